@@ -106,12 +106,30 @@ def if_has_avx512(a, b = []):
         "//conditions:default": b,
     })
 
+def if_has_avx512_ifma(a, b = []):
+    return select({
+        "@kroma_network_tachyon//:tachyon_has_avx512_ifma": a,
+        "//conditions:default": b,
+    })
+
+def if_has_gfni(a, b = []):
+    return select({
+        "@kroma_network_tachyon//:tachyon_has_gfni": a,
+        "//conditions:default": b,
+    })
+
 def if_has_matplotlib(a, b = []):
     return select({
         "@kroma_network_tachyon//:tachyon_has_matplotlib": a,
         "//conditions:default": b,
     })
 
+def if_has_trace_event(a, b = []):
+    return select({
+        "@kroma_network_tachyon//:tachyon_has_trace_event": a,
+        "//conditions:default": b,
+    })
+
 def if_has_numa(a, b = []):
     return select({
         "@kroma_network_tachyon//:tachyon_has_numa": a,
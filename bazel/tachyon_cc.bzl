@@ -1,10 +1,13 @@
 load("@local_config_cuda//cuda:build_defs.bzl", "cuda_library", "if_cuda")
+load("@local_config_rocm//rocm:build_defs.bzl", "if_rocm", "rocm_default_copts")
 load("@rules_cc//cc:defs.bzl", "cc_binary", "cc_library", "cc_test", "objc_library")
 load(
     "//bazel:tachyon.bzl",
     "if_has_asm_prime_field",
     "if_has_avx512",
+    "if_has_avx512_ifma",
     "if_has_exception",
+    "if_has_gfni",
     "if_has_matplotlib",
     "if_has_openmp",
     "if_has_rtti",
@@ -52,6 +55,12 @@ def tachyon_openmp_defines():
 def tachyon_avx512_defines():
     return if_has_avx512(["TACHYON_HAS_AVX512"])
 
+def tachyon_avx512_ifma_defines():
+    return if_has_avx512_ifma(["TACHYON_HAS_AVX512_IFMA"])
+
+def tachyon_gfni_defines():
+    return if_has_gfni(["TACHYON_HAS_GFNI"])
+
 def tachyon_asm_prime_field_defines():
     return if_has_asm_prime_field(["TACHYON_HAS_ASM_PRIME_FIELD"])
 
@@ -288,14 +297,20 @@ def tachyon_cuda_library(
         safe_code = True,
         force_exceptions = False,
         force_rtti = False,
+        deps = [],
         **kwargs):
+    # NOTE: Under --config=rocm, the sources are compiled as HIP by
+    # |rocm_default_copts()|, which is empty otherwise.
     cuda_library(
         name = name,
-        copts = copts + tachyon_cxxopts(safe_code = safe_code, force_exceptions = force_exceptions, force_rtti = force_rtti),
+        copts = copts + tachyon_cxxopts(safe_code = safe_code, force_exceptions = force_exceptions, force_rtti = force_rtti) + rocm_default_copts(),
         defines = defines + tachyon_defines(use_cuda = True),
         local_defines = local_defines + tachyon_local_defines(),
         linkopts = linkopts + tachyon_linkopts(),
         alwayslink = alwayslink,
+        deps = deps + if_rocm([
+            "@local_config_rocm//rocm:rocm_headers",
+        ]),
         **kwargs
     )
 
@@ -309,6 +324,8 @@ def tachyon_cuda_binary(
         name = lib_name,
         deps = deps + if_cuda([
             "@local_config_cuda//cuda:cudart_static",
+        ]) + if_rocm([
+            "@local_config_rocm//rocm:hip",
         ]),
         testonly = testonly,
         **kwargs
@@ -331,6 +348,8 @@ def tachyon_cuda_test(
         name = lib_name,
         deps = deps + if_cuda([
             "@local_config_cuda//cuda:cudart_static",
+        ]) + if_rocm([
+            "@local_config_rocm//rocm:hip",
         ]) + [
             "@com_google_googletest//:gtest",
         ],
@@ -0,0 +1,234 @@
+// Measures the knobs of |base::TuningProfile| on this machine and writes them
+// to a profile, which is loaded from $TACHYON_TUNING_PROFILE_PATH or by
+// tachyon_load_tuning_profile().
+//
+//   bazel run -c opt //benchmark/calibration -- -k 16 -k 20 \
+//       --num_threads 8 --num_threads 16 --output /path/to/profile.tsv
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/ranges/algorithm.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/base/tuning_profile.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+namespace tachyon {
+
+using namespace math;
+
+namespace {
+
+using Point = bn254::G1AffinePoint;
+using Domain = Radix2EvaluationDomain<bn254::Fr>;
+
+constexpr PippengerParallelStrategy kStrategies[] = {
+    PippengerParallelStrategy::kNone,
+    PippengerParallelStrategy::kParallelWindow,
+    PippengerParallelStrategy::kParallelTerm,
+    PippengerParallelStrategy::kParallelWindowAndTerm,
+};
+
+// The ratios of the domain size to the polynomial size that the degree aware
+// FFT is measured at.
+constexpr size_t kFFTRatios[] = {2, 4, 8, 16};
+
+// Returns the shortest time of |fn| in seconds out of |repeats| runs.
+template <typename Fn>
+double Measure(size_t repeats, Fn&& fn) {
+  double best = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < repeats; ++i) {
+    base::TimeTicks now = base::TimeTicks::Now();
+    fn();
+    best = std::min(best, (base::TimeTicks::Now() - now).InSecondsF());
+  }
+  return best;
+}
+
+double MeasureMSM(const VariableBaseMSMTestSet<Point>& test_set, size_t size,
+                  PippengerParallelStrategy strategy, size_t repeats) {
+  PippengerAdapter<Point> pippenger;
+  return Measure(repeats, [&]() {
+    bn254::G1PointXYZZ bucket;
+    CHECK(pippenger.RunWithStrategy(
+        test_set.bases.begin(), test_set.bases.begin() + size,
+        test_set.scalars.begin(), test_set.scalars.begin() + size, strategy,
+        &bucket));
+  });
+}
+
+// Returns the fastest strategy for the MSMs of |size|.
+PippengerParallelStrategy CalibrateMSM(
+    const VariableBaseMSMTestSet<Point>& test_set, size_t size,
+    size_t repeats) {
+  PippengerParallelStrategy best_strategy = PippengerParallelStrategy::kNone;
+  double best = std::numeric_limits<double>::max();
+  for (PippengerParallelStrategy strategy : kStrategies) {
+    double time = MeasureMSM(test_set, size, strategy, repeats);
+    std::cout << "  " << PippengerParallelStrategyToString(strategy) << ": "
+              << time << "s" << std::endl;
+    if (time < best) {
+      best = time;
+      best_strategy = strategy;
+    }
+  }
+  return best_strategy;
+}
+
+// Returns the smallest ratio of the domain size to the polynomial size from
+// which the degree aware FFT is faster than the full one over the domain of
+// |size|. The factor is forced through the default profile, since it is read
+// by |Domain::DoFFT()|.
+size_t CalibrateFFT(size_t size, size_t repeats) {
+  base::TuningProfile& profile = base::TuningProfile::GetDefault();
+  std::unique_ptr<Domain> domain = Domain::Create(size);
+  size_t ret = size + 1;
+  for (size_t ratio : kFFTRatios) {
+    if (size / ratio == 0) break;
+    Domain::DensePoly poly = Domain::DensePoly::Random(size / ratio - 1);
+
+    profile.Set(base::TuningProfile::kDegreeAwareFFTThresholdFactor, 0,
+                base::NumberToString(ratio));
+    double degree_aware =
+        Measure(repeats, [&]() { Domain::Evals evals = domain->FFT(poly); });
+    profile.Set(base::TuningProfile::kDegreeAwareFFTThresholdFactor, 0,
+                base::NumberToString(size + 1));
+    double full =
+        Measure(repeats, [&]() { Domain::Evals evals = domain->FFT(poly); });
+    std::cout << "  1/" << ratio << ": degree aware " << degree_aware
+              << "s, full " << full << "s" << std::endl;
+    if (degree_aware < full) {
+      ret = ratio;
+      break;
+    }
+  }
+  profile.Clear();
+  return ret;
+}
+
+}  // namespace
+
+int RealMain(int argc, char** argv) {
+  std::vector<uint64_t> exponents;
+  std::vector<uint64_t> num_threads_list;
+  size_t repeats = 3;
+  std::string output_path;
+
+  base::FlagParser parser;
+  // clang-format off
+  parser.AddFlag<base::Flag<std::vector<uint64_t>>>(&exponents)
+      .set_short_name("-k")
+      .set_required()
+      .set_help("Specify the exponent 'k' where the size of the MSMs and the FFTs to calibrate is 2ᵏ.");
+  // clang-format on
+  parser.AddFlag<base::Flag<std::vector<uint64_t>>>(&num_threads_list)
+      .set_long_name("--num_threads")
+      .set_help(
+          "The numbers of the threads to try on the largest MSM. The number "
+          "of the threads isn't written to the profile if not specified.");
+  parser.AddFlag<base::Flag<size_t>>(&repeats)
+      .set_long_name("--repeats")
+      .set_help("The number of the runs of each measurement. 3 by default.");
+  parser.AddFlag<base::StringFlag>(&output_path)
+      .set_long_name("--output")
+      .set_required()
+      .set_help("The path to write the profile to.");
+  {
+    std::string error;
+    if (!parser.Parse(argc, argv, &error)) {
+      tachyon_cerr << error << std::endl;
+      return 1;
+    }
+  }
+  if (repeats == 0) {
+    tachyon_cerr << "--repeats must be positive" << std::endl;
+    return 1;
+  }
+  base::ranges::sort(exponents);  // NOLINT
+
+  bn254::G1Curve::Init();
+  // The measurements shouldn't be affected by the profile of
+  // $TACHYON_TUNING_PROFILE_PATH.
+  base::TuningProfile::GetDefault().Clear();
+  base::TuningProfile profile;
+
+  std::cout << "Generating random points..." << std::endl;
+  size_t max_size = size_t{1} << exponents.back();
+  VariableBaseMSMTestSet<Point> test_set =
+      VariableBaseMSMTestSet<Point>::Random(max_size,
+                                            VariableBaseMSMMethod::kNone);
+  std::cout << "Generation completed" << std::endl;
+
+  PippengerParallelStrategy largest_strategy =
+      PippengerParallelStrategy::kParallelTerm;
+  for (uint64_t exponent : exponents) {
+    std::cout << "MSM 2^" << exponent << std::endl;
+    largest_strategy = CalibrateMSM(test_set, size_t{1} << exponent, repeats);
+    profile.Set(base::TuningProfile::kPippengerParallelStrategy,
+                static_cast<uint32_t>(exponent),
+                PippengerParallelStrategyToString(largest_strategy));
+  }
+
+  for (uint64_t exponent : exponents) {
+    std::cout << "FFT 2^" << exponent << std::endl;
+    size_t factor = CalibrateFFT(size_t{1} << exponent, repeats);
+    profile.Set(base::TuningProfile::kDegreeAwareFFTThresholdFactor,
+                static_cast<uint32_t>(exponent), base::NumberToString(factor));
+  }
+
+#if defined(TACHYON_HAS_OPENMP)
+  if (!num_threads_list.empty()) {
+    int max_threads = omp_get_max_threads();
+    uint64_t best_num_threads = 0;
+    double best = std::numeric_limits<double>::max();
+    for (uint64_t num_threads : num_threads_list) {
+      if (num_threads == 0) continue;
+      omp_set_num_threads(static_cast<int>(num_threads));
+      double time = MeasureMSM(test_set, max_size, largest_strategy, repeats);
+      std::cout << "MSM 2^" << exponents.back() << " with " << num_threads
+                << " threads: " << time << "s" << std::endl;
+      if (time < best) {
+        best = time;
+        best_num_threads = num_threads;
+      }
+    }
+    omp_set_num_threads(max_threads);
+    if (best_num_threads != 0) {
+      profile.Set(base::TuningProfile::kNumThreads, 0,
+                  base::NumberToString(best_num_threads));
+    }
+  }
+#else
+  if (!num_threads_list.empty()) {
+    tachyon_cerr << "--num_threads is ignored without OpenMP" << std::endl;
+  }
+#endif
+
+  if (!profile.Save(base::FilePath(output_path))) {
+    tachyon_cerr << "Failed to write the profile to " << output_path
+                 << std::endl;
+    return 1;
+  }
+  std::cout << profile.ToString();
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
@@ -0,0 +1,310 @@
+// Compares the results of the benchmark runs written as JSONs by
+// |SimpleBenchmarkReporter::WriteResults()|, e.g.,
+//
+//   bazel run -c opt //benchmark:compare_results -- \
+//     --base base_1.json --base base_2.json --base base_3.json \
+//     --new new_1.json --new new_2.json --new new_3.json
+//
+// The times of the same target and vendor are summarized by their median and
+// standard deviation over the repetitions. A result regresses if its median
+// is slower than the base one by more than the threshold and by more than the
+// noise, i.e., |--num_stddevs| times the larger standard deviation. It exits
+// with 1 if any result regresses, so that it can gate the upgrades.
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/str_format.h"
+#include "rapidjson/document.h"
+#include "rapidjson/error/en.h"
+
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/console/table_writer.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon {
+
+namespace {
+
+struct Environment {
+  std::string cpu_model;
+  size_t num_threads = 0;
+  std::string gpu;
+  std::string tachyon_version;
+
+  // NOTE: |tachyon_version| is not compared, since it is what usually differs
+  // between the runs to compare.
+  bool operator==(const Environment& other) const {
+    return cpu_model == other.cpu_model && num_threads == other.num_threads &&
+           gpu == other.gpu;
+  }
+  bool operator!=(const Environment& other) const { return !operator==(other); }
+
+  std::string ToString() const {
+    return absl::StrFormat("cpu: \"%s\", threads: %d, gpu: \"%s\", tachyon: %s",
+                           cpu_model, num_threads, gpu, tachyon_version);
+  }
+};
+
+struct Samples {
+  std::string target;
+  std::string vendor;
+  std::vector<double> base_times;
+  std::vector<double> new_times;
+};
+
+class Comparison {
+ public:
+  const std::vector<Samples>& samples() const { return samples_; }
+
+  // Adds the times in the JSON at |path| to the base or the new ones.
+  [[nodiscard]] bool Load(const base::FilePath& path, bool is_base,
+                          std::optional<Environment>* environment) {
+    std::string content;
+    if (!base::ReadFileToString(path, &content)) {
+      tachyon_cerr << "Failed to read " << path.value() << std::endl;
+      return false;
+    }
+    rapidjson::Document document;
+    document.Parse(content.data(), content.size());
+    if (document.HasParseError()) {
+      tachyon_cerr << "Failed to parse " << path.value() << ": "
+                   << rapidjson::GetParseError_En(document.GetParseError())
+                   << std::endl;
+      return false;
+    }
+    if (!document.IsObject() || !document.HasMember("results") ||
+        !document["results"].IsArray()) {
+      tachyon_cerr << path.value() << " has no results" << std::endl;
+      return false;
+    }
+
+    if (document.HasMember("environment") &&
+        document["environment"].IsObject()) {
+      Environment env = ParseEnvironment(document["environment"]);
+      if (!environment->has_value()) {
+        *environment = std::move(env);
+      } else if (**environment != env) {
+        tachyon_cerr << "WARNING: " << path.value()
+                     << " was run on a different environment: "
+                     << env.ToString() << std::endl;
+      }
+    }
+
+    for (const rapidjson::Value& result : document["results"].GetArray()) {
+      if (!result.IsObject() || !IsStringMember(result, "target") ||
+          !IsStringMember(result, "vendor") || !result.HasMember("time_sec") ||
+          !result["time_sec"].IsNumber()) {
+        tachyon_cerr << path.value() << " has a malformed result" << std::endl;
+        return false;
+      }
+      Samples& samples = GetSamples(result["target"].GetString(),
+                                    result["vendor"].GetString());
+      double time = result["time_sec"].GetDouble();
+      if (is_base) {
+        samples.base_times.push_back(time);
+      } else {
+        samples.new_times.push_back(time);
+      }
+    }
+    return true;
+  }
+
+ private:
+  static bool IsStringMember(const rapidjson::Value& object,
+                             const char* name) {
+    return object.HasMember(name) && object[name].IsString();
+  }
+
+  static Environment ParseEnvironment(const rapidjson::Value& object) {
+    Environment ret;
+    if (IsStringMember(object, "cpu_model")) {
+      ret.cpu_model = object["cpu_model"].GetString();
+    }
+    if (object.HasMember("num_threads") && object["num_threads"].IsUint64()) {
+      ret.num_threads = object["num_threads"].GetUint64();
+    }
+    if (IsStringMember(object, "gpu")) {
+      ret.gpu = object["gpu"].GetString();
+    }
+    if (IsStringMember(object, "tachyon_version")) {
+      ret.tachyon_version = object["tachyon_version"].GetString();
+    }
+    return ret;
+  }
+
+  // NOTE: The samples are kept in the order they first appear, which is the
+  // order of the rows of the benchmark.
+  Samples& GetSamples(const std::string& target, const std::string& vendor) {
+    auto [it, inserted] =
+        indices_.try_emplace(std::make_pair(target, vendor), samples_.size());
+    if (inserted) {
+      samples_.push_back({target, vendor, {}, {}});
+    }
+    return samples_[it->second];
+  }
+
+  std::vector<Samples> samples_;
+  absl::flat_hash_map<std::pair<std::string, std::string>, size_t> indices_;
+};
+
+double Median(std::vector<double> values) {
+  std::sort(values.begin(), values.end());
+  size_t mid = values.size() / 2;
+  if (values.size() % 2 == 1) return values[mid];
+  return (values[mid - 1] + values[mid]) / 2;
+}
+
+// Returns the sample standard deviation, or 0 if there is only one value.
+double StdDev(const std::vector<double>& values) {
+  if (values.size() < 2) return 0;
+  double mean = 0;
+  for (double value : values) {
+    mean += value;
+  }
+  mean /= values.size();
+  double sum = 0;
+  for (double value : values) {
+    sum += (value - mean) * (value - mean);
+  }
+  return std::sqrt(sum / (values.size() - 1));
+}
+
+}  // namespace
+
+int RealMain(int argc, char** argv) {
+  std::vector<std::string> base_paths;
+  std::vector<std::string> new_paths;
+  double threshold = 5;
+  double num_stddevs = 2;
+
+  base::FlagParser parser;
+  parser.AddFlag<base::Flag<std::vector<std::string>>>(&base_paths)
+      .set_long_name("--base")
+      .set_required()
+      .set_help(
+          "The JSON of a run to compare against. It can be given more than "
+          "once for the repetitions of the run.");
+  parser.AddFlag<base::Flag<std::vector<std::string>>>(&new_paths)
+      .set_long_name("--new")
+      .set_required()
+      .set_help(
+          "The JSON of a run to compare. It can be given more than once for "
+          "the repetitions of the run.");
+  parser.AddFlag<base::Flag<double>>(&threshold)
+      .set_long_name("--threshold")
+      .set_help(
+          "The percentage of the slowdown of a median that is regarded as a "
+          "regression. By default, 5.");
+  parser.AddFlag<base::Flag<double>>(&num_stddevs)
+      .set_long_name("--num_stddevs")
+      .set_help(
+          "The number of the standard deviations that a slowdown should also "
+          "exceed to be regarded as a regression. By default, 2.");
+  {
+    std::string error;
+    if (!parser.Parse(argc, argv, &error)) {
+      tachyon_cerr << error << std::endl;
+      return 1;
+    }
+  }
+  if (threshold < 0 || num_stddevs < 0) {
+    tachyon_cerr << "threshold and num_stddevs should not be negative"
+                 << std::endl;
+    return 1;
+  }
+
+  Comparison comparison;
+  std::optional<Environment> base_environment;
+  std::optional<Environment> new_environment;
+  for (const std::string& path : base_paths) {
+    if (!comparison.Load(base::FilePath(path), /*is_base=*/true,
+                         &base_environment)) {
+      return 1;
+    }
+  }
+  for (const std::string& path : new_paths) {
+    if (!comparison.Load(base::FilePath(path), /*is_base=*/false,
+                         &new_environment)) {
+      return 1;
+    }
+  }
+  if (base_environment.has_value()) {
+    std::cout << "base: " << base_environment->ToString() << std::endl;
+  }
+  if (new_environment.has_value()) {
+    std::cout << "new: " << new_environment->ToString() << std::endl;
+  }
+  if (base_environment.has_value() && new_environment.has_value() &&
+      *base_environment != *new_environment) {
+    tachyon_cerr << "WARNING: The runs were on different environments"
+                 << std::endl;
+  }
+
+  base::TableWriterBuilder builder;
+  builder.AlignHeaderLeft()
+      .AddSpace(1)
+      .FitToTerminalWidth()
+      .StripTrailingAsciiWhitespace();
+  for (std::string_view column :
+       {"target", "vendor", "base_median", "base_stddev", "new_median",
+        "new_stddev", "change", "status"}) {
+    builder.AddColumn(column);
+  }
+  base::TableWriter writer = builder.Build();
+
+  size_t num_regressions = 0;
+  for (size_t i = 0; i < comparison.samples().size(); ++i) {
+    const Samples& samples = comparison.samples()[i];
+    writer.SetElement(i, 0, samples.target);
+    writer.SetElement(i, 1, samples.vendor);
+    if (samples.base_times.empty() || samples.new_times.empty()) {
+      writer.SetElement(i, 7, samples.base_times.empty() ? "added" : "removed");
+      continue;
+    }
+
+    double base_median = Median(samples.base_times);
+    double base_stddev = StdDev(samples.base_times);
+    double new_median = Median(samples.new_times);
+    double new_stddev = StdDev(samples.new_times);
+    double diff = new_median - base_median;
+    double noise = num_stddevs * std::max(base_stddev, new_stddev);
+    double change = base_median > 0 ? diff / base_median * 100 : 0;
+    std::string_view status;
+    if (change > threshold && diff > noise) {
+      status = "regressed";
+      ++num_regressions;
+    } else if (change < -threshold && -diff > noise) {
+      status = "improved";
+    }
+
+    writer.SetElement(i, 2, base::NumberToString(base_median));
+    writer.SetElement(i, 3, base::NumberToString(base_stddev));
+    writer.SetElement(i, 4, base::NumberToString(new_median));
+    writer.SetElement(i, 5, base::NumberToString(new_stddev));
+    writer.SetElement(i, 6, absl::StrFormat("%+.2f%%", change));
+    writer.SetElement(i, 7, status);
+  }
+  writer.Print(true);
+
+  if (num_regressions > 0) {
+    tachyon_cerr << num_regressions << " result(s) regressed" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
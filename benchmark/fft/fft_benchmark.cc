@@ -10,6 +10,7 @@
 // clang-format on
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_evaluation_domain.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/mixed_radix_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
 
@@ -71,12 +72,30 @@ void Run(const FFTConfig& config) {
   for (const FFTConfig::Vendor vendor : config.vendors()) {
     reporter.AddVendor(FFTConfig::VendorToString(vendor));
   }
+  if (config.perf_counters()) {
+    CHECK(reporter.EnablePerfCounters());
+  }
+
+  using F = typename Domain::Field;
+  using MixedRadixDomain = MixedRadixEvaluationDomain<F, Domain::kMaxDegree>;
 
   std::vector<uint64_t> degrees = config.GetDegrees();
+  if (config.mixed_radix()) {
+    for (uint64_t& degree : degrees) {
+      degree *= F::Config::kSmallSubgroupBase;
+    }
+  }
 
   std::cout << "Generating evaluation domain and random polys..." << std::endl;
-  std::vector<std::unique_ptr<Domain>> domains = base::Map(
-      degrees, [](uint64_t degree) { return Domain::Create(degree); });
+  std::vector<std::unique_ptr<Domain>> domains =
+      base::Map(degrees, [&config](uint64_t degree) {
+        // NOTE: |Domain::Create()| prefers the radix-2 domain of size
+        // 2^⌈log₂(3 * 2ᵏ)⌉, so the mixed-radix domain is created explicitly.
+        if (config.mixed_radix()) {
+          return std::unique_ptr<Domain>(MixedRadixDomain::Create(degree));
+        }
+        return Domain::Create(degree);
+      });
   std::vector<PolyOrEvals> polys = base::Map(
       degrees, [](uint64_t degree) { return PolyOrEvals::Random(degree); });
   std::cout << "Generation completed" << std::endl;
@@ -122,6 +141,9 @@ void Run(const FFTConfig& config) {
   }
 
   reporter.Show();
+  if (!config.output_path().empty()) {
+    CHECK(reporter.WriteResults(base::FilePath(config.output_path())));
+  }
 }
 
 int RealMain(int argc, char** argv) {
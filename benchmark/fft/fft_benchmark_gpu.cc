@@ -0,0 +1,107 @@
+#if TACHYON_CUDA
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// clang-format off
+#include "benchmark/fft/fft_config.h"
+#include "benchmark/fft/simple_fft_benchmark_reporter.h"
+// clang-format on
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/kernels/bn254_radix2_ntt_kernels.cu.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain_gpu.h"
+
+namespace tachyon {
+
+using namespace math;
+
+template <typename Domain, typename PolyOrEvals, typename RetPoly>
+void RunAndRecord(const std::vector<std::unique_ptr<Domain>>& domains,
+                  const std::vector<PolyOrEvals>& polys,
+                  SimpleFFTBenchmarkReporter& reporter,
+                  std::vector<RetPoly>* results) {
+  for (size_t i = 0; i < domains.size(); ++i) {
+    base::TimeTicks now = base::TimeTicks::Now();
+    if constexpr (std::is_same_v<RetPoly, typename Domain::DensePoly>) {
+      results->push_back(domains[i]->IFFT(polys[i]));
+    } else {
+      results->push_back(domains[i]->FFT(polys[i]));
+    }
+    reporter.AddTime(i, (base::TimeTicks::Now() - now).InSecondsF());
+  }
+}
+
+template <typename PolyOrEvals, typename RetPoly>
+void Run(const FFTConfig& config) {
+  using F = bn254::Fr;
+  constexpr size_t kMaxDegree = SIZE_MAX - 1;
+  using CpuDomain = Radix2EvaluationDomain<F, kMaxDegree>;
+  using GpuDomain = Radix2EvaluationDomainGpu<F, kMaxDegree>;
+
+  SimpleFFTBenchmarkReporter reporter("(I)FFT Benchmark GPU",
+                                      config.exponents());
+  reporter.AddVendor("tachyon_gpu");
+
+  std::vector<uint64_t> degrees = config.GetDegrees();
+
+  std::cout << "Generating evaluation domain and random polys..." << std::endl;
+  std::vector<std::unique_ptr<CpuDomain>> cpu_domains = base::Map(
+      degrees, [](uint64_t degree) { return CpuDomain::Create(degree); });
+  std::vector<std::unique_ptr<GpuDomain>> gpu_domains = base::Map(
+      degrees, [](uint64_t degree) { return GpuDomain::Create(degree); });
+  std::vector<PolyOrEvals> polys = base::Map(
+      degrees, [](uint64_t degree) { return PolyOrEvals::Random(degree - 1); });
+  std::cout << "Generation completed" << std::endl;
+
+  std::vector<RetPoly> results_cpu;
+  RunAndRecord(cpu_domains, polys, reporter, &results_cpu);
+  std::vector<RetPoly> results_gpu;
+  RunAndRecord(gpu_domains, polys, reporter, &results_gpu);
+
+  if (config.check_results()) {
+    CHECK(results_cpu == results_gpu) << "Results not matched";
+  }
+
+  reporter.Show();
+}
+
+int RealMain(int argc, char** argv) {
+  using F = bn254::Fr;
+  constexpr size_t kMaxDegree = SIZE_MAX - 1;
+  using DensePoly = UnivariateDensePolynomial<F, kMaxDegree>;
+  using Evals = UnivariateEvaluations<F, kMaxDegree>;
+
+  F::Init();
+
+  FFTConfig config;
+  if (!config.Parse(argc, argv)) {
+    return 1;
+  }
+
+  if (config.run_ifft()) {
+    Run<Evals, DensePoly>(config);
+  } else {
+    Run<DensePoly, Evals>(config);
+  }
+
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
+#else
+#include "tachyon/base/console/iostream.h"
+
+int main(int argc, char **argv) {
+  tachyon_cerr << "please build with --config cuda" << std::endl;
+  return 1;
+}
+#endif  // TACHYON_CUDA
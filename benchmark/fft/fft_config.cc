@@ -58,9 +58,25 @@ bool FFTConfig::Parse(int argc, char** argv) {
   parser.AddFlag<base::BoolFlag>(&run_ifft_)
       .set_long_name("--run_ifft")
       .set_help("Run IFFT benchmark. Default is FFT benchmark.");
+  parser.AddFlag<base::BoolFlag>(&mixed_radix_)
+      .set_long_name("--mixed_radix")
+      .set_help(
+          "Run the benchmark on the mixed-radix domains of size q * 2ᵏ, "
+          "where q is the small subgroup base of the field, instead of the "
+          "radix-2 domains. It can't be used with --vendor.");
   parser.AddFlag<base::BoolFlag>(&check_results_)
       .set_long_name("--check_results")
       .set_help("Whether checks results generated by each fft runner.");
+  parser.AddFlag<base::BoolFlag>(&perf_counters_)
+      .set_long_name("--perf_counters")
+      .set_help(
+          "Whether counts the cycles, instructions, LLC misses and dTLB "
+          "misses of each run. Only supported on Linux.");
+  parser.AddFlag<base::StringFlag>(&output_path_)
+      .set_long_name("--output")
+      .set_help(
+          "Writes the results to the path as a JSON if it ends with "
+          "\".json\", or as a CSV otherwise.");
   parser.AddFlag<base::Flag<std::vector<Vendor>>>(&vendors_)
       .set_long_name("--vendor")
       .set_help(
@@ -74,6 +90,12 @@ bool FFTConfig::Parse(int argc, char** argv) {
     }
   }
 
+  if (mixed_radix_ && !vendors_.empty()) {
+    tachyon_cerr << "The vendors only support the domains of size 2ᵏ"
+                 << std::endl;
+    return false;
+  }
+
   base::ranges::sort(exponents_);  // NOLINT
   return true;
 }
@@ -25,7 +25,10 @@ class FFTConfig {
   const std::vector<uint64_t>& exponents() const { return exponents_; }
   const std::vector<Vendor>& vendors() const { return vendors_; }
   bool run_ifft() const { return run_ifft_; }
+  bool mixed_radix() const { return mixed_radix_; }
   bool check_results() const { return check_results_; }
+  bool perf_counters() const { return perf_counters_; }
+  const std::string& output_path() const { return output_path_; }
 
   bool Parse(int argc, char** argv);
 
@@ -35,7 +38,10 @@ class FFTConfig {
   std::vector<uint64_t> exponents_;
   std::vector<Vendor> vendors_;
   bool run_ifft_ = false;
+  bool mixed_radix_ = false;
   bool check_results_ = false;
+  bool perf_counters_ = false;
+  std::string output_path_;
 };
 
 }  // namespace tachyon
@@ -55,13 +55,15 @@ class FFTRunner {
            std::vector<RetPoly>* results) {
     for (size_t i = 0; i < degrees.size(); ++i) {
       PolyOrEvals poly = (*polys_)[i];
+      PerfCounters::Values counters = reporter_->ReadPerfCounters();
       base::TimeTicks now = base::TimeTicks::Now();
       std::unique_ptr<CRetPoly> ret;
       ret.reset(fn(
           reinterpret_cast<const tachyon_bn254_univariate_evaluation_domain*>(
               domains_[i].get()),
           reinterpret_cast<CPolyOrEvals>(&poly)));
-      reporter_->AddTime(i, (base::TimeTicks::Now() - now).InSecondsF());
+      reporter_->AddTime(i, (base::TimeTicks::Now() - now).InSecondsF(),
+                         counters);
       results->push_back(*reinterpret_cast<RetPoly*>(ret.get()));
     }
   }
@@ -73,6 +75,7 @@ class FFTRunner {
       uint64_t duration_in_us;
 
       std::unique_ptr<F> ret;
+      PerfCounters::Values counters = reporter_->ReadPerfCounters();
       if constexpr (std::is_same_v<PolyOrEvals, typename Domain::Evals>) {
         const F omega_inv = domains_[i]->group_gen_inv();
         ret.reset(c::base::native_cast(
@@ -93,7 +96,8 @@ class FFTRunner {
         std::vector<F> res_vec(ret.get(), ret.get() + (*polys_)[i].Degree());
         results->emplace_back(std::move(res_vec));
       }
-      reporter_->AddTime(i, base::Microseconds(duration_in_us).InSecondsF());
+      reporter_->AddTime(i, base::Microseconds(duration_in_us).InSecondsF(),
+                         counters);
     }
   }
 
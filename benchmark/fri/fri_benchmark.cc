@@ -0,0 +1,240 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+
+// clang-format off
+#include "benchmark/fri/fri_config.h"
+#include "benchmark/fri/poseidon2_binary_merkle_hasher.h"
+#include "benchmark/fri/simple_fri_benchmark_reporter.h"
+// clang-format on
+#include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/random.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/crypto/commitments/fri/fri.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/blocked_binary_merkle_tree_storage.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/baby_bear_t16_poseidon2_config.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/goldilocks_t8_poseidon2_config.h"
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+
+namespace tachyon {
+
+extern "C" void run_fri_plonky3_baby_bear(uint32_t k, uint32_t log_blowup,
+                                          size_t num_queries,
+                                          uint64_t* commit_duration_in_us,
+                                          uint64_t* open_duration_in_us);
+
+extern "C" void run_fri_plonky3_goldilocks(uint32_t k, uint32_t log_blowup,
+                                           size_t num_queries,
+                                           uint64_t* commit_duration_in_us,
+                                           uint64_t* open_duration_in_us);
+
+namespace {
+
+constexpr size_t kMaxDegree = SIZE_MAX - 1;
+
+struct Row {
+  FRIConfig::Field field;
+  uint32_t k;
+  uint32_t blowup;
+
+  std::string ToString() const {
+    return absl::Substitute("$0 2^$1 x$2", FRIConfig::FieldToString(field), k,
+                            blowup);
+  }
+};
+
+template <typename F>
+class FRIStorageImpl : public crypto::FRIStorage<F> {
+ public:
+  // crypto::FRIStorage<F> methods
+  void Allocate(size_t size) override { layers_.resize(size); }
+  crypto::BinaryMerkleTreeStorage<F>* GetLayer(size_t index) override {
+    return &layers_[index];
+  }
+
+ private:
+  std::vector<crypto::BlockedBinaryMerkleTreeStorage<F>> layers_;
+};
+
+// Runs |callback| and adds its time to the next column of |row|. Returns the
+// time in seconds.
+template <typename Callable>
+double Measure(SimpleFRIBenchmarkReporter& reporter, size_t row,
+               Callable callback) {
+  PerfCounters::Values counters = reporter.ReadPerfCounters();
+  base::TimeTicks start = base::TimeTicks::Now();
+  callback();
+  double time = (base::TimeTicks::Now() - start).InSecondsF();
+  reporter.AddTime(row, time, counters);
+  return time;
+}
+
+// Commits to a random polynomial of degree 2ᵏ - 1 over the domain blown up
+// by |blowup| and opens |config.num_queries()| random queries.
+template <typename F>
+void RunTachyon(const FRIConfig& config,
+                const crypto::Poseidon2Config<F>& poseidon2_config,
+                const Row& row_info, size_t row,
+                SimpleFRIBenchmarkReporter& reporter) {
+  using PCS = crypto::FRI<F, kMaxDegree>;
+  using Poly = typename PCS::Poly;
+  using Evals = typename PCS::Evals;
+  using Domain = typename PCS::Domain;
+
+  size_t n = size_t{1} << row_info.k;
+  size_t lde_size = n * row_info.blowup;
+  std::unique_ptr<Domain> domain = Domain::Create(lde_size);
+  Poseidon2BinaryMerkleHasher<F> hasher(poseidon2_config);
+  Poly poly = Poly::Random(n - 1);
+
+  // NOTE: The LDE and the Merkle tree of the first layer are measured apart
+  // from the commitment, which goes through both and folds every layer.
+  Evals evals;
+  Measure(reporter, row, [&]() { evals = domain->FFT(poly); });
+  crypto::BlockedBinaryMerkleTreeStorage<F> tree_storage;
+  crypto::BinaryMerkleTree<F, F, kMaxDegree + 1> tree(&tree_storage, &hasher);
+  Measure(reporter, row, [&]() {
+    F root;
+    CHECK(tree.Commit(evals.evaluations(), &root));
+  });
+
+  FRIStorageImpl<F> storage;
+  PCS pcs(domain.get(), &storage, &hasher, config.arity());
+  crypto::SimpleTranscriptWriter<F> writer((base::Uint8VectorBuffer()));
+  double commit_time =
+      Measure(reporter, row, [&]() { CHECK(pcs.Commit(poly, &writer)); });
+
+  std::vector<size_t> indices =
+      base::CreateVector(config.num_queries(), [lde_size]() {
+        return base::Uniform(base::Range<size_t>::Until(lde_size));
+      });
+  crypto::FRIProof<F> proof;
+  double open_time = Measure(reporter, row, [&]() {
+    CHECK(pcs.CreateOpeningProof(indices, &proof));
+  });
+  reporter.AddTime(row, commit_time + open_time);
+
+  if (config.check_results()) {
+    crypto::SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+    reader.buffer().set_buffer_offset(0);
+    CHECK(pcs.VerifyOpeningProof(reader, indices, proof))
+        << "Proof not verified";
+  }
+}
+
+void RunVendor(const FRIConfig& config, FRIConfig::Vendor vendor,
+               const Row& row_info, size_t row,
+               SimpleFRIBenchmarkReporter& reporter) {
+  uint32_t log_blowup = base::bits::Log2Floor(row_info.blowup);
+  uint64_t commit_duration_in_us = 0;
+  uint64_t open_duration_in_us = 0;
+  switch (vendor) {
+    case FRIConfig::Vendor::kPlonky3:
+      if (row_info.field == FRIConfig::Field::kBabyBear) {
+        run_fri_plonky3_baby_bear(row_info.k, log_blowup,
+                                  config.num_queries(),
+                                  &commit_duration_in_us,
+                                  &open_duration_in_us);
+      } else {
+        run_fri_plonky3_goldilocks(row_info.k, log_blowup,
+                                   config.num_queries(),
+                                   &commit_duration_in_us,
+                                   &open_duration_in_us);
+      }
+      break;
+  }
+  double commit_time = base::Microseconds(commit_duration_in_us).InSecondsF();
+  double open_time = base::Microseconds(open_duration_in_us).InSecondsF();
+  // NOTE: The hardware events are not counted for the vendors, since their
+  // setup can't be excluded.
+  reporter.AddTime(row, commit_time);
+  reporter.AddTime(row, open_time);
+  reporter.AddTime(row, commit_time + open_time);
+}
+
+}  // namespace
+
+int RealMain(int argc, char** argv) {
+  math::BabyBear::Init();
+  math::Goldilocks::Init();
+
+  FRIConfig config;
+  if (!config.Parse(argc, argv)) {
+    return 1;
+  }
+
+  std::vector<Row> rows;
+  for (FRIConfig::Field field : config.fields()) {
+    for (uint32_t blowup : config.blowups()) {
+      for (uint32_t k : config.exponents()) {
+        Row row{field, k, blowup};
+        if (k + base::bits::Log2Floor(blowup) >
+            FRIConfig::GetTwoAdicity(field)) {
+          std::cout << "Skipping " << row.ToString()
+                    << ", whose LDE doesn't fit in the two-adic subgroup"
+                    << std::endl;
+          continue;
+        }
+        rows.push_back(row);
+      }
+    }
+  }
+
+  // NOTE: "commit" is the LDE, the Merkle trees and the folding of every
+  // layer, and "open" is the queries. plonky3 commits to the LDE first and
+  // folds it while opening, so only the totals are comparable.
+  SimpleFRIBenchmarkReporter reporter(
+      "FRI Benchmark",
+      base::Map(rows, [](const Row& row) { return row.ToString(); }));
+  for (std::string_view column :
+       {"tachyon_lde", "tachyon_merkle", "tachyon_commit", "tachyon_open",
+        "tachyon_total"}) {
+    reporter.AddColumn(column);
+  }
+  for (FRIConfig::Vendor vendor : config.vendors()) {
+    std::string name = FRIConfig::VendorToString(vendor);
+    for (std::string_view step : {"commit", "open", "total"}) {
+      reporter.AddColumn(absl::Substitute("$0_$1", name, step));
+    }
+  }
+  if (config.perf_counters()) {
+    CHECK(reporter.EnablePerfCounters());
+  }
+
+  const crypto::Poseidon2Config<math::BabyBear>& baby_bear_config =
+      crypto::GetBabyBearT16Poseidon2Config();
+  const crypto::Poseidon2Config<math::Goldilocks>& goldilocks_config =
+      crypto::GetGoldilocksT8Poseidon2Config();
+
+  for (size_t i = 0; i < rows.size(); ++i) {
+    std::cout << "Benchmarking " << rows[i].ToString() << "..." << std::endl;
+    if (rows[i].field == FRIConfig::Field::kBabyBear) {
+      RunTachyon(config, baby_bear_config, rows[i], i, reporter);
+    } else {
+      RunTachyon(config, goldilocks_config, rows[i], i, reporter);
+    }
+    for (FRIConfig::Vendor vendor : config.vendors()) {
+      RunVendor(config, vendor, rows[i], i, reporter);
+    }
+  }
+
+  reporter.Show();
+  if (!config.output_path().empty()) {
+    CHECK(reporter.WriteResults(base::FilePath(config.output_path())));
+  }
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
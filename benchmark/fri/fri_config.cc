@@ -0,0 +1,168 @@
+#include "benchmark/fri/fri_config.h"
+
+#include <string>
+
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/ranges/algorithm.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
+#include "tachyon/math/finite_fields/goldilocks/goldilocks_prime_field.h"
+
+namespace tachyon {
+namespace base {
+
+template <>
+class FlagValueTraits<FRIConfig::Field> {
+ public:
+  static bool ParseValue(std::string_view input, FRIConfig::Field* value,
+                         std::string* reason) {
+    if (input == "baby_bear") {
+      *value = FRIConfig::Field::kBabyBear;
+    } else if (input == "goldilocks") {
+      *value = FRIConfig::Field::kGoldilocks;
+    } else if (input == "mersenne31") {
+      *reason =
+          "mersenne31 has no large two-adic subgroup, over which FRI folds";
+      return false;
+    } else {
+      *reason = absl::Substitute("Unknown field: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
+template <>
+class FlagValueTraits<FRIConfig::Vendor> {
+ public:
+  static bool ParseValue(std::string_view input, FRIConfig::Vendor* value,
+                         std::string* reason) {
+    if (input == "plonky3") {
+      *value = FRIConfig::Vendor::kPlonky3;
+    } else {
+      *reason = absl::Substitute("Unknown vendor: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace base
+
+// static
+std::string FRIConfig::FieldToString(Field field) {
+  switch (field) {
+    case Field::kBabyBear:
+      return "baby_bear";
+    case Field::kGoldilocks:
+      return "goldilocks";
+  }
+  NOTREACHED();
+  return "";
+}
+
+// static
+std::string FRIConfig::VendorToString(Vendor vendor) {
+  switch (vendor) {
+    case Vendor::kPlonky3:
+      return "plonky3";
+  }
+  NOTREACHED();
+  return "";
+}
+
+// static
+uint32_t FRIConfig::GetTwoAdicity(Field field) {
+  switch (field) {
+    case Field::kBabyBear:
+      return math::BabyBear::Config::kTwoAdicity;
+    case Field::kGoldilocks:
+      return math::Goldilocks::Config::kTwoAdicity;
+  }
+  NOTREACHED();
+  return 0;
+}
+
+bool FRIConfig::Parse(int argc, char** argv) {
+  base::FlagParser parser;
+  // clang-format off
+  parser.AddFlag<base::Flag<std::vector<uint32_t>>>(&exponents_)
+      .set_short_name("-k")
+      .set_required()
+      .set_help("Specify the exponent 'k's where the size of the polynomial to commit is 2ᵏ.");
+  // clang-format on
+  parser.AddFlag<base::Flag<std::vector<uint32_t>>>(&blowups_)
+      .set_long_name("--blowup")
+      .set_help(
+          "Blowup factors of the LDE, each of which is one of 2, 4, 8 and "
+          "16. By default, 2.");
+  parser.AddFlag<base::Flag<std::vector<Field>>>(&fields_)
+      .set_long_name("--field")
+      .set_help(
+          "Fields to be benchmarked with. By default, all of them. "
+          "(supported fields: baby_bear, goldilocks)");
+  parser.AddFlag<base::Flag<size_t>>(&arity_)
+      .set_long_name("--arity")
+      .set_help(
+          "The arity by which each layer is folded, which is one of 2, 4, 8 "
+          "and 16. By default, 2.");
+  parser.AddFlag<base::Flag<size_t>>(&num_queries_)
+      .set_long_name("--num_queries")
+      .set_help("The number of the queries to open. By default, 100.");
+  parser.AddFlag<base::Flag<std::vector<Vendor>>>(&vendors_)
+      .set_long_name("--vendor")
+      .set_help(
+          "Vendors to be benchmarked with. They always fold by 2. (supported "
+          "vendors: plonky3)");
+  parser.AddFlag<base::BoolFlag>(&check_results_)
+      .set_long_name("--check_results")
+      .set_help("Whether verifies the opening proofs created by tachyon.");
+  parser.AddFlag<base::BoolFlag>(&perf_counters_)
+      .set_long_name("--perf_counters")
+      .set_help(
+          "Whether counts the cycles, instructions, LLC misses and dTLB "
+          "misses of each run. Only supported on Linux.");
+  parser.AddFlag<base::StringFlag>(&output_path_)
+      .set_long_name("--output")
+      .set_help(
+          "Writes the results to the path as a JSON if it ends with "
+          "\".json\", or as a CSV otherwise.");
+  {
+    std::string error;
+    if (!parser.Parse(argc, argv, &error)) {
+      tachyon_cerr << error << std::endl;
+      return false;
+    }
+  }
+
+  if (blowups_.empty()) {
+    blowups_ = {2};
+  }
+  if (fields_.empty()) {
+    fields_ = {Field::kBabyBear, Field::kGoldilocks};
+  }
+  for (uint32_t blowup : blowups_) {
+    if (!base::bits::IsPowerOfTwo(blowup) || blowup < 2 || blowup > 16) {
+      tachyon_cerr << "blowup should be one of 2, 4, 8 and 16" << std::endl;
+      return false;
+    }
+  }
+  if (!base::bits::IsPowerOfTwo(arity_) || arity_ < 2 || arity_ > 16) {
+    tachyon_cerr << "arity should be one of 2, 4, 8 and 16" << std::endl;
+    return false;
+  }
+  if (num_queries_ == 0) {
+    tachyon_cerr << "num_queries should be positive" << std::endl;
+    return false;
+  }
+
+  base::ranges::sort(exponents_);  // NOLINT
+  base::ranges::sort(blowups_);  // NOLINT
+  return true;
+}
+
+}  // namespace tachyon
@@ -0,0 +1,60 @@
+#ifndef BENCHMARK_FRI_FRI_CONFIG_H_
+#define BENCHMARK_FRI_FRI_CONFIG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace tachyon {
+
+class FRIConfig {
+ public:
+  enum class Field {
+    kBabyBear,
+    kGoldilocks,
+  };
+
+  enum class Vendor {
+    kPlonky3,
+  };
+
+  static std::string FieldToString(Field field);
+  static std::string VendorToString(Vendor vendor);
+
+  // Returns the largest k of the subgroups of order 2ᵏ of |field|. The LDEs
+  // larger than 2ᵏ are skipped.
+  static uint32_t GetTwoAdicity(Field field);
+
+  FRIConfig() = default;
+  FRIConfig(const FRIConfig& other) = delete;
+  FRIConfig& operator=(const FRIConfig& other) = delete;
+
+  const std::vector<uint32_t>& exponents() const { return exponents_; }
+  const std::vector<uint32_t>& blowups() const { return blowups_; }
+  const std::vector<Field>& fields() const { return fields_; }
+  const std::vector<Vendor>& vendors() const { return vendors_; }
+  size_t arity() const { return arity_; }
+  size_t num_queries() const { return num_queries_; }
+  bool check_results() const { return check_results_; }
+  bool perf_counters() const { return perf_counters_; }
+  const std::string& output_path() const { return output_path_; }
+
+  bool Parse(int argc, char** argv);
+
+ private:
+  std::vector<uint32_t> exponents_;
+  std::vector<uint32_t> blowups_;
+  std::vector<Field> fields_;
+  std::vector<Vendor> vendors_;
+  size_t arity_ = 2;
+  size_t num_queries_ = 100;
+  bool check_results_ = false;
+  bool perf_counters_ = false;
+  std::string output_path_;
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_FRI_FRI_CONFIG_H_
@@ -0,0 +1,110 @@
+use std::time::Instant;
+
+use p3_baby_bear::{BabyBear, DiffusionMatrixBabyBear};
+use p3_challenger::{CanObserve, DuplexChallenger, FieldChallenger};
+use p3_commit::{ExtensionMmcs, Pcs};
+use p3_dft::Radix2DitParallel;
+use p3_field::extension::BinomialExtensionField;
+use p3_field::Field;
+use p3_fri::{FriConfig, TwoAdicFriPcs};
+use p3_goldilocks::{DiffusionMatrixGoldilocks, Goldilocks};
+use p3_matrix::dense::RowMajorMatrix;
+use p3_merkle_tree::FieldMerkleTreeMmcs;
+use p3_poseidon2::{Poseidon2, Poseidon2ExternalMatrixGeneral};
+use p3_symmetric::{PaddingFreeSponge, TruncatedPermutation};
+
+// Commits to a random polynomial of degree 2ᵏ - 1 and opens it at a random
+// point, which folds the LDE and opens |num_queries| queries. The durations
+// of both are written in microseconds.
+macro_rules! run_fri {
+    ($name:ident, $val:ty, $challenge:ty, $diffusion:ident, $width:literal, $rate:literal,
+     $digest:literal) => {
+        #[no_mangle]
+        pub extern "C" fn $name(
+            k: u32,
+            log_blowup: u32,
+            num_queries: usize,
+            commit_duration: *mut u64,
+            open_duration: *mut u64,
+        ) {
+            type Val = $val;
+            type Challenge = $challenge;
+            type Perm =
+                Poseidon2<Val, Poseidon2ExternalMatrixGeneral, $diffusion, $width, 7>;
+            type MyHash = PaddingFreeSponge<Perm, $width, $rate, $digest>;
+            type MyCompress = TruncatedPermutation<Perm, 2, $digest, $width>;
+            type ValMmcs = FieldMerkleTreeMmcs<
+                <Val as Field>::Packing,
+                <Val as Field>::Packing,
+                MyHash,
+                MyCompress,
+                $digest,
+            >;
+            type ChallengeMmcs = ExtensionMmcs<Val, Challenge, ValMmcs>;
+            type Challenger = DuplexChallenger<Val, Perm, $width, $rate>;
+            type MyPcs = TwoAdicFriPcs<Val, Radix2DitParallel, ValMmcs, ChallengeMmcs>;
+
+            let mut rng = rand::thread_rng();
+            let perm = Perm::new_from_rng_128(
+                Poseidon2ExternalMatrixGeneral,
+                $diffusion,
+                &mut rng,
+            );
+            let val_mmcs =
+                ValMmcs::new(MyHash::new(perm.clone()), MyCompress::new(perm.clone()));
+            let fri_config = FriConfig {
+                log_blowup: log_blowup as usize,
+                num_queries,
+                proof_of_work_bits: 0,
+                mmcs: ChallengeMmcs::new(val_mmcs.clone()),
+            };
+            let pcs = MyPcs::new(k as usize, Radix2DitParallel, val_mmcs, fri_config);
+
+            let degree = 1 << k;
+            let domain =
+                <MyPcs as Pcs<Challenge, Challenger>>::natural_domain_for_degree(&pcs, degree);
+            let evals = RowMajorMatrix::<Val>::rand(&mut rng, degree, 1);
+
+            let start = Instant::now();
+            let (commitment, prover_data) =
+                <MyPcs as Pcs<Challenge, Challenger>>::commit(&pcs, vec![(domain, evals)]);
+            unsafe {
+                commit_duration.write(start.elapsed().as_micros() as u64);
+            }
+
+            let mut challenger = Challenger::new(perm);
+            challenger.observe(commitment);
+            let zeta: Challenge = challenger.sample_ext_element();
+
+            let start = Instant::now();
+            let (_opened_values, _proof) = <MyPcs as Pcs<Challenge, Challenger>>::open(
+                &pcs,
+                vec![(&prover_data, vec![vec![zeta]])],
+                &mut challenger,
+            );
+            unsafe {
+                open_duration.write(start.elapsed().as_micros() as u64);
+            }
+        }
+    };
+}
+
+run_fri!(
+    run_fri_plonky3_baby_bear,
+    BabyBear,
+    BinomialExtensionField<BabyBear, 4>,
+    DiffusionMatrixBabyBear,
+    16,
+    8,
+    8
+);
+
+run_fri!(
+    run_fri_plonky3_goldilocks,
+    Goldilocks,
+    BinomialExtensionField<Goldilocks, 2>,
+    DiffusionMatrixGoldilocks,
+    8,
+    4,
+    4
+);
@@ -0,0 +1,61 @@
+#ifndef BENCHMARK_FRI_POSEIDON2_BINARY_MERKLE_HASHER_H_
+#define BENCHMARK_FRI_POSEIDON2_BINARY_MERKLE_HASHER_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_hasher.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_horizen_external_matrix.h"
+
+namespace tachyon {
+
+// |Poseidon2BinaryMerkleHasher| compresses 2 nodes into 1 by a Poseidon2
+// permutation of the state that starts with them, and keeps the leaves as
+// they are, since |crypto::FRI| reads the evaluations back from the leaves.
+// NOTE: A node is a single element, which is enough to measure how long the
+// hashes take but is too small to be collision resistant over a 31-bit field.
+template <typename F>
+class Poseidon2BinaryMerkleHasher : public crypto::BinaryMerkleHasher<F, F> {
+ public:
+  using Poseidon2 = crypto::Poseidon2Sponge<crypto::Poseidon2ExternalMatrix<
+      crypto::Poseidon2HorizenExternalMatrix<F>>>;
+
+  explicit Poseidon2BinaryMerkleHasher(
+      const crypto::Poseidon2Config<F>& config) {
+    // NOTE: Each thread permutes its own sponge, since the tree hashes the
+    // nodes of a level in parallel.
+#if defined(TACHYON_HAS_OPENMP)
+    size_t num_threads = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t num_threads = 1;
+#endif
+    sponges_ = std::vector<Poseidon2>(num_threads, Poseidon2(config));
+  }
+
+  // crypto::BinaryMerkleHasher<F, F> methods
+  F ComputeLeafHash(const F& leaf) const override { return leaf; }
+  F ComputeParentHash(const F& left, const F& right) const override {
+#if defined(TACHYON_HAS_OPENMP)
+    Poseidon2& sponge = sponges_[omp_get_thread_num()];
+#else
+    Poseidon2& sponge = sponges_[0];
+#endif
+    sponge.state[0] = left;
+    sponge.state[1] = right;
+    for (size_t i = 2; i < sponge.state.size(); ++i) {
+      sponge.state[i] = F::Zero();
+    }
+    sponge.Permute();
+    return sponge.state[0];
+  }
+
+ private:
+  mutable std::vector<Poseidon2> sponges_;
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_FRI_POSEIDON2_BINARY_MERKLE_HASHER_H_
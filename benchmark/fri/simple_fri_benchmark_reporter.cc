@@ -0,0 +1,18 @@
+#include "benchmark/fri/simple_fri_benchmark_reporter.h"
+
+#include <utility>
+
+namespace tachyon {
+
+SimpleFRIBenchmarkReporter::SimpleFRIBenchmarkReporter(
+    std::string_view title, std::vector<std::string> targets)
+    : SimpleBenchmarkReporter(title) {
+  targets_ = std::move(targets);
+  times_.resize(targets_.size());
+}
+
+void SimpleFRIBenchmarkReporter::AddColumn(std::string_view name) {
+  column_headers_.push_back(std::string(name));
+}
+
+}  // namespace tachyon
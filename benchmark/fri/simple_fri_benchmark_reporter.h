@@ -0,0 +1,27 @@
+#ifndef BENCHMARK_FRI_SIMPLE_FRI_BENCHMARK_REPORTER_H_
+#define BENCHMARK_FRI_SIMPLE_FRI_BENCHMARK_REPORTER_H_
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmark/simple_benchmark_reporter.h"
+
+namespace tachyon {
+
+class SimpleFRIBenchmarkReporter : public SimpleBenchmarkReporter {
+ public:
+  // Each of |targets| names a row, e.g., a field, a size and a blowup.
+  SimpleFRIBenchmarkReporter(std::string_view title,
+                             std::vector<std::string> targets);
+  SimpleFRIBenchmarkReporter(const SimpleFRIBenchmarkReporter& other) = delete;
+  SimpleFRIBenchmarkReporter& operator=(
+      const SimpleFRIBenchmarkReporter& other) = delete;
+
+  // Adds a column for the times of |name|, e.g., a step of the commitment.
+  void AddColumn(std::string_view name);
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_FRI_SIMPLE_FRI_BENCHMARK_REPORTER_H_
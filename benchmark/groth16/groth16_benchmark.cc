@@ -0,0 +1,139 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "absl/types/span.h"
+
+// clang-format off
+#include "benchmark/groth16/groth16_config.h"
+#include "benchmark/groth16/random_r1cs.h"
+#include "benchmark/groth16/simple_groth16_benchmark_reporter.h"
+// clang-format on
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/zk/r1cs/constraint_system/quadratic_arithmetic_program.h"
+#include "tachyon/zk/r1cs/groth16/prove.h"
+
+namespace tachyon {
+
+using namespace zk::r1cs;
+
+namespace {
+
+using Curve = math::bn254::BN254Curve;
+using F = math::bn254::Fr;
+
+constexpr size_t kMaxDegree = SIZE_MAX - 1;
+
+using Domain = math::UnivariateEvaluationDomain<F, kMaxDegree>;
+
+// Runs |callback| and adds its time to the next column of |row|.
+template <typename Callable>
+void Measure(SimpleGroth16BenchmarkReporter& reporter, size_t row,
+             Callable callback) {
+  PerfCounters::Values counters = reporter.ReadPerfCounters();
+  base::TimeTicks start = base::TimeTicks::Now();
+  callback();
+  reporter.AddTime(row, (base::TimeTicks::Now() - start).InSecondsF(),
+                   counters);
+}
+
+template <typename Point>
+void RunMSM(absl::Span<const Point> bases, absl::Span<const F> scalars) {
+  math::VariableBaseMSM<Point> msm;
+  typename math::VariableBaseMSM<Point>::Bucket ret;
+  CHECK(msm.Run(bases, scalars, &ret));
+}
+
+std::vector<F> WitnessMap(const ConstraintMatrices<F>& matrices,
+                          absl::Span<const F> full_assignments) {
+  std::unique_ptr<Domain> domain = Domain::Create(
+      matrices.num_constraints + matrices.num_instance_variables);
+  return QuadraticArithmeticProgram<F>::WitnessMapFromMatrices(
+      domain.get(), matrices, full_assignments);
+}
+
+}  // namespace
+
+int RealMain(int argc, char** argv) {
+  Curve::Init();
+
+  Groth16Config config;
+  if (!config.Parse(argc, argv)) {
+    return 1;
+  }
+
+  // NOTE: Each MSM is the one that |groth16::CreateProofWithAssignment()| runs,
+  // and "total" is the witness map followed by the whole proof.
+  SimpleGroth16BenchmarkReporter reporter("Groth16 Benchmark",
+                                          config.exponents());
+  for (std::string_view column : {"witness_map", "msm_a", "msm_b_g1",
+                                  "msm_b_g2", "msm_h", "msm_l", "total"}) {
+    reporter.AddColumn(column);
+  }
+  if (config.perf_counters()) {
+    CHECK(reporter.EnablePerfCounters());
+  }
+
+  for (size_t i = 0; i < config.exponents().size(); ++i) {
+    uint32_t k = config.exponents()[i];
+    std::cout << "Generating a random R1CS of k = " << k << "..."
+              << std::endl;
+    RandomR1CS<Curve> r1cs =
+        RandomR1CS<Curve>::Create(size_t{1} << k, config.num_terms());
+    std::cout << "Generation completed" << std::endl;
+
+    const groth16::ProvingKey<Curve>& pk = r1cs.proving_key();
+    absl::Span<const F> full_assignments =
+        absl::MakeConstSpan(r1cs.full_assignments());
+
+    std::vector<F> h;
+    Measure(reporter, i,
+            [&]() { h = WitnessMap(r1cs.matrices(), full_assignments); });
+    Measure(reporter, i, [&]() {
+      RunMSM(absl::MakeConstSpan(pk.a_g1_query()).subspan(1),
+             full_assignments.subspan(1));
+    });
+    Measure(reporter, i, [&]() {
+      RunMSM(absl::MakeConstSpan(pk.b_g1_query()).subspan(1),
+             full_assignments.subspan(1));
+    });
+    Measure(reporter, i, [&]() {
+      RunMSM(absl::MakeConstSpan(pk.b_g2_query()).subspan(1),
+             full_assignments.subspan(1));
+    });
+    Measure(reporter, i, [&]() {
+      RunMSM(absl::MakeConstSpan(pk.h_g1_query()),
+             absl::MakeConstSpan(h).first(pk.h_g1_query().size()));
+    });
+    Measure(reporter, i, [&]() {
+      RunMSM(absl::MakeConstSpan(pk.l_g1_query()),
+             r1cs.GetWitnessAssignments());
+    });
+    Measure(reporter, i, [&]() {
+      std::vector<F> h_coefficients =
+          WitnessMap(r1cs.matrices(), full_assignments);
+      groth16::CreateProofWithAssignmentZK<Curve>(
+          pk, absl::MakeConstSpan(h_coefficients),
+          r1cs.GetInstanceAssignments(), r1cs.GetWitnessAssignments(),
+          full_assignments.subspan(1));
+    });
+  }
+
+  reporter.Show();
+  if (!config.output_path().empty()) {
+    CHECK(reporter.WriteResults(base::FilePath(config.output_path())));
+  }
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
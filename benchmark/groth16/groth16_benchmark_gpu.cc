@@ -0,0 +1,137 @@
+#if TACHYON_CUDA
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "absl/types/span.h"
+
+// clang-format off
+#include "benchmark/groth16/groth16_config.h"
+#include "benchmark/groth16/random_r1cs.h"
+#include "benchmark/groth16/simple_groth16_benchmark_reporter.h"
+// clang-format on
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/device/gpu/gpu_device_functions.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_mem_pool_manager.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1_gpu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/bellman/bn254_bellman_msm_kernels.cu.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/zk/r1cs/constraint_system/quadratic_arithmetic_program.h"
+#include "tachyon/zk/r1cs/groth16/prove.h"
+#include "tachyon/zk/r1cs/groth16/prove_gpu.h"
+
+namespace tachyon {
+
+using namespace zk::r1cs;
+
+using Curve = math::bn254::BN254Curve;
+using F = math::bn254::Fr;
+
+constexpr size_t kMaxDegree = SIZE_MAX - 1;
+
+using Domain = math::UnivariateEvaluationDomain<F, kMaxDegree>;
+
+std::vector<F> WitnessMap(const ConstraintMatrices<F>& matrices,
+                          absl::Span<const F> full_assignments) {
+  std::unique_ptr<Domain> domain = Domain::Create(
+      matrices.num_constraints + matrices.num_instance_variables);
+  return QuadraticArithmeticProgram<F>::WitnessMapFromMatrices(
+      domain.get(), matrices, full_assignments);
+}
+
+int RealMain(int argc, char** argv) {
+  Curve::Init();
+  math::bn254::G1CurveGpu::Init();
+
+  Groth16Config config;
+  if (!config.Parse(argc, argv)) {
+    return 1;
+  }
+
+  // NOTE: Both of them include the witness map, which runs on the CPU. Only
+  // the G1 MSMs run on the GPU.
+  SimpleGroth16BenchmarkReporter reporter("Groth16 Benchmark GPU",
+                                          config.exponents());
+  reporter.AddColumn("cpu");
+  reporter.AddColumn("gpu");
+  if (config.perf_counters()) {
+    CHECK(reporter.EnablePerfCounters());
+  }
+
+  gpuDeviceProp device_prop;
+  GPU_MUST_SUCCESS(gpuGetDeviceProperties(&device_prop, 0),
+                   "Failed to gpuGetDeviceProperties()");
+  reporter.set_gpu(device_prop.name);
+
+  device::gpu::GpuMemPoolManager& manager =
+      device::gpu::GpuMemPoolManager::GetInstance();
+  gpuMemPool_t mem_pool = manager.GetMemPool(0);
+  gpuStream_t stream = manager.GetStream(0);
+  CHECK(mem_pool && stream);
+
+  for (size_t i = 0; i < config.exponents().size(); ++i) {
+    uint32_t k = config.exponents()[i];
+    std::cout << "Generating a random R1CS of k = " << k << "..."
+              << std::endl;
+    RandomR1CS<Curve> r1cs =
+        RandomR1CS<Curve>::Create(size_t{1} << k, config.num_terms());
+    std::cout << "Generation completed" << std::endl;
+
+    const groth16::ProvingKey<Curve>& pk = r1cs.proving_key();
+    absl::Span<const F> full_assignments =
+        absl::MakeConstSpan(r1cs.full_assignments());
+    // The same randomness is used on both sides to compare the proofs.
+    F r = F::Random();
+    F s = F::Random();
+
+    PerfCounters::Values counters = reporter.ReadPerfCounters();
+    base::TimeTicks start = base::TimeTicks::Now();
+    std::vector<F> h = WitnessMap(r1cs.matrices(), full_assignments);
+    groth16::Proof<Curve> proof = groth16::CreateProofWithAssignment(
+        pk, r, s, absl::MakeConstSpan(h), r1cs.GetInstanceAssignments(),
+        r1cs.GetWitnessAssignments(), full_assignments.subspan(1));
+    reporter.AddTime(i, (base::TimeTicks::Now() - start).InSecondsF(),
+                     counters);
+
+    // NOTE: The G1 queries are uploaded when |prover| is created, which is
+    // not timed.
+    groth16::ProverGpu<Curve, math::bn254::G1CurveGpu> prover(
+        pk, math::MSMAlgorithmKind::kBellmanMSM, mem_pool, stream);
+    counters = reporter.ReadPerfCounters();
+    start = base::TimeTicks::Now();
+    h = WitnessMap(r1cs.matrices(), full_assignments);
+    groth16::Proof<Curve> proof_gpu = prover.CreateProofWithAssignment(
+        r, s, absl::MakeConstSpan(h), r1cs.GetWitnessAssignments(),
+        full_assignments.subspan(1));
+    reporter.AddTime(i, (base::TimeTicks::Now() - start).InSecondsF(),
+                     counters);
+
+    if (config.check_results()) {
+      CHECK_EQ(proof, proof_gpu) << "Results not matched";
+    }
+  }
+
+  reporter.Show();
+  if (!config.output_path().empty()) {
+    CHECK(reporter.WriteResults(base::FilePath(config.output_path())));
+  }
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
+#else
+#include "tachyon/base/console/iostream.h"
+
+int main(int argc, char **argv) {
+  tachyon_cerr << "please build with --config cuda" << std::endl;
+  return 1;
+}
+#endif  // TACHYON_CUDA
@@ -0,0 +1,57 @@
+#include "benchmark/groth16/groth16_config.h"
+
+#include <string>
+
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/ranges/algorithm.h"
+
+namespace tachyon {
+
+bool Groth16Config::Parse(int argc, char** argv) {
+  base::FlagParser parser;
+  // clang-format off
+  parser.AddFlag<base::Flag<std::vector<uint32_t>>>(&exponents_)
+      .set_short_name("-k")
+      .set_required()
+      .set_help("Specify the exponent 'k's where the size of the domain of the R1CS to prove is 2ᵏ.");
+  // clang-format on
+  parser.AddFlag<base::Flag<size_t>>(&num_terms_)
+      .set_long_name("--num_terms")
+      .set_help(
+          "The number of the terms in each row of the A and B matrices. By "
+          "default, 2.");
+  parser.AddFlag<base::BoolFlag>(&check_results_)
+      .set_long_name("--check_results")
+      .set_help("Whether checks the proofs created on the GPU.");
+  parser.AddFlag<base::BoolFlag>(&perf_counters_)
+      .set_long_name("--perf_counters")
+      .set_help(
+          "Whether counts the cycles, instructions, LLC misses and dTLB "
+          "misses of each run. Only supported on Linux.");
+  parser.AddFlag<base::StringFlag>(&output_path_)
+      .set_long_name("--output")
+      .set_help(
+          "Writes the results to the path as a JSON if it ends with "
+          "\".json\", or as a CSV otherwise.");
+  {
+    std::string error;
+    if (!parser.Parse(argc, argv, &error)) {
+      tachyon_cerr << error << std::endl;
+      return false;
+    }
+  }
+
+  if (num_terms_ == 0) {
+    tachyon_cerr << "num_terms should be positive" << std::endl;
+    return false;
+  }
+  base::ranges::sort(exponents_);  // NOLINT
+  if (exponents_.front() < 2) {
+    tachyon_cerr << "k should be at least 2" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tachyon
@@ -0,0 +1,36 @@
+#ifndef BENCHMARK_GROTH16_GROTH16_CONFIG_H_
+#define BENCHMARK_GROTH16_GROTH16_CONFIG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace tachyon {
+
+class Groth16Config {
+ public:
+  Groth16Config() = default;
+  Groth16Config(const Groth16Config& other) = delete;
+  Groth16Config& operator=(const Groth16Config& other) = delete;
+
+  const std::vector<uint32_t>& exponents() const { return exponents_; }
+  size_t num_terms() const { return num_terms_; }
+  bool check_results() const { return check_results_; }
+  bool perf_counters() const { return perf_counters_; }
+  const std::string& output_path() const { return output_path_; }
+
+  bool Parse(int argc, char** argv);
+
+ private:
+  std::vector<uint32_t> exponents_;
+  size_t num_terms_ = 2;
+  bool check_results_ = false;
+  bool perf_counters_ = false;
+  std::string output_path_;
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_GROTH16_GROTH16_CONFIG_H_
@@ -0,0 +1,152 @@
+#ifndef BENCHMARK_GROTH16_RANDOM_R1CS_H_
+#define BENCHMARK_GROTH16_RANDOM_R1CS_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/random.h"
+#include "tachyon/zk/r1cs/constraint_system/constraint_matrices.h"
+#include "tachyon/zk/r1cs/groth16/proving_key.h"
+
+namespace tachyon {
+
+// |RandomR1CS| is a satisfied R1CS of random constraints along with a proving
+// key of pseudo random points, so that the Groth16 prover can be benchmarked
+// at any size without a trusted setup. The proofs don't verify against the
+// key, but creating them takes as long as creating the real ones.
+//
+// The i-th constraint is (Σⱼ aᵢⱼxⱼ) * (Σⱼ bᵢⱼxⱼ) = xₗ₊ᵢ, where l is
+// |kNumInstanceVariables| and the terms of A and B are taken randomly from
+// the variables before xₗ₊ᵢ. So each witness is computed from the ones
+// before it.
+template <typename Curve>
+class RandomR1CS {
+ public:
+  using F = typename Curve::G1Curve::ScalarField;
+  using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
+  using G1JacobianPoint = typename Curve::G1Curve::JacobianPoint;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G2JacobianPoint = typename Curve::G2Curve::JacobianPoint;
+
+  // The one and a public input.
+  constexpr static size_t kNumInstanceVariables = 2;
+
+  // Creates an R1CS of |n| - |kNumInstanceVariables| constraints, so that the
+  // size of its domain is |n|, with |num_terms| terms in each row of A and B.
+  static RandomR1CS Create(size_t n, size_t num_terms) {
+    CHECK_GT(n, kNumInstanceVariables);
+    size_t num_constraints = n - kNumInstanceVariables;
+
+    RandomR1CS ret;
+    ret.full_assignments_.reserve(n);
+    ret.full_assignments_.push_back(F::One());
+    ret.full_assignments_.push_back(F::Random());
+
+    std::vector<std::vector<zk::r1cs::Cell<F>>> a(num_constraints);
+    std::vector<std::vector<zk::r1cs::Cell<F>>> b(num_constraints);
+    std::vector<std::vector<zk::r1cs::Cell<F>>> c(num_constraints);
+    for (size_t i = 0; i < num_constraints; ++i) {
+      size_t num_variables = kNumInstanceVariables + i;
+      F a_value = AddRandomTerms(ret.full_assignments_, num_variables,
+                                 num_terms, a[i]);
+      F b_value = AddRandomTerms(ret.full_assignments_, num_variables,
+                                 num_terms, b[i]);
+      c[i].push_back({F::One(), num_variables});
+      ret.full_assignments_.push_back(a_value * b_value);
+    }
+
+    zk::r1cs::ConstraintMatrices<F>& matrices = ret.matrices_;
+    matrices.num_instance_variables = kNumInstanceVariables;
+    matrices.num_witness_variables = num_constraints;
+    matrices.num_constraints = num_constraints;
+    matrices.a = zk::r1cs::Matrix<F>(std::move(a));
+    matrices.b = zk::r1cs::Matrix<F>(std::move(b));
+    matrices.c = zk::r1cs::Matrix<F>(std::move(c));
+    matrices.a_num_non_zero = matrices.a.CountNonZero();
+    matrices.b_num_non_zero = matrices.b.CountNonZero();
+    matrices.c_num_non_zero = matrices.c.CountNonZero();
+
+    // NOTE: The queries share the same bases, which doesn't affect the time
+    // of the MSMs.
+    std::vector<G1AffinePoint> g1_bases =
+        CreatePseudoRandomPoints<G1JacobianPoint, G1AffinePoint>(n);
+    std::vector<G2AffinePoint> g2_bases =
+        CreatePseudoRandomPoints<G2JacobianPoint, G2AffinePoint>(n);
+    zk::r1cs::groth16::VerifyingKey<Curve> verifying_key(
+        G1AffinePoint::Random(), G2AffinePoint::Random(),
+        G2AffinePoint::Random(), G2AffinePoint::Random(),
+        std::vector<G1AffinePoint>(g1_bases.begin(),
+                                   g1_bases.begin() + kNumInstanceVariables));
+    ret.proving_key_ = zk::r1cs::groth16::ProvingKey<Curve>(
+        std::move(verifying_key), G1AffinePoint::Random(),
+        G1AffinePoint::Random(), std::vector<G1AffinePoint>(g1_bases),
+        std::vector<G1AffinePoint>(g1_bases), std::move(g2_bases),
+        std::vector<G1AffinePoint>(g1_bases.begin(), g1_bases.end() - 1),
+        std::vector<G1AffinePoint>(g1_bases.begin() + kNumInstanceVariables,
+                                   g1_bases.end()));
+    return ret;
+  }
+
+  const zk::r1cs::ConstraintMatrices<F>& matrices() const { return matrices_; }
+  const std::vector<F>& full_assignments() const { return full_assignments_; }
+  const zk::r1cs::groth16::ProvingKey<Curve>& proving_key() const {
+    return proving_key_;
+  }
+
+  // Returns the instance assignments without the one.
+  absl::Span<const F> GetInstanceAssignments() const {
+    return absl::MakeConstSpan(full_assignments_)
+        .subspan(1, kNumInstanceVariables - 1);
+  }
+
+  absl::Span<const F> GetWitnessAssignments() const {
+    return absl::MakeConstSpan(full_assignments_)
+        .subspan(kNumInstanceVariables);
+  }
+
+ private:
+  // Adds |num_terms| random terms of the first |num_variables| variables to
+  // |row| and returns their sum evaluated at |assignments|.
+  static F AddRandomTerms(const std::vector<F>& assignments,
+                          size_t num_variables, size_t num_terms,
+                          std::vector<zk::r1cs::Cell<F>>& row) {
+    F ret = F::Zero();
+    row.reserve(num_terms);
+    for (size_t i = 0; i < num_terms; ++i) {
+      size_t index = base::Uniform(base::Range<size_t>(0, num_variables));
+      F coefficient = F::Random();
+      ret += coefficient * assignments[index];
+      row.push_back({std::move(coefficient), index});
+    }
+    return ret;
+  }
+
+  // NOTE: Unlike |math::CreatePseudoRandomPoints()|, the points are
+  // normalized all at once, which matters for the sizes of the proving key.
+  template <typename JacobianPoint, typename AffinePoint>
+  static std::vector<AffinePoint> CreatePseudoRandomPoints(size_t size) {
+    std::vector<JacobianPoint> points;
+    points.reserve(size);
+    JacobianPoint p = JacobianPoint::Random();
+    for (size_t i = 0; i < size; ++i) {
+      points.push_back(p);
+      p = p.Double();
+    }
+    std::vector<AffinePoint> ret(size);
+    CHECK(JacobianPoint::BatchNormalize(points, &ret));
+    return ret;
+  }
+
+  zk::r1cs::ConstraintMatrices<F> matrices_;
+  std::vector<F> full_assignments_;
+  zk::r1cs::groth16::ProvingKey<Curve> proving_key_;
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_GROTH16_RANDOM_R1CS_H_
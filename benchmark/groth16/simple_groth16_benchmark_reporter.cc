@@ -0,0 +1,24 @@
+#include "benchmark/groth16/simple_groth16_benchmark_reporter.h"
+
+#include <string>
+#include <vector>
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon {
+
+SimpleGroth16BenchmarkReporter::SimpleGroth16BenchmarkReporter(
+    std::string_view title, const std::vector<uint32_t>& exponents)
+    : SimpleBenchmarkReporter(title) {
+  targets_ = base::Map(exponents, [](uint32_t exponent) {
+    return base::NumberToString(exponent);
+  });
+  times_.resize(exponents.size());
+}
+
+void SimpleGroth16BenchmarkReporter::AddColumn(std::string_view name) {
+  column_headers_.push_back(std::string(name));
+}
+
+}  // namespace tachyon
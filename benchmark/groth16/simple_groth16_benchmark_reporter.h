@@ -0,0 +1,27 @@
+#ifndef BENCHMARK_GROTH16_SIMPLE_GROTH16_BENCHMARK_REPORTER_H_
+#define BENCHMARK_GROTH16_SIMPLE_GROTH16_BENCHMARK_REPORTER_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "benchmark/simple_benchmark_reporter.h"
+
+namespace tachyon {
+
+class SimpleGroth16BenchmarkReporter : public SimpleBenchmarkReporter {
+ public:
+  SimpleGroth16BenchmarkReporter(std::string_view title,
+                                 const std::vector<uint32_t>& exponents);
+  SimpleGroth16BenchmarkReporter(const SimpleGroth16BenchmarkReporter& other) =
+      delete;
+  SimpleGroth16BenchmarkReporter& operator=(
+      const SimpleGroth16BenchmarkReporter& other) = delete;
+
+  // Adds a column for the times of |name|, e.g., a step of the prover.
+  void AddColumn(std::string_view name);
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_GROTH16_SIMPLE_GROTH16_BENCHMARK_REPORTER_H_
@@ -0,0 +1,268 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+
+// clang-format off
+#include "benchmark/halo2/halo2_config.h"
+#include "benchmark/halo2/simple_halo2_benchmark_reporter.h"
+// clang-format on
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/base/time/trace_recorder.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/zk/base/commitments/gwc_extension.h"
+#include "tachyon/zk/base/commitments/shplonk_extension.h"
+#include "tachyon/zk/lookup/halo2/scheme.h"
+#include "tachyon/zk/lookup/log_derivative_halo2/scheme.h"
+#include "tachyon/zk/plonk/examples/fibonacci/fibonacci1_circuit.h"
+#include "tachyon/zk/plonk/examples/multi_lookup_circuit.h"
+#include "tachyon/zk/plonk/examples/shuffle_circuit.h"
+#include "tachyon/zk/plonk/halo2/blake2b_transcript.h"
+#include "tachyon/zk/plonk/halo2/constants.h"
+#include "tachyon/zk/plonk/halo2/prover.h"
+#include "tachyon/zk/plonk/layout/floor_planner/simple_floor_planner.h"
+
+namespace tachyon {
+
+using namespace zk::plonk;
+
+extern "C" void run_halo2_fibonacci(uint32_t k, bool use_shplonk,
+                                    uint64_t* duration_in_us);
+
+extern "C" void run_halo2_shuffle(uint32_t k, bool use_shplonk,
+                                  uint64_t* duration_in_us);
+
+namespace {
+
+using F = math::bn254::Fr;
+
+constexpr size_t kMaxDegree = SIZE_MAX - 1;
+
+using GWC = zk::GWCExtension<math::bn254::BN254Curve, kMaxDegree, kMaxDegree,
+                             math::bn254::G1AffinePoint>;
+using SHPlonk =
+    zk::SHPlonkExtension<math::bn254::BN254Curve, kMaxDegree, kMaxDegree,
+                         math::bn254::G1AffinePoint>;
+using Poly = typename SHPlonk::Poly;
+using Evals = typename SHPlonk::Evals;
+using Commitment = typename SHPlonk::Commitment;
+using Halo2LS = zk::lookup::halo2::Scheme<Poly, Evals, Commitment>;
+using LogDerivativeHalo2LS =
+    zk::lookup::log_derivative_halo2::Scheme<Poly, Evals, Commitment>;
+
+using FibonacciCircuit = Fibonacci1Circuit<F, SimpleFloorPlanner>;
+using ShuffleCircuitImpl =
+    ShuffleCircuit<F, Halo2Config::kShuffleWidth, Halo2Config::kShuffleHeight,
+                   SimpleFloorPlanner>;
+using MultiLookupCircuitImpl = MultiLookupCircuit<F, SimpleFloorPlanner>;
+
+// Proves |circuit| for every exponent and adds the times to the rows of the
+// |circuit_idx|-th circuit. Only the proof is timed, not the keygen.
+template <typename PCS, typename LS, typename Circuit>
+void RunTachyon(const Halo2Config& config, size_t circuit_idx,
+                const Circuit& circuit, const std::vector<Evals>& instances,
+                SimpleHalo2BenchmarkReporter& reporter) {
+  using Domain = typename PCS::Domain;
+
+  for (size_t i = 0; i < config.exponents().size(); ++i) {
+    size_t n = size_t{1} << config.exponents()[i];
+    PCS pcs;
+    CHECK(pcs.UnsafeSetup(n, F(2)));
+    halo2::Prover<PCS, LS> prover = halo2::Prover<PCS, LS>::CreateFromSeed(
+        std::move(pcs),
+        std::make_unique<halo2::Blake2bWriter<Commitment>>(
+            base::Uint8VectorBuffer()),
+        halo2::kXORShiftSeed, /*blinding_factors=*/0);
+    prover.set_domain(Domain::Create(n));
+
+    ProvingKey<LS> pkey;
+    CHECK(pkey.Load(&prover, circuit));
+
+    base::TraceRecorder trace_recorder;
+    prover.set_trace_recorder(&trace_recorder);
+    std::vector<Circuit> circuits = {circuit};
+    std::vector<std::vector<Evals>> instances_vec = {instances};
+
+    size_t row = reporter.GetRow(circuit_idx, i);
+    PerfCounters::Values counters = reporter.ReadPerfCounters();
+    base::TimeTicks start = base::TimeTicks::Now();
+    prover.CreateProof(pkey, std::move(instances_vec), circuits);
+    reporter.AddTime(row, (base::TimeTicks::Now() - start).InSecondsF(),
+                     counters);
+
+    // NOTE: The phases of the proof are recorded one level below
+    // "CreateProof", which follows "Synthesize".
+    std::vector<SimpleHalo2BenchmarkReporter::Phase> phases;
+    for (const base::TraceRecorder::Event& event : trace_recorder.events()) {
+      if (event.name == "Synthesize" || event.depth == 1) {
+        phases.push_back({event.name, event.duration.InSecondsF()});
+      }
+    }
+    reporter.AddPhases(row, std::move(phases));
+  }
+}
+
+template <typename Circuit>
+void RunTachyonAll(const Halo2Config& config, size_t circuit_idx,
+                   const Circuit& circuit, const std::vector<Evals>& instances,
+                   SimpleHalo2BenchmarkReporter& reporter) {
+  for (Halo2Config::PCS pcs : config.pcses()) {
+    for (Halo2Config::LS ls : config.lookups()) {
+      std::cout << "Proving with tachyon (" << Halo2Config::PCSToString(pcs)
+                << ", " << Halo2Config::LSToString(ls) << ")..." << std::endl;
+      if (pcs == Halo2Config::PCS::kGWC) {
+        if (ls == Halo2Config::LS::kHalo2) {
+          RunTachyon<GWC, Halo2LS>(config, circuit_idx, circuit, instances,
+                                   reporter);
+        } else {
+          RunTachyon<GWC, LogDerivativeHalo2LS>(config, circuit_idx, circuit,
+                                                instances, reporter);
+        }
+      } else {
+        if (ls == Halo2Config::LS::kHalo2) {
+          RunTachyon<SHPlonk, Halo2LS>(config, circuit_idx, circuit, instances,
+                                       reporter);
+        } else {
+          RunTachyon<SHPlonk, LogDerivativeHalo2LS>(
+              config, circuit_idx, circuit, instances, reporter);
+        }
+      }
+    }
+  }
+}
+
+void RunVendors(const Halo2Config& config, size_t circuit_idx,
+                Halo2Config::Circuit circuit,
+                SimpleHalo2BenchmarkReporter& reporter) {
+  for (Halo2Config::Vendor vendor : config.vendors()) {
+    for (Halo2Config::PCS pcs : config.pcses()) {
+      std::cout << "Proving with " << Halo2Config::VendorToString(vendor)
+                << " (" << Halo2Config::PCSToString(pcs) << ")..." << std::endl;
+      for (size_t i = 0; i < config.exponents().size(); ++i) {
+        uint64_t duration_in_us = 0;
+        bool use_shplonk = pcs == Halo2Config::PCS::kSHPlonk;
+        if (circuit == Halo2Config::Circuit::kFibonacci) {
+          run_halo2_fibonacci(config.exponents()[i], use_shplonk,
+                              &duration_in_us);
+        } else {
+          run_halo2_shuffle(config.exponents()[i], use_shplonk,
+                            &duration_in_us);
+        }
+        // NOTE: The hardware events are not counted for the vendors, since
+        // their setup and keygen can't be excluded.
+        reporter.AddTime(reporter.GetRow(circuit_idx, i),
+                         base::Microseconds(duration_in_us).InSecondsF());
+      }
+    }
+  }
+}
+
+std::vector<std::vector<F>> CreateRandomTable() {
+  return base::CreateVector(Halo2Config::kShuffleWidth, []() {
+    return base::CreateVector(Halo2Config::kShuffleHeight,
+                              []() { return F::Random(); });
+  });
+}
+
+// Returns |table| whose rows are shuffled all in the same way.
+std::vector<std::vector<F>> ShuffleRows(
+    const std::vector<std::vector<F>>& table) {
+  std::vector<size_t> permutation = base::CreateRangedVector(
+      size_t{0}, size_t{Halo2Config::kShuffleHeight});
+  for (size_t i = permutation.size() - 1; i > 0; --i) {
+    std::swap(permutation[i],
+              permutation[base::Uniform(base::Range<size_t>(0, i + 1))]);
+  }
+  return base::Map(table, [&permutation](const std::vector<F>& column) {
+    return base::Map(permutation, [&column](size_t i) { return column[i]; });
+  });
+}
+
+}  // namespace
+
+int RealMain(int argc, char** argv) {
+  math::bn254::BN254Curve::Init();
+
+  Halo2Config config;
+  if (!config.Parse(argc, argv)) {
+    return 1;
+  }
+
+  SimpleHalo2BenchmarkReporter reporter(
+      "Halo2 Prover Benchmark",
+      base::Map(config.circuits(), &Halo2Config::CircuitToString),
+      config.exponents());
+  for (Halo2Config::PCS pcs : config.pcses()) {
+    for (Halo2Config::LS ls : config.lookups()) {
+      reporter.AddVendor(absl::Substitute("tachyon_$0_$1",
+                                          Halo2Config::PCSToString(pcs),
+                                          Halo2Config::LSToString(ls)));
+    }
+  }
+  for (Halo2Config::Vendor vendor : config.vendors()) {
+    for (Halo2Config::PCS pcs : config.pcses()) {
+      reporter.AddVendor(absl::Substitute("$0_$1",
+                                          Halo2Config::VendorToString(vendor),
+                                          Halo2Config::PCSToString(pcs)));
+    }
+  }
+  if (config.perf_counters()) {
+    CHECK(reporter.EnablePerfCounters());
+  }
+
+  for (size_t i = 0; i < config.circuits().size(); ++i) {
+    Halo2Config::Circuit circuit = config.circuits()[i];
+    std::cout << "Benchmarking the " << Halo2Config::CircuitToString(circuit)
+              << " circuit..." << std::endl;
+    switch (circuit) {
+      case Halo2Config::Circuit::kFibonacci: {
+        std::vector<F> instance_column = {F(1), F(1), F(55)};
+        RunTachyonAll(config, i, FibonacciCircuit(),
+                      {Evals(std::move(instance_column))}, reporter);
+        break;
+      }
+      case Halo2Config::Circuit::kShuffle: {
+        std::vector<std::vector<F>> original_table = CreateRandomTable();
+        std::vector<std::vector<F>> shuffled_table =
+            ShuffleRows(original_table);
+        RunTachyonAll(config, i,
+                      ShuffleCircuitImpl(std::move(original_table),
+                                         std::move(shuffled_table)),
+                      {}, reporter);
+        break;
+      }
+      case Halo2Config::Circuit::kMultiLookup: {
+        // NOTE: The lookup table of the circuit has to contain its instance
+        // and |a|.
+        F a = F::Random();
+        std::vector<F> instance_column = {F(2)};
+        RunTachyonAll(config, i,
+                      MultiLookupCircuitImpl(a, {F(2), a, a, F::Zero()}),
+                      {Evals(std::move(instance_column))}, reporter);
+        break;
+      }
+    }
+    RunVendors(config, i, circuit, reporter);
+  }
+
+  reporter.Show();
+  for (size_t i = 0; i < config.circuits().size(); ++i) {
+    reporter.ShowPhases(reporter.GetRow(i, config.exponents().size() - 1));
+  }
+  if (!config.output_path().empty()) {
+    CHECK(reporter.WriteResults(base::FilePath(config.output_path())));
+  }
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
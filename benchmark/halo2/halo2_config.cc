@@ -0,0 +1,234 @@
+#include "benchmark/halo2/halo2_config.h"
+
+#include <string>
+
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/ranges/algorithm.h"
+
+namespace tachyon {
+namespace base {
+
+template <>
+class FlagValueTraits<Halo2Config::Circuit> {
+ public:
+  static bool ParseValue(std::string_view input, Halo2Config::Circuit* value,
+                         std::string* reason) {
+    if (input == "fibonacci") {
+      *value = Halo2Config::Circuit::kFibonacci;
+    } else if (input == "shuffle") {
+      *value = Halo2Config::Circuit::kShuffle;
+    } else if (input == "multi_lookup") {
+      *value = Halo2Config::Circuit::kMultiLookup;
+    } else {
+      *reason = absl::Substitute("Unknown circuit: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
+template <>
+class FlagValueTraits<Halo2Config::PCS> {
+ public:
+  static bool ParseValue(std::string_view input, Halo2Config::PCS* value,
+                         std::string* reason) {
+    if (input == "gwc") {
+      *value = Halo2Config::PCS::kGWC;
+    } else if (input == "shplonk") {
+      *value = Halo2Config::PCS::kSHPlonk;
+    } else {
+      *reason = absl::Substitute("Unknown pcs: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
+template <>
+class FlagValueTraits<Halo2Config::LS> {
+ public:
+  static bool ParseValue(std::string_view input, Halo2Config::LS* value,
+                         std::string* reason) {
+    if (input == "halo2") {
+      *value = Halo2Config::LS::kHalo2;
+    } else if (input == "log_derivative_halo2") {
+      *value = Halo2Config::LS::kLogDerivativeHalo2;
+    } else {
+      *reason = absl::Substitute("Unknown lookup: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
+template <>
+class FlagValueTraits<Halo2Config::Vendor> {
+ public:
+  static bool ParseValue(std::string_view input, Halo2Config::Vendor* value,
+                         std::string* reason) {
+    if (input == "halo2") {
+      *value = Halo2Config::Vendor::kHalo2;
+    } else {
+      *reason = absl::Substitute("Unknown vendor: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace base
+
+// static
+std::string Halo2Config::CircuitToString(Circuit circuit) {
+  switch (circuit) {
+    case Circuit::kFibonacci:
+      return "fibonacci";
+    case Circuit::kShuffle:
+      return "shuffle";
+    case Circuit::kMultiLookup:
+      return "multi_lookup";
+  }
+  NOTREACHED();
+  return "";
+}
+
+// static
+std::string Halo2Config::PCSToString(PCS pcs) {
+  switch (pcs) {
+    case PCS::kGWC:
+      return "gwc";
+    case PCS::kSHPlonk:
+      return "shplonk";
+  }
+  NOTREACHED();
+  return "";
+}
+
+// static
+std::string Halo2Config::LSToString(LS ls) {
+  switch (ls) {
+    case LS::kHalo2:
+      return "halo2";
+    case LS::kLogDerivativeHalo2:
+      return "log_derivative_halo2";
+  }
+  NOTREACHED();
+  return "";
+}
+
+// static
+std::string Halo2Config::VendorToString(Vendor vendor) {
+  switch (vendor) {
+    case Vendor::kHalo2:
+      return "halo2";
+  }
+  NOTREACHED();
+  return "";
+}
+
+// static
+uint32_t Halo2Config::GetMinK(Circuit circuit) {
+  switch (circuit) {
+    case Circuit::kFibonacci:
+      return 4;
+    case Circuit::kShuffle:
+      // |kShuffleHeight| + 1 rows for the grand product and the rows for the
+      // blinding factors.
+      return 9;
+    case Circuit::kMultiLookup:
+      return 5;
+  }
+  NOTREACHED();
+  return 0;
+}
+
+// static
+bool Halo2Config::HasVendorCircuit(Circuit circuit) {
+  return circuit != Circuit::kMultiLookup;
+}
+
+bool Halo2Config::Parse(int argc, char** argv) {
+  base::FlagParser parser;
+  // clang-format off
+  parser.AddFlag<base::Flag<std::vector<uint32_t>>>(&exponents_)
+      .set_short_name("-k")
+      .set_required()
+      .set_help("Specify the exponent 'k' where the size of the domain to prove is 2ᵏ.");
+  // clang-format on
+  parser.AddFlag<base::Flag<std::vector<Circuit>>>(&circuits_)
+      .set_long_name("--circuit")
+      .set_help(
+          "Circuits to be benchmarked with. By default, all of them that the "
+          "vendors implement. (supported circuits: fibonacci, shuffle, "
+          "multi_lookup)");
+  parser.AddFlag<base::Flag<std::vector<PCS>>>(&pcses_)
+      .set_long_name("--pcs")
+      .set_help(
+          "PCSes to be benchmarked with. By default, all of them. (supported "
+          "pcses: gwc, shplonk)");
+  parser.AddFlag<base::Flag<std::vector<LS>>>(&lookups_)
+      .set_long_name("--lookup")
+      .set_help(
+          "Lookup schemes to be benchmarked with. By default, all of them. "
+          "(supported lookups: halo2, log_derivative_halo2)");
+  parser.AddFlag<base::Flag<std::vector<Vendor>>>(&vendors_)
+      .set_long_name("--vendor")
+      .set_help(
+          "Vendors to be benchmarked with. They only support the halo2 "
+          "lookup and don't implement the multi_lookup circuit. (supported "
+          "vendors: halo2)");
+  parser.AddFlag<base::BoolFlag>(&perf_counters_)
+      .set_long_name("--perf_counters")
+      .set_help(
+          "Whether counts the cycles, instructions, LLC misses and dTLB "
+          "misses of each run. Only supported on Linux.");
+  parser.AddFlag<base::StringFlag>(&output_path_)
+      .set_long_name("--output")
+      .set_help(
+          "Writes the results to the path as a JSON if it ends with "
+          "\".json\", or as a CSV otherwise.");
+  {
+    std::string error;
+    if (!parser.Parse(argc, argv, &error)) {
+      tachyon_cerr << error << std::endl;
+      return false;
+    }
+  }
+
+  if (circuits_.empty()) {
+    for (Circuit circuit :
+         {Circuit::kFibonacci, Circuit::kShuffle, Circuit::kMultiLookup}) {
+      if (vendors_.empty() || HasVendorCircuit(circuit)) {
+        circuits_.push_back(circuit);
+      }
+    }
+  }
+  if (pcses_.empty()) {
+    pcses_ = {PCS::kGWC, PCS::kSHPlonk};
+  }
+  if (lookups_.empty()) {
+    lookups_ = {LS::kHalo2, LS::kLogDerivativeHalo2};
+  }
+
+  base::ranges::sort(exponents_);  // NOLINT
+  for (Circuit circuit : circuits_) {
+    if (exponents_.front() < GetMinK(circuit)) {
+      tachyon_cerr << "The " << CircuitToString(circuit)
+                   << " circuit needs k of at least " << GetMinK(circuit)
+                   << std::endl;
+      return false;
+    }
+    if (!vendors_.empty() && !HasVendorCircuit(circuit)) {
+      tachyon_cerr << "The vendors don't implement the "
+                   << CircuitToString(circuit) << " circuit" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace tachyon
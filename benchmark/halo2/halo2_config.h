@@ -0,0 +1,77 @@
+#ifndef BENCHMARK_HALO2_HALO2_CONFIG_H_
+#define BENCHMARK_HALO2_HALO2_CONFIG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace tachyon {
+
+class Halo2Config {
+ public:
+  enum class Circuit {
+    kFibonacci,
+    kShuffle,
+    kMultiLookup,
+  };
+
+  enum class PCS {
+    kGWC,
+    kSHPlonk,
+  };
+
+  enum class LS {
+    kHalo2,
+    kLogDerivativeHalo2,
+  };
+
+  enum class Vendor {
+    kHalo2,
+  };
+
+  // The number of the columns and the rows to shuffle in the shuffle circuit.
+  // NOTE: These should be the same as the ones in
+  // vendors/halo2/benchmark/src/lib.rs.
+  constexpr static size_t kShuffleWidth = 4;
+  constexpr static size_t kShuffleHeight = 256;
+
+  static std::string CircuitToString(Circuit circuit);
+  static std::string PCSToString(PCS pcs);
+  static std::string LSToString(LS ls);
+  static std::string VendorToString(Vendor vendor);
+
+  // Returns the smallest k of the domain that fits |circuit|.
+  static uint32_t GetMinK(Circuit circuit);
+
+  // Returns true if the vendors implement |circuit|.
+  static bool HasVendorCircuit(Circuit circuit);
+
+  Halo2Config() = default;
+  Halo2Config(const Halo2Config& other) = delete;
+  Halo2Config& operator=(const Halo2Config& other) = delete;
+
+  const std::vector<uint32_t>& exponents() const { return exponents_; }
+  const std::vector<Circuit>& circuits() const { return circuits_; }
+  const std::vector<PCS>& pcses() const { return pcses_; }
+  const std::vector<LS>& lookups() const { return lookups_; }
+  const std::vector<Vendor>& vendors() const { return vendors_; }
+  bool perf_counters() const { return perf_counters_; }
+  const std::string& output_path() const { return output_path_; }
+
+  bool Parse(int argc, char** argv);
+
+ private:
+  std::vector<uint32_t> exponents_;
+  std::vector<Circuit> circuits_;
+  std::vector<PCS> pcses_;
+  std::vector<LS> lookups_;
+  std::vector<Vendor> vendors_;
+  bool perf_counters_ = false;
+  std::string output_path_;
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_HALO2_HALO2_CONFIG_H_
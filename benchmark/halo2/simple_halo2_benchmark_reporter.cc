@@ -0,0 +1,80 @@
+#include "benchmark/halo2/simple_halo2_benchmark_reporter.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/console/table_writer.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/ranges/algorithm.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon {
+
+SimpleHalo2BenchmarkReporter::SimpleHalo2BenchmarkReporter(
+    std::string_view title, const std::vector<std::string>& circuits,
+    const std::vector<uint32_t>& exponents)
+    : SimpleBenchmarkReporter(title), num_exponents_(exponents.size()) {
+  for (const std::string& circuit : circuits) {
+    for (uint32_t exponent : exponents) {
+      targets_.push_back(absl::Substitute("$0 (k = $1)", circuit, exponent));
+    }
+  }
+  times_.resize(targets_.size());
+  phases_.resize(targets_.size());
+}
+
+void SimpleHalo2BenchmarkReporter::AddVendor(std::string_view name) {
+  column_headers_.push_back(std::string(name));
+}
+
+void SimpleHalo2BenchmarkReporter::AddPhases(size_t row,
+                                             std::vector<Phase>&& phases) {
+  CHECK(!times_[row].empty());
+  phases_[row].resize(times_[row].size());
+  phases_[row].back() = std::move(phases);
+}
+
+void SimpleHalo2BenchmarkReporter::ShowPhases(size_t row) const {
+  const std::vector<std::vector<Phase>>& phases = phases_[row];
+
+  std::vector<std::string> names;
+  std::vector<size_t> columns;
+  for (size_t i = 0; i < phases.size(); ++i) {
+    if (phases[i].empty()) continue;
+    columns.push_back(i);
+    for (const Phase& phase : phases[i]) {
+      if (base::ranges::find(names, phase.name) == names.end()) {
+        names.push_back(phase.name);
+      }
+    }
+  }
+  if (columns.empty()) return;
+
+  base::TableWriterBuilder builder;
+  builder.AlignHeaderLeft()
+      .AddSpace(1)
+      .FitToTerminalWidth()
+      .StripTrailingAsciiWhitespace()
+      .AddColumn(targets_[row]);
+  for (size_t column : columns) {
+    builder.AddColumn(column_headers_[column]);
+  }
+  base::TableWriter writer = builder.Build();
+
+  for (size_t i = 0; i < names.size(); ++i) {
+    writer.SetElement(i, 0, names[i]);
+    for (size_t j = 0; j < columns.size(); ++j) {
+      double time = 0;
+      for (const Phase& phase : phases[columns[j]]) {
+        if (phase.name == names[i]) time += phase.time;
+      }
+      writer.SetElement(i, j + 1, base::NumberToString(time));
+    }
+  }
+  writer.Print(true);
+}
+
+}  // namespace tachyon
@@ -0,0 +1,52 @@
+#ifndef BENCHMARK_HALO2_SIMPLE_HALO2_BENCHMARK_REPORTER_H_
+#define BENCHMARK_HALO2_SIMPLE_HALO2_BENCHMARK_REPORTER_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "benchmark/simple_benchmark_reporter.h"
+
+namespace tachyon {
+
+class SimpleHalo2BenchmarkReporter : public SimpleBenchmarkReporter {
+ public:
+  struct Phase {
+    std::string name;
+    double time;
+  };
+
+  // The rows are the pairs of |circuits| and |exponents|.
+  SimpleHalo2BenchmarkReporter(std::string_view title,
+                               const std::vector<std::string>& circuits,
+                               const std::vector<uint32_t>& exponents);
+  SimpleHalo2BenchmarkReporter(const SimpleHalo2BenchmarkReporter& other) =
+      delete;
+  SimpleHalo2BenchmarkReporter& operator=(
+      const SimpleHalo2BenchmarkReporter& other) = delete;
+
+  void AddVendor(std::string_view name);
+
+  // Returns the index of the row of the |exponent_idx|-th exponent of the
+  // |circuit_idx|-th circuit.
+  size_t GetRow(size_t circuit_idx, size_t exponent_idx) const {
+    return circuit_idx * num_exponents_ + exponent_idx;
+  }
+
+  // Adds the breakdown of the run whose time was added last to |row|.
+  void AddPhases(size_t row, std::vector<Phase>&& phases);
+
+  // Prints the breakdowns of the runs of |row|.
+  void ShowPhases(size_t row) const;
+
+ private:
+  size_t num_exponents_;
+  // |phases_[i][j]| is the breakdown of |times_[i][j]|, which is empty for the
+  // vendors.
+  std::vector<std::vector<std::vector<Phase>>> phases_;
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_HALO2_SIMPLE_HALO2_BENCHMARK_REPORTER_H_
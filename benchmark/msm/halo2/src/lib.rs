@@ -1,7 +1,8 @@
 use halo2_proofs::halo2curves::bn256::{ Fr, G1Affine, Bn256 };
 use halo2_proofs::poly::commitment::MSM;
 use halo2_proofs::poly::kzg::msm::MSMKZG;
-use std::{ mem, slice, time::Instant };
+use std::{ slice, time::Instant };
+use tachyon_rs::base::cast_slice;
 use tachyon_rs::math::elliptic_curves::bn::bn254::{
     Fr as CppFr,
     G1AffinePoint as CppG1AffinePoint,
@@ -19,19 +20,11 @@ pub extern "C" fn run_msm_halo2(
         let bases: &[CppG1AffinePoint] = slice::from_raw_parts(bases, size);
         let scalars: &[CppFr] = slice::from_raw_parts(scalars, size);
 
-        let mut bases_vec = Vec::<G1Affine>::new();
-        bases_vec.reserve_exact(bases.len());
-        for i in 0..size {
-            bases_vec.push(G1Affine {
-                x: mem::transmute(bases[i].x),
-                y: mem::transmute(bases[i].y),
-            });
-        }
-
-        let scalars: &[Fr] = mem::transmute(scalars);
+        let bases: &[G1Affine] = cast_slice(bases);
+        let scalars: &[Fr] = cast_slice(scalars);
 
         let mut msm = MSMKZG::<Bn256>::new();
-        for (base, scalar) in bases_vec.iter().zip(scalars.iter()) {
+        for (base, scalar) in bases.iter().zip(scalars.iter()) {
             msm.append_term(*scalar, base.into());
         }
         let start = Instant::now();
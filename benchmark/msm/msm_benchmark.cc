@@ -8,6 +8,8 @@
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_traits.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_type_traits.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/msm.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
 
 namespace tachyon {
 
@@ -25,18 +27,38 @@ extern "C" tachyon_bn254_g1_jacobian* run_msm_halo2(
     const tachyon_bn254_g1_affine* bases, const tachyon_bn254_fr* scalars,
     size_t size, uint64_t* duration_in_us);
 
+tachyon_bn254_g1_jacobian* RunMSMWithBatchAffine(
+    PippengerAdapter<bn254::G1AffinePoint>* pippenger,
+    const tachyon_bn254_g1_affine* bases, const tachyon_bn254_fr* scalars,
+    size_t size) {
+  const bn254::G1AffinePoint* bases_first = c::base::native_cast(bases);
+  const bn254::Fr* scalars_first = c::base::native_cast(scalars);
+  bn254::G1PointXYZZ bucket;
+  CHECK(pippenger->Run(bases_first, bases_first + size, scalars_first,
+                       scalars_first + size, &bucket));
+  return c::base::c_cast(new bn254::G1JacobianPoint(
+      ConvertPoint<bn254::G1JacobianPoint>(bucket)));
+}
+
 int RealMain(int argc, char** argv) {
   MSMConfig config;
   MSMConfig::Options options;
   options.include_vendors = true;
+  options.include_batch_affine = true;
   if (!config.Parse(argc, argv, options)) {
     return 1;
   }
 
   SimpleMSMBenchmarkReporter reporter("MSM Benchmark", config.exponents());
+  if (config.batch_affine()) {
+    reporter.AddVendor("tachyon_batch_affine");
+  }
   for (const MSMConfig::Vendor vendor : config.vendors()) {
     reporter.AddVendor(MSMConfig::VendorToString(vendor));
   }
+  if (config.perf_counters()) {
+    CHECK(reporter.EnablePerfCounters());
+  }
 
   std::vector<uint64_t> point_nums = config.GetPointNums();
 
@@ -54,6 +76,17 @@ int RealMain(int argc, char** argv) {
   runner.SetInputs(&test_set.bases, &test_set.scalars);
   std::vector<bn254::G1JacobianPoint> results;
   runner.Run(tachyon_bn254_g1_affine_msm, msm, point_nums, &results);
+  if (config.batch_affine()) {
+    PippengerAdapter<bn254::G1AffinePoint> pippenger;
+    pippenger.SetAccumulationStrategy(
+        PippengerAccumulationStrategy::kBatchAffine);
+    std::vector<bn254::G1JacobianPoint> results_batch_affine;
+    runner.Run(RunMSMWithBatchAffine, &pippenger, point_nums,
+               &results_batch_affine);
+    if (config.check_results()) {
+      CHECK(results == results_batch_affine) << "Result not matched";
+    }
+  }
   for (const MSMConfig::Vendor vendor : config.vendors()) {
     std::vector<bn254::G1JacobianPoint> results_vendor;
     switch (vendor) {
@@ -74,6 +107,9 @@ int RealMain(int argc, char** argv) {
   }
 
   reporter.Show();
+  if (!config.output_path().empty()) {
+    CHECK(reporter.WriteResults(base::FilePath(config.output_path())));
+  }
 
   tachyon_bn254_g1_destroy_msm(msm);
 
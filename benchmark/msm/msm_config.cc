@@ -7,6 +7,7 @@
 #include "tachyon/base/console/iostream.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/memory/huge_page_allocator.h"
 #include "tachyon/base/ranges/algorithm.h"
 
 namespace tachyon {
@@ -48,6 +49,25 @@ class FlagValueTraits<MSMConfig::Vendor> {
   }
 };
 
+template <>
+class FlagValueTraits<HugePageMode> {
+ public:
+  static bool ParseValue(std::string_view input, HugePageMode* value,
+                         std::string* reason) {
+    if (input == "none") {
+      *value = HugePageMode::kNone;
+    } else if (input == "transparent") {
+      *value = HugePageMode::kTransparent;
+    } else if (input == "hugetlb") {
+      *value = HugePageMode::kHugeTlb;
+    } else {
+      *reason = absl::Substitute("Unknown huge page mode: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
 }  // namespace base
 
 // static
@@ -81,6 +101,22 @@ bool MSMConfig::Parse(int argc, char** argv,
       .set_help(
           "Testset to be benchmarked with. (supported testset: random, "
           "non_uniform)");
+  parser.AddFlag<base::BoolFlag>(&perf_counters_)
+      .set_long_name("--perf_counters")
+      .set_help(
+          "Whether counts the cycles, instructions, LLC misses and dTLB "
+          "misses of each run. Only supported on Linux.");
+  parser.AddFlag<base::StringFlag>(&output_path_)
+      .set_long_name("--output")
+      .set_help(
+          "Writes the results to the path as a JSON if it ends with "
+          "\".json\", or as a CSV otherwise.");
+  base::HugePageMode huge_page_mode = base::HugePageMode::kNone;
+  parser.AddFlag<base::Flag<base::HugePageMode>>(&huge_page_mode)
+      .set_long_name("--huge_pages")
+      .set_help(
+          "How the buckets of pippenger are backed by huge pages. (supported "
+          "modes: none, transparent, hugetlb)");
   if (options.include_vendors) {
     parser.AddFlag<base::Flag<std::vector<Vendor>>>(&vendors_)
         .set_long_name("--vendor")
@@ -88,6 +124,13 @@ bool MSMConfig::Parse(int argc, char** argv,
             "Vendors to be benchmarked with. (supported vendors: arkworks, "
             "bellman, halo2)");
   }
+  if (options.include_batch_affine) {
+    parser.AddFlag<base::BoolFlag>(&batch_affine_)
+        .set_long_name("--batch_affine")
+        .set_help(
+            "Whether benchmarks pippenger with batch affine accumulation as "
+            "well.");
+  }
   if (options.include_algos) {
     parser
         .AddFlag<base::IntFlag>(
@@ -115,6 +158,7 @@ bool MSMConfig::Parse(int argc, char** argv,
     }
   }
 
+  base::SetHugePageMode(huge_page_mode);
   base::ranges::sort(exponents_);  // NOLINT
   return true;
 }
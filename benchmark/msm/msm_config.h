@@ -26,6 +26,7 @@ class MSMConfig {
   struct Options {
     bool include_vendors = false;
     bool include_algos = false;
+    bool include_batch_affine = false;
   };
 
   static std::string VendorToString(Vendor vendor);
@@ -38,6 +39,9 @@ class MSMConfig {
   const std::vector<Vendor>& vendors() const { return vendors_; }
   int algorithm() const { return algorithm_; }
   bool check_results() const { return check_results_; }
+  bool batch_affine() const { return batch_affine_; }
+  bool perf_counters() const { return perf_counters_; }
+  const std::string& output_path() const { return output_path_; }
 
   bool Parse(int argc, char** argv, const Options& options);
 
@@ -65,6 +69,9 @@ class MSMConfig {
   int algorithm_ = 0;
   TestSet test_set_ = TestSet::kRandom;
   bool check_results_ = false;
+  bool batch_affine_ = false;
+  bool perf_counters_ = false;
+  std::string output_path_;
 };
 
 }  // namespace tachyon
@@ -46,11 +46,13 @@ class MSMRunner {
            std::vector<RetPoint>* results) {
     results->clear();
     for (size_t i = 0; i < point_nums.size(); ++i) {
+      PerfCounters::Values counters = reporter_->ReadPerfCounters();
       base::TimeTicks now = base::TimeTicks::Now();
       std::unique_ptr<CRetPoint> ret;
       ret.reset(fn(msm, c::base::c_cast(bases_->data()),
                    c::base::c_cast(scalars_->data()), point_nums[i]));
-      reporter_->AddTime(i, (base::TimeTicks::Now() - now).InSecondsF());
+      reporter_->AddTime(i, (base::TimeTicks::Now() - now).InSecondsF(),
+                         counters);
       results->push_back(*c::base::native_cast(ret.get()));
     }
   }
@@ -61,10 +63,12 @@ class MSMRunner {
     for (size_t i = 0; i < point_nums.size(); ++i) {
       std::unique_ptr<CRetPoint> ret;
       uint64_t duration_in_us;
+      PerfCounters::Values counters = reporter_->ReadPerfCounters();
       ret.reset(fn(c::base::c_cast(bases_->data()),
                    c::base::c_cast(scalars_->data()), point_nums[i],
                    &duration_in_us));
-      reporter_->AddTime(i, base::Microseconds(duration_in_us).InSecondsF());
+      reporter_->AddTime(i, base::Microseconds(duration_in_us).InSecondsF(),
+                         counters);
       results->push_back(*c::base::native_cast(ret.get()));
     }
   }
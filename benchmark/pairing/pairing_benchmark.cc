@@ -0,0 +1,65 @@
+#include <iostream>
+#include <vector>
+
+#include "absl/types/span.h"
+
+// clang-format off
+#include "benchmark/pairing/pairing_config.h"
+#include "benchmark/pairing/simple_pairing_benchmark_reporter.h"
+// clang-format on
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/time/time_interval.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/math/elliptic_curves/test/random.h"
+
+namespace tachyon {
+
+using namespace math;
+
+int RealMain(int argc, char** argv) {
+  using Curve = bn254::BN254Curve;
+  using G1AffinePoint = bn254::G1AffinePoint;
+  using G2AffinePoint = bn254::G2AffinePoint;
+  using G2Prepared = Curve::G2Prepared;
+  using Fp12 = Curve::Fp12;
+
+  PairingConfig config;
+  if (!config.Parse(argc, argv)) {
+    return 1;
+  }
+
+  Curve::Init();
+
+  const std::vector<uint64_t>& pair_nums = config.pair_nums();
+  SimplePairingBenchmarkReporter reporter("Pairing benchmark", pair_nums);
+
+  std::cout << "Generating random points..." << std::endl;
+  uint64_t max_pair_num = pair_nums.back();
+  std::vector<G1AffinePoint> g1_points =
+      CreatePseudoRandomPoints<G1AffinePoint>(max_pair_num);
+  std::vector<G2Prepared> g2_points = base::CreateVector(
+      max_pair_num, []() { return G2Prepared::From(G2AffinePoint::Random()); });
+  std::cout << "Generation completed" << std::endl;
+
+  base::TimeInterval interval;
+  for (size_t i = 0; i < pair_nums.size(); ++i) {
+    absl::Span<const G1AffinePoint> g1 =
+        absl::MakeConstSpan(g1_points).first(pair_nums[i]);
+    absl::Span<const G2Prepared> g2 =
+        absl::MakeConstSpan(g2_points).first(pair_nums[i]);
+
+    interval.Reset();
+    Fp12 f = Curve::MultiMillerLoop(g1, g2);
+    reporter.AddTime(i, interval.GetTimeDelta().InSecondsF());
+    f = Curve::FinalExponentiation(f);
+    reporter.AddTime(i, interval.GetTimeDelta().InSecondsF());
+  }
+
+  reporter.Show();
+
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
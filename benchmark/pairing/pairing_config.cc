@@ -0,0 +1,29 @@
+#include "benchmark/pairing/pairing_config.h"
+
+#include <string>
+
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/ranges/algorithm.h"
+
+namespace tachyon {
+
+bool PairingConfig::Parse(int argc, char** argv) {
+  base::FlagParser parser;
+  parser.AddFlag<base::Flag<std::vector<uint64_t>>>(&pair_nums_)
+      .set_short_name("-n")
+      .set_required()
+      .set_help("The number of pairs to test");
+  {
+    std::string error;
+    if (!parser.Parse(argc, argv, &error)) {
+      tachyon_cerr << error << std::endl;
+      return false;
+    }
+  }
+
+  base::ranges::sort(pair_nums_);  // NOLINT
+  return true;
+}
+
+}  // namespace tachyon
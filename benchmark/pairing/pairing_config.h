@@ -0,0 +1,26 @@
+#ifndef BENCHMARK_PAIRING_PAIRING_CONFIG_H_
+#define BENCHMARK_PAIRING_PAIRING_CONFIG_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace tachyon {
+
+class PairingConfig {
+ public:
+  PairingConfig() = default;
+  PairingConfig(const PairingConfig& other) = delete;
+  PairingConfig& operator=(const PairingConfig& other) = delete;
+
+  const std::vector<uint64_t>& pair_nums() const { return pair_nums_; }
+
+  bool Parse(int argc, char** argv);
+
+ private:
+  std::vector<uint64_t> pair_nums_;
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_PAIRING_PAIRING_CONFIG_H_
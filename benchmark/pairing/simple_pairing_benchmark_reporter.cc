@@ -0,0 +1,21 @@
+#include "benchmark/pairing/simple_pairing_benchmark_reporter.h"
+
+#include <string>
+#include <vector>
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon {
+
+SimplePairingBenchmarkReporter::SimplePairingBenchmarkReporter(
+    std::string_view title, const std::vector<uint64_t>& nums)
+    : SimpleBenchmarkReporter(title) {
+  column_headers_.push_back("MultiMillerLoop");
+  column_headers_.push_back("FinalExponentiation");
+  targets_ =
+      base::Map(nums, [](uint64_t num) { return base::NumberToString(num); });
+  times_.resize(nums.size());
+}
+
+}  // namespace tachyon
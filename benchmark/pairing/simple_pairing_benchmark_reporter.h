@@ -0,0 +1,24 @@
+#ifndef BENCHMARK_PAIRING_SIMPLE_PAIRING_BENCHMARK_REPORTER_H_
+#define BENCHMARK_PAIRING_SIMPLE_PAIRING_BENCHMARK_REPORTER_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "benchmark/simple_benchmark_reporter.h"
+
+namespace tachyon {
+
+class SimplePairingBenchmarkReporter : public SimpleBenchmarkReporter {
+ public:
+  SimplePairingBenchmarkReporter(std::string_view title,
+                                 const std::vector<uint64_t>& nums);
+  SimplePairingBenchmarkReporter(const SimplePairingBenchmarkReporter& other) =
+      delete;
+  SimplePairingBenchmarkReporter& operator=(
+      const SimplePairingBenchmarkReporter& other) = delete;
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_PAIRING_SIMPLE_PAIRING_BENCHMARK_REPORTER_H_
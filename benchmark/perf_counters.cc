@@ -0,0 +1,152 @@
+#include "benchmark/perf_counters.h"
+
+#include <unistd.h>
+
+#include "tachyon/build/build_config.h"
+
+#if BUILDFLAG(IS_LINUX)
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/syscall.h>
+#endif
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/posix/eintr_wrapper.h"
+
+namespace tachyon {
+
+namespace {
+
+#if BUILDFLAG(IS_LINUX)
+struct EventConfig {
+  uint32_t type;
+  uint64_t config;
+};
+
+EventConfig GetEventConfig(PerfCounters::Event event) {
+  switch (event) {
+    case PerfCounters::Event::kCycles:
+      return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+    case PerfCounters::Event::kInstructions:
+      return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS};
+    case PerfCounters::Event::kLLCMisses:
+      return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES};
+    case PerfCounters::Event::kDTLBMisses:
+      return {PERF_TYPE_HW_CACHE,
+              PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+  }
+  NOTREACHED();
+  return {};
+}
+
+int OpenCounter(PerfCounters::Event event) {
+  EventConfig event_config = GetEventConfig(event);
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = event_config.type;
+  attr.config = event_config.config;
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  // NOTE: The threads spawned after this are counted along with the calling
+  // thread, and reading the counter sums up all of them.
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, /*pid=*/0,
+                                  /*cpu=*/-1, /*group_fd=*/-1, /*flags=*/0));
+}
+#endif  // BUILDFLAG(IS_LINUX)
+
+}  // namespace
+
+// static
+std::string_view PerfCounters::EventToString(Event event) {
+  switch (event) {
+    case Event::kCycles:
+      return "cycles";
+    case Event::kInstructions:
+      return "instructions";
+    case Event::kLLCMisses:
+      return "llc_misses";
+    case Event::kDTLBMisses:
+      return "dtlb_misses";
+  }
+  NOTREACHED();
+  return "";
+}
+
+// static
+PerfCounters::Values PerfCounters::Sub(const Values& a, const Values& b) {
+  Values ret;
+  for (size_t i = 0; i < kNumEvents; ++i) {
+    ret[i] = a[i] >= b[i] ? a[i] - b[i] : 0;
+  }
+  return ret;
+}
+
+PerfCounters::PerfCounters() { fds_.fill(-1); }
+
+PerfCounters::~PerfCounters() {
+  for (int fd : fds_) {
+    if (fd >= 0) IGNORE_EINTR(close(fd));
+  }
+}
+
+bool PerfCounters::IsValid() const {
+  for (int fd : fds_) {
+    if (fd >= 0) return true;
+  }
+  return false;
+}
+
+bool PerfCounters::Initialize() {
+  if (IsValid()) {
+    LOG(ERROR) << "Already initialized";
+    return false;
+  }
+#if BUILDFLAG(IS_LINUX)
+  for (size_t i = 0; i < kNumEvents; ++i) {
+    Event event = static_cast<Event>(i);
+    fds_[i] = OpenCounter(event);
+    if (fds_[i] < 0) {
+      PLOG(WARNING) << "perf_event_open() for " << EventToString(event);
+    }
+  }
+  if (!IsValid()) {
+    LOG(ERROR) << "No hardware counter is available, check "
+                  "/proc/sys/kernel/perf_event_paranoid";
+    return false;
+  }
+  return true;
+#else
+  LOG(ERROR) << "Hardware counters are only supported on Linux";
+  return false;
+#endif
+}
+
+PerfCounters::Values PerfCounters::Read() const {
+  Values ret{};
+#if BUILDFLAG(IS_LINUX)
+  for (size_t i = 0; i < kNumEvents; ++i) {
+    if (fds_[i] < 0) continue;
+    // The value, the time enabled and the time running.
+    uint64_t data[3];
+    if (HANDLE_EINTR(read(fds_[i], data, sizeof(data))) !=
+        static_cast<ssize_t>(sizeof(data))) {
+      PLOG(ERROR) << "read()";
+      continue;
+    }
+    if (data[2] == 0) continue;
+    ret[i] = data[2] < data[1] ? static_cast<uint64_t>(
+                                     static_cast<double>(data[0]) * data[1] /
+                                     data[2])
+                               : data[0];
+  }
+#endif
+  return ret;
+}
+
+}  // namespace tachyon
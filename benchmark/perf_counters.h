@@ -0,0 +1,63 @@
+#ifndef BENCHMARK_PERF_COUNTERS_H_
+#define BENCHMARK_PERF_COUNTERS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <string_view>
+
+namespace tachyon {
+
+// |PerfCounters| counts the hardware events of the whole process with
+// perf_event_open() of Linux. Only the user space is counted, so that it works
+// unless /proc/sys/kernel/perf_event_paranoid is greater than 2. On the other
+// platforms, |Initialize()| always fails.
+//
+//   PerfCounters counters;
+//   CHECK(counters.Initialize());
+//   PerfCounters::Values start = counters.Read();
+//   // heavy calculation
+//   PerfCounters::Values delta = PerfCounters::Sub(counters.Read(), start);
+class PerfCounters {
+ public:
+  enum class Event {
+    kCycles,
+    kInstructions,
+    kLLCMisses,
+    kDTLBMisses,
+  };
+
+  constexpr static size_t kNumEvents = 4;
+
+  // The values indexed by |Event|.
+  using Values = std::array<uint64_t, kNumEvents>;
+
+  static std::string_view EventToString(Event event);
+
+  static Values Sub(const Values& a, const Values& b);
+
+  PerfCounters();
+  PerfCounters(const PerfCounters& other) = delete;
+  PerfCounters& operator=(const PerfCounters& other) = delete;
+  ~PerfCounters();
+
+  bool IsValid() const;
+
+  // Opens a counter for each event. Returns false if none of them can be
+  // opened. The events not supported by the cpu are always read as 0.
+  // NOTE: The threads spawned before this are not counted, so this should be
+  // called before using any thread pool.
+  [[nodiscard]] bool Initialize();
+
+  // Returns the number of events counted from |Initialize()|. The counts are
+  // scaled up if the kernel had to multiplex the counters.
+  Values Read() const;
+
+ private:
+  std::array<int, kNumEvents> fds_;
+};
+
+}  // namespace tachyon
+
+#endif  // BENCHMARK_PERF_COUNTERS_H_
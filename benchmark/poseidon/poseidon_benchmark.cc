@@ -27,18 +27,27 @@ int RealMain(int argc, char** argv) {
   Field::Init();
   SimplePoseidonBenchmarkReporter reporter("Poseidon Benchmark",
                                            config.repeating_num());
+  reporter.AddVendor("tachyon_optimized");
   reporter.AddVendor("arkworks");
+  if (config.perf_counters()) {
+    CHECK(reporter.EnablePerfCounters());
+  }
   PoseidonBenchmarkRunner<Field> runner(&reporter, &config);
 
-  Field result = runner.Run();
+  Field result = runner.Run(/*use_optimized_constants=*/false);
+  Field result_optimized = runner.Run(/*use_optimized_constants=*/true);
   Field result_arkworks = runner.RunExternal(run_poseidon_arkworks);
 
   if (config.check_results()) {
+    CHECK_EQ(result, result_optimized) << "Result not matched";
     CHECK_EQ(result, result_arkworks) << "Result not matched";
   }
 
   reporter.AddAverageToLastRow();
   reporter.Show();
+  if (!config.output_path().empty()) {
+    CHECK(reporter.WriteResults(base::FilePath(config.output_path())));
+  }
 
   return 0;
 }
@@ -32,15 +32,22 @@ class PoseidonBenchmarkRunner {
                           PoseidonConfig* config)
       : reporter_(reporter), config_(config) {}
 
-  Field Run() {
+  // If |use_optimized_constants| is true, the sponge permutes with the
+  // optimized constants, see |crypto::PoseidonOptimizedConstants|.
+  Field Run(bool use_optimized_constants) {
     Field ret;
     for (size_t i = 0; i < config_->repeating_num(); ++i) {
       crypto::PoseidonConfig<Field> config =
           crypto::PoseidonConfig<Field>::CreateCustom(8, 5, 8, 63, 0);
+      if (use_optimized_constants) {
+        CHECK(config.UseOptimizedConstants());
+      }
       crypto::PoseidonSponge<Field> sponge(config);
+      PerfCounters::Values counters = reporter_->ReadPerfCounters();
       base::TimeTicks start = base::TimeTicks::Now();
       sponge.Permute();
-      reporter_->AddTime(i, (base::TimeTicks::Now() - start).InSecondsF());
+      reporter_->AddTime(i, (base::TimeTicks::Now() - start).InSecondsF(),
+                         counters);
       if (i == 0) {
         ret = sponge.state.elements[1];
       }
@@ -52,8 +59,10 @@ class PoseidonBenchmarkRunner {
     std::unique_ptr<CPrimeField> ret;
     for (size_t i = 0; i < config_->repeating_num(); ++i) {
       uint64_t duration_in_us;
+      PerfCounters::Values counters = reporter_->ReadPerfCounters();
       ret.reset(fn(&duration_in_us));
-      reporter_->AddTime(i, base::Microseconds(duration_in_us).InSecondsF());
+      reporter_->AddTime(i, base::Microseconds(duration_in_us).InSecondsF(),
+                         counters);
     }
     return *c::base::native_cast(ret.get());
   }
@@ -16,6 +16,16 @@ bool PoseidonConfig::Parse(int argc, char** argv) {
   parser.AddFlag<base::Flag<bool>>(&check_results_)
       .set_long_name("--check_results")
       .set_help("Whether checks results generated by each poseidon runner.");
+  parser.AddFlag<base::BoolFlag>(&perf_counters_)
+      .set_long_name("--perf_counters")
+      .set_help(
+          "Whether counts the cycles, instructions, LLC misses and dTLB "
+          "misses of each run. Only supported on Linux.");
+  parser.AddFlag<base::StringFlag>(&output_path_)
+      .set_long_name("--output")
+      .set_help(
+          "Writes the results to the path as a JSON if it ends with "
+          "\".json\", or as a CSV otherwise.");
 
   std::string error;
   if (!parser.Parse(argc, argv, &error)) {
@@ -3,6 +3,8 @@
 
 #include <stddef.h>
 
+#include <string>
+
 namespace tachyon {
 
 class PoseidonConfig {
@@ -13,12 +15,16 @@ class PoseidonConfig {
 
   bool check_results() const { return check_results_; }
   size_t repeating_num() const { return repeating_num_; }
+  bool perf_counters() const { return perf_counters_; }
+  const std::string& output_path() const { return output_path_; }
 
   bool Parse(int argc, char** argv);
 
  private:
   bool check_results_ = false;
   size_t repeating_num_ = 10;
+  bool perf_counters_ = false;
+  std::string output_path_;
 };
 
 }  // namespace tachyon
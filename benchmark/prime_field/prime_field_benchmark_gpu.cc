@@ -0,0 +1,145 @@
+#if TACHYON_CUDA || TACHYON_USE_ROCM
+
+#include <stdint.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/simple_benchmark_reporter.h"
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/ranges/algorithm.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+#include "tachyon/base/time/time_interval.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq_gpu.h"
+#include "tachyon/math/finite_fields/kernels/prime_field_ops.cu.h"
+#include "tachyon/math/finite_fields/prime_field_conversions.h"
+
+namespace tachyon {
+
+using namespace device;
+using namespace math;
+
+namespace {
+
+constexpr size_t kThreadNum = 32;
+
+class SimplePrimeFieldBenchmarkReporter : public SimpleBenchmarkReporter {
+ public:
+  explicit SimplePrimeFieldBenchmarkReporter(const std::vector<uint64_t>& nums)
+      : SimpleBenchmarkReporter("Prime field benchmark") {
+    column_headers_.push_back("Mul");
+    column_headers_.push_back("Square");
+    column_headers_.push_back("Mul + Mul + Add");
+    column_headers_.push_back("SumOfTwoProducts");
+    targets_ =
+        base::Map(nums, [](uint64_t num) { return base::NumberToString(num); });
+    times_.resize(nums.size());
+  }
+};
+
+// a * b + c * d with 2 montgomery reductions
+__global__ void MulMulAdd(const bn254::FqGpu* a, const bn254::FqGpu* b,
+                          const bn254::FqGpu* c, const bn254::FqGpu* d,
+                          bn254::FqGpu* result, unsigned int count) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= count) return;
+  result[gid] = a[gid] * b[gid] + c[gid] * d[gid];
+}
+
+gpuError_t Synchronize(std::string_view method) {
+  gpuError_t error = LOG_IF_GPU_LAST_ERROR("Failed to " << method << "()");
+  return error == gpuSuccess
+             ? LOG_IF_GPU_ERROR(gpuDeviceSynchronize(),
+                                "Failed to gpuDeviceSynchronize()")
+             : error;
+}
+
+}  // namespace
+
+int RealMain(int argc, char** argv) {
+  std::vector<uint64_t> nums;
+  base::FlagParser parser;
+  parser.AddFlag<base::Flag<std::vector<uint64_t>>>(&nums)
+      .set_short_name("-n")
+      .set_required()
+      .set_help("The number of field elements to test");
+  {
+    std::string error;
+    if (!parser.Parse(argc, argv, &error)) {
+      tachyon_cerr << error << std::endl;
+      return 1;
+    }
+  }
+  base::ranges::sort(nums);  // NOLINT
+
+  bn254::Fq::Init();
+  bn254::FqGpu::Init();
+
+  SimplePrimeFieldBenchmarkReporter reporter(nums);
+
+  GPU_MUST_SUCCESS(gpuDeviceReset(), "Failed to gpuDeviceReset()");
+  uint64_t max_num = nums.back();
+  std::vector<gpu::GpuMemory<bn254::FqGpu>> inputs;
+  for (size_t i = 0; i < 4; ++i) {
+    inputs.push_back(gpu::GpuMemory<bn254::FqGpu>::MallocManaged(max_num));
+  }
+  auto results = gpu::GpuMemory<bn254::FqGpu>::MallocManaged(max_num);
+
+  std::cout << "Generating random field elements..." << std::endl;
+  for (gpu::GpuMemory<bn254::FqGpu>& input : inputs) {
+    for (uint64_t i = 0; i < max_num; ++i) {
+      input[i] = ConvertPrimeField<bn254::FqGpu>(bn254::Fq::Random());
+    }
+  }
+  std::cout << "Generation completed" << std::endl;
+
+  const bn254::FqGpu* a = inputs[0].get();
+  const bn254::FqGpu* b = inputs[1].get();
+  const bn254::FqGpu* c = inputs[2].get();
+  const bn254::FqGpu* d = inputs[3].get();
+  for (size_t i = 0; i < nums.size(); ++i) {
+    unsigned int count = nums[i];
+    unsigned int block_num = (count - 1) / kThreadNum + 1;
+
+    base::TimeInterval interval(base::TimeTicks::Now());
+    kernels::Mul<<<block_num, kThreadNum>>>(a, a, results.get(), count);
+    GPU_MUST_SUCCESS(Synchronize("Mul"), "");
+    reporter.AddTime(i, interval.GetTimeDelta().InSecondsF());
+
+    kernels::Square<<<block_num, kThreadNum>>>(a, results.get(), count);
+    GPU_MUST_SUCCESS(Synchronize("Square"), "");
+    reporter.AddTime(i, interval.GetTimeDelta().InSecondsF());
+
+    MulMulAdd<<<block_num, kThreadNum>>>(a, b, c, d, results.get(), count);
+    GPU_MUST_SUCCESS(Synchronize("MulMulAdd"), "");
+    reporter.AddTime(i, interval.GetTimeDelta().InSecondsF());
+
+    kernels::SumOfTwoProducts<<<block_num, kThreadNum>>>(a, b, c, d,
+                                                         results.get(), count);
+    GPU_MUST_SUCCESS(Synchronize("SumOfTwoProducts"), "");
+    reporter.AddTime(i, interval.GetTimeDelta().InSecondsF());
+  }
+
+  reporter.Show();
+
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
+#else
+#include "tachyon/base/console/iostream.h"
+
+int main(int argc, char **argv) {
+  tachyon_cerr << "please build with --config cuda or --config rocm"
+               << std::endl;
+  return 1;
+}
+#endif  // TACHYON_CUDA
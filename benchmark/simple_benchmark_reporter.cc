@@ -1,20 +1,114 @@
 #include "benchmark/simple_benchmark_reporter.h"
 
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #if defined(TACHYON_HAS_MATPLOTLIB)
 #include "third_party/matplotlibcpp17/include/pyplot.h"
 
 using namespace matplotlibcpp17;
 #endif  // defined(TACHYON_HAS_MATPLOTLIB)
 
+#include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
 #include "absl/strings/substitute.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
 
 #include "tachyon/base/console/table_writer.h"
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/strings/string_number_conversions.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/version.h"
+
+#if BUILDFLAG(IS_MAC)
+#include <sys/sysctl.h>
+#endif
 
 namespace tachyon {
 
+namespace {
+
+// Returns the model name of the CPU, or an empty string if it is unknown.
+std::string GetCpuModel() {
+#if BUILDFLAG(IS_LINUX)
+  std::string cpuinfo;
+  if (!base::ReadFileToString(base::FilePath("/proc/cpuinfo"), &cpuinfo)) {
+    return "";
+  }
+  for (std::string_view line : absl::StrSplit(cpuinfo, '\n')) {
+    std::vector<std::string_view> key_and_value =
+        absl::StrSplit(line, absl::MaxSplits(':', 1));
+    if (key_and_value.size() == 2 &&
+        absl::StripAsciiWhitespace(key_and_value[0]) == "model name") {
+      return std::string(absl::StripAsciiWhitespace(key_and_value[1]));
+    }
+  }
+  return "";
+#elif BUILDFLAG(IS_MAC)
+  char brand[256];
+  size_t size = sizeof(brand);
+  if (sysctlbyname("machdep.cpu.brand_string", brand, &size, nullptr, 0) !=
+      0) {
+    return "";
+  }
+  return std::string(brand);
+#else
+  return "";
+#endif
+}
+
+// NOTE: This is the same as the number of threads of
+// |base::ThreadPool::GetDefault()|.
+size_t GetNumThreads() {
+#if defined(TACHYON_HAS_OPENMP)
+  return static_cast<size_t>(omp_get_max_threads());
+#else
+  return std::max(size_t{std::thread::hardware_concurrency()}, size_t{1});
+#endif
+}
+
+}  // namespace
+
+bool SimpleBenchmarkReporter::EnablePerfCounters() {
+  auto perf_counters = std::make_unique<PerfCounters>();
+  if (!perf_counters->Initialize()) return false;
+  perf_counters_ = std::move(perf_counters);
+  return true;
+}
+
+PerfCounters::Values SimpleBenchmarkReporter::ReadPerfCounters() const {
+  if (!perf_counters_) return {};
+  return perf_counters_->Read();
+}
+
+void SimpleBenchmarkReporter::AddTime(size_t idx, double time) {
+  times_[idx].push_back(time);
+  if (perf_counters_) {
+    counters_.resize(times_.size());
+    counters_[idx].push_back(std::nullopt);
+  }
+}
+
+void SimpleBenchmarkReporter::AddTime(
+    size_t idx, double time, const PerfCounters::Values& counters_at_start) {
+  if (!perf_counters_) {
+    AddTime(idx, time);
+    return;
+  }
+  PerfCounters::Values counters =
+      PerfCounters::Sub(perf_counters_->Read(), counters_at_start);
+  times_[idx].push_back(time);
+  counters_.resize(times_.size());
+  counters_[idx].push_back(counters);
+}
+
 void SimpleBenchmarkReporter::Show() {
   base::TableWriterBuilder builder;
   builder.AlignHeaderLeft()
@@ -70,4 +164,93 @@ void SimpleBenchmarkReporter::Show() {
 #endif  // defined(TACHYON_HAS_MATPLOTLIB)
 }
 
+std::optional<PerfCounters::Values> SimpleBenchmarkReporter::GetCounters(
+    size_t i, size_t j) const {
+  if (i >= counters_.size() || j >= counters_[i].size()) return std::nullopt;
+  return counters_[i][j];
+}
+
+bool SimpleBenchmarkReporter::WriteResults(const base::FilePath& path) const {
+  std::string content = path.Extension() == ".json" ? ToJSON() : ToCSV();
+  if (!base::WriteFile(path, content)) {
+    LOG(ERROR) << "Failed to write results to " << path.value();
+    return false;
+  }
+  return true;
+}
+
+std::string SimpleBenchmarkReporter::ToCSV() const {
+  std::string ret = "target,vendor,time_sec";
+  if (perf_counters_) {
+    for (size_t i = 0; i < PerfCounters::kNumEvents; ++i) {
+      ret += ",";
+      ret += PerfCounters::EventToString(static_cast<PerfCounters::Event>(i));
+    }
+  }
+  ret += "\n";
+  for (size_t i = 0; i < targets_.size(); ++i) {
+    for (size_t j = 0; j < times_[i].size(); ++j) {
+      absl::StrAppend(&ret, targets_[i], ",", column_headers_[j], ",",
+                      base::NumberToString(times_[i][j]));
+      if (perf_counters_) {
+        std::optional<PerfCounters::Values> counters = GetCounters(i, j);
+        for (size_t k = 0; k < PerfCounters::kNumEvents; ++k) {
+          ret += ",";
+          if (counters.has_value()) {
+            ret += base::NumberToString((*counters)[k]);
+          }
+        }
+      }
+      ret += "\n";
+    }
+  }
+  return ret;
+}
+
+std::string SimpleBenchmarkReporter::ToJSON() const {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  writer.StartObject();
+  writer.Key("title");
+  writer.String(title_.c_str());
+  writer.Key("environment");
+  writer.StartObject();
+  writer.Key("cpu_model");
+  writer.String(GetCpuModel().c_str());
+  writer.Key("num_threads");
+  writer.Uint64(GetNumThreads());
+  writer.Key("gpu");
+  writer.String(gpu_.c_str());
+  writer.Key("tachyon_version");
+  std::string_view version = GetRuntimeFullVersionStr();
+  writer.String(version.data(), version.size());
+  writer.EndObject();
+  writer.Key("results");
+  writer.StartArray();
+  for (size_t i = 0; i < targets_.size(); ++i) {
+    for (size_t j = 0; j < times_[i].size(); ++j) {
+      writer.StartObject();
+      writer.Key("target");
+      writer.String(targets_[i].c_str());
+      writer.Key("vendor");
+      writer.String(column_headers_[j].c_str());
+      writer.Key("time_sec");
+      writer.Double(times_[i][j]);
+      if (std::optional<PerfCounters::Values> counters = GetCounters(i, j);
+          counters.has_value()) {
+        for (size_t k = 0; k < PerfCounters::kNumEvents; ++k) {
+          std::string_view name =
+              PerfCounters::EventToString(static_cast<PerfCounters::Event>(k));
+          writer.Key(name.data(), name.size());
+          writer.Uint64((*counters)[k]);
+        }
+      }
+      writer.EndObject();
+    }
+  }
+  writer.EndArray();
+  writer.EndObject();
+  return buffer.GetString();
+}
+
 }  // namespace tachyon
@@ -3,9 +3,15 @@
 
 #include <stddef.h>
 
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "benchmark/perf_counters.h"
+#include "tachyon/base/files/file_path.h"
+
 namespace tachyon {
 
 class SimpleBenchmarkReporter {
@@ -17,15 +23,50 @@ class SimpleBenchmarkReporter {
   SimpleBenchmarkReporter& operator=(const SimpleBenchmarkReporter& other) =
       delete;
 
-  void AddTime(size_t idx, double time) { times_[idx].push_back(time); }
+  bool perf_counters_enabled() const { return perf_counters_ != nullptr; }
+
+  // Sets the name of the GPU the benchmark runs on, which is written to the
+  // environment of |ToJSON()|. It is left empty for the CPU benchmarks.
+  void set_gpu(std::string_view gpu) { gpu_ = std::string(gpu); }
+
+  // Starts counting the hardware events of each run. See |PerfCounters|.
+  // NOTE: This should be called before any thread pool is used.
+  [[nodiscard]] bool EnablePerfCounters();
+
+  // Returns the current counts to be passed to |AddTime()| after the run, or
+  // zeros if the counters are not enabled.
+  PerfCounters::Values ReadPerfCounters() const;
+
+  void AddTime(size_t idx, double time);
+
+  // Adds |time| along with the events counted from |counters_at_start|.
+  void AddTime(size_t idx, double time,
+               const PerfCounters::Values& counters_at_start);
 
   void Show();
 
+  // Writes the times and the hardware counts of every run to |path|, as a
+  // JSON if its extension is ".json" or as a CSV otherwise.
+  [[nodiscard]] bool WriteResults(const base::FilePath& path) const;
+
+  std::string ToCSV() const;
+  // Returns the title, the environment, i.e., the CPU model, the number of
+  // threads, the GPU and the tachyon version with its commit, and the results.
+  // See benchmark/compare_results.cc.
+  std::string ToJSON() const;
+
  protected:
+  std::optional<PerfCounters::Values> GetCounters(size_t i, size_t j) const;
+
   std::string title_;
+  std::string gpu_;
   std::vector<std::string> column_headers_;
   std::vector<std::string> targets_;
   std::vector<std::vector<double>> times_;
+  // |counters_[i][j]| is counted during |times_[i][j]|. It is empty if the
+  // time is added without the counts.
+  std::vector<std::vector<std::optional<PerfCounters::Values>>> counters_;
+  std::unique_ptr<PerfCounters> perf_counters_;
 };
 
 }  // namespace tachyon
@@ -54,6 +54,11 @@ class TACHYON_EXPORT Buffer : public ReadOnlyBuffer {
     return Write64LEAt(buffer_offset_, value);
   }
 
+  template <typename T>
+  [[nodiscard]] bool WriteArray(const T* values, size_t size) {
+    return WriteArrayAt(buffer_offset_, values, size);
+  }
+
   template <typename T>
   [[nodiscard]] bool WriteMany(const T& value) {
     return Write(value);
@@ -119,6 +124,27 @@ class TACHYON_EXPORT Buffer : public ReadOnlyBuffer {
     return Copyable<T>::WriteTo(value, this);
   }
 
+  // Writes |size| values of |T| of |values| at |buffer_offset| at once
+  // instead of value by value. See |ReadOnlyBuffer::ReadArrayAt()|.
+  template <
+      typename T,
+      std::enable_if_t<internal::IsBuiltinSerializable<T>::value>* = nullptr>
+  [[nodiscard]] bool WriteArrayAt(size_t buffer_offset, const T* values,
+                                  size_t size) {
+    base::CheckedNumeric<size_t> len = size;
+    size_t size_needed;
+    if (!(len * sizeof(T) + buffer_offset).AssignIfValid(&size_needed)) {
+      return false;
+    }
+    if (size_needed > buffer_len_) {
+      if (!Grow(size_needed)) return false;
+    }
+    BulkCopy<T>(values, reinterpret_cast<char*>(buffer_) + buffer_offset, size,
+                !IsNativeEndian());
+    buffer_offset_ = size_needed;
+    return true;
+  }
+
   template <typename T>
   [[nodiscard]] bool WriteManyAt(size_t buffer_offset, const T& value) {
     return WriteAt(buffer_offset, value);
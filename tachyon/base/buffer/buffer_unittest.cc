@@ -1,3 +1,5 @@
+#include <limits>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -143,4 +145,95 @@ TEST(BufferTest, WriteMany) {
   }
 }
 
+TEST(BufferTest, ReadSpan) {
+  alignas(uint64_t) uint8_t kData[24] = {0};
+  for (size_t i = 0; i < sizeof(kData); ++i) {
+    kData[i] = static_cast<uint8_t>(i);
+  }
+
+  ReadOnlyBuffer buffer(kData, sizeof(kData));
+  absl::Span<const uint64_t> values;
+  ASSERT_TRUE(buffer.ReadSpan(2, &values));
+  EXPECT_EQ(values.data(), reinterpret_cast<const uint64_t*>(kData));
+  EXPECT_EQ(values.size(), 2);
+  EXPECT_EQ(buffer.buffer_offset(), 16);
+  // Not enough bytes.
+  EXPECT_FALSE(buffer.ReadSpan(2, &values));
+  // Overflow.
+  EXPECT_FALSE(buffer.ReadSpanAt(0, std::numeric_limits<size_t>::max(),
+                                 &values));
+  // Not aligned.
+  absl::Span<const uint8_t> bytes;
+  ASSERT_TRUE(buffer.ReadSpanAt(0, 1, &bytes));
+  EXPECT_EQ(bytes[0], 0);
+  EXPECT_FALSE(buffer.ReadSpan(1, &values));
+
+  // Not the byte order of the host.
+  buffer.set_endian(
+#if defined(ABSL_IS_LITTLE_ENDIAN)
+      Endian::kBig
+#else
+      Endian::kLittle
+#endif
+  );
+  EXPECT_FALSE(buffer.ReadSpanAt(0, 1, &values));
+  ASSERT_TRUE(buffer.ReadSpanAt(0, 1, &bytes));
+}
+
+TEST(BufferTest, ReadWriteArray) {
+  std::vector<uint32_t> values = {1, 2, 3, 0x12345678};
+  for (Endian endian : {Endian::kNative, Endian::kBig, Endian::kLittle}) {
+    Uint8VectorBuffer write_buf;
+    write_buf.set_endian(endian);
+    ASSERT_TRUE(write_buf.WriteArray(values.data(), values.size()));
+    if (endian == Endian::kBig) {
+      EXPECT_EQ(write_buf.owned_buffer()[12], 0x12);
+    } else if (endian == Endian::kLittle) {
+      EXPECT_EQ(write_buf.owned_buffer()[12], 0x78);
+    }
+
+    Buffer read_buf(write_buf.buffer(), write_buf.buffer_len());
+    read_buf.set_endian(endian);
+    std::vector<uint32_t> read_values(values.size());
+    ASSERT_TRUE(read_buf.ReadArray(read_values.data(), read_values.size()));
+    EXPECT_EQ(read_values, values);
+    ASSERT_TRUE(read_buf.Done());
+    EXPECT_FALSE(read_buf.ReadArray(read_values.data(), 1));
+  }
+}
+
+TEST(BufferTest, BulkCopy) {
+  // NOTE: This is large enough to be copied in parallel.
+  std::vector<uint64_t> values(kParallelBulkCopyThreshold / sizeof(uint64_t) +
+                               3);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = i * 0x0101010101010101;
+  }
+  std::vector<uint64_t> copied(values.size());
+  BulkCopy<uint64_t>(values.data(), copied.data(), values.size(),
+                     /*swap_bytes=*/false);
+  EXPECT_EQ(copied, values);
+
+  BulkCopy<uint64_t>(values.data(), copied.data(), values.size(),
+                     /*swap_bytes=*/true);
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(copied[i], absl::gbswap_64(values[i]));
+  }
+
+  // Unaligned values of every size.
+  uint8_t bytes[35];
+  for (size_t i = 0; i < std::size(bytes); ++i) {
+    bytes[i] = static_cast<uint8_t>(i);
+  }
+  uint16_t values16[17];
+  ByteSwap16Array(&bytes[1], values16, std::size(values16));
+  EXPECT_EQ(values16[16], 0x2122);
+  uint32_t values32[8];
+  ByteSwap32Array(&bytes[1], values32, std::size(values32));
+  EXPECT_EQ(values32[7], 0x1d1e1f20u);
+  uint64_t values64[4];
+  ByteSwap64Array(&bytes[1], values64, std::size(values64));
+  EXPECT_EQ(values64[3], 0x191a1b1c1d1e1f20u);
+}
+
 }  // namespace tachyon::base
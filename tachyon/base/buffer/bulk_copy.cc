@@ -0,0 +1,43 @@
+#include "tachyon/base/buffer/bulk_copy.h"
+
+#include "absl/base/internal/endian.h"
+
+namespace tachyon::base {
+
+// NOTE: The loops below load and store through |memcpy()|, which the compiler
+// turns into the unaligned moves, so that they can be vectorized.
+
+void ByteSwap16Array(const void* src, void* dst, size_t n) {
+  const uint8_t* src_bytes = static_cast<const uint8_t*>(src);
+  uint8_t* dst_bytes = static_cast<uint8_t*>(dst);
+  for (size_t i = 0; i < n; ++i) {
+    uint16_t value;
+    memcpy(&value, &src_bytes[i * 2], 2);
+    value = absl::gbswap_16(value);
+    memcpy(&dst_bytes[i * 2], &value, 2);
+  }
+}
+
+void ByteSwap32Array(const void* src, void* dst, size_t n) {
+  const uint8_t* src_bytes = static_cast<const uint8_t*>(src);
+  uint8_t* dst_bytes = static_cast<uint8_t*>(dst);
+  for (size_t i = 0; i < n; ++i) {
+    uint32_t value;
+    memcpy(&value, &src_bytes[i * 4], 4);
+    value = absl::gbswap_32(value);
+    memcpy(&dst_bytes[i * 4], &value, 4);
+  }
+}
+
+void ByteSwap64Array(const void* src, void* dst, size_t n) {
+  const uint8_t* src_bytes = static_cast<const uint8_t*>(src);
+  uint8_t* dst_bytes = static_cast<uint8_t*>(dst);
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t value;
+    memcpy(&value, &src_bytes[i * 8], 8);
+    value = absl::gbswap_64(value);
+    memcpy(&dst_bytes[i * 8], &value, 8);
+  }
+}
+
+}  // namespace tachyon::base
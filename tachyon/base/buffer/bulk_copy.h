@@ -0,0 +1,71 @@
+#ifndef TACHYON_BASE_BUFFER_BULK_COPY_H_
+#define TACHYON_BASE_BUFFER_BULK_COPY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <type_traits>
+
+#include "absl/types/span.h"
+
+#include "tachyon/export.h"
+#include "tachyon/base/parallelize.h"
+
+namespace tachyon::base {
+
+// The arrays of at least this many bytes are copied in parallel.
+constexpr size_t kParallelBulkCopyThreshold = size_t{1} << 20;
+
+// Copies |n| values of 2, 4 or 8 bytes from |src| to |dst|, reversing the
+// bytes of each value. Neither |src| nor |dst| needs to be aligned, but they
+// must not overlap.
+TACHYON_EXPORT void ByteSwap16Array(const void* src, void* dst, size_t n);
+TACHYON_EXPORT void ByteSwap32Array(const void* src, void* dst, size_t n);
+TACHYON_EXPORT void ByteSwap64Array(const void* src, void* dst, size_t n);
+
+// Copies |n| values of |T| from |src| to |dst| as a whole instead of value by
+// value. If |swap_bytes| is true, the bytes of each value are reversed, which
+// converts the values between the big and the little endian.
+template <typename T>
+void BulkCopy(const void* src, void* dst, size_t n, bool swap_bytes) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
+                sizeof(T) == 8);
+  auto copy = [swap_bytes](const uint8_t* src, uint8_t* dst, size_t n) {
+    if constexpr (sizeof(T) > 1) {
+      if (swap_bytes) {
+        if constexpr (sizeof(T) == 2) {
+          ByteSwap16Array(src, dst, n);
+        } else if constexpr (sizeof(T) == 4) {
+          ByteSwap32Array(src, dst, n);
+        } else {
+          ByteSwap64Array(src, dst, n);
+        }
+        return;
+      }
+    }
+    memcpy(dst, src, n * sizeof(T));
+  };
+
+  const uint8_t* src_bytes = static_cast<const uint8_t*>(src);
+  uint8_t* dst_bytes = static_cast<uint8_t*>(dst);
+  if (n * sizeof(T) < kParallelBulkCopyThreshold) {
+    copy(src_bytes, dst_bytes, n);
+    return;
+  }
+  absl::Span<uint8_t> dst_span(dst_bytes, n * sizeof(T));
+  // NOTE: The chunks are cut on the value boundaries.
+  size_t num_threads = ThreadPool::GetCurrent().num_threads();
+  size_t chunk_size = (n + num_threads - 1) / num_threads * sizeof(T);
+  ParallelizeByChunkSize(
+      dst_span, chunk_size,
+      [&copy, src_bytes, dst_bytes](absl::Span<uint8_t> chunk) {
+        copy(src_bytes + (chunk.data() - dst_bytes), chunk.data(),
+             chunk.size() / sizeof(T));
+      });
+}
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_BUFFER_BULK_COPY_H_
@@ -0,0 +1,62 @@
+#include <immintrin.h>
+
+#include "absl/base/internal/endian.h"
+
+#include "tachyon/base/buffer/bulk_copy.h"
+
+namespace tachyon::base {
+
+namespace {
+
+// Reverses the bytes of every |ValueSize|-byte value of 32 bytes at a time
+// with |_mm256_shuffle_epi8()| and the rest one value at a time.
+template <size_t ValueSize, typename T, T (*Swap)(T)>
+void ByteSwapArray(const void* src, void* dst, size_t n, __m256i mask) {
+  const uint8_t* src_bytes = static_cast<const uint8_t*>(src);
+  uint8_t* dst_bytes = static_cast<uint8_t*>(dst);
+  size_t size = n * ValueSize;
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src_bytes[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst_bytes[i]),
+                        _mm256_shuffle_epi8(v, mask));
+  }
+  for (; i < size; i += ValueSize) {
+    T value;
+    memcpy(&value, &src_bytes[i], ValueSize);
+    value = Swap(value);
+    memcpy(&dst_bytes[i], &value, ValueSize);
+  }
+}
+
+}  // namespace
+
+void ByteSwap16Array(const void* src, void* dst, size_t n) {
+  // clang-format off
+  __m256i mask = _mm256_setr_epi8(
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  // clang-format on
+  ByteSwapArray<2, uint16_t, absl::gbswap_16>(src, dst, n, mask);
+}
+
+void ByteSwap32Array(const void* src, void* dst, size_t n) {
+  // clang-format off
+  __m256i mask = _mm256_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  // clang-format on
+  ByteSwapArray<4, uint32_t, absl::gbswap_32>(src, dst, n, mask);
+}
+
+void ByteSwap64Array(const void* src, void* dst, size_t n) {
+  // clang-format off
+  __m256i mask = _mm256_setr_epi8(
+      7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+      7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  // clang-format on
+  ByteSwapArray<8, uint64_t, absl::gbswap_64>(src, dst, n, mask);
+}
+
+}  // namespace tachyon::base
@@ -4,6 +4,7 @@
 #include <array>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "absl/types/span.h"
@@ -112,17 +113,25 @@ template <typename T, size_t N>
 class Copyable<T[N]> {
  public:
   static bool WriteTo(const T* values, Buffer* buffer) {
-    for (size_t i = 0; i < N; ++i) {
-      if (!buffer->Write(values[i])) return false;
+    if constexpr (internal::IsBuiltinSerializable<T>::value) {
+      return buffer->WriteArray(values, N);
+    } else {
+      for (size_t i = 0; i < N; ++i) {
+        if (!buffer->Write(values[i])) return false;
+      }
+      return true;
     }
-    return true;
   }
 
   static bool ReadFrom(const ReadOnlyBuffer& buffer, T* values) {
-    for (size_t i = 0; i < N; ++i) {
-      if (!buffer.Read(&values[i])) return false;
+    if constexpr (internal::IsBuiltinSerializable<T>::value) {
+      return buffer.ReadArray(values, N);
+    } else {
+      for (size_t i = 0; i < N; ++i) {
+        if (!buffer.Read(&values[i])) return false;
+      }
+      return true;
     }
-    return true;
   }
 
   static size_t EstimateSize(const T* values) {
@@ -136,22 +145,39 @@ class Copyable<T[N]> {
 template <typename T>
 class Copyable<std::vector<T>> {
  public:
+  // NOTE: |std::vector<bool>| doesn't store its values contiguously.
+  constexpr static bool kIsBulkCopyable =
+      internal::IsBuiltinSerializable<T>::value && !std::is_same_v<T, bool>;
+
   static bool WriteTo(const std::vector<T>& values, Buffer* buffer) {
     if (!buffer->Write(values.size())) return false;
-    for (const T& value : values) {
-      if (!buffer->Write(value)) return false;
+    if constexpr (kIsBulkCopyable) {
+      return buffer->WriteArray(values.data(), values.size());
+    } else {
+      for (const T& value : values) {
+        if (!buffer->Write(value)) return false;
+      }
+      return true;
     }
-    return true;
   }
 
   static bool ReadFrom(const ReadOnlyBuffer& buffer, std::vector<T>* values) {
     size_t size;
     if (!buffer.Read(&size)) return false;
-    values->resize(size);
-    for (T& value : (*values)) {
-      if (!buffer.Read(&value)) return false;
+    if constexpr (kIsBulkCopyable) {
+      // NOTE: This prevents a corrupted size from allocating too much memory.
+      if (size > (buffer.buffer_len() - buffer.buffer_offset()) / sizeof(T)) {
+        return false;
+      }
+      values->resize(size);
+      return buffer.ReadArray(values->data(), size);
+    } else {
+      values->resize(size);
+      for (T& value : (*values)) {
+        if (!buffer.Read(&value)) return false;
+      }
+      return true;
     }
-    return true;
   }
 
   static size_t EstimateSize(const std::vector<T>& values) {
@@ -166,17 +192,25 @@ template <typename T, size_t N>
 class Copyable<std::array<T, N>> {
  public:
   static bool WriteTo(const std::array<T, N>& values, Buffer* buffer) {
-    for (const T& value : values) {
-      if (!buffer->Write(value)) return false;
+    if constexpr (internal::IsBuiltinSerializable<T>::value) {
+      return buffer->WriteArray(values.data(), N);
+    } else {
+      for (const T& value : values) {
+        if (!buffer->Write(value)) return false;
+      }
+      return true;
     }
-    return true;
   }
 
   static bool ReadFrom(const ReadOnlyBuffer& buffer, std::array<T, N>* values) {
-    for (T& value : (*values)) {
-      if (!buffer.Read(&value)) return false;
+    if constexpr (internal::IsBuiltinSerializable<T>::value) {
+      return buffer.ReadArray(values->data(), N);
+    } else {
+      for (T& value : (*values)) {
+        if (!buffer.Read(&value)) return false;
+      }
+      return true;
     }
-    return true;
   }
 
   static size_t EstimateSize(const std::array<T, N>& values) {
@@ -192,10 +226,14 @@ class Copyable<absl::Span<T>> {
  public:
   static bool WriteTo(absl::Span<T> values, Buffer* buffer) {
     if (!buffer->Write(values.size())) return false;
-    for (const T& value : values) {
-      if (!buffer->Write(value)) return false;
+    if constexpr (internal::IsBuiltinSerializable<T>::value) {
+      return buffer->WriteArray(values.data(), values.size());
+    } else {
+      for (const T& value : values) {
+        if (!buffer->Write(value)) return false;
+      }
+      return true;
     }
-    return true;
   }
 
   static bool ReadFrom(const ReadOnlyBuffer& buffer, absl::Span<T>* values) {
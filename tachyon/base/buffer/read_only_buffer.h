@@ -8,10 +8,13 @@
 #include <utility>
 
 #include "absl/base/internal/endian.h"
+#include "absl/types/span.h"
 
+#include "tachyon/base/buffer/bulk_copy.h"
 #include "tachyon/base/buffer/copyable_forward.h"
 #include "tachyon/base/endian.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/numerics/checked_math.h"
 
 namespace tachyon::base {
 namespace internal {
@@ -73,6 +76,29 @@ class TACHYON_EXPORT ReadOnlyBuffer {
 
   [[nodiscard]] bool Done() const { return buffer_offset_ == buffer_len_; }
 
+  // Returns true if the multi-byte values are stored in the byte order of the
+  // host, so that they can be used in place.
+  bool IsNativeEndian() const {
+    switch (endian_) {
+      case Endian::kNative:
+        return true;
+      case Endian::kBig:
+#if defined(ABSL_IS_BIG_ENDIAN)
+        return true;
+#else
+        return false;
+#endif
+      case Endian::kLittle:
+#if defined(ABSL_IS_LITTLE_ENDIAN)
+        return true;
+#else
+        return false;
+#endif
+    }
+    NOTREACHED();
+    return false;
+  }
+
   // Returns false when either
   // 1) |buffer_offset| + |size| overflows.
   // 2) if it tries to read more than |buffer_len_|.
@@ -126,10 +152,66 @@ class TACHYON_EXPORT ReadOnlyBuffer {
 
   template <typename T, size_t N>
   [[nodiscard]] bool ReadAt(size_t buffer_offset, T (&array)[N]) const {
-    buffer_offset_ = buffer_offset;
-    for (size_t i = 0; i < N; ++i) {
-      if (!Read(&array[i])) return false;
+    if constexpr (internal::IsBuiltinSerializable<T>::value) {
+      return ReadArrayAt(buffer_offset, array, N);
+    } else {
+      buffer_offset_ = buffer_offset;
+      for (size_t i = 0; i < N; ++i) {
+        if (!Read(&array[i])) return false;
+      }
+      return true;
     }
+  }
+
+  // Reads |size| values of |T| at |buffer_offset| into |values| at once
+  // instead of value by value. The values are copied as they are if |endian_|
+  // is the byte order of the host and byte-swapped otherwise. Returns false
+  // when either
+  // 1) |buffer_offset| + |size| * sizeof(T) overflows.
+  // 2) if it tries to read more than |buffer_len_|.
+  template <
+      typename T,
+      std::enable_if_t<internal::IsBuiltinSerializable<T>::value>* = nullptr>
+  [[nodiscard]] bool ReadArrayAt(size_t buffer_offset, T* values,
+                                 size_t size) const {
+    base::CheckedNumeric<size_t> len = size;
+    size_t size_needed;
+    if (!(len * sizeof(T) + buffer_offset).AssignIfValid(&size_needed)) {
+      return false;
+    }
+    if (size_needed > buffer_len_) return false;
+    BulkCopy<T>(reinterpret_cast<const char*>(buffer_) + buffer_offset, values,
+                size, !IsNativeEndian());
+    buffer_offset_ = size_needed;
+    return true;
+  }
+
+  // Points |span| to the |size| values of |T| at |buffer_offset| instead of
+  // copying them, e.g., to use a column of a memory mapped file in place. The
+  // values must be stored as their in-memory representation. Returns false
+  // when either
+  // 1) |buffer_offset| + |size| * sizeof(T) overflows.
+  // 2) if it tries to read more than |buffer_len_|.
+  // 3) the values are not aligned to alignof(T).
+  // 4) T is multi-byte and |endian_| is not the byte order of the host.
+  // NOTE: |span| is valid only while the underlying memory is.
+  template <typename T>
+  [[nodiscard]] bool ReadSpanAt(size_t buffer_offset, size_t size,
+                                absl::Span<const T>* span) const {
+    static_assert(std::is_trivially_copyable_v<T>);
+    if constexpr (sizeof(T) > 1) {
+      if (!IsNativeEndian()) return false;
+    }
+    base::CheckedNumeric<size_t> len = size;
+    size_t size_needed;
+    if (!(len * sizeof(T) + buffer_offset).AssignIfValid(&size_needed)) {
+      return false;
+    }
+    if (size_needed > buffer_len_) return false;
+    const char* ptr = reinterpret_cast<const char*>(buffer_) + buffer_offset;
+    if (reinterpret_cast<uintptr_t>(ptr) % alignof(T) != 0) return false;
+    *span = absl::Span<const T>(reinterpret_cast<const T*>(ptr), size);
+    buffer_offset_ = size_needed;
     return true;
   }
 
@@ -137,6 +219,16 @@ class TACHYON_EXPORT ReadOnlyBuffer {
     return ReadAt(buffer_offset_, ptr, size);
   }
 
+  template <typename T>
+  [[nodiscard]] bool ReadArray(T* values, size_t size) const {
+    return ReadArrayAt(buffer_offset_, values, size);
+  }
+
+  template <typename T>
+  [[nodiscard]] bool ReadSpan(size_t size, absl::Span<const T>* span) const {
+    return ReadSpanAt(buffer_offset_, size, span);
+  }
+
   template <typename T>
   [[nodiscard]] bool Read(T&& value) const {
     return ReadAt(buffer_offset_, std::forward<T>(value));
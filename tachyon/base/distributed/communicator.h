@@ -0,0 +1,154 @@
+#ifndef TACHYON_BASE_DISTRIBUTED_COMMUNICATOR_H_
+#define TACHYON_BASE_DISTRIBUTED_COMMUNICATOR_H_
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/buffer/read_only_buffer.h"
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/distributed/transport.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/range.h"
+
+namespace tachyon::base {
+
+// |Communicator| runs the collectives of the distributed algorithms over a
+// |Transport|. The values are serialized with |base::Copyable| in the native
+// endianness, so all the ranks must share it. Every rank of the group must
+// call the same collectives in the same order.
+class Communicator {
+ public:
+  explicit Communicator(Transport* transport) : transport_(transport) {
+    CHECK(transport_);
+  }
+
+  Transport* transport() const { return transport_; }
+
+  int rank() const { return transport_->rank(); }
+  int world_size() const { return transport_->world_size(); }
+  bool IsRoot() const { return rank() == 0; }
+
+  // Returns the range of the |size| elements that |rank| takes when they are
+  // split into |world_size| contiguous ranges of almost the same size.
+  static Range<size_t> GetShard(size_t size, int rank, int world_size) {
+    size_t quotient = size / world_size;
+    size_t remainder = size % world_size;
+    size_t r = static_cast<size_t>(rank);
+    size_t start = r * quotient + std::min(r, remainder);
+    return {start, start + quotient + (r < remainder ? 1 : 0)};
+  }
+
+  Range<size_t> GetShard(size_t size) const {
+    return GetShard(size, rank(), world_size());
+  }
+
+  template <typename T>
+  [[nodiscard]] bool SendValue(int peer, const T& value) {
+    std::vector<uint8_t> bytes;
+    if (!Serialize(value, &bytes)) return false;
+    return transport_->Send(peer, bytes);
+  }
+
+  template <typename T>
+  [[nodiscard]] bool ReceiveValue(int peer, T* value) {
+    std::vector<uint8_t> bytes;
+    if (!transport_->Receive(peer, &bytes)) return false;
+    return Deserialize(bytes, value);
+  }
+
+  // Sends |send_value| to |send_peer| while receiving |recv_value| from
+  // |recv_peer|.
+  template <typename T>
+  [[nodiscard]] bool Exchange(int send_peer, const T& send_value,
+                              int recv_peer, T* recv_value) {
+    std::vector<uint8_t> bytes;
+    if (!Serialize(send_value, &bytes)) return false;
+    bool sent = false;
+    std::thread sender([this, send_peer, &bytes, &sent]() {
+      sent = transport_->Send(send_peer, bytes);
+    });
+    bool received = ReceiveValue(recv_peer, recv_value);
+    sender.join();
+    return sent && received;
+  }
+
+  // Sets |values[i]| to |value| of rank i.
+  template <typename T>
+  [[nodiscard]] bool AllGather(const T& value, std::vector<T>* values) {
+    int size = world_size();
+    int me = rank();
+    values->resize(size);
+    (*values)[me] = value;
+    for (int step = 1; step < size; ++step) {
+      int send_peer = (me + step) % size;
+      int recv_peer = (me - step + size) % size;
+      if (!Exchange(send_peer, value, recv_peer, &(*values)[recv_peer])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Sends |send_values[i]| to rank i and sets |recv_values[i]| to what rank i
+  // sent to this rank.
+  template <typename T>
+  [[nodiscard]] bool AllToAll(std::vector<T>&& send_values,
+                              std::vector<T>* recv_values) {
+    int size = world_size();
+    int me = rank();
+    if (send_values.size() != static_cast<size_t>(size)) {
+      LOG(ERROR) << "send_values_size and world_size don't match";
+      return false;
+    }
+    recv_values->resize(size);
+    (*recv_values)[me] = std::move(send_values[me]);
+    for (int step = 1; step < size; ++step) {
+      int send_peer = (me + step) % size;
+      int recv_peer = (me - step + size) % size;
+      if (!Exchange(send_peer, send_values[send_peer], recv_peer,
+                    &(*recv_values)[recv_peer])) {
+        return false;
+      }
+      send_values[send_peer] = T();
+    }
+    return true;
+  }
+
+  // Blocks until every rank calls |Barrier()|.
+  [[nodiscard]] bool Barrier() {
+    std::vector<uint8_t> unused;
+    return AllGather(uint8_t{0}, &unused);
+  }
+
+ private:
+  template <typename T>
+  static bool Serialize(const T& value, std::vector<uint8_t>* bytes) {
+    Uint8VectorBuffer buffer;
+    if (!buffer.Grow(EstimateSize(value))) return false;
+    if (!buffer.Write(value)) return false;
+    *bytes = std::move(buffer).TakeOwnedBuffer();
+    return true;
+  }
+
+  template <typename T>
+  static bool Deserialize(const std::vector<uint8_t>& bytes, T* value) {
+    ReadOnlyBuffer buffer(bytes.data(), bytes.size());
+    if (!buffer.Read(value) || !buffer.Done()) {
+      LOG(ERROR) << "Failed to deserialize a message";
+      return false;
+    }
+    return true;
+  }
+
+  // not owned
+  Transport* const transport_;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_DISTRIBUTED_COMMUNICATOR_H_
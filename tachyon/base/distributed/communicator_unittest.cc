@@ -0,0 +1,80 @@
+#include "tachyon/base/distributed/communicator.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/distributed/local_transport.h"
+
+namespace tachyon::base {
+
+namespace {
+
+constexpr int kWorldSize = 4;
+
+template <typename Callable>
+void RunOnAllRanks(LocalTransportGroup& group, Callable callback) {
+  std::vector<std::thread> threads;
+  for (int i = 0; i < group.world_size(); ++i) {
+    threads.emplace_back([&group, &callback, i]() {
+      Communicator comm(group.GetTransport(i));
+      callback(comm);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace
+
+TEST(CommunicatorTest, GetShard) {
+  std::vector<Range<size_t>> shards;
+  for (int i = 0; i < kWorldSize; ++i) {
+    shards.push_back(Communicator::GetShard(10, i, kWorldSize));
+  }
+  std::vector<Range<size_t>> expected = {{0, 3}, {3, 6}, {6, 8}, {8, 10}};
+  EXPECT_EQ(shards, expected);
+}
+
+TEST(CommunicatorTest, SendAndReceive) {
+  LocalTransportGroup group(2);
+  RunOnAllRanks(group, [](Communicator& comm) {
+    if (comm.IsRoot()) {
+      ASSERT_TRUE(comm.SendValue(1, std::vector<int>{1, 2, 3}));
+    } else {
+      std::vector<int> value;
+      ASSERT_TRUE(comm.ReceiveValue(0, &value));
+      EXPECT_EQ(value, std::vector<int>({1, 2, 3}));
+    }
+  });
+}
+
+TEST(CommunicatorTest, AllGather) {
+  LocalTransportGroup group(kWorldSize);
+  RunOnAllRanks(group, [](Communicator& comm) {
+    std::vector<int> values;
+    ASSERT_TRUE(comm.AllGather(comm.rank() * 10, &values));
+    EXPECT_EQ(values, std::vector<int>({0, 10, 20, 30}));
+  });
+}
+
+TEST(CommunicatorTest, AllToAll) {
+  LocalTransportGroup group(kWorldSize);
+  RunOnAllRanks(group, [](Communicator& comm) {
+    // Rank i sends i * 10 + j to rank j.
+    std::vector<std::vector<int>> send_values(kWorldSize);
+    for (int j = 0; j < kWorldSize; ++j) {
+      send_values[j] = {comm.rank() * 10 + j};
+    }
+    std::vector<std::vector<int>> recv_values;
+    ASSERT_TRUE(comm.AllToAll(std::move(send_values), &recv_values));
+    for (int j = 0; j < kWorldSize; ++j) {
+      EXPECT_EQ(recv_values[j], std::vector<int>({j * 10 + comm.rank()}));
+    }
+    EXPECT_TRUE(comm.Barrier());
+  });
+}
+
+}  // namespace tachyon::base
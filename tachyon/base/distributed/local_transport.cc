@@ -0,0 +1,53 @@
+#include "tachyon/base/distributed/local_transport.h"
+
+#include <utility>
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::base {
+
+LocalTransportGroup::LocalTransportGroup(int world_size)
+    : mailboxes_(new Mailbox[world_size * world_size]) {
+  CHECK_GT(world_size, 0);
+  transports_.reserve(world_size);
+  for (int i = 0; i < world_size; ++i) {
+    transports_.push_back(std::make_unique<LocalTransport>(this, i));
+  }
+}
+
+LocalTransportGroup::~LocalTransportGroup() = default;
+
+Transport* LocalTransportGroup::GetTransport(int rank) {
+  CHECK_GE(rank, 0);
+  CHECK_LT(rank, world_size());
+  return transports_[rank].get();
+}
+
+bool LocalTransport::Send(int peer, absl::Span<const uint8_t> data) {
+  if (peer < 0 || peer >= world_size()) {
+    LOG(ERROR) << "Invalid peer: " << peer;
+    return false;
+  }
+  LocalTransportGroup::Mailbox& mailbox = group_->GetMailbox(rank_, peer);
+  {
+    std::lock_guard<std::mutex> lock(mailbox.mutex);
+    mailbox.messages.emplace_back(data.begin(), data.end());
+  }
+  mailbox.cv.notify_one();
+  return true;
+}
+
+bool LocalTransport::Receive(int peer, std::vector<uint8_t>* data) {
+  if (peer < 0 || peer >= world_size()) {
+    LOG(ERROR) << "Invalid peer: " << peer;
+    return false;
+  }
+  LocalTransportGroup::Mailbox& mailbox = group_->GetMailbox(peer, rank_);
+  std::unique_lock<std::mutex> lock(mailbox.mutex);
+  mailbox.cv.wait(lock, [&mailbox]() { return !mailbox.messages.empty(); });
+  *data = std::move(mailbox.messages.front());
+  mailbox.messages.pop_front();
+  return true;
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,72 @@
+#ifndef TACHYON_BASE_DISTRIBUTED_LOCAL_TRANSPORT_H_
+#define TACHYON_BASE_DISTRIBUTED_LOCAL_TRANSPORT_H_
+
+#include <stdint.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/distributed/transport.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+class LocalTransport;
+
+// |LocalTransportGroup| connects |world_size| ranks living in one process,
+// each of which is usually driven by its own thread. It is mainly used to test
+// the distributed algorithms without a network.
+class TACHYON_EXPORT LocalTransportGroup {
+ public:
+  explicit LocalTransportGroup(int world_size);
+  LocalTransportGroup(const LocalTransportGroup& other) = delete;
+  LocalTransportGroup& operator=(const LocalTransportGroup& other) = delete;
+  ~LocalTransportGroup();
+
+  int world_size() const { return static_cast<int>(transports_.size()); }
+
+  Transport* GetTransport(int rank);
+
+ private:
+  friend class LocalTransport;
+
+  struct Mailbox {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::vector<uint8_t>> messages;
+  };
+
+  // Returns the mailbox of the messages from |from| to |to|.
+  Mailbox& GetMailbox(int from, int to) {
+    return mailboxes_[from * world_size() + to];
+  }
+
+  std::vector<std::unique_ptr<LocalTransport>> transports_;
+  std::unique_ptr<Mailbox[]> mailboxes_;
+};
+
+class TACHYON_EXPORT LocalTransport : public Transport {
+ public:
+  LocalTransport(LocalTransportGroup* group, int rank)
+      : group_(group), rank_(rank) {}
+
+  // Transport methods
+  int rank() const override { return rank_; }
+  int world_size() const override { return group_->world_size(); }
+  [[nodiscard]] bool Send(int peer, absl::Span<const uint8_t> data) override;
+  [[nodiscard]] bool Receive(int peer, std::vector<uint8_t>* data) override;
+
+ private:
+  // not owned
+  LocalTransportGroup* const group_;
+  const int rank_;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_DISTRIBUTED_LOCAL_TRANSPORT_H_
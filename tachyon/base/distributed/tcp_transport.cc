@@ -0,0 +1,230 @@
+#include "tachyon/base/distributed/tcp_transport.h"
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "absl/base/internal/endian.h"
+#include "absl/memory/memory.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/posix/eintr_wrapper.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+#include "tachyon/base/time/time.h"
+
+namespace tachyon::base {
+
+namespace {
+
+bool ParseAddress(std::string_view address, std::string* host,
+                  std::string* port) {
+  size_t pos = address.rfind(':');
+  if (pos == std::string_view::npos || pos == 0 ||
+      pos + 1 == address.size()) {
+    LOG(ERROR) << "Invalid address: " << address;
+    return false;
+  }
+  int unused;
+  if (!StringToInt(address.substr(pos + 1), &unused)) {
+    LOG(ERROR) << "Invalid port: " << address;
+    return false;
+  }
+  *host = std::string(address.substr(0, pos));
+  *port = std::string(address.substr(pos + 1));
+  return true;
+}
+
+// Returns the addresses of |address| as a linked list, which must be freed
+// with |freeaddrinfo()|.
+addrinfo* Resolve(std::string_view address, bool passive) {
+  std::string host;
+  std::string port;
+  if (!ParseAddress(address, &host, &port)) return nullptr;
+
+  addrinfo hints = {};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  if (passive) hints.ai_flags = AI_PASSIVE;
+  addrinfo* result = nullptr;
+  int error = getaddrinfo(host.c_str(), port.c_str(), &hints, &result);
+  if (error != 0) {
+    LOG(ERROR) << "Failed to resolve " << address << ": "
+               << gai_strerror(error);
+    return nullptr;
+  }
+  return result;
+}
+
+ScopedFD Listen(std::string_view address, int backlog) {
+  addrinfo* infos = Resolve(address, /*passive=*/true);
+  if (!infos) return ScopedFD();
+
+  ScopedFD fd;
+  for (addrinfo* info = infos; info; info = info->ai_next) {
+    fd.reset(socket(info->ai_family, info->ai_socktype, info->ai_protocol));
+    if (!fd.is_valid()) continue;
+    int on = 1;
+    setsockopt(fd.get(), SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (bind(fd.get(), info->ai_addr, info->ai_addrlen) == 0 &&
+        listen(fd.get(), backlog) == 0) {
+      break;
+    }
+    fd.reset();
+  }
+  freeaddrinfo(infos);
+  if (!fd.is_valid()) {
+    PLOG(ERROR) << "Failed to listen on " << address;
+  }
+  return fd;
+}
+
+ScopedFD ConnectOnce(std::string_view address) {
+  addrinfo* infos = Resolve(address, /*passive=*/false);
+  if (!infos) return ScopedFD();
+
+  ScopedFD fd;
+  for (addrinfo* info = infos; info; info = info->ai_next) {
+    fd.reset(socket(info->ai_family, info->ai_socktype, info->ai_protocol));
+    if (!fd.is_valid()) continue;
+    if (HANDLE_EINTR(connect(fd.get(), info->ai_addr, info->ai_addrlen)) ==
+        0) {
+      break;
+    }
+    fd.reset();
+  }
+  freeaddrinfo(infos);
+  return fd;
+}
+
+bool WriteAll(int fd, const uint8_t* data, size_t size) {
+  while (size > 0) {
+    ssize_t written = HANDLE_EINTR(send(fd, data, size, MSG_NOSIGNAL));
+    if (written <= 0) {
+      PLOG(ERROR) << "Failed to send()";
+      return false;
+    }
+    data += written;
+    size -= written;
+  }
+  return true;
+}
+
+bool ReadAll(int fd, uint8_t* data, size_t size) {
+  while (size > 0) {
+    ssize_t read = HANDLE_EINTR(recv(fd, data, size, 0));
+    if (read == 0) {
+      LOG(ERROR) << "Connection closed by the peer";
+      return false;
+    } else if (read < 0) {
+      PLOG(ERROR) << "Failed to recv()";
+      return false;
+    }
+    data += read;
+    size -= read;
+  }
+  return true;
+}
+
+void SetNoDelay(int fd) {
+  int on = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+}
+
+}  // namespace
+
+TcpTransport::TcpTransport(int rank, std::vector<ScopedFD> fds)
+    : rank_(rank), fds_(std::move(fds)) {}
+
+TcpTransport::~TcpTransport() = default;
+
+// static
+std::unique_ptr<TcpTransport> TcpTransport::Create(
+    int rank, const std::vector<std::string>& addresses, TimeDelta timeout) {
+  int world_size = static_cast<int>(addresses.size());
+  if (rank < 0 || rank >= world_size) {
+    LOG(ERROR) << "Invalid rank: " << rank;
+    return nullptr;
+  }
+
+  std::vector<ScopedFD> fds(world_size);
+  ScopedFD listen_fd;
+  if (rank + 1 < world_size) {
+    listen_fd = Listen(addresses[rank], world_size);
+    if (!listen_fd.is_valid()) return nullptr;
+  }
+
+  // NOTE: Each rank announces itself to the ranks it connects to, since the
+  // accepted connections arrive in no particular order.
+  TimeTicks deadline = TimeTicks::Now() + timeout;
+  for (int peer = 0; peer < rank; ++peer) {
+    ScopedFD fd;
+    while (!(fd = ConnectOnce(addresses[peer])).is_valid()) {
+      if (TimeTicks::Now() >= deadline) {
+        LOG(ERROR) << "Timed out to connect to " << addresses[peer];
+        return nullptr;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    uint8_t rank_bytes[4];
+    absl::little_endian::Store32(rank_bytes, static_cast<uint32_t>(rank));
+    if (!WriteAll(fd.get(), rank_bytes, sizeof(rank_bytes))) return nullptr;
+    SetNoDelay(fd.get());
+    fds[peer] = std::move(fd);
+  }
+
+  for (int i = rank + 1; i < world_size; ++i) {
+    ScopedFD fd(HANDLE_EINTR(accept(listen_fd.get(), nullptr, nullptr)));
+    if (!fd.is_valid()) {
+      PLOG(ERROR) << "Failed to accept()";
+      return nullptr;
+    }
+    uint8_t rank_bytes[4];
+    if (!ReadAll(fd.get(), rank_bytes, sizeof(rank_bytes))) return nullptr;
+    uint32_t peer = absl::little_endian::Load32(rank_bytes);
+    if (peer <= static_cast<uint32_t>(rank) ||
+        peer >= static_cast<uint32_t>(world_size) || fds[peer].is_valid()) {
+      LOG(ERROR) << "Unexpected peer: " << peer;
+      return nullptr;
+    }
+    SetNoDelay(fd.get());
+    fds[peer] = std::move(fd);
+  }
+  return absl::WrapUnique(new TcpTransport(rank, std::move(fds)));
+}
+
+bool TcpTransport::Send(int peer, absl::Span<const uint8_t> data) {
+  if (!CheckPeer(peer)) return false;
+  uint8_t size_bytes[8];
+  absl::little_endian::Store64(size_bytes, data.size());
+  if (!WriteAll(fds_[peer].get(), size_bytes, sizeof(size_bytes))) {
+    return false;
+  }
+  return WriteAll(fds_[peer].get(), data.data(), data.size());
+}
+
+bool TcpTransport::Receive(int peer, std::vector<uint8_t>* data) {
+  if (!CheckPeer(peer)) return false;
+  uint8_t size_bytes[8];
+  if (!ReadAll(fds_[peer].get(), size_bytes, sizeof(size_bytes))) {
+    return false;
+  }
+  data->resize(absl::little_endian::Load64(size_bytes));
+  return ReadAll(fds_[peer].get(), data->data(), data->size());
+}
+
+bool TcpTransport::CheckPeer(int peer) const {
+  if (peer < 0 || peer >= world_size() || peer == rank_) {
+    LOG(ERROR) << "Invalid peer: " << peer;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tachyon::base
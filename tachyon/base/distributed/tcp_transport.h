@@ -0,0 +1,56 @@
+#ifndef TACHYON_BASE_DISTRIBUTED_TCP_TRANSPORT_H_
+#define TACHYON_BASE_DISTRIBUTED_TCP_TRANSPORT_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/distributed/transport.h"
+#include "tachyon/base/files/scoped_file.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |TcpTransport| connects the ranks with a full mesh of TCP connections. Each
+// message is framed with its length as a little endian 64-bit integer.
+//
+// NOTE: An RDMA transport, or any other, can be plugged in by implementing
+// |Transport| the same way.
+class TACHYON_EXPORT TcpTransport : public Transport {
+ public:
+  TcpTransport(const TcpTransport& other) = delete;
+  TcpTransport& operator=(const TcpTransport& other) = delete;
+  ~TcpTransport() override;
+
+  // Listens on |addresses[rank]|, connects to the ranks below |rank| and
+  // accepts the connections from the ranks above it. Each address is given as
+  // "host:port". Since the ranks may start at different times, connecting to
+  // a peer is retried until |timeout| expires. Returns nullptr on failure.
+  static std::unique_ptr<TcpTransport> Create(
+      int rank, const std::vector<std::string>& addresses,
+      TimeDelta timeout = Seconds(60));
+
+  // Transport methods
+  int rank() const override { return rank_; }
+  int world_size() const override { return static_cast<int>(fds_.size()); }
+  [[nodiscard]] bool Send(int peer, absl::Span<const uint8_t> data) override;
+  [[nodiscard]] bool Receive(int peer, std::vector<uint8_t>* data) override;
+
+ private:
+  TcpTransport(int rank, std::vector<ScopedFD> fds);
+
+  bool CheckPeer(int peer) const;
+
+  const int rank_;
+  // |fds_[i]| is the connection to rank i. |fds_[rank_]| is invalid.
+  std::vector<ScopedFD> fds_;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_DISTRIBUTED_TCP_TRANSPORT_H_
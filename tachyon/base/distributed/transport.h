@@ -0,0 +1,40 @@
+#ifndef TACHYON_BASE_DISTRIBUTED_TRANSPORT_H_
+#define TACHYON_BASE_DISTRIBUTED_TRANSPORT_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |Transport| moves byte messages between the ranks of a group of processes,
+// e.g., the hosts proving a circuit together. The ranks are numbered from 0 to
+// |world_size()| - 1. The messages from one rank to another are delivered in
+// the order they are sent.
+//
+// An implementation must allow |Send()| to one peer and |Receive()| from
+// another, or the same, peer to run concurrently on different threads, since
+// the collectives of |Communicator| send and receive at the same time to avoid
+// deadlocks over the bounded buffers of the underlying links.
+class TACHYON_EXPORT Transport {
+ public:
+  virtual ~Transport() = default;
+
+  virtual int rank() const = 0;
+  virtual int world_size() const = 0;
+
+  // Sends |data| to |peer|. It may return before |peer| receives it.
+  [[nodiscard]] virtual bool Send(int peer, absl::Span<const uint8_t> data) = 0;
+
+  // Blocks until the next message from |peer| arrives and moves it into
+  // |data|.
+  [[nodiscard]] virtual bool Receive(int peer, std::vector<uint8_t>* data) = 0;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_DISTRIBUTED_TRANSPORT_H_
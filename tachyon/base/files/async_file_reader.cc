@@ -0,0 +1,166 @@
+#include "tachyon/base/files/async_file_reader.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+
+#include "tachyon/base/files/io_uring.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/thread_pool.h"
+
+namespace tachyon::base {
+
+AsyncFileReader::AsyncFileReader() = default;
+
+AsyncFileReader::~AsyncFileReader() = default;
+
+bool AsyncFileReader::Initialize(const FilePath& file_path,
+                                 bool use_io_uring) {
+  return Initialize(File(file_path, File::FLAG_OPEN | File::FLAG_READ),
+                    use_io_uring);
+}
+
+bool AsyncFileReader::Initialize(File file, bool use_io_uring) {
+  if (IsValid()) {
+    LOG(ERROR) << "Already initialized";
+    return false;
+  }
+  if (!file.IsValid()) {
+    LOG(ERROR) << "Invalid file: " << File::ErrorToString(file.error_details());
+    return false;
+  }
+  file_ = std::move(file);
+  if (use_io_uring) {
+    auto io_uring = std::make_unique<IoUring>();
+    if (io_uring->Initialize(kDefaultQueueDepth)) {
+      io_uring_ = std::move(io_uring);
+    } else {
+      VLOG(1) << "io_uring is not available, falling back to the thread pool";
+    }
+  }
+  return true;
+}
+
+bool AsyncFileReader::Read(absl::Span<const Request> requests,
+                           ChunkCallback callback) {
+  if (!IsValid()) {
+    LOG(ERROR) << "Not initialized";
+    return false;
+  }
+  int64_t length = file_.GetLength();
+  for (const Request& request : requests) {
+    if (request.offset < 0 ||
+        request.size > static_cast<uint64_t>(
+                           std::max(int64_t{0}, length - request.offset))) {
+      LOG(ERROR) << "Out of range: [" << request.offset << ", "
+                 << request.offset + request.size << ") of " << length;
+      return false;
+    }
+  }
+  std::vector<Chunk> chunks = SplitIntoChunks(requests);
+  if (io_uring_) return ReadWithIoUring(absl::MakeSpan(chunks), callback);
+  return ReadWithThreadPool(absl::MakeSpan(chunks), callback);
+}
+
+std::vector<AsyncFileReader::Chunk> AsyncFileReader::SplitIntoChunks(
+    absl::Span<const Request> requests) const {
+  // NOTE: A single read of io_uring is limited to |uint32_t|.
+  size_t chunk_size = std::clamp(chunk_size_, size_t{1},
+                                 size_t{std::numeric_limits<int32_t>::max()});
+  std::vector<Chunk> chunks;
+  for (size_t i = 0; i < requests.size(); ++i) {
+    const Request& request = requests[i];
+    uint8_t* dst = static_cast<uint8_t*>(request.dst);
+    for (size_t done = 0; done < request.size; done += chunk_size) {
+      chunks.push_back({i, request.offset + static_cast<int64_t>(done),
+                        dst + done, std::min(chunk_size, request.size - done)});
+    }
+  }
+  return chunks;
+}
+
+bool AsyncFileReader::ReadWithIoUring(absl::Span<Chunk> chunks,
+                                      const ChunkCallback& callback) {
+  // The number of bytes read so far for each of |chunks|, which are resumed
+  // on short reads.
+  std::vector<size_t> num_read(chunks.size(), 0);
+  size_t next = 0;
+  size_t num_in_flight = 0;
+  bool ok = true;
+  int fd = file_.GetPlatformFile();
+
+  auto prepare = [this, &chunks, &num_read, fd](size_t index) {
+    const Chunk& chunk = chunks[index];
+    size_t done = num_read[index];
+    return io_uring_->PrepareRead(
+        fd, chunk.offset + static_cast<int64_t>(done), chunk.dst + done,
+        static_cast<uint32_t>(chunk.size - done), index);
+  };
+
+  while (num_in_flight > 0 || (ok && next < chunks.size())) {
+    while (ok && next < chunks.size() &&
+           num_in_flight < io_uring_->num_entries() && prepare(next)) {
+      ++next;
+      ++num_in_flight;
+    }
+    // NOTE: The kernel writes to the destinations until the reads complete,
+    // so they are drained even on failure, and a failure of the ring itself
+    // is fatal.
+    CHECK(io_uring_->Submit(1));
+    IoUring::Completion completion;
+    while (io_uring_->PopCompletion(&completion)) {
+      --num_in_flight;
+      size_t index = static_cast<size_t>(completion.user_data);
+      const Chunk& chunk = chunks[index];
+      if (completion.result <= 0) {
+        if (ok) {
+          if (completion.result == 0) {
+            LOG(ERROR) << "Unexpected end of file at " << chunk.offset;
+          } else {
+            LOG(ERROR) << "Failed to read at " << chunk.offset << ": "
+                       << strerror(-completion.result);
+          }
+        }
+        ok = false;
+        continue;
+      }
+      num_read[index] += static_cast<size_t>(completion.result);
+      if (num_read[index] < chunk.size) {
+        if (ok) {
+          // NOTE: The completion freed an entry, so this can't fail.
+          CHECK(prepare(index));
+          ++num_in_flight;
+        }
+        continue;
+      }
+      if (ok && callback) {
+        callback(chunk.request_index, absl::MakeSpan(chunk.dst, chunk.size));
+      }
+    }
+  }
+  return ok;
+}
+
+bool AsyncFileReader::ReadWithThreadPool(absl::Span<Chunk> chunks,
+                                         const ChunkCallback& callback) {
+  std::atomic<bool> ok = true;
+  ParallelFor(0, chunks.size(), [this, &chunks, &callback, &ok](size_t i) {
+    if (!ok.load(std::memory_order_relaxed)) return;
+    const Chunk& chunk = chunks[i];
+    if (!file_.ReadAndCheck(chunk.offset,
+                            absl::MakeSpan(chunk.dst, chunk.size))) {
+      LOG(ERROR) << "Failed to read at " << chunk.offset;
+      ok.store(false, std::memory_order_relaxed);
+      return;
+    }
+    if (callback) {
+      callback(chunk.request_index, absl::MakeSpan(chunk.dst, chunk.size));
+    }
+  });
+  return ok.load(std::memory_order_relaxed);
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,99 @@
+#ifndef TACHYON_BASE_FILES_ASYNC_FILE_READER_H_
+#define TACHYON_BASE_FILES_ASYNC_FILE_READER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/export.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+
+namespace tachyon::base {
+
+class IoUring;
+
+// |AsyncFileReader| reads large ranges of a file straight into their
+// destination buffers, keeping many chunks of them in flight at the same time
+// to saturate an NVMe drive. On Linux, the chunks are submitted to an
+// io_uring. Otherwise, or if io_uring is not available, they are read with
+// pread() over the threads of |ThreadPool::GetCurrent()|.
+//
+//   AsyncFileReader reader;
+//   CHECK(reader.Initialize(path));
+//   std::vector<uint8_t> data(size);
+//   CHECK(reader.Read({{offset, data.data(), data.size()}}));
+//
+// NOTE: This is not thread-safe.
+class TACHYON_EXPORT AsyncFileReader {
+ public:
+  // A range of the file to read into |dst|.
+  struct Request {
+    int64_t offset;
+    void* dst;
+    size_t size;
+  };
+
+  // Called with the index of the request and the bytes of a chunk of it as
+  // soon as the chunk is read, so that it can be decoded while the other
+  // chunks are still being read. It may be called from other threads and
+  // concurrently.
+  using ChunkCallback =
+      std::function<void(size_t request_index, absl::Span<uint8_t> chunk)>;
+
+  constexpr static size_t kDefaultChunkSize = size_t{1} << 22;
+  constexpr static size_t kDefaultQueueDepth = 32;
+
+  AsyncFileReader();
+  AsyncFileReader(const AsyncFileReader& other) = delete;
+  AsyncFileReader& operator=(const AsyncFileReader& other) = delete;
+  ~AsyncFileReader();
+
+  bool IsValid() const { return file_.IsValid(); }
+
+  // Returns true if the reads are submitted to an io_uring.
+  bool uses_io_uring() const { return io_uring_ != nullptr; }
+
+  void set_chunk_size(size_t chunk_size) { chunk_size_ = chunk_size; }
+  size_t chunk_size() const { return chunk_size_; }
+
+  // Opens the file at |file_path|. If |use_io_uring| is false, the reads are
+  // always done over the thread pool.
+  [[nodiscard]] bool Initialize(const FilePath& file_path,
+                                bool use_io_uring = true);
+
+  [[nodiscard]] bool Initialize(File file, bool use_io_uring = true);
+
+  // Reads every range of |requests|. Returns false if any of them fails or
+  // goes past the end of the file.
+  [[nodiscard]] bool Read(absl::Span<const Request> requests,
+                          ChunkCallback callback = ChunkCallback());
+
+ private:
+  struct Chunk {
+    size_t request_index;
+    int64_t offset;
+    uint8_t* dst;
+    size_t size;
+  };
+
+  std::vector<Chunk> SplitIntoChunks(absl::Span<const Request> requests) const;
+
+  bool ReadWithIoUring(absl::Span<Chunk> chunks, const ChunkCallback& callback);
+
+  bool ReadWithThreadPool(absl::Span<Chunk> chunks,
+                          const ChunkCallback& callback);
+
+  File file_;
+  std::unique_ptr<IoUring> io_uring_;
+  size_t chunk_size_ = kDefaultChunkSize;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_FILES_ASYNC_FILE_READER_H_
@@ -0,0 +1,64 @@
+#include "tachyon/base/files/async_file_reader.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::base {
+
+class AsyncFileReaderTest : public testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    contents_.resize(10000);
+    for (size_t i = 0; i < contents_.size(); ++i) {
+      contents_[i] = static_cast<char>(i * 7 + 3);
+    }
+    path_ = temp_dir_.GetPath().Append("file");
+    ASSERT_TRUE(WriteFile(path_, contents_));
+  }
+
+ protected:
+  ScopedTempDir temp_dir_;
+  FilePath path_;
+  std::string contents_;
+};
+
+INSTANTIATE_TEST_SUITE_P(UseIoUring, AsyncFileReaderTest, testing::Bool());
+
+TEST_P(AsyncFileReaderTest, Read) {
+  AsyncFileReader reader;
+  EXPECT_FALSE(reader.Initialize(temp_dir_.GetPath().Append("missing")));
+  ASSERT_TRUE(reader.Initialize(path_, GetParam()));
+  EXPECT_TRUE(reader.IsValid());
+  if (!GetParam()) EXPECT_FALSE(reader.uses_io_uring());
+  reader.set_chunk_size(1000);
+
+  std::vector<char> first(2500);
+  std::vector<char> second(4000);
+  std::vector<size_t> num_read(2, 0);
+  AsyncFileReader::Request requests[] = {
+      {0, first.data(), first.size()},
+      {6000, second.data(), second.size()},
+  };
+  ASSERT_TRUE(reader.Read(
+      requests, [&num_read](size_t index, absl::Span<uint8_t> chunk) {
+        num_read[index] += chunk.size();
+      }));
+  EXPECT_EQ(std::string(first.begin(), first.end()),
+            contents_.substr(0, first.size()));
+  EXPECT_EQ(std::string(second.begin(), second.end()),
+            contents_.substr(6000, second.size()));
+  EXPECT_EQ(num_read, std::vector<size_t>({first.size(), second.size()}));
+
+  std::vector<char> past_end(2);
+  EXPECT_FALSE(reader.Read(
+      {{static_cast<int64_t>(contents_.size()) - 1, past_end.data(), 2}}));
+  EXPECT_FALSE(reader.Read({{-1, past_end.data(), 1}}));
+}
+
+}  // namespace tachyon::base
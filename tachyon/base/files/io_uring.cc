@@ -0,0 +1,23 @@
+#include "tachyon/base/files/io_uring.h"
+
+namespace tachyon::base {
+
+// NOTE: io_uring is only available on Linux, so |Initialize()| always fails
+// here and |AsyncFileReader| falls back to the thread pool.
+
+IoUring::~IoUring() = default;
+
+bool IoUring::Initialize(size_t num_entries) { return false; }
+
+bool IoUring::PrepareRead(int fd, int64_t offset, void* dst, uint32_t size,
+                          uint64_t user_data) {
+  return false;
+}
+
+bool IoUring::Submit(size_t min_completions) { return false; }
+
+bool IoUring::PopCompletion(Completion* completion) { return false; }
+
+void IoUring::Close() {}
+
+}  // namespace tachyon::base
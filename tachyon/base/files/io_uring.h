@@ -0,0 +1,77 @@
+#ifndef TACHYON_BASE_FILES_IO_URING_H_
+#define TACHYON_BASE_FILES_IO_URING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/export.h"
+
+struct io_uring_cqe;
+struct io_uring_sqe;
+
+namespace tachyon::base {
+
+// |IoUring| is a minimal io_uring of Linux that only reads files. It talks to
+// the kernel with the system calls directly instead of depending on liburing.
+// NOTE: This is not thread-safe.
+class TACHYON_EXPORT IoUring {
+ public:
+  struct Completion {
+    uint64_t user_data;
+    // The number of bytes read, or -errno on failure.
+    int32_t result;
+  };
+
+  IoUring() = default;
+  IoUring(const IoUring& other) = delete;
+  IoUring& operator=(const IoUring& other) = delete;
+  ~IoUring();
+
+  bool IsValid() const { return fd_ >= 0; }
+
+  size_t num_entries() const { return num_entries_; }
+
+  // Sets up a ring of at least |num_entries| entries. Returns false if
+  // io_uring is not available, e.g., on the kernels older than 5.6 or when it
+  // is blocked by seccomp.
+  [[nodiscard]] bool Initialize(size_t num_entries);
+
+  // Queues a read of |size| bytes at |offset| of |fd| into |dst|. Returns false
+  // if the submission queue is full.
+  [[nodiscard]] bool PrepareRead(int fd, int64_t offset, void* dst,
+                                 uint32_t size, uint64_t user_data);
+
+  // Submits the queued reads and waits until at least |min_completions| reads
+  // complete. Returns false on failure.
+  [[nodiscard]] bool Submit(size_t min_completions);
+
+  // Pops a completion into |completion|. Returns false if there is none.
+  [[nodiscard]] bool PopCompletion(Completion* completion);
+
+ private:
+  void Close();
+
+  int fd_ = -1;
+  size_t num_entries_ = 0;
+  unsigned num_pending_ = 0;
+
+  void* sq_ring_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  void* cq_ring_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+
+  unsigned* sq_head_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_FILES_IO_URING_H_
@@ -0,0 +1,161 @@
+#include "tachyon/base/files/io_uring.h"
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/posix/eintr_wrapper.h"
+
+namespace tachyon::base {
+
+namespace {
+
+unsigned* GetRingField(void* ring, uint32_t offset) {
+  return reinterpret_cast<unsigned*>(static_cast<char*>(ring) + offset);
+}
+
+unsigned LoadAcquire(const unsigned* ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+void StoreRelease(unsigned* ptr, unsigned value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+}  // namespace
+
+IoUring::~IoUring() { Close(); }
+
+bool IoUring::Initialize(size_t num_entries) {
+  if (IsValid()) {
+    LOG(ERROR) << "Already initialized";
+    return false;
+  }
+
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = static_cast<int>(syscall(__NR_io_uring_setup,
+                                    static_cast<unsigned>(num_entries),
+                                    &params));
+  if (fd < 0) {
+    VPLOG(1) << "io_uring_setup()";
+    return false;
+  }
+  fd_ = fd;
+  num_entries_ = params.sq_entries;
+
+  sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap) {
+    sq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    cq_ring_size_ = sq_ring_size_;
+  }
+  sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+  if (sq_ring_ == MAP_FAILED) {
+    sq_ring_ = nullptr;
+    PLOG(ERROR) << "mmap()";
+    Close();
+    return false;
+  }
+  if (single_mmap) {
+    cq_ring_ = sq_ring_;
+  } else {
+    cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == MAP_FAILED) {
+      cq_ring_ = nullptr;
+      PLOG(ERROR) << "mmap()";
+      Close();
+      return false;
+    }
+  }
+  sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  void* sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    PLOG(ERROR) << "mmap()";
+    Close();
+    return false;
+  }
+  sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+  sq_head_ = GetRingField(sq_ring_, params.sq_off.head);
+  sq_tail_ = GetRingField(sq_ring_, params.sq_off.tail);
+  sq_mask_ = *GetRingField(sq_ring_, params.sq_off.ring_mask);
+  sq_array_ = GetRingField(sq_ring_, params.sq_off.array);
+  cq_head_ = GetRingField(cq_ring_, params.cq_off.head);
+  cq_tail_ = GetRingField(cq_ring_, params.cq_off.tail);
+  cq_mask_ = *GetRingField(cq_ring_, params.cq_off.ring_mask);
+  cqes_ = reinterpret_cast<io_uring_cqe*>(static_cast<char*>(cq_ring_) +
+                                          params.cq_off.cqes);
+  return true;
+}
+
+bool IoUring::PrepareRead(int fd, int64_t offset, void* dst, uint32_t size,
+                          uint64_t user_data) {
+  unsigned tail = *sq_tail_;
+  if (tail - LoadAcquire(sq_head_) >= num_entries_) return false;
+
+  unsigned index = tail & sq_mask_;
+  io_uring_sqe* sqe = &sqes_[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = IORING_OP_READ;
+  sqe->fd = fd;
+  sqe->off = static_cast<uint64_t>(offset);
+  sqe->addr = reinterpret_cast<uint64_t>(dst);
+  sqe->len = size;
+  sqe->user_data = user_data;
+  sq_array_[index] = index;
+  StoreRelease(sq_tail_, tail + 1);
+  ++num_pending_;
+  return true;
+}
+
+bool IoUring::Submit(size_t min_completions) {
+  unsigned flags = min_completions > 0 ? IORING_ENTER_GETEVENTS : 0;
+  while (true) {
+    long ret =
+        syscall(__NR_io_uring_enter, fd_, num_pending_,
+                static_cast<unsigned>(min_completions), flags, nullptr, 0);
+    if (ret >= 0) {
+      num_pending_ -= std::min(num_pending_, static_cast<unsigned>(ret));
+      return true;
+    }
+    if (errno != EINTR) break;
+  }
+  PLOG(ERROR) << "io_uring_enter()";
+  return false;
+}
+
+bool IoUring::PopCompletion(Completion* completion) {
+  unsigned head = *cq_head_;
+  if (head == LoadAcquire(cq_tail_)) return false;
+  const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+  completion->user_data = cqe.user_data;
+  completion->result = cqe.res;
+  StoreRelease(cq_head_, head + 1);
+  return true;
+}
+
+void IoUring::Close() {
+  if (sqes_) munmap(sqes_, sqes_size_);
+  if (cq_ring_ && cq_ring_ != sq_ring_) munmap(cq_ring_, cq_ring_size_);
+  if (sq_ring_) munmap(sq_ring_, sq_ring_size_);
+  if (fd_ >= 0) IGNORE_EINTR(close(fd_));
+  sqes_ = nullptr;
+  cq_ring_ = nullptr;
+  sq_ring_ = nullptr;
+  fd_ = -1;
+  num_entries_ = 0;
+  num_pending_ = 0;
+}
+
+}  // namespace tachyon::base
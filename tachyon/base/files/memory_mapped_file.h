@@ -0,0 +1,74 @@
+#ifndef TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
+#define TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/read_only_buffer.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |MemoryMappedFile| maps a whole file into the address space read-only. The
+// mapping is released when it is destroyed.
+class TACHYON_EXPORT MemoryMappedFile {
+ public:
+  // How the mapping is going to be read, which is passed to the kernel to tune
+  // the readahead.
+  enum class Access {
+    // The default readahead of the kernel is used.
+    kNormal,
+    // The file is read once from the beginning to the end, e.g., when it is
+    // parsed. The kernel reads ahead aggressively and may drop the pages soon
+    // after they are read.
+    kSequential,
+    // The file is read at random, e.g., when the columns are paged in lazily.
+    // The kernel doesn't read ahead.
+    kRandom,
+  };
+
+  MemoryMappedFile() = default;
+  MemoryMappedFile(const MemoryMappedFile& other) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+  ~MemoryMappedFile();
+
+  const uint8_t* data() const { return data_; }
+  size_t length() const { return length_; }
+  absl::Span<const uint8_t> bytes() const {
+    return absl::Span<const uint8_t>(data_, length_);
+  }
+
+  bool IsValid() const { return data_ != nullptr; }
+
+  // Returns a buffer reading the mapping in place, which is valid while this
+  // is alive.
+  ReadOnlyBuffer ToBuffer() const { return ReadOnlyBuffer(data_, length_); }
+
+  // Opens and maps the file at |file_path|. Returns false if the file can't be
+  // opened, is empty or can't be mapped.
+  [[nodiscard]] bool Initialize(const FilePath& file_path,
+                                Access access = Access::kNormal);
+
+  // Maps |file|. The file is closed afterwards, while the mapping is still
+  // alive.
+  [[nodiscard]] bool Initialize(File file, Access access = Access::kNormal);
+
+  // Starts reading [|offset|, |offset| + |length|) of the file in the
+  // background, so that the pages are already in memory when they are
+  // touched. Returns false if the range is out of the mapping.
+  bool WillNeed(size_t offset, size_t length) const;
+
+ private:
+  void CloseHandles();
+
+  uint8_t* data_ = nullptr;
+  size_t length_ = 0;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
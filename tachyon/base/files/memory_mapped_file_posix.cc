@@ -0,0 +1,92 @@
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <utility>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::base {
+
+namespace {
+
+int ToMadviseAdvice(MemoryMappedFile::Access access) {
+  switch (access) {
+    case MemoryMappedFile::Access::kNormal:
+      return MADV_NORMAL;
+    case MemoryMappedFile::Access::kSequential:
+      return MADV_SEQUENTIAL;
+    case MemoryMappedFile::Access::kRandom:
+      return MADV_RANDOM;
+  }
+  NOTREACHED();
+  return MADV_NORMAL;
+}
+
+}  // namespace
+
+MemoryMappedFile::~MemoryMappedFile() { CloseHandles(); }
+
+bool MemoryMappedFile::Initialize(const FilePath& file_path, Access access) {
+  File file(file_path, File::FLAG_OPEN | File::FLAG_READ);
+  if (!file.IsValid()) {
+    LOG(ERROR) << "Couldn't open " << file_path.value();
+    return false;
+  }
+  return Initialize(std::move(file), access);
+}
+
+bool MemoryMappedFile::Initialize(File file, Access access) {
+  if (IsValid()) {
+    LOG(ERROR) << "Already initialized";
+    return false;
+  }
+  if (!file.IsValid()) return false;
+
+  int64_t length = file.GetLength();
+  if (length <= 0) {
+    LOG(ERROR) << "Can't map an empty file";
+    return false;
+  }
+
+  void* data = mmap(nullptr, static_cast<size_t>(length), PROT_READ,
+                    MAP_SHARED, file.GetPlatformFile(), 0);
+  if (data == MAP_FAILED) {
+    PLOG(ERROR) << "mmap";
+    return false;
+  }
+  data_ = static_cast<uint8_t*>(data);
+  length_ = static_cast<size_t>(length);
+  // NOTE: The advice is only a hint, so the mapping is still usable if it
+  // fails.
+  if (access != Access::kNormal &&
+      madvise(data_, length_, ToMadviseAdvice(access)) != 0) {
+    PLOG(WARNING) << "madvise";
+  }
+  return true;
+}
+
+bool MemoryMappedFile::WillNeed(size_t offset, size_t length) const {
+  if (offset > length_ || length > length_ - offset) return false;
+  if (length == 0) return true;
+  // NOTE: madvise() requires the address to be aligned to the page size.
+  uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  uintptr_t begin = reinterpret_cast<uintptr_t>(data_ + offset);
+  uintptr_t aligned_begin = bits::AlignDown(begin, page_size);
+  if (madvise(reinterpret_cast<void*>(aligned_begin),
+              begin + length - aligned_begin, MADV_WILLNEED) != 0) {
+    PLOG(WARNING) << "madvise";
+    return false;
+  }
+  return true;
+}
+
+void MemoryMappedFile::CloseHandles() {
+  if (data_ != nullptr) munmap(data_, length_);
+  data_ = nullptr;
+  length_ = 0;
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,59 @@
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <string_view>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::base {
+
+TEST(MemoryMappedFileTest, Initialize) {
+  ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  MemoryMappedFile empty_file;
+  FilePath empty_path = temp_dir.GetPath().Append("empty");
+  ASSERT_TRUE(WriteFile(empty_path, std::string_view()));
+  EXPECT_FALSE(empty_file.Initialize(empty_path));
+  EXPECT_FALSE(empty_file.Initialize(temp_dir.GetPath().Append("missing")));
+
+  constexpr std::string_view kContents = "tachyon";
+  FilePath path = temp_dir.GetPath().Append("file");
+  ASSERT_TRUE(WriteFile(path, kContents));
+
+  MemoryMappedFile file;
+  ASSERT_TRUE(file.Initialize(path));
+  EXPECT_TRUE(file.IsValid());
+  ASSERT_EQ(file.length(), kContents.size());
+  EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(file.data()),
+                             file.length()),
+            kContents);
+  EXPECT_FALSE(file.Initialize(path));
+}
+
+TEST(MemoryMappedFileTest, Access) {
+  ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  constexpr std::string_view kContents = "tachyon";
+  FilePath path = temp_dir.GetPath().Append("file");
+  ASSERT_TRUE(WriteFile(path, kContents));
+
+  MemoryMappedFile file;
+  ASSERT_TRUE(file.Initialize(path, MemoryMappedFile::Access::kSequential));
+  EXPECT_TRUE(file.WillNeed(0, file.length()));
+  EXPECT_TRUE(file.WillNeed(3, 4));
+  EXPECT_FALSE(file.WillNeed(3, 5));
+  EXPECT_FALSE(file.WillNeed(8, 0));
+
+  ReadOnlyBuffer buffer = file.ToBuffer();
+  absl::Span<const char> chars;
+  ASSERT_TRUE(buffer.ReadSpan(kContents.size(), &chars));
+  EXPECT_EQ(chars.data(), reinterpret_cast<const char*>(file.data()));
+  EXPECT_EQ(std::string_view(chars.data(), chars.size()), kContents);
+  EXPECT_TRUE(buffer.Done());
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,33 @@
+#include "tachyon/base/memory/default_init_allocator.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(DefaultInitAllocatorTest, Resize) {
+  UninitializedVector<int> values = {1, 2, 3};
+  // The elements are kept and the new ones are written before read.
+  values.resize(1000);
+  EXPECT_EQ(values[2], 3);
+  values[999] = 5;
+  EXPECT_EQ(values[999], 5);
+
+  // The elements constructed with arguments are initialized as usual.
+  values.resize(1001, 7);
+  EXPECT_EQ(values.back(), 7);
+  values.push_back(8);
+  EXPECT_EQ(values.back(), 8);
+}
+
+TEST(DefaultInitAllocatorTest, NonTrivialType) {
+  std::vector<std::string, DefaultInitAllocator<std::string>> values(3);
+  for (const std::string& value : values) {
+    EXPECT_TRUE(value.empty());
+  }
+  values.resize(4, "a");
+  EXPECT_EQ(values.back(), "a");
+}
+
+}  // namespace tachyon::base
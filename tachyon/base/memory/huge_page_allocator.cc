@@ -0,0 +1,73 @@
+#include "tachyon/base/memory/huge_page_allocator.h"
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/memory/aligned_memory.h"
+#include "tachyon/build/build_config.h"
+
+#if BUILDFLAG(IS_POSIX)
+#include <sys/mman.h>
+#endif
+
+namespace tachyon::base {
+
+namespace {
+
+std::atomic<HugePageMode> g_huge_page_mode = HugePageMode::kNone;
+
+}  // namespace
+
+void SetHugePageMode(HugePageMode mode) {
+  g_huge_page_mode.store(mode, std::memory_order_relaxed);
+}
+
+HugePageMode GetHugePageMode() {
+  return g_huge_page_mode.load(std::memory_order_relaxed);
+}
+
+void AdviseHugePages(void* ptr, size_t size) {
+#if BUILDFLAG(IS_LINUX) && defined(MADV_HUGEPAGE)
+  uintptr_t begin =
+      bits::AlignUp(reinterpret_cast<uintptr_t>(ptr), uintptr_t{kHugePageSize});
+  uintptr_t end = bits::AlignDown(reinterpret_cast<uintptr_t>(ptr) + size,
+                                  uintptr_t{kHugePageSize});
+  if (begin >= end) return;
+  // NOTE: This is only a hint, so the failure, e.g., when the transparent
+  // huge pages are disabled, is ignored.
+  madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+#endif
+}
+
+void* AllocateHugePages(size_t size) {
+  size = bits::AlignUp(size, kHugePageSize);
+#if BUILDFLAG(IS_POSIX)
+  HugePageMode mode = GetHugePageMode();
+#if defined(MAP_HUGETLB)
+  if (mode == HugePageMode::kHugeTlb) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED) return ptr;
+  }
+#endif
+  void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) return nullptr;
+  if (mode != HugePageMode::kNone) AdviseHugePages(ptr, size);
+  return ptr;
+#else
+  return AlignedAlloc(size, kHugePageSize);
+#endif
+}
+
+void FreeHugePages(void* ptr, size_t size) {
+#if BUILDFLAG(IS_POSIX)
+  munmap(ptr, bits::AlignUp(size, kHugePageSize));
+#else
+  AlignedFree(ptr);
+#endif
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,94 @@
+#ifndef TACHYON_BASE_MEMORY_HUGE_PAGE_ALLOCATOR_H_
+#define TACHYON_BASE_MEMORY_HUGE_PAGE_ALLOCATOR_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "tachyon/export.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/memory/default_init_allocator.h"
+
+namespace tachyon::base {
+
+// How |HugePageAllocator| backs the large allocations.
+enum class HugePageMode {
+  // The pages are left to the kernel.
+  kNone,
+  // The transparent huge pages are requested with madvise(MADV_HUGEPAGE).
+  kTransparent,
+  // The pages are taken from hugetlbfs with mmap(MAP_HUGETLB), falling back
+  // to |kTransparent| if no huge page is reserved.
+  kHugeTlb,
+};
+
+// The allocations smaller than this are served by |std::allocator|, since
+// they don't span a huge page.
+constexpr size_t kHugePageSize = size_t{1} << 21;
+
+TACHYON_EXPORT void SetHugePageMode(HugePageMode mode);
+
+TACHYON_EXPORT HugePageMode GetHugePageMode();
+
+// Advises the kernel to back the pages of [|ptr|, |ptr| + |size|) with
+// transparent huge pages. It has an effect only on the pages that are not
+// touched yet.
+TACHYON_EXPORT void AdviseHugePages(void* ptr, size_t size);
+
+// Maps |size| bytes, rounded up to |kHugePageSize|, according to
+// |GetHugePageMode()|. Returns nullptr on failure.
+TACHYON_EXPORT void* AllocateHugePages(size_t size);
+
+// Unmaps the memory returned by |AllocateHugePages(size)|.
+TACHYON_EXPORT void FreeHugePages(void* ptr, size_t size);
+
+// An allocator for the buffers accessed at random, e.g., the buckets of
+// Pippenger or the nodes of a merkle tree, whose TLB misses dominate on 4 KB
+// pages. Whether an allocation is mapped by |AllocateHugePages()| only
+// depends on its size, so |SetHugePageMode()| can be called at any time.
+// NOTE: Without |SetHugePageMode()|, this behaves the same as the default
+// allocator, since glibc maps the large allocations as well.
+template <typename T>
+class HugePageAllocator {
+ public:
+  using value_type = T;
+
+  HugePageAllocator() = default;
+  template <typename U>
+  HugePageAllocator(const HugePageAllocator<U>& other) {}
+
+  T* allocate(size_t n) {
+    size_t size = n * sizeof(T);
+    if (size < kHugePageSize) return std::allocator<T>().allocate(n);
+    void* ptr = AllocateHugePages(size);
+    // NOTE: Like the default allocator, running out of memory is fatal.
+    CHECK(ptr) << "Failed to allocate " << size << " bytes";
+    return static_cast<T*>(ptr);
+  }
+
+  void deallocate(T* ptr, size_t n) {
+    size_t size = n * sizeof(T);
+    if (size < kHugePageSize) return std::allocator<T>().deallocate(ptr, n);
+    FreeHugePages(ptr, size);
+  }
+
+  template <typename U>
+  bool operator==(const HugePageAllocator<U>& other) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const HugePageAllocator<U>& other) const {
+    return false;
+  }
+};
+
+// NOTE: Like |UninitializedVector|, the elements of trivially copyable types
+// are left uninitialized when it grows.
+template <typename T>
+using HugePageVector =
+    std::vector<T, DefaultInitAllocator<T, HugePageAllocator<T>>>;
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_MEMORY_HUGE_PAGE_ALLOCATOR_H_
@@ -0,0 +1,25 @@
+#include "tachyon/base/memory/huge_page_allocator.h"
+
+#include <numeric>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(HugePageAllocatorTest, Allocate) {
+  for (HugePageMode mode : {HugePageMode::kNone, HugePageMode::kTransparent,
+                            HugePageMode::kHugeTlb}) {
+    SetHugePageMode(mode);
+    EXPECT_EQ(GetHugePageMode(), mode);
+    for (size_t size : {size_t{10}, kHugePageSize / sizeof(int) + 1}) {
+      HugePageVector<int> values(size);
+      std::iota(values.begin(), values.end(), 0);
+      EXPECT_EQ(values.back(), static_cast<int>(size - 1));
+      values.resize(size * 2);
+      EXPECT_EQ(values[size - 1], static_cast<int>(size - 1));
+    }
+  }
+  SetHugePageMode(HugePageMode::kNone);
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,154 @@
+#include "tachyon/base/memory/numa.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <utility>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+#include "tachyon/build/build_config.h"
+
+#if BUILDFLAG(IS_LINUX)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace tachyon::base {
+
+namespace {
+
+// NOTE: The node mask is a single unsigned long, which covers every machine
+// in practice.
+constexpr size_t kMaxNumaNodes = sizeof(unsigned long) * 8;
+
+std::atomic<NumaPolicy> g_numa_policy = NumaPolicy::kDefault;
+
+#if BUILDFLAG(IS_LINUX)
+bool ReadCpuList(const FilePath& path, std::vector<size_t>* values) {
+  std::string content;
+  if (!ReadFileToString(path, &content)) return false;
+  return ParseCpuList(absl::StripAsciiWhitespace(content), values);
+}
+
+bool BindMemory(void* ptr, size_t size, int mode, unsigned long node_mask) {
+  // NOTE: The kernel ignores the last bit of |maxnode|.
+  if (syscall(SYS_mbind, ptr, size, mode, &node_mask, kMaxNumaNodes + 1,
+              MPOL_MF_MOVE) != 0) {
+    PLOG(ERROR) << "mbind()";
+    return false;
+  }
+  return true;
+}
+#endif
+
+}  // namespace
+
+bool ParseCpuList(std::string_view input, std::vector<size_t>* values) {
+  std::vector<size_t> ret;
+  if (!input.empty()) {
+    for (std::string_view range : absl::StrSplit(input, ',')) {
+      std::vector<std::string_view> bounds = absl::StrSplit(range, '-');
+      size_t first;
+      size_t last;
+      if (bounds.size() > 2 || !StringToSizeT(bounds[0], &first)) return false;
+      if (bounds.size() == 1) {
+        last = first;
+      } else if (!StringToSizeT(bounds[1], &last) || last < first) {
+        return false;
+      }
+      for (size_t i = first; i <= last; ++i) {
+        ret.push_back(i);
+      }
+    }
+  }
+  *values = std::move(ret);
+  return true;
+}
+
+size_t GetNumaNodeCount() {
+#if BUILDFLAG(IS_LINUX)
+  static size_t count = []() {
+    std::vector<size_t> nodes;
+    if (!ReadCpuList(FilePath("/sys/devices/system/node/online"), &nodes) ||
+        nodes.empty()) {
+      return size_t{1};
+    }
+    return std::min(nodes.back() + 1, kMaxNumaNodes);
+  }();
+  return count;
+#else
+  return 1;
+#endif
+}
+
+std::vector<size_t> GetNumaNodeCpus(size_t node) {
+  std::vector<size_t> cpus;
+#if BUILDFLAG(IS_LINUX)
+  if (!ReadCpuList(FilePath(absl::Substitute(
+                       "/sys/devices/system/node/node$0/cpulist", node)),
+                   &cpus)) {
+    return {};
+  }
+#endif
+  return cpus;
+}
+
+void SetNumaPolicy(NumaPolicy policy) {
+  g_numa_policy.store(policy, std::memory_order_relaxed);
+}
+
+NumaPolicy GetNumaPolicy() {
+  return g_numa_policy.load(std::memory_order_relaxed);
+}
+
+bool ApplyNumaPolicy(void* ptr, size_t size) {
+#if BUILDFLAG(IS_LINUX)
+  NumaPolicy policy = GetNumaPolicy();
+  size_t node_count = GetNumaNodeCount();
+  if (policy == NumaPolicy::kDefault || node_count == 1) return true;
+
+  size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  uintptr_t begin =
+      bits::AlignUp(reinterpret_cast<uintptr_t>(ptr), uintptr_t{page_size});
+  uintptr_t end = bits::AlignDown(reinterpret_cast<uintptr_t>(ptr) + size,
+                                  uintptr_t{page_size});
+  if (begin >= end) return true;
+
+  if (policy == NumaPolicy::kInterleave) {
+    unsigned long node_mask =
+        node_count == kMaxNumaNodes ? ~0ul : (1ul << node_count) - 1;
+    return BindMemory(reinterpret_cast<void*>(begin), end - begin,
+                      MPOL_INTERLEAVE, node_mask);
+  }
+
+  size_t num_pages = (end - begin) / page_size;
+  size_t num_pages_per_node = (num_pages + node_count - 1) / node_count;
+  for (size_t i = 0; i < node_count; ++i) {
+    size_t first = i * num_pages_per_node;
+    if (first >= num_pages) break;
+    size_t len = std::min(num_pages_per_node, num_pages - first);
+    // NOTE: |MPOL_PREFERRED| falls back to the other nodes rather than
+    // failing when the node runs out of memory.
+    if (!BindMemory(reinterpret_cast<void*>(begin + first * page_size),
+                    len * page_size, MPOL_PREFERRED, 1ul << i)) {
+      return false;
+    }
+  }
+  return true;
+#else
+  return true;
+#endif
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,65 @@
+#ifndef TACHYON_BASE_MEMORY_NUMA_H_
+#define TACHYON_BASE_MEMORY_NUMA_H_
+
+#include <stddef.h>
+
+#include <string_view>
+#include <vector>
+
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// How the large buffers, e.g., the polynomials and the proving key columns,
+// are placed over the NUMA nodes.
+enum class NumaPolicy {
+  // The pages are placed on the node of the thread touching them first.
+  kDefault,
+  // The pages are interleaved over all the nodes, so that the threads on
+  // every node see the same bandwidth.
+  kInterleave,
+  // The buffer is split into as many contiguous slices as the nodes and the
+  // k-th slice is placed on the k-th node. This matches the chunks of
+  // |Parallelize()| when the threads are pinned with
+  // |ThreadAffinity::kCompact|.
+  kPartition,
+};
+
+// The buffers smaller than this are left as they are, since they don't span
+// enough pages to be worth a system call.
+constexpr size_t kMinNumaBufferSize = size_t{1} << 21;
+
+// Parses a cpulist, e.g., "0-3,8,10-11", of sysfs into |values|.
+TACHYON_EXPORT bool ParseCpuList(std::string_view input,
+                                 std::vector<size_t>* values);
+
+// Returns the number of the NUMA nodes. Returns 1 if the platform doesn't
+// support NUMA.
+TACHYON_EXPORT size_t GetNumaNodeCount();
+
+// Returns the CPUs of the |node|-th NUMA node. Returns an empty vector if the
+// platform doesn't support NUMA.
+TACHYON_EXPORT std::vector<size_t> GetNumaNodeCpus(size_t node);
+
+// NOTE: This only affects the buffers passed to |ApplyNumaPolicy()| after the
+// call.
+TACHYON_EXPORT void SetNumaPolicy(NumaPolicy policy);
+
+TACHYON_EXPORT NumaPolicy GetNumaPolicy();
+
+// Places the pages of [|ptr|, |ptr| + |size|) according to |GetNumaPolicy()|,
+// moving the pages that are already touched. Only the pages that lie fully
+// inside the range are affected. Returns false if the system call fails.
+TACHYON_EXPORT bool ApplyNumaPolicy(void* ptr, size_t size);
+
+template <typename T>
+bool ApplyNumaPolicy(std::vector<T>& values) {
+  if (GetNumaPolicy() == NumaPolicy::kDefault) return true;
+  size_t size = values.size() * sizeof(T);
+  if (size < kMinNumaBufferSize) return true;
+  return ApplyNumaPolicy(values.data(), size);
+}
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_MEMORY_NUMA_H_
@@ -0,0 +1,19 @@
+#include "tachyon/base/memory/numa.h"
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(NumaTest, ParseCpuList) {
+  std::vector<size_t> values;
+  ASSERT_TRUE(ParseCpuList("", &values));
+  EXPECT_TRUE(values.empty());
+  ASSERT_TRUE(ParseCpuList("0-3,8,10-11", &values));
+  EXPECT_EQ(values, std::vector<size_t>({0, 1, 2, 3, 8, 10, 11}));
+
+  for (std::string_view input : {"1-", "3-1", "0-1-2", "a", "0,,1"}) {
+    EXPECT_FALSE(ParseCpuList(input, &values));
+  }
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,103 @@
+#ifndef TACHYON_BASE_MEMORY_VECTOR_POOL_H_
+#define TACHYON_BASE_MEMORY_VECTOR_POOL_H_
+
+#include <stddef.h>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/memory/huge_page_allocator.h"
+#include "tachyon/base/no_destructor.h"
+
+namespace tachyon::base {
+
+// |VectorPool| keeps the storage of the released vectors and hands it out to
+// the next |Acquire()| of the same size class, so that a buffer of the same
+// size created and destroyed over and over, e.g., a part of the circuit
+// polynomial per proof, neither goes back to malloc nor is zero-initialized
+// again. A size class holds the vectors whose capacity is the same power of
+// two.
+//
+//   std::vector<F> values = VectorPool<F>::GetDefault().Acquire(n);
+//   // ... fill |values| ...
+//   VectorPool<F>::GetDefault().Release(std::move(values));
+template <typename T>
+class VectorPool {
+ public:
+  VectorPool() = default;
+  VectorPool(const VectorPool& other) = delete;
+  VectorPool& operator=(const VectorPool& other) = delete;
+
+  static VectorPool& GetDefault() {
+    static NoDestructor<VectorPool> pool;
+    return *pool;
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t ret = 0;
+    for (const std::vector<std::vector<T>>& vectors : size_classes_) {
+      ret += vectors.size();
+    }
+    return ret;
+  }
+
+  // Returns a vector of |size| elements.
+  // NOTE: The elements are left as they were when the storage was released,
+  // so they must be overwritten before they are read.
+  std::vector<T> Acquire(size_t size) {
+    if (size == 0) return {};
+    size_t size_class = bits::SafeLog2Ceiling(size);
+    std::vector<T> ret;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (size_class < size_classes_.size() &&
+          !size_classes_[size_class].empty()) {
+        ret = std::move(size_classes_[size_class].back());
+        size_classes_[size_class].pop_back();
+      }
+    }
+    if (ret.capacity() == 0) {
+      ret.reserve(size_t{1} << size_class);
+      AdviseHugePages(ret.data(), ret.capacity() * sizeof(T));
+    }
+    // NOTE: Only the elements beyond the previous size are initialized.
+    ret.resize(size);
+    return ret;
+  }
+
+  // Keeps the storage of |values| for the next |Acquire()|. The vectors whose
+  // capacity is not a power of two are dropped, since they are not created
+  // by |Acquire()|.
+  void Release(std::vector<T>&& values) {
+    size_t capacity = values.capacity();
+    if (capacity == 0 || !bits::IsPowerOfTwo(capacity)) return;
+    size_t size_class = bits::SafeLog2Ceiling(capacity);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (size_class >= size_classes_.size()) {
+      size_classes_.resize(size_class + 1);
+    }
+    size_classes_[size_class].push_back(std::move(values));
+  }
+
+  // Frees every storage kept by the pool.
+  void Clear() {
+    std::vector<std::vector<std::vector<T>>> size_classes;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      size_classes = std::move(size_classes_);
+      size_classes_.clear();
+    }
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  // |size_classes_[k]| holds the vectors whose capacity is 2ᵏ.
+  std::vector<std::vector<std::vector<T>>> size_classes_;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_MEMORY_VECTOR_POOL_H_
@@ -0,0 +1,40 @@
+#include "tachyon/base/memory/vector_pool.h"
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(VectorPoolTest, AcquireAndRelease) {
+  VectorPool<int> pool;
+  std::vector<int> values = pool.Acquire(5);
+  EXPECT_EQ(values.size(), 5);
+  EXPECT_EQ(values.capacity(), 8);
+  values[4] = 4;
+  const int* data = values.data();
+  pool.Release(std::move(values));
+  EXPECT_EQ(pool.size(), 1);
+
+  // The storage is reused by the same size class without being reset.
+  values = pool.Acquire(7);
+  EXPECT_EQ(pool.size(), 0);
+  EXPECT_EQ(values.data(), data);
+  EXPECT_EQ(values.size(), 7);
+  EXPECT_EQ(values[4], 4);
+  pool.Release(std::move(values));
+
+  // The other size classes don't share the storage.
+  values = pool.Acquire(9);
+  EXPECT_NE(values.data(), data);
+  EXPECT_EQ(values.capacity(), 16);
+  EXPECT_EQ(pool.size(), 1);
+
+  // The vectors not created by the pool are dropped.
+  pool.Release(std::vector<int>(3));
+  EXPECT_EQ(pool.size(), 1);
+
+  pool.Clear();
+  EXPECT_EQ(pool.size(), 0);
+  EXPECT_TRUE(pool.Acquire(0).empty());
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,276 @@
+#include "tachyon/base/metrics/metrics_registry.h"
+
+#include <algorithm>
+
+#include "absl/strings/str_cat.h"
+
+#include "tachyon/base/environment.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::base {
+
+namespace internal {
+
+size_t GetMetricShardIndex() {
+  static std::atomic<size_t> next_index = 0;
+  thread_local size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed) % kNumMetricShards;
+  return index;
+}
+
+}  // namespace internal
+
+namespace {
+
+void AtomicAdd(std::atomic<double>& target, double value) {
+  double expected = target.load(std::memory_order_relaxed);
+  while (!target.compare_exchange_weak(expected, expected + value,
+                                       std::memory_order_relaxed)) {
+  }
+}
+
+// Escapes |value| to be put in the double quotes of a label.
+std::string EscapeLabelValue(std::string_view value) {
+  std::string ret;
+  ret.reserve(value.size());
+  for (char c : value) {
+    switch (c) {
+      case '\\':
+        ret += "\\\\";
+        break;
+      case '"':
+        ret += "\\\"";
+        break;
+      case '\n':
+        ret += "\\n";
+        break;
+      default:
+        ret += c;
+    }
+  }
+  return ret;
+}
+
+// Returns |labels| as "a="1",b="2"" without the braces, so that the "le" label
+// of the histograms can be appended to it.
+std::string FormatLabels(const MetricsRegistry::Labels& labels) {
+  std::string ret;
+  for (const auto& [key, value] : labels) {
+    if (!ret.empty()) ret += ",";
+    absl::StrAppend(&ret, key, "=\"", EscapeLabelValue(value), "\"");
+  }
+  return ret;
+}
+
+std::string WithBraces(std::string_view labels) {
+  if (labels.empty()) return "";
+  return absl::StrCat("{", labels, "}");
+}
+
+std::string WithLabel(std::string_view labels, std::string_view label) {
+  if (labels.empty()) return absl::StrCat("{", label, "}");
+  return absl::StrCat("{", labels, ",", label, "}");
+}
+
+MetricsRegistry* CreateRegistry() {
+  MetricsRegistry* registry = new MetricsRegistry();
+  std::string_view enabled;
+  if (Environment::Get("TACHYON_METRICS", &enabled) && enabled == "1") {
+    registry->set_enabled(true);
+  }
+  return registry;
+}
+
+}  // namespace
+
+uint64_t Counter::value() const {
+  uint64_t ret = 0;
+  for (const Shard& shard : shards_) {
+    ret += shard.value.load(std::memory_order_relaxed);
+  }
+  return ret;
+}
+
+void Gauge::Add(double value) { AtomicAdd(value_, value); }
+
+// static
+std::vector<double> Histogram::GetDefaultSecondsBounds() {
+  std::vector<double> bounds;
+  double bound = 0.001;
+  for (size_t i = 0; i < 12; ++i) {
+    bounds.push_back(bound);
+    bound *= 4;
+  }
+  return bounds;
+}
+
+Histogram::Histogram(std::vector<double> bounds) : bounds_(std::move(bounds)) {
+  CHECK(std::is_sorted(bounds_.begin(), bounds_.end()));
+  for (Shard& shard : shards_) {
+    shard.counts =
+        std::make_unique<std::atomic<uint64_t>[]>(bounds_.size() + 1);
+  }
+}
+
+void Histogram::Observe(double value) {
+  size_t bucket = std::lower_bound(bounds_.begin(), bounds_.end(), value) -
+                  bounds_.begin();
+  Shard& shard = shards_[internal::GetMetricShardIndex()];
+  shard.counts[bucket].fetch_add(1, std::memory_order_relaxed);
+  AtomicAdd(shard.sum, value);
+}
+
+Histogram::Snapshot Histogram::GetSnapshot() const {
+  Snapshot snapshot;
+  snapshot.counts.resize(bounds_.size() + 1);
+  for (const Shard& shard : shards_) {
+    for (size_t i = 0; i < snapshot.counts.size(); ++i) {
+      snapshot.counts[i] += shard.counts[i].load(std::memory_order_relaxed);
+    }
+    snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+  }
+  for (uint64_t count : snapshot.counts) {
+    snapshot.count += count;
+  }
+  return snapshot;
+}
+
+// static
+MetricsRegistry& MetricsRegistry::GetInstance() {
+  // NOTE: It is never destroyed, like |NoDestructor|.
+  static MetricsRegistry* registry = CreateRegistry();
+  return *registry;
+}
+
+Counter* MetricsRegistry::GetCounter(std::string_view name,
+                                     std::string_view help,
+                                     const Labels& labels) {
+  absl::MutexLock lock(&lock_);
+  std::unique_ptr<Counter>& counter =
+      GetFamily(name, help, Type::kCounter).counters[FormatLabels(labels)];
+  if (!counter) counter = std::make_unique<Counter>();
+  return counter.get();
+}
+
+Gauge* MetricsRegistry::GetGauge(std::string_view name, std::string_view help,
+                                 const Labels& labels) {
+  absl::MutexLock lock(&lock_);
+  std::unique_ptr<Gauge>& gauge =
+      GetFamily(name, help, Type::kGauge).gauges[FormatLabels(labels)];
+  if (!gauge) gauge = std::make_unique<Gauge>();
+  return gauge.get();
+}
+
+Histogram* MetricsRegistry::GetHistogram(std::string_view name,
+                                         std::string_view help,
+                                         const Labels& labels,
+                                         std::vector<double> bounds) {
+  absl::MutexLock lock(&lock_);
+  std::unique_ptr<Histogram>& histogram =
+      GetFamily(name, help, Type::kHistogram).histograms[FormatLabels(labels)];
+  if (!histogram) histogram = std::make_unique<Histogram>(std::move(bounds));
+  return histogram.get();
+}
+
+void MetricsRegistry::AddCollector(RepeatingCallback<void()> collector) {
+  absl::MutexLock lock(&lock_);
+  collectors_.push_back(std::move(collector));
+}
+
+std::string MetricsRegistry::ToPrometheusText() {
+  // NOTE: The collectors are run without |lock_|, since they update the
+  // gauges through |GetGauge()|.
+  std::vector<RepeatingCallback<void()>> collectors;
+  {
+    absl::MutexLock lock(&lock_);
+    collectors = collectors_;
+  }
+  for (const RepeatingCallback<void()>& collector : collectors) {
+    collector.Run();
+  }
+
+  std::string text;
+  absl::MutexLock lock(&lock_);
+  for (const auto& [name, family] : families_) {
+    std::string_view type;
+    switch (family.type) {
+      case Type::kCounter:
+        type = "counter";
+        break;
+      case Type::kGauge:
+        type = "gauge";
+        break;
+      case Type::kHistogram:
+        type = "histogram";
+        break;
+    }
+    absl::StrAppend(&text, "# HELP ", name, " ", family.help, "\n");
+    absl::StrAppend(&text, "# TYPE ", name, " ", type, "\n");
+    for (const auto& [labels, counter] : family.counters) {
+      absl::StrAppend(&text, name, WithBraces(labels), " ", counter->value(),
+                      "\n");
+    }
+    for (const auto& [labels, gauge] : family.gauges) {
+      absl::StrAppend(&text, name, WithBraces(labels), " ", gauge->value(),
+                      "\n");
+    }
+    for (const auto& [labels, histogram] : family.histograms) {
+      Histogram::Snapshot snapshot = histogram->GetSnapshot();
+      uint64_t cumulative_count = 0;
+      for (size_t i = 0; i < histogram->bounds().size(); ++i) {
+        cumulative_count += snapshot.counts[i];
+        absl::StrAppend(
+            &text, name, "_bucket",
+            WithLabel(labels,
+                      absl::StrCat("le=\"", histogram->bounds()[i], "\"")),
+            " ", cumulative_count, "\n");
+      }
+      absl::StrAppend(&text, name, "_bucket", WithLabel(labels, "le=\"+Inf\""),
+                      " ", snapshot.count, "\n");
+      absl::StrAppend(&text, name, "_sum", WithBraces(labels), " ",
+                      snapshot.sum, "\n");
+      absl::StrAppend(&text, name, "_count", WithBraces(labels), " ",
+                      snapshot.count, "\n");
+    }
+  }
+  return text;
+}
+
+MetricsRegistry::Family& MetricsRegistry::GetFamily(std::string_view name,
+                                                    std::string_view help,
+                                                    Type type) {
+  auto it = families_.find(name);
+  if (it == families_.end()) {
+    it = families_.emplace(std::string(name), Family{type, std::string(help)})
+             .first;
+  }
+  CHECK(it->second.type == type) << "Metric of a different type: " << name;
+  return it->second;
+}
+
+ThroughputMetrics::Scope::Scope(const ThroughputMetrics* metrics,
+                                uint64_t num_items) {
+  if (!MetricsRegistry::IsEnabled()) return;
+  metrics_ = metrics;
+  num_items_ = num_items;
+  start_ = TimeTicks::Now();
+}
+
+ThroughputMetrics::Scope::~Scope() {
+  if (!metrics_) return;
+  metrics_->items_->Increment(num_items_);
+  metrics_->seconds_->Observe((TimeTicks::Now() - start_).InSecondsF());
+}
+
+ThroughputMetrics::ThroughputMetrics(std::string_view name,
+                                     std::string_view unit,
+                                     const MetricsRegistry::Labels& labels) {
+  MetricsRegistry& registry = MetricsRegistry::GetInstance();
+  items_ = registry.GetCounter(absl::StrCat(name, "_", unit, "_total"),
+                               absl::StrCat("The number of the ", unit, "."),
+                               labels);
+  seconds_ = registry.GetHistogram(absl::StrCat(name, "_seconds"),
+                                   "The time spent in seconds.", labels);
+}
+
+}  // namespace tachyon::base
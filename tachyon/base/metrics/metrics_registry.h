@@ -0,0 +1,251 @@
+#ifndef TACHYON_BASE_METRICS_METRICS_REGISTRY_H_
+#define TACHYON_BASE_METRICS_METRICS_REGISTRY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+#include "tachyon/base/functional/callback.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+namespace internal {
+
+// The metrics are split into as many shards, each on its own cache line, and
+// each thread updates the shard of its own. So the threads updating the same
+// metric neither lock nor bounce a cache line between each other, as long as
+// there are not more threads than the shards.
+constexpr size_t kNumMetricShards = 32;
+constexpr size_t kMetricShardAlignment = 64;
+
+// Returns the index of the shard of the calling thread.
+TACHYON_EXPORT size_t GetMetricShardIndex();
+
+}  // namespace internal
+
+// |Counter| is a monotonically increasing count, e.g., the number of the
+// proofs. It is exported as a Prometheus counter.
+class TACHYON_EXPORT Counter {
+ public:
+  Counter() = default;
+  Counter(const Counter& other) = delete;
+  Counter& operator=(const Counter& other) = delete;
+
+  void Increment(uint64_t value = 1) {
+    shards_[internal::GetMetricShardIndex()].value.fetch_add(
+        value, std::memory_order_relaxed);
+  }
+
+  uint64_t value() const;
+
+ private:
+  struct alignas(internal::kMetricShardAlignment) Shard {
+    std::atomic<uint64_t> value{0};
+  };
+
+  std::array<Shard, internal::kNumMetricShards> shards_;
+};
+
+// |Gauge| is a value that goes up and down, e.g., the bytes of the GPU memory
+// in use. It is exported as a Prometheus gauge.
+class TACHYON_EXPORT Gauge {
+ public:
+  Gauge() = default;
+  Gauge(const Gauge& other) = delete;
+  Gauge& operator=(const Gauge& other) = delete;
+
+  double value() const { return value_.load(std::memory_order_relaxed); }
+
+  void Set(double value) { value_.store(value, std::memory_order_relaxed); }
+  void Add(double value);
+
+ private:
+  std::atomic<double> value_{0};
+};
+
+// |Histogram| counts the observed values, e.g., the latencies of the proofs,
+// into the buckets of |bounds()|, along with their sum. It is exported as a
+// Prometheus histogram.
+class TACHYON_EXPORT Histogram {
+ public:
+  struct Snapshot {
+    // |counts[i]| is the number of the values in (|bounds[i - 1]|,
+    // |bounds[i]|], where the last one holds the values greater than the last
+    // bound.
+    std::vector<uint64_t> counts;
+    uint64_t count = 0;
+    double sum = 0;
+  };
+
+  // Returns the bounds from 1ms to about 1.1h, each of which is 4 times the
+  // previous one.
+  static std::vector<double> GetDefaultSecondsBounds();
+
+  // |bounds| must be sorted in ascending order.
+  explicit Histogram(std::vector<double> bounds);
+  Histogram(const Histogram& other) = delete;
+  Histogram& operator=(const Histogram& other) = delete;
+
+  const std::vector<double>& bounds() const { return bounds_; }
+
+  void Observe(double value);
+
+  Snapshot GetSnapshot() const;
+
+ private:
+  struct alignas(internal::kMetricShardAlignment) Shard {
+    std::unique_ptr<std::atomic<uint64_t>[]> counts;
+    std::atomic<double> sum{0};
+  };
+
+  std::vector<double> bounds_;
+  std::array<Shard, internal::kNumMetricShards> shards_;
+};
+
+// |MetricsRegistry| holds the metrics of the process to be scraped by a
+// monitoring system, e.g., the proofs per second, the latency of each phase of
+// the provers and the throughput of the MSMs and the FFTs. A metric is
+// identified by its name and labels, and lives as long as the registry, so
+// the pointer returned by |GetCounter()| and the like can be kept to update it
+// without looking it up again.
+//
+// The instrumented code records the metrics only if |IsEnabled()|, which is
+// false unless $TACHYON_METRICS is set to 1 or |set_enabled()| is called.
+//
+// Example:
+//
+//   tachyon::base::Counter* proofs =
+//       tachyon::base::MetricsRegistry::GetInstance().GetCounter(
+//           "tachyon_prover_proofs_total", "The number of the proofs.",
+//           {{"prover", "halo2"}});
+//   proofs->Increment();
+//   std::cout << tachyon::base::MetricsRegistry::GetInstance()
+//                    .ToPrometheusText();
+class TACHYON_EXPORT MetricsRegistry {
+ public:
+  using Labels = std::vector<std::pair<std::string, std::string>>;
+
+  static MetricsRegistry& GetInstance();
+
+  static bool IsEnabled() {
+    return GetInstance().enabled_.load(std::memory_order_relaxed);
+  }
+
+  MetricsRegistry() = default;
+  MetricsRegistry(const MetricsRegistry& other) = delete;
+  MetricsRegistry& operator=(const MetricsRegistry& other) = delete;
+
+  void set_enabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  // Returns the metric of |name| and |labels|, which is created on the first
+  // call. |help| is taken from the first call of |name|. It crashes if |name|
+  // is of a different type.
+  Counter* GetCounter(std::string_view name, std::string_view help,
+                      const Labels& labels = {});
+  Gauge* GetGauge(std::string_view name, std::string_view help,
+                  const Labels& labels = {});
+  // |bounds| is taken from the first call of |name| and |labels|.
+  Histogram* GetHistogram(
+      std::string_view name, std::string_view help, const Labels& labels = {},
+      std::vector<double> bounds = Histogram::GetDefaultSecondsBounds());
+
+  // Adds |collector|, which is run whenever the metrics are exported, to
+  // sample the gauges that aren't updated by the instrumented code, e.g., the
+  // usage of the GPU memory pools.
+  void AddCollector(RepeatingCallback<void()> collector);
+
+  // Returns the metrics in the Prometheus text exposition format, sorted by
+  // their names and labels.
+  std::string ToPrometheusText();
+
+ private:
+  enum class Type {
+    kCounter,
+    kGauge,
+    kHistogram,
+  };
+
+  struct Family {
+    Type type;
+    std::string help;
+    // The keys are the labels formatted as |FormatLabels()|.
+    std::map<std::string, std::unique_ptr<Counter>> counters;
+    std::map<std::string, std::unique_ptr<Gauge>> gauges;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms;
+  };
+
+  Family& GetFamily(std::string_view name, std::string_view help, Type type)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  std::atomic<bool> enabled_{false};
+  absl::Mutex lock_;
+  std::map<std::string, Family, std::less<>> families_ ABSL_GUARDED_BY(lock_);
+  std::vector<RepeatingCallback<void()>> collectors_ ABSL_GUARDED_BY(lock_);
+};
+
+// |ThroughputMetrics| records the items processed by an operation, e.g., the
+// points of the MSMs, along with the time spent on it, as
+// <name>_<unit>_total and <name>_seconds. So the throughput is given by
+// rate(<name>_<unit>_total) / rate(<name>_seconds_sum).
+//
+// Example:
+//
+//   static const tachyon::base::ThroughputMetrics metrics("tachyon_msm",
+//                                                         "points");
+//   tachyon::base::ThroughputMetrics::Scope scope = metrics.Measure(size);
+class TACHYON_EXPORT ThroughputMetrics {
+ public:
+  // Records |num_items| and the time from its construction to its destruction
+  // if the metrics are enabled at its construction.
+  class TACHYON_EXPORT Scope {
+   public:
+    Scope(const Scope& other) = delete;
+    Scope& operator=(const Scope& other) = delete;
+    ~Scope();
+
+   private:
+    friend class ThroughputMetrics;
+
+    Scope(const ThroughputMetrics* metrics, uint64_t num_items);
+
+    // not owned
+    const ThroughputMetrics* metrics_ = nullptr;
+    uint64_t num_items_ = 0;
+    TimeTicks start_;
+  };
+
+  ThroughputMetrics(std::string_view name, std::string_view unit,
+                    const MetricsRegistry::Labels& labels = {});
+  ThroughputMetrics(const ThroughputMetrics& other) = delete;
+  ThroughputMetrics& operator=(const ThroughputMetrics& other) = delete;
+
+  [[nodiscard]] Scope Measure(uint64_t num_items) const {
+    return Scope(this, num_items);
+  }
+
+ private:
+  // not owned
+  Counter* items_ = nullptr;
+  // not owned
+  Histogram* seconds_ = nullptr;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_METRICS_METRICS_REGISTRY_H_
@@ -0,0 +1,98 @@
+#include "tachyon/base/metrics/metrics_registry.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(MetricsRegistryTest, Counter) {
+  MetricsRegistry registry;
+  Counter* counter = registry.GetCounter("counter", "help");
+  EXPECT_EQ(counter, registry.GetCounter("counter", "help"));
+  EXPECT_NE(counter, registry.GetCounter("counter", "help", {{"a", "1"}}));
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 4; ++i) {
+    threads.emplace_back([counter]() {
+      for (size_t j = 0; j < 1000; ++j) {
+        counter->Increment();
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter->value(), uint64_t{4000});
+}
+
+TEST(MetricsRegistryTest, Gauge) {
+  MetricsRegistry registry;
+  Gauge* gauge = registry.GetGauge("gauge", "help");
+  gauge->Set(3);
+  gauge->Add(-1.5);
+  EXPECT_EQ(gauge->value(), 1.5);
+}
+
+TEST(MetricsRegistryTest, Histogram) {
+  MetricsRegistry registry;
+  Histogram* histogram =
+      registry.GetHistogram("histogram", "help", {}, {1, 2, 4});
+  for (double value : {0.5, 1.0, 3.0, 3.5, 10.0}) {
+    histogram->Observe(value);
+  }
+  Histogram::Snapshot snapshot = histogram->GetSnapshot();
+  EXPECT_EQ(snapshot.counts, (std::vector<uint64_t>{2, 0, 2, 1}));
+  EXPECT_EQ(snapshot.count, uint64_t{5});
+  EXPECT_EQ(snapshot.sum, 18.0);
+}
+
+TEST(MetricsRegistryTest, ToPrometheusText) {
+  MetricsRegistry registry;
+  registry.GetCounter("proofs_total", "The number of the proofs.",
+                      {{"prover", "halo2"}})
+      ->Increment(3);
+  Gauge* gauge = registry.GetGauge("used_bytes", "The bytes in use.",
+                                   {{"device", "0"}, {"name", "a\"b"}});
+  size_t num_collections = 0;
+  registry.AddCollector(
+      [&num_collections, gauge]() { gauge->Set(++num_collections); });
+  registry.GetHistogram("seconds", "The time spent.", {}, {1, 2})
+      ->Observe(1.5);
+
+  EXPECT_EQ(registry.ToPrometheusText(),
+            "# HELP proofs_total The number of the proofs.\n"
+            "# TYPE proofs_total counter\n"
+            "proofs_total{prover=\"halo2\"} 3\n"
+            "# HELP seconds The time spent.\n"
+            "# TYPE seconds histogram\n"
+            "seconds_bucket{le=\"1\"} 0\n"
+            "seconds_bucket{le=\"2\"} 1\n"
+            "seconds_bucket{le=\"+Inf\"} 1\n"
+            "seconds_sum 1.5\n"
+            "seconds_count 1\n"
+            "# HELP used_bytes The bytes in use.\n"
+            "# TYPE used_bytes gauge\n"
+            "used_bytes{device=\"0\",name=\"a\\\"b\"} 1\n");
+  EXPECT_EQ(num_collections, size_t{1});
+}
+
+TEST(MetricsRegistryTest, ThroughputMetrics) {
+  MetricsRegistry& registry = MetricsRegistry::GetInstance();
+  ThroughputMetrics metrics("test_op", "items");
+  Counter* items = registry.GetCounter("test_op_items_total", "");
+  Histogram* seconds = registry.GetHistogram("test_op_seconds", "");
+
+  registry.set_enabled(false);
+  { ThroughputMetrics::Scope scope = metrics.Measure(10); }
+  EXPECT_EQ(items->value(), uint64_t{0});
+
+  registry.set_enabled(true);
+  { ThroughputMetrics::Scope scope = metrics.Measure(10); }
+  registry.set_enabled(false);
+  EXPECT_EQ(items->value(), uint64_t{10});
+  EXPECT_EQ(seconds->GetSnapshot().count, uint64_t{1});
+}
+
+}  // namespace tachyon::base
@@ -9,8 +9,25 @@
 
 #include "tachyon/base/functional/functor_traits.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/base/threading/thread_pool.h"
 
 namespace tachyon::base {
+namespace internal {
+
+// Same as |GetNumElementsPerThread()|, but splits |container| over the
+// threads of |ThreadPool::GetCurrent()|, which every |Parallelize*()|
+// dispatches to.
+template <typename Container>
+size_t GetNumElementsPerTask(const Container& container,
+                             std::optional<size_t> threshold) {
+  size_t thread_nums = ThreadPool::GetCurrent().num_threads();
+  size_t size = std::size(container);
+  return (!threshold.has_value() || size > threshold.value())
+             ? (size + thread_nums - 1) / thread_nums
+             : size;
+}
+
+}  // namespace internal
 
 template <typename T>
 using ParallelizeCallback1 = std::function<void(absl::Span<T>)>;
@@ -32,7 +49,8 @@ void ParallelizeByChunkSize(Container& container, size_t chunk_size,
                             Callable callback) {
   if (chunk_size == 0) return;
   size_t num_chunks = (std::size(container) + chunk_size - 1) / chunk_size;
-  OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+  ParallelFor(0, num_chunks, [&container, chunk_size, num_chunks,
+                              &callback](size_t i) {
     size_t len = i == num_chunks - 1 ? std::size(container) - i * chunk_size
                                      : chunk_size;
     SpanTy chunk(std::data(container) + i * chunk_size, len);
@@ -44,7 +62,7 @@ void ParallelizeByChunkSize(Container& container, size_t chunk_size,
       static_assert(ArgNum == 3);
       callback(chunk, i, chunk_size);
     }
-  }
+  });
 }
 
 // Splits the |container| into threads and executes |callback| in parallel.
@@ -53,7 +71,7 @@ template <typename Container, typename Callable>
 void Parallelize(Container& container, Callable callback,
                  std::optional<size_t> threshold = std::nullopt) {
   size_t num_elements_per_thread =
-      GetNumElementsPerThread(container, threshold);
+      internal::GetNumElementsPerTask(container, threshold);
   ParallelizeByChunkSize(container, num_elements_per_thread,
                          std::move(callback));
 }
@@ -76,7 +94,8 @@ std::vector<ReturnType> ParallelizeMapByChunkSize(Container& container,
   if (chunk_size == 0) return {};
   size_t num_chunks = (std::size(container) + chunk_size - 1) / chunk_size;
   std::vector<ReturnType> values(num_chunks);
-  OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+  ParallelFor(0, num_chunks, [&container, chunk_size, num_chunks, &callback,
+                              &values](size_t i) {
     size_t len = i == num_chunks - 1 ? std::size(container) - i * chunk_size
                                      : chunk_size;
     SpanTy chunk(std::data(container) + i * chunk_size, len);
@@ -88,7 +107,7 @@ std::vector<ReturnType> ParallelizeMapByChunkSize(Container& container,
       static_assert(ArgNum == 3);
       values[i] = callback(chunk, i, chunk_size);
     }
-  }
+  });
   return values;
 }
 
@@ -100,11 +119,44 @@ template <typename Container, typename Callable>
 auto ParallelizeMap(Container& container, Callable callback,
                     std::optional<size_t> threshold = std::nullopt) {
   size_t num_elements_per_thread =
-      GetNumElementsPerThread(container, threshold);
+      internal::GetNumElementsPerTask(container, threshold);
   return ParallelizeMapByChunkSize(container, num_elements_per_thread,
                                    std::move(callback));
 }
 
+// Replaces each element of |values| with the result of folding |op| over the
+// elements up to and including it, i.e, values[i] = values[0] op ... op
+// values[i]. |op| must be associative. Each thread scans its own chunk first,
+// then the totals of the chunks are scanned and every chunk but the first is
+// combined with the total of the chunks before it.
+// See parallelize_unittest.cc for more details.
+template <typename T, typename BinaryOp>
+void ParallelizeInclusiveScan(absl::Span<T> values, BinaryOp op,
+                              std::optional<size_t> threshold = std::nullopt) {
+  if (values.empty()) return;
+  size_t chunk_size = internal::GetNumElementsPerTask(values, threshold);
+  std::vector<T> totals = ParallelizeMapByChunkSize(
+      values, chunk_size, [&op](absl::Span<T> chunk) {
+        for (size_t i = 1; i < chunk.size(); ++i) {
+          chunk[i] = op(chunk[i - 1], chunk[i]);
+        }
+        return chunk.back();
+      });
+  if (totals.size() == 1) return;
+  for (size_t i = 1; i < totals.size(); ++i) {
+    totals[i] = op(totals[i - 1], totals[i]);
+  }
+  ParallelizeByChunkSize(
+      values, chunk_size,
+      [&op, &totals](absl::Span<T> chunk, size_t chunk_idx) {
+        if (chunk_idx == 0) return;
+        const T& prefix = totals[chunk_idx - 1];
+        for (T& value : chunk) {
+          value = op(prefix, value);
+        }
+      });
+}
+
 }  // namespace tachyon::base
 
 #endif  // TACHYON_BASE_PARALLELIZE_H_
@@ -2,6 +2,8 @@
 
 #include <functional>
 #include <numeric>
+#include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -101,4 +103,25 @@ TEST(ParallelizeTest, ParallelizeMap) {
             15);
 }
 
+TEST(ParallelizeTest, ParallelizeInclusiveScan) {
+  std::vector<int> test_in(1000);
+  std::iota(test_in.begin(), test_in.end(), 0);
+
+  std::vector<int> expected(test_in.size());
+  std::partial_sum(test_in.begin(), test_in.end(), expected.begin());
+  std::vector<int> values = test_in;
+  ParallelizeInclusiveScan(absl::MakeSpan(values), std::plus<int>());
+  EXPECT_EQ(values, expected);
+
+  // Unlike addition, the order of the operands of concatenation matters.
+  std::vector<std::string> strings(100);
+  for (size_t i = 0; i < strings.size(); ++i) {
+    strings[i] = std::string(1, static_cast<char>('a' + i % 26));
+  }
+  std::vector<std::string> expected_strings(strings.size());
+  std::partial_sum(strings.begin(), strings.end(), expected_strings.begin());
+  ParallelizeInclusiveScan(absl::MakeSpan(strings), std::plus<std::string>());
+  EXPECT_EQ(strings, expected_strings);
+}
+
 }  // namespace tachyon::base
@@ -0,0 +1,60 @@
+#ifndef TACHYON_BASE_SORT_H_
+#define TACHYON_BASE_SORT_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "third_party/pdqsort/include/pdqsort.h"
+
+#include "tachyon/base/openmp_util.h"
+
+namespace tachyon::base {
+
+// Ranges smaller than this are sorted by a single |pdqsort()| call.
+constexpr size_t kParallelSortThreshold = size_t{1} << 14;
+
+// Sorts [|begin|, |end|) with |comp| like |pdqsort()|, but in parallel: the
+// range is split into a chunk per thread that is sorted by |pdqsort()|, and
+// then the sorted chunks are merged pairwise in parallel. Like |pdqsort()|,
+// the order of the equivalent elements is not preserved and it can differ
+// from the one of |pdqsort()|.
+template <typename Iterator, typename Compare = std::less<>>
+void ParallelSort(Iterator begin, Iterator end, Compare comp = Compare(),
+                  size_t threshold = kParallelSortThreshold) {
+  size_t size = static_cast<size_t>(std::distance(begin, end));
+#if defined(TACHYON_HAS_OPENMP)
+  size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+  size_t thread_nums = 1;
+#endif
+  if (thread_nums == 1 || size <= threshold) {
+    pdqsort(begin, end, comp);
+    return;
+  }
+
+  size_t chunk_size = (size + thread_nums - 1) / thread_nums;
+  size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+    size_t start = i * chunk_size;
+    pdqsort(begin + start, begin + std::min(start + chunk_size, size), comp);
+  }
+
+  // Merge the sorted runs of |width| pairwise until a single run is left.
+  for (size_t width = chunk_size; width < size; width *= 2) {
+    size_t num_pairs = (size + 2 * width - 1) / (2 * width);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_pairs; ++i) {
+      size_t start = 2 * i * width;
+      size_t middle = std::min(start + width, size);
+      size_t last = std::min(start + 2 * width, size);
+      if (middle == last) continue;
+      std::inplace_merge(begin + start, begin + middle, begin + last, comp);
+    }
+  }
+}
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_SORT_H_
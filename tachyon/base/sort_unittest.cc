@@ -0,0 +1,34 @@
+#include "tachyon/base/sort.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+
+namespace tachyon::base {
+
+TEST(SortTest, ParallelSort) {
+  for (size_t size : {0, 1, 7, 1000, 1023}) {
+    SCOPED_TRACE(size);
+    std::vector<int> values =
+        CreateVector(size, []() { return Uniform(Range<int>(0, 100)); });
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+    std::vector<int> expected_desc = expected;
+    std::reverse(expected_desc.begin(), expected_desc.end());
+
+    // A threshold of 0 forces the parallel path even for the small sizes.
+    std::vector<int> sorted = values;
+    ParallelSort(sorted.begin(), sorted.end(), std::less<>(), 0);
+    EXPECT_EQ(sorted, expected);
+
+    sorted = values;
+    ParallelSort(sorted.begin(), sorted.end(), std::greater<>(), 0);
+    EXPECT_EQ(sorted, expected_desc);
+  }
+}
+
+}  // namespace tachyon::base
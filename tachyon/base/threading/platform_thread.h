@@ -14,6 +14,7 @@
 #include <iosfwd>
 #include <type_traits>
 #include <optional>
+#include <vector>
 
 #include "tachyon/export.h"
 #include "tachyon/base/message_loop/message_pump_type.h"
@@ -257,6 +258,10 @@ class TACHYON_EXPORT PlatformThreadBase {
   // underlying priority successfully changed or not.
   static ThreadType GetCurrentThreadType();
 
+  // Pins the current thread to `cpus`. Returns false if the platform doesn't
+  // support it or `cpus` is empty.
+  static bool SetCurrentThreadAffinity(const std::vector<size_t>& cpus);
+
   // Returns a realtime period provided by `delegate`.
   static TimeDelta GetRealtimePeriod(Delegate* delegate);
 
@@ -421,6 +421,27 @@ void PlatformThreadBase::SetName(const std::string& name) {
 #endif  //  !BUILDFLAG(IS_NACL) && !BUILDFLAG(IS_AIX)
 }
 
+// static
+bool PlatformThreadBase::SetCurrentThreadAffinity(
+    const std::vector<size_t>& cpus) {
+#if !BUILDFLAG(IS_NACL)
+  if (cpus.empty()) return false;
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (size_t cpu : cpus) {
+    if (cpu >= CPU_SETSIZE) return false;
+    CPU_SET(cpu, &cpu_set);
+  }
+  if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+    DPLOG(ERROR) << "sched_setaffinity()";
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif  // !BUILDFLAG(IS_NACL)
+}
+
 #if !BUILDFLAG(IS_NACL)
 // static
 void PlatformThread::SetThreadTypeDelegate(ThreadTypeDelegate* delegate) {
@@ -85,6 +85,14 @@ void PlatformThreadBase::SetName(const std::string& name) {
   pthread_setname_np(shortened_name.c_str());
 }
 
+// static
+bool PlatformThreadBase::SetCurrentThreadAffinity(
+    const std::vector<size_t>& cpus) {
+  // macOS only takes affinity tags as hints, which can't pin a thread to the
+  // given CPUs.
+  return false;
+}
+
 /*
 TODO(chokobole):
 // Whether optimized realt-time thread config should be used for audio.
@@ -0,0 +1,227 @@
+#include "tachyon/base/threading/thread_pool.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include "tachyon/base/memory/numa.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/threading/platform_thread.h"
+
+namespace tachyon::base {
+
+namespace {
+
+thread_local ThreadPool* g_current_pool = nullptr;
+thread_local size_t g_current_worker_index = 0;
+// The pool bound by |ScopedThreadPool|.
+thread_local ThreadPool* g_scoped_pool = nullptr;
+
+std::atomic<ThreadAffinity> g_default_affinity = ThreadAffinity::kNone;
+
+size_t GetDefaultNumThreads() {
+#if defined(TACHYON_HAS_OPENMP)
+  return static_cast<size_t>(omp_get_max_threads());
+#else
+  return std::max(size_t{std::thread::hardware_concurrency()}, size_t{1});
+#endif
+}
+
+// Returns the CPUs in the order the threads are pinned to them.
+std::vector<size_t> GetAffinityCpus(ThreadAffinity affinity) {
+  std::vector<std::vector<size_t>> node_cpus;
+  size_t max_node_size = 0;
+  for (size_t i = 0; i < GetNumaNodeCount(); ++i) {
+    std::vector<size_t> cpus = GetNumaNodeCpus(i);
+    if (cpus.empty()) continue;
+    max_node_size = std::max(max_node_size, cpus.size());
+    node_cpus.push_back(std::move(cpus));
+  }
+  if (node_cpus.empty()) {
+    std::vector<size_t> cpus(std::thread::hardware_concurrency());
+    std::iota(cpus.begin(), cpus.end(), 0);
+    return cpus;
+  }
+
+  std::vector<size_t> ret;
+  if (affinity == ThreadAffinity::kCompact) {
+    for (const std::vector<size_t>& cpus : node_cpus) {
+      ret.insert(ret.end(), cpus.begin(), cpus.end());
+    }
+  } else {
+    for (size_t i = 0; i < max_node_size; ++i) {
+      for (const std::vector<size_t>& cpus : node_cpus) {
+        if (i < cpus.size()) ret.push_back(cpus[i]);
+      }
+    }
+  }
+  return ret;
+}
+
+}  // namespace
+
+ThreadPool::ThreadPool(size_t num_workers, ThreadAffinity affinity) {
+  std::vector<size_t> cpus;
+  if (affinity != ThreadAffinity::kNone) cpus = GetAffinityCpus(affinity);
+  workers_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+    if (!cpus.empty()) workers_[i]->cpu = cpus[(i + 1) % cpus.size()];
+  }
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers_[i]->thread = std::thread(&ThreadPool::RunWorker, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopped_ = true;
+  }
+  sleep_cv_.notify_all();
+  for (std::unique_ptr<Worker>& worker : workers_) {
+    worker->thread.join();
+  }
+}
+
+// static
+ThreadPool& ThreadPool::GetDefault() {
+  static NoDestructor<ThreadPool> pool(
+      GetDefaultNumThreads() - 1,
+      g_default_affinity.load(std::memory_order_relaxed));
+  return *pool;
+}
+
+// static
+ThreadPool& ThreadPool::GetCurrent() {
+  if (g_scoped_pool) return *g_scoped_pool;
+  if (g_current_pool) return *g_current_pool;
+  return GetDefault();
+}
+
+// static
+void ThreadPool::SetDefaultAffinity(ThreadAffinity affinity) {
+  g_default_affinity.store(affinity, std::memory_order_relaxed);
+}
+
+void ThreadPool::PostTask(Task task) {
+  std::optional<size_t> worker_index = GetCurrentWorkerIndex();
+  if (worker_index.has_value()) {
+    Worker& worker = *workers_[*worker_index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.push_back(std::move(task));
+  } else {
+    std::lock_guard<std::mutex> lock(shared_mutex_);
+    shared_tasks_.push_back(std::move(task));
+  }
+  num_pending_tasks_.fetch_add(1, std::memory_order_release);
+  // NOTE: Locking |sleep_mutex_| makes sure that a worker which has just
+  // seen no pending tasks is already waiting on |sleep_cv_|.
+  { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+  sleep_cv_.notify_one();
+}
+
+bool ThreadPool::RunPendingTask() {
+  std::optional<Task> task = PopTask(GetCurrentWorkerIndex());
+  if (!task.has_value()) return false;
+  std::move(*task)();
+  return true;
+}
+
+void ThreadPool::RunWorker(size_t index) {
+  g_current_pool = this;
+  g_current_worker_index = index;
+  if (workers_[index]->cpu.has_value()) {
+    PlatformThread::SetCurrentThreadAffinity({*workers_[index]->cpu});
+  }
+#if defined(TACHYON_HAS_OPENMP)
+  // The OpenMP regions inside the tasks are run by this thread alone, since
+  // the other threads of the pool are busy with the other tasks.
+  omp_set_num_threads(1);
+#endif
+  while (true) {
+    std::optional<Task> task = PopTask(index);
+    if (task.has_value()) {
+      std::move(*task)();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    if (stopped_) return;
+    sleep_cv_.wait(lock, [this]() {
+      return stopped_ ||
+             num_pending_tasks_.load(std::memory_order_acquire) > 0;
+    });
+  }
+}
+
+std::optional<size_t> ThreadPool::GetCurrentWorkerIndex() const {
+  if (g_current_pool != this) return std::nullopt;
+  return g_current_worker_index;
+}
+
+std::optional<ThreadPool::Task> ThreadPool::PopTask(
+    std::optional<size_t> worker_index) {
+  if (num_pending_tasks_.load(std::memory_order_acquire) == 0) {
+    return std::nullopt;
+  }
+  if (worker_index.has_value()) {
+    Worker& worker = *workers_[*worker_index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      Task task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+      num_pending_tasks_.fetch_sub(1, std::memory_order_relaxed);
+      return task;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(shared_mutex_);
+    if (!shared_tasks_.empty()) {
+      Task task = std::move(shared_tasks_.front());
+      shared_tasks_.pop_front();
+      num_pending_tasks_.fetch_sub(1, std::memory_order_relaxed);
+      return task;
+    }
+  }
+  return StealTask(worker_index.has_value() ? *worker_index + 1 : 0);
+}
+
+std::optional<ThreadPool::Task> ThreadPool::StealTask(size_t start) {
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    Worker& worker = *workers_[(start + i) % workers_.size()];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      Task task = std::move(worker.tasks.front());
+      worker.tasks.pop_front();
+      num_pending_tasks_.fetch_sub(1, std::memory_order_relaxed);
+      return task;
+    }
+  }
+  return std::nullopt;
+}
+
+ScopedThreadPool::ScopedThreadPool(ThreadPool* pool) : pool_(pool) {
+  if (!pool_) return;
+  previous_pool_ = std::exchange(g_scoped_pool, pool_);
+#if defined(TACHYON_HAS_OPENMP)
+  previous_omp_num_threads_ = omp_get_max_threads();
+  omp_set_num_threads(static_cast<int>(pool_->num_threads()));
+#endif
+}
+
+ScopedThreadPool::~ScopedThreadPool() {
+  if (!pool_) return;
+  g_scoped_pool = previous_pool_;
+#if defined(TACHYON_HAS_OPENMP)
+  omp_set_num_threads(previous_omp_num_threads_);
+#endif
+}
+
+void TaskGroup::Wait() {
+  while (num_pending_tasks_.load(std::memory_order_acquire) > 0) {
+    if (!pool_.RunPendingTask()) std::this_thread::yield();
+  }
+}
+
+}  // namespace tachyon::base
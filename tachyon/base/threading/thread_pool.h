@@ -0,0 +1,208 @@
+#ifndef TACHYON_BASE_THREADING_THREAD_POOL_H_
+#define TACHYON_BASE_THREADING_THREAD_POOL_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// Which CPUs the workers of |ThreadPool| are pinned to.
+enum class ThreadAffinity {
+  // The workers are left to the scheduler.
+  kNone,
+  // The workers fill up the CPUs of a NUMA node before moving to the next
+  // node, so that the neighboring tasks share the caches and the memory.
+  kCompact,
+  // The workers are assigned to the NUMA nodes in a round-robin manner, so
+  // that every node contributes its memory bandwidth.
+  kSpread,
+};
+
+// |ThreadPool| runs tasks on worker threads, each of which owns a deque of
+// tasks. A worker pops the tasks it posted itself from the back of its deque
+// and, once it runs out of them, steals from the front of the others. The
+// tasks posted from the other threads go to a shared queue.
+//
+// A thread waiting for a |TaskGroup| runs the pending tasks instead of
+// blocking. So the nested parallel regions, e.g., an FFT inside a per-column
+// loop, are split over the same threads rather than oversubscribing the cores
+// or being serialized, and the independent prover stages running on
+// different threads can share |GetDefault()|.
+class TACHYON_EXPORT ThreadPool {
+ public:
+  using Task = absl::AnyInvocable<void() &&>;
+
+  // Creates a pool with |num_workers| worker threads. The thread waiting for
+  // the tasks works as well, so |num_threads()| is |num_workers| + 1.
+  // NOTE: The first CPU in the order of |affinity| is left to the thread
+  // creating the pool, which is not pinned.
+  explicit ThreadPool(size_t num_workers,
+                      ThreadAffinity affinity = ThreadAffinity::kNone);
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+  ~ThreadPool();
+
+  // Returns the pool shared by the whole process. It has as many threads as
+  // OpenMP would use if OpenMP is enabled, or as the hardware supports
+  // otherwise.
+  static ThreadPool& GetDefault();
+
+  // Returns the pool that the parallel regions of the calling thread are run
+  // on, i.e., the pool bound by |ScopedThreadPool| if any, the pool that the
+  // calling thread works for if any, or |GetDefault()| otherwise.
+  static ThreadPool& GetCurrent();
+
+  // Sets the affinity of |GetDefault()|. It has no effect once |GetDefault()|
+  // is called.
+  static void SetDefaultAffinity(ThreadAffinity affinity);
+
+  size_t num_threads() const { return workers_.size() + 1; }
+
+  void PostTask(Task task);
+
+  // Runs a pending task on the calling thread. Returns false if there was
+  // none.
+  bool RunPendingTask();
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    std::thread thread;
+    std::optional<size_t> cpu;
+  };
+
+  void RunWorker(size_t index);
+
+  // Returns the worker index of the calling thread if it is a worker of this
+  // pool.
+  std::optional<size_t> GetCurrentWorkerIndex() const;
+
+  std::optional<Task> PopTask(std::optional<size_t> worker_index);
+  std::optional<Task> StealTask(size_t start);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  std::mutex shared_mutex_;
+  std::deque<Task> shared_tasks_;
+
+  // The number of tasks that are posted but not popped yet.
+  std::atomic<size_t> num_pending_tasks_ = 0;
+
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  bool stopped_ = false;
+};
+
+// |ScopedThreadPool| binds |pool| to the calling thread while it is alive, so
+// that the parallel regions of the calling thread, including the OpenMP ones,
+// use as many threads as |pool| has. So the provers running on different
+// threads, each with its own pool, split the cores instead of oversubscribing
+// them. A pool may be shared by several threads as well.
+//
+//   ThreadPool pool(23);
+//   ScopedThreadPool scoped_pool(&pool);
+//   prover.CreateProof(...);
+//
+// NOTE: A nullptr |pool| leaves the binding as it is.
+class TACHYON_EXPORT ScopedThreadPool {
+ public:
+  explicit ScopedThreadPool(ThreadPool* pool);
+  ScopedThreadPool(const ScopedThreadPool& other) = delete;
+  ScopedThreadPool& operator=(const ScopedThreadPool& other) = delete;
+  ~ScopedThreadPool();
+
+ private:
+  ThreadPool* pool_;
+  ThreadPool* previous_pool_ = nullptr;
+  int previous_omp_num_threads_ = 0;
+};
+
+// |TaskGroup| runs tasks on |ThreadPool| and waits for all of them.
+// NOTE: The tasks may be run on the thread calling |Wait()|.
+class TACHYON_EXPORT TaskGroup {
+ public:
+  explicit TaskGroup(ThreadPool& pool = ThreadPool::GetCurrent())
+      : pool_(pool) {}
+  TaskGroup(const TaskGroup& other) = delete;
+  TaskGroup& operator=(const TaskGroup& other) = delete;
+  ~TaskGroup() { Wait(); }
+
+  template <typename Callable>
+  void Run(Callable&& callable) {
+    num_pending_tasks_.fetch_add(1, std::memory_order_relaxed);
+    pool_.PostTask(
+        [this, callable = std::forward<Callable>(callable)]() mutable {
+          callable();
+          num_pending_tasks_.fetch_sub(1, std::memory_order_release);
+        });
+  }
+
+  // Waits until every task run by this group is done, running the pending
+  // tasks of |pool_| meanwhile.
+  void Wait();
+
+ private:
+  ThreadPool& pool_;
+  std::atomic<size_t> num_pending_tasks_ = 0;
+};
+
+namespace internal {
+
+template <typename Callable>
+void SplitRange(TaskGroup& group, size_t begin, size_t end, size_t grain_size,
+                Callable& callable) {
+  // The upper halves are left to be stolen, while the lower half is split
+  // further on this thread.
+  while (end - begin > grain_size) {
+    size_t mid = begin + (end - begin) / 2;
+    group.Run([&group, mid, end, grain_size, &callable]() {
+      SplitRange(group, mid, end, grain_size, callable);
+    });
+    end = mid;
+  }
+  for (size_t i = begin; i < end; ++i) {
+    callable(i);
+  }
+}
+
+}  // namespace internal
+
+// Calls |callable(i)| for every i in [|begin|, |end|) in parallel, where the
+// range is split in halves until at most |grain_size| indices are left.
+template <typename Callable>
+void ParallelFor(size_t begin, size_t end, Callable&& callable,
+                 size_t grain_size = 1,
+                 ThreadPool& pool = ThreadPool::GetCurrent()) {
+  if (begin >= end) return;
+  if (grain_size == 0) grain_size = 1;
+  TaskGroup group(pool);
+  internal::SplitRange(group, begin, end, grain_size, callable);
+  group.Wait();
+}
+
+// Calls every one of |callables| in parallel.
+template <typename Callable, typename... Callables>
+void ParallelInvoke(Callable&& callable, Callables&&... callables) {
+  TaskGroup group;
+  (group.Run(std::forward<Callables>(callables)), ...);
+  callable();
+  group.Wait();
+}
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_THREADING_THREAD_POOL_H_
@@ -0,0 +1,144 @@
+#include "tachyon/base/threading/thread_pool.h"
+
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(ThreadPoolTest, PostTask) {
+  ThreadPool pool(3);
+  EXPECT_EQ(pool.num_threads(), 4);
+
+  std::atomic<size_t> count = 0;
+  TaskGroup group(pool);
+  for (size_t i = 0; i < 100; ++i) {
+    group.Run([&count]() { count.fetch_add(1, std::memory_order_relaxed); });
+  }
+  group.Wait();
+  EXPECT_EQ(count.load(), 100);
+}
+
+TEST(ThreadPoolTest, NoWorkers) {
+  ThreadPool pool(0);
+  std::vector<int> values(10, 0);
+  ParallelFor(
+      0, values.size(), [&values](size_t i) { values[i] = i; }, 1, pool);
+  std::vector<int> expected(10);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(values, expected);
+}
+
+TEST(ThreadPoolTest, ParallelFor) {
+  for (size_t grain_size : {size_t{1}, size_t{7}, size_t{1000}}) {
+    std::vector<int> values(1000, 0);
+    ParallelFor(
+        0, values.size(), [&values](size_t i) { values[i] += i; }, grain_size);
+    std::vector<int> expected(1000);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(values, expected);
+  }
+  // Empty range.
+  ParallelFor(3, 3, [](size_t i) { FAIL(); });
+}
+
+TEST(ThreadPoolTest, NestedParallelFor) {
+  std::vector<std::vector<int>> values(16, std::vector<int>(64, 0));
+  ParallelFor(0, values.size(), [&values](size_t i) {
+    ParallelFor(0, values[i].size(),
+                [&values, i](size_t j) { values[i][j] = i * j; });
+  });
+  for (size_t i = 0; i < values.size(); ++i) {
+    for (size_t j = 0; j < values[i].size(); ++j) {
+      EXPECT_EQ(values[i][j], i * j);
+    }
+  }
+}
+
+TEST(ThreadPoolTest, ParallelInvoke) {
+  int a = 0;
+  int b = 0;
+  int c = 0;
+  ParallelInvoke([&a]() { a = 1; }, [&b]() { b = 2; }, [&c]() { c = 3; });
+  EXPECT_EQ(a, 1);
+  EXPECT_EQ(b, 2);
+  EXPECT_EQ(c, 3);
+}
+
+TEST(ThreadPoolTest, SharedByThreads) {
+  // Independent stages running on different threads share the default pool.
+  std::vector<size_t> sums(4, 0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < sums.size(); ++t) {
+    threads.emplace_back([&sums, t]() {
+      std::vector<size_t> values(1000, 0);
+      ParallelFor(0, values.size(),
+                  [&values, t](size_t i) { values[i] = i + t; });
+      sums[t] = std::accumulate(values.begin(), values.end(), size_t{0});
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (size_t t = 0; t < sums.size(); ++t) {
+    EXPECT_EQ(sums[t], 999 * 1000 / 2 + 1000 * t);
+  }
+}
+
+TEST(ThreadPoolTest, ScopedThreadPool) {
+  ThreadPool& default_pool = ThreadPool::GetDefault();
+  EXPECT_EQ(&ThreadPool::GetCurrent(), &default_pool);
+
+  ThreadPool pool(2);
+  {
+    ScopedThreadPool scoped_pool(&pool);
+    EXPECT_EQ(&ThreadPool::GetCurrent(), &pool);
+    {
+      ScopedThreadPool null_scoped_pool(nullptr);
+      EXPECT_EQ(&ThreadPool::GetCurrent(), &pool);
+    }
+
+    // The tasks run on the workers of |pool| see it as the current pool, so
+    // the nested parallel regions stay on it as well.
+    std::vector<ThreadPool*> pools(100, nullptr);
+    ParallelFor(0, pools.size(), [&pools](size_t i) {
+      pools[i] = &ThreadPool::GetCurrent();
+    });
+    for (ThreadPool* current_pool : pools) {
+      EXPECT_EQ(current_pool, &pool);
+    }
+  }
+  EXPECT_EQ(&ThreadPool::GetCurrent(), &default_pool);
+}
+
+TEST(ThreadPoolTest, ScopedThreadPoolPerThread) {
+  // Each thread runs on its own pool, while the threads of the same pool
+  // share it.
+  std::vector<std::unique_ptr<ThreadPool>> pools;
+  pools.push_back(std::make_unique<ThreadPool>(1));
+  pools.push_back(std::make_unique<ThreadPool>(1));
+  std::vector<size_t> sums(4, 0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < sums.size(); ++t) {
+    ThreadPool* pool = pools[t % pools.size()].get();
+    threads.emplace_back([&sums, t, pool]() {
+      ScopedThreadPool scoped_pool(pool);
+      std::vector<size_t> values(1000, 0);
+      ParallelFor(0, values.size(),
+                  [&values, t](size_t i) { values[i] = i + t; });
+      sums[t] = std::accumulate(values.begin(), values.end(), size_t{0});
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (size_t t = 0; t < sums.size(); ++t) {
+    EXPECT_EQ(sums[t], 999 * 1000 / 2 + 1000 * t);
+  }
+}
+
+}  // namespace tachyon::base
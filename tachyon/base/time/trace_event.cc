@@ -0,0 +1,125 @@
+#include "tachyon/base/time/trace_event.h"
+
+#include <algorithm>
+
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::base {
+
+// static
+std::atomic<bool> TraceLog::enabled_ = false;
+
+TraceLog::TraceLog() = default;
+
+// static
+TraceLog& TraceLog::GetInstance() {
+  static NoDestructor<TraceLog> trace_log;
+  return *trace_log;
+}
+
+void TraceLog::Start(size_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = std::max(capacity, size_t{1});
+  for (std::unique_ptr<ThreadBuffer>& thread_buffer : thread_buffers_) {
+    if (thread_buffer->events.size() != capacity_) {
+      thread_buffer->events = std::vector<Event>(capacity_);
+    }
+    thread_buffer->num_written.store(0, std::memory_order_relaxed);
+  }
+  start_ = TimeTicks::Now();
+  enabled_.store(true, std::memory_order_release);
+}
+
+void TraceLog::Stop() { enabled_.store(false, std::memory_order_release); }
+
+const char* TraceLog::InternName(std::string_view name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const std::unique_ptr<std::string>& interned : interned_names_) {
+    if (*interned == name) return interned->c_str();
+  }
+  interned_names_.push_back(std::make_unique<std::string>(name));
+  return interned_names_.back()->c_str();
+}
+
+void TraceLog::AddEvent(const char* category, const char* name,
+                        TimeTicks begin, TimeTicks end) {
+  ThreadBuffer* thread_buffer = GetThreadBuffer();
+  size_t index = thread_buffer->num_written.load(std::memory_order_relaxed);
+  Event& event = thread_buffer->events[index % thread_buffer->events.size()];
+  event.category = category;
+  event.name = name;
+  event.start = begin - start_;
+  event.duration = end - begin;
+  thread_buffer->num_written.store(index + 1, std::memory_order_release);
+}
+
+TraceLog::ThreadBuffer* TraceLog::GetThreadBuffer() {
+  thread_local ThreadBuffer* thread_buffer = nullptr;
+  if (thread_buffer) return thread_buffer;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  thread_buffers_.push_back(std::make_unique<ThreadBuffer>(
+      PlatformThread::CurrentId(), capacity_));
+  thread_buffer = thread_buffers_.back().get();
+  return thread_buffer;
+}
+
+std::vector<std::pair<PlatformThreadId, TraceLog::Event>>
+TraceLog::GetEvents() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<std::pair<PlatformThreadId, Event>> ret;
+  for (const std::unique_ptr<ThreadBuffer>& thread_buffer : thread_buffers_) {
+    size_t num_written =
+        thread_buffer->num_written.load(std::memory_order_acquire);
+    size_t capacity = thread_buffer->events.size();
+    size_t begin = num_written > capacity ? num_written - capacity : 0;
+    for (size_t i = begin; i < num_written; ++i) {
+      ret.emplace_back(thread_buffer->thread_id,
+                       thread_buffer->events[i % capacity]);
+    }
+  }
+  return ret;
+}
+
+std::string TraceLog::ToChromeTraceJson() const {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  writer.StartObject();
+  writer.Key("traceEvents");
+  writer.StartArray();
+  for (const auto& [thread_id, event] : GetEvents()) {
+    writer.StartObject();
+    writer.Key("name");
+    writer.String(event.name);
+    writer.Key("cat");
+    writer.String(event.category);
+    writer.Key("ph");
+    writer.String("X");
+    writer.Key("pid");
+    writer.Int(0);
+    writer.Key("tid");
+    writer.Int64(static_cast<int64_t>(thread_id));
+    writer.Key("ts");
+    writer.Double(event.start.InMicrosecondsF());
+    writer.Key("dur");
+    writer.Double(event.duration.InMicrosecondsF());
+    writer.EndObject();
+  }
+  writer.EndArray();
+  writer.EndObject();
+  return buffer.GetString();
+}
+
+bool TraceLog::WriteChromeTrace(const FilePath& path) const {
+  if (!WriteFile(path, ToChromeTraceJson())) {
+    LOG(ERROR) << "Failed to write trace to " << path.value();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,150 @@
+#ifndef TACHYON_BASE_TIME_TRACE_EVENT_H_
+#define TACHYON_BASE_TIME_TRACE_EVENT_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/threading/platform_thread.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |TraceLog| collects the spans marked by |TRACE_EVENT()| from every thread
+// and exports them as a Chrome trace that can be loaded in chrome://tracing or
+// https://ui.perfetto.dev. Unlike |TraceRecorder|, it is process-wide and can
+// be fed from the parallel regions: each thread appends to its own ring buffer
+// without a lock, overwriting its oldest spans once the buffer is full.
+//
+// |TRACE_EVENT()| compiles to nothing unless tachyon is built with
+// --//:has_trace_event, and only reads a flag until |Start()| is called.
+//
+// Example:
+//
+//   void Pippenger::Run() {
+//     TRACE_EVENT("msm", "Pippenger::Run");
+//     // heavy calculation
+//   }
+//
+//   tachyon::base::TraceLog::GetInstance().Start();
+//   msm.Run();
+//   tachyon::base::TraceLog::GetInstance().Stop();
+//   CHECK(tachyon::base::TraceLog::GetInstance().WriteChromeTrace(
+//       tachyon::base::FilePath("trace.json")));
+class TACHYON_EXPORT TraceLog {
+ public:
+  struct Event {
+    // NOTE: These point to the string literals passed to |TRACE_EVENT()| or
+    // the names returned by |InternName()|.
+    const char* category = nullptr;
+    const char* name = nullptr;
+    // The time from the |TraceLog| is started to the event begins.
+    TimeDelta start;
+    TimeDelta duration;
+  };
+
+  // The number of the latest events kept for each thread.
+  constexpr static size_t kDefaultCapacity = size_t{1} << 14;
+
+  static TraceLog& GetInstance();
+
+  static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  // Clears the recorded events and starts recording.
+  // NOTE: |Start()| and |Stop()| should be called while no traced code is
+  // running, e.g., between proofs.
+  void Start(size_t capacity = kDefaultCapacity);
+  void Stop();
+
+  // Returns a copy of |name| that lives as long as the process, so that
+  // the names built at runtime can be passed to |AddEvent()|.
+  const char* InternName(std::string_view name);
+
+  void AddEvent(const char* category, const char* name, TimeTicks begin,
+                TimeTicks end);
+
+  // Returns the recorded events of every thread along with their thread ids.
+  // NOTE: This should be called after |Stop()|, or while no traced code is
+  // running.
+  std::vector<std::pair<PlatformThreadId, Event>> GetEvents() const;
+
+  std::string ToChromeTraceJson() const;
+  [[nodiscard]] bool WriteChromeTrace(const FilePath& path) const;
+
+ private:
+  friend class NoDestructor<TraceLog>;
+
+  // The ring buffer of a thread, which is written only by the thread.
+  struct ThreadBuffer {
+    PlatformThreadId thread_id;
+    std::vector<Event> events;
+    // The number of events ever written since the last |Start()|.
+    std::atomic<size_t> num_written = 0;
+
+    ThreadBuffer(PlatformThreadId thread_id, size_t capacity)
+        : thread_id(thread_id), events(capacity) {}
+  };
+
+  TraceLog();
+
+  ThreadBuffer* GetThreadBuffer();
+
+  static std::atomic<bool> enabled_;
+
+  TimeTicks start_;
+  size_t capacity_ = kDefaultCapacity;
+  mutable std::mutex mutex_;
+  // NOTE: The buffers are never freed, since a thread keeps a pointer to its
+  // buffer until it exits.
+  std::vector<std::unique_ptr<ThreadBuffer>> thread_buffers_;
+  std::vector<std::unique_ptr<std::string>> interned_names_;
+};
+
+// |ScopedTraceSpan| adds an event to |TraceLog| from its construction to its
+// destruction if |TraceLog| is enabled on construction. Use |TRACE_EVENT()|
+// instead of this.
+class TACHYON_EXPORT ScopedTraceSpan {
+ public:
+  ScopedTraceSpan(const char* category, const char* name)
+      : category_(category), name_(name) {
+    if (TraceLog::IsEnabled()) begin_ = TimeTicks::Now();
+  }
+  ScopedTraceSpan(const ScopedTraceSpan& other) = delete;
+  ScopedTraceSpan& operator=(const ScopedTraceSpan& other) = delete;
+  ~ScopedTraceSpan() {
+    if (begin_.is_null()) return;
+    TraceLog::GetInstance().AddEvent(category_, name_, begin_,
+                                     TimeTicks::Now());
+  }
+
+ private:
+  const char* const category_;
+  const char* const name_;
+  TimeTicks begin_;
+};
+
+}  // namespace tachyon::base
+
+#define TRACE_EVENT_CAT_INDIRECT(a, b) a##b
+#define TRACE_EVENT_CAT(a, b) TRACE_EVENT_CAT_INDIRECT(a, b)
+
+// Traces the enclosing scope as |name| of |category|, both of which must be
+// string literals.
+#if defined(TACHYON_HAS_TRACE_EVENT)
+#define TRACE_EVENT(category, name)                 \
+  ::tachyon::base::ScopedTraceSpan TRACE_EVENT_CAT( \
+      trace_event_span_, __LINE__)(category, name)
+#else
+#define TRACE_EVENT(category, name) static_cast<void>(0)
+#endif
+
+#endif  // TACHYON_BASE_TIME_TRACE_EVENT_H_
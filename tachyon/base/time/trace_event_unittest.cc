@@ -0,0 +1,69 @@
+#include "tachyon/base/time/trace_event.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(TraceLogTest, AddEvents) {
+  TraceLog& trace_log = TraceLog::GetInstance();
+  // Nothing is recorded until the trace log is started.
+  { ScopedTraceSpan span("test", "ignored"); }
+  trace_log.Start();
+  EXPECT_TRUE(TraceLog::IsEnabled());
+  {
+    ScopedTraceSpan outer("test", "outer");
+    std::thread thread([]() { ScopedTraceSpan span("test", "thread"); });
+    thread.join();
+  }
+  trace_log.Stop();
+  EXPECT_FALSE(TraceLog::IsEnabled());
+  { ScopedTraceSpan span("test", "ignored"); }
+
+  std::vector<std::pair<PlatformThreadId, TraceLog::Event>> events =
+      trace_log.GetEvents();
+  ASSERT_EQ(events.size(), size_t{2});
+  auto outer = std::find_if(events.begin(), events.end(), [](const auto& e) {
+    return strcmp(e.second.name, "outer") == 0;
+  });
+  auto thread = std::find_if(events.begin(), events.end(), [](const auto& e) {
+    return strcmp(e.second.name, "thread") == 0;
+  });
+  ASSERT_NE(outer, events.end());
+  ASSERT_NE(thread, events.end());
+  EXPECT_NE(outer->first, thread->first);
+  EXPECT_LE(outer->second.start, thread->second.start);
+  EXPECT_GE(outer->second.duration, thread->second.duration);
+
+  std::string json = trace_log.ToChromeTraceJson();
+  EXPECT_NE(json.find("\"name\":\"thread\""), std::string::npos);
+  EXPECT_NE(json.find("\"cat\":\"test\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+}
+
+TEST(TraceLogTest, KeepLatestEvents) {
+  TraceLog& trace_log = TraceLog::GetInstance();
+  trace_log.Start(/*capacity=*/2);
+  { ScopedTraceSpan span("test", "first"); }
+  { ScopedTraceSpan span("test", trace_log.InternName("second")); }
+  { ScopedTraceSpan span("test", "third"); }
+  trace_log.Stop();
+
+  std::vector<std::pair<PlatformThreadId, TraceLog::Event>> events =
+      trace_log.GetEvents();
+  ASSERT_EQ(events.size(), size_t{2});
+  EXPECT_STREQ(events[0].second.name, "second");
+  EXPECT_STREQ(events[1].second.name, "third");
+  EXPECT_EQ(trace_log.InternName("second"), events[0].second.name);
+
+  // The events are cleared on start.
+  trace_log.Start();
+  trace_log.Stop();
+  EXPECT_TRUE(trace_log.GetEvents().empty());
+}
+
+}  // namespace tachyon::base
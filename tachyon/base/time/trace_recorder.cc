@@ -0,0 +1,164 @@
+#include "tachyon/base/time/trace_recorder.h"
+
+#include <stdio.h>
+
+#include <utility>
+
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/build/build_config.h"
+
+#if BUILDFLAG(IS_POSIX)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace tachyon::base {
+
+TraceRecorder::TraceRecorder() : start_(TimeTicks::Now()) {}
+
+void TraceRecorder::Reset() {
+  start_ = TimeTicks::Now();
+  depth_ = 0;
+  events_.clear();
+}
+
+size_t TraceRecorder::BeginEvent(std::string_view name) {
+  Event event;
+  event.name = std::string(name);
+  event.depth = depth_++;
+  event.start = TimeTicks::Now() - start_;
+  event.rss_begin = GetCurrentRSS();
+  events_.push_back(std::move(event));
+  return events_.size() - 1;
+}
+
+void TraceRecorder::EndEvent(size_t index, TimeDelta duration) {
+  CHECK_LT(index, events_.size());
+  CHECK_GT(depth_, size_t{0});
+  --depth_;
+  Event& event = events_[index];
+  event.duration = duration;
+  event.rss_end = GetCurrentRSS();
+  event.peak_rss = GetPeakRSS();
+}
+
+std::string TraceRecorder::ToChromeTraceJson() const {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  writer.StartObject();
+  writer.Key("traceEvents");
+  writer.StartArray();
+  for (const Event& event : events_) {
+    // See
+    // https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+    // for the format of the complete events.
+    writer.StartObject();
+    writer.Key("name");
+    writer.String(event.name.data(), event.name.size());
+    writer.Key("ph");
+    writer.String("X");
+    writer.Key("pid");
+    writer.Int(0);
+    writer.Key("tid");
+    writer.Int(0);
+    writer.Key("ts");
+    writer.Double(event.start.InMicrosecondsF());
+    writer.Key("dur");
+    writer.Double(event.duration.InMicrosecondsF());
+    writer.Key("args");
+    writer.StartObject();
+    writer.Key("depth");
+    writer.Uint64(event.depth);
+    writer.Key("rss_begin");
+    writer.Uint64(event.rss_begin);
+    writer.Key("rss_end");
+    writer.Uint64(event.rss_end);
+    writer.Key("peak_rss");
+    writer.Uint64(event.peak_rss);
+    writer.EndObject();
+    writer.EndObject();
+  }
+  writer.EndArray();
+  writer.EndObject();
+  return buffer.GetString();
+}
+
+bool TraceRecorder::WriteChromeTrace(const FilePath& path) const {
+  if (!WriteFile(path, ToChromeTraceJson())) {
+    LOG(ERROR) << "Failed to write trace to " << path.value();
+    return false;
+  }
+  return true;
+}
+
+// static
+uint64_t TraceRecorder::GetCurrentRSS() {
+#if BUILDFLAG(IS_LINUX)
+  FILE* file = fopen("/proc/self/statm", "r");
+  if (file == nullptr) return 0;
+  unsigned long size = 0;     // NOLINT(runtime/int)
+  unsigned long resident = 0;  // NOLINT(runtime/int)
+  int num_read = fscanf(file, "%lu %lu", &size, &resident);
+  fclose(file);
+  if (num_read != 2) return 0;
+  return uint64_t{resident} * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#else
+  return 0;
+#endif
+}
+
+// static
+uint64_t TraceRecorder::GetPeakRSS() {
+#if BUILDFLAG(IS_POSIX)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if BUILDFLAG(IS_APPLE)
+  // NOTE: |ru_maxrss| is in bytes on macOS.
+  return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+  // NOTE: |ru_maxrss| is in kilobytes on Linux.
+  return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+  return 0;
+#endif
+}
+
+ScopedTraceEvent::ScopedTraceEvent(TraceRecorder* recorder,
+                                   std::string_view name)
+    : recorder_(recorder) {
+#if defined(TACHYON_HAS_TRACE_EVENT)
+  if (TraceLog::IsEnabled()) {
+    span_.emplace("phase", TraceLog::GetInstance().InternName(name));
+  }
+#endif
+  if (MetricsRegistry::IsEnabled()) {
+    histogram_ = MetricsRegistry::GetInstance().GetHistogram(
+        "tachyon_phase_seconds", "The time spent in each phase in seconds.",
+        {{"phase", std::string(name)}});
+  }
+  if (!recorder_ && !histogram_) return;
+  if (recorder_) index_ = recorder_->BeginEvent(name);
+  interval_.Reset();
+}
+
+ScopedTraceEvent::~ScopedTraceEvent() {
+  if (!recorder_ && !histogram_) return;
+  TimeDelta duration = interval_.GetTimeDelta(/*update=*/false);
+  if (recorder_) recorder_->EndEvent(index_, duration);
+  if (histogram_) histogram_->Observe(duration.InSecondsF());
+}
+
+void ScopedTracePhases::Begin(std::string_view name) {
+#if !defined(TACHYON_HAS_TRACE_EVENT)
+  if (!recorder_ && !MetricsRegistry::IsEnabled()) return;
+#endif
+  event_.reset();
+  event_.emplace(recorder_, name);
+}
+
+}  // namespace tachyon::base
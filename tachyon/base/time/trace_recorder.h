@@ -0,0 +1,127 @@
+#ifndef TACHYON_BASE_TIME_TRACE_RECORDER_H_
+#define TACHYON_BASE_TIME_TRACE_RECORDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/metrics/metrics_registry.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/base/time/time_interval.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |TraceRecorder| records a hierarchical trace of the scopes marked by
+// |ScopedTraceEvent|, with the time spent in each of them and the resident
+// memory of the process around them, and exports it as a Chrome trace that can
+// be loaded in chrome://tracing or https://ui.perfetto.dev.
+// NOTE: This class doesn't guarantee thread safety. The events should be
+// recorded from a single thread, e.g, outside of the parallel regions.
+//
+// Example:
+//
+//   tachyon::base::TraceRecorder recorder;
+//   {
+//     tachyon::base::ScopedTraceEvent event(&recorder, "Prove");
+//     {
+//       tachyon::base::ScopedTraceEvent event(&recorder, "Commit");
+//       // heavy calculation
+//     }
+//   }
+//   CHECK(recorder.WriteChromeTrace(tachyon::base::FilePath("trace.json")));
+class TACHYON_EXPORT TraceRecorder {
+ public:
+  struct Event {
+    std::string name;
+    // The number of events enclosing this event.
+    size_t depth = 0;
+    // The time from the |TraceRecorder| is created or reset to the event begins.
+    TimeDelta start;
+    TimeDelta duration;
+    // The resident memory in bytes when the event begins and ends.
+    uint64_t rss_begin = 0;
+    uint64_t rss_end = 0;
+    // The peak resident memory in bytes of the process when the event ends.
+    uint64_t peak_rss = 0;
+  };
+
+  TraceRecorder();
+  TraceRecorder(const TraceRecorder& other) = delete;
+  TraceRecorder& operator=(const TraceRecorder& other) = delete;
+
+  const std::vector<Event>& events() const { return events_; }
+
+  // Clears the events and restarts the clock.
+  void Reset();
+
+  // Returns the index of the event, which should be passed to |EndEvent()|.
+  size_t BeginEvent(std::string_view name);
+  void EndEvent(size_t index, TimeDelta duration);
+
+  std::string ToChromeTraceJson() const;
+  [[nodiscard]] bool WriteChromeTrace(const FilePath& path) const;
+
+  // Returns the current and the peak resident memory of the process in bytes,
+  // or 0 if it's not supported on the platform.
+  static uint64_t GetCurrentRSS();
+  static uint64_t GetPeakRSS();
+
+ private:
+  TimeTicks start_;
+  size_t depth_ = 0;
+  std::vector<Event> events_;
+};
+
+// |ScopedTraceEvent| records an event to |recorder| from its construction to
+// its destruction. It does nothing if |recorder| is nullptr, so tracing can be
+// turned on and off by passing a |TraceRecorder| or not. If tachyon is built
+// with --//:has_trace_event, the event is added to an enabled |TraceLog| as
+// well, regardless of |recorder|. If the metrics are enabled, its time is
+// observed by tachyon_phase_seconds{phase="<name>"} of |MetricsRegistry| as
+// well, regardless of |recorder|.
+class TACHYON_EXPORT ScopedTraceEvent {
+ public:
+  ScopedTraceEvent(TraceRecorder* recorder, std::string_view name);
+  ScopedTraceEvent(const ScopedTraceEvent& other) = delete;
+  ScopedTraceEvent& operator=(const ScopedTraceEvent& other) = delete;
+  ~ScopedTraceEvent();
+
+ private:
+  // not owned
+  TraceRecorder* const recorder_;
+  // not owned
+  Histogram* histogram_ = nullptr;
+  size_t index_ = 0;
+  TimeInterval interval_;
+  std::optional<ScopedTraceSpan> span_;
+};
+
+// |ScopedTracePhases| records consecutive events to |recorder|, each of which
+// ends when the next one begins or |ScopedTracePhases| is destroyed. This is
+// handy to mark the steps of a long function without introducing scopes.
+class TACHYON_EXPORT ScopedTracePhases {
+ public:
+  explicit ScopedTracePhases(TraceRecorder* recorder) : recorder_(recorder) {}
+  ScopedTracePhases(const ScopedTracePhases& other) = delete;
+  ScopedTracePhases& operator=(const ScopedTracePhases& other) = delete;
+  ~ScopedTracePhases() = default;
+
+  // Ends the current phase if any, and begins a new phase named |name|.
+  void Begin(std::string_view name);
+
+ private:
+  // not owned
+  TraceRecorder* const recorder_;
+  std::optional<ScopedTraceEvent> event_;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_TIME_TRACE_RECORDER_H_
@@ -0,0 +1,73 @@
+#include "tachyon/base/time/trace_recorder.h"
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(TraceRecorderTest, RecordEvents) {
+  TraceRecorder recorder;
+  {
+    ScopedTraceEvent outer(&recorder, "outer");
+    { ScopedTraceEvent inner(&recorder, "inner"); }
+    { ScopedTraceEvent inner(&recorder, "inner2"); }
+  }
+  // Nothing is recorded without a recorder.
+  { ScopedTraceEvent event(nullptr, "ignored"); }
+
+  const std::vector<TraceRecorder::Event>& events = recorder.events();
+  ASSERT_EQ(events.size(), size_t{3});
+  EXPECT_EQ(events[0].name, "outer");
+  EXPECT_EQ(events[0].depth, size_t{0});
+  EXPECT_EQ(events[1].name, "inner");
+  EXPECT_EQ(events[1].depth, size_t{1});
+  EXPECT_EQ(events[2].name, "inner2");
+  EXPECT_EQ(events[2].depth, size_t{1});
+  EXPECT_LE(events[0].start, events[1].start);
+  EXPECT_LE(events[1].start + events[1].duration, events[2].start);
+  EXPECT_GE(events[0].duration, events[1].duration + events[2].duration);
+
+  std::string json = recorder.ToChromeTraceJson();
+  EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"inner2\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+
+  recorder.Reset();
+  EXPECT_TRUE(recorder.events().empty());
+}
+
+TEST(TraceRecorderTest, RecordPhases) {
+  TraceRecorder recorder;
+  {
+    ScopedTracePhases phases(&recorder);
+    phases.Begin("first");
+    phases.Begin("second");
+  }
+
+  const std::vector<TraceRecorder::Event>& events = recorder.events();
+  ASSERT_EQ(events.size(), size_t{2});
+  EXPECT_EQ(events[0].name, "first");
+  EXPECT_EQ(events[0].depth, size_t{0});
+  EXPECT_EQ(events[1].name, "second");
+  EXPECT_EQ(events[1].depth, size_t{0});
+  EXPECT_LE(events[0].start + events[0].duration, events[1].start);
+}
+
+TEST(TraceRecorderTest, RecordPhaseMetrics) {
+  MetricsRegistry& registry = MetricsRegistry::GetInstance();
+  Histogram* histogram = registry.GetHistogram("tachyon_phase_seconds", "",
+                                               {{"phase", "metrics_test"}});
+
+  { ScopedTraceEvent event(nullptr, "metrics_test"); }
+  EXPECT_EQ(histogram->GetSnapshot().count, uint64_t{0});
+
+  registry.set_enabled(true);
+  { ScopedTraceEvent event(nullptr, "metrics_test"); }
+  {
+    ScopedTracePhases phases(nullptr);
+    phases.Begin("metrics_test");
+  }
+  registry.set_enabled(false);
+  EXPECT_EQ(histogram->GetSnapshot().count, uint64_t{2});
+}
+
+}  // namespace tachyon::base
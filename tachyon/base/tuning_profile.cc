@@ -0,0 +1,133 @@
+#include "tachyon/base/tuning_profile.h"
+
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/environment.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon::base {
+
+namespace {
+
+TuningProfile* CreateDefaultProfile() {
+  TuningProfile* profile = new TuningProfile();
+  std::string_view path;
+  if (Environment::Get("TACHYON_TUNING_PROFILE_PATH", &path) &&
+      !profile->Load(FilePath(path))) {
+    LOG(WARNING) << "Failed to load the tuning profile: " << path;
+  }
+  return profile;
+}
+
+}  // namespace
+
+// static
+TuningProfile& TuningProfile::GetDefault() {
+  // NOTE: It is never destroyed, like |NoDestructor|.
+  static TuningProfile* profile = CreateDefaultProfile();
+  return *profile;
+}
+
+bool TuningProfile::empty() const {
+  absl::MutexLock lock(&lock_);
+  return values_.empty();
+}
+
+bool TuningProfile::Load(const FilePath& path) {
+  std::string content;
+  if (!ReadFileToString(path, &content)) {
+    LOG(ERROR) << "Failed to read " << path.value();
+    return false;
+  }
+
+  std::map<Key, std::string> values;
+  for (std::string_view line :
+       absl::StrSplit(content, '\n', absl::SkipWhitespace())) {
+    if (line[0] == '#') continue;
+    std::vector<std::string_view> fields = absl::StrSplit(line, '\t');
+    uint32_t log_size;
+    if (fields.size() != 3 || fields[0].empty() ||
+        !StringToUint(fields[1], &log_size) || fields[2].empty()) {
+      LOG(ERROR) << "Malformed line of " << path.value() << ": " << line;
+      return false;
+    }
+    values[{std::string(fields[0]), log_size}] = std::string(fields[2]);
+  }
+
+  absl::MutexLock lock(&lock_);
+  values_ = std::move(values);
+  return true;
+}
+
+bool TuningProfile::Save(const FilePath& path) const {
+  std::string content = ToString();
+  if (!CreateDirectory(path.DirName())) {
+    LOG(ERROR) << "Failed to create " << path.DirName().value();
+    return false;
+  }
+  if (!WriteFile(path, content)) {
+    LOG(ERROR) << "Failed to write " << path.value();
+    return false;
+  }
+  return true;
+}
+
+void TuningProfile::Set(std::string_view knob, uint32_t log_size,
+                        std::string_view value) {
+  absl::MutexLock lock(&lock_);
+  values_[{std::string(knob), log_size}] = std::string(value);
+}
+
+void TuningProfile::Clear() {
+  absl::MutexLock lock(&lock_);
+  values_.clear();
+}
+
+std::optional<std::string> TuningProfile::Get(std::string_view knob,
+                                              size_t size) const {
+  Key key(std::string(knob), bits::SafeLog2Ceiling(size));
+  absl::MutexLock lock(&lock_);
+  auto it = values_.upper_bound(key);
+  if (it == values_.begin()) return std::nullopt;
+  --it;
+  if (it->first.first != key.first) return std::nullopt;
+  return it->second;
+}
+
+std::optional<size_t> TuningProfile::GetSize(std::string_view knob,
+                                             size_t size) const {
+  std::optional<std::string> value = Get(knob, size);
+  if (!value.has_value()) return std::nullopt;
+  size_t ret;
+  if (!StringToSizeT(*value, &ret)) {
+    LOG(ERROR) << "The value of " << knob << " is not a number: " << *value;
+    return std::nullopt;
+  }
+  return ret;
+}
+
+void TuningProfile::ApplyNumThreads() const {
+  std::optional<size_t> num_threads = GetSize(kNumThreads);
+  if (!num_threads.has_value() || *num_threads == 0) return;
+#if defined(TACHYON_HAS_OPENMP)
+  omp_set_num_threads(static_cast<int>(*num_threads));
+#endif
+}
+
+std::string TuningProfile::ToString() const {
+  std::string content;
+  absl::MutexLock lock(&lock_);
+  for (const auto& [key, value] : values_) {
+    absl::StrAppend(&content, key.first, "\t", key.second, "\t", value, "\n");
+  }
+  return content;
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,92 @@
+#ifndef TACHYON_BASE_TUNING_PROFILE_H_
+#define TACHYON_BASE_TUNING_PROFILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// |TuningProfile| holds the values of the knobs of the host, e.g., the
+// parallel strategy of the MSMs, measured by the calibration run of
+// //benchmark/calibration. The knobs that aren't in the profile keep their
+// defaults. The profile is read from a file, one value per line as
+//
+//   <knob>\t<log size>\t<value>
+//
+// where the value holds for the operations whose sizes are at least
+// 2^<log size>, up to the next log size of the same knob. A log size of 0
+// holds for every size. The lines that start with '#' are ignored.
+//
+// NOTE: The values only hold for the machine they are measured on, so the
+// file shouldn't be shared between the machines.
+class TACHYON_EXPORT TuningProfile {
+ public:
+  // See |math::PippengerParallelStrategy|.
+  constexpr static std::string_view kPippengerParallelStrategy =
+      "msm.pippenger_parallel_strategy";
+  // The smallest MSM run on the GPU by the C API. The smaller ones run on the
+  // CPU.
+  constexpr static std::string_view kMinGpuMSMSize = "msm.min_gpu_size";
+  // See |math::Radix2EvaluationDomain::kDegreeAwareFFTThresholdFactor|.
+  constexpr static std::string_view kDegreeAwareFFTThresholdFactor =
+      "fft.degree_aware_threshold_factor";
+  // See |crypto::BinaryMerkleTree::leaves_size_for_parallelization()|.
+  constexpr static std::string_view kLeavesSizeForParallelization =
+      "merkle_tree.leaves_size_for_parallelization";
+  // The number of the OpenMP threads. See |ApplyNumThreads()|.
+  constexpr static std::string_view kNumThreads = "num_threads";
+
+  // Returns the profile shared by the whole process, which is loaded from
+  // $TACHYON_TUNING_PROFILE_PATH once if it is set. It is empty otherwise.
+  static TuningProfile& GetDefault();
+
+  TuningProfile() = default;
+  TuningProfile(const TuningProfile& other) = delete;
+  TuningProfile& operator=(const TuningProfile& other) = delete;
+
+  bool empty() const;
+
+  // Replaces the values with the ones read from |path|. Returns false if it
+  // fails to read |path| or any of its lines is malformed, in which case the
+  // values are left as they were.
+  [[nodiscard]] bool Load(const FilePath& path);
+  [[nodiscard]] bool Save(const FilePath& path) const;
+
+  void Set(std::string_view knob, uint32_t log_size, std::string_view value);
+  void Clear();
+
+  // Returns the value of |knob| for the operations of |size|, which is the
+  // one of the largest log size not greater than ⌈log₂(|size|)⌉.
+  std::optional<std::string> Get(std::string_view knob,
+                                 size_t size = 1) const;
+  // Same as above, but returns std::nullopt if the value isn't a number.
+  std::optional<size_t> GetSize(std::string_view knob, size_t size = 1) const;
+
+  // Sets the number of the OpenMP threads to the value of |kNumThreads| if it
+  // is set.
+  void ApplyNumThreads() const;
+
+  std::string ToString() const;
+
+ private:
+  using Key = std::pair<std::string, uint32_t>;
+
+  mutable absl::Mutex lock_;
+  std::map<Key, std::string> values_ ABSL_GUARDED_BY(lock_);
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_TUNING_PROFILE_H_
@@ -0,0 +1,62 @@
+#include "tachyon/base/tuning_profile.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::base {
+
+TEST(TuningProfileTest, Get) {
+  TuningProfile profile;
+  EXPECT_TRUE(profile.empty());
+  EXPECT_FALSE(profile.Get("knob").has_value());
+
+  profile.Set("knob", 0, "small");
+  profile.Set("knob", 10, "large");
+  profile.Set("other", 4, "16");
+  EXPECT_FALSE(profile.empty());
+
+  EXPECT_EQ(profile.Get("knob"), "small");
+  EXPECT_EQ(profile.Get("knob", 1000), "small");
+  EXPECT_EQ(profile.Get("knob", 1024), "large");
+  EXPECT_EQ(profile.Get("knob", size_t{1} << 20), "large");
+  // The values of the other knobs aren't taken.
+  EXPECT_FALSE(profile.Get("other", 8).has_value());
+  EXPECT_EQ(profile.GetSize("other", 16), size_t{16});
+  EXPECT_FALSE(profile.GetSize("knob").has_value());
+  EXPECT_FALSE(profile.Get("unknown", 1024).has_value());
+
+  profile.Clear();
+  EXPECT_TRUE(profile.empty());
+}
+
+TEST(TuningProfileTest, SaveAndLoad) {
+  ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  FilePath path = temp_dir.GetPath().Append("tuning/profile.tsv");
+
+  TuningProfile profile;
+  profile.Set(TuningProfile::kPippengerParallelStrategy, 0, "parallel_term");
+  profile.Set(TuningProfile::kPippengerParallelStrategy, 16,
+              "parallel_window");
+  profile.Set(TuningProfile::kNumThreads, 0, "8");
+  ASSERT_TRUE(profile.Save(path));
+
+  TuningProfile profile2;
+  ASSERT_TRUE(profile2.Load(path));
+  EXPECT_EQ(profile2.ToString(), profile.ToString());
+
+  // A malformed profile leaves the values as they were.
+  ASSERT_TRUE(WriteFile(path, "# comment\nnum_threads\t0\n"));
+  EXPECT_FALSE(profile2.Load(path));
+  EXPECT_EQ(profile2.GetSize(TuningProfile::kNumThreads), size_t{8});
+
+  ASSERT_TRUE(WriteFile(path, "# comment\nnum_threads\t0\t4\n"));
+  ASSERT_TRUE(profile2.Load(path));
+  EXPECT_EQ(profile2.GetSize(TuningProfile::kNumThreads), size_t{4});
+  EXPECT_FALSE(
+      profile2.Get(TuningProfile::kPippengerParallelStrategy).has_value());
+}
+
+}  // namespace tachyon::base
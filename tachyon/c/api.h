@@ -1,6 +1,9 @@
 #ifndef TACHYON_C_API_H_
 #define TACHYON_C_API_H_
 
+#include "tachyon/c/base/metrics.h"
+#include "tachyon/c/base/parallel_runtime.h"
+#include "tachyon/c/base/tuning_profile.h"
 #include "tachyon/c/math/elliptic_curves/bls12/bls12_381/fq.h"
 #include "tachyon/c/math/elliptic_curves/bls12/bls12_381/fr.h"
 #include "tachyon/c/math/elliptic_curves/bls12/bls12_381/g1.h"
@@ -0,0 +1,19 @@
+#include "tachyon/c/base/metrics.h"
+
+#include <string>
+
+#include "tachyon/base/metrics/metrics_registry.h"
+
+using namespace tachyon;
+
+void tachyon_metrics_set_enabled(bool enabled) {
+  base::MetricsRegistry::GetInstance().set_enabled(enabled);
+}
+
+bool tachyon_metrics_is_enabled() { return base::MetricsRegistry::IsEnabled(); }
+
+void tachyon_metrics_write_prometheus_text(tachyon_metrics_writer writer,
+                                           void* user_data) {
+  std::string text = base::MetricsRegistry::GetInstance().ToPrometheusText();
+  writer(text.data(), text.size(), user_data);
+}
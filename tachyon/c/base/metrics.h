@@ -0,0 +1,68 @@
+/**
+ * @file metrics.h
+ * @brief Metrics interface.
+ *
+ * This header file provides an interface to export the metrics of a
+ * long-running prover process to a monitoring system, e.g., the proofs per
+ * second, the latency of each phase of the provers, the throughput of the MSMs
+ * and the FFTs and the usage of the GPU memory pools. The metrics are written
+ * in the Prometheus text exposition format, so that the process can serve them
+ * on its own /metrics endpoint.
+ */
+#ifndef TACHYON_C_BASE_METRICS_H_
+#define TACHYON_C_BASE_METRICS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "tachyon/c/export.h"
+
+/**
+ * @brief A function that receives the metrics.
+ *
+ * @param text The metrics in the Prometheus text exposition format, not
+ * null-terminated. It is valid only during the call.
+ * @param text_len The length of the text.
+ * @param user_data The pointer passed to
+ * tachyon_metrics_write_prometheus_text().
+ */
+typedef void (*tachyon_metrics_writer)(const char* text, size_t text_len,
+                                       void* user_data);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sets whether the metrics are recorded.
+ *
+ * They are not recorded by default unless $TACHYON_METRICS is set to 1.
+ *
+ * @param enabled True to record the metrics.
+ */
+TACHYON_C_EXPORT void tachyon_metrics_set_enabled(bool enabled);
+
+/**
+ * @brief Retrieves whether the metrics are recorded.
+ *
+ * @return True if the metrics are recorded.
+ */
+TACHYON_C_EXPORT bool tachyon_metrics_is_enabled();
+
+/**
+ * @brief Passes the current metrics to a function.
+ *
+ * This is safe to call from any thread while the provers are running, e.g.,
+ * from the handler of the /metrics endpoint.
+ *
+ * @param writer The function that receives the metrics.
+ * @param user_data The pointer passed to @p writer as it is.
+ */
+TACHYON_C_EXPORT void tachyon_metrics_write_prometheus_text(
+    tachyon_metrics_writer writer, void* user_data);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // TACHYON_C_BASE_METRICS_H_
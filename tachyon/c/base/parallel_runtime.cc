@@ -0,0 +1,44 @@
+#include "tachyon/c/base/parallel_runtime.h"
+
+#include <memory>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/memory/numa.h"
+#include "tachyon/base/threading/thread_pool.h"
+
+using namespace tachyon;
+
+static_assert(static_cast<uint8_t>(base::NumaPolicy::kPartition) ==
+              TACHYON_NUMA_POLICY_PARTITION);
+static_assert(static_cast<uint8_t>(base::ThreadAffinity::kSpread) ==
+              TACHYON_THREAD_AFFINITY_SPREAD);
+
+void tachyon_set_numa_policy(uint8_t policy) {
+  CHECK_LE(policy, TACHYON_NUMA_POLICY_PARTITION);
+  base::SetNumaPolicy(static_cast<base::NumaPolicy>(policy));
+}
+
+void tachyon_set_thread_affinity(uint8_t affinity) {
+  CHECK_LE(affinity, TACHYON_THREAD_AFFINITY_SPREAD);
+  base::ThreadPool::SetDefaultAffinity(
+      static_cast<base::ThreadAffinity>(affinity));
+}
+
+tachyon_thread_pool* tachyon_thread_pool_create(size_t num_threads,
+                                                uint8_t affinity) {
+  CHECK_GT(num_threads, size_t{0});
+  CHECK_LE(affinity, TACHYON_THREAD_AFFINITY_SPREAD);
+  auto* pool = new std::shared_ptr<base::ThreadPool>(
+      std::make_shared<base::ThreadPool>(
+          num_threads - 1, static_cast<base::ThreadAffinity>(affinity)));
+  return reinterpret_cast<tachyon_thread_pool*>(pool);
+}
+
+void tachyon_thread_pool_destroy(tachyon_thread_pool* pool) {
+  delete reinterpret_cast<std::shared_ptr<base::ThreadPool>*>(pool);
+}
+
+size_t tachyon_thread_pool_get_num_threads(const tachyon_thread_pool* pool) {
+  return (*reinterpret_cast<const std::shared_ptr<base::ThreadPool>*>(pool))
+      ->num_threads();
+}
@@ -0,0 +1,92 @@
+/**
+ * @file parallel_runtime.h
+ * @brief Parallel runtime interface.
+ *
+ * This header file provides an interface to control how the parallel runtime
+ * places the large buffers over the NUMA nodes and pins its worker threads.
+ * The functions setting them should be called before any other function of
+ * tachyon. It also provides the thread pools, which split the cores among the
+ * provers running concurrently on different threads.
+ */
+#ifndef TACHYON_C_BASE_PARALLEL_RUNTIME_H_
+#define TACHYON_C_BASE_PARALLEL_RUNTIME_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/c/export.h"
+
+#define TACHYON_NUMA_POLICY_DEFAULT 0
+#define TACHYON_NUMA_POLICY_INTERLEAVE 1
+#define TACHYON_NUMA_POLICY_PARTITION 2
+
+#define TACHYON_THREAD_AFFINITY_NONE 0
+#define TACHYON_THREAD_AFFINITY_COMPACT 1
+#define TACHYON_THREAD_AFFINITY_SPREAD 2
+
+/**
+ * @struct tachyon_thread_pool
+ * @brief A pool of worker threads that steal the tasks from each other.
+ *
+ * A prover set to a pool runs its parallel regions, including the OpenMP ones,
+ * on as many threads as the pool has instead of every core. It is
+ * reference-counted, so that it stays alive until the handle and every prover
+ * set to it are destroyed. It may be shared by several provers.
+ */
+struct tachyon_thread_pool {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sets how the polynomials and the proving key columns are placed over
+ * the NUMA nodes.
+ * @param policy One of TACHYON_NUMA_POLICY_*.
+ */
+TACHYON_C_EXPORT void tachyon_set_numa_policy(uint8_t policy);
+
+/**
+ * @brief Sets which CPUs the worker threads are pinned to.
+ *
+ * This has no effect once the worker threads are created.
+ *
+ * @param affinity One of TACHYON_THREAD_AFFINITY_*.
+ */
+TACHYON_C_EXPORT void tachyon_set_thread_affinity(uint8_t affinity);
+
+/**
+ * @brief Creates a thread pool.
+ *
+ * The thread calling into a prover set to the pool works as one of its
+ * threads, so @p num_threads - 1 worker threads are created.
+ *
+ * @param num_threads The number of threads, which must be positive.
+ * @param affinity One of TACHYON_THREAD_AFFINITY_*.
+ * @return A pointer to the newly created thread pool.
+ */
+TACHYON_C_EXPORT tachyon_thread_pool* tachyon_thread_pool_create(
+    size_t num_threads, uint8_t affinity);
+
+/**
+ * @brief Releases the reference to a thread pool. The worker threads are
+ * joined once every prover set to it is destroyed as well.
+ *
+ * @param pool Pointer to the thread pool.
+ */
+TACHYON_C_EXPORT void tachyon_thread_pool_destroy(tachyon_thread_pool* pool);
+
+/**
+ * @brief Retrieves the number of threads of a thread pool.
+ *
+ * @param pool Pointer to the thread pool.
+ * @return The number of threads.
+ */
+TACHYON_C_EXPORT size_t
+tachyon_thread_pool_get_num_threads(const tachyon_thread_pool* pool);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // TACHYON_C_BASE_PARALLEL_RUNTIME_H_
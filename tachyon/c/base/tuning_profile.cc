@@ -0,0 +1,13 @@
+#include "tachyon/c/base/tuning_profile.h"
+
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/tuning_profile.h"
+
+using namespace tachyon;
+
+bool tachyon_load_tuning_profile(const char* path) {
+  base::TuningProfile& profile = base::TuningProfile::GetDefault();
+  if (!profile.Load(base::FilePath(path))) return false;
+  profile.ApplyNumThreads();
+  return true;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file tuning_profile.h
+ * @brief Tuning profile interface.
+ *
+ * This header file provides an interface to load the tuning profile written by
+ * the calibration run of //benchmark/calibration, which holds the values of
+ * the knobs, e.g., the parallel strategy of the MSMs, measured on the host.
+ * The profile is also loaded from $TACHYON_TUNING_PROFILE_PATH when it is set.
+ */
+#ifndef TACHYON_C_BASE_TUNING_PROFILE_H_
+#define TACHYON_C_BASE_TUNING_PROFILE_H_
+
+#include <stdbool.h>
+
+#include "tachyon/c/export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Loads the tuning profile and sets the number of the OpenMP threads
+ * if the profile has it.
+ *
+ * The profile replaces the one loaded before. It should be called before any
+ * prover is created.
+ *
+ * @param path The path of the profile.
+ * @return True if the profile is loaded, false if it fails to read the file or
+ * the file is malformed, in which case the profile loaded before is kept.
+ */
+TACHYON_C_EXPORT bool tachyon_load_tuning_profile(const char* path);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // TACHYON_C_BASE_TUNING_PROFILE_H_
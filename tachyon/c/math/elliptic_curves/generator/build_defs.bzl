@@ -299,5 +299,6 @@ def generate_ec_points(
             deps = g1_gpu_deps + g1_msm_kernels_deps + [
                 ":g1",
                 "//tachyon/c/math/elliptic_curves/msm:msm_gpu",
+                "//tachyon/c/math/elliptic_curves/msm:msm_hybrid",
             ],
         )
@@ -4,6 +4,7 @@
 #include "tachyon/c/math/elliptic_curves/%{header_dir_name}/g1_point_traits.h"
 #include "tachyon/c/math/elliptic_curves/%{header_dir_name}/g1_point_type_traits.h"
 #include "tachyon/c/math/elliptic_curves/msm/msm_gpu.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm_hybrid.h"
 #include "tachyon/math/elliptic_curves/%{header_dir_name}/g1_gpu.h"
 %{if HasSpecializedG1MsmKernels}
 #include "tachyon/math/elliptic_curves/msm/kernels/bellman/%{type}_bellman_msm_kernels.cu.h"
@@ -14,6 +15,10 @@ struct tachyon_%{type}_g1_msm_gpu : public tachyon::c::math::MSMGpuApi<tachyon::
   using tachyon::c::math::MSMGpuApi<tachyon::math::%{type}::G1CurveGpu>::MSMGpuApi;
 };
 
+struct tachyon_%{type}_g1_msm_hybrid : public tachyon::c::math::MSMHybridApi<tachyon::math::%{type}::G1CurveGpu> {
+  using tachyon::c::math::MSMHybridApi<tachyon::math::%{type}::G1CurveGpu>::MSMHybridApi;
+};
+
 tachyon_%{type}_g1_msm_gpu_ptr tachyon_%{type}_g1_create_msm_gpu(uint8_t degree, int algorithm) {
   return new tachyon_%{type}_g1_msm_gpu(degree, algorithm);
 }
@@ -35,4 +40,59 @@ tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_affine_msm_gpu(
   return tachyon::c::math::DoMSMGpu<tachyon::math::%{type}::G1JacobianPoint>(
       *ptr, bases, scalars, size);
 }
+
+uint64_t tachyon_%{type}_g1_msm_gpu_upload_point2_bases(
+    tachyon_%{type}_g1_msm_gpu_ptr ptr, const tachyon_%{type}_g1_point2* bases, size_t size) {
+  return tachyon::c::math::UploadBasesGpu(*ptr, bases, size);
+}
+
+uint64_t tachyon_%{type}_g1_msm_gpu_upload_affine_bases(
+    tachyon_%{type}_g1_msm_gpu_ptr ptr, const tachyon_%{type}_g1_affine* bases, size_t size) {
+  return tachyon::c::math::UploadBasesGpu(*ptr, bases, size);
+}
+
+tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_msm_gpu_with_resident_bases(
+    tachyon_%{type}_g1_msm_gpu_ptr ptr, uint64_t bases_handle,
+    const tachyon_%{type}_fr* scalars, size_t size) {
+  return tachyon::c::math::DoMSMGpuWithResidentBases<tachyon::math::%{type}::G1JacobianPoint>(
+      *ptr, bases_handle, scalars, size);
+}
+
+void tachyon_%{type}_g1_msm_gpu_release_bases(
+    tachyon_%{type}_g1_msm_gpu_ptr ptr, uint64_t bases_handle) {
+  tachyon::c::math::ReleaseBasesGpu(*ptr, bases_handle);
+}
+
+tachyon_%{type}_g1_msm_hybrid_ptr tachyon_%{type}_g1_create_msm_hybrid(int algorithm) {
+  return new tachyon_%{type}_g1_msm_hybrid(algorithm);
+}
+
+void tachyon_%{type}_g1_destroy_msm_hybrid(tachyon_%{type}_g1_msm_hybrid_ptr ptr) {
+  delete ptr;
+}
+
+void tachyon_%{type}_g1_msm_hybrid_set_gpu_ratio(
+    tachyon_%{type}_g1_msm_hybrid_ptr ptr, double gpu_ratio, bool adaptive) {
+  ptr->msm->set_gpu_ratio(gpu_ratio);
+  ptr->msm->set_adaptive(adaptive);
+}
+
+double tachyon_%{type}_g1_msm_hybrid_get_gpu_ratio(
+    tachyon_%{type}_g1_msm_hybrid_ptr ptr) {
+  return ptr->msm->gpu_ratio();
+}
+
+tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_point2_msm_hybrid(
+    tachyon_%{type}_g1_msm_hybrid_ptr ptr, const tachyon_%{type}_g1_point2* bases,
+    const tachyon_%{type}_fr* scalars, size_t size) {
+  return tachyon::c::math::DoMSMHybrid<tachyon::math::%{type}::G1JacobianPoint>(
+      *ptr, bases, scalars, size);
+}
+
+tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_affine_msm_hybrid(
+    tachyon_%{type}_g1_msm_hybrid_ptr ptr, const tachyon_%{type}_g1_affine* bases,
+    const tachyon_%{type}_fr* scalars, size_t size) {
+  return tachyon::c::math::DoMSMHybrid<tachyon::math::%{type}::G1JacobianPoint>(
+      *ptr, bases, scalars, size);
+}
 // clang-format on
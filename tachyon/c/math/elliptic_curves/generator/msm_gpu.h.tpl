@@ -7,6 +7,7 @@
  * operations on points of the G1 group of the %{type} curve.
  */
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -15,6 +16,7 @@
 #include "tachyon/c/math/elliptic_curves/%{header_dir_name}/g1.h"
 
 typedef struct tachyon_%{type}_g1_msm_gpu* tachyon_%{type}_g1_msm_gpu_ptr;
+typedef struct tachyon_%{type}_g1_msm_hybrid* tachyon_%{type}_g1_msm_hybrid_ptr;
 
 %{extern_c_front}
 
@@ -55,4 +57,102 @@ TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_point2_msm_gpu(
 TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_affine_msm_gpu(
     tachyon_%{type}_g1_msm_gpu_ptr ptr, const tachyon_%{type}_g1_affine* bases,
     const tachyon_%{type}_fr* scalars, size_t size);
+
+/**
+ * @brief Uploads projective bases to the GPU and keeps them resident until they are released.
+ * If the same bases are already resident, they are not uploaded again.
+ * @param ptr The MSM context.
+ * @param bases Array of projective points.
+ * @param size The number of points.
+ * @return A handle to the resident bases, which is the content hash of the bases.
+ */
+TACHYON_C_EXPORT uint64_t tachyon_%{type}_g1_msm_gpu_upload_point2_bases(
+    tachyon_%{type}_g1_msm_gpu_ptr ptr, const tachyon_%{type}_g1_point2* bases, size_t size);
+
+/**
+ * @brief Uploads affine bases to the GPU and keeps them resident until they are released.
+ * If the same bases are already resident, they are not uploaded again.
+ * @param ptr The MSM context.
+ * @param bases Array of affine points.
+ * @param size The number of points.
+ * @return A handle to the resident bases, which is the content hash of the bases.
+ */
+TACHYON_C_EXPORT uint64_t tachyon_%{type}_g1_msm_gpu_upload_affine_bases(
+    tachyon_%{type}_g1_msm_gpu_ptr ptr, const tachyon_%{type}_g1_affine* bases, size_t size);
+
+/**
+ * @brief Computes MSM using resident bases and scalars on the GPU. Only the scalars are uploaded.
+ * @param ptr The MSM context.
+ * @param bases_handle The handle returned by tachyon_%{type}_g1_msm_gpu_upload_point2_bases() or
+ * tachyon_%{type}_g1_msm_gpu_upload_affine_bases().
+ * @param scalars Array of scalars for the multiplication with the first |size| bases.
+ * @param size The number of scalars, which must not exceed the number of the bases.
+ * @return A pointer to the result of the MSM operation in Jacobian coordinates.
+ */
+TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_msm_gpu_with_resident_bases(
+    tachyon_%{type}_g1_msm_gpu_ptr ptr, uint64_t bases_handle,
+    const tachyon_%{type}_fr* scalars, size_t size);
+
+/**
+ * @brief Releases the resident bases from the GPU.
+ * @param ptr The MSM context.
+ * @param bases_handle The handle to the resident bases.
+ */
+TACHYON_C_EXPORT void tachyon_%{type}_g1_msm_gpu_release_bases(
+    tachyon_%{type}_g1_msm_gpu_ptr ptr, uint64_t bases_handle);
+
+/**
+ * @brief Creates a new MSM context that splits each MSM between the GPU and the CPU, running both concurrently.
+ * The split ratio starts from 0.9 on the GPU and adapts to the throughputs measured by each MSM.
+ * @param algorithm The specific algorithm to use for the GPU side of the MSM.
+ * @return A pointer to the newly created hybrid MSM context.
+ */
+TACHYON_C_EXPORT tachyon_%{type}_g1_msm_hybrid_ptr tachyon_%{type}_g1_create_msm_hybrid(int algorithm);
+
+/**
+ * @brief Destroys a hybrid MSM context, freeing its resources.
+ * @param ptr The pointer to the MSM context to destroy.
+ */
+TACHYON_C_EXPORT void tachyon_%{type}_g1_destroy_msm_hybrid(tachyon_%{type}_g1_msm_hybrid_ptr ptr);
+
+/**
+ * @brief Sets the ratio of the bases and scalars that runs on the GPU.
+ * @param ptr The MSM context.
+ * @param gpu_ratio The ratio in [0, 1].
+ * @param adaptive Whether the ratio adapts to the throughputs measured by the following MSMs.
+ */
+TACHYON_C_EXPORT void tachyon_%{type}_g1_msm_hybrid_set_gpu_ratio(
+    tachyon_%{type}_g1_msm_hybrid_ptr ptr, double gpu_ratio, bool adaptive);
+
+/**
+ * @brief Returns the ratio of the bases and scalars that the next MSM runs on the GPU.
+ * @param ptr The MSM context.
+ * @return The ratio in [0, 1].
+ */
+TACHYON_C_EXPORT double tachyon_%{type}_g1_msm_hybrid_get_gpu_ratio(
+    tachyon_%{type}_g1_msm_hybrid_ptr ptr);
+
+/**
+ * @brief Computes MSM using projective bases and scalars on both the GPU and the CPU.
+ * @param ptr The MSM context.
+ * @param bases Array of projective points to be multiplied by corresponding scalars.
+ * @param scalars Array of scalars for the multiplication.
+ * @param size The number of points and scalars (must be the same).
+ * @return A pointer to the result of the MSM operation in Jacobian coordinates.
+ */
+TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_point2_msm_hybrid(
+    tachyon_%{type}_g1_msm_hybrid_ptr ptr, const tachyon_%{type}_g1_point2* bases,
+    const tachyon_%{type}_fr* scalars, size_t size);
+
+/**
+ * @brief Computes MSM using affine bases and scalars on both the GPU and the CPU.
+ * @param ptr The MSM context.
+ * @param bases Array of affine points to be multiplied by corresponding scalars.
+ * @param scalars Array of scalars for the multiplication.
+ * @param size The number of points and scalars (must be the same).
+ * @return A pointer to the result of the MSM operation in Jacobian coordinates.
+ */
+TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_affine_msm_hybrid(
+    tachyon_%{type}_g1_msm_hybrid_ptr ptr, const tachyon_%{type}_g1_affine* bases,
+    const tachyon_%{type}_fr* scalars, size_t size);
 // clang-format on
@@ -1,20 +1,25 @@
 #ifndef TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_GPU_H_
 #define TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_GPU_H_
 
-#include <limits>
 #include <memory>
 #include <string>
+#include <string_view>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
 #include "tachyon/base/console/console_stream.h"
 #include "tachyon/base/environment.h"
 #include "tachyon/base/files/file_util.h"
+#include "tachyon/base/tuning_profile.h"
 #include "tachyon/c/base/type_traits_forward.h"
 #include "tachyon/c/math/elliptic_curves/msm/algorithm.h"
 #include "tachyon/c/math/elliptic_curves/msm/msm_input_provider.h"
+#include "tachyon/device/gpu/gpu_mem_pool_manager.h"
 #include "tachyon/device/gpu/gpu_memory.h"
-#include "tachyon/device/gpu/scoped_mem_pool.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm_gpu.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 
@@ -27,16 +32,30 @@ struct MSMGpuApi {
   using CpuCurve = typename GpuCurve::CpuCurve;
   using CpuAffinePoint = tachyon::math::AffinePoint<CpuCurve>;
 
-  tachyon::device::gpu::ScopedMemPool mem_pool;
-  tachyon::device::gpu::ScopedStream stream;
+  // Bases uploaded once by |UploadBasesGpu()| and kept on the device until
+  // they are released.
+  struct ResidentBases {
+    tachyon::device::gpu::GpuMemory<GpuAffinePoint> d_bases;
+    size_t size = 0;
+  };
+
+  // Shared with the other GPU workloads. See
+  // |tachyon::device::gpu::GpuMemPoolManager|.
+  gpuMemPool_t mem_pool = nullptr;
+  gpuStream_t stream = nullptr;
   tachyon::device::gpu::GpuMemory<GpuAffinePoint> d_bases;
   tachyon::device::gpu::GpuMemory<GpuScalarField> d_scalars;
   MSMInputProvider<CpuAffinePoint> provider;
   std::unique_ptr<tachyon::math::VariableBaseMSMGpu<GpuCurve>> msm;
+  // Keyed by the content hash of the bases.
+  absl::flat_hash_map<uint64_t, ResidentBases> resident_bases_map;
 
   std::string msm_gpu_input_dir;
   bool log_msm = false;
   size_t idx = 0;
+  // The MSMs smaller than this run on the CPU, since copying their inputs to
+  // the device costs more than they save. See |base::TuningProfile|.
+  size_t min_gpu_size = 0;
 
   MSMGpuApi(uint8_t degree, int algorithm_in) {
     tachyon::math::MSMAlgorithmKind algorithm;
@@ -51,8 +70,6 @@ struct MSMGpuApi {
         NOTREACHED() << "Not supported algorithm";
     }
 
-    GPU_MUST_SUCCESS(gpuDeviceReset(), "Failed to gpuDeviceReset()");
-
     {
       // NOTE(chokobole): This should be replaced with VLOG().
       // Currently, there's no way to delegate VLOG flags from rust side.
@@ -71,24 +88,23 @@ struct MSMGpuApi {
       if (log_msm_str == "1") log_msm = true;
     }
 
-    gpuMemPoolProps props = {gpuMemAllocationTypePinned,
-                             gpuMemHandleTypeNone,
-                             {gpuMemLocationTypeDevice, 0}};
-    mem_pool = tachyon::device::gpu::CreateMemPool(&props);
-    uint64_t mem_pool_threshold = std::numeric_limits<uint64_t>::max();
-    GPU_MUST_SUCCESS(
-        gpuMemPoolSetAttribute(mem_pool.get(), gpuMemPoolAttrReleaseThreshold,
-                               &mem_pool_threshold),
-        "Failed to gpuMemPoolSetAttribute()");
+    tachyon::device::gpu::GpuMemPoolManager& manager =
+        tachyon::device::gpu::GpuMemPoolManager::GetInstance();
+    mem_pool = manager.GetMemPool(0);
+    stream = manager.GetStream(0);
+    CHECK(mem_pool && stream);
+
+    min_gpu_size =
+        tachyon::base::TuningProfile::GetDefault()
+            .GetSize(tachyon::base::TuningProfile::kMinGpuMSMSize)
+            .value_or(0);
 
     uint64_t size = uint64_t{1} << degree;
     d_bases = tachyon::device::gpu::GpuMemory<GpuAffinePoint>::Malloc(size);
     d_scalars = tachyon::device::gpu::GpuMemory<GpuScalarField>::Malloc(size);
 
-    stream = tachyon::device::gpu::CreateStream();
-    provider.set_needs_align(true);
     msm.reset(new tachyon::math::VariableBaseMSMGpu<GpuCurve>(
-        algorithm, mem_pool.get(), stream.get()));
+        algorithm, mem_pool, stream));
   }
 };
 
@@ -100,17 +116,31 @@ CRetPoint* DoMSMGpu(MSMGpuApi<GpuCurve>& msm_api, const CPoint* bases,
                     const CScalarField* scalars, size_t size) {
   msm_api.provider.Inject(bases, scalars, size);
 
-  size_t aligned_size = msm_api.provider.bases().size();
-  CHECK(msm_api.d_bases.CopyFrom(msm_api.provider.bases().data(),
-                                 tachyon::device::gpu::GpuMemoryType::kHost, 0,
-                                 aligned_size));
-  CHECK(msm_api.d_scalars.CopyFrom(msm_api.provider.scalars().data(),
-                                   tachyon::device::gpu::GpuMemoryType::kHost,
-                                   0, aligned_size));
+  if (size < msm_api.min_gpu_size) {
+    tachyon::math::VariableBaseMSM<tachyon::math::AffinePoint<CpuCurve>>
+        cpu_msm;
+    typename tachyon::math::VariableBaseMSM<
+        tachyon::math::AffinePoint<CpuCurve>>::Bucket bucket;
+    CHECK(cpu_msm.Run(msm_api.provider.bases(), msm_api.provider.scalars(),
+                      &bucket));
+    CRetPoint* cret = new CRetPoint();
+    *cret = c::base::c_cast(
+        tachyon::math::ConvertPoint<RetPoint>(std::move(bucket)));
+    return cret;
+  }
+
+  // NOTE: The inputs are uploaded straight from the caller's memory without
+  // being padded to a power of 2, since the GPU MSMs cut their last chunk at
+  // |size|. The copies are ordered before the MSM, which runs on the same
+  // stream.
+  CHECK_LE(size, msm_api.d_bases.size());
+  CHECK(msm_api.d_bases.CopyFromPageableAsync(msm_api.provider.bases().data(),
+                                              msm_api.stream, 0, size));
+  CHECK(msm_api.d_scalars.CopyFromPageableAsync(
+      msm_api.provider.scalars().data(), msm_api.stream, 0, size));
 
   RetPoint ret;
-  CHECK(
-      msm_api.msm->Run(msm_api.d_bases, msm_api.d_scalars, aligned_size, &ret));
+  CHECK(msm_api.msm->Run(msm_api.d_bases, msm_api.d_scalars, size, &ret));
   CRetPoint* cret = new CRetPoint();
   *cret = c::base::c_cast(ret);
 
@@ -148,6 +178,78 @@ CRetPoint* DoMSMGpu(MSMGpuApi<GpuCurve>& msm_api, const CPoint* bases,
   return cret;
 }
 
+// Uploads |bases| to the device unless the same bases are already resident,
+// and returns the handle to them. The handle is the content hash of the
+// bases, so uploading the same bases again only costs hashing them.
+template <typename GpuCurve, typename CPoint>
+uint64_t UploadBasesGpu(MSMGpuApi<GpuCurve>& msm_api, const CPoint* bases,
+                        size_t size) {
+  using CpuAffinePoint = typename MSMGpuApi<GpuCurve>::CpuAffinePoint;
+  using GpuAffinePoint = typename MSMGpuApi<GpuCurve>::GpuAffinePoint;
+
+  const CpuAffinePoint* native_bases =
+      reinterpret_cast<const CpuAffinePoint*>(bases);
+  uint64_t handle = absl::Hash<std::string_view>()(
+      std::string_view(reinterpret_cast<const char*>(native_bases),
+                       sizeof(CpuAffinePoint) * size));
+  auto it = msm_api.resident_bases_map.find(handle);
+  if (it != msm_api.resident_bases_map.end()) {
+    CHECK_EQ(it->second.size, size) << "Hash collision between base sets";
+    return handle;
+  }
+
+  typename MSMGpuApi<GpuCurve>::ResidentBases resident_bases;
+  resident_bases.d_bases =
+      tachyon::device::gpu::GpuMemory<GpuAffinePoint>::Malloc(size);
+  CHECK(resident_bases.d_bases.CopyFrom(
+      native_bases, tachyon::device::gpu::GpuMemoryType::kHost));
+  resident_bases.size = size;
+  msm_api.resident_bases_map[handle] = std::move(resident_bases);
+  return handle;
+}
+
+// Same as |DoMSMGpu()|, but only uploads |scalars|, which are multiplied by
+// the first |size| bases of |bases_handle| returned by |UploadBasesGpu()|.
+template <typename RetPoint, typename GpuCurve, typename CScalarField,
+          typename CRetPoint = typename PointTraits<RetPoint>::CCurvePoint>
+CRetPoint* DoMSMGpuWithResidentBases(MSMGpuApi<GpuCurve>& msm_api,
+                                     uint64_t bases_handle,
+                                     const CScalarField* scalars,
+                                     size_t size) {
+  auto it = msm_api.resident_bases_map.find(bases_handle);
+  CHECK(it != msm_api.resident_bases_map.end())
+      << "Unknown bases handle: " << bases_handle;
+  const typename MSMGpuApi<GpuCurve>::ResidentBases& resident_bases =
+      it->second;
+  CHECK_LE(size, resident_bases.size);
+
+  msm_api.provider.InjectScalars(scalars, size);
+  CHECK_LE(size, msm_api.d_scalars.size());
+  CHECK(msm_api.d_scalars.CopyFromPageableAsync(
+      msm_api.provider.scalars().data(), msm_api.stream, 0, size));
+
+  RetPoint ret;
+  CHECK(msm_api.msm->Run(resident_bases.d_bases, msm_api.d_scalars, size,
+                         &ret));
+  CRetPoint* cret = new CRetPoint();
+  *cret = c::base::c_cast(ret);
+
+  if (msm_api.log_msm) {
+    // NOTE(chokobole): This should be replaced with VLOG().
+    // Currently, there's no way to delegate VLOG flags from rust side.
+    tachyon::base::ConsoleStream cs;
+    cs.Yellow();
+    std::cout << "DoMSMGpuWithResidentBases()" << msm_api.idx++ << std::endl;
+    std::cout << ret.ToHexString() << std::endl;
+  }
+  return cret;
+}
+
+template <typename GpuCurve>
+void ReleaseBasesGpu(MSMGpuApi<GpuCurve>& msm_api, uint64_t bases_handle) {
+  msm_api.resident_bases_map.erase(bases_handle);
+}
+
 }  // namespace tachyon::c::math
 
 #endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_GPU_H_
@@ -72,4 +72,70 @@ TEST_P(MSMGpuTest, MSMG1Affine) {
   tachyon_bn254_g1_destroy_msm_gpu(msm);
 }
 
+TEST_P(MSMGpuTest, MSMWithResidentBases) {
+  size_t max_num = *std::max_element(std::begin(kNums), std::end(kNums));
+  tachyon_bn254_g1_msm_gpu_ptr msm = tachyon_bn254_g1_create_msm_gpu(
+      base::bits::Log2Ceiling(max_num), GetParam());
+
+  for (const VariableBaseMSMTestSet<bn254::G1AffinePoint>& t :
+       this->test_sets_) {
+    uint64_t handle = tachyon_bn254_g1_msm_gpu_upload_affine_bases(
+        msm, c::base::c_cast(t.bases.data()), t.bases.size());
+    // Uploading the same bases again returns the same handle.
+    EXPECT_EQ(tachyon_bn254_g1_msm_gpu_upload_affine_bases(
+                  msm, c::base::c_cast(t.bases.data()), t.bases.size()),
+              handle);
+
+    for (size_t i = 0; i < 2; ++i) {
+      std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
+      ret.reset(tachyon_bn254_g1_msm_gpu_with_resident_bases(
+          msm, handle, c::base::c_cast(t.scalars.data()), t.scalars.size()));
+      EXPECT_EQ(c::base::native_cast(*ret), t.answer.ToJacobian());
+    }
+
+    // Multiplies with a prefix of the resident bases.
+    size_t prefix_size = t.scalars.size() - 1;
+    bn254::G1JacobianPoint expected = bn254::G1JacobianPoint::Zero();
+    for (size_t i = 0; i < prefix_size; ++i) {
+      expected += t.bases[i] * t.scalars[i];
+    }
+    std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
+    ret.reset(tachyon_bn254_g1_msm_gpu_with_resident_bases(
+        msm, handle, c::base::c_cast(t.scalars.data()), prefix_size));
+    EXPECT_EQ(c::base::native_cast(*ret), expected);
+
+    tachyon_bn254_g1_msm_gpu_release_bases(msm, handle);
+  }
+  tachyon_bn254_g1_destroy_msm_gpu(msm);
+}
+
+TEST_P(MSMGpuTest, MSMHybrid) {
+  tachyon_bn254_g1_msm_hybrid_ptr msm =
+      tachyon_bn254_g1_create_msm_hybrid(GetParam());
+
+  // Splits the MSMs evenly, and then lets the ratio adapt.
+  tachyon_bn254_g1_msm_hybrid_set_gpu_ratio(msm, 0.5, true);
+  for (const VariableBaseMSMTestSet<bn254::G1AffinePoint>& t :
+       this->test_sets_) {
+    std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
+    ret.reset(tachyon_bn254_g1_affine_msm_hybrid(
+        msm, c::base::c_cast(t.bases.data()), c::base::c_cast(t.scalars.data()),
+        t.scalars.size()));
+    EXPECT_EQ(c::base::native_cast(*ret), t.answer.ToJacobian());
+
+    std::vector<Point2<bn254::Fq>> bases =
+        base::CreateVector(t.bases.size(), [&t](size_t i) {
+          return Point2<bn254::Fq>(t.bases[i].x(), t.bases[i].y());
+        });
+    ret.reset(tachyon_bn254_g1_point2_msm_hybrid(
+        msm, c::base::c_cast(bases.data()), c::base::c_cast(t.scalars.data()),
+        t.scalars.size()));
+    EXPECT_EQ(c::base::native_cast(*ret), t.answer.ToJacobian());
+  }
+  double gpu_ratio = tachyon_bn254_g1_msm_hybrid_get_gpu_ratio(msm);
+  EXPECT_GE(gpu_ratio, 0.0);
+  EXPECT_LE(gpu_ratio, 1.0);
+  tachyon_bn254_g1_destroy_msm_hybrid(msm);
+}
+
 }  // namespace tachyon::math
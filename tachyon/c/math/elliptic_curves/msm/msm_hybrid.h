@@ -0,0 +1,74 @@
+#ifndef TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_HYBRID_H_
+#define TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_HYBRID_H_
+
+#include <iostream>
+#include <memory>
+
+#include "tachyon/base/console/console_stream.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/c/base/type_traits_forward.h"
+#include "tachyon/c/math/elliptic_curves/msm/algorithm.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm_input_provider.h"
+#include "tachyon/device/gpu/gpu_mem_pool_manager.h"
+#include "tachyon/math/elliptic_curves/affine_point.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm_hybrid.h"
+
+namespace tachyon::c::math {
+
+template <typename GpuCurve>
+struct MSMHybridApi {
+  using CpuCurve = typename GpuCurve::CpuCurve;
+  using CpuAffinePoint = tachyon::math::AffinePoint<CpuCurve>;
+
+  MSMInputProvider<CpuAffinePoint> provider;
+  std::unique_ptr<tachyon::math::VariableBaseMSMHybrid<GpuCurve>> msm;
+
+  explicit MSMHybridApi(int algorithm_in) {
+    tachyon::math::MSMAlgorithmKind algorithm;
+    switch (algorithm_in) {
+      case TACHYON_MSM_ALGO_BELLMAN_MSM:
+        algorithm = tachyon::math::MSMAlgorithmKind::kBellmanMSM;
+        break;
+      case TACHYON_MSM_ALGO_CUZK:
+        algorithm = tachyon::math::MSMAlgorithmKind::kCUZK;
+        break;
+      default:
+        NOTREACHED() << "Not supported algorithm";
+    }
+
+    {
+      // NOTE(chokobole): This should be replaced with VLOG().
+      // Currently, there's no way to delegate VLOG flags from rust side.
+      tachyon::base::ConsoleStream cs;
+      cs.Green();
+      std::cout << "CreateMSMHybridApi()" << std::endl;
+    }
+
+    // The GPU side runs on the device 0, like |MSMGpuApi|.
+    tachyon::device::gpu::GpuMemPoolManager& manager =
+        tachyon::device::gpu::GpuMemPoolManager::GetInstance();
+    gpuMemPool_t mem_pool = manager.GetMemPool(0);
+    gpuStream_t stream = manager.GetStream(0);
+    CHECK(mem_pool && stream);
+    msm.reset(new tachyon::math::VariableBaseMSMHybrid<GpuCurve>(
+        algorithm, mem_pool, stream));
+  }
+};
+
+template <typename RetPoint, typename GpuCurve, typename CPoint,
+          typename CScalarField,
+          typename CRetPoint = typename PointTraits<RetPoint>::CCurvePoint>
+CRetPoint* DoMSMHybrid(MSMHybridApi<GpuCurve>& msm_api, const CPoint* bases,
+                       const CScalarField* scalars, size_t size) {
+  msm_api.provider.Inject(bases, scalars, size);
+  RetPoint ret;
+  CHECK(msm_api.msm->Run(msm_api.provider.bases(), msm_api.provider.scalars(),
+                         &ret));
+  CRetPoint* cret = new CRetPoint();
+  *cret = c::base::c_cast(ret);
+  return cret;
+}
+
+}  // namespace tachyon::c::math
+
+#endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_HYBRID_H_
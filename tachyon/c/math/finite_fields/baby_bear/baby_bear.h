@@ -0,0 +1,23 @@
+/**
+ * @file baby_bear.h
+ * @brief Defines the element of the BabyBear field.
+ */
+#ifndef TACHYON_C_MATH_FINITE_FIELDS_BABY_BEAR_BABY_BEAR_H_
+#define TACHYON_C_MATH_FINITE_FIELDS_BABY_BEAR_BABY_BEAR_H_
+
+#include <stdint.h>
+
+/**
+ * @struct tachyon_baby_bear
+ * @brief Represents an element of the BabyBear field, whose modulus is
+ * 2³¹ - 2²⁷ + 1.
+ *
+ * The element is stored in its Montgomery form with R = 2³², which is the same
+ * representation as the one of plonky3, so that the elements are passed
+ * across the FFI boundary without any conversion.
+ */
+struct tachyon_baby_bear {
+  uint32_t value;
+};
+
+#endif  // TACHYON_C_MATH_FINITE_FIELDS_BABY_BEAR_BABY_BEAR_H_
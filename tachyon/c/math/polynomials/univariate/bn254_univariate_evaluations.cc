@@ -1,5 +1,8 @@
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_evaluations.h"
 
+#include <vector>
+
+#include "tachyon/base/logging.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fr_type_traits.h"
 #include "tachyon/c/math/polynomials/constants.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
@@ -38,3 +41,15 @@ void tachyon_bn254_univariate_evaluations_set_value(
   reinterpret_cast<Evals&>(*evals).at(i) =
       tachyon::c::base::native_cast(*value);
 }
+
+void tachyon_bn254_univariate_evaluations_set_range(
+    tachyon_bn254_univariate_evaluations* evals, size_t start,
+    const tachyon_bn254_fr* values, size_t len) {
+  std::vector<bn254::Fr>& cpp_evaluations =
+      reinterpret_cast<Evals&>(*evals).evaluations();
+  CHECK_LE(start + len, cpp_evaluations.size());
+  bn254::Fr* cpp_values = &cpp_evaluations[start];
+  for (size_t i = 0; i < len; ++i) {
+    cpp_values[i] = tachyon::c::base::native_cast(values[i]);
+  }
+}
@@ -78,6 +78,22 @@ TACHYON_C_EXPORT void tachyon_bn254_univariate_evaluations_set_value(
     tachyon_bn254_univariate_evaluations* evals, size_t i,
     const tachyon_bn254_fr* value);
 
+/**
+ * @brief Sets a contiguous range of the univariate evaluations structure.
+ *
+ * Sets the values at [@p start, @p start + @p len) to @p values with a single
+ * bounds check, which is cheaper than setting them one by one across the FFI
+ * boundary.
+ *
+ * @param evals Pointer to the evaluations structure.
+ * @param start Index of the first value to set.
+ * @param values Pointer to the @p len values to set.
+ * @param len Number of the values to set.
+ */
+TACHYON_C_EXPORT void tachyon_bn254_univariate_evaluations_set_range(
+    tachyon_bn254_univariate_evaluations* evals, size_t start,
+    const tachyon_bn254_fr* values, size_t len);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -1,7 +1,10 @@
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_evaluations.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fr_type_traits.h"
 #include "tachyon/c/math/polynomials/constants.h"
@@ -56,4 +59,14 @@ TEST_F(UnivariateEvaluationsTest, SetValue) {
   EXPECT_EQ(reinterpret_cast<Evals&>(*evals_)[0], cpp_value);
 }
 
+TEST_F(UnivariateEvaluationsTest, SetRange) {
+  std::vector<bn254::Fr> cpp_values =
+      base::CreateVector(kDegree, []() { return bn254::Fr::Random(); });
+  tachyon_bn254_univariate_evaluations_set_range(
+      evals_, 1, c::base::c_cast(cpp_values.data()), cpp_values.size());
+  for (size_t i = 0; i < cpp_values.size(); ++i) {
+    EXPECT_EQ(reinterpret_cast<Evals&>(*evals_)[i + 1], cpp_values[i]);
+  }
+}
+
 }  // namespace tachyon::math
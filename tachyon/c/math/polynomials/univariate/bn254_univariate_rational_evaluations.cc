@@ -66,6 +66,48 @@ void tachyon_bn254_univariate_rational_evaluations_set_rational(
   };
 }
 
+void tachyon_bn254_univariate_rational_evaluations_set_range(
+    tachyon_bn254_univariate_rational_evaluations* evals, size_t start,
+    const tachyon_bn254_fr* numerators, const tachyon_bn254_fr* denominators,
+    size_t len) {
+  std::vector<RationalField<bn254::Fr>>& cpp_evaluations =
+      reinterpret_cast<RationalEvals&>(*evals).evaluations();
+  CHECK_LE(start + len, cpp_evaluations.size());
+  RationalField<bn254::Fr>* cpp_values = &cpp_evaluations[start];
+  if (denominators == nullptr) {
+    for (size_t i = 0; i < len; ++i) {
+      cpp_values[i] = RationalField<bn254::Fr>(
+          tachyon::c::base::native_cast(numerators[i]));
+    }
+    return;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    cpp_values[i] = {tachyon::c::base::native_cast(numerators[i]),
+                     tachyon::c::base::native_cast(denominators[i])};
+  }
+}
+
+void tachyon_bn254_univariate_rational_evaluations_set_batch(
+    tachyon_bn254_univariate_rational_evaluations* evals, const size_t* indices,
+    const tachyon_bn254_fr* numerators, const tachyon_bn254_fr* denominators,
+    size_t len) {
+  std::vector<RationalField<bn254::Fr>>& cpp_evaluations =
+      reinterpret_cast<RationalEvals&>(*evals).evaluations();
+  size_t size = cpp_evaluations.size();
+  for (size_t i = 0; i < len; ++i) {
+    CHECK_LT(indices[i], size);
+    if (denominators == nullptr) {
+      cpp_evaluations[indices[i]] = RationalField<bn254::Fr>(
+          tachyon::c::base::native_cast(numerators[i]));
+    } else {
+      cpp_evaluations[indices[i]] = {
+          tachyon::c::base::native_cast(numerators[i]),
+          tachyon::c::base::native_cast(denominators[i]),
+      };
+    }
+  }
+}
+
 tachyon_bn254_univariate_evaluations*
 tachyon_bn254_univariate_rational_evaluations_batch_evaluate(
     const tachyon_bn254_univariate_rational_evaluations* rational_evals) {
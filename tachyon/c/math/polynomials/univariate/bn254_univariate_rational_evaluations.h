@@ -105,6 +105,45 @@ tachyon_bn254_univariate_rational_evaluations_set_rational(
     tachyon_bn254_univariate_rational_evaluations* evals, size_t i,
     const tachyon_bn254_fr* numerator, const tachyon_bn254_fr* denominator);
 
+/**
+ * @brief Sets a contiguous range of the rational evaluations structure.
+ *
+ * Sets the values at [@p start, @p start + @p len) to @p numerators[i] /
+ * @p denominators[i] with a single bounds check, which is cheaper than
+ * setting them one by one across the FFI boundary.
+ *
+ * @param evals Pointer to the rational evaluations structure.
+ * @param start Index of the first value to set.
+ * @param numerators Pointer to the @p len numerators.
+ * @param denominators Pointer to the @p len denominators, or NULL if every
+ * denominator is one.
+ * @param len Number of the values to set.
+ */
+TACHYON_C_EXPORT void tachyon_bn254_univariate_rational_evaluations_set_range(
+    tachyon_bn254_univariate_rational_evaluations* evals, size_t start,
+    const tachyon_bn254_fr* numerators, const tachyon_bn254_fr* denominators,
+    size_t len);
+
+/**
+ * @brief Sets a batch of the values at the given indices of the rational
+ * evaluations structure.
+ *
+ * Sets the value at @p indices[i] to @p numerators[i] / @p denominators[i] for
+ * every i in [0, @p len). The indices don't have to be sorted, and the last
+ * one wins if an index appears more than once.
+ *
+ * @param evals Pointer to the rational evaluations structure.
+ * @param indices Pointer to the @p len indices.
+ * @param numerators Pointer to the @p len numerators.
+ * @param denominators Pointer to the @p len denominators, or NULL if every
+ * denominator is one.
+ * @param len Number of the values to set.
+ */
+TACHYON_C_EXPORT void tachyon_bn254_univariate_rational_evaluations_set_batch(
+    tachyon_bn254_univariate_rational_evaluations* evals, const size_t* indices,
+    const tachyon_bn254_fr* numerators, const tachyon_bn254_fr* denominators,
+    size_t len);
+
 /**
  * @brief Performs a batch evaluation on the rational evaluations structure.
  *
@@ -81,6 +81,59 @@ TEST_F(UnivariateRationalEvaluationsTest, SetRational) {
   EXPECT_EQ(reinterpret_cast<RationalEvals&>(*evals_)[0], expected);
 }
 
+TEST_F(UnivariateRationalEvaluationsTest, SetRange) {
+  std::vector<RationalField<bn254::Fr>> expected = base::CreateVector(
+      3, []() { return RationalField<bn254::Fr>::Random(); });
+  std::vector<bn254::Fr> numerators = base::Map(
+      expected,
+      [](const RationalField<bn254::Fr>& value) { return value.numerator(); });
+  std::vector<bn254::Fr> denominators =
+      base::Map(expected, [](const RationalField<bn254::Fr>& value) {
+        return value.denominator();
+      });
+  tachyon_bn254_univariate_rational_evaluations_set_range(
+      evals_, 2, c::base::c_cast(numerators.data()),
+      c::base::c_cast(denominators.data()), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(reinterpret_cast<RationalEvals&>(*evals_)[2 + i], expected[i]);
+  }
+
+  tachyon_bn254_univariate_rational_evaluations_set_range(
+      evals_, 0, c::base::c_cast(numerators.data()), nullptr, 2);
+  for (size_t i = 0; i < 2; ++i) {
+    EXPECT_EQ(reinterpret_cast<RationalEvals&>(*evals_)[i],
+              RationalField<bn254::Fr>(numerators[i]));
+  }
+}
+
+TEST_F(UnivariateRationalEvaluationsTest, SetBatch) {
+  std::vector<size_t> indices = {4, 0, 2};
+  std::vector<RationalField<bn254::Fr>> expected = base::CreateVector(
+      indices.size(), []() { return RationalField<bn254::Fr>::Random(); });
+  std::vector<bn254::Fr> numerators = base::Map(
+      expected,
+      [](const RationalField<bn254::Fr>& value) { return value.numerator(); });
+  std::vector<bn254::Fr> denominators =
+      base::Map(expected, [](const RationalField<bn254::Fr>& value) {
+        return value.denominator();
+      });
+  tachyon_bn254_univariate_rational_evaluations_set_batch(
+      evals_, indices.data(), c::base::c_cast(numerators.data()),
+      c::base::c_cast(denominators.data()), indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_EQ(reinterpret_cast<RationalEvals&>(*evals_)[indices[i]],
+              expected[i]);
+  }
+
+  tachyon_bn254_univariate_rational_evaluations_set_batch(
+      evals_, indices.data(), c::base::c_cast(numerators.data()), nullptr,
+      indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_EQ(reinterpret_cast<RationalEvals&>(*evals_)[indices[i]],
+              RationalField<bn254::Fr>(numerators[i]));
+  }
+}
+
 TEST_F(UnivariateRationalEvaluationsTest, BatchEvaluate) {
   std::vector<RationalField<bn254::Fr>> rational_values = base::CreateVector(
       kDegree + 1, []() { return RationalField<bn254::Fr>::Random(); });
@@ -0,0 +1,160 @@
+#include "tachyon/c/zk/air/sp1/baby_bear_poseidon2_two_adic_fri.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/c/math/finite_fields/baby_bear/baby_bear_type_traits.h"
+#include "tachyon/c/math/polynomials/constants.h"
+#include "tachyon/crypto/commitments/merkle_tree/field_merkle_tree/field_merkle_tree_mmcs.h"
+#include "tachyon/crypto/hashes/sponge/padding_free_sponge.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/baby_bear_t16_poseidon2_config.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_plonky3_external_matrix.h"
+#include "tachyon/crypto/hashes/sponge/truncated_permutation.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+using namespace tachyon;
+
+using F = math::BabyBear;
+using Poseidon2 = crypto::Poseidon2Sponge<
+    crypto::Poseidon2ExternalMatrix<crypto::Poseidon2Plonky3ExternalMatrix<F>>>;
+
+constexpr size_t kRate = 8;
+constexpr size_t kChunk = TACHYON_SP1_BABY_BEAR_POSEIDON2_DIGEST_SIZE;
+constexpr size_t kWidth = TACHYON_SP1_BABY_BEAR_POSEIDON2_WIDTH;
+
+using Hasher = crypto::PaddingFreeSponge<Poseidon2, kRate, kChunk>;
+using Compressor = crypto::TruncatedPermutation<Poseidon2, kChunk, 2>;
+using MMCS = crypto::FieldMerkleTreeMMCS<F, Hasher, Compressor, kChunk>;
+using Tree = MMCS::ProverData;
+using Domain = math::Radix2EvaluationDomain<F, c::math::kMaxDegree>;
+
+namespace {
+
+class TwoAdicFri {
+ public:
+  TwoAdicFri(uint32_t log_blowup, const Poseidon2& sponge)
+      : log_blowup_(log_blowup), mmcs_(Hasher(sponge), Compressor(sponge)) {}
+
+  const MMCS& mmcs() const { return mmcs_; }
+
+  // Transposes the rows into the columns to extend them, and transposes the
+  // extended columns back into the rows. The extensions are already in
+  // bit-reversed order, so nothing is permuted.
+  void CosetLDEBatch(const F* values, size_t rows, size_t cols,
+                     const F& shift, F* extended_values) const {
+    CHECK(base::bits::IsPowerOfTwo(rows));
+    std::vector<Domain::Evals> columns(cols);
+    OPENMP_PARALLEL_FOR(size_t j = 0; j < cols; ++j) {
+      std::vector<F> column(rows);
+      for (size_t i = 0; i < rows; ++i) {
+        column[i] = values[i * cols + j];
+      }
+      columns[j] = Domain::Evals(std::move(column));
+    }
+    std::unique_ptr<Domain> domain = Domain::Create(rows);
+    columns = domain->LDEBatchBitReversed(
+        std::move(columns), size_t{1} << log_blowup_, shift);
+
+    size_t extended_rows = rows << log_blowup_;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < extended_rows; ++i) {
+      F* row = &extended_values[i * cols];
+      for (size_t j = 0; j < cols; ++j) {
+        row[j] = columns[j].evaluations()[i];
+      }
+    }
+  }
+
+ private:
+  uint32_t log_blowup_;
+  MMCS mmcs_;
+};
+
+crypto::Poseidon2Config<F> CreatePoseidon2Config(const F* round_constants) {
+  static_assert(kWidth == 16);
+  crypto::Poseidon2Config<F> config = crypto::GetBabyBearT16Poseidon2Config();
+  if (round_constants != nullptr) {
+    for (Eigen::Index i = 0; i < config.ark.rows(); ++i) {
+      for (Eigen::Index j = 0; j < config.ark.cols(); ++j) {
+        config.ark(i, j) = round_constants[i * kWidth + j];
+      }
+    }
+  }
+  return config;
+}
+
+}  // namespace
+
+tachyon_sp1_baby_bear_poseidon2_two_adic_fri*
+tachyon_sp1_baby_bear_poseidon2_two_adic_fri_create(
+    uint32_t log_blowup, const tachyon_baby_bear* round_constants) {
+  Poseidon2 sponge(
+      CreatePoseidon2Config(c::base::native_cast(round_constants)));
+  return reinterpret_cast<tachyon_sp1_baby_bear_poseidon2_two_adic_fri*>(
+      new TwoAdicFri(log_blowup, sponge));
+}
+
+void tachyon_sp1_baby_bear_poseidon2_two_adic_fri_destroy(
+    tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs) {
+  delete reinterpret_cast<TwoAdicFri*>(pcs);
+}
+
+void tachyon_sp1_baby_bear_poseidon2_two_adic_fri_coset_lde_batch(
+    const tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs,
+    const tachyon_baby_bear* values, size_t rows, size_t cols,
+    tachyon_baby_bear shift, tachyon_baby_bear* extended_values) {
+  reinterpret_cast<const TwoAdicFri*>(pcs)->CosetLDEBatch(
+      c::base::native_cast(values), rows, cols, c::base::native_cast(shift),
+      c::base::native_cast(extended_values));
+}
+
+tachyon_sp1_baby_bear_poseidon2_field_merkle_tree*
+tachyon_sp1_baby_bear_poseidon2_two_adic_fri_commit(
+    const tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs,
+    const tachyon_baby_bear* const* matrices, const size_t* rows,
+    const size_t* cols, size_t num_matrices, tachyon_baby_bear* commitment) {
+  std::vector<math::RowMajorMatrix<F>> leaves(num_matrices);
+  for (size_t i = 0; i < num_matrices; ++i) {
+    leaves[i] = Eigen::Map<const math::RowMajorMatrix<F>>(
+        c::base::native_cast(matrices[i]), static_cast<Eigen::Index>(rows[i]),
+        static_cast<Eigen::Index>(cols[i]));
+  }
+  MMCS::Commitment cpp_commitment;
+  std::unique_ptr<Tree> tree(new Tree());
+  CHECK(reinterpret_cast<const TwoAdicFri*>(pcs)->mmcs().Commit(
+      std::move(leaves), &cpp_commitment, tree.get()));
+  for (size_t i = 0; i < kChunk; ++i) {
+    commitment[i] = c::base::c_cast(cpp_commitment[i]);
+  }
+  return reinterpret_cast<tachyon_sp1_baby_bear_poseidon2_field_merkle_tree*>(
+      tree.release());
+}
+
+void tachyon_sp1_baby_bear_poseidon2_two_adic_fri_open(
+    const tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs,
+    const tachyon_sp1_baby_bear_poseidon2_field_merkle_tree* tree,
+    size_t index, tachyon_baby_bear* openings, tachyon_baby_bear* proof) {
+  std::vector<std::vector<F>> cpp_openings;
+  MMCS::Proof cpp_proof;
+  CHECK(reinterpret_cast<const TwoAdicFri*>(pcs)->mmcs().CreateOpeningProof(
+      index, *reinterpret_cast<const Tree*>(tree), &cpp_openings,
+      &cpp_proof));
+  F* opening = c::base::native_cast(openings);
+  for (const std::vector<F>& row : cpp_openings) {
+    opening = std::copy(row.begin(), row.end(), opening);
+  }
+  F* sibling = c::base::native_cast(proof);
+  for (const MMCS::Digest& digest : cpp_proof) {
+    sibling = std::copy(digest.begin(), digest.end(), sibling);
+  }
+}
+
+void tachyon_sp1_baby_bear_poseidon2_field_merkle_tree_destroy(
+    tachyon_sp1_baby_bear_poseidon2_field_merkle_tree* tree) {
+  delete reinterpret_cast<Tree*>(tree);
+}
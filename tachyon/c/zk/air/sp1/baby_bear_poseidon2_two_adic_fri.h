@@ -0,0 +1,147 @@
+/**
+ * @file baby_bear_poseidon2_two_adic_fri.h
+ * @brief Defines the interface for the prover side of the TwoAdicFriPcs of
+ * SP1 over BabyBear, whose input matrices are committed by a field merkle tree
+ * of Poseidon2.
+ */
+
+#ifndef TACHYON_C_ZK_AIR_SP1_BABY_BEAR_POSEIDON2_TWO_ADIC_FRI_H_
+#define TACHYON_C_ZK_AIR_SP1_BABY_BEAR_POSEIDON2_TWO_ADIC_FRI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/c/export.h"
+#include "tachyon/c/math/finite_fields/baby_bear/baby_bear.h"
+
+// The number of the field elements of a digest of the field merkle tree.
+#define TACHYON_SP1_BABY_BEAR_POSEIDON2_DIGEST_SIZE 8
+// The width of the Poseidon2 permutation.
+#define TACHYON_SP1_BABY_BEAR_POSEIDON2_WIDTH 16
+// The number of the rounds of the Poseidon2 permutation, 8 full rounds and 13
+// partial rounds.
+#define TACHYON_SP1_BABY_BEAR_POSEIDON2_ROUNDS 21
+
+/**
+ * @struct tachyon_sp1_baby_bear_poseidon2_two_adic_fri
+ * @brief Represents the prover side of the TwoAdicFriPcs, which computes the
+ * low-degree extensions of the input matrices and commits to them.
+ */
+struct tachyon_sp1_baby_bear_poseidon2_two_adic_fri {};
+
+/**
+ * @struct tachyon_sp1_baby_bear_poseidon2_field_merkle_tree
+ * @brief Represents the prover data of a commitment, which is the field merkle
+ * tree over the committed matrices.
+ */
+struct tachyon_sp1_baby_bear_poseidon2_field_merkle_tree {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Creates a new TwoAdicFriPcs prover.
+ *
+ * The Poseidon2 permutation uses the external and the internal matrices of
+ * plonky3. If @p round_constants is NULL, the round constants are generated
+ * by the Grain LFSR as in the reference implementation. Otherwise, it must
+ * point to TACHYON_SP1_BABY_BEAR_POSEIDON2_ROUNDS *
+ * TACHYON_SP1_BABY_BEAR_POSEIDON2_WIDTH round constants, indexed by
+ * (round * TACHYON_SP1_BABY_BEAR_POSEIDON2_WIDTH + i).
+ *
+ * @param log_blowup The log of the blowup factor of the low-degree extensions.
+ * @param round_constants The round constants of Poseidon2, or NULL.
+ * @return A pointer to the newly created prover.
+ */
+TACHYON_C_EXPORT tachyon_sp1_baby_bear_poseidon2_two_adic_fri*
+tachyon_sp1_baby_bear_poseidon2_two_adic_fri_create(
+    uint32_t log_blowup, const tachyon_baby_bear* round_constants);
+
+/**
+ * @brief Destroys a TwoAdicFriPcs prover, freeing its resources.
+ *
+ * @param pcs The prover to destroy.
+ */
+TACHYON_C_EXPORT void tachyon_sp1_baby_bear_poseidon2_two_adic_fri_destroy(
+    tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs);
+
+/**
+ * @brief Computes the low-degree extension of a matrix over a coset.
+ *
+ * @p values are the @p rows x @p cols evaluations in row-major order over the
+ * subgroup of size @p rows, which must be a power of two. Every column is
+ * extended to the coset of @p shift of the subgroup that is larger by the
+ * blowup factor, and the rows of the result are written to
+ * @p extended_values in bit-reversed order, which must have room for
+ * (@p rows << log_blowup) x @p cols elements.
+ *
+ * @param pcs The prover.
+ * @param values The evaluations of the columns in row-major order.
+ * @param rows The number of the rows.
+ * @param cols The number of the columns.
+ * @param shift The shift of the coset.
+ * @param extended_values The buffer to store the low-degree extension.
+ */
+TACHYON_C_EXPORT void
+tachyon_sp1_baby_bear_poseidon2_two_adic_fri_coset_lde_batch(
+    const tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs,
+    const tachyon_baby_bear* values, size_t rows, size_t cols,
+    tachyon_baby_bear shift, tachyon_baby_bear* extended_values);
+
+/**
+ * @brief Commits to the matrices with the field merkle tree.
+ *
+ * The i-th matrix is @p rows[i] x @p cols[i] elements in row-major order at
+ * @p matrices[i], and every height must be a power of two. The matrices are
+ * copied into the returned tree, so they can be freed after this returns.
+ *
+ * @param pcs The prover.
+ * @param matrices The pointers to the matrices.
+ * @param rows The numbers of the rows of the matrices.
+ * @param cols The numbers of the columns of the matrices.
+ * @param num_matrices The number of the matrices, which must not be zero.
+ * @param commitment The buffer to store the root of the tree, which must have
+ * room for TACHYON_SP1_BABY_BEAR_POSEIDON2_DIGEST_SIZE elements.
+ * @return A pointer to the tree, which serves as the prover data.
+ */
+TACHYON_C_EXPORT tachyon_sp1_baby_bear_poseidon2_field_merkle_tree*
+tachyon_sp1_baby_bear_poseidon2_two_adic_fri_commit(
+    const tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs,
+    const tachyon_baby_bear* const* matrices, const size_t* rows,
+    const size_t* cols, size_t num_matrices, tachyon_baby_bear* commitment);
+
+/**
+ * @brief Opens the rows at an index of the committed matrices.
+ *
+ * @p index is a row index of the tallest matrices, which is shifted down for
+ * the shorter ones. The opened rows are concatenated in the order of the
+ * matrices into @p openings, which must have room for the sum of the numbers
+ * of the columns. The siblings on the path from the leaf to the root are
+ * written to @p proof, which must have room for log2(max height) *
+ * TACHYON_SP1_BABY_BEAR_POSEIDON2_DIGEST_SIZE elements.
+ *
+ * @param pcs The prover.
+ * @param tree The tree returned by the commitment.
+ * @param index The row index to open.
+ * @param openings The buffer to store the opened rows.
+ * @param proof The buffer to store the opening proof.
+ */
+TACHYON_C_EXPORT void tachyon_sp1_baby_bear_poseidon2_two_adic_fri_open(
+    const tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs,
+    const tachyon_sp1_baby_bear_poseidon2_field_merkle_tree* tree,
+    size_t index, tachyon_baby_bear* openings, tachyon_baby_bear* proof);
+
+/**
+ * @brief Destroys a field merkle tree, freeing its resources.
+ *
+ * @param tree The tree to destroy.
+ */
+TACHYON_C_EXPORT void tachyon_sp1_baby_bear_poseidon2_field_merkle_tree_destroy(
+    tachyon_sp1_baby_bear_poseidon2_field_merkle_tree* tree);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // TACHYON_C_ZK_AIR_SP1_BABY_BEAR_POSEIDON2_TWO_ADIC_FRI_H_
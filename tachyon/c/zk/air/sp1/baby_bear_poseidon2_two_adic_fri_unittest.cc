@@ -0,0 +1,139 @@
+#include "tachyon/c/zk/air/sp1/baby_bear_poseidon2_two_adic_fri.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/c/math/finite_fields/baby_bear/baby_bear_type_traits.h"
+#include "tachyon/c/math/polynomials/constants.h"
+#include "tachyon/crypto/commitments/merkle_tree/field_merkle_tree/field_merkle_tree_mmcs.h"
+#include "tachyon/crypto/hashes/sponge/padding_free_sponge.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_plonky3_external_matrix.h"
+#include "tachyon/crypto/hashes/sponge/truncated_permutation.h"
+#include "tachyon/math/finite_fields/baby_bear/poseidon2.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+constexpr uint32_t kLogBlowup = 1;
+constexpr size_t kChunk = TACHYON_SP1_BABY_BEAR_POSEIDON2_DIGEST_SIZE;
+
+using F = math::BabyBear;
+using Poseidon2 =
+    Poseidon2Sponge<Poseidon2ExternalMatrix<Poseidon2Plonky3ExternalMatrix<F>>>;
+using MyHasher = PaddingFreeSponge<Poseidon2, 8, kChunk>;
+using MyCompressor = TruncatedPermutation<Poseidon2, kChunk, 2>;
+using MMCS = FieldMerkleTreeMMCS<F, MyHasher, MyCompressor, kChunk>;
+using Domain = math::Radix2EvaluationDomain<F, c::math::kMaxDegree>;
+
+class TwoAdicFriTest : public math::FiniteFieldTest<F> {
+ public:
+  void SetUp() override {
+    pcs_ = tachyon_sp1_baby_bear_poseidon2_two_adic_fri_create(kLogBlowup,
+                                                                nullptr);
+  }
+
+  void TearDown() override {
+    tachyon_sp1_baby_bear_poseidon2_two_adic_fri_destroy(pcs_);
+  }
+
+  static math::RowMajorMatrix<F> CreateRandomMatrix(size_t rows,
+                                                    size_t cols) {
+    math::RowMajorMatrix<F> ret(rows, cols);
+    for (Eigen::Index i = 0; i < ret.size(); ++i) {
+      ret.data()[i] = F::Random();
+    }
+    return ret;
+  }
+
+ protected:
+  tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs_;
+};
+
+}  // namespace
+
+TEST_F(TwoAdicFriTest, CosetLDEBatch) {
+  constexpr size_t kRows = 8;
+  constexpr size_t kCols = 3;
+  constexpr size_t kExtendedRows = kRows << kLogBlowup;
+
+  math::RowMajorMatrix<F> matrix = CreateRandomMatrix(kRows, kCols);
+  F shift = F::FromMontgomery(F::Config::kSubgroupGenerator);
+  std::vector<F> extended(kExtendedRows * kCols);
+  tachyon_sp1_baby_bear_poseidon2_two_adic_fri_coset_lde_batch(
+      pcs_, c::base::c_cast(matrix.data()), kRows, kCols,
+      c::base::c_cast(shift), c::base::c_cast(extended.data()));
+
+  F omega;
+  ASSERT_TRUE(F::GetRootOfUnity(kExtendedRows, &omega));
+  std::unique_ptr<Domain> domain = Domain::Create(kRows);
+  uint32_t log_extended_rows = base::bits::Log2Floor(kExtendedRows);
+  for (size_t j = 0; j < kCols; ++j) {
+    Domain::Evals evals(base::CreateVector(
+        kRows, [&matrix, j](size_t i) { return matrix(i, j); }));
+    Domain::DensePoly poly = domain->IFFT(evals);
+    for (size_t i = 0; i < kExtendedRows; ++i) {
+      size_t k = base::bits::BitRev(i) >> (64 - log_extended_rows);
+      EXPECT_EQ(extended[i * kCols + j], poly.Evaluate(shift * omega.Pow(k)));
+    }
+  }
+}
+
+TEST_F(TwoAdicFriTest, CommitAndOpen) {
+  std::vector<math::RowMajorMatrix<F>> matrices = {
+      CreateRandomMatrix(8, 2),
+      CreateRandomMatrix(4, 3),
+  };
+  std::vector<const tachyon_baby_bear*> ptrs = base::Map(
+      matrices, [](const math::RowMajorMatrix<F>& matrix) {
+        return c::base::c_cast(matrix.data());
+      });
+  std::vector<size_t> rows = {8, 4};
+  std::vector<size_t> cols = {2, 3};
+  std::vector<F> commitment(kChunk);
+  tachyon_sp1_baby_bear_poseidon2_field_merkle_tree* tree =
+      tachyon_sp1_baby_bear_poseidon2_two_adic_fri_commit(
+          pcs_, ptrs.data(), rows.data(), cols.data(), matrices.size(),
+          c::base::c_cast(commitment.data()));
+
+  Poseidon2 sponge(Poseidon2Config<F>::CreateCustom(
+      15, 7, 8, 13, math::GetPoseidon2BabyBearInternalShiftVector<15>()));
+  MMCS mmcs{MyHasher(sponge), MyCompressor(sponge)};
+  MMCS::Commitment expected_commitment;
+  MMCS::ProverData prover_data;
+  ASSERT_TRUE(mmcs.Commit(std::vector<math::RowMajorMatrix<F>>(matrices),
+                          &expected_commitment, &prover_data));
+  EXPECT_EQ(commitment, (std::vector<F>(expected_commitment.begin(),
+                                        expected_commitment.end())));
+
+  constexpr size_t kIndex = 5;
+  std::vector<F> openings(2 + 3);
+  std::vector<F> proof(3 * kChunk);
+  tachyon_sp1_baby_bear_poseidon2_two_adic_fri_open(
+      pcs_, tree, kIndex, c::base::c_cast(openings.data()),
+      c::base::c_cast(proof.data()));
+  EXPECT_EQ(openings, (std::vector<F>{matrices[0](5, 0), matrices[0](5, 1),
+                                      matrices[1](2, 0), matrices[1](2, 1),
+                                      matrices[1](2, 2)}));
+
+  std::vector<std::vector<F>> expected_openings;
+  MMCS::Proof expected_proof;
+  ASSERT_TRUE(mmcs.CreateOpeningProof(kIndex, prover_data, &expected_openings,
+                                      &expected_proof));
+  for (size_t i = 0; i < expected_proof.size(); ++i) {
+    for (size_t j = 0; j < kChunk; ++j) {
+      EXPECT_EQ(proof[i * kChunk + j], expected_proof[i][j]);
+    }
+  }
+
+  tachyon_sp1_baby_bear_poseidon2_field_merkle_tree_destroy(tree);
+}
+
+}  // namespace tachyon::crypto
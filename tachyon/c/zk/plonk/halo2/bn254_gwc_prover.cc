@@ -3,10 +3,13 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "tachyon/base/logging.h"
+#include "tachyon/base/threading/thread_pool.h"
+#include "tachyon/base/time/trace_recorder.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_traits.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_type_traits.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_gwc_pcs.h"
@@ -238,9 +241,11 @@ void tachyon_halo2_bn254_gwc_prover_set_extended_domain(
       tachyon_bn254_plonk_proving_key_get_verifying_key(pk);
   const tachyon_bn254_plonk_constraint_system* cs =
       tachyon_bn254_plonk_verifying_key_get_constraint_system(vk);
-  uint32_t extended_k = reinterpret_cast<const CS*>(cs)->ComputeExtendedK(
-      reinterpret_cast<const ProverImpl*>(prover)->pcs().K());
-  reinterpret_cast<ProverImpl*>(prover)->set_extended_domain(
+  ProverImpl* prover_impl = reinterpret_cast<ProverImpl*>(prover);
+  uint32_t extended_k =
+      reinterpret_cast<const CS*>(cs)->ComputeExtendedK(prover_impl->pcs().K());
+  base::ScopedThreadPool scoped_thread_pool(prover_impl->thread_pool());
+  prover_impl->set_extended_domain(
       PCS::ExtendedDomain::Create(size_t{1} << extended_k));
 }
 
@@ -256,12 +261,70 @@ void tachyon_halo2_bn254_gwc_prover_get_proof(
     size_t* proof_len) {
   const crypto::TranscriptWriter<PCS::Commitment>* transcript =
       reinterpret_cast<const ProverImpl*>(prover)->GetWriter();
-  const std::vector<uint8_t>& buffer = transcript->buffer().owned_buffer();
+  absl::Span<const uint8_t> buffer = transcript->GetUnflushedProof();
   *proof_len = buffer.size();
-  if (proof == nullptr) return;
+  if (proof == nullptr || proof == buffer.data()) return;
   memcpy(proof, buffer.data(), buffer.size());
 }
 
+size_t tachyon_halo2_bn254_gwc_prover_get_proof_len(
+    const tachyon_halo2_bn254_gwc_prover* prover) {
+  return reinterpret_cast<const ProverImpl*>(prover)
+      ->GetWriter()
+      ->GetProofLen();
+}
+
+void tachyon_halo2_bn254_gwc_prover_set_proof_output(
+    tachyon_halo2_bn254_gwc_prover* prover, uint8_t* proof,
+    size_t proof_len) {
+  reinterpret_cast<ProverImpl*>(prover)->SetProofOutput(
+      absl::Span<uint8_t>(proof, proof_len));
+}
+
+void tachyon_halo2_bn254_gwc_prover_set_proof_sink(
+    tachyon_halo2_bn254_gwc_prover* prover, tachyon_halo2_proof_sink sink,
+    void* data) {
+  crypto::TranscriptWriterBase::ProofSink proof_sink;
+  if (sink != nullptr) {
+    proof_sink = [sink, data](absl::Span<const uint8_t> segment) {
+      return sink(data, segment.data(), segment.size());
+    };
+  }
+  reinterpret_cast<ProverImpl*>(prover)->SetProofSink(std::move(proof_sink));
+}
+
+void tachyon_halo2_bn254_gwc_prover_set_async_commit(
+    tachyon_halo2_bn254_gwc_prover* prover, bool async_commit) {
+  reinterpret_cast<ProverImpl*>(prover)->set_async_commit(async_commit);
+}
+
+void tachyon_halo2_bn254_gwc_prover_set_thread_pool(
+    tachyon_halo2_bn254_gwc_prover* prover, const tachyon_thread_pool* pool) {
+  reinterpret_cast<ProverImpl*>(prover)->set_thread_pool(
+      pool ? *reinterpret_cast<const std::shared_ptr<base::ThreadPool>*>(pool)
+           : nullptr);
+}
+
+void tachyon_halo2_bn254_gwc_prover_enable_trace(
+    tachyon_halo2_bn254_gwc_prover* prover, bool enable) {
+  reinterpret_cast<ProverImpl*>(prover)->EnableTrace(enable);
+}
+
+void tachyon_halo2_bn254_gwc_prover_get_trace(
+    const tachyon_halo2_bn254_gwc_prover* prover, char* trace,
+    size_t* trace_len) {
+  const base::TraceRecorder* trace_recorder =
+      reinterpret_cast<const ProverImpl*>(prover)->trace_recorder();
+  if (trace_recorder == nullptr) {
+    *trace_len = 0;
+    return;
+  }
+  std::string json = trace_recorder->ToChromeTraceJson();
+  *trace_len = json.size();
+  if (trace == nullptr) return;
+  memcpy(trace, json.data(), json.size());
+}
+
 void tachyon_halo2_bn254_gwc_prover_set_transcript_repr(
     const tachyon_halo2_bn254_gwc_prover* prover,
     tachyon_bn254_plonk_proving_key* pk) {
@@ -10,9 +10,11 @@
 #ifndef TACHYON_C_ZK_PLONK_HALO2_BN254_GWC_PROVER_H_
 #define TACHYON_C_ZK_PLONK_HALO2_BN254_GWC_PROVER_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include "tachyon/c/base/parallel_runtime.h"
 #include "tachyon/c/export.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1.h"
@@ -20,6 +22,7 @@
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_evaluation_domain.h"
 #include "tachyon/c/zk/base/bn254_blinder.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_argument_data.h"
+#include "tachyon/c/zk/plonk/halo2/proof_sink.h"
 #include "tachyon/c/zk/plonk/keys/bn254_plonk_proving_key.h"
 
 /**
@@ -29,6 +32,11 @@
  * Encapsulates the state and functionality required for constructing Halo2
  * proofs using the GWC construction on the BN254 curve. This includes managing
  * commitments, handling randomness, and generating the cryptographic proof.
+ *
+ * A prover must not be used by several threads at the same time, but the
+ * provers may be used by different threads concurrently. Each of them runs on
+ * the thread pool set by tachyon_halo2_bn254_gwc_prover_set_thread_pool(),
+ * so that they split the cores instead of oversubscribing them.
  */
 struct tachyon_halo2_bn254_gwc_prover {};
 
@@ -225,6 +233,99 @@ TACHYON_C_EXPORT void tachyon_halo2_bn254_gwc_prover_get_proof(
     const tachyon_halo2_bn254_gwc_prover* prover, uint8_t* proof,
     size_t* proof_len);
 
+/**
+ * @brief Returns the length of the generated GWC proof, including the
+ * segments streamed to the proof sink.
+ *
+ * @param prover Pointer to the GWC prover instance.
+ * @return The length of the proof.
+ */
+TACHYON_C_EXPORT size_t tachyon_halo2_bn254_gwc_prover_get_proof_len(
+    const tachyon_halo2_bn254_gwc_prover* prover);
+
+/**
+ * @brief Sets the buffer into which the following GWC proofs are written,
+ * so that a proof is neither reallocated as it grows nor copied out by
+ * tachyon_halo2_bn254_gwc_prover_get_proof(). Every proof is written from
+ * the start of the buffer, and its length is returned by
+ * tachyon_halo2_bn254_gwc_prover_get_proof_len().
+ *
+ * @note The proof generation fails if the proof doesn't fit in the buffer. A
+ * proof is as long as any other proof of the same proving key.
+ *
+ * @param prover Pointer to the GWC prover instance.
+ * @param proof Buffer to store the proofs, which must outlive the prover.
+ * @param proof_len The length of the buffer.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_gwc_prover_set_proof_output(
+    tachyon_halo2_bn254_gwc_prover* prover, uint8_t* proof,
+    size_t proof_len);
+
+/**
+ * @brief Streams the following GWC proofs to |sink| segment by segment as
+ * they are written, instead of accumulating them for
+ * tachyon_halo2_bn254_gwc_prover_get_proof(), which then returns nothing.
+ * Passing NULL stops streaming.
+ *
+ * @param prover Pointer to the GWC prover instance.
+ * @param sink The callback to which the segments are passed.
+ * @param data The pointer passed to |sink|.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_gwc_prover_set_proof_sink(
+    tachyon_halo2_bn254_gwc_prover* prover, tachyon_halo2_proof_sink sink,
+    void* data);
+
+/**
+ * @brief Sets whether to compute the batch commitments on another thread while
+ * the prover works on what doesn't depend on them.
+ *
+ * @param prover Pointer to the GWC prover instance.
+ * @param async_commit Whether to commit asynchronously.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_gwc_prover_set_async_commit(
+    tachyon_halo2_bn254_gwc_prover* prover, bool async_commit);
+
+/**
+ * @brief Sets the thread pool that the prover runs on.
+ *
+ * The prover keeps a reference to @p pool, so @p pool may be destroyed by the
+ * caller afterwards. Several provers may share a pool. By default, or if
+ * @p pool is NULL, the prover runs on the process-wide pool, which uses every
+ * core.
+ *
+ * @param prover Pointer to the GWC prover instance.
+ * @param pool Pointer to the thread pool, or NULL.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_gwc_prover_set_thread_pool(
+    tachyon_halo2_bn254_gwc_prover* prover, const tachyon_thread_pool* pool);
+
+/**
+ * @brief Enables or disables recording the phases of the proof generation.
+ *
+ * While enabled, each proof generation records the time and the memory usage
+ * of each of its phases, which can be retrieved by
+ * tachyon_halo2_bn254_gwc_prover_get_trace().
+ *
+ * @param prover Pointer to the GWC prover instance.
+ * @param enable Whether to record the phases.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_gwc_prover_enable_trace(
+    tachyon_halo2_bn254_gwc_prover* prover, bool enable);
+
+/**
+ * @brief Retrieves the phases recorded by the last proof generation in the
+ * Chrome trace event format, which can be loaded in chrome://tracing or
+ * Perfetto.
+ *
+ * @param prover Pointer to the GWC prover instance.
+ * @param trace Buffer to store the trace in JSON, not null-terminated.
+ * @param trace_len Pointer to store the length of the trace. This is 0 if
+ * tracing is disabled.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_gwc_prover_get_trace(
+    const tachyon_halo2_bn254_gwc_prover* prover, char* trace,
+    size_t* trace_len);
+
 /**
  * @brief Sets the representation of the transcript for the prover based on the
  * proving key.
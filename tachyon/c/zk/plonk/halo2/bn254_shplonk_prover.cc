@@ -3,16 +3,21 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "tachyon/base/logging.h"
+#include "tachyon/base/threading/thread_pool.h"
+#include "tachyon/base/time/trace_recorder.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_traits.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_type_traits.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_ls.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_shplonk_pcs.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_transcript.h"
 #include "tachyon/c/zk/plonk/halo2/kzg_family_prover_impl.h"
+#include "tachyon/c/zk/plonk/halo2/proving_context.h"
+#include "tachyon/c/zk/plonk/keys/bn254_plonk_proving_key_impl.h"
 #include "tachyon/c/zk/plonk/keys/proving_key_impl_base.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
 #include "tachyon/zk/plonk/halo2/blake2b_transcript.h"
@@ -29,6 +34,40 @@ using CS = zk::plonk::ConstraintSystem<PCS::Field>;
 using ProverImpl = c::zk::plonk::halo2::KZGFamilyProverImpl<PCS, LS>;
 using ProvingKey = c::zk::plonk::ProvingKeyImplBase<LS>;
 using Data = zk::plonk::halo2::ArgumentData<PCS::Poly, PCS::Evals>;
+using ProvingContext =
+    c::zk::plonk::halo2::ProvingContext<PCS, c::zk::plonk::bn254::PKeyImpl>;
+
+namespace {
+
+std::unique_ptr<crypto::TranscriptWriter<math::bn254::G1AffinePoint>>
+CreateWriter(uint8_t transcript_type) {
+  base::Uint8VectorBuffer write_buf;
+  std::unique_ptr<crypto::TranscriptWriter<math::bn254::G1AffinePoint>> writer;
+  switch (static_cast<zk::plonk::halo2::TranscriptType>(transcript_type)) {
+    case zk::plonk::halo2::TranscriptType::kBlake2b: {
+      writer = std::make_unique<
+          zk::plonk::halo2::Blake2bWriter<math::bn254::G1AffinePoint>>(
+          std::move(write_buf));
+      break;
+    }
+    case zk::plonk::halo2::TranscriptType::kPoseidon: {
+      writer = std::make_unique<
+          zk::plonk::halo2::PoseidonWriter<math::bn254::G1AffinePoint>>(
+          std::move(write_buf));
+      break;
+    }
+    case zk::plonk::halo2::TranscriptType::kSha256: {
+      writer = std::make_unique<
+          zk::plonk::halo2::Sha256Writer<math::bn254::G1AffinePoint>>(
+          std::move(write_buf));
+      break;
+    }
+  }
+  CHECK(writer);
+  return writer;
+}
+
+}  // namespace
 
 tachyon_halo2_bn254_shplonk_prover*
 tachyon_halo2_bn254_shplonk_prover_create_from_unsafe_setup(
@@ -43,31 +82,8 @@ tachyon_halo2_bn254_shplonk_prover_create_from_unsafe_setup(
         memcpy(bigint.limbs, reinterpret_cast<const uint8_t*>(s->limbs),
                sizeof(uint64_t) * math::bn254::Fr::kLimbNums);
         CHECK(pcs.UnsafeSetup(n, math::bn254::Fr::FromMontgomery(bigint)));
-        base::Uint8VectorBuffer write_buf;
         std::unique_ptr<crypto::TranscriptWriter<math::bn254::G1AffinePoint>>
-            writer;
-        switch (
-            static_cast<zk::plonk::halo2::TranscriptType>(transcript_type)) {
-          case zk::plonk::halo2::TranscriptType::kBlake2b: {
-            writer = std::make_unique<
-                zk::plonk::halo2::Blake2bWriter<math::bn254::G1AffinePoint>>(
-                std::move(write_buf));
-            break;
-          }
-          case zk::plonk::halo2::TranscriptType::kPoseidon: {
-            writer = std::make_unique<
-                zk::plonk::halo2::PoseidonWriter<math::bn254::G1AffinePoint>>(
-                std::move(write_buf));
-            break;
-          }
-          case zk::plonk::halo2::TranscriptType::kSha256: {
-            writer = std::make_unique<
-                zk::plonk::halo2::Sha256Writer<math::bn254::G1AffinePoint>>(
-                std::move(write_buf));
-            break;
-          }
-        }
-        CHECK(writer);
+            writer = CreateWriter(transcript_type);
         zk::plonk::halo2::Prover<PCS, LS> prover =
             zk::plonk::halo2::Prover<PCS, LS>::CreateFromRNG(
                 std::move(pcs), std::move(writer),
@@ -93,31 +109,8 @@ tachyon_halo2_bn254_shplonk_prover_create_from_params(uint8_t transcript_type,
         base::ReadOnlyBuffer read_buf(params, params_len);
         c::zk::plonk::ReadBuffer(read_buf, pcs);
 
-        base::Uint8VectorBuffer write_buf;
         std::unique_ptr<crypto::TranscriptWriter<math::bn254::G1AffinePoint>>
-            writer;
-        switch (
-            static_cast<zk::plonk::halo2::TranscriptType>(transcript_type)) {
-          case zk::plonk::halo2::TranscriptType::kBlake2b: {
-            writer = std::make_unique<
-                zk::plonk::halo2::Blake2bWriter<math::bn254::G1AffinePoint>>(
-                std::move(write_buf));
-            break;
-          }
-          case zk::plonk::halo2::TranscriptType::kPoseidon: {
-            writer = std::make_unique<
-                zk::plonk::halo2::PoseidonWriter<math::bn254::G1AffinePoint>>(
-                std::move(write_buf));
-            break;
-          }
-          case zk::plonk::halo2::TranscriptType::kSha256: {
-            writer = std::make_unique<
-                zk::plonk::halo2::Sha256Writer<math::bn254::G1AffinePoint>>(
-                std::move(write_buf));
-            break;
-          }
-        }
-        CHECK(writer);
+            writer = CreateWriter(transcript_type);
         zk::plonk::halo2::Prover<PCS, LS> prover =
             zk::plonk::halo2::Prover<PCS, LS>::CreateFromRNG(
                 std::move(pcs), std::move(writer),
@@ -130,6 +123,30 @@ tachyon_halo2_bn254_shplonk_prover_create_from_params(uint8_t transcript_type,
   return reinterpret_cast<tachyon_halo2_bn254_shplonk_prover*>(prover);
 }
 
+tachyon_halo2_bn254_shplonk_prover*
+tachyon_halo2_bn254_shplonk_prover_create_from_proving_context(
+    uint8_t transcript_type,
+    const tachyon_halo2_bn254_shplonk_proving_context* context) {
+  const std::shared_ptr<const ProvingContext>& proving_context =
+      *reinterpret_cast<const std::shared_ptr<const ProvingContext>*>(context);
+
+  ProverImpl* prover = new ProverImpl(
+      [transcript_type, &proving_context]() {
+        // NOTE: The copy of the PCS shares the SRS with |proving_context|.
+        PCS pcs = proving_context->pcs();
+        RowIndex blinding_factors = proving_context->proving_key()
+                                      ->verifying_key()
+                                      .constraint_system()
+                                      .ComputeBlindingFactors();
+        return zk::plonk::halo2::Prover<PCS, LS>::CreateFromRNG(
+            std::move(pcs), CreateWriter(transcript_type),
+            /*rng=*/nullptr, blinding_factors);
+      },
+      transcript_type);
+  prover->SetProvingContext(proving_context);
+  return reinterpret_cast<tachyon_halo2_bn254_shplonk_prover*>(prover);
+}
+
 void tachyon_halo2_bn254_shplonk_prover_destroy(
     tachyon_halo2_bn254_shplonk_prover* prover) {
   delete reinterpret_cast<ProverImpl*>(prover);
@@ -238,9 +255,11 @@ void tachyon_halo2_bn254_shplonk_prover_set_extended_domain(
       tachyon_bn254_plonk_proving_key_get_verifying_key(pk);
   const tachyon_bn254_plonk_constraint_system* cs =
       tachyon_bn254_plonk_verifying_key_get_constraint_system(vk);
-  uint32_t extended_k = reinterpret_cast<const CS*>(cs)->ComputeExtendedK(
-      reinterpret_cast<const ProverImpl*>(prover)->pcs().K());
-  reinterpret_cast<ProverImpl*>(prover)->set_extended_domain(
+  ProverImpl* prover_impl = reinterpret_cast<ProverImpl*>(prover);
+  uint32_t extended_k =
+      reinterpret_cast<const CS*>(cs)->ComputeExtendedK(prover_impl->pcs().K());
+  base::ScopedThreadPool scoped_thread_pool(prover_impl->thread_pool());
+  prover_impl->set_extended_domain(
       PCS::ExtendedDomain::Create(size_t{1} << extended_k));
 }
 
@@ -252,20 +271,122 @@ void tachyon_halo2_bn254_shplonk_prover_create_proof(
       reinterpret_cast<ProvingKey&>(*pk), reinterpret_cast<Data*>(data));
 }
 
+void tachyon_halo2_bn254_shplonk_prover_create_proof_with_proving_context(
+    tachyon_halo2_bn254_shplonk_prover* prover,
+    tachyon_halo2_bn254_argument_data* data) {
+  ProverImpl* prover_impl = reinterpret_cast<ProverImpl*>(prover);
+  const ProvingContext* proving_context =
+      prover_impl->proving_context<ProvingContext>();
+  CHECK(proving_context) << "The prover isn't created from a proving context";
+  prover_impl->CreateProof(*proving_context->proving_key(),
+                           reinterpret_cast<Data*>(data));
+}
+
 void tachyon_halo2_bn254_shplonk_prover_get_proof(
     const tachyon_halo2_bn254_shplonk_prover* prover, uint8_t* proof,
     size_t* proof_len) {
   const crypto::TranscriptWriter<PCS::Commitment>* transcript =
       reinterpret_cast<const ProverImpl*>(prover)->GetWriter();
-  const std::vector<uint8_t>& buffer = transcript->buffer().owned_buffer();
+  absl::Span<const uint8_t> buffer = transcript->GetUnflushedProof();
   *proof_len = buffer.size();
-  if (proof == nullptr) return;
+  if (proof == nullptr || proof == buffer.data()) return;
   memcpy(proof, buffer.data(), buffer.size());
 }
 
+size_t tachyon_halo2_bn254_shplonk_prover_get_proof_len(
+    const tachyon_halo2_bn254_shplonk_prover* prover) {
+  return reinterpret_cast<const ProverImpl*>(prover)
+      ->GetWriter()
+      ->GetProofLen();
+}
+
+void tachyon_halo2_bn254_shplonk_prover_set_proof_output(
+    tachyon_halo2_bn254_shplonk_prover* prover, uint8_t* proof,
+    size_t proof_len) {
+  reinterpret_cast<ProverImpl*>(prover)->SetProofOutput(
+      absl::Span<uint8_t>(proof, proof_len));
+}
+
+void tachyon_halo2_bn254_shplonk_prover_set_proof_sink(
+    tachyon_halo2_bn254_shplonk_prover* prover, tachyon_halo2_proof_sink sink,
+    void* data) {
+  crypto::TranscriptWriterBase::ProofSink proof_sink;
+  if (sink != nullptr) {
+    proof_sink = [sink, data](absl::Span<const uint8_t> segment) {
+      return sink(data, segment.data(), segment.size());
+    };
+  }
+  reinterpret_cast<ProverImpl*>(prover)->SetProofSink(std::move(proof_sink));
+}
+
+void tachyon_halo2_bn254_shplonk_prover_set_async_commit(
+    tachyon_halo2_bn254_shplonk_prover* prover, bool async_commit) {
+  reinterpret_cast<ProverImpl*>(prover)->set_async_commit(async_commit);
+}
+
+void tachyon_halo2_bn254_shplonk_prover_set_thread_pool(
+    tachyon_halo2_bn254_shplonk_prover* prover,
+    const tachyon_thread_pool* pool) {
+  reinterpret_cast<ProverImpl*>(prover)->set_thread_pool(
+      pool ? *reinterpret_cast<const std::shared_ptr<base::ThreadPool>*>(pool)
+           : nullptr);
+}
+
+void tachyon_halo2_bn254_shplonk_prover_enable_trace(
+    tachyon_halo2_bn254_shplonk_prover* prover, bool enable) {
+  reinterpret_cast<ProverImpl*>(prover)->EnableTrace(enable);
+}
+
+void tachyon_halo2_bn254_shplonk_prover_get_trace(
+    const tachyon_halo2_bn254_shplonk_prover* prover, char* trace,
+    size_t* trace_len) {
+  const base::TraceRecorder* trace_recorder =
+      reinterpret_cast<const ProverImpl*>(prover)->trace_recorder();
+  if (trace_recorder == nullptr) {
+    *trace_len = 0;
+    return;
+  }
+  std::string json = trace_recorder->ToChromeTraceJson();
+  *trace_len = json.size();
+  if (trace == nullptr) return;
+  memcpy(trace, json.data(), json.size());
+}
+
 void tachyon_halo2_bn254_shplonk_prover_set_transcript_repr(
     const tachyon_halo2_bn254_shplonk_prover* prover,
     tachyon_bn254_plonk_proving_key* pk) {
   reinterpret_cast<ProvingKey*>(pk)->SetTranscriptRepr(
       reinterpret_cast<const ProverImpl&>(*prover));
 }
+
+tachyon_halo2_bn254_shplonk_proving_context*
+tachyon_halo2_bn254_shplonk_proving_context_create(
+    const tachyon_halo2_bn254_shplonk_prover* prover,
+    tachyon_bn254_plonk_proving_key* pk) {
+  const ProverImpl* prover_impl = reinterpret_cast<const ProverImpl*>(prover);
+  CHECK(prover_impl->extended_domain())
+      << "The extended domain of the prover isn't set";
+  std::unique_ptr<c::zk::plonk::bn254::PKeyImpl> proving_key(
+      reinterpret_cast<c::zk::plonk::bn254::PKeyImpl*>(pk));
+  proving_key->SetTranscriptRepr(*prover_impl);
+  auto* proving_context = new std::shared_ptr<const ProvingContext>(
+      std::make_shared<const ProvingContext>(
+          prover_impl->pcs(), prover_impl->shared_domain(),
+          prover_impl->shared_extended_domain(), std::move(proving_key)));
+  return reinterpret_cast<tachyon_halo2_bn254_shplonk_proving_context*>(
+      proving_context);
+}
+
+void tachyon_halo2_bn254_shplonk_proving_context_destroy(
+    tachyon_halo2_bn254_shplonk_proving_context* context) {
+  delete reinterpret_cast<std::shared_ptr<const ProvingContext>*>(context);
+}
+
+const tachyon_bn254_plonk_proving_key*
+tachyon_halo2_bn254_shplonk_proving_context_get_proving_key(
+    const tachyon_halo2_bn254_shplonk_proving_context* context) {
+  const std::shared_ptr<const ProvingContext>& proving_context =
+      *reinterpret_cast<const std::shared_ptr<const ProvingContext>*>(context);
+  return reinterpret_cast<const tachyon_bn254_plonk_proving_key*>(
+      proving_context->proving_key());
+}
@@ -10,9 +10,11 @@
 #ifndef TACHYON_C_ZK_PLONK_HALO2_BN254_SHPLONK_PROVER_H_
 #define TACHYON_C_ZK_PLONK_HALO2_BN254_SHPLONK_PROVER_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include "tachyon/c/base/parallel_runtime.h"
 #include "tachyon/c/export.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1.h"
@@ -20,6 +22,7 @@
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_evaluation_domain.h"
 #include "tachyon/c/zk/base/bn254_blinder.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_argument_data.h"
+#include "tachyon/c/zk/plonk/halo2/proof_sink.h"
 #include "tachyon/c/zk/plonk/keys/bn254_plonk_proving_key.h"
 
 /**
@@ -28,9 +31,25 @@
  *
  * Encapsulates the state and functionalities required to generate SHPLONK
  * proofs in the Halo2 framework, using BN254 as the underlying curve.
+ *
+ * A prover must not be used by several threads at the same time, but the
+ * provers may be used by different threads concurrently. Each of them runs on
+ * the thread pool set by tachyon_halo2_bn254_shplonk_prover_set_thread_pool(),
+ * so that they split the cores instead of oversubscribing them.
  */
 struct tachyon_halo2_bn254_shplonk_prover {};
 
+/**
+ * @struct tachyon_halo2_bn254_shplonk_proving_context
+ * @brief Represents the immutable data shared by SHPLONK provers proving the
+ * same circuit concurrently.
+ *
+ * It holds the SRS, the domains with their twiddles and the proving key. It is
+ * reference-counted, so that it stays alive until the handle and every prover
+ * created from it are destroyed.
+ */
+struct tachyon_halo2_bn254_shplonk_proving_context {};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -191,6 +210,19 @@ TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_create_proof(
     tachyon_bn254_plonk_proving_key* pk,
     tachyon_halo2_bn254_argument_data* data);
 
+/**
+ * @brief Generates a SHPLONK proof for the provided argument data with the
+ * proving key of the proving context that the prover is created from.
+ *
+ * @param prover Pointer to the SHPLONK prover instance created by
+ * tachyon_halo2_bn254_shplonk_prover_create_from_proving_context().
+ * @param data Pointer to the argument data.
+ */
+TACHYON_C_EXPORT void
+tachyon_halo2_bn254_shplonk_prover_create_proof_with_proving_context(
+    tachyon_halo2_bn254_shplonk_prover* prover,
+    tachyon_halo2_bn254_argument_data* data);
+
 /**
  * @brief Retrieves the generated SHPLONK proof.
  *
@@ -202,6 +234,100 @@ TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_get_proof(
     const tachyon_halo2_bn254_shplonk_prover* prover, uint8_t* proof,
     size_t* proof_len);
 
+/**
+ * @brief Returns the length of the generated SHPLONK proof, including the
+ * segments streamed to the proof sink.
+ *
+ * @param prover Pointer to the SHPLONK prover instance.
+ * @return The length of the proof.
+ */
+TACHYON_C_EXPORT size_t tachyon_halo2_bn254_shplonk_prover_get_proof_len(
+    const tachyon_halo2_bn254_shplonk_prover* prover);
+
+/**
+ * @brief Sets the buffer into which the following SHPLONK proofs are written,
+ * so that a proof is neither reallocated as it grows nor copied out by
+ * tachyon_halo2_bn254_shplonk_prover_get_proof(). Every proof is written from
+ * the start of the buffer, and its length is returned by
+ * tachyon_halo2_bn254_shplonk_prover_get_proof_len().
+ *
+ * @note The proof generation fails if the proof doesn't fit in the buffer. A
+ * proof is as long as any other proof of the same proving key.
+ *
+ * @param prover Pointer to the SHPLONK prover instance.
+ * @param proof Buffer to store the proofs, which must outlive the prover.
+ * @param proof_len The length of the buffer.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_set_proof_output(
+    tachyon_halo2_bn254_shplonk_prover* prover, uint8_t* proof,
+    size_t proof_len);
+
+/**
+ * @brief Streams the following SHPLONK proofs to |sink| segment by segment as
+ * they are written, instead of accumulating them for
+ * tachyon_halo2_bn254_shplonk_prover_get_proof(), which then returns nothing.
+ * Passing NULL stops streaming.
+ *
+ * @param prover Pointer to the SHPLONK prover instance.
+ * @param sink The callback to which the segments are passed.
+ * @param data The pointer passed to |sink|.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_set_proof_sink(
+    tachyon_halo2_bn254_shplonk_prover* prover, tachyon_halo2_proof_sink sink,
+    void* data);
+
+/**
+ * @brief Sets whether to compute the batch commitments on another thread while
+ * the prover works on what doesn't depend on them.
+ *
+ * @param prover Pointer to the SHPLONK prover instance.
+ * @param async_commit Whether to commit asynchronously.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_set_async_commit(
+    tachyon_halo2_bn254_shplonk_prover* prover, bool async_commit);
+
+/**
+ * @brief Sets the thread pool that the prover runs on.
+ *
+ * The prover keeps a reference to @p pool, so @p pool may be destroyed by the
+ * caller afterwards. Several provers may share a pool. By default, or if
+ * @p pool is NULL, the prover runs on the process-wide pool, which uses every
+ * core.
+ *
+ * @param prover Pointer to the SHPLONK prover instance.
+ * @param pool Pointer to the thread pool, or NULL.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_set_thread_pool(
+    tachyon_halo2_bn254_shplonk_prover* prover,
+    const tachyon_thread_pool* pool);
+
+/**
+ * @brief Enables or disables recording the phases of the proof generation.
+ *
+ * While enabled, each proof generation records the time and the memory usage
+ * of each of its phases, which can be retrieved by
+ * tachyon_halo2_bn254_shplonk_prover_get_trace().
+ *
+ * @param prover Pointer to the SHPLONK prover instance.
+ * @param enable Whether to record the phases.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_enable_trace(
+    tachyon_halo2_bn254_shplonk_prover* prover, bool enable);
+
+/**
+ * @brief Retrieves the phases recorded by the last proof generation in the
+ * Chrome trace event format, which can be loaded in chrome://tracing or
+ * Perfetto.
+ *
+ * @param prover Pointer to the SHPLONK prover instance.
+ * @param trace Buffer to store the trace in JSON, not null-terminated.
+ * @param trace_len Pointer to store the length of the trace. This is 0 if
+ * tracing is disabled.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_get_trace(
+    const tachyon_halo2_bn254_shplonk_prover* prover, char* trace,
+    size_t* trace_len);
+
 /**
  * @brief Sets the representation of the transcript according to the proving
  * key. This is used for encoding the transcript in a specific way as defined by
@@ -214,6 +340,42 @@ TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_set_transcript_repr(
     const tachyon_halo2_bn254_shplonk_prover* prover,
     tachyon_bn254_plonk_proving_key* pk);
 
+/**
+ * @brief Creates a proving context from a SHPLONK prover and a proving key.
+ *
+ * The context shares the SRS and the domains with |prover| and takes the
+ * ownership of |pk|, so |pk| must not be destroyed by the caller afterwards.
+ * The extended domain of |prover| must be set before, and the transcript
+ * representation of |pk| is set here.
+ *
+ * @param prover Pointer to the SHPLONK prover instance.
+ * @param pk Pointer to the plonk proving key.
+ * @return A pointer to the newly created proving context.
+ */
+TACHYON_C_EXPORT tachyon_halo2_bn254_shplonk_proving_context*
+tachyon_halo2_bn254_shplonk_proving_context_create(
+    const tachyon_halo2_bn254_shplonk_prover* prover,
+    tachyon_bn254_plonk_proving_key* pk);
+
+/**
+ * @brief Releases the reference to a proving context. The context is freed
+ * once every prover created from it is destroyed as well.
+ *
+ * @param context Pointer to the proving context.
+ */
+TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_proving_context_destroy(
+    tachyon_halo2_bn254_shplonk_proving_context* context);
+
+/**
+ * @brief Retrieves the proving key of a proving context.
+ *
+ * @param context Pointer to the proving context.
+ * @return A pointer to the proving key.
+ */
+TACHYON_C_EXPORT const tachyon_bn254_plonk_proving_key*
+tachyon_halo2_bn254_shplonk_proving_context_get_proving_key(
+    const tachyon_halo2_bn254_shplonk_proving_context* context);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -15,6 +15,7 @@
 #include "tachyon/c/math/polynomials/constants.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_transcript.h"
 #include "tachyon/c/zk/plonk/halo2/test/bn254_halo2_params_data.h"
+#include "tachyon/c/zk/plonk/keys/bn254_plonk_proving_key_impl.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
 #include "tachyon/zk/base/commitments/shplonk_extension.h"
 #include "tachyon/zk/lookup/halo2/scheme.h"
@@ -118,6 +119,26 @@ TEST_P(SHPlonkProverTest, CommitLagrange) {
       c::base::native_cast(*point));
 }
 
+TEST_P(SHPlonkProverTest, SetThreadPool) {
+  tachyon_thread_pool* pool =
+      tachyon_thread_pool_create(2, TACHYON_THREAD_AFFINITY_NONE);
+  EXPECT_EQ(tachyon_thread_pool_get_num_threads(pool), 2);
+  tachyon_halo2_bn254_shplonk_prover_set_thread_pool(prover_, pool);
+  // The prover outlives the handle of the pool.
+  tachyon_thread_pool_destroy(pool);
+
+  PCS::Domain::DensePoly poly = PCS::Domain::DensePoly::Random(5);
+  tachyon_bn254_g1_jacobian* point = tachyon_halo2_bn254_shplonk_prover_commit(
+      prover_,
+      reinterpret_cast<const tachyon_bn254_univariate_dense_polynomial*>(
+          &poly));
+  EXPECT_EQ(
+      (reinterpret_cast<Prover<PCS, LS>*>(prover_)->Commit(poly).ToJacobian()),
+      c::base::native_cast(*point));
+
+  tachyon_halo2_bn254_shplonk_prover_set_thread_pool(prover_, nullptr);
+}
+
 TEST_P(SHPlonkProverTest, SetRng) {
   std::vector<uint8_t> seed = base::CreateVector(
       crypto::XORShiftRNG::kSeedSize,
@@ -207,4 +228,39 @@ TEST_P(SHPlonkProverTest, SetTranscript) {
   tachyon_halo2_bn254_transcript_writer_destroy(transcript);
 }
 
+TEST_P(SHPlonkProverTest, ProvingContext) {
+  uint8_t transcript_type = GetParam();
+
+  tachyon_bn254_plonk_proving_key* pk =
+      reinterpret_cast<tachyon_bn254_plonk_proving_key*>(
+          new c::zk::plonk::bn254::PKeyImpl());
+  tachyon_halo2_bn254_shplonk_prover_set_extended_domain(prover_, pk);
+  tachyon_halo2_bn254_shplonk_proving_context* context =
+      tachyon_halo2_bn254_shplonk_proving_context_create(prover_, pk);
+  EXPECT_EQ(tachyon_halo2_bn254_shplonk_proving_context_get_proving_key(
+                context),
+            pk);
+
+  tachyon_halo2_bn254_shplonk_prover* provers[] = {
+      tachyon_halo2_bn254_shplonk_prover_create_from_proving_context(
+          transcript_type, context),
+      tachyon_halo2_bn254_shplonk_prover_create_from_proving_context(
+          transcript_type, context),
+  };
+  // The provers outlive the handle of the context.
+  tachyon_halo2_bn254_shplonk_proving_context_destroy(context);
+
+  for (tachyon_halo2_bn254_shplonk_prover* prover : provers) {
+    EXPECT_EQ(tachyon_halo2_bn254_shplonk_prover_get_k(prover), k_);
+    EXPECT_EQ(tachyon_halo2_bn254_shplonk_prover_get_domain(prover),
+              tachyon_halo2_bn254_shplonk_prover_get_domain(prover_));
+    EXPECT_TRUE(tachyon_bn254_g2_affine_eq(
+        tachyon_halo2_bn254_shplonk_prover_get_s_g2(prover),
+        tachyon_halo2_bn254_shplonk_prover_get_s_g2(prover_)));
+  }
+  for (tachyon_halo2_bn254_shplonk_prover* prover : provers) {
+    tachyon_halo2_bn254_shplonk_prover_destroy(prover);
+  }
+}
+
 }  // namespace tachyon::zk::plonk::halo2::bn254
@@ -6,10 +6,14 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/endian_auto_reset.h"
 #include "tachyon/base/buffer/read_only_buffer.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/memory/default_init_allocator.h"
+#include "tachyon/base/parallelize.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_gwc_pcs.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_shplonk_pcs.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
@@ -60,9 +64,39 @@ template <typename T>
 class BufferReader<std::vector<T>> {
  public:
   static std::vector<T> Read(const tachyon::base::ReadOnlyBuffer& buffer) {
-    return tachyon::base::CreateVector(ReadU32AsSizeT(buffer), [&buffer]() {
-      return BufferReader<T>::Read(buffer);
-    });
+    size_t size = ReadU32AsSizeT(buffer);
+    if constexpr (std::is_base_of_v<tachyon::math::PrimeFieldBase<T>, T>) {
+      return ReadPrimeFields(buffer, size);
+    } else {
+      return tachyon::base::CreateVector(
+          size, [&buffer]() { return BufferReader<T>::Read(buffer); });
+    }
+  }
+
+ private:
+  // Reads the limbs of every element at once and converts them out of the
+  // montgomery form in parallel, which is the bulk of loading the columns of
+  // a proving key.
+  static std::vector<T> ReadPrimeFields(
+      const tachyon::base::ReadOnlyBuffer& buffer, size_t size) {
+    using BigInt = typename T::BigIntTy;
+    static_assert(sizeof(BigInt) == BigInt::kLimbNums * sizeof(uint64_t));
+
+    tachyon::base::EndianAutoReset resetter(buffer,
+                                            tachyon::base::Endian::kLittle);
+    tachyon::base::UninitializedVector<BigInt> montgomeries(size);
+    CHECK(buffer.ReadArray(reinterpret_cast<uint64_t*>(montgomeries.data()),
+                           size * BigInt::kLimbNums));
+    std::vector<T> ret(size);
+    tachyon::base::Parallelize(
+        ret, [&montgomeries](absl::Span<T> chunk, size_t chunk_offset,
+                             size_t chunk_size) {
+          size_t offset = chunk_offset * chunk_size;
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            chunk[i] = T::FromMontgomery(montgomeries[offset + i]);
+          }
+        });
+    return ret;
   }
 };
 
@@ -30,11 +30,13 @@ class KZGFamilyProverImpl : public ProverImplBase<PCS, LS> {
   using ProverImplBase<PCS, LS>::ProverImplBase;
 
   CJacobianPoint* Commit(const std::vector<ScalarField>& scalars) const {
+    tachyon::base::ScopedThreadPool scoped_thread_pool(this->thread_pool());
     return DoMSM(this->pcs_.GetG1PowersOfTau(), scalars);
   }
 
   CJacobianPoint* CommitLagrange(
       const std::vector<ScalarField>& scalars) const {
+    tachyon::base::ScopedThreadPool scoped_thread_pool(this->thread_pool());
     return DoMSM(this->pcs_.GetG1PowersOfTauLagrange(), scalars);
   }
 
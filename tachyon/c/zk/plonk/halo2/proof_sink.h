@@ -0,0 +1,26 @@
+/**
+ * @file
+ * @brief Defines the callback to which a Halo2 prover streams its proof.
+ */
+
+#ifndef TACHYON_C_ZK_PLONK_HALO2_PROOF_SINK_H_
+#define TACHYON_C_ZK_PLONK_HALO2_PROOF_SINK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Called with each segment of a proof in order as soon as it is
+ * complete, which is the proof written before a challenge is squeezed.
+ *
+ * @param data The pointer passed together with the callback.
+ * @param segment The bytes of the segment, which are valid only during the
+ * call.
+ * @param segment_len The length of the segment.
+ * @return False to make the proof generation fail.
+ */
+typedef bool (*tachyon_halo2_proof_sink)(void* data, const uint8_t* segment,
+                                         size_t segment_len);
+
+#endif  // TACHYON_C_ZK_PLONK_HALO2_PROOF_SINK_H_
@@ -4,12 +4,21 @@
 #include <stdint.h>
 
 #include <memory>
+#include <optional>
+#include <string_view>
 #include <utility>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/environment.h"
 #include "tachyon/base/files/file_util.h"
 #include "tachyon/base/functional/callback.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/threading/thread_pool.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/base/time/trace_recorder.h"
+#include "tachyon/base/tuning_profile.h"
+#include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/zk/plonk/halo2/prover.h"
 
 namespace tachyon::c::zk::plonk::halo2 {
@@ -25,6 +34,9 @@ class ProverImplBase : public tachyon::zk::plonk::halo2::Prover<PCS, LS> {
 
   ProverImplBase(Callback callback, uint8_t transcript_type)
       : Base(std::move(callback).Run()), transcript_type_(transcript_type) {
+    // The profile of $TACHYON_TUNING_PROFILE_PATH, if any, is loaded here
+    // before the first proof.
+    tachyon::base::TuningProfile::GetDefault().ApplyNumThreads();
     std::string_view pcs_params_str;
     if (tachyon::base::Environment::Get("TACHYON_PCS_PARAMS_LOG_PATH",
                                         &pcs_params_str)) {
@@ -35,11 +47,78 @@ class ProverImplBase : public tachyon::zk::plonk::halo2::Prover<PCS, LS> {
       CHECK(tachyon::base::WriteFile(tachyon::base::FilePath(pcs_params_str),
                                      buffer.owned_buffer()));
     }
+    if (tachyon::base::Environment::Get("TACHYON_PROVER_TRACE_PATH",
+                                        &trace_path_)) {
+      EnableTrace(true);
+    }
+    // NOTE: The spans of |TRACE_EVENT()| are recorded only if tachyon is
+    // built with --//:has_trace_event.
+    if (tachyon::base::Environment::Get("TACHYON_TRACE_EVENT_PATH",
+                                        &trace_event_path_)) {
+      tachyon::base::TraceLog& trace_log =
+          tachyon::base::TraceLog::GetInstance();
+      if (!trace_log.IsEnabled()) trace_log.Start();
+    }
   }
 
   uint8_t transcript_type() const { return transcript_type_; }
 
+  // Returns the phases recorded by the last |CreateProof()|, or nullptr if
+  // tracing is disabled.
+  const tachyon::base::TraceRecorder* trace_recorder() const {
+    return trace_recorder_.get();
+  }
+
+  void EnableTrace(bool enable) {
+    if (enable) {
+      if (!trace_recorder_) {
+        trace_recorder_ = std::make_unique<tachyon::base::TraceRecorder>();
+      }
+    } else {
+      trace_recorder_.reset();
+    }
+    this->set_trace_recorder(trace_recorder_.get());
+  }
+
+  // Returns the pool that the prover runs on, or nullptr if it runs on the
+  // pool of the calling thread.
+  tachyon::base::ThreadPool* thread_pool() const { return thread_pool_.get(); }
+
+  // Keeps a reference to |thread_pool|, which may be shared with the other
+  // provers. Passing nullptr lets the prover run on the pool of the calling
+  // thread, which is |tachyon::base::ThreadPool::GetDefault()| by default.
+  void set_thread_pool(std::shared_ptr<tachyon::base::ThreadPool> thread_pool) {
+    thread_pool_ = std::move(thread_pool);
+  }
+
+  // Returns the |ProvingContext| that the prover is created from, or nullptr.
+  template <typename ProvingContext>
+  const ProvingContext* proving_context() const {
+    return static_cast<const ProvingContext*>(proving_context_.get());
+  }
+
+  // Keeps a reference to |proving_context|, from which the PCS and the domains
+  // of the prover are borrowed. The proving key of |proving_context| is shared
+  // with the other provers, so the prover is set not to modify it.
+  template <typename ProvingContext>
+  void SetProvingContext(
+      std::shared_ptr<const ProvingContext> proving_context) {
+    this->set_domain(proving_context->domain());
+    this->set_extended_domain(proving_context->extended_domain());
+    this->set_keep_fixed_columns(true);
+    this->set_cache_lookup_tables(false);
+    proving_context_ = std::move(proving_context);
+  }
+
   void SetRngState(absl::Span<const uint8_t> state) {
+    std::string_view state_str;
+    if (tachyon::base::Environment::Get("TACHYON_RNG_STATE_LOG_PATH",
+                                        &state_str)) {
+      VLOG(1) << "Save rng state to: " << state_str;
+      CHECK(
+          tachyon::base::WriteFile(tachyon::base::FilePath(state_str), state));
+    }
+
     tachyon::base::ReadOnlyBuffer buffer(state.data(), state.size());
     uint32_t x, y, z, w;
     CHECK(buffer.Read32LE(&x));
@@ -67,11 +146,32 @@ class ProverImplBase : public tachyon::zk::plonk::halo2::Prover<PCS, LS> {
     }
 
     this->transcript_ = std::move(writer);
+    if (proof_output_.has_value()) {
+      this->GetWriter()->SetProofOutput(*proof_output_);
+    }
+    this->GetWriter()->set_proof_sink(proof_sink_);
+  }
+
+  // Writes the proofs straight into |output| from now on, including the ones
+  // written by the transcripts set later. See
+  // |crypto::TranscriptWriterBase::SetProofOutput()|.
+  void SetProofOutput(absl::Span<uint8_t> output) {
+    proof_output_ = output;
+    this->GetWriter()->SetProofOutput(output);
+  }
+
+  // Streams the proofs to |proof_sink| from now on, including the ones written
+  // by the transcripts set later. See
+  // |crypto::TranscriptWriterBase::set_proof_sink()|.
+  void SetProofSink(crypto::TranscriptWriterBase::ProofSink proof_sink) {
+    proof_sink_ = std::move(proof_sink);
+    this->GetWriter()->set_proof_sink(proof_sink_);
   }
 
   void CreateProof(
       tachyon::zk::plonk::ProvingKey<LS>& proving_key,
       tachyon::zk::plonk::halo2::ArgumentData<Poly, Evals>* argument_data) {
+    tachyon::base::ScopedThreadPool scoped_thread_pool(thread_pool_.get());
     std::string_view arg_data_str;
     if (tachyon::base::Environment::Get("TACHYON_ARG_DATA_LOG_PATH",
                                         &arg_data_str)) {
@@ -83,11 +183,33 @@ class ProverImplBase : public tachyon::zk::plonk::halo2::Prover<PCS, LS> {
                                           buffer.owned_buffer()));
     }
 
+    // NOTE: Every proof is written from the start of the proof output.
+    if (proof_output_.has_value()) {
+      this->GetWriter()->SetProofOutput(*proof_output_);
+    }
+    if (trace_recorder_) trace_recorder_->Reset();
     Base::CreateProof(proving_key, argument_data);
+    if (trace_recorder_ && !trace_path_.empty()) {
+      VLOG(1) << "Save prover trace to: " << trace_path_;
+      CHECK(trace_recorder_->WriteChromeTrace(
+          tachyon::base::FilePath(trace_path_)));
+    }
+    if (!trace_event_path_.empty()) {
+      VLOG(1) << "Save trace events to: " << trace_event_path_;
+      CHECK(tachyon::base::TraceLog::GetInstance().WriteChromeTrace(
+          tachyon::base::FilePath(trace_event_path_)));
+    }
   }
 
  protected:
   uint8_t transcript_type_;
+  std::shared_ptr<const void> proving_context_;
+  std::shared_ptr<tachyon::base::ThreadPool> thread_pool_;
+  std::unique_ptr<tachyon::base::TraceRecorder> trace_recorder_;
+  std::string_view trace_path_;
+  std::string_view trace_event_path_;
+  std::optional<absl::Span<uint8_t>> proof_output_;
+  crypto::TranscriptWriterBase::ProofSink proof_sink_;
 };
 
 }  // namespace tachyon::c::zk::plonk::halo2
@@ -1,10 +1,22 @@
+#include <algorithm>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_split.h"
+#include "absl/types/span.h"
 
 #include "tachyon/base/console/iostream.h"
 #include "tachyon/base/files/file_path_flag.h"
 #include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/flag/flag_parser.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/time/trace_recorder.h"
+#include "tachyon/c/base/parallel_runtime.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fr_type_traits.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_traits.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_shplonk_pcs.h"
@@ -54,45 +66,177 @@ void WriteParams(CProver* c_prover,
 }
 
 template <typename CProver>
-void CreateProof(CProver* c_prover, const std::vector<uint8_t>& pk_bytes,
-                 const std::vector<uint8_t>& arg_data_bytes,
-                 const std::vector<uint8_t>& transcript_state_bytes) {
+void SetUpProver(CProver* c_prover, const ProvingKey& pk) {
   using NativeProver = typename base::TypeTraits<CProver>::NativeType;
   using PCS = typename NativeProver::PCS;
 
   NativeProver* prover = base::native_cast(c_prover);
-  std::cout << "deserializing proving key" << std::endl;
-  ProvingKey pk(pk_bytes, /*read_only_vk=*/false);
-  std::cout << "done deserializing proving key" << std::endl;
-
   uint32_t extended_k = pk.verifying_key().constraint_system().ComputeExtendedK(
       prover->pcs().K());
   prover->set_extended_domain(
       PCS::ExtendedDomain::Create(size_t{1} << extended_k));
+}
+
+// Creates a proof from the captured inputs, so that every run starts from the
+// same transcript and rng state. If |rng_state_bytes| is empty, the rng state
+// is derived by replaying the blinds of the advice columns from the seed.
+template <typename CProver>
+std::vector<uint8_t> CreateProof(
+    CProver* c_prover, ProvingKey& pk,
+    const std::vector<uint8_t>& arg_data_bytes,
+    const std::vector<uint8_t>& transcript_state_bytes,
+    const std::optional<std::vector<uint8_t>>& rng_state_bytes) {
+  using NativeProver = typename base::TypeTraits<CProver>::NativeType;
+  using PCS = typename NativeProver::PCS;
 
+  NativeProver* prover = base::native_cast(c_prover);
   if constexpr (std::is_same_v<CProver, tachyon_halo2_bn254_shplonk_prover>) {
     tachyon_halo2_bn254_shplonk_prover_set_transcript_state(
         c_prover, transcript_state_bytes.data(), transcript_state_bytes.size());
   }
 
-  prover->SetRng(std::make_unique<crypto::XORShiftRNG>(
-      crypto::XORShiftRNG::FromSeed(tachyon::zk::plonk::halo2::kXORShiftSeed)));
-
-  std::cout << "deserializing argument data" << std::endl;
   ArgumentData<PCS> arg_data = DeserializeArgumentData<PCS>(arg_data_bytes);
-  std::cout << "done deserializing argument data" << std::endl;
-  for (size_t i = 0; i < arg_data.advice_blinds_vec().size(); ++i) {
-    const std::vector<tachyon::math::bn254::Fr>& advice_blinds =
-        arg_data.advice_blinds_vec()[i];
-    for (size_t j = 0; j < advice_blinds.size(); ++j) {
-      // Update Rng state
-      prover->blinder().Generate();
+  if (rng_state_bytes.has_value()) {
+    prover->SetRngState(rng_state_bytes.value());
+  } else {
+    prover->SetRng(
+        std::make_unique<crypto::XORShiftRNG>(crypto::XORShiftRNG::FromSeed(
+            tachyon::zk::plonk::halo2::kXORShiftSeed)));
+    for (size_t i = 0; i < arg_data.advice_blinds_vec().size(); ++i) {
+      const std::vector<tachyon::math::bn254::Fr>& advice_blinds =
+          arg_data.advice_blinds_vec()[i];
+      for (size_t j = 0; j < advice_blinds.size(); ++j) {
+        // Update Rng state
+        prover->blinder().Generate();
+      }
     }
   }
 
   prover->blinder().set_blinding_factors(
       pk.verifying_key().constraint_system().ComputeBlindingFactors());
   prover->CreateProof(pk, &arg_data);
+
+  std::vector<uint8_t> proof;
+  size_t proof_size;
+  tachyon_halo2_bn254_shplonk_prover_get_proof(c_prover, nullptr, &proof_size);
+  proof.resize(proof_size);
+  tachyon_halo2_bn254_shplonk_prover_get_proof(c_prover, proof.data(),
+                                               &proof_size);
+  return proof;
+}
+
+// The durations of a phase recorded by |tachyon::base::TraceRecorder| over
+// the measured runs.
+struct PhaseTiming {
+  std::string name;
+  size_t depth = 0;
+  std::vector<double> durations_us;
+
+  double Mean() const {
+    double sum = 0;
+    for (double duration : durations_us) {
+      sum += duration;
+    }
+    return sum / durations_us.size();
+  }
+
+  double Min() const {
+    return *std::min_element(durations_us.begin(), durations_us.end());
+  }
+};
+
+// Adds the events of a run to |timings|. The phases of a deterministic replay
+// are recorded in the same order, so the events are matched by their index.
+bool AddRun(const tachyon::base::TraceRecorder& recorder,
+            std::vector<PhaseTiming>& timings) {
+  const std::vector<tachyon::base::TraceRecorder::Event>& events =
+      recorder.events();
+  if (timings.empty()) {
+    timings.resize(events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+      timings[i].name = events[i].name;
+      timings[i].depth = events[i].depth;
+    }
+  } else if (timings.size() != events.size()) {
+    LOG(ERROR) << "The number of phases differs between the runs";
+    return false;
+  }
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (timings[i].name != events[i].name) {
+      LOG(ERROR) << "The phases differ between the runs: " << timings[i].name
+                 << " vs " << events[i].name;
+      return false;
+    }
+    timings[i].durations_us.push_back(events[i].duration.InMicrosecondsF());
+  }
+  return true;
+}
+
+// Writes |timings| as lines of "name,depth,mean_us,min_us", which can be
+// passed to --baseline of the later replays.
+bool WriteTimings(const std::vector<PhaseTiming>& timings,
+                  const tachyon::base::FilePath& path) {
+  std::string content;
+  for (const PhaseTiming& timing : timings) {
+    absl::StrAppendFormat(&content, "%s,%d,%.3f,%.3f\n", timing.name,
+                          timing.depth, timing.Mean(), timing.Min());
+  }
+  return tachyon::base::WriteFile(path, content);
+}
+
+// Reads the mean durations in microseconds written by |WriteTimings()|.
+bool ReadBaseline(const tachyon::base::FilePath& path,
+                  std::vector<std::pair<std::string, double>>* baseline) {
+  std::string content;
+  if (!tachyon::base::ReadFileToString(path, &content)) {
+    LOG(ERROR) << "Failed to read file: " << path.value();
+    return false;
+  }
+  for (std::string_view line :
+       absl::StrSplit(content, '\n', absl::SkipEmpty())) {
+    std::vector<std::string_view> fields = absl::StrSplit(line, ',');
+    double mean_us;
+    if (fields.size() != 4 || !absl::SimpleAtod(fields[2], &mean_us)) {
+      LOG(ERROR) << "Invalid baseline line: " << line;
+      return false;
+    }
+    baseline->emplace_back(std::string(fields[0]), mean_us);
+  }
+  return true;
+}
+
+void PrintTimings(
+    const std::vector<PhaseTiming>& timings,
+    const std::vector<std::pair<std::string, double>>& baseline) {
+  bool has_baseline = !baseline.empty();
+  if (has_baseline && baseline.size() != timings.size()) {
+    LOG(WARNING) << "The baseline has different phases, which are ignored";
+    has_baseline = false;
+  }
+  std::cout << absl::StrFormat("%-40s %12s %12s", "phase", "mean(ms)",
+                               "min(ms)");
+  if (has_baseline) {
+    std::cout << absl::StrFormat(" %12s %9s", "base(ms)", "delta");
+  }
+  std::cout << std::endl;
+  for (size_t i = 0; i < timings.size(); ++i) {
+    const PhaseTiming& timing = timings[i];
+    std::string name = std::string(2 * timing.depth, ' ') + timing.name;
+    double mean_us = timing.Mean();
+    std::cout << absl::StrFormat("%-40s %12.3f %12.3f", name, mean_us / 1000,
+                                 timing.Min() / 1000);
+    if (has_baseline) {
+      const auto& [base_name, base_mean_us] = baseline[i];
+      if (base_name == timing.name && base_mean_us > 0) {
+        std::cout << absl::StrFormat(
+            " %12.3f %+8.1f%%", base_mean_us / 1000,
+            (mean_us - base_mean_us) / base_mean_us * 100);
+      } else {
+        std::cout << absl::StrFormat(" %12s %9s", "-", "-");
+      }
+    }
+    std::cout << std::endl;
+  }
 }
 
 }  // namespace c::zk::plonk::halo2::bn254
@@ -117,6 +261,11 @@ int RunMain(int argc, char** argv) {
                  << std::endl;
     return 1;
   }
+  if (tachyon::base::Environment::Has("TACHYON_RNG_STATE_LOG_PATH")) {
+    tachyon_cerr << "If this is set, the rng state log is overwritten"
+                 << std::endl;
+    return 1;
+  }
 
   zk::plonk::halo2::TranscriptType transcript_type;
   uint32_t k;
@@ -125,6 +274,14 @@ int RunMain(int argc, char** argv) {
   tachyon::base::FilePath pk_path;
   tachyon::base::FilePath arg_data_path;
   tachyon::base::FilePath transcript_state_path;
+  tachyon::base::FilePath rng_state_path;
+  uint32_t num_threads = 0;
+  bool async_commit = false;
+  uint32_t precompute_factor = 0;
+  uint32_t num_runs = 1;
+  uint32_t num_warmups = 0;
+  tachyon::base::FilePath timings_path;
+  tachyon::base::FilePath baseline_path;
   tachyon::base::FlagParser parser;
   parser
       .AddFlag<tachyon::base::Flag<zk::plonk::halo2::TranscriptType>>(
@@ -154,6 +311,38 @@ int RunMain(int argc, char** argv) {
       .set_long_name("--transcript_state")
       .set_required()
       .set_help("The path to transcript state");
+  parser.AddFlag<tachyon::base::FilePathFlag>(&rng_state_path)
+      .set_long_name("--rng_state")
+      .set_help(
+          "The path to rng state saved by TACHYON_RNG_STATE_LOG_PATH. If not "
+          "given, it is derived from the advice blinds of argument data.");
+  parser.AddFlag<tachyon::base::Uint32Flag>(&num_threads)
+      .set_long_name("--threads")
+      .set_help(
+          "The number of threads to prove with. If 0, the default thread pool "
+          "is used.");
+  parser.AddFlag<tachyon::base::BoolFlag>(&async_commit)
+      .set_long_name("--async_commit")
+      .set_help("Whether to overlap commitments with the next phase");
+  parser.AddFlag<tachyon::base::Uint32Flag>(&precompute_factor)
+      .set_long_name("--precompute_factor")
+      .set_help(
+          "If positive, commits with the MSM of the bases precomputed by this "
+          "factor.");
+  parser.AddFlag<tachyon::base::Uint32Flag>(&num_runs)
+      .set_long_name("--runs")
+      .set_help("The number of measured runs, which is 1 by default");
+  parser.AddFlag<tachyon::base::Uint32Flag>(&num_warmups)
+      .set_long_name("--warmups")
+      .set_help("The number of runs before the measured ones");
+  parser.AddFlag<tachyon::base::FilePathFlag>(&timings_path)
+      .set_long_name("--timings_output")
+      .set_help("The path to write the timings of the phases to");
+  parser.AddFlag<tachyon::base::FilePathFlag>(&baseline_path)
+      .set_long_name("--baseline")
+      .set_help(
+          "The path to the timings written by --timings_output of another "
+          "replay, against which the deltas are printed");
   {
     std::string error;
     if (!parser.Parse(argc, argv, &error)) {
@@ -162,10 +351,12 @@ int RunMain(int argc, char** argv) {
     }
   }
 
-  std ::optional<std::vector<uint8_t>> pk_bytes =
-      tachyon::base::ReadFileToBytes(pk_path);
-  if (!pk_bytes.has_value()) {
-    tachyon_cerr << "Failed to read file: " << pk_path.value() << std::endl;
+  // NOTE: The proving key is deserialized straight from the mapping, which
+  // saves a copy of the whole file.
+  tachyon::base::MemoryMappedFile pk_file;
+  if (!pk_file.Initialize(
+          pk_path, tachyon::base::MemoryMappedFile::Access::kSequential)) {
+    tachyon_cerr << "Failed to map file: " << pk_path.value() << std::endl;
     return 1;
   }
 
@@ -185,6 +376,26 @@ int RunMain(int argc, char** argv) {
     return 1;
   }
 
+  std::optional<std::vector<uint8_t>> rng_state_bytes;
+  if (!rng_state_path.empty()) {
+    rng_state_bytes = tachyon::base::ReadFileToBytes(rng_state_path);
+    if (!rng_state_bytes.has_value()) {
+      tachyon_cerr << "Failed to read file: " << rng_state_path.value()
+                   << std::endl;
+      return 1;
+    }
+  }
+
+  if (num_runs == 0) {
+    tachyon_cerr << "--runs must be positive" << std::endl;
+    return 1;
+  }
+  std::vector<std::pair<std::string, double>> baseline;
+  if (!baseline_path.empty() &&
+      !c::zk::plonk::halo2::bn254::ReadBaseline(baseline_path, &baseline)) {
+    return 1;
+  }
+
   tachyon_halo2_bn254_shplonk_prover* prover;
   std::optional<std::vector<uint8_t>> pcs_params_bytes;
   if (!pcs_params_path.empty()) {
@@ -214,17 +425,67 @@ int RunMain(int argc, char** argv) {
     }
   }
 
-  c::zk::plonk::halo2::bn254::CreateProof(prover, pk_bytes.value(),
-                                          arg_data_bytes.value(),
-                                          transcript_state_bytes.value());
+  using NativeProver = c::base::TypeTraits<
+      tachyon_halo2_bn254_shplonk_prover>::NativeType;
+  NativeProver* native_prover = c::base::native_cast(prover);
+  tachyon_thread_pool* thread_pool = nullptr;
+  if (num_threads > 0) {
+    thread_pool =
+        tachyon_thread_pool_create(num_threads, TACHYON_THREAD_AFFINITY_NONE);
+    tachyon_halo2_bn254_shplonk_prover_set_thread_pool(prover, thread_pool);
+  }
+  native_prover->set_async_commit(async_commit);
+  if (precompute_factor > 0) {
+    std::cout << "precomputing bases" << std::endl;
+    CHECK(native_prover->pcs().Precompute(precompute_factor));
+    std::cout << "done precomputing bases" << std::endl;
+  }
+  native_prover->EnableTrace(true);
+
+  std::cout << "deserializing proving key" << std::endl;
+  c::zk::plonk::halo2::bn254::ProvingKey pk(pk_file.bytes(),
+                                            /*read_only_vk=*/false);
+  std::cout << "done deserializing proving key" << std::endl;
+  c::zk::plonk::halo2::bn254::SetUpProver(prover, pk);
+  if (num_runs + num_warmups > 1) {
+    // NOTE: The proving key is kept intact, so that every run proves the
+    // same way as the first one.
+    native_prover->set_keep_fixed_columns(true);
+    native_prover->set_cache_lookup_tables(false);
+  }
 
   std::vector<uint8_t> proof;
-  size_t proof_size;
-  tachyon_halo2_bn254_shplonk_prover_get_proof(prover, nullptr, &proof_size);
-  proof.resize(proof_size);
-  tachyon_halo2_bn254_shplonk_prover_get_proof(prover, proof.data(),
-                                               &proof_size);
+  std::vector<c::zk::plonk::halo2::bn254::PhaseTiming> timings;
+  for (uint32_t i = 0; i < num_warmups + num_runs; ++i) {
+    bool is_warmup = i < num_warmups;
+    std::cout << (is_warmup ? "warmup " : "run ")
+              << (is_warmup ? i : i - num_warmups) << std::endl;
+    std::vector<uint8_t> run_proof = c::zk::plonk::halo2::bn254::CreateProof(
+        prover, pk, arg_data_bytes.value(), transcript_state_bytes.value(),
+        rng_state_bytes);
+    if (i == 0) {
+      proof = std::move(run_proof);
+    } else if (run_proof != proof) {
+      tachyon_cerr << "The proof differs from the first run, so the replay "
+                      "is not deterministic"
+                   << std::endl;
+    }
+    if (is_warmup) continue;
+    if (!c::zk::plonk::halo2::bn254::AddRun(*native_prover->trace_recorder(),
+                                            timings)) {
+      return 1;
+    }
+  }
+
+  c::zk::plonk::halo2::bn254::PrintTimings(timings, baseline);
+  if (!timings_path.empty() &&
+      !c::zk::plonk::halo2::bn254::WriteTimings(timings, timings_path)) {
+    tachyon_cerr << "Failed to write file: " << timings_path.value()
+                 << std::endl;
+    return 1;
+  }
 
+  size_t proof_size = proof.size();
   std::cout << "proof: [";
   for (size_t i = 0; i < proof_size; ++i) {
     std::cout << uint32_t{proof[i]};
@@ -235,6 +496,7 @@ int RunMain(int argc, char** argv) {
   std::cout << "]" << std::endl;
 
   tachyon_halo2_bn254_shplonk_prover_destroy(prover);
+  if (thread_pool) tachyon_thread_pool_destroy(thread_pool);
   return 0;
 }
 
@@ -0,0 +1,61 @@
+#ifndef TACHYON_C_ZK_PLONK_HALO2_PROVING_CONTEXT_H_
+#define TACHYON_C_ZK_PLONK_HALO2_PROVING_CONTEXT_H_
+
+#include <memory>
+#include <utility>
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::c::zk::plonk::halo2 {
+
+// |ProvingContext| holds the data that doesn't change from proof to proof of
+// a circuit, i.e, the PCS with the SRS, the domains with their twiddles and the
+// proving key, so that several provers proving the same circuit concurrently
+// can borrow a single copy of it. It is owned by a |std::shared_ptr| and each
+// prover created from it keeps a reference to it.
+// NOTE: The copy of the PCS shares the SRS with the PCS that it is copied
+// from. See |crypto::KZG|.
+template <typename PCS, typename ProvingKey>
+class ProvingContext {
+ public:
+  using Domain = typename PCS::Domain;
+  using ExtendedDomain = typename PCS::ExtendedDomain;
+
+  ProvingContext(const PCS& pcs, std::shared_ptr<const Domain> domain,
+                 std::shared_ptr<const ExtendedDomain> extended_domain,
+                 std::unique_ptr<ProvingKey> proving_key)
+      : pcs_(pcs),
+        domain_(std::move(domain)),
+        extended_domain_(std::move(extended_domain)),
+        proving_key_(std::move(proving_key)) {
+    CHECK(domain_);
+    CHECK(extended_domain_);
+    // Page in every column now, since paging in lazily isn't thread-safe.
+    // See |zk::plonk::ProvingKeyColumnLoader|.
+    proving_key_->fixed_columns();
+    proving_key_->fixed_polys();
+    proving_key_->permutation_proving_key();
+  }
+  ProvingContext(const ProvingContext& other) = delete;
+  ProvingContext& operator=(const ProvingContext& other) = delete;
+
+  const PCS& pcs() const { return pcs_; }
+  const std::shared_ptr<const Domain>& domain() const { return domain_; }
+  const std::shared_ptr<const ExtendedDomain>& extended_domain() const {
+    return extended_domain_;
+  }
+  // NOTE: This is not const since |zk::plonk::halo2::Prover::CreateProof()|
+  // takes a mutable proving key. The provers created from the context don't
+  // modify it though. See |zk::plonk::halo2::Prover::set_keep_fixed_columns()|.
+  ProvingKey* proving_key() const { return proving_key_.get(); }
+
+ private:
+  PCS pcs_;
+  std::shared_ptr<const Domain> domain_;
+  std::shared_ptr<const ExtendedDomain> extended_domain_;
+  std::unique_ptr<ProvingKey> proving_key_;
+};
+
+}  // namespace tachyon::c::zk::plonk::halo2
+
+#endif  // TACHYON_C_ZK_PLONK_HALO2_PROVING_CONTEXT_H_
@@ -1,8 +1,11 @@
 #include <string>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/console/iostream.h"
 #include "tachyon/base/files/file_path_flag.h"
 #include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/flag/flag_parser.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_shplonk_pcs.h"
@@ -37,7 +40,7 @@ std::vector<std::vector<typename PCS::Evals>> GetInstanceColumnsVec() {
 }
 
 template <typename CVerifier>
-bool VerifyProof(CVerifier* c_verifier, const std::vector<uint8_t>& pk_bytes) {
+bool VerifyProof(CVerifier* c_verifier, absl::Span<const uint8_t> pk_bytes) {
   using NativeVerifier = typename base::TypeTraits<CVerifier>::NativeType;
   using PCS = typename NativeVerifier::PCS;
 
@@ -99,10 +102,10 @@ int RunMain(int argc, char** argv) {
     }
   }
 
-  std ::optional<std::vector<uint8_t>> pk_bytes =
-      base::ReadFileToBytes(pk_path);
-  if (!pk_bytes.has_value()) {
-    tachyon_cerr << "Failed to read file: " << pk_path.value() << std::endl;
+  base::MemoryMappedFile pk_file;
+  if (!pk_file.Initialize(pk_path,
+                          base::MemoryMappedFile::Access::kSequential)) {
+    tachyon_cerr << "Failed to map file: " << pk_path.value() << std::endl;
     return 1;
   }
 
@@ -121,7 +124,7 @@ int RunMain(int argc, char** argv) {
           pcs_params_bytes->size(), std::data(kProof), std::size(kProof));
   std::cout << "done creating verifier" << std::endl;
 
-  if (!c::zk::plonk::halo2::bn254::VerifyProof(verifier, pk_bytes.value())) {
+  if (!c::zk::plonk::halo2::bn254::VerifyProof(verifier, pk_file.bytes())) {
     tachyon_halo2_bn254_shplonk_verifier_destroy(verifier);
     tachyon_cerr << "Failed to verify proof" << std::endl;
     return 1;
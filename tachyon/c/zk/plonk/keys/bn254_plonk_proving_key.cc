@@ -19,6 +19,38 @@ tachyon_bn254_plonk_proving_key_create_from_state(const uint8_t* state,
   return reinterpret_cast<tachyon_bn254_plonk_proving_key*>(pkey);
 }
 
+tachyon_bn254_plonk_proving_key*
+tachyon_bn254_plonk_proving_key_create_from_native_file(const char* path) {
+  PKeyImpl* pkey = new PKeyImpl();
+  if (!pkey->LoadNative(base::FilePath(path))) {
+    delete pkey;
+    return nullptr;
+  }
+  return reinterpret_cast<tachyon_bn254_plonk_proving_key*>(pkey);
+}
+
+tachyon_bn254_plonk_proving_key*
+tachyon_bn254_plonk_proving_key_create_lazily_from_native_file(
+    const char* path) {
+  PKeyImpl* pkey = new PKeyImpl();
+  if (!pkey->LoadNative(base::FilePath(path), /*lazy=*/true)) {
+    delete pkey;
+    return nullptr;
+  }
+  return reinterpret_cast<tachyon_bn254_plonk_proving_key*>(pkey);
+}
+
+void tachyon_bn254_plonk_proving_key_release_columns(
+    tachyon_bn254_plonk_proving_key* pk) {
+  reinterpret_cast<PKeyImpl*>(pk)->ReleaseColumns();
+}
+
+bool tachyon_bn254_plonk_proving_key_write_native_file(
+    const tachyon_bn254_plonk_proving_key* pk, const char* path) {
+  const PKeyImpl* pkey = reinterpret_cast<const PKeyImpl*>(pk);
+  return pkey->WriteNative(base::FilePath(path));
+}
+
 void tachyon_bn254_plonk_proving_key_destroy(
     tachyon_bn254_plonk_proving_key* pk) {
   delete reinterpret_cast<PKeyImpl*>(pk);
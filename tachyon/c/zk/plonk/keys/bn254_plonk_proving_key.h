@@ -6,6 +6,7 @@
 #ifndef TACHYON_C_ZK_PLONK_KEYS_BN254_PLONK_PROVING_KEY_H_
 #define TACHYON_C_ZK_PLONK_KEYS_BN254_PLONK_PROVING_KEY_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -34,6 +35,57 @@ TACHYON_C_EXPORT tachyon_bn254_plonk_proving_key*
 tachyon_bn254_plonk_proving_key_create_from_state(const uint8_t* state,
                                                   size_t state_len);
 
+/**
+ * @brief Creates a PLONK proving key for the BN254 curve from a file written by
+ * tachyon_bn254_plonk_proving_key_write_native_file().
+ *
+ * The file is memory mapped and its columns are copied as they are, which is
+ * much faster than deserializing the state of the proving key.
+ *
+ * @param path The null-terminated path to the native proving key file.
+ * @return A pointer to the newly created PLONK proving key, or NULL if the file
+ * can't be loaded.
+ */
+TACHYON_C_EXPORT tachyon_bn254_plonk_proving_key*
+tachyon_bn254_plonk_proving_key_create_from_native_file(const char* path);
+
+/**
+ * @brief Creates a PLONK proving key for the BN254 curve from a file written by
+ * tachyon_bn254_plonk_proving_key_write_native_file(), paging in its fixed
+ * columns, fixed polynomials and permutation polynomials from the file when
+ * they are first used.
+ *
+ * @param path The null-terminated path to the native proving key file.
+ * @return A pointer to the newly created PLONK proving key, or NULL if the file
+ * can't be loaded.
+ */
+TACHYON_C_EXPORT tachyon_bn254_plonk_proving_key*
+tachyon_bn254_plonk_proving_key_create_lazily_from_native_file(
+    const char* path);
+
+/**
+ * @brief Drops the columns of a PLONK proving key for the BN254 curve that can
+ * be paged in again, e.g, under memory pressure between proofs. This does
+ * nothing unless the proving key is created by
+ * tachyon_bn254_plonk_proving_key_create_lazily_from_native_file().
+ *
+ * @param pk A pointer to the PLONK proving key.
+ */
+TACHYON_C_EXPORT void tachyon_bn254_plonk_proving_key_release_columns(
+    tachyon_bn254_plonk_proving_key* pk);
+
+/**
+ * @brief Writes a PLONK proving key for the BN254 curve to a file in the native
+ * format, so that it can be loaded by
+ * tachyon_bn254_plonk_proving_key_create_from_native_file() afterwards.
+ *
+ * @param pk A pointer to the PLONK proving key created from a state.
+ * @param path The null-terminated path to write the native proving key file.
+ * @return True if the file is written successfully, false otherwise.
+ */
+TACHYON_C_EXPORT bool tachyon_bn254_plonk_proving_key_write_native_file(
+    const tachyon_bn254_plonk_proving_key* pk, const char* path);
+
 /**
  * @brief Destroys a PLONK proving key for the BN254 curve, freeing its
  * resources.
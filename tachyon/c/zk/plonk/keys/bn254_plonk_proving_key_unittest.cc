@@ -1,5 +1,8 @@
 #include "tachyon/c/zk/plonk/keys/bn254_plonk_proving_key.h"
 
+#include <memory>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/c/zk/plonk/halo2/bn254_ls.h"
@@ -15,6 +18,39 @@ class Bn254PlonkProvingKeyTest : public math::FiniteFieldTest<math::bn254::Fr> {
   using LS = c::zk::plonk::halo2::bn254::LS;
 };
 
+using Poly = Bn254PlonkProvingKeyTest::LS::Poly;
+using Evals = Bn254PlonkProvingKeyTest::LS::Evals;
+
+class FakeColumnLoader : public ProvingKeyColumnLoader<Poly, Evals> {
+ public:
+  explicit FakeColumnLoader(size_t* num_loads) : num_loads_(num_loads) {}
+
+  // ProvingKeyColumnLoader<Poly, Evals> methods
+  bool LoadFixedColumns(std::vector<Evals>* fixed_columns) override {
+    ++*num_loads_;
+    *fixed_columns = {Evals::One(kDegree)};
+    return true;
+  }
+  bool LoadFixedPolys(std::vector<Poly>* fixed_polys) override {
+    ++*num_loads_;
+    *fixed_polys = {Poly::One()};
+    return true;
+  }
+  bool LoadPermutationProvingKey(PermutationProvingKey<Poly, Evals>*
+                                     permutation_proving_key) override {
+    ++*num_loads_;
+    *permutation_proving_key = PermutationProvingKey<Poly, Evals>(
+        {Evals::One(kDegree)}, {Poly::One()});
+    return true;
+  }
+
+ private:
+  constexpr static size_t kDegree = 3;
+
+  // not owned
+  size_t* const num_loads_;
+};
+
 }  // namespace
 
 TEST_F(Bn254PlonkProvingKeyTest, GetVerifyingKey) {
@@ -27,4 +63,28 @@ TEST_F(Bn254PlonkProvingKeyTest, GetVerifyingKey) {
                 &cpp_pkey.verifying_key()));
 }
 
+TEST_F(Bn254PlonkProvingKeyTest, ColumnLoader) {
+  ProvingKey<LS> pkey;
+  size_t num_loads = 0;
+  pkey.SetColumnLoader(std::make_unique<FakeColumnLoader>(&num_loads));
+  EXPECT_TRUE(pkey.has_column_loader());
+  EXPECT_EQ(num_loads, size_t{0});
+
+  for (size_t i = 0; i < 2; ++i) {
+    EXPECT_EQ(pkey.fixed_columns().size(), size_t{1});
+    EXPECT_EQ(pkey.fixed_polys(), std::vector<Poly>{Poly::One()});
+    EXPECT_EQ(pkey.permutation_proving_key().polys(),
+              std::vector<Poly>{Poly::One()});
+  }
+  EXPECT_EQ(num_loads, size_t{3});
+
+  pkey.ReleaseFixedColumns();
+  EXPECT_EQ(pkey.fixed_columns().size(), size_t{1});
+  EXPECT_EQ(num_loads, size_t{4});
+
+  pkey.ReleaseColumns();
+  EXPECT_EQ(pkey.fixed_polys().size(), size_t{1});
+  EXPECT_EQ(num_loads, size_t{5});
+}
+
 }  // namespace tachyon::zk::plonk
@@ -2,19 +2,28 @@
 #define TACHYON_C_ZK_PLONK_KEYS_PROVING_KEY_IMPL_BASE_H_
 
 #include <stdint.h>
+#include <string.h>
 
+#include <iterator>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "absl/types/span.h"
 
+#include "tachyon/base/bits.h"
 #include "tachyon/base/buffer/read_only_buffer.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/environment.h"
+#include "tachyon/base/files/async_file_reader.h"
 #include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/c/zk/plonk/halo2/buffer_reader.h"
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
 #include "tachyon/zk/plonk/keys/proving_key.h"
+#include "tachyon/zk/plonk/keys/proving_key_column_loader.h"
 
 namespace tachyon::c::zk::plonk {
 
@@ -23,7 +32,29 @@ class ProvingKeyImplBase : public tachyon::zk::plonk::ProvingKey<LS> {
  public:
   using F = typename LS::Field;
   using C = typename LS::Commitment;
+  using Poly = typename LS::Poly;
+  using Evals = typename LS::Evals;
 
+  // The native format starts with the header below, followed by the halo2
+  // serialization of the verifying key and then the columns of the proving
+  // key. Each column is its length as a uint64_t followed by the in-memory
+  // representation of its elements aligned to |kNativeAlignment|, so that it
+  // can be copied from the memory mapped file as it is.
+  // clang-format off
+  // +-------+---------+------------+----------------+--------+-----------+
+  // | magic | version | field size | F::One() bytes | vk len | vk bytes  |
+  // +-------+---------+------------+----------------+--------+-----------+
+  // |  u64  |   u32   |    u32     |   field size   |  u64   | vk len    |
+  // +-------+---------+------------+----------------+--------+-----------+
+  // clang-format on
+  // NOTE: The elements are written in the limbs of the host, which is checked
+  // with F::One() when loaded, so the file can't be shared across hosts whose
+  // endianness or field representation are different.
+  constexpr static uint64_t kNativeMagic = 0x4b50'4e4f'4843'4154;  // TACHONPK
+  constexpr static uint32_t kNativeVersion = 1;
+  constexpr static size_t kNativeAlignment = 64;
+
+  ProvingKeyImplBase() = default;
   ProvingKeyImplBase(absl::Span<const uint8_t> state, bool read_only_vk)
       : read_only_vk_(read_only_vk) {
     std::string_view pk_str;
@@ -52,10 +83,325 @@ class ProvingKeyImplBase : public tachyon::zk::plonk::ProvingKey<LS> {
     return this->verifying_key_.transcript_repr_;
   }
 
+  // Writes the proving key to |path| in the native format. This is meant to be
+  // done once after loading the proving key from the halo2 serialization, so
+  // that following runs can load it with |LoadNative()| instead.
+  [[nodiscard]] bool WriteNative(const tachyon::base::FilePath& path) const {
+    if (read_only_vk_ || vk_state_.empty()) {
+      LOG(ERROR) << "The proving key isn't loaded from the halo2 serialization";
+      return false;
+    }
+
+    std::vector<uint8_t> out;
+    WriteNativeValue(out, kNativeMagic);
+    WriteNativeValue(out, kNativeVersion);
+    WriteNativeValue(out, static_cast<uint32_t>(sizeof(F)));
+    WriteNativeValue(out, F::One());
+    WriteNativeValue(out, static_cast<uint64_t>(vk_state_.size()));
+    out.insert(out.end(), vk_state_.begin(), vk_state_.end());
+
+    WriteNativeColumn(out, this->l_first_.coefficients().coefficients());
+    WriteNativeColumn(out, this->l_last_.coefficients().coefficients());
+    WriteNativeColumn(out, this->l_active_row_.coefficients().coefficients());
+    const std::vector<Evals>& fixed_columns = this->fixed_columns();
+    WriteNativeValue(out, static_cast<uint64_t>(fixed_columns.size()));
+    for (const Evals& column : fixed_columns) {
+      WriteNativeColumn(out, column.evaluations());
+    }
+    const std::vector<Poly>& fixed_polys = this->fixed_polys();
+    WriteNativeValue(out, static_cast<uint64_t>(fixed_polys.size()));
+    for (const Poly& poly : fixed_polys) {
+      WriteNativeColumn(out, poly.coefficients().coefficients());
+    }
+    const std::vector<Evals>& permutations =
+        this->permutation_proving_key().permutations();
+    WriteNativeValue(out, static_cast<uint64_t>(permutations.size()));
+    for (const Evals& permutation : permutations) {
+      WriteNativeColumn(out, permutation.evaluations());
+    }
+    const std::vector<Poly>& permutation_polys =
+        this->permutation_proving_key().polys();
+    WriteNativeValue(out, static_cast<uint64_t>(permutation_polys.size()));
+    for (const Poly& poly : permutation_polys) {
+      WriteNativeColumn(out, poly.coefficients().coefficients());
+    }
+    return tachyon::base::WriteLargeFile(path, out);
+  }
+
+  // Loads the proving key from |path| written by |WriteNative()|. The header
+  // is parsed out of the memory mapped file, and every column is read straight
+  // into its vector by |AsyncFileReader| instead of being deserialized element
+  // by element. If |lazy| is true, the fixed columns, the fixed polys and the
+  // permutation proving key are copied out of the mapping only when they are
+  // first touched, and the file is kept mapped until then. See
+  // |ProvingKey::ReleaseColumns()|.
+  [[nodiscard]] bool LoadNative(const tachyon::base::FilePath& path,
+                                bool lazy = false) {
+    auto file = std::make_unique<tachyon::base::MemoryMappedFile>();
+    if (!file->Initialize(path)) return false;
+
+    NativeReader reader(file->ToBuffer());
+    uint64_t magic;
+    uint32_t version;
+    uint32_t field_size;
+    if (!reader.Read(&magic) || !reader.Read(&version) ||
+        !reader.Read(&field_size)) {
+      return false;
+    }
+    if (magic != kNativeMagic || version != kNativeVersion) {
+      LOG(ERROR) << "Not a native proving key of version " << kNativeVersion;
+      return false;
+    }
+    if (field_size != sizeof(F)) {
+      LOG(ERROR) << "Field size mismatch: " << field_size << " vs "
+                 << sizeof(F);
+      return false;
+    }
+    F one;
+    if (!reader.Read(&one)) return false;
+    if (one != F::One()) {
+      LOG(ERROR) << "Field representation mismatch";
+      return false;
+    }
+
+    uint64_t vk_len;
+    absl::Span<const uint8_t> vk_state;
+    if (!reader.Read(&vk_len) || !reader.ReadBytes(vk_len, &vk_state)) {
+      return false;
+    }
+    tachyon::base::ReadOnlyBuffer vk_buffer(vk_state.data(), vk_state.size());
+    ReadVerifyingKey(vk_buffer, this->verifying_key_);
+    if (!vk_buffer.Done()) {
+      LOG(ERROR) << "Invalid verifying key";
+      return false;
+    }
+
+    // Collect the locations of every column first, so that they can be copied
+    // in parallel.
+    std::vector<absl::Span<const F>> poly_columns(3);
+    for (absl::Span<const F>& column : poly_columns) {
+      if (!reader.ReadColumn(&column)) return false;
+    }
+    NativeColumns columns;
+    for (std::vector<absl::Span<const F>>* group :
+         {&columns.fixed_columns, &columns.fixed_polys, &columns.permutations,
+          &columns.permutation_polys}) {
+      uint64_t num_columns;
+      if (!reader.Read(&num_columns)) return false;
+      group->resize(num_columns);
+      for (absl::Span<const F>& column : *group) {
+        if (!reader.ReadColumn(&column)) return false;
+      }
+    }
+    if (!reader.Done()) {
+      LOG(ERROR) << "Trailing bytes in " << path.value();
+      return false;
+    }
+
+    if (lazy) {
+      std::vector<std::vector<F>> poly_coeffs = CopyColumns(poly_columns);
+      this->l_first_ = ToPoly(std::move(poly_coeffs[0]));
+      this->l_last_ = ToPoly(std::move(poly_coeffs[1]));
+      this->l_active_row_ = ToPoly(std::move(poly_coeffs[2]));
+      this->SetColumnLoader(std::make_unique<NativeColumnLoader>(
+          std::move(file), std::move(columns)));
+    } else {
+      // Read every column in one go, so that as many reads as possible are
+      // kept in flight.
+      std::vector<absl::Span<const F>> all_columns = poly_columns;
+      for (const std::vector<absl::Span<const F>>* group :
+           {&columns.fixed_columns, &columns.fixed_polys, &columns.permutations,
+            &columns.permutation_polys}) {
+        all_columns.insert(all_columns.end(), group->begin(), group->end());
+      }
+      std::vector<std::vector<F>> values;
+      if (!ReadColumns(path, *file, all_columns, &values)) return false;
+      auto it = std::make_move_iterator(values.begin());
+      auto take = [&it](size_t n) {
+        std::vector<std::vector<F>> ret(it, it + n);
+        it += n;
+        return ret;
+      };
+      std::vector<std::vector<F>> poly_coeffs = take(poly_columns.size());
+      this->l_first_ = ToPoly(std::move(poly_coeffs[0]));
+      this->l_last_ = ToPoly(std::move(poly_coeffs[1]));
+      this->l_active_row_ = ToPoly(std::move(poly_coeffs[2]));
+      this->column_loader_.reset();
+      this->fixed_columns_ = ToEvalsList(take(columns.fixed_columns.size()));
+      this->fixed_polys_ = ToPolys(take(columns.fixed_polys.size()));
+      // NOTE: The order of evaluating the arguments is unspecified.
+      std::vector<Evals> permutations =
+          ToEvalsList(take(columns.permutations.size()));
+      this->permutation_proving_key_ =
+          tachyon::zk::plonk::PermutationProvingKey<Poly, Evals>(
+              std::move(permutations),
+              ToPolys(take(columns.permutation_polys.size())));
+    }
+    this->vanishing_argument_ =
+        tachyon::zk::plonk::VanishingArgument<LS>::Create(
+            this->verifying_key_.constraint_system_);
+    this->lookup_table_index_cache_.Clear();
+    vk_state_.assign(vk_state.begin(), vk_state.end());
+    read_only_vk_ = false;
+    return true;
+  }
+
  private:
+  // Reads the values written by |WriteNative()| out of the memory mapped file.
+  class NativeReader {
+   public:
+    explicit NativeReader(tachyon::base::ReadOnlyBuffer&& buffer)
+        : buffer_(std::move(buffer)) {}
+
+    bool Done() const { return buffer_.Done(); }
+
+    // NOTE: The header values are not necessarily aligned, e.g., the length
+    // of the column following the verifying key, so they are copied rather
+    // than viewed in place.
+    template <typename T>
+    [[nodiscard]] bool Read(T* value) {
+      absl::Span<const uint8_t> bytes;
+      if (!ReadSpan(sizeof(T), &bytes)) return false;
+      memcpy(value, bytes.data(), sizeof(T));
+      return true;
+    }
+
+    [[nodiscard]] bool ReadBytes(uint64_t len,
+                                 absl::Span<const uint8_t>* bytes) {
+      return ReadSpan(len, bytes);
+    }
+
+    [[nodiscard]] bool ReadColumn(absl::Span<const F>* column) {
+      uint64_t len;
+      if (!Read(&len)) return false;
+      buffer_.set_buffer_offset(tachyon::base::bits::AlignUp(
+          buffer_.buffer_offset(), kNativeAlignment));
+      return ReadSpan(len, column);
+    }
+
+   private:
+    template <typename T>
+    [[nodiscard]] bool ReadSpan(uint64_t len, absl::Span<const T>* values) {
+      if (!buffer_.ReadSpan(len, values)) {
+        LOG(ERROR) << "Native proving key is truncated";
+        return false;
+      }
+      return true;
+    }
+
+    tachyon::base::ReadOnlyBuffer buffer_;
+  };
+
+  // The locations of the columns in the memory mapped file.
+  struct NativeColumns {
+    std::vector<absl::Span<const F>> fixed_columns;
+    std::vector<absl::Span<const F>> fixed_polys;
+    std::vector<absl::Span<const F>> permutations;
+    std::vector<absl::Span<const F>> permutation_polys;
+  };
+
+  // Pages in the columns out of the memory mapped file for |LoadNative()| with
+  // |lazy| set.
+  class NativeColumnLoader
+      : public tachyon::zk::plonk::ProvingKeyColumnLoader<Poly, Evals> {
+   public:
+    NativeColumnLoader(std::unique_ptr<tachyon::base::MemoryMappedFile> file,
+                       NativeColumns&& columns)
+        : file_(std::move(file)), columns_(std::move(columns)) {}
+
+    // tachyon::zk::plonk::ProvingKeyColumnLoader<Poly, Evals> methods
+    bool LoadFixedColumns(std::vector<Evals>* fixed_columns) override {
+      *fixed_columns = ToEvalsList(CopyColumns(columns_.fixed_columns));
+      return true;
+    }
+    bool LoadFixedPolys(std::vector<Poly>* fixed_polys) override {
+      *fixed_polys = ToPolys(CopyColumns(columns_.fixed_polys));
+      return true;
+    }
+    bool LoadPermutationProvingKey(
+        tachyon::zk::plonk::PermutationProvingKey<Poly, Evals>*
+            permutation_proving_key) override {
+      *permutation_proving_key =
+          tachyon::zk::plonk::PermutationProvingKey<Poly, Evals>(
+              ToEvalsList(CopyColumns(columns_.permutations)),
+              ToPolys(CopyColumns(columns_.permutation_polys)));
+      return true;
+    }
+
+   private:
+    // |columns_| points into |file_|.
+    std::unique_ptr<tachyon::base::MemoryMappedFile> file_;
+    NativeColumns columns_;
+  };
+
+  static std::vector<std::vector<F>> CopyColumns(
+      const std::vector<absl::Span<const F>>& columns) {
+    std::vector<std::vector<F>> ret(columns.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < columns.size(); ++i) {
+      ret[i].resize(columns[i].size());
+      memcpy(ret[i].data(), columns[i].data(), columns[i].size() * sizeof(F));
+    }
+    return ret;
+  }
+
+  // Reads |columns| located in the memory mapped |file| of |path| into |ret|
+  // with |AsyncFileReader|, which overlaps the reads and, unlike copying out
+  // of the mapping, doesn't fault in the pages of the file one by one.
+  static bool ReadColumns(const tachyon::base::FilePath& path,
+                          const tachyon::base::MemoryMappedFile& file,
+                          const std::vector<absl::Span<const F>>& columns,
+                          std::vector<std::vector<F>>* ret) {
+    tachyon::base::AsyncFileReader reader;
+    if (!reader.Initialize(path)) return false;
+    std::vector<tachyon::base::AsyncFileReader::Request> requests(
+        columns.size());
+    ret->resize(columns.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < columns.size(); ++i) {
+      (*ret)[i].resize(columns[i].size());
+      const uint8_t* bytes =
+          reinterpret_cast<const uint8_t*>(columns[i].data());
+      requests[i] = {static_cast<int64_t>(bytes - file.data()),
+                     (*ret)[i].data(), columns[i].size() * sizeof(F)};
+    }
+    return reader.Read(requests);
+  }
+
+  template <typename T>
+  static void WriteNativeValue(std::vector<uint8_t>& out, const T& value) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+  }
+
+  static void WriteNativeColumn(std::vector<uint8_t>& out,
+                                const std::vector<F>& column) {
+    WriteNativeValue(out, static_cast<uint64_t>(column.size()));
+    out.resize(tachyon::base::bits::AlignUp(out.size(), kNativeAlignment));
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(column.data());
+    out.insert(out.end(), bytes, bytes + column.size() * sizeof(F));
+  }
+
+  static Poly ToPoly(std::vector<F>&& coeffs) {
+    return Poly(typename Poly::Coefficients(std::move(coeffs)));
+  }
+
+  static std::vector<Poly> ToPolys(std::vector<std::vector<F>>&& coeffs_list) {
+    return tachyon::base::Map(coeffs_list, [](std::vector<F>& coeffs) {
+      return ToPoly(std::move(coeffs));
+    });
+  }
+
+  static std::vector<Evals> ToEvalsList(
+      std::vector<std::vector<F>>&& evals_list) {
+    return tachyon::base::Map(evals_list, [](std::vector<F>& evals) {
+      return Evals(std::move(evals));
+    });
+  }
+
   void ReadProvingKey(const tachyon::base::ReadOnlyBuffer& buffer) {
     ReadVerifyingKey(buffer, this->verifying_key_);
     if (read_only_vk_) return;
+    const uint8_t* state = static_cast<const uint8_t*>(buffer.buffer());
+    vk_state_.assign(state, state + buffer.buffer_offset());
     ReadBuffer(buffer, this->l_first_);
     ReadBuffer(buffer, this->l_last_);
     ReadBuffer(buffer, this->l_active_row_);
@@ -110,6 +456,9 @@ class ProvingKeyImplBase : public tachyon::zk::plonk::ProvingKey<LS> {
 
  private:
   bool read_only_vk_ = false;
+  // The halo2 serialization of the verifying key, which is kept to write the
+  // native format.
+  std::vector<uint8_t> vk_state_;
 };
 
 }  // namespace tachyon::c::zk::plonk
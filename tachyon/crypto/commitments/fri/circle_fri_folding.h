@@ -0,0 +1,107 @@
+// Copyright 2024 StarkWare Industries Ltd
+// Use of this source code is governed by a Apache-2.0 style license that
+// can be found in the LICENSE-APACHE.stwo
+
+#ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_CIRCLE_FRI_FOLDING_H_
+#define TACHYON_CRYPTO_COMMITMENTS_FRI_CIRCLE_FRI_FOLDING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/optional.h"
+#include "tachyon/math/circle/circle_coset.h"
+#include "tachyon/math/circle/circle_evaluation_domain.h"
+
+namespace tachyon::crypto {
+namespace internal {
+
+inline size_t CircleBitRev(size_t i, uint32_t bits) {
+  if (bits == 0) return 0;
+  return base::bits::BitRev(i) >> (sizeof(size_t) * 8 - bits);
+}
+
+// Overwrites the j-th evaluation with
+//
+//   (e₂ⱼ + e₂ⱼ₊₁) / 2 + β * (e₂ⱼ - e₂ⱼ₊₁) / (2 * tⱼ)
+//
+// and drops the upper half, where tⱼ is |twiddles[j]|.
+template <typename F>
+void FoldPairsInPlace(const F& beta, std::vector<F>&& twiddles,
+                      std::vector<F>& evals) {
+  size_t half_size = evals.size() >> 1;
+  CHECK_EQ(twiddles.size(), half_size);
+  F two_inv = unwrap(F(2).Inverse());
+  // β / (2 * tⱼ)
+  CHECK(F::BatchInverseInPlace(twiddles, beta * two_inv));
+  for (size_t j = 0; j < half_size; ++j) {
+    F lo = evals[2 * j];
+    const F& hi = evals[2 * j + 1];
+    F diff = lo - hi;
+    lo += hi;
+    lo *= two_inv;
+    evals[j] = lo + twiddles[j] * diff;
+  }
+  evals.resize(half_size);
+}
+
+}  // namespace internal
+
+// Folds the evaluations of f over |domain| in bit-reversed order, where
+// f(p) = f₀(pₓ) + p_y * f₁(pₓ), into the evaluations of
+//
+//   f'(pₓ) = f₀(pₓ) + β * f₁(pₓ)
+//          = (f(p) + f(p̄)) / 2 + β * (f(p) - f(p̄)) / (2 * p_y)
+//
+// over the x-coordinates of |domain.half_coset()| in bit-reversed order, where
+// p̄ is the conjugate of p. Like |FRI::FoldInPlace()|, the evaluations are
+// folded in place and the upper half is dropped.
+template <typename Circle, typename F>
+void FoldCircleIntoLine(const math::CircleEvaluationDomain<Circle>& domain,
+                        const F& beta, std::vector<F>& evals) {
+  using Point = typename Circle::Point;
+
+  CHECK_EQ(evals.size(), domain.size());
+  const math::CircleCoset<Circle>& half_coset = domain.half_coset();
+  std::vector<Point> points = half_coset.GetPoints(half_coset.size());
+  // The (2j)-th and the (2j + 1)-th evaluations are at p and p̄, where p is
+  // the rev(j)-th point of the half coset.
+  std::vector<F> twiddles(points.size());
+  for (size_t j = 0; j < points.size(); ++j) {
+    twiddles[j] = points[internal::CircleBitRev(j, half_coset.log_size())].y();
+  }
+  internal::FoldPairsInPlace(beta, std::move(twiddles), evals);
+}
+
+// Folds the evaluations of g over the x-coordinates of |coset| in bit-reversed
+// order, where g(x) = g₀(π(x)) + x * g₁(π(x)) and π(x) = 2x² - 1, into the
+// evaluations of
+//
+//   g'(π(x)) = g₀(π(x)) + β * g₁(π(x))
+//            = (g(x) + g(-x)) / 2 + β * (g(x) - g(-x)) / (2x)
+//
+// over the x-coordinates of |coset.Double()| in bit-reversed order.
+template <typename Circle, typename F>
+void FoldLine(const math::CircleCoset<Circle>& coset, const F& beta,
+              std::vector<F>& evals) {
+  using Point = typename Circle::Point;
+
+  CHECK_EQ(evals.size(), coset.size());
+  CHECK_GT(coset.log_size(), 0);
+  std::vector<Point> points = coset.GetPoints(coset.size() / 2);
+  // The (2j)-th and the (2j + 1)-th evaluations are at x and -x, where x is
+  // the x-coordinate of the rev(j)-th point of the coset.
+  std::vector<F> twiddles(points.size());
+  for (size_t j = 0; j < points.size(); ++j) {
+    twiddles[j] = points[internal::CircleBitRev(j, coset.log_size() - 1)].x();
+  }
+  internal::FoldPairsInPlace(beta, std::move(twiddles), evals);
+}
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_FRI_CIRCLE_FRI_FOLDING_H_
@@ -0,0 +1,88 @@
+#include "tachyon/crypto/commitments/fri/circle_fri_folding.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/circle/stark/g1.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using Circle = math::stark::G1Circle;
+using Domain = math::CircleEvaluationDomain<Circle>;
+using F = math::Mersenne31;
+
+class CircleFRIFoldingTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Circle::Init(); }
+};
+
+// Returns the coefficients of f₀ + β * f₁ over the basis, which are
+// |coeffs[2i]| + β * |coeffs[2i + 1]|.
+std::vector<F> FoldCoeffs(const std::vector<F>& coeffs, const F& beta) {
+  return base::CreateVector(coeffs.size() / 2, [&coeffs, &beta](size_t i) {
+    return coeffs[2 * i] + beta * coeffs[2 * i + 1];
+  });
+}
+
+}  // namespace
+
+TEST_F(CircleFRIFoldingTest, FoldCircleIntoLine) {
+  constexpr uint32_t kLogSize = 6;
+
+  std::unique_ptr<Domain> domain = Domain::Create(kLogSize);
+  std::vector<F> coeffs =
+      base::CreateVector(domain->size(), []() { return F::Random(); });
+  std::vector<F> evals = domain->CFFT(coeffs);
+  F beta = F::Random();
+  FoldCircleIntoLine(*domain, beta, evals);
+
+  // f' over the x-coordinates is the polynomial over the basis whose odd
+  // coefficients, which are multiplied by y, are zero.
+  std::vector<F> folded_coeffs = FoldCoeffs(coeffs, beta);
+  std::vector<F> expected_coeffs(coeffs.size(), F::Zero());
+  for (size_t i = 0; i < folded_coeffs.size(); ++i) {
+    expected_coeffs[2 * i] = folded_coeffs[i];
+  }
+  ASSERT_EQ(evals.size(), domain->size() / 2);
+  for (size_t i = 0; i < evals.size(); ++i) {
+    EXPECT_EQ(evals[i],
+              Domain::Evaluate(expected_coeffs,
+                               domain->GetBitReversedElement(2 * i)));
+  }
+}
+
+TEST_F(CircleFRIFoldingTest, FoldToConstant) {
+  constexpr uint32_t kLogSize = 8;
+
+  // The evaluations of a polynomial of 2ⁿ⁻¹ coefficients over the domain of
+  // size 2ⁿ are folded into a constant.
+  std::unique_ptr<Domain> domain = Domain::Create(kLogSize);
+  std::vector<F> coeffs =
+      base::CreateVector(domain->size() / 2, []() { return F::Random(); });
+  std::vector<F> evals = domain->CFFT(coeffs);
+
+  F beta = F::Random();
+  FoldCircleIntoLine(*domain, beta, evals);
+  coeffs = FoldCoeffs(coeffs, beta);
+  math::CircleCoset<Circle> coset = domain->half_coset();
+  while (coset.log_size() > 0) {
+    beta = F::Random();
+    FoldLine(coset, beta, evals);
+    coeffs = FoldCoeffs(coeffs, beta);
+    coset = coset.Double();
+    if (coeffs.size() == 1) {
+      for (const F& eval : evals) {
+        EXPECT_EQ(eval, coeffs[0]);
+      }
+      break;
+    }
+  }
+  EXPECT_EQ(coeffs.size(), size_t{1});
+}
+
+}  // namespace tachyon::crypto
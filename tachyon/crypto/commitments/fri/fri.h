@@ -7,13 +7,20 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <memory>
+#include <algorithm>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+#include "gtest/gtest_prod.h"
+
+#include "tachyon/base/bits.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/optional.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/base/time/trace_event.h"
 #include "tachyon/crypto/commitments/fri/fri_proof.h"
 #include "tachyon/crypto/commitments/fri/fri_storage.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
@@ -22,6 +29,14 @@
 
 namespace tachyon::crypto {
 
+// Each layer of |FRI| is folded by the arity, which is one of 2, 4, 8 and 16,
+// and the evaluations of a layer are committed in bit-reversed order so that
+// each coset folded into a single point of the next layer is a subtree of the
+// Merkle tree, whose root serves as the leaf of the coset. A layer is
+// committed by the cap of its tree, see |FRIStorage::cap_height()|. An
+// opening proof opens many queries at once, sharing the cosets and the Merkle
+// nodes that they have in common. If |pow_bits| is not zero, the prover grinds
+// a nonce after committing, which the verifier checks before the queries.
 template <typename F, size_t MaxDegree>
 class FRI final
     : public UnivariatePolynomialCommitmentScheme<FRI<F, MaxDegree>> {
@@ -31,88 +46,116 @@ class FRI final
   using Evals = typename Base::Evals;
   using Domain = typename Base::Domain;
 
+  using Tree = BinaryMerkleTree<F, F, MaxDegree + 1>;
+
+  constexpr static size_t kMaxArity = 16;
+  constexpr static uint32_t kMaxPowBits = 32;
+  // The number of nonces tried in parallel while grinding.
+  constexpr static size_t kGrindingBatchSize = 1 << 12;
+
   FRI() = default;
   FRI(const Domain* domain, FRIStorage<F>* storage,
-      BinaryMerkleHasher<F, F>* hasher)
-      : domain_(domain), storage_(storage), hasher_(hasher) {
+      BinaryMerkleHasher<F, F>* hasher, size_t arity = 2,
+      uint32_t pow_bits = 0)
+      : domain_(domain),
+        storage_(storage),
+        hasher_(hasher),
+        pow_bits_(pow_bits) {
     // This ensures last folding process.
     CHECK_GE(domain->size(), size_t{2}) << "Domain size must be at least 2";
-    uint32_t k = domain->log_size_of_group();
-    if (k > 1) {
-      sub_domains_ = base::CreateVector(k - 1, [k](size_t i) {
-        return Domain::Create(size_t{1} << (k - i - 1));
-      });
-    }
-    storage_->Allocate(k);
+    CHECK(base::bits::IsPowerOfTwo(arity) && arity >= 2 && arity <= kMaxArity)
+        << "Arity must be one of 2, 4, 8 and 16";
+    CHECK_LE(pow_bits, kMaxPowBits);
+    log_arity_ = base::bits::Log2Floor(arity);
+    storage_->Allocate(GetNumLayers());
   }
 
+  size_t arity() const { return size_t{1} << log_arity_; }
+  uint32_t pow_bits() const { return pow_bits_; }
+
   // UnivariatePolynomialCommitmentScheme methods
   const char* Name() const { return "FRI"; }
 
   size_t N() const { return domain_->size(); }
 
   [[nodiscard]] bool Commit(const Poly& poly, Transcript<F>* transcript) const {
-    uint32_t num_layers = domain_->log_size_of_group();
+    TRACE_EVENT("fri", "FRI::Commit");
     TranscriptWriter<F>* writer = transcript->ToWriter();
-    BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(0), hasher_);
     Evals evals = domain_->FFT(poly);
-    F root;
-    if (!tree.Commit(evals.evaluations(), &root)) return false;
-    if (!writer->WriteToProof(root)) return false;
-    const Poly* cur_poly = &poly;
+    std::vector<F>& values = evals.evaluations();
 
+    // NOTE: Each layer is folded from the evaluations of the previous one in
+    // place, so no layer goes back to the coefficients nor allocates.
+    std::vector<F> cap;
     F beta;
-    Poly folded_poly;
-    if (num_layers > 1) {
-      for (uint32_t i = 1; i < num_layers; ++i) {
-        // Pᵢ(X)   = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
-        // Pᵢ₊₁(X) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
-        beta = writer->SqueezeChallenge();
-        VLOG(2) << "FRI(beta[" << i - 1 << "]): " << beta.ToHexString(true);
-        folded_poly = cur_poly->template Fold<false>(beta);
-        BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(i),
-                                                   hasher_);
-        evals = sub_domains_[i - 1]->FFT(folded_poly);
-        if (!tree.Commit(evals.evaluations(), &root)) return false;
-        if (!writer->WriteToProof(root)) return false;
-        cur_poly = &folded_poly;
+    F omega_inv = domain_->group_gen_inv();
+    for (uint32_t i = 0; i < GetNumLayers(); ++i) {
+      uint32_t log_size = GetLayerLogSize(i);
+      Tree tree(storage_->GetLayer(i), hasher_);
+      tree.set_cap_height(GetLayerCapHeight(i));
+      if (!tree.CommitToCap(BitReversedView{&values, log_size}, &cap)) {
+        return false;
+      }
+      for (const F& node : cap) {
+        if (!writer->WriteToProof(node)) return false;
+      }
+
+      // Pᵢ(X)   = Σⱼ Xʲ * Pᵢ,ⱼ(Xᵃ), where a is the arity.
+      // Pᵢ₊₁(X) = Σⱼ βʲ * Pᵢ,ⱼ(X)
+      // Folding by 2ᵗ is the same as folding by 2 t times with β, β², ...,
+      // β^(2ᵗ⁻¹).
+      beta = writer->SqueezeChallenge();
+      VLOG(2) << "FRI(beta[" << i << "]): " << beta.ToHexString(true);
+      for (uint32_t j = 0; j < GetLayerLogArity(i); ++j) {
+        FoldInPlace(beta, omega_inv, values);
+        beta.SquareInPlace();
+        omega_inv.SquareInPlace();
       }
     }
+    if (!writer->WriteToProof(values.empty() ? F::Zero() : values[0])) {
+      return false;
+    }
 
-    beta = writer->SqueezeChallenge();
-    VLOG(2) << "FRI(beta[" << num_layers - 1
-            << "]): " << beta.ToHexString(true);
-    folded_poly = cur_poly->template Fold<false>(beta);
-    return writer->WriteToProof(folded_poly[0]);
+    if (pow_bits_ == 0) return true;
+    F challenge = writer->SqueezeChallenge();
+    return writer->WriteToProof(Grind(challenge));
   }
 
   [[nodiscard]] bool DoCreateOpeningProof(size_t index,
                                           FRIProof<F>* fri_proof) {
-    size_t domain_size = domain_->size();
-    uint32_t num_layers = domain_->log_size_of_group();
+    return DoCreateOpeningProof(std::vector<size_t>{index}, fri_proof);
+  }
+
+  [[nodiscard]] bool DoCreateOpeningProof(const std::vector<size_t>& indices,
+                                          FRIProof<F>* fri_proof) {
+    TRACE_EVENT("fri", "FRI::CreateOpeningProof");
+    uint32_t num_layers = GetNumLayers();
+    fri_proof->cosets.resize(num_layers);
+    fri_proof->siblings.resize(num_layers);
     for (uint32_t i = 0; i < num_layers; ++i) {
-      size_t leaf_index = index % domain_size;
+      uint32_t log_size = GetLayerLogSize(i);
+      uint32_t log_arity = GetLayerLogArity(i);
+      size_t size = size_t{1} << log_size;
       BinaryMerkleTreeStorage<F>* layer = storage_->GetLayer(i);
-      BinaryMerkleTree<F, F, MaxDegree + 1> tree(layer, hasher_);
-      BinaryMerkleProof<F> proof;
-      if (!tree.CreateOpeningProof(leaf_index, &proof)) return false;
-      // Merkle proof for Pᵢ(ωʲ) against Cᵢ
-      fri_proof->paths.push_back(std::move(proof));
-      // Pᵢ(ωʲ)
-      fri_proof->evaluations.push_back(
-          layer->GetHash(domain_size - 1 + leaf_index));
-
-      size_t half_domain_size = domain_size >> 1;
-      size_t leaf_index_sym = (index + half_domain_size) % domain_size;
-      BinaryMerkleProof<F> proof_sym;
-      if (!tree.CreateOpeningProof(leaf_index_sym, &proof_sym)) return false;
-      // Merkle proof for Pᵢ(-ωʲ) against Cᵢ
-      fri_proof->paths_sym.push_back(std::move(proof_sym));
-      // Pᵢ(-ωʲ)
-      fri_proof->evaluations_sym.push_back(
-          layer->GetHash(domain_size - 1 + leaf_index_sym));
-
-      domain_size = half_domain_size;
+
+      // NOTE: The evaluations are read back from the leaves, which assumes
+      // that |ComputeLeafHash()| is the identity.
+      std::vector<size_t> cosets = GetCosets(indices, log_size, log_arity);
+      fri_proof->cosets[i] =
+          base::Map(cosets, [layer, size, log_arity](size_t coset) {
+            size_t first_leaf = size - 1 + (coset << log_arity);
+            return base::CreateVector(
+                size_t{1} << log_arity,
+                [layer, first_leaf](size_t j) {
+                  return layer->GetHash(first_leaf + j);
+                });
+          });
+
+      // Walk up from the roots of the cosets to the cap, taking the siblings
+      // that are not on any other path.
+      Tree::CollectSiblings(layer, std::move(cosets), size >> log_arity,
+                            size_t{1} << GetLayerCapHeight(i),
+                            &fri_proof->siblings[i]);
     }
     return true;
   }
@@ -120,88 +163,271 @@ class FRI final
   [[nodiscard]] bool DoVerifyOpeningProof(Transcript<F>& transcript,
                                           size_t index,
                                           const FRIProof<F>& proof) const {
+    return DoVerifyOpeningProof(transcript, std::vector<size_t>{index}, proof);
+  }
+
+  [[nodiscard]] bool DoVerifyOpeningProof(Transcript<F>& transcript,
+                                          const std::vector<size_t>& indices,
+                                          const FRIProof<F>& proof) const {
     TranscriptReader<F>* reader = transcript.ToReader();
-    size_t domain_size = domain_->size();
-    uint32_t num_layers = domain_->log_size_of_group();
-    F root;
-    F x;
-    F beta;
-    F evaluation;
-    F evaluation_sym;
-    F two_inv = unwrap(F(2).Inverse());
-    for (uint32_t i = 0; i < num_layers; ++i) {
-      BinaryMerkleTreeStorage<F>* layer = storage_->GetLayer(i);
-      BinaryMerkleTree<F, F, MaxDegree + 1> tree(layer, hasher_);
+    uint32_t num_layers = GetNumLayers();
+    if (proof.cosets.size() != num_layers ||
+        proof.siblings.size() != num_layers) {
+      LOG(ERROR) << "Proof doesn't have " << num_layers << " layers";
+      return false;
+    }
 
-      if (!reader->ReadFromProof(&root)) return false;
-      if (!tree.VerifyOpeningProof(root, proof.evaluations[i], proof.paths[i]))
+    std::vector<std::vector<F>> caps(num_layers);
+    std::vector<F> betas(num_layers);
+    for (uint32_t i = 0; i < num_layers; ++i) {
+      caps[i].resize(size_t{1} << GetLayerCapHeight(i));
+      for (F& node : caps[i]) {
+        if (!reader->ReadFromProof(&node)) return false;
+      }
+      betas[i] = reader->SqueezeChallenge();
+      VLOG(2) << "FRI(beta[" << i << "]): " << betas[i].ToHexString(true);
+    }
+    F last_evaluation;
+    if (!reader->ReadFromProof(&last_evaluation)) return false;
+    if (pow_bits_ > 0) {
+      F challenge = reader->SqueezeChallenge();
+      F nonce;
+      if (!reader->ReadFromProof(&nonce)) return false;
+      if (!CheckProofOfWork(challenge, nonce)) {
+        LOG(ERROR) << "Proof of work is invalid";
         return false;
+      }
+    }
 
-      if (!tree.VerifyOpeningProof(root, proof.evaluations_sym[i],
-                                   proof.paths_sym[i]))
+    // |evaluations[j]| is the evaluation of the current layer at the point of
+    // the j-th query, which is folded from the previous layer.
+    std::vector<F> evaluations(indices.size());
+    for (uint32_t i = 0; i < num_layers; ++i) {
+      uint32_t log_size = GetLayerLogSize(i);
+      uint32_t log_arity = GetLayerLogArity(i);
+      size_t arity = size_t{1} << log_arity;
+      std::vector<size_t> cosets = GetCosets(indices, log_size, log_arity);
+      const std::vector<std::vector<F>>& coset_evals = proof.cosets[i];
+      if (coset_evals.size() != cosets.size() ||
+          std::any_of(coset_evals.begin(), coset_evals.end(),
+                      [arity](const std::vector<F>& evals) {
+                        return evals.size() != arity;
+                      })) {
+        LOG(ERROR) << "Proof has wrong cosets at layer [" << i << "]";
+        return false;
+      }
+      if (!VerifyCap(cosets, coset_evals, size_t{1} << (log_size - log_arity),
+                     proof.siblings[i], caps[i])) {
+        LOG(ERROR) << "Merkle proof doesn't match with cap at layer [" << i
+                   << "]";
         return false;
+      }
 
-      // Given equations:
-      // Pᵢ(X)  = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
-      // Pᵢ(-X) = Pᵢ_even(X²) - X * Pᵢ_odd(X²)
-      //
-      // Using Gaussian elimination, we derive:
-      // Pᵢ_even(X²) = (Pᵢ(X) + Pᵢ(-X)) / 2
-      // Pᵢ_odd(X²)  = (Pᵢ(X) - Pᵢ(-X)) / (2 * X)
-      //
-      // Next layer equation:
-      // Pᵢ₊₁(X) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
-      //
-      // If the domain of Pᵢ(X) is Dᵢ = {ω⁰, ω¹, ..., ωⁿ⁻¹},
-      // then the domain of Pᵢ₊₁(X) is Dᵢ₊₁ = {ω⁰, ω¹, ..., ωᵏ⁻¹},
-      // where k = n / 2.
-      //
-      // As per the definition:
-      // Pᵢ₊₁(ωʲ) = Pᵢ_even((ωʲ)²) + β * Pᵢ_odd((ωʲ)²)
-      //
-      // Substituting Pᵢ_even and Pᵢ_odd:
-      // Pᵢ₊₁(ωʲ) = (Pᵢ(ωʲ) + Pᵢ(-ωʲ)) / 2 + β * (Pᵢ(ωʲ) - Pᵢ(-ωʲ)) / (2 * ωʲ)
-      //           = ((1 + β * ω⁻ʲ) * Pᵢ(ωʲ) + (1 - β * ω⁻ʲ) * Pᵢ(-ωʲ)) / 2
-      size_t leaf_index = index % domain_size;
-      if (i == 0) {
-        evaluation = proof.evaluations[i];
-        evaluation_sym = proof.evaluations_sym[i];
-        x = domain_->GetElement(leaf_index);
-      } else {
-        evaluation *= (F::One() + beta);
-        evaluation_sym *= (F::One() - beta);
-        evaluation += evaluation_sym;
-        evaluation *= two_inv;
-
-        if (evaluation != proof.evaluations[i]) {
+      for (size_t j = 0; j < indices.size(); ++j) {
+        size_t natural_index = indices[j] % (size_t{1} << log_size);
+        auto [coset, position] =
+            GetCosetPosition(natural_index, log_size, log_arity);
+        const std::vector<F>& evals =
+            coset_evals[std::lower_bound(cosets.begin(), cosets.end(), coset) -
+                        cosets.begin()];
+        if (i > 0 && evals[position] != evaluations[j]) {
           LOG(ERROR)
               << "Proof doesn't match with expected evaluation at layer [" << i
               << "]";
           return false;
         }
-        evaluation_sym = proof.evaluations_sym[i];
-        x = sub_domains_[i - 1]->GetElement(leaf_index);
+        evaluations[j] = FoldCoset(evals, betas[i], natural_index, log_size,
+                                   log_arity);
       }
-      beta = reader->SqueezeChallenge();
-      VLOG(2) << "FRI(beta[" << i << "]): " << beta.ToHexString(true);
-      beta *= unwrap(x.Inverse());
-      domain_size = domain_size >> 1;
     }
 
-    evaluation *= (F::One() + beta);
-    evaluation_sym *= (F::One() - beta);
-    evaluation += evaluation_sym;
-    evaluation *= two_inv;
-
-    if (!reader->ReadFromProof(&root)) return false;
-    if (root != evaluation) {
-      LOG(ERROR) << "Root doesn't match with expected evaluation";
-      return false;
+    for (const F& evaluation : evaluations) {
+      if (evaluation != last_evaluation) {
+        LOG(ERROR) << "Last evaluation doesn't match with expected evaluation";
+        return false;
+      }
     }
     return true;
   }
 
  private:
+  FRIEND_TEST(FRITest, FoldInPlace);
+
+  // Views the evaluations of a layer of size 2ᴸ in bit-reversed order. The
+  // coset {x * ζᵏ} of the subgroup generated by ζ of order 2ᵗ, which is
+  // folded into xᵃ, is then at 2ᵗ consecutive leaves.
+  struct BitReversedView {
+    const std::vector<F>* values;
+    uint32_t log_size;
+
+    size_t size() const { return values->size(); }
+    const F& operator[](size_t i) const {
+      return (*values)[BitRev(i, log_size)];
+    }
+  };
+
+  static size_t BitRev(size_t i, uint32_t bits) {
+    if (bits == 0) return 0;
+    return base::bits::BitRev(i) >> (sizeof(size_t) * 8 - bits);
+  }
+
+  uint32_t GetNumLayers() const {
+    uint32_t k = domain_->log_size_of_group();
+    return (k + log_arity_ - 1) / log_arity_;
+  }
+
+  uint32_t GetLayerLogSize(uint32_t layer) const {
+    return domain_->log_size_of_group() - layer * log_arity_;
+  }
+
+  // The cap can't go below the roots of the cosets.
+  uint32_t GetLayerCapHeight(uint32_t layer) const {
+    return std::min(storage_->cap_height(),
+                    GetLayerLogSize(layer) - GetLayerLogArity(layer));
+  }
+
+  // The last layer may be smaller than the arity, in which case it is folded
+  // as a whole.
+  uint32_t GetLayerLogArity(uint32_t layer) const {
+    return std::min(log_arity_, GetLayerLogSize(layer));
+  }
+
+  // Returns the coset of the layer of size 2ᴸ folded by 2ᵗ into which the
+  // |natural_index|-th evaluation falls and the position of the evaluation in
+  // the coset, both in the committed order.
+  static std::pair<size_t, size_t> GetCosetPosition(size_t natural_index,
+                                                    uint32_t log_size,
+                                                    uint32_t log_arity) {
+    uint32_t log_num_cosets = log_size - log_arity;
+    size_t mask = (size_t{1} << log_num_cosets) - 1;
+    return {BitRev(natural_index & mask, log_num_cosets),
+            BitRev(natural_index >> log_num_cosets, log_arity)};
+  }
+
+  // Returns the sorted distinct cosets that the queries open at a layer.
+  static std::vector<size_t> GetCosets(const std::vector<size_t>& indices,
+                                       uint32_t log_size, uint32_t log_arity) {
+    std::vector<size_t> cosets = base::Map(
+        indices, [log_size, log_arity](size_t index) {
+          return GetCosetPosition(index % (size_t{1} << log_size), log_size,
+                                  log_arity)
+              .first;
+        });
+    std::sort(cosets.begin(), cosets.end());
+    cosets.erase(std::unique(cosets.begin(), cosets.end()), cosets.end());
+    return cosets;
+  }
+
+  // Returns true if the roots of the |cosets| and the |siblings| in the order
+  // that |DoCreateOpeningProof()| collects them lead to the |cap|.
+  bool VerifyCap(const std::vector<size_t>& cosets,
+                 const std::vector<std::vector<F>>& coset_evals,
+                 size_t num_cosets, absl::Span<const F> siblings,
+                 absl::Span<const F> cap) const {
+    // The root of a coset is computed from its evaluations as the leaves.
+    std::vector<std::pair<size_t, F>> nodes(cosets.size());
+    for (size_t i = 0; i < cosets.size(); ++i) {
+      std::vector<F> hashes = coset_evals[i];
+      while (hashes.size() > 1) {
+        for (size_t j = 0; j < hashes.size() / 2; ++j) {
+          hashes[j] =
+              hasher_->ComputeParentHash(hashes[2 * j], hashes[2 * j + 1]);
+        }
+        hashes.resize(hashes.size() / 2);
+      }
+      nodes[i] = {cosets[i], std::move(hashes[0])};
+    }
+
+    return Tree::VerifyCap(hasher_, std::move(nodes), num_cosets, siblings,
+                           cap);
+  }
+
+  // Folds the evaluations of a coset of the layer of size 2ᴸ, which is in
+  // the committed order, into the evaluation of the next layer at the point
+  // of the |natural_index|-th evaluation. See |FoldInPlace()|.
+  F FoldCoset(const std::vector<F>& coset_evals, F beta, size_t natural_index,
+              uint32_t log_size, uint32_t log_arity) const {
+    uint32_t k = domain_->log_size_of_group();
+    uint32_t log_num_cosets = log_size - log_arity;
+    // The coset is {x * ζʲ}, where x is the |natural_index|-th element of the
+    // layer and ζ generates the subgroup of order 2ᵗ. The j-th evaluation of
+    // the coset is at x * ζ^rev(j), so the pairs ±y are adjacent.
+    size_t mask = (size_t{1} << log_num_cosets) - 1;
+    F x = domain_->GetElement((natural_index & mask) << (k - log_size));
+    F zeta = domain_->GetElement(size_t{1} << (k - log_arity));
+    F two_inv = unwrap(F(2).Inverse());
+    std::vector<F> evals = coset_evals;
+    for (uint32_t t = log_arity; t > 0; --t) {
+      size_t half_size = evals.size() >> 1;
+      for (size_t j = 0; j < half_size; ++j) {
+        F y = x * zeta.Pow(BitRev(j, t - 1));
+        F diff = evals[2 * j] - evals[2 * j + 1];
+        evals[j] = evals[2 * j] + evals[2 * j + 1];
+        evals[j] *= two_inv;
+        evals[j] += beta * two_inv * unwrap(y.Inverse()) * diff;
+      }
+      evals.resize(half_size);
+      beta.SquareInPlace();
+      x.SquareInPlace();
+      zeta.SquareInPlace();
+    }
+    return evals[0];
+  }
+
+  // Folds the evaluations of Pᵢ(X) over {ω⁰, ω¹, ..., ωⁿ⁻¹} into the
+  // evaluations of Pᵢ₊₁(X) over {ω⁰, ω², ..., ωⁿ⁻²}, where |omega_inv| is ω⁻¹.
+  // Since -ωʲ = ωʲ⁺ⁿᐟ²,
+  //
+  // Pᵢ₊₁(ω²ʲ) = (Pᵢ(ωʲ) + Pᵢ(-ωʲ)) / 2 + β * ω⁻ʲ * (Pᵢ(ωʲ) - Pᵢ(-ωʲ)) / 2
+  //
+  // reads only the j-th and the (j + n / 2)-th evaluations, so it overwrites
+  // the j-th one and the upper half is dropped.
+  static void FoldInPlace(const F& beta, const F& omega_inv,
+                          std::vector<F>& evals) {
+    if (evals.empty()) return;
+    size_t half_size = evals.size() >> 1;
+    F two_inv = unwrap(F(2).Inverse());
+    F beta_half = beta * two_inv;
+    absl::Span<F> lower = absl::MakeSpan(evals).subspan(0, half_size);
+    absl::Span<const F> upper =
+        absl::MakeConstSpan(evals).subspan(half_size, half_size);
+    base::Parallelize(lower, [&beta_half, &omega_inv, &two_inv, &upper](
+                                 absl::Span<F> chunk, size_t chunk_offset,
+                                 size_t chunk_size) {
+      size_t start = chunk_offset * chunk_size;
+      // β * ω⁻ʲ / 2
+      F coeff = beta_half * omega_inv.Pow(start);
+      for (size_t i = 0; i < chunk.size(); ++i) {
+        const F& eval_sym = upper[start + i];
+        F diff = chunk[i] - eval_sym;
+        chunk[i] += eval_sym;
+        chunk[i] *= two_inv;
+        chunk[i] += coeff * diff;
+        coeff *= omega_inv;
+      }
+    });
+    evals.resize(half_size);
+  }
+
+  bool CheckProofOfWork(const F& challenge, const F& nonce) const {
+    uint64_t mask = (uint64_t{1} << pow_bits_) - 1;
+    return (hasher_->ComputeParentHash(challenge, nonce).ToBigInt()[0] &
+            mask) == 0;
+  }
+
+  // Returns the smallest nonce whose hash with |challenge| has |pow_bits_|
+  // trailing zero bits.
+  F Grind(const F& challenge) const {
+    for (uint64_t start = 0;; start += kGrindingBatchSize) {
+      std::vector<uint8_t> found(kGrindingBatchSize);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < kGrindingBatchSize; ++i) {
+        found[i] = CheckProofOfWork(challenge, F(start + i));
+      }
+      auto it = std::find(found.begin(), found.end(), 1);
+      if (it != found.end()) return F(start + (it - found.begin()));
+    }
+  }
+
   // not owned
   const Domain* domain_ = nullptr;
   // not owned
@@ -210,7 +436,8 @@ class FRI final
   BinaryMerkleHasher<F, F>* hasher_ = nullptr;
   // not owned
   Transcript<F>* transcript_ = nullptr;
-  std::vector<std::unique_ptr<Domain>> sub_domains_;
+  uint32_t log_arity_ = 1;
+  uint32_t pow_bits_ = 0;
 };
 
 template <typename F, size_t MaxDegree>
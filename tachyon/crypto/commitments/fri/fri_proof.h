@@ -6,16 +6,17 @@
 
 #include <vector>
 
-#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_proof.h"
-
 namespace tachyon::crypto {
 
 template <typename F>
 struct FRIProof {
-  std::vector<BinaryMerkleProof<F>> paths;
-  std::vector<BinaryMerkleProof<F>> paths_sym;
-  std::vector<F> evaluations;
-  std::vector<F> evaluations_sym;
+  // |cosets[i][j]| holds the evaluations of the j-th coset opened at the i-th
+  // layer in the committed order. A coset opened by many queries is held once.
+  std::vector<std::vector<std::vector<F>>> cosets;
+  // |siblings[i]| holds the Merkle nodes of the i-th layer that can't be
+  // computed from |cosets[i]|, from the bottom to the top. The nodes shared
+  // by the paths of the cosets are held once.
+  std::vector<std::vector<F>> siblings;
 };
 
 }  // namespace tachyon::crypto
@@ -4,6 +4,9 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_STORAGE_H_
 #define TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_STORAGE_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
 
 namespace tachyon::crypto {
@@ -13,8 +16,18 @@ class FRIStorage {
  public:
   virtual ~FRIStorage() = default;
 
+  // Each layer is committed by the cap of its tree, which is the
+  // 2^|cap_height()| nodes at the depth of |cap_height()|, instead of the
+  // root, which shortens every path of the opening proof by |cap_height()|.
+  // The cap height of a layer is bounded by the depth of its cosets.
+  uint32_t cap_height() const { return cap_height_; }
+  void set_cap_height(uint32_t cap_height) { cap_height_ = cap_height; }
+
   virtual void Allocate(size_t size) = 0;
   virtual BinaryMerkleTreeStorage<Hash>* GetLayer(size_t index) = 0;
+
+ protected:
+  uint32_t cap_height_ = 0;
 };
 
 }  // namespace tachyon::crypto
@@ -3,6 +3,9 @@
 
 #include "tachyon/crypto/commitments/fri/fri.h"
 
+#include <memory>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
@@ -51,7 +54,7 @@ class SimpleFRIStorage : public FRIStorage<math::Goldilocks> {
 
 class FRITest : public math::FiniteFieldTest<math::Goldilocks> {
  public:
-  constexpr static size_t K = 3;
+  constexpr static size_t K = 5;
   constexpr static size_t N = size_t{1} << K;
   constexpr static size_t kMaxDegree = N - 1;
 
@@ -76,18 +79,132 @@ class FRITest : public math::FiniteFieldTest<math::Goldilocks> {
 }  // namespace
 
 TEST_F(FRITest, CommitAndVerify) {
+  for (size_t arity : {size_t{2}, size_t{4}, size_t{8}, size_t{16}}) {
+    SCOPED_TRACE(arity);
+    PCS pcs(domain_.get(), &storage_, &hasher_, arity);
+    Poly poly = Poly::Random(kMaxDegree);
+    base::Uint8VectorBuffer write_buffer;
+    SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+    ASSERT_TRUE(pcs.Commit(poly, &writer));
+
+    size_t index = base::Uniform(base::Range<size_t>::Until(kMaxDegree + 1));
+    FRIProof<math::Goldilocks> proof;
+    ASSERT_TRUE(pcs.CreateOpeningProof(index, &proof));
+
+    SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+    reader.buffer().set_buffer_offset(0);
+    ASSERT_TRUE(pcs.VerifyOpeningProof(reader, index, proof));
+  }
+}
+
+TEST_F(FRITest, BatchedQueries) {
+  // The queries 3 and 19 share their cosets at every layer, and 3 is repeated.
+  std::vector<size_t> indices = {3, 19, 0, 3, 30};
+  for (size_t arity : {size_t{2}, size_t{4}, size_t{8}, size_t{16}}) {
+    SCOPED_TRACE(arity);
+    PCS pcs(domain_.get(), &storage_, &hasher_, arity);
+    Poly poly = Poly::Random(kMaxDegree);
+    base::Uint8VectorBuffer write_buffer;
+    SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+    ASSERT_TRUE(pcs.Commit(poly, &writer));
+
+    FRIProof<math::Goldilocks> proof;
+    ASSERT_TRUE(pcs.CreateOpeningProof(indices, &proof));
+    // 3 and 19 fall into the same coset, so no more than 3 cosets are opened.
+    EXPECT_LE(proof.cosets[0].size(), size_t{3});
+
+    SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+    reader.buffer().set_buffer_offset(0);
+    ASSERT_TRUE(pcs.VerifyOpeningProof(reader, indices, proof));
+  }
+}
+
+TEST_F(FRITest, CapHeight) {
+  std::vector<size_t> indices = {3, 19, 0, 30};
+  for (uint32_t cap_height : {uint32_t{1}, uint32_t{3}, uint32_t{5}}) {
+    SCOPED_TRACE(cap_height);
+    storage_.set_cap_height(cap_height);
+    PCS pcs(domain_.get(), &storage_, &hasher_, 2);
+    Poly poly = Poly::Random(kMaxDegree);
+    base::Uint8VectorBuffer write_buffer;
+    SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+    ASSERT_TRUE(pcs.Commit(poly, &writer));
+
+    FRIProof<math::Goldilocks> proof;
+    ASSERT_TRUE(pcs.CreateOpeningProof(indices, &proof));
+    // The cosets of the first layer are at the depth of 4, so if the cap is
+    // there or would be deeper, every node above the cosets is in the cap.
+    if (cap_height >= 4) {
+      EXPECT_TRUE(proof.siblings[0].empty());
+    }
+
+    SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+    reader.buffer().set_buffer_offset(0);
+    ASSERT_TRUE(pcs.VerifyOpeningProof(reader, indices, proof));
+  }
+}
+
+TEST_F(FRITest, Grinding) {
+  PCS pcs(domain_.get(), &storage_, &hasher_, 4, 8);
+  Poly poly = Poly::Random(kMaxDegree);
+  base::Uint8VectorBuffer write_buffer;
+  SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+  ASSERT_TRUE(pcs.Commit(poly, &writer));
+
+  std::vector<size_t> indices = {1, 7, 12};
+  FRIProof<math::Goldilocks> proof;
+  ASSERT_TRUE(pcs.CreateOpeningProof(indices, &proof));
+
+  SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+  reader.buffer().set_buffer_offset(0);
+  ASSERT_TRUE(pcs.VerifyOpeningProof(reader, indices, proof));
+
+  // The nonce is the last element written to the proof. Since the hash of
+  // |SimpleHasher| is linear in the nonce, the next nonce always fails.
+  std::vector<F> elements;
+  reader.buffer().set_buffer_offset(0);
+  while (!reader.buffer().Done()) {
+    F element;
+    ASSERT_TRUE(reader.buffer().Read(&element));
+    elements.push_back(element);
+  }
+  elements.back() += F::One();
+  base::Uint8VectorBuffer tampered_buffer;
+  SimpleTranscriptWriter<F> tampered_writer(std::move(tampered_buffer));
+  for (const F& element : elements) {
+    ASSERT_TRUE(tampered_writer.WriteToProof(element));
+  }
+  SimpleTranscriptReader<F> tampered_reader(
+      std::move(tampered_writer).TakeBuffer());
+  tampered_reader.buffer().set_buffer_offset(0);
+  EXPECT_FALSE(pcs.VerifyOpeningProof(tampered_reader, indices, proof));
+}
+
+TEST_F(FRITest, TamperedCoset) {
+  PCS pcs(domain_.get(), &storage_, &hasher_, 4);
   Poly poly = Poly::Random(kMaxDegree);
   base::Uint8VectorBuffer write_buffer;
   SimpleTranscriptWriter<F> writer(std::move(write_buffer));
-  ASSERT_TRUE(pcs_.Commit(poly, &writer));
+  ASSERT_TRUE(pcs.Commit(poly, &writer));
 
-  size_t index = base::Uniform(base::Range<size_t>::Until(kMaxDegree + 1));
+  std::vector<size_t> indices = {5, 21};
   FRIProof<math::Goldilocks> proof;
-  ASSERT_TRUE(pcs_.CreateOpeningProof(index, &proof));
+  ASSERT_TRUE(pcs.CreateOpeningProof(indices, &proof));
+  proof.cosets[0][0][1] += F::One();
 
   SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
   reader.buffer().set_buffer_offset(0);
-  ASSERT_TRUE(pcs_.VerifyOpeningProof(reader, index, proof));
+  EXPECT_FALSE(pcs.VerifyOpeningProof(reader, indices, proof));
+}
+
+TEST_F(FRITest, FoldInPlace) {
+  Poly poly = Poly::Random(kMaxDegree);
+  F beta = F::Random();
+  std::vector<F> evals = domain_->FFT(poly).evaluations();
+  PCS::FoldInPlace(beta, domain_->group_gen_inv(), evals);
+
+  std::unique_ptr<Domain> sub_domain = Domain::Create(N / 2);
+  EXPECT_EQ(evals, sub_domain->FFT(poly.Fold<false>(beta)).evaluations());
 }
 
 }  // namespace tachyon::crypto
@@ -0,0 +1,707 @@
+// Copyright 2020-2022 The Electric Coin Company
+// Copyright 2022 The Halo2 developers
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.halo2 and the LICENCE-APACHE.halo2
+// file.
+
+#ifndef TACHYON_CRYPTO_COMMITMENTS_IPA_IPA_H_
+#define TACHYON_CRYPTO_COMMITMENTS_IPA_IPA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/commitments/batch_commitment_state.h"
+#include "tachyon/crypto/commitments/polynomial_openings.h"
+#include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
+#include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
+
+namespace tachyon {
+namespace zk {
+
+template <typename Point, size_t MaxDegree, size_t MaxExtendedDegree,
+          typename _Commitment>
+class IPAExtension;
+
+}  // namespace zk
+
+namespace crypto {
+
+// |IPA| is the polynomial commitment scheme based on the inner product
+// argument, which needs no trusted setup, so that it works on the curves
+// without a pairing, e.g., Pasta. P(X) is committed to as <p, g>, where p are
+// the coefficients of P(X) and g are random generators.
+//
+// The openings at the same point x are combined into P(X) = Σᵢ vⁱPᵢ(X), whose
+// evaluation is proven by k = log₂(n) rounds, each of which folds
+// a = p, b = (1, x, x², ..., xⁿ⁻¹) and g in half. The verifier computes the
+// last of the generators by a single MSM over g and the checks of all the
+// points, or even of many proofs, are accumulated into it. See
+// |ComputeVerificationMSM()|.
+template <typename Point, size_t MaxDegree,
+          typename Commitment = typename math::Pippenger<Point>::Bucket>
+class IPA final : public UnivariatePolynomialCommitmentScheme<
+                      IPA<Point, MaxDegree, Commitment>> {
+ public:
+  using Base =
+      UnivariatePolynomialCommitmentScheme<IPA<Point, MaxDegree, Commitment>>;
+  using Field = typename Base::Field;
+  using Poly = typename Base::Poly;
+  using Evals = typename Base::Evals;
+  using Domain = typename Base::Domain;
+  using Bucket = typename math::Pippenger<Point>::Bucket;
+  using JacobianPoint = math::JacobianPoint<typename Point::Curve>;
+
+  // The terms of an MSM that sums up to zero iff the opening proofs
+  // accumulated into it are valid.
+  struct VerificationMSM {
+    // The scalars of |g()|.
+    std::vector<Field> g_scalars;
+    // The other terms, e.g., the commitments and the ones of |u()| and |w()|.
+    std::vector<Point> bases;
+    std::vector<Field> scalars;
+
+    void AddTerm(const Point& base, const Field& scalar) {
+      bases.push_back(base);
+      scalars.push_back(scalar);
+    }
+  };
+
+  IPA() = default;
+  IPA(std::vector<Point>&& g, std::vector<Point>&& g_lagrange, Point&& u,
+      Point&& w)
+      : g_(std::move(g)),
+        g_lagrange_(std::move(g_lagrange)),
+        u_(std::move(u)),
+        w_(std::move(w)) {
+    CHECK_EQ(g_.size(), g_lagrange_.size());
+    CHECK_LE(g_.size(), MaxDegree + 1);
+    CHECK(base::bits::IsPowerOfTwo(g_.size()));
+  }
+
+  const std::vector<Point>& g() const { return g_; }
+  const std::vector<Point>& g_lagrange() const { return g_lagrange_; }
+  const Point& u() const { return u_; }
+  const Point& w() const { return w_; }
+
+  size_t N() const { return g_.size(); }
+
+  void ResizeBatchCommitments() {
+    batch_commitments_.resize(this->batch_commitment_state_.batch_count);
+  }
+
+  std::vector<Commitment> GetBatchCommitments() {
+    std::vector<Commitment> batch_commitments;
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      batch_commitments = std::move(batch_commitments_);
+    } else {
+      batch_commitments.resize(batch_commitments_.size());
+      CHECK(Bucket::BatchNormalize(batch_commitments_, &batch_commitments));
+      batch_commitments_.clear();
+    }
+    this->batch_commitment_state_.Reset();
+    return batch_commitments;
+  }
+
+  // Reads the opening proof of |poly_openings| from |reader| like
+  // |VerifyOpeningProof()| but, instead of running the check, accumulates it
+  // into |msm|, so that the checks of many proofs can be run at once by
+  // |VerifyMSM()|.
+  template <typename Container>
+  [[nodiscard]] bool ComputeVerificationMSM(
+      const Container& poly_openings, TranscriptReader<Commitment>* reader,
+      VerificationMSM* msm) const {
+    Field v = reader->SqueezeChallenge();
+    VLOG(2) << "IPA(v): " << v.ToHexString(true);
+
+    PolynomialOpeningGrouper<Poly, Commitment> grouper;
+    grouper.GroupBySinglePoint(poly_openings);
+
+    msm->g_scalars.resize(N());
+    for (const GroupedPolynomialOpenings<Poly, Commitment>&
+             grouped_poly_openings : grouper.grouped_poly_openings_vec()) {
+      // NOTE: The checks of the points are randomized by |r|, so that they
+      // add up to a single check.
+      Field r = Field::Random();
+      Field power_of_v = Field::One();
+      Field opening = Field::Zero();
+      for (const PolynomialOpenings<Poly, Commitment>& poly_openings :
+           grouped_poly_openings.poly_openings_vec) {
+        // C = C₀ + vC₁ + v²C₂ + ...
+        // P(x) = P₀(x) + vP₁(x) + v²P₂(x) + ...
+        msm->AddTerm(math::ConvertPoint<Point>(*poly_openings.poly_oracle),
+                     r * power_of_v);
+        opening += power_of_v * poly_openings.openings[0];
+        power_of_v *= v;
+      }
+      if (!AccumulateProof(grouped_poly_openings.points[0], opening, r, reader,
+                           msm)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Runs the checks of |msms| populated by |ComputeVerificationMSM()| at once.
+  // Since they share |g()|, this costs a single MSM over it regardless of the
+  // number of checks.
+  [[nodiscard]] bool VerifyMSM(absl::Span<const VerificationMSM> msms) const {
+    if (msms.empty()) return true;
+
+    std::vector<Field> g_scalars(N());
+    VerificationMSM others;
+    for (size_t i = 0; i < msms.size(); ++i) {
+      // The first check doesn't have to be randomized.
+      Field r = i == 0 ? Field::One() : Field::Random();
+      const VerificationMSM& msm = msms[i];
+      if (msm.g_scalars.size() != g_scalars.size()) {
+        LOG(ERROR) << "The MSM is of a different size: "
+                   << msm.g_scalars.size() << " != " << g_scalars.size();
+        return false;
+      }
+      OPENMP_PARALLEL_FOR(size_t j = 0; j < g_scalars.size(); ++j) {
+        g_scalars[j] += r * msm.g_scalars[j];
+      }
+      for (size_t j = 0; j < msm.bases.size(); ++j) {
+        others.AddTerm(msm.bases[j], r * msm.scalars[j]);
+      }
+    }
+
+    math::VariableBaseMSM<Point> msm;
+    Bucket result;
+    if (!msm.Run(g_, g_scalars, &result)) return false;
+    Bucket others_result;
+    if (!msm.Run(others.bases, others.scalars, &others_result)) return false;
+    return (result + others_result).IsZero();
+  }
+
+ private:
+  friend class VectorCommitmentScheme<IPA<Point, MaxDegree, Commitment>>;
+  friend class UnivariatePolynomialCommitmentScheme<
+      IPA<Point, MaxDegree, Commitment>>;
+  template <typename, size_t, size_t, typename>
+  friend class zk::IPAExtension;
+
+  const char* Name() const { return "IPA"; }
+
+  // VectorCommitmentScheme methods
+  [[nodiscard]] bool DoSetup(size_t size) {
+    if (!base::bits::IsPowerOfTwo(size)) {
+      LOG(ERROR) << "The size is not a power of two: " << size;
+      return false;
+    }
+    // NOTE: Like |Pedersen|, the generators are random instead of being
+    // hashed to the curve.
+    g_ = base::CreateVector(size, []() { return Point::Random(); });
+    u_ = Point::Random();
+    w_ = Point::Random();
+    return ComputeLagrangeGenerators(g_, &g_lagrange_);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommit(const ScalarContainer& v, Commitment* out) const {
+    return DoMSM(g_, v, out);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommit(const ScalarContainer& v,
+                              BatchCommitmentState& state, size_t index) {
+    return RunMSM(g_, v, &batch_commitments_[index]);
+  }
+
+  [[nodiscard]] bool DoCommit(const Poly& poly, Commitment* out) const {
+    return DoMSM(g_, poly.coefficients().coefficients(), out);
+  }
+
+  [[nodiscard]] bool DoCommit(const Poly& poly, BatchCommitmentState& state,
+                              size_t index) {
+    return RunMSM(g_, poly.coefficients().coefficients(),
+                  &batch_commitments_[index]);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
+                                      Commitment* out) const {
+    return DoMSM(g_lagrange_, v, out);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
+                                      BatchCommitmentState& state,
+                                      size_t index) {
+    return RunMSM(g_lagrange_, v, &batch_commitments_[index]);
+  }
+
+  [[nodiscard]] bool DoCommitLagrange(const Evals& evals,
+                                      Commitment* out) const {
+    return DoMSM(g_lagrange_, evals.evaluations(), out);
+  }
+
+  [[nodiscard]] bool DoCommitLagrange(const Evals& evals,
+                                      BatchCommitmentState& state,
+                                      size_t index) {
+    return RunMSM(g_lagrange_, evals.evaluations(),
+                  &batch_commitments_[index]);
+  }
+
+  [[nodiscard]] bool DoBatchCommit(absl::Span<const Poly* const> polys,
+                                   BatchCommitmentState& state, size_t index) {
+    std::vector<absl::Span<const Field>> scalars_list =
+        base::Map(polys, [](const Poly* poly) {
+          return absl::MakeConstSpan(poly->coefficients().coefficients());
+        });
+    return DoBatchMSM(g_, scalars_list, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommit(
+      absl::Span<const absl::Span<const Field>> scalars_list,
+      BatchCommitmentState& state, size_t index) {
+    return DoBatchMSM(g_, scalars_list, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommitLagrange(
+      absl::Span<const Evals* const> evals_list, BatchCommitmentState& state,
+      size_t index) {
+    std::vector<absl::Span<const Field>> scalars_list =
+        base::Map(evals_list, [](const Evals* evals) {
+          return absl::MakeConstSpan(evals->evaluations());
+        });
+    return DoBatchMSM(g_lagrange_, scalars_list, index);
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const Field> deltas,
+                                      Commitment* out) const {
+    Bucket result;
+    if (!RunUpdateLagrange(commitment, rows, deltas, &result)) return false;
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      *out = std::move(result);
+    } else {
+      *out = math::ConvertPoint<Commitment>(result);
+    }
+    return true;
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const Field> deltas,
+                                      BatchCommitmentState& state,
+                                      size_t index) {
+    return RunUpdateLagrange(commitment, rows, deltas,
+                             &batch_commitments_[index]);
+  }
+
+  // UnivariatePolynomialCommitmentScheme methods
+  template <typename Container>
+  [[nodiscard]] bool DoCreateOpeningProof(
+      const Container& poly_openings, TranscriptWriter<Commitment>* writer) {
+    Field v = writer->SqueezeChallenge();
+    VLOG(2) << "IPA(v): " << v.ToHexString(true);
+
+    PolynomialOpeningGrouper<Poly> grouper;
+    grouper.GroupBySinglePoint(poly_openings);
+
+    for (const GroupedPolynomialOpenings<Poly>& grouped_poly_openings :
+         grouper.grouped_poly_openings_vec()) {
+      // P(X) = P₀(X) + vP₁(X) + v²P₂(X) + ...
+      const std::vector<PolynomialOpenings<Poly>>& poly_openings_vec =
+          grouped_poly_openings.poly_openings_vec;
+      std::vector<const Poly*> polys = base::Map(
+          poly_openings_vec, [](const PolynomialOpenings<Poly>& poly_openings) {
+            return poly_openings.poly_oracle.get();
+          });
+      Poly poly = math::LinearCombination(
+          polys, Field::GetSuccessivePowers(polys.size(), v));
+      if (!CreateProof(poly, grouped_poly_openings.points[0], writer)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename Container>
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Container& poly_openings,
+      TranscriptReader<Commitment>* reader) const {
+    VerificationMSM msm;
+    if (!ComputeVerificationMSM(poly_openings, reader, &msm)) return false;
+    return VerifyMSM(absl::Span<const VerificationMSM>(&msm, 1));
+  }
+
+  // Proves P(|x|) to be its evaluation, where P(X) is committed to as C.
+  [[nodiscard]] bool CreateProof(const Poly& poly, const Field& x,
+                                 TranscriptWriter<Commitment>* writer) const {
+    size_t n = N();
+    std::vector<Field> a = poly.coefficients().coefficients();
+    if (a.size() > n) {
+      LOG(ERROR) << "Too many coefficients: " << a.size() << " > " << n;
+      return false;
+    }
+    a.resize(n);
+
+    // S(X) is random with S(x) = 0, which hides P(X) from the rounds.
+    std::vector<Field> s =
+        base::CreateVector(n, []() { return Field::Random(); });
+    s[0] -= Evaluate(s, x);
+    Field s_blind = Field::Random();
+    Bucket s_bucket;
+    if (!RunMSM(g_, s, &s_bucket)) return false;
+    if (!writer->WriteToProof(math::ConvertPoint<Commitment>(
+            math::ConvertPoint<JacobianPoint>(s_bucket) + s_blind * w_))) {
+      return false;
+    }
+
+    Field xi = writer->SqueezeChallenge();
+    VLOG(2) << "IPA(xi): " << xi.ToHexString(true);
+    Field z = writer->SqueezeChallenge();
+    VLOG(2) << "IPA(z): " << z.ToHexString(true);
+
+    // a = P(X) + ξS(X) - P(x), which is committed to as
+    // C' = C + ξS - P(x)g₀ with the blind f = ξ * |s_blind|.
+    // NOTE: <a, b> = 0, since S(x) = 0.
+    Field opening = Evaluate(a, x);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) { a[i] += xi * s[i]; }
+    a[0] -= opening;
+    Field f = xi * s_blind;
+
+    std::vector<Field> b = Field::GetSuccessivePowers(n, x);
+    std::vector<Point> g = g_;
+    std::vector<JacobianPoint> folded_g(n / 2);
+    math::VariableBaseMSM<Point> msm;
+    for (size_t half = n / 2; half > 0; half /= 2) {
+      absl::Span<const Field> a_lo = absl::MakeConstSpan(a).first(half);
+      absl::Span<const Field> a_hi = absl::MakeConstSpan(a).subspan(half, half);
+      absl::Span<const Field> b_lo = absl::MakeConstSpan(b).first(half);
+      absl::Span<const Field> b_hi = absl::MakeConstSpan(b).subspan(half, half);
+      absl::Span<const Point> g_lo = absl::MakeConstSpan(g).first(half);
+      absl::Span<const Point> g_hi = absl::MakeConstSpan(g).subspan(half, half);
+
+      // L = <a_hi, g_lo> + z<a_hi, b_lo>U + l_blind * W
+      // R = <a_lo, g_hi> + z<a_lo, b_hi>U + r_blind * W
+      Bucket l_bucket;
+      if (!msm.Run(g_lo, a_hi, &l_bucket)) return false;
+      Bucket r_bucket;
+      if (!msm.Run(g_hi, a_lo, &r_bucket)) return false;
+      Field l_blind = Field::Random();
+      Field r_blind = Field::Random();
+      JacobianPoint l = math::ConvertPoint<JacobianPoint>(l_bucket) +
+                        (z * InnerProduct(a_hi, b_lo)) * u_ + l_blind * w_;
+      JacobianPoint r = math::ConvertPoint<JacobianPoint>(r_bucket) +
+                        (z * InnerProduct(a_lo, b_hi)) * u_ + r_blind * w_;
+      if (!writer->WriteToProof(math::ConvertPoint<Commitment>(l)) ||
+          !writer->WriteToProof(math::ConvertPoint<Commitment>(r))) {
+        return false;
+      }
+
+      Field u_j = writer->SqueezeChallenge();
+      VLOG(2) << "IPA(u_j): " << u_j.ToHexString(true);
+      std::optional<Field> u_j_inv = u_j.Inverse();
+      if (!u_j_inv.has_value()) {
+        LOG(ERROR) << "The round challenge is zero";
+        return false;
+      }
+
+      // a' = a_lo + uⱼ⁻¹a_hi, b' = b_lo + uⱼb_hi and g' = g_lo + uⱼg_hi, so
+      // that C' + uⱼ⁻¹L + uⱼR commits to a' over g' with the blind
+      // f + uⱼ⁻¹ * |l_blind| + uⱼ * |r_blind|.
+      // NOTE: They are folded in place, except for g, which is folded into
+      // |folded_g| and normalized back into |g| at once.
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < half; ++i) {
+        a[i] += *u_j_inv * a[i + half];
+        b[i] += u_j * b[i + half];
+        folded_g[i] = u_j * g[i + half];
+        folded_g[i] += g[i];
+      }
+      a.resize(half);
+      b.resize(half);
+      g.resize(half);
+      folded_g.resize(half);
+      if (!JacobianPoint::BatchNormalize(folded_g, &g)) return false;
+      f += *u_j_inv * l_blind + u_j * r_blind;
+    }
+
+    return writer->WriteToProof(a[0]) && writer->WriteToProof(f);
+  }
+
+  // Reads the proof of P(|x|) = |opening|, where P(X) is committed to as C,
+  // and accumulates the check of it randomized by |r| into |msm|, which
+  // already holds rC:
+  //
+  // r(C - P(x)g₀ + ξS + Σⱼ(uⱼ⁻¹Lⱼ + uⱼRⱼ) - cG - czbU - fW) = 0
+  //
+  // where G = <s, g> with sᵢ = Πⱼ uⱼ^|bit of i for the round j| and
+  // b = Πⱼ(1 + uⱼx^(2^(k - 1 - j))) are the last folded g and b.
+  [[nodiscard]] bool AccumulateProof(const Field& x, const Field& opening,
+                                     const Field& r,
+                                     TranscriptReader<Commitment>* reader,
+                                     VerificationMSM* msm) const {
+    Commitment s_commitment;
+    if (!reader->ReadFromProof(&s_commitment)) return false;
+    Field xi = reader->SqueezeChallenge();
+    VLOG(2) << "IPA(xi): " << xi.ToHexString(true);
+    Field z = reader->SqueezeChallenge();
+    VLOG(2) << "IPA(z): " << z.ToHexString(true);
+    msm->AddTerm(math::ConvertPoint<Point>(s_commitment), r * xi);
+    msm->g_scalars[0] -= r * opening;
+
+    uint32_t k = this->K();
+    std::vector<Field> u_js;
+    u_js.reserve(k);
+    for (uint32_t j = 0; j < k; ++j) {
+      Commitment l;
+      Commitment r_commitment;
+      if (!reader->ReadFromProof(&l) || !reader->ReadFromProof(&r_commitment)) {
+        return false;
+      }
+      Field u_j = reader->SqueezeChallenge();
+      VLOG(2) << "IPA(u_j): " << u_j.ToHexString(true);
+      std::optional<Field> u_j_inv = u_j.Inverse();
+      if (!u_j_inv.has_value()) {
+        LOG(ERROR) << "The round challenge is zero";
+        return false;
+      }
+      msm->AddTerm(math::ConvertPoint<Point>(l), r * *u_j_inv);
+      msm->AddTerm(math::ConvertPoint<Point>(r_commitment), r * u_j);
+      u_js.push_back(std::move(u_j));
+    }
+
+    Field c;
+    Field f;
+    if (!reader->ReadFromProof(&c) || !reader->ReadFromProof(&f)) return false;
+
+    // The round j folds the bit k - 1 - j of the indices, so s is built from
+    // the last round.
+    std::vector<Field> s(N());
+    s[0] = -r * c;
+    for (size_t j = k, len = 1; j > 0; --j, len *= 2) {
+      const Field& u_j = u_js[j - 1];
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < len; ++i) {
+        s[len + i] = s[i] * u_j;
+      }
+    }
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < s.size(); ++i) {
+      msm->g_scalars[i] += s[i];
+    }
+
+    Field b = Field::One();
+    Field power_of_x = x;
+    for (size_t j = k; j > 0; --j) {
+      b *= Field::One() + u_js[j - 1] * power_of_x;
+      power_of_x.SquareInPlace();
+    }
+    msm->AddTerm(u_, -r * c * z * b);
+    msm->AddTerm(w_, -r * f);
+    return true;
+  }
+
+  template <typename ScalarContainer>
+  bool DoMSM(const std::vector<Point>& bases, const ScalarContainer& scalars,
+             Commitment* out) const {
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      return RunMSM(bases, scalars, out);
+    } else {
+      Bucket result;
+      if (!RunMSM(bases, scalars, &result)) return false;
+      *out = math::ConvertPoint<Commitment>(result);
+      return true;
+    }
+  }
+
+  template <typename ScalarContainer>
+  static bool RunMSM(const std::vector<Point>& bases,
+                     const ScalarContainer& scalars, Bucket* out) {
+    if (std::size(scalars) > bases.size()) {
+      LOG(ERROR) << "Too many scalars: " << std::size(scalars) << " > "
+                 << bases.size();
+      return false;
+    }
+    math::VariableBaseMSM<Point> msm;
+    return msm.Run(absl::MakeConstSpan(bases).first(std::size(scalars)),
+                   scalars, out);
+  }
+
+  // |out| = |commitment| + Σᵢ |deltas[i]|·|g_lagrange_[rows[i]]|
+  bool RunUpdateLagrange(const Commitment& commitment,
+                         absl::Span<const size_t> rows,
+                         absl::Span<const Field> deltas, Bucket* out) const {
+    if (rows.size() != deltas.size()) {
+      LOG(ERROR) << "The sizes of the rows and the deltas don't match: "
+                 << rows.size() << " vs " << deltas.size();
+      return false;
+    }
+    std::vector<Point> bases(rows.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+      if (rows[i] >= g_lagrange_.size()) {
+        LOG(ERROR) << "Invalid row: " << rows[i];
+        return false;
+      }
+      bases[i] = g_lagrange_[rows[i]];
+    }
+    if (bases.empty()) {
+      *out = Bucket::Zero();
+    } else if (!RunMSM(bases, deltas, out)) {
+      return false;
+    }
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      *out += commitment;
+    } else {
+      *out += math::ConvertPoint<Bucket>(commitment);
+    }
+    return true;
+  }
+
+  bool DoBatchMSM(const std::vector<Point>& bases,
+                  absl::Span<const absl::Span<const Field>> scalars_list,
+                  size_t index) {
+    if (index + scalars_list.size() > batch_commitments_.size()) {
+      LOG(ERROR) << "Too many commitments: " << index + scalars_list.size()
+                 << " > " << batch_commitments_.size();
+      return false;
+    }
+    size_t size = 0;
+    for (absl::Span<const Field> scalars : scalars_list) {
+      size = std::max(size, scalars.size());
+    }
+    if (size > bases.size()) {
+      LOG(ERROR) << "Too many scalars: " << size << " > " << bases.size();
+      return false;
+    }
+    math::VariableBaseMSM<Point> msm;
+    std::vector<Bucket> results;
+    if (!msm.RunBatch(absl::MakeConstSpan(bases).first(size), scalars_list,
+                      &results)) {
+      return false;
+    }
+    std::move(results.begin(), results.end(),
+              batch_commitments_.begin() + index);
+    return true;
+  }
+
+  static Field Evaluate(absl::Span<const Field> coeffs, const Field& x) {
+    Field ret = Field::Zero();
+    for (const Field& coeff : base::Reversed(coeffs)) {
+      ret *= x;
+      ret += coeff;
+    }
+    return ret;
+  }
+
+  static Field InnerProduct(absl::Span<const Field> a,
+                            absl::Span<const Field> b) {
+    Field ret = Field::Zero();
+    for (size_t i = 0; i < a.size(); ++i) {
+      ret += a[i] * b[i];
+    }
+    return ret;
+  }
+
+  // gᵢ' = [Lᵢ(X)] = (1/n) Σⱼ ω⁻ⁱʲgⱼ, which is the inverse FFT of g run over the
+  // points.
+  static bool ComputeLagrangeGenerators(const std::vector<Point>& g,
+                                        std::vector<Point>* g_lagrange) {
+    size_t n = g.size();
+    if (n == 1) {
+      *g_lagrange = g;
+      return true;
+    }
+    std::unique_ptr<Domain> domain = Domain::Create(n);
+    uint32_t k = base::bits::SafeLog2Ceiling(n);
+
+    std::vector<JacobianPoint> points(n);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      points[base::bits::BitRev(i) >> (64 - k)] =
+          math::ConvertPoint<JacobianPoint>(g[i]);
+    }
+    for (size_t m = 1; m < n; m *= 2) {
+      std::vector<Field> twiddles = Field::GetSuccessivePowers(
+          m, domain->group_gen_inv().Pow(n / (2 * m)));
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < n / 2; ++i) {
+        size_t lo = i / m * 2 * m + i % m;
+        JacobianPoint t = twiddles[i % m] * points[lo + m];
+        points[lo + m] = points[lo] - t;
+        points[lo] += t;
+      }
+    }
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      points[i] *= domain->size_inv();
+    }
+
+    g_lagrange->resize(n);
+    return JacobianPoint::BatchNormalize(points, g_lagrange);
+  }
+
+  std::vector<Point> g_;
+  std::vector<Point> g_lagrange_;
+  Point u_;
+  Point w_;
+  std::vector<Bucket> batch_commitments_;
+};
+
+template <typename Point, size_t MaxDegree, typename _Commitment>
+struct VectorCommitmentSchemeTraits<IPA<Point, MaxDegree, _Commitment>> {
+ public:
+  constexpr static size_t kMaxSize = MaxDegree + 1;
+  constexpr static bool kIsTransparent = true;
+  constexpr static bool kSupportsBatchMode = true;
+
+  using Field = typename Point::ScalarField;
+  using Commitment = _Commitment;
+};
+
+}  // namespace crypto
+
+namespace base {
+
+template <typename Point, size_t MaxDegree, typename Commitment>
+class Copyable<crypto::IPA<Point, MaxDegree, Commitment>> {
+ public:
+  using PCS = crypto::IPA<Point, MaxDegree, Commitment>;
+
+  static bool WriteTo(const PCS& pcs, Buffer* buffer) {
+    return buffer->WriteMany(pcs.g(), pcs.g_lagrange(), pcs.u(), pcs.w());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, PCS* pcs) {
+    std::vector<Point> g;
+    std::vector<Point> g_lagrange;
+    Point u;
+    Point w;
+    if (!buffer.ReadMany(&g, &g_lagrange, &u, &w)) {
+      return false;
+    }
+    if (g.size() != g_lagrange.size() ||
+        !base::bits::IsPowerOfTwo(g.size())) {
+      LOG(ERROR) << "Invalid generators";
+      return false;
+    }
+
+    *pcs = PCS(std::move(g), std::move(g_lagrange), std::move(u),
+               std::move(w));
+    return true;
+  }
+
+  static size_t EstimateSize(const PCS& pcs) {
+    return base::EstimateSize(pcs.g(), pcs.g_lagrange(), pcs.u(), pcs.w());
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_IPA_IPA_H_
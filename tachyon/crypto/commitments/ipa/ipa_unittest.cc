@@ -0,0 +1,156 @@
+#include "tachyon/crypto/commitments/ipa/ipa.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+#include "tachyon/math/elliptic_curves/pasta/pallas/curve.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+constexpr size_t K = 4;
+constexpr size_t N = size_t{1} << K;
+constexpr size_t kMaxDegree = N - 1;
+
+using PCS = IPA<math::pallas::AffinePoint, kMaxDegree,
+                math::pallas::AffinePoint>;
+using F = typename PCS::Field;
+using Poly = typename PCS::Poly;
+using Evals = typename PCS::Evals;
+using Domain = typename PCS::Domain;
+using Commitment = typename PCS::Commitment;
+
+class IPATest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { math::pallas::Curve::Init(); }
+
+  void SetUp() override {
+    ASSERT_TRUE(pcs_.Setup(N));
+
+    polys_ = base::CreateVector(3, []() { return Poly::Random(kMaxDegree); });
+    commitments_ = base::Map(polys_, [this](const Poly& poly) {
+      Commitment commitment;
+      CHECK(pcs_.Commit(poly, &commitment));
+      return commitment;
+    });
+    points_ = {F::Random(), F::Random()};
+    // P₀(x₀), P₁(x₀), P₁(x₁), P₂(x₁)
+    queries_ = {{0, 0}, {1, 0}, {1, 1}, {2, 1}};
+    openings_ = base::Map(queries_, [this](const std::pair<size_t, size_t>& q) {
+      return polys_[q.first].Evaluate(points_[q.second]);
+    });
+  }
+
+ protected:
+  std::vector<PolynomialOpening<Poly>> CreateProverOpenings() const {
+    return base::CreateVector(queries_.size(), [this](size_t i) {
+      return PolynomialOpening<Poly>(
+          base::Ref<const Poly>(&polys_[queries_[i].first]),
+          points_[queries_[i].second], openings_[i]);
+    });
+  }
+
+  std::vector<PolynomialOpening<Poly, Commitment>> CreateVerifierOpenings()
+      const {
+    return base::CreateVector(queries_.size(), [this](size_t i) {
+      return PolynomialOpening<Poly, Commitment>(
+          base::Ref<const Commitment>(&commitments_[queries_[i].first]),
+          points_[queries_[i].second], openings_[i]);
+    });
+  }
+
+  void CreateProof(SimpleTranscriptWriter<Commitment>* writer) {
+    CHECK(pcs_.CreateOpeningProof(CreateProverOpenings(), writer));
+  }
+
+  PCS pcs_;
+  std::vector<Poly> polys_;
+  std::vector<Commitment> commitments_;
+  std::vector<F> points_;
+  std::vector<std::pair<size_t, size_t>> queries_;
+  std::vector<F> openings_;
+};
+
+}  // namespace
+
+TEST_F(IPATest, CommitLagrange) {
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  Evals evals = domain->FFT(polys_[0]);
+
+  Commitment commitment;
+  ASSERT_TRUE(pcs_.CommitLagrange(evals, &commitment));
+  EXPECT_EQ(commitment, commitments_[0]);
+}
+
+TEST_F(IPATest, BatchCommit) {
+  std::vector<const Poly*> polys =
+      base::Map(polys_, [](const Poly& poly) { return &poly; });
+  pcs_.SetBatchMode(polys.size());
+  ASSERT_TRUE(pcs_.BatchCommit(polys, 0));
+  EXPECT_EQ(pcs_.GetBatchCommitments(), commitments_);
+}
+
+TEST_F(IPATest, CreateAndVerifyProof) {
+  SimpleTranscriptWriter<Commitment> writer((base::Uint8VectorBuffer()));
+  CreateProof(&writer);
+
+  base::Buffer read_buf(writer.buffer().buffer(), writer.buffer().buffer_len());
+  SimpleTranscriptReader<Commitment> reader(std::move(read_buf));
+  EXPECT_TRUE(pcs_.VerifyOpeningProof(CreateVerifierOpenings(), &reader));
+}
+
+TEST_F(IPATest, VerifyWrongOpening) {
+  SimpleTranscriptWriter<Commitment> writer((base::Uint8VectorBuffer()));
+  CreateProof(&writer);
+
+  openings_[2] += F::One();
+  base::Buffer read_buf(writer.buffer().buffer(), writer.buffer().buffer_len());
+  SimpleTranscriptReader<Commitment> reader(std::move(read_buf));
+  EXPECT_FALSE(pcs_.VerifyOpeningProof(CreateVerifierOpenings(), &reader));
+}
+
+TEST_F(IPATest, VerifyMSM) {
+  using VerificationMSM = typename PCS::VerificationMSM;
+
+  SimpleTranscriptWriter<Commitment> writer((base::Uint8VectorBuffer()));
+  CreateProof(&writer);
+
+  std::vector<PolynomialOpening<Poly, Commitment>> verifier_openings =
+      CreateVerifierOpenings();
+  std::vector<VerificationMSM> msms(3);
+  for (VerificationMSM& msm : msms) {
+    base::Buffer read_buf(writer.buffer().buffer(),
+                          writer.buffer().buffer_len());
+    SimpleTranscriptReader<Commitment> reader(std::move(read_buf));
+    ASSERT_TRUE(pcs_.ComputeVerificationMSM(verifier_openings, &reader, &msm));
+  }
+  EXPECT_TRUE(pcs_.VerifyMSM(msms));
+
+  msms[1].scalars[0] += F::One();
+  EXPECT_FALSE(pcs_.VerifyMSM(msms));
+}
+
+TEST_F(IPATest, Copyable) {
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(pcs_)));
+  ASSERT_TRUE(write_buf.Write(pcs_));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  PCS value;
+  ASSERT_TRUE(write_buf.Read(&value));
+  EXPECT_EQ(pcs_.g(), value.g());
+  EXPECT_EQ(pcs_.g_lagrange(), value.g_lagrange());
+  EXPECT_EQ(pcs_.u(), value.u());
+  EXPECT_EQ(pcs_.w(), value.w());
+}
+
+}  // namespace tachyon::crypto
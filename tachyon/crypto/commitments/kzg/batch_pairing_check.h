@@ -0,0 +1,56 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_BATCH_PAIRING_CHECK_H_
+#define TACHYON_CRYPTO_COMMITMENTS_KZG_BATCH_PAIRING_CHECK_H_
+
+#include <array>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/pairing/pairing.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::crypto {
+
+// Checks e(aᵢ, |g2_arr[0]|) * e(bᵢ, |g2_arr[1]|) ≟ gᴛ⁰ for every [aᵢ, bᵢ] of
+// |pairing_points_vec| at once. Each check is raised to the power of a random
+// rᵢ and they are multiplied together:
+//
+// e(Σᵢ rᵢ * aᵢ, |g2_arr[0]|) * e(Σᵢ rᵢ * bᵢ, |g2_arr[1]|) ≟ gᴛ⁰
+//
+// Since the G2 points are shared, this costs two MSMs and a single pairing of
+// two pairs regardless of the number of checks.
+template <typename Curve>
+[[nodiscard]] bool BatchCheckPairingPoints(
+    absl::Span<const std::array<typename Curve::G1Curve::AffinePoint, 2>>
+        pairing_points_vec,
+    const std::array<typename Curve::G2Prepared, 2>& g2_arr) {
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using PairingPoints = std::array<G1Point, 2>;
+  using F = typename G1Point::ScalarField;
+  using Bucket = typename math::VariableBaseMSM<G1Point>::Bucket;
+
+  if (pairing_points_vec.empty()) return true;
+
+  // The first check doesn't have to be randomized.
+  std::vector<F> rs = base::CreateVector(
+      pairing_points_vec.size(),
+      [](size_t i) { return i == 0 ? F::One() : F::Random(); });
+
+  math::VariableBaseMSM<G1Point> msm;
+  G1Point g1_arr[2];
+  for (size_t i = 0; i < 2; ++i) {
+    std::vector<G1Point> bases = base::Map(
+        pairing_points_vec,
+        [i](const PairingPoints& pairing_points) { return pairing_points[i]; });
+    Bucket bucket;
+    if (!msm.Run(bases, rs, &bucket)) return false;
+    g1_arr[i] = math::ConvertPoint<G1Point>(bucket);
+  }
+  return math::Pairing<Curve>(g1_arr, g2_arr).IsOne();
+}
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_KZG_BATCH_PAIRING_CHECK_H_
@@ -0,0 +1,131 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_FK20_H_
+#define TACHYON_CRYPTO_COMMITMENTS_KZG_FK20_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/commitments/kzg/kzg.h"
+#include "tachyon/math/polynomials/univariate/group_fft.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
+
+namespace tachyon::crypto {
+
+// |FK20| computes the KZG opening proofs of a polynomial f of degree < n at
+// all the points ωᵏ of the domain of size n at once, as described in "Fast
+// amortized KZG proofs" by Feist and Khovratovich. Opening them one by one
+// costs O(n²), while it costs O(n log n) scalar multiplications.
+//
+// The proof at z is the commitment to (f(X) - f(z)) / (X - z), which is
+//
+//   π_z = Σₘ zᵐ * hₘ, where hₘ = Σᵢ fₘ₊₁₊ᵢ * [τⁱ]G.
+//
+// So the proofs at ωᵏ are the |math::GroupFFT()| of h, and h is a Toeplitz
+// matrix-vector product of the coefficients of f and the SRS. It is computed
+// by embedding the matrix into a circulant one of size 2n, which is
+// diagonalized by the FFT. The FFT of the SRS side is computed once by
+// |Setup()|.
+template <typename G1Point, size_t MaxDegree>
+class FK20 {
+ public:
+  using Field = typename G1Point::ScalarField;
+  using Point = decltype(std::declval<G1Point>().ToJacobian());
+  // The circulant matrix is of size 2n.
+  using Domain = math::UnivariateEvaluationDomain<Field, 2 * MaxDegree + 1>;
+
+  FK20() = default;
+
+  size_t n() const { return n_; }
+
+  // Precomputes the FFT of the first |n| powers of τ of |kzg|. Returns false
+  // if |n| is not a power of 2, |n| > |kzg.N()| or there's no domain of size
+  // 2 * |n|.
+  template <typename Commitment>
+  [[nodiscard]] bool Setup(const KZG<G1Point, MaxDegree, Commitment>& kzg,
+                           size_t n) {
+    if (!base::bits::IsPowerOfTwo(n) || n > kzg.N()) {
+      LOG(ERROR) << "Invalid size: " << n;
+      return false;
+    }
+    Field omega;
+    if (!Field::GetRootOfUnity(2 * n, &omega)) {
+      LOG(ERROR) << "No root of unity of size " << 2 * n;
+      return false;
+    }
+
+    // [[τⁿ⁻¹]G, ..., [τ⁰]G, 0, ..., 0]
+    const std::vector<G1Point>& g1_powers_of_tau = kzg.g1_powers_of_tau();
+    std::vector<G1Point> reversed(2 * n, G1Point::Zero());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      reversed[i] = g1_powers_of_tau[n - 1 - i];
+    }
+    std::vector<G1Point> srs_fft;
+    if (!math::GroupFFT(absl::MakeConstSpan(reversed), &srs_fft)) return false;
+
+    n_ = n;
+    domain_ = Domain::Create(2 * n);
+    srs_fft_ = std::move(srs_fft);
+    return true;
+  }
+
+  // Sets |proofs| to the opening proofs of the polynomial whose coefficients
+  // are |coeffs| at ω⁰, ..., ωⁿ⁻¹. Returns false if |Setup()| is not called
+  // or |coeffs| has more than n coefficients.
+  [[nodiscard]] bool ComputeAllProofs(absl::Span<const Field> coeffs,
+                                      std::vector<G1Point>* proofs) const {
+    if (n_ == 0) {
+      LOG(ERROR) << "Setup() is not called";
+      return false;
+    }
+    if (coeffs.size() > n_) {
+      LOG(ERROR) << "Too many coefficients: " << coeffs.size() << " > " << n_;
+      return false;
+    }
+
+    // [f₀, ..., fₙ₋₁, 0, ..., 0]
+    std::vector<Field> padded(2 * n_, Field::Zero());
+    std::copy(coeffs.begin(), coeffs.end(), padded.begin());
+    std::vector<Field> coeffs_fft =
+        domain_
+            ->FFT(typename Domain::DensePoly(
+                typename Domain::DenseCoeffs(std::move(padded))))
+            .TakeEvaluations();
+    // NOTE: The FFT of a zero polynomial is empty.
+    coeffs_fft.resize(2 * n_, Field::Zero());
+
+    // The IFFT of the products is the circular convolution of the two, whose
+    // n + m-th element is hₘ.
+    std::vector<Point> products(2 * n_);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < 2 * n_; ++i) {
+      products[i] = srs_fft_[i] * coeffs_fft[i];
+    }
+    std::vector<G1Point> products_affine(2 * n_);
+    if (!Point::BatchNormalize(products, &products_affine)) return false;
+    std::vector<G1Point> convolution;
+    if (!math::GroupIFFT(absl::MakeConstSpan(products_affine), &convolution)) {
+      return false;
+    }
+
+    // NOTE: hₙ₋₁ is zero and so is the last element of the convolution.
+    return math::GroupFFT(absl::MakeConstSpan(convolution).subspan(n_),
+                          proofs);
+  }
+
+ private:
+  size_t n_ = 0;
+  std::unique_ptr<Domain> domain_;
+  // The FFT of the reversed first |n_| powers of τ padded with zeros.
+  std::vector<G1Point> srs_fft_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_KZG_FK20_H_
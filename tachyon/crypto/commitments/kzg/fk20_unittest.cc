@@ -0,0 +1,90 @@
+#include "tachyon/crypto/commitments/kzg/fk20.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+constexpr size_t N = 16;
+constexpr size_t kMaxDegree = N - 1;
+
+class FK20Test : public testing::Test {
+ public:
+  using F = math::bn254::Fr;
+  using PCS =
+      KZG<math::bn254::G1AffinePoint, kMaxDegree, math::bn254::G1AffinePoint>;
+
+  static void SetUpTestSuite() { math::bn254::G1Curve::Init(); }
+};
+
+}  // namespace
+
+TEST_F(FK20Test, Setup) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  FK20<math::bn254::G1AffinePoint, kMaxDegree> fk20;
+  std::vector<math::bn254::G1AffinePoint> proofs;
+  EXPECT_FALSE(fk20.ComputeAllProofs({}, &proofs));
+  EXPECT_FALSE(fk20.Setup(pcs, N * 2));
+  EXPECT_FALSE(fk20.Setup(pcs, N - 1));
+  ASSERT_TRUE(fk20.Setup(pcs, N));
+  EXPECT_EQ(fk20.n(), N);
+
+  std::vector<F> coeffs(N + 1, F::One());
+  EXPECT_FALSE(fk20.ComputeAllProofs(coeffs, &proofs));
+}
+
+TEST_F(FK20Test, ComputeAllProofs) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  for (size_t n : {size_t{2}, size_t{8}, size_t{16}}) {
+    SCOPED_TRACE(n);
+    FK20<math::bn254::G1AffinePoint, kMaxDegree> fk20;
+    ASSERT_TRUE(fk20.Setup(pcs, n));
+
+    std::vector<F> coeffs = base::CreateVector(n, []() { return F::Random(); });
+    std::vector<math::bn254::G1AffinePoint> proofs;
+    ASSERT_TRUE(fk20.ComputeAllProofs(coeffs, &proofs));
+    ASSERT_EQ(proofs.size(), n);
+
+    F omega;
+    ASSERT_TRUE(F::GetRootOfUnity(n, &omega));
+    F z = F::One();
+    for (size_t k = 0; k < n; ++k) {
+      // The quotient (f(X) - f(z)) / (X - z) by the synthetic division.
+      std::vector<F> quotient(n - 1);
+      F acc = F::Zero();
+      for (size_t i = n - 1; i > 0; --i) {
+        acc = acc * z + coeffs[i];
+        quotient[i - 1] = acc;
+      }
+      math::bn254::G1AffinePoint expected;
+      ASSERT_TRUE(pcs.Commit(quotient, &expected));
+      EXPECT_EQ(proofs[k], expected);
+      z *= omega;
+    }
+  }
+}
+
+TEST_F(FK20Test, ZeroPolynomial) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  FK20<math::bn254::G1AffinePoint, kMaxDegree> fk20;
+  ASSERT_TRUE(fk20.Setup(pcs, N));
+  std::vector<math::bn254::G1AffinePoint> proofs;
+  ASSERT_TRUE(fk20.ComputeAllProofs({}, &proofs));
+  EXPECT_EQ(proofs, std::vector<math::bn254::G1AffinePoint>(
+                        N, math::bn254::G1AffinePoint::Zero()));
+}
+
+}  // namespace tachyon::crypto
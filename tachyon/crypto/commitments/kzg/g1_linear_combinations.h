@@ -0,0 +1,91 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_G1_LINEAR_COMBINATIONS_H_
+#define TACHYON_CRYPTO_COMMITMENTS_KZG_G1_LINEAR_COMBINATIONS_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::crypto {
+
+// |G1LinearCombinations| collects the terms sᵢ * Pᵢ of |N| linear combinations
+// of G1 points, so that they are computed by a single batched MSM instead of a
+// scalar multiplication and a point addition per term. The terms of the same
+// base are merged into one, which is common for the commitments opened at
+// many points, and so are the terms of the generator G.
+//
+// NOTE: A base is identified by its address, so the bases passed to |Add()|
+// must outlive |Evaluate()| and must not move.
+template <typename G1Point, size_t N>
+class G1LinearCombinations {
+ public:
+  using F = typename G1Point::ScalarField;
+  using Bucket = typename math::VariableBaseMSM<G1Point>::Bucket;
+
+  G1LinearCombinations() {
+    for (F& generator_scalar : generator_scalars_) {
+      generator_scalar = F::Zero();
+    }
+  }
+
+  void Reserve(size_t size) {
+    bases_.reserve(size + 1);
+    for (std::vector<F>& scalars : scalars_list_) {
+      scalars.reserve(size + 1);
+    }
+  }
+
+  // Adds |scalar| * |base| to the |idx|-th linear combination.
+  template <typename Point>
+  void Add(size_t idx, const F& scalar, const Point& base) {
+    auto [it, inserted] = indices_.try_emplace(&base, bases_.size());
+    if (inserted) {
+      if constexpr (std::is_same_v<Point, G1Point>) {
+        bases_.push_back(base);
+      } else {
+        bases_.push_back(math::ConvertPoint<G1Point>(base));
+      }
+      for (std::vector<F>& scalars : scalars_list_) {
+        scalars.push_back(F::Zero());
+      }
+    }
+    scalars_list_[idx][it->second] += scalar;
+  }
+
+  // Adds |scalar| * G to the |idx|-th linear combination.
+  void AddGenerator(size_t idx, const F& scalar) {
+    generator_scalars_[idx] += scalar;
+  }
+
+  // Populates |rets| with the linear combinations. This consumes the terms.
+  [[nodiscard]] bool Evaluate(std::array<G1Point, N>* rets) {
+    bases_.push_back(G1Point::Generator());
+    std::array<absl::Span<const F>, N> scalars_spans;
+    for (size_t i = 0; i < N; ++i) {
+      scalars_list_[i].push_back(generator_scalars_[i]);
+      scalars_spans[i] = scalars_list_[i];
+    }
+
+    math::VariableBaseMSM<G1Point> msm;
+    std::vector<Bucket> buckets;
+    if (!msm.RunBatch(bases_, scalars_spans, &buckets)) return false;
+    return Bucket::BatchNormalize(buckets, rets);
+  }
+
+ private:
+  std::vector<G1Point> bases_;
+  std::array<std::vector<F>, N> scalars_list_;
+  std::array<F, N> generator_scalars_;
+  absl::flat_hash_map<const void*, size_t> indices_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_KZG_G1_LINEAR_COMBINATIONS_H_
@@ -0,0 +1,59 @@
+#include "tachyon/crypto/commitments/kzg/g1_linear_combinations.h"
+
+#include <array>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+class G1LinearCombinationsTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { math::bn254::G1Curve::Init(); }
+};
+
+}  // namespace
+
+TEST_F(G1LinearCombinationsTest, Evaluate) {
+  using G1Point = math::bn254::G1AffinePoint;
+  using F = math::bn254::Fr;
+
+  constexpr size_t kSize = 10;
+  std::vector<G1Point> bases =
+      base::CreateVector(kSize, []() { return G1Point::Random(); });
+  std::vector<math::bn254::G1JacobianPoint> jacobian_bases = base::CreateVector(
+      kSize, []() { return math::bn254::G1JacobianPoint::Random(); });
+
+  G1LinearCombinations<G1Point, 2> combinations;
+  combinations.Reserve(2 * kSize);
+  std::array<math::bn254::G1JacobianPoint, 2> expected = {
+      math::bn254::G1JacobianPoint::Zero(),
+      math::bn254::G1JacobianPoint::Zero()};
+  for (size_t i = 0; i < kSize; ++i) {
+    // Every base is added twice to each combination to test the merging.
+    for (size_t j = 0; j < 4; ++j) {
+      F scalar = F::Random();
+      combinations.Add(j % 2, scalar, bases[i]);
+      expected[j % 2] += scalar * bases[i];
+
+      scalar = F::Random();
+      combinations.Add(j % 2, scalar, jacobian_bases[i]);
+      expected[j % 2] += scalar * jacobian_bases[i];
+    }
+  }
+  F scalar = F::Random();
+  combinations.AddGenerator(1, scalar);
+  expected[1] += scalar * G1Point::Generator();
+
+  std::array<G1Point, 2> results;
+  ASSERT_TRUE(combinations.Evaluate(&results));
+  EXPECT_EQ(results[0], expected[0].ToAffine());
+  EXPECT_EQ(results[1], expected[1].ToAffine());
+}
+
+}  // namespace tachyon::crypto
@@ -13,6 +13,9 @@
 
 #include "gtest/gtest_prod.h"
 
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/kzg/batch_pairing_check.h"
+#include "tachyon/crypto/commitments/kzg/g1_linear_combinations.h"
 #include "tachyon/crypto/commitments/kzg/kzg_family.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
@@ -48,6 +51,9 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
   using Field = typename Base::Field;
   using Poly = typename Base::Poly;
   using Point = typename Poly::Point;
+  // The G1 points of the pairing check of an opening proof, which are paired
+  // with [τ]₂ and [-1]₂ respectively.
+  using PairingPoints = std::array<G1Point, 2>;
 
   GWC() = default;
   explicit GWC(KZG<G1Point, MaxDegree, Commitment>&& kzg)
@@ -69,64 +75,14 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
     return this->kzg_.GetBatchCommitments(this->batch_commitment_state_);
   }
 
- private:
-  friend class VectorCommitmentScheme<GWC<Curve, MaxDegree, Commitment>>;
-  friend class UnivariatePolynomialCommitmentScheme<
-      GWC<Curve, MaxDegree, Commitment>>;
-  template <typename, size_t, size_t, typename>
-  friend class zk::GWCExtension;
-  FRIEND_TEST(GWCTest, Copyable);
-
-  const char* Name() const { return "GWC"; }
-
-  // UnivariatePolynomialCommitmentScheme methods
+  // Reads the opening proof of |poly_openings| from |reader| like
+  // |VerifyOpeningProof()| but, instead of running the pairing check,
+  // populates |pairing_points| with the G1 points of it, so that the checks
+  // of many proofs can be run at once by |BatchVerifyPairingPoints()|.
   template <typename Container>
-  [[nodiscard]] bool DoCreateOpeningProof(
-      const Container& poly_openings, TranscriptWriter<Commitment>* writer) {
-    Field v = writer->SqueezeChallenge();
-    VLOG(2) << "GWC(v): " << v.ToHexString(true);
-
-    PolynomialOpeningGrouper<Poly> grouper;
-    grouper.GroupBySinglePoint(poly_openings);
-
-    // Group |poly_openings| to |grouped_poly_openings_vec|.
-    // {x₀, [P₀, P₁, P₂]}
-    // {x₁, [P₀, P₁, P₂]}
-    // {x₂, [P₀, P₁, P₂, P₃]}
-    // {x₃, [P₃]}
-    // {x₄, [P₄]}
-    const std::vector<GroupedPolynomialOpenings<Poly>>&
-        grouped_poly_openings_vec = grouper.grouped_poly_openings_vec();
-
-    this->SetBatchMode(grouped_poly_openings_vec.size());
-    for (size_t i = 0; i < grouped_poly_openings_vec.size(); ++i) {
-      // clang-format off
-      // W₀(X) = H₀(X) / (X - x₀) = (P₀(X) - P₀(x₀)) + v(P₁(X) - P₁(x₀)) + v²(P₂(X) - P₂(x₀)) / (X - x₀)
-      // W₁(X) = H₁(X) / (X - x₁) = (P₀(X) - P₀(x₁)) + v(P₁(X) - P₁(x₁)) + v²(P₂(X) - P₂(x₁)) / (X - x₁)
-      // W₂(X) = H₂(X) / (X - x₂) = (P₀(X) - P₀(x₂)) + v(P₁(X) - P₁(x₂)) + v²(P₂(X) - P₂(x₂)) + v³(P₃(X) - P₃(x₂)) / (X - x₂)
-      // W₃(X) = H₃(X) / (X - x₃) = (P₃(X) - P₃(x₃)) / (X - x₃)
-      // W₄(X) = H₄(X) / (X - x₄) = (P₄(X) - P₄(x₄)) / (X - x₄)
-      // clang-format on
-      std::vector<Poly> low_degree_extensions;
-      Poly w = grouped_poly_openings_vec[i].CreateCombinedLowDegreeExtensions(
-          v, low_degree_extensions);
-      if (!this->Commit(w, i)) return false;
-    }
-
-    // Commit all the Wᵢ(X).
-    std::vector<Commitment> commitments = this->GetBatchCommitments();
-    for (const Commitment& commitment : commitments) {
-      if (!writer->WriteToProof(commitment)) return false;
-    }
-    return true;
-  }
-
-  template <typename Container>
-  [[nodiscard]] bool DoVerifyOpeningProof(
-      const Container& poly_openings,
-      TranscriptReader<Commitment>* reader) const {
-    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
-
+  [[nodiscard]] bool ComputePairingPoints(
+      const Container& poly_openings, TranscriptReader<Commitment>* reader,
+      PairingPoints* pairing_points) const {
     Field v = reader->SqueezeChallenge();
     VLOG(2) << "GWC(v): " << v.ToHexString(true);
 
@@ -154,62 +110,45 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
     Field u = reader->SqueezeChallenge();
     VLOG(2) << "GWC(u): " << u.ToHexString(true);
 
+    // NOTE: W and Wₐᵤₓ + Cₘᵤₗₜ - [Oₘᵤₗₜ]₁ below are collected as terms over
+    // the shared bases [Wᵢ(τ)]₁, Cⱼ and G and computed by a single batched
+    // MSM, where the terms of Cⱼ opened at many points are merged into one.
+    G1LinearCombinations<G1Point, 2> combinations;
+    combinations.Reserve(commitments.size() + std::size(poly_openings));
     Field opening_multi = Field::Zero();
-    G1JacobianPoint commitment_multi = G1JacobianPoint::Zero();
-    G1JacobianPoint witness_with_aux = G1JacobianPoint::Zero();
-    G1JacobianPoint witness = G1JacobianPoint::Zero();
     Field power_of_u = Field::One();
     for (size_t i = 0; i < grouped_poly_openings_vec.size(); ++i) {
-      Field opening_batch = Field::Zero();
-      G1JacobianPoint commitment_batch = G1JacobianPoint::Zero();
+      // clang-format off
+      // |witness| = W = [W₀(τ)]₁ + u[W₁(τ)]₁ + u²[W₂(τ)]₁ + u³[W₃(τ)]₁ + u⁴[W₄(τ)]₁
+      // |witness_with_aux| = Wₐᵤₓ = x₀[W₀(τ)]₁ + ux₁[W₁(τ)]₁ + u²x₂[W₂(τ)]₁ + u³x₃[W₃(τ)]₁ + u⁴x₄[W₄(τ)]₁
+      // clang-format on
+      combinations.Add(0, power_of_u, commitments[i]);
+      combinations.Add(1, power_of_u * grouped_poly_openings_vec[i].points[0],
+                       commitments[i]);
 
       const std::vector<PolynomialOpenings<Poly, Commitment>>&
           poly_openings_vec = grouped_poly_openings_vec[i].poly_openings_vec;
-      for (const PolynomialOpenings<Poly, Commitment>& poly_openings :
-           base::Reversed(poly_openings_vec)) {
-        // |opening_batch₀| = P₀(x₀) + vP₁(x₀) + v²P₂(x₀)
-        // |opening_batch₁| = P₀(x₁) + vP₁(x₁) + v²P₂(x₁)
-        // |opening_batch₂| = P₀(x₂) + vP₁(x₂) + v²P₂(x₂) + v³P₃(x₂)
-        // |opening_batch₃| = P₃(x₃)
-        // |opening_batch₄| = P₄(x₄)
-        opening_batch *= v;
-        opening_batch += poly_openings.openings[0];
-        // |commitment_batch₀| = C₀ + vC₁ + v²C₂
-        // |commitment_batch₁| = C₀ + vC₁ + v²C₂
-        // |commitment_batch₂| = C₀ + vC₁ + v²C₂ + v³C₃
-        // |commitment_batch₃| = C₃
-        // |commitment_batch₄| = C₄
-        commitment_batch *= v;
-        commitment_batch += *poly_openings.poly_oracle;
-      }
-
       // |commitment_multi| = Cₘᵤₗₜ = C₀ + vC₁ + v²C₂ +
       //                              u(C₀ + vC₁ + v²C₂) +
       //                              u²(C₀ + vC₁ + v²C₂ + v³C₃) +
       //                              u³C₃ +
       //                              u⁴C₄
-      commitment_batch *= power_of_u;
-      commitment_multi += commitment_batch;
       // |opening_multi| = Oₘᵤₗₜ = P₀(x₀) + vP₁(x₀) + v²P₂(x₀) +
       //                           u(P₀(x₁) + vP₁(x₁) + v²P₂(x₁)) +
       //                           u²(P₀(x₂) + vP₁(x₂) + v²P₂(x₂) + v³P₃(x₂)) +
       //                           u³P₃(x₃) +
       //                           u⁴P₄(x₄)
-      opening_batch *= power_of_u;
-      opening_multi += opening_batch;
-
-      // clang-format off
-      // |witness_with_aux| = Wₐᵤₓ = x₀[W₀(τ)]₁ + ux₁[W₁(τ)]₁ + u²x₂[W₂(τ)]₁ + u³x₃[W₃(τ)]₁ + u⁴x₄[W₄(τ)]₁
-      // clang-format on
-      witness_with_aux +=
-          power_of_u * grouped_poly_openings_vec[i].points[0] * commitments[i];
-      // clang-format off
-      // |witness| = W = [W₀(τ)]₁ + u[W₁(τ)]₁ + u²[W₂(τ)]₁ + u³[W₃(τ)]₁ + u⁴[W₄(τ)]₁
-      // clang-format on
-      witness += power_of_u * commitments[i];
+      Field scalar = power_of_u;
+      for (const PolynomialOpenings<Poly, Commitment>& poly_openings :
+           poly_openings_vec) {
+        combinations.Add(1, scalar, *poly_openings.poly_oracle);
+        opening_multi += scalar * poly_openings.openings[0];
+        scalar *= v;
+      }
 
       power_of_u *= u;
     }
+    combinations.AddGenerator(1, -opening_multi);
     // clang-format off
     // e(W, [τ]₂) * e(Wₐᵤₓ + Cₘᵤₗₜ - [Oₘᵤₗₜ]₁, [-1]₂) ≟ gᴛ⁰
     // τ(W₀(τ) + uW₁(τ) + u²W₂(τ) + u³W₃(τ) + u⁴W₄(τ)) - x₀W₀(τ) - ux₁W₁(τ) - u²x₂W₂(τ) - u³x₃W₃(τ) - u⁴x₄W₄(τ) -
@@ -219,13 +158,80 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
     // (τ - x₀)W₀(τ) + u(τ - x₁)W₁(τ) + u²(τ - x₂)W₂(τ) + u³(τ - x₃)W₃(τ) + u⁴(τ - x₄)W₄(τ) -
     // H₀(τ) - uH₁(τ) - u²H₂(τ) - u³H₃(τ) - u⁴H₄(τ) ≟ 0
     // clang-format on
-    G1JacobianPoint g1_jacobian_arr[] = {
-        witness, (witness_with_aux + commitment_multi -
-                  opening_multi * G1JacobianPoint::Generator())};
-    G1Point g1_arr[2];
-    if (!G1JacobianPoint::BatchNormalize(g1_jacobian_arr, &g1_arr))
+    return combinations.Evaluate(pairing_points);
+  }
+
+  // Runs the pairing checks of |pairing_points_vec| populated by
+  // |ComputePairingPoints()| at once. See |BatchCheckPairingPoints()|.
+  [[nodiscard]] bool BatchVerifyPairingPoints(
+      absl::Span<const PairingPoints> pairing_points_vec) const {
+    return BatchCheckPairingPoints<Curve>(pairing_points_vec, g2_arr_);
+  }
+
+ private:
+  friend class VectorCommitmentScheme<GWC<Curve, MaxDegree, Commitment>>;
+  friend class UnivariatePolynomialCommitmentScheme<
+      GWC<Curve, MaxDegree, Commitment>>;
+  template <typename, size_t, size_t, typename>
+  friend class zk::GWCExtension;
+  FRIEND_TEST(GWCTest, Copyable);
+
+  const char* Name() const { return "GWC"; }
+
+  // UnivariatePolynomialCommitmentScheme methods
+  template <typename Container>
+  [[nodiscard]] bool DoCreateOpeningProof(
+      const Container& poly_openings, TranscriptWriter<Commitment>* writer) {
+    Field v = writer->SqueezeChallenge();
+    VLOG(2) << "GWC(v): " << v.ToHexString(true);
+
+    PolynomialOpeningGrouper<Poly> grouper;
+    grouper.GroupBySinglePoint(poly_openings);
+
+    // Group |poly_openings| to |grouped_poly_openings_vec|.
+    // {x₀, [P₀, P₁, P₂]}
+    // {x₁, [P₀, P₁, P₂]}
+    // {x₂, [P₀, P₁, P₂, P₃]}
+    // {x₃, [P₃]}
+    // {x₄, [P₄]}
+    const std::vector<GroupedPolynomialOpenings<Poly>>&
+        grouped_poly_openings_vec = grouper.grouped_poly_openings_vec();
+
+    this->SetBatchMode(grouped_poly_openings_vec.size());
+    std::vector<Poly> ws;
+    ws.reserve(grouped_poly_openings_vec.size());
+    for (size_t i = 0; i < grouped_poly_openings_vec.size(); ++i) {
+      // clang-format off
+      // W₀(X) = H₀(X) / (X - x₀) = (P₀(X) - P₀(x₀)) + v(P₁(X) - P₁(x₀)) + v²(P₂(X) - P₂(x₀)) / (X - x₀)
+      // W₁(X) = H₁(X) / (X - x₁) = (P₀(X) - P₀(x₁)) + v(P₁(X) - P₁(x₁)) + v²(P₂(X) - P₂(x₁)) / (X - x₁)
+      // W₂(X) = H₂(X) / (X - x₂) = (P₀(X) - P₀(x₂)) + v(P₁(X) - P₁(x₂)) + v²(P₂(X) - P₂(x₂)) + v³(P₃(X) - P₃(x₂)) / (X - x₂)
+      // W₃(X) = H₃(X) / (X - x₃) = (P₃(X) - P₃(x₃)) / (X - x₃)
+      // W₄(X) = H₄(X) / (X - x₄) = (P₄(X) - P₄(x₄)) / (X - x₄)
+      // clang-format on
+      std::vector<Poly> low_degree_extensions;
+      ws.push_back(
+          grouped_poly_openings_vec[i].CreateCombinedLowDegreeExtensions(
+              v, low_degree_extensions));
+    }
+    // Commit all the Wᵢ(X).
+    std::vector<const Poly*> w_ptrs =
+        base::Map(ws, [](const Poly& w) { return &w; });
+    if (!this->BatchCommit(w_ptrs, 0)) return false;
+    std::vector<Commitment> commitments = this->GetBatchCommitments();
+    for (const Commitment& commitment : commitments) {
+      if (!writer->WriteToProof(commitment)) return false;
+    }
+    return true;
+  }
+
+  template <typename Container>
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Container& poly_openings,
+      TranscriptReader<Commitment>* reader) const {
+    PairingPoints pairing_points;
+    if (!ComputePairingPoints(poly_openings, reader, &pairing_points))
       return false;
-    return math::Pairing<Curve>(g1_arr, g2_arr_).IsOne();
+    return math::Pairing<Curve>(pairing_points, g2_arr_).IsOne();
   }
 
   // KZGFamily methods
@@ -14,6 +14,10 @@ class GWCTest : public KZGFamilyTest<PCS> {};
 
 TEST_F(GWCTest, CreateAndVerifyProof) { this->CreateAndVerifyProof(); }
 
+TEST_F(GWCTest, BatchVerifyPairingPoints) {
+  this->BatchVerifyPairingPoints();
+}
+
 TEST_F(GWCTest, Copyable) { this->Copyable(); }
 
 }  // namespace tachyon::crypto
@@ -10,15 +10,24 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/range.h"
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
+#include "tachyon/math/elliptic_curves/msm/precomputed_bases_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/polynomials/univariate/group_fft.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 
 namespace tachyon {
@@ -30,25 +39,87 @@ class KZG {
  public:
   using Field = typename G1Point::ScalarField;
   using Bucket = typename math::Pippenger<G1Point>::Bucket;
+  using PrecomputedMSM = math::PrecomputedBasesMSM<G1Point>;
 
   static constexpr size_t kMaxDegree = MaxDegree;
+  // A run of zeros is skipped by |Commit()| and |CommitLagrange()| if it is at
+  // least 1/|kMinSkippedZerosRatio| of the scalars.
+  static constexpr size_t kMinSkippedZerosRatio = 8;
 
   KZG() = default;
 
   KZG(std::vector<G1Point>&& g1_powers_of_tau,
       std::vector<G1Point>&& g1_powers_of_tau_lagrange)
-      : g1_powers_of_tau_(std::move(g1_powers_of_tau)),
-        g1_powers_of_tau_lagrange_(std::move(g1_powers_of_tau_lagrange)) {
-    CHECK_EQ(g1_powers_of_tau_.size(), g1_powers_of_tau_lagrange_.size());
-    CHECK_LE(g1_powers_of_tau_.size(), kMaxDegree + 1);
+      : srs_(std::make_shared<SRS>()) {
+    srs_->g1_powers_of_tau = std::move(g1_powers_of_tau);
+    srs_->g1_powers_of_tau_lagrange = std::move(g1_powers_of_tau_lagrange);
+    CHECK_EQ(srs_->g1_powers_of_tau.size(),
+             srs_->g1_powers_of_tau_lagrange.size());
+    CHECK_LE(srs_->g1_powers_of_tau.size(), kMaxDegree + 1);
+  }
+  KZG(const KZG& other) = default;
+  KZG& operator=(const KZG& other) = default;
+  // NOTE: |other| is left with an empty SRS rather than none, like the moved
+  // vectors were.
+  KZG(KZG&& other)
+      : srs_(std::exchange(other.srs_, std::make_shared<SRS>())),
+        batch_commitments_(std::move(other.batch_commitments_)) {}
+  KZG& operator=(KZG&& other) {
+    srs_ = std::exchange(other.srs_, std::make_shared<SRS>());
+    batch_commitments_ = std::move(other.batch_commitments_);
+    return *this;
   }
 
   const std::vector<G1Point>& g1_powers_of_tau() const {
-    return g1_powers_of_tau_;
+    return srs_->g1_powers_of_tau;
   }
 
   const std::vector<G1Point>& g1_powers_of_tau_lagrange() const {
-    return g1_powers_of_tau_lagrange_;
+    return srs_->g1_powers_of_tau_lagrange;
+  }
+
+  const PrecomputedMSM& precomputed_g1_powers_of_tau() const {
+    return srs_->precomputed_g1_powers_of_tau;
+  }
+
+  const PrecomputedMSM& precomputed_g1_powers_of_tau_lagrange() const {
+    return srs_->precomputed_g1_powers_of_tau_lagrange;
+  }
+
+  bool IsPrecomputed() const {
+    return srs_->precomputed_g1_powers_of_tau.size() != 0;
+  }
+
+  // Returns true if the SRS is shared with another copy of |KZG|.
+  bool IsSRSShared() const { return srs_.use_count() > 1; }
+
+  // Builds the tables of |math::PrecomputedBasesMSM| from the SRS, after which
+  // |Commit()| and |CommitLagrange()| use them instead of a variable-base MSM.
+  // Each table takes |precompute_factor| times as much memory as the SRS.
+  [[nodiscard]] bool Precompute(
+      size_t precompute_factor = PrecomputedMSM::kDefaultPrecomputeFactor) {
+    SRS& srs = GetMutableSRS();
+    return srs.precomputed_g1_powers_of_tau.Precompute(srs.g1_powers_of_tau,
+                                                       precompute_factor) &&
+           srs.precomputed_g1_powers_of_tau_lagrange.Precompute(
+               srs.g1_powers_of_tau_lagrange, precompute_factor);
+  }
+
+  // Sets the tables built by |Precompute()| before, e.g., the ones read from a
+  // file using |base::Copyable|.
+  [[nodiscard]] bool SetPrecomputed(
+      PrecomputedMSM&& precomputed_g1_powers_of_tau,
+      PrecomputedMSM&& precomputed_g1_powers_of_tau_lagrange) {
+    if (precomputed_g1_powers_of_tau.size() < N() ||
+        precomputed_g1_powers_of_tau_lagrange.size() < N()) {
+      LOG(ERROR) << "Precomputed tables are smaller than the SRS";
+      return false;
+    }
+    SRS& srs = GetMutableSRS();
+    srs.precomputed_g1_powers_of_tau = std::move(precomputed_g1_powers_of_tau);
+    srs.precomputed_g1_powers_of_tau_lagrange =
+        std::move(precomputed_g1_powers_of_tau_lagrange);
+    return true;
   }
 
   void ResizeBatchCommitments(size_t size) { batch_commitments_.resize(size); }
@@ -66,7 +137,7 @@ class KZG {
     return batch_commitments;
   }
 
-  size_t N() const { return g1_powers_of_tau_.size(); }
+  size_t N() const { return srs_->g1_powers_of_tau.size(); }
 
   [[nodiscard]] bool UnsafeSetup(size_t size) {
     return UnsafeSetup(size, Field::Random());
@@ -75,85 +146,329 @@ class KZG {
   [[nodiscard]] bool UnsafeSetup(size_t size, const Field& tau) {
     using Domain = math::UnivariateEvaluationDomain<Field, kMaxDegree>;
 
-    // |g1_powers_of_tau_| = [τ⁰g₁, τ¹g₁, ... , τⁿ⁻¹g₁]
+    // The SRS is replaced as a whole, so the copies sharing the old one keep
+    // it as it is.
+    srs_ = std::make_shared<SRS>();
+
+    // |g1_powers_of_tau| = [τ⁰g₁, τ¹g₁, ... , τⁿ⁻¹g₁]
     G1Point g1 = G1Point::Generator();
     std::vector<Field> powers_of_tau = Field::GetSuccessivePowers(size, tau);
 
-    g1_powers_of_tau_.resize(size);
+    srs_->g1_powers_of_tau.resize(size);
     if (!G1Point::BatchMapScalarFieldToPoint(g1, powers_of_tau,
-                                             &g1_powers_of_tau_)) {
+                                             &srs_->g1_powers_of_tau)) {
       return false;
     }
 
-    // Get |g1_powers_of_tau_lagrange_| from τ and g₁.
+    // Get |g1_powers_of_tau_lagrange| from τ and g₁.
     std::unique_ptr<Domain> domain = Domain::Create(size);
     std::vector<Field> lagrange_coeffs =
         domain->EvaluateAllLagrangeCoefficients(tau);
 
-    g1_powers_of_tau_lagrange_.resize(size);
-    return G1Point::BatchMapScalarFieldToPoint(g1, lagrange_coeffs,
-                                               &g1_powers_of_tau_lagrange_);
+    srs_->g1_powers_of_tau_lagrange.resize(size);
+    return G1Point::BatchMapScalarFieldToPoint(
+        g1, lagrange_coeffs, &srs_->g1_powers_of_tau_lagrange);
+  }
+
+  // Sets |out| to the Lagrange SRS [L₀(τ)g₁, ..., Lₙ₋₁(τ)g₁] of the domain of
+  // size |n|. Unlike the monomial SRS, it isn't a prefix of the one of a
+  // larger domain, so it is derived from the first |n| powers of τ by
+  // |math::GroupIFFT()| and cached per size. The span stays valid as long as
+  // this SRS or a copy of it is alive. Returns false if |n| is not a power of
+  // 2 or |n| > |N()|.
+  [[nodiscard]] bool GetLagrangeSRS(size_t n,
+                                    absl::Span<const G1Point>* out) const {
+    if (n == N()) {
+      *out = absl::MakeConstSpan(srs_->g1_powers_of_tau_lagrange);
+      return true;
+    }
+    if (!base::bits::IsPowerOfTwo(n) || n > N()) {
+      LOG(ERROR) << "Invalid size of the Lagrange SRS: " << n;
+      return false;
+    }
+    return srs_->lagrange_cache->Get(
+        absl::MakeConstSpan(srs_->g1_powers_of_tau).first(n), out);
   }
 
-  // Return false if |n| >= |N()|.
+  // Returns false if |n| >= |N()| or |n| is not a power of 2.
+  // NOTE: The precomputed table of the monomial SRS is kept as it is, since it
+  // also works for a prefix of the SRS. But the one of the Lagrange SRS is
+  // cleared, since the Lagrange SRS is replaced with the one of the smaller
+  // domain.
   [[nodiscard]] bool Downsize(size_t n) {
     if (n >= N()) return false;
-    g1_powers_of_tau_.resize(n);
-    g1_powers_of_tau_lagrange_.resize(n);
+    absl::Span<const G1Point> lagrange;
+    if (!GetLagrangeSRS(n, &lagrange)) return false;
+    std::vector<G1Point> g1_powers_of_tau_lagrange(lagrange.begin(),
+                                                   lagrange.end());
+    SRS& srs = GetMutableSRS();
+    srs.g1_powers_of_tau.resize(n);
+    srs.g1_powers_of_tau_lagrange = std::move(g1_powers_of_tau_lagrange);
+    srs.precomputed_g1_powers_of_tau_lagrange = PrecomputedMSM();
     return true;
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v, Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_, v, out);
+    return DoMSM(srs_->g1_powers_of_tau, srs_->precomputed_g1_powers_of_tau, v,
+                 out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v,
                             BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_, v, state, index);
+    return DoMSM(srs_->g1_powers_of_tau, srs_->precomputed_g1_powers_of_tau, v,
+                 state, index);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, out);
+    return DoMSM(srs_->g1_powers_of_tau_lagrange,
+                 srs_->precomputed_g1_powers_of_tau_lagrange, v, out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, state, index);
+    return DoMSM(srs_->g1_powers_of_tau_lagrange,
+                 srs_->precomputed_g1_powers_of_tau_lagrange, v, state, index);
+  }
+
+  // Commits to each of |scalars_list| and stores the commitments in
+  // |batch_commitments_| from |index|. Unlike calling |Commit()| for each of
+  // them, the SRS is loaded once for all the commitments.
+  [[nodiscard]] bool BatchCommit(
+      absl::Span<const absl::Span<const Field>> scalars_list,
+      BatchCommitmentState& state, size_t index) {
+    return DoBatchMSM(srs_->g1_powers_of_tau,
+                      srs_->precomputed_g1_powers_of_tau, scalars_list, state,
+                      index);
+  }
+
+  // Same as above, but commits against the Lagrange SRS.
+  [[nodiscard]] bool BatchCommitLagrange(
+      absl::Span<const absl::Span<const Field>> scalars_list,
+      BatchCommitmentState& state, size_t index) {
+    return DoBatchMSM(srs_->g1_powers_of_tau_lagrange,
+                      srs_->precomputed_g1_powers_of_tau_lagrange,
+                      scalars_list, state, index);
+  }
+
+  // Populates |out| with the commitment of the evaluations that differ from
+  // the ones of |commitment| by |deltas| at |rows|:
+  //   |out| = |commitment| + Σᵢ |deltas[i]|·[L_{rows[i]}(τ)]₁
+  // by the additive homomorphism. Since the MSM runs over |rows| only, it is
+  // preferred to |CommitLagrange()| when a few rows are changed.
+  [[nodiscard]] bool UpdateLagrange(const Commitment& commitment,
+                                    absl::Span<const size_t> rows,
+                                    absl::Span<const Field> deltas,
+                                    Commitment* out) const {
+    Bucket result;
+    if (!RunUpdateLagrange(commitment, rows, deltas, &result)) return false;
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      *out = std::move(result);
+    } else {
+      *out = math::ConvertPoint<Commitment>(result);
+    }
+    return true;
+  }
+
+  // Same as above, but stores the commitment in |batch_commitments_| at
+  // |index|.
+  [[nodiscard]] bool UpdateLagrange(const Commitment& commitment,
+                                    absl::Span<const size_t> rows,
+                                    absl::Span<const Field> deltas,
+                                    BatchCommitmentState& state, size_t index) {
+    return RunUpdateLagrange(commitment, rows, deltas,
+                             &batch_commitments_[index]);
   }
 
  private:
+  // The Lagrange SRS of the smaller domains derived by |GetLagrangeSRS()|.
+  class LagrangeCache {
+   public:
+    bool Get(absl::Span<const G1Point> g1_powers_of_tau,
+             absl::Span<const G1Point>* out) {
+      absl::MutexLock lock(&mu_);
+      auto it = lagrange_srs_map_.find(g1_powers_of_tau.size());
+      if (it == lagrange_srs_map_.end()) {
+        std::vector<G1Point> lagrange_srs;
+        if (!math::GroupIFFT(g1_powers_of_tau, &lagrange_srs)) return false;
+        it = lagrange_srs_map_
+                 .emplace(g1_powers_of_tau.size(), std::move(lagrange_srs))
+                 .first;
+      }
+      *out = absl::MakeConstSpan(it->second);
+      return true;
+    }
+
+   private:
+    absl::Mutex mu_;
+    // NOTE: The vectors are never moved once inserted, so the spans returned
+    // by |Get()| stay valid.
+    std::map<size_t, std::vector<G1Point>> lagrange_srs_map_
+        ABSL_GUARDED_BY(mu_);
+  };
+
+  // NOTE: The SRS is shared by the copies of |KZG|, e.g, the PCS of the provers
+  // proving the same circuit concurrently, since it is never modified once set
+  // up. The methods that modify it copy it first if it is shared.
+  struct SRS {
+    std::vector<G1Point> g1_powers_of_tau;
+    std::vector<G1Point> g1_powers_of_tau_lagrange;
+    // Empty unless |Precompute()| or |SetPrecomputed()| is called.
+    PrecomputedMSM precomputed_g1_powers_of_tau;
+    PrecomputedMSM precomputed_g1_powers_of_tau_lagrange;
+    // NOTE: It is shared by the copies of the SRS, since |Downsize()| keeps a
+    // prefix of |g1_powers_of_tau|, from which the cached ones are derived.
+    std::shared_ptr<LagrangeCache> lagrange_cache =
+        std::make_shared<LagrangeCache>();
+  };
+
+  SRS& GetMutableSRS() {
+    if (IsSRSShared()) srs_ = std::make_shared<SRS>(*srs_);
+    return *srs_;
+  }
+
   template <typename BaseContainer, typename ScalarContainer>
-  static bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
-                    Commitment* out) {
-    math::VariableBaseMSM<G1Point> msm;
-    absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
-        bases.data(), std::min(bases.size(), scalars.size()));
+  static bool DoMSM(const BaseContainer& bases,
+                    const PrecomputedMSM& precomputed,
+                    const ScalarContainer& scalars, Commitment* out) {
     if constexpr (std::is_same_v<Commitment, Bucket>) {
-      return msm.Run(bases_span, scalars, out);
+      return RunMSM(bases, precomputed, scalars, out);
     } else {
       Bucket result;
-      if (!msm.Run(bases_span, scalars, &result)) return false;
+      if (!RunMSM(bases, precomputed, scalars, &result)) return false;
       *out = math::ConvertPoint<Commitment>(result);
       return true;
     }
   }
 
   template <typename BaseContainer, typename ScalarContainer>
-  bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
-             BatchCommitmentState& state, size_t index) {
+  bool DoMSM(const BaseContainer& bases, const PrecomputedMSM& precomputed,
+             const ScalarContainer& scalars, BatchCommitmentState& state,
+             size_t index) {
+    return RunMSM(bases, precomputed, scalars, &batch_commitments_[index]);
+  }
+
+  bool DoBatchMSM(const std::vector<G1Point>& bases,
+                  const PrecomputedMSM& precomputed,
+                  absl::Span<const absl::Span<const Field>> scalars_list,
+                  BatchCommitmentState& state, size_t index) {
+    if (index + scalars_list.size() > batch_commitments_.size()) {
+      LOG(ERROR) << "Too many commitments: " << index + scalars_list.size()
+                 << " > " << batch_commitments_.size();
+      return false;
+    }
+    // NOTE: The precomputed tables already take fewer windows than a batch of
+    // variable-base MSMs, so they are used one by one.
+    if (precomputed.size() != 0) {
+      for (size_t i = 0; i < scalars_list.size(); ++i) {
+        if (!precomputed.Run(scalars_list[i], &batch_commitments_[index + i])) {
+          return false;
+        }
+      }
+      return true;
+    }
+    size_t size = 0;
+    for (absl::Span<const Field> scalars : scalars_list) {
+      size = std::max(size, scalars.size());
+    }
+    math::VariableBaseMSM<G1Point> msm;
+    absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
+        bases.data(), std::min(bases.size(), size));
+    std::vector<Bucket> results;
+    if (!msm.RunBatch(bases_span, scalars_list, &results)) return false;
+    std::move(results.begin(), results.end(),
+              batch_commitments_.begin() + index);
+    return true;
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  static bool RunMSM(const BaseContainer& bases,
+                     const PrecomputedMSM& precomputed,
+                     const ScalarContainer& scalars, Bucket* out) {
+    if (precomputed.size() != 0) {
+      return precomputed.Run(scalars, out);
+    }
     math::VariableBaseMSM<G1Point> msm;
     absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
         bases.data(), std::min(bases.size(), scalars.size()));
-    return msm.Run(bases_span, scalars, &batch_commitments_[index]);
+    if (bases_span.size() != scalars.size()) {
+      return msm.Run(bases_span, scalars, out);
+    }
+
+    // NOTE: The zeros add nothing to the buckets, but they still cost the
+    // digits of every window, so a long run of them, e.g., the rows of a
+    // column that a circuit doesn't use, is skipped by running the MSMs of
+    // the scalars around it instead.
+    absl::Span<const Field> scalars_span = absl::MakeConstSpan(scalars);
+    base::Range<size_t> zeros = FindLongestZeroRun(scalars_span);
+    if (zeros.GetSize() * kMinSkippedZerosRatio < scalars_span.size()) {
+      return msm.Run(bases_span, scalars_span, out);
+    }
+    *out = Bucket::Zero();
+    if (zeros.from != 0 && !msm.Run(bases_span.first(zeros.from),
+                                    scalars_span.first(zeros.from), out)) {
+      return false;
+    }
+    if (zeros.to != scalars_span.size()) {
+      Bucket rest;
+      if (!msm.Run(bases_span.subspan(zeros.to),
+                   scalars_span.subspan(zeros.to), &rest)) {
+        return false;
+      }
+      *out += rest;
+    }
+    return true;
+  }
+
+  bool RunUpdateLagrange(const Commitment& commitment,
+                         absl::Span<const size_t> rows,
+                         absl::Span<const Field> deltas, Bucket* out) const {
+    if (rows.size() != deltas.size()) {
+      LOG(ERROR) << "The sizes of the rows and the deltas don't match: "
+                 << rows.size() << " vs " << deltas.size();
+      return false;
+    }
+    const std::vector<G1Point>& lagrange = srs_->g1_powers_of_tau_lagrange;
+    std::vector<G1Point> bases(rows.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+      if (rows[i] >= lagrange.size()) {
+        LOG(ERROR) << "Invalid row: " << rows[i];
+        return false;
+      }
+      bases[i] = lagrange[rows[i]];
+    }
+    if (bases.empty()) {
+      *out = Bucket::Zero();
+    } else {
+      math::VariableBaseMSM<G1Point> msm;
+      if (!msm.Run(bases, deltas, out)) return false;
+    }
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      *out += commitment;
+    } else {
+      *out += math::ConvertPoint<Bucket>(commitment);
+    }
+    return true;
+  }
+
+  // Returns the longest run of zeros in |scalars|.
+  static base::Range<size_t> FindLongestZeroRun(
+      absl::Span<const Field> scalars) {
+    base::Range<size_t> longest(0, 0);
+    size_t from = 0;
+    for (size_t i = 0; i <= scalars.size(); ++i) {
+      if (i < scalars.size() && scalars[i].IsZero()) continue;
+      if (i - from > longest.GetSize()) longest = base::Range<size_t>(from, i);
+      from = i + 1;
+    }
+    return longest;
   }
 
-  std::vector<G1Point> g1_powers_of_tau_;
-  std::vector<G1Point> g1_powers_of_tau_lagrange_;
+  std::shared_ptr<SRS> srs_ = std::make_shared<SRS>();
   std::vector<Bucket> batch_commitments_;
 };
 
@@ -10,7 +10,11 @@
 #include <stddef.h>
 
 #include <utility>
+#include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/kzg/kzg.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -38,6 +42,11 @@ class KZGFamily {
     return kzg_.UnsafeSetup(size, tau) && DoUnsafeSetupWithTau(size, tau);
   }
 
+  // See |KZG::Precompute()|.
+  [[nodiscard]] bool Precompute(size_t precompute_factor) {
+    return kzg_.Precompute(precompute_factor);
+  }
+
   template <typename ScalarContainer>
   [[nodiscard]] bool DoCommit(const ScalarContainer& poly,
                               Commitment* commitment) const {
@@ -87,6 +96,52 @@ class KZGFamily {
     return kzg_.CommitLagrange(evals.evaluations(), state, index);
   }
 
+  [[nodiscard]] bool DoBatchCommit(
+      absl::Span<const math::UnivariateDensePolynomial<F, MaxDegree>* const>
+          polys,
+      BatchCommitmentState& state, size_t index) {
+    std::vector<absl::Span<const F>> scalars_list = base::Map(
+        polys,
+        [](const math::UnivariateDensePolynomial<F, MaxDegree>* poly) {
+          return absl::MakeConstSpan(poly->coefficients().coefficients());
+        });
+    return kzg_.BatchCommit(scalars_list, state, index);
+  }
+
+  // Same as above, but commits to the views of the coefficients, e.g., the
+  // pieces of a polynomial that is longer than the SRS.
+  [[nodiscard]] bool DoBatchCommit(
+      absl::Span<const absl::Span<const F>> scalars_list,
+      BatchCommitmentState& state, size_t index) {
+    return kzg_.BatchCommit(scalars_list, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommitLagrange(
+      absl::Span<const math::UnivariateEvaluations<F, MaxDegree>* const>
+          evals_list,
+      BatchCommitmentState& state, size_t index) {
+    std::vector<absl::Span<const F>> scalars_list = base::Map(
+        evals_list, [](const math::UnivariateEvaluations<F, MaxDegree>* evals) {
+          return absl::MakeConstSpan(evals->evaluations());
+        });
+    return kzg_.BatchCommitLagrange(scalars_list, state, index);
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const F> deltas,
+                                      Commitment* out) const {
+    return kzg_.UpdateLagrange(commitment, rows, deltas, out);
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const F> deltas,
+                                      BatchCommitmentState& state,
+                                      size_t index) {
+    return kzg_.UpdateLagrange(commitment, rows, deltas, state, index);
+  }
+
  protected:
   [[nodiscard]] virtual bool DoUnsafeSetupWithTau(size_t size,
                                                   const F& tau) = 0;
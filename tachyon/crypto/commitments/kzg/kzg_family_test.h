@@ -60,6 +60,38 @@ class KZGFamilyTest : public testing::Test {
     EXPECT_TRUE((pcs_.VerifyOpeningProof(verifier_openings, &reader)));
   }
 
+  void BatchVerifyPairingPoints() {
+    using PairingPoints = typename PCS::PairingPoints;
+
+    OwnedPolynomialOpenings<Poly, Commitment> owned_openings;
+    std::string error;
+    ASSERT_TRUE(
+        LoadAndParseJson(base::FilePath("tachyon/crypto/commitments/test/"
+                                        "bn254_kzg_polynomial_openings.json"),
+                         &owned_openings, &error));
+    ASSERT_TRUE(error.empty());
+
+    SimpleTranscriptWriter<Commitment> writer((base::Uint8VectorBuffer()));
+    std::vector<PolynomialOpening<Poly>> prover_openings =
+        owned_openings.CreateProverOpenings();
+    ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings, &writer));
+
+    std::vector<PolynomialOpening<Poly, Commitment>> verifier_openings =
+        owned_openings.CreateVerifierOpenings();
+    std::vector<PairingPoints> pairing_points_vec(3);
+    for (PairingPoints& pairing_points : pairing_points_vec) {
+      base::Buffer read_buf(writer.buffer().buffer(),
+                            writer.buffer().buffer_len());
+      SimpleTranscriptReader<Commitment> reader(std::move(read_buf));
+      ASSERT_TRUE(pcs_.ComputePairingPoints(verifier_openings, &reader,
+                                            &pairing_points));
+    }
+    EXPECT_TRUE(pcs_.BatchVerifyPairingPoints(pairing_points_vec));
+
+    pairing_points_vec[1][0] = math::bn254::G1AffinePoint::Generator();
+    EXPECT_FALSE(pcs_.BatchVerifyPairingPoints(pairing_points_vec));
+  }
+
   void Copyable() {
     base::Uint8VectorBuffer write_buf;
     ASSERT_TRUE(write_buf.Grow(base::EstimateSize(pcs_)));
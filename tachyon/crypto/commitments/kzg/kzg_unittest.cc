@@ -1,8 +1,12 @@
 #include "tachyon/crypto/commitments/kzg/kzg.h"
 
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
 
@@ -90,12 +94,202 @@ TEST_F(KZGTest, BatchCommitLagrange) {
   EXPECT_EQ(batch_commitments, batch_commitments_lagrange);
 }
 
-TEST_F(KZGTest, Downsize) {
+TEST_F(KZGTest, BatchCommit) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  size_t num_polys = 10;
+  std::vector<Poly> polys =
+      base::CreateVector(num_polys, []() { return Poly::Random(N - 1); });
+  std::vector<absl::Span<const math::bn254::Fr>> scalars_list =
+      base::Map(polys, [](const Poly& poly) {
+        return absl::MakeConstSpan(poly.coefficients().coefficients());
+      });
+
+  BatchCommitmentState state(true, num_polys);
+  pcs.ResizeBatchCommitments(num_polys);
+  for (size_t i = 0; i < num_polys; ++i) {
+    ASSERT_TRUE(pcs.Commit(polys[i].coefficients().coefficients(), state, i));
+  }
+  std::vector<math::bn254::G1AffinePoint> expected =
+      pcs.GetBatchCommitments(state);
+
+  state.batch_mode = true;
+  state.batch_count = num_polys;
+  pcs.ResizeBatchCommitments(num_polys);
+  // Commits the first half and the second half in two batches.
+  absl::Span<const absl::Span<const math::bn254::Fr>> scalars_list_span =
+      scalars_list;
+  ASSERT_TRUE(pcs.BatchCommit(scalars_list_span.subspan(0, num_polys / 2),
+                              state, 0));
+  ASSERT_TRUE(pcs.BatchCommit(scalars_list_span.subspan(num_polys / 2), state,
+                              num_polys / 2));
+  EXPECT_FALSE(pcs.BatchCommit(scalars_list_span, state, 1));
+  std::vector<math::bn254::G1AffinePoint> batch_commitments =
+      pcs.GetBatchCommitments(state);
+  EXPECT_EQ(batch_commitments, expected);
+
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  std::vector<Evals> poly_evals = base::Map(
+      polys, [&domain](const Poly& poly) { return domain->FFT(poly); });
+  std::vector<absl::Span<const math::bn254::Fr>> evals_list =
+      base::Map(poly_evals, [](const Evals& evals) {
+        return absl::MakeConstSpan(evals.evaluations());
+      });
+
+  state.batch_mode = true;
+  state.batch_count = num_polys;
+  pcs.ResizeBatchCommitments(num_polys);
+  ASSERT_TRUE(pcs.BatchCommitLagrange(evals_list, state, 0));
+  std::vector<math::bn254::G1AffinePoint> batch_commitments_lagrange =
+      pcs.GetBatchCommitments(state);
+  EXPECT_EQ(batch_commitments_lagrange, expected);
+}
+
+TEST_F(KZGTest, CommitWithPrecompute) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  Poly poly = Poly::Random(N - 1);
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  Evals poly_evals = domain->FFT(poly);
+
+  math::bn254::G1AffinePoint expected;
+  ASSERT_TRUE(pcs.Commit(poly.coefficients().coefficients(), &expected));
+
+  ASSERT_FALSE(pcs.IsPrecomputed());
+  ASSERT_TRUE(pcs.Precompute());
+  ASSERT_TRUE(pcs.IsPrecomputed());
+
+  math::bn254::G1AffinePoint commit;
+  ASSERT_TRUE(pcs.Commit(poly.coefficients().coefficients(), &commit));
+  EXPECT_EQ(commit, expected);
+
+  math::bn254::G1AffinePoint commit_lagrange;
+  ASSERT_TRUE(pcs.CommitLagrange(poly_evals.evaluations(), &commit_lagrange));
+  EXPECT_EQ(commit_lagrange, expected);
+}
+
+TEST_F(KZGTest, CommitLagrangeWithZeros) {
   PCS pcs;
   ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  // The zeros are in the middle, at the front and at the back of the scalars.
+  std::vector<std::vector<uint64_t>> values_list = {
+      {1, 2, 0, 0, 0, 0, 3, 4},
+      {0, 0, 0, 0, 0, 1, 2, 3},
+      {1, 2, 3, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0},
+  };
+  for (const std::vector<uint64_t>& values : values_list) {
+    std::vector<math::bn254::Fr> scalars = base::Map(
+        values, [](uint64_t value) { return math::bn254::Fr(value); });
+    math::VariableBaseMSM<math::bn254::G1AffinePoint> msm;
+    math::VariableBaseMSM<math::bn254::G1AffinePoint>::Bucket bucket;
+    ASSERT_TRUE(msm.Run(pcs.g1_powers_of_tau_lagrange(), scalars, &bucket));
+    math::bn254::G1AffinePoint expected = bucket.ToAffine();
+
+    math::bn254::G1AffinePoint commit;
+    ASSERT_TRUE(pcs.CommitLagrange(scalars, &commit));
+    EXPECT_EQ(commit, expected);
+  }
+}
+
+TEST_F(KZGTest, UpdateLagrange) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  std::vector<math::bn254::Fr> scalars =
+      base::CreateVector(N, []() { return math::bn254::Fr::Random(); });
+  math::bn254::G1AffinePoint commit;
+  ASSERT_TRUE(pcs.CommitLagrange(scalars, &commit));
+
+  std::vector<size_t> rows = {1, 5};
+  std::vector<math::bn254::Fr> deltas = {math::bn254::Fr::Random(),
+                                         math::bn254::Fr::Random()};
+  for (size_t i = 0; i < rows.size(); ++i) {
+    scalars[rows[i]] += deltas[i];
+  }
+  math::bn254::G1AffinePoint expected;
+  ASSERT_TRUE(pcs.CommitLagrange(scalars, &expected));
+
+  math::bn254::G1AffinePoint updated;
+  ASSERT_TRUE(pcs.UpdateLagrange(commit, rows, deltas, &updated));
+  EXPECT_EQ(updated, expected);
+
+  ASSERT_TRUE(pcs.UpdateLagrange(commit, {}, {}, &updated));
+  EXPECT_EQ(updated, commit);
+
+  std::vector<size_t> invalid_rows = {N};
+  EXPECT_FALSE(pcs.UpdateLagrange(commit, invalid_rows,
+                                  absl::MakeConstSpan(deltas).first(1),
+                                  &updated));
+  EXPECT_FALSE(pcs.UpdateLagrange(commit, rows,
+                                  absl::MakeConstSpan(deltas).first(1),
+                                  &updated));
+}
+
+TEST_F(KZGTest, Downsize) {
+  math::bn254::Fr tau = math::bn254::Fr::Random();
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N, tau));
   ASSERT_FALSE(pcs.Downsize(N));
+  ASSERT_FALSE(pcs.Downsize(N / 2 + 1));
   ASSERT_TRUE(pcs.Downsize(N / 2));
   EXPECT_EQ(pcs.N(), N / 2);
+
+  PCS expected;
+  ASSERT_TRUE(expected.UnsafeSetup(N / 2, tau));
+  EXPECT_EQ(pcs.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  EXPECT_EQ(pcs.g1_powers_of_tau_lagrange(),
+            expected.g1_powers_of_tau_lagrange());
+}
+
+TEST_F(KZGTest, GetLagrangeSRS) {
+  math::bn254::Fr tau = math::bn254::Fr::Random();
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N, tau));
+
+  absl::Span<const math::bn254::G1AffinePoint> lagrange;
+  ASSERT_FALSE(pcs.GetLagrangeSRS(N * 2, &lagrange));
+  ASSERT_FALSE(pcs.GetLagrangeSRS(N / 2 + 1, &lagrange));
+  ASSERT_TRUE(pcs.GetLagrangeSRS(N, &lagrange));
+  EXPECT_EQ(lagrange.data(), pcs.g1_powers_of_tau_lagrange().data());
+
+  for (size_t n = 2; n < N; n *= 2) {
+    SCOPED_TRACE(n);
+    PCS expected;
+    ASSERT_TRUE(expected.UnsafeSetup(n, tau));
+    ASSERT_TRUE(pcs.GetLagrangeSRS(n, &lagrange));
+    EXPECT_EQ(std::vector<math::bn254::G1AffinePoint>(lagrange.begin(),
+                                                      lagrange.end()),
+              expected.g1_powers_of_tau_lagrange());
+
+    // The second call returns the cached one.
+    absl::Span<const math::bn254::G1AffinePoint> cached;
+    ASSERT_TRUE(pcs.GetLagrangeSRS(n, &cached));
+    EXPECT_EQ(cached.data(), lagrange.data());
+  }
+}
+
+TEST_F(KZGTest, ShareSRS) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+  EXPECT_FALSE(pcs.IsSRSShared());
+
+  PCS copy = pcs;
+  EXPECT_TRUE(pcs.IsSRSShared());
+  EXPECT_EQ(copy.g1_powers_of_tau().data(), pcs.g1_powers_of_tau().data());
+
+  // Modifying the copy doesn't affect the original.
+  ASSERT_TRUE(copy.Downsize(N / 2));
+  EXPECT_FALSE(pcs.IsSRSShared());
+  EXPECT_EQ(copy.N(), N / 2);
+  EXPECT_EQ(pcs.N(), N);
+
+  PCS moved = std::move(pcs);
+  EXPECT_EQ(moved.N(), N);
+  EXPECT_EQ(pcs.N(), size_t{0});
 }
 
 TEST_F(KZGTest, Copyable) {
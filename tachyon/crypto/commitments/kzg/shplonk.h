@@ -14,11 +14,14 @@
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/containers/contains.h"
+#include "tachyon/crypto/commitments/kzg/batch_pairing_check.h"
+#include "tachyon/crypto/commitments/kzg/g1_linear_combinations.h"
 #include "tachyon/crypto/commitments/kzg/kzg_family.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/math/elliptic_curves/pairing/pairing.h"
+#include "tachyon/math/polynomials/univariate/polynomial_arithmetic.h"
 
 namespace tachyon {
 namespace zk {
@@ -49,6 +52,9 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   using Field = typename Base::Field;
   using Poly = typename Base::Poly;
   using Point = typename Poly::Point;
+  // The G1 points of the pairing check of an opening proof, which are paired
+  // with [τ]₂ and [-1]₂ respectively.
+  using PairingPoints = std::array<G1Point, 2>;
 
   SHPlonk() = default;
   explicit SHPlonk(KZG<G1Point, MaxDegree, Commitment>&& kzg)
@@ -70,6 +76,131 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
     return this->kzg_.GetBatchCommitments(this->batch_commitment_state_);
   }
 
+  // Reads the opening proof of |poly_openings| from |reader| like
+  // |VerifyOpeningProof()| but, instead of running the pairing check,
+  // populates |pairing_points| with the G1 points of it, so that the checks
+  // of many proofs can be run at once by |BatchVerifyPairingPoints()|.
+  template <typename Container>
+  [[nodiscard]] bool ComputePairingPoints(
+      const Container& poly_openings, TranscriptReader<Commitment>* reader,
+      PairingPoints* pairing_points) const {
+    Field y = reader->SqueezeChallenge();
+    VLOG(2) << "SHPlonk(y): " << y.ToHexString(true);
+    Field v = reader->SqueezeChallenge();
+    VLOG(2) << "SHPlonk(v): " << v.ToHexString(true);
+
+    Commitment h;
+    if (!reader->ReadFromProof(&h)) return false;
+
+    Field u = reader->SqueezeChallenge();
+    VLOG(2) << "SHPlonk(u): " << u.ToHexString(true);
+
+    Commitment q;
+    if (!reader->ReadFromProof(&q)) return false;
+
+    PolynomialOpeningGrouper<Poly, Commitment> grouper;
+    grouper.GroupByPolyOracleAndPoints(poly_openings);
+
+    // Group |poly_openings| to |grouped_poly_openings_vec|.
+    // {[C₀, C₁, C₂], [x₀, x₁, x₂]}
+    // {[C₃], [x₂, x₃]}
+    // {[C₄], [x₄]}
+    const std::vector<GroupedPolynomialOpenings<Poly, Commitment>>&
+        grouped_poly_openings_vec = grouper.grouped_poly_openings_vec();
+    const absl::btree_set<Point>& super_point_set = grouper.super_point_set();
+
+    Field first_z_diff_inverse = Field::Zero();
+    Field first_z = Field::Zero();
+
+    // NOTE: p below is collected as terms over the bases Cᵢ, [H(τ)]₁, [Q(τ)]₁
+    // and G, where every [Rᵢ(u)]₁ is merged into the term of G, and computed
+    // by a single MSM.
+    G1LinearCombinations<G1Point, 1> combinations;
+    combinations.Reserve(std::size(poly_openings) + 2);
+    Field power_of_v = Field::One();
+    size_t i = 0;
+    for (const GroupedPolynomialOpenings<Poly, Commitment>&
+             grouped_poly_openings : grouped_poly_openings_vec) {
+      const std::vector<PolynomialOpenings<Poly, Commitment>>&
+          poly_openings_vec = grouped_poly_openings.poly_openings_vec;
+      const std::vector<Point>& points = grouped_poly_openings.points;
+      // |points₀| = [x₀, x₁, x₂]
+      // |points₁| = [x₂, x₃]
+      // |points₂| = [x₄]
+      // |diffs₀| = [x₃, x₄]
+      // |diffs₁| = [x₀, x₁, x₄]
+      // |diffs₂| = [x₀, x₁, x₂, x₃]
+      std::vector<Point> diffs;
+      diffs.reserve(super_point_set.size() - points.size());
+      for (const Point& point : super_point_set) {
+        if (!base::Contains(points, point)) {
+          diffs.push_back(point);
+        }
+      }
+
+      // clang-format off
+      // |normalized_z_diff₀| = Zᴛ\₀(u) / Zᴛ\₀(u) = 1
+      // |normalized_z_diff₁| = Zᴛ\₁(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₄) / (u - x₃)(u - x₄)
+      // |normalized_z_diff₂| = Zᴛ\₂(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃) / (u - x₃)(u - x₄)
+      // clang-format on
+      Point normalized_z_diff = Poly::EvaluateVanishingPolyByRoots(diffs, u);
+      if (i == 0) {
+        // Zᴛ = [x₀, x₁, x₂, x₃, x₄]
+        // |first_z| = Z₀(u) = Zᴛ(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₂)
+        first_z = Poly::EvaluateVanishingPolyByRoots(points, u);
+        // Z₀(u)⁻¹ = (u - x₃)(u - x₄)⁻¹
+        CHECK(normalized_z_diff.InverseInPlace());
+        first_z_diff_inverse = std::move(normalized_z_diff);
+        normalized_z_diff = Field::One();
+      } else {
+        normalized_z_diff *= first_z_diff_inverse;
+      }
+
+      // clang-format off
+      // |normalized_l_commitments₀| = [L₀(τ)]₁ / Zᴛ\₀(u) = (C₀ - [R₀(u)]₁) + y(C₁ - [R₁(u)]₁) + y²(C₂ - [R₂(u)]₁) * Zᴛ\₀(u) / Zᴛ\₀(u)
+      // |normalized_l_commitments₁| = [L₁(τ)]₁ / Zᴛ\₀(u) = (C₃ - [R₃(u)]₁) * Zᴛ\₁(u) / Zᴛ\₀(u)
+      // |normalized_l_commitments₂| = [L₂(τ)]₁ / Zᴛ\₀(u) = (C₄ - [R₄(u)]₁) * Zᴛ\₂(u) / Zᴛ\₀(u)
+      // clang-format on
+      // The term of [Lᵢ(τ)]₁ / Zᴛ\₀(u) in p is scaled by vⁱ.
+      Field scalar = power_of_v * normalized_z_diff;
+      for (const PolynomialOpenings<Poly, Commitment>& poly_openings :
+           poly_openings_vec) {
+        Poly r;
+        CHECK(math::LagrangeInterpolate(points, poly_openings.openings, &r));
+        combinations.Add(0, scalar, *poly_openings.poly_oracle);
+        combinations.AddGenerator(0, -(scalar * r.Evaluate(u)));
+        scalar *= y;
+      }
+      power_of_v *= v;
+      ++i;
+    }
+
+    // clang-format off
+    // |p| = ([L₀(τ)]₁ + v[L₁(τ)]₁ + v²[L₂(τ)]₁) / Zᴛ\₀(u) - Z₀(u)[H(τ)]₁ + u[Q(τ)]₁
+    // clang-format on
+    combinations.Add(0, -first_z, h);
+    combinations.Add(0, u, q);
+    std::array<G1Point, 1> p;
+    if (!combinations.Evaluate(&p)) return false;
+
+    // clang-format off
+    // e([Q(τ)]₁, [τ]₂) * e(p, [-1]₂) ≟ gᴛ⁰
+    // τ * Q(τ) - (L₀(τ) + v * L₁(τ) + v² * L₂(τ)) / Zᴛ\₀(u) + Z₀(u) * H(τ) - u * Q(τ) ≟ 0
+    // (τ - u) * Q(τ) ≟ (L₀(τ) + v * L₁(τ) + v² * L₂(τ)) / Zᴛ\₀(u) - Z₀(u) * H(τ)
+    // (τ - u) * Q(τ) ≟ (L₀(τ) + v * L₁(τ) + v² * L₂(τ) - Zᴛ(u) * H(τ)) / Zᴛ\₀(u)
+    // (τ - u) * Q(τ) * Zᴛ\₀(u) ≟ L(τ)
+    // clang-format on
+    *pairing_points = {std::move(q), std::move(p[0])};
+    return true;
+  }
+
+  // Runs the pairing checks of |pairing_points_vec| populated by
+  // |ComputePairingPoints()| at once. See |BatchCheckPairingPoints()|.
+  [[nodiscard]] bool BatchVerifyPairingPoints(
+      absl::Span<const PairingPoints> pairing_points_vec) const {
+    return BatchCheckPairingPoints<Curve>(pairing_points_vec, g2_arr_);
+  }
+
  private:
   friend class VectorCommitmentScheme<SHPlonk<Curve, MaxDegree, Commitment>>;
   friend class UnivariatePolynomialCommitmentScheme<
@@ -132,17 +263,19 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
     Field u = writer->SqueezeChallenge();
     VLOG(2) << "SHPlonk(u): " << u.ToHexString(true);
 
-    // Create [L₀(X), L₁(X), L₂(X)].
-    // clang-format off
-    // L₀(X) = Zᴛ\₀(u) * ((P₀(X) - R₀(u)) + y(P₁(X) - R₁(u)) + y²(P₂(X) - R₂(u)))
-    // L₁(X) = Zᴛ\₁(u) * (P₃(X) - R₃(u))
-    // L₂(X) = Zᴛ\₂(u) * (P₄(X) - R₄(u))
-    // clang-format on
-    Field first_z_diff;
-    std::vector<Poly> l_polys = base::Map(
+    // Zᴛ = [x₀, x₁, x₂, x₃, x₄]
+    std::vector<Field> z_t(super_point_set.begin(), super_point_set.end());
+    // Zᴛ(X) = (X - x₀)(X - x₁)(X - x₂)(X - x₃)(X - x₄)
+    // Zᴛ(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃)(u - x₄)
+    Field zt_eval = Poly::EvaluateVanishingPolyByRoots(z_t, u);
+
+    // calculate difference vanishing polynomial evaluation
+    // |z_diffs₀| = Zᴛ\₀(u) = (u - x₃)(u - x₄)
+    // |z_diffs₁| = Zᴛ\₁(u) = (u - x₀)(u - x₁)(u - x₄)
+    // |z_diffs₂| = Zᴛ\₂(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃)
+    std::vector<Field> z_diffs = base::Map(
         grouped_poly_openings_vec,
-        [&y, &u, &first_z_diff, &low_degree_extensions_vec, &super_point_set](
-            size_t i,
+        [&u, &super_point_set](
             const GroupedPolynomialOpenings<Poly>& grouped_poly_openings) {
           std::vector<Point> diffs;
           diffs.reserve(super_point_set.size() -
@@ -152,72 +285,57 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
               diffs.push_back(point);
             }
           }
-          // calculate difference vanishing polynomial evaluation
-          // |z_diff₀| = Zᴛ\₀(u) = (u - x₃)(u - x₄)
-          // |z_diff₁| = Zᴛ\₁(u) = (u - x₀)(u - x₁)(u - x₄)
-          // |z_diff₂| = Zᴛ\₂(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃)
-          Field z_diff = Poly::EvaluateVanishingPolyByRoots(diffs, u);
-          if (i == 0) {
-            first_z_diff = z_diff;
-          }
-
-          const std::vector<Poly>& low_degree_extensions =
-              low_degree_extensions_vec[i];
-          std::vector<Poly> polys = base::Map(
-              grouped_poly_openings.poly_openings_vec,
-              [&u, &low_degree_extensions](
-                  size_t i, const PolynomialOpenings<Poly>& poly_openings) {
-                using Coefficients = typename Poly::Coefficients;
-
-                Poly poly = *poly_openings.poly_oracle;
-                if (poly.NumElements() > 0) {
-                  // NOTE(chokobole): It's safe to access since we checked
-                  // |NumElements()| is greater than 0.
-                  poly.at(0) -= low_degree_extensions[i].Evaluate(u);
-                  return poly;
-                }
-
-                return Poly(Coefficients(
-                    {-low_degree_extensions[i].Evaluate(u)}, true));
-              });
-
-          // clang-format off
-          // L₀(X) = (P₀(X) - R₀(u)) + y(P₁(X) - R₁(u)) + y²(P₂(X) - R₂(u))) * Zᴛ\₀(u)
-          // L₁(X) = (P₃(X) - R₃(u)) * Zᴛ\₁(u)
-          // L₂(X) = (P₄(X) - R₄(u)) * Zᴛ\₂(u)
-          // clang-format on
-          Poly& l = Poly::template LinearCombinationInPlace</*forward=*/false>(
-              polys, y);
-          return l * z_diff;
+          return Poly::EvaluateVanishingPolyByRoots(diffs, u);
         });
+    // Zᴛ\₀(u)⁻¹
+    Field first_z_diff_inv = z_diffs[0];
+    CHECK(first_z_diff_inv.InverseInPlace());
 
-    // Create a linear combination of polynomials [L₀(X), L₁(X), L₂(X)] with
-    // |v|.
-    // L(X) = L₀(X) + vL₁(X) + v²L₂(X)
-    Poly& l_poly =
-        Poly::template LinearCombinationInPlace</*forward=*/false>(l_polys, v);
-
-    // Zᴛ = [x₀, x₁, x₂, x₃, x₄]
-    std::vector<Field> z_t(super_point_set.begin(), super_point_set.end());
-    // Zᴛ(X) = (X - x₀)(X - x₁)(X - x₂)(X - x₃)(X - x₄)
-    // Zᴛ(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃)(u - x₄)
-    Field zt_eval = Poly::EvaluateVanishingPolyByRoots(z_t, u);
-
+    // clang-format off
+    // L₀(X) = Zᴛ\₀(u) * ((P₀(X) - R₀(u)) + y(P₁(X) - R₁(u)) + y²(P₂(X) - R₂(u)))
+    // L₁(X) = Zᴛ\₁(u) * (P₃(X) - R₃(u))
+    // L₂(X) = Zᴛ\₂(u) * (P₄(X) - R₄(u))
     // L(X) = L₀(X) + vL₁(X) + v²L₂(X) - Zᴛ(u) * H(X)
-    h_poly *= zt_eval;
-    l_poly -= h_poly;
+    // clang-format on
+    // NOTE: L(X) / Zᴛ\₀(u) is accumulated in a single pass over the
+    // coefficients of every Pᵢ(X) and H(X), whose scalars are
+    // vⁱ * yʲ * Zᴛ\ᵢ(u) / Zᴛ\₀(u) and -Zᴛ(u) / Zᴛ\₀(u), instead of building
+    // each Lᵢ(X) from copies of Pᵢ(X) and normalizing the quotient afterwards.
+    std::vector<const Poly*> polys;
+    std::vector<Field> scalars;
+    Field constant = Field::Zero();
+    Field v_power = Field::One();
+    for (size_t i = 0; i < grouped_poly_openings_vec.size(); ++i) {
+      const std::vector<PolynomialOpenings<Poly>>& poly_openings_vec =
+          grouped_poly_openings_vec[i].poly_openings_vec;
+      const std::vector<Poly>& low_degree_extensions =
+          low_degree_extensions_vec[i];
+      Field scalar = v_power * z_diffs[i] * first_z_diff_inv;
+      for (size_t j = 0; j < poly_openings_vec.size(); ++j) {
+        polys.push_back(poly_openings_vec[j].poly_oracle.get());
+        scalars.push_back(scalar);
+        constant -= scalar * low_degree_extensions[j].Evaluate(u);
+        scalar *= y;
+      }
+      v_power *= v;
+    }
+    polys.push_back(&h_poly);
+    scalars.push_back(-(zt_eval * first_z_diff_inv));
+    Poly q_poly = math::LinearCombination(polys, scalars);
+    if (q_poly.NumElements() > 0) {
+      // NOTE: It's safe to access since we checked |NumElements()| is greater
+      // than 0.
+      q_poly.at(0) += constant;
+    } else {
+      using Coefficients = typename Poly::Coefficients;
+      q_poly = Poly(Coefficients({constant}, true));
+    }
 
     // L(X) should be zero in X = |u|
-    DCHECK(l_poly.Evaluate(u).IsZero());
-
-    // Q(X) = L(X) / (X - u)
-    Poly vanishing_poly = Poly::FromRoots(std::vector<Field>({u}));
-    CHECK(l_poly /= vanishing_poly);
-    Poly& q_poly = l_poly;
+    DCHECK(q_poly.Evaluate(u).IsZero());
 
-    // Normalize
     // Q(X) = L(X) / ((X - u) * Zᴛ\₀(u))
-    CHECK(q_poly /= first_z_diff);
+    math::DivideByLinearInPlace(q_poly, u);
 
     // Commit Q(X)
     Commitment q;
@@ -229,137 +347,10 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   [[nodiscard]] bool DoVerifyOpeningProof(
       const Container& poly_openings,
       TranscriptReader<Commitment>* reader) const {
-    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
-
-    Field y = reader->SqueezeChallenge();
-    VLOG(2) << "SHPlonk(y): " << y.ToHexString(true);
-    Field v = reader->SqueezeChallenge();
-    VLOG(2) << "SHPlonk(v): " << v.ToHexString(true);
-
-    Commitment h;
-    if (!reader->ReadFromProof(&h)) return false;
-
-    Field u = reader->SqueezeChallenge();
-    VLOG(2) << "SHPlonk(u): " << u.ToHexString(true);
-
-    Commitment q;
-    if (!reader->ReadFromProof(&q)) return false;
-
-    PolynomialOpeningGrouper<Poly, Commitment> grouper;
-    grouper.GroupByPolyOracleAndPoints(poly_openings);
-
-    // Group |poly_openings| to |grouped_poly_openings_vec|.
-    // {[C₀, C₁, C₂], [x₀, x₁, x₂]}
-    // {[C₃], [x₂, x₃]}
-    // {[C₄], [x₄]}
-    const std::vector<GroupedPolynomialOpenings<Poly, Commitment>>&
-        grouped_poly_openings_vec = grouper.grouped_poly_openings_vec();
-    const absl::btree_set<Point>& super_point_set = grouper.super_point_set();
-
-    Field first_z_diff_inverse = Field::Zero();
-    Field first_z = Field::Zero();
-
-    std::vector<G1JacobianPoint> normalized_l_commitments;
-    normalized_l_commitments.reserve(grouped_poly_openings_vec.size());
-    size_t i = 0;
-    for (const GroupedPolynomialOpenings<Poly, Commitment>&
-             grouped_poly_openings : grouped_poly_openings_vec) {
-      const std::vector<PolynomialOpenings<Poly, Commitment>>&
-          poly_openings_vec = grouped_poly_openings.poly_openings_vec;
-      const std::vector<Point>& points = grouped_poly_openings.points;
-      // |commitments₀| = [C₀, C₁, C₂]
-      // |commitments₁| = [C₃]
-      // |commitments₂| = [C₄]
-      std::vector<Commitment> commitments = base::Map(
-          poly_openings_vec,
-          [](const PolynomialOpenings<Poly, Commitment>& poly_openings) {
-            return *poly_openings.poly_oracle;
-          });
-      // |points₀| = [x₀, x₁, x₂]
-      // |points₁| = [x₂, x₃]
-      // |points₂| = [x₄]
-      // |diffs₀| = [x₃, x₄]
-      // |diffs₁| = [x₀, x₁, x₄]
-      // |diffs₂| = [x₀, x₁, x₂, x₃]
-      std::vector<Point> diffs;
-      diffs.reserve(super_point_set.size() - points.size());
-      for (const Point& point : super_point_set) {
-        if (!base::Contains(points, point)) {
-          diffs.push_back(point);
-        }
-      }
-
-      // clang-format off
-      // |normalized_z_diff₀| = Zᴛ\₀(u) / Zᴛ\₀(u) = 1
-      // |normalized_z_diff₁| = Zᴛ\₁(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₄) / (u - x₃)(u - x₄)
-      // |normalized_z_diff₂| = Zᴛ\₂(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃) / (u - x₃)(u - x₄)
-      // clang-format on
-      Point normalized_z_diff = Poly::EvaluateVanishingPolyByRoots(diffs, u);
-      if (i == 0) {
-        // Zᴛ = [x₀, x₁, x₂, x₃, x₄]
-        // |first_z| = Z₀(u) = Zᴛ(u) / Zᴛ\₀(u) = (u - x₀)(u - x₁)(u - x₂)
-        first_z = Poly::EvaluateVanishingPolyByRoots(points, u);
-        // Z₀(u)⁻¹ = (u - x₃)(u - x₄)⁻¹
-        CHECK(normalized_z_diff.InverseInPlace());
-        first_z_diff_inverse = std::move(normalized_z_diff);
-        normalized_z_diff = Field::One();
-      } else {
-        normalized_z_diff *= first_z_diff_inverse;
-      }
-
-      // |r_commitments₀| = [[R₀(u)]₁, [R₁(u)]₁, [R₂(u)]₁]
-      // |r_commitments₁| = [[R₃(u)]₁]
-      // |r_commitments₂| = [[R₄(u)]₁]
-      std::vector<G1JacobianPoint> r_commitments = base::Map(
-          poly_openings_vec,
-          [&points,
-           &u](const PolynomialOpenings<Poly, Commitment>& poly_openings) {
-            Poly r;
-            CHECK(
-                math::LagrangeInterpolate(points, poly_openings.openings, &r));
-            return r.Evaluate(u) * G1Point::Generator();
-          });
-
-      // clang-format off
-      // |l_commitment₀| = (C₀ - [R₀(u)]₁) + y(C₁ - [R₁(u)]₁) + y²(C₂ - [R₂(u)]₁)
-      // |l_commitment₁| = C₁ - [R₁(u)]₁
-      // |l_commitment₂| = C₂ - [R₂(u)]₁
-      // clang-format on
-      G1JacobianPoint l_commitment = G1JacobianPoint::Zero();
-      for (size_t j = commitments.size() - 1; j != SIZE_MAX; --j) {
-        l_commitment *= y;
-        l_commitment += (commitments[j] - r_commitments[j]);
-      }
-
-      // clang-format off
-      // |normalized_l_commitments₀| = [L₀(τ)]₁ / Zᴛ\₀(u) = (C₀ - [R₀(u)]₁) + y(C₁ - [R₁(u)]₁) + y²(C₂ - [R₂(u)]₁) * Zᴛ\₀(u) / Zᴛ\₀(u)
-      // |normalized_l_commitments₁| = [L₁(τ)]₁ / Zᴛ\₀(u) = (C₁ - [R₁(u)]₁) * Zᴛ\₁(u) / Zᴛ\₀(u)
-      // |normalized_l_commitments₂| = [L₂(τ)]₁ / Zᴛ\₀(u) = (C₂ - [R₂(u)]₁) * Zᴛ\₂(u) / Zᴛ\₀(u)
-      // clang-format on
-      l_commitment *= normalized_z_diff;
-      normalized_l_commitments.push_back(std::move(l_commitment));
-      ++i;
-    }
-
-    // clang-format off
-    // |p| = ([L₀(τ)]₁ + v[L₁(τ)]₁ + v²[L₂(τ)]₁) / Zᴛ\₀(u) - Z₀(u)[H(τ)]₁ + u[Q(τ)]₁
-    // clang-format on
-    G1JacobianPoint& p =
-        G1JacobianPoint::template LinearCombinationInPlace</*forward=*/false>(
-            normalized_l_commitments, v);
-
-    p -= (first_z * h);
-    p += (u * q);
-
-    // clang-format off
-    // e([Q(τ)]₁, [τ]₂) * e(p, [-1]₂) ≟ gᴛ⁰
-    // τ * Q(τ) - (L₀(τ) + v * L₁(τ) + v² * L₂(τ)) / Zᴛ\₀(u) + Z₀(u) * H(τ) - u * Q(τ) ≟ 0
-    // (τ - u) * Q(τ) ≟ (L₀(τ) + v * L₁(τ) + v² * L₂(τ)) / Zᴛ\₀(u) - Z₀(u) * H(τ)
-    // (τ - u) * Q(τ) ≟ (L₀(τ) + v * L₁(τ) + v² * L₂(τ) - Zᴛ(u) * H(τ)) / Zᴛ\₀(u)
-    // (τ - u) * Q(τ) * Zᴛ\₀(u) ≟ L(τ)
-    // clang-format on
-    G1Point g1_arr[] = {std::move(q), p.ToAffine()};
-    return math::Pairing<Curve>(g1_arr, g2_arr_).IsOne();
+    PairingPoints pairing_points;
+    if (!ComputePairingPoints(poly_openings, reader, &pairing_points))
+      return false;
+    return math::Pairing<Curve>(pairing_points, g2_arr_).IsOne();
   }
 
   // KZGFamily methods
@@ -14,6 +14,10 @@ class SHPlonkTest : public KZGFamilyTest<PCS> {};
 
 TEST_F(SHPlonkTest, CreateAndVerifyProof) { this->CreateAndVerifyProof(); }
 
+TEST_F(SHPlonkTest, BatchVerifyPairingPoints) {
+  this->BatchVerifyPairingPoints();
+}
+
 TEST_F(SHPlonkTest, Copyable) { this->Copyable(); }
 
 }  // namespace tachyon::crypto
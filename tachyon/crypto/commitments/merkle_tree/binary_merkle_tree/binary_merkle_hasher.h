@@ -4,6 +4,10 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_HASHER_H_
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_HASHER_H_
 
+#include <stddef.h>
+
+#include "absl/types/span.h"
+
 namespace tachyon::crypto {
 
 template <typename Leaf, typename Hash>
@@ -13,7 +17,37 @@ class BinaryMerkleHasher {
 
   virtual Hash ComputeLeafHash(const Leaf& leaf) const = 0;
 
+  // Returns how many leaves |ComputeLeafHashes()| hashes at once, e.g., the
+  // number of lanes of a packed field. It must be a power of two.
+  virtual size_t GetLeafHashBatchSize() const { return 1; }
+
+  // Computes the hashes of |leaves| into |hashes|, where |leaves| has at most
+  // |GetLeafHashBatchSize()| elements. By default, the leaves are hashed one
+  // by one.
+  virtual void ComputeLeafHashes(absl::Span<const Leaf> leaves,
+                                 absl::Span<Hash> hashes) const {
+    for (size_t i = 0; i < leaves.size(); ++i) {
+      hashes[i] = ComputeLeafHash(leaves[i]);
+    }
+  }
+
   virtual Hash ComputeParentHash(const Hash& left, const Hash& right) const = 0;
+
+  // Returns how many parents |ComputeParentHashes()| hashes at once. It must
+  // be a power of two.
+  virtual size_t GetParentHashBatchSize() const { return 1; }
+
+  // Computes the hashes of the parents of |children| into |parents|, where
+  // the i-th parent is the parent of |children[2 * i]| and
+  // |children[2 * i + 1]|, and |parents| has at most
+  // |GetParentHashBatchSize()| elements. By default, the parents are hashed
+  // one by one.
+  virtual void ComputeParentHashes(absl::Span<const Hash> children,
+                                   absl::Span<Hash> parents) const {
+    for (size_t i = 0; i < parents.size(); ++i) {
+      parents[i] = ComputeParentHash(children[2 * i], children[2 * i + 1]);
+    }
+  }
 };
 
 }  // namespace tachyon::crypto
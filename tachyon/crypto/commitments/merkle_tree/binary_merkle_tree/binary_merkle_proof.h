@@ -4,6 +4,8 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
 
+#include <stddef.h>
+
 #include <vector>
 
 namespace tachyon::crypto {
@@ -33,6 +35,23 @@ struct BinaryMerkleProof {
   }
 };
 
+// A proof that opens many leaves of a tree of |num_leaves| leaves at once.
+// |siblings| only has the nodes that can't be computed from the opened
+// leaves, level by level from the leaves and in ascending order within a
+// level, so a node shared by many paths appears at most once.
+template <typename Hash>
+struct BinaryMerkleMultiProof {
+  size_t num_leaves = 0;
+  std::vector<Hash> siblings;
+
+  bool operator==(const BinaryMerkleMultiProof& other) const {
+    return num_leaves == other.num_leaves && siblings == other.siblings;
+  }
+  bool operator!=(const BinaryMerkleMultiProof& other) const {
+    return !operator==(other);
+  }
+};
+
 }  // namespace tachyon::crypto
 
 #endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
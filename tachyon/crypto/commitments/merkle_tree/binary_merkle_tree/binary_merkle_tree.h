@@ -5,16 +5,21 @@
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_TREE_H_
 
 #include <algorithm>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/numerics/checked_math.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/base/range.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/base/tuning_profile.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_hasher.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_proof.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
@@ -42,8 +47,158 @@ class BinaryMerkleTree final
     leaves_size_for_parallelization_ = leaves_size_for_parallelization;
   }
 
+  size_t cap_height() const { return cap_height_; }
+  void set_cap_height(size_t cap_height) { cap_height_ = cap_height; }
+
+  // Commits to |leaves| and writes the cap, which is the 2^|cap_height()|
+  // nodes at the depth of |cap_height()|, to |cap|. With a cap height of 0,
+  // the cap only has the root.
+  template <typename Container>
+  [[nodiscard]] bool CommitToCap(const Container& leaves,
+                                 std::vector<Hash>* cap) const {
+    Hash root;
+    if (!DoCommit(leaves, &root)) return false;
+    *cap = GetCap();
+    return true;
+  }
+
+  std::vector<Hash> GetCap() const {
+    size_t from = (size_t{1} << cap_height_) - 1;
+    return base::CreateVector(from + 1, [this, from](size_t i) {
+      return storage_->GetHash(from + i);
+    });
+  }
+
+  // Verifies the |proof| of the leaf at |index|, which stops at the cap,
+  // against the |cap|.
+  [[nodiscard]] bool VerifyOpeningProofToCap(
+      absl::Span<const Hash> cap, size_t index, const Hash& leaf_hash,
+      const BinaryMerkleProof<Hash>& proof) const {
+    Hash hash = leaf_hash;
+    for (const BinaryMerklePath<Hash>& path : proof.paths) {
+      // A sibling on the left means that the node is a right child.
+      if (path.left != (index % 2 == 1)) {
+        LOG(ERROR) << "Proof doesn't match with the index";
+        return false;
+      }
+      if (path.left) {
+        hash = hasher_->ComputeParentHash(path.hash, hash);
+      } else {
+        hash = hasher_->ComputeParentHash(hash, path.hash);
+      }
+      index >>= 1;
+    }
+    if (index >= cap.size()) {
+      LOG(ERROR) << "Proof doesn't reach the cap";
+      return false;
+    }
+    return hash == cap[index];
+  }
+
+  // Verifies that the leaves of |leaf_hashes|, each of which is a pair of an
+  // index and a leaf hash, lead to the |cap| with the multi-opening |proof|.
+  [[nodiscard]] bool VerifyOpeningProofToCap(
+      absl::Span<const Hash> cap,
+      const std::vector<std::pair<size_t, Hash>>& leaf_hashes,
+      const BinaryMerkleMultiProof<Hash>& proof) const {
+    if (!base::bits::IsPowerOfTwo(proof.num_leaves) ||
+        proof.num_leaves > MaxSize) {
+      LOG(ERROR) << "Invalid number of leaves " << proof.num_leaves;
+      return false;
+    }
+    if (!base::bits::IsPowerOfTwo(cap.size()) ||
+        cap.size() > proof.num_leaves) {
+      LOG(ERROR) << "Invalid cap size " << cap.size();
+      return false;
+    }
+    std::vector<std::pair<size_t, Hash>> nodes = leaf_hashes;
+    std::sort(nodes.begin(), nodes.end(),
+              [](const std::pair<size_t, Hash>& a,
+                 const std::pair<size_t, Hash>& b) {
+                return a.first < b.first;
+              });
+    for (size_t i = 1; i < nodes.size(); ++i) {
+      if (nodes[i - 1].first == nodes[i].first &&
+          nodes[i - 1].second != nodes[i].second) {
+        LOG(ERROR) << "Index " << nodes[i].first << " has different leaves";
+        return false;
+      }
+    }
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    if (nodes.empty()) {
+      LOG(ERROR) << "No leaves to verify";
+      return false;
+    }
+    if (nodes.back().first >= proof.num_leaves) {
+      LOG(ERROR) << "Index " << nodes.back().first << " is out of range";
+      return false;
+    }
+    return VerifyCap(hasher_, std::move(nodes), proof.num_leaves,
+                     proof.siblings, cap);
+  }
+
+  // Collects the siblings on the paths from the sorted distinct |nodes| at the
+  // level of |level_size| nodes up to the level of |cap_size| nodes, where
+  // the nodes are indexed within the level. A sibling is skipped if it is on
+  // another path, since the verifier computes it anyway.
+  static void CollectSiblings(const BinaryMerkleTreeStorage<Hash>* storage,
+                              std::vector<size_t> nodes, size_t level_size,
+                              size_t cap_size, std::vector<Hash>* siblings) {
+    siblings->clear();
+    for (; level_size > cap_size; level_size >>= 1) {
+      std::vector<size_t> parents;
+      parents.reserve(nodes.size());
+      for (size_t j = 0; j < nodes.size(); ++j) {
+        if (j + 1 < nodes.size() && nodes[j + 1] == (nodes[j] ^ 1)) {
+          ++j;
+        } else {
+          siblings->push_back(
+              storage->GetHash(level_size - 1 + (nodes[j] ^ 1)));
+        }
+        parents.push_back(nodes[j] >> 1);
+      }
+      nodes = std::move(parents);
+    }
+  }
+
+  // Returns true if the sorted distinct |nodes| at the level of |level_size|
+  // nodes and the |siblings| in the order that |CollectSiblings()| collects
+  // them lead to the |cap|, whose size is a power of two. Every parent is
+  // hashed once even if it is on many paths.
+  static bool VerifyCap(const BinaryMerkleHasher<Leaf, Hash>* hasher,
+                        std::vector<std::pair<size_t, Hash>> nodes,
+                        size_t level_size, absl::Span<const Hash> siblings,
+                        absl::Span<const Hash> cap) {
+    if (cap.empty() || cap.size() > level_size) return false;
+    size_t sibling_idx = 0;
+    for (; level_size > cap.size(); level_size >>= 1) {
+      std::vector<std::pair<size_t, Hash>> parents;
+      parents.reserve(nodes.size());
+      for (size_t j = 0; j < nodes.size(); ++j) {
+        const auto& [node, hash] = nodes[j];
+        Hash parent;
+        if (j + 1 < nodes.size() && nodes[j + 1].first == (node ^ 1)) {
+          parent = hasher->ComputeParentHash(hash, nodes[++j].second);
+        } else {
+          if (sibling_idx == siblings.size()) return false;
+          const Hash& sibling = siblings[sibling_idx++];
+          parent = node % 2 == 0 ? hasher->ComputeParentHash(hash, sibling)
+                                 : hasher->ComputeParentHash(sibling, hash);
+        }
+        parents.emplace_back(node >> 1, std::move(parent));
+      }
+      nodes = std::move(parents);
+    }
+    if (sibling_idx != siblings.size()) return false;
+    return std::all_of(nodes.begin(), nodes.end(),
+                       [cap](const std::pair<size_t, Hash>& node) {
+                         return node.second == cap[node.first];
+                       });
+  }
+
  private:
   FRIEND_TEST(BinaryMerkleTreeTest, FillLeaves);
+  FRIEND_TEST(BinaryMerkleTreeTest, FillLeavesInBatch);
   FRIEND_TEST(BinaryMerkleTreeTest, BuildTreeFromLeaves);
 
   friend class VectorCommitmentScheme<BinaryMerkleTree<Leaf, Hash, MaxSize>>;
@@ -55,6 +210,7 @@ class BinaryMerkleTree final
 
   template <typename Container>
   [[nodiscard]] bool DoCommit(const Container& leaves, Hash* out) const {
+    TRACE_EVENT("merkle", "BinaryMerkleTree::Commit");
     if (!FillLeaves(leaves)) return false;
 
     // For instance, if |leaves_size_for_parallelization_| equals 4, the
@@ -66,18 +222,28 @@ class BinaryMerkleTree final
     // 7 8 9 10 11 12 13 14
     //
     // Finally, the remaining tree should be constructed from leaves 1 and 2.
+    // Since the remaining tree is as wide as the number of subtrees, each of
+    // its levels is hashed in parallel as long as it has at least
+    // |leaves_size_for_parallelization_| nodes.
     size_t leaves_size = std::size(leaves);
     if (leaves_size > leaves_size_for_parallelization_) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < leaves_size;
-                          i += leaves_size_for_parallelization_) {
-        size_t from = leaves_size - 1 + i;
-        size_t to = from + leaves_size_for_parallelization_;
-        BuildTreeFromLeaves(base::Range<size_t>(from, to));
+      // A subtree of a single leaf is the leaf itself.
+      if (leaves_size_for_parallelization_ > 1) {
+        OPENMP_PARALLEL_FOR(size_t i = 0; i < leaves_size;
+                            i += leaves_size_for_parallelization_) {
+          size_t from = leaves_size - 1 + i;
+          size_t to = from + leaves_size_for_parallelization_;
+          BuildTreeFromLeaves(base::Range<size_t>(from, to));
+        }
       }
       size_t i = base::bits::Log2Floor(leaves_size) -
                  base::bits::Log2Floor(leaves_size_for_parallelization_);
-      BuildTreeFromLeaves(
-          base::Range<size_t>((1 << i) - 1, (1 << (i + 1)) - 1));
+      base::Range<size_t> range((1 << i) - 1, (1 << (i + 1)) - 1);
+      while (range.GetSize() >= leaves_size_for_parallelization_) {
+        BuildLevel(range, /*parallel=*/true);
+        range = base::Range<size_t>(range.from >> 1, (range.to >> 1) - 1);
+      }
+      BuildTreeFromLeaves(range);
     } else {
       BuildTreeFromLeaves(
           base::Range<size_t>(leaves_size - 1, (leaves_size << 1) - 1));
@@ -86,13 +252,18 @@ class BinaryMerkleTree final
     return true;
   }
 
+  // The proof stops at the cap, so it has |cap_height()| fewer paths than the
+  // height of the tree.
   [[nodiscard]] bool DoCreateOpeningProof(size_t index,
                                           BinaryMerkleProof<Hash>* proof) {
     size_t size = storage_->GetSize();
+    if (!CheckCapHeight((size + 1) >> 1)) return false;
     index = (size >> 1) + index;
-    proof->paths.resize(base::bits::Log2Floor(size));
+    proof->paths.resize(base::bits::Log2Floor(size) - cap_height_);
+    // The nodes below the cap start at 2^(|cap_height_| + 1) - 1.
+    size_t below_cap = (size_t{2} << cap_height_) - 1;
     size_t i = 0;
-    while (index > 0) {
+    while (index >= below_cap) {
       BinaryMerklePath<Hash> path;
       if (index % 2 == 0) {
         path.left = true;
@@ -108,6 +279,40 @@ class BinaryMerkleTree final
     return true;
   }
 
+  // Opens the leaves at |indices| at once. Duplicated indices are opened
+  // once.
+  [[nodiscard]] bool DoCreateOpeningProof(
+      const std::vector<size_t>& indices,
+      BinaryMerkleMultiProof<Hash>* proof) {
+    size_t num_leaves = (storage_->GetSize() + 1) >> 1;
+    std::vector<size_t> nodes = indices;
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    if (nodes.empty()) {
+      LOG(ERROR) << "No indices to open";
+      return false;
+    }
+    if (nodes.back() >= num_leaves) {
+      LOG(ERROR) << "Index " << nodes.back() << " is out of range";
+      return false;
+    }
+    if (!CheckCapHeight(num_leaves)) return false;
+    proof->num_leaves = num_leaves;
+    CollectSiblings(storage_, std::move(nodes), num_leaves,
+                    size_t{1} << cap_height_, &proof->siblings);
+    return true;
+  }
+
+  // Verifies that the leaves of |leaf_hashes|, each of which is a pair of an
+  // index and a leaf hash, are under |root|.
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Hash& root,
+      const std::vector<std::pair<size_t, Hash>>& leaf_hashes,
+      const BinaryMerkleMultiProof<Hash>& proof) const {
+    return VerifyOpeningProofToCap(absl::MakeConstSpan(&root, 1), leaf_hashes,
+                                   proof);
+  }
+
   [[nodiscard]] bool DoVerifyOpeningProof(
       const Hash& root, const Hash& leaf_hash,
       const BinaryMerkleProof<Hash>& proof) const {
@@ -133,32 +338,107 @@ class BinaryMerkleTree final
       LOG(ERROR) << "Too many leaves";
       return false;
     }
+    if (!CheckCapHeight(leaves_size)) return false;
     base::CheckedNumeric<size_t> n = leaves_size;
     storage_->Allocate(((n << 1) - 1).ValueOrDie());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < leaves_size; ++i) {
-      storage_->SetHash(leaves_size + i - 1,
-                        hasher_->ComputeLeafHash(leaves[i]));
+    size_t batch_size =
+        std::min(hasher_->GetLeafHashBatchSize(), leaves_size);
+    if (batch_size == 1) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < leaves_size; ++i) {
+        storage_->SetHash(leaves_size + i - 1,
+                          hasher_->ComputeLeafHash(leaves[i]));
+      }
+      return true;
+    }
+    // Both |leaves_size| and |batch_size| are powers of two.
+    absl::Span<const Leaf> leaves_span = absl::MakeConstSpan(leaves);
+    size_t num_batches = leaves_size / batch_size;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_batches; ++i) {
+      std::vector<Hash> hashes(batch_size);
+      hasher_->ComputeLeafHashes(
+          leaves_span.subspan(i * batch_size, batch_size),
+          absl::MakeSpan(hashes));
+      for (size_t j = 0; j < batch_size; ++j) {
+        storage_->SetHash(leaves_size + i * batch_size + j - 1, hashes[j]);
+      }
+    }
+    return true;
+  }
+
+  bool CheckCapHeight(size_t leaves_size) const {
+    if (cap_height_ > base::bits::Log2Floor(leaves_size)) {
+      LOG(ERROR) << "Cap height " << cap_height_
+                 << " is larger than the height of the tree";
+      return false;
     }
     return true;
   }
 
   void BuildTreeFromLeaves(base::Range<size_t> range) const {
     while (range.GetSize() > 0) {
-      for (size_t i = range.from; i < range.to; i += 2) {
-        storage_->SetHash(i >> 1,
-                          hasher_->ComputeParentHash(storage_->GetHash(i),
-                                                     storage_->GetHash(i + 1)));
-      }
+      BuildLevel(range, /*parallel=*/false);
       range = base::Range<size_t>(range.from >> 1, (range.to >> 1) - 1);
     }
   }
 
+  // Hashes the nodes in |range|, which starts at a left child, into their
+  // parents, |GetParentHashBatchSize()| parents at a time. |range.to| may stop
+  // before the last right child, since |BuildTreeFromLeaves()| narrows the
+  // range to the parents with |(range.to >> 1) - 1|.
+  void BuildLevel(base::Range<size_t> range, bool parallel) const {
+    size_t num_parents = (range.GetSize() + 1) / 2;
+    if (num_parents == 0) return;
+    size_t batch_size =
+        std::min(hasher_->GetParentHashBatchSize(), num_parents);
+    // Both |num_parents| and |batch_size| are powers of two.
+    size_t num_batches = num_parents / batch_size;
+    auto build_batch = [this, &range, batch_size](size_t i) {
+      size_t first = range.from + 2 * i * batch_size;
+      if (batch_size == 1) {
+        storage_->SetHash(first >> 1,
+                          hasher_->ComputeParentHash(
+                              storage_->GetHash(first),
+                              storage_->GetHash(first + 1)));
+        return;
+      }
+      std::vector<Hash> children(2 * batch_size);
+      std::vector<Hash> parents(batch_size);
+      for (size_t j = 0; j < children.size(); ++j) {
+        children[j] = storage_->GetHash(first + j);
+      }
+      hasher_->ComputeParentHashes(children, absl::MakeSpan(parents));
+      for (size_t j = 0; j < batch_size; ++j) {
+        storage_->SetHash((first >> 1) + j, parents[j]);
+      }
+    };
+    if (parallel) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < num_batches; ++i) {
+        build_batch(i);
+      }
+    } else {
+      for (size_t i = 0; i < num_batches; ++i) {
+        build_batch(i);
+      }
+    }
+  }
+
+  // Returns the value of the tuning profile if it is set, or
+  // |kDefaultLeavesSizeForParallelization| otherwise. See
+  // |base::TuningProfile|.
+  static size_t GetDefaultLeavesSizeForParallelization() {
+    std::optional<size_t> value = base::TuningProfile::GetDefault().GetSize(
+        base::TuningProfile::kLeavesSizeForParallelization);
+    if (value.has_value() && base::bits::IsPowerOfTwo(*value)) return *value;
+    return kDefaultLeavesSizeForParallelization;
+  }
+
   // not owned
   mutable BinaryMerkleTreeStorage<Hash>* storage_ = nullptr;
   // not owned
   BinaryMerkleHasher<Leaf, Hash>* hasher_ = nullptr;
   size_t leaves_size_for_parallelization_ =
-      kDefaultLeavesSizeForParallelization;
+      GetDefaultLeavesSizeForParallelization();
+  size_t cap_height_ = 0;
 };
 
 template <typename Leaf, typename Hash, size_t MaxSize>
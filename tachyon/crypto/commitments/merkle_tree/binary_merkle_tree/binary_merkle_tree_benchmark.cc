@@ -0,0 +1,89 @@
+#include <stdint.h>
+
+#include <array>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/blocked_binary_merkle_tree_storage.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+constexpr size_t kMaxSize = size_t{1} << 26;
+
+// A 32-byte hash, so that the benchmarks are dominated by the memory accesses
+// of the storage rather than by hashing.
+using Hash = std::array<uint64_t, 4>;
+
+class SimpleHasher : public BinaryMerkleHasher<uint64_t, Hash> {
+ public:
+  // BinaryMerkleHasher<uint64_t, Hash> methods
+  Hash ComputeLeafHash(const uint64_t& leaf) const override {
+    return {leaf, leaf + 1, leaf + 2, leaf + 3};
+  }
+  Hash ComputeParentHash(const Hash& left, const Hash& right) const override {
+    Hash ret;
+    for (size_t i = 0; i < ret.size(); ++i) {
+      ret[i] = left[i] * 31 + right[(i + 1) % 4];
+    }
+    return ret;
+  }
+};
+
+}  // namespace
+
+template <typename Storage>
+void BM_Commit(benchmark::State& state) {
+  std::vector<uint64_t> leaves =
+      base::CreateRangedVector<uint64_t>(0, state.range(0));
+  Storage storage;
+  SimpleHasher hasher;
+  BinaryMerkleTree<uint64_t, Hash, kMaxSize> tree(&storage, &hasher);
+  for (auto _ : state) {
+    Hash commitment;
+    CHECK(tree.Commit(leaves, &commitment));
+    benchmark::DoNotOptimize(commitment);
+  }
+}
+
+template <typename Storage>
+void BM_CreateOpeningProof(benchmark::State& state) {
+  size_t num_leaves = state.range(0);
+  std::vector<uint64_t> leaves =
+      base::CreateRangedVector<uint64_t>(0, num_leaves);
+  Storage storage;
+  SimpleHasher hasher;
+  BinaryMerkleTree<uint64_t, Hash, kMaxSize> tree(&storage, &hasher);
+  Hash commitment;
+  CHECK(tree.Commit(leaves, &commitment));
+  // Strides over the leaves with an odd number, so that consecutive openings
+  // don't share their paths.
+  size_t index = 0;
+  for (auto _ : state) {
+    BinaryMerkleProof<Hash> proof;
+    CHECK(tree.CreateOpeningProof(index, &proof));
+    benchmark::DoNotOptimize(proof);
+    index = (index + 0x9e3779b1) & (num_leaves - 1);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_Commit, SimpleBinaryMerkleTreeStorage<Hash>)
+    ->RangeMultiplier(4)
+    ->Range(1 << 20, 1 << 26);
+BENCHMARK_TEMPLATE(BM_Commit, BlockedBinaryMerkleTreeStorage<Hash>)
+    ->RangeMultiplier(4)
+    ->Range(1 << 20, 1 << 26);
+BENCHMARK_TEMPLATE(BM_CreateOpeningProof, SimpleBinaryMerkleTreeStorage<Hash>)
+    ->RangeMultiplier(4)
+    ->Range(1 << 20, 1 << 26);
+BENCHMARK_TEMPLATE(BM_CreateOpeningProof, BlockedBinaryMerkleTreeStorage<Hash>)
+    ->RangeMultiplier(4)
+    ->Range(1 << 20, 1 << 26);
+
+}  // namespace tachyon::crypto
+
@@ -0,0 +1,101 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_TREE_STORAGE_GPU_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_TREE_STORAGE_GPU_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+
+namespace tachyon::crypto {
+
+// A |BinaryMerkleTreeStorage| whose nodes live in device memory, where each
+// node is a digest of |Chunk| field elements. The nodes are laid out as in
+// |BinaryMerkleTree|: the root is at index 0 and the children of the i-th node
+// are at 2i + 1 and 2i + 2, so every layer is contiguous.
+//
+// Nodes are copied back to the host lazily: |GetHash()| only copies the node
+// it is asked for, so creating an opening proof costs O(log n) small copies
+// instead of copying the whole tree. Use |FetchLayer()| to copy back a whole
+// layer at once.
+template <typename F, size_t Chunk>
+class BinaryMerkleTreeStorageGpu final
+    : public BinaryMerkleTreeStorage<std::array<F, Chunk>> {
+ public:
+  using Hash = std::array<F, Chunk>;
+  using GpuField = typename F::GpuField;
+
+  BinaryMerkleTreeStorageGpu() = default;
+  BinaryMerkleTreeStorageGpu(const BinaryMerkleTreeStorageGpu& other) = delete;
+  BinaryMerkleTreeStorageGpu& operator=(
+      const BinaryMerkleTreeStorageGpu& other) = delete;
+
+  // Returns the device memory holding |GetSize()| * |Chunk| elements. After
+  // writing to it on the device, |Invalidate()| must be called.
+  device::gpu::GpuMemory<GpuField>& d_nodes() { return d_nodes_; }
+  const device::gpu::GpuMemory<GpuField>& d_nodes() const { return d_nodes_; }
+
+  // Drops the host copies of the nodes, so that they are copied back again
+  // on the next access.
+  void Invalidate() { fetched_.assign(fetched_.size(), false); }
+
+  // Copies back the nodes in [|from|, |to|) to the host.
+  [[nodiscard]] bool FetchNodes(size_t from, size_t to) const {
+    if (from > to || to > hashes_.size()) {
+      LOG(ERROR) << "Invalid range [" << from << ", " << to << ")";
+      return false;
+    }
+    if (from == to) return true;
+    if (!d_nodes_.CopyTo(&hashes_[from], device::gpu::GpuMemoryType::kHost,
+                         from * Chunk, (to - from) * Chunk)) {
+      return false;
+    }
+    for (size_t i = from; i < to; ++i) {
+      fetched_[i] = true;
+    }
+    return true;
+  }
+
+  // Copies back the layer at |depth|, where the root is at depth 0.
+  [[nodiscard]] bool FetchLayer(size_t depth) const {
+    size_t from = (size_t{1} << depth) - 1;
+    return FetchNodes(from, 2 * from + 1);
+  }
+
+  // BinaryMerkleTreeStorage methods
+  void Allocate(size_t size) override {
+    d_nodes_ = device::gpu::GpuMemory<GpuField>::Malloc(size * Chunk);
+    hashes_.resize(size);
+    fetched_.assign(size, false);
+  }
+
+  size_t GetSize() const override { return hashes_.size(); }
+
+  const Hash& GetHash(size_t i) const override {
+    if (!fetched_[i]) {
+      CHECK(FetchNodes(i, i + 1));
+    }
+    return hashes_[i];
+  }
+
+  void SetHash(size_t i, const Hash& hash) override {
+    CHECK(d_nodes_.CopyFrom(hash.data(), device::gpu::GpuMemoryType::kHost,
+                            i * Chunk, Chunk));
+    hashes_[i] = hash;
+    fetched_[i] = true;
+  }
+
+ private:
+  device::gpu::GpuMemory<GpuField> d_nodes_;
+  // The host copies of the nodes. |hashes_[i]| is valid only if |fetched_[i]|
+  // is true.
+  mutable std::vector<Hash> hashes_;
+  mutable std::vector<bool> fetched_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_TREE_STORAGE_GPU_H_
@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/blocked_binary_merkle_tree_storage.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
 
 namespace tachyon::crypto {
@@ -21,6 +22,26 @@ class SimpleHasher : public BinaryMerkleHasher<int, int> {
   }
 };
 
+// Same as |SimpleHasher| but hashes 4 leaves and 2 parents at once.
+class SimpleBatchHasher : public SimpleHasher {
+ public:
+  // BinaryMerkleHasher<int, int> methods
+  size_t GetLeafHashBatchSize() const override { return 4; }
+  void ComputeLeafHashes(absl::Span<const int> leaves,
+                         absl::Span<int> hashes) const override {
+    CHECK_EQ(leaves.size(), size_t{4});
+    std::copy(leaves.begin(), leaves.end(), hashes.begin());
+  }
+  size_t GetParentHashBatchSize() const override { return 2; }
+  void ComputeParentHashes(absl::Span<const int> children,
+                           absl::Span<int> parents) const override {
+    CHECK_LE(parents.size(), size_t{2});
+    for (size_t i = 0; i < parents.size(); ++i) {
+      parents[i] = children[2 * i] + 2 * children[2 * i + 1];
+    }
+  }
+};
+
 class BinaryMerkleTreeTest : public testing::Test {
  public:
   constexpr static size_t K = 3;
@@ -51,6 +72,18 @@ TEST_F(BinaryMerkleTreeTest, FillLeaves) {
   EXPECT_FALSE(vcs_.FillLeaves(invalid_leaves));
 }
 
+TEST_F(BinaryMerkleTreeTest, FillLeavesInBatch) {
+  CreateLeaves();
+  ASSERT_TRUE(vcs_.FillLeaves(leaves_));
+  std::vector<int> expected_nodes = storage_.hashes();
+
+  SimpleBatchHasher batch_hasher;
+  SimpleBinaryMerkleTreeStorage<int> storage;
+  VCS vcs(&storage, &batch_hasher);
+  ASSERT_TRUE(vcs.FillLeaves(leaves_));
+  EXPECT_EQ(storage.hashes(), expected_nodes);
+}
+
 TEST_F(BinaryMerkleTreeTest, BuildTreeFromLeaves) {
   CreateLeaves();
   ASSERT_TRUE(vcs_.FillLeaves(leaves_));
@@ -111,4 +144,129 @@ TEST_F(BinaryMerkleTreeTest, CommitAndVerify) {
   ASSERT_TRUE(vcs_.VerifyOpeningProof(commitment, leaf_hash, proof));
 }
 
+TEST_F(BinaryMerkleTreeTest, CommitAndVerifyMultiOpening) {
+  CreateLeaves();
+
+  int commitment;
+  ASSERT_TRUE(vcs_.Commit(leaves_, &commitment));
+
+  BinaryMerkleMultiProof<int> proof;
+  EXPECT_FALSE(vcs_.CreateOpeningProof(std::vector<size_t>{N}, &proof));
+  ASSERT_TRUE(
+      vcs_.CreateOpeningProof(std::vector<size_t>{3, 0, 1, 3}, &proof));
+
+  // The leaves 0 and 1 are siblings and so are their parent and the parent of
+  // the leaf 3, so only the sibling of the leaf 3 and the right child of the
+  // root are needed.
+  BinaryMerkleMultiProof<int> expected_proof;
+  expected_proof.num_leaves = N;
+  expected_proof.siblings = {2, 54};
+  EXPECT_EQ(proof, expected_proof);
+
+  std::vector<std::pair<size_t, int>> leaf_hashes = {{1, 1}, {3, 3}, {0, 0}};
+  ASSERT_TRUE(vcs_.VerifyOpeningProof(commitment, leaf_hashes, proof));
+
+  leaf_hashes.push_back({3, 4});
+  EXPECT_FALSE(vcs_.VerifyOpeningProof(commitment, leaf_hashes, proof));
+  leaf_hashes.back() = {2, 2};
+  EXPECT_FALSE(vcs_.VerifyOpeningProof(commitment, leaf_hashes, proof));
+  leaf_hashes.pop_back();
+  leaf_hashes[0].second = 2;
+  EXPECT_FALSE(vcs_.VerifyOpeningProof(commitment, leaf_hashes, proof));
+}
+
+TEST_F(BinaryMerkleTreeTest, CommitToCap) {
+  CreateLeaves();
+
+  vcs_.set_cap_height(K + 1);
+  std::vector<int> cap;
+  EXPECT_FALSE(vcs_.CommitToCap(leaves_, &cap));
+
+  vcs_.set_cap_height(1);
+  ASSERT_TRUE(vcs_.CommitToCap(leaves_, &cap));
+  EXPECT_EQ(cap, std::vector<int>({18, 54}));
+
+  // The path stops below the cap.
+  BinaryMerkleProof<int> proof;
+  ASSERT_TRUE(vcs_.CreateOpeningProof(1, &proof));
+  BinaryMerkleProof<int> expected_proof;
+  expected_proof.paths = std::vector<BinaryMerklePath<int>>{
+      {true, 0},
+      {false, 8},
+  };
+  EXPECT_EQ(proof, expected_proof);
+  EXPECT_TRUE(vcs_.VerifyOpeningProofToCap(cap, 1, 1, proof));
+  EXPECT_FALSE(vcs_.VerifyOpeningProofToCap(cap, 5, 1, proof));
+
+  BinaryMerkleMultiProof<int> multi_proof;
+  ASSERT_TRUE(
+      vcs_.CreateOpeningProof(std::vector<size_t>{0, 1, 3}, &multi_proof));
+  EXPECT_EQ(multi_proof.siblings, std::vector<int>({2}));
+  std::vector<std::pair<size_t, int>> leaf_hashes = {{0, 0}, {1, 1}, {3, 3}};
+  EXPECT_TRUE(vcs_.VerifyOpeningProofToCap(cap, leaf_hashes, multi_proof));
+  EXPECT_FALSE(vcs_.VerifyOpeningProofToCap(absl::MakeConstSpan(cap.data(), 1),
+                                            leaf_hashes, multi_proof));
+}
+
+TEST_F(BinaryMerkleTreeTest, CommitInParallel) {
+  CreateLeaves();
+
+  SimpleBatchHasher batch_hasher;
+  for (size_t leaves_size_for_parallelization : {size_t{1}, size_t{2}, N}) {
+    for (bool use_batch_hasher : {false, true}) {
+      SimpleBinaryMerkleTreeStorage<int> storage;
+      VCS vcs(&storage, use_batch_hasher
+                            ? static_cast<BinaryMerkleHasher<int, int>*>(
+                                  &batch_hasher)
+                            : &hasher_);
+      vcs.set_leaves_size_for_parallelization(leaves_size_for_parallelization);
+      int commitment;
+      ASSERT_TRUE(vcs.Commit(leaves_, &commitment));
+      EXPECT_EQ(commitment, 126);
+    }
+  }
+}
+
+TEST_F(BinaryMerkleTreeTest, BlockedStorage) {
+  CreateLeaves();
+
+  int commitment;
+  ASSERT_TRUE(vcs_.Commit(leaves_, &commitment));
+  BinaryMerkleProof<int> expected_proof;
+  ASSERT_TRUE(vcs_.CreateOpeningProof(5, &expected_proof));
+
+  for (size_t block_height = 1; block_height <= K + 2; ++block_height) {
+    BlockedBinaryMerkleTreeStorage<int> storage(block_height);
+    VCS vcs(&storage, &hasher_);
+    vcs.set_leaves_size_for_parallelization(N >> 1);
+
+    int blocked_commitment;
+    ASSERT_TRUE(vcs.Commit(leaves_, &blocked_commitment));
+    EXPECT_EQ(blocked_commitment, commitment);
+    BinaryMerkleProof<int> proof;
+    ASSERT_TRUE(vcs.CreateOpeningProof(5, &proof));
+    EXPECT_EQ(proof, expected_proof);
+
+    std::vector<int> nodes(storage.GetSize());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      nodes[i] = storage.GetHash(i);
+    }
+    EXPECT_EQ(nodes, storage_.hashes());
+  }
+
+  BlockedBinaryMerkleTreeStorage<int> storage(2);
+  storage.Allocate(storage_.GetSize());
+  // clang-format off
+  std::vector<size_t> expected_indices = {
+    0,
+    1, 2,
+    3, 6, 9, 12,
+    4, 5, 7, 8, 10, 11, 13, 14,
+  };
+  // clang-format on
+  for (size_t i = 0; i < expected_indices.size(); ++i) {
+    EXPECT_EQ(storage.ToBlockedIndex(i), expected_indices[i]);
+  }
+}
+
 }  // namespace tachyon::crypto
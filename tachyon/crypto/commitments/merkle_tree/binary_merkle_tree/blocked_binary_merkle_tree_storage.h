@@ -0,0 +1,95 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BLOCKED_BINARY_MERKLE_TREE_STORAGE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BLOCKED_BINARY_MERKLE_TREE_STORAGE_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/memory/huge_page_allocator.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
+
+namespace tachyon::crypto {
+
+// A |BinaryMerkleTreeStorage| that stores the nodes in subtree-blocked order
+// instead of the heap order |BinaryMerkleTree| indexes them with.
+//
+// The tree is cut into subtrees, called blocks, of |block_height()| levels
+// each, and every block is stored contiguously in heap order. Blocks at the
+// same depth are stored next to each other, from left to right, and shallower
+// blocks come first. For example, with a block height of 2:
+//
+//   heap order:                blocked order:
+//          0                          0
+//      1       2                  1       2
+//    3   4   5   6              3   6   9   12
+//   7 8 9 10 11 12 13 14       4 5 7 8 10 11 13 14
+//
+// A node and its ancestors of up to |block_height()| - 1 levels above are in
+// the same block, so an opening proof reads |block_height()| siblings per
+// block instead of one cache line per level, and building a subtree only
+// touches the blocks under it.
+//
+// The nodes are allocated by |base::HugePageAllocator|, since a proof still
+// jumps between the blocks of every depth.
+template <typename T>
+class BlockedBinaryMerkleTreeStorage : public BinaryMerkleTreeStorage<T> {
+ public:
+  // A block of height 4 holds 15 nodes, which spans 8 cache lines for 32-byte
+  // hashes.
+  constexpr static size_t kDefaultBlockHeight = 4;
+
+  explicit BlockedBinaryMerkleTreeStorage(
+      size_t block_height = kDefaultBlockHeight)
+      : block_height_(block_height) {
+    CHECK_GT(block_height_, size_t{0});
+  }
+
+  size_t block_height() const { return block_height_; }
+  const base::HugePageVector<T>& hashes() const { return hashes_; }
+
+  // Returns the position in |hashes()| of the node at |index| in heap order.
+  size_t ToBlockedIndex(size_t index) const {
+    size_t depth = base::bits::Log2Floor(index + 1);
+    size_t block_depth = depth - depth % block_height_;
+    size_t local_depth = depth - block_depth;
+    // The heap index of the root of the block that has the node.
+    size_t block_root = ((index + 1) >> local_depth) - 1;
+    // Blocks shallower than |block_depth| are all full, so they occupy
+    // 2^|block_depth| - 1 nodes, which is also the heap index of the first
+    // root at |block_depth|.
+    size_t level_offset = (size_t{1} << block_depth) - 1;
+    size_t block_size =
+        (size_t{1} << std::min(block_height_, height_ - block_depth)) - 1;
+    size_t local_index = (size_t{1} << local_depth) - 1 + (index + 1) -
+                         ((block_root + 1) << local_depth);
+    return level_offset + (block_root - level_offset) * block_size +
+           local_index;
+  }
+
+  // BinaryMerkleTreeStorage<T> methods
+  void Allocate(size_t size) override {
+    CHECK(base::bits::IsPowerOfTwo(size + 1));
+    hashes_.resize(size);
+    height_ = base::bits::Log2Floor(size + 1);
+  }
+  size_t GetSize() const override { return hashes_.size(); }
+  const T& GetHash(size_t i) const override {
+    return hashes_[ToBlockedIndex(i)];
+  }
+  void SetHash(size_t i, const T& hash) override {
+    hashes_[ToBlockedIndex(i)] = hash;
+  }
+
+ private:
+  size_t block_height_;
+  // The number of levels of the tree.
+  size_t height_ = 0;
+  base::HugePageVector<T> hashes_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BLOCKED_BINARY_MERKLE_TREE_STORAGE_H_
@@ -0,0 +1,160 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BYTE_HASH_BINARY_MERKLE_HASHER_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BYTE_HASH_BINARY_MERKLE_HASHER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "absl/types/span.h"
+
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_hasher.h"
+#include "tachyon/crypto/hashes/blake3/blake3.h"
+#include "tachyon/crypto/hashes/keccak/keccak.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
+
+namespace tachyon::crypto {
+
+// A |BinaryMerkleHasher| whose hashes are the bytes of |ByteHash|, e.g.,
+// |Keccak256| for commitments verifiable in the EVM.
+//
+// A leaf is a prime field or a container of them. Every element is written as
+// the big-endian bytes of its |BigInt|, which is how the EVM encodes a uint256
+// for a 256-bit field, and those bytes are fed to the hash from the stack, so
+// hashing a leaf doesn't allocate. A parent is the hash of the 2 children
+// concatenated.
+//
+// |MultiLaneHash| hashes |MultiLaneHash::kLanes| inputs of the same size at
+// once, which is used for batches of leaves that serialize to the same size
+// and for batches of parents.
+template <typename Leaf, typename ByteHash, typename MultiLaneHash>
+class ByteHashBinaryMerkleHasher final
+    : public BinaryMerkleHasher<Leaf, typename ByteHash::Digest> {
+ public:
+  using Digest = typename ByteHash::Digest;
+
+  constexpr static size_t kLanes = MultiLaneHash::kLanes;
+
+  // BinaryMerkleHasher<Leaf, Digest> methods
+  Digest ComputeLeafHash(const Leaf& leaf) const override {
+    ByteHash hasher;
+    if constexpr (math::FiniteFieldTraits<Leaf>::kIsPrimeField) {
+      UpdateElement(hasher, leaf);
+    } else {
+      for (const auto& element : leaf) {
+        UpdateElement(hasher, element);
+      }
+    }
+    return hasher.Finalize();
+  }
+
+  size_t GetLeafHashBatchSize() const override { return kLanes; }
+
+  void ComputeLeafHashes(absl::Span<const Leaf> leaves,
+                         absl::Span<Digest> hashes) const override {
+    if (!CanHashInLanes(leaves)) {
+      BinaryMerkleHasher<Leaf, Digest>::ComputeLeafHashes(leaves, hashes);
+      return;
+    }
+    MultiLaneHash hasher;
+    if constexpr (math::FiniteFieldTraits<Leaf>::kIsPrimeField) {
+      UpdateElements(hasher, leaves,
+                     [](const Leaf& leaf) -> const Leaf& { return leaf; });
+    } else {
+      size_t num_elements = std::size(leaves[0]);
+      for (size_t i = 0; i < num_elements; ++i) {
+        UpdateElements(hasher, leaves, [i](const Leaf& leaf) -> const auto& {
+          return leaf[i];
+        });
+      }
+    }
+    std::array<Digest, kLanes> digests = hasher.Finalize();
+    std::copy(digests.begin(), digests.end(), hashes.begin());
+  }
+
+  Digest ComputeParentHash(const Digest& left,
+                           const Digest& right) const override {
+    ByteHash hasher;
+    hasher.Update(left);
+    hasher.Update(right);
+    return hasher.Finalize();
+  }
+
+  size_t GetParentHashBatchSize() const override { return kLanes; }
+
+  void ComputeParentHashes(absl::Span<const Digest> children,
+                           absl::Span<Digest> parents) const override {
+    if (parents.size() != kLanes) {
+      BinaryMerkleHasher<Leaf, Digest>::ComputeParentHashes(children, parents);
+      return;
+    }
+    MultiLaneHash hasher;
+    std::array<absl::Span<const uint8_t>, kLanes> inputs;
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      inputs[lane] = children[2 * lane];
+    }
+    hasher.Update(inputs);
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      inputs[lane] = children[2 * lane + 1];
+    }
+    hasher.Update(inputs);
+    std::array<Digest, kLanes> digests = hasher.Finalize();
+    std::copy(digests.begin(), digests.end(), parents.begin());
+  }
+
+ private:
+  template <typename F>
+  static void UpdateElement(ByteHash& hasher, const F& element) {
+    static_assert(math::FiniteFieldTraits<F>::kIsPrimeField,
+                  "Only prime fields can be serialized into a leaf");
+    hasher.Update(element.ToBigInt().ToBytesBE());
+  }
+
+  // Feeds |lane_element(leaves[lane])| to every lane.
+  template <typename LaneElement>
+  static void UpdateElements(MultiLaneHash& hasher,
+                             absl::Span<const Leaf> leaves,
+                             LaneElement lane_element) {
+    using F = std::decay_t<decltype(lane_element(leaves[0]))>;
+    using Bytes = decltype(std::declval<F>().ToBigInt().ToBytesBE());
+    std::array<Bytes, kLanes> bytes;
+    std::array<absl::Span<const uint8_t>, kLanes> inputs;
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      bytes[lane] = lane_element(leaves[lane]).ToBigInt().ToBytesBE();
+      inputs[lane] = bytes[lane];
+    }
+    hasher.Update(inputs);
+  }
+
+  // Returns true if |leaves| fill every lane and serialize to the same size,
+  // which |MultiLaneHash| can hash.
+  static bool CanHashInLanes(absl::Span<const Leaf> leaves) {
+    if (leaves.size() != kLanes) return false;
+    if constexpr (math::FiniteFieldTraits<Leaf>::kIsPrimeField) {
+      return Leaf::BigIntTy::kByteNums <= MultiLaneHash::kMaxSize;
+    } else {
+      using F = std::decay_t<decltype(*std::begin(leaves[0]))>;
+      size_t num_elements = std::size(leaves[0]);
+      for (const Leaf& leaf : leaves) {
+        if (std::size(leaf) != num_elements) return false;
+      }
+      return num_elements * F::BigIntTy::kByteNums <= MultiLaneHash::kMaxSize;
+    }
+  }
+};
+
+template <typename Leaf>
+using Keccak256BinaryMerkleHasher =
+    ByteHashBinaryMerkleHasher<Leaf, Keccak256, Keccak256x4>;
+
+template <typename Leaf>
+using Blake3BinaryMerkleHasher =
+    ByteHashBinaryMerkleHasher<Leaf, Blake3, Blake3x8>;
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BYTE_HASH_BINARY_MERKLE_HASHER_H_
@@ -0,0 +1,115 @@
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/byte_hash_binary_merkle_hasher.h"
+
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::crypto {
+
+using F = math::bn254::Fr;
+
+namespace {
+
+template <typename Hasher>
+class ByteHashBinaryMerkleHasherTest : public math::FiniteFieldTest<F> {};
+
+class Keccak256BinaryMerkleHasherTest : public math::FiniteFieldTest<F> {};
+
+template <typename Hasher>
+struct HasherLeaf;
+
+template <typename Leaf, typename ByteHash, typename MultiLaneHash>
+struct HasherLeaf<ByteHashBinaryMerkleHasher<Leaf, ByteHash, MultiLaneHash>> {
+  using Type = Leaf;
+};
+
+}  // namespace
+
+using HasherTypes = testing::Types<
+    Keccak256BinaryMerkleHasher<F>, Blake3BinaryMerkleHasher<F>,
+    Keccak256BinaryMerkleHasher<std::vector<F>>,
+    Blake3BinaryMerkleHasher<std::vector<F>>>;
+TYPED_TEST_SUITE(ByteHashBinaryMerkleHasherTest, HasherTypes);
+
+TYPED_TEST(ByteHashBinaryMerkleHasherTest, ComputeHashes) {
+  using Hasher = TypeParam;
+  using Leaf = typename HasherLeaf<Hasher>::Type;
+  using Digest = typename Hasher::Digest;
+
+  Hasher hasher;
+  std::vector<Leaf> leaves = base::CreateVector(Hasher::kLanes, [](size_t i) {
+    if constexpr (std::is_same_v<Leaf, F>) {
+      return F(i);
+    } else {
+      return base::CreateVector(3, [i](size_t j) { return F(3 * i + j); });
+    }
+  });
+
+  std::vector<Digest> expected_hashes(leaves.size());
+  for (size_t i = 0; i < leaves.size(); ++i) {
+    expected_hashes[i] = hasher.ComputeLeafHash(leaves[i]);
+  }
+  std::vector<Digest> hashes(leaves.size());
+  hasher.ComputeLeafHashes(leaves, absl::MakeSpan(hashes));
+  EXPECT_EQ(hashes, expected_hashes);
+
+  std::vector<Digest> expected_parents(leaves.size() / 2);
+  for (size_t i = 0; i < expected_parents.size(); ++i) {
+    expected_parents[i] =
+        hasher.ComputeParentHash(hashes[2 * i], hashes[2 * i + 1]);
+  }
+  std::vector<Digest> parents(expected_parents.size());
+  hasher.ComputeParentHashes(hashes, absl::MakeSpan(parents));
+  EXPECT_EQ(parents, expected_parents);
+}
+
+TYPED_TEST(ByteHashBinaryMerkleHasherTest, CommitAndVerify) {
+  using Hasher = TypeParam;
+  using Leaf = typename HasherLeaf<Hasher>::Type;
+  using Digest = typename Hasher::Digest;
+  constexpr size_t kN = 32;
+
+  std::vector<Leaf> leaves = base::CreateVector(kN, [](size_t i) {
+    if constexpr (std::is_same_v<Leaf, F>) {
+      return F(i);
+    } else {
+      return std::vector<F>{F(i), F(i + 1)};
+    }
+  });
+
+  Hasher hasher;
+  SimpleBinaryMerkleTreeStorage<Digest> storage;
+  BinaryMerkleTree<Leaf, Digest, kN> tree(&storage, &hasher);
+  Digest commitment;
+  ASSERT_TRUE(tree.Commit(leaves, &commitment));
+
+  BinaryMerkleProof<Digest> proof;
+  ASSERT_TRUE(tree.CreateOpeningProof(5, &proof));
+  EXPECT_TRUE(tree.VerifyOpeningProof(
+      commitment, hasher.ComputeLeafHash(leaves[5]), proof));
+}
+
+TEST_F(Keccak256BinaryMerkleHasherTest, EVMCompatibility) {
+  // A leaf is keccak256(abi.encodePacked(uint256(x))) and a parent is
+  // keccak256(abi.encodePacked(left, right)).
+  Keccak256BinaryMerkleHasher<F> hasher;
+  F leaf(5);
+  Keccak256::Digest leaf_hash = Keccak256::Hash(leaf.ToBigInt().ToBytesBE());
+  EXPECT_EQ(hasher.ComputeLeafHash(leaf), leaf_hash);
+
+  std::array<uint8_t, 2 * Keccak256::kDigestSize> children;
+  std::copy(leaf_hash.begin(), leaf_hash.end(), children.begin());
+  std::copy(leaf_hash.begin(), leaf_hash.end(),
+            children.begin() + Keccak256::kDigestSize);
+  EXPECT_EQ(hasher.ComputeParentHash(leaf_hash, leaf_hash),
+            Keccak256::Hash(children));
+}
+
+}  // namespace tachyon::crypto
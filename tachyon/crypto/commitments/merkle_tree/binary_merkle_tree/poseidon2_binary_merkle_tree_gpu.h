@@ -0,0 +1,204 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON2_BINARY_MERKLE_TREE_GPU_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON2_BINARY_MERKLE_TREE_GPU_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage_gpu.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/kernels/poseidon2_kernels.cu.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_config.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_plonky3_external_matrix.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+
+namespace tachyon::crypto {
+
+// Builds binary merkle trees on the GPU, hashing the leaves with a
+// |Poseidon2Sponge<ExternalMatrix>| of |Width| elements and compressing 2
+// digests of |Chunk| elements into their parent with the same permutation.
+// This is the device counterpart of a |BinaryMerkleTree| whose hasher uses a
+// |PaddingFreeSponge| for the leaves and a |TruncatedPermutation| for the
+// parents.
+//
+// Every layer is written to a |BinaryMerkleTreeStorageGpu| without leaving the
+// device and only the root is copied back. Since the storage has the same
+// layout as the one of |BinaryMerkleTree|, opening proofs can be created by a
+// |BinaryMerkleTree| over the same storage, which copies back just the nodes
+// on the path.
+template <typename ExternalMatrix, size_t Width, size_t Chunk>
+class Poseidon2BinaryMerkleTreeGpu {
+ public:
+  using F = typename ExternalMatrix::Field;
+  using GpuField = typename F::GpuField;
+  using Hash = std::array<F, Chunk>;
+
+  using Plonky3ExternalMatrix =
+      Poseidon2ExternalMatrix<Poseidon2Plonky3ExternalMatrix<F>>;
+
+  constexpr static bool kUsePlonky3ExternalMatrix =
+      std::is_same_v<ExternalMatrix, Plonky3ExternalMatrix>;
+  constexpr static unsigned int kThreadNum = 128;
+
+  static_assert(2 * Chunk <= Width, "2 children must fit in the state");
+
+  Poseidon2BinaryMerkleTreeGpu(const Poseidon2Config<F>& config,
+                               gpuStream_t stream = nullptr)
+      : stream_(stream) {
+    CHECK_EQ(config.rate + config.capacity, Width);
+    rate_ = config.rate;
+
+    size_t num_rounds = config.full_rounds + config.partial_rounds;
+    std::vector<F> ark(num_rounds * Width);
+    for (size_t r = 0; r < num_rounds; ++r) {
+      for (size_t i = 0; i < Width; ++i) {
+        ark[r * Width + i] = config.ark(r, i);
+      }
+    }
+    d_ark_ = device::gpu::GpuMemory<GpuField>::Malloc(ark.size());
+    CHECK(d_ark_.CopyFrom(ark.data(), device::gpu::GpuMemoryType::kHost));
+
+    std::vector<F> diagonal_minus_one = GetInternalDiagonalMinusOne(config);
+    d_internal_diagonal_minus_one_ =
+        device::gpu::GpuMemory<GpuField>::Malloc(Width);
+    CHECK(d_internal_diagonal_minus_one_.CopyFrom(
+        diagonal_minus_one.data(), device::gpu::GpuMemoryType::kHost));
+
+    params_.ark = d_ark_.get();
+    params_.internal_diagonal_minus_one = d_internal_diagonal_minus_one_.get();
+    params_.internal_scale = GetInternalScale(config);
+    params_.full_rounds = config.full_rounds;
+    params_.partial_rounds = config.partial_rounds;
+    params_.alpha = config.alpha;
+  }
+  Poseidon2BinaryMerkleTreeGpu(const Poseidon2BinaryMerkleTreeGpu& other) =
+      delete;
+  Poseidon2BinaryMerkleTreeGpu& operator=(
+      const Poseidon2BinaryMerkleTreeGpu& other) = delete;
+
+  gpuStream_t stream() const { return stream_; }
+
+  // Builds the tree over |num_leaves| leaves of |leaf_size| elements each,
+  // laid out back to back in |d_leaves|, into |storage| and writes the root to
+  // |root|. |num_leaves| must be a power of two.
+  [[nodiscard]] bool Commit(const device::gpu::GpuMemory<GpuField>& d_leaves,
+                            size_t num_leaves, size_t leaf_size,
+                            BinaryMerkleTreeStorageGpu<F, Chunk>* storage,
+                            Hash* root) const {
+    TRACE_EVENT("gpu", "Poseidon2BinaryMerkleTreeGpu::Commit");
+    if (!base::bits::IsPowerOfTwo(num_leaves)) {
+      LOG(ERROR) << num_leaves << " is not a power of two";
+      return false;
+    }
+    if (d_leaves.size() < num_leaves * leaf_size) {
+      LOG(ERROR) << "d_leaves.size() is smaller than num_leaves * leaf_size";
+      return false;
+    }
+
+    storage->Allocate(2 * num_leaves - 1);
+    GpuField* d_nodes = storage->d_nodes().get();
+
+    kernels::Poseidon2HashLeaves<GpuField, Width, kUsePlonky3ExternalMatrix>
+        <<<GetGrid(num_leaves), kThreadNum, 0, stream_>>>(
+            d_leaves.get(), leaf_size, rate_, Chunk, params_,
+            d_nodes + (num_leaves - 1) * Chunk, num_leaves);
+    if (LOG_IF_GPU_LAST_ERROR("Failed to kernels::Poseidon2HashLeaves()") !=
+        gpuSuccess) {
+      return false;
+    }
+
+    // The layer below the parents in [|from|, 2 * |from| + 1) is in
+    // [2 * |from| + 1, 4 * |from| + 3).
+    for (size_t parents = num_leaves / 2; parents > 0; parents /= 2) {
+      size_t from = parents - 1;
+      kernels::Poseidon2CompressPairs<GpuField, Width,
+                                      kUsePlonky3ExternalMatrix>
+          <<<GetGrid(parents), kThreadNum, 0, stream_>>>(
+              d_nodes + (2 * from + 1) * Chunk, Chunk, params_,
+              d_nodes + from * Chunk, parents);
+      if (LOG_IF_GPU_LAST_ERROR(
+              "Failed to kernels::Poseidon2CompressPairs()") != gpuSuccess) {
+        return false;
+      }
+    }
+    if (LOG_IF_GPU_ERROR(gpuStreamSynchronize(stream_),
+                         "Failed to gpuStreamSynchronize()") != gpuSuccess) {
+      return false;
+    }
+
+    storage->Invalidate();
+    *root = storage->GetHash(0);
+    return true;
+  }
+
+  // Same as above, but uploads |leaves| first, which holds |num_leaves| leaves
+  // of |leaves.size()| / |num_leaves| elements each.
+  [[nodiscard]] bool Commit(absl::Span<const F> leaves, size_t num_leaves,
+                            BinaryMerkleTreeStorageGpu<F, Chunk>* storage,
+                            Hash* root) const {
+    if (num_leaves == 0 || leaves.size() % num_leaves != 0) {
+      LOG(ERROR) << "leaves.size() is not a multiple of num_leaves";
+      return false;
+    }
+    auto d_leaves = device::gpu::GpuMemory<GpuField>::Malloc(leaves.size());
+    if (!d_leaves.CopyFrom(leaves.data(), device::gpu::GpuMemoryType::kHost)) {
+      return false;
+    }
+    return Commit(d_leaves, num_leaves, leaves.size() / num_leaves, storage,
+                  root);
+  }
+
+ private:
+  // The plonky3 internal matrix of a scalar field is described by
+  // |Poseidon2Config::internal_shifts|, which is equivalent to the diagonal
+  // -2, 2^(shifts₀), 2^(shifts₁), .... See |Poseidon2Plonky3InternalMatrix|.
+  static std::vector<F> GetInternalDiagonalMinusOne(
+      const Poseidon2Config<F>& config) {
+    std::vector<F> ret(Width);
+    if (config.internal_diagonal_minus_one.size() ==
+        static_cast<Eigen::Index>(Width)) {
+      for (size_t i = 0; i < Width; ++i) {
+        ret[i] = config.internal_diagonal_minus_one[i];
+      }
+      return ret;
+    }
+    CHECK(config.use_plonky3_internal_matrix);
+    CHECK_EQ(config.internal_shifts.size() + 1,
+             static_cast<Eigen::Index>(Width));
+    ret[0] = -F(2);
+    for (size_t i = 1; i < Width; ++i) {
+      ret[i] = F(uint32_t{1} << config.internal_shifts[i - 1]);
+    }
+    return ret;
+  }
+
+  static GpuField GetInternalScale(const Poseidon2Config<F>& config) {
+    if constexpr (F::Config::kModulusBits <= 32 &&
+                  F::Config::kUseMontgomery) {
+      if (config.use_plonky3_internal_matrix) return F::FromMontgomery(1);
+    }
+    return F::One();
+  }
+
+  static unsigned int GetGrid(size_t threads) {
+    return (threads + kThreadNum - 1) / kThreadNum;
+  }
+
+  // not owned
+  gpuStream_t stream_ = nullptr;
+  size_t rate_ = 0;
+  device::gpu::GpuMemory<GpuField> d_ark_;
+  device::gpu::GpuMemory<GpuField> d_internal_diagonal_minus_one_;
+  kernels::Poseidon2ParamsGpu<GpuField> params_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON2_BINARY_MERKLE_TREE_GPU_H_
@@ -0,0 +1,190 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_FIELD_MERKLE_TREE_FIELD_MERKLE_TREE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_FIELD_MERKLE_TREE_FIELD_MERKLE_TREE_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/math/matrix/matrix_types.h"
+
+namespace tachyon::crypto {
+
+// A merkle tree over the rows of matrices of field elements of possibly
+// different heights, where every height is a power of two.
+//
+// The leaves are the hashes of the rows of the tallest matrices, each of
+// which hashes the rows at the same index of all of them concatenated. The
+// rows of every shorter matrix are hashed the same way and injected at the
+// layer as wide as it is tall: each node of that layer is the compression of
+// the node built from its children and the hash of the matching rows.
+//
+// The rows are read directly from the row-major matrices, so no transposed
+// copy of the matrices is needed.
+template <typename F, size_t N>
+class FieldMerkleTree {
+ public:
+  using Digest = std::array<F, N>;
+
+  FieldMerkleTree() = default;
+
+  // Returns false if |leaves| is empty or one of the heights is not a power of
+  // two.
+  static bool IsValidLeaves(absl::Span<const math::RowMajorMatrix<F>> leaves) {
+    if (leaves.empty()) {
+      LOG(ERROR) << "No matrices to commit";
+      return false;
+    }
+    for (const math::RowMajorMatrix<F>& matrix : leaves) {
+      if (!base::bits::IsPowerOfTwo(matrix.rows())) {
+        LOG(ERROR) << "The height " << matrix.rows()
+                   << " is not a power of two";
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename Hasher, typename Compressor>
+  static FieldMerkleTree Build(const Hasher& hasher,
+                               const Compressor& compressor,
+                               std::vector<math::RowMajorMatrix<F>>&& leaves) {
+    TRACE_EVENT("merkle", "FieldMerkleTree::Build");
+    CHECK(IsValidLeaves(leaves));
+
+    std::vector<size_t> sorted_indices = GetSortedIndices(leaves);
+    std::vector<std::vector<Digest>> digest_layers;
+
+    size_t i = 0;
+    std::vector<const math::RowMajorMatrix<F>*> matrices =
+        TakeMatricesOfHeight(leaves, sorted_indices,
+                             leaves[sorted_indices[0]].rows(), i);
+    digest_layers.push_back(CreateFirstDigestLayer(hasher, matrices));
+
+    while (digest_layers.back().size() > 1) {
+      size_t next_layer_size = digest_layers.back().size() / 2;
+      matrices =
+          TakeMatricesOfHeight(leaves, sorted_indices, next_layer_size, i);
+      digest_layers.push_back(CompressAndInject(
+          hasher, compressor, digest_layers.back(), matrices));
+    }
+    return FieldMerkleTree(std::move(leaves), std::move(digest_layers));
+  }
+
+  const std::vector<math::RowMajorMatrix<F>>& leaves() const {
+    return leaves_;
+  }
+  const std::vector<std::vector<Digest>>& digest_layers() const {
+    return digest_layers_;
+  }
+
+  const Digest& GetRoot() const { return digest_layers_.back()[0]; }
+
+  // Returns the indices of |leaves| sorted by their heights in descending
+  // order. Matrices of the same height keep their order.
+  static std::vector<size_t> GetSortedIndices(
+      absl::Span<const math::RowMajorMatrix<F>> leaves) {
+    std::vector<size_t> ret(leaves.size());
+    std::iota(ret.begin(), ret.end(), 0);
+    std::stable_sort(ret.begin(), ret.end(), [leaves](size_t a, size_t b) {
+      return leaves[a].rows() > leaves[b].rows();
+    });
+    return ret;
+  }
+
+  // Hashes the rows at |row| of |matrices| concatenated. The rows are read in
+  // place, and |rows| only holds the views of them so that it can be reused
+  // across the calls.
+  template <typename Hasher>
+  static Digest HashRows(
+      const Hasher& hasher,
+      absl::Span<const math::RowMajorMatrix<F>* const> matrices, size_t row,
+      std::vector<absl::Span<const F>>& rows) {
+    rows.clear();
+    for (const math::RowMajorMatrix<F>* matrix : matrices) {
+      rows.emplace_back(matrix->data() + row * matrix->cols(), matrix->cols());
+    }
+    return hasher.HashRows(rows);
+  }
+
+ private:
+  FieldMerkleTree(std::vector<math::RowMajorMatrix<F>>&& leaves,
+                  std::vector<std::vector<Digest>>&& digest_layers)
+      : leaves_(std::move(leaves)), digest_layers_(std::move(digest_layers)) {}
+
+  // Returns the matrices of |height| starting at |sorted_indices[i]| and
+  // advances |i| past them.
+  static std::vector<const math::RowMajorMatrix<F>*> TakeMatricesOfHeight(
+      const std::vector<math::RowMajorMatrix<F>>& leaves,
+      const std::vector<size_t>& sorted_indices, size_t height, size_t& i) {
+    std::vector<const math::RowMajorMatrix<F>*> ret;
+    while (i < sorted_indices.size() &&
+           static_cast<size_t>(leaves[sorted_indices[i]].rows()) == height) {
+      ret.push_back(&leaves[sorted_indices[i++]]);
+    }
+    return ret;
+  }
+
+  // NOTE: The hashers and the compressors may keep a mutable state, so every
+  // chunk works with its own copy of them.
+  template <typename Hasher>
+  static std::vector<Digest> CreateFirstDigestLayer(
+      const Hasher& hasher,
+      const std::vector<const math::RowMajorMatrix<F>*>& matrices) {
+    std::vector<Digest> ret(matrices[0]->rows());
+    base::Parallelize(ret, [&hasher, &matrices](absl::Span<Digest> chunk,
+                                                size_t chunk_offset,
+                                                size_t chunk_size) {
+      Hasher chunk_hasher = hasher;
+      std::vector<absl::Span<const F>> rows;
+      size_t start = chunk_offset * chunk_size;
+      for (size_t i = 0; i < chunk.size(); ++i) {
+        chunk[i] = HashRows(chunk_hasher, matrices, start + i, rows);
+      }
+    });
+    return ret;
+  }
+
+  template <typename Hasher, typename Compressor>
+  static std::vector<Digest> CompressAndInject(
+      const Hasher& hasher, const Compressor& compressor,
+      const std::vector<Digest>& prev_layer,
+      const std::vector<const math::RowMajorMatrix<F>*>& matrices) {
+    std::vector<Digest> ret(prev_layer.size() / 2);
+    base::Parallelize(ret, [&](absl::Span<Digest> chunk, size_t chunk_offset,
+                               size_t chunk_size) {
+      Hasher chunk_hasher = hasher;
+      Compressor chunk_compressor = compressor;
+      std::vector<absl::Span<const F>> rows;
+      size_t start = chunk_offset * chunk_size;
+      for (size_t i = 0; i < chunk.size(); ++i) {
+        size_t idx = start + i;
+        chunk[i] = chunk_compressor.Compress(
+            absl::MakeConstSpan(&prev_layer[2 * idx], 2));
+        if (!matrices.empty()) {
+          chunk[i] = chunk_compressor.Compress(std::array<Digest, 2>{
+              chunk[i], HashRows(chunk_hasher, matrices, idx, rows)});
+        }
+      }
+    });
+    return ret;
+  }
+
+  std::vector<math::RowMajorMatrix<F>> leaves_;
+  // |digest_layers_[0]| is as wide as the tallest matrices and
+  // |digest_layers_.back()| only has the root.
+  std::vector<std::vector<Digest>> digest_layers_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_FIELD_MERKLE_TREE_FIELD_MERKLE_TREE_H_
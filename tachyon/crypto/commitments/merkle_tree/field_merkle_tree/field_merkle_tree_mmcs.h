@@ -0,0 +1,178 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_FIELD_MERKLE_TREE_FIELD_MERKLE_TREE_MMCS_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_FIELD_MERKLE_TREE_FIELD_MERKLE_TREE_MMCS_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/commitments/merkle_tree/field_merkle_tree/field_merkle_tree.h"
+#include "tachyon/crypto/commitments/mixed_matrix_commitment_scheme.h"
+
+namespace tachyon::crypto {
+
+// A |MixedMatrixCommitmentScheme| backed by a |FieldMerkleTree|. An opening
+// proof is the siblings on the path from the leaf at the opened index to the
+// root.
+template <typename F, typename Hasher, typename Compressor, size_t N>
+class FieldMerkleTreeMMCS final
+    : public MixedMatrixCommitmentScheme<
+          FieldMerkleTreeMMCS<F, Hasher, Compressor, N>> {
+ public:
+  using Digest = std::array<F, N>;
+  using Commitment = Digest;
+  using ProverData = FieldMerkleTree<F, N>;
+  using Proof = std::vector<Digest>;
+
+  FieldMerkleTreeMMCS() = default;
+  FieldMerkleTreeMMCS(const Hasher& hasher, const Compressor& compressor)
+      : hasher_(hasher), compressor_(compressor) {}
+  FieldMerkleTreeMMCS(Hasher&& hasher, Compressor&& compressor)
+      : hasher_(std::move(hasher)), compressor_(std::move(compressor)) {}
+
+  const Hasher& hasher() const { return hasher_; }
+  const Compressor& compressor() const { return compressor_; }
+
+ private:
+  friend class MixedMatrixCommitmentScheme<
+      FieldMerkleTreeMMCS<F, Hasher, Compressor, N>>;
+
+  [[nodiscard]] bool DoCommit(std::vector<math::RowMajorMatrix<F>>&& matrices,
+                              Commitment* commitment,
+                              ProverData* prover_data) const {
+    if (!ProverData::IsValidLeaves(matrices)) return false;
+    *prover_data =
+        ProverData::Build(hasher_, compressor_, std::move(matrices));
+    *commitment = prover_data->GetRoot();
+    return true;
+  }
+
+  [[nodiscard]] bool DoCreateOpeningProof(
+      size_t index, const ProverData& prover_data,
+      std::vector<std::vector<F>>* openings, Proof* proof) const {
+    const std::vector<math::RowMajorMatrix<F>>& leaves = prover_data.leaves();
+    const std::vector<std::vector<Digest>>& digest_layers =
+        prover_data.digest_layers();
+    size_t max_height = digest_layers[0].size();
+    if (index >= max_height) {
+      LOG(ERROR) << "Index " << index << " is out of range";
+      return false;
+    }
+    size_t log_max_height = base::bits::Log2Floor(max_height);
+
+    openings->resize(leaves.size());
+    for (size_t i = 0; i < leaves.size(); ++i) {
+      const math::RowMajorMatrix<F>& matrix = leaves[i];
+      size_t log_height = base::bits::Log2Floor(matrix.rows());
+      size_t row = index >> (log_max_height - log_height);
+      const F* row_ptr = matrix.data() + row * matrix.cols();
+      (*openings)[i] = std::vector<F>(row_ptr, row_ptr + matrix.cols());
+    }
+
+    proof->resize(log_max_height);
+    for (size_t i = 0; i < log_max_height; ++i) {
+      (*proof)[i] = digest_layers[i][(index >> i) ^ 1];
+    }
+    return true;
+  }
+
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Commitment& commitment, absl::Span<const Dimensions> dimensions,
+      size_t index, absl::Span<const std::vector<F>> openings,
+      const Proof& proof) const {
+    if (dimensions.empty() || dimensions.size() != openings.size()) {
+      LOG(ERROR) << "The number of dimensions and openings doesn't match";
+      return false;
+    }
+    for (size_t i = 0; i < dimensions.size(); ++i) {
+      if (!base::bits::IsPowerOfTwo(dimensions[i].height)) {
+        LOG(ERROR) << "The height " << dimensions[i].height
+                   << " is not a power of two";
+        return false;
+      }
+      if (openings[i].size() != dimensions[i].width) {
+        LOG(ERROR) << "The opening of matrix " << i
+                   << " doesn't match its width";
+        return false;
+      }
+    }
+
+    std::vector<size_t> sorted_indices(dimensions.size());
+    std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
+    std::stable_sort(sorted_indices.begin(), sorted_indices.end(),
+                     [dimensions](size_t a, size_t b) {
+                       return dimensions[a].height > dimensions[b].height;
+                     });
+
+    size_t height = dimensions[sorted_indices[0]].height;
+    if (proof.size() != base::bits::Log2Floor(height)) {
+      LOG(ERROR) << "The proof doesn't match the tallest height";
+      return false;
+    }
+    if (index >= height) {
+      LOG(ERROR) << "Index " << index << " is out of range";
+      return false;
+    }
+
+    size_t i = 0;
+    Digest root = HashOpeningsOfHeight(dimensions, openings, sorted_indices,
+                                       height, i);
+    for (const Digest& sibling : proof) {
+      if (index & 1) {
+        root = compressor_.Compress(std::array<Digest, 2>{sibling, root});
+      } else {
+        root = compressor_.Compress(std::array<Digest, 2>{root, sibling});
+      }
+      index >>= 1;
+      height >>= 1;
+      if (i < sorted_indices.size() &&
+          dimensions[sorted_indices[i]].height == height) {
+        root = compressor_.Compress(std::array<Digest, 2>{
+            root, HashOpeningsOfHeight(dimensions, openings, sorted_indices,
+                                       height, i)});
+      }
+    }
+    if (i != sorted_indices.size()) {
+      LOG(ERROR) << "Some matrices are shorter than the tree";
+      return false;
+    }
+    return root == commitment;
+  }
+
+  // Hashes the openings of the matrices of |height| starting at
+  // |sorted_indices[i]| concatenated and advances |i| past them.
+  Digest HashOpeningsOfHeight(absl::Span<const Dimensions> dimensions,
+                              absl::Span<const std::vector<F>> openings,
+                              const std::vector<size_t>& sorted_indices,
+                              size_t height, size_t& i) const {
+    std::vector<absl::Span<const F>> rows;
+    while (i < sorted_indices.size() &&
+           dimensions[sorted_indices[i]].height == height) {
+      rows.emplace_back(openings[sorted_indices[i++]]);
+    }
+    return hasher_.HashRows(rows);
+  }
+
+  Hasher hasher_;
+  Compressor compressor_;
+};
+
+template <typename F, typename Hasher, typename Compressor, size_t N>
+struct MixedMatrixCommitmentSchemeTraits<
+    FieldMerkleTreeMMCS<F, Hasher, Compressor, N>> {
+  using Field = F;
+  using Commitment = std::array<F, N>;
+  using ProverData = FieldMerkleTree<F, N>;
+  using Proof = std::vector<std::array<F, N>>;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_FIELD_MERKLE_TREE_FIELD_MERKLE_TREE_MMCS_H_
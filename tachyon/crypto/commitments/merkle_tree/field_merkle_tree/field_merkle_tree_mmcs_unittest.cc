@@ -0,0 +1,154 @@
+#include "tachyon/crypto/commitments/merkle_tree/field_merkle_tree/field_merkle_tree_mmcs.h"
+
+#include <array>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/crypto/hashes/sponge/padding_free_sponge.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_horizen_external_matrix.h"
+#include "tachyon/crypto/hashes/sponge/truncated_permutation.h"
+#include "tachyon/math/finite_fields/baby_bear/poseidon2.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+constexpr size_t kRate = 8;
+constexpr size_t kChunk = 8;
+
+using F = math::BabyBear;
+using Poseidon2 =
+    Poseidon2Sponge<Poseidon2ExternalMatrix<Poseidon2HorizenExternalMatrix<F>>>;
+using MyHasher = PaddingFreeSponge<Poseidon2, kRate, kChunk>;
+using MyCompressor = TruncatedPermutation<Poseidon2, kChunk, 2>;
+using MMCS = FieldMerkleTreeMMCS<F, MyHasher, MyCompressor, kChunk>;
+using Digest = MMCS::Digest;
+
+class FieldMerkleTreeMMCSTest : public math::FiniteFieldTest<F> {
+ public:
+  void SetUp() override {
+    Poseidon2Config<F> config = Poseidon2Config<F>::CreateCustom(
+        15, 7, 8, 13, math::GetPoseidon2BabyBearInternalShiftVector<15>());
+    Poseidon2 sponge(config);
+    hasher_.emplace(sponge);
+    compressor_.emplace(sponge);
+    mmcs_.emplace(*hasher_, *compressor_);
+  }
+
+  static math::RowMajorMatrix<F> CreateRandomMatrix(size_t rows,
+                                                    size_t cols) {
+    math::RowMajorMatrix<F> ret(rows, cols);
+    for (Eigen::Index i = 0; i < ret.size(); ++i) {
+      ret.data()[i] = F::Random();
+    }
+    return ret;
+  }
+
+ protected:
+  std::optional<MyHasher> hasher_;
+  std::optional<MyCompressor> compressor_;
+  std::optional<MMCS> mmcs_;
+};
+
+}  // namespace
+
+TEST_F(FieldMerkleTreeMMCSTest, CommitSingleMatrix) {
+  math::RowMajorMatrix<F> matrix = CreateRandomMatrix(4, 10);
+
+  std::vector<Digest> leaves(4);
+  for (size_t i = 0; i < 4; ++i) {
+    std::vector<F> row(matrix.row(i).begin(), matrix.row(i).end());
+    leaves[i] = hasher_->Hash(row);
+  }
+  Digest expected = compressor_->Compress(std::array<Digest, 2>{
+      compressor_->Compress(std::array<Digest, 2>{leaves[0], leaves[1]}),
+      compressor_->Compress(std::array<Digest, 2>{leaves[2], leaves[3]})});
+
+  std::vector<math::RowMajorMatrix<F>> matrices;
+  matrices.push_back(std::move(matrix));
+  Digest commitment;
+  FieldMerkleTree<F, kChunk> prover_data;
+  ASSERT_TRUE(mmcs_->Commit(std::move(matrices), &commitment, &prover_data));
+  EXPECT_EQ(commitment, expected);
+}
+
+TEST_F(FieldMerkleTreeMMCSTest, CommitMatricesOfDifferentHeights) {
+  math::RowMajorMatrix<F> tall = CreateRandomMatrix(4, 3);
+  math::RowMajorMatrix<F> short_ = CreateRandomMatrix(2, 5);
+
+  std::vector<Digest> leaves(4);
+  for (size_t i = 0; i < 4; ++i) {
+    std::vector<F> row(tall.row(i).begin(), tall.row(i).end());
+    leaves[i] = hasher_->Hash(row);
+  }
+  std::vector<Digest> layer(2);
+  for (size_t i = 0; i < 2; ++i) {
+    std::vector<F> row(short_.row(i).begin(), short_.row(i).end());
+    layer[i] = compressor_->Compress(std::array<Digest, 2>{
+        compressor_->Compress(
+            std::array<Digest, 2>{leaves[2 * i], leaves[2 * i + 1]}),
+        hasher_->Hash(row)});
+  }
+  Digest expected =
+      compressor_->Compress(std::array<Digest, 2>{layer[0], layer[1]});
+
+  std::vector<math::RowMajorMatrix<F>> matrices;
+  matrices.push_back(std::move(short_));
+  matrices.push_back(std::move(tall));
+  Digest commitment;
+  FieldMerkleTree<F, kChunk> prover_data;
+  ASSERT_TRUE(mmcs_->Commit(std::move(matrices), &commitment, &prover_data));
+  EXPECT_EQ(commitment, expected);
+}
+
+TEST_F(FieldMerkleTreeMMCSTest, CreateAndVerifyOpeningProof) {
+  std::vector<math::RowMajorMatrix<F>> matrices;
+  matrices.push_back(CreateRandomMatrix(8, 3));
+  matrices.push_back(CreateRandomMatrix(2, 5));
+  matrices.push_back(CreateRandomMatrix(8, 2));
+  matrices.push_back(CreateRandomMatrix(1, 4));
+  std::vector<Dimensions> dimensions = {{3, 8}, {5, 2}, {2, 8}, {4, 1}};
+
+  Digest commitment;
+  FieldMerkleTree<F, kChunk> prover_data;
+  ASSERT_TRUE(mmcs_->Commit(std::move(matrices), &commitment, &prover_data));
+
+  for (size_t index = 0; index < 8; ++index) {
+    std::vector<std::vector<F>> openings;
+    std::vector<Digest> proof;
+    ASSERT_TRUE(
+        mmcs_->CreateOpeningProof(index, prover_data, &openings, &proof));
+    ASSERT_EQ(openings.size(), size_t{4});
+    EXPECT_EQ(openings[1].size(), size_t{5});
+    EXPECT_EQ(openings[1][0], prover_data.leaves()[1](index >> 2, 0));
+    EXPECT_TRUE(mmcs_->VerifyOpeningProof(commitment, dimensions, index,
+                                          openings, proof));
+    EXPECT_FALSE(mmcs_->VerifyOpeningProof(commitment, dimensions,
+                                           index ^ 1, openings, proof));
+
+    openings[1][0] += F::One();
+    EXPECT_FALSE(mmcs_->VerifyOpeningProof(commitment, dimensions, index,
+                                           openings, proof));
+  }
+
+  std::vector<std::vector<F>> openings;
+  std::vector<Digest> proof;
+  EXPECT_FALSE(mmcs_->CreateOpeningProof(8, prover_data, &openings, &proof));
+}
+
+TEST_F(FieldMerkleTreeMMCSTest, InvalidMatrices) {
+  Digest commitment;
+  FieldMerkleTree<F, kChunk> prover_data;
+  EXPECT_FALSE(mmcs_->Commit({}, &commitment, &prover_data));
+
+  std::vector<math::RowMajorMatrix<F>> matrices;
+  matrices.push_back(CreateRandomMatrix(3, 2));
+  EXPECT_FALSE(mmcs_->Commit(std::move(matrices), &commitment, &prover_data));
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,78 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MIXED_MATRIX_COMMITMENT_SCHEME_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MIXED_MATRIX_COMMITMENT_SCHEME_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/crypto/commitments/mixed_matrix_commitment_scheme_traits_forward.h"
+#include "tachyon/math/matrix/matrix_types.h"
+
+namespace tachyon::crypto {
+
+// The width and the height of a committed matrix, which is all a verifier
+// needs to know about it.
+struct Dimensions {
+  size_t width = 0;
+  size_t height = 0;
+
+  bool operator==(const Dimensions& other) const {
+    return width == other.width && height == other.height;
+  }
+  bool operator!=(const Dimensions& other) const { return !operator==(other); }
+};
+
+// A commitment scheme to a batch of matrices of possibly different heights,
+// whose openings reveal a whole row of every matrix at once. A row index of
+// the tallest matrix is mapped to the row of a shorter matrix by dropping its
+// low bits, i.e., the i-th row of a matrix |k| times shorter is opened
+// together with the |k * i|-th to the |k * (i + 1) - 1|-th rows of the
+// tallest one.
+template <typename Derived>
+class MixedMatrixCommitmentScheme {
+ public:
+  using Field = typename MixedMatrixCommitmentSchemeTraits<Derived>::Field;
+  using Commitment =
+      typename MixedMatrixCommitmentSchemeTraits<Derived>::Commitment;
+  using ProverData =
+      typename MixedMatrixCommitmentSchemeTraits<Derived>::ProverData;
+  using Proof = typename MixedMatrixCommitmentSchemeTraits<Derived>::Proof;
+
+  // Commits to |matrices| and populates |commitment| and |prover_data|, which
+  // keeps |matrices| to create opening proofs later.
+  [[nodiscard]] bool Commit(std::vector<math::RowMajorMatrix<Field>>&& matrices,
+                            Commitment* commitment,
+                            ProverData* prover_data) const {
+    const Derived* derived = static_cast<const Derived*>(this);
+    return derived->DoCommit(std::move(matrices), commitment, prover_data);
+  }
+
+  // Opens the row at |index| of every matrix committed in |prover_data| and
+  // populates |openings| with the rows, in the order of the matrices, and
+  // |proof| with what is needed to verify them. |index| is a row index of the
+  // tallest matrix.
+  [[nodiscard]] bool CreateOpeningProof(
+      size_t index, const ProverData& prover_data,
+      std::vector<std::vector<Field>>* openings, Proof* proof) const {
+    const Derived* derived = static_cast<const Derived*>(this);
+    return derived->DoCreateOpeningProof(index, prover_data, openings, proof);
+  }
+
+  // Verifies that |openings| are the rows at |index| of the matrices of
+  // |dimensions| committed to |commitment|.
+  [[nodiscard]] bool VerifyOpeningProof(
+      const Commitment& commitment, absl::Span<const Dimensions> dimensions,
+      size_t index, absl::Span<const std::vector<Field>> openings,
+      const Proof& proof) const {
+    const Derived* derived = static_cast<const Derived*>(this);
+    return derived->DoVerifyOpeningProof(commitment, dimensions, index,
+                                         openings, proof);
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MIXED_MATRIX_COMMITMENT_SCHEME_H_
@@ -8,15 +8,20 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/base/strings/string_util.h"
 #include "tachyon/crypto/commitments/vector_commitment_scheme.h"
+#include "tachyon/math/elliptic_curves/msm/precomputed_bases_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 
@@ -32,6 +37,7 @@ class Pedersen final
  public:
   using Field = typename Point::ScalarField;
   using Bucket = typename math::Pippenger<Point>::Bucket;
+  using PrecomputedMSM = math::PrecomputedBasesMSM<Point>;
 
   Pedersen() = default;
   Pedersen(const Point& h, const std::vector<Point>& generators)
@@ -45,6 +51,71 @@ class Pedersen final
 
   const Point& h() const { return h_; }
   const std::vector<Point>& generators() const { return generators_; }
+  const PrecomputedMSM& precomputed_generators() const {
+    return precomputed_generators_;
+  }
+
+  bool IsPrecomputed() const { return precomputed_generators_.size() != 0; }
+
+  // Builds the table of |math::PrecomputedBasesMSM| from the generators, after
+  // which the commitments are computed with it. The table takes
+  // |precompute_factor| times as much memory as the generators. See
+  // |math::PrecomputedBasesMSM|.
+  [[nodiscard]] bool Precompute(
+      size_t precompute_factor = PrecomputedMSM::kDefaultPrecomputeFactor) {
+    return precomputed_generators_.Precompute(generators_, precompute_factor);
+  }
+
+  // Sets the table built by |Precompute()| before, e.g., the one read from a
+  // file.
+  [[nodiscard]] bool SetPrecomputed(PrecomputedMSM&& precomputed_generators) {
+    if (precomputed_generators.size() < N()) {
+      LOG(ERROR) << "Precomputed table is smaller than the generators";
+      return false;
+    }
+    precomputed_generators_ = std::move(precomputed_generators);
+    return true;
+  }
+
+  // Commits to each of |v_list| blinded by the corresponding |r_list| in one
+  // pass and populates |out| with the commitments in the same order. Unlike
+  // calling |Commit()| for each of them, the generators are loaded once for
+  // all the commitments, unless they are precomputed.
+  [[nodiscard]] bool BatchCommit(
+      absl::Span<const absl::Span<const Field>> v_list,
+      absl::Span<const Field> r_list, std::vector<Commitment>* out) const {
+    if (v_list.size() != r_list.size()) {
+      LOG(ERROR) << "Vectors and blinding factors differ in length: "
+                 << v_list.size() << " != " << r_list.size();
+      return false;
+    }
+    std::vector<Bucket> results;
+    if (IsPrecomputed()) {
+      results.resize(v_list.size());
+      for (size_t i = 0; i < v_list.size(); ++i) {
+        if (!precomputed_generators_.Run(v_list[i], &results[i])) return false;
+      }
+    } else {
+      size_t size = 0;
+      for (absl::Span<const Field> v : v_list) {
+        size = std::max(size, v.size());
+      }
+      math::VariableBaseMSM<Point> msm;
+      absl::Span<const Point> generators(generators_.data(),
+                                         std::min(generators_.size(), size));
+      if (!msm.RunBatch(generators, v_list, &results)) return false;
+    }
+    out->resize(results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      if constexpr (std::is_same_v<Commitment, Bucket>) {
+        (*out)[i] = r_list[i] * h_ + results[i];
+      } else {
+        (*out)[i] =
+            r_list[i] * h_ + math::ConvertPoint<Commitment>(results[i]);
+      }
+    }
+    return true;
+  }
 
   void ResizeBatchCommitments() {
     batch_commitments_.resize(this->batch_commitment_state_.batch_count);
@@ -98,9 +169,8 @@ class Pedersen final
   // clang-format on
   bool DoCommit(const std::vector<Field>& v, const Field& r,
                 Commitment* out) const {
-    math::VariableBaseMSM<Point> msm;
     Bucket result;
-    if (!msm.Run(generators_, v, &result)) return false;
+    if (!RunMSM(v, &result)) return false;
     if constexpr (std::is_same_v<Commitment, Bucket>) {
       *out = r * h_ + result;
     } else {
@@ -111,14 +181,21 @@ class Pedersen final
 
   bool DoCommit(const std::vector<Field>& v, const Field& r,
                 BatchCommitmentState& state, size_t index) {
-    math::VariableBaseMSM<Point> msm;
     if (batch_commitments_.size() != state.batch_count)
       batch_commitments_.resize(state.batch_count);
-    return msm.Run(generators_, v, &batch_commitments_[index]);
+    return RunMSM(v, &batch_commitments_[index]);
+  }
+
+  bool RunMSM(const std::vector<Field>& v, Bucket* out) const {
+    if (IsPrecomputed()) return precomputed_generators_.Run(v, out);
+    math::VariableBaseMSM<Point> msm;
+    return msm.Run(generators_, v, out);
   }
 
   Point h_;
   std::vector<Point> generators_;
+  // Empty unless |Precompute()| or |SetPrecomputed()| is called.
+  PrecomputedMSM precomputed_generators_;
   std::vector<Bucket> batch_commitments_;
 };
 
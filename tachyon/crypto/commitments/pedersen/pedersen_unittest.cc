@@ -72,6 +72,68 @@ TEST_F(PedersenTest, BatchCommitPedersen) {
   EXPECT_EQ(batch_commitments, msm_results);
 }
 
+TEST_F(PedersenTest, CommitPrecomputed) {
+  VCS vcs;
+  ASSERT_TRUE(vcs.Setup());
+
+  std::vector<math::bn254::Fr> v =
+      base::CreateVector(kMaxSize, []() { return math::bn254::Fr::Random(); });
+  math::bn254::Fr r = math::bn254::Fr::Random();
+  math::bn254::G1JacobianPoint expected;
+  ASSERT_TRUE(vcs.Commit(v, r, &expected));
+
+  EXPECT_FALSE(vcs.IsPrecomputed());
+  ASSERT_TRUE(vcs.Precompute(/*precompute_factor=*/2));
+  EXPECT_TRUE(vcs.IsPrecomputed());
+
+  math::bn254::G1JacobianPoint commitment;
+  ASSERT_TRUE(vcs.Commit(v, r, &commitment));
+  EXPECT_EQ(commitment, expected);
+
+  VCS::PrecomputedMSM too_small;
+  ASSERT_TRUE(too_small.Precompute(
+      absl::MakeConstSpan(vcs.generators()).subspan(0, kMaxSize - 1),
+      /*precompute_factor=*/2));
+  EXPECT_FALSE(vcs.SetPrecomputed(std::move(too_small)));
+}
+
+TEST_F(PedersenTest, BatchCommit) {
+  size_t num_vectors = 10;
+
+  std::vector<std::vector<math::bn254::Fr>> v_vec =
+      base::CreateVector(num_vectors, []() {
+        return base::CreateVector(kMaxSize,
+                                  []() { return math::bn254::Fr::Random(); });
+      });
+  std::vector<absl::Span<const math::bn254::Fr>> v_list =
+      base::Map(v_vec, [](const std::vector<math::bn254::Fr>& v) {
+        return absl::Span<const math::bn254::Fr>(v);
+      });
+  std::vector<math::bn254::Fr> r_vec = base::CreateVector(
+      num_vectors, []() { return math::bn254::Fr::Random(); });
+
+  VCS vcs;
+  ASSERT_TRUE(vcs.Setup());
+  std::vector<math::bn254::G1JacobianPoint> expected = base::CreateVector(
+      num_vectors, [&vcs, &v_vec, &r_vec](size_t i) {
+        math::bn254::G1JacobianPoint commitment;
+        CHECK(vcs.Commit(v_vec[i], r_vec[i], &commitment));
+        return commitment;
+      });
+
+  std::vector<math::bn254::G1JacobianPoint> commitments;
+  ASSERT_TRUE(vcs.BatchCommit(v_list, r_vec, &commitments));
+  EXPECT_EQ(commitments, expected);
+
+  ASSERT_TRUE(vcs.Precompute());
+  commitments.clear();
+  ASSERT_TRUE(vcs.BatchCommit(v_list, r_vec, &commitments));
+  EXPECT_EQ(commitments, expected);
+
+  EXPECT_FALSE(vcs.BatchCommit(
+      v_list, absl::MakeConstSpan(r_vec).subspan(1), &commitments));
+}
+
 TEST_F(PedersenTest, Copyable) {
   VCS expected;
   ASSERT_TRUE(expected.Setup());
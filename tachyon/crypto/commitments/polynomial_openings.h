@@ -7,14 +7,14 @@
 
 #include "absl/container/btree_set.h"
 #include "absl/strings/substitute.h"
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
-#include "tachyon/base/openmp_util.h"
-#include "tachyon/base/optional.h"
 #include "tachyon/base/ref.h"
 #include "tachyon/math/polynomials/univariate/lagrange_interpolation.h"
+#include "tachyon/math/polynomials/univariate/polynomial_arithmetic.h"
 
 namespace tachyon::crypto {
 
@@ -153,22 +153,30 @@ struct GroupedPolynomialOpenings {
 
   Poly CombineLowDegreeExtensions(
       const Field& r, const std::vector<Poly>& low_degree_extensions) const {
-    // numerators: [P₀(X) - R₀(X), P₁(X) - R₁(X), P₂(X) - R₂(X)]
-    std::vector<Poly> numerators(low_degree_extensions.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < low_degree_extensions.size(); ++i) {
-      numerators[i] =
-          *poly_openings_vec[i].poly_oracle - low_degree_extensions[i];
-    }
-
     // Combine numerator polynomials with powers of |r|.
     // N(X) = (P₀(X) - R₀(X)) + r(P₁(X) - R₁(X)) + r²(P₂(X) - R₂(X))
-    Poly& n = Poly::template LinearCombinationInPlace</*forward=*/false>(
-        numerators, r);
+    // NOTE: N(X) is accumulated in a single pass over the coefficients, so
+    // that none of Pᵢ(X) is copied to be subtracted by Rᵢ(X).
+    std::vector<Field> r_powers =
+        Field::GetSuccessivePowers(low_degree_extensions.size(), r);
+    std::vector<const Poly*> polys;
+    std::vector<Field> scalars;
+    polys.reserve(low_degree_extensions.size() * 2);
+    scalars.reserve(low_degree_extensions.size() * 2);
+    for (size_t i = 0; i < low_degree_extensions.size(); ++i) {
+      polys.push_back(poly_openings_vec[i].poly_oracle.get());
+      scalars.push_back(r_powers[i]);
+      polys.push_back(&low_degree_extensions[i]);
+      scalars.push_back(-r_powers[i]);
+    }
+    Poly n = math::LinearCombination(polys, scalars);
 
     // Divide combined polynomial by vanishing polynomial of evaluation points.
     // H(X) = N(X) / (X - x₀)(X - x₁)(X - x₂)
-    Poly vanishing_poly = Poly::FromRoots(points);
-    return unwrap(n / vanishing_poly);
+    // NOTE: Dividing by the linear factors one at a time is cheaper than
+    // expanding the vanishing polynomial and running a long division by it.
+    return math::DivideByLinearFactors(std::move(n),
+                                       absl::MakeConstSpan(points));
   }
 };
 
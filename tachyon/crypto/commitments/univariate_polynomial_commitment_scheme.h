@@ -3,6 +3,8 @@
 
 #include <stddef.h>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/vector_commitment_scheme.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -64,6 +66,62 @@ class UnivariatePolynomialCommitmentScheme
     return derived->DoCommitLagrange(evals, derived->batch_commitment_state(),
                                      index);
   }
+
+  // Commit to each of |polys| and stores the commitments in
+  // |batch_commitments_| from |index| if |batch_mode| is true. Unlike calling
+  // |Commit()| for each of them, the commitments can share the loads of the
+  // parameters. Return false if the degree of any of |polys| exceeds
+  // |kMaxDegree|. It terminates when |batch_mode| is false.
+  template <typename T = Derived, std::enable_if_t<VectorCommitmentSchemeTraits<
+                                      T>::kSupportsBatchMode>* = nullptr>
+  [[nodiscard]] bool BatchCommit(absl::Span<const Poly* const> polys,
+                                 size_t index) {
+    Derived* derived = static_cast<Derived*>(this);
+    CHECK(derived->GetBatchMode());
+    return derived->DoBatchCommit(polys, derived->batch_commitment_state(),
+                                  index);
+  }
+
+  // Commit to each of |evals_list| and stores the commitments in
+  // |batch_commitments_| from |index| if |batch_mode| is true. Unlike calling
+  // |CommitLagrange()| for each of them, the commitments can share the loads
+  // of the parameters. Return false if the degree of any of |evals_list|
+  // exceeds |kMaxDegree|. It terminates when |batch_mode| is false.
+  template <typename T = Derived, std::enable_if_t<VectorCommitmentSchemeTraits<
+                                      T>::kSupportsBatchMode>* = nullptr>
+  [[nodiscard]] bool BatchCommitLagrange(
+      absl::Span<const Evals* const> evals_list, size_t index) {
+    Derived* derived = static_cast<Derived*>(this);
+    CHECK(derived->GetBatchMode());
+    return derived->DoBatchCommitLagrange(
+        evals_list, derived->batch_commitment_state(), index);
+  }
+
+  // Populates |result| with the commitment of the evaluations that differ
+  // from the ones of |commitment| by |deltas| at |rows|. It is the same as
+  // |CommitLagrange()| of the changed evaluations, but only |rows| are
+  // committed to. Return false if |rows| and |deltas| don't match.
+  [[nodiscard]] bool UpdateLagrange(const Commitment& commitment,
+                                    absl::Span<const size_t> rows,
+                                    absl::Span<const Field> deltas,
+                                    Commitment* result) const {
+    const Derived* derived = static_cast<const Derived*>(this);
+    return derived->DoUpdateLagrange(commitment, rows, deltas, result);
+  }
+
+  // Same as above, but stores the commitment in |batch_commitments_| at
+  // |index| if |batch_mode| is true. It terminates when |batch_mode| is false.
+  template <typename T = Derived, std::enable_if_t<VectorCommitmentSchemeTraits<
+                                      T>::kSupportsBatchMode>* = nullptr>
+  [[nodiscard]] bool UpdateLagrange(const Commitment& commitment,
+                                    absl::Span<const size_t> rows,
+                                    absl::Span<const Field> deltas,
+                                    size_t index) {
+    Derived* derived = static_cast<Derived*>(this);
+    CHECK(derived->GetBatchMode());
+    return derived->DoUpdateLagrange(commitment, rows, deltas,
+                                     derived->batch_commitment_state(), index);
+  }
 };
 
 }  // namespace tachyon::crypto
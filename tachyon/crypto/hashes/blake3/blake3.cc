@@ -0,0 +1,282 @@
+#include "tachyon/crypto/hashes/blake3/blake3.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/crypto/hashes/blake3/blake3_constants.h"
+
+#if ARCH_CPU_X86_64
+#include "tachyon/crypto/hashes/blake3/blake3_avx2.h"
+#endif
+
+namespace tachyon::crypto {
+
+namespace {
+
+uint32_t RotateRight(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+void G(uint32_t state[16], size_t a, size_t b, size_t c, size_t d,
+       uint32_t mx, uint32_t my) {
+  state[a] = state[a] + state[b] + mx;
+  state[d] = RotateRight(state[d] ^ state[a], 16);
+  state[c] = state[c] + state[d];
+  state[b] = RotateRight(state[b] ^ state[c], 12);
+  state[a] = state[a] + state[b] + my;
+  state[d] = RotateRight(state[d] ^ state[a], 8);
+  state[c] = state[c] + state[d];
+  state[b] = RotateRight(state[b] ^ state[c], 7);
+}
+
+// Writes the 16 words of the compression of |block| into |out|. The first 8
+// of them are the next chaining value.
+void Compress(const uint32_t cv[8], const uint32_t block[16], uint64_t counter,
+              uint32_t block_len, uint32_t flags, uint32_t out[16]) {
+  uint32_t state[16];
+  memcpy(state, cv, 8 * sizeof(uint32_t));
+  memcpy(state + 8, blake3::kIV, 4 * sizeof(uint32_t));
+  state[12] = static_cast<uint32_t>(counter);
+  state[13] = static_cast<uint32_t>(counter >> 32);
+  state[14] = block_len;
+  state[15] = flags;
+
+  uint32_t m[16];
+  memcpy(m, block, sizeof(m));
+  for (size_t round = 0; round < blake3::kRounds; ++round) {
+    G(state, 0, 4, 8, 12, m[0], m[1]);
+    G(state, 1, 5, 9, 13, m[2], m[3]);
+    G(state, 2, 6, 10, 14, m[4], m[5]);
+    G(state, 3, 7, 11, 15, m[6], m[7]);
+    G(state, 0, 5, 10, 15, m[8], m[9]);
+    G(state, 1, 6, 11, 12, m[10], m[11]);
+    G(state, 2, 7, 8, 13, m[12], m[13]);
+    G(state, 3, 4, 9, 14, m[14], m[15]);
+    uint32_t permuted[16];
+    for (size_t i = 0; i < 16; ++i) {
+      permuted[i] = m[blake3::kMessagePermutation[i]];
+    }
+    memcpy(m, permuted, sizeof(m));
+  }
+  for (size_t i = 0; i < 8; ++i) {
+    out[i] = state[i] ^ state[i + 8];
+    out[i + 8] = state[i + 8] ^ cv[i];
+  }
+}
+
+void LoadWords(const uint8_t bytes[Blake3::kBlockSize], uint32_t words[16]) {
+  for (size_t i = 0; i < 16; ++i) {
+    words[i] = uint32_t{bytes[4 * i]} | (uint32_t{bytes[4 * i + 1]} << 8) |
+               (uint32_t{bytes[4 * i + 2]} << 16) |
+               (uint32_t{bytes[4 * i + 3]} << 24);
+  }
+}
+
+void StoreWord(uint32_t word, uint8_t bytes[4]) {
+  for (size_t i = 0; i < 4; ++i) {
+    bytes[i] = static_cast<uint8_t>(word >> (8 * i));
+  }
+}
+
+}  // namespace
+
+void Blake3Compress8(uint32_t cvs[8][8], const uint32_t blocks[16][8],
+                     uint32_t block_len, uint32_t flags) {
+#if ARCH_CPU_X86_64
+  Blake3Compress8AVX2(cvs, blocks, block_len, flags);
+#else
+  for (size_t lane = 0; lane < 8; ++lane) {
+    uint32_t cv[8];
+    uint32_t block[16];
+    for (size_t i = 0; i < 8; ++i) {
+      cv[i] = cvs[i][lane];
+    }
+    for (size_t i = 0; i < 16; ++i) {
+      block[i] = blocks[i][lane];
+    }
+    uint32_t out[16];
+    Compress(cv, block, 0, block_len, flags, out);
+    for (size_t i = 0; i < 8; ++i) {
+      cvs[i][lane] = out[i];
+    }
+  }
+#endif
+}
+
+Blake3::Blake3() { Reset(); }
+
+// static
+Blake3::Digest Blake3::Hash(absl::Span<const uint8_t> input) {
+  Blake3 hasher;
+  hasher.Update(input);
+  return hasher.Finalize();
+}
+
+void Blake3::Update(absl::Span<const uint8_t> input) {
+  while (!input.empty()) {
+    // A block is only compressed once more bytes come, since the last block
+    // of a chunk is compressed with a different flag.
+    if (blocks_compressed_ * kBlockSize + block_len_ == kChunkSize) {
+      uint32_t block[16];
+      LoadWords(block_, block);
+      uint32_t out[16];
+      Compress(chunk_cv_.data(), block, chunk_counter_, kBlockSize,
+               blake3::kChunkEnd, out);
+      ChainingValue cv;
+      memcpy(cv.data(), out, sizeof(cv));
+      PushChunkChainingValue(cv, chunk_counter_ + 1);
+      std::copy(std::begin(blake3::kIV), std::end(blake3::kIV),
+                chunk_cv_.begin());
+      ++chunk_counter_;
+      memset(block_, 0, sizeof(block_));
+      block_len_ = 0;
+      blocks_compressed_ = 0;
+    } else if (block_len_ == kBlockSize) {
+      CompressBlock();
+    }
+    size_t size = std::min(kBlockSize - block_len_, input.size());
+    memcpy(block_ + block_len_, input.data(), size);
+    block_len_ += size;
+    input.remove_prefix(size);
+  }
+}
+
+Blake3::Digest Blake3::Finalize() {
+  // Every parent is compressed with the chaining value built so far from the
+  // right, and the last compression is done with |blake3::kRoot|.
+  uint32_t cv[8];
+  uint32_t block[16];
+  LoadWords(block_, block);
+  uint64_t counter = chunk_counter_;
+  uint32_t block_len = block_len_;
+  uint32_t flags = blake3::kChunkEnd |
+                   (blocks_compressed_ == 0 ? blake3::kChunkStart : 0);
+  memcpy(cv, chunk_cv_.data(), sizeof(cv));
+  for (size_t i = cv_stack_len_; i-- > 0;) {
+    uint32_t out[16];
+    Compress(cv, block, counter, block_len, flags, out);
+    memcpy(block, cv_stack_[i].data(), sizeof(cv));
+    memcpy(block + 8, out, sizeof(cv));
+    std::copy(std::begin(blake3::kIV), std::end(blake3::kIV), cv);
+    counter = 0;
+    block_len = kBlockSize;
+    flags = blake3::kParent;
+  }
+  uint32_t out[16];
+  Compress(cv, block, counter, block_len, flags | blake3::kRoot, out);
+  Digest ret;
+  for (size_t i = 0; i < 8; ++i) {
+    StoreWord(out[i], &ret[4 * i]);
+  }
+  Reset();
+  return ret;
+}
+
+void Blake3::Reset() {
+  std::copy(std::begin(blake3::kIV), std::end(blake3::kIV), chunk_cv_.begin());
+  chunk_counter_ = 0;
+  memset(block_, 0, sizeof(block_));
+  block_len_ = 0;
+  blocks_compressed_ = 0;
+  cv_stack_len_ = 0;
+}
+
+void Blake3::CompressBlock() {
+  uint32_t block[16];
+  LoadWords(block_, block);
+  uint32_t out[16];
+  Compress(chunk_cv_.data(), block, chunk_counter_, kBlockSize,
+           blocks_compressed_ == 0 ? blake3::kChunkStart : 0, out);
+  memcpy(chunk_cv_.data(), out, sizeof(chunk_cv_));
+  ++blocks_compressed_;
+  memset(block_, 0, sizeof(block_));
+  block_len_ = 0;
+}
+
+void Blake3::PushChunkChainingValue(ChainingValue cv, uint64_t total_chunks) {
+  // Every trailing zero bit of |total_chunks| completes a subtree.
+  while ((total_chunks & 1) == 0) {
+    uint32_t block[16];
+    memcpy(block, cv_stack_[--cv_stack_len_].data(), sizeof(cv));
+    memcpy(block + 8, cv.data(), sizeof(cv));
+    uint32_t out[16];
+    Compress(blake3::kIV, block, 0, kBlockSize, blake3::kParent, out);
+    memcpy(cv.data(), out, sizeof(cv));
+    total_chunks >>= 1;
+  }
+  cv_stack_[cv_stack_len_++] = cv;
+}
+
+Blake3x8::Blake3x8() { Reset(); }
+
+// static
+std::array<Blake3x8::Digest, Blake3x8::kLanes> Blake3x8::Hash(
+    const std::array<absl::Span<const uint8_t>, kLanes>& inputs) {
+  Blake3x8 hasher;
+  hasher.Update(inputs);
+  return hasher.Finalize();
+}
+
+void Blake3x8::Update(
+    const std::array<absl::Span<const uint8_t>, kLanes>& inputs) {
+  size_t size = inputs[0].size();
+  for (size_t lane = 1; lane < kLanes; ++lane) {
+    CHECK_EQ(inputs[lane].size(), size);
+  }
+  CHECK_LE(blocks_compressed_ * Blake3::kBlockSize + block_len_ + size,
+           Blake3::kChunkSize);
+  size_t offset = 0;
+  while (offset < size) {
+    if (block_len_ == Blake3::kBlockSize) {
+      CompressBlocks(blocks_compressed_ == 0 ? blake3::kChunkStart : 0);
+    }
+    size_t len = std::min(Blake3::kBlockSize - block_len_, size - offset);
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      memcpy(blocks_[lane] + block_len_, inputs[lane].data() + offset, len);
+    }
+    block_len_ += len;
+    offset += len;
+  }
+}
+
+std::array<Blake3x8::Digest, Blake3x8::kLanes> Blake3x8::Finalize() {
+  CompressBlocks(blake3::kChunkEnd | blake3::kRoot |
+                 (blocks_compressed_ == 0 ? blake3::kChunkStart : 0));
+  std::array<Digest, kLanes> ret;
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    for (size_t i = 0; i < 8; ++i) {
+      StoreWord(cvs_[i][lane], &ret[lane][4 * i]);
+    }
+  }
+  Reset();
+  return ret;
+}
+
+void Blake3x8::Reset() {
+  for (size_t i = 0; i < 8; ++i) {
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      cvs_[i][lane] = blake3::kIV[i];
+    }
+  }
+  memset(blocks_, 0, sizeof(blocks_));
+  block_len_ = 0;
+  blocks_compressed_ = 0;
+}
+
+void Blake3x8::CompressBlocks(uint32_t flags) {
+  uint32_t blocks[16][kLanes];
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    uint32_t words[16];
+    LoadWords(blocks_[lane], words);
+    for (size_t i = 0; i < 16; ++i) {
+      blocks[i][lane] = words[i];
+    }
+  }
+  Blake3Compress8(cvs_, blocks, block_len_, flags);
+  ++blocks_compressed_;
+  memset(blocks_, 0, sizeof(blocks_));
+  block_len_ = 0;
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,101 @@
+#ifndef TACHYON_CRYPTO_HASHES_BLAKE3_BLAKE3_H_
+#define TACHYON_CRYPTO_HASHES_BLAKE3_BLAKE3_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "absl/types/span.h"
+
+#include "tachyon/export.h"
+
+namespace tachyon::crypto {
+
+// Compresses 8 blocks of the first chunk of 8 inputs at once, where
+// |cvs[i][j]| is the i-th word of the chaining value of the j-th input and
+// |blocks[i][j]| is the i-th word of the block of the j-th input. |cvs| is
+// overwritten with the new chaining values.
+TACHYON_EXPORT void Blake3Compress8(uint32_t cvs[8][8],
+                                    const uint32_t blocks[16][8],
+                                    uint32_t block_len, uint32_t flags);
+
+// BLAKE3 in its default hashing mode with a 32-byte output.
+// See https://github.com/BLAKE3-team/BLAKE3-specs.
+class TACHYON_EXPORT Blake3 {
+ public:
+  constexpr static size_t kDigestSize = 32;
+  constexpr static size_t kBlockSize = 64;
+  constexpr static size_t kChunkSize = 1024;
+
+  using Digest = std::array<uint8_t, kDigestSize>;
+
+  Blake3();
+
+  static Digest Hash(absl::Span<const uint8_t> input);
+
+  void Update(absl::Span<const uint8_t> input);
+
+  // Returns the digest of the bytes given to |Update()| and resets the state,
+  // so that the next bytes are hashed from scratch.
+  Digest Finalize();
+
+ private:
+  using ChainingValue = std::array<uint32_t, 8>;
+
+  void Reset();
+  void CompressBlock();
+  // Pushes the chaining value of the chunk that just ended, merging it with
+  // the ones of the completed subtrees on the stack.
+  void PushChunkChainingValue(ChainingValue cv, uint64_t total_chunks);
+
+  // The state of the current chunk.
+  ChainingValue chunk_cv_;
+  uint64_t chunk_counter_ = 0;
+  uint8_t block_[kBlockSize] = {};
+  size_t block_len_ = 0;
+  size_t blocks_compressed_ = 0;
+
+  // The chaining values of the completed subtrees. A tree of 2⁶⁴ bytes has at
+  // most 54 of them.
+  ChainingValue cv_stack_[54];
+  size_t cv_stack_len_ = 0;
+};
+
+// Hashes 8 inputs of the same size of at most |Blake3::kChunkSize| bytes at
+// once with |Blake3Compress8()|. Since every input fits in a single chunk, the
+// lanes never build a tree.
+class TACHYON_EXPORT Blake3x8 {
+ public:
+  constexpr static size_t kLanes = 8;
+  // The maximum number of bytes a lane can hash.
+  constexpr static size_t kMaxSize = Blake3::kChunkSize;
+
+  using Digest = Blake3::Digest;
+
+  Blake3x8();
+
+  static std::array<Digest, kLanes> Hash(
+      const std::array<absl::Span<const uint8_t>, kLanes>& inputs);
+
+  // Absorbs |inputs[i]| into the i-th lane. Every input must have the same
+  // size, and the total size must not exceed |Blake3::kChunkSize|.
+  void Update(const std::array<absl::Span<const uint8_t>, kLanes>& inputs);
+
+  // Returns the digests of every lane and resets the states.
+  std::array<Digest, kLanes> Finalize();
+
+ private:
+  void Reset();
+  void CompressBlocks(uint32_t flags);
+
+  // |cvs_[i][j]| is the i-th word of the chaining value of the j-th lane.
+  uint32_t cvs_[8][kLanes];
+  uint8_t blocks_[kLanes][Blake3::kBlockSize] = {};
+  size_t block_len_ = 0;
+  size_t blocks_compressed_ = 0;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_BLAKE3_BLAKE3_H_
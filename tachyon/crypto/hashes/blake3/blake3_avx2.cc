@@ -0,0 +1,75 @@
+#include "tachyon/crypto/hashes/blake3/blake3_avx2.h"
+
+#include <immintrin.h>
+#include <stddef.h>
+
+#include "tachyon/crypto/hashes/blake3/blake3_constants.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+__m256i Add(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+
+__m256i RotateRight(__m256i x, int n) {
+  return _mm256_or_si256(_mm256_srl_epi32(x, _mm_cvtsi32_si128(n)),
+                         _mm256_sll_epi32(x, _mm_cvtsi32_si128(32 - n)));
+}
+
+void G(__m256i state[16], size_t a, size_t b, size_t c, size_t d, __m256i mx,
+       __m256i my) {
+  state[a] = Add(Add(state[a], state[b]), mx);
+  state[d] = RotateRight(_mm256_xor_si256(state[d], state[a]), 16);
+  state[c] = Add(state[c], state[d]);
+  state[b] = RotateRight(_mm256_xor_si256(state[b], state[c]), 12);
+  state[a] = Add(Add(state[a], state[b]), my);
+  state[d] = RotateRight(_mm256_xor_si256(state[d], state[a]), 8);
+  state[c] = Add(state[c], state[d]);
+  state[b] = RotateRight(_mm256_xor_si256(state[b], state[c]), 7);
+}
+
+}  // namespace
+
+void Blake3Compress8AVX2(uint32_t cvs[8][8], const uint32_t blocks[16][8],
+                         uint32_t block_len, uint32_t flags) {
+  __m256i state[16];
+  for (size_t i = 0; i < 8; ++i) {
+    state[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cvs[i]));
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    state[i + 8] = _mm256_set1_epi32(static_cast<int>(blake3::kIV[i]));
+  }
+  // The counter of the first chunk is 0.
+  state[12] = _mm256_setzero_si256();
+  state[13] = _mm256_setzero_si256();
+  state[14] = _mm256_set1_epi32(static_cast<int>(block_len));
+  state[15] = _mm256_set1_epi32(static_cast<int>(flags));
+
+  __m256i m[16];
+  for (size_t i = 0; i < 16; ++i) {
+    m[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[i]));
+  }
+  for (size_t round = 0; round < blake3::kRounds; ++round) {
+    G(state, 0, 4, 8, 12, m[0], m[1]);
+    G(state, 1, 5, 9, 13, m[2], m[3]);
+    G(state, 2, 6, 10, 14, m[4], m[5]);
+    G(state, 3, 7, 11, 15, m[6], m[7]);
+    G(state, 0, 5, 10, 15, m[8], m[9]);
+    G(state, 1, 6, 11, 12, m[10], m[11]);
+    G(state, 2, 7, 8, 13, m[12], m[13]);
+    G(state, 3, 4, 9, 14, m[14], m[15]);
+    __m256i permuted[16];
+    for (size_t i = 0; i < 16; ++i) {
+      permuted[i] = m[blake3::kMessagePermutation[i]];
+    }
+    for (size_t i = 0; i < 16; ++i) {
+      m[i] = permuted[i];
+    }
+  }
+  for (size_t i = 0; i < 8; ++i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(cvs[i]),
+                        _mm256_xor_si256(state[i], state[i + 8]));
+  }
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,18 @@
+#ifndef TACHYON_CRYPTO_HASHES_BLAKE3_BLAKE3_AVX2_H_
+#define TACHYON_CRYPTO_HASHES_BLAKE3_BLAKE3_AVX2_H_
+
+#include <stdint.h>
+
+#include "tachyon/export.h"
+
+namespace tachyon::crypto {
+
+// Same as |Blake3Compress8()|, but every word of the 8 inputs is compressed in
+// a single AVX2 register.
+TACHYON_EXPORT void Blake3Compress8AVX2(uint32_t cvs[8][8],
+                                        const uint32_t blocks[16][8],
+                                        uint32_t block_len, uint32_t flags);
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_BLAKE3_BLAKE3_AVX2_H_
@@ -0,0 +1,26 @@
+#ifndef TACHYON_CRYPTO_HASHES_BLAKE3_BLAKE3_CONSTANTS_H_
+#define TACHYON_CRYPTO_HASHES_BLAKE3_BLAKE3_CONSTANTS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace tachyon::crypto::blake3 {
+
+constexpr uint32_t kIV[8] = {0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+                             0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+
+// The message words are permuted with |kMessagePermutation| between rounds.
+constexpr size_t kMessagePermutation[16] = {2, 6,  3,  10, 7, 0,  4,  13,
+                                            1, 11, 12, 5,  9, 14, 15, 8};
+
+constexpr size_t kRounds = 7;
+
+// The domain separation flags.
+constexpr uint32_t kChunkStart = 1 << 0;
+constexpr uint32_t kChunkEnd = 1 << 1;
+constexpr uint32_t kParent = 1 << 2;
+constexpr uint32_t kRoot = 1 << 3;
+
+}  // namespace tachyon::crypto::blake3
+
+#endif  // TACHYON_CRYPTO_HASHES_BLAKE3_BLAKE3_CONSTANTS_H_
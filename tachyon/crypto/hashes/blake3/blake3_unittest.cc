@@ -0,0 +1,79 @@
+#include "tachyon/crypto/hashes/blake3/blake3.h"
+
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+// The inputs of the official test vectors.
+std::vector<uint8_t> CreateInput(size_t size) {
+  std::vector<uint8_t> ret(size);
+  for (size_t i = 0; i < size; ++i) {
+    ret[i] = static_cast<uint8_t>(i % 251);
+  }
+  return ret;
+}
+
+}  // namespace
+
+TEST(Blake3Test, Hash) {
+  struct {
+    size_t size;
+    std::string_view digest;
+  } tests[] = {
+      {0, "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262"},
+      {1, "2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213"},
+      {1024,
+       "42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af7"},
+      {1025,
+       "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444"},
+      {2048,
+       "e776b6028c7cd22a4d0ba182a8bf62205d2ef576467e838ed6f2529b85fba24a"},
+      {8193,
+       "bab6c09cb8ce8cf459261398d2e7aef35700bf488116ceb94a36d0f5f1b7bc3b"},
+  };
+
+  for (const auto& test : tests) {
+    EXPECT_EQ(base::HexEncode(Blake3::Hash(CreateInput(test.size)), true),
+              test.digest);
+  }
+}
+
+TEST(Blake3Test, Update) {
+  std::vector<uint8_t> input = CreateInput(3073);
+  absl::Span<const uint8_t> bytes(input);
+
+  Blake3 hasher;
+  hasher.Update(bytes.subspan(0, 1000));
+  hasher.Update(bytes.subspan(1000));
+  EXPECT_EQ(hasher.Finalize(), Blake3::Hash(input));
+  // The hasher is reset after |Finalize()|.
+  hasher.Update(input);
+  EXPECT_EQ(hasher.Finalize(), Blake3::Hash(input));
+}
+
+TEST(Blake3x8Test, Hash) {
+  for (size_t size : {size_t{0}, size_t{1}, Blake3::kBlockSize,
+                      Blake3::kBlockSize + 1, Blake3::kChunkSize}) {
+    std::vector<uint8_t> inputs[Blake3x8::kLanes];
+    std::array<absl::Span<const uint8_t>, Blake3x8::kLanes> spans;
+    for (size_t lane = 0; lane < Blake3x8::kLanes; ++lane) {
+      inputs[lane] = CreateInput(size + lane);
+      inputs[lane].erase(inputs[lane].begin(), inputs[lane].begin() + lane);
+      spans[lane] = inputs[lane];
+    }
+    std::array<Blake3::Digest, Blake3x8::kLanes> digests =
+        Blake3x8::Hash(spans);
+    for (size_t lane = 0; lane < Blake3x8::kLanes; ++lane) {
+      EXPECT_EQ(digests[lane], Blake3::Hash(inputs[lane]));
+    }
+  }
+}
+
+}  // namespace tachyon::crypto
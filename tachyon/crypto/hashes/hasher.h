@@ -17,6 +17,14 @@ class Hasher {
     const Derived& derived = static_cast<const Derived&>(*this);
     return derived.DoHash(input);
   }
+
+  // Hashes |rows| concatenated without copying them into a buffer. Each of
+  // |rows| is a container of elements, e.g., |absl::Span<const F>|.
+  template <typename Rows>
+  auto HashRows(const Rows& rows) const {
+    const Derived& derived = static_cast<const Derived&>(*this);
+    return derived.DoHashRows(rows);
+  }
 };
 
 }  // namespace tachyon::crypto
@@ -0,0 +1,156 @@
+#include "tachyon/crypto/hashes/keccak/keccak.h"
+
+#include <string.h>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/crypto/hashes/keccak/keccak_constants.h"
+
+#if ARCH_CPU_X86_64
+#include "tachyon/crypto/hashes/keccak/keccak_avx2.h"
+#endif
+
+namespace tachyon::crypto {
+
+namespace {
+
+uint64_t RotateLeft(uint64_t x, int n) { return (x << n) | (x >> (64 - n)); }
+
+// Xors |byte| into the byte at |offset| % 8 of |word| in little-endian order.
+void XorByte(uint64_t& word, size_t offset, uint8_t byte) {
+  word ^= uint64_t{byte} << (8 * (offset % 8));
+}
+
+uint8_t GetByte(uint64_t word, size_t offset) {
+  return static_cast<uint8_t>(word >> (8 * (offset % 8)));
+}
+
+}  // namespace
+
+void KeccakF1600(uint64_t state[25]) {
+  for (uint64_t round_constant : keccak::kRoundConstants) {
+    // θ
+    uint64_t c[5];
+    for (size_t x = 0; x < 5; ++x) {
+      c[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^
+             state[x + 20];
+    }
+    for (size_t x = 0; x < 5; ++x) {
+      uint64_t d = c[(x + 4) % 5] ^ RotateLeft(c[(x + 1) % 5], 1);
+      for (size_t y = 0; y < 25; y += 5) {
+        state[y + x] ^= d;
+      }
+    }
+    // ρ and π
+    uint64_t current = state[1];
+    for (size_t i = 0; i < 24; ++i) {
+      int lane = keccak::kPiLanes[i];
+      uint64_t next = state[lane];
+      state[lane] = RotateLeft(current, keccak::kRhoOffsets[i]);
+      current = next;
+    }
+    // χ
+    for (size_t y = 0; y < 25; y += 5) {
+      uint64_t row[5];
+      memcpy(row, &state[y], sizeof(row));
+      for (size_t x = 0; x < 5; ++x) {
+        state[y + x] = row[x] ^ (~row[(x + 1) % 5] & row[(x + 2) % 5]);
+      }
+    }
+    // ι
+    state[0] ^= round_constant;
+  }
+}
+
+void KeccakF1600x4(uint64_t states[25][4]) {
+#if ARCH_CPU_X86_64
+  KeccakF1600x4AVX2(states);
+#else
+  for (size_t lane = 0; lane < 4; ++lane) {
+    uint64_t state[25];
+    for (size_t i = 0; i < 25; ++i) {
+      state[i] = states[i][lane];
+    }
+    KeccakF1600(state);
+    for (size_t i = 0; i < 25; ++i) {
+      states[i][lane] = state[i];
+    }
+  }
+#endif
+}
+
+// static
+Keccak256::Digest Keccak256::Hash(absl::Span<const uint8_t> input) {
+  Keccak256 hasher;
+  hasher.Update(input);
+  return hasher.Finalize();
+}
+
+void Keccak256::Update(absl::Span<const uint8_t> input) {
+  for (uint8_t byte : input) {
+    XorByte(state_[offset_ / 8], offset_, byte);
+    if (++offset_ == kRate) {
+      KeccakF1600(state_);
+      offset_ = 0;
+    }
+  }
+}
+
+Keccak256::Digest Keccak256::Finalize() {
+  // Keccak pads with 0x01 where SHA3 pads with 0x06.
+  XorByte(state_[offset_ / 8], offset_, 0x01);
+  XorByte(state_[(kRate - 1) / 8], kRate - 1, 0x80);
+  KeccakF1600(state_);
+  Digest ret;
+  for (size_t i = 0; i < kDigestSize; ++i) {
+    ret[i] = GetByte(state_[i / 8], i);
+  }
+  memset(state_, 0, sizeof(state_));
+  offset_ = 0;
+  return ret;
+}
+
+// static
+std::array<Keccak256x4::Digest, Keccak256x4::kLanes> Keccak256x4::Hash(
+    const std::array<absl::Span<const uint8_t>, kLanes>& inputs) {
+  Keccak256x4 hasher;
+  hasher.Update(inputs);
+  return hasher.Finalize();
+}
+
+void Keccak256x4::Update(
+    const std::array<absl::Span<const uint8_t>, kLanes>& inputs) {
+  size_t size = inputs[0].size();
+  for (size_t lane = 1; lane < kLanes; ++lane) {
+    CHECK_EQ(inputs[lane].size(), size);
+  }
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      XorByte(states_[offset_ / 8][lane], offset_, inputs[lane][i]);
+    }
+    if (++offset_ == Keccak256::kRate) {
+      KeccakF1600x4(states_);
+      offset_ = 0;
+    }
+  }
+}
+
+std::array<Keccak256x4::Digest, Keccak256x4::kLanes> Keccak256x4::Finalize() {
+  constexpr size_t kLastOffset = Keccak256::kRate - 1;
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    XorByte(states_[offset_ / 8][lane], offset_, 0x01);
+    XorByte(states_[kLastOffset / 8][lane], kLastOffset, 0x80);
+  }
+  KeccakF1600x4(states_);
+  std::array<Digest, kLanes> ret;
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    for (size_t i = 0; i < Keccak256::kDigestSize; ++i) {
+      ret[lane][i] = GetByte(states_[i / 8][lane], i);
+    }
+  }
+  memset(states_, 0, sizeof(states_));
+  offset_ = 0;
+  return ret;
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,75 @@
+#ifndef TACHYON_CRYPTO_HASHES_KECCAK_KECCAK_H_
+#define TACHYON_CRYPTO_HASHES_KECCAK_KECCAK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <limits>
+
+#include "absl/types/span.h"
+
+#include "tachyon/export.h"
+
+namespace tachyon::crypto {
+
+// Applies Keccak-f[1600] to |state|.
+TACHYON_EXPORT void KeccakF1600(uint64_t state[25]);
+
+// Applies Keccak-f[1600] to 4 states at once, where |states[i][j]| is the
+// i-th word of the j-th state.
+TACHYON_EXPORT void KeccakF1600x4(uint64_t states[25][4]);
+
+// Keccak-256 as used by Ethereum, which differs from SHA3-256 only in the
+// padding.
+class TACHYON_EXPORT Keccak256 {
+ public:
+  constexpr static size_t kDigestSize = 32;
+  // (1600 - 2 * 256) / 8
+  constexpr static size_t kRate = 136;
+
+  using Digest = std::array<uint8_t, kDigestSize>;
+
+  static Digest Hash(absl::Span<const uint8_t> input);
+
+  void Update(absl::Span<const uint8_t> input);
+
+  // Returns the digest of the bytes given to |Update()| and resets the state,
+  // so that the next bytes are hashed from scratch.
+  Digest Finalize();
+
+ private:
+  uint64_t state_[25] = {};
+  // The number of bytes absorbed into the current block.
+  size_t offset_ = 0;
+};
+
+// Hashes 4 inputs of the same size at once with |KeccakF1600x4()|.
+class TACHYON_EXPORT Keccak256x4 {
+ public:
+  constexpr static size_t kLanes = 4;
+  // The maximum number of bytes a lane can hash.
+  constexpr static size_t kMaxSize = std::numeric_limits<size_t>::max();
+
+  using Digest = Keccak256::Digest;
+
+  static std::array<Digest, kLanes> Hash(
+      const std::array<absl::Span<const uint8_t>, kLanes>& inputs);
+
+  // Absorbs |inputs[i]| into the i-th lane. Every input must have the same
+  // size.
+  void Update(const std::array<absl::Span<const uint8_t>, kLanes>& inputs);
+
+  // Returns the digests of every lane and resets the states.
+  std::array<Digest, kLanes> Finalize();
+
+ private:
+  // |states_[i][j]| is the i-th word of the j-th lane, so that the same words
+  // of the lanes are next to each other.
+  uint64_t states_[25][kLanes] = {};
+  size_t offset_ = 0;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_KECCAK_KECCAK_H_
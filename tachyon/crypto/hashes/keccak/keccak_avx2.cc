@@ -0,0 +1,66 @@
+#include "tachyon/crypto/hashes/keccak/keccak_avx2.h"
+
+#include <immintrin.h>
+
+#include "tachyon/crypto/hashes/keccak/keccak_constants.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+__m256i RotateLeft(__m256i x, int n) {
+  return _mm256_or_si256(_mm256_sll_epi64(x, _mm_cvtsi32_si128(n)),
+                         _mm256_srl_epi64(x, _mm_cvtsi32_si128(64 - n)));
+}
+
+__m256i Xor(__m256i a, __m256i b) { return _mm256_xor_si256(a, b); }
+
+}  // namespace
+
+void KeccakF1600x4AVX2(uint64_t states[25][4]) {
+  __m256i state[25];
+  for (size_t i = 0; i < 25; ++i) {
+    state[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(states[i]));
+  }
+  for (uint64_t round_constant : keccak::kRoundConstants) {
+    // θ
+    __m256i c[5];
+    for (size_t x = 0; x < 5; ++x) {
+      c[x] = Xor(Xor(state[x], state[x + 5]),
+                 Xor(Xor(state[x + 10], state[x + 15]), state[x + 20]));
+    }
+    for (size_t x = 0; x < 5; ++x) {
+      __m256i d = Xor(c[(x + 4) % 5], RotateLeft(c[(x + 1) % 5], 1));
+      for (size_t y = 0; y < 25; y += 5) {
+        state[y + x] = Xor(state[y + x], d);
+      }
+    }
+    // ρ and π
+    __m256i current = state[1];
+    for (size_t i = 0; i < 24; ++i) {
+      int lane = keccak::kPiLanes[i];
+      __m256i next = state[lane];
+      state[lane] = RotateLeft(current, keccak::kRhoOffsets[i]);
+      current = next;
+    }
+    // χ
+    for (size_t y = 0; y < 25; y += 5) {
+      __m256i row[5];
+      for (size_t x = 0; x < 5; ++x) {
+        row[x] = state[y + x];
+      }
+      for (size_t x = 0; x < 5; ++x) {
+        state[y + x] = Xor(
+            row[x], _mm256_andnot_si256(row[(x + 1) % 5], row[(x + 2) % 5]));
+      }
+    }
+    // ι
+    state[0] = Xor(state[0],
+                   _mm256_set1_epi64x(static_cast<int64_t>(round_constant)));
+  }
+  for (size_t i = 0; i < 25; ++i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(states[i]), state[i]);
+  }
+}
+
+}  // namespace tachyon::crypto
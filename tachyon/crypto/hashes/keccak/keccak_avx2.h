@@ -0,0 +1,16 @@
+#ifndef TACHYON_CRYPTO_HASHES_KECCAK_KECCAK_AVX2_H_
+#define TACHYON_CRYPTO_HASHES_KECCAK_KECCAK_AVX2_H_
+
+#include <stdint.h>
+
+#include "tachyon/export.h"
+
+namespace tachyon::crypto {
+
+// Same as |KeccakF1600x4()|, but every word of the 4 states is permuted in a
+// single AVX2 register.
+TACHYON_EXPORT void KeccakF1600x4AVX2(uint64_t states[25][4]);
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_KECCAK_KECCAK_AVX2_H_
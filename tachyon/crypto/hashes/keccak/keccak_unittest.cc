@@ -0,0 +1,76 @@
+#include "tachyon/crypto/hashes/keccak/keccak.h"
+
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+absl::Span<const uint8_t> ToBytes(std::string_view str) {
+  return {reinterpret_cast<const uint8_t*>(str.data()), str.size()};
+}
+
+std::vector<uint8_t> CreateInput(size_t size, uint8_t seed) {
+  std::vector<uint8_t> ret(size);
+  for (size_t i = 0; i < size; ++i) {
+    ret[i] = static_cast<uint8_t>(i * 7 + seed);
+  }
+  return ret;
+}
+
+}  // namespace
+
+TEST(Keccak256Test, Hash) {
+  struct {
+    std::string_view input;
+    std::string_view digest;
+  } tests[] = {
+      {"",
+       "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470"},
+      {"abc",
+       "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45"},
+  };
+
+  for (const auto& test : tests) {
+    EXPECT_EQ(base::HexEncode(Keccak256::Hash(ToBytes(test.input)), true),
+              test.digest);
+  }
+}
+
+TEST(Keccak256Test, Update) {
+  // Crosses the boundary of a block.
+  std::vector<uint8_t> input = CreateInput(300, 0);
+  absl::Span<const uint8_t> bytes(input);
+
+  Keccak256 hasher;
+  hasher.Update(bytes.subspan(0, 100));
+  hasher.Update(bytes.subspan(100));
+  EXPECT_EQ(hasher.Finalize(), Keccak256::Hash(input));
+  // The hasher is reset after |Finalize()|.
+  hasher.Update(input);
+  EXPECT_EQ(hasher.Finalize(), Keccak256::Hash(input));
+}
+
+TEST(Keccak256x4Test, Hash) {
+  for (size_t size :
+       {size_t{0}, size_t{1}, Keccak256::kRate, Keccak256::kRate + 1}) {
+    std::vector<uint8_t> inputs[Keccak256x4::kLanes];
+    std::array<absl::Span<const uint8_t>, Keccak256x4::kLanes> spans;
+    for (size_t lane = 0; lane < Keccak256x4::kLanes; ++lane) {
+      inputs[lane] = CreateInput(size, lane);
+      spans[lane] = inputs[lane];
+    }
+    std::array<Keccak256::Digest, Keccak256x4::kLanes> digests =
+        Keccak256x4::Hash(spans);
+    for (size_t lane = 0; lane < Keccak256x4::kLanes; ++lane) {
+      EXPECT_EQ(digests[lane], Keccak256::Hash(inputs[lane]));
+    }
+  }
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,175 @@
+load("//bazel:tachyon_cc.bzl", "tachyon_cc_library")
+
+# The fields that the generator is linked with.
+_FIELDS = {
+    "baby_bear": struct(
+        type = "tachyon::math::BabyBear",
+        hdr = "tachyon/math/finite_fields/baby_bear/baby_bear.h",
+        dep = "//tachyon/math/finite_fields/baby_bear",
+    ),
+    "bn254_fr": struct(
+        type = "tachyon::math::bn254::Fr",
+        hdr = "tachyon/math/elliptic_curves/bn/bn254/fr.h",
+        dep = "//tachyon/math/elliptic_curves/bn/bn254:fr",
+    ),
+    "goldilocks": struct(
+        type = "tachyon::math::Goldilocks",
+        hdr = "tachyon/math/finite_fields/goldilocks/goldilocks_prime_field.h",
+        dep = "//tachyon/math/finite_fields/goldilocks:goldilocks_prime_field",
+    ),
+    "mersenne31": struct(
+        type = "tachyon::math::Mersenne31",
+        hdr = "tachyon/math/finite_fields/mersenne31/mersenne31.h",
+        dep = "//tachyon/math/finite_fields/mersenne31",
+    ),
+}
+
+def _generate_sponge_config_hdr_impl(ctx):
+    field = _FIELDS[ctx.attr.field]
+
+    arguments = [
+        "--out=%s" % (ctx.outputs.out.path),
+        "--namespace=%s" % (ctx.attr.namespace),
+        "--class=%s" % (ctx.attr.class_name),
+        "--hash=%s" % (ctx.attr.hash),
+        "--field=%s" % (ctx.attr.field),
+        "--field_type=%s" % (field.type),
+        "--field_hdr=%s" % (field.hdr),
+        "--rate=%s" % (ctx.attr.rate),
+        "--alpha=%s" % (ctx.attr.alpha),
+        "--full_rounds=%s" % (ctx.attr.full_rounds),
+        "--partial_rounds=%s" % (ctx.attr.partial_rounds),
+        "--skip_matrices=%s" % (ctx.attr.skip_matrices),
+        "--hdr_tpl_path=%s" % (ctx.file.hdr_tpl_path.path),
+    ]
+    if len(ctx.attr.internal_matrix) > 0:
+        arguments.append("--internal_matrix=%s" % (ctx.attr.internal_matrix))
+        arguments.append("--internal_matrix_hdr=%s" % (ctx.attr.internal_matrix_hdr))
+
+    ctx.actions.run(
+        inputs = [ctx.file.hdr_tpl_path],
+        tools = [ctx.executable._tool],
+        executable = ctx.executable._tool,
+        outputs = [ctx.outputs.out],
+        arguments = arguments,
+    )
+
+    return [DefaultInfo(files = depset([ctx.outputs.out]))]
+
+generate_sponge_config_hdr = rule(
+    implementation = _generate_sponge_config_hdr_impl,
+    attrs = {
+        "out": attr.output(mandatory = True),
+        "namespace": attr.string(mandatory = True),
+        "class_name": attr.string(mandatory = True),
+        "hash": attr.string(mandatory = True, values = ["poseidon", "poseidon2"]),
+        "field": attr.string(mandatory = True, values = _FIELDS.keys()),
+        "rate": attr.int(mandatory = True),
+        "alpha": attr.int(mandatory = True),
+        "full_rounds": attr.int(mandatory = True),
+        "partial_rounds": attr.int(mandatory = True),
+        "skip_matrices": attr.int(default = 0),
+        "internal_matrix": attr.string(),
+        "internal_matrix_hdr": attr.string(),
+        "hdr_tpl_path": attr.label(
+            mandatory = True,
+            allow_single_file = True,
+        ),
+        "_tool": attr.label(
+            # TODO(chokobole): Change to "exec", so we can build on macos.
+            cfg = "target",
+            executable = True,
+            allow_single_file = True,
+            default = Label("@kroma_network_tachyon//tachyon/crypto/hashes/sponge/generator"),
+        ),
+    },
+)
+
+# Generates a library of |Get{class_name}()|, which returns the
+# |PoseidonConfig| shared by the callers. Its round constants and MDS matrix
+# are computed at build time instead of by the grain LFSR at runtime.
+def generate_poseidon_config(
+        name,
+        class_name,
+        field,
+        rate,
+        alpha,
+        full_rounds,
+        partial_rounds,
+        skip_matrices = 0,
+        namespace = "tachyon::crypto",
+        **kwargs):
+    generate_sponge_config_hdr(
+        namespace = namespace,
+        class_name = class_name,
+        hash = "poseidon",
+        field = field,
+        rate = rate,
+        alpha = alpha,
+        full_rounds = full_rounds,
+        partial_rounds = partial_rounds,
+        skip_matrices = skip_matrices,
+        hdr_tpl_path = Label("@kroma_network_tachyon//tachyon/crypto/hashes/sponge/generator:poseidon_config.h.tpl"),
+        name = "{}_gen_hdr".format(name),
+        out = "{}.h".format(name),
+    )
+
+    tachyon_cc_library(
+        name = name,
+        hdrs = [":{}_gen_hdr".format(name)],
+        deps = [
+            _FIELDS[field].dep,
+            "//tachyon/base:no_destructor",
+            "//tachyon/crypto/hashes/sponge/poseidon:poseidon_config",
+            "//tachyon/math/base:big_int",
+            "@com_google_absl//absl/types:span",
+        ],
+        **kwargs
+    )
+
+# Same as |generate_poseidon_config()|, but for |Poseidon2Config|.
+# |internal_matrix| is the expression of the internal diagonal vector or the
+# internal shift vector declared in |internal_matrix_hdr| of
+# |internal_matrix_dep|.
+def generate_poseidon2_config(
+        name,
+        class_name,
+        field,
+        rate,
+        alpha,
+        full_rounds,
+        partial_rounds,
+        internal_matrix,
+        internal_matrix_hdr,
+        internal_matrix_dep,
+        namespace = "tachyon::crypto",
+        **kwargs):
+    generate_sponge_config_hdr(
+        namespace = namespace,
+        class_name = class_name,
+        hash = "poseidon2",
+        field = field,
+        rate = rate,
+        alpha = alpha,
+        full_rounds = full_rounds,
+        partial_rounds = partial_rounds,
+        internal_matrix = internal_matrix,
+        internal_matrix_hdr = internal_matrix_hdr,
+        hdr_tpl_path = Label("@kroma_network_tachyon//tachyon/crypto/hashes/sponge/generator:poseidon2_config.h.tpl"),
+        name = "{}_gen_hdr".format(name),
+        out = "{}.h".format(name),
+    )
+
+    tachyon_cc_library(
+        name = name,
+        hdrs = [":{}_gen_hdr".format(name)],
+        deps = [
+            _FIELDS[field].dep,
+            internal_matrix_dep,
+            "//tachyon/base:no_destructor",
+            "//tachyon/crypto/hashes/sponge/poseidon2:poseidon2_config",
+            "//tachyon/math/base:big_int",
+            "@com_google_absl//absl/types:span",
+        ],
+        **kwargs
+    )
@@ -0,0 +1,214 @@
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/str_replace.h"
+#include "absl/strings/strip.h"
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/files/file_path_flag.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+#include "tachyon/build/cc_writer.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_config.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
+#include "tachyon/math/finite_fields/goldilocks/goldilocks_prime_field.h"
+#include "tachyon/math/finite_fields/mersenne31/mersenne31.h"
+
+namespace tachyon {
+
+struct GenerationConfig : public build::CcWriter {
+  base::FilePath hdr_tpl_path;
+
+  std::string ns_name;
+  std::string class_name;
+  std::string hash;
+  std::string field;
+  std::string field_type;
+  base::FilePath field_hdr;
+  std::string internal_matrix;
+  base::FilePath internal_matrix_hdr;
+  uint64_t rate;
+  uint64_t alpha;
+  uint64_t full_rounds;
+  uint64_t partial_rounds;
+  uint64_t skip_matrices = 0;
+
+  int GenerateHdr() const;
+
+  template <typename F>
+  int DoGenerateHdr() const;
+};
+
+// Returns the entries of |matrix| in row-major order, each of which is
+// written as the |BigInt| of its canonical value.
+template <typename F>
+std::string GenerateBigInts(const math::Matrix<F>& matrix) {
+  std::stringstream ss;
+  for (Eigen::Index i = 0; i < matrix.rows(); ++i) {
+    for (Eigen::Index j = 0; j < matrix.cols(); ++j) {
+      const typename F::BigIntTy value = matrix(i, j).ToBigInt();
+      std::vector<std::string> limbs;
+      for (size_t k = 0; k < F::BigIntTy::kLimbNums; ++k) {
+        limbs.push_back(absl::Substitute("UINT64_C($0)", value[k]));
+      }
+      ss << absl::Substitute("    tachyon::math::BigInt<$0>({$1}),\n",
+                             F::BigIntTy::kLimbNums,
+                             absl::StrJoin(limbs, ", "));
+    }
+  }
+  return std::string(absl::StripSuffix(ss.str(), "\n"));
+}
+
+template <typename F>
+int GenerationConfig::DoGenerateHdr() const {
+  F::Init();
+
+  absl::flat_hash_map<std::string, std::string> replacements = {
+      {"%{namespace}", ns_name},
+      {"%{class}", class_name},
+      {"%{field}", field_type},
+      {"%{field_hdr}", field_hdr.value()},
+      {"%{rate}", base::NumberToString(rate)},
+      {"%{alpha}", base::NumberToString(alpha)},
+      {"%{full_rounds}", base::NumberToString(full_rounds)},
+      {"%{partial_rounds}", base::NumberToString(partial_rounds)},
+      {"%{n}", base::NumberToString(F::BigIntTy::kLimbNums)},
+      {"%{ark_size}",
+       base::NumberToString((full_rounds + partial_rounds) * (rate + 1))},
+  };
+
+  math::Matrix<F> ark;
+  if (hash == "poseidon") {
+    crypto::PoseidonConfigEntry config_entry(rate, alpha, full_rounds,
+                                             partial_rounds, skip_matrices);
+    math::Matrix<F> mds;
+    crypto::FindPoseidonArkAndMds<F>(
+        config_entry.ToPoseidonGrainLFSRConfig<F>(), skip_matrices, ark, mds);
+    replacements["%{skip_matrices}"] = base::NumberToString(skip_matrices);
+    replacements["%{mds_size}"] = base::NumberToString((rate + 1) * (rate + 1));
+    replacements["%{mds}"] = GenerateBigInts(mds);
+  } else {
+    crypto::Poseidon2ConfigEntry config_entry(rate, alpha, full_rounds,
+                                              partial_rounds);
+    crypto::FindPoseidon2Ark<F>(config_entry.ToPoseidonGrainLFSRConfig<F>(),
+                                ark);
+    // NOTE: Only the first constant of a partial round is used, and the rest
+    // aren't set by |FindPoseidon2Ark()|.
+    for (size_t i = full_rounds / 2; i < full_rounds / 2 + partial_rounds;
+         ++i) {
+      for (size_t j = 1; j < rate + 1; ++j) {
+        ark(i, j) = F::Zero();
+      }
+    }
+    replacements["%{internal_matrix}"] = internal_matrix;
+    replacements["%{internal_matrix_hdr}"] = internal_matrix_hdr.value();
+  }
+  replacements["%{ark}"] = GenerateBigInts(ark);
+
+  std::string tpl_content;
+  CHECK(base::ReadFileToString(hdr_tpl_path, &tpl_content));
+
+  std::string content = absl::StrReplaceAll(tpl_content, replacements);
+  return WriteHdr(content, false);
+}
+
+int GenerationConfig::GenerateHdr() const {
+  if (field == "bn254_fr") {
+    return DoGenerateHdr<math::bn254::Fr>();
+  } else if (field == "baby_bear") {
+    return DoGenerateHdr<math::BabyBear>();
+  } else if (field == "goldilocks") {
+    return DoGenerateHdr<math::Goldilocks>();
+  } else if (field == "mersenne31") {
+    return DoGenerateHdr<math::Mersenne31>();
+  }
+  tachyon_cerr << "field not supported: " << field << std::endl;
+  return 1;
+}
+
+int RealMain(int argc, char** argv) {
+  GenerationConfig config;
+  config.generator = "//tachyon/crypto/hashes/sponge/generator";
+
+  base::FlagParser parser;
+  parser.AddFlag<base::FilePathFlag>(&config.out)
+      .set_long_name("--out")
+      .set_help("path to output");
+  parser.AddFlag<base::StringFlag>(&config.ns_name)
+      .set_long_name("--namespace")
+      .set_required();
+  parser.AddFlag<base::StringFlag>(&config.class_name)
+      .set_long_name("--class")
+      .set_required();
+  parser.AddFlag<base::StringFlag>(&config.hash)
+      .set_long_name("--hash")
+      .set_help("either poseidon or poseidon2")
+      .set_required();
+  parser.AddFlag<base::StringFlag>(&config.field)
+      .set_long_name("--field")
+      .set_help("one of bn254_fr, baby_bear, goldilocks and mersenne31")
+      .set_required();
+  parser.AddFlag<base::StringFlag>(&config.field_type)
+      .set_long_name("--field_type")
+      .set_required();
+  parser.AddFlag<base::FilePathFlag>(&config.field_hdr)
+      .set_long_name("--field_hdr")
+      .set_required();
+  parser.AddFlag<base::StringFlag>(&config.internal_matrix)
+      .set_long_name("--internal_matrix")
+      .set_help(
+          "expression of the internal diagonal vector or the internal shift "
+          "vector of poseidon2");
+  parser.AddFlag<base::FilePathFlag>(&config.internal_matrix_hdr)
+      .set_long_name("--internal_matrix_hdr");
+  parser.AddFlag<base::Uint64Flag>(&config.rate)
+      .set_long_name("--rate")
+      .set_required();
+  parser.AddFlag<base::Uint64Flag>(&config.alpha)
+      .set_long_name("--alpha")
+      .set_required();
+  parser.AddFlag<base::Uint64Flag>(&config.full_rounds)
+      .set_long_name("--full_rounds")
+      .set_required();
+  parser.AddFlag<base::Uint64Flag>(&config.partial_rounds)
+      .set_long_name("--partial_rounds")
+      .set_required();
+  parser.AddFlag<base::Uint64Flag>(&config.skip_matrices)
+      .set_long_name("--skip_matrices");
+  parser.AddFlag<base::FilePathFlag>(&config.hdr_tpl_path)
+      .set_long_name("--hdr_tpl_path")
+      .set_required();
+
+  std::string error;
+  if (!parser.Parse(argc, argv, &error)) {
+    tachyon_cerr << error << std::endl;
+    return 1;
+  }
+
+  if (config.hash != "poseidon" && config.hash != "poseidon2") {
+    tachyon_cerr << "hash not supported: " << config.hash << std::endl;
+    return 1;
+  }
+  if (config.hash == "poseidon2" && config.internal_matrix.empty()) {
+    tachyon_cerr << "--internal_matrix is required for poseidon2" << std::endl;
+    return 1;
+  }
+
+  if (base::EndsWith(config.out.value(), ".h")) {
+    return config.GenerateHdr();
+  } else {
+    tachyon_cerr << "suffix not supported:" << config.out << std::endl;
+    return 1;
+  }
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
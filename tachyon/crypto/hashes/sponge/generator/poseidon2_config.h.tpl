@@ -0,0 +1,31 @@
+// clang-format off
+#include <array>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_config.h"
+#include "tachyon/math/base/big_int.h"
+#include "%{field_hdr}"
+#include "%{internal_matrix_hdr}"
+
+namespace %{namespace} {
+
+// The round constants of the Poseidon2 over |%{field}|
+// with rate: %{rate}, alpha: %{alpha}, full_rounds: %{full_rounds} and partial_rounds: %{partial_rounds},
+// which are the canonical values in row-major order.
+inline constexpr std::array<tachyon::math::BigInt<%{n}>, %{ark_size}> k%{class}Ark = {
+%{ark}
+};
+
+// Returns the config created from the constants above on the first call, which
+// is shared by the callers. |F| is either |%{field}| or its packed field.
+template <typename F = %{field}>
+const tachyon::crypto::Poseidon2Config<F>& Get%{class}() {
+  static const tachyon::base::NoDestructor<tachyon::crypto::Poseidon2Config<F>> config(
+      tachyon::crypto::Poseidon2Config<F>::CreateCustom(%{rate}, %{alpha}, %{full_rounds}, %{partial_rounds}, %{internal_matrix}, absl::MakeConstSpan(k%{class}Ark)));
+  return *config;
+}
+
+}  // namespace %{namespace}
+// clang-format on
@@ -0,0 +1,34 @@
+// clang-format off
+#include <array>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config.h"
+#include "tachyon/math/base/big_int.h"
+#include "%{field_hdr}"
+
+namespace %{namespace} {
+
+// The round constants and the MDS matrix of the Poseidon over |%{field}|
+// with rate: %{rate}, alpha: %{alpha}, full_rounds: %{full_rounds}, partial_rounds: %{partial_rounds} and skip_matrices: %{skip_matrices},
+// which are the canonical values in row-major order.
+inline constexpr std::array<tachyon::math::BigInt<%{n}>, %{ark_size}> k%{class}Ark = {
+%{ark}
+};
+
+inline constexpr std::array<tachyon::math::BigInt<%{n}>, %{mds_size}> k%{class}Mds = {
+%{mds}
+};
+
+// Returns the config created from the constants above on the first call, which
+// is shared by the callers.
+template <typename F = %{field}>
+const tachyon::crypto::PoseidonConfig<F>& Get%{class}() {
+  static const tachyon::base::NoDestructor<tachyon::crypto::PoseidonConfig<F>> config(
+      tachyon::crypto::PoseidonConfig<F>::CreateCustom(%{rate}, %{alpha}, %{full_rounds}, %{partial_rounds}, absl::MakeConstSpan(k%{class}Ark), absl::MakeConstSpan(k%{class}Mds)));
+  return *config;
+}
+
+}  // namespace %{namespace}
+// clang-format on
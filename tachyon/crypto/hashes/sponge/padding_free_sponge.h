@@ -31,13 +31,51 @@ class PaddingFreeSponge final
 
   template <typename T>
   std::array<F, Out> DoHash(const T& input) const {
+    ResetState();
+    size_t idx = 0;
+    AbsorbRow(input, idx);
+    return Finalize(idx);
+  }
+
+  template <typename Rows>
+  std::array<F, Out> DoHashRows(const Rows& rows) const {
+    ResetState();
+    size_t idx = 0;
+    for (const auto& row : rows) {
+      AbsorbRow(row, idx);
+    }
+    return Finalize(idx);
+  }
+
+  // Every hash starts from a zeroed state, so that it doesn't depend on the
+  // previous ones.
+  void ResetState() const {
+    auto& state = derived_.state;
+    for (Eigen::Index i = 0; i < state.elements.size(); ++i) {
+      state[i] = F::Zero();
+    }
+  }
+
+  // Overwrites the rate part of the state with |row| from |idx| and
+  // permutes whenever it is full, so that a row split across the rows passed
+  // to |DoHashRows()| is hashed as if they were concatenated.
+  template <typename T>
+  void AbsorbRow(const T& row, size_t& idx) const {
     auto& state = derived_.state;
-    for (size_t i = 0; i < std::size(input); i += Rate) {
-      for (size_t j = 0; j < Rate; ++j) {
-        if (i + j < std::size(input)) {
-          state[j] = input[i + j];
-        }
+    for (size_t i = 0; i < std::size(row); ++i) {
+      state[idx++] = row[i];
+      if (idx == Rate) {
+        derived_.Permute();
+        idx = 0;
       }
+    }
+  }
+
+  // Permutes the last partially overwritten rate, if any, and returns the
+  // first |Out| elements of the state.
+  std::array<F, Out> Finalize(size_t idx) const {
+    auto& state = derived_.state;
+    if (idx > 0) {
       derived_.Permute();
     }
     std::array<F, Out> ret;
@@ -2,6 +2,7 @@
 
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
@@ -40,4 +41,24 @@ TEST_F(PaddingFreeSpongeTest, Hash) {
   EXPECT_EQ(hash, expected);
 }
 
+TEST_F(PaddingFreeSpongeTest, HashRows) {
+  using Poseidon2 = Poseidon2Sponge<
+      Poseidon2ExternalMatrix<Poseidon2HorizenExternalMatrix<F>>>;
+  constexpr size_t kRate = 8;
+  constexpr size_t kOut = 8;
+
+  Poseidon2Config<F> config = Poseidon2Config<F>::CreateCustom(
+      15, 7, 8, 13, math::GetPoseidon2BabyBearInternalShiftVector<15>());
+  Poseidon2 sponge(config);
+  PaddingFreeSponge<Poseidon2, kRate, kOut> hasher(std::move(sponge));
+  std::vector<F> inputs =
+      base::CreateVector(100, [](uint32_t i) { return F(i); });
+  // The rows don't line up with the rate.
+  absl::Span<const F> elements(inputs);
+  std::vector<absl::Span<const F>> rows = {
+      elements.subspan(0, 3), elements.subspan(3, 0), elements.subspan(3, 13),
+      elements.subspan(16, 84)};
+  EXPECT_EQ(hasher.HashRows(rows), hasher.Hash(inputs));
+}
+
 }  // namespace tachyon::crypto
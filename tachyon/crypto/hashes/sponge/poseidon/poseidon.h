@@ -13,6 +13,7 @@
 #include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config.h"
 #include "tachyon/crypto/hashes/sponge/poseidon/poseidon_sponge_base.h"
 #include "tachyon/crypto/hashes/sponge/sponge_state.h"
+#include "tachyon/math/finite_fields/lazy_reduction_accumulator.h"
 
 namespace tachyon {
 namespace crypto {
@@ -41,12 +42,50 @@ struct PoseidonSponge final : public PoseidonSpongeBase<PoseidonSponge<F>> {
   PoseidonSponge(const PoseidonConfig<F>& config, SpongeState<F>&& state)
       : config(config), state(std::move(state)) {}
 
+  // Same as |PoseidonSpongeBase::Permute()|, but with the
+  // |config.optimized_constants| if set.
+  void Permute() {
+    if (!config.optimized_constants) {
+      PoseidonSpongeBase<PoseidonSponge<F>>::Permute();
+      return;
+    }
+    const PoseidonOptimizedConstants<F>& constants =
+        *config.optimized_constants;
+    size_t full_rounds_over_2 = config.full_rounds / 2;
+    for (size_t i = 0; i < full_rounds_over_2; ++i) {
+      state.elements += constants.full_round_ark.row(i).transpose();
+      this->ApplySBox(/*is_full_round=*/true);
+      ApplyDenseMix(i + 1 == full_rounds_over_2 ? constants.pre_sparse_mds
+                                                : config.mds);
+    }
+    for (size_t i = 0; i < config.partial_rounds; ++i) {
+      state[0] += constants.partial_round_ark[i];
+      this->ApplySBox(/*is_full_round=*/false);
+      ApplySparseMix(constants, i);
+    }
+    for (size_t i = full_rounds_over_2; i < config.full_rounds; ++i) {
+      state.elements += constants.full_round_ark.row(i).transpose();
+      this->ApplySBox(/*is_full_round=*/true);
+      ApplyDenseMix(config.mds);
+    }
+  }
+
   // PoseidonSpongeBase methods
   void ApplyARK(Eigen::Index round_number, bool) {
     state.elements += config.ark.row(round_number);
   }
 
-  void ApplyMix(bool) {
+  void ApplyMix(bool) { ApplyDenseMix(config.mds); }
+
+  bool operator==(const PoseidonSponge& other) const {
+    return config == other.config && state == other.state;
+  }
+  bool operator!=(const PoseidonSponge& other) const {
+    return !operator==(other);
+  }
+
+ private:
+  void ApplyDenseMix(const math::Matrix<F>& matrix) {
     // NOTE (chokobole): Eigen matrix multiplication has a computational
     // overhead unlike naive matrix multiplication.
     //
@@ -74,20 +113,33 @@ struct PoseidonSponge final : public PoseidonSpongeBase<PoseidonSponge<F>> {
     // m₁v₁ + m₀v₀ + 0
     // m₃v₁ + m₂v₀ * 1
     // m₃v₁ + m₂v₀ + 0
+    //
+    // Every row is accumulated by |math::LazyReductionAccumulator|, which
+    // reduces once per row if |F| allows it.
     math::Vector<F> elements(state.elements.size());
-    for (Eigen::Index i = 0; i < config.mds.rows(); ++i) {
-      for (Eigen::Index j = 0; j < config.mds.cols(); ++j) {
-        elements[i] += config.mds(i, j) * state.elements[j];
+    for (Eigen::Index i = 0; i < matrix.rows(); ++i) {
+      math::LazyReductionAccumulator<F> sum;
+      for (Eigen::Index j = 0; j < matrix.cols(); ++j) {
+        sum.AddProduct(matrix(i, j), state.elements[j]);
       }
+      elements[i] = sum.Reduce();
     }
     state.elements = std::move(elements);
   }
 
-  bool operator==(const PoseidonSponge& other) const {
-    return config == other.config && state == other.state;
-  }
-  bool operator!=(const PoseidonSponge& other) const {
-    return !operator==(other);
+  // Multiplies |state| by the sparse matrix of the |round|-th partial round,
+  // which is the identity except for its first row and column.
+  void ApplySparseMix(const PoseidonOptimizedConstants<F>& constants,
+                      size_t round) {
+    math::LazyReductionAccumulator<F> first;
+    first.AddProduct(config.mds(0, 0), state[0]);
+    for (Eigen::Index j = 1; j < config.mds.cols(); ++j) {
+      first.AddProduct(constants.sparse_first_rows(round, j - 1), state[j]);
+    }
+    for (Eigen::Index j = 1; j < config.mds.cols(); ++j) {
+      state[j] += constants.sparse_first_columns(round, j - 1) * state[0];
+    }
+    state[0] = first.Reduce();
   }
 };
 
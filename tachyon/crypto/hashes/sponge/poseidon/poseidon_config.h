@@ -6,6 +6,7 @@
 #ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_CONFIG_H_
 #define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_CONFIG_H_
 
+#include <optional>
 #include <utility>
 
 #include "absl/types/span.h"
@@ -16,6 +17,7 @@
 #include "tachyon/base/ranges/algorithm.h"
 #include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config_base.h"
 #include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config_entry.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_optimized_constants.h"
 
 namespace tachyon {
 namespace crypto {
@@ -62,6 +64,10 @@ struct PoseidonConfig : public PoseidonConfigBase<F> {
   // Maximally Distance Separating (MDS) Matrix.
   math::Matrix<F> mds;
 
+  // If set, |PoseidonSponge| permutes with these instead of |ark| and |mds|.
+  // See |UseOptimizedConstants()|.
+  std::optional<PoseidonOptimizedConstants<F>> optimized_constants;
+
   PoseidonConfig() = default;
   PoseidonConfig(const PoseidonConfigBase<F>& base, const math::Matrix<F>& mds)
       : PoseidonConfigBase<F>(base), mds(mds) {}
@@ -96,6 +102,39 @@ struct PoseidonConfig : public PoseidonConfigBase<F> {
     return ret;
   }
 
+  // Same as above, but with |ark| and |mds| of the canonical values in
+  // row-major order, which are generated at build time by
+  // |generate_poseidon_config()|, instead of the grain LFSR.
+  template <typename BigInt>
+  static PoseidonConfig CreateCustom(size_t rate, uint64_t alpha,
+                                     size_t full_rounds, size_t partial_rounds,
+                                     absl::Span<const BigInt> ark,
+                                     absl::Span<const BigInt> mds) {
+    PoseidonConfigEntry config_entry(rate, alpha, full_rounds, partial_rounds,
+                                     0);
+    PoseidonConfig ret = config_entry.ToPoseidonConfig<F>();
+    size_t state_len = ret.rate + ret.capacity;
+    ret.ark = internal::CreateMatrixFromBigInts<F>(
+        ark, full_rounds + partial_rounds, state_len);
+    ret.mds = internal::CreateMatrixFromBigInts<F>(mds, state_len, state_len);
+    return ret;
+  }
+
+  // Derives |optimized_constants| from |ark| and |mds|, which makes a partial
+  // round cost O(t) instead of O(t²) multiplications. The permutation stays
+  // the same.
+  [[nodiscard]] bool UseOptimizedConstants() {
+    PoseidonOptimizedConstants<F> constants;
+    if (!PoseidonOptimizedConstants<F>::Create(this->ark, mds,
+                                               this->full_rounds,
+                                               this->partial_rounds,
+                                               &constants)) {
+      return false;
+    }
+    optimized_constants = std::move(constants);
+    return true;
+  }
+
   bool IsValid() const override {
     return PoseidonConfigBase<F>::IsValid() &&
            static_cast<size_t>(mds.rows()) == this->rate + this->capacity &&
@@ -103,7 +142,8 @@ struct PoseidonConfig : public PoseidonConfigBase<F> {
   }
 
   bool operator==(const PoseidonConfig& other) const {
-    return PoseidonConfigBase<F>::operator==(other) && mds == other.mds;
+    return PoseidonConfigBase<F>::operator==(other) && mds == other.mds &&
+           optimized_constants == other.optimized_constants;
   }
   bool operator!=(const PoseidonConfig& other) const {
     return !operator==(other);
@@ -128,27 +168,33 @@ namespace base {
 template <typename F>
 class Copyable<crypto::PoseidonConfig<F>> {
  public:
+  // NOTE: The optimized constants are derived again from |ark| and |mds|
+  // when read, so only whether they are used is written.
   static bool WriteTo(const crypto::PoseidonConfig<F>& config, Buffer* buffer) {
     return Copyable<crypto::PoseidonConfigBase<F>>::WriteTo(config, buffer) &&
-           buffer->Write(config.mds);
+           buffer->WriteMany(config.mds,
+                             config.optimized_constants.has_value());
   }
 
   static bool ReadFrom(const ReadOnlyBuffer& buffer,
                        crypto::PoseidonConfig<F>* config) {
     crypto::PoseidonConfigBase<F> base;
     math::Matrix<F> mds;
-    if (!buffer.ReadMany(&base, &mds)) {
+    bool use_optimized_constants;
+    if (!buffer.ReadMany(&base, &mds, &use_optimized_constants)) {
       return false;
     }
 
     *config = {std::move(base), std::move(mds)};
+    if (use_optimized_constants) return config->UseOptimizedConstants();
     return true;
   }
 
   static size_t EstimateSize(const crypto::PoseidonConfig<F>& config) {
     const crypto::PoseidonConfigBase<F>& base =
         static_cast<const crypto::PoseidonConfigBase<F>&>(config);
-    return base::EstimateSize(base, config.mds);
+    return base::EstimateSize(base, config.mds,
+                              config.optimized_constants.has_value());
   }
 };
 
@@ -9,14 +9,47 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <type_traits>
 #include <utility>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/crypto/hashes/sponge/sponge_config.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
 #include "tachyon/math/matrix/matrix_types.h"
 
 namespace tachyon {
 namespace crypto {
+namespace internal {
+
+// Returns the |rows| x |cols| matrix of |values| in row-major order, which are
+// the canonical values of the prime field of |F|. This is used to build the
+// configs from the constants generated at build time.
+template <typename F, typename BigInt>
+math::Matrix<F> CreateMatrixFromBigInts(absl::Span<const BigInt> values,
+                                        size_t rows, size_t cols) {
+  using PrimeField =
+      std::conditional_t<math::FiniteFieldTraits<F>::kIsPackedPrimeField,
+                         typename math::FiniteFieldTraits<F>::PrimeField, F>;
+
+  CHECK_EQ(values.size(), rows * cols);
+  math::Matrix<F> ret(rows, cols);
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t j = 0; j < cols; ++j) {
+      PrimeField value(values[i * cols + j]);
+      if constexpr (math::FiniteFieldTraits<F>::kIsPackedPrimeField) {
+        ret(i, j) = F::Broadcast(value);
+      } else {
+        ret(i, j) = value;
+      }
+    }
+  }
+  return ret;
+}
+
+}  // namespace internal
 
 template <typename F>
 struct PoseidonConfigBase : public SpongeConfig {
@@ -13,6 +13,8 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/crypto/hashes/sponge/poseidon/bn254_t3_poseidon_config.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/bn254_t5_poseidon_config.h"
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 
@@ -87,4 +89,16 @@ TEST(PoseidonConfigTest, CreateCustom) {
   }
 }
 
+TEST(PoseidonConfigTest, Generated) {
+  using F = math::bn254::Fr;
+  F::Init();
+
+  EXPECT_EQ(GetBn254T3PoseidonConfig(),
+            PoseidonConfig<F>::CreateCustom(2, 5, 8, 57, 0));
+  EXPECT_EQ(GetBn254T5PoseidonConfig(),
+            PoseidonConfig<F>::CreateCustom(4, 5, 8, 60, 0));
+  // The config is created only once.
+  EXPECT_EQ(&GetBn254T3PoseidonConfig(), &GetBn254T3PoseidonConfig());
+}
+
 }  // namespace tachyon::crypto
@@ -0,0 +1,172 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_OPTIMIZED_CONSTANTS_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_OPTIMIZED_CONSTANTS_H_
+
+#include <stddef.h>
+
+#include <utility>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/optional.h"
+#include "tachyon/math/matrix/matrix_types.h"
+
+namespace tachyon::crypto {
+
+// The constants of Poseidon rewritten so that a partial round costs O(t)
+// instead of O(t²) multiplications, where t is the width. See Appendix B of
+// https://eprint.iacr.org/2019/458.
+//
+// 1. A partial round only raises the first element to the power, so the
+//    round constants of the other elements are moved through the S-box and
+//    the MDS into the next round. Every partial round then just adds a
+//    constant to the first element, and what is left is added to the first
+//    full round after the partial rounds.
+// 2. The MDS M = [[m₀₀, vᵀ], [w, M̂]] is factored into M'' * M', where
+//    M' = [[1, 0], [0, M̂]] and M'' = [[m₀₀, vᵀM̂⁻¹], [w, I]]. M' doesn't
+//    touch the first element, so it commutes with the S-box and the
+//    constant of a partial round and is merged into the matrix of the
+//    previous round, which is factored again. Every partial round is then
+//    left with a sparse M'', and the product of the last M' and the MDS is
+//    used at the last full round before the partial rounds.
+template <typename F>
+struct PoseidonOptimizedConstants {
+  // |full_round_ark[i]| is added to the state at the i-th full round.
+  math::Matrix<F> full_round_ark;
+  // |partial_round_ark[i]| is added to the first element at the i-th partial
+  // round.
+  math::Vector<F> partial_round_ark;
+  // The dense matrix used in place of the MDS at the last full round before
+  // the partial rounds.
+  math::Matrix<F> pre_sparse_mds;
+  // |sparse_first_rows[i]| and |sparse_first_columns[i]| are vᵀM̂⁻¹ and w of
+  // the sparse matrix of the i-th partial round, whose top left element is
+  // always m₀₀ of the MDS.
+  math::Matrix<F> sparse_first_rows;
+  math::Matrix<F> sparse_first_columns;
+
+  // Derives the constants from the round constants |ark| and the |mds| of
+  // Poseidon. Returns false if the bottom right corner of |mds| is not
+  // invertible.
+  [[nodiscard]] static bool Create(const math::Matrix<F>& ark,
+                                   const math::Matrix<F>& mds,
+                                   size_t full_rounds, size_t partial_rounds,
+                                   PoseidonOptimizedConstants* out) {
+    Eigen::Index width = mds.rows();
+    size_t full_rounds_over_2 = full_rounds / 2;
+    if (partial_rounds > 0 && full_rounds_over_2 == 0) {
+      LOG(ERROR) << "No full round before the partial rounds";
+      return false;
+    }
+
+    PoseidonOptimizedConstants ret;
+    ret.full_round_ark = math::Matrix<F>(full_rounds, width);
+    ret.partial_round_ark = math::Vector<F>(partial_rounds);
+    for (size_t i = 0; i < full_rounds_over_2; ++i) {
+      ret.full_round_ark.row(i) = ark.row(i);
+    }
+    math::Vector<F> carry(width);
+    for (size_t i = 0; i < partial_rounds; ++i) {
+      math::Vector<F> constants(width);
+      for (Eigen::Index j = 0; j < width; ++j) {
+        constants[j] = ark(full_rounds_over_2 + i, j) + carry[j];
+      }
+      ret.partial_round_ark[i] = constants[0];
+      constants[0] = F::Zero();
+      carry = Multiply(mds, constants);
+    }
+    for (size_t i = full_rounds_over_2; i < full_rounds; ++i) {
+      ret.full_round_ark.row(i) = ark.row(partial_rounds + i);
+    }
+    if (full_rounds_over_2 < full_rounds) {
+      for (Eigen::Index j = 0; j < width; ++j) {
+        ret.full_round_ark(full_rounds_over_2, j) += carry[j];
+      }
+    }
+
+    // Factors the matrix of every partial round from the last one.
+    ret.sparse_first_rows = math::Matrix<F>(partial_rounds, width - 1);
+    ret.sparse_first_columns = math::Matrix<F>(partial_rounds, width - 1);
+    math::Matrix<F> matrix = mds;
+    for (size_t i = partial_rounds; i-- > 0;) {
+      math::Matrix<F> m_hat = matrix.bottomRightCorner(width - 1, width - 1);
+      // vᵀM̂⁻¹ is the solution x of M̂ᵀx = v.
+      math::Vector<F> first_row;
+      if (!Solve(m_hat.transpose(),
+                 matrix.topRightCorner(1, width - 1).transpose(),
+                 &first_row)) {
+        LOG(ERROR) << "The MDS is not invertible";
+        return false;
+      }
+      ret.sparse_first_rows.row(i) = first_row.transpose();
+      ret.sparse_first_columns.row(i) =
+          matrix.bottomLeftCorner(width - 1, 1).transpose();
+
+      math::Matrix<F> m_prime(width, width);
+      m_prime(0, 0) = F::One();
+      m_prime.bottomRightCorner(width - 1, width - 1) = m_hat;
+      matrix = Multiply(m_prime, mds);
+    }
+    ret.pre_sparse_mds = std::move(matrix);
+    *out = std::move(ret);
+    return true;
+  }
+
+  bool operator==(const PoseidonOptimizedConstants& other) const {
+    return full_round_ark == other.full_round_ark &&
+           partial_round_ark == other.partial_round_ark &&
+           pre_sparse_mds == other.pre_sparse_mds &&
+           sparse_first_rows == other.sparse_first_rows &&
+           sparse_first_columns == other.sparse_first_columns;
+  }
+  bool operator!=(const PoseidonOptimizedConstants& other) const {
+    return !operator==(other);
+  }
+
+ private:
+  // NOTE: Eigen matrix multiplication has a computational overhead, see
+  // |PoseidonSponge::ApplyDenseMix()|.
+  template <typename Rhs>
+  static Rhs Multiply(const math::Matrix<F>& lhs, const Rhs& rhs) {
+    Rhs ret(lhs.rows(), rhs.cols());
+    for (Eigen::Index i = 0; i < lhs.rows(); ++i) {
+      for (Eigen::Index j = 0; j < rhs.cols(); ++j) {
+        for (Eigen::Index k = 0; k < lhs.cols(); ++k) {
+          ret(i, j) += lhs(i, k) * rhs(k, j);
+        }
+      }
+    }
+    return ret;
+  }
+
+  // Solves |a| * x = |b| by Gauss-Jordan elimination.
+  static bool Solve(math::Matrix<F> a, math::Vector<F> b, math::Vector<F>* x) {
+    Eigen::Index n = a.rows();
+    for (Eigen::Index col = 0; col < n; ++col) {
+      Eigen::Index pivot = col;
+      while (pivot < n && a(pivot, col).IsZero()) ++pivot;
+      if (pivot == n) return false;
+      if (pivot != col) {
+        a.row(pivot).swap(a.row(col));
+        std::swap(b[pivot], b[col]);
+      }
+      F inv = unwrap(a(col, col).Inverse());
+      for (Eigen::Index j = col; j < n; ++j) {
+        a(col, j) *= inv;
+      }
+      b[col] *= inv;
+      for (Eigen::Index row = 0; row < n; ++row) {
+        if (row == col || a(row, col).IsZero()) continue;
+        F factor = a(row, col);
+        for (Eigen::Index j = col; j < n; ++j) {
+          a(row, j) -= factor * a(col, j);
+        }
+        b[row] -= factor * b[col];
+      }
+    }
+    *x = std::move(b);
+    return true;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_OPTIMIZED_CONSTANTS_H_
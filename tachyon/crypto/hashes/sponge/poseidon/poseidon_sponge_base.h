@@ -38,6 +38,8 @@ struct PoseidonSpongeBase : public FieldBasedCryptographicSponge<Derived> {
     }
   }
 
+  // NOTE: This is called through |Derived|, so that |Derived| can replace it
+  // by defining its own |Permute()|.
   void Permute() {
     Derived& derived = static_cast<Derived&>(*this);
     auto& config = derived.config;
@@ -68,19 +70,22 @@ struct PoseidonSpongeBase : public FieldBasedCryptographicSponge<Derived> {
     }
   }
 
-  // Absorbs everything in |elements|, this does not end in an absorbing.
-  void AbsorbInternal(size_t rate_start_index, absl::Span<const F> elements) {
+  // Absorbs every |stride|-th element of |elements|, this does not end in an
+  // absorbing.
+  void AbsorbInternal(size_t rate_start_index, absl::Span<const F> elements,
+                      size_t stride) {
     Derived& derived = static_cast<Derived&>(*this);
     auto& config = derived.config;
     auto& state = derived.state;
+    size_t num_elements = (elements.size() + stride - 1) / stride;
     size_t elements_idx = 0;
     while (true) {
-      size_t remaining_size = elements.size() - elements_idx;
+      size_t remaining_size = num_elements - elements_idx;
       // if we can finish in this call
       if (rate_start_index + remaining_size <= config.rate) {
         for (size_t i = 0; i < remaining_size; ++i, ++elements_idx) {
           state[config.capacity + i + rate_start_index] +=
-              elements[elements_idx];
+              elements[elements_idx * stride];
         }
         state.mode.type = DuplexSpongeMode::Type::kAbsorbing;
         state.mode.next_index = rate_start_index + remaining_size;
@@ -89,26 +94,27 @@ struct PoseidonSpongeBase : public FieldBasedCryptographicSponge<Derived> {
       // otherwise absorb (|config.rate| - |rate_start_index|) elements
       size_t num_elements_absorbed = config.rate - rate_start_index;
       for (size_t i = 0; i < num_elements_absorbed; ++i, ++elements_idx) {
-        state[config.capacity + i + rate_start_index] += elements[elements_idx];
+        state[config.capacity + i + rate_start_index] +=
+            elements[elements_idx * stride];
       }
-      Permute();
+      derived.Permute();
       rate_start_index = 0;
     }
   }
 
   // Squeeze |output| many elements. This does not end in a squeezing.
-  void SqueezeInternal(size_t rate_start_index, std::vector<F>* output) {
+  void SqueezeInternal(size_t rate_start_index, absl::Span<F> output) {
     Derived& derived = static_cast<Derived&>(*this);
     auto& config = derived.config;
     auto& state = derived.state;
-    size_t output_size = output->size();
+    size_t output_size = output.size();
     size_t output_idx = 0;
     while (true) {
       size_t output_remaining_size = output_size - output_idx;
       // if we can finish in this call
       if (rate_start_index + output_remaining_size <= config.rate) {
         for (size_t i = 0; i < output_remaining_size; ++i) {
-          (*output)[output_idx + i] =
+          output[output_idx + i] =
               state[config.capacity + rate_start_index + i];
         }
         state.mode.type = DuplexSpongeMode::Type::kSqueezing;
@@ -119,12 +125,11 @@ struct PoseidonSpongeBase : public FieldBasedCryptographicSponge<Derived> {
       // otherwise squeeze (|config.rate| - |rate_start_index|) elements
       size_t num_elements_squeezed = config.rate - rate_start_index;
       for (size_t i = 0; i < num_elements_squeezed; ++i) {
-        (*output)[output_idx + i] =
-            state[config.capacity + rate_start_index + i];
+        output[output_idx + i] = state[config.capacity + rate_start_index + i];
       }
 
       if (output_remaining_size != config.rate) {
-        Permute();
+        derived.Permute();
       }
       output_idx += num_elements_squeezed;
       rate_start_index = 0;
@@ -142,30 +147,7 @@ struct PoseidonSpongeBase : public FieldBasedCryptographicSponge<Derived> {
     return Absorb(absl::MakeConstSpan(elements));
   }
 
-  bool Absorb(absl::Span<const F> input) {
-    Derived& derived = static_cast<Derived&>(*this);
-    auto& config = derived.config;
-    auto& state = derived.state;
-
-    switch (state.mode.type) {
-      case DuplexSpongeMode::Type::kAbsorbing: {
-        size_t absorb_index = state.mode.next_index;
-        if (absorb_index == config.rate) {
-          Permute();
-          absorb_index = 0;
-        }
-        AbsorbInternal(absorb_index, input);
-        return true;
-      }
-      case DuplexSpongeMode::Type::kSqueezing: {
-        Permute();
-        AbsorbInternal(0, input);
-        return true;
-      }
-    }
-    NOTREACHED();
-    return false;
-  }
+  bool Absorb(absl::Span<const F> input) { return DoAbsorbStrided(input, 1); }
 
   std::vector<uint8_t> SqueezeBytes(size_t num_bytes) {
     size_t usable_bytes = (F::kModulusBits - 1) / 8;
@@ -221,30 +203,63 @@ struct PoseidonSpongeBase : public FieldBasedCryptographicSponge<Derived> {
   }
 
   // FieldBasedCryptographicSponge methods
-  std::vector<F> SqueezeNativeFieldElements(size_t num_elements) {
+  bool DoAbsorbStrided(absl::Span<const F> elements, size_t stride) {
     Derived& derived = static_cast<Derived&>(*this);
     auto& config = derived.config;
     auto& state = derived.state;
+    if (stride == 0) {
+      LOG(ERROR) << "Stride must be positive";
+      return false;
+    }
+
+    switch (state.mode.type) {
+      case DuplexSpongeMode::Type::kAbsorbing: {
+        size_t absorb_index = state.mode.next_index;
+        if (absorb_index == config.rate) {
+          derived.Permute();
+          absorb_index = 0;
+        }
+        AbsorbInternal(absorb_index, elements, stride);
+        return true;
+      }
+      case DuplexSpongeMode::Type::kSqueezing: {
+        derived.Permute();
+        AbsorbInternal(0, elements, stride);
+        return true;
+      }
+    }
+    NOTREACHED();
+    return false;
+  }
 
+  std::vector<F> SqueezeNativeFieldElements(size_t num_elements) {
     std::vector<F> ret(num_elements);
+    DoSqueezeInto(absl::MakeSpan(ret));
+    return ret;
+  }
+
+  void DoSqueezeInto(absl::Span<F> output) {
+    Derived& derived = static_cast<Derived&>(*this);
+    auto& config = derived.config;
+    auto& state = derived.state;
+
     switch (state.mode.type) {
       case DuplexSpongeMode::Type::kAbsorbing: {
-        Permute();
-        SqueezeInternal(0, &ret);
-        return ret;
+        derived.Permute();
+        SqueezeInternal(0, output);
+        return;
       }
       case DuplexSpongeMode::Type::kSqueezing: {
         size_t squeeze_index = state.mode.next_index;
         if (squeeze_index == config.rate) {
-          Permute();
+          derived.Permute();
           squeeze_index = 0;
         }
-        SqueezeInternal(squeeze_index, &ret);
-        return ret;
+        SqueezeInternal(squeeze_index, output);
+        return;
       }
     }
     NOTREACHED();
-    return {};
   }
 };
 
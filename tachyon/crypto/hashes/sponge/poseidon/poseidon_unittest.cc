@@ -7,9 +7,11 @@
 
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
 #include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
@@ -44,6 +46,30 @@ TEST_F(PoseidonTest, AbsorbSqueeze) {
   EXPECT_EQ(result, expected);
 }
 
+TEST_F(PoseidonTest, AbsorbStridedAndSqueezeInto) {
+  using Fr = math::bls12_381::Fr;
+
+  PoseidonConfig<Fr> config = PoseidonConfig<Fr>::CreateDefault(2, false);
+  PoseidonSponge<Fr> sponge(config);
+  PoseidonSponge<Fr> strided_sponge(config);
+  // A 5x3 row-major matrix, whose columns are absorbed one by one.
+  std::vector<Fr> matrix =
+      base::CreateVector(15, [](uint32_t i) { return Fr(i); });
+  for (size_t col = 0; col < 3; ++col) {
+    std::vector<Fr> column = base::CreateVector(
+        5, [&matrix, col](size_t row) { return matrix[row * 3 + col]; });
+    ASSERT_TRUE(sponge.Absorb(column));
+    ASSERT_TRUE(strided_sponge.AbsorbStrided(
+        absl::MakeConstSpan(matrix).subspan(col), 3));
+  }
+  std::vector<Fr> output(4);
+  strided_sponge.SqueezeInto(absl::MakeSpan(output).subspan(0, 1));
+  strided_sponge.SqueezeInto(absl::MakeSpan(output).subspan(1));
+  EXPECT_EQ(output, sponge.SqueezeNativeFieldElements(4));
+
+  EXPECT_FALSE(strided_sponge.AbsorbStrided(matrix, 0));
+}
+
 TEST_F(PoseidonTest, Copyable) {
   using Fr = math::bls12_381::Fr;
 
@@ -63,6 +89,45 @@ TEST_F(PoseidonTest, Copyable) {
   EXPECT_EQ(value, expected);
 }
 
+TEST_F(PoseidonTest, OptimizedConstants) {
+  using Fr = math::bls12_381::Fr;
+
+  for (size_t rate : {size_t{2}, size_t{4}, size_t{8}}) {
+    SCOPED_TRACE(rate);
+    PoseidonConfig<Fr> config = PoseidonConfig<Fr>::CreateDefault(rate, false);
+    PoseidonConfig<Fr> optimized_config = config;
+    ASSERT_TRUE(optimized_config.UseOptimizedConstants());
+
+    PoseidonSponge<Fr> sponge(config);
+    PoseidonSponge<Fr> optimized_sponge(optimized_config);
+    std::vector<Fr> inputs = {Fr(0), Fr(1), Fr(2), Fr(3), Fr(4)};
+    ASSERT_TRUE(sponge.Absorb(inputs));
+    ASSERT_TRUE(optimized_sponge.Absorb(inputs));
+    EXPECT_EQ(optimized_sponge.SqueezeNativeFieldElements(3),
+              sponge.SqueezeNativeFieldElements(3));
+  }
+}
+
+TEST_F(PoseidonTest, CopyableWithOptimizedConstants) {
+  using Fr = math::bls12_381::Fr;
+
+  PoseidonConfig<Fr> config = PoseidonConfig<Fr>::CreateDefault(2, false);
+  ASSERT_TRUE(config.UseOptimizedConstants());
+  PoseidonSponge<Fr> expected(config);
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  PoseidonSponge<Fr> value;
+  ASSERT_TRUE(write_buf.Read(&value));
+
+  EXPECT_EQ(value, expected);
+}
+
 namespace {
 
 class PackedPoseidonTest : public math::FiniteFieldTest<math::PackedBabyBear> {
@@ -0,0 +1,29 @@
+#include "tachyon/crypto/hashes/sponge/poseidon2/kernels/baby_bear_poseidon2_kernels.cu.h"
+
+namespace tachyon::crypto::kernels {
+
+template __global__ void
+Poseidon2HashLeaves<math::BabyBearGpu, 16, false>(
+    const math::BabyBearGpu* leaves, unsigned int leaf_size, unsigned int rate,
+    unsigned int chunk, Poseidon2ParamsGpu<math::BabyBearGpu> params,
+    math::BabyBearGpu* digests, unsigned int n);
+
+template __global__ void
+Poseidon2HashLeaves<math::BabyBearGpu, 16, true>(
+    const math::BabyBearGpu* leaves, unsigned int leaf_size, unsigned int rate,
+    unsigned int chunk, Poseidon2ParamsGpu<math::BabyBearGpu> params,
+    math::BabyBearGpu* digests, unsigned int n);
+
+template __global__ void
+Poseidon2CompressPairs<math::BabyBearGpu, 16, false>(
+    const math::BabyBearGpu* children, unsigned int chunk,
+    Poseidon2ParamsGpu<math::BabyBearGpu> params, math::BabyBearGpu* parents,
+    unsigned int n);
+
+template __global__ void
+Poseidon2CompressPairs<math::BabyBearGpu, 16, true>(
+    const math::BabyBearGpu* children, unsigned int chunk,
+    Poseidon2ParamsGpu<math::BabyBearGpu> params, math::BabyBearGpu* parents,
+    unsigned int n);
+
+}  // namespace tachyon::crypto::kernels
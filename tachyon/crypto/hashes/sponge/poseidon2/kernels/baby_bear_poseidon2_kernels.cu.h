@@ -0,0 +1,35 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_KERNELS_BABY_BEAR_POSEIDON2_KERNELS_CU_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_KERNELS_BABY_BEAR_POSEIDON2_KERNELS_CU_H_
+
+#include "tachyon/crypto/hashes/sponge/poseidon2/kernels/poseidon2_kernels.cu.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear_gpu.h"
+
+namespace tachyon::crypto::kernels {
+
+extern template __global__ void
+Poseidon2HashLeaves<math::BabyBearGpu, 16, false>(
+    const math::BabyBearGpu* leaves, unsigned int leaf_size, unsigned int rate,
+    unsigned int chunk, Poseidon2ParamsGpu<math::BabyBearGpu> params,
+    math::BabyBearGpu* digests, unsigned int n);
+
+extern template __global__ void
+Poseidon2HashLeaves<math::BabyBearGpu, 16, true>(
+    const math::BabyBearGpu* leaves, unsigned int leaf_size, unsigned int rate,
+    unsigned int chunk, Poseidon2ParamsGpu<math::BabyBearGpu> params,
+    math::BabyBearGpu* digests, unsigned int n);
+
+extern template __global__ void
+Poseidon2CompressPairs<math::BabyBearGpu, 16, false>(
+    const math::BabyBearGpu* children, unsigned int chunk,
+    Poseidon2ParamsGpu<math::BabyBearGpu> params, math::BabyBearGpu* parents,
+    unsigned int n);
+
+extern template __global__ void
+Poseidon2CompressPairs<math::BabyBearGpu, 16, true>(
+    const math::BabyBearGpu* children, unsigned int chunk,
+    Poseidon2ParamsGpu<math::BabyBearGpu> params, math::BabyBearGpu* parents,
+    unsigned int n);
+
+}  // namespace tachyon::crypto::kernels
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_KERNELS_BABY_BEAR_POSEIDON2_KERNELS_CU_H_
@@ -0,0 +1,178 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_KERNELS_POSEIDON2_KERNELS_CU_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_KERNELS_POSEIDON2_KERNELS_CU_H_
+
+#include "tachyon/device/gpu/gpu_runtime.h"
+
+namespace tachyon::crypto::kernels {
+
+// The device counterpart of |Poseidon2Config|. Every pointer points to device
+// memory.
+template <typename F>
+struct Poseidon2ParamsGpu {
+  // The round constants of (|full_rounds| + |partial_rounds|) rounds, stored
+  // row by row with |Width| elements per round.
+  const F* ark;
+  // See |Poseidon2HorizenInternalMatrix|.
+  const F* internal_diagonal_minus_one;
+  // Multiplied to every element after the internal matrix. This is
+  // |PrimeField::FromMontgomery(1)| for the plonky3 internal matrix of a field
+  // in montgomery form and 1 otherwise. See |Poseidon2Plonky3InternalMatrix|.
+  F internal_scale;
+  unsigned int full_rounds;
+  unsigned int partial_rounds;
+  unsigned int alpha;
+};
+
+// Applies the 4x4 block of the external matrix. See
+// |Poseidon2HorizenExternalMatrix::DoApply()| and
+// |Poseidon2Plonky3ExternalMatrix::DoApply()|.
+template <typename F, bool kUsePlonky3ExternalMatrix>
+__device__ void ApplyExternalMatrix4x4(F* v) {
+  if constexpr (kUsePlonky3ExternalMatrix) {
+    F t0 = v[0] + v[1];
+    F t1 = v[2] + v[3];
+    F t2 = t0 + t1;
+    F t3 = t2 + v[1];
+    F t4 = t2 + v[3];
+    v[3] = t4 + v[0].Double();
+    v[1] = t3 + v[2].Double();
+    v[0] = t3 + t0;
+    v[2] = t4 + t1;
+  } else {
+    F t0 = v[0] + v[1];
+    F t1 = v[2] + v[3];
+    F t2 = v[1] + v[1] + t1;
+    F t3 = v[3] + v[3] + t0;
+    v[3] = t1.Double().Double() + t3;
+    v[1] = t0.Double().Double() + t2;
+    v[0] = t3 + v[1];
+    v[2] = t2 + v[3];
+  }
+}
+
+// See |Poseidon2ExternalMatrix::Apply()|. |Width| must be a multiple of 4.
+template <typename F, unsigned int Width, bool kUsePlonky3ExternalMatrix>
+__device__ void ApplyExternalMatrix(F* v) {
+  static_assert(Width % 4 == 0 && Width <= 24);
+  for (unsigned int i = 0; i < Width; i += 4) {
+    ApplyExternalMatrix4x4<F, kUsePlonky3ExternalMatrix>(&v[i]);
+  }
+  if constexpr (Width > 4) {
+    F sums[4];
+    for (unsigned int i = 0; i < 4; ++i) {
+      sums[i] = v[i];
+      for (unsigned int j = 4; j < Width; j += 4) {
+        sums[i] += v[i + j];
+      }
+    }
+    for (unsigned int i = 0; i < Width; ++i) {
+      v[i] += sums[i % 4];
+    }
+  }
+}
+
+// See |Poseidon2HorizenInternalMatrix::Apply()|.
+template <typename F, unsigned int Width>
+__device__ void ApplyInternalMatrix(F* v, const Poseidon2ParamsGpu<F>& params) {
+  F sum = v[0];
+  for (unsigned int i = 1; i < Width; ++i) {
+    sum += v[i];
+  }
+  for (unsigned int i = 0; i < Width; ++i) {
+    v[i] = (v[i] * params.internal_diagonal_minus_one[i] + sum) *
+           params.internal_scale;
+  }
+}
+
+template <typename F>
+__device__ F SBox(const F& x, unsigned int alpha) {
+  F ret = F::One();
+  F base = x;
+  while (alpha > 0) {
+    if (alpha & 1) ret *= base;
+    alpha >>= 1;
+    if (alpha > 0) base = base.Square();
+  }
+  return ret;
+}
+
+// The device counterpart of |PoseidonSpongeBase::Permute()| for
+// |Poseidon2Sponge|.
+template <typename F, unsigned int Width, bool kUsePlonky3ExternalMatrix>
+__device__ void Poseidon2Permute(F* state,
+                                 const Poseidon2ParamsGpu<F>& params) {
+  ApplyExternalMatrix<F, Width, kUsePlonky3ExternalMatrix>(state);
+
+  unsigned int full_rounds_over_2 = params.full_rounds / 2;
+  unsigned int num_rounds = params.full_rounds + params.partial_rounds;
+  for (unsigned int r = 0; r < num_rounds; ++r) {
+    const F* ark = params.ark + static_cast<size_t>(r) * Width;
+    if (r < full_rounds_over_2 ||
+        r >= full_rounds_over_2 + params.partial_rounds) {
+      for (unsigned int i = 0; i < Width; ++i) {
+        state[i] = SBox(state[i] + ark[i], params.alpha);
+      }
+      ApplyExternalMatrix<F, Width, kUsePlonky3ExternalMatrix>(state);
+    } else {
+      state[0] = SBox(state[0] + ark[0], params.alpha);
+      ApplyInternalMatrix<F, Width>(state, params);
+    }
+  }
+}
+
+// Hashes |n| leaves of |leaf_size| elements each, laid out back to back in
+// |leaves|, and writes a digest of |chunk| elements per leaf to |digests|.
+// Every leaf is absorbed |rate| elements at a time into a zeroed state,
+// overwriting the rate part as |PaddingFreeSponge| does, and the digest is the
+// first |chunk| elements of the final state.
+template <typename F, unsigned int Width, bool kUsePlonky3ExternalMatrix>
+__global__ void Poseidon2HashLeaves(const F* leaves, unsigned int leaf_size,
+                                    unsigned int rate, unsigned int chunk,
+                                    Poseidon2ParamsGpu<F> params, F* digests,
+                                    unsigned int n) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= n) return;
+  const F* leaf = leaves + static_cast<size_t>(gid) * leaf_size;
+  F state[Width];
+  for (unsigned int i = 0; i < Width; ++i) {
+    state[i] = F::Zero();
+  }
+  for (unsigned int i = 0; i < leaf_size; i += rate) {
+    for (unsigned int j = 0; j < rate && i + j < leaf_size; ++j) {
+      state[j] = leaf[i + j];
+    }
+    Poseidon2Permute<F, Width, kUsePlonky3ExternalMatrix>(state, params);
+  }
+  F* digest = digests + static_cast<size_t>(gid) * chunk;
+  for (unsigned int i = 0; i < chunk; ++i) {
+    digest[i] = state[i];
+  }
+}
+
+// Compresses |n| pairs of sibling digests of |chunk| elements into their
+// parents, as |TruncatedPermutation| with 2 inputs does: the 2 children are
+// placed next to each other in a zeroed state, which is permuted and truncated
+// to |chunk| elements. |children| holds the 2 * |n| children back to back and
+// the i-th parent is written to the i-th slot of |parents|. 2 * |chunk| must
+// not be greater than |Width|.
+template <typename F, unsigned int Width, bool kUsePlonky3ExternalMatrix>
+__global__ void Poseidon2CompressPairs(const F* children, unsigned int chunk,
+                                       Poseidon2ParamsGpu<F> params,
+                                       F* parents, unsigned int n) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= n) return;
+  const F* pair = children + static_cast<size_t>(gid) * 2 * chunk;
+  F state[Width];
+  for (unsigned int i = 0; i < Width; ++i) {
+    state[i] = i < 2 * chunk ? pair[i] : F::Zero();
+  }
+  Poseidon2Permute<F, Width, kUsePlonky3ExternalMatrix>(state, params);
+  F* parent = parents + static_cast<size_t>(gid) * chunk;
+  for (unsigned int i = 0; i < chunk; ++i) {
+    parent[i] = state[i];
+  }
+}
+
+}  // namespace tachyon::crypto::kernels
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_KERNELS_POSEIDON2_KERNELS_CU_H_
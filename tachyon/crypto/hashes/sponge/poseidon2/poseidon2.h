@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/hashes/sponge/poseidon/poseidon_sponge_base.h"
@@ -81,6 +83,28 @@ struct Poseidon2Sponge final
     }
   }
 
+  // Permutes up to |F::N| independent states of the prime field of |F| at
+  // once, where |F| is a packed prime field. The states are transposed into
+  // |state| so that the i-th lane of |state| holds the i-th of |states|, and
+  // transposed back after the permutation.
+  template <typename PrimeField>
+  void PermuteBatch(absl::Span<SpongeState<PrimeField>> states) {
+    static_assert(math::FiniteFieldTraits<F>::kIsPackedPrimeField);
+    CHECK_LE(states.size(), F::N);
+    Eigen::Index size = state.elements.size();
+    for (Eigen::Index i = 0; i < size; ++i) {
+      for (size_t lane = 0; lane < states.size(); ++lane) {
+        state.elements[i][lane] = states[lane].elements[i];
+      }
+    }
+    this->Permute();
+    for (Eigen::Index i = 0; i < size; ++i) {
+      for (size_t lane = 0; lane < states.size(); ++lane) {
+        states[lane].elements[i] = state.elements[i][lane];
+      }
+    }
+  }
+
   bool operator==(const Poseidon2Sponge& other) const {
     return config == other.config && state == other.state;
   }
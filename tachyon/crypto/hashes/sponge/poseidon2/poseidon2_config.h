@@ -71,15 +71,7 @@ struct Poseidon2Config : public PoseidonConfigBase<F> {
       const std::array<PrimeField, N>& internal_diagonal_minus_one) {
     Poseidon2ConfigEntry config_entry(rate, alpha, full_rounds, partial_rounds);
     Poseidon2Config ret = config_entry.ToPoseidon2Config<F>();
-    ret.internal_diagonal_minus_one = math::Vector<F>(N);
-    for (size_t i = 0; i < N; ++i) {
-      if constexpr (math::FiniteFieldTraits<F>::kIsPackedPrimeField) {
-        ret.internal_diagonal_minus_one[i] =
-            F::Broadcast(internal_diagonal_minus_one[i]);
-      } else {
-        ret.internal_diagonal_minus_one[i] = internal_diagonal_minus_one[i];
-      }
-    }
+    ret.SetInternalMatrix(internal_diagonal_minus_one);
     FindPoseidon2Ark<F>(config_entry.ToPoseidonGrainLFSRConfig<F>(), ret.ark);
     return ret;
   }
@@ -90,21 +82,57 @@ struct Poseidon2Config : public PoseidonConfigBase<F> {
       const std::array<uint8_t, N>& internal_shifts) {
     Poseidon2ConfigEntry config_entry(rate, alpha, full_rounds, partial_rounds);
     Poseidon2Config ret = config_entry.ToPoseidon2Config<F>();
-    ret.use_plonky3_internal_matrix = true;
+    ret.SetInternalMatrix(internal_shifts);
+    FindPoseidon2Ark<F>(config_entry.ToPoseidonGrainLFSRConfig<F>(), ret.ark);
+    return ret;
+  }
+
+  // Same as above, but with |ark| of the canonical values in row-major order,
+  // which is generated at build time by |generate_poseidon2_config()|, instead
+  // of the grain LFSR.
+  template <typename T, size_t N>
+  static Poseidon2Config CreateCustom(
+      size_t rate, uint64_t alpha, size_t full_rounds, size_t partial_rounds,
+      const std::array<T, N>& internal_matrix,
+      absl::Span<const typename PrimeField::BigIntTy> ark) {
+    Poseidon2ConfigEntry config_entry(rate, alpha, full_rounds, partial_rounds);
+    Poseidon2Config ret = config_entry.ToPoseidon2Config<F>();
+    ret.SetInternalMatrix(internal_matrix);
+    ret.ark = internal::CreateMatrixFromBigInts<F>(
+        ark, full_rounds + partial_rounds, ret.rate + ret.capacity);
+    return ret;
+  }
+
+ private:
+  template <size_t N>
+  void SetInternalMatrix(
+      const std::array<PrimeField, N>& internal_diagonal_minus_one) {
+    this->internal_diagonal_minus_one = math::Vector<F>(N);
+    for (size_t i = 0; i < N; ++i) {
+      if constexpr (math::FiniteFieldTraits<F>::kIsPackedPrimeField) {
+        this->internal_diagonal_minus_one[i] =
+            F::Broadcast(internal_diagonal_minus_one[i]);
+      } else {
+        this->internal_diagonal_minus_one[i] = internal_diagonal_minus_one[i];
+      }
+    }
+  }
+
+  template <size_t N>
+  void SetInternalMatrix(const std::array<uint8_t, N>& internal_shifts) {
+    use_plonky3_internal_matrix = true;
     if constexpr (math::FiniteFieldTraits<F>::kIsPackedPrimeField) {
-      ret.internal_diagonal_minus_one = math::Vector<F>(N + 1);
-      ret.internal_diagonal_minus_one[0] = F(PrimeField::Config::kModulus - 2);
+      internal_diagonal_minus_one = math::Vector<F>(N + 1);
+      internal_diagonal_minus_one[0] = F(PrimeField::Config::kModulus - 2);
       for (size_t i = 1; i < N + 1; ++i) {
-        ret.internal_diagonal_minus_one[i] = F(1 << internal_shifts[i - 1]);
+        internal_diagonal_minus_one[i] = F(1 << internal_shifts[i - 1]);
       }
     } else {
-      ret.internal_shifts = math::Vector<uint8_t>(N);
+      this->internal_shifts = math::Vector<uint8_t>(N);
       for (size_t i = 0; i < N; ++i) {
-        ret.internal_shifts[i] = internal_shifts[i];
+        this->internal_shifts[i] = internal_shifts[i];
       }
     }
-    FindPoseidon2Ark<F>(config_entry.ToPoseidonGrainLFSRConfig<F>(), ret.ark);
-    return ret;
   }
 };
 
@@ -10,6 +10,8 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/baby_bear_t16_poseidon2_config.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/goldilocks_t8_poseidon2_config.h"
 #include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_horizen_external_matrix.h"
 #include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
 #include "tachyon/math/finite_fields/baby_bear/poseidon2.h"
@@ -46,6 +48,24 @@ TEST_F(Poseidon2GoldilocksTest, Permute) {
   EXPECT_EQ(sponge.state.elements, expected);
 }
 
+TEST_F(Poseidon2GoldilocksTest, PermuteWithGeneratedConfig) {
+  using F = math::Goldilocks;
+
+  Poseidon2Sponge<Poseidon2ExternalMatrix<Poseidon2HorizenExternalMatrix<F>>>
+      sponge(GetGoldilocksT8Poseidon2Config());
+  Poseidon2Config<F> config = Poseidon2Config<F>::CreateCustom(
+      7, 7, 8, 22, math::GetPoseidon2GoldilocksInternalDiagonalVector<8>());
+  Poseidon2Sponge<Poseidon2ExternalMatrix<Poseidon2HorizenExternalMatrix<F>>>
+      expected(config);
+  for (size_t i = 0; i < 8; ++i) {
+    sponge.state.elements[i] = F(i);
+    expected.state.elements[i] = F(i);
+  }
+  sponge.Permute();
+  expected.Permute();
+  EXPECT_EQ(sponge.state.elements, expected.state.elements);
+}
+
 TEST_F(Poseidon2GoldilocksTest, Copyable) {
   using F = math::Goldilocks;
 
@@ -95,6 +115,34 @@ TEST_F(Poseidon2BabyBearTest, Permute) {
   EXPECT_EQ(sponge.state.elements, expected);
 }
 
+TEST_F(Poseidon2BabyBearTest, PermuteWithGeneratedConfig) {
+  using PackedF = math::PackedBabyBear;
+  using F = math::BabyBear;
+
+  Poseidon2Config<F> config = Poseidon2Config<F>::CreateCustom(
+      15, 7, 8, 13, math::GetPoseidon2BabyBearInternalShiftVector<15>());
+  Poseidon2Sponge<Poseidon2ExternalMatrix<Poseidon2HorizenExternalMatrix<F>>>
+      expected(config);
+  Poseidon2Sponge<Poseidon2ExternalMatrix<Poseidon2HorizenExternalMatrix<F>>>
+      sponge(GetBabyBearT16Poseidon2Config());
+  Poseidon2Sponge<
+      Poseidon2ExternalMatrix<Poseidon2HorizenExternalMatrix<PackedF>>>
+      packed_sponge(GetBabyBearT16Poseidon2Config<PackedF>());
+  for (size_t i = 0; i < 16; ++i) {
+    expected.state.elements[i] = F(i);
+    sponge.state.elements[i] = F(i);
+    packed_sponge.state.elements[i] = PackedF(i);
+  }
+  expected.Permute();
+  sponge.Permute();
+  packed_sponge.Permute();
+  EXPECT_EQ(sponge.state.elements, expected.state.elements);
+  for (size_t i = 0; i < 16; ++i) {
+    EXPECT_EQ(packed_sponge.state.elements[i],
+              PackedF::Broadcast(expected.state.elements[i]));
+  }
+}
+
 TEST_F(Poseidon2BabyBearTest, PermutePacked) {
   using PackedF = math::PackedBabyBear;
   using F = math::BabyBear;
@@ -125,4 +173,34 @@ TEST_F(Poseidon2BabyBearTest, PermutePacked) {
   }
 }
 
+TEST_F(Poseidon2BabyBearTest, PermuteBatch) {
+  using PackedF = math::PackedBabyBear;
+  using F = math::BabyBear;
+
+  Poseidon2Config<PackedF> packed_config =
+      Poseidon2Config<PackedF>::CreateCustom(
+          15, 7, 8, 13, math::GetPoseidon2BabyBearInternalShiftVector<15>());
+  Poseidon2Sponge<
+      Poseidon2ExternalMatrix<Poseidon2HorizenExternalMatrix<PackedF>>>
+      packed_sponge(packed_config);
+
+  Poseidon2Config<F> config = Poseidon2Config<F>::CreateCustom(
+      15, 7, 8, 13, math::GetPoseidon2BabyBearInternalShiftVector<15>());
+  std::vector<SpongeState<F>> states;
+  std::vector<SpongeState<F>> expected_states;
+  for (size_t lane = 0; lane < PackedF::N; ++lane) {
+    Poseidon2Sponge<Poseidon2ExternalMatrix<Poseidon2HorizenExternalMatrix<F>>>
+        sponge(config);
+    for (size_t i = 0; i < 16; ++i) {
+      sponge.state.elements[i] = F::Random();
+    }
+    states.push_back(sponge.state);
+    sponge.Permute();
+    expected_states.push_back(sponge.state);
+  }
+
+  packed_sponge.PermuteBatch(absl::MakeSpan(states));
+  EXPECT_EQ(states, expected_states);
+}
+
 }  // namespace tachyon::crypto
@@ -10,6 +10,8 @@
 #include <numeric>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/hashes/sponge/duplex_sponge_mode.h"
 #include "tachyon/math/finite_fields/finite_field_traits.h"
@@ -126,6 +128,21 @@ class FieldBasedCryptographicSponge : public CryptographicSponge<Derived> {
  public:
   using NativeField = typename CryptographicSpongeTraits<Derived>::F;
 
+  // Absorbs every |stride|-th element of |elements| starting from the first
+  // one. This absorbs a row of a column-major matrix or a column of a
+  // row-major matrix without copying it. Returns false if |stride| is 0.
+  [[nodiscard]] bool AbsorbStrided(absl::Span<const NativeField> elements,
+                                   size_t stride) {
+    Derived* derived = static_cast<Derived*>(this);
+    return derived->DoAbsorbStrided(elements, stride);
+  }
+
+  // Squeezes |output.size()| field elements from the sponge into |output|.
+  void SqueezeInto(absl::Span<NativeField> output) {
+    Derived* derived = static_cast<Derived*>(this);
+    derived->DoSqueezeInto(output);
+  }
+
   // Squeeze |sizes.size()| field elements from the sponge.
   // where the |i|-th element of the output has |sizes[i]|.
   std::vector<NativeField> SqueezeNativeFieldElementsWithSizes(
@@ -9,8 +9,12 @@
 #include <stddef.h>
 
 #include <array>
+#include <type_traits>
 #include <utility>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
 #include "tachyon/crypto/hashes/compressor.h"
 #include "tachyon/crypto/hashes/sponge/sponge.h"
 
@@ -29,13 +33,29 @@ class TruncatedPermutation final
  private:
   friend class Compressor<TruncatedPermutation<Derived, Chunk, N>>;
 
+  // |input| is either |N| chunks of |Chunk| elements, e.g.,
+  // |absl::Span<const std::array<F, Chunk>>| over adjacent digests, or
+  // |N| * |Chunk| elements laid out back to back.
   template <typename T>
   std::array<F, Chunk> DoCompress(const T& input) const {
     auto& state = derived_.state;
-    size_t idx = 0;
-    for (size_t i = 0; i < N; ++i) {
-      for (size_t j = 0; j < Chunk; ++j) {
-        state[idx++] = input[i][j];
+    // The elements past the inputs are zeroed, so that the result doesn't
+    // depend on the previous compressions.
+    for (Eigen::Index i = N * Chunk; i < state.elements.size(); ++i) {
+      state[i] = F::Zero();
+    }
+    if constexpr (std::is_convertible_v<const T&, absl::Span<const F>>) {
+      absl::Span<const F> elements = input;
+      DCHECK_EQ(elements.size(), N * Chunk);
+      for (size_t i = 0; i < N * Chunk; ++i) {
+        state[i] = elements[i];
+      }
+    } else {
+      size_t idx = 0;
+      for (size_t i = 0; i < N; ++i) {
+        for (size_t j = 0; j < Chunk; ++j) {
+          state[idx++] = input[i][j];
+        }
       }
     }
     derived_.Permute();
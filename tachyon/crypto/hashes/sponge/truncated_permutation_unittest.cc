@@ -2,6 +2,7 @@
 
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
@@ -39,6 +40,17 @@ TEST_F(TruncatedPermutationTest, Hash) {
                                     F(828329642),  F(1491697358), F(1128780676),
                                     F(287184043),  F(1806152977)};
   EXPECT_EQ(hash, expected);
+
+  std::vector<std::array<F, kChunk>> chunks(kN);
+  std::vector<F> elements(kN * kChunk);
+  for (size_t i = 0; i < kN; ++i) {
+    for (size_t j = 0; j < kChunk; ++j) {
+      chunks[i][j] = inputs[i][j];
+      elements[i * kChunk + j] = inputs[i][j];
+    }
+  }
+  EXPECT_EQ(compressor.Compress(absl::MakeConstSpan(chunks)), expected);
+  EXPECT_EQ(compressor.Compress(elements), expected);
 }
 
 }  // namespace tachyon::crypto
@@ -5,12 +5,14 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/random.h"
 #include "tachyon/base/template_util.h"
 #include "tachyon/crypto/random/rng.h"
 
-namespace tachyon::crypto {
+namespace tachyon {
+namespace crypto {
 
 // XORShiftRNG stands for "XOR Shift Random Number Generator".
 // Please use |base::Uniform()| mostly for production. This is being used in
@@ -77,6 +79,14 @@ class XORShiftRNG final : public RNG<XORShiftRNG> {
     return w_;
   }
 
+  bool operator==(const XORShiftRNG& other) const {
+    return x_ == other.x_ && y_ == other.y_ && z_ == other.z_ &&
+           w_ == other.w_;
+  }
+  bool operator!=(const XORShiftRNG& other) const {
+    return !operator==(other);
+  }
+
  private:
   XORShiftRNG(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
       : x_(x), y_(y), z_(z), w_(w) {}
@@ -87,6 +97,30 @@ class XORShiftRNG final : public RNG<XORShiftRNG> {
   uint32_t w_ = 195911405;  // 0xBAD_5EED
 };
 
-}  // namespace tachyon::crypto
+}  // namespace crypto
+
+namespace base {
+
+template <>
+class Copyable<crypto::XORShiftRNG> {
+ public:
+  static bool WriteTo(const crypto::XORShiftRNG& rng, Buffer* buffer) {
+    return buffer->WriteMany(rng.x(), rng.y(), rng.z(), rng.w());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, crypto::XORShiftRNG* rng) {
+    uint32_t x, y, z, w;
+    if (!buffer.ReadMany(&x, &y, &z, &w)) return false;
+    *rng = crypto::XORShiftRNG::FromState(x, y, z, w);
+    return true;
+  }
+
+  static size_t EstimateSize(const crypto::XORShiftRNG& rng) {
+    return crypto::XORShiftRNG::kStateSize;
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
 
 #endif  // TACHYON_CRYPTO_RANDOM_XOR_SHIFT_XOR_SHIFT_RNG_H_
@@ -2,6 +2,8 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/base/buffer/vector_buffer.h"
+
 namespace tachyon::crypto {
 
 TEST(XORShiftRngTest, NextUint64) {
@@ -68,4 +70,22 @@ TEST(XORShiftRngTest, NextUint64) {
   }
 }
 
+TEST(XORShiftRngTest, Copyable) {
+  XORShiftRNG expected = XORShiftRNG::FromRandomSeed();
+  expected.NextUint32();
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  XORShiftRNG value;
+  ASSERT_TRUE(write_buf.Read(&value));
+
+  EXPECT_EQ(value, expected);
+  EXPECT_EQ(value.NextUint64(), expected.NextUint64());
+}
+
 }  // namespace tachyon::crypto
@@ -0,0 +1,147 @@
+#ifndef TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_BATCHED_SUMCHECK_H_
+#define TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_BATCHED_SUMCHECK_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/sumcheck/multilinear/sumcheck_prover.h"
+#include "tachyon/crypto/sumcheck/multilinear/sumcheck_proving_key.h"
+#include "tachyon/crypto/sumcheck/multilinear/sumcheck_verifier.h"
+#include "tachyon/crypto/sumcheck/multilinear/sumcheck_verifying_key.h"
+#include "tachyon/math/polynomials/multivariate/linear_combination.h"
+
+namespace tachyon::crypto {
+
+// |BatchedSumcheck| proves k sums of the polynomials g₁, ..., gₖ over the same
+// number of variables with a single run of the protocol. The verifier samples
+// the coefficients α₁, ..., αₖ, and the protocol runs on
+//
+//   g(x) = α₁g₁(x) + ... + αₖgₖ(x)
+//
+// whose sum is α₁H₁ + ... + αₖHₖ. The instances share the challenges, so the
+// final claim g(r) is checked by evaluating each gᵢ at the same point r.
+template <typename MLE>
+class BatchedSumcheck {
+ public:
+  using F = typename MLE::Field;
+  using Point = typename MLE::Point;
+  using Term = math::LinearCombinationTerm<F>;
+
+  // Samples the coefficients α₁, ..., αₖ on the verifier side.
+  static std::vector<F> SampleCoefficients(size_t num_instances) {
+    return base::CreateVector(num_instances, []() { return F::Random(); });
+  }
+
+  // Returns the proving key of g. The terms of gᵢ are scaled by αᵢ, and their
+  // indexes are shifted past the MLEs of the previous instances.
+  static SumcheckProvingKey<MLE> CombineProvingKeys(
+      absl::Span<const SumcheckProvingKey<MLE>> keys,
+      absl::Span<const F> coefficients) {
+    CHECK_EQ(keys.size(), coefficients.size());
+    CHECK(!keys.empty());
+    SumcheckProvingKey<MLE> ret;
+    ret.verifying_key = CombineVerifyingKeys(
+        base::Map(keys, [](const SumcheckProvingKey<MLE>& key) {
+          return key.verifying_key;
+        }));
+    for (size_t i = 0; i < keys.size(); ++i) {
+      size_t offset = ret.flattened_ml_evaluations.size();
+      for (const Term& term : keys[i].terms) {
+        ret.terms.push_back(
+            {coefficients[i] * term.coefficient,
+             base::Map(term.indexes,
+                       [offset](size_t index) { return offset + index; })});
+      }
+      ret.flattened_ml_evaluations.insert(
+          ret.flattened_ml_evaluations.end(),
+          keys[i].flattened_ml_evaluations.begin(),
+          keys[i].flattened_ml_evaluations.end());
+    }
+    return ret;
+  }
+
+  // Returns the verifying key of g. Every instance must have the same number
+  // of variables.
+  static SumcheckVerifyingKey CombineVerifyingKeys(
+      absl::Span<const SumcheckVerifyingKey> keys) {
+    CHECK(!keys.empty());
+    SumcheckVerifyingKey ret = keys[0];
+    for (const SumcheckVerifyingKey& key : keys.subspan(1)) {
+      CHECK_EQ(key.num_variables, ret.num_variables);
+      ret.max_evaluations = std::max(ret.max_evaluations, key.max_evaluations);
+    }
+    return ret;
+  }
+
+  // Returns α₁H₁ + ... + αₖHₖ, the sum of g, from the sums |claims| of gᵢ.
+  static F CombineClaims(absl::Span<const F> claims,
+                         absl::Span<const F> coefficients) {
+    CHECK_EQ(claims.size(), coefficients.size());
+    return F::SumOfProductsSerial(claims, coefficients);
+  }
+
+  // Returns g(|point|) = α₁g₁(|point|) + ... + αₖgₖ(|point|), which the
+  // verifier compares with |Subclaim::expected_evaluation|. The instances are
+  // evaluated in parallel.
+  static F Evaluate(
+      absl::Span<const math::LinearCombination<MLE>* const> instances,
+      absl::Span<const F> coefficients, const Point& point) {
+    CHECK_EQ(instances.size(), coefficients.size());
+    std::vector<F> evaluations(instances.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < instances.size(); ++i) {
+      evaluations[i] = instances[i]->Evaluate(point);
+    }
+    return F::SumOfProductsSerial(evaluations, coefficients);
+  }
+
+  // Same as |MultilinearSumcheck::RunInteractiveProtocol()|, but for the
+  // batch of |instances|.
+  template <size_t MaxDegree>
+  [[nodiscard]] static bool RunInteractiveProtocol(
+      absl::Span<const math::LinearCombination<MLE>* const> instances) {
+    CHECK(!instances.empty());
+    size_t num_variables = instances[0]->num_variables();
+
+    const std::vector<F> coefficients = SampleCoefficients(instances.size());
+    std::vector<SumcheckProvingKey<MLE>> proving_keys =
+        base::Map(instances, [](const math::LinearCombination<MLE>* instance) {
+          return SumcheckProvingKey<MLE>::Build(*instance);
+        });
+    SumcheckProvingKey<MLE> proving_key =
+        CombineProvingKeys(proving_keys, coefficients);
+    SumcheckVerifyingKey verifying_key = proving_key.verifying_key;
+
+    SumcheckProver<MLE, MaxDegree> prover(std::move(proving_key));
+    SumcheckVerifier<MLE> verifier(std::move(verifying_key));
+    SumcheckProverMsg<F, MaxDegree> prover_msg = prover.Round();
+    SumcheckVerifierMsg<F> verifier_msg = verifier.Round(std::move(prover_msg));
+    for (size_t i = 1; i < num_variables; ++i) {
+      prover_msg = prover.Round(std::move(verifier_msg));
+      verifier_msg = verifier.Round(std::move(prover_msg));
+    }
+
+    std::vector<F> claims(instances.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < instances.size(); ++i) {
+      claims[i] = instances[i]->Combine();
+    }
+    Subclaim<F> subclaim;
+    if (!verifier.CheckAndGenerateSubclaim(
+            CombineClaims(claims, coefficients), &subclaim)) {
+      return false;
+    }
+    return Evaluate(instances, coefficients, subclaim.point) ==
+           subclaim.expected_evaluation;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_BATCHED_SUMCHECK_H_
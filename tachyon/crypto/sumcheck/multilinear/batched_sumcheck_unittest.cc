@@ -0,0 +1,80 @@
+#include "tachyon/crypto/sumcheck/multilinear/batched_sumcheck.h"
+
+#include <memory>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/range.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+#include "tachyon/math/polynomials/multivariate/multilinear_dense_evaluations.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::GF7;
+
+constexpr size_t kNumVariables = 6;
+
+using MLE = math::MultilinearDenseEvaluations<F, kNumVariables>;
+
+class BatchedSumcheckTest : public math::FiniteFieldTest<F> {
+ public:
+  void SetUp() override {
+    // NOTE: |LinearCombination| is not movable, so each instance is created
+    // in place.
+    instances_ = base::CreateVector(3, []() {
+      return absl::WrapUnique(
+          new math::LinearCombination<MLE>(math::LinearCombination<MLE>::Random(
+              kNumVariables, base::Range<size_t>(2, 4), 3)));
+    });
+    instance_ptrs_ = base::Map(
+        instances_,
+        [](const std::unique_ptr<math::LinearCombination<MLE>>& instance)
+            -> const math::LinearCombination<MLE>* { return instance.get(); });
+  }
+
+ protected:
+  std::vector<std::unique_ptr<math::LinearCombination<MLE>>> instances_;
+  std::vector<const math::LinearCombination<MLE>*> instance_ptrs_;
+};
+
+}  // namespace
+
+TEST_F(BatchedSumcheckTest, CombineProvingKeys) {
+  std::vector<SumcheckProvingKey<MLE>> keys = base::Map(
+      instance_ptrs_, [](const math::LinearCombination<MLE>* instance) {
+        return SumcheckProvingKey<MLE>::Build(*instance);
+      });
+  std::vector<F> coefficients =
+      BatchedSumcheck<MLE>::SampleCoefficients(keys.size());
+  SumcheckProvingKey<MLE> key =
+      BatchedSumcheck<MLE>::CombineProvingKeys(keys, coefficients);
+
+  size_t term_idx = 0;
+  size_t offset = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    for (const math::LinearCombinationTerm<F>& term : keys[i].terms) {
+      const math::LinearCombinationTerm<F>& combined = key.terms[term_idx++];
+      EXPECT_EQ(combined.coefficient, coefficients[i] * term.coefficient);
+      for (size_t j = 0; j < term.indexes.size(); ++j) {
+        EXPECT_EQ(key.flattened_ml_evaluations[combined.indexes[j]],
+                  keys[i].flattened_ml_evaluations[term.indexes[j]]);
+      }
+    }
+    offset += keys[i].flattened_ml_evaluations.size();
+  }
+  EXPECT_EQ(term_idx, key.terms.size());
+  EXPECT_EQ(offset, key.flattened_ml_evaluations.size());
+  EXPECT_EQ(key.verifying_key.num_variables, kNumVariables);
+}
+
+TEST_F(BatchedSumcheckTest, RunInteractiveProtocol) {
+  EXPECT_TRUE(BatchedSumcheck<MLE>::RunInteractiveProtocol<3>(instance_ptrs_));
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,20 @@
+#include "tachyon/crypto/sumcheck/multilinear/kernels/bn254_sumcheck_kernels.cu.h"
+
+namespace tachyon::crypto::kernels {
+
+template __global__ void EvaluateRound<math::bn254::FrGpu>(
+    const math::bn254::FrGpu* tables, size_t stride,
+    const math::bn254::FrGpu* coefficients, const unsigned int* term_offsets,
+    const unsigned int* indexes, unsigned int num_terms,
+    unsigned int num_evaluations, unsigned int n,
+    math::bn254::FrGpu* block_sums);
+
+template __global__ void SumBlocks<math::bn254::FrGpu>(
+    const math::bn254::FrGpu* block_sums, unsigned int num_blocks,
+    unsigned int num_evaluations, math::bn254::FrGpu* sums);
+
+template __global__ void FixFirstVariable<math::bn254::FrGpu>(
+    const math::bn254::FrGpu* tables, size_t stride, math::bn254::FrGpu r,
+    unsigned int half, math::bn254::FrGpu* out);
+
+}  // namespace tachyon::crypto::kernels
@@ -0,0 +1,26 @@
+#ifndef TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_KERNELS_BN254_SUMCHECK_KERNELS_CU_H_
+#define TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_KERNELS_BN254_SUMCHECK_KERNELS_CU_H_
+
+#include "tachyon/crypto/sumcheck/multilinear/kernels/sumcheck_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr_gpu.h"
+
+namespace tachyon::crypto::kernels {
+
+extern template __global__ void EvaluateRound<math::bn254::FrGpu>(
+    const math::bn254::FrGpu* tables, size_t stride,
+    const math::bn254::FrGpu* coefficients, const unsigned int* term_offsets,
+    const unsigned int* indexes, unsigned int num_terms,
+    unsigned int num_evaluations, unsigned int n,
+    math::bn254::FrGpu* block_sums);
+
+extern template __global__ void SumBlocks<math::bn254::FrGpu>(
+    const math::bn254::FrGpu* block_sums, unsigned int num_blocks,
+    unsigned int num_evaluations, math::bn254::FrGpu* sums);
+
+extern template __global__ void FixFirstVariable<math::bn254::FrGpu>(
+    const math::bn254::FrGpu* tables, size_t stride, math::bn254::FrGpu r,
+    unsigned int half, math::bn254::FrGpu* out);
+
+}  // namespace tachyon::crypto::kernels
+
+#endif  // TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_KERNELS_BN254_SUMCHECK_KERNELS_CU_H_
@@ -0,0 +1,108 @@
+#ifndef TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_KERNELS_SUMCHECK_KERNELS_CU_H_
+#define TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_KERNELS_SUMCHECK_KERNELS_CU_H_
+
+#include <stddef.h>
+
+#include "tachyon/device/gpu/gpu_runtime.h"
+
+namespace tachyon::crypto::kernels {
+
+// The maximum number of MLEs in a term, which bounds the evaluations that a
+// thread of |EvaluateRound()| keeps.
+constexpr unsigned int kMaxSumcheckEvaluations = 8;
+
+// Evaluates the terms at 0, 1, ..., |num_evaluations| - 1 on the hypercube
+// points in [0, |n|) and writes the sums of each block to |block_sums|, whose
+// |blockIdx.x|-th row has |num_evaluations| elements. The i-th MLE has 2 * |n|
+// evaluations starting from |tables| + i * |stride|, and the MLEs of the t-th
+// term are |indexes[term_offsets[t]]|, ..., |indexes[term_offsets[t + 1]]|
+// - 1. |blockDim.x| must be a power of 2 and the dynamic shared memory must
+// hold |blockDim.x| elements.
+template <typename F>
+__global__ void EvaluateRound(const F* tables, size_t stride,
+                              const F* coefficients,
+                              const unsigned int* term_offsets,
+                              const unsigned int* indexes,
+                              unsigned int num_terms,
+                              unsigned int num_evaluations, unsigned int n,
+                              F* block_sums) {
+  F sums[kMaxSumcheckEvaluations + 1];
+  F products[kMaxSumcheckEvaluations + 1];
+  for (unsigned int k = 0; k < num_evaluations; ++k) {
+    sums[k] = F::Zero();
+  }
+  for (unsigned int j = blockIdx.x * blockDim.x + threadIdx.x; j < n;
+       j += gridDim.x * blockDim.x) {
+    for (unsigned int t = 0; t < num_terms; ++t) {
+      for (unsigned int k = 0; k < num_evaluations; ++k) {
+        products[k] = coefficients[t];
+      }
+      for (unsigned int i = term_offsets[t]; i < term_offsets[t + 1]; ++i) {
+        const F* table = tables + indexes[i] * stride;
+        F start = table[2 * j];
+        F step = table[2 * j + 1] - start;
+        // start, (start + step), (start + 2 * step), ...
+        for (unsigned int k = 0; k < num_evaluations; ++k) {
+          products[k] *= start;
+          start += step;
+        }
+      }
+      for (unsigned int k = 0; k < num_evaluations; ++k) {
+        sums[k] += products[k];
+      }
+    }
+  }
+
+  // NOTE: The evaluations are reduced one by one, so that the shared memory
+  // doesn't grow with |num_evaluations|.
+  extern __shared__ char shared[];
+  F* partial_sums = reinterpret_cast<F*>(shared);
+  for (unsigned int k = 0; k < num_evaluations; ++k) {
+    partial_sums[threadIdx.x] = sums[k];
+    __syncthreads();
+    for (unsigned int s = blockDim.x / 2; s > 0; s >>= 1) {
+      if (threadIdx.x < s) {
+        partial_sums[threadIdx.x] += partial_sums[threadIdx.x + s];
+      }
+      __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+      block_sums[blockIdx.x * num_evaluations + k] = partial_sums[0];
+    }
+    __syncthreads();
+  }
+}
+
+// Adds up the |num_blocks| rows of |block_sums| written by |EvaluateRound()|
+// to |sums|. The k-th thread sums up the k-th column.
+template <typename F>
+__global__ void SumBlocks(const F* block_sums, unsigned int num_blocks,
+                          unsigned int num_evaluations, F* sums) {
+  unsigned int k = threadIdx.x;
+  if (k >= num_evaluations) return;
+  F sum = F::Zero();
+  for (unsigned int b = 0; b < num_blocks; ++b) {
+    sum += block_sums[b * num_evaluations + k];
+  }
+  sums[k] = sum;
+}
+
+// Fixes the first variable of the |blockIdx.y|-th MLE with |r|, where the
+// MLEs have 2 * |half| evaluations starting from |tables| + i * |stride|. The
+// result is written to |out| + i * |half|.
+// NOTE: It can't run in place, since the threads would overwrite the
+// evaluations that the other threads read.
+template <typename F>
+__global__ void FixFirstVariable(const F* tables, size_t stride, F r,
+                                 unsigned int half, F* out) {
+  unsigned int b = blockIdx.x * blockDim.x + threadIdx.x;
+  if (b >= half) return;
+  const F* table = tables + blockIdx.y * stride;
+  const F& left = table[2 * b];
+  const F& right = table[2 * b + 1];
+  out[blockIdx.y * size_t{half} + b] = left + r * (right - left);
+}
+
+}  // namespace tachyon::crypto::kernels
+
+#endif  // TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_KERNELS_SUMCHECK_KERNELS_CU_H_
@@ -5,9 +5,15 @@
 
 #include "tachyon/crypto/sumcheck/multilinear/multilinear_sumcheck.h"
 
+#include <memory>
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
 #include "tachyon/base/range.h"
+#include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
 #include "tachyon/math/finite_fields/test/gf7.h"
 #include "tachyon/math/polynomials/multivariate/linear_combination.h"
@@ -20,6 +26,9 @@ using F = math::GF7;
 
 class MultilinearSumcheckTest : public math::FiniteFieldTest<F> {};
 
+class PackedMultilinearSumcheckTest
+    : public math::FiniteFieldTest<math::PackedBabyBear> {};
+
 }  // namespace
 
 TEST_F(MultilinearSumcheckTest, TestInteractiveProtocolSmall) {
@@ -38,6 +47,47 @@ TEST_F(MultilinearSumcheckTest, TestInteractiveProtocolSmall) {
           linear_combination, kNumVariables));
 }
 
+TEST_F(MultilinearSumcheckTest, TestInteractiveProtocolUnrolled) {
+  // |SumcheckProver| runs |EvaluateProducts()| for up to 4 evaluations.
+  constexpr size_t kNumVariables = 10;
+  constexpr size_t kMaxPossibleEvaluations = 4;
+  size_t kNumTerms = 5;
+  using MLE = math::MultilinearDenseEvaluations<F, kNumVariables>;
+  for (size_t max_evaluations = 1; max_evaluations <= kMaxPossibleEvaluations;
+       ++max_evaluations) {
+    const math::LinearCombination<MLE> linear_combination =
+        math::LinearCombination<MLE>::Random(
+            kNumVariables, base::Range<size_t>(1, max_evaluations + 1),
+            kNumTerms);
+
+    EXPECT_TRUE(MultilinearSumcheck<MLE>::RunInteractiveProtocol<
+                kMaxPossibleEvaluations>(linear_combination, kNumVariables));
+  }
+}
+
+TEST_F(MultilinearSumcheckTest, TestInteractiveProtocolBoolean) {
+  // |SumcheckProver| skips the runs of 0s and 1s of the 0/1-valued MLEs.
+  constexpr size_t kNumVariables = 10;
+  constexpr size_t kMaxPossibleEvaluations = 3;
+  size_t kNumTerms = 5;
+  using MLE = math::MultilinearDenseEvaluations<F, kNumVariables>;
+  math::LinearCombination<MLE> linear_combination(kNumVariables);
+  for (size_t i = 0; i < kNumTerms; ++i) {
+    std::vector<F> bits =
+        base::CreateVector(size_t{1} << kNumVariables, []() {
+          return base::Bernoulli(0.8) ? F::Zero() : F::One();
+        });
+    linear_combination.AddTerm(
+        F::Random(), {std::make_shared<MLE>(std::move(bits)),
+                      std::make_shared<MLE>(MLE::Random(kNumVariables)),
+                      std::make_shared<MLE>(MLE::Random(kNumVariables))});
+  }
+
+  EXPECT_TRUE(
+      MultilinearSumcheck<MLE>::RunInteractiveProtocol<kMaxPossibleEvaluations>(
+          linear_combination, kNumVariables));
+}
+
 TEST_F(MultilinearSumcheckTest, TestInteractiveProtocolBig) {
   // |SumcheckVerifier| returns early for |InterpolateUniPoly()|
   constexpr size_t kNumVariables = 10;
@@ -54,4 +104,21 @@ TEST_F(MultilinearSumcheckTest, TestInteractiveProtocolBig) {
           linear_combination, kNumVariables));
 }
 
+TEST_F(PackedMultilinearSumcheckTest, TestInteractiveProtocol) {
+  // |SumcheckProver| runs |EvaluateProducts()| on the lanes of
+  // |math::PackedBabyBear|.
+  constexpr size_t kNumVariables = 10;
+  const base::Range<size_t> kMaxEvaluationsInTermRange(2, 5);
+  constexpr size_t kMaxPossibleEvaluations = 4;
+  size_t kNumTerms = 5;
+  using MLE = math::MultilinearDenseEvaluations<math::BabyBear, kNumVariables>;
+  const math::LinearCombination<MLE> linear_combination =
+      math::LinearCombination<MLE>::Random(
+          kNumVariables, kMaxEvaluationsInTermRange, kNumTerms);
+
+  EXPECT_TRUE(
+      MultilinearSumcheck<MLE>::RunInteractiveProtocol<kMaxPossibleEvaluations>(
+          linear_combination, kNumVariables));
+}
+
 }  // namespace tachyon::crypto
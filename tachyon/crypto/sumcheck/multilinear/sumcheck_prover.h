@@ -6,12 +6,19 @@
 #ifndef TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_SUMCHECK_PROVER_H_
 #define TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_SUMCHECK_PROVER_H_
 
+#include <algorithm>
+#include <array>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/sumcheck/multilinear/sumcheck_prover_msg.h"
 #include "tachyon/crypto/sumcheck/multilinear/sumcheck_proving_key.h"
 #include "tachyon/crypto/sumcheck/multilinear/sumcheck_verifier_msg.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
 #include "tachyon/math/polynomials/multivariate/linear_combination.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 
@@ -39,7 +46,7 @@ class SumcheckProver {
         flattened_ml_evaluations_(key.flattened_ml_evaluations) {
     // Constants are not accepted.
     CHECK_NE(num_variables_, size_t{0});
-    randomness_.reserve(num_variables_);
+    Reserve();
   }
   explicit SumcheckProver(SumcheckProvingKey<MLE>&& key)
       : num_variables_(key.verifying_key.num_variables),
@@ -48,7 +55,7 @@ class SumcheckProver {
         flattened_ml_evaluations_(std::move(key.flattened_ml_evaluations)) {
     // Constants are not accepted.
     CHECK_NE(num_variables_, size_t{0});
-    randomness_.reserve(num_variables_);
+    Reserve();
   }
 
   // Generate prover message, and proceed to next round.
@@ -85,42 +92,60 @@ class SumcheckProver {
     // g₁(3) = start₀ + start₁ + 3step₀ + 3step₁
     //         where product_sum₀ = start₀ + start₁ and product_sumᵢ = product_sum₀ + (i - 1) * (step₀ + step₁)
     // clang-format on
-#if defined(TACHYON_HAS_OPENMP)
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-#else
-    size_t thread_nums = 1;
-#endif
+    // NOTE: The evaluations of the chunks are kept in |chunk_evaluations_|,
+    // which is allocated once by |Reserve()|, so that a round doesn't allocate
+    // on the heap except for the returned message.
+    size_t thread_nums = GetMaxThreadNums();
     size_t size = size_t{1} << (num_variables_ - round_);
     thread_nums = (thread_nums * kParallelFactor) <= size ? thread_nums : 1;
 
     size_t chunk_size = (size + thread_nums - 1) / thread_nums;
     size_t num_chunks = (size + chunk_size - 1) / chunk_size;
-
-    std::vector<std::vector<F>> finished_evaluations(
-        num_chunks, std::vector<F>(max_evaluations_ + 1, F::Zero()));
+    size_t num_evaluations = max_evaluations_ + 1;
+    // The number of threads may have been raised since |Reserve()|.
+    if (chunk_evaluations_.size() < 2 * num_chunks * num_evaluations) {
+      chunk_evaluations_.resize(2 * num_chunks * num_evaluations);
+    }
 
     OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
       size_t begin = i * chunk_size;
-      size_t len = (i == num_chunks - 1) ? size - begin : chunk_size;
-      std::vector<F> intermediate_evaluations(max_evaluations_ + 1, F::Zero());
-      for (size_t j = begin; j < begin + len; ++j) {
-        for (const Term& term : terms_) {
-          std::fill(intermediate_evaluations.begin(),
-                    intermediate_evaluations.end(), term.coefficient);
-          EvaluateTermPerVariable(j, intermediate_evaluations, term);
-          for (size_t k = 0; k < max_evaluations_ + 1; ++k) {
-            finished_evaluations[i][k] += intermediate_evaluations[k];
-          }
-        }
+      size_t end = std::min(begin + chunk_size, size);
+      absl::Span<F> sums = absl::MakeSpan(
+          &chunk_evaluations_[2 * i * num_evaluations], num_evaluations);
+      std::fill(sums.begin(), sums.end(), F::Zero());
+      // The common shapes, the products of up to 4 MLEs, are unrolled by the
+      // number of evaluations.
+      switch (max_evaluations_) {
+        case 1:
+          EvaluateProducts<1>(begin, end, sums);
+          break;
+        case 2:
+          EvaluateProducts<2>(begin, end, sums);
+          break;
+        case 3:
+          EvaluateProducts<3>(begin, end, sums);
+          break;
+        case 4:
+          EvaluateProducts<4>(begin, end, sums);
+          break;
+        default:
+          EvaluateTerms(
+              begin, end, sums,
+              absl::MakeSpan(
+                  &chunk_evaluations_[(2 * i + 1) * num_evaluations],
+                  num_evaluations));
+          break;
       }
     }
     for (size_t i = 1; i < num_chunks; ++i) {
-      for (size_t j = 0; j < max_evaluations_ + 1; ++j) {
-        finished_evaluations[0][j] += finished_evaluations[i][j];
+      const F* sums = &chunk_evaluations_[2 * i * num_evaluations];
+      for (size_t j = 0; j < num_evaluations; ++j) {
+        chunk_evaluations_[j] += sums[j];
       }
     }
-    return {math::UnivariateEvaluations<F, MaxDegree>(
-        std::move(finished_evaluations[0]))};
+    return {math::UnivariateEvaluations<F, MaxDegree>(std::vector<F>(
+        chunk_evaluations_.begin(),
+        chunk_evaluations_.begin() + num_evaluations))};
   }
 
   // Receive message from verifier and run a prover round.
@@ -138,27 +163,149 @@ class SumcheckProver {
   SumcheckProverMsg<F, MaxDegree> Round(SumcheckVerifierMsg<F>&& v_msg) {
     // First round should be prover
     CHECK_GT(round_, size_t{0});
-    randomness_.push_back(v_msg.random_value);
-    Point point({std::move(v_msg.random_value)});
-    for (MLE& evaluations : flattened_ml_evaluations_) {
-      evaluations.FixVariablesInPlace(point);
+    const F& r = randomness_.emplace_back(std::move(v_msg.random_value));
+    // NOTE: The 0/1-valued MLEs are folded at the first round without a
+    // multiplication, since each folded value is one of 0, 1, r and 1 - r.
+    F one_minus_r = F::One() - r;
+    for (size_t i = 0; i < flattened_ml_evaluations_.size(); ++i) {
+      MLE& evaluations = flattened_ml_evaluations_[i];
+      if (round_ == 1 && is_boolean_[i]) {
+        FixBooleanFirstVariableInPlace(r, one_minus_r, evaluations);
+      } else {
+        evaluations.FixFirstVariableInPlace(r);
+      }
     }
     return Round();
   }
 
  private:
-  void EvaluateTermPerVariable(size_t j, std::vector<F>& products,
+  static size_t GetMaxThreadNums() {
+#if defined(TACHYON_HAS_OPENMP)
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+  }
+
+  // Allocates the buffers that the rounds reuse. The first round has the
+  // most chunks, since the number of the hypercube points only shrinks.
+  void Reserve() {
+    randomness_.reserve(num_variables_);
+    is_boolean_ = base::Map(flattened_ml_evaluations_,
+                            [](const MLE& mle) { return mle.IsBoolean(); });
+    // Each chunk holds its sums and the products of a term.
+    chunk_evaluations_.resize(2 * GetMaxThreadNums() * (max_evaluations_ + 1));
+  }
+
+  // Same as |MLE::FixFirstVariableInPlace()|, but for the 0/1-valued
+  // |evaluations|.
+  static void FixBooleanFirstVariableInPlace(const F& r, const F& one_minus_r,
+                                             MLE& evaluations) {
+    std::vector<F>& values = evaluations.evaluations();
+    size_t half = values.size() >> 1;
+    for (size_t b = 0; b < half; ++b) {
+      const F& left = values[b << 1];
+      const F& right = values[(b << 1) + 1];
+      values[b] = left == right ? left : (right.IsOne() ? r : one_minus_r);
+    }
+    values.resize(half);
+  }
+
+  // Adds the evaluations of the terms at 0, 1, ..., |MaxEvaluations| on
+  // the hypercube points in [|begin|, |end|) to |sums|. If |F| has a packed
+  // field, |PackedField::N| points are evaluated at once on its lanes.
+  template <size_t MaxEvaluations>
+  void EvaluateProducts(size_t begin, size_t end, absl::Span<F> sums) const {
+    using PackedField = typename math::PackedFieldTraits<F>::PackedField;
+
+    size_t j = begin;
+    if constexpr (!std::is_void_v<PackedField>) {
+      constexpr size_t N = PackedField::N;
+
+      std::array<PackedField, MaxEvaluations + 1> packed_sums;
+      packed_sums.fill(PackedField::Zero());
+      std::array<PackedField, MaxEvaluations + 1> packed_products;
+      for (; j + N <= end; j += N) {
+        for (const Term& term : terms_) {
+          packed_products.fill(PackedField::Broadcast(term.coefficient));
+          for (size_t index : term.indexes) {
+            const MLE& table = flattened_ml_evaluations_[index];
+            PackedField start;
+            PackedField step;
+            for (size_t l = 0; l < N; ++l) {
+              start[l] = table[(j + l) << 1];
+              step[l] = table[((j + l) << 1) + 1] - start[l];
+            }
+            for (PackedField& p : packed_products) {
+              p *= start;
+              start += step;
+            }
+          }
+          for (size_t k = 0; k < MaxEvaluations + 1; ++k) {
+            packed_sums[k] += packed_products[k];
+          }
+        }
+      }
+      for (size_t k = 0; k < MaxEvaluations + 1; ++k) {
+        for (size_t l = 0; l < N; ++l) {
+          sums[k] += packed_sums[k][l];
+        }
+      }
+    }
+
+    std::array<F, MaxEvaluations + 1> products;
+    for (; j < end; ++j) {
+      for (const Term& term : terms_) {
+        products.fill(term.coefficient);
+        if (!EvaluateTermPerVariable(j, products, term)) continue;
+        for (size_t k = 0; k < MaxEvaluations + 1; ++k) {
+          sums[k] += products[k];
+        }
+      }
+    }
+  }
+
+  // Same as |EvaluateProducts()|, but for any number of evaluations.
+  // |products| is the scratch for the products of a term.
+  void EvaluateTerms(size_t begin, size_t end, absl::Span<F> sums,
+                     absl::Span<F> products) const {
+    for (size_t j = begin; j < end; ++j) {
+      for (const Term& term : terms_) {
+        std::fill(products.begin(), products.end(), term.coefficient);
+        if (!EvaluateTermPerVariable(j, products, term)) continue;
+        for (size_t k = 0; k < products.size(); ++k) {
+          sums[k] += products[k];
+        }
+      }
+    }
+  }
+
+  // |Products| is |std::array<F, N>| so that the loop below is unrolled, or
+  // |absl::Span<F>|. Returns false if the term is zero at |j|.
+  template <typename Products>
+  bool EvaluateTermPerVariable(size_t j, Products& products,
                                const Term& term) const {
     for (size_t index : term.indexes) {
       const MLE& table = flattened_ml_evaluations_[index];
-      F start = table[j << 1];
-      const F step = table[(j << 1) + 1] - start;
+      const F& left = table[j << 1];
+      const F& right = table[(j << 1) + 1];
+      // NOTE: The MLEs that start out 0/1-valued, e.g., selectors, are mostly
+      // runs of 0s or 1s, which stay so after being folded. Such a run zeroes
+      // the whole term or leaves it as it is, so that the multiplications
+      // below are skipped.
+      if (is_boolean_[index] && left == right) {
+        if (left.IsZero()) return false;
+        if (left.IsOne()) continue;
+      }
+      F start = left;
+      const F step = right - left;
       // start, (start + step), (start + 2 * step), (start + 3 * step),...
       for (F& p : products) {
         p *= start;
         start += step;
       }
     }
+    return true;
   }
 
   // The current round number.
@@ -174,6 +321,11 @@ class SumcheckProver {
   std::vector<Term> terms_;
   // Stores a list of multilinear evaluations in which |terms_| points to.
   std::vector<MLE> flattened_ml_evaluations_;
+  // Whether each of |flattened_ml_evaluations_| was 0/1-valued before the
+  // first round.
+  std::vector<bool> is_boolean_;
+  // The sums and the scratch of each chunk of |Round()|.
+  std::vector<F> chunk_evaluations_;
 };
 
 }  // namespace tachyon::crypto
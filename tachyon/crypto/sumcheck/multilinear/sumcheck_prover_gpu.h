@@ -0,0 +1,252 @@
+// This header defines |SumcheckProverGpu|, which runs the rounds of
+// |SumcheckProver| on the GPU. The MLEs stay on the device between the
+// rounds, and only the evaluations of each round polynomial are copied back
+// to the host.
+
+#ifndef TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_SUMCHECK_PROVER_GPU_H_
+#define TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_SUMCHECK_PROVER_GPU_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/crypto/sumcheck/multilinear/kernels/sumcheck_kernels.cu.h"
+#include "tachyon/crypto/sumcheck/multilinear/sumcheck_prover_msg.h"
+#include "tachyon/crypto/sumcheck/multilinear/sumcheck_proving_key.h"
+#include "tachyon/crypto/sumcheck/multilinear/sumcheck_verifier_msg.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/finite_fields/prime_field_conversions.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
+
+namespace tachyon::crypto {
+
+// |SumcheckProverGpu| produces the same messages as |SumcheckProver|. The
+// MLEs are kept in two device buffers that are used in turn, since a variable
+// can't be fixed in place by the threads running in parallel. Each round
+// reduces the evaluations of the terms per block, and the block sums are
+// added up on the device as well.
+template <typename MLE, size_t MaxDegree>
+class SumcheckProverGpu {
+ public:
+  using F = typename MLE::Field;
+  using GpuField = typename F::GpuField;
+
+  constexpr static unsigned int kThreadNum = 256;
+  // The rounds run on at most this many blocks, each of which loops over the
+  // hypercube points.
+  constexpr static unsigned int kMaxBlockNum = 1024;
+
+  explicit SumcheckProverGpu(gpuStream_t stream = nullptr) : stream_(stream) {}
+
+  gpuStream_t stream() const { return stream_; }
+
+  // Uploads the terms and the MLEs of |key|. The device buffers are reused by
+  // the following loads if they are large enough.
+  [[nodiscard]] bool Load(const SumcheckProvingKey<MLE>& key) {
+    TRACE_EVENT("gpu", "SumcheckProverGpu::Load");
+    num_variables_ = key.verifying_key.num_variables;
+    max_evaluations_ = key.verifying_key.max_evaluations;
+    // Constants are not accepted.
+    if (num_variables_ == 0) {
+      LOG(ERROR) << "num_variables is 0";
+      return false;
+    }
+    if (num_variables_ >= size_t{std::numeric_limits<unsigned int>::digits}) {
+      LOG(ERROR) << "Too many variables: " << num_variables_;
+      return false;
+    }
+    if (max_evaluations_ > kernels::kMaxSumcheckEvaluations) {
+      LOG(ERROR) << "Too many MLEs in a term: " << max_evaluations_;
+      return false;
+    }
+    round_ = 0;
+    current_ = 0;
+    stride_ = size_t{1} << num_variables_;
+    randomness_.clear();
+    randomness_.reserve(num_variables_);
+
+    if (!UploadTerms(key)) return false;
+    if (!UploadTables(key.flattened_ml_evaluations)) return false;
+
+    size_t num_evaluations = max_evaluations_ + 1;
+    if (d_block_sums_.size() < kMaxBlockNum * num_evaluations) {
+      d_block_sums_ = device::gpu::GpuMemory<GpuField>::Malloc(
+          kMaxBlockNum * num_evaluations);
+      d_sums_ = device::gpu::GpuMemory<GpuField>::Malloc(num_evaluations);
+    }
+    // The host vectors of |key| must outlive the asynchronous copies above.
+    return Synchronize();
+  }
+
+  // Same as |SumcheckProver::Round()|.
+  [[nodiscard]] bool Round(SumcheckProverMsg<F, MaxDegree>* msg) {
+    TRACE_EVENT("gpu", "SumcheckProverGpu::Round");
+    // Max number of prover rounds should be |num_variables_|.
+    CHECK_LE(++round_, num_variables_);
+
+    unsigned int size = static_cast<unsigned int>(stride_ / 2);
+    unsigned int num_blocks =
+        std::min((size + kThreadNum - 1) / kThreadNum, kMaxBlockNum);
+    unsigned int num_evaluations =
+        static_cast<unsigned int>(max_evaluations_ + 1);
+    kernels::EvaluateRound<<<num_blocks, kThreadNum,
+                             kThreadNum * sizeof(GpuField), stream_>>>(
+        d_tables_[current_].get(), stride_, d_coefficients_.get(),
+        d_term_offsets_.get(), d_indexes_.get(), num_terms_, num_evaluations,
+        size, d_block_sums_.get());
+    if (LOG_IF_GPU_LAST_ERROR("Failed to kernels::EvaluateRound()") !=
+        gpuSuccess) {
+      return false;
+    }
+    kernels::SumBlocks<<<1, num_evaluations, 0, stream_>>>(
+        d_block_sums_.get(), num_blocks, num_evaluations, d_sums_.get());
+    if (LOG_IF_GPU_LAST_ERROR("Failed to kernels::SumBlocks()") !=
+        gpuSuccess) {
+      return false;
+    }
+
+    std::vector<F> evaluations(num_evaluations);
+    if (!d_sums_.CopyToAsync(evaluations.data(),
+                             device::gpu::GpuMemoryType::kHost, stream_, 0,
+                             num_evaluations)) {
+      return false;
+    }
+    if (!Synchronize()) return false;
+    *msg = {math::UnivariateEvaluations<F, MaxDegree>(std::move(evaluations))};
+    return true;
+  }
+
+  // Same as |SumcheckProver::Round(SumcheckVerifierMsg&&)|.
+  [[nodiscard]] bool Round(SumcheckVerifierMsg<F>&& v_msg,
+                           SumcheckProverMsg<F, MaxDegree>* msg) {
+    // First round should be prover
+    CHECK_GT(round_, size_t{0});
+    const F& r = randomness_.emplace_back(std::move(v_msg.random_value));
+
+    unsigned int half = static_cast<unsigned int>(stride_ / 2);
+    dim3 grid((half + kThreadNum - 1) / kThreadNum, num_tables_);
+    const GpuField& gpu_r = math::ConvertPrimeField<GpuField>(r);
+    kernels::FixFirstVariable<<<grid, kThreadNum, 0, stream_>>>(
+        d_tables_[current_].get(), stride_, gpu_r, half,
+        d_tables_[current_ ^ 1].get());
+    if (LOG_IF_GPU_LAST_ERROR("Failed to kernels::FixFirstVariable()") !=
+        gpuSuccess) {
+      return false;
+    }
+    current_ ^= 1;
+    stride_ = half;
+    return Round(msg);
+  }
+
+ private:
+  // Uploads the coefficients of the terms and the indexes of their MLEs,
+  // where the MLEs of the t-th term are in [|term_offsets[t]|,
+  // |term_offsets[t + 1]|) of the indexes.
+  bool UploadTerms(const SumcheckProvingKey<MLE>& key) {
+    num_terms_ = static_cast<unsigned int>(key.terms.size());
+    coefficients_.clear();
+    term_offsets_ = {0};
+    indexes_.clear();
+    for (const math::LinearCombinationTerm<F>& term : key.terms) {
+      coefficients_.push_back(term.coefficient);
+      for (size_t index : term.indexes) {
+        indexes_.push_back(static_cast<unsigned int>(index));
+      }
+      term_offsets_.push_back(static_cast<unsigned int>(indexes_.size()));
+    }
+    return Upload(coefficients_, d_coefficients_) &&
+           Upload(term_offsets_, d_term_offsets_) &&
+           Upload(indexes_, d_indexes_);
+  }
+
+  // Uploads the MLEs back to back with |stride_| evaluations each. A zero MLE
+  // may have no evaluations, which is uploaded as zeros.
+  bool UploadTables(const std::vector<MLE>& tables) {
+    num_tables_ = static_cast<unsigned int>(tables.size());
+    if (num_tables_ > std::numeric_limits<uint16_t>::max()) {
+      LOG(ERROR) << "Too many MLEs: " << num_tables_;
+      return false;
+    }
+    if (d_tables_[0].size() < tables.size() * stride_) {
+      d_tables_[0] =
+          device::gpu::GpuMemory<GpuField>::Malloc(tables.size() * stride_);
+      d_tables_[1] = device::gpu::GpuMemory<GpuField>::Malloc(
+          tables.size() * stride_ / 2);
+    }
+    for (size_t i = 0; i < tables.size(); ++i) {
+      const std::vector<F>& evaluations = tables[i].evaluations();
+      if (evaluations.empty()) {
+        if (!d_tables_[0].MemsetAsync(0, stream_, i * stride_, stride_)) {
+          return false;
+        }
+        continue;
+      }
+      if (evaluations.size() != stride_) {
+        LOG(ERROR) << "The MLEs have different sizes";
+        return false;
+      }
+      if (!d_tables_[0].CopyFromPageableAsync(evaluations.data(), stream_,
+                                              i * stride_, stride_)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename T, typename R>
+  bool Upload(const std::vector<T>& values,
+              device::gpu::GpuMemory<R>& d_values) {
+    if (values.empty()) return true;
+    if (d_values.size() < values.size()) {
+      d_values = device::gpu::GpuMemory<R>::Malloc(values.size());
+    }
+    return d_values.CopyFromAsync(values.data(),
+                                  device::gpu::GpuMemoryType::kHost, stream_,
+                                  0, values.size());
+  }
+
+  bool Synchronize() {
+    return LOG_IF_GPU_ERROR(gpuStreamSynchronize(stream_),
+                            "Failed to gpuStreamSynchronize()") == gpuSuccess;
+  }
+
+  // not owned
+  gpuStream_t stream_ = nullptr;
+  // The current round number.
+  size_t round_ = 0;
+  // Number of variables.
+  size_t num_variables_ = 0;
+  // Max number of evaluations in a term.
+  size_t max_evaluations_ = 0;
+  unsigned int num_terms_ = 0;
+  unsigned int num_tables_ = 0;
+  // Sampled set of random values given by the verifier.
+  std::vector<F> randomness_;
+
+  // The host copies of the terms, which outlive the asynchronous uploads.
+  std::vector<F> coefficients_;
+  std::vector<unsigned int> term_offsets_;
+  std::vector<unsigned int> indexes_;
+
+  device::gpu::GpuMemory<GpuField> d_coefficients_;
+  device::gpu::GpuMemory<unsigned int> d_term_offsets_;
+  device::gpu::GpuMemory<unsigned int> d_indexes_;
+  // The MLEs are read from |d_tables_[current_]| and their variable is fixed
+  // into the other one. Each MLE has |stride_| evaluations.
+  device::gpu::GpuMemory<GpuField> d_tables_[2];
+  size_t current_ = 0;
+  size_t stride_ = 0;
+  device::gpu::GpuMemory<GpuField> d_block_sums_;
+  device::gpu::GpuMemory<GpuField> d_sums_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_SUMCHECK_MULTILINEAR_SUMCHECK_PROVER_GPU_H_
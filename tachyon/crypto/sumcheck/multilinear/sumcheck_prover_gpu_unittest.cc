@@ -0,0 +1,57 @@
+#include "tachyon/crypto/sumcheck/multilinear/sumcheck_prover_gpu.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/range.h"
+#include "tachyon/crypto/sumcheck/multilinear/kernels/bn254_sumcheck_kernels.cu.h"
+#include "tachyon/crypto/sumcheck/multilinear/sumcheck_prover.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/multivariate/linear_combination.h"
+#include "tachyon/math/polynomials/multivariate/multilinear_dense_evaluations.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+class SumcheckProverGpuTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+
+  static void TearDownTestSuite() {
+    GPU_MUST_SUCCESS(gpuDeviceReset(), "");
+  }
+};
+
+}  // namespace
+
+TEST_F(SumcheckProverGpuTest, Round) {
+  // The first rounds run on more than one block.
+  constexpr size_t kNumVariables = 12;
+  constexpr size_t kMaxPossibleEvaluations = 8;
+  using MLE = math::MultilinearDenseEvaluations<F, kNumVariables>;
+
+  for (size_t max_evaluations : {1, 4, 8}) {
+    const math::LinearCombination<MLE> linear_combination =
+        math::LinearCombination<MLE>::Random(
+            kNumVariables, base::Range<size_t>(1, max_evaluations + 1), 5);
+    const SumcheckProvingKey<MLE> proving_key =
+        SumcheckProvingKey<MLE>::Build(linear_combination);
+
+    SumcheckProver<MLE, kMaxPossibleEvaluations> prover(proving_key);
+    SumcheckProverGpu<MLE, kMaxPossibleEvaluations> prover_gpu;
+    ASSERT_TRUE(prover_gpu.Load(proving_key));
+
+    SumcheckProverMsg<F, kMaxPossibleEvaluations> msg_gpu;
+    ASSERT_TRUE(prover_gpu.Round(&msg_gpu));
+    EXPECT_EQ(msg_gpu, prover.Round());
+    for (size_t i = 1; i < kNumVariables; ++i) {
+      F r = F::Random();
+      ASSERT_TRUE(prover_gpu.Round({r}, &msg_gpu));
+      EXPECT_EQ(msg_gpu, prover.Round({r}));
+    }
+  }
+}
+
+}  // namespace tachyon::crypto
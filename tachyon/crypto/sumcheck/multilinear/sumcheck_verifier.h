@@ -85,13 +85,22 @@ class SumcheckVerifier {
   bool CheckAndGenerateSubclaim(const F& asserted_sum, Subclaim<F>* subclaim) {
     // Insufficient rounds.
     CHECK_EQ(polynomials_received_.size(), num_variables_);
-    F expected = asserted_sum;
-
-    for (size_t i = 0; i < num_variables_; ++i) {
-      const std::vector<F>& evaluations = polynomials_received_[i];
+    for (const std::vector<F>& evaluations : polynomials_received_) {
       // Incorrect number of evaluations.
       CHECK_EQ(evaluations.size(), max_evaluations_ + 1);
+    }
 
+    // NOTE: gᵢ(rᵢ) only depends on the i-th round, so the interpolations of
+    // every round run in parallel before the claims are chained.
+    std::vector<F> interpolations(num_variables_);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_variables_; ++i) {
+      interpolations[i] =
+          InterpolateUniPoly(polynomials_received_[i], randomness_[i]);
+    }
+
+    F expected = asserted_sum;
+    for (size_t i = 0; i < num_variables_; ++i) {
+      const std::vector<F>& evaluations = polynomials_received_[i];
       const F& p0 = evaluations[0];
       const F& p1 = evaluations[1];
 
@@ -101,7 +110,7 @@ class SumcheckVerifier {
       if (sum != expected) {
         return false;
       }
-      expected = InterpolateUniPoly(evaluations, randomness_[i]);
+      expected = std::move(interpolations[i]);
     }
     *subclaim = {std::move(randomness_), std::move(expected)};
     return true;
@@ -131,7 +131,7 @@ class SimpleTranscriptWriter<
 
  private:
   bool DoWriteToProof(const F& value) override {
-    return this->buffer_.Write(value);
+    return this->GetProofBuffer().Write(value);
   }
 };
 
@@ -158,11 +158,11 @@ class SimpleTranscriptWriter<math::AffinePoint<Curve>>
 
  private:
   bool DoWriteToProof(const math::AffinePoint<Curve>& point) override {
-    return this->buffer_.Write(point);
+    return this->GetProofBuffer().Write(point);
   }
 
   bool DoWriteToProof(const F& scalar) override {
-    return this->buffer_.Write(scalar);
+    return this->GetProofBuffer().Write(scalar);
   }
 };
 
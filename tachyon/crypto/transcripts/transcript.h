@@ -7,7 +7,15 @@
 #ifndef TACHYON_CRYPTO_TRANSCRIPTS_TRANSCRIPT_H_
 #define TACHYON_CRYPTO_TRANSCRIPTS_TRANSCRIPT_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <optional>
 #include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
 #include "tachyon/crypto/transcripts/transcript_traits.h"
@@ -44,6 +52,17 @@ class TranscriptImpl<_Commitment, false> {
   // treating it as a common input.
   [[nodiscard]] virtual bool WriteToTranscript(const Field& value) = 0;
 
+  // Write |commitments| to the transcript in order, which is the same as
+  // calling |WriteToTranscript()| for each of them. The transcripts can
+  // override this to absorb them at once.
+  [[nodiscard]] virtual bool WriteManyToTranscript(
+      absl::Span<const Commitment> commitments) {
+    for (const Commitment& commitment : commitments) {
+      if (!WriteToTranscript(commitment)) return false;
+    }
+    return true;
+  }
+
   TranscriptWriterImpl<Commitment, false>* ToWriter() {
     return static_cast<TranscriptWriterImpl<Commitment, false>*>(this);
   }
@@ -75,6 +94,17 @@ class TranscriptImpl<_Field, true> {
   // treating it as a common input.
   [[nodiscard]] virtual bool WriteToTranscript(const Field& value) = 0;
 
+  // Write |values| to the transcript in order, which is the same as calling
+  // |WriteToTranscript()| for each of them. The transcripts can override this
+  // to absorb them at once.
+  [[nodiscard]] virtual bool WriteManyToTranscript(
+      absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      if (!WriteToTranscript(value)) return false;
+    }
+    return true;
+  }
+
   TranscriptWriterImpl<Field, true>* ToWriter() {
     return static_cast<TranscriptWriterImpl<Field, true>*>(this);
   }
@@ -168,22 +198,119 @@ using TranscriptReader =
     TranscriptReaderImpl<T,
                          TranscriptTraits<T>::kFieldAndCommitmentAreSameType>;
 
+// Holds the proof written by either of the specializations of
+// |TranscriptWriterImpl|. The proof is written to |buffer()| by default.
+class TranscriptWriterBase {
+ public:
+  // Called with each segment of the proof passed by |FlushProof()|. Returns
+  // false on failure.
+  using ProofSink = std::function<bool(absl::Span<const uint8_t> segment)>;
+
+  TranscriptWriterBase() = default;
+  explicit TranscriptWriterBase(base::Uint8VectorBuffer buf)
+      : buffer_(std::move(buf)) {}
+  virtual ~TranscriptWriterBase() = default;
+
+  base::Uint8VectorBuffer& buffer() { return buffer_; }
+  const base::Uint8VectorBuffer& buffer() const { return buffer_; }
+
+  base::Uint8VectorBuffer&& TakeBuffer() && { return std::move(buffer_); }
+
+  // Writes the proof straight into |output| instead of |buffer()| from now
+  // on, so that it is neither reallocated as it grows nor copied out at the
+  // end. Writing the proof fails once |output| is full.
+  void SetProofOutput(absl::Span<uint8_t> output) {
+    output_.emplace(output.data(), output.size());
+    flushed_len_ = 0;
+  }
+
+  // When |proof_sink| is set, |FlushProof()| passes the proof written since
+  // the previous flush to it and rewinds the proof buffer, so that the buffer
+  // only grows as large as the largest segment.
+  void set_proof_sink(ProofSink proof_sink) {
+    proof_sink_ = std::move(proof_sink);
+  }
+
+  // Returns the proof written since the previous flush, which is the whole
+  // proof unless a proof sink is set.
+  absl::Span<const uint8_t> GetUnflushedProof() const {
+    const base::Buffer& buffer = GetProofBuffer();
+    return absl::Span<const uint8_t>(
+        static_cast<const uint8_t*>(buffer.buffer()), buffer.buffer_offset());
+  }
+
+  // Returns the length of the proof written so far, including the flushed
+  // segments.
+  size_t GetProofLen() const {
+    return flushed_len_ + GetProofBuffer().buffer_offset();
+  }
+
+  // Passes the unflushed proof to the proof sink, if any. This is meant to be
+  // called when a challenge is squeezed, after which the proof written so far
+  // doesn't change. Returns false if the proof sink fails.
+  [[nodiscard]] bool FlushProof() {
+    if (!proof_sink_) return true;
+    absl::Span<const uint8_t> segment = GetUnflushedProof();
+    if (segment.empty()) return true;
+    if (!proof_sink_(segment)) return false;
+    flushed_len_ += segment.size();
+    GetProofBuffer().set_buffer_offset(0);
+    return true;
+  }
+
+  // Restores the proof written so far, of which the first |flushed_len| bytes
+  // are flushed and the rest is |unflushed_proof|, to a writer nothing is
+  // written to yet. This is used to resume a proof from a checkpoint along
+  // with |RestoreState()|.
+  [[nodiscard]] bool RestoreProof(absl::Span<const uint8_t> unflushed_proof,
+                                  size_t flushed_len) {
+    base::Buffer& buffer = GetProofBuffer();
+    if (buffer.buffer_offset() != 0 || flushed_len_ != 0) return false;
+    if (!buffer.Write(unflushed_proof.data(), unflushed_proof.size()))
+      return false;
+    flushed_len_ = flushed_len;
+    return true;
+  }
+
+  // Saves the state of the hash of the transcript to |state|, so that it can
+  // be restored by |RestoreState()|. Returns false if the transcript doesn't
+  // support it.
+  [[nodiscard]] virtual bool SaveState(std::vector<uint8_t>* state) const {
+    return false;
+  }
+
+  [[nodiscard]] virtual bool RestoreState(absl::Span<const uint8_t> state) {
+    return false;
+  }
+
+ protected:
+  base::Buffer& GetProofBuffer() {
+    if (output_.has_value()) return *output_;
+    return buffer_;
+  }
+  const base::Buffer& GetProofBuffer() const {
+    if (output_.has_value()) return *output_;
+    return buffer_;
+  }
+
+  base::Uint8VectorBuffer buffer_;
+  std::optional<base::Buffer> output_;
+  ProofSink proof_sink_;
+  size_t flushed_len_ = 0;
+};
+
 // Transcript view from the perspective of a prover that has access to an output
 // stream of messages from the prover to the verifier.
 template <typename Commitment>
-class TranscriptWriterImpl<Commitment, false> : public Transcript<Commitment> {
+class TranscriptWriterImpl<Commitment, false> : public Transcript<Commitment>,
+                                                 public TranscriptWriterBase {
  public:
   using Field = typename TranscriptTraits<Commitment>::Field;
 
   TranscriptWriterImpl() = default;
   // Initialize a transcript given an output buffer.
   explicit TranscriptWriterImpl(base::Uint8VectorBuffer buf)
-      : buffer_(std::move(buf)) {}
-
-  base::Uint8VectorBuffer& buffer() { return buffer_; }
-  const base::Uint8VectorBuffer& buffer() const { return buffer_; }
-
-  base::Uint8VectorBuffer&& TakeBuffer() && { return std::move(buffer_); }
+      : TranscriptWriterBase(std::move(buf)) {}
 
   // Write a |commitment| to the proof. Note that it also writes the
   // |commitment| to the transcript by calling |WriteToTranscript()| internally.
@@ -200,6 +327,22 @@ class TranscriptWriterImpl<Commitment, false> : public Transcript<Commitment> {
     return this->WriteToTranscript(value) && DoWriteToProof(value);
   }
 
+  // Write |commitments| to the proof in order, which is the same as calling
+  // |WriteToProof()| for each of them, except that they are written to the
+  // transcript at once by |WriteManyToTranscript()|.
+  [[nodiscard]] bool WriteManyToProof(
+      absl::Span<const Commitment> commitments) {
+    for (const Commitment& commitment : commitments) {
+      VLOG(3) << "Proof[" << proof_idx_++
+              << "]: " << commitment.ToHexString(true);
+    }
+    if (!this->WriteManyToTranscript(commitments)) return false;
+    for (const Commitment& commitment : commitments) {
+      if (!DoWriteToProof(commitment)) return false;
+    }
+    return true;
+  }
+
  protected:
   //  Write a |commitment| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Commitment& commitment) = 0;
@@ -207,24 +350,19 @@ class TranscriptWriterImpl<Commitment, false> : public Transcript<Commitment> {
   //  Write a |value| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Field& value) = 0;
 
-  base::Uint8VectorBuffer buffer_;
   size_t proof_idx_ = 0;
 };
 
 // Transcript view from the perspective of a prover that has access to an output
 // stream of messages from the prover to the verifier.
 template <typename Field>
-class TranscriptWriterImpl<Field, true> : public Transcript<Field> {
+class TranscriptWriterImpl<Field, true> : public Transcript<Field>,
+                                           public TranscriptWriterBase {
  public:
   TranscriptWriterImpl() = default;
   // Initialize a transcript given an output buffer.
   explicit TranscriptWriterImpl(base::Uint8VectorBuffer buf)
-      : buffer_(std::move(buf)) {}
-
-  base::Uint8VectorBuffer& buffer() { return buffer_; }
-  const base::Uint8VectorBuffer& buffer() const { return buffer_; }
-
-  base::Uint8VectorBuffer&& TakeBuffer() && { return std::move(buffer_); }
+      : TranscriptWriterBase(std::move(buf)) {}
 
   // Write a |value| to the proof. Note that it also writes the
   // |value| to the transcript by calling |WriteToTranscript()| internally.
@@ -233,11 +371,24 @@ class TranscriptWriterImpl<Field, true> : public Transcript<Field> {
     return this->WriteToTranscript(value) && DoWriteToProof(value);
   }
 
+  // Write |values| to the proof in order, which is the same as calling
+  // |WriteToProof()| for each of them, except that they are written to the
+  // transcript at once by |WriteManyToTranscript()|.
+  [[nodiscard]] bool WriteManyToProof(absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      VLOG(3) << "Proof[" << proof_idx_++ << "]: " << value.ToHexString(true);
+    }
+    if (!this->WriteManyToTranscript(values)) return false;
+    for (const Field& value : values) {
+      if (!DoWriteToProof(value)) return false;
+    }
+    return true;
+  }
+
  protected:
   //  Write a |value| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Field& value) = 0;
 
-  base::Uint8VectorBuffer buffer_;
   size_t proof_idx_ = 0;
 };
 
@@ -3,13 +3,15 @@
 
 #include <tuple>
 
+#include "tachyon/device/gpu/gpu_device_functions.h"
+#include "tachyon/device/gpu/gpu_enums.h"
 #include "tachyon/device/gpu/gpu_memory.h"
 
 #define CUB_TRY_ALLOCATE(fn, ...)                                    \
   ({                                                                 \
     size_t bytes = 0;                                                \
-    cudaError_t error = fn(nullptr, bytes, __VA_ARGS__);             \
-    if (error == cudaSuccess) {                                      \
+    gpuError_t error = fn(nullptr, bytes, __VA_ARGS__);              \
+    if (error == gpuSuccess) {                                       \
       ::tachyon::device::gpu::GpuMemory<uint8_t> storage =           \
           ::tachyon::device::gpu::GpuMemory<uint8_t>::Malloc(bytes); \
       std::ignore = storage;                                         \
@@ -22,8 +24,8 @@
 #define CUB_INVOKE(fn, ...)                                          \
   ({                                                                 \
     size_t bytes = 0;                                                \
-    cudaError_t error = fn(nullptr, bytes, __VA_ARGS__);             \
-    if (error == cudaSuccess) {                                      \
+    gpuError_t error = fn(nullptr, bytes, __VA_ARGS__);              \
+    if (error == gpuSuccess) {                                       \
       ::tachyon::device::gpu::GpuMemory<uint8_t> storage =           \
           ::tachyon::device::gpu::GpuMemory<uint8_t>::Malloc(bytes); \
       error = fn(storage.get(), bytes, __VA_ARGS__);                 \
@@ -36,8 +38,8 @@
 #define CUB_TRY_ALLOCATE_WITH_POOL(pool, stream, fn, ...)                  \
   ({                                                                       \
     size_t bytes = 0;                                                      \
-    cudaError_t error = fn(nullptr, bytes, __VA_ARGS__);                   \
-    if (error == cudaSuccess) {                                            \
+    gpuError_t error = fn(nullptr, bytes, __VA_ARGS__);                    \
+    if (error == gpuSuccess) {                                             \
       ::tachyon::device::gpu::GpuMemory<uint8_t> storage =                 \
           ::tachyon::device::gpu::GpuMemory<uint8_t>::MallocFromPoolAsync( \
               bytes, pool, stream);                                        \
@@ -51,8 +53,8 @@
 #define CUB_INVOKE_WITH_POOL(pool, stream, fn, ...)                        \
   ({                                                                       \
     size_t bytes = 0;                                                      \
-    cudaError_t error = fn(nullptr, bytes, __VA_ARGS__);                   \
-    if (error == cudaSuccess) {                                            \
+    gpuError_t error = fn(nullptr, bytes, __VA_ARGS__);                    \
+    if (error == gpuSuccess) {                                             \
       ::tachyon::device::gpu::GpuMemory<uint8_t> storage =                 \
           ::tachyon::device::gpu::GpuMemory<uint8_t>::MallocFromPoolAsync( \
               bytes, pool, stream);                                        \
@@ -3,9 +3,8 @@
 
 #include <type_traits>
 
-#include "third_party/gpus/cuda/include/cuda_runtime.h"
-
 #include "tachyon/base/compiler_specific.h"
+#include "tachyon/device/gpu/gpu_runtime.h"
 
 namespace tachyon::device::gpu {
 
@@ -37,6 +36,11 @@ enum class CacheOperator {
 
 template <typename T, StateSpace Space, CacheOperator Operator>
 __device__ ALWAYS_INLINE constexpr T LoadSingle(const T* ptr) {
+#if TACHYON_USE_ROCM
+  // NOTE: HIP has no intrinsics for the cache operators, so every load is a
+  // plain one, which the L2 cache of AMD GPUs serves the same way.
+  return *ptr;
+#else
   if constexpr (Space == StateSpace::kGlobal) {
     if constexpr (Operator == CacheOperator::kNone) {
       return __ldg(ptr);
@@ -53,6 +57,7 @@ __device__ ALWAYS_INLINE constexpr T LoadSingle(const T* ptr) {
     }
   }
   return *ptr;
+#endif  // TACHYON_USE_ROCM
 }
 
 template <class T, typename U, CacheOperator Operator, size_t Stride>
@@ -80,6 +85,10 @@ __device__ ALWAYS_INLINE constexpr T Load(const T* address,
 
 template <typename T, CacheOperator Operator>
 __device__ ALWAYS_INLINE constexpr void StoreSingle(T* ptr, T value) {
+#if TACHYON_USE_ROCM
+  // NOTE: See the note in |LoadSingle()|.
+  *ptr = value;
+#else
   if constexpr (Operator == CacheOperator::kWriteBack) {
     __stwb(ptr, value);
   } else if constexpr (Operator == CacheOperator::kGlobal) {
@@ -91,6 +100,7 @@ __device__ ALWAYS_INLINE constexpr void StoreSingle(T* ptr, T value) {
   } else {
     *ptr = value;
   }
+#endif  // TACHYON_USE_ROCM
 }
 
 // T=uint4, U=uint4, Operator=tachyon::device::gpu::CacheOperator::kStreaming,
@@ -6,7 +6,9 @@
 #if TACHYON_CUDA
 #include "third_party/gpus/cuda/include/cuda.h"
 #include "third_party/gpus/cuda/include/cuda_runtime_api.h"
-#endif  // TACHYON_CUDA
+#elif TACHYON_USE_ROCM
+#include "rocm/include/hip/hip_runtime_api.h"
+#endif
 
 // clang-format off
 #if TACHYON_CUDA
@@ -16,6 +18,16 @@ using gpuError_t = cudaError_t;
 
 #define gpuDeviceReset cudaDeviceReset
 #define gpuDeviceSynchronize cudaDeviceSynchronize
+#define gpuGetDevice cudaGetDevice
+#define gpuGetDeviceCount cudaGetDeviceCount
+#define gpuSetDevice cudaSetDevice
+#define gpuMemGetInfo cudaMemGetInfo
+#define gpuDeviceGetAttribute cudaDeviceGetAttribute
+#define gpuDevAttrClockRate cudaDevAttrClockRate
+#define gpuDevAttrMultiProcessorCount cudaDevAttrMultiProcessorCount
+#define gpuDevAttrWarpSize cudaDevAttrWarpSize
+using gpuDeviceProp = cudaDeviceProp;
+#define gpuGetDeviceProperties cudaGetDeviceProperties
 
 using gpuEvent_t = cudaEvent_t;
 #define gpuEventCreate cudaEventCreate
@@ -26,20 +38,36 @@ using gpuEvent_t = cudaEvent_t;
 #define gpuEventRecord cudaEventRecord
 #define gpuEventSynchronize cudaEventSynchronize
 
+#define gpuFuncSetCacheConfig cudaFuncSetCacheConfig
+
+using gpuGraph_t = cudaGraph_t;
+using gpuGraphExec_t = cudaGraphExec_t;
+#define gpuGraphDestroy cudaGraphDestroy
+#define gpuGraphExecDestroy cudaGraphExecDestroy
+#define gpuGraphExecUpdate cudaGraphExecUpdate
+#define gpuGraphInstantiateWithFlags cudaGraphInstantiateWithFlags
+#define gpuGraphLaunch cudaGraphLaunch
+
 #if CUDA_VERSION >= 11020  // CUDA 11.2
 // See https://developer.nvidia.com/blog/enhancing-memory-allocation-with-new-cuda-11-2-features/
 using gpuMemPool_t = cudaMemPool_t;
 using gpuMemPoolProps = cudaMemPoolProps;
+using gpuMemPoolAttr = cudaMemPoolAttr;
 #define gpuMemPoolCreate cudaMemPoolCreate
 #define gpuMemPoolDestroy cudaMemPoolDestroy
 #define gpuMemPoolSetAttribute cudaMemPoolSetAttribute
 #define gpuMemPoolGetAttribute cudaMemPoolGetAttribute
 #endif
 
+using gpuHostFn_t = cudaHostFn_t;
+#define gpuLaunchHostFunc cudaLaunchHostFunc
+
 using gpuStream_t = cudaStream_t;
+#define gpuStreamBeginCapture cudaStreamBeginCapture
 #define gpuStreamCreate cudaStreamCreate
 #define gpuStreamCreateWithFlags cudaStreamCreateWithFlags
 #define gpuStreamDestroy cudaStreamDestroy
+#define gpuStreamEndCapture cudaStreamEndCapture
 #define gpuStreamSynchronize cudaStreamSynchronize
 #define gpuStreamWaitEvent cudaStreamWaitEvent
 #elif TACHYON_USE_ROCM
@@ -54,6 +82,16 @@ static std::string cudaGetErrorString(int err) { return std::to_string(err); }
 using gpuError_t = int;
 
 #define gpuDeviceSynchronize hipDeviceSynchronize
+#define gpuGetDevice hipGetDevice
+#define gpuGetDeviceCount hipGetDeviceCount
+#define gpuSetDevice hipSetDevice
+#define gpuMemGetInfo hipMemGetInfo
+#define gpuDeviceGetAttribute hipDeviceGetAttribute
+#define gpuDevAttrClockRate hipDeviceAttributeClockRate
+#define gpuDevAttrMultiProcessorCount hipDeviceAttributeMultiprocessorCount
+#define gpuDevAttrWarpSize hipDeviceAttributeWarpSize
+using gpuDeviceProp = hipDeviceProp_t;
+#define gpuGetDeviceProperties hipGetDeviceProperties
 
 using gpuEvent_t = hipEvent_t;
 #define gpuEventCreate hipEventCreate
@@ -64,17 +102,33 @@ using gpuEvent_t = hipEvent_t;
 #define gpuEventRecord hipEventRecord
 #define gpuEventSynchronize hipEventSynchronize
 
+#define gpuFuncSetCacheConfig hipFuncSetCacheConfig
+
+using gpuGraph_t = hipGraph_t;
+using gpuGraphExec_t = hipGraphExec_t;
+#define gpuGraphDestroy hipGraphDestroy
+#define gpuGraphExecDestroy hipGraphExecDestroy
+#define gpuGraphExecUpdate hipGraphExecUpdate
+#define gpuGraphInstantiateWithFlags hipGraphInstantiateWithFlags
+#define gpuGraphLaunch hipGraphLaunch
+
 using gpuMemPool_t = hipMemPool_t;
 using gpuMemPoolProps = hipMemPoolProps;
+using gpuMemPoolAttr = hipMemPoolAttr;
 #define gpuMemPoolCreate hipMemPoolCreate
 #define gpuMemPoolDestroy hipMemPoolDestroy
 #define gpuMemPoolSetAttribute hipMemPoolSetAttribute
 #define gpuMemPoolGetAttribute hipMemPoolGetAttribute
 
+using gpuHostFn_t = hipHostFn_t;
+#define gpuLaunchHostFunc hipLaunchHostFunc
+
 using gpuStream_t = hipStream_t;
+#define gpuStreamBeginCapture hipStreamBeginCapture
 #define gpuStreamCreate hipStreamCreate
 #define gpuStreamCreateWithFlags hipStreamCreateWithFlags
 #define gpuStreamDestroy hipStreamDestroy
+#define gpuStreamEndCapture hipStreamEndCapture
 #define gpuStreamSynchronize hipStreamSynchronize
 #define gpuStreamWaitEvent hipStreamWaitEvent
 #endif
@@ -0,0 +1,61 @@
+#include "tachyon/device/gpu/gpu_device_perf_info.h"
+
+#include "tachyon/device/gpu/gpu_logging.h"
+
+namespace tachyon::device::gpu {
+
+std::vector<GpuDevicePerfInfo> GetGpuDevicePerfInfos() {
+  int device_count = 0;
+  if (LOG_IF_GPU_ERROR(gpuGetDeviceCount(&device_count),
+                       "Failed to gpuGetDeviceCount()") != gpuSuccess) {
+    return {};
+  }
+  int current_device = 0;
+  if (LOG_IF_GPU_ERROR(gpuGetDevice(&current_device),
+                       "Failed to gpuGetDevice()") != gpuSuccess) {
+    return {};
+  }
+
+  std::vector<GpuDevicePerfInfo> ret;
+  ret.reserve(device_count);
+  for (int i = 0; i < device_count; ++i) {
+    GpuDevicePerfInfo info;
+    info.device_id = i;
+    if (LOG_IF_GPU_ERROR(gpuDeviceGetAttribute(&info.multiprocessor_count,
+                                               gpuDevAttrMultiProcessorCount,
+                                               i),
+                         "Failed to gpuDeviceGetAttribute()") != gpuSuccess ||
+        LOG_IF_GPU_ERROR(
+            gpuDeviceGetAttribute(&info.clock_rate, gpuDevAttrClockRate, i),
+            "Failed to gpuDeviceGetAttribute()") != gpuSuccess ||
+        LOG_IF_GPU_ERROR(
+            gpuDeviceGetAttribute(&info.warp_size, gpuDevAttrWarpSize, i),
+            "Failed to gpuDeviceGetAttribute()") != gpuSuccess ||
+        LOG_IF_GPU_ERROR(gpuSetDevice(i), "Failed to gpuSetDevice()") !=
+            gpuSuccess ||
+        LOG_IF_GPU_ERROR(
+            gpuMemGetInfo(&info.free_memory_bytes, &info.total_memory_bytes),
+            "Failed to gpuMemGetInfo()") != gpuSuccess) {
+      ret.clear();
+      break;
+    }
+    ret.push_back(info);
+  }
+  GPU_MUST_SUCCESS(gpuSetDevice(current_device), "Failed to gpuSetDevice()");
+  return ret;
+}
+
+int GetWarpSize() {
+  int device_id = 0;
+  int warp_size = 0;
+  if (LOG_IF_GPU_ERROR(gpuGetDevice(&device_id), "Failed to gpuGetDevice()") !=
+          gpuSuccess ||
+      LOG_IF_GPU_ERROR(
+          gpuDeviceGetAttribute(&warp_size, gpuDevAttrWarpSize, device_id),
+          "Failed to gpuDeviceGetAttribute()") != gpuSuccess) {
+    return kDefaultWarpSize;
+  }
+  return warp_size;
+}
+
+}  // namespace tachyon::device::gpu
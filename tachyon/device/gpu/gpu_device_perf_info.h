@@ -0,0 +1,47 @@
+#ifndef TACHYON_DEVICE_GPU_GPU_DEVICE_PERF_INFO_H_
+#define TACHYON_DEVICE_GPU_GPU_DEVICE_PERF_INFO_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "tachyon/export.h"
+
+namespace tachyon::device::gpu {
+
+// |GpuDevicePerfInfo| describes a GPU device visible to the process. It is
+// used to pick the devices and to split the work among them.
+struct TACHYON_EXPORT GpuDevicePerfInfo {
+  int device_id = 0;
+  int multiprocessor_count = 0;
+  // The peak clock rate in kHz.
+  int clock_rate = 0;
+  // The number of threads that run in lockstep, which is 32 on NVIDIA GPUs and
+  // 64 on most AMD GPUs, e.g., MI250 and MI300.
+  int warp_size = 0;
+  size_t free_memory_bytes = 0;
+  size_t total_memory_bytes = 0;
+
+  // Returns a value proportional to the peak throughput of the device, which
+  // is only meaningful when compared with the other devices.
+  double GetRelativeThroughput() const {
+    return static_cast<double>(multiprocessor_count) * clock_rate;
+  }
+};
+
+// Returns the |GpuDevicePerfInfo| of every GPU device. Returns an empty vector
+// if it fails to query the devices.
+TACHYON_EXPORT std::vector<GpuDevicePerfInfo> GetGpuDevicePerfInfos();
+
+// The warp size of NVIDIA GPUs, which is assumed if the device can't be
+// queried.
+constexpr int kDefaultWarpSize = 32;
+
+// Returns the warp size of the current device. The kernels whose blocks are as
+// wide as a warp should be launched with this instead of assuming 32, so that
+// the wavefronts of AMD GPUs aren't left half empty.
+TACHYON_EXPORT int GetWarpSize();
+
+}  // namespace tachyon::device::gpu
+
+#endif  // TACHYON_DEVICE_GPU_GPU_DEVICE_PERF_INFO_H_
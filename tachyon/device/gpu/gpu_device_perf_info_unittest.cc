@@ -0,0 +1,38 @@
+#include "tachyon/device/gpu/gpu_device_perf_info.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/device/gpu/gpu_logging.h"
+
+namespace tachyon::device::gpu {
+
+TEST(GpuDevicePerfInfoTest, GetGpuDevicePerfInfos) {
+  std::vector<GpuDevicePerfInfo> perf_infos = GetGpuDevicePerfInfos();
+  ASSERT_FALSE(perf_infos.empty());
+  for (size_t i = 0; i < perf_infos.size(); ++i) {
+    const GpuDevicePerfInfo& perf_info = perf_infos[i];
+    EXPECT_EQ(perf_info.device_id, static_cast<int>(i));
+    EXPECT_GT(perf_info.multiprocessor_count, 0);
+    EXPECT_GT(perf_info.clock_rate, 0);
+    // NOTE: NVIDIA GPUs run warps of 32 threads, and AMD GPUs run wavefronts
+    // of either 32 or 64 threads.
+    EXPECT_TRUE(perf_info.warp_size == 32 || perf_info.warp_size == 64);
+    EXPECT_GT(perf_info.total_memory_bytes, 0);
+    EXPECT_LE(perf_info.free_memory_bytes, perf_info.total_memory_bytes);
+  }
+}
+
+TEST(GpuDevicePerfInfoTest, GetWarpSize) {
+  int device_id = 0;
+  GPU_MUST_SUCCESS(gpuGetDevice(&device_id), "");
+  std::vector<GpuDevicePerfInfo> perf_infos = GetGpuDevicePerfInfos();
+  ASSERT_LT(static_cast<size_t>(device_id), perf_infos.size());
+  EXPECT_EQ(GetWarpSize(), perf_infos[device_id].warp_size);
+#if TACHYON_CUDA
+  EXPECT_EQ(GetWarpSize(), kDefaultWarpSize);
+#endif
+}
+
+}  // namespace tachyon::device::gpu
@@ -3,11 +3,17 @@
 
 #if TACHYON_CUDA
 #include "third_party/gpus/cuda/include/cuda_runtime_api.h"
-#endif  // TACHYON_CUDA
+#elif TACHYON_USE_ROCM
+#include "rocm/include/hip/hip_runtime_api.h"
+#endif
 
 // clang-format off
 #if TACHYON_CUDA
 #define gpuSuccess cudaSuccess
+#define gpuErrorMemoryAllocation cudaErrorMemoryAllocation
+
+// cudaFuncCache
+#define gpuFuncCachePreferL1 cudaFuncCachePreferL1
 
 // cudaMemAllocationHandleType
 #define gpuMemAllocationTypeInvalid cudaMemAllocationTypeInvalid
@@ -34,8 +40,23 @@
 #define gpuMemPoolAttrUsedMemCurrent cudaMemPoolAttrUsedMemCurrent
 #define gpuMemPoolAttrUsedMemHigh cudaMemPoolAttrUsedMemHigh
 
+// cudaGraphInstantiateFlags
+#define gpuGraphInstantiateFlagAutoFreeOnLaunch cudaGraphInstantiateFlagAutoFreeOnLaunch
+
+// cudaStreamCaptureMode
+#define gpuStreamCaptureModeGlobal cudaStreamCaptureModeGlobal
+#define gpuStreamCaptureModeThreadLocal cudaStreamCaptureModeThreadLocal
+#define gpuStreamCaptureModeRelaxed cudaStreamCaptureModeRelaxed
+
+// cudaStream flags
+#define gpuStreamNonBlocking cudaStreamNonBlocking
+
 #elif TACHYON_USE_ROCM
 #define gpuSuccess hipSuccess
+#define gpuErrorMemoryAllocation hipErrorOutOfMemory
+
+// hipFuncCache_t
+#define gpuFuncCachePreferL1 hipFuncCachePreferL1
 
 // hipMemAllocationHandleType
 #define gpuMemAllocationTypeInvalid hipMemAllocationTypeInvalid
@@ -61,6 +82,17 @@
 #define gpuMemPoolAttrReservedMemHigh hipMemPoolAttrReservedMemHigh
 #define gpuMemPoolAttrUsedMemCurrent hipMemPoolAttrUsedMemCurrent
 #define gpuMemPoolAttrUsedMemHigh hipMemPoolAttrUsedMemHigh
+
+// hipGraphInstantiateFlags
+#define gpuGraphInstantiateFlagAutoFreeOnLaunch hipGraphInstantiateFlagAutoFreeOnLaunch
+
+// hipStreamCaptureMode
+#define gpuStreamCaptureModeGlobal hipStreamCaptureModeGlobal
+#define gpuStreamCaptureModeThreadLocal hipStreamCaptureModeThreadLocal
+#define gpuStreamCaptureModeRelaxed hipStreamCaptureModeRelaxed
+
+// hipStream flags
+#define gpuStreamNonBlocking hipStreamNonBlocking
 #endif
 // clang-format on
 
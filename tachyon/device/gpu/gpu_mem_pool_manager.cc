@@ -0,0 +1,143 @@
+#include "tachyon/device/gpu/gpu_mem_pool_manager.h"
+
+#include <string>
+#include <utility>
+
+#include "tachyon/base/metrics/metrics_registry.h"
+#include "tachyon/device/gpu/gpu_enums.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+
+namespace tachyon::device::gpu {
+
+namespace {
+
+bool GetAttribute(gpuMemPool_t mem_pool, gpuMemPoolAttr attr,
+                  uint64_t* value) {
+  return LOG_IF_GPU_ERROR(gpuMemPoolGetAttribute(mem_pool, attr, value),
+                          "Failed to gpuMemPoolGetAttribute()") == gpuSuccess;
+}
+
+bool SetAttribute(gpuMemPool_t mem_pool, gpuMemPoolAttr attr,
+                  uint64_t value) {
+  return LOG_IF_GPU_ERROR(gpuMemPoolSetAttribute(mem_pool, attr, &value),
+                          "Failed to gpuMemPoolSetAttribute()") == gpuSuccess;
+}
+
+// Samples the stats of the pool of |device_id| into the gauges of
+// |base::MetricsRegistry| whenever the metrics are exported.
+void AddMetricsCollector(int device_id) {
+  base::MetricsRegistry& registry = base::MetricsRegistry::GetInstance();
+  base::MetricsRegistry::Labels labels = {
+      {"device", std::to_string(device_id)}};
+  base::Gauge* reserved_bytes = registry.GetGauge(
+      "tachyon_gpu_mem_pool_reserved_bytes",
+      "The bytes the GPU memory pool holds from the device.", labels);
+  base::Gauge* peak_reserved_bytes = registry.GetGauge(
+      "tachyon_gpu_mem_pool_peak_reserved_bytes",
+      "The peak bytes the GPU memory pool held from the device.", labels);
+  base::Gauge* used_bytes = registry.GetGauge(
+      "tachyon_gpu_mem_pool_used_bytes",
+      "The bytes allocated from the GPU memory pool.", labels);
+  base::Gauge* peak_used_bytes = registry.GetGauge(
+      "tachyon_gpu_mem_pool_peak_used_bytes",
+      "The peak bytes allocated from the GPU memory pool.", labels);
+  registry.AddCollector([device_id, reserved_bytes, peak_reserved_bytes,
+                         used_bytes, peak_used_bytes]() {
+    GpuMemPoolManager::Stats stats;
+    if (!GpuMemPoolManager::GetInstance().GetStats(device_id, &stats)) return;
+    reserved_bytes->Set(stats.reserved_bytes);
+    peak_reserved_bytes->Set(stats.peak_reserved_bytes);
+    used_bytes->Set(stats.used_bytes);
+    peak_used_bytes->Set(stats.peak_used_bytes);
+  });
+}
+
+}  // namespace
+
+// static
+GpuMemPoolManager& GpuMemPoolManager::GetInstance() {
+  static base::NoDestructor<GpuMemPoolManager> manager;
+  return *manager;
+}
+
+gpuMemPool_t GpuMemPoolManager::GetMemPool(int device_id) {
+  absl::MutexLock lock(&lock_);
+  Device* device = GetOrCreateDevice(device_id);
+  return device ? device->mem_pool.get() : nullptr;
+}
+
+gpuStream_t GpuMemPoolManager::GetStream(int device_id, size_t index) {
+  absl::MutexLock lock(&lock_);
+  Device* device = GetOrCreateDevice(device_id);
+  if (!device) return nullptr;
+  if (index < device->streams.size()) return device->streams[index].get();
+
+  // NOTE: A stream belongs to the device that is current when it is created.
+  int current_device = 0;
+  if (LOG_IF_GPU_ERROR(gpuGetDevice(&current_device),
+                       "Failed to gpuGetDevice()") != gpuSuccess ||
+      LOG_IF_GPU_ERROR(gpuSetDevice(device_id), "Failed to gpuSetDevice()") !=
+          gpuSuccess) {
+    return nullptr;
+  }
+  while (device->streams.size() <= index) {
+    device->streams.push_back(CreateStream());
+  }
+  GPU_MUST_SUCCESS(gpuSetDevice(current_device), "Failed to gpuSetDevice()");
+  return device->streams[index].get();
+}
+
+bool GpuMemPoolManager::SetReleaseThreshold(int device_id,
+                                            uint64_t threshold) {
+  absl::MutexLock lock(&lock_);
+  Device* device = GetOrCreateDevice(device_id);
+  if (!device) return false;
+  return SetAttribute(device->mem_pool.get(), gpuMemPoolAttrReleaseThreshold,
+                      threshold);
+}
+
+bool GpuMemPoolManager::GetStats(int device_id, Stats* stats) {
+  absl::MutexLock lock(&lock_);
+  Device* device = GetOrCreateDevice(device_id);
+  if (!device) return false;
+  gpuMemPool_t mem_pool = device->mem_pool.get();
+  return GetAttribute(mem_pool, gpuMemPoolAttrReservedMemCurrent,
+                      &stats->reserved_bytes) &&
+         GetAttribute(mem_pool, gpuMemPoolAttrReservedMemHigh,
+                      &stats->peak_reserved_bytes) &&
+         GetAttribute(mem_pool, gpuMemPoolAttrUsedMemCurrent,
+                      &stats->used_bytes) &&
+         GetAttribute(mem_pool, gpuMemPoolAttrUsedMemHigh,
+                      &stats->peak_used_bytes);
+}
+
+bool GpuMemPoolManager::ResetPeakStats(int device_id) {
+  absl::MutexLock lock(&lock_);
+  Device* device = GetOrCreateDevice(device_id);
+  if (!device) return false;
+  // NOTE: The peaks can only be reset to 0, which the pool replaces with the
+  // current values.
+  gpuMemPool_t mem_pool = device->mem_pool.get();
+  return SetAttribute(mem_pool, gpuMemPoolAttrReservedMemHigh, 0) &&
+         SetAttribute(mem_pool, gpuMemPoolAttrUsedMemHigh, 0);
+}
+
+GpuMemPoolManager::Device* GpuMemPoolManager::GetOrCreateDevice(
+    int device_id) {
+  auto it = devices_.find(device_id);
+  if (it != devices_.end()) return &it->second;
+
+  gpuMemPoolProps props = {gpuMemAllocationTypePinned,
+                           gpuMemHandleTypeNone,
+                           {gpuMemLocationTypeDevice, device_id}};
+  Device device;
+  device.mem_pool = CreateMemPool(&props);
+  if (!SetAttribute(device.mem_pool.get(), gpuMemPoolAttrReleaseThreshold,
+                    kDefaultReleaseThreshold)) {
+    return nullptr;
+  }
+  AddMetricsCollector(device_id);
+  return &devices_.emplace(device_id, std::move(device)).first->second;
+}
+
+}  // namespace tachyon::device::gpu
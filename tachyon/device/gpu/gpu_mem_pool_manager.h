@@ -0,0 +1,88 @@
+#ifndef TACHYON_DEVICE_GPU_GPU_MEM_POOL_MANAGER_H_
+#define TACHYON_DEVICE_GPU_GPU_MEM_POOL_MANAGER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <limits>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/device/gpu/gpu_device_functions.h"
+#include "tachyon/device/gpu/scoped_mem_pool.h"
+#include "tachyon/device/gpu/scoped_stream.h"
+#include "tachyon/export.h"
+
+namespace tachyon::device::gpu {
+
+// |GpuMemPoolManager| owns a stream-ordered memory pool and the streams to
+// allocate from it for each device, which are shared by the whole process.
+// The pool keeps the freed memory up to its release threshold, so the GPU
+// workloads that interleave, e.g., the MSMs, the NTTs and the hashes, reuse
+// the memory of each other instead of growing and shrinking their own pools.
+//
+// NOTE: The memory freed on a stream is reused by the other streams only
+// after the free has completed, which the pool tracks by itself.
+class TACHYON_EXPORT GpuMemPoolManager {
+ public:
+  // By default, the pool never releases the freed memory to the device.
+  constexpr static uint64_t kDefaultReleaseThreshold =
+      std::numeric_limits<uint64_t>::max();
+
+  struct Stats {
+    // The bytes the pool holds from the device, including the freed ones
+    // that are not released yet.
+    uint64_t reserved_bytes = 0;
+    uint64_t peak_reserved_bytes = 0;
+    // The bytes allocated from the pool that are not freed yet.
+    uint64_t used_bytes = 0;
+    uint64_t peak_used_bytes = 0;
+  };
+
+  static GpuMemPoolManager& GetInstance();
+
+  GpuMemPoolManager(const GpuMemPoolManager& other) = delete;
+  GpuMemPoolManager& operator=(const GpuMemPoolManager& other) = delete;
+
+  // Returns the pool of |device_id|, which is created on the first call with
+  // |kDefaultReleaseThreshold|. Returns nullptr if it fails to create one.
+  gpuMemPool_t GetMemPool(int device_id);
+
+  // Returns the |index|-th stream of |device_id|, which is created on the
+  // first call. Returns nullptr if it fails to create one.
+  gpuStream_t GetStream(int device_id, size_t index = 0);
+
+  // Sets the bytes of the freed memory that the pool of |device_id| keeps
+  // instead of releasing to the device at the synchronizations.
+  [[nodiscard]] bool SetReleaseThreshold(int device_id, uint64_t threshold);
+
+  [[nodiscard]] bool GetStats(int device_id, Stats* stats);
+
+  // Resets the peaks of the stats of |device_id| to the current values.
+  [[nodiscard]] bool ResetPeakStats(int device_id);
+
+ private:
+  friend class base::NoDestructor<GpuMemPoolManager>;
+
+  struct Device {
+    ScopedMemPool mem_pool;
+    std::vector<ScopedStream> streams;
+  };
+
+  GpuMemPoolManager() = default;
+
+  // Returns the |Device| of |device_id| whose pool is created, or nullptr if
+  // it fails to create the pool.
+  Device* GetOrCreateDevice(int device_id) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  absl::Mutex lock_;
+  absl::flat_hash_map<int, Device> devices_ ABSL_GUARDED_BY(lock_);
+};
+
+}  // namespace tachyon::device::gpu
+
+#endif  // TACHYON_DEVICE_GPU_GPU_MEM_POOL_MANAGER_H_
@@ -0,0 +1,59 @@
+#include "tachyon/device/gpu/gpu_mem_pool_manager.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/device/gpu/gpu_memory.h"
+
+namespace tachyon::device::gpu {
+
+TEST(GpuMemPoolManagerTest, Share) {
+  GpuMemPoolManager& manager = GpuMemPoolManager::GetInstance();
+  gpuMemPool_t mem_pool = manager.GetMemPool(0);
+  ASSERT_NE(mem_pool, nullptr);
+  EXPECT_EQ(manager.GetMemPool(0), mem_pool);
+
+  gpuStream_t stream = manager.GetStream(0);
+  ASSERT_NE(stream, nullptr);
+  EXPECT_EQ(manager.GetStream(0), stream);
+  gpuStream_t stream2 = manager.GetStream(0, 2);
+  ASSERT_NE(stream2, nullptr);
+  EXPECT_NE(stream2, stream);
+  EXPECT_EQ(manager.GetStream(0, 2), stream2);
+}
+
+TEST(GpuMemPoolManagerTest, Stats) {
+  GpuMemPoolManager& manager = GpuMemPoolManager::GetInstance();
+  gpuMemPool_t mem_pool = manager.GetMemPool(0);
+  gpuStream_t stream = manager.GetStream(0);
+  ASSERT_TRUE(manager.ResetPeakStats(0));
+
+  constexpr size_t kSize = size_t{1} << 20;
+  GpuMemPoolManager::Stats stats;
+  {
+    GpuMemory<uint8_t> memory =
+        GpuMemory<uint8_t>::MallocFromPoolAsync(kSize, mem_pool, stream);
+    GPU_MUST_SUCCESS(gpuStreamSynchronize(stream), "");
+    ASSERT_TRUE(manager.GetStats(0, &stats));
+    EXPECT_GE(stats.used_bytes, kSize);
+    EXPECT_GE(stats.reserved_bytes, stats.used_bytes);
+  }
+  GPU_MUST_SUCCESS(gpuStreamSynchronize(stream), "");
+  ASSERT_TRUE(manager.GetStats(0, &stats));
+  EXPECT_EQ(stats.used_bytes, 0);
+  EXPECT_GE(stats.peak_used_bytes, kSize);
+  // NOTE: The freed memory is kept by |kDefaultReleaseThreshold|.
+  EXPECT_GE(stats.reserved_bytes, kSize);
+
+  ASSERT_TRUE(manager.SetReleaseThreshold(0, 0));
+  {
+    GpuMemory<uint8_t> memory =
+        GpuMemory<uint8_t>::MallocFromPoolAsync(kSize, mem_pool, stream);
+  }
+  GPU_MUST_SUCCESS(gpuStreamSynchronize(stream), "");
+  ASSERT_TRUE(manager.GetStats(0, &stats));
+  EXPECT_EQ(stats.reserved_bytes, 0);
+  ASSERT_TRUE(manager.SetReleaseThreshold(
+      0, GpuMemPoolManager::kDefaultReleaseThreshold));
+}
+
+}  // namespace tachyon::device::gpu
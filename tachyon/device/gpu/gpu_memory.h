@@ -9,6 +9,7 @@
 
 #include "tachyon/base/numerics/checked_math.h"
 #include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/pinned_host_buffer_pool.h"
 #include "tachyon/export.h"
 
 namespace tachyon::device::gpu {
@@ -230,6 +231,17 @@ class GpuMemory {
     return true;
   }
 
+  // Copies to the pageable host memory |dst| on |stream| through
+  // |PinnedHostBufferPool::GetDefault()|. It returns once |dst| is written.
+  // NOTE: This should be the device memory.
+  bool CopyToPageable(void* dst, gpuStream_t stream = nullptr, size_t from = 0,
+                      size_t len = 0) const {
+    COMPUTE_FROM_AND_LEN(from, len);
+    DCHECK_EQ(memory_type_, GpuMemoryType::kDevice);
+    return PinnedHostBufferPool::GetDefault().CopyFromDevice(
+        dst, ptr_ + from, sizeof(T) * len, stream);
+  }
+
   template <typename U>
   bool CopyTo(const GpuMemory<U>& dst_memory, size_t from = 0, size_t len = 0) {
     return CopyTo(dst_memory.get(), dst_memory.memory_type(), from, len);
@@ -269,6 +281,17 @@ class GpuMemory {
     return true;
   }
 
+  // Copies from the pageable host memory |src| on |stream| through
+  // |PinnedHostBufferPool::GetDefault()|. It returns once |src| can be reused.
+  // NOTE: This should be the device memory.
+  bool CopyFromPageableAsync(const void* src, gpuStream_t stream = nullptr,
+                             size_t from = 0, size_t len = 0) {
+    COMPUTE_FROM_AND_LEN(from, len);
+    DCHECK_EQ(memory_type_, GpuMemoryType::kDevice);
+    return PinnedHostBufferPool::GetDefault().CopyToDeviceAsync(
+        ptr_ + from, src, sizeof(T) * len, stream);
+  }
+
   template <typename U>
   bool CopyFrom(const GpuMemory<U>& src_memory, size_t from = 0,
                 size_t len = 0) {
@@ -312,6 +335,15 @@ class GpuMemory {
     return CopyToAsync(ret->data(), GpuMemoryType::kHost, stream, from, len);
   }
 
+  // Same as |ToStdVector()|, but through |PinnedHostBufferPool::GetDefault()|.
+  template <typename R = T>
+  bool ToStdVectorPageable(std::vector<R>* ret, gpuStream_t stream = nullptr,
+                           size_t from = 0, size_t len = 0) const {
+    COMPUTE_LEN(from, len);
+    ret->resize(len);
+    return CopyToPageable(ret->data(), stream, from, len);
+  }
+
   template <typename R = T>
   absl::Span<R> ToSpan(size_t from = 0, size_t len = 0) const {
     COMPUTE_FROM_AND_LEN(from, len);
@@ -1,12 +1,15 @@
 #include "tachyon/device/gpu/gpu_memory.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/random.h"
+#include "tachyon/device/gpu/pinned_host_buffer_pool.h"
 #include "tachyon/device/gpu/scoped_mem_pool.h"
+#include "tachyon/device/gpu/scoped_stream.h"
 
 namespace tachyon::device::gpu {
 
@@ -104,4 +107,36 @@ TEST(GpuMemoryTest, CopyFrom) {
 #endif  // TACHYON_CUDA
 }
 
+TEST(GpuMemoryTest, CopyPageable) {
+  auto memory = GpuMemory<int>::Malloc(512);
+  std::vector<int> host_memory = base::CreateVector(
+      512, []() { return base::Uniform(base::Range<int>::From(0)); });
+  ASSERT_TRUE(memory.CopyFromPageableAsync(host_memory.data()));
+  std::vector<int> result;
+  ASSERT_TRUE(memory.ToStdVectorPageable(&result));
+  EXPECT_EQ(result, host_memory);
+}
+
+TEST(PinnedHostBufferPoolTest, Chunks) {
+  // NOTE: The chunks split the elements to check the boundaries.
+  PinnedHostBufferPool pool(/*chunk_size=*/1001);
+  ScopedStream stream = CreateStream();
+  // Covers a single chunk and many chunks.
+  for (size_t size : {100, 4096}) {
+    auto memory = GpuMemory<int>::Malloc(size);
+    std::vector<int> host_memory = base::CreateVector(
+        size, []() { return base::Uniform(base::Range<int>::From(0)); });
+    ASSERT_TRUE(pool.CopyToDeviceAsync(memory.get(), host_memory.data(),
+                                       sizeof(int) * size, stream.get()));
+    // The source can be reused once it is staged.
+    std::vector<int> expected = host_memory;
+    std::fill(host_memory.begin(), host_memory.end(), 0);
+
+    std::vector<int> result(size);
+    ASSERT_TRUE(pool.CopyFromDevice(result.data(), memory.get(),
+                                    sizeof(int) * size, stream.get()));
+    EXPECT_EQ(result, expected);
+  }
+}
+
 }  // namespace tachyon::device::gpu
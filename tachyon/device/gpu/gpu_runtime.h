@@ -0,0 +1,15 @@
+#ifndef TACHYON_DEVICE_GPU_GPU_RUNTIME_H_
+#define TACHYON_DEVICE_GPU_GPU_RUNTIME_H_
+
+// Includes the runtime of the configured GPU platform, which declares the
+// kernel qualifiers, e.g., __global__ and __device__, the built-in variables,
+// e.g., threadIdx and warpSize, and the device intrinsics. The kernel headers
+// should include this instead of the CUDA or the HIP one directly so that
+// they are built on both platforms.
+#if TACHYON_USE_ROCM
+#include "rocm/include/hip/hip_runtime.h"
+#elif TACHYON_CUDA
+#include "third_party/gpus/cuda/include/cuda_runtime.h"
+#endif
+
+#endif  // TACHYON_DEVICE_GPU_GPU_RUNTIME_H_
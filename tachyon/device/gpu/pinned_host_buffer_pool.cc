@@ -0,0 +1,139 @@
+#include "tachyon/device/gpu/pinned_host_buffer_pool.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/device/gpu/gpu_enums.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+
+namespace tachyon::device::gpu {
+
+// static
+PinnedHostBufferPool& PinnedHostBufferPool::GetDefault() {
+  static base::NoDestructor<PinnedHostBufferPool> pool;
+  return *pool;
+}
+
+PinnedHostBufferPool::PinnedHostBufferPool(size_t chunk_size)
+    : chunk_size_(chunk_size) {
+  CHECK_GT(chunk_size_, size_t{0});
+}
+
+PinnedHostBufferPool::~PinnedHostBufferPool() {
+  absl::MutexLock lock(&lock_);
+  for (std::unique_ptr<Buffer>& buffer : free_buffers_) {
+    GPU_MUST_SUCCESS(gpuEventSynchronize(buffer->event.get()),
+                     "Failed to gpuEventSynchronize()");
+    GpuFreeMemory(nullptr, buffer->ptr, GpuMemoryType::kHost);
+  }
+}
+
+bool PinnedHostBufferPool::CopyToDeviceAsync(void* dst, const void* src,
+                                             size_t size, gpuStream_t stream) {
+  Buffers buffers;
+  if (!AcquireBuffers(&buffers)) return false;
+
+  bool ret = true;
+  for (size_t offset = 0, i = 0; offset < size; offset += chunk_size_, ++i) {
+    size_t len = std::min(chunk_size_, size - offset);
+    Buffer& buffer = *buffers[i % 2];
+    if (LOG_IF_GPU_ERROR(gpuEventSynchronize(buffer.event.get()),
+                         "Failed to gpuEventSynchronize()") != gpuSuccess) {
+      ret = false;
+      break;
+    }
+    memcpy(buffer.ptr, static_cast<const char*>(src) + offset, len);
+    if (LOG_IF_GPU_ERROR(
+            GpuMemcpyAsync(static_cast<char*>(dst) + offset, buffer.ptr, len,
+                           gpuMemcpyHostToDevice, stream),
+            "Failed to GpuMemcpyAsync()") != gpuSuccess ||
+        LOG_IF_GPU_ERROR(gpuEventRecord(buffer.event.get(), stream),
+                         "Failed to gpuEventRecord()") != gpuSuccess) {
+      ret = false;
+      break;
+    }
+  }
+  ReleaseBuffers(std::move(buffers));
+  return ret;
+}
+
+bool PinnedHostBufferPool::CopyFromDevice(void* dst, const void* src,
+                                          size_t size, gpuStream_t stream) {
+  Buffers buffers;
+  if (!AcquireBuffers(&buffers)) return false;
+
+  // Enqueues the transfer of the |i|-th chunk to its buffer.
+  auto enqueue = [&](size_t i) {
+    size_t offset = i * chunk_size_;
+    size_t len = std::min(chunk_size_, size - offset);
+    Buffer& buffer = *buffers[i % 2];
+    // NOTE: The buffer may still be read by the transfer of another copy.
+    return LOG_IF_GPU_ERROR(gpuEventSynchronize(buffer.event.get()),
+                            "Failed to gpuEventSynchronize()") == gpuSuccess &&
+           LOG_IF_GPU_ERROR(
+               GpuMemcpyAsync(buffer.ptr,
+                              static_cast<const char*>(src) + offset, len,
+                              gpuMemcpyDeviceToHost, stream),
+               "Failed to GpuMemcpyAsync()") == gpuSuccess &&
+           LOG_IF_GPU_ERROR(gpuEventRecord(buffer.event.get(), stream),
+                            "Failed to gpuEventRecord()") == gpuSuccess;
+  };
+
+  size_t num_chunks = (size + chunk_size_ - 1) / chunk_size_;
+  bool ret = num_chunks == 0 || enqueue(0);
+  for (size_t i = 0; ret && i < num_chunks; ++i) {
+    // The next chunk is transferred while the current one is unstaged.
+    if (i + 1 < num_chunks && !enqueue(i + 1)) {
+      ret = false;
+      break;
+    }
+    Buffer& buffer = *buffers[i % 2];
+    if (LOG_IF_GPU_ERROR(gpuEventSynchronize(buffer.event.get()),
+                         "Failed to gpuEventSynchronize()") != gpuSuccess) {
+      ret = false;
+      break;
+    }
+    size_t offset = i * chunk_size_;
+    memcpy(static_cast<char*>(dst) + offset, buffer.ptr,
+           std::min(chunk_size_, size - offset));
+  }
+  ReleaseBuffers(std::move(buffers));
+  return ret;
+}
+
+bool PinnedHostBufferPool::AcquireBuffers(Buffers* buffers) {
+  {
+    absl::MutexLock lock(&lock_);
+    for (std::unique_ptr<Buffer>& buffer : *buffers) {
+      if (free_buffers_.empty()) break;
+      buffer = std::move(free_buffers_.back());
+      free_buffers_.pop_back();
+    }
+  }
+  for (std::unique_ptr<Buffer>& buffer : *buffers) {
+    if (buffer) continue;
+    void* ptr = nullptr;
+    if (LOG_IF_GPU_ERROR(GpuMallocHost(&ptr, chunk_size_),
+                         "Failed to GpuMallocHost()") != gpuSuccess) {
+      ReleaseBuffers(std::move(*buffers));
+      return false;
+    }
+    buffer = std::make_unique<Buffer>();
+    buffer->ptr = ptr;
+    buffer->event = CreateEventWithFlags(gpuEventDisableTiming);
+  }
+  return true;
+}
+
+void PinnedHostBufferPool::ReleaseBuffers(Buffers buffers) {
+  absl::MutexLock lock(&lock_);
+  for (std::unique_ptr<Buffer>& buffer : buffers) {
+    if (buffer) free_buffers_.push_back(std::move(buffer));
+  }
+}
+
+}  // namespace tachyon::device::gpu
@@ -0,0 +1,75 @@
+#ifndef TACHYON_DEVICE_GPU_PINNED_HOST_BUFFER_POOL_H_
+#define TACHYON_DEVICE_GPU_PINNED_HOST_BUFFER_POOL_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/device/gpu/gpu_device_functions.h"
+#include "tachyon/device/gpu/scoped_event.h"
+#include "tachyon/export.h"
+
+namespace tachyon::device::gpu {
+
+// |PinnedHostBufferPool| keeps the pinned host buffers to stage the copies
+// between the pageable host memory, e.g., |std::vector<T>|, and the device.
+// The driver copies from the pageable memory at about half the bandwidth of
+// the pinned one and blocks the host until it is done, whereas the copies
+// here are split into chunks so that staging a chunk on the host overlaps the
+// transfer of the previous one.
+class TACHYON_EXPORT PinnedHostBufferPool {
+ public:
+  constexpr static size_t kDefaultChunkSize = size_t{8} << 20;  // 8 MiB
+
+  // Returns the pool shared by the whole process.
+  static PinnedHostBufferPool& GetDefault();
+
+  explicit PinnedHostBufferPool(size_t chunk_size = kDefaultChunkSize);
+  PinnedHostBufferPool(const PinnedHostBufferPool& other) = delete;
+  PinnedHostBufferPool& operator=(const PinnedHostBufferPool& other) = delete;
+  ~PinnedHostBufferPool();
+
+  size_t chunk_size() const { return chunk_size_; }
+
+  // Copies |size| bytes from the pageable host memory |src| to the device
+  // memory |dst| on |stream|. It returns once |src| is staged, so that it can
+  // be reused, while the transfers may still be running on |stream|.
+  [[nodiscard]] bool CopyToDeviceAsync(void* dst, const void* src, size_t size,
+                                       gpuStream_t stream = nullptr);
+
+  // Copies |size| bytes from the device memory |src| to the pageable host
+  // memory |dst| on |stream|. It returns once |dst| is written.
+  [[nodiscard]] bool CopyFromDevice(void* dst, const void* src, size_t size,
+                                    gpuStream_t stream = nullptr);
+
+ private:
+  friend class base::NoDestructor<PinnedHostBufferPool>;
+
+  struct Buffer {
+    void* ptr = nullptr;
+    // Recorded after the last transfer from or to |ptr|, which should be
+    // waited for before |ptr| is written again.
+    ScopedEvent event;
+  };
+
+  // NOTE: A copy holds two buffers, one being transferred and the other being
+  // staged, and they are returned to the pool with their transfers running.
+  using Buffers = std::array<std::unique_ptr<Buffer>, 2>;
+
+  [[nodiscard]] bool AcquireBuffers(Buffers* buffers);
+  void ReleaseBuffers(Buffers buffers);
+
+  const size_t chunk_size_;
+  absl::Mutex lock_;
+  std::vector<std::unique_ptr<Buffer>> free_buffers_ ABSL_GUARDED_BY(lock_);
+};
+
+}  // namespace tachyon::device::gpu
+
+#endif  // TACHYON_DEVICE_GPU_PINNED_HOST_BUFFER_POOL_H_
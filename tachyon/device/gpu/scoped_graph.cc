@@ -0,0 +1,49 @@
+#include "tachyon/device/gpu/scoped_graph.h"
+
+namespace tachyon::device::gpu {
+
+ScopedGraph EndCapture(gpuStream_t stream) {
+  gpuGraph_t graph = nullptr;
+  if (LOG_IF_GPU_ERROR(gpuStreamEndCapture(stream, &graph),
+                       "Failed to gpuStreamEndCapture()") != gpuSuccess) {
+    return ScopedGraph();
+  }
+  return ScopedGraph(graph);
+}
+
+ScopedGraphExec InstantiateGraph(gpuGraph_t graph) {
+  gpuGraphExec_t graph_exec = nullptr;
+  if (LOG_IF_GPU_ERROR(
+          gpuGraphInstantiateWithFlags(
+              &graph_exec, graph, gpuGraphInstantiateFlagAutoFreeOnLaunch),
+          "Failed to gpuGraphInstantiateWithFlags()") != gpuSuccess) {
+    return ScopedGraphExec();
+  }
+  return ScopedGraphExec(graph_exec);
+}
+
+bool UpdateGraphExec(gpuGraphExec_t graph_exec, gpuGraph_t graph) {
+#if TACHYON_CUDA && CUDA_VERSION >= 12000  // CUDA 12.0
+  cudaGraphExecUpdateResultInfo result_info;
+  gpuError_t error = gpuGraphExecUpdate(graph_exec, graph, &result_info);
+#elif TACHYON_CUDA
+  cudaGraphNode_t error_node = nullptr;
+  cudaGraphExecUpdateResult result;
+  gpuError_t error =
+      gpuGraphExecUpdate(graph_exec, graph, &error_node, &result);
+#elif TACHYON_USE_ROCM
+  hipGraphNode_t error_node = nullptr;
+  hipGraphExecUpdateResult result;
+  gpuError_t error =
+      gpuGraphExecUpdate(graph_exec, graph, &error_node, &result);
+#endif
+  if (error != gpuSuccess) {
+    // NOTE: A failed update is expected when the topology has changed, so it
+    // is not logged, but cleared not to be caught by the next launch.
+    gpuGetLastError();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tachyon::device::gpu
@@ -0,0 +1,47 @@
+#ifndef TACHYON_DEVICE_GPU_SCOPED_GRAPH_H_
+#define TACHYON_DEVICE_GPU_SCOPED_GRAPH_H_
+
+#include <memory>
+#include <type_traits>
+
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/export.h"
+
+namespace tachyon::device::gpu {
+
+struct TACHYON_EXPORT GraphDestroyer {
+  void operator()(gpuGraph_t graph) const {
+    GPU_MUST_SUCCESS(gpuGraphDestroy(graph), "Failed to gpuGraphDestroy()");
+  }
+};
+
+struct TACHYON_EXPORT GraphExecDestroyer {
+  void operator()(gpuGraphExec_t graph_exec) const {
+    GPU_MUST_SUCCESS(gpuGraphExecDestroy(graph_exec),
+                     "Failed to gpuGraphExecDestroy()");
+  }
+};
+
+using ScopedGraph =
+    std::unique_ptr<std::remove_pointer_t<gpuGraph_t>, GraphDestroyer>;
+using ScopedGraphExec =
+    std::unique_ptr<std::remove_pointer_t<gpuGraphExec_t>, GraphExecDestroyer>;
+
+// Ends the capture on |stream| begun by |gpuStreamBeginCapture()| and returns
+// the captured graph, or nullptr if the capture has failed.
+TACHYON_EXPORT ScopedGraph EndCapture(gpuStream_t stream);
+
+// Returns the executable of |graph|, or nullptr if it fails to instantiate.
+// The allocations that |graph| leaves unfreed are freed before the next launch.
+TACHYON_EXPORT ScopedGraphExec InstantiateGraph(gpuGraph_t graph);
+
+// Updates |graph_exec| in place to run |graph|, which is cheaper than
+// instantiating |graph| again. It only succeeds if |graph| has the same
+// topology as the graph |graph_exec| was instantiated from, e.g., when only the
+// pointers that the kernels take differ.
+[[nodiscard]] TACHYON_EXPORT bool UpdateGraphExec(gpuGraphExec_t graph_exec,
+                                                  gpuGraph_t graph);
+
+}  // namespace tachyon::device::gpu
+
+#endif  // TACHYON_DEVICE_GPU_SCOPED_GRAPH_H_
@@ -6,6 +6,7 @@
 #include <optional>
 #include <ostream>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -13,6 +14,7 @@
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/base/types/always_false.h"
 #include "tachyon/math/base/semigroups.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
 
 namespace tachyon::math {
 namespace internal {
@@ -124,30 +126,58 @@ class MultiplicativeGroup : public MultiplicativeSemigroup<G> {
   }
 
  private:
+  // The number of interleaved chains of |DoScalarBatchInverse()|.
+  constexpr static size_t kNumBatchInverseChains = 4;
+
   [[nodiscard]] constexpr static bool DoBatchInverse(absl::Span<const G> groups,
                                                      absl::Span<G> inverses,
                                                      const G& coeff) {
+    // NOTE: |PackedFieldTraits<G>| is specialized after |G| is defined, so it
+    // must not be looked up until this is instantiated.
+    using PackedField = typename PackedFieldTraits<G>::PackedField;
+
+    if constexpr (!std::is_void_v<PackedField>) {
+      // NOTE: A single packed value, such as the lanes inverted by
+      // |PackedField::Inverse()|, stays on the scalar path.
+      if (groups.size() >= 2 * PackedField::N) {
+        return DoPackedBatchInverse<PackedField>(groups, inverses, coeff);
+      }
+    }
+    return DoScalarBatchInverse(groups, inverses, coeff);
+  }
+
+  [[nodiscard]] constexpr static bool DoScalarBatchInverse(
+      absl::Span<const G> groups, absl::Span<G> inverses, const G& coeff) {
     // Montgomery’s Trick and Fast Implementation of Masked AES
     // Genelle, Prouff and Quisquater
     // Section 3.2
     // but with an optimization to multiply every element in the returned
     // vector by |coeff|.
+    //
+    // The i-th element is accumulated into the
+    // (i % |kNumBatchInverseChains|)-th chain, so that the multiplications of
+    // different chains don't depend on each other. The products of the chains
+    // are combined by a tree, which needs only a single inversion.
 
-    // First pass: compute [a₁, a₁ * a₂, ..., a₁ * a₂ * ... * aₙ]
-    std::vector<G> productions;
-    productions.reserve(groups.size() + 1);
-    productions.push_back(G::One());
-    G product = G::One();
-    for (const G& g : groups) {
+    // First pass: compute the products of the preceding elements of the same
+    // chain, [1, ..., 1, a₁, a₂, ..., a₁ * a₅, ...]
+    std::vector<G> productions(groups.size());
+    G products[kNumBatchInverseChains] = {G::One(), G::One(), G::One(),
+                                          G::One()};
+    for (size_t i = 0; i < groups.size(); ++i) {
+      const G& g = groups[i];
       if (!g.IsZero()) {
+        G& product = products[i % kNumBatchInverseChains];
+        productions[i] = product;
         product *= g;
-        productions.push_back(product);
       }
     }
 
-    // Invert |product|.
+    // Invert the product of all the chains.
     // (a₁ * a₂ * ... *  aₙ)⁻¹
-    std::optional<G> product_inv_opt = product.Inverse();
+    G products01 = products[0] * products[1];
+    G products23 = products[2] * products[3];
+    std::optional<G> product_inv_opt = (products01 * products23).Inverse();
     if (UNLIKELY(!product_inv_opt)) {
       LOG_IF_NOT_GPU(ERROR) << "Inverse of zero attempted";
       return false;
@@ -159,25 +189,96 @@ class MultiplicativeGroup : public MultiplicativeSemigroup<G> {
     // c * (a₁ * a₂ * ... *  aₙ)⁻¹
     if (!coeff.IsOne()) product_inv *= coeff;
 
+    // Split |product_inv| into the inverses of the products of the chains by
+    // multiplying the products of the other chains.
+    G product_invs[kNumBatchInverseChains] = {
+        product_inv * products[1] * products23,
+        product_inv * products[0] * products23,
+        product_inv * products01 * products[3],
+        product_inv * products01 * products[2],
+    };
+
     // Second pass: iterate backwards to compute inverses.
     //              [c * a₁⁻¹, c * a₂,⁻¹ ..., c * aₙ⁻¹]
-    auto prod_it = productions.rbegin();
-    ++prod_it;
     for (size_t i = groups.size() - 1; i != std::numeric_limits<size_t>::max();
          --i) {
-      const G& g = groups[i];
+      // NOTE: |groups| and |inverses| may be the same, so |groups[i]| is read
+      // before |inverses[i]| is written.
+      G g = groups[i];
       if (!g.IsZero()) {
-        // c * (a₁ * a₂ * ... *  aᵢ)⁻¹ * aᵢ = c * (a₁ * a₂ * ... *  aᵢ₋₁)⁻¹
-        G new_product_inv = product_inv * g;
-        // v = c * (a₁ * a₂ * ... *  aᵢ)⁻¹ * (a₁ * a₂ * ... aᵢ₋₁) = c * aᵢ⁻¹
-        inverses[i] = product_inv * (*(prod_it++));
-        product_inv = std::move(new_product_inv);
+        G& chain_product_inv = product_invs[i % kNumBatchInverseChains];
+        // v = c * (aᵢ * ...)⁻¹ * (... aᵢ₋₄) = c * aᵢ⁻¹
+        inverses[i] = chain_product_inv * productions[i];
+        // c * (aᵢ * ...)⁻¹ * aᵢ = c * (aᵢ₊₄ * ...)⁻¹
+        chain_product_inv *= g;
       } else {
         inverses[i] = G::Zero();
       }
     }
     return true;
   }
+
+  // Same as |DoScalarBatchInverse()|, but every lane of |PackedField| runs its
+  // own chain over |PackedField::N| consecutive elements reinterpreted as a
+  // single packed value, and the lanes of the product are inverted at once
+  // by |DoScalarBatchInverse()|. The remainder that doesn't fill a packed
+  // value is inverted by |DoScalarBatchInverse()| as well.
+  template <typename PackedField>
+  [[nodiscard]] static bool DoPackedBatchInverse(absl::Span<const G> groups,
+                                                 absl::Span<G> inverses,
+                                                 const G& coeff) {
+    constexpr size_t N = PackedField::N;
+
+    // NOTE: Unlike |G|, |PackedField| has constants that must be set up
+    // before its first use.
+    [[maybe_unused]] static bool packed_field_initialized = []() {
+      PackedField::Init();
+      return true;
+    }();
+
+    size_t num_packed = groups.size() / N;
+    const PackedField* packed_groups =
+        reinterpret_cast<const PackedField*>(groups.data());
+    PackedField* packed_inverses =
+        reinterpret_cast<PackedField*>(inverses.data());
+
+    // The zeros are replaced by ones so that they don't break the chains.
+    auto replace_zeros = [](PackedField value) {
+      for (size_t i = 0; i < N; ++i) {
+        if (value[i].IsZero()) value[i] = G::One();
+      }
+      return value;
+    };
+
+    std::vector<PackedField> productions(num_packed);
+    PackedField product = PackedField::One();
+    for (size_t i = 0; i < num_packed; ++i) {
+      productions[i] = product;
+      product *= replace_zeros(packed_groups[i]);
+    }
+
+    PackedField product_inv;
+    if (UNLIKELY(!DoScalarBatchInverse(product.values(),
+                                       absl::MakeSpan(product_inv.values()),
+                                       coeff))) {
+      return false;
+    }
+
+    for (size_t i = num_packed - 1; i != std::numeric_limits<size_t>::max();
+         --i) {
+      PackedField g = packed_groups[i];
+      PackedField inverse = product_inv * productions[i];
+      for (size_t j = 0; j < N; ++j) {
+        if (g[j].IsZero()) inverse[j] = G::Zero();
+      }
+      product_inv *= replace_zeros(g);
+      packed_inverses[i] = inverse;
+    }
+
+    if (groups.size() == num_packed * N) return true;
+    return DoScalarBatchInverse(groups.subspan(num_packed * N),
+                                inverses.subspan(num_packed * N), coeff);
+  }
 };
 
 template <typename G>
@@ -1,12 +1,17 @@
 #ifndef TACHYON_MATH_BASE_RATIONAL_FIELD_H_
 #define TACHYON_MATH_BASE_RATIONAL_FIELD_H_
 
+#include <algorithm>
+#include <atomic>
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "tachyon/base/optional.h"
+#include "tachyon/base/parallelize.h"
 #include "tachyon/base/template_util.h"
+#include "tachyon/base/threading/thread_pool.h"
 #include "tachyon/math/base/field.h"
 
 namespace tachyon::math {
@@ -69,6 +74,89 @@ class RationalField : public Field<RationalField<F>> {
     return true;
   }
 
+  // Same as |BatchEvaluate()|, but evaluates every container of |inputs| into
+  // the one of |outputs| at the same index. The elements of all of them are
+  // split evenly among the threads regardless of the sizes of the containers,
+  // and each thread inverts its denominators with a single batch inversion.
+  // The denominators equal to one, which are the common case, are skipped, and
+  // their number is added to |num_skipped_inversions| if it is not null.
+  template <typename InputContainer, typename OutputContainer>
+  [[nodiscard]] static bool BatchEvaluateAll(
+      const std::vector<const InputContainer*>& inputs,
+      const std::vector<OutputContainer*>& outputs,
+      size_t* num_skipped_inversions = nullptr) {
+    static_assert(
+        std::is_same_v<base::container_value_t<InputContainer>, RationalField>);
+    static_assert(std::is_same_v<base::container_value_t<OutputContainer>, F>);
+
+    if (inputs.size() != outputs.size()) {
+      LOG(ERROR) << "Size of |inputs| and |outputs| do not match";
+      return false;
+    }
+    // |offsets[i]| is the index of the first element of |inputs[i]| among the
+    // elements of all of them.
+    std::vector<size_t> offsets(inputs.size() + 1);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      if (std::size(*inputs[i]) != std::size(*outputs[i])) {
+        LOG(ERROR) << "Size of |inputs[" << i << "]| and |outputs[" << i
+                   << "]| do not match";
+        return false;
+      }
+      offsets[i + 1] = offsets[i] + std::size(*inputs[i]);
+    }
+    size_t size = offsets.back();
+    if (size == 0) return true;
+
+    size_t num_threads = base::ThreadPool::GetCurrent().num_threads();
+    size_t chunk_size = (size + num_threads - 1) / num_threads;
+    size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    std::vector<size_t> num_skipped(num_chunks);
+    std::atomic<bool> check_valid(true);
+    base::ParallelFor(0, num_chunks, [&](size_t chunk) {
+      size_t begin = chunk * chunk_size;
+      size_t end = std::min(begin + chunk_size, size);
+      std::vector<F> denominators;
+      std::vector<F*> results;
+      denominators.reserve(end - begin);
+      results.reserve(end - begin);
+      size_t i = std::upper_bound(offsets.begin(), offsets.end(), begin) -
+                 offsets.begin() - 1;
+      for (size_t idx = begin; idx < end; ++i) {
+        const InputContainer& input = *inputs[i];
+        OutputContainer& output = *outputs[i];
+        size_t j = idx - offsets[i];
+        size_t len = std::min(offsets[i + 1], end) - idx;
+        for (size_t k = j; k < j + len; ++k) {
+          const RationalField& value = input[k];
+          output[k] = value.numerator_;
+          if (!value.denominator_.IsOne()) {
+            denominators.push_back(value.denominator_);
+            results.push_back(&output[k]);
+          }
+        }
+        idx += len;
+      }
+      num_skipped[chunk] = end - begin - denominators.size();
+      if (!F::BatchInverseInPlaceSerial(denominators)) {
+        check_valid.store(false, std::memory_order_relaxed);
+        return;
+      }
+      for (size_t k = 0; k < results.size(); ++k) {
+        *results[k] *= denominators[k];
+      }
+    });
+    if (!check_valid.load(std::memory_order_relaxed)) {
+      LOG(ERROR) << "Inverse of zero attempted";
+      return false;
+    }
+    if (num_skipped_inversions) {
+      for (size_t n : num_skipped) {
+        *num_skipped_inversions += n;
+      }
+    }
+    return true;
+  }
+
   constexpr const F& numerator() const { return numerator_; }
   constexpr const F& denominator() const { return denominator_; }
 
@@ -5,6 +5,7 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
 #include "tachyon/math/finite_fields/test/gf7.h"
 
@@ -195,4 +196,42 @@ TEST_F(RationalFieldTest, BatchEvaluate) {
   }
 }
 
+TEST_F(RationalFieldTest, BatchEvaluateAll) {
+  std::vector<std::vector<R>> inputs = {
+      base::CreateVector(37, []() { return R::Random(); }),
+      {},
+      base::CreateVector(50, [](size_t i) { return R(GF7(i % 7)); }),
+      base::CreateVector(13, []() { return R::Random(); }),
+  };
+  std::vector<std::vector<GF7>> outputs =
+      base::Map(inputs, [](const std::vector<R>& input) {
+        return std::vector<GF7>(input.size());
+      });
+  size_t expected_num_skipped_inversions = 0;
+  for (const std::vector<R>& input : inputs) {
+    for (const R& value : input) {
+      if (value.denominator().IsOne()) ++expected_num_skipped_inversions;
+    }
+  }
+
+  size_t num_skipped_inversions = 0;
+  ASSERT_TRUE(R::BatchEvaluateAll(
+      base::Map(inputs, [](const std::vector<R>& input) { return &input; }),
+      base::Map(outputs, [](std::vector<GF7>& output) { return &output; }),
+      &num_skipped_inversions));
+  EXPECT_EQ(num_skipped_inversions, expected_num_skipped_inversions);
+  EXPECT_GE(num_skipped_inversions, size_t{50});
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    for (size_t j = 0; j < inputs[i].size(); ++j) {
+      EXPECT_EQ(inputs[i][j].Evaluate(), outputs[i][j]);
+    }
+  }
+
+  std::vector<std::vector<GF7>> wrong_outputs(inputs.size());
+  EXPECT_FALSE(R::BatchEvaluateAll(
+      base::Map(inputs, [](const std::vector<R>& input) { return &input; }),
+      base::Map(wrong_outputs,
+                [](std::vector<GF7>& output) { return &output; })));
+}
+
 }  // namespace tachyon::math
@@ -6,6 +6,7 @@
 
 #include "tachyon/base/parallelize.h"
 #include "tachyon/math/base/groups.h"
+#include "tachyon/math/finite_fields/lazy_reduction_accumulator.h"
 
 namespace tachyon::math {
 
@@ -38,12 +39,12 @@ class Ring : public AdditiveGroup<R>, public MultiplicativeSemigroup<R> {
     std::vector<R> partial_sum_of_products = base::ParallelizeMap(
         a,
         [&b](absl::Span<const R> chunk, size_t chunk_idx, size_t chunk_size) {
-          R sum = R::Zero();
+          LazyReductionAccumulator<R> sum;
           size_t i = chunk_idx * chunk_size;
           for (size_t j = 0; j < chunk.size(); ++j) {
-            sum += (chunk[j] * b[i + j]);
+            sum.AddProduct(chunk[j], b[i + j]);
           }
-          return sum;
+          return sum.Reduce();
         });
     return std::accumulate(partial_sum_of_products.begin(),
                            partial_sum_of_products.end(), R::Zero(),
@@ -67,11 +68,11 @@ class Ring : public AdditiveGroup<R>, public MultiplicativeSemigroup<R> {
   constexpr static R DoSumOfProductsSerial(const ContainerA& a,
                                            const ContainerB& b) {
     size_t n = std::size(a);
-    R sum = R::Zero();
+    LazyReductionAccumulator<R> sum;
     for (size_t i = 0; i < n; ++i) {
-      sum += (a[i] * b[i]);
+      sum.AddProduct(a[i], b[i]);
     }
-    return sum;
+    return sum.Reduce();
   }
 };
 
@@ -0,0 +1,96 @@
+// Copyright 2024 StarkWare Industries Ltd
+// Use of this source code is governed by a Apache-2.0 style license that
+// can be found in the LICENSE-APACHE.stwo
+
+#ifndef TACHYON_MATH_CIRCLE_CIRCLE_COSET_H_
+#define TACHYON_MATH_CIRCLE_CIRCLE_COSET_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::math {
+
+// A coset of a subgroup of the circle group: {p + i * g | 0 ≤ i < 2ᵏ}, where
+// g generates the subgroup of order 2ᵏ. The circle group must be of order
+// 2ᴸ, which is the modulus of |ScalarField|.
+template <typename _Circle>
+class CircleCoset {
+ public:
+  using Circle = _Circle;
+  using Point = typename Circle::Point;
+  using ScalarField = typename Circle::ScalarField;
+
+  // L, where the circle group is of order 2ᴸ.
+  constexpr static uint32_t kLogOrder = ScalarField::Config::kModulusBits - 1;
+
+  CircleCoset() = default;
+  CircleCoset(const Point& initial, const Point& step, uint32_t log_size)
+      : initial_(initial), step_(step), log_size_(log_size) {}
+
+  // Returns g, which generates the subgroup of order 2ᵏ.
+  static Point GetSubgroupGenerator(uint32_t log_size) {
+    CHECK_LE(log_size, kLogOrder);
+    Point ret = Point::Generator();
+    for (uint32_t i = log_size; i < kLogOrder; ++i) {
+      ret.DoubleInPlace();
+    }
+    return ret;
+  }
+
+  // {i * g}
+  static CircleCoset Subgroup(uint32_t log_size) {
+    return {Point::Zero(), GetSubgroupGenerator(log_size), log_size};
+  }
+
+  // {g' + i * g}, where g' generates the subgroup of order 2ᵏ⁺¹.
+  static CircleCoset Odds(uint32_t log_size) {
+    return {GetSubgroupGenerator(log_size + 1), GetSubgroupGenerator(log_size),
+            log_size};
+  }
+
+  // {g' + i * g}, where g' generates the subgroup of order 2ᵏ⁺².
+  static CircleCoset HalfOdds(uint32_t log_size) {
+    return {GetSubgroupGenerator(log_size + 2), GetSubgroupGenerator(log_size),
+            log_size};
+  }
+
+  const Point& initial() const { return initial_; }
+  const Point& step() const { return step_; }
+  uint32_t log_size() const { return log_size_; }
+  size_t size() const { return size_t{1} << log_size_; }
+
+  // Returns p + i * g.
+  Point At(size_t i) const { return initial_ + step_.ScalarMul(i); }
+
+  // Returns the first |count| points in order.
+  std::vector<Point> GetPoints(size_t count) const {
+    CHECK_LE(count, size());
+    std::vector<Point> ret;
+    ret.reserve(count);
+    Point point = initial_;
+    for (size_t i = 0; i < count; ++i) {
+      ret.push_back(point);
+      point += step_;
+    }
+    return ret;
+  }
+
+  // {2p + i * 2g}, which is of size 2ᵏ⁻¹.
+  CircleCoset Double() const {
+    CHECK_GT(log_size_, 0);
+    return {initial_.Double(), step_.Double(), log_size_ - 1};
+  }
+
+ private:
+  Point initial_;
+  Point step_;
+  uint32_t log_size_ = 0;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_CIRCLE_CIRCLE_COSET_H_
@@ -0,0 +1,254 @@
+// Copyright 2024 StarkWare Industries Ltd
+// Use of this source code is governed by a Apache-2.0 style license that
+// can be found in the LICENSE-APACHE.stwo
+
+#ifndef TACHYON_MATH_CIRCLE_CIRCLE_EVALUATION_DOMAIN_H_
+#define TACHYON_MATH_CIRCLE_CIRCLE_EVALUATION_DOMAIN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/optional.h"
+#include "tachyon/math/circle/circle_coset.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
+#include "tachyon/math/finite_fields/mersenne31/packed_mersenne31.h"
+
+namespace tachyon::math {
+
+// The circle domain of size 2ⁿ is the union of a coset of size 2ⁿ⁻¹, which is
+// |half_coset()|, and its conjugate. The polynomials over the domain are
+// spanned by the basis
+//
+//   bⱼ(x, y) = yʲ⁰ * xʲ¹ * π(x)ʲ² * π²(x)ʲ³ * ... * πⁿ⁻²(x)ʲⁿ⁻¹,
+//
+// where π(x) = 2x² - 1 is the x-coordinate of doubling a point and jₖ is the
+// k-th bit of j. |CFFT()| takes the coefficients over the basis and returns
+// the evaluations in bit-reversed order, in which the points p and -p that
+// the circle FRI folds together are adjacent. See
+// https://eprint.iacr.org/2024/278.
+//
+// The first layer of the CFFT splits f(x, y) = f₀(x) + y * f₁(x) and the
+// others split g(x) = g₀(π(x)) + x * g₁(π(x)) like a radix-2 FFT, whose
+// butterflies run on the lanes of |PackedField| if the blocks are large
+// enough.
+template <typename Circle>
+class CircleEvaluationDomain {
+ public:
+  using F = typename Circle::BaseField;
+  using Point = typename Circle::Point;
+  using Coset = CircleCoset<Circle>;
+  using PackedField = typename PackedFieldTraits<F>::PackedField;
+
+  constexpr static bool kHasPackedField = !std::is_void_v<PackedField>;
+
+  // Creates the circle domain of size 2ⁿ whose half coset is
+  // |Coset::HalfOdds(n - 1)|, which is the canonic one.
+  static std::unique_ptr<CircleEvaluationDomain> Create(uint32_t log_size) {
+    CHECK_GT(log_size, 0);
+    return Create(Coset::HalfOdds(log_size - 1));
+  }
+
+  static std::unique_ptr<CircleEvaluationDomain> Create(
+      const Coset& half_coset) {
+    auto ret = absl::WrapUnique(new CircleEvaluationDomain(half_coset));
+    if constexpr (kHasPackedField) {
+      // NOTE: Unlike |F|, |PackedField| has constants that must be set up
+      // before its first use.
+      [[maybe_unused]] static bool packed_field_initialized = []() {
+        PackedField::Init();
+        return true;
+      }();
+    }
+    ret->PrepareTwiddles();
+    return ret;
+  }
+
+  const Coset& half_coset() const { return half_coset_; }
+  uint32_t log_size() const { return half_coset_.log_size() + 1; }
+  size_t size() const { return size_t{1} << log_size(); }
+
+  // Returns the i-th point in the natural order, where the points of
+  // |half_coset()| are followed by their conjugates.
+  Point GetElement(size_t i) const {
+    size_t half_size = half_coset_.size();
+    if (i < half_size) return half_coset_.At(i);
+    return half_coset_.At(i - half_size).Conjugate();
+  }
+
+  // Returns the point of the i-th evaluation of |CFFT()|.
+  Point GetBitReversedElement(size_t i) const {
+    return GetElement(BitRev(i, log_size()));
+  }
+
+  // Evaluates the polynomial whose coefficients over the basis are |coeffs|
+  // at |point|.
+  static F Evaluate(absl::Span<const F> coeffs, const Point& point) {
+    CHECK(base::bits::IsPowerOfTwo(coeffs.size()));
+    uint32_t log_size = base::bits::Log2Floor(coeffs.size());
+    // |factors[k]| is multiplied when the k-th bit of j is set.
+    std::vector<F> factors;
+    factors.reserve(log_size);
+    if (log_size > 0) factors.push_back(point.y());
+    F x = point.x();
+    for (uint32_t k = 1; k < log_size; ++k) {
+      factors.push_back(x);
+      x = x.Square().Double() - F::One();
+    }
+    std::vector<F> values(coeffs.begin(), coeffs.end());
+    for (uint32_t k = log_size; k > 0; --k) {
+      size_t half_size = size_t{1} << (k - 1);
+      for (size_t j = 0; j < half_size; ++j) {
+        values[j] += values[j + half_size] * factors[k - 1];
+      }
+    }
+    return values[0];
+  }
+
+  // Returns the evaluations in bit-reversed order of the polynomial whose
+  // coefficients over the basis are |coeffs|, which are padded with zeros up
+  // to |size()|.
+  std::vector<F> CFFT(std::vector<F> coeffs) const {
+    CHECK_LE(coeffs.size(), size());
+    coeffs.resize(size(), F::Zero());
+    absl::Span<F> values = absl::MakeSpan(coeffs);
+    for (size_t k = line_twiddles_.size(); k > 0; --k) {
+      RunLayer<false>(values, k, line_twiddles_[k - 1]);
+    }
+    RunLayer<false>(values, 0, circle_twiddles_);
+    return coeffs;
+  }
+
+  // Returns the coefficients over the basis of the polynomial whose
+  // evaluations in bit-reversed order are |evals|.
+  std::vector<F> ICFFT(std::vector<F> evals) const {
+    CHECK_EQ(evals.size(), size());
+    absl::Span<F> values = absl::MakeSpan(evals);
+    RunLayer<true>(values, 0, circle_twiddle_invs_);
+    for (size_t k = 0; k < line_twiddle_invs_.size(); ++k) {
+      RunLayer<true>(values, k + 1, line_twiddle_invs_[k]);
+    }
+    F size_inv = unwrap(F(size()).Inverse());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < evals.size(); ++i) {
+      evals[i] *= size_inv;
+    }
+    return evals;
+  }
+
+ private:
+  explicit CircleEvaluationDomain(const Coset& half_coset)
+      : half_coset_(half_coset) {}
+
+  static size_t BitRev(size_t i, uint32_t bits) {
+    if (bits == 0) return 0;
+    return base::bits::BitRev(i) >> (sizeof(size_t) * 8 - bits);
+  }
+
+  // If |Inverse| is false,
+  //   |lo| = |lo| + |hi| * |twiddle|
+  //   |hi| = |lo| - |hi| * |twiddle|
+  // Otherwise,
+  //   |lo| = |lo| + |hi|
+  //   |hi| = (|lo| - |hi|) * |twiddle|
+  template <bool Inverse, typename T>
+  static void Butterfly(T& lo, T& hi, const T& twiddle) {
+    if constexpr (Inverse) {
+      T t = lo - hi;
+      lo += hi;
+      hi = t * twiddle;
+    } else {
+      T t = hi * twiddle;
+      hi = lo - t;
+      lo += t;
+    }
+  }
+
+  // Runs the k-th layer, which pairs up the evaluations 2ᵏ apart within each
+  // block of 2ᵏ⁺¹ with the twiddle of the block.
+  template <bool Inverse>
+  static void RunLayer(absl::Span<F> values, size_t layer,
+                       absl::Span<const F> twiddles) {
+    size_t gap = size_t{1} << layer;
+    DCHECK_EQ(values.size(), twiddles.size() * 2 * gap);
+    if constexpr (kHasPackedField) {
+      constexpr size_t N = PackedField::N;
+      if (gap >= N) {
+        OPENMP_PARALLEL_FOR(size_t h = 0; h < twiddles.size(); ++h) {
+          PackedField* lo =
+              reinterpret_cast<PackedField*>(&values[(2 * h) << layer]);
+          PackedField* hi = lo + gap / N;
+          PackedField twiddle = PackedField::Broadcast(twiddles[h]);
+          for (size_t j = 0; j < gap / N; ++j) {
+            Butterfly<Inverse>(lo[j], hi[j], twiddle);
+          }
+        }
+        return;
+      }
+    }
+    OPENMP_PARALLEL_FOR(size_t h = 0; h < twiddles.size(); ++h) {
+      F* lo = &values[(2 * h) << layer];
+      F* hi = lo + gap;
+      for (size_t j = 0; j < gap; ++j) {
+        Butterfly<Inverse>(lo[j], hi[j], twiddles[h]);
+      }
+    }
+  }
+
+  void PrepareTwiddles() {
+    uint32_t half_log_size = half_coset_.log_size();
+    std::vector<Point> points = half_coset_.GetPoints(half_coset_.size());
+
+    // The h-th block of the first layer pairs up p and its conjugate, where p
+    // is the point of the (2h)-th evaluation, whose twiddle is p_y.
+    circle_twiddles_.resize(points.size());
+    for (size_t h = 0; h < points.size(); ++h) {
+      circle_twiddles_[h] = points[BitRev(h, half_log_size)].y();
+    }
+
+    // The k-th line layer pairs up x and -x over the x-coordinates of the
+    // half coset doubled k - 1 times, whose twiddle is x.
+    std::vector<F> xs = base::Map(points, [](const Point& p) { return p.x(); });
+    line_twiddles_.resize(half_log_size);
+    for (uint32_t k = 0; k < half_log_size; ++k) {
+      size_t half_size = xs.size() / 2;
+      std::vector<F>& twiddles = line_twiddles_[k];
+      twiddles.resize(half_size);
+      for (size_t h = 0; h < half_size; ++h) {
+        twiddles[h] = xs[BitRev(h, half_log_size - k - 1)];
+      }
+      xs.resize(half_size);
+      for (F& x : xs) {
+        x = x.Square().Double() - F::One();
+      }
+    }
+
+    circle_twiddle_invs_ = circle_twiddles_;
+    CHECK(F::BatchInverseInPlace(circle_twiddle_invs_));
+    line_twiddle_invs_ = line_twiddles_;
+    for (std::vector<F>& twiddle_invs : line_twiddle_invs_) {
+      CHECK(F::BatchInverseInPlace(twiddle_invs));
+    }
+  }
+
+  Coset half_coset_;
+  std::vector<F> circle_twiddles_;
+  std::vector<F> circle_twiddle_invs_;
+  // |line_twiddles_[k]| is for the (k + 1)-th layer.
+  std::vector<std::vector<F>> line_twiddles_;
+  std::vector<std::vector<F>> line_twiddle_invs_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_CIRCLE_CIRCLE_EVALUATION_DOMAIN_H_
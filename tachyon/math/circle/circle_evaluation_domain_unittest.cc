@@ -0,0 +1,76 @@
+#include "tachyon/math/circle/circle_evaluation_domain.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/circle/stark/g1.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class CircleEvaluationDomainTest : public testing::Test {
+ public:
+  using Domain = CircleEvaluationDomain<stark::G1Circle>;
+  using F = Mersenne31;
+
+  static void SetUpTestSuite() { stark::G1Circle::Init(); }
+};
+
+}  // namespace
+
+TEST_F(CircleEvaluationDomainTest, GetElement) {
+  std::unique_ptr<Domain> domain = Domain::Create(4);
+  ASSERT_EQ(domain->size(), size_t{16});
+  size_t half_size = domain->size() / 2;
+  for (size_t i = 0; i < half_size; ++i) {
+    EXPECT_TRUE(domain->GetElement(i).IsOnCircle());
+    EXPECT_EQ(domain->GetElement(i + half_size),
+              domain->GetElement(i).Conjugate());
+  }
+  // The points p and p̄ are adjacent in bit-reversed order.
+  for (size_t i = 0; i < domain->size(); i += 2) {
+    EXPECT_EQ(domain->GetBitReversedElement(i + 1),
+              domain->GetBitReversedElement(i).Conjugate());
+  }
+}
+
+TEST_F(CircleEvaluationDomainTest, CFFT) {
+  for (uint32_t log_size = 1; log_size <= 8; ++log_size) {
+    SCOPED_TRACE(log_size);
+    std::unique_ptr<Domain> domain = Domain::Create(log_size);
+    std::vector<F> coeffs =
+        base::CreateVector(domain->size(), []() { return F::Random(); });
+    std::vector<F> evals = domain->CFFT(coeffs);
+    for (size_t i = 0; i < evals.size(); ++i) {
+      ASSERT_EQ(evals[i],
+                Domain::Evaluate(coeffs, domain->GetBitReversedElement(i)));
+    }
+  }
+}
+
+TEST_F(CircleEvaluationDomainTest, CFFTWithFewerCoeffs) {
+  std::unique_ptr<Domain> domain = Domain::Create(6);
+  std::vector<F> coeffs =
+      base::CreateVector(domain->size() / 4, []() { return F::Random(); });
+  std::vector<F> evals = domain->CFFT(coeffs);
+  for (size_t i = 0; i < evals.size(); ++i) {
+    ASSERT_EQ(evals[i],
+              Domain::Evaluate(coeffs, domain->GetBitReversedElement(i)));
+  }
+}
+
+TEST_F(CircleEvaluationDomainTest, ICFFT) {
+  for (uint32_t log_size = 1; log_size <= 12; ++log_size) {
+    SCOPED_TRACE(log_size);
+    std::unique_ptr<Domain> domain = Domain::Create(log_size);
+    std::vector<F> coeffs =
+        base::CreateVector(domain->size(), []() { return F::Random(); });
+    EXPECT_EQ(domain->ICFFT(domain->CFFT(coeffs)), coeffs);
+  }
+}
+
+}  // namespace tachyon::math
@@ -21,8 +21,30 @@ class BLS12Curve : public PairingFriendlyCurve<Config> {
  public:
   using Base = PairingFriendlyCurve<Config>;
   using Fp12 = typename Config::Fp12;
+  using G1AffinePoint = typename Base::G1AffinePoint;
+  using G2AffinePoint = typename Base::G2AffinePoint;
   using G2Prepared = bls12::G2Prepared<Config>;
 
+  // Returns true if |point| on the curve is in G1 by checking φ(P) = [-x²]P,
+  // where φ(x, y) = (βx, y) is |G1AffinePoint::Endomorphism()|.
+  static bool IsInG1Subgroup(const G1AffinePoint& point) {
+    return Base::IsInSubgroup(point, [](const G1AffinePoint& point) {
+      auto x2_point = point.ScalarMul(Config::kX).ScalarMul(Config::kX);
+      return G1AffinePoint::Endomorphism(point).ToJacobian() == -x2_point;
+    });
+  }
+
+  // Returns true if |point| on the curve is in G2 by checking ψ(P) = [x]P.
+  static bool IsInG2Subgroup(const G2AffinePoint& point) {
+    return Base::IsInSubgroup(point, [](const G2AffinePoint& point) {
+      auto x_point = point.ScalarMul(Config::kX);
+      if constexpr (Config::kXIsNegative) {
+        x_point.NegateInPlace();
+      }
+      return Base::Psi(point).ToJacobian() == x_point;
+    });
+  }
+
   // TODO(chokobole): Leave a comment to help understand readers.
   template <typename G1AffinePointContainer, typename G2PreparedContainer>
   static Fp12 MultiMillerLoop(const G1AffinePointContainer& a,
@@ -56,8 +78,11 @@ class BLS12Curve : public PairingFriendlyCurve<Config> {
       return f;
     };
 
-    std::vector<Fp12> results =
-        base::ParallelizeMapByChunkSize(pairs, 4, callback);
+    // Every chunk runs its own loop and squares its own accumulator, so the
+    // pairs are split evenly over the threads rather than into small chunks.
+    // This keeps the number of the redundant squarings and the partial
+    // products to be multiplied to the number of threads.
+    std::vector<Fp12> results = base::ParallelizeMap(pairs, callback);
     Fp12 f = std::accumulate(results.begin(), results.end(), Fp12::One(),
                              std::multiplies<>());
 
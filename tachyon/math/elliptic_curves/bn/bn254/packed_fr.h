@@ -0,0 +1,57 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_BN_BN254_PACKED_FR_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_BN_BN254_PACKED_FR_H_
+
+#include "tachyon/build/build_config.h"
+
+#if ARCH_CPU_X86_64 && defined(TACHYON_HAS_AVX512_IFMA)
+#include "tachyon/math/elliptic_curves/bn/bn254/packed_fr_avx512_ifma.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
+#include "tachyon/math/matrix/prime_field_num_traits.h"
+
+namespace tachyon::math {
+namespace bn254 {
+
+using PackedFr = PackedFrAVX512IFMA;
+
+}  // namespace bn254
+
+template <>
+struct FiniteFieldTraits<bn254::PackedFr> {
+  static constexpr bool kIsPrimeField = true;
+  static constexpr bool kIsPackedPrimeField = true;
+  static constexpr bool kIsExtensionField = false;
+
+  using PrimeField = bn254::Fr;
+  using Config = bn254::Fr::Config;
+};
+
+template <>
+struct PackedFieldTraits<bn254::Fr> {
+  using PackedField = bn254::PackedFr;
+};
+
+}  // namespace tachyon::math
+
+namespace Eigen {
+
+template <>
+struct NumTraits<tachyon::math::bn254::PackedFr>
+    : GenericNumTraits<tachyon::math::bn254::PackedFr> {
+  using PrimeField = tachyon::math::bn254::Fr;
+  constexpr static size_t N = tachyon::math::bn254::PackedFr::N;
+
+  enum {
+    IsInteger = 1,
+    IsSigned = 0,
+    IsComplex = 0,
+    RequireInitialization = 1,
+    ReadCost = CostCalculator<PrimeField>::ComputeReadCost() * N,
+    AddCost = CostCalculator<PrimeField>::ComputeAddCost() * N,
+    MulCost = CostCalculator<PrimeField>::ComputeMulCost() * N,
+  };
+};
+
+}  // namespace Eigen
+#endif
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_BN_BN254_PACKED_FR_H_
@@ -0,0 +1,77 @@
+#include "tachyon/math/elliptic_curves/bn/bn254/packed_fr_avx512_ifma.h"
+
+#include "tachyon/math/finite_fields/packed_prime_field_avx512_ifma.h"
+
+namespace tachyon::math::bn254 {
+
+namespace {
+
+using Montgomery = MontgomeryAVX512IFMA<Fr::N>;
+
+static_assert(sizeof(Fr) == Fr::N * sizeof(uint64_t));
+
+Montgomery kMontgomery;
+
+const uint64_t* ToLimbs(const PackedFrAVX512IFMA& packed) {
+  return reinterpret_cast<const uint64_t*>(packed.values().data());
+}
+
+uint64_t* ToLimbs(PackedFrAVX512IFMA& packed) {
+  return reinterpret_cast<uint64_t*>(packed.values().data());
+}
+
+PackedFrAVX512IFMA FromLimbs(const Montgomery::Limbs& limbs) {
+  PackedFrAVX512IFMA ret;
+  kMontgomery.Store(limbs, ToLimbs(ret));
+  return ret;
+}
+
+}  // namespace
+
+PackedFrAVX512IFMA::PackedFrAVX512IFMA(uint32_t value) {
+  values_.fill(Fr(value));
+}
+
+// static
+void PackedFrAVX512IFMA::Init() {
+  kMontgomery = Montgomery(Fr::Config::kModulus.limbs);
+}
+
+// static
+PackedFrAVX512IFMA PackedFrAVX512IFMA::Zero() {
+  return Broadcast(Fr::Zero());
+}
+
+// static
+PackedFrAVX512IFMA PackedFrAVX512IFMA::One() { return Broadcast(Fr::One()); }
+
+// static
+PackedFrAVX512IFMA PackedFrAVX512IFMA::Broadcast(const PrimeField& value) {
+  PackedFrAVX512IFMA ret;
+  ret.values_.fill(value);
+  return ret;
+}
+
+PackedFrAVX512IFMA PackedFrAVX512IFMA::Add(
+    const PackedFrAVX512IFMA& other) const {
+  return FromLimbs(kMontgomery.Add(kMontgomery.Load(ToLimbs(*this)),
+                                   kMontgomery.Load(ToLimbs(other))));
+}
+
+PackedFrAVX512IFMA PackedFrAVX512IFMA::Sub(
+    const PackedFrAVX512IFMA& other) const {
+  return FromLimbs(kMontgomery.Sub(kMontgomery.Load(ToLimbs(*this)),
+                                   kMontgomery.Load(ToLimbs(other))));
+}
+
+PackedFrAVX512IFMA PackedFrAVX512IFMA::Negate() const {
+  return FromLimbs(kMontgomery.Negate(kMontgomery.Load(ToLimbs(*this))));
+}
+
+PackedFrAVX512IFMA PackedFrAVX512IFMA::Mul(
+    const PackedFrAVX512IFMA& other) const {
+  return FromLimbs(kMontgomery.Mul(kMontgomery.LoadShifted(ToLimbs(*this)),
+                                   kMontgomery.Load(ToLimbs(other))));
+}
+
+}  // namespace tachyon::math::bn254
@@ -0,0 +1,67 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_BN_BN254_PACKED_FR_AVX512_IFMA_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_BN_BN254_PACKED_FR_AVX512_IFMA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/export.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/packed_prime_field_base.h"
+
+namespace tachyon::math {
+namespace bn254 {
+
+class PackedFrAVX512IFMA;
+
+}  // namespace bn254
+
+template <>
+struct PackedPrimeFieldTraits<bn254::PackedFrAVX512IFMA> {
+  using PrimeField = bn254::Fr;
+
+  constexpr static size_t N = 8;
+};
+
+namespace bn254 {
+
+// 8 lanes of |Fr|, whose 256-bit elements are multiplied in 52-bit limbs on
+// AVX-512 IFMA. See |MontgomeryAVX512IFMA|.
+class TACHYON_EXPORT PackedFrAVX512IFMA final
+    : public PackedPrimeFieldBase<PackedFrAVX512IFMA> {
+ public:
+  using PrimeField = Fr;
+
+  constexpr static size_t N = 8;
+
+  PackedFrAVX512IFMA() = default;
+  // NOTE: This is needed by Eigen matrix.
+  explicit PackedFrAVX512IFMA(uint32_t value);
+  PackedFrAVX512IFMA(const PackedFrAVX512IFMA& other) = default;
+  PackedFrAVX512IFMA& operator=(const PackedFrAVX512IFMA& other) = default;
+  PackedFrAVX512IFMA(PackedFrAVX512IFMA&& other) = default;
+  PackedFrAVX512IFMA& operator=(PackedFrAVX512IFMA&& other) = default;
+
+  static void Init();
+
+  static PackedFrAVX512IFMA Zero();
+
+  static PackedFrAVX512IFMA One();
+
+  static PackedFrAVX512IFMA Broadcast(const PrimeField& value);
+
+  // AdditiveSemigroup methods
+  PackedFrAVX512IFMA Add(const PackedFrAVX512IFMA& other) const;
+
+  // AdditiveGroup methods
+  PackedFrAVX512IFMA Sub(const PackedFrAVX512IFMA& other) const;
+
+  PackedFrAVX512IFMA Negate() const;
+
+  // MultiplicativeSemigroup methods
+  PackedFrAVX512IFMA Mul(const PackedFrAVX512IFMA& other) const;
+};
+
+}  // namespace bn254
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_BN_BN254_PACKED_FR_AVX512_IFMA_H_
@@ -11,6 +11,7 @@
 
 #include "tachyon/base/optional.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/math/base/big_int.h"
 #include "tachyon/math/elliptic_curves/bn/g2_prepared.h"
 #include "tachyon/math/elliptic_curves/pairing/pairing_friendly_curve.h"
 
@@ -21,8 +22,24 @@ class BNCurve : public PairingFriendlyCurve<Config> {
  public:
   using Base = PairingFriendlyCurve<Config>;
   using Fp12 = typename Config::Fp12;
+  using G1AffinePoint = typename Base::G1AffinePoint;
+  using G2AffinePoint = typename Base::G2AffinePoint;
   using G2Prepared = bn::G2Prepared<Config>;
 
+  // Every point on a BN curve is in G1, since #E(Fp) = r.
+  static bool IsInG1Subgroup(const G1AffinePoint&) { return true; }
+
+  // Returns true if |point| on the curve is in G2 by checking ψ(P) = [6x²]P,
+  // which takes a scalar of about half the size of r.
+  static bool IsInG2Subgroup(const G2AffinePoint& point) {
+    return Base::IsInSubgroup(point, [](const G2AffinePoint& point) {
+      return Base::Psi(point).ToJacobian() ==
+             point.ScalarMul(Config::kX)
+                 .ScalarMul(Config::kX)
+                 .ScalarMul(BigInt<1>(6));
+    });
+  }
+
   // TODO(chokobole): Leave a comment to help understand readers.
   template <typename G1AffinePointContainer, typename G2PreparedContainer>
   static Fp12 MultiMillerLoop(const G1AffinePointContainer& a,
@@ -52,8 +69,11 @@ class BNCurve : public PairingFriendlyCurve<Config> {
       return f;
     };
 
-    std::vector<Fp12> results =
-        base::ParallelizeMapByChunkSize(pairs, 4, callback);
+    // Every chunk runs its own loop and squares its own accumulator, so the
+    // pairs are split evenly over the threads rather than into small chunks.
+    // This keeps the number of the redundant squarings and the partial
+    // products to be multiplied to the number of threads.
+    std::vector<Fp12> results = base::ParallelizeMap(pairs, callback);
     Fp12 f = std::accumulate(results.begin(), results.end(), Fp12::One(),
                              std::multiplies<>());
 
@@ -7,7 +7,12 @@
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_BELLMAN_BELLMAN_MSM_H_
 
 #include <memory>
+#include <utility>
 
+#include "absl/container/flat_hash_map.h"
+
+#include "tachyon/device/gpu/scoped_graph.h"
+#include "tachyon/device/gpu/scoped_stream.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/bellman/bellman_msm_impl.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/msm_algorithm.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
@@ -32,6 +37,8 @@ class BellmanMSM : public PippengerBase<AffinePoint<GpuCurve>>,
     }
     CHECK(mem_pool);
     CHECK(stream);
+    stream_sort_a_ = device::gpu::CreateStream();
+    stream_sort_b_ = device::gpu::CreateStream();
     d_results_ =
         device::gpu::GpuMemory<JacobianPoint<GpuCurve>>::MallocFromPoolAsync(
             ScalarField::Config::kModulusBits, mem_pool, stream);
@@ -42,7 +49,21 @@ class BellmanMSM : public PippengerBase<AffinePoint<GpuCurve>>,
   BellmanMSM(const BellmanMSM& other) = delete;
   BellmanMSM& operator=(const BellmanMSM& other) = delete;
 
+  bool use_graph() const { return use_graph_; }
+  // If set, the launches of an MSM are captured into a graph on the first run
+  // of its size and replayed by the following runs of the same size, which
+  // saves the launch overhead that dominates the small and medium MSMs. It is
+  // set by default.
+  void set_use_graph(bool use_graph) {
+    use_graph_ = use_graph;
+    if (!use_graph_) graphs_.clear();
+  }
+
   // MSMGpuAlgorithm methods
+  void SetWindowBits(unsigned int window_bits) override {
+    window_bits_ = window_bits;
+  }
+
   [[nodiscard]] bool Run(
       const device::gpu::GpuMemory<AffinePoint<GpuCurve>>& bases,
       const device::gpu::GpuMemory<ScalarField>& scalars, size_t size,
@@ -54,7 +75,15 @@ class BellmanMSM : public PippengerBase<AffinePoint<GpuCurve>>,
     config.scalars = scalars.get();
     config.results = d_results_.get();
     config.log_scalars_count = base::bits::Log2Ceiling(size);
-    gpuError_t error = bellman::ExecuteAsync<GpuCurve>(config);
+    config.scalars_count = static_cast<unsigned int>(size);
+    config.window_bits = window_bits_;
+    config.stream_sort_a = stream_sort_a_.get();
+    config.stream_sort_b = stream_sort_b_.get();
+    // NOTE: The inputs on the host are copied by the execution on its own
+    // streams, which is not captured.
+    bool use_graph = use_graph_ && IsOnDevice(bases) && IsOnDevice(scalars);
+    gpuError_t error = use_graph ? ExecuteGraphAsync(config)
+                                 : bellman::ExecuteAsync<GpuCurve>(config);
     if (error != gpuSuccess) return false;
 
     device::gpu::GpuMemcpyAsync(
@@ -84,9 +113,70 @@ class BellmanMSM : public PippengerBase<AffinePoint<GpuCurve>>,
     return ret;
   }
 
+  struct Graph {
+    device::gpu::ScopedGraphExec exec;
+    // The inputs that the kernels of |exec| take.
+    const AffinePoint<GpuCurve>* bases = nullptr;
+    const ScalarField* scalars = nullptr;
+  };
+
+  template <typename T>
+  static bool IsOnDevice(const device::gpu::GpuMemory<T>& memory) {
+    return memory.memory_type() == device::gpu::GpuMemoryType::kDevice ||
+           memory.memory_type() == device::gpu::GpuMemoryType::kUnified;
+  }
+
+  // Replays the graph of the size and the window of |config| if it was
+  // captured with the same inputs. Otherwise, it captures the launches of
+  // |config| and updates the graph with them, which only differs in the
+  // pointers to the inputs.
+  gpuError_t ExecuteGraphAsync(
+      const bellman::ExecutionConfig<GpuCurve>& config) {
+    Graph& graph =
+        graphs_[std::make_pair(config.scalars_count, config.window_bits)];
+    if (graph.exec && graph.bases == config.bases &&
+        graph.scalars == config.scalars) {
+      return LOG_IF_GPU_ERROR(gpuGraphLaunch(graph.exec.get(), stream_),
+                              "Failed to gpuGraphLaunch()");
+    }
+
+    // NOTE: The capture is thread local, so that the other threads are free
+    // to call the unsafe functions, e.g., |gpuMalloc()|, meanwhile.
+    RETURN_AND_LOG_IF_GPU_ERROR(
+        gpuStreamBeginCapture(stream_, gpuStreamCaptureModeThreadLocal),
+        "Failed to gpuStreamBeginCapture()");
+    gpuError_t error = bellman::ExecuteAsync<GpuCurve>(config);
+    device::gpu::ScopedGraph captured = device::gpu::EndCapture(stream_);
+    bool is_captured = error == gpuSuccess && captured;
+    if (is_captured &&
+        !(graph.exec &&
+          device::gpu::UpdateGraphExec(graph.exec.get(), captured.get()))) {
+      graph.exec = device::gpu::InstantiateGraph(captured.get());
+    }
+    if (!is_captured || !graph.exec) {
+      // NOTE: Nothing has been launched, since the capture has failed, so
+      // the MSM is launched again without a graph.
+      LOG(WARNING) << "Failed to capture the MSM into a graph, it is launched "
+                      "without a graph from now on";
+      gpuGetLastError();
+      set_use_graph(false);
+      return bellman::ExecuteAsync<GpuCurve>(config);
+    }
+    graph.bases = config.bases;
+    graph.scalars = config.scalars;
+    return LOG_IF_GPU_ERROR(gpuGraphLaunch(graph.exec.get(), stream_),
+                            "Failed to gpuGraphLaunch()");
+  }
+
   bool init_ = false;
+  bool use_graph_ = true;
+  unsigned int window_bits_ = 0;
   gpuMemPool_t mem_pool_ = nullptr;
   gpuStream_t stream_ = nullptr;
+  device::gpu::ScopedStream stream_sort_a_;
+  device::gpu::ScopedStream stream_sort_b_;
+  // The graphs keyed by the size of the MSM and the window bits.
+  absl::flat_hash_map<std::pair<unsigned int, unsigned int>, Graph> graphs_;
   std::unique_ptr<JacobianPoint<CpuCurve>[]> results_;
   device::gpu::GpuMemory<JacobianPoint<GpuCurve>> d_results_;
 };
@@ -10,10 +10,15 @@
 #include <cmath>
 #include <utility>
 
+#if TACHYON_USE_ROCM
+// hipcub provides the same interface as cub on top of rocprim.
+#include <hipcub/hipcub.hpp>  // NOLINT(build/include_order)
+#else
 // It is guided to use "umbrella" header instead of
 // "third_party/gpus/cuda/include/cub/cub.cuh".
 // See https://nvlabs.github.io/cub/#sec6
 #include <cub/cub.cuh>  // NOLINT(build/include_order)
+#endif
 
 #include "tachyon/base/bits.h"
 #include "tachyon/device/gpu/cuda/cub_helper.h"
@@ -24,6 +29,10 @@
 #include "tachyon/device/gpu/scoped_stream.h"
 #include "tachyon/math/elliptic_curves/msm/kernels/bellman/bellman_msm_kernels.cu.h"
 
+#if TACHYON_USE_ROCM
+namespace cub = hipcub;
+#endif
+
 namespace tachyon::math::bellman {
 
 template <typename Curve>
@@ -34,27 +43,39 @@ struct ExecutionConfig {
   const typename AffinePoint<Curve>::ScalarField* scalars = nullptr;
   JacobianPoint<Curve>* results = nullptr;
   unsigned int log_scalars_count = 0;
+  // The number of the scalars, which may not be a power of 2, or 0 for
+  // 2^|log_scalars_count|. The last chunk of the inputs is cut at it, so that
+  // the inputs don't need to be padded.
+  unsigned int scalars_count = 0;
+  // The bits of a window of the first pass, or 0 to choose it from
+  // |log_scalars_count|. See |GetWindowsBitsCount()|.
+  unsigned int window_bits = 0;
   gpuEvent_t h2d_copy_finished = nullptr;
-  cudaHostFn_t h2d_copy_finished_callback = nullptr;
+  gpuHostFn_t h2d_copy_finished_callback = nullptr;
   void* h2d_copy_finished_callback_data = nullptr;
   gpuEvent_t d2h_copy_finished = nullptr;
-  cudaHostFn_t d2h_copy_finished_callback = nullptr;
+  gpuHostFn_t d2h_copy_finished_callback = nullptr;
   void* d2h_copy_finished_callback_data = nullptr;
   bool force_min_chunk_size = false;
   unsigned int log_min_chunk_size = 0;
   bool force_max_chunk_size = false;
   unsigned int log_max_chunk_size = 0;
+  // The streams that the sorts are forked to. If not given, they are created
+  // and destroyed by each execution, which should be avoided while |stream| is
+  // being captured into a graph.
+  gpuStream_t stream_sort_a = nullptr;
+  gpuStream_t stream_sort_b = nullptr;
 };
 
 template <typename Curve>
 struct ExtendedConfig {
   ExecutionConfig<Curve> execution_config;
-  cudaPointerAttributes scalars_attributes;
-  cudaPointerAttributes bases_attributes;
-  cudaPointerAttributes results_attributes;
+  gpuPointerAttributes scalars_attributes;
+  gpuPointerAttributes bases_attributes;
+  gpuPointerAttributes results_attributes;
   unsigned int log_min_inputs_count = 0;
   unsigned int log_max_inputs_count = 0;
-  cudaDeviceProp device_props;
+  gpuDeviceProp device_props;
 };
 
 unsigned int GetWindowsBitsCount(unsigned int log_scalars_count) {
@@ -109,13 +130,14 @@ unsigned int GetWindowsCount(unsigned int window_bits_count) {
   return (ScalarField::Config::kModulusBits - 1) / window_bits_count + 1;
 }
 
-unsigned int GetOptimalLogDataSplit(unsigned int mpc,
+// |warp_size| is the number of threads of the blocks that the buckets are
+// reduced by. See |ReduceBuckets()|.
+unsigned int GetOptimalLogDataSplit(unsigned int mpc, unsigned int warp_size,
                                     unsigned int source_window_bits,
                                     unsigned int target_window_bits,
                                     unsigned int target_windows_count) {
-#define MAX_THREADS 32
 #define MIN_BLOCKS 16
-  unsigned int full_occupancy = mpc * MAX_THREADS * MIN_BLOCKS;
+  unsigned int full_occupancy = mpc * warp_size * MIN_BLOCKS;
   unsigned int target = full_occupancy << 6;
   unsigned int unit_threads_count = target_windows_count << target_window_bits;
   unsigned int split_target =
@@ -123,7 +145,6 @@ unsigned int GetOptimalLogDataSplit(unsigned int mpc,
   unsigned int split_limit = source_window_bits - target_window_bits - 1;
   return std::min(split_target, split_limit);
 #undef MIN_BLOCKS
-#undef MAX_THREADS
 }
 
 template <typename Curve,
@@ -135,10 +156,13 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
   gpuMemPool_t pool = ec.mem_pool;
   gpuStream_t stream = ec.stream;
   unsigned int log_scalars_count = ec.log_scalars_count;
-  unsigned int scalars_count = 1 << log_scalars_count;
+  unsigned int scalars_count =
+      ec.scalars_count != 0 ? ec.scalars_count : 1 << log_scalars_count;
   unsigned int log_min_inputs_count = config.log_min_inputs_count;
   unsigned int log_max_inputs_count = config.log_max_inputs_count;
-  unsigned int bits_count_pass_one = GetWindowsBitsCount(log_scalars_count);
+  unsigned int bits_count_pass_one =
+      ec.window_bits != 0 ? ec.window_bits
+                          : GetWindowsBitsCount(log_scalars_count);
   unsigned int signed_bits_count_pass_one = bits_count_pass_one - 1;
   unsigned int windows_count_pass_one =
       GetWindowsCount<ScalarField>(bits_count_pass_one);
@@ -162,8 +186,10 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
   ScopedStream stream_copy_scalars;
   ScopedStream stream_copy_bases;
   ScopedStream stream_copy_finished;
-  ScopedStream stream_sort_a;
-  ScopedStream stream_sort_b;
+  ScopedStream scoped_stream_sort_a;
+  ScopedStream scoped_stream_sort_b;
+  gpuStream_t stream_sort_a = ec.stream_sort_a;
+  gpuStream_t stream_sort_b = ec.stream_sort_b;
   gpuError_t error;
   if (!dry_run) {
     ScopedEvent execution_started_event =
@@ -192,14 +218,20 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
       stream_copy_finished = CreateStream();
     }
 
-    stream_sort_a = CreateStream();
+    if (!stream_sort_a) {
+      scoped_stream_sort_a = CreateStream();
+      stream_sort_a = scoped_stream_sort_a.get();
+    }
     RETURN_AND_LOG_IF_GPU_ERROR(
-        gpuStreamWaitEvent(stream_sort_a.get(), execution_started_event.get()),
+        gpuStreamWaitEvent(stream_sort_a, execution_started_event.get()),
         "Failed to gpuStreamWaitEvent()");
 
-    stream_sort_b = CreateStream();
+    if (!stream_sort_b) {
+      scoped_stream_sort_b = CreateStream();
+      stream_sort_b = scoped_stream_sort_b.get();
+    }
     RETURN_AND_LOG_IF_GPU_ERROR(
-        gpuStreamWaitEvent(stream_sort_b.get(), execution_started_event.get()),
+        gpuStreamWaitEvent(stream_sort_b, execution_started_event.get()),
         "Failed to gpuStreamWaitEvent()");
   }
 
@@ -229,11 +261,11 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
 
   for (unsigned int inputs_offset = 0, log_inputs_count = log_min_inputs_count;
        inputs_offset < scalars_count;) {
-    unsigned int inputs_count = 1 << log_inputs_count;
+    unsigned int inputs_count =
+        std::min(1u << log_inputs_count, scalars_count - inputs_offset);
     bool is_first_loop = inputs_offset == 0;
     bool is_last_loop = inputs_offset + inputs_count == scalars_count;
-    unsigned int input_indexes_count = windows_count_pass_one
-                                       << log_inputs_count;
+    unsigned int input_indexes_count = windows_count_pass_one * inputs_count;
 
     if (!dry_run) {
       if (is_first_loop &&
@@ -248,7 +280,7 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
             gpuStreamWaitEvent(stream_copy_scalars.get(),
                                event_scalars_free.get()),
             "Failed to gpuStreamWaitEvent()");
-        const size_t inputs_size = sizeof(ScalarField) << log_inputs_count;
+        const size_t inputs_size = sizeof(ScalarField) * inputs_count;
         CHECK(inputs_scalars.CopyFromAsync(
             &ec.scalars[inputs_offset], GpuMemoryType::kHost,
             stream_copy_scalars.get(), 0, inputs_size));
@@ -266,7 +298,7 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
         RETURN_AND_LOG_IF_GPU_ERROR(
             gpuStreamWaitEvent(stream_copy_bases.get(), event_bases_free.get()),
             "Failed to gpuStreamWaitEvent()");
-        size_t bases_size = sizeof(AffinePoint<Curve>) << log_inputs_count;
+        size_t bases_size = sizeof(AffinePoint<Curve>) * inputs_count;
         CHECK(inputs_bases.CopyFromAsync(
             &ec.bases[inputs_offset], GpuMemoryType::kHost,
             stream_copy_bases.get(), 0, bases_size));
@@ -294,10 +326,10 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
         }
         if (ec.h2d_copy_finished_callback) {
           RETURN_AND_LOG_IF_GPU_ERROR(
-              cudaLaunchHostFunc(stream_copy_finished.get(),
-                                 ec.h2d_copy_finished_callback,
-                                 ec.h2d_copy_finished_callback_data),
-              "Failed to cudaLaunchHostFunc()");
+              gpuLaunchHostFunc(stream_copy_finished.get(),
+                                ec.h2d_copy_finished_callback,
+                                ec.h2d_copy_finished_callback_data),
+              "Failed to gpuLaunchHostFunc()");
         }
       }
       if (is_first_loop &&
@@ -434,7 +466,7 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
           pool, stream, cub::DeviceRadixSort::SortPairsDescending,
           bucket_run_lengths.get(), sorted_bucket_run_lengths.get(),
           bucket_run_offsets.get(), sorted_bucket_run_offsets.get(),
-          extended_buckets_count_pass_one, 0, log_inputs_count + 1);
+          extended_buckets_count_pass_one, 0, log_inputs_count + 1, stream);
       if (error != gpuSuccess) return error;
       error = CUB_TRY_ALLOCATE_WITH_POOL(
           pool, stream, cub::DeviceRadixSort::SortPairsDescending,
@@ -449,19 +481,17 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
           gpuEventRecord(event_sort_inputs_ready.get(), stream),
           "Failed to gpuEventRecord()");
       RETURN_AND_LOG_IF_GPU_ERROR(
-          gpuStreamWaitEvent(stream_sort_a.get(),
-                             event_sort_inputs_ready.get()),
+          gpuStreamWaitEvent(stream_sort_a, event_sort_inputs_ready.get()),
           "Failed to gpuStreamWaitEvent()");
       RETURN_AND_LOG_IF_GPU_ERROR(
-          gpuStreamWaitEvent(stream_sort_b.get(),
-                             event_sort_inputs_ready.get()),
+          gpuStreamWaitEvent(stream_sort_b, event_sort_inputs_ready.get()),
           "Failed to gpuStreamWaitEvent()");
       event_sort_inputs_ready.reset();
       error = CUB_INVOKE_WITH_POOL(
           pool, stream, cub::DeviceRadixSort::SortPairsDescending,
           bucket_run_lengths.get(), sorted_bucket_run_lengths.get(),
           bucket_run_offsets.get(), sorted_bucket_run_offsets.get(),
-          extended_buckets_count_pass_one, 0, log_inputs_count + 1);
+          extended_buckets_count_pass_one, 0, log_inputs_count + 1, stream);
       if (error != gpuSuccess) return error;
       error = CUB_INVOKE_WITH_POOL(
           pool, stream, cub::DeviceRadixSort::SortPairsDescending,
@@ -472,10 +502,10 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
       ScopedEvent event_sort_a = CreateEventWithFlags(gpuEventDisableTiming);
       ScopedEvent event_sort_b = CreateEventWithFlags(gpuEventDisableTiming);
       RETURN_AND_LOG_IF_GPU_ERROR(
-          gpuEventRecord(event_sort_a.get(), stream_sort_a.get()),
+          gpuEventRecord(event_sort_a.get(), stream_sort_a),
           "Failed to gpuEventRecord()");
       RETURN_AND_LOG_IF_GPU_ERROR(
-          gpuEventRecord(event_sort_b.get(), stream_sort_b.get()),
+          gpuEventRecord(event_sort_b.get(), stream_sort_b),
           "Failed to gpuEventRecord()");
       RETURN_AND_LOG_IF_GPU_ERROR(
           gpuStreamWaitEvent(stream, event_sort_a.get()),
@@ -538,8 +568,8 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
     if (copy_scalars || copy_bases) {
       stream_copy_finished.reset();
     }
-    stream_sort_a.reset();
-    stream_sort_b.reset();
+    scoped_stream_sort_a.reset();
+    scoped_stream_sort_b.reset();
     if (top_window_unused_bits != 0) {
       unsigned int top_window_offset = (windows_count_pass_one - 1)
                                        << signed_bits_count_pass_one;
@@ -577,8 +607,8 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
     unsigned int target_buckets_count = target_windows_count
                                         << target_bits_count;
     unsigned int log_data_split = GetOptimalLogDataSplit(
-        config.device_props.multiProcessorCount, source_bits_count,
-        target_bits_count, target_windows_count);
+        config.device_props.multiProcessorCount, config.device_props.warpSize,
+        source_bits_count, target_bits_count, target_windows_count);
     unsigned int total_buckets_count = target_buckets_count << log_data_split;
     target_buckets = GpuMemory<PointXYZZ<Curve>>::MallocFromPoolAsync(
         total_buckets_count, pool, stream);
@@ -612,11 +642,11 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
         if (UNLIKELY(error != gpuSuccess)) return error;
         if (copy_results) {
           RETURN_AND_LOG_IF_GPU_ERROR(
-              cudaMemcpyAsync(
+              GpuMemcpyAsync(
                   ec.results, results.get(),
                   sizeof(JacobianPoint<Curve>) * result_windows_count,
                   gpuMemcpyDeviceToHost, stream),
-              "Failed to cudaMemcpyAsync()");
+              "Failed to GpuMemcpyAsync()");
           if (ec.d2h_copy_finished) {
             RETURN_AND_LOG_IF_GPU_ERROR(
                 gpuEventRecord(ec.d2h_copy_finished, stream),
@@ -624,9 +654,9 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
           }
           if (ec.d2h_copy_finished_callback) {
             RETURN_AND_LOG_IF_GPU_ERROR(
-                cudaLaunchHostFunc(stream, ec.d2h_copy_finished_callback,
-                                   ec.d2h_copy_finished_callback_data),
-                "Failed to cudaLaunchHostFunc()");
+                gpuLaunchHostFunc(stream, ec.d2h_copy_finished_callback,
+                                  ec.d2h_copy_finished_callback_data),
+                "Failed to gpuLaunchHostFunc()");
           }
         }
       }
@@ -646,25 +676,26 @@ gpuError_t ScheduleExecution(const ExtendedConfig<Curve>& config,
 
 template <typename Curve>
 gpuError_t ExecuteAsync(const ExecutionConfig<Curve>& config) {
+  using namespace device::gpu;
   int device_id;
-  RETURN_AND_LOG_IF_GPU_ERROR(cudaGetDevice(&device_id),
-                              "Failed to cudaGetDevice()");
-  cudaDeviceProp props{};
-  RETURN_AND_LOG_IF_GPU_ERROR(cudaGetDeviceProperties(&props, device_id),
-                              "Failed to cudaGetDeviceProperties()");
+  RETURN_AND_LOG_IF_GPU_ERROR(gpuGetDevice(&device_id),
+                              "Failed to gpuGetDevice()");
+  gpuDeviceProp props{};
+  RETURN_AND_LOG_IF_GPU_ERROR(gpuGetDeviceProperties(&props, device_id),
+                              "Failed to gpuGetDeviceProperties()");
   unsigned int log_scalars_count = config.log_scalars_count;
-  cudaPointerAttributes scalars_attributes{};
-  cudaPointerAttributes bases_attributes{};
-  cudaPointerAttributes results_attributes{};
+  gpuPointerAttributes scalars_attributes{};
+  gpuPointerAttributes bases_attributes{};
+  gpuPointerAttributes results_attributes{};
   RETURN_AND_LOG_IF_GPU_ERROR(
-      cudaPointerGetAttributes(&scalars_attributes, config.scalars),
-      "Failed to cudaPointerGetAttributes()");
+      GpuPointerGetAttributes(&scalars_attributes, config.scalars),
+      "Failed to GpuPointerGetAttributes()");
   RETURN_AND_LOG_IF_GPU_ERROR(
-      cudaPointerGetAttributes(&bases_attributes, config.bases),
-      "Failed to cudaPointerGetAttributes()");
+      GpuPointerGetAttributes(&bases_attributes, config.bases),
+      "Failed to GpuPointerGetAttributes()");
   RETURN_AND_LOG_IF_GPU_ERROR(
-      cudaPointerGetAttributes(&results_attributes, config.results),
-      "Failed to cudaPointerGetAttributes()");
+      GpuPointerGetAttributes(&results_attributes, config.results),
+      "Failed to GpuPointerGetAttributes()");
   bool copy_scalars = scalars_attributes.type == gpuMemoryTypeUnregistered ||
                       scalars_attributes.type == gpuMemoryTypeHost;
   unsigned int log_min_inputs_count =
@@ -695,11 +726,11 @@ gpuError_t ExecuteAsync(const ExecutionConfig<Curve>& config) {
                                              log_max_inputs_count,
                                              props};
     gpuError_t error = ScheduleExecution(extended_config, true);
-    if (error == cudaErrorMemoryAllocation) {
+    if (error == gpuErrorMemoryAllocation) {
       log_max_inputs_count--;
       if (!copy_scalars) log_min_inputs_count--;
       if (log_max_inputs_count < GetLogMinInputsCount(log_scalars_count))
-        return cudaErrorMemoryAllocation;
+        return gpuErrorMemoryAllocation;
       continue;
     }
     if (error != gpuSuccess) {
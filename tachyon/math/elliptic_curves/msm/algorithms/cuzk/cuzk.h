@@ -12,6 +12,8 @@
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/device/gpu/gpu_device_perf_info.h"
 #include "tachyon/device/gpu/scoped_stream.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/cuzk/cuzk_csr_sparse_matrix.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/cuzk/cuzk_ell_sparse_matrix.h"
@@ -37,9 +39,10 @@ class CUZK : public PippengerBase<AffinePoint<GpuCurve>>,
       : mem_pool_(mem_pool), stream_(stream) {
     // TODO(chokobole): Why grid_size is fixed to 512??
     constexpr unsigned int kDefaultGridSize = 512;
-    constexpr unsigned int kDefaultBlockSize = 32;
     grid_size_ = kDefaultGridSize;
-    block_size_ = kDefaultBlockSize;
+    // NOTE: A block is as wide as a warp, which is 64 threads on most AMD
+    // GPUs.
+    block_size_ = device::gpu::GetWarpSize();
   }
   CUZK(const CUZK& other) = delete;
   CUZK& operator=(const CUZK& other) = delete;
@@ -57,6 +60,10 @@ class CUZK : public PippengerBase<AffinePoint<GpuCurve>>,
   }
 
   // MSMGpuAlgorithm methods
+  void SetWindowBits(unsigned int window_bits) override {
+    window_bits_ = window_bits;
+  }
+
   [[nodiscard]] bool Run(
       const device::gpu::GpuMemory<AffinePoint<GpuCurve>>& bases,
       const device::gpu::GpuMemory<ScalarField>& scalars, size_t size,
@@ -71,6 +78,7 @@ class CUZK : public PippengerBase<AffinePoint<GpuCurve>>,
       const device::gpu::GpuMemory<AffinePoint<GpuCurve>>& bases,
       const device::gpu::GpuMemory<ScalarField>& scalars, size_t size,
       PointXYZZ<CpuCurve>* cpu_result) {
+    TRACE_EVENT("gpu", "CUZK::Run");
     if (bases.size() < size) {
       LOG(ERROR) << "bases.size() is smaller than size";
       return false;
@@ -81,12 +89,14 @@ class CUZK : public PippengerBase<AffinePoint<GpuCurve>>,
     }
 
     if (device_count_ == 0) {
-      gpuError_t error = LOG_IF_GPU_ERROR(cudaGetDeviceCount(&device_count_),
-                                          "Failed to cudaGetDeviceCount()");
-      error = LOG_IF_GPU_ERROR(cudaGetDevice(&device_id_),
-                               "Failed to cudaGetDevice()");
+      gpuError_t error = LOG_IF_GPU_ERROR(gpuGetDeviceCount(&device_count_),
+                                          "Failed to gpuGetDeviceCount()");
+      error = LOG_IF_GPU_ERROR(gpuGetDevice(&device_id_),
+                               "Failed to gpuGetDevice()");
     }
-    ctx_ = MSMCtx::CreateDefault<ScalarField>(size);
+    ctx_ = window_bits_ == 0
+               ? MSMCtx::CreateDefault<ScalarField>(size)
+               : MSMCtx::Create<ScalarField>(size, window_bits_);
     start_group_ =
         (ctx_.window_count + device_count_ - 1) / device_count_ * device_id_;
     end_group_ = (ctx_.window_count + device_count_ - 1) / device_count_ *
@@ -238,7 +248,7 @@ class CUZK : public PippengerBase<AffinePoint<GpuCurve>>,
       device::gpu::GpuMemory<PointXYZZ<GpuCurve>>& results,
       unsigned int bucket_index) const {
     device::gpu::ScopedStream stream =
-        device::gpu::CreateStreamWithFlags(cudaStreamNonBlocking);
+        device::gpu::CreateStreamWithFlags(gpuStreamNonBlocking);
     std::vector<unsigned int> row_ptrs;
     if (!device_row_ptrs.ToStdVectorAsync(&row_ptrs, stream.get())) {
       return false;
@@ -440,6 +450,7 @@ class CUZK : public PippengerBase<AffinePoint<GpuCurve>>,
   unsigned int block_size_ = 0;
   unsigned int start_group_ = 0;
   unsigned int end_group_ = 0;
+  unsigned int window_bits_ = 0;
 };
 
 }  // namespace tachyon::math
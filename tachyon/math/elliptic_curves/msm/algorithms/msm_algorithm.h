@@ -4,21 +4,21 @@
 #include "tachyon/device/gpu/gpu_memory.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/jacobian_point.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/msm_algorithm_kind.h"
 
 namespace tachyon::math {
 
-enum class MSMAlgorithmKind {
-  kBellmanMSM,
-  kCUZK,
-  kPippenger,
-};
-
 template <typename GpuCurve>
 class MSMGpuAlgorithm {
  public:
   using ScalarField = typename JacobianPoint<GpuCurve>::ScalarField;
   using CpuCurve = typename GpuCurve::CpuCurve;
 
+  virtual ~MSMGpuAlgorithm() = default;
+
+  // Sets the bits of a window, or 0 to choose it from the size of the MSM.
+  virtual void SetWindowBits(unsigned int window_bits) = 0;
+
   virtual bool Run(const device::gpu::GpuMemory<AffinePoint<GpuCurve>>& bases,
                    const device::gpu::GpuMemory<ScalarField>& scalars,
                    size_t size, JacobianPoint<CpuCurve>* cpu_result) = 0;
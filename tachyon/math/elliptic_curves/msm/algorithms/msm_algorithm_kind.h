@@ -0,0 +1,28 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_MSM_ALGORITHM_KIND_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_MSM_ALGORITHM_KIND_H_
+
+#include <string_view>
+
+namespace tachyon::math {
+
+enum class MSMAlgorithmKind {
+  kBellmanMSM,
+  kCUZK,
+  kPippenger,
+};
+
+constexpr std::string_view MSMAlgorithmKindToString(MSMAlgorithmKind kind) {
+  switch (kind) {
+    case MSMAlgorithmKind::kBellmanMSM:
+      return "bellman_msm";
+    case MSMAlgorithmKind::kCUZK:
+      return "cuzk";
+    case MSMAlgorithmKind::kPippenger:
+      return "pippenger";
+  }
+  return "";
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_MSM_ALGORITHM_KIND_H_
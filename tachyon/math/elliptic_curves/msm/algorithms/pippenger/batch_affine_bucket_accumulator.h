@@ -0,0 +1,157 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_BUCKET_ACCUMULATOR_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_BUCKET_ACCUMULATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/affine_point.h"
+#include "tachyon/math/elliptic_curves/curve_type.h"
+#include "tachyon/math/elliptic_curves/point_xyzz.h"
+
+namespace tachyon::math {
+
+template <typename Point, typename SFINAE = void>
+constexpr bool kSupportsBatchAffineAccumulation = false;
+
+template <typename Curve>
+constexpr bool kSupportsBatchAffineAccumulation<
+    AffinePoint<Curve>,
+    std::enable_if_t<Curve::kType == CurveType::kShortWeierstrass>> = true;
+
+// |BatchAffineBucketAccumulator| accumulates bases into affine buckets. An
+// affine addition P + Q needs a single inversion of (Q.x - P.x), so additions
+// into distinct buckets are gathered into a batch and their denominators are
+// inverted all at once using Montgomery's trick. This makes an addition cost
+// roughly 6 field multiplications instead of 10 for a mixed addition into
+// |PointXYZZ|.
+//
+// A bucket may appear at most once in a batch. A base whose bucket is already
+// scheduled, or whose addition is a doubling or cancels out, is added into the
+// |PointXYZZ| bucket instead, which is merged at the end. For random scalars
+// this rarely happens as long as the batch is small compared to the number of
+// buckets.
+//
+// NOTE: This is only usable when |kSupportsBatchAffineAccumulation<Point>| is
+// true.
+template <typename Point>
+class BatchAffineBucketAccumulator {
+ public:
+  using Curve = typename Point::Curve;
+  using BaseField = typename Point::BaseField;
+  using Bucket = PointXYZZ<Curve>;
+
+  constexpr static size_t kMaxBatchSize = 512;
+
+  BatchAffineBucketAccumulator() = default;
+  BatchAffineBucketAccumulator(const BatchAffineBucketAccumulator& other) =
+      delete;
+  BatchAffineBucketAccumulator& operator=(
+      const BatchAffineBucketAccumulator& other) = delete;
+  BatchAffineBucketAccumulator(BatchAffineBucketAccumulator&& other) = default;
+  BatchAffineBucketAccumulator& operator=(
+      BatchAffineBucketAccumulator&& other) = default;
+
+  // Adds (or subtracts if the digit is negative) the i-th base into the
+  // (|digits[i]| - 1)-th bucket of |buckets|. |buckets| must be zero on entry.
+  template <typename BaseInputIterator>
+  void Accumulate(absl::Span<const int32_t> digits,
+                  BaseInputIterator bases_it, absl::Span<Bucket> buckets) {
+    Prepare(buckets.size());
+    for (size_t i = 0; i < digits.size(); ++i, ++bases_it) {
+      int32_t digit = digits[i];
+      if (digit == 0 || bases_it->IsZero()) continue;
+      size_t index;
+      Point base = *bases_it;
+      if (0 < digit) {
+        index = static_cast<size_t>(digit - 1);
+      } else {
+        index = static_cast<size_t>(-digit - 1);
+        base.NegateInPlace();
+      }
+      Schedule(index, base, buckets);
+      if (batch_.size() == batch_size_) ApplyBatch();
+    }
+    ApplyBatch();
+
+    for (size_t i = 0; i < buckets.size(); ++i) {
+      if (!affine_buckets_[i].IsZero()) buckets[i] += affine_buckets_[i];
+    }
+  }
+
+ private:
+  struct Entry {
+    size_t index;
+    Point point;
+  };
+
+  void Prepare(size_t num_buckets) {
+    affine_buckets_.resize(num_buckets);
+    std::fill(affine_buckets_.begin(), affine_buckets_.end(), Point::Zero());
+    scheduled_.resize(num_buckets);
+    std::fill(scheduled_.begin(), scheduled_.end(), false);
+    batch_size_ = std::clamp(num_buckets / 2, size_t{1}, kMaxBatchSize);
+    batch_.reserve(batch_size_);
+    denominators_.reserve(batch_size_);
+  }
+
+  void Schedule(size_t index, const Point& point, absl::Span<Bucket> buckets) {
+    Point& affine_bucket = affine_buckets_[index];
+    if (scheduled_[index]) {
+      buckets[index] += point;
+      return;
+    }
+    if (affine_bucket.IsZero()) {
+      affine_bucket = point;
+      return;
+    }
+    if (affine_bucket.x() == point.x()) {
+      // Either a doubling or a cancellation, both of which can't be done with
+      // the batched formula.
+      buckets[index] += point;
+      return;
+    }
+    scheduled_[index] = true;
+    denominators_.push_back(point.x() - affine_bucket.x());
+    batch_.push_back({index, point});
+  }
+
+  // Computes R = P + Q for every scheduled addition, where
+  // λ = (Q.y - P.y) / (Q.x - P.x), R.x = λ² - P.x - Q.x and
+  // R.y = λ(P.x - R.x) - P.y.
+  void ApplyBatch() {
+    if (batch_.empty()) return;
+    // The denominators are never zero, since bases sharing their x-coordinate
+    // with the bucket are never scheduled.
+    CHECK(BaseField::BatchInverseInPlaceSerial(denominators_));
+    for (size_t i = 0; i < batch_.size(); ++i) {
+      const Entry& entry = batch_[i];
+      Point& affine_bucket = affine_buckets_[entry.index];
+      BaseField lambda =
+          (entry.point.y() - affine_bucket.y()) * denominators_[i];
+      BaseField x = lambda.Square() - affine_bucket.x() - entry.point.x();
+      BaseField y = lambda * (affine_bucket.x() - x) - affine_bucket.y();
+      affine_bucket = Point(std::move(x), std::move(y));
+      scheduled_[entry.index] = false;
+    }
+    batch_.clear();
+    denominators_.clear();
+  }
+
+  size_t batch_size_ = 1;
+  std::vector<Point> affine_buckets_;
+  std::vector<bool> scheduled_;
+  std::vector<Entry> batch_;
+  std::vector<BaseField> denominators_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_BUCKET_ACCUMULATOR_H_
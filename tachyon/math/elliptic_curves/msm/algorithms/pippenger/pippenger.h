@@ -7,14 +7,23 @@
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_H_
 
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/memory/default_init_allocator.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/base/time/trace_event.h"
 #include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_bucket_accumulator.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_workspace.h"
+#include "tachyon/math/elliptic_curves/msm/glv.h"
 #include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
 #include "tachyon/math/elliptic_curves/msm/msm_util.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
@@ -49,6 +58,41 @@ void FillDigits(const BigInt<N>& scalar, size_t window_bits,
   digits->back() += static_cast<int64_t>(carry << window_bits);
 }
 
+// Same as above, but passes the i-th digit to |set_digit(i, digit)| for
+// 0 ≤ i < |window_count|, so that no allocation happens per scalar.
+template <size_t N, typename Callback>
+void FillDigits(const BigInt<N>& scalar, size_t window_bits,
+                size_t window_count, Callback set_digit) {
+  uint64_t radix = 1 << window_bits;
+
+  uint64_t carry = 0;
+  size_t bit_offset = 0;
+  int64_t digit = 0;
+  for (size_t i = 0; i < window_count; ++i) {
+    uint64_t bits = scalar.ExtractBits64(bit_offset, window_bits);
+    uint64_t coeff = carry + bits;
+    carry = (coeff + radix / 2) >> window_bits;
+    digit = static_cast<int64_t>(coeff) -
+            static_cast<int64_t>(carry << window_bits);
+    if (i != window_count - 1) {
+      set_digit(i, static_cast<int32_t>(digit));
+    }
+    bit_offset += window_bits;
+  }
+  digit += static_cast<int64_t>(carry << window_bits);
+  set_digit(window_count - 1, static_cast<int32_t>(digit));
+}
+
+// Same as above, but writes the digits into |workspace|.
+template <size_t N, typename Bucket>
+void FillDigits(const BigInt<N>& scalar, size_t window_bits,
+                size_t scalar_index, PippengerWorkspace<Bucket>* workspace) {
+  FillDigits(scalar, window_bits, workspace->ctx().window_count,
+             [scalar_index, workspace](size_t window_index, int32_t digit) {
+               workspace->SetDigit(scalar_index, window_index, digit);
+             });
+}
+
 template <typename Point>
 class Pippenger : public PippengerBase<Point> {
  public:
@@ -56,21 +100,63 @@ class Pippenger : public PippengerBase<Point> {
   using Bucket = typename PippengerBase<Point>::Bucket;
 
   constexpr static size_t N = ScalarField::N;
+  // The smallest number of buckets reduced by a thread in
+  // |AccumulateWindowsByTerms()|.
+  constexpr static size_t kMinBucketsPerSegment = 64;
+  // See |SetUseSmallScalars()|.
+  constexpr static size_t kSmallScalarBits = 8;
 
   Pippenger() : use_msm_window_naf_(Point::kNegationIsCheap) {
 #if defined(TACHYON_HAS_OPENMP)
     parallel_windows_ = true;
 #endif  // defined(TACHYON_HAS_OPENMP)
   }
+  Pippenger(const Pippenger& other) = delete;
+  Pippenger& operator=(const Pippenger& other) = delete;
+  Pippenger(Pippenger&& other) = default;
+  Pippenger& operator=(Pippenger&& other) = default;
 
   void SetParallelWindows(bool parallel_windows) {
     parallel_windows_ = parallel_windows;
   }
 
+  // Accumulates the buckets in affine coordinates with batched inversions. See
+  // |BatchAffineBucketAccumulator|. This is ignored unless |Point| is an
+  // affine point.
+  void SetUseBatchAffine(bool use_batch_affine) {
+    use_batch_affine_ = use_batch_affine;
+  }
+
+  // Splits every scalar into two half-width scalars using the endomorphism of
+  // the curve. See |GLV::DecomposeFixedWidth()|. This doubles the number of
+  // bases, but halves the number of windows. This is ignored unless
+  // |kHasEndomorphism<Point>| is true.
+  void SetUseGLV(bool use_glv) { use_glv_ = use_glv; }
+
+  // Splits the scalars into the ones less than 2^|kSmallScalarBits|, which are
+  // added to the buckets of their values directly, or skipped if zero, and
+  // the rest, which are compacted and run over the windows, if at most half of
+  // them are the rest. This speeds up the MSMs of the boolean or sparse
+  // columns, which are run over the windows as a whole otherwise. This is
+  // enabled by default.
+  void SetUseSmallScalars(bool use_small_scalars) {
+    use_small_scalars_ = use_small_scalars;
+  }
+
+  // Sets the bits of a window, or 0 to choose it from the number of the
+  // scalars. See |MSMCtx::ComputeWindowsBits()|.
+  void SetWindowBits(size_t window_bits) { window_bits_ = window_bits; }
+
   void SetUseMSMWindowNAForTesting(bool use_msm_window_naf) {
     use_msm_window_naf_ = use_msm_window_naf;
   }
 
+  void SetThreadNumsForTesting(size_t thread_nums) {
+    thread_nums_for_testing_ = thread_nums;
+  }
+
+  const PippengerWorkspace<Bucket>& workspace() const { return workspace_; }
+
   template <typename BaseInputIterator, typename ScalarInputIterator,
             std::enable_if_t<IsAbleToMSM<BaseInputIterator, ScalarInputIterator,
                                          Point, ScalarField>>* = nullptr>
@@ -78,146 +164,503 @@ class Pippenger : public PippengerBase<Point> {
                          BaseInputIterator bases_last,
                          ScalarInputIterator scalars_first,
                          ScalarInputIterator scalars_last, Bucket* ret) {
+    TRACE_EVENT("msm", "Pippenger::Run");
     size_t bases_size = std::distance(bases_first, bases_last);
     size_t scalars_size = std::distance(scalars_first, scalars_last);
     if (bases_size != scalars_size) {
       LOG(ERROR) << "bases_size and scalars_size don't match";
       return false;
     }
-    ctx_ = MSMCtx::CreateDefault<ScalarField>(scalars_size);
+    if (use_small_scalars_ &&
+        TryRunWithSmallScalars(bases_first, scalars_first, scalars_size, ret)) {
+      return true;
+    }
+    return RunWindows(bases_first, scalars_first, scalars_size, ret);
+  }
 
-    std::vector<BigInt<N>> scalars;
-    scalars.resize(scalars_size);
-    auto scalars_it = scalars_first;
-    for (size_t i = 0; i < scalars_size; ++i, ++scalars_it) {
-      scalars[i] = scalars_it->ToBigInt();
+  // Computes |scalars_list.size()| MSMs over the same bases in a single pass.
+  // Each MSM has its own set of buckets, and for every window each base is
+  // loaded once and added into the buckets of every MSM whose digit is
+  // non-zero. A scalar container may be shorter than the bases, in which case
+  // the missing scalars are treated as zero.
+  // NOTE: |SetUseBatchAffine()| and |SetUseGLV()| are ignored here.
+  template <typename BaseInputIterator>
+  [[nodiscard]] bool RunBatch(
+      BaseInputIterator bases_first, BaseInputIterator bases_last,
+      absl::Span<const absl::Span<const ScalarField>> scalars_list,
+      absl::Span<Bucket> rets) {
+    TRACE_EVENT("msm", "Pippenger::RunBatch");
+    CHECK_EQ(scalars_list.size(), rets.size());
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t size = 0;
+    for (absl::Span<const ScalarField> scalars : scalars_list) {
+      if (scalars.size() > bases_size) {
+        LOG(ERROR) << "Too many scalars: " << scalars.size() << " > "
+                   << bases_size;
+        return false;
+      }
+      size = std::max(size, scalars.size());
+    }
+    if (size == 0) {
+      std::fill(rets.begin(), rets.end(), Bucket::Zero());
+      return true;
     }
 
-    std::vector<Bucket> window_sums(ctx_.window_count);
+    MSMCtx ctx = CreateCtx(size);
+    size_t batch_size = scalars_list.size();
+    batch_digits_.resize(size_t{ctx.window_count} * size * batch_size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      for (size_t k = 0; k < batch_size; ++k) {
+        absl::Span<const ScalarField> scalars = scalars_list[k];
+        BigInt<N> scalar =
+            i < scalars.size() ? scalars[i].ToBigInt() : BigInt<N>();
+        auto set_digit = [this, size, batch_size, i, k](
+                             size_t window_index, int32_t digit) {
+          batch_digits_[(window_index * size + i) * batch_size + k] = digit;
+        };
+        if (use_msm_window_naf_) {
+          FillDigits(scalar, ctx.window_bits, ctx.window_count, set_digit);
+        } else {
+          for (size_t j = 0; j < ctx.window_count; ++j) {
+            set_digit(j, static_cast<int32_t>(scalar.ExtractBits64(
+                             ctx.window_bits * j, ctx.window_bits)));
+          }
+        }
+      }
+    }
 
-    if (use_msm_window_naf_) {
-      AccumulateWindowNAFSums(std::move(bases_first), scalars, &window_sums);
+    size_t bucket_sets = parallel_windows_ ? ctx.window_count : 1;
+    size_t bucket_size = GetBucketSize(ctx, ctx.window_count - 1);
+    batch_buckets_.resize(std::max(batch_buckets_.size(),
+                                   bucket_sets * batch_size * bucket_size));
+    batch_window_sums_.resize(batch_size * ctx.window_count);
+    if (parallel_windows_) {
+      OPENMP_PARALLEL_FOR(size_t j = 0; j < ctx.window_count; ++j) {
+        AccumulateBatchWindowSums(bases_first, ctx, batch_size, j, j);
+      }
     } else {
-      AccumulateWindowSums(std::move(bases_first), scalars, &window_sums);
+      for (size_t j = 0; j < ctx.window_count; ++j) {
+        AccumulateBatchWindowSums(bases_first, ctx, batch_size, j, 0);
+      }
+    }
+    for (size_t k = 0; k < batch_size; ++k) {
+      rets[k] = PippengerBase<Point>::AccumulateWindowSums(
+          absl::MakeConstSpan(batch_window_sums_)
+              .subspan(k * ctx.window_count, ctx.window_count),
+          ctx.window_bits);
     }
-
-    *ret = PippengerBase<Point>::AccumulateWindowSums(window_sums,
-                                                      ctx_.window_bits);
     return true;
   }
 
  private:
-  template <typename BaseInputIterator>
-  void AccumulateSingleWindowNAFSum(
-      BaseInputIterator bases_it,
-      const std::vector<std::vector<int64_t>>& scalar_digits, size_t i,
-      Bucket* window_sum, bool is_last_window) {
-    size_t bucket_size;
-    if (is_last_window) {
-      bucket_size = 1 << ctx_.window_bits;
-    } else {
-      bucket_size = 1 << (ctx_.window_bits - 1);
+  // The value of |small_scalars_| for a scalar that is not small.
+  constexpr static uint32_t kLargeScalar = std::numeric_limits<uint32_t>::max();
+
+  template <typename BaseInputIterator, typename ScalarInputIterator>
+  [[nodiscard]] bool RunWindows(BaseInputIterator bases_first,
+                                ScalarInputIterator scalars_first,
+                                size_t scalars_size, Bucket* ret) {
+    if constexpr (kHasEndomorphism<Point>) {
+      if (use_glv_) {
+        return RunWithGLV(bases_first, scalars_first, scalars_size, ret);
+      }
     }
-    std::vector<Bucket> buckets(bucket_size);
-    for (size_t j = 0; j < scalar_digits.size(); ++j, ++bases_it) {
-      const Point& base = *bases_it;
-      int64_t scalar = scalar_digits[j][i];
-      if (0 < scalar) {
-        buckets[static_cast<uint64_t>(scalar - 1)] += base;
-      } else if (0 > scalar) {
-        buckets[static_cast<uint64_t>(-scalar - 1)] -= base;
+
+    Prepare(CreateCtx(scalars_size));
+    FillWindowDigits([scalars_first](size_t i) {
+      return std::next(scalars_first, i)->ToBigInt();
+    });
+    *ret = AccumulateWindows(bases_first);
+    return true;
+  }
+
+  // Runs the MSM as described in |SetUseSmallScalars()|. Returns false without
+  // running it if more than half of the scalars are not small.
+  template <typename BaseInputIterator, typename ScalarInputIterator>
+  bool TryRunWithSmallScalars(BaseInputIterator bases_first,
+                              ScalarInputIterator scalars_first,
+                              size_t scalars_size, Bucket* ret) {
+    TRACE_EVENT("msm", "Pippenger::TryRunWithSmallScalars");
+    small_scalars_.resize(scalars_size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars_size; ++i) {
+      BigInt<N> scalar = std::next(scalars_first, i)->ToBigInt();
+      bool is_small = scalar[0] < (uint64_t{1} << kSmallScalarBits);
+      for (size_t j = 1; j < N && is_small; ++j) {
+        is_small = scalar[j] == 0;
       }
+      small_scalars_[i] =
+          is_small ? static_cast<uint32_t>(scalar[0]) : kLargeScalar;
     }
-    *window_sum = PippengerBase<Point>::AccumulateBuckets(buckets);
+    size_t large_count = 0;
+    uint32_t max_small_scalar = 0;
+    for (uint32_t small_scalar : small_scalars_) {
+      if (small_scalar == kLargeScalar) {
+        ++large_count;
+      } else {
+        max_small_scalar = std::max(max_small_scalar, small_scalar);
+      }
+    }
+    if (large_count * 2 > scalars_size) return false;
+
+    *ret = Bucket::Zero();
+    if (large_count != 0) {
+      compacted_bases_.resize(large_count);
+      compacted_scalars_.resize(large_count);
+      size_t j = 0;
+      for (size_t i = 0; i < scalars_size; ++i) {
+        if (small_scalars_[i] != kLargeScalar) continue;
+        compacted_bases_[j] = *std::next(bases_first, i);
+        compacted_scalars_[j] = *std::next(scalars_first, i);
+        ++j;
+      }
+      CHECK(RunWindows(compacted_bases_.begin(), compacted_scalars_.begin(),
+                       large_count, ret));
+    }
+
+    // The small scalars are their own digits of a single window, whose
+    // buckets are accumulated by every thread over its range of the bases.
+    if (max_small_scalar == 0) return true;
+    size_t thread_nums = std::min(GetThreadNums(), scalars_size);
+    size_t range_size = (scalars_size + thread_nums - 1) / thread_nums;
+    small_scalar_sums_.resize(thread_nums);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < thread_nums; ++i) {
+      std::vector<Bucket> buckets(max_small_scalar, Bucket::Zero());
+      size_t end = std::min((i + 1) * range_size, scalars_size);
+      for (size_t j = i * range_size; j < end; ++j) {
+        uint32_t small_scalar = small_scalars_[j];
+        if (small_scalar == 0 || small_scalar == kLargeScalar) continue;
+        buckets[small_scalar - 1] += *std::next(bases_first, j);
+      }
+      small_scalar_sums_[i] = PippengerBase<Point>::AccumulateBuckets(buckets);
+    }
+    for (const Bucket& small_scalar_sum : small_scalar_sums_) {
+      *ret += small_scalar_sum;
+    }
+    return true;
   }
 
-  template <typename BaseInputIterator>
-  void AccumulateWindowNAFSums(BaseInputIterator bases_first,
-                               absl::Span<const BigInt<N>> scalars,
-                               std::vector<Bucket>* window_sums) {
-    std::vector<std::vector<int64_t>> scalar_digits;
-    scalar_digits.resize(scalars.size());
-    for (std::vector<int64_t>& scalar_digit : scalar_digits) {
-      scalar_digit.resize(ctx_.window_count);
+  // Splits every scalar k into k1 + lambda k2 and runs the MSM on the bases
+  // gᵢ and φ(gᵢ) with the half-width scalars |k1| and |k2|, whose signs are
+  // folded into the bases.
+  template <typename BaseInputIterator, typename ScalarInputIterator>
+  [[nodiscard]] bool RunWithGLV(BaseInputIterator bases_first,
+                                ScalarInputIterator scalars_first,
+                                size_t scalars_size, Bucket* ret) {
+    size_t size = scalars_size * 2;
+    glv_bases_.resize(size);
+    glv_scalars_.resize(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars_size; ++i) {
+      typename GLV<Point>::FixedWidthDecompositionResult result =
+          GLV<Point>::DecomposeFixedWidth(*std::next(scalars_first, i));
+      const Point& base = *std::next(bases_first, i);
+      Point b1 = base;
+      Point b2 = GLV<Point>::Endomorphism(base);
+      if (result.k1_is_negative) b1.NegateInPlace();
+      if (result.k2_is_negative) b2.NegateInPlace();
+      glv_bases_[2 * i] = std::move(b1);
+      glv_bases_[2 * i + 1] = std::move(b2);
+      glv_scalars_[2 * i] = std::move(result.k1);
+      glv_scalars_[2 * i + 1] = std::move(result.k2);
     }
-    for (size_t i = 0; i < scalars.size(); ++i) {
-      FillDigits(scalars[i], ctx_.window_bits, &scalar_digits[i]);
+
+    // The half-width scalars are roughly |kModulusBits| / 2 bits long, so only
+    // the windows covering their actual bit length are needed.
+    BigInt<N> scalars_or;
+    for (const BigInt<N>& scalar : glv_scalars_) {
+      scalars_or |= scalar;
     }
-    if (parallel_windows_) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
-                                     &(*window_sums)[i],
-                                     i == ctx_.window_count - 1);
+    MSMCtx ctx;
+    ctx.window_bits =
+        window_bits_ != 0 ? window_bits_ : MSMCtx::ComputeWindowsBits(size);
+    ctx.window_count = std::max(
+        size_t{1},
+        (ComputeBitLength(scalars_or) + ctx.window_bits - 1) / ctx.window_bits);
+    ctx.size = size;
+
+    Prepare(ctx);
+    FillWindowDigits([this](size_t i) { return glv_scalars_[i]; });
+    *ret = AccumulateWindows(glv_bases_.begin());
+    return true;
+  }
+
+  MSMCtx CreateCtx(size_t size) const {
+    if (window_bits_ == 0) return MSMCtx::CreateDefault<ScalarField>(size);
+    return MSMCtx::Create<ScalarField>(size, window_bits_);
+  }
+
+  void Prepare(const MSMCtx& ctx) {
+    // The last window of the signed digits needs twice as many buckets, since
+    // it also holds the final carry.
+    size_t bucket_size = use_msm_window_naf_ ? size_t{1} << ctx.window_bits
+                                             : (size_t{1} << ctx.window_bits) - 1;
+    thread_nums_ = GetThreadNums();
+    term_splits_ = ComputeTermSplits(ctx, bucket_size);
+    size_t bucket_sets =
+        parallel_windows_ ? ctx.window_count * term_splits_ : 1;
+    workspace_.Prepare(ctx, bucket_sets, bucket_size);
+    if constexpr (kSupportsBatchAffineAccumulation<Point>) {
+      if (use_batch_affine_ &&
+          batch_affine_accumulators_.size() < bucket_sets) {
+        batch_affine_accumulators_.resize(bucket_sets);
+      }
+    }
+  }
+
+  // |get_scalar(i)| returns the i-th scalar as a |BigInt<N>|.
+  template <typename Callback>
+  void FillWindowDigits(Callback get_scalar) {
+    TRACE_EVENT("msm", "Pippenger::FillWindowDigits");
+    const MSMCtx& ctx = workspace_.ctx();
+    if (use_msm_window_naf_) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx.size; ++i) {
+        FillDigits(get_scalar(i), ctx.window_bits, i, &workspace_);
       }
     } else {
-      for (size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
-                                     &(*window_sums)[i],
-                                     i == ctx_.window_count - 1);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx.size; ++i) {
+        BigInt<N> scalar = get_scalar(i);
+        for (size_t j = 0; j < ctx.window_count; ++j) {
+          // We take |window_bits| bits starting from the j-th window. If the
+          // scalar is non-zero, we update the corresponding bucket.
+          // (Recall that buckets don't have a zero bucket.)
+          workspace_.SetDigit(i, j,
+                              static_cast<int32_t>(scalar.ExtractBits64(
+                                  ctx.window_bits * j, ctx.window_bits)));
+        }
       }
     }
   }
 
   template <typename BaseInputIterator>
-  void AccumulateSingleWindowSum(BaseInputIterator bases_first,
-                                 absl::Span<const BigInt<N>> scalars,
-                                 size_t window_offset, Bucket* out) {
-    Bucket window_sum = Bucket::Zero();
-    // We don't need the "zero" bucket, so we only have 2^{window_bits} - 1
-    // buckets.
-    std::vector<Bucket> buckets((1 << ctx_.window_bits) - 1);
-    auto bases_it = bases_first;
-    for (size_t j = 0; j < scalars.size(); ++j, ++bases_it) {
-      const BigInt<N>& scalar = scalars[j];
-      if (scalar.IsZero()) continue;
+  Bucket AccumulateWindows(BaseInputIterator bases_first) {
+    TRACE_EVENT("msm", "Pippenger::AccumulateWindows");
+    const MSMCtx& ctx = workspace_.ctx();
+    std::vector<Bucket>& window_sums = workspace_.window_sums();
+    if (parallel_windows_ && term_splits_ > 1) {
+      AccumulateWindowsByTerms(bases_first);
+    } else if (parallel_windows_) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx.window_count; ++i) {
+        AccumulateSingleWindowSum(bases_first, i, i, &window_sums[i]);
+      }
+    } else {
+      for (size_t i = 0; i < ctx.window_count; ++i) {
+        AccumulateSingleWindowSum(bases_first, i, 0, &window_sums[i]);
+      }
+    }
+    return PippengerBase<Point>::AccumulateWindowSums(window_sums,
+                                                      ctx.window_bits);
+  }
 
-      const Point& base = *bases_it;
-      if (scalar.IsOne()) {
-        // We only process unit scalars once in the first window.
-        if (window_offset == 0) {
-          window_sum += base;
+  size_t GetThreadNums() const {
+    if (thread_nums_for_testing_ != 0) return thread_nums_for_testing_;
+#if defined(TACHYON_HAS_OPENMP)
+    // A nested parallel region, e.g., inside |PippengerAdapter|, runs
+    // serially.
+    if (omp_in_parallel()) return 1;
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+  }
+
+  // When there are more threads than windows, windows alone can't keep every
+  // thread busy. Then the bases of each window are split into
+  // |term_splits_| ranges, each accumulated into its own set of buckets, so
+  // that there are about |thread_nums_| units of work.
+  size_t ComputeTermSplits(const MSMCtx& ctx, size_t bucket_size) const {
+    if (!parallel_windows_ || thread_nums_ <= ctx.window_count) return 1;
+    if constexpr (kSupportsBatchAffineAccumulation<Point>) {
+      if (use_batch_affine_) return 1;
+    }
+    // A range should have more bases than buckets, otherwise merging the
+    // bucket sets costs more than the additions it parallelizes.
+    size_t max_term_splits = std::max(size_t{1}, ctx.size / bucket_size);
+    return std::min(thread_nums_ / ctx.window_count, max_term_splits);
+  }
+
+  // Accumulates every window sum into |workspace_.window_sums()| with the bases
+  // of each window split into |term_splits_| ranges. The bucket sets of each
+  // window are then merged and reduced by segments of buckets in parallel. See
+  // |PippengerBase::AccumulateBucketSegment()|.
+  template <typename BaseInputIterator>
+  void AccumulateWindowsByTerms(BaseInputIterator bases_first) {
+    const MSMCtx& ctx = workspace_.ctx();
+    size_t range_size = (ctx.size + term_splits_ - 1) / term_splits_;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx.window_count * term_splits_;
+                        ++i) {
+      size_t window_index = i / term_splits_;
+      size_t start =
+          std::min((i % term_splits_) * range_size, size_t{ctx.size});
+      absl::Span<Bucket> buckets =
+          workspace_.GetBuckets(i, GetBucketSize(ctx, window_index));
+      absl::Span<const int32_t> digits =
+          std::as_const(workspace_).GetDigits(window_index);
+      AddBasesToBuckets(std::next(bases_first, start),
+                        digits.subspan(start, range_size), buckets);
+    }
+
+    // The bucket sets of each window are merged into the first one segment by
+    // segment, and each segment is reduced right after it is merged.
+    size_t segment_count = std::max(
+        size_t{1}, std::min(thread_nums_ / ctx.window_count,
+                            GetBucketSize(ctx, 0) / kMinBucketsPerSegment));
+    segment_sums_.resize(ctx.window_count * segment_count);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx.window_count * segment_count;
+                        ++i) {
+      size_t window_index = i / segment_count;
+      size_t bucket_size = GetBucketSize(ctx, window_index);
+      size_t segment_size = (bucket_size + segment_count - 1) / segment_count;
+      size_t offset = std::min((i % segment_count) * segment_size, bucket_size);
+      size_t len = std::min(segment_size, bucket_size - offset);
+      absl::Span<Bucket> segment =
+          workspace_
+              .GetBucketsWithoutReset(window_index * term_splits_, bucket_size)
+              .subspan(offset, len);
+      for (size_t j = 1; j < term_splits_; ++j) {
+        absl::Span<const Bucket> other =
+            workspace_
+                .GetBucketsWithoutReset(window_index * term_splits_ + j,
+                                        bucket_size)
+                .subspan(offset, len);
+        for (size_t k = 0; k < len; ++k) {
+          segment[k] += other[k];
         }
+      }
+      segment_sums_[i] =
+          PippengerBase<Point>::AccumulateBucketSegment(segment, offset);
+    }
+
+    std::vector<Bucket>& window_sums = workspace_.window_sums();
+    for (size_t i = 0; i < ctx.window_count; ++i) {
+      window_sums[i] = std::accumulate(
+          segment_sums_.begin() + i * segment_count,
+          segment_sums_.begin() + (i + 1) * segment_count, Bucket::Zero());
+    }
+  }
+
+  static size_t ComputeBitLength(const BigInt<N>& value) {
+    for (size_t i = N; i > 0; --i) {
+      if (value[i - 1] != 0) {
+        return (i - 1) * 64 + base::bits::Log2Floor(value[i - 1]) + 1;
+      }
+    }
+    return 0;
+  }
+
+  size_t GetBucketSize(const MSMCtx& ctx, size_t window_index) const {
+    if (use_msm_window_naf_) {
+      if (window_index == ctx.window_count - 1) {
+        return size_t{1} << ctx.window_bits;
       } else {
-        BigInt<N> scalar_tmp = scalar;
-        // We right-shift by |window_offset|, thus getting rid of the lower
-        // bits.
-        scalar_tmp.DivBy2ExpInPlace(window_offset);
-
-        // We mod the remaining bits by 2^{window_bits}, thus taking
-        // |window_bits|.
-        uint64_t idx = scalar_tmp[0] % (1 << ctx_.window_bits);
-
-        // If the scalar is non-zero, we update the corresponding
-        // bucket.
-        // (Recall that |buckets| doesn't have a zero bucket.)
-        if (idx != 0) {
-          buckets[idx - 1] += base;
+        return size_t{1} << (ctx.window_bits - 1);
+      }
+    } else {
+      // We don't need the "zero" bucket, so we only have 2^{window_bits} - 1
+      // buckets.
+      return (size_t{1} << ctx.window_bits) - 1;
+    }
+  }
+
+  // Accumulates the |window_index|-th window sum of every MSM of
+  // |RunBatch()| into |batch_window_sums_|, using the |bucket_set_index|-th
+  // group of |batch_size| bucket sets.
+  template <typename BaseInputIterator>
+  void AccumulateBatchWindowSums(BaseInputIterator bases_it, const MSMCtx& ctx,
+                                 size_t batch_size, size_t window_index,
+                                 size_t bucket_set_index) {
+    size_t max_bucket_size = GetBucketSize(ctx, ctx.window_count - 1);
+    size_t bucket_size = GetBucketSize(ctx, window_index);
+    Bucket* buckets =
+        &batch_buckets_[bucket_set_index * batch_size * max_bucket_size];
+    std::fill(buckets, buckets + batch_size * max_bucket_size, Bucket::Zero());
+    const int32_t* digits =
+        &batch_digits_[window_index * ctx.size * batch_size];
+    for (size_t i = 0; i < ctx.size; ++i, ++bases_it) {
+      const Point& base = *bases_it;
+      for (size_t k = 0; k < batch_size; ++k) {
+        int32_t digit = digits[i * batch_size + k];
+        if (0 < digit) {
+          buckets[k * max_bucket_size + static_cast<size_t>(digit - 1)] += base;
+        } else if (0 > digit) {
+          buckets[k * max_bucket_size + static_cast<size_t>(-digit - 1)] -=
+              base;
         }
       }
     }
-    *out = PippengerBase<Point>::AccumulateBuckets(buckets, window_sum);
+    for (size_t k = 0; k < batch_size; ++k) {
+      batch_window_sums_[k * ctx.window_count + window_index] =
+          PippengerBase<Point>::AccumulateBuckets(absl::MakeConstSpan(
+              buckets + k * max_bucket_size, bucket_size));
+    }
   }
 
   template <typename BaseInputIterator>
-  void AccumulateWindowSums(BaseInputIterator bases_first,
-                            absl::Span<const BigInt<N>> scalars,
-                            std::vector<Bucket>* window_sums) {
-    if (parallel_windows_) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowSum(bases_first, scalars, ctx_.window_bits * i,
-                                  &(*window_sums)[i]);
+  void AccumulateSingleWindowSum(BaseInputIterator bases_it,
+                                 size_t window_index, size_t bucket_set_index,
+                                 Bucket* window_sum) {
+    absl::Span<Bucket> buckets = workspace_.GetBuckets(
+        bucket_set_index, GetBucketSize(workspace_.ctx(), window_index));
+    absl::Span<const int32_t> digits =
+        std::as_const(workspace_).GetDigits(window_index);
+    if constexpr (kSupportsBatchAffineAccumulation<Point>) {
+      if (use_batch_affine_) {
+        batch_affine_accumulators_[bucket_set_index].Accumulate(
+            digits, bases_it, buckets);
+        *window_sum = PippengerBase<Point>::AccumulateBuckets(buckets);
+        return;
       }
-    } else {
-      for (size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowSum(bases_first, scalars, ctx_.window_bits * i,
-                                  &(*window_sums)[i]);
+    }
+    AddBasesToBuckets(bases_it, digits, buckets);
+    *window_sum = PippengerBase<Point>::AccumulateBuckets(buckets);
+  }
+
+  template <typename BaseInputIterator>
+  static void AddBasesToBuckets(BaseInputIterator bases_it,
+                                absl::Span<const int32_t> digits,
+                                absl::Span<Bucket> buckets) {
+    for (size_t j = 0; j < digits.size(); ++j, ++bases_it) {
+      int32_t digit = digits[j];
+      if (0 < digit) {
+        buckets[static_cast<size_t>(digit - 1)] += *bases_it;
+      } else if (0 > digit) {
+        buckets[static_cast<size_t>(-digit - 1)] -= *bases_it;
       }
     }
   }
 
   bool use_msm_window_naf_ = false;
   bool parallel_windows_ = false;
-  MSMCtx ctx_;
+  bool use_batch_affine_ = false;
+  bool use_glv_ = false;
+  bool use_small_scalars_ = true;
+  size_t window_bits_ = 0;
+  size_t thread_nums_for_testing_ = 0;
+  // These are updated by |Prepare()|.
+  size_t thread_nums_ = 1;
+  // The number of ranges the bases of a window are split into. See
+  // |ComputeTermSplits()|.
+  size_t term_splits_ = 1;
+  PippengerWorkspace<Bucket> workspace_;
+  std::vector<BatchAffineBucketAccumulator<Point>> batch_affine_accumulators_;
+  // These are only used when |use_glv_| is true.
+  // NOTE: Every element of these is overwritten before it is read, so they
+  // are not value-initialized when they grow.
+  base::UninitializedVector<Point> glv_bases_;
+  base::UninitializedVector<BigInt<N>> glv_scalars_;
+  // These are only used when |use_small_scalars_| is true. See
+  // |TryRunWithSmallScalars()|.
+  base::UninitializedVector<uint32_t> small_scalars_;
+  base::UninitializedVector<Point> compacted_bases_;
+  base::UninitializedVector<ScalarField> compacted_scalars_;
+  std::vector<Bucket> small_scalar_sums_;
+  // These are only used by |RunBatch()|.
+  // |batch_digits_[(j * size + i) * batch_size + k]| is the j-th window digit
+  // of the i-th scalar of the k-th MSM, so that the digits of every MSM for a
+  // base are contiguous.
+  base::UninitializedVector<int32_t> batch_digits_;
+  std::vector<Bucket> batch_buckets_;
+  std::vector<Bucket> batch_window_sums_;
+  // This is only used by |AccumulateWindowsByTerms()|.
+  std::vector<Bucket> segment_sums_;
 };
 
 }  // namespace tachyon::math
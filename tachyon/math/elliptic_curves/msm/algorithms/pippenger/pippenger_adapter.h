@@ -2,10 +2,20 @@
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_ADAPTER_H_
 
 #include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/tuning_profile.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/msm_tuning_cache.h"
 
 namespace tachyon::math {
 
@@ -16,20 +26,92 @@ enum class PippengerParallelStrategy {
   kParallelWindowAndTerm,
 };
 
+constexpr std::string_view PippengerParallelStrategyToString(
+    PippengerParallelStrategy strategy) {
+  switch (strategy) {
+    case PippengerParallelStrategy::kNone:
+      return "none";
+    case PippengerParallelStrategy::kParallelWindow:
+      return "parallel_window";
+    case PippengerParallelStrategy::kParallelTerm:
+      return "parallel_term";
+    case PippengerParallelStrategy::kParallelWindowAndTerm:
+      return "parallel_window_and_term";
+  }
+  return "";
+}
+
+inline bool StringToPippengerParallelStrategy(
+    std::string_view str, PippengerParallelStrategy* strategy) {
+  for (PippengerParallelStrategy candidate :
+       {PippengerParallelStrategy::kNone,
+        PippengerParallelStrategy::kParallelWindow,
+        PippengerParallelStrategy::kParallelTerm,
+        PippengerParallelStrategy::kParallelWindowAndTerm}) {
+    if (str == PippengerParallelStrategyToString(candidate)) {
+      *strategy = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+enum class PippengerAccumulationStrategy {
+  // Adds bases into |Bucket|s.
+  kDefault,
+  // Adds bases into affine buckets with batched inversions. See
+  // |BatchAffineBucketAccumulator|. This falls back to |kDefault| unless
+  // |Point| is an affine point.
+  kBatchAffine,
+};
+
 template <typename Point>
 class PippengerAdapter {
  public:
   using ScalarField = typename Point::ScalarField;
   using Bucket = typename Pippenger<Point>::Bucket;
 
+  void SetAccumulationStrategy(PippengerAccumulationStrategy strategy) {
+    accumulation_strategy_ = strategy;
+  }
+
+  // See |Pippenger::SetUseGLV()|.
+  void SetUseGLV(bool use_glv) { use_glv_ = use_glv; }
+
+  // See |Pippenger::SetWindowBits()|.
+  void SetWindowBits(size_t window_bits) { window_bits_ = window_bits; }
+
+  // If set, |Run()| takes the window size of each size of the MSMs from
+  // |tuning_cache|, which measures the candidates around the default one by
+  // the first MSM of the size. This is ignored if |SetWindowBits()| is set.
+  void SetTuningCache(MSMTuningCache* tuning_cache) {
+    tuning_cache_ = tuning_cache;
+  }
+
   template <typename BaseInputIterator, typename ScalarInputIterator>
   [[nodiscard]] bool Run(BaseInputIterator bases_first,
                          BaseInputIterator bases_last,
                          ScalarInputIterator scalars_first,
                          ScalarInputIterator scalars_last, Bucket* ret) {
-    return RunWithStrategy(std::move(bases_first), std::move(bases_last),
-                           std::move(scalars_first), std::move(scalars_last),
-                           PippengerParallelStrategy::kParallelTerm, ret);
+    size_t scalars_size = std::distance(scalars_first, scalars_last);
+    PippengerParallelStrategy strategy = GetParallelStrategy(scalars_size);
+    if (tuning_cache_ == nullptr || window_bits_ != 0 || scalars_size == 0) {
+      return RunWithStrategy(std::move(bases_first), std::move(bases_last),
+                             std::move(scalars_first), std::move(scalars_last),
+                             strategy, ret);
+    }
+
+    MSMTuningCache::Key key = {GetDeviceName(), Point::Curve::Config::kName,
+                               base::bits::SafeLog2Ceiling(scalars_size)};
+    bool success = tuning_cache_->Run(
+        key, GetCandidates(scalars_size),
+        [&](const MSMTuningCache::Entry& entry) {
+          window_bits_ = entry.window_bits;
+          return RunWithStrategy(bases_first, bases_last, scalars_first,
+                                 scalars_last, strategy, ret);
+        });
+    window_bits_ = 0;
+    return success;
   }
 
   template <typename BaseInputIterator, typename ScalarInputIterator>
@@ -41,9 +123,13 @@ class PippengerAdapter {
                                      Bucket* ret) {
     if (strategy == PippengerParallelStrategy::kNone ||
         strategy == PippengerParallelStrategy::kParallelWindow) {
-      Pippenger<Point> pippenger;
+      if (pippengers_.empty()) pippengers_.resize(1);
+      Pippenger<Point>& pippenger = pippengers_[0];
       pippenger.SetParallelWindows(strategy ==
                                    PippengerParallelStrategy::kParallelWindow);
+      pippenger.SetUseBatchAffine(UseBatchAffine());
+      pippenger.SetUseGLV(use_glv_);
+      pippenger.SetWindowBits(window_bits_);
       return pippenger.Run(std::move(bases_first), std::move(bases_last),
                            std::move(scalars_first), std::move(scalars_last),
                            ret);
@@ -70,24 +156,23 @@ class PippengerAdapter {
 #else
       int thread_nums = 1;
 #endif  // defined(TACHYON_HAS_OPENMP)
-      struct Result {
-        Bucket value;
-        bool valid;
-      };
-
 #if defined(TACHYON_HAS_OPENMP)
       omp_set_num_threads(thread_nums);
 #endif
       size_t chunk_size = (scalars_size + thread_nums - 1) / thread_nums;
       size_t num_chunks = (scalars_size + chunk_size - 1) / chunk_size;
-      std::vector<Result> results;
+      std::vector<Result>& results = results_;
       results.resize(num_chunks);
+      if (pippengers_.size() < num_chunks) pippengers_.resize(num_chunks);
       OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
         size_t start = i * chunk_size;
         size_t len = i == num_chunks - 1 ? scalars_size - start : chunk_size;
-        Pippenger<Point> pippenger;
+        Pippenger<Point>& pippenger = pippengers_[i];
         pippenger.SetParallelWindows(
             strategy == PippengerParallelStrategy::kParallelWindowAndTerm);
+        pippenger.SetUseBatchAffine(UseBatchAffine());
+        pippenger.SetUseGLV(use_glv_);
+        pippenger.SetWindowBits(window_bits_);
         auto bases_start = bases_first + start;
         auto bases_end = bases_start + len;
         auto scalars_start = scalars_first + start;
@@ -108,6 +193,146 @@ class PippengerAdapter {
       return true;
     }
   }
+
+  // Computes |scalars_list.size()| MSMs over the same bases. The bases are
+  // split into chunks run on each thread by |Pippenger::RunBatch()|, so every
+  // chunk of bases is loaded once for all the MSMs.
+  template <typename BaseInputIterator>
+  [[nodiscard]] bool RunBatch(
+      BaseInputIterator bases_first, BaseInputIterator bases_last,
+      absl::Span<const absl::Span<const ScalarField>> scalars_list,
+      absl::Span<Bucket> rets) {
+    CHECK_EQ(scalars_list.size(), rets.size());
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t size = 0;
+    for (absl::Span<const ScalarField> scalars : scalars_list) {
+      if (scalars.size() > bases_size) {
+        LOG(ERROR) << "Too many scalars: " << scalars.size() << " > "
+                   << bases_size;
+        return false;
+      }
+      size = std::max(size, scalars.size());
+    }
+    if (size == 0) {
+      std::fill(rets.begin(), rets.end(), Bucket::Zero());
+      return true;
+    }
+
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+    size_t batch_size = scalars_list.size();
+    size_t chunk_size = (size + thread_nums - 1) / thread_nums;
+    size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    // |results[i * batch_size + k]| holds the k-th MSM of the i-th chunk.
+    std::vector<Result>& results = results_;
+    results.resize(num_chunks * batch_size);
+    if (pippengers_.size() < num_chunks) pippengers_.resize(num_chunks);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+      size_t start = i * chunk_size;
+      size_t len = i == num_chunks - 1 ? size - start : chunk_size;
+      std::vector<absl::Span<const ScalarField>> chunk_scalars_list =
+          base::Map(scalars_list,
+                    [start, len](absl::Span<const ScalarField> scalars) {
+                      if (start >= scalars.size()) {
+                        return absl::Span<const ScalarField>();
+                      }
+                      return scalars.subspan(start, len);
+                    });
+      std::vector<Bucket> chunk_rets(batch_size);
+      Pippenger<Point>& pippenger = pippengers_[i];
+      pippenger.SetParallelWindows(false);
+      pippenger.SetWindowBits(window_bits_);
+      auto bases_start = bases_first + start;
+      auto bases_end = bases_start + len;
+      bool valid =
+          pippenger.RunBatch(bases_start, bases_end, chunk_scalars_list,
+                             absl::MakeSpan(chunk_rets));
+      for (size_t k = 0; k < batch_size; ++k) {
+        results[i * batch_size + k] = {std::move(chunk_rets[k]), valid};
+      }
+    }
+
+    bool all_good =
+        std::all_of(results.begin(), results.end(),
+                    [](const Result& result) { return result.valid; });
+    if (!all_good) return false;
+
+    for (size_t k = 0; k < batch_size; ++k) {
+      Bucket ret = Bucket::Zero();
+      for (size_t i = 0; i < num_chunks; ++i) {
+        ret += results[i * batch_size + k].value;
+      }
+      rets[k] = std::move(ret);
+    }
+    return true;
+  }
+
+ private:
+  struct Result {
+    Bucket value;
+    bool valid;
+  };
+
+  // Returns the strategy of the tuning profile for the MSMs of |size| if it
+  // is set, or |kParallelTerm| otherwise. See |base::TuningProfile|.
+  static PippengerParallelStrategy GetParallelStrategy(size_t size) {
+    PippengerParallelStrategy strategy =
+        PippengerParallelStrategy::kParallelTerm;
+    std::optional<std::string> value = base::TuningProfile::GetDefault().Get(
+        base::TuningProfile::kPippengerParallelStrategy, size);
+    if (value.has_value() &&
+        !StringToPippengerParallelStrategy(*value, &strategy)) {
+      LOG(ERROR) << "Invalid pippenger parallel strategy: " << *value;
+    }
+    return strategy;
+  }
+
+  bool UseBatchAffine() const {
+    return accumulation_strategy_ ==
+           PippengerAccumulationStrategy::kBatchAffine;
+  }
+
+  static size_t GetMaxThreads() {
+#if defined(TACHYON_HAS_OPENMP)
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+  }
+
+  // NOTE: The options that change the accumulation are a part of the name, so
+  // that they are tuned separately.
+  std::string GetDeviceName() const {
+    return absl::StrCat("cpu(", GetMaxThreads(), " threads",
+                        use_glv_ ? ", glv" : "",
+                        UseBatchAffine() ? ", batch_affine" : "", ")");
+  }
+
+  // Returns the windows around the default one of the MSM run on each thread.
+  static std::vector<MSMTuningCache::Entry> GetCandidates(size_t size) {
+    size_t max_threads = GetMaxThreads();
+    unsigned int window_bits =
+        MSMCtx::ComputeWindowsBits((size + max_threads - 1) / max_threads);
+    std::vector<MSMTuningCache::Entry> candidates;
+    for (unsigned int bits = std::max(window_bits, 5u) - 2;
+         bits <= window_bits + 2; ++bits) {
+      candidates.push_back({MSMAlgorithmKind::kPippenger, bits});
+    }
+    return candidates;
+  }
+
+  PippengerAccumulationStrategy accumulation_strategy_ =
+      PippengerAccumulationStrategy::kDefault;
+  bool use_glv_ = false;
+  size_t window_bits_ = 0;
+  MSMTuningCache* tuning_cache_ = nullptr;
+  // Each |Pippenger| owns a |PippengerWorkspace|. They are kept across runs so
+  // that repeated MSMs of a similar size don't allocate on the heap.
+  std::vector<Pippenger<Point>> pippengers_;
+  std::vector<Result> results_;
 };
 
 }  // namespace tachyon::math
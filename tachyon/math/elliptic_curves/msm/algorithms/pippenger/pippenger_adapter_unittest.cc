@@ -47,4 +47,70 @@ TEST_F(PippengerAdapterTest, RunWithStrategy) {
   }
 }
 
+TEST_F(PippengerAdapterTest, RunWithBatchAffine) {
+  const VariableBaseMSMTestSet<bn254::G1AffinePoint>& test_set =
+      this->test_set_;
+
+  for (PippengerParallelStrategy strategy :
+       {PippengerParallelStrategy::kNone,
+        PippengerParallelStrategy::kParallelWindow,
+        PippengerParallelStrategy::kParallelTerm,
+        PippengerParallelStrategy::kParallelWindowAndTerm}) {
+    PippengerAdapter<bn254::G1AffinePoint> pippenger;
+    pippenger.SetAccumulationStrategy(
+        PippengerAccumulationStrategy::kBatchAffine);
+    SCOPED_TRACE(absl::Substitute("strategy: $0", static_cast<int>(strategy)));
+    bn254::G1PointXYZZ ret;
+    EXPECT_TRUE(pippenger.RunWithStrategy(
+        test_set.bases.begin(), test_set.bases.end(), test_set.scalars.begin(),
+        test_set.scalars.end(), strategy, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TEST_F(PippengerAdapterTest, RunWithGLV) {
+  const VariableBaseMSMTestSet<bn254::G1AffinePoint>& test_set =
+      this->test_set_;
+
+  for (PippengerParallelStrategy strategy :
+       {PippengerParallelStrategy::kNone,
+        PippengerParallelStrategy::kParallelWindow,
+        PippengerParallelStrategy::kParallelTerm,
+        PippengerParallelStrategy::kParallelWindowAndTerm}) {
+    PippengerAdapter<bn254::G1AffinePoint> pippenger;
+    pippenger.SetUseGLV(true);
+    SCOPED_TRACE(absl::Substitute("strategy: $0", static_cast<int>(strategy)));
+    bn254::G1PointXYZZ ret;
+    EXPECT_TRUE(pippenger.RunWithStrategy(
+        test_set.bases.begin(), test_set.bases.end(), test_set.scalars.begin(),
+        test_set.scalars.end(), strategy, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TEST_F(PippengerAdapterTest, RunBatch) {
+  using ScalarField = bn254::G1AffinePoint::ScalarField;
+
+  const VariableBaseMSMTestSet<bn254::G1AffinePoint>& test_set =
+      this->test_set_;
+
+  std::vector<ScalarField> other_scalars =
+      base::CreateVector(kSize / 3, []() { return ScalarField::Random(); });
+  std::vector<absl::Span<const ScalarField>> scalars_list = {test_set.scalars,
+                                                             other_scalars};
+
+  PippengerAdapter<bn254::G1AffinePoint> pippenger;
+  std::vector<bn254::G1PointXYZZ> rets(scalars_list.size());
+  ASSERT_TRUE(pippenger.RunBatch(test_set.bases.begin(), test_set.bases.end(),
+                                 scalars_list, absl::MakeSpan(rets)));
+  EXPECT_EQ(rets[0], test_set.answer);
+
+  bn254::G1PointXYZZ expected;
+  ASSERT_TRUE(pippenger.Run(test_set.bases.begin(),
+                            test_set.bases.begin() + other_scalars.size(),
+                            other_scalars.begin(), other_scalars.end(),
+                            &expected));
+  EXPECT_EQ(rets[1], expected);
+}
+
 }  // namespace tachyon::math
@@ -6,9 +6,18 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_BASE_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_BASE_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "absl/types/span.h"
 
 #include "tachyon/base/containers/adapters.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/semigroups.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
@@ -56,6 +65,43 @@ class PippengerBase {
     return window_sum;
   }
 
+  // Returns Σᵢ (|offset| + i + 1) * bucketsᵢ, which is what |buckets| adds to
+  // |AccumulateBuckets()| when they are the buckets from |offset| of a larger
+  // range. The |offset| weight is added with a single scalar multiplication of
+  // the sum of |buckets|.
+  static Bucket AccumulateBucketSegment(absl::Span<const Bucket> buckets,
+                                        size_t offset) {
+    Bucket running_sum = Bucket::Zero();
+    Bucket segment_sum = Bucket::Zero();
+    for (const auto& bucket : base::Reversed(buckets)) {
+      running_sum += bucket;
+      segment_sum += running_sum;
+    }
+    if (offset != 0) {
+      segment_sum +=
+          running_sum.ScalarMul(BigInt<1>(static_cast<uint64_t>(offset)));
+    }
+    return segment_sum;
+  }
+
+  // Same as |AccumulateBuckets()|, but splits |buckets| into |segment_count|
+  // ranges and reduces them in parallel. See |AccumulateBucketSegment()|.
+  static Bucket AccumulateBucketsInParallel(
+      absl::Span<const Bucket> buckets, size_t segment_count,
+      const Bucket& initial_value = Bucket::Zero()) {
+    segment_count =
+        std::max(size_t{1}, std::min(segment_count, buckets.size()));
+    size_t segment_size = (buckets.size() + segment_count - 1) / segment_count;
+    std::vector<Bucket> segment_sums(segment_count);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < segment_count; ++i) {
+      size_t offset = std::min(i * segment_size, buckets.size());
+      segment_sums[i] = AccumulateBucketSegment(
+          buckets.subspan(offset, segment_size), offset);
+    }
+    return std::accumulate(segment_sums.begin(), segment_sums.end(),
+                           initial_value);
+  }
+
   static Bucket AccumulateWindowSums(absl::Span<const Bucket> window_sums,
                                      size_t window_bits) {
     // We store the sum for the lowest window.
@@ -69,4 +69,230 @@ TYPED_TEST(PippengerTest, Run) {
   }
 }
 
+TYPED_TEST(PippengerTest, RunWithBatchAffine) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  if constexpr (kSupportsBatchAffineAccumulation<Point>) {
+    // Repeated scalars make bucket conflicts in a batch and repeated bases
+    // make doublings and cancellations.
+    VariableBaseMSMTestSet<Point> non_uniform_test_set =
+        VariableBaseMSMTestSet<Point>::NonUniform(kSize, 3,
+                                                  VariableBaseMSMMethod::kNaive);
+    VariableBaseMSMTestSet<Point> easy_test_set =
+        VariableBaseMSMTestSet<Point>::Easy(kSize,
+                                            VariableBaseMSMMethod::kNaive);
+    for (const VariableBaseMSMTestSet<Point>* test_set :
+         {&this->test_set_, &non_uniform_test_set, &easy_test_set}) {
+      for (bool use_window_naf : {false, true}) {
+        SCOPED_TRACE(absl::Substitute("use_window_naf: $0", use_window_naf));
+        Pippenger<Point> pippenger;
+        pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+        pippenger.SetUseBatchAffine(true);
+        // The scalars of |easy_test_set| are small.
+        pippenger.SetUseSmallScalars(false);
+        Bucket ret;
+        ASSERT_TRUE(pippenger.Run(
+            test_set->bases.begin(), test_set->bases.end(),
+            test_set->scalars.begin(), test_set->scalars.end(), &ret));
+        EXPECT_EQ(ret, test_set->answer);
+      }
+    }
+  } else {
+    GTEST_SKIP() << "Batch affine accumulation is only for affine points";
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithGLV) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  if constexpr (kHasEndomorphism<Point>) {
+    VariableBaseMSMTestSet<Point> easy_test_set =
+        VariableBaseMSMTestSet<Point>::Easy(kSize,
+                                            VariableBaseMSMMethod::kNaive);
+    for (const VariableBaseMSMTestSet<Point>* test_set :
+         {&this->test_set_, &easy_test_set}) {
+      for (bool use_window_naf : {false, true}) {
+        for (bool use_batch_affine : {false, true}) {
+          SCOPED_TRACE(absl::Substitute(
+              "use_window_naf: $0, use_batch_affine: $1", use_window_naf,
+              use_batch_affine));
+          Pippenger<Point> pippenger;
+          pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+          pippenger.SetUseBatchAffine(use_batch_affine);
+          pippenger.SetUseGLV(true);
+          // The scalars of |easy_test_set| are small.
+          pippenger.SetUseSmallScalars(false);
+          Bucket ret;
+          ASSERT_TRUE(pippenger.Run(
+              test_set->bases.begin(), test_set->bases.end(),
+              test_set->scalars.begin(), test_set->scalars.end(), &ret));
+          EXPECT_EQ(ret, test_set->answer);
+          // The half-width scalars need about half as many windows.
+          const MSMCtx& ctx = pippenger.workspace().ctx();
+          EXPECT_LT(ctx.window_count * 3,
+                    MSMCtx::ComputeWindowsCount<typename Point::ScalarField>(
+                        ctx.window_bits) *
+                        2);
+        }
+      }
+    }
+  } else {
+    GTEST_SKIP() << "GLV is only for curves with an endomorphism";
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithTermSplits) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  for (bool use_window_naf : {false, true}) {
+    for (size_t thread_nums : {1, 64, 1024}) {
+      SCOPED_TRACE(absl::Substitute("use_window_naf: $0, thread_nums: $1",
+                                    use_window_naf, thread_nums));
+      Pippenger<Point> pippenger;
+      pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+      pippenger.SetParallelWindows(true);
+      pippenger.SetThreadNumsForTesting(thread_nums);
+      Bucket ret;
+      ASSERT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                test_set.scalars.begin(),
+                                test_set.scalars.end(), &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithSmallScalars) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  VariableBaseMSMTestSet<Point> test_set = this->test_set_;
+  // Zeros, ones, other small scalars and a few large ones.
+  for (size_t i = 0; i < test_set.size(); ++i) {
+    switch (i % 4) {
+      case 0:
+        test_set.scalars[i] = ScalarField::Zero();
+        break;
+      case 1:
+        test_set.scalars[i] = ScalarField::One();
+        break;
+      case 2:
+        test_set.scalars[i] = ScalarField(i * 6);
+        break;
+      case 3:
+        if (i % 8 != 3) test_set.scalars[i] = ScalarField::Zero();
+        break;
+    }
+  }
+
+  Pippenger<Point> expected_pippenger;
+  expected_pippenger.SetUseSmallScalars(false);
+  Bucket expected;
+  ASSERT_TRUE(expected_pippenger.Run(
+      test_set.bases.begin(), test_set.bases.end(), test_set.scalars.begin(),
+      test_set.scalars.end(), &expected));
+
+  for (size_t thread_nums : {1, 3, 64}) {
+    SCOPED_TRACE(absl::Substitute("thread_nums: $0", thread_nums));
+    Pippenger<Point> pippenger;
+    pippenger.SetThreadNumsForTesting(thread_nums);
+    Bucket ret;
+    ASSERT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                              test_set.scalars.begin(), test_set.scalars.end(),
+                              &ret));
+    EXPECT_EQ(ret, expected);
+  }
+}
+
+TYPED_TEST(PippengerTest, AccumulateBucketsInParallel) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  std::vector<Bucket> buckets =
+      base::CreateVector(kSize, []() { return Bucket::Random(); });
+  Bucket expected = PippengerBase<Point>::AccumulateBuckets(buckets);
+  for (size_t segment_count : {1, 2, 3, 7, 40, 41}) {
+    SCOPED_TRACE(absl::Substitute("segment_count: $0", segment_count));
+    EXPECT_EQ(PippengerBase<Point>::AccumulateBucketsInParallel(buckets,
+                                                                segment_count),
+              expected);
+  }
+}
+
+TYPED_TEST(PippengerTest, RunBatch) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+  VariableBaseMSMTestSet<Point> small_test_set =
+      VariableBaseMSMTestSet<Point>::Random(kSize / 2,
+                                            VariableBaseMSMMethod::kNaive);
+  // The bases of |small_test_set| are replaced with the prefix of the bases of
+  // |test_set|, so that both share the same bases.
+  small_test_set.bases.assign(test_set.bases.begin(),
+                              test_set.bases.begin() + kSize / 2);
+  Bucket small_answer;
+  {
+    Pippenger<Point> pippenger;
+    ASSERT_TRUE(pippenger.Run(
+        small_test_set.bases.begin(), small_test_set.bases.end(),
+        small_test_set.scalars.begin(), small_test_set.scalars.end(),
+        &small_answer));
+  }
+
+  struct {
+    bool use_window_naf;
+    bool parallel_windows;
+  } tests[] = {
+    {false, false},
+    {true, false},
+#if defined(TACHYON_HAS_OPENMP)
+    {false, true},
+    {true, true},
+#endif  // defined(TACHYON_HAS_OPENMP)
+  };
+
+  std::vector<absl::Span<const ScalarField>> scalars_list = {
+      test_set.scalars, small_test_set.scalars, test_set.scalars};
+  for (const auto& test : tests) {
+    Pippenger<Point> pippenger;
+    SCOPED_TRACE(absl::Substitute("use_window_naf: $0 parallel_windows: $1",
+                                  test.use_window_naf, test.parallel_windows));
+    pippenger.SetUseMSMWindowNAForTesting(test.use_window_naf);
+    pippenger.SetParallelWindows(test.parallel_windows);
+    std::vector<Bucket> rets(scalars_list.size());
+    ASSERT_TRUE(pippenger.RunBatch(test_set.bases.begin(),
+                                   test_set.bases.end(), scalars_list,
+                                   absl::MakeSpan(rets)));
+    EXPECT_EQ(rets[0], test_set.answer);
+    EXPECT_EQ(rets[1], small_answer);
+    EXPECT_EQ(rets[2], test_set.answer);
+  }
+}
+
+TYPED_TEST(PippengerTest, RunReusingWorkspace) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  VariableBaseMSMTestSet<Point> small_test_set =
+      VariableBaseMSMTestSet<Point>::Random(kSize / 2,
+                                            VariableBaseMSMMethod::kNaive);
+
+  Pippenger<Point> pippenger;
+  for (const VariableBaseMSMTestSet<Point>* test_set :
+       {&this->test_set_, &small_test_set, &this->test_set_}) {
+    Bucket ret;
+    ASSERT_TRUE(pippenger.Run(test_set->bases.begin(), test_set->bases.end(),
+                              test_set->scalars.begin(),
+                              test_set->scalars.end(), &ret));
+    EXPECT_EQ(ret, test_set->answer);
+  }
+}
+
 }  // namespace tachyon::math
@@ -0,0 +1,96 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_WORKSPACE_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_WORKSPACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/memory/huge_page_allocator.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
+
+namespace tachyon::math {
+
+// |PippengerWorkspace| owns every temporary buffer that |Pippenger| needs.
+// Buffers only grow, so that running MSMs of the same or smaller size again
+// doesn't allocate memory on the heap.
+//
+// The scalar digits are stored in a flat matrix laid out window-major, i.e.,
+// the digits of the i-th window for every scalar are contiguous. This way each
+// window only touches its own row when accumulating buckets.
+//
+// The digits and the buckets are allocated by |base::HugePageAllocator|, since
+// the buckets are updated at random.
+//
+// NOTE: A workspace must not be shared by concurrent |Pippenger::Run()|
+// calls.
+template <typename Bucket>
+class PippengerWorkspace {
+ public:
+  PippengerWorkspace() = default;
+  PippengerWorkspace(const PippengerWorkspace& other) = delete;
+  PippengerWorkspace& operator=(const PippengerWorkspace& other) = delete;
+  PippengerWorkspace(PippengerWorkspace&& other) = default;
+  PippengerWorkspace& operator=(PippengerWorkspace&& other) = default;
+
+  const MSMCtx& ctx() const { return ctx_; }
+
+  // Prepares the buffers for an MSM described by |ctx|. |bucket_sets| is the
+  // number of windows whose buckets are alive at the same time and
+  // |bucket_size| is the number of buckets per window.
+  void Prepare(const MSMCtx& ctx, size_t bucket_sets, size_t bucket_size) {
+    ctx_ = ctx;
+    bucket_size_ = bucket_size;
+    digits_.resize(size_t{ctx.window_count} * ctx.size);
+    buckets_.resize(std::max(buckets_.size(), bucket_sets * bucket_size));
+    window_sums_.resize(ctx.window_count);
+  }
+
+  // Returns the digits of the |window_index|-th window for every scalar.
+  absl::Span<int32_t> GetDigits(size_t window_index) {
+    return absl::MakeSpan(digits_).subspan(window_index * ctx_.size,
+                                           ctx_.size);
+  }
+  absl::Span<const int32_t> GetDigits(size_t window_index) const {
+    return absl::MakeConstSpan(digits_).subspan(window_index * ctx_.size,
+                                                ctx_.size);
+  }
+
+  // Writes the |window_index|-th digit of the |scalar_index|-th scalar.
+  void SetDigit(size_t scalar_index, size_t window_index, int32_t digit) {
+    digits_[window_index * ctx_.size + scalar_index] = digit;
+  }
+
+  // Returns the |bucket_set_index|-th set of the first |size| buckets. The
+  // buckets are reset to zero.
+  absl::Span<Bucket> GetBuckets(size_t bucket_set_index, size_t size) {
+    absl::Span<Bucket> buckets = absl::MakeSpan(buckets_).subspan(
+        bucket_set_index * bucket_size_, size);
+    std::fill(buckets.begin(), buckets.end(), Bucket::Zero());
+    return buckets;
+  }
+
+  // Same as above, but the buckets are returned as they are.
+  absl::Span<Bucket> GetBucketsWithoutReset(size_t bucket_set_index,
+                                            size_t size) {
+    return absl::MakeSpan(buckets_).subspan(bucket_set_index * bucket_size_,
+                                            size);
+  }
+
+  std::vector<Bucket>& window_sums() { return window_sums_; }
+  const std::vector<Bucket>& window_sums() const { return window_sums_; }
+
+ private:
+  MSMCtx ctx_;
+  size_t bucket_size_ = 0;
+  base::HugePageVector<int32_t> digits_;
+  base::HugePageVector<Bucket> buckets_;
+  std::vector<Bucket> window_sums_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_WORKSPACE_H_
@@ -6,11 +6,19 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_H_
 
-#include "tachyon/math/base/bit_iterator.h"
-#include "tachyon/math/base/gmp/bit_traits.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/base/gmp/gmp_util.h"
 #include "tachyon/math/base/gmp/signed_value.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/jacobian_point.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/projective_point.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
@@ -18,6 +26,17 @@
 
 namespace tachyon::math {
 
+// |kHasEndomorphism<Point>| is true if the curve of |Point| has the GLV
+// coefficients and the endomorphism coefficient.
+template <typename Point, typename SFINAE = void>
+constexpr bool kHasEndomorphism = false;
+
+template <typename Point>
+constexpr bool kHasEndomorphism<
+    Point,
+    std::void_t<decltype(Point::Curve::Config::kEndomorphismCoefficient)>> =
+    true;
+
 template <typename Point>
 class GLV {
  public:
@@ -25,11 +44,27 @@ class GLV {
   using ScalarField = typename Point::ScalarField;
   using RetPoint = typename internal::AdditiveSemigroupTraits<Point>::ReturnTy;
 
+  constexpr static size_t N = ScalarField::N;
+
   struct CoefficientDecompositionResult {
     SignedValue<mpz_class> k1;
     SignedValue<mpz_class> k2;
   };
 
+  struct FixedWidthDecompositionResult {
+    BigInt<N> k1;
+    bool k1_is_negative;
+    BigInt<N> k2;
+    bool k2_is_negative;
+  };
+
+  // The window of the wNAF of |Mul()|, which precomputes 2ʷ⁻² odd multiples
+  // of each of p and φ(p).
+  constexpr static uint32_t kWNAFWindowBits = 4;
+  constexpr static size_t kWNAFTableSize = size_t{1} << (kWNAFWindowBits - 2);
+
+  using WNAFDigits = std::array<int8_t, 64 * N + 1>;
+
   static Point Endomorphism(const Point& point) {
     return Point::Endomorphism(point);
   }
@@ -73,56 +108,151 @@ class GLV {
     return {SignedValue<mpz_class>(k1), SignedValue<mpz_class>(k2)};
   }
 
-  static RetPoint Mul(const Point& p, const ScalarField& k) {
-    CoefficientDecompositionResult result = Decompose(k);
+  // Same as |Decompose()|, but only uses fixed-width arithmetic on |BigInt|
+  // without branching on |k|, so that it can be called for every scalar of an
+  // MSM. β₁ = ⌊k * n22 / r⌋ and β₂ = ⌊k * -n12 / r⌋ are approximated by
+  // (k * g₁) >> 64N and (k * g₂) >> 64N, where g₁ = ⌊2^(64N) * |n22| / r⌋ and
+  // g₂ = ⌊2^(64N) * |n12| / r⌋. The approximation may be off by one, which
+  // makes k1 and k2 a few bits larger than the ones from |Decompose()|, but
+  // k = k1 + lambda k2 still holds, since (n11, n12) and (n21, n22) are
+  // vectors of the lattice. The lattice constants are emitted by the curve
+  // generator, so this doesn't depend on |Point::Curve::Init()|.
+  constexpr static FixedWidthDecompositionResult DecomposeFixedWidth(
+      const ScalarField& k) {
+    using Config = typename Point::Curve::Config;
+    static_assert(std::is_same_v<std::decay_t<decltype(Config::kGLVG1)>,
+                                 BigInt<N>>);
 
-    Point b1 = p;
-    Point b2 = Endomorphism(p);
+    const BigInt<N>* coeffs = Config::kGLVAbsCoeffs;
+    const bool* coeffs_are_negative = Config::kGLVCoeffsAreNegative;
 
-    if (result.k1.sign == Sign::kNegative) {
-      b1.NegateInPlace();
-    }
-    if (result.k2.sign == Sign::kNegative) {
-      b2.NegateInPlace();
-    }
+    BigInt<N> scalar = k.ToBigInt();
+    BigInt<N> beta_1 = scalar.Multiply(Config::kGLVG1).hi;
+    BigInt<N> beta_2 = scalar.Multiply(Config::kGLVG2).hi;
+    bool beta_1_is_negative = coeffs_are_negative[3];
+    bool beta_2_is_negative = !coeffs_are_negative[1];
 
-    RetPoint b1b2 = b1 + b2;
+    // Both k1 and k2 are small, so they are computed modulo 2^(64N) in two's
+    // complement.
+    // k1 = k - β₁ * n11 - β₂ * n21
+    BigInt<N> k1 = scalar;
+    k1 -= ConditionalNegate(beta_1.Mul(coeffs[0]),
+                            beta_1_is_negative ^ coeffs_are_negative[0]);
+    k1 -= ConditionalNegate(beta_2.Mul(coeffs[2]),
+                            beta_2_is_negative ^ coeffs_are_negative[2]);
+    // k2 = -β₁ * n12 - β₂ * n22
+    BigInt<N> k2;
+    k2 -= ConditionalNegate(beta_1.Mul(coeffs[1]),
+                            beta_1_is_negative ^ coeffs_are_negative[1]);
+    k2 -= ConditionalNegate(beta_2.Mul(coeffs[3]),
+                            beta_2_is_negative ^ coeffs_are_negative[3]);
 
-    auto k1_begin = BitIteratorBE<mpz_class>::begin(&result.k1.abs_value);
-    auto k1_end = BitIteratorBE<mpz_class>::end(&result.k1.abs_value);
-    auto k2_begin = BitIteratorBE<mpz_class>::begin(&result.k2.abs_value);
+    bool k1_is_negative = (k1.biggest_limb() >> 63) != 0;
+    bool k2_is_negative = (k2.biggest_limb() >> 63) != 0;
+    return {ConditionalNegate(k1, k1_is_negative), k1_is_negative,
+            ConditionalNegate(k2, k2_is_negative), k2_is_negative};
+  }
 
-    RetPoint ret = RetPoint::Zero();
-    bool skip_zeros = true;
-    auto k1_it = k1_begin;
-    auto k2_it = k2_begin;
-    while (k1_it != k1_end) {
-      if (skip_zeros && !(*k1_it) && !(*k2_it)) {
-        skip_zeros = false;
-        ++k1_it;
-        ++k2_it;
-        continue;
-      }
-      skip_zeros = false;
-      ret.DoubleInPlace();
-      if ((*k1_it)) {
-        if (*(k2_it)) {
-          ret += b1b2;
+  // Returns the number of the digits and writes the width-w NAF of |k| to
+  // |digits| from the least significant digit, where w is
+  // |kWNAFWindowBits|. Every non-zero digit is odd and less than 2ʷ⁻¹ in
+  // absolute value, and at most one of any w consecutive digits is non-zero.
+  // |k| must be less than 2^(64N - 1), which holds for k1 and k2 of
+  // |DecomposeFixedWidth()|.
+  constexpr static size_t ComputeWNAF(BigInt<N> k, WNAFDigits& digits) {
+    constexpr uint64_t kWindow = uint64_t{1} << kWNAFWindowBits;
+    size_t size = 0;
+    while (!k.IsZero()) {
+      int8_t digit = 0;
+      if (k.IsOdd()) {
+        uint64_t mod = k.smallest_limb() & (kWindow - 1);
+        if (mod >= kWindow / 2) {
+          digit = static_cast<int8_t>(static_cast<int64_t>(mod) -
+                                      static_cast<int64_t>(kWindow));
+          k += BigInt<N>(kWindow - mod);
         } else {
-          ret += b1;
-        }
-      } else {
-        if (*(k2_it)) {
-          ret += b2;
+          digit = static_cast<int8_t>(mod);
+          k -= BigInt<N>(mod);
         }
       }
-      ++k1_it;
-      ++k2_it;
+      digits[size++] = digit;
+      k.DivBy2InPlace();
+    }
+    return size;
+  }
+
+  // Computes k * p by interleaving the wNAFs of k1 and k2 of
+  // |DecomposeFixedWidth()| over the odd multiples of p and of φ(p), where φ
+  // is the endomorphism. This takes about half the doublings of the
+  // double-and-add and one addition every w + 1 bits of each of k1 and k2.
+  static RetPoint Mul(const Point& p, const ScalarField& k) {
+    FixedWidthDecompositionResult result = DecomposeFixedWidth(k);
+    WNAFDigits k1_digits;
+    WNAFDigits k2_digits;
+    size_t k1_size = ComputeWNAF(result.k1, k1_digits);
+    size_t k2_size = ComputeWNAF(result.k2, k2_digits);
+
+    // |b1_table[i]| = (2i + 1) * b1 and |b2_table[i]| = (2i + 1) * b2, where
+    // b1 = ±p and b2 = ±φ(p) follow the signs of k1 and k2.
+    RetPoint b1_table[kWNAFTableSize];
+    RetPoint b2_table[kWNAFTableSize];
+    b1_table[0] = ConvertPoint<RetPoint>(p);
+    if (result.k1_is_negative) b1_table[0].NegateInPlace();
+    RetPoint b1_double = b1_table[0].Double();
+    for (size_t i = 1; i < kWNAFTableSize; ++i) {
+      b1_table[i] = b1_table[i - 1] + b1_double;
+    }
+    for (size_t i = 0; i < kWNAFTableSize; ++i) {
+      b2_table[i] = RetPoint::Endomorphism(b1_table[i]);
+      if (result.k1_is_negative != result.k2_is_negative) {
+        b2_table[i].NegateInPlace();
+      }
+    }
+
+    RetPoint ret = RetPoint::Zero();
+    for (size_t i = std::max(k1_size, k2_size); i > 0; --i) {
+      ret.DoubleInPlace();
+      AddWNAFDigit(b1_table, i - 1 < k1_size ? k1_digits[i - 1] : 0, ret);
+      AddWNAFDigit(b2_table, i - 1 < k2_size ? k2_digits[i - 1] : 0, ret);
     }
     return ret;
   }
+
+ private:
+  // Returns -|value| modulo 2^(64N) if |negate| is true. Otherwise, returns
+  // |value|.
+  constexpr static BigInt<N> ConditionalNegate(const BigInt<N>& value,
+                                               bool negate) {
+    uint64_t mask = -static_cast<uint64_t>(negate);
+    BigInt<N> ret;
+    for (size_t i = 0; i < N; ++i) {
+      ret[i] = value[i] ^ mask;
+    }
+    ret += BigInt<N>(static_cast<uint64_t>(negate));
+    return ret;
+  }
+
+  static void AddWNAFDigit(const RetPoint* table, int8_t digit,
+                           RetPoint& ret) {
+    if (digit > 0) {
+      ret += table[digit >> 1];
+    } else if (digit < 0) {
+      ret -= table[(-digit) >> 1];
+    }
+  }
 };
 
+// Returns k * p by |GLV::Mul()| if the curve of |Point| has the
+// endomorphism. Otherwise, returns |p.ScalarMul(k)|.
+template <typename Point>
+auto ScalarMulWithGLV(const Point& p, const typename Point::ScalarField& k) {
+  if constexpr (kHasEndomorphism<Point>) {
+    return GLV<Point>::Mul(p, k);
+  } else {
+    return p.ScalarMul(k);
+  }
+}
+
 }  // namespace tachyon::math
 
 #endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_H_
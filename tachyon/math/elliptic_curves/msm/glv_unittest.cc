@@ -1,5 +1,7 @@
 #include "tachyon/math/elliptic_curves/msm/glv.h"
 
+#include <stdlib.h>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/g1.h"
@@ -56,13 +58,70 @@ TYPED_TEST(GLVTest, Decompose) {
   EXPECT_EQ(scalar, k1 + Point::Curve::Config::kLambda * k2);
 }
 
+TYPED_TEST(GLVTest, DecomposeFixedWidth) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+
+  for (size_t i = 0; i < 100; ++i) {
+    ScalarField scalar = ScalarField::Random();
+    auto result = GLV<Point>::DecomposeFixedWidth(scalar);
+    ScalarField k1 = ScalarField::FromBigInt(result.k1);
+    ScalarField k2 = ScalarField::FromBigInt(result.k2);
+    if (result.k1_is_negative) {
+      k1.NegateInPlace();
+    }
+    if (result.k2_is_negative) {
+      k2.NegateInPlace();
+    }
+    EXPECT_EQ(scalar, k1 + Point::Curve::Config::kLambda * k2);
+
+    // Since each of β₁ and β₂ is off by less than 2, |k1| < 2(|n11| + |n21|)
+    // and |k2| < 2(|n12| + |n22|).
+    const mpz_class* coeffs = Point::Curve::Config::kGLVCoeffs;
+    EXPECT_LT(ScalarField::FromBigInt(result.k1).ToMpzClass(),
+              (gmp::GetAbs(coeffs[0]) + gmp::GetAbs(coeffs[2])) * 2);
+    EXPECT_LT(ScalarField::FromBigInt(result.k2).ToMpzClass(),
+              (gmp::GetAbs(coeffs[1]) + gmp::GetAbs(coeffs[3])) * 2);
+  }
+}
+
+TYPED_TEST(GLVTest, ComputeWNAF) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  constexpr size_t N = ScalarField::N;
+  constexpr int kWindowBits = GLV<Point>::kWNAFWindowBits;
+
+  for (size_t i = 0; i < 10; ++i) {
+    BigInt<N> k = GLV<Point>::DecomposeFixedWidth(ScalarField::Random()).k1;
+    typename GLV<Point>::WNAFDigits digits;
+    size_t size = GLV<Point>::ComputeWNAF(k, digits);
+
+    mpz_class value;
+    for (size_t j = size; j > 0; --j) {
+      int8_t digit = digits[j - 1];
+      value = value * 2 + int{digit};
+      if (digit == 0) continue;
+      EXPECT_NE(digit % 2, 0);
+      EXPECT_LT(std::abs(digit), 1 << (kWindowBits - 1));
+      for (size_t l = j; l < j + kWindowBits - 1 && l < size; ++l) {
+        EXPECT_EQ(digits[l], 0);
+      }
+    }
+    EXPECT_EQ(ScalarField::FromMpzClass(value).ToBigInt(), k);
+  }
+}
+
 TYPED_TEST(GLVTest, Mul) {
   using Point = TypeParam;
   using ScalarField = typename Point::ScalarField;
 
   Point base = Point::Random();
-  ScalarField scalar = ScalarField::Random();
-  EXPECT_EQ(GLV<Point>::Mul(base, scalar), base * scalar);
+  for (const ScalarField& scalar :
+       {ScalarField::Random(), ScalarField::Zero(), ScalarField::One(),
+        -ScalarField::One()}) {
+    EXPECT_EQ(GLV<Point>::Mul(base, scalar), base * scalar);
+    EXPECT_EQ(ScalarMulWithGLV(base, scalar), base * scalar);
+  }
 }
 
 }  // namespace tachyon::math
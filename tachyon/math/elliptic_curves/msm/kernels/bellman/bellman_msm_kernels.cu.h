@@ -7,6 +7,7 @@
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_KERNELS_BELLMAN_BELLMAN_MSM_KERNELS_CU_H_
 
 #include "tachyon/device/gpu/cuda/cuda_memory.h"
+#include "tachyon/device/gpu/gpu_device_perf_info.h"
 #include "tachyon/device/gpu/gpu_logging.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/affine_point.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/jacobian_point.h"
@@ -185,7 +186,6 @@ gpuError_t RemoveZeroBuckets(const unsigned int* unique_bucket_indexes,
                              unsigned int count, gpuStream_t stream);
 #undef MAX_THREADS
 
-#define MAX_THREADS 32
 #define MIN_BLOCKS 16
 template <typename Curve, bool IsFirst>
 __global__ void AggregateBucketsKernel(
@@ -262,7 +262,8 @@ gpuError_t AggregateBuckets(bool is_first, const unsigned int* base_indexes,
                             const AffinePoint<Curve>* bases,
                             PointXYZZ<Curve>* buckets, unsigned int count,
                             gpuStream_t stream) {
-  dim3 block_dim = count < MAX_THREADS ? count : MAX_THREADS;
+  const unsigned int max_threads = device::gpu::GetWarpSize();
+  dim3 block_dim = count < max_threads ? count : max_threads;
   dim3 grid_dim = (count - 1) / block_dim.x + 1;
   auto kernel = is_first ? AggregateBucketsKernel<Curve, true>
                          : AggregateBucketsKernel<Curve, false>;
@@ -272,7 +273,6 @@ gpuError_t AggregateBuckets(bool is_first, const unsigned int* base_indexes,
   return LOG_IF_GPU_LAST_ERROR("Failed to AggregateBucketsKernel()");
 }
 
-#define MAX_THREADS 32
 template <typename Curve>
 __global__ void ExtractTopBucketsKernel(PointXYZZ<Curve>* buckets,
                                         PointXYZZ<Curve>* top_buckets,
@@ -290,16 +290,15 @@ gpuError_t ExtractTopBuckets(PointXYZZ<Curve>* buckets,
                              PointXYZZ<Curve>* top_buckets,
                              unsigned int bits_count,
                              unsigned int windows_count, gpuStream_t stream) {
+  const unsigned int max_threads = device::gpu::GetWarpSize();
   const dim3 block_dim =
-      windows_count < MAX_THREADS ? windows_count : MAX_THREADS;
+      windows_count < max_threads ? windows_count : max_threads;
   const dim3 grid_dim = (windows_count - 1) / block_dim.x + 1;
   ExtractTopBucketsKernel<<<grid_dim, block_dim, 0, stream>>>(
       buckets, top_buckets, bits_count, windows_count);
   return LOG_IF_GPU_LAST_ERROR("Failed to ExtractTopBucketsKernel()");
 }
-#undef MAX_THREADS
 
-#define MAX_THREADS 32
 #define MIN_BLOCKS 16
 template <typename Curve>
 __global__ void SplitWindowsKernel(
@@ -358,17 +357,16 @@ gpuError_t SplitWindows(unsigned int source_window_bits_count,
                         const PointXYZZ<Curve>* source_buckets,
                         PointXYZZ<Curve>* target_buckets, unsigned int count,
                         gpuStream_t stream) {
-  dim3 block_dim = count < MAX_THREADS ? count : MAX_THREADS;
+  const unsigned int max_threads = device::gpu::GetWarpSize();
+  dim3 block_dim = count < max_threads ? count : max_threads;
   dim3 grid_dim = (count - 1) / block_dim.x + 1;
   SplitWindowsKernel<<<grid_dim, block_dim, 0, stream>>>(
       source_window_bits_count, source_windows_count, source_buckets,
       target_buckets, count);
   return LOG_IF_GPU_LAST_ERROR("Failed to SplitWindowsKernel()");
 }
-#undef MAX_THREADS
 #undef MIN_BLOCKS
 
-#define MAX_THREADS 32
 #define MIN_BLOCKS 16
 template <typename Curve>
 __global__ void ReduceBucketsKernel(PointXYZZ<Curve>* buckets,
@@ -385,15 +383,14 @@ __global__ void ReduceBucketsKernel(PointXYZZ<Curve>* buckets,
 template <typename Curve>
 gpuError_t ReduceBuckets(PointXYZZ<Curve>* buckets, unsigned int count,
                          gpuStream_t stream) {
-  dim3 block_dim = count < MAX_THREADS ? count : MAX_THREADS;
+  const unsigned int max_threads = device::gpu::GetWarpSize();
+  dim3 block_dim = count < max_threads ? count : max_threads;
   dim3 grid_dim = (count - 1) / block_dim.x + 1;
   ReduceBucketsKernel<<<grid_dim, block_dim, 0, stream>>>(buckets, count);
   return LOG_IF_GPU_LAST_ERROR("Failed to ReduceBucketsKernel()");
 }
-#undef MAX_THREADS
 #undef MIN_BLOCKS
 
-#define MAX_THREADS 32
 template <typename Curve>
 __global__ void LastPassGatherKernel(
     unsigned int bits_count_pass_one,
@@ -433,22 +430,26 @@ gpuError_t LastPassGather(unsigned int bits_count_pass_one,
                           const PointXYZZ<Curve>* top_buckets,
                           JacobianPoint<Curve>* target, unsigned int count,
                           gpuStream_t stream) {
-  dim3 block_dim = count < MAX_THREADS ? count : MAX_THREADS;
+  const unsigned int max_threads = device::gpu::GetWarpSize();
+  dim3 block_dim = count < max_threads ? count : max_threads;
   dim3 grid_dim = (count - 1) / block_dim.x + 1;
   LastPassGatherKernel<<<grid_dim, block_dim, 0, stream>>>(
       bits_count_pass_one, source, top_buckets, target, count);
   return LOG_IF_GPU_LAST_ERROR("Failed to LastPassGatherKernel()");
 }
-#undef MAX_THREADS
 
 template <typename T>
 void SetKernelAttributes(T* func) {
-  GPU_MUST_SUCCESS(cudaFuncSetCacheConfig(func, cudaFuncCachePreferL1),
-                   "Failed to cudaFuncSetCacheConfig()");
+  GPU_MUST_SUCCESS(gpuFuncSetCacheConfig(func, gpuFuncCachePreferL1),
+                   "Failed to gpuFuncSetCacheConfig()");
+#if TACHYON_CUDA
+  // NOTE: AMD GPUs don't share the L1 cache with the shared memory, so there
+  // is no carveout to set.
   GPU_MUST_SUCCESS(
       cudaFuncSetAttribute(func, cudaFuncAttributePreferredSharedMemoryCarveout,
                            cudaSharedmemCarveoutMaxL1),
       "Failed to cudaFuncSetAttribute()");
+#endif  // TACHYON_CUDA
 }
 
 template <typename Curve, typename ScalarField = typename Curve::ScalarField>
@@ -18,8 +18,13 @@ struct TACHYON_EXPORT MSMCtx {
 
   template <typename ScalarField>
   constexpr static MSMCtx CreateDefault(size_t size) {
+    return Create<ScalarField>(size, ComputeWindowsBits(size));
+  }
+
+  template <typename ScalarField>
+  constexpr static MSMCtx Create(size_t size, unsigned int window_bits) {
     MSMCtx ctx;
-    ctx.window_bits = ComputeWindowsBits(size);
+    ctx.window_bits = window_bits;
     ctx.window_count = ComputeWindowsCount<ScalarField>(ctx.window_bits);
     ctx.size = size;
     return ctx;
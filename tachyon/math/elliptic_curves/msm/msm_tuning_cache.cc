@@ -0,0 +1,110 @@
+#include "tachyon/math/elliptic_curves/msm/msm_tuning_cache.h"
+
+#include <string_view>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+
+#include "tachyon/base/environment.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon::math {
+
+namespace {
+
+bool StringToMSMAlgorithmKind(std::string_view str, MSMAlgorithmKind* kind) {
+  for (MSMAlgorithmKind candidate :
+       {MSMAlgorithmKind::kBellmanMSM, MSMAlgorithmKind::kCUZK,
+        MSMAlgorithmKind::kPippenger}) {
+    if (str == MSMAlgorithmKindToString(candidate)) {
+      *kind = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+base::FilePath GetDefaultPath() {
+  std::string_view path;
+  if (base::Environment::Get("TACHYON_MSM_TUNING_CACHE_PATH", &path)) {
+    return base::FilePath(path);
+  }
+  return base::GetHomeDir().Append(".cache/tachyon/msm_tuning.tsv");
+}
+
+}  // namespace
+
+// static
+MSMTuningCache& MSMTuningCache::GetDefault() {
+  static base::NoDestructor<MSMTuningCache> cache(GetDefaultPath());
+  return *cache;
+}
+
+MSMTuningCache::MSMTuningCache(const base::FilePath& path) : path_(path) {
+  Load();
+}
+
+std::optional<MSMTuningCache::Entry> MSMTuningCache::Find(
+    const Key& key) const {
+  absl::MutexLock lock(&lock_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return std::nullopt;
+  return it->second;
+}
+
+bool MSMTuningCache::Insert(const Key& key, const Entry& entry) {
+  absl::MutexLock lock(&lock_);
+  entries_[key] = entry;
+  return Save();
+}
+
+void MSMTuningCache::Load() {
+  if (!base::PathExists(path_)) return;
+  std::string content;
+  if (!base::ReadFileToString(path_, &content)) {
+    LOG(WARNING) << "Failed to read " << path_.value();
+    return;
+  }
+
+  absl::MutexLock lock(&lock_);
+  for (std::string_view line :
+       absl::StrSplit(content, '\n', absl::SkipWhitespace())) {
+    std::vector<std::string_view> fields = absl::StrSplit(line, '\t');
+    Key key;
+    Entry entry;
+    if (fields.size() != 5 ||
+        !base::StringToUint(fields[2], &key.log_size) ||
+        !StringToMSMAlgorithmKind(fields[3], &entry.algorithm) ||
+        !base::StringToUint(fields[4], &entry.window_bits)) {
+      LOG(WARNING) << "Skipping a malformed line of " << path_.value() << ": "
+                   << line;
+      continue;
+    }
+    key.device = std::string(fields[0]);
+    key.curve = std::string(fields[1]);
+    entries_[std::move(key)] = entry;
+  }
+}
+
+bool MSMTuningCache::Save() const {
+  std::string content;
+  for (const auto& [key, entry] : entries_) {
+    absl::StrAppend(&content, key.device, "\t", key.curve, "\t", key.log_size,
+                    "\t", MSMAlgorithmKindToString(entry.algorithm), "\t",
+                    entry.window_bits, "\n");
+  }
+  if (!base::CreateDirectory(path_.DirName())) {
+    LOG(ERROR) << "Failed to create " << path_.DirName().value();
+    return false;
+  }
+  if (!base::WriteFile(path_, content)) {
+    LOG(ERROR) << "Failed to write " << path_.value();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,123 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_TUNING_CACHE_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_TUNING_CACHE_H_
+
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/time_interval.h"
+#include "tachyon/export.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/msm_algorithm_kind.h"
+
+namespace tachyon::math {
+
+// |MSMTuningCache| keeps the fastest algorithm and window size measured for
+// the MSMs of each device, curve and size, so that the following MSMs of the
+// same kind run with them without being measured again. The entries are
+// persisted to a file, one per line as
+//
+//   <device>\t<curve>\t<log size>\t<algorithm>\t<window bits>
+//
+// NOTE: The entries only hold for the machine they are measured on, so the
+// file shouldn't be shared between the machines.
+class TACHYON_EXPORT MSMTuningCache {
+ public:
+  struct Key {
+    // e.g., "cpu" or the name of the GPU.
+    std::string device;
+    std::string curve;
+    unsigned int log_size = 0;
+
+    bool operator<(const Key& other) const {
+      return std::tie(device, curve, log_size) <
+             std::tie(other.device, other.curve, other.log_size);
+    }
+  };
+
+  struct Entry {
+    MSMAlgorithmKind algorithm = MSMAlgorithmKind::kPippenger;
+    unsigned int window_bits = 0;
+
+    bool operator==(const Entry& other) const {
+      return algorithm == other.algorithm && window_bits == other.window_bits;
+    }
+    bool operator!=(const Entry& other) const { return !operator==(other); }
+  };
+
+  // Returns the cache shared by the whole process, which is persisted to
+  // $TACHYON_MSM_TUNING_CACHE_PATH if it is set, or to
+  // ~/.cache/tachyon/msm_tuning.tsv otherwise.
+  static MSMTuningCache& GetDefault();
+
+  // Loads the entries from |path| if it exists.
+  explicit MSMTuningCache(const base::FilePath& path);
+  MSMTuningCache(const MSMTuningCache& other) = delete;
+  MSMTuningCache& operator=(const MSMTuningCache& other) = delete;
+
+  const base::FilePath& path() const { return path_; }
+
+  std::optional<Entry> Find(const Key& key) const;
+
+  // Adds or replaces the entry of |key| and writes all the entries to the
+  // file.
+  [[nodiscard]] bool Insert(const Key& key, const Entry& entry);
+
+  // Runs |run(entry)| with the entry of |key|. If there is none, it runs
+  // |run(entry)| with each of |candidates| and adds the fastest one. A failed
+  // run, e.g., of a window too large to fit in the memory, is skipped. Returns
+  // false if no run succeeds.
+  template <typename Callback>
+  [[nodiscard]] bool Run(const Key& key, absl::Span<const Entry> candidates,
+                         Callback run) {
+    std::optional<Entry> entry = Find(key);
+    if (entry.has_value()) return run(*entry);
+
+    // NOTE: The first run also pays the one-time costs, e.g., allocating the
+    // buckets, so it is repeated not to be compared with them.
+    if (!candidates.empty() && !run(candidates[0])) {
+      candidates.remove_prefix(1);
+    }
+    std::optional<Entry> best;
+    base::TimeDelta best_time;
+    for (const Entry& candidate : candidates) {
+      base::TimeInterval interval(base::TimeTicks::Now());
+      if (!run(candidate)) continue;
+      base::TimeDelta time = interval.GetTimeDelta();
+      if (!best.has_value() || time < best_time) {
+        best = candidate;
+        best_time = time;
+      }
+    }
+    if (!best.has_value()) return false;
+
+    VLOG(1) << "MSM(" << key.device << ", " << key.curve << ", 2^"
+            << key.log_size << ") is tuned: "
+            << MSMAlgorithmKindToString(best->algorithm)
+            << ", window_bits = " << best->window_bits
+            << ", time = " << best_time;
+    // NOTE: If it fails to write the file, the MSM is only measured again by
+    // the next process.
+    std::ignore = Insert(key, *best);
+    return true;
+  }
+
+ private:
+  void Load();
+  bool Save() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  const base::FilePath path_;
+  mutable absl::Mutex lock_;
+  std::map<Key, Entry> entries_ ABSL_GUARDED_BY(lock_);
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_TUNING_CACHE_H_
@@ -0,0 +1,121 @@
+#include "tachyon/math/elliptic_curves/msm/msm_tuning_cache.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class MSMTuningCacheTest : public testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().Append("tuning/msm_tuning.tsv");
+  }
+
+ protected:
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+};
+
+}  // namespace
+
+TEST_F(MSMTuningCacheTest, InsertAndLoad) {
+  MSMTuningCache::Key key = {"cpu", "bn254::G1", 10};
+  MSMTuningCache::Entry entry = {MSMAlgorithmKind::kPippenger, 7};
+  {
+    MSMTuningCache cache(path_);
+    EXPECT_FALSE(cache.Find(key).has_value());
+    ASSERT_TRUE(cache.Insert(key, entry));
+    EXPECT_EQ(cache.Find(key), entry);
+  }
+
+  MSMTuningCache cache(path_);
+  EXPECT_EQ(cache.Find(key), entry);
+  EXPECT_FALSE(cache.Find({"cpu", "bn254::G1", 11}).has_value());
+  EXPECT_FALSE(cache.Find({"gpu", "bn254::G1", 10}).has_value());
+}
+
+TEST_F(MSMTuningCacheTest, SkipMalformedLines) {
+  ASSERT_TRUE(base::CreateDirectory(path_.DirName()));
+  ASSERT_TRUE(base::WriteFile(path_,
+                              "cpu\tbn254::G1\t10\tpippenger\t7\n"
+                              "cpu\tbn254::G1\tten\tpippenger\t7\n"
+                              "cpu\tbn254::G1\t11\tunknown\t7\n"
+                              "cpu\tbn254::G1\t12\n"));
+
+  MSMTuningCache cache(path_);
+  EXPECT_EQ(cache.Find({"cpu", "bn254::G1", 10}),
+            (MSMTuningCache::Entry{MSMAlgorithmKind::kPippenger, 7}));
+  EXPECT_FALSE(cache.Find({"cpu", "bn254::G1", 11}).has_value());
+  EXPECT_FALSE(cache.Find({"cpu", "bn254::G1", 12}).has_value());
+}
+
+TEST_F(MSMTuningCacheTest, Run) {
+  MSMTuningCache cache(path_);
+  MSMTuningCache::Key key = {"cpu", "bn254::G1", 10};
+  std::vector<MSMTuningCache::Entry> candidates = {
+      {MSMAlgorithmKind::kPippenger, 3},
+      {MSMAlgorithmKind::kPippenger, 4},
+      {MSMAlgorithmKind::kPippenger, 5},
+  };
+
+  // The candidate that fails is never chosen.
+  std::vector<unsigned int> window_bits_list;
+  ASSERT_TRUE(cache.Run(key, candidates, [&](const auto& entry) {
+    window_bits_list.push_back(entry.window_bits);
+    return entry.window_bits != 4;
+  }));
+  // The first candidate is run twice to warm up.
+  EXPECT_EQ(window_bits_list, (std::vector<unsigned int>{3, 3, 4, 5}));
+  std::optional<MSMTuningCache::Entry> entry = cache.Find(key);
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_NE(entry->window_bits, 4u);
+
+  // The cached entry is run without the other candidates.
+  window_bits_list.clear();
+  ASSERT_TRUE(cache.Run(key, candidates, [&](const auto& entry) {
+    window_bits_list.push_back(entry.window_bits);
+    return true;
+  }));
+  EXPECT_EQ(window_bits_list, (std::vector<unsigned int>{entry->window_bits}));
+
+  EXPECT_FALSE(cache.Run({"cpu", "bn254::G1", 11}, candidates,
+                         [](const auto&) { return false; }));
+}
+
+TEST_F(MSMTuningCacheTest, VariableBaseMSM) {
+  using Point = bn254::G1AffinePoint;
+  using Bucket = VariableBaseMSM<Point>::Bucket;
+
+  Point::Curve::Init();
+  VariableBaseMSMTestSet<Point> test_set =
+      VariableBaseMSMTestSet<Point>::Random(100, VariableBaseMSMMethod::kNaive);
+
+  MSMTuningCache cache(path_);
+  VariableBaseMSM<Point> msm;
+  msm.SetTuningCache(&cache);
+  for (size_t i = 0; i < 2; ++i) {
+    Bucket ret;
+    ASSERT_TRUE(msm.Run(test_set.bases, test_set.scalars, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+
+  std::string content;
+  ASSERT_TRUE(base::ReadFileToString(path_, &content));
+  // The MSM of size 100 is tuned as the one of 2⁷.
+  EXPECT_NE(content.find("\ttachyon::math::bn254::G1\t7\tpippenger\t"),
+            std::string::npos);
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,225 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_BASES_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_BASES_MSM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/memory/default_init_allocator.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::math {
+
+// MSM(Multi-Scalar Multiplication): s₀ * g₀ + s₁ * g₁ + ... + sₙ₋₁ * gₙ₋₁
+// |PrecomputedBasesMSM| is a variable-base MSM for bases that never change,
+// like the SRS of a KZG commitment or the queries of a Groth16 proving key.
+//
+// With a precompute factor f, each scalar is split into f chunks of
+// c = ⌈|kModulusBits| / f⌉ bits and the table stores 2^(c * t) * gᵢ for
+// 0 ≤ t < f. An MSM of n scalars then turns into an MSM of f * n scalars of c
+// bits, which needs f times fewer windows, hence f times fewer bucket
+// reductions and doublings, at the cost of f times more memory.
+template <typename Point>
+class PrecomputedBasesMSM {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename PippengerBase<Point>::Bucket;
+
+  constexpr static size_t N = ScalarField::N;
+  constexpr static size_t kDefaultPrecomputeFactor = 4;
+
+  PrecomputedBasesMSM() = default;
+  PrecomputedBasesMSM(size_t precompute_factor, std::vector<Point>&& table)
+      : precompute_factor_(precompute_factor),
+        chunk_bits_(ComputeChunkBits(precompute_factor)),
+        table_(std::move(table)) {
+    CHECK_GT(precompute_factor_, size_t{0});
+    CHECK_EQ(table_.size() % precompute_factor_, size_t{0});
+  }
+
+  size_t precompute_factor() const { return precompute_factor_; }
+  size_t chunk_bits() const { return chunk_bits_; }
+  const std::vector<Point>& table() const { return table_; }
+
+  // Returns the number of bases.
+  size_t size() const {
+    return precompute_factor_ == 0 ? 0 : table_.size() / precompute_factor_;
+  }
+
+  template <typename BaseContainer>
+  [[nodiscard]] bool Precompute(const BaseContainer& bases,
+                                size_t precompute_factor) {
+    if (precompute_factor == 0 ||
+        precompute_factor > ScalarField::Config::kModulusBits) {
+      LOG(ERROR) << "Invalid precompute factor: " << precompute_factor;
+      return false;
+    }
+    precompute_factor_ = precompute_factor;
+    chunk_bits_ = ComputeChunkBits(precompute_factor);
+
+    size_t size = std::size(bases);
+    std::vector<Bucket> shifted_bases(size * precompute_factor);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      Bucket shifted_base;
+      if constexpr (std::is_same_v<Point, Bucket>) {
+        shifted_base = bases[i];
+      } else {
+        shifted_base = ConvertPoint<Bucket>(bases[i]);
+      }
+      shifted_bases[i] = shifted_base;
+      for (size_t t = 1; t < precompute_factor; ++t) {
+        for (size_t j = 0; j < chunk_bits_; ++j) {
+          shifted_base.DoubleInPlace();
+        }
+        shifted_bases[t * size + i] = shifted_base;
+      }
+    }
+
+    if constexpr (std::is_same_v<Point, Bucket>) {
+      table_ = std::move(shifted_bases);
+      return true;
+    } else {
+      table_.resize(shifted_bases.size());
+      if constexpr (std::is_same_v<Point,
+                                   AffinePoint<typename Point::Curve>>) {
+        return Bucket::BatchNormalize(shifted_bases, &table_);
+      } else {
+        return ConvertPoints(shifted_bases, &table_);
+      }
+    }
+  }
+
+  // Computes the MSM between |scalars| and the first |std::size(scalars)|
+  // bases. This is thread-safe, since it doesn't touch any member.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool Run(const ScalarContainer& scalars, Bucket* ret) const {
+    size_t scalars_size = std::size(scalars);
+    if (scalars_size > size()) {
+      LOG(ERROR) << "Too many scalars: " << scalars_size << " > " << size();
+      return false;
+    }
+    if (scalars_size == 0) {
+      *ret = Bucket::Zero();
+      return true;
+    }
+
+    base::UninitializedVector<BigInt<N>> scalar_bigints(scalars_size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars_size; ++i) {
+      scalar_bigints[i] = scalars[i].ToBigInt();
+    }
+
+    size_t terms = scalars_size * precompute_factor_;
+    size_t window_bits =
+        std::min(size_t{MSMCtx::ComputeWindowsBits(terms)}, chunk_bits_);
+    size_t window_count = (chunk_bits_ + window_bits - 1) / window_bits;
+
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+    size_t chunk_size = (terms + thread_nums - 1) / thread_nums;
+    size_t num_chunks = (terms + chunk_size - 1) / chunk_size;
+
+    // |window_sums[i * window_count + j]| holds the j-th window sum of the i-th
+    // chunk of terms.
+    std::vector<Bucket> window_sums(num_chunks * window_count);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+      size_t start = i * chunk_size;
+      size_t end = std::min(start + chunk_size, terms);
+      std::vector<Bucket> buckets((size_t{1} << window_bits) - 1);
+      for (size_t j = 0; j < window_count; ++j) {
+        size_t bit_count = std::min(window_bits, chunk_bits_ - j * window_bits);
+        std::fill(buckets.begin(), buckets.end(), Bucket::Zero());
+        for (size_t k = start; k < end; ++k) {
+          // The k-th term is the |k % scalars_size|-th scalar's
+          // |k / scalars_size|-th chunk.
+          size_t t = k / scalars_size;
+          size_t scalar_index = k - t * scalars_size;
+          uint64_t digit = ExtractDigit(scalar_bigints[scalar_index],
+                                        t * chunk_bits_ + j * window_bits,
+                                        bit_count);
+          if (digit != 0) {
+            buckets[digit - 1] += table_[t * size() + scalar_index];
+          }
+        }
+        window_sums[i * window_count + j] =
+            PippengerBase<Point>::AccumulateBuckets(buckets);
+      }
+    }
+
+    for (size_t i = 1; i < num_chunks; ++i) {
+      for (size_t j = 0; j < window_count; ++j) {
+        window_sums[j] += window_sums[i * window_count + j];
+      }
+    }
+    window_sums.resize(window_count);
+    *ret = PippengerBase<Point>::AccumulateWindowSums(window_sums, window_bits);
+    return true;
+  }
+
+ private:
+  constexpr static size_t ComputeChunkBits(size_t precompute_factor) {
+    return (ScalarField::Config::kModulusBits + precompute_factor - 1) /
+           precompute_factor;
+  }
+
+  // Returns |bit_count| bits of |scalar| starting from |bit_offset|, treating
+  // the bits beyond the limbs as zero.
+  static uint64_t ExtractDigit(const BigInt<N>& scalar, size_t bit_offset,
+                               size_t bit_count) {
+    constexpr size_t kBitNums = N * 64;
+    if (bit_offset >= kBitNums) return 0;
+    bit_count = std::min(bit_count, kBitNums - bit_offset);
+    return scalar.ExtractBits64(bit_offset, bit_count);
+  }
+
+  size_t precompute_factor_ = 0;
+  size_t chunk_bits_ = 0;
+  // |table_[t * size() + i]| = 2^(|chunk_bits_| * t) * gᵢ
+  std::vector<Point> table_;
+};
+
+}  // namespace tachyon::math
+
+namespace tachyon::base {
+
+template <typename Point>
+class Copyable<math::PrecomputedBasesMSM<Point>> {
+ public:
+  using MSM = math::PrecomputedBasesMSM<Point>;
+
+  static bool WriteTo(const MSM& msm, Buffer* buffer) {
+    return buffer->WriteMany(msm.precompute_factor(), msm.table());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, MSM* msm) {
+    size_t precompute_factor;
+    std::vector<Point> table;
+    if (!buffer.ReadMany(&precompute_factor, &table)) return false;
+    if (precompute_factor == 0 || table.size() % precompute_factor != 0) {
+      LOG(ERROR) << "Invalid precomputed table";
+      return false;
+    }
+    *msm = MSM(precompute_factor, std::move(table));
+    return true;
+  }
+
+  static size_t EstimateSize(const MSM& msm) {
+    return base::EstimateSize(msm.precompute_factor(), msm.table());
+  }
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_BASES_MSM_H_
@@ -0,0 +1,110 @@
+#include "tachyon/math/elliptic_curves/msm/precomputed_bases_msm.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+template <typename Point>
+class PrecomputedBasesMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+
+  PrecomputedBasesMSMTest()
+      : test_set_(VariableBaseMSMTestSet<Point>::Random(
+            kSize, VariableBaseMSMMethod::kNaive)) {}
+  PrecomputedBasesMSMTest(const PrecomputedBasesMSMTest&) = delete;
+  PrecomputedBasesMSMTest& operator=(const PrecomputedBasesMSMTest&) = delete;
+  ~PrecomputedBasesMSMTest() override = default;
+
+ protected:
+  VariableBaseMSMTestSet<Point> test_set_;
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint,
+                   bn254::G1PointXYZZ>;
+TYPED_TEST_SUITE(PrecomputedBasesMSMTest, PointTypes);
+
+TYPED_TEST(PrecomputedBasesMSMTest, Run) {
+  using Point = TypeParam;
+  using Bucket = typename PrecomputedBasesMSM<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  for (size_t precompute_factor : {1, 2, 4, 8}) {
+    SCOPED_TRACE(absl::Substitute("precompute_factor: $0", precompute_factor));
+    PrecomputedBasesMSM<Point> msm;
+    ASSERT_TRUE(msm.Precompute(test_set.bases, precompute_factor));
+    EXPECT_EQ(msm.size(), kSize);
+
+    Bucket ret;
+    ASSERT_TRUE(msm.Run(test_set.scalars, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(PrecomputedBasesMSMTest, RunWithFewerScalars) {
+  using Point = TypeParam;
+  using Bucket = typename PrecomputedBasesMSM<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  PrecomputedBasesMSM<Point> msm;
+  ASSERT_TRUE(msm.Precompute(
+      test_set.bases, PrecomputedBasesMSM<Point>::kDefaultPrecomputeFactor));
+
+  absl::Span<const Point> bases =
+      absl::MakeConstSpan(test_set.bases).subspan(0, kSize / 2);
+  absl::Span<const typename Point::ScalarField> scalars =
+      absl::MakeConstSpan(test_set.scalars).subspan(0, kSize / 2);
+  VariableBaseMSM<Point> variable_base_msm;
+  Bucket expected;
+  ASSERT_TRUE(variable_base_msm.Run(bases, scalars, &expected));
+
+  Bucket ret;
+  ASSERT_TRUE(msm.Run(scalars, &ret));
+  EXPECT_EQ(ret, expected);
+
+  std::vector<typename Point::ScalarField> too_many_scalars(kSize + 1);
+  EXPECT_FALSE(msm.Run(too_many_scalars, &ret));
+}
+
+TYPED_TEST(PrecomputedBasesMSMTest, Copyable) {
+  using Point = TypeParam;
+  using Bucket = typename PrecomputedBasesMSM<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  PrecomputedBasesMSM<Point> expected;
+  ASSERT_TRUE(expected.Precompute(test_set.bases, 3));
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  PrecomputedBasesMSM<Point> value;
+  ASSERT_TRUE(write_buf.Read(&value));
+  EXPECT_EQ(value.precompute_factor(), expected.precompute_factor());
+  EXPECT_EQ(value.chunk_bits(), expected.chunk_bits());
+  EXPECT_EQ(value.table(), expected.table());
+
+  Bucket ret;
+  ASSERT_TRUE(value.Run(test_set.scalars, &ret));
+  EXPECT_EQ(ret, test_set.answer);
+}
+
+}  // namespace tachyon::math
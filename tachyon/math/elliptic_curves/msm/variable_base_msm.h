@@ -1,8 +1,13 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 
+#include <iterator>
 #include <utility>
+#include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/metrics/metrics_registry.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
 
 namespace tachyon::math {
@@ -12,21 +17,32 @@ namespace tachyon::math {
 // with respective scalars, unlike the Fixed-base MSM, which uses the same
 // base point for all multiplications.
 // This implementation uses Pippenger's algorithm to compute the MSM.
+// The points of the MSMs and the time spent on them are recorded as
+// tachyon_msm_points_total{device="cpu"} and tachyon_msm_seconds{device="cpu"}
+// if the metrics are enabled. See |base::ThroughputMetrics|.
+// NOTE: |Run()| reuses the internal buffers of the previous run, so a single
+// instance must not be used from multiple threads at the same time.
 template <typename Point>
 class VariableBaseMSM {
  public:
   using ScalarField = typename Point::ScalarField;
   using Bucket = typename Pippenger<Point>::Bucket;
 
+  // See |PippengerAdapter::SetTuningCache()|.
+  void SetTuningCache(MSMTuningCache* tuning_cache) {
+    pippenger_.SetTuningCache(tuning_cache);
+  }
+
   template <typename BaseInputIterator, typename ScalarInputIterator>
   [[nodiscard]] bool Run(BaseInputIterator bases_first,
                          BaseInputIterator bases_last,
                          ScalarInputIterator scalars_first,
                          ScalarInputIterator scalars_last, Bucket* ret) {
-    PippengerAdapter<Point> pippenger;
-    return pippenger.Run(std::move(bases_first), std::move(bases_last),
-                         std::move(scalars_first), std::move(scalars_last),
-                         ret);
+    base::ThroughputMetrics::Scope scope =
+        GetMetrics().Measure(std::distance(scalars_first, scalars_last));
+    return pippenger_.Run(std::move(bases_first), std::move(bases_last),
+                          std::move(scalars_first), std::move(scalars_last),
+                          ret);
   }
 
   template <typename BaseContainer, typename ScalarContainer>
@@ -35,6 +51,37 @@ class VariableBaseMSM {
     return Run(std::begin(bases), std::end(bases), std::begin(scalars),
                std::end(scalars), ret);
   }
+
+  // Computes an MSM between |bases| and each of |scalars_list| and populates
+  // |rets| with the results in the same order. Unlike calling |Run()| for each
+  // of them, the bases are loaded once for all the MSMs. See
+  // |Pippenger::RunBatch()|. Each of |scalars_list| may be shorter than
+  // |bases|.
+  template <typename BaseContainer>
+  [[nodiscard]] bool RunBatch(
+      const BaseContainer& bases,
+      absl::Span<const absl::Span<const ScalarField>> scalars_list,
+      std::vector<Bucket>* rets) {
+    size_t num_points = 0;
+    for (absl::Span<const ScalarField> scalars : scalars_list) {
+      num_points += scalars.size();
+    }
+    base::ThroughputMetrics::Scope scope = GetMetrics().Measure(num_points);
+    rets->resize(scalars_list.size());
+    return pippenger_.RunBatch(std::begin(bases), std::end(bases),
+                               scalars_list, absl::MakeSpan(*rets));
+  }
+
+ private:
+  static const base::ThroughputMetrics& GetMetrics() {
+    static const base::ThroughputMetrics metrics("tachyon_msm", "points",
+                                                 {{"device", "cpu"}});
+    return metrics;
+  }
+
+  // Kept across runs so that the buckets and digits allocated by the previous
+  // run are reused.
+  PippengerAdapter<Point> pippenger_;
 };
 
 }  // namespace tachyon::math
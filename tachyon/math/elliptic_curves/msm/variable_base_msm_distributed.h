@@ -0,0 +1,92 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_DISTRIBUTED_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_DISTRIBUTED_H_
+
+#include <stddef.h>
+
+#include <numeric>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/distributed/communicator.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/range.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+
+namespace tachyon::math {
+
+// |VariableBaseMSMDistributed| shards an MSM across the ranks of a
+// |base::Communicator|, e.g., several hosts whose memory together holds the
+// bases. The i-th rank holds only the bases and the scalars in
+// |GetShard(size)| of the i-th rank, runs |VariableBaseMSM| on them and the
+// partial results are summed up on every rank.
+//
+// NOTE: Every rank must call |Run()| or |RunBatch()| in the same order.
+template <typename Point>
+class VariableBaseMSMDistributed {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename VariableBaseMSM<Point>::Bucket;
+
+  explicit VariableBaseMSMDistributed(base::Communicator* comm)
+      : comm_(comm) {}
+  VariableBaseMSMDistributed(const VariableBaseMSMDistributed& other) =
+      delete;
+  VariableBaseMSMDistributed& operator=(
+      const VariableBaseMSMDistributed& other) = delete;
+
+  // Returns the range of an MSM of |size| terms that this rank holds.
+  base::Range<size_t> GetShard(size_t size) const {
+    return comm_->GetShard(size);
+  }
+
+  // |bases| and |scalars| are the shard of this rank. |ret| is set to the MSM
+  // over the shards of all the ranks.
+  [[nodiscard]] bool Run(absl::Span<const Point> bases,
+                         absl::Span<const ScalarField> scalars, Bucket* ret) {
+    if (bases.size() != scalars.size()) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+    Bucket partial;
+    if (!msm_.Run(bases, scalars, &partial)) return false;
+
+    std::vector<Bucket> partials;
+    if (!comm_->AllGather(partial, &partials)) return false;
+    *ret = std::accumulate(partials.begin(), partials.end(), Bucket::Zero());
+    return true;
+  }
+
+  // Same as above, but runs an MSM between |bases| and each of
+  // |scalars_list|. See |VariableBaseMSM::RunBatch()|.
+  [[nodiscard]] bool RunBatch(
+      absl::Span<const Point> bases,
+      absl::Span<const absl::Span<const ScalarField>> scalars_list,
+      std::vector<Bucket>* rets) {
+    std::vector<Bucket> partial;
+    if (!msm_.RunBatch(bases, scalars_list, &partial)) return false;
+
+    std::vector<std::vector<Bucket>> partials;
+    if (!comm_->AllGather(partial, &partials)) return false;
+    rets->assign(scalars_list.size(), Bucket::Zero());
+    for (const std::vector<Bucket>& buckets : partials) {
+      if (buckets.size() != rets->size()) {
+        LOG(ERROR) << "The number of MSMs don't match across the ranks";
+        return false;
+      }
+      for (size_t i = 0; i < buckets.size(); ++i) {
+        (*rets)[i] += buckets[i];
+      }
+    }
+    return true;
+  }
+
+ private:
+  // not owned
+  base::Communicator* const comm_;
+  VariableBaseMSM<Point> msm_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_DISTRIBUTED_H_
@@ -0,0 +1,57 @@
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm_distributed.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/distributed/local_transport.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+constexpr size_t kSize = 40;
+constexpr int kWorldSize = 3;
+
+class VariableBaseMSMDistributedTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+};
+
+}  // namespace
+
+TEST_F(VariableBaseMSMDistributedTest, Run) {
+  using Point = bn254::G1AffinePoint;
+  using Bucket = typename VariableBaseMSMDistributed<Point>::Bucket;
+
+  VariableBaseMSMTestSet<Point> test_set =
+      VariableBaseMSMTestSet<Point>::Random(kSize,
+                                            VariableBaseMSMMethod::kNaive);
+
+  base::LocalTransportGroup group(kWorldSize);
+  std::vector<Bucket> rets(kWorldSize);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kWorldSize; ++i) {
+    threads.emplace_back([&group, &test_set, &rets, i]() {
+      base::Communicator comm(group.GetTransport(i));
+      VariableBaseMSMDistributed<Point> msm(&comm);
+      base::Range<size_t> shard = msm.GetShard(kSize);
+      CHECK(msm.Run(absl::MakeConstSpan(test_set.bases)
+                        .subspan(shard.from, shard.GetSize()),
+                    absl::MakeConstSpan(test_set.scalars)
+                        .subspan(shard.from, shard.GetSize()),
+                    &rets[i]));
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const Bucket& ret : rets) {
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+}  // namespace tachyon::math
@@ -2,9 +2,19 @@
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_GPU_H_
 
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/metrics/metrics_registry.h"
+#include "tachyon/device/gpu/gpu_logging.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/bellman/bellman_msm.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/cuzk/cuzk.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/msm_tuning_cache.h"
 
 namespace tachyon::math {
 
@@ -15,8 +25,25 @@ class VariableBaseMSMGpu {
   using CpuCurve = typename GpuCurve::CpuCurve;
 
   VariableBaseMSMGpu(MSMAlgorithmKind kind, gpuMemPool_t mem_pool,
-                     gpuStream_t stream) {
-    algo_ = Create(kind, mem_pool, stream);
+                     gpuStream_t stream)
+      : kind_(kind), mem_pool_(mem_pool), stream_(stream) {}
+
+  // Takes the algorithm and the window size of each size of the MSMs from
+  // |tuning_cache|, which measures the candidates by the first MSM of the
+  // size on the current device.
+  VariableBaseMSMGpu(MSMTuningCache* tuning_cache, gpuMemPool_t mem_pool,
+                     gpuStream_t stream)
+      : tuning_cache_(tuning_cache), mem_pool_(mem_pool), stream_(stream) {
+    int device_id = 0;
+    gpuDeviceProp props{};
+    if (LOG_IF_GPU_ERROR(gpuGetDevice(&device_id),
+                         "Failed to gpuGetDevice()") == gpuSuccess &&
+        LOG_IF_GPU_ERROR(gpuGetDeviceProperties(&props, device_id),
+                         "Failed to gpuGetDeviceProperties()") == gpuSuccess) {
+      device_name_ = props.name;
+    } else {
+      device_name_ = "gpu";
+    }
   }
   VariableBaseMSMGpu(const VariableBaseMSMGpu& other) = delete;
   VariableBaseMSMGpu& operator=(const VariableBaseMSMGpu& other) = delete;
@@ -24,7 +51,43 @@ class VariableBaseMSMGpu {
   bool Run(const device::gpu::GpuMemory<AffinePoint<GpuCurve>>& bases,
            const device::gpu::GpuMemory<ScalarField>& scalars, size_t size,
            JacobianPoint<CpuCurve>* cpu_result) {
-    return algo_->Run(bases, scalars, size, cpu_result);
+    // See |VariableBaseMSM|.
+    static const base::ThroughputMetrics metrics("tachyon_msm", "points",
+                                                 {{"device", "gpu"}});
+    base::ThroughputMetrics::Scope scope = metrics.Measure(size);
+    if (tuning_cache_ == nullptr || size == 0) {
+      return GetAlgorithm(kind_)->Run(bases, scalars, size, cpu_result);
+    }
+
+    MSMTuningCache::Key key = {device_name_, GpuCurve::Config::kName,
+                               base::bits::SafeLog2Ceiling(size)};
+    return tuning_cache_->Run(
+        key, GetCandidates(key.log_size, size),
+        [&](const MSMTuningCache::Entry& entry) {
+          MSMGpuAlgorithm<GpuCurve>* algo = GetAlgorithm(entry.algorithm);
+          algo->SetWindowBits(entry.window_bits);
+          bool ret = algo->Run(bases, scalars, size, cpu_result);
+          algo->SetWindowBits(0);
+          return ret;
+        });
+  }
+
+  // Runs an MSM between |bases| and each of |scalars_list| and populates
+  // |cpu_results| with the results in the same order. |bases| stay resident on
+  // the device for all the MSMs, so only the scalars differ between the runs.
+  // NOTE: The GPU kernels already allocate a set of buckets per MSM, so the
+  // MSMs are run one after another on the same stream.
+  bool RunBatch(
+      const device::gpu::GpuMemory<AffinePoint<GpuCurve>>& bases,
+      absl::Span<const device::gpu::GpuMemory<ScalarField>> scalars_list,
+      size_t size, std::vector<JacobianPoint<CpuCurve>>* cpu_results) {
+    cpu_results->resize(scalars_list.size());
+    for (size_t i = 0; i < scalars_list.size(); ++i) {
+      if (!Run(bases, scalars_list[i], size, &(*cpu_results)[i])) {
+        return false;
+      }
+    }
+    return true;
   }
 
  private:
@@ -42,7 +105,34 @@ class VariableBaseMSMGpu {
     return nullptr;
   }
 
-  std::unique_ptr<MSMGpuAlgorithm<GpuCurve>> algo_;
+  // Returns the windows around the default one of Bellman's MSM and the
+  // default one of cuZK.
+  static std::vector<MSMTuningCache::Entry> GetCandidates(
+      unsigned int log_size, size_t size) {
+    unsigned int window_bits = bellman::GetWindowsBitsCount(log_size);
+    return {
+        {MSMAlgorithmKind::kBellmanMSM, window_bits - 1},
+        {MSMAlgorithmKind::kBellmanMSM, window_bits},
+        {MSMAlgorithmKind::kBellmanMSM, window_bits + 1},
+        {MSMAlgorithmKind::kCUZK, MSMCtx::ComputeWindowsBits(size)},
+    };
+  }
+
+  MSMGpuAlgorithm<GpuCurve>* GetAlgorithm(MSMAlgorithmKind kind) {
+    std::unique_ptr<MSMGpuAlgorithm<GpuCurve>>& algo = algos_[kind];
+    if (!algo) algo = Create(kind, mem_pool_, stream_);
+    return algo.get();
+  }
+
+  MSMAlgorithmKind kind_ = MSMAlgorithmKind::kBellmanMSM;
+  MSMTuningCache* tuning_cache_ = nullptr;
+  std::string device_name_;
+  gpuMemPool_t mem_pool_ = nullptr;
+  gpuStream_t stream_ = nullptr;
+  // Created on the first use, since only the tuning uses more than one.
+  absl::flat_hash_map<MSMAlgorithmKind,
+                      std::unique_ptr<MSMGpuAlgorithm<GpuCurve>>>
+      algos_;
 };
 
 }  // namespace tachyon::math
@@ -1,15 +1,25 @@
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm_gpu.h"
 
 #include <limits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "tachyon/device/gpu/gpu_enums.h"
 #include "tachyon/device/gpu/gpu_memory.h"
 #include "tachyon/device/gpu/scoped_mem_pool.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g1_gpu.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g2_gpu.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1_gpu.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2_gpu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/bellman/bls12_381_bellman_msm_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/bellman/bls12_381_g2_bellman_msm_kernels.cu.h"
 #include "tachyon/math/elliptic_curves/msm/kernels/bellman/bn254_bellman_msm_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/bellman/bn254_g2_bellman_msm_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/cuzk/bls12_381_cuzk_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/cuzk/bls12_381_g2_cuzk_kernels.cu.h"
 #include "tachyon/math/elliptic_curves/msm/kernels/cuzk/bn254_cuzk_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/cuzk/bn254_g2_cuzk_kernels.cu.h"
 #include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
 
 namespace tachyon::math {
@@ -28,17 +38,17 @@ class VariableMSMCorrectnessGpuTest : public testing::Test {
   static void SetUpTestSuite() {
     bn254::G1Curve::Init();
 
-    VariableBaseMSMTestSet<bn254::G1AffinePoint> test_set =
-        VariableBaseMSMTestSet<bn254::G1AffinePoint>::Random(
-            kCount, VariableBaseMSMMethod::kMSM);
+    test_set_ = VariableBaseMSMTestSet<bn254::G1AffinePoint>::Random(
+        kCount, VariableBaseMSMMethod::kMSM);
 
     d_bases_ = gpu::GpuMemory<bn254::G1AffinePointGpu>::Malloc(kCount);
     d_scalars_ = gpu::GpuMemory<bn254::FrGpu>::Malloc(kCount);
 
-    CHECK(d_bases_.CopyFrom(test_set.bases.data(), gpu::GpuMemoryType::kHost));
-    CHECK(d_scalars_.CopyFrom(test_set.scalars.data(),
+    CHECK(
+        d_bases_.CopyFrom(test_set_.bases.data(), gpu::GpuMemoryType::kHost));
+    CHECK(d_scalars_.CopyFrom(test_set_.scalars.data(),
                               gpu::GpuMemoryType::kHost));
-    expected_ = test_set.answer.ToJacobian();
+    expected_ = test_set_.answer.ToJacobian();
   }
 
   static void TearDownTestSuite() {
@@ -49,15 +59,47 @@ class VariableMSMCorrectnessGpuTest : public testing::Test {
   }
 
  protected:
+  static VariableBaseMSMTestSet<bn254::G1AffinePoint> test_set_;
   static gpu::GpuMemory<bn254::G1AffinePointGpu> d_bases_;
   static gpu::GpuMemory<bn254::FrGpu> d_scalars_;
   static bn254::G1JacobianPoint expected_;
 };
 
+VariableBaseMSMTestSet<bn254::G1AffinePoint>
+    VariableMSMCorrectnessGpuTest::test_set_;
+
 gpu::GpuMemory<bn254::G1AffinePointGpu> VariableMSMCorrectnessGpuTest::d_bases_;
 gpu::GpuMemory<bn254::FrGpu> VariableMSMCorrectnessGpuTest::d_scalars_;
 bn254::G1JacobianPoint VariableMSMCorrectnessGpuTest::expected_;
 
+template <typename GpuCurve>
+void TestMSMOnCurve(gpuMemPool_t mem_pool, gpuStream_t stream, size_t size) {
+  using CpuCurve = typename GpuCurve::CpuCurve;
+  using ScalarField = typename AffinePoint<GpuCurve>::ScalarField;
+
+  CpuCurve::Init();
+  VariableBaseMSMTestSet<AffinePoint<CpuCurve>> test_set =
+      VariableBaseMSMTestSet<AffinePoint<CpuCurve>>::Random(
+          size, VariableBaseMSMMethod::kMSM);
+
+  gpu::GpuMemory<AffinePoint<GpuCurve>> d_bases =
+      gpu::GpuMemory<AffinePoint<GpuCurve>>::Malloc(size);
+  gpu::GpuMemory<ScalarField> d_scalars =
+      gpu::GpuMemory<ScalarField>::Malloc(size);
+  ASSERT_TRUE(
+      d_bases.CopyFrom(test_set.bases.data(), gpu::GpuMemoryType::kHost));
+  ASSERT_TRUE(
+      d_scalars.CopyFrom(test_set.scalars.data(), gpu::GpuMemoryType::kHost));
+
+  for (MSMAlgorithmKind algorithm :
+       {MSMAlgorithmKind::kBellmanMSM, MSMAlgorithmKind::kCUZK}) {
+    VariableBaseMSMGpu<GpuCurve> msm_gpu(algorithm, mem_pool, stream);
+    JacobianPoint<CpuCurve> actual;
+    ASSERT_TRUE(msm_gpu.Run(d_bases, d_scalars, size, &actual));
+    EXPECT_EQ(actual, test_set.answer.ToJacobian());
+  }
+}
+
 }  // namespace
 
 TEST_F(VariableMSMCorrectnessGpuTest, MSM) {
@@ -83,4 +125,116 @@ TEST_F(VariableMSMCorrectnessGpuTest, MSM) {
   }
 }
 
+TEST_F(VariableMSMCorrectnessGpuTest, RunRepeatedly) {
+  gpuMemPoolProps props = {gpuMemAllocationTypePinned,
+                           gpuMemHandleTypeNone,
+                           {gpuMemLocationTypeDevice, 0}};
+  gpu::ScopedMemPool mem_pool = gpu::CreateMemPool(&props);
+
+  uint64_t mem_pool_threshold = std::numeric_limits<uint64_t>::max();
+  gpuError_t error = gpuMemPoolSetAttribute(
+      mem_pool.get(), gpuMemPoolAttrReleaseThreshold, &mem_pool_threshold);
+  ASSERT_EQ(error, gpuSuccess);
+
+  gpu::ScopedStream stream = gpu::CreateStream();
+
+  gpu::GpuMemory<bn254::FrGpu> zero_scalars =
+      gpu::GpuMemory<bn254::FrGpu>::Malloc(kCount);
+  ASSERT_TRUE(zero_scalars.Memset());
+
+  // The MSMs of the same size replay the launches of the first one, while
+  // the different scalars update them.
+  VariableBaseMSMGpu<bn254::G1CurveGpu> msm_gpu(
+      MSMAlgorithmKind::kBellmanMSM, mem_pool.get(), stream.get());
+  for (size_t i = 0; i < 2; ++i) {
+    bn254::G1JacobianPoint actual;
+    ASSERT_TRUE(msm_gpu.Run(d_bases_, d_scalars_, kCount, &actual));
+    EXPECT_EQ(actual, expected_);
+    ASSERT_TRUE(msm_gpu.Run(d_bases_, d_scalars_, kCount, &actual));
+    EXPECT_EQ(actual, expected_);
+    ASSERT_TRUE(msm_gpu.Run(d_bases_, zero_scalars, kCount, &actual));
+    EXPECT_TRUE(actual.IsZero());
+  }
+}
+
+TEST_F(VariableMSMCorrectnessGpuTest, RunBatch) {
+  gpuMemPoolProps props = {gpuMemAllocationTypePinned,
+                           gpuMemHandleTypeNone,
+                           {gpuMemLocationTypeDevice, 0}};
+  gpu::ScopedMemPool mem_pool = gpu::CreateMemPool(&props);
+
+  uint64_t mem_pool_threshold = std::numeric_limits<uint64_t>::max();
+  gpuError_t error = gpuMemPoolSetAttribute(
+      mem_pool.get(), gpuMemPoolAttrReleaseThreshold, &mem_pool_threshold);
+  ASSERT_EQ(error, gpuSuccess);
+
+  gpu::ScopedStream stream = gpu::CreateStream();
+
+  std::vector<gpu::GpuMemory<bn254::FrGpu>> scalars_list;
+  scalars_list.push_back(gpu::GpuMemory<bn254::FrGpu>::Malloc(kCount));
+  ASSERT_TRUE(scalars_list.back().CopyFrom(d_scalars_));
+  scalars_list.push_back(gpu::GpuMemory<bn254::FrGpu>::Malloc(kCount));
+  ASSERT_TRUE(scalars_list.back().Memset());
+
+  for (MSMAlgorithmKind algorithm :
+       {MSMAlgorithmKind::kBellmanMSM, MSMAlgorithmKind::kCUZK}) {
+    VariableBaseMSMGpu<bn254::G1CurveGpu> msm_gpu(algorithm, mem_pool.get(),
+                                                  stream.get());
+    std::vector<bn254::G1JacobianPoint> actuals;
+    ASSERT_TRUE(msm_gpu.RunBatch(d_bases_, scalars_list, kCount, &actuals));
+    ASSERT_EQ(actuals.size(), scalars_list.size());
+    EXPECT_EQ(actuals[0], expected_);
+    EXPECT_TRUE(actuals[1].IsZero());
+  }
+}
+
+TEST_F(VariableMSMCorrectnessGpuTest, MSMWithoutPadding) {
+  gpuMemPoolProps props = {gpuMemAllocationTypePinned,
+                           gpuMemHandleTypeNone,
+                           {gpuMemLocationTypeDevice, 0}};
+  gpu::ScopedMemPool mem_pool = gpu::CreateMemPool(&props);
+
+  uint64_t mem_pool_threshold = std::numeric_limits<uint64_t>::max();
+  gpuError_t error = gpuMemPoolSetAttribute(
+      mem_pool.get(), gpuMemPoolAttrReleaseThreshold, &mem_pool_threshold);
+  ASSERT_EQ(error, gpuSuccess);
+
+  gpu::ScopedStream stream = gpu::CreateStream();
+
+  // The inputs after |size| are not zeroed, so they must not be read.
+  size_t size = kCount - 3;
+  bn254::G1JacobianPoint expected = bn254::G1JacobianPoint::Zero();
+  for (size_t i = 0; i < size; ++i) {
+    expected += test_set_.bases[i] * test_set_.scalars[i];
+  }
+
+  for (MSMAlgorithmKind algorithm :
+       {MSMAlgorithmKind::kBellmanMSM, MSMAlgorithmKind::kCUZK}) {
+    VariableBaseMSMGpu<bn254::G1CurveGpu> msm_gpu(algorithm, mem_pool.get(),
+                                                  stream.get());
+    bn254::G1JacobianPoint actual;
+    ASSERT_TRUE(msm_gpu.Run(d_bases_, d_scalars_, size, &actual));
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST_F(VariableMSMCorrectnessGpuTest, MSMOnOtherCurves) {
+  gpuMemPoolProps props = {gpuMemAllocationTypePinned,
+                           gpuMemHandleTypeNone,
+                           {gpuMemLocationTypeDevice, 0}};
+  gpu::ScopedMemPool mem_pool = gpu::CreateMemPool(&props);
+
+  uint64_t mem_pool_threshold = std::numeric_limits<uint64_t>::max();
+  gpuError_t error = gpuMemPoolSetAttribute(
+      mem_pool.get(), gpuMemPoolAttrReleaseThreshold, &mem_pool_threshold);
+  ASSERT_EQ(error, gpuSuccess);
+
+  gpu::ScopedStream stream = gpu::CreateStream();
+
+  // The G2 curves run on |Fp2| over the device prime field.
+  TestMSMOnCurve<bn254::G2CurveGpu>(mem_pool.get(), stream.get(), kCount);
+  TestMSMOnCurve<bls12_381::G1CurveGpu>(mem_pool.get(), stream.get(), kCount);
+  TestMSMOnCurve<bls12_381::G2CurveGpu>(mem_pool.get(), stream.get(), kCount);
+}
+
 }  // namespace tachyon::math
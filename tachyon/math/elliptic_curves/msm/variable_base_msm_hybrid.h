@@ -0,0 +1,173 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_HYBRID_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_HYBRID_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <thread>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/time_interval.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm_gpu.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::math {
+
+// |VariableBaseMSMHybrid| splits an MSM between a GPU device and the CPU, so
+// that the host cores don't sit idle while the device runs. The first
+// |gpu_ratio()| of the bases and the scalars runs on |VariableBaseMSMGpu| in
+// a separate thread, while the rest runs on |VariableBaseMSM| in the calling
+// thread, and the two results are summed up.
+//
+// If adaptive, which is the default, the ratio is moved toward the ratio of
+// the throughputs measured by each run, so that both sides finish at about the
+// same time.
+//
+// NOTE: |Run()| must not be called concurrently.
+template <typename GpuCurve>
+class VariableBaseMSMHybrid {
+ public:
+  using ScalarField = typename JacobianPoint<GpuCurve>::ScalarField;
+  using CpuCurve = typename GpuCurve::CpuCurve;
+  using CpuScalarField = typename JacobianPoint<CpuCurve>::ScalarField;
+
+  // The GPU usually runs an MSM an order of magnitude faster than the CPU.
+  constexpr static double kDefaultGpuRatio = 0.9;
+  // The adaptive ratio is kept within [|kMinGpuRatio|, |kMaxGpuRatio|], so
+  // that both sides keep being measured.
+  constexpr static double kMinGpuRatio = 0.01;
+  constexpr static double kMaxGpuRatio = 0.99;
+
+  // |mem_pool| and |stream| should belong to the current device.
+  VariableBaseMSMHybrid(MSMAlgorithmKind kind, gpuMemPool_t mem_pool,
+                        gpuStream_t stream,
+                        double gpu_ratio = kDefaultGpuRatio)
+      : stream_(stream), gpu_msm_(kind, mem_pool, stream) {
+    GPU_MUST_SUCCESS(gpuGetDevice(&device_id_), "Failed to gpuGetDevice()");
+    set_gpu_ratio(gpu_ratio);
+  }
+  VariableBaseMSMHybrid(const VariableBaseMSMHybrid& other) = delete;
+  VariableBaseMSMHybrid& operator=(const VariableBaseMSMHybrid& other) =
+      delete;
+
+  double gpu_ratio() const { return gpu_ratio_; }
+  void set_gpu_ratio(double gpu_ratio) {
+    CHECK_GE(gpu_ratio, 0.0);
+    CHECK_LE(gpu_ratio, 1.0);
+    gpu_ratio_ = gpu_ratio;
+  }
+
+  bool adaptive() const { return adaptive_; }
+  void set_adaptive(bool adaptive) { adaptive_ = adaptive; }
+
+  [[nodiscard]] bool Run(absl::Span<const AffinePoint<CpuCurve>> bases,
+                         absl::Span<const CpuScalarField> scalars,
+                         JacobianPoint<CpuCurve>* cpu_result) {
+    if (bases.size() != scalars.size()) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+
+    size_t size = scalars.size();
+    size_t gpu_size = std::min(
+        size, static_cast<size_t>(gpu_ratio_ * static_cast<double>(size) +
+                                  0.5));
+    size_t cpu_size = size - gpu_size;
+
+    JacobianPoint<CpuCurve> gpu_result = JacobianPoint<CpuCurve>::Zero();
+    bool gpu_valid = true;
+    base::TimeDelta gpu_time;
+    std::thread gpu_thread;
+    if (gpu_size != 0) {
+      gpu_thread = std::thread([this, gpu_size, &bases, &scalars, &gpu_result,
+                                &gpu_valid, &gpu_time]() {
+        base::TimeInterval interval(base::TimeTicks::Now());
+        gpu_valid = RunOnGpu(bases.subspan(0, gpu_size),
+                             scalars.subspan(0, gpu_size), &gpu_result);
+        gpu_time = interval.GetTimeDelta();
+      });
+    }
+
+    JacobianPoint<CpuCurve> cpu_part_result = JacobianPoint<CpuCurve>::Zero();
+    bool cpu_valid = true;
+    base::TimeDelta cpu_time;
+    if (cpu_size != 0) {
+      base::TimeInterval interval(base::TimeTicks::Now());
+      typename VariableBaseMSM<AffinePoint<CpuCurve>>::Bucket bucket;
+      cpu_valid = cpu_msm_.Run(bases.subspan(gpu_size),
+                               scalars.subspan(gpu_size), &bucket);
+      cpu_time = interval.GetTimeDelta();
+      if (cpu_valid) {
+        cpu_part_result = ConvertPoint<JacobianPoint<CpuCurve>>(bucket);
+      }
+    }
+    if (gpu_thread.joinable()) gpu_thread.join();
+
+    if (!gpu_valid || !cpu_valid) return false;
+    if (adaptive_ && gpu_time.is_positive() && cpu_time.is_positive()) {
+      UpdateGpuRatio(gpu_size / gpu_time.InSecondsF(),
+                     cpu_size / cpu_time.InSecondsF());
+    }
+    *cpu_result = gpu_result + cpu_part_result;
+    return true;
+  }
+
+ private:
+  // Uploads the bases and the scalars and runs an MSM on the device. The
+  // device buffers grow to a power of 2 and are kept for the next run.
+  bool RunOnGpu(absl::Span<const AffinePoint<CpuCurve>> bases,
+                absl::Span<const CpuScalarField> scalars,
+                JacobianPoint<CpuCurve>* cpu_result) {
+    // NOTE: The current device is per host thread.
+    if (LOG_IF_GPU_ERROR(gpuSetDevice(device_id_),
+                         "Failed to gpuSetDevice()") != gpuSuccess) {
+      return false;
+    }
+    size_t size = bases.size();
+    size_t capacity = size_t{1} << base::bits::Log2Ceiling(size);
+    if (d_bases_.size() < capacity) {
+      d_bases_.reset();
+      d_scalars_.reset();
+      d_bases_ =
+          device::gpu::GpuMemory<AffinePoint<GpuCurve>>::Malloc(capacity);
+      d_scalars_ = device::gpu::GpuMemory<ScalarField>::Malloc(capacity);
+    }
+    if (!d_bases_.CopyFromPageableAsync(bases.data(), stream_, 0, size)) {
+      return false;
+    }
+    if (!d_scalars_.CopyFromPageableAsync(scalars.data(), stream_, 0, size)) {
+      return false;
+    }
+    return gpu_msm_.Run(d_bases_, d_scalars_, size, cpu_result);
+  }
+
+  // Moves |gpu_ratio_| halfway toward the ratio at which both sides would
+  // have finished at the same time, which damps the noise of a single run.
+  void UpdateGpuRatio(double gpu_throughput, double cpu_throughput) {
+    double measured_ratio = gpu_throughput / (gpu_throughput + cpu_throughput);
+    gpu_ratio_ = std::clamp((gpu_ratio_ + measured_ratio) / 2, kMinGpuRatio,
+                            kMaxGpuRatio);
+    VLOG(1) << "VariableBaseMSMHybrid: gpu_ratio = " << gpu_ratio_;
+  }
+
+  int device_id_ = 0;
+  gpuStream_t stream_ = nullptr;
+  double gpu_ratio_ = kDefaultGpuRatio;
+  bool adaptive_ = true;
+  VariableBaseMSMGpu<GpuCurve> gpu_msm_;
+  // Kept across runs so that the buckets allocated by the previous run are
+  // reused.
+  VariableBaseMSM<AffinePoint<CpuCurve>> cpu_msm_;
+  device::gpu::GpuMemory<AffinePoint<GpuCurve>> d_bases_;
+  device::gpu::GpuMemory<ScalarField> d_scalars_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_HYBRID_H_
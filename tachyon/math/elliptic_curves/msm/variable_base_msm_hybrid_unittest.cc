@@ -0,0 +1,70 @@
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm_hybrid.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/device/gpu/gpu_mem_pool_manager.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1_gpu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/bellman/bn254_bellman_msm_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/cuzk/bn254_cuzk_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class VariableBaseMSMHybridTest : public testing::Test {
+ public:
+  constexpr static size_t kCount = 1000;
+
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+
+  VariableBaseMSMHybridTest()
+      : test_set_(VariableBaseMSMTestSet<bn254::G1AffinePoint>::Random(
+            kCount, VariableBaseMSMMethod::kMSM)) {}
+
+  void SetUp() override {
+    device::gpu::GpuMemPoolManager& manager =
+        device::gpu::GpuMemPoolManager::GetInstance();
+    mem_pool_ = manager.GetMemPool(0);
+    stream_ = manager.GetStream(0);
+    ASSERT_TRUE(mem_pool_ && stream_);
+  }
+
+ protected:
+  VariableBaseMSMTestSet<bn254::G1AffinePoint> test_set_;
+  gpuMemPool_t mem_pool_ = nullptr;
+  gpuStream_t stream_ = nullptr;
+};
+
+}  // namespace
+
+TEST_F(VariableBaseMSMHybridTest, Run) {
+  for (MSMAlgorithmKind algorithm :
+       {MSMAlgorithmKind::kBellmanMSM, MSMAlgorithmKind::kCUZK}) {
+    VariableBaseMSMHybrid<bn254::G1CurveGpu> msm(algorithm, mem_pool_,
+                                                 stream_);
+    // The ratio adapts to the measured throughputs after each run.
+    for (size_t i = 0; i < 3; ++i) {
+      bn254::G1JacobianPoint actual;
+      ASSERT_TRUE(msm.Run(test_set_.bases, test_set_.scalars, &actual));
+      EXPECT_EQ(actual, test_set_.answer.ToJacobian());
+      EXPECT_GE(msm.gpu_ratio(), msm.kMinGpuRatio);
+      EXPECT_LE(msm.gpu_ratio(), msm.kMaxGpuRatio);
+    }
+  }
+}
+
+TEST_F(VariableBaseMSMHybridTest, RunWithFixedRatios) {
+  // Includes the ratios that run only on one side.
+  for (double gpu_ratio : {0.0, 0.3, 1.0}) {
+    VariableBaseMSMHybrid<bn254::G1CurveGpu> msm(
+        MSMAlgorithmKind::kBellmanMSM, mem_pool_, stream_, gpu_ratio);
+    msm.set_adaptive(false);
+    bn254::G1JacobianPoint actual;
+    ASSERT_TRUE(msm.Run(test_set_.bases, test_set_.scalars, &actual));
+    EXPECT_EQ(actual, test_set_.answer.ToJacobian());
+    EXPECT_EQ(msm.gpu_ratio(), gpu_ratio);
+  }
+}
+
+}  // namespace tachyon::math
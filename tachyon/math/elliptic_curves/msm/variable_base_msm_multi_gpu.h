@@ -0,0 +1,203 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_MULTI_GPU_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_MULTI_GPU_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/device/gpu/gpu_device_perf_info.h"
+#include "tachyon/device/gpu/gpu_mem_pool_manager.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm_gpu.h"
+
+namespace tachyon::math {
+
+// |VariableBaseMSMMultiGpu| shards an MSM across several GPU devices. The
+// bases and the scalars are split into contiguous ranges proportional to the
+// split ratios of the devices, each device runs |VariableBaseMSMGpu| on its own
+// range concurrently and the partial results are summed up on the host.
+//
+// NOTE: |Run()| must not be called concurrently.
+template <typename GpuCurve>
+class VariableBaseMSMMultiGpu {
+ public:
+  using ScalarField = typename JacobianPoint<GpuCurve>::ScalarField;
+  using CpuCurve = typename GpuCurve::CpuCurve;
+  using CpuScalarField = typename JacobianPoint<CpuCurve>::ScalarField;
+
+  // Uses every device visible to the process. The split ratios are
+  // proportional to |GpuDevicePerfInfo::GetRelativeThroughput()|.
+  explicit VariableBaseMSMMultiGpu(MSMAlgorithmKind kind)
+      : VariableBaseMSMMultiGpu(kind, device::gpu::GetGpuDevicePerfInfos()) {}
+
+  VariableBaseMSMMultiGpu(
+      MSMAlgorithmKind kind,
+      const std::vector<device::gpu::GpuDevicePerfInfo>& perf_infos)
+      : VariableBaseMSMMultiGpu(kind, GetDeviceIds(perf_infos),
+                                GetSplitRatios(perf_infos)) {}
+
+  // Uses the devices of |device_ids|. The i-th device takes
+  // |split_ratios[i]| / Σ |split_ratios| of the scalars.
+  VariableBaseMSMMultiGpu(MSMAlgorithmKind kind,
+                          const std::vector<int>& device_ids,
+                          const std::vector<double>& split_ratios)
+      : kind_(kind) {
+    CHECK(!device_ids.empty());
+    CHECK_EQ(device_ids.size(), split_ratios.size());
+    double total_ratio =
+        std::accumulate(split_ratios.begin(), split_ratios.end(), 0.0);
+    CHECK_GT(total_ratio, 0.0);
+    devices_.resize(device_ids.size());
+    for (size_t i = 0; i < device_ids.size(); ++i) {
+      CHECK_GE(split_ratios[i], 0.0);
+      devices_[i].device_id = device_ids[i];
+      devices_[i].split_ratio = split_ratios[i] / total_ratio;
+    }
+  }
+  VariableBaseMSMMultiGpu(const VariableBaseMSMMultiGpu& other) = delete;
+  VariableBaseMSMMultiGpu& operator=(const VariableBaseMSMMultiGpu& other) =
+      delete;
+
+  size_t GetDeviceCount() const { return devices_.size(); }
+
+  [[nodiscard]] bool Run(absl::Span<const AffinePoint<CpuCurve>> bases,
+                         absl::Span<const CpuScalarField> scalars,
+                         JacobianPoint<CpuCurve>* cpu_result) {
+    if (bases.size() != scalars.size()) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+
+    std::vector<size_t> offsets = ComputeOffsets(scalars.size());
+    std::vector<JacobianPoint<CpuCurve>> results(devices_.size(),
+                                                 JacobianPoint<CpuCurve>::Zero());
+    // NOTE: |std::vector<bool>| is not safe to be written concurrently.
+    std::unique_ptr<bool[]> valids(new bool[devices_.size()]);
+    std::vector<std::thread> threads;
+    threads.reserve(devices_.size());
+    for (size_t i = 0; i < devices_.size(); ++i) {
+      size_t start = offsets[i];
+      size_t len = offsets[i + 1] - start;
+      if (len == 0) {
+        valids[i] = true;
+        continue;
+      }
+      threads.emplace_back([this, i, start, len, &bases, &scalars, &results,
+                            &valids]() {
+        valids[i] = devices_[i].Run(kind_, bases.subspan(start, len),
+                                    scalars.subspan(start, len), &results[i]);
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    if (!std::all_of(valids.get(), valids.get() + devices_.size(),
+                     [](bool valid) { return valid; })) {
+      return false;
+    }
+    *cpu_result = std::accumulate(results.begin(), results.end(),
+                                  JacobianPoint<CpuCurve>::Zero());
+    return true;
+  }
+
+ private:
+  struct Device {
+    // Uploads the bases and the scalars and runs an MSM on the device. The
+    // device buffers grow to a power of 2 and are kept for the next run.
+    bool Run(MSMAlgorithmKind kind,
+             absl::Span<const AffinePoint<CpuCurve>> bases,
+             absl::Span<const CpuScalarField> scalars,
+             JacobianPoint<CpuCurve>* cpu_result) {
+      gpuError_t error = gpuSetDevice(device_id);
+      if (error != gpuSuccess) {
+        GPU_LOG(ERROR, error) << "Failed to gpuSetDevice()";
+        return false;
+      }
+      if (!msm) {
+        device::gpu::GpuMemPoolManager& manager =
+            device::gpu::GpuMemPoolManager::GetInstance();
+        mem_pool = manager.GetMemPool(device_id);
+        stream = manager.GetStream(device_id);
+        if (!mem_pool || !stream) return false;
+        msm = std::make_unique<VariableBaseMSMGpu<GpuCurve>>(kind, mem_pool,
+                                                             stream);
+      }
+
+      size_t size = bases.size();
+      size_t capacity = size_t{1} << base::bits::Log2Ceiling(size);
+      if (d_bases.size() < capacity) {
+        d_bases.reset();
+        d_scalars.reset();
+        d_bases =
+            device::gpu::GpuMemory<AffinePoint<GpuCurve>>::Malloc(capacity);
+        d_scalars = device::gpu::GpuMemory<ScalarField>::Malloc(capacity);
+      }
+      if (!d_bases.CopyFromPageableAsync(bases.data(), stream, 0, size)) {
+        return false;
+      }
+      if (!d_scalars.CopyFromPageableAsync(scalars.data(), stream, 0, size)) {
+        return false;
+      }
+      return msm->Run(d_bases, d_scalars, size, cpu_result);
+    }
+
+    int device_id = 0;
+    double split_ratio = 0;
+    // Shared with the other GPU workloads. See
+    // |device::gpu::GpuMemPoolManager|.
+    gpuMemPool_t mem_pool = nullptr;
+    gpuStream_t stream = nullptr;
+    std::unique_ptr<VariableBaseMSMGpu<GpuCurve>> msm;
+    device::gpu::GpuMemory<AffinePoint<GpuCurve>> d_bases;
+    device::gpu::GpuMemory<ScalarField> d_scalars;
+  };
+
+  static std::vector<int> GetDeviceIds(
+      const std::vector<device::gpu::GpuDevicePerfInfo>& perf_infos) {
+    std::vector<int> ret(perf_infos.size());
+    for (size_t i = 0; i < perf_infos.size(); ++i) {
+      ret[i] = perf_infos[i].device_id;
+    }
+    return ret;
+  }
+
+  static std::vector<double> GetSplitRatios(
+      const std::vector<device::gpu::GpuDevicePerfInfo>& perf_infos) {
+    std::vector<double> ret(perf_infos.size());
+    for (size_t i = 0; i < perf_infos.size(); ++i) {
+      ret[i] = perf_infos[i].GetRelativeThroughput();
+    }
+    return ret;
+  }
+
+  // Returns |devices_.size() + 1| offsets, where the i-th device takes the
+  // scalars in [offsets[i], offsets[i + 1]).
+  std::vector<size_t> ComputeOffsets(size_t size) const {
+    std::vector<size_t> offsets(devices_.size() + 1);
+    double accumulated_ratio = 0;
+    for (size_t i = 0; i < devices_.size(); ++i) {
+      accumulated_ratio += devices_[i].split_ratio;
+      offsets[i + 1] = std::min(
+          size, static_cast<size_t>(accumulated_ratio * size + 0.5));
+    }
+    offsets.back() = size;
+    return offsets;
+  }
+
+  MSMAlgorithmKind kind_;
+  std::vector<Device> devices_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_MULTI_GPU_H_
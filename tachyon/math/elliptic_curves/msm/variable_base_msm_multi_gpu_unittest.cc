@@ -0,0 +1,55 @@
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm_multi_gpu.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/g1_gpu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/bellman/bn254_bellman_msm_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/cuzk/bn254_cuzk_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class VariableBaseMSMMultiGpuTest : public testing::Test {
+ public:
+  constexpr static size_t kCount = 1000;
+
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+
+  VariableBaseMSMMultiGpuTest()
+      : test_set_(VariableBaseMSMTestSet<bn254::G1AffinePoint>::Random(
+            kCount, VariableBaseMSMMethod::kMSM)) {}
+
+ protected:
+  VariableBaseMSMTestSet<bn254::G1AffinePoint> test_set_;
+};
+
+}  // namespace
+
+TEST_F(VariableBaseMSMMultiGpuTest, RunOnAllDevices) {
+  for (MSMAlgorithmKind algorithm :
+       {MSMAlgorithmKind::kBellmanMSM, MSMAlgorithmKind::kCUZK}) {
+    VariableBaseMSMMultiGpu<bn254::G1CurveGpu> msm(algorithm);
+    bn254::G1JacobianPoint actual;
+    ASSERT_TRUE(msm.Run(test_set_.bases, test_set_.scalars, &actual));
+    EXPECT_EQ(actual, test_set_.answer.ToJacobian());
+  }
+}
+
+TEST_F(VariableBaseMSMMultiGpuTest, RunWithSplitRatios) {
+  // Shards the MSM unevenly, even on a single device.
+  for (MSMAlgorithmKind algorithm :
+       {MSMAlgorithmKind::kBellmanMSM, MSMAlgorithmKind::kCUZK}) {
+    VariableBaseMSMMultiGpu<bn254::G1CurveGpu> msm(algorithm, {0, 0, 0},
+                                                   {1, 3, 0});
+    EXPECT_EQ(msm.GetDeviceCount(), size_t{3});
+    for (size_t i = 0; i < 2; ++i) {
+      bn254::G1JacobianPoint actual;
+      ASSERT_TRUE(msm.Run(test_set_.bases, test_set_.scalars, &actual));
+      EXPECT_EQ(actual, test_set_.answer.ToJacobian());
+    }
+  }
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,164 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_STREAMING_GPU_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_STREAMING_GPU_H_
+
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/device/gpu/scoped_event.h"
+#include "tachyon/device/gpu/scoped_stream.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm_gpu.h"
+
+namespace tachyon::math {
+
+// |VariableBaseMSMStreamingGpu| runs an MSM whose inputs don't fit in the
+// device memory. The bases and the scalars are streamed in chunks of
+// |chunk_size()| through two pinned host buffers and two device buffers.
+// While the kernels run on the i-th chunk on the compute stream, the (i+1)-th
+// chunk is copied on a separate copy stream, and the compute stream waits for
+// it with an event before touching it. The partial results of the chunks are
+// summed up as they arrive.
+//
+// NOTE: |Run()| must not be called concurrently.
+template <typename GpuCurve>
+class VariableBaseMSMStreamingGpu {
+ public:
+  using ScalarField = typename JacobianPoint<GpuCurve>::ScalarField;
+  using CpuCurve = typename GpuCurve::CpuCurve;
+  using CpuScalarField = typename JacobianPoint<CpuCurve>::ScalarField;
+
+  constexpr static size_t kBufferNums = 2;
+
+  // |chunk_size| must be a power of 2.
+  VariableBaseMSMStreamingGpu(MSMAlgorithmKind kind, size_t chunk_size,
+                              gpuMemPool_t mem_pool, gpuStream_t stream)
+      : chunk_size_(chunk_size), stream_(stream), msm_(kind, mem_pool, stream) {
+    CHECK(base::bits::IsPowerOfTwo(chunk_size));
+    copy_stream_ = device::gpu::CreateStream();
+    for (size_t i = 0; i < kBufferNums; ++i) {
+      Buffer& buffer = buffers_[i];
+      buffer.h_bases =
+          device::gpu::GpuMemory<AffinePoint<GpuCurve>>::MallocHost(chunk_size);
+      buffer.h_scalars =
+          device::gpu::GpuMemory<ScalarField>::MallocHost(chunk_size);
+      buffer.d_bases =
+          device::gpu::GpuMemory<AffinePoint<GpuCurve>>::Malloc(chunk_size);
+      buffer.d_scalars = device::gpu::GpuMemory<ScalarField>::Malloc(chunk_size);
+      buffer.copied = device::gpu::CreateEventWithFlags(gpuEventDisableTiming);
+    }
+  }
+  VariableBaseMSMStreamingGpu(const VariableBaseMSMStreamingGpu& other) =
+      delete;
+  VariableBaseMSMStreamingGpu& operator=(
+      const VariableBaseMSMStreamingGpu& other) = delete;
+
+  size_t chunk_size() const { return chunk_size_; }
+
+  // Returns the largest power of 2 chunk size whose buffers take at most a
+  // half of |free_memory_bytes|.
+  static size_t ComputeChunkSize(size_t free_memory_bytes) {
+    size_t bytes_per_element =
+        kBufferNums * (sizeof(AffinePoint<GpuCurve>) + sizeof(ScalarField));
+    size_t max_chunk_size = free_memory_bytes / 2 / bytes_per_element;
+    if (max_chunk_size == 0) return 1;
+    return size_t{1} << base::bits::Log2Floor(max_chunk_size);
+  }
+
+  [[nodiscard]] bool Run(absl::Span<const AffinePoint<CpuCurve>> bases,
+                         absl::Span<const CpuScalarField> scalars,
+                         JacobianPoint<CpuCurve>* cpu_result) {
+    if (bases.size() != scalars.size()) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+
+    size_t num_chunks = (scalars.size() + chunk_size_ - 1) / chunk_size_;
+    JacobianPoint<CpuCurve> ret = JacobianPoint<CpuCurve>::Zero();
+    if (num_chunks > 0 && !Upload(bases, scalars, 0)) return false;
+    for (size_t i = 0; i < num_chunks; ++i) {
+      Buffer& buffer = buffers_[i % kBufferNums];
+      gpuError_t error = gpuStreamWaitEvent(stream_, buffer.copied.get(), 0);
+      if (error != gpuSuccess) {
+        GPU_LOG(ERROR, error) << "Failed to gpuStreamWaitEvent()";
+        return false;
+      }
+      // The other buffer was used by the previous chunk, whose |Run()| has
+      // already synchronized the compute stream, so it is safe to overwrite.
+      if (i + 1 < num_chunks && !Upload(bases, scalars, i + 1)) return false;
+
+      JacobianPoint<CpuCurve> partial_result;
+      if (!msm_.Run(buffer.d_bases, buffer.d_scalars, chunk_size_,
+                    &partial_result)) {
+        return false;
+      }
+      ret += partial_result;
+    }
+    *cpu_result = std::move(ret);
+    return true;
+  }
+
+ private:
+  struct Buffer {
+    device::gpu::GpuMemory<AffinePoint<GpuCurve>> h_bases;
+    device::gpu::GpuMemory<ScalarField> h_scalars;
+    device::gpu::GpuMemory<AffinePoint<GpuCurve>> d_bases;
+    device::gpu::GpuMemory<ScalarField> d_scalars;
+    // Recorded on the copy stream when the copies into |d_bases| and
+    // |d_scalars| are issued.
+    device::gpu::ScopedEvent copied;
+  };
+
+  // Stages the |chunk_index|-th chunk into the pinned host buffers and copies
+  // it to the device asynchronously. The tail of the last chunk is filled with
+  // zero scalars.
+  bool Upload(absl::Span<const AffinePoint<CpuCurve>> bases,
+              absl::Span<const CpuScalarField> scalars, size_t chunk_index) {
+    Buffer& buffer = buffers_[chunk_index % kBufferNums];
+    // The pinned host buffers may still be read by the previous copy from
+    // them.
+    gpuError_t error = gpuEventSynchronize(buffer.copied.get());
+    if (error != gpuSuccess) {
+      GPU_LOG(ERROR, error) << "Failed to gpuEventSynchronize()";
+      return false;
+    }
+
+    size_t start = chunk_index * chunk_size_;
+    size_t len = std::min(chunk_size_, scalars.size() - start);
+    memcpy(buffer.h_bases.get(), &bases[start],
+           sizeof(AffinePoint<GpuCurve>) * len);
+    memcpy(buffer.h_scalars.get(), &scalars[start], sizeof(ScalarField) * len);
+    if (len < chunk_size_) {
+      memset(buffer.h_scalars.get() + len, 0,
+             sizeof(ScalarField) * (chunk_size_ - len));
+    }
+    if (!buffer.d_bases.CopyFromAsync(buffer.h_bases, copy_stream_.get())) {
+      return false;
+    }
+    if (!buffer.d_scalars.CopyFromAsync(buffer.h_scalars, copy_stream_.get())) {
+      return false;
+    }
+    error = gpuEventRecord(buffer.copied.get(), copy_stream_.get());
+    if (error != gpuSuccess) {
+      GPU_LOG(ERROR, error) << "Failed to gpuEventRecord()";
+      return false;
+    }
+    return true;
+  }
+
+  size_t chunk_size_;
+  gpuStream_t stream_;
+  device::gpu::ScopedStream copy_stream_;
+  VariableBaseMSMGpu<GpuCurve> msm_;
+  Buffer buffers_[kBufferNums];
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_STREAMING_GPU_H_
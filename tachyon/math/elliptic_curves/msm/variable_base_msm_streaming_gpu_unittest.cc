@@ -0,0 +1,75 @@
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm_streaming_gpu.h"
+
+#include <limits>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/device/gpu/scoped_mem_pool.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1_gpu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/bellman/bn254_bellman_msm_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/cuzk/bn254_cuzk_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using namespace device;
+
+class VariableBaseMSMStreamingGpuTest : public testing::Test {
+ public:
+  // Not a multiple of the chunk sizes below, so that the last chunk is
+  // padded.
+  constexpr static size_t kCount = 1000;
+
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+
+  VariableBaseMSMStreamingGpuTest()
+      : test_set_(VariableBaseMSMTestSet<bn254::G1AffinePoint>::Random(
+            kCount, VariableBaseMSMMethod::kMSM)) {}
+
+ protected:
+  VariableBaseMSMTestSet<bn254::G1AffinePoint> test_set_;
+};
+
+}  // namespace
+
+TEST_F(VariableBaseMSMStreamingGpuTest, Run) {
+  gpuMemPoolProps props = {gpuMemAllocationTypePinned,
+                           gpuMemHandleTypeNone,
+                           {gpuMemLocationTypeDevice, 0}};
+  gpu::ScopedMemPool mem_pool = gpu::CreateMemPool(&props);
+
+  uint64_t mem_pool_threshold = std::numeric_limits<uint64_t>::max();
+  gpuError_t error = gpuMemPoolSetAttribute(
+      mem_pool.get(), gpuMemPoolAttrReleaseThreshold, &mem_pool_threshold);
+  ASSERT_EQ(error, gpuSuccess);
+
+  gpu::ScopedStream stream = gpu::CreateStream();
+
+  for (MSMAlgorithmKind algorithm :
+       {MSMAlgorithmKind::kBellmanMSM, MSMAlgorithmKind::kCUZK}) {
+    for (size_t chunk_size : {128, 256, 1024}) {
+      SCOPED_TRACE(absl::Substitute("chunk_size: $0", chunk_size));
+      VariableBaseMSMStreamingGpu<bn254::G1CurveGpu> msm(
+          algorithm, chunk_size, mem_pool.get(), stream.get());
+      bn254::G1JacobianPoint actual;
+      ASSERT_TRUE(msm.Run(test_set_.bases, test_set_.scalars, &actual));
+      EXPECT_EQ(actual, test_set_.answer.ToJacobian());
+    }
+  }
+}
+
+TEST_F(VariableBaseMSMStreamingGpuTest, ComputeChunkSize) {
+  using MSM = VariableBaseMSMStreamingGpu<bn254::G1CurveGpu>;
+
+  EXPECT_EQ(MSM::ComputeChunkSize(0), size_t{1});
+  size_t chunk_size = MSM::ComputeChunkSize(size_t{1} << 30);
+  EXPECT_TRUE(base::bits::IsPowerOfTwo(chunk_size));
+  size_t bytes = MSM::kBufferNums * chunk_size *
+                 (sizeof(bn254::G1AffinePointGpu) + sizeof(bn254::FrGpu));
+  EXPECT_LE(bytes, size_t{1} << 29);
+  EXPECT_GT(bytes * 2, size_t{1} << 29);
+}
+
+}  // namespace tachyon::math
@@ -44,4 +44,32 @@ TYPED_TEST(VariableBaseMSMTest, DoMSM) {
   EXPECT_EQ(ret, test_set.answer);
 }
 
+TYPED_TEST(VariableBaseMSMTest, RunBatch) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename VariableBaseMSM<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  std::vector<ScalarField> other_scalars =
+      base::CreateVector(kSize / 2, []() { return ScalarField::Random(); });
+  std::vector<absl::Span<const ScalarField>> scalars_list = {
+      test_set.scalars, other_scalars, absl::Span<const ScalarField>()};
+
+  VariableBaseMSM<Point> msm;
+  std::vector<Bucket> rets;
+  ASSERT_TRUE(msm.RunBatch(test_set.bases, scalars_list, &rets));
+  ASSERT_EQ(rets.size(), scalars_list.size());
+  EXPECT_EQ(rets[0], test_set.answer);
+  Bucket expected;
+  ASSERT_TRUE(msm.Run(absl::MakeConstSpan(test_set.bases).subspan(0, kSize / 2),
+                      other_scalars, &expected));
+  EXPECT_EQ(rets[1], expected);
+  EXPECT_EQ(rets[2], Bucket::Zero());
+
+  std::vector<ScalarField> too_many_scalars(kSize + 1);
+  scalars_list.push_back(too_many_scalars);
+  EXPECT_FALSE(msm.RunBatch(test_set.bases, scalars_list, &rets));
+}
+
 }  // namespace tachyon::math
@@ -12,6 +12,8 @@
 
 #include "absl/strings/substitute.h"
 
+#include "tachyon/base/buffer/copyable.h"
+
 namespace tachyon::math {
 
 template <typename F>
@@ -42,4 +44,31 @@ using EllCoeffs = std::vector<EllCoeff<F>>;
 
 }  // namespace tachyon::math
 
+namespace tachyon::base {
+
+template <typename F>
+class Copyable<math::EllCoeff<F>> {
+ public:
+  static bool WriteTo(const math::EllCoeff<F>& ell_coeff, Buffer* buffer) {
+    return buffer->WriteMany(ell_coeff.c0(), ell_coeff.c1(), ell_coeff.c2());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       math::EllCoeff<F>* ell_coeff) {
+    F c0;
+    F c1;
+    F c2;
+    if (!buffer.ReadMany(&c0, &c1, &c2)) return false;
+
+    *ell_coeff = math::EllCoeff<F>(std::move(c0), std::move(c1), std::move(c2));
+    return true;
+  }
+
+  static size_t EstimateSize(const math::EllCoeff<F>& ell_coeff) {
+    return base::EstimateSize(ell_coeff.c0(), ell_coeff.c1(), ell_coeff.c2());
+  }
+};
+
+}  // namespace tachyon::base
+
 #endif  // TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_ELL_COEFF_H_
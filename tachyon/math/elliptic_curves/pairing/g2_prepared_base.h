@@ -6,8 +6,10 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_G2_PREPARED_BASE_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_G2_PREPARED_BASE_H_
 
+#include <type_traits>
 #include <utility>
 
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/math/elliptic_curves/pairing/ell_coeff.h"
 
 namespace tachyon::math {
@@ -37,4 +39,40 @@ class G2PreparedBase {
 
 }  // namespace tachyon::math
 
+namespace tachyon::base {
+
+// Persisting the prepared form lets a verifier skip computing the line
+// coefficients of a fixed G2 point, e.g, the ones of a verifying key.
+template <typename Derived>
+class Copyable<Derived,
+               std::enable_if_t<std::is_base_of_v<
+                   math::G2PreparedBase<typename Derived::Config>, Derived>>> {
+ public:
+  using Fp2 = typename Derived::Fp2;
+
+  static bool WriteTo(const Derived& g2_prepared, Buffer* buffer) {
+    return buffer->WriteMany(g2_prepared.ell_coeffs(), g2_prepared.infinity());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, Derived* g2_prepared) {
+    math::EllCoeffs<Fp2> ell_coeffs;
+    bool infinity;
+    if (!buffer.ReadMany(&ell_coeffs, &infinity)) return false;
+
+    if (infinity) {
+      *g2_prepared = Derived();
+    } else {
+      *g2_prepared = Derived(std::move(ell_coeffs));
+    }
+    return true;
+  }
+
+  static size_t EstimateSize(const Derived& g2_prepared) {
+    return base::EstimateSize(g2_prepared.ell_coeffs(),
+                              g2_prepared.infinity());
+  }
+};
+
+}  // namespace tachyon::base
+
 #endif  // TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_G2_PREPARED_BASE_H_
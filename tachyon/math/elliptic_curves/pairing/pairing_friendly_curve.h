@@ -1,8 +1,10 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_PAIRING_FRIENDLY_CURVE_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_PAIRING_FRIENDLY_CURVE_H_
 
+#include <utility>
 #include <vector>
 
+#include "tachyon/base/optional.h"
 #include "tachyon/math/elliptic_curves/pairing/ell_coeff.h"
 #include "tachyon/math/elliptic_curves/pairing/twist_type.h"
 
@@ -17,13 +19,73 @@ class PairingFriendlyCurve {
   using Fp2 = typename G2Curve::BaseField;
   using Fp12 = typename Config::Fp12;
   using G1AffinePoint = typename G1Curve::AffinePoint;
+  using G2AffinePoint = typename G2Curve::AffinePoint;
 
   static void Init() {
-    Config::Init();
-    Fp12::Init();
+    [[maybe_unused]] static bool initialized = []() {
+      Config::Init();
+      Fp12::Init();
+      return true;
+    }();
+  }
+
+  // Returns ψ(|point|), where ψ = untwist⁻¹ ∘ π ∘ untwist and π is the
+  // p-power Frobenius endomorphism. It is
+  //
+  //   ψ(x, y) = (x̄ * ξ^((p - 1) / 3), ȳ * ξ^((p - 1) / 2))
+  //
+  // for a D-type twist, where ξ is the non-residue of Fp6 = Fp2[v] / (v³ - ξ),
+  // and the coefficients are inverted for an M-type twist.
+  static G2AffinePoint Psi(const G2AffinePoint& point) {
+    const PsiCoeffs& coeffs = GetPsiCoeffs();
+    Fp2 x = point.x();
+    x.FrobeniusMapInPlace(1);
+    x *= coeffs.x;
+    Fp2 y = point.y();
+    y.FrobeniusMapInPlace(1);
+    y *= coeffs.y;
+    return G2AffinePoint(std::move(x), std::move(y));
   }
 
  protected:
+  struct PsiCoeffs {
+    Fp2 x;
+    Fp2 y;
+  };
+
+  // NOTE: The coefficients are computed on the first call, which must come
+  // after |Init()|.
+  static const PsiCoeffs& GetPsiCoeffs() {
+    static const PsiCoeffs coeffs = []() {
+      // w = ξ^((p - 1) / 6)
+      const Fp2& w = Fp12::Config::kFrobeniusCoeffs[1];
+      // x = w² = ξ^((p - 1) / 3)
+      Fp2 x = w.Square();
+      // y = w³ = ξ^((p - 1) / 2)
+      Fp2 y = x * w;
+      if constexpr (Config::kTwistType == TwistType::kM) {
+        x = unwrap(x.Inverse());
+        y = unwrap(y.Inverse());
+      }
+      return PsiCoeffs{std::move(x), std::move(y)};
+    }();
+    return coeffs;
+  }
+
+  // Returns true if |point| on the curve is in the subgroup of order r. The
+  // fast |test(point)| compares an endomorphism of |point| with a small
+  // multiple of it, which only makes sense if the endomorphism acts on the
+  // subgroup as that multiple. This is checked once on the generator and if
+  // it doesn't hold, it falls back to checking [r]P = O.
+  template <typename AffinePoint, typename Test>
+  static bool IsInSubgroup(const AffinePoint& point, Test test) {
+    static const bool test_is_valid = test(AffinePoint::Generator());
+    if (point.IsZero()) return true;
+    if (test_is_valid) return test(point);
+    return point.ScalarMul(AffinePoint::ScalarField::Config::kModulus)
+        .IsZero();
+  }
+
   class Pair {
    public:
     Pair() = default;
@@ -0,0 +1,77 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_POINT_VALIDATION_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_POINT_VALIDATION_H_
+
+#include <atomic>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+
+namespace tachyon::math {
+
+// How much the points read from an untrusted source, e.g., an SRS or a zkey,
+// are checked when they are loaded.
+enum class PointValidation {
+  // The points are trusted.
+  kNone,
+  // Every point must be on the curve.
+  kOnCurve,
+  // Every point must be on the curve and in the subgroup of order r.
+  kSubgroup,
+};
+
+// Returns true if every point of |points| passes |validation|, where
+// |is_in_subgroup(point)| tells if |point| on the curve is in the subgroup of
+// order r. The point at infinity is always valid. The points are checked in
+// parallel and every thread stops as soon as any of them finds an invalid one.
+template <typename AffinePoint, typename SubgroupCheck>
+[[nodiscard]] bool ValidatePoints(absl::Span<const AffinePoint> points,
+                                  PointValidation validation,
+                                  SubgroupCheck is_in_subgroup) {
+  using Curve = typename AffinePoint::Curve;
+
+  if (validation == PointValidation::kNone) return true;
+  std::atomic<bool> failed(false);
+  base::Parallelize(
+      points, [validation, &is_in_subgroup,
+               &failed](absl::Span<const AffinePoint> chunk) {
+        for (const AffinePoint& point : chunk) {
+          if (failed.load(std::memory_order_relaxed)) return;
+          if (point.IsZero()) continue;
+          if (!Curve::IsOnCurve(point) ||
+              (validation == PointValidation::kSubgroup &&
+               !is_in_subgroup(point))) {
+            failed.store(true, std::memory_order_relaxed);
+            return;
+          }
+        }
+      });
+  if (failed.load(std::memory_order_relaxed)) {
+    LOG(ERROR) << "Invalid point is found";
+    return false;
+  }
+  return true;
+}
+
+// Same as above, but checks the G1 points of a pairing friendly |Curve| with
+// its fast subgroup check, e.g., |BNCurve::IsInG1Subgroup()|.
+template <typename Curve>
+[[nodiscard]] bool ValidateG1Points(
+    absl::Span<const typename Curve::G1Curve::AffinePoint> points,
+    PointValidation validation) {
+  return ValidatePoints(points, validation, &Curve::IsInG1Subgroup);
+}
+
+// Same as above, but checks the G2 points, e.g., with
+// |BNCurve::IsInG2Subgroup()|.
+template <typename Curve>
+[[nodiscard]] bool ValidateG2Points(
+    absl::Span<const typename Curve::G2Curve::AffinePoint> points,
+    PointValidation validation) {
+  return ValidatePoints(points, validation, &Curve::IsInG2Subgroup);
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_POINT_VALIDATION_H_
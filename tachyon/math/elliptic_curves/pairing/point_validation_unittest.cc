@@ -0,0 +1,95 @@
+#include "tachyon/math/elliptic_curves/pairing/point_validation.h"
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/bls12_381.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename Curve>
+class PointValidationTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Curve::Init(); }
+};
+
+// Returns a random point on the curve, which is unlikely to be in the subgroup
+// of order r unless the cofactor is 1.
+template <typename AffinePoint>
+AffinePoint CreateRandomPointOnCurve() {
+  using BaseField = typename AffinePoint::BaseField;
+  while (true) {
+    std::optional<AffinePoint> point =
+        AffinePoint::CreateFromX(BaseField::Random(), /*pick_odd=*/false);
+    if (point.has_value()) return std::move(point).value();
+  }
+}
+
+template <typename AffinePoint>
+bool IsInSubgroupByOrder(const AffinePoint& point) {
+  using ScalarField = typename AffinePoint::ScalarField;
+  return point.ScalarMul(ScalarField::Config::kModulus).IsZero();
+}
+
+}  // namespace
+
+using CurveTypes = testing::Types<bn254::BN254Curve, bls12_381::BLS12_381Curve>;
+TYPED_TEST_SUITE(PointValidationTest, CurveTypes);
+
+TYPED_TEST(PointValidationTest, IsInSubgroup) {
+  using Curve = TypeParam;
+  using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+
+  EXPECT_TRUE(Curve::IsInG1Subgroup(G1AffinePoint::Zero()));
+  EXPECT_TRUE(Curve::IsInG2Subgroup(G2AffinePoint::Zero()));
+  for (size_t i = 0; i < 10; ++i) {
+    EXPECT_TRUE(Curve::IsInG1Subgroup(G1AffinePoint::Random()));
+    EXPECT_TRUE(Curve::IsInG2Subgroup(G2AffinePoint::Random()));
+
+    G1AffinePoint g1 = CreateRandomPointOnCurve<G1AffinePoint>();
+    EXPECT_EQ(Curve::IsInG1Subgroup(g1), IsInSubgroupByOrder(g1));
+    G2AffinePoint g2 = CreateRandomPointOnCurve<G2AffinePoint>();
+    EXPECT_EQ(Curve::IsInG2Subgroup(g2), IsInSubgroupByOrder(g2));
+    EXPECT_FALSE(Curve::IsInG2Subgroup(g2));
+  }
+}
+
+TYPED_TEST(PointValidationTest, ValidatePoints) {
+  using Curve = TypeParam;
+  using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using Fp = typename G1AffinePoint::BaseField;
+
+  std::vector<G1AffinePoint> g1s = {G1AffinePoint::Zero()};
+  std::vector<G2AffinePoint> g2s = {G2AffinePoint::Zero()};
+  for (size_t i = 0; i < 100; ++i) {
+    g1s.push_back(G1AffinePoint::Random());
+    g2s.push_back(G2AffinePoint::Random());
+  }
+  for (PointValidation validation :
+       {PointValidation::kNone, PointValidation::kOnCurve,
+        PointValidation::kSubgroup}) {
+    EXPECT_TRUE(ValidateG1Points<Curve>(g1s, validation));
+    EXPECT_TRUE(ValidateG2Points<Curve>(g2s, validation));
+  }
+
+  // On the curve, but not in the subgroup.
+  g2s[50] = CreateRandomPointOnCurve<G2AffinePoint>();
+  EXPECT_TRUE(ValidateG2Points<Curve>(g2s, PointValidation::kOnCurve));
+  EXPECT_FALSE(ValidateG2Points<Curve>(g2s, PointValidation::kSubgroup));
+
+  // Not on the curve.
+  g1s[50] = G1AffinePoint(g1s[50].x(), g1s[50].y() + Fp::One());
+  EXPECT_TRUE(ValidateG1Points<Curve>(g1s, PointValidation::kNone));
+  EXPECT_FALSE(ValidateG1Points<Curve>(g1s, PointValidation::kOnCurve));
+  EXPECT_FALSE(ValidateG1Points<Curve>(g1s, PointValidation::kSubgroup));
+}
+
+}  // namespace tachyon::math
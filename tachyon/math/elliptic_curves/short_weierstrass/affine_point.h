@@ -1,6 +1,7 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_AFFINE_POINT_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_AFFINE_POINT_H_
 
+#include <algorithm>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -17,6 +18,7 @@
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/curve_type.h"
 #include "tachyon/math/elliptic_curves/jacobian_point.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/projective_point.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
@@ -178,23 +180,82 @@ class AffinePoint<
   }
 
  private:
+  // NOTE: The table takes |window_count| * (2ʷ - 1) points, where w is
+  // capped by |kMaxBatchMapWindowBits| so that the table stays small enough
+  // even for the SRS of degree 2²⁶ over G2.
+  constexpr static unsigned int kMaxBatchMapWindowBits = 12;
+
+  // Computes sᵢ * G with the fixed-base windowed method. The multiples
+  // j * 2ʷⁱ * G for 1 ≤ j < 2ʷ are precomputed once in affine form, so that
+  // each sᵢ * G takes ⌈|kModulusBits| / w⌉ mixed additions instead of a full
+  // scalar multiplication.
   template <typename ScalarFieldContainer, typename AffineContainer>
   [[nodiscard]] constexpr static bool DoBatchMapScalarFieldToPoint(
       const AffinePoint& point, const ScalarFieldContainer& scalar_fields,
       AffineContainer* affine_points) {
+    using BigInt = typename ScalarField::BigIntTy;
+
     size_t size = std::size(scalar_fields);
     if (size != std::size(*affine_points)) {
       LOG(ERROR) << "Size of |scalar_fields| and |affine_points| do not match";
       return false;
     }
+    if (size == 0) return true;
+
+    unsigned int modulus_bits = ScalarField::Config::kModulusBits;
+    unsigned int window_bits = std::min(MSMCtx::ComputeWindowsBits(size),
+                                        kMaxBatchMapWindowBits);
+    unsigned int window_count =
+        MSMCtx::ComputeWindowsCount<ScalarField>(window_bits);
+    size_t window_size = (size_t{1} << window_bits) - 1;
+
+    // |window_bases[i]| = 2ʷⁱ * G
+    JacobianPoint<Curve> window_base = point.ToJacobian();
+    std::vector<JacobianPoint<Curve>> window_bases =
+        base::CreateVector(window_count, [&window_base, window_bits]() {
+          JacobianPoint<Curve> ret = window_base;
+          for (unsigned int i = 0; i < window_bits; ++i) {
+            window_base.DoubleInPlace();
+          }
+          return ret;
+        });
+
+    // |tables[i][j - 1]| = j * 2ʷⁱ * G
+    std::vector<std::vector<AffinePoint>> tables(window_count);
+    base::Parallelize(tables, [&window_bases, window_size](
+                                  absl::Span<std::vector<AffinePoint>> chunk,
+                                  size_t chunk_idx, size_t chunk_size) {
+      size_t start = chunk_idx * chunk_size;
+      std::vector<JacobianPoint<Curve>> multiples(window_size);
+      for (size_t i = 0; i < chunk.size(); ++i) {
+        const JacobianPoint<Curve>& window_base = window_bases[start + i];
+        multiples[0] = window_base;
+        for (size_t j = 1; j < window_size; ++j) {
+          multiples[j] = multiples[j - 1] + window_base;
+        }
+        chunk[i].resize(window_size);
+        CHECK(JacobianPoint<Curve>::BatchNormalizeSerial(multiples, &chunk[i]));
+      }
+    });
+
     std::vector<JacobianPoint<Curve>> jacobian_points(size);
     base::Parallelize(
-        jacobian_points, [&point, &scalar_fields, affine_points](
-                             absl::Span<JacobianPoint<Curve>> chunk,
-                             size_t chunk_idx, size_t chunk_size) {
+        jacobian_points,
+        [&scalar_fields, affine_points, &tables, modulus_bits, window_bits](
+            absl::Span<JacobianPoint<Curve>> chunk, size_t chunk_idx,
+            size_t chunk_size) {
           size_t start = chunk_idx * chunk_size;
           for (size_t i = 0; i < chunk.size(); ++i) {
-            chunk[i] = scalar_fields[start + i] * point;
+            BigInt scalar = scalar_fields[start + i].ToBigInt();
+            JacobianPoint<Curve> ret = JacobianPoint<Curve>::Zero();
+            for (size_t j = 0; j < tables.size(); ++j) {
+              size_t bit_offset = j * window_bits;
+              size_t bit_count =
+                  std::min(size_t{window_bits}, modulus_bits - bit_offset);
+              uint64_t digit = scalar.ExtractBits64(bit_offset, bit_count);
+              if (digit != 0) ret += tables[j][digit - 1];
+            }
+            chunk[i] = ret;
           }
           absl::Span<AffinePoint> sub_affine =
               absl::MakeSpan(*affine_points).subspan(start, chunk.size());
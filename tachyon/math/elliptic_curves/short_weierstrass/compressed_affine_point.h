@@ -0,0 +1,165 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_COMPRESSED_AFFINE_POINT_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_COMPRESSED_AFFINE_POINT_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+#include <utility>
+
+#include "absl/strings/substitute.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/compiler_specific.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/affine_point.h"
+
+namespace tachyon {
+namespace math {
+
+// The flags follow |SWFlags| of arkworks, where y is regarded as negative if
+// y > -y.
+enum class SWFlag : uint8_t {
+  kYIsPositive = 0,
+  kPointAtInfinity = 1 << 6,
+  kYIsNegative = 1 << 7,
+};
+
+// |CompressedAffinePoint| keeps only the x-coordinate of an |AffinePoint| and
+// which of the two square roots of x³ + a * x + b the y-coordinate is. It
+// takes about half the size of |AffinePoint| when serialized, at the cost of a
+// square root over |BaseField| to decompress it.
+// NOTE: Like |AffinePoint::CreateFromX()|, the decompressed point is not
+// checked to be in the prime order subgroup.
+template <typename Curve>
+class CompressedAffinePoint {
+ public:
+  using BaseField = typename Curve::BaseField;
+
+  constexpr CompressedAffinePoint() = default;
+  constexpr CompressedAffinePoint(const BaseField& x, SWFlag flag)
+      : x_(x), flag_(flag) {}
+  constexpr CompressedAffinePoint(BaseField&& x, SWFlag flag)
+      : x_(std::move(x)), flag_(flag) {}
+
+  constexpr static CompressedAffinePoint Compress(
+      const AffinePoint<Curve>& point) {
+    if (point.IsZero()) return {BaseField::Zero(), SWFlag::kPointAtInfinity};
+    return {point.x(), point.y() > -point.y() ? SWFlag::kYIsNegative
+                                              : SWFlag::kYIsPositive};
+  }
+
+  // Decompresses |compressed_points| into |affine_points| in parallel.
+  // Returns false if the sizes don't match or any of the x-coordinates is not
+  // on the curve.
+  template <typename CompressedContainer, typename AffineContainer>
+  [[nodiscard]] static bool BatchDecompress(
+      const CompressedContainer& compressed_points,
+      AffineContainer* affine_points) {
+    if (std::size(compressed_points) != std::size(*affine_points)) {
+      LOG(ERROR) << "Size of |compressed_points| and |affine_points| do not "
+                    "match";
+      return false;
+    }
+    std::atomic<bool> check_valid(true);
+    base::Parallelize(
+        *affine_points,
+        [&compressed_points, &check_valid](
+            absl::Span<AffinePoint<Curve>> chunk, size_t chunk_idx,
+            size_t chunk_size) {
+          size_t start = chunk_idx * chunk_size;
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            if (UNLIKELY(!compressed_points[start + i].Decompress(&chunk[i]))) {
+              check_valid.store(false, std::memory_order_relaxed);
+              return;
+            }
+          }
+        });
+    if (UNLIKELY(!check_valid.load(std::memory_order_relaxed))) {
+      LOG(ERROR) << "Failed to decompress a point";
+      return false;
+    }
+    return true;
+  }
+
+  constexpr const BaseField& x() const { return x_; }
+  constexpr SWFlag flag() const { return flag_; }
+
+  constexpr bool operator==(const CompressedAffinePoint& other) const {
+    return x_ == other.x_ && flag_ == other.flag_;
+  }
+  constexpr bool operator!=(const CompressedAffinePoint& other) const {
+    return !operator==(other);
+  }
+
+  // Returns false if |x()| is not the x-coordinate of any point on the curve.
+  [[nodiscard]] constexpr bool Decompress(AffinePoint<Curve>* point) const {
+    using Config = typename Curve::Config;
+
+    if (flag_ == SWFlag::kPointAtInfinity) {
+      *point = AffinePoint<Curve>::Zero();
+      return true;
+    }
+    BaseField right = x_.Square() * x_ + Config::kB;
+    if constexpr (!Config::kAIsZero) {
+      right += Config::kA * x_;
+    }
+    BaseField y;
+    if (!right.SquareRoot(&y)) return false;
+    BaseField neg_y = -y;
+    if ((y > neg_y) != (flag_ == SWFlag::kYIsNegative)) {
+      y = std::move(neg_y);
+    }
+    *point = AffinePoint<Curve>(x_, std::move(y));
+    return true;
+  }
+
+  std::string ToString() const {
+    return absl::Substitute("($0, $1)", x_.ToString(),
+                            static_cast<int>(flag_));
+  }
+
+ private:
+  BaseField x_;
+  SWFlag flag_ = SWFlag::kYIsPositive;
+};
+
+}  // namespace math
+
+namespace base {
+
+template <typename Curve>
+class Copyable<math::CompressedAffinePoint<Curve>> {
+ public:
+  static bool WriteTo(const math::CompressedAffinePoint<Curve>& point,
+                      Buffer* buffer) {
+    return buffer->WriteMany(point.x(), point.flag());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       math::CompressedAffinePoint<Curve>* point) {
+    using BaseField = typename Curve::BaseField;
+    BaseField x;
+    math::SWFlag flag;
+    if (!buffer.ReadMany(&x, &flag)) return false;
+    if (flag != math::SWFlag::kYIsPositive &&
+        flag != math::SWFlag::kPointAtInfinity &&
+        flag != math::SWFlag::kYIsNegative) {
+      return false;
+    }
+
+    *point = math::CompressedAffinePoint<Curve>(std::move(x), flag);
+    return true;
+  }
+
+  static size_t EstimateSize(const math::CompressedAffinePoint<Curve>& point) {
+    return base::EstimateSize(point.x(), point.flag());
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_COMPRESSED_AFFINE_POINT_H_
@@ -0,0 +1,91 @@
+#include "tachyon/math/elliptic_curves/short_weierstrass/compressed_affine_point.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g2.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename AffinePoint>
+class CompressedAffinePointTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { AffinePoint::Curve::Init(); }
+};
+
+}  // namespace
+
+using AffinePointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G2AffinePoint,
+                   bls12_381::G1AffinePoint, bls12_381::G2AffinePoint>;
+TYPED_TEST_SUITE(CompressedAffinePointTest, AffinePointTypes);
+
+TYPED_TEST(CompressedAffinePointTest, CompressAndDecompress) {
+  using AffinePoint = TypeParam;
+  using Curve = typename AffinePoint::Curve;
+
+  for (const AffinePoint& expected :
+       {AffinePoint::Random(), -AffinePoint::Random(), AffinePoint::Zero()}) {
+    CompressedAffinePoint<Curve> compressed =
+        CompressedAffinePoint<Curve>::Compress(expected);
+    AffinePoint point;
+    ASSERT_TRUE(compressed.Decompress(&point));
+    EXPECT_EQ(point, expected);
+  }
+
+  AffinePoint p = AffinePoint::Random();
+  EXPECT_NE(CompressedAffinePoint<Curve>::Compress(p).flag(),
+            CompressedAffinePoint<Curve>::Compress(-p).flag());
+}
+
+TYPED_TEST(CompressedAffinePointTest, BatchDecompress) {
+  using AffinePoint = TypeParam;
+  using Curve = typename AffinePoint::Curve;
+
+  std::vector<AffinePoint> expected =
+      base::CreateVector(100, []() { return AffinePoint::Random(); });
+  std::vector<CompressedAffinePoint<Curve>> compressed_points =
+      base::Map(expected, [](const AffinePoint& point) {
+        return CompressedAffinePoint<Curve>::Compress(point);
+      });
+
+  std::vector<AffinePoint> points(expected.size() - 1);
+  ASSERT_FALSE(CompressedAffinePoint<Curve>::BatchDecompress(compressed_points,
+                                                             &points));
+
+  points.resize(expected.size());
+  ASSERT_TRUE(CompressedAffinePoint<Curve>::BatchDecompress(compressed_points,
+                                                            &points));
+  EXPECT_EQ(points, expected);
+}
+
+TYPED_TEST(CompressedAffinePointTest, Copyable) {
+  using AffinePoint = TypeParam;
+  using Curve = typename AffinePoint::Curve;
+
+  AffinePoint point = AffinePoint::Random();
+  CompressedAffinePoint<Curve> expected =
+      CompressedAffinePoint<Curve>::Compress(point);
+  EXPECT_LT(base::EstimateSize(expected), base::EstimateSize(point));
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  CompressedAffinePoint<Curve> value;
+  ASSERT_TRUE(write_buf.Read(&value));
+  EXPECT_EQ(expected, value);
+}
+
+}  // namespace tachyon::math
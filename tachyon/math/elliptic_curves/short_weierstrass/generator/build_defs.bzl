@@ -146,7 +146,6 @@ def generate_ec_points(
         **kwargs
     )
 
-    # TODO(chokobole): Remove this if condition once GPU G2 is implemented.
     if gen_gpu:
         tachyon_cc_library(
             name = "{}_gpu".format(name),
@@ -16,6 +16,8 @@ namespace %{namespace} {
 template <typename _BaseField, typename _ScalarField>
 class %{class}CurveConfig {
  public:
+  constexpr static const char* kName = "%{namespace}::%{class}";
+
   using BaseField = _BaseField;
   using BasePrimeField = %{base_prime_field};
   using ScalarField = _ScalarField;
@@ -38,6 +40,18 @@ class %{class}CurveConfig {
 %{endif HasGLVCoefficients}
   static ScalarField kLambda;
   static mpz_class kGLVCoeffs[4];
+%{if HasGLVCoefficients}
+  // The fixed-width lattice constants for |GLV::DecomposeFixedWidth()|.
+  // |kGLVAbsCoeffs[i]| = |kGLVCoeffs[i]|
+  constexpr static %{glv_big_int_type} kGLVAbsCoeffs[4] = {
+%{glv_abs_coeffs}
+  };
+  constexpr static bool kGLVCoeffsAreNegative[4] = {%{glv_coeffs_are_negative}};
+  // g₁ = ⌊2^(64N) * |n22| / r⌋
+  constexpr static %{glv_big_int_type} kGLVG1 = %{glv_big_int_type}({%{glv_g1}});
+  // g₂ = ⌊2^(64N) * |n12| / r⌋
+  constexpr static %{glv_big_int_type} kGLVG2 = %{glv_big_int_type}({%{glv_g2}});
+%{endif HasGLVCoefficients}
 
   static void Init() {
 %{a_init}
@@ -127,6 +127,37 @@ int GenerationConfig::GenerateConfigHdr() const {
                            }),
         "\n");
 
+    // The lattice {(a, b) | a + λb ≡ 0 (mod r)} is spanned by (n11, n12) and
+    // (n21, n22), so r = |n11 * n22 - n12 * n21|.
+    std::vector<mpz_class> coeffs =
+        base::Map(glv_coefficients, [](const std::string& coeff) {
+          return math::gmp::FromDecString(coeff);
+        });
+    mpz_class r =
+        math::gmp::GetAbs(coeffs[0] * coeffs[3] - coeffs[1] * coeffs[2]);
+    size_t n = math::gmp::GetLimbSize(r);
+    std::string big_int_type = absl::Substitute("BigInt<$0>", n);
+    replacements["%{glv_big_int_type}"] = big_int_type;
+    replacements["%{glv_abs_coeffs}"] = absl::StrJoin(
+        base::Map(coeffs,
+                  [&big_int_type](const mpz_class& coeff) {
+                    return absl::Substitute(
+                        "      $0({$1}),", big_int_type,
+                        math::MpzClassToString(math::gmp::GetAbs(coeff)));
+                  }),
+        "\n");
+    replacements["%{glv_coeffs_are_negative}"] = absl::StrJoin(
+        base::Map(coeffs,
+                  [](const mpz_class& coeff) {
+                    return base::BoolToString(math::gmp::IsNegative(coeff));
+                  }),
+        ", ");
+    // g₁ = ⌊2^(64N) * |n22| / r⌋ and g₂ = ⌊2^(64N) * |n12| / r⌋
+    replacements["%{glv_g1}"] = math::MpzClassToString(
+        (math::gmp::GetAbs(coeffs[3]) << (64 * n)) / r);
+    replacements["%{glv_g2}"] = math::MpzClassToString(
+        (math::gmp::GetAbs(coeffs[1]) << (64 * n)) / r);
+
     RemoveOptionalLines(tpl_lines, "HasGLVCoefficients", has_glv_coefficients);
   }
   tpl_content = absl::StrJoin(tpl_lines, "\n");
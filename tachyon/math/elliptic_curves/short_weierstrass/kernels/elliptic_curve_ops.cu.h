@@ -3,8 +3,7 @@
 
 #include <stddef.h>
 
-#include "third_party/gpus/cuda/include/cuda_runtime.h"
-
+#include "tachyon/device/gpu/gpu_runtime.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/affine_point.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/jacobian_point.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/point_xyzz.h"
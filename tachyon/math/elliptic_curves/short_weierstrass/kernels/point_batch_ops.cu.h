@@ -0,0 +1,199 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_KERNELS_POINT_BATCH_OPS_CU_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_KERNELS_POINT_BATCH_OPS_CU_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+
+#include "tachyon/device/gpu/gpu_runtime.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/affine_point.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/jacobian_point.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/point_xyzz.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/projective_point.h"
+
+namespace tachyon::math::kernels {
+
+namespace internal {
+
+// Returns the coordinate that is inverted to normalize |point|, which is zero
+// if and only if |point| is the identity.
+template <typename Curve>
+__device__ constexpr const typename Curve::BaseField& GetDenominator(
+    const ProjectivePoint<Curve>& point) {
+  return point.z();
+}
+
+template <typename Curve>
+__device__ constexpr const typename Curve::BaseField& GetDenominator(
+    const JacobianPoint<Curve>& point) {
+  return point.z();
+}
+
+template <typename Curve>
+__device__ constexpr const typename Curve::BaseField& GetDenominator(
+    const PointXYZZ<Curve>& point) {
+  return point.zzz();
+}
+
+// Returns the affine point of |point| given the inverse of its denominator.
+template <typename Curve>
+__device__ constexpr AffinePoint<Curve> ToAffine(
+    const ProjectivePoint<Curve>& point,
+    const typename Curve::BaseField& z_inv) {
+  return {point.x() * z_inv, point.y() * z_inv};
+}
+
+template <typename Curve>
+__device__ constexpr AffinePoint<Curve> ToAffine(
+    const JacobianPoint<Curve>& point, const typename Curve::BaseField& z_inv) {
+  typename Curve::BaseField z_inv_square = z_inv.Square();
+  return {point.x() * z_inv_square, point.y() * z_inv_square * z_inv};
+}
+
+template <typename Curve>
+__device__ constexpr AffinePoint<Curve> ToAffine(
+    const PointXYZZ<Curve>& point, const typename Curve::BaseField& zzz_inv) {
+  typename Curve::BaseField z_inv_square = (zzz_inv * point.zz()).Square();
+  return {point.x() * z_inv_square, point.y() * zzz_inv};
+}
+
+}  // namespace internal
+
+// The first half of the batch normalization. Each block computes the products
+// of the denominators of its points with the parallel prefix and suffix
+// products over the shared memory, so that the i-th thread gets
+//
+//   |others[i]| = Π{j ≠ i} dⱼ and |block_products[blockIdx.x]| = Π dⱼ,
+//
+// where the zero denominators, i.e., the identities, are taken as 1. Then
+// dᵢ⁻¹ = |others[i]| * |block_products[blockIdx.x]|⁻¹, which costs a single
+// inversion per block. |blockDim.x| must be a power of 2 and the dynamic shared
+// memory must hold 2 * |blockDim.x| base field elements.
+template <typename Point>
+__global__ void ComputeDenominatorProducts(
+    const Point* points, typename Point::BaseField* others,
+    typename Point::BaseField* block_products, unsigned int count) {
+  using BaseField = typename Point::BaseField;
+
+  extern __shared__ char shared[];
+  BaseField* prefix = reinterpret_cast<BaseField*>(shared);
+  BaseField* suffix = prefix + blockDim.x;
+
+  unsigned int tid = threadIdx.x;
+  unsigned int gid = blockIdx.x * blockDim.x + tid;
+  BaseField d = BaseField::One();
+  if (gid < count) {
+    const BaseField& denominator = internal::GetDenominator(points[gid]);
+    if (!denominator.IsZero()) d = denominator;
+  }
+  prefix[tid] = d;
+  suffix[tid] = d;
+  __syncthreads();
+
+  // Hillis-Steele scans: |prefix[tid]| = d₀ * ... * d_tid and |suffix[tid]| =
+  // d_tid * ... * d_(blockDim.x - 1).
+  for (unsigned int offset = 1; offset < blockDim.x; offset <<= 1) {
+    BaseField p = tid >= offset ? prefix[tid - offset] : BaseField::One();
+    BaseField s =
+        tid + offset < blockDim.x ? suffix[tid + offset] : BaseField::One();
+    __syncthreads();
+    prefix[tid] *= p;
+    suffix[tid] *= s;
+    __syncthreads();
+  }
+
+  if (gid < count) {
+    BaseField other = tid > 0 ? prefix[tid - 1] : BaseField::One();
+    if (tid + 1 < blockDim.x) other *= suffix[tid + 1];
+    others[gid] = other;
+  }
+  if (tid == 0) block_products[blockIdx.x] = suffix[0];
+}
+
+// The second half of the batch normalization, which must be launched with the
+// same |blockDim.x| as |ComputeDenominatorProducts()|. The dynamic shared
+// memory must hold a base field element.
+template <typename Point>
+__global__ void NormalizeWithDenominatorProducts(
+    const Point* points, const typename Point::BaseField* others,
+    const typename Point::BaseField* block_products,
+    AffinePoint<typename Point::Curve>* affine_points, unsigned int count) {
+  using BaseField = typename Point::BaseField;
+
+  extern __shared__ char shared[];
+  BaseField* block_inverse = reinterpret_cast<BaseField*>(shared);
+  if (threadIdx.x == 0) {
+    const std::optional<BaseField> inverse =
+        block_products[blockIdx.x].Inverse();
+    assert(inverse);
+    *block_inverse = *inverse;
+  }
+  __syncthreads();
+
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= count) return;
+  const Point& point = points[gid];
+  if (internal::GetDenominator(point).IsZero()) {
+    affine_points[gid] = AffinePoint<typename Point::Curve>::Zero();
+    return;
+  }
+  affine_points[gid] =
+      internal::ToAffine(point, others[gid] * (*block_inverse));
+}
+
+// Computes the table of the fixed-base mapping, where the (i, j)-th entry is
+// (j + 1) * 2ʷⁱ * |base| for 0 ≤ i < |window_count| and 0 ≤ j < 2ʷ - 1. The
+// entries are computed independently by the double-and-add, so the 2D grid
+// runs without any synchronization.
+template <typename Curve>
+__global__ void ComputeFixedBaseTable(AffinePoint<Curve> base,
+                                      unsigned int window_bits,
+                                      unsigned int window_count,
+                                      PointXYZZ<Curve>* table) {
+  unsigned int window_size = (1u << window_bits) - 1;
+  unsigned int j = blockIdx.x * blockDim.x + threadIdx.x;
+  unsigned int i = blockIdx.y;
+  if (j >= window_size || i >= window_count) return;
+
+  // 2ʷⁱ * |base|
+  PointXYZZ<Curve> window_base = base.ToXYZZ();
+  for (unsigned int k = 0; k < window_bits * i; ++k) {
+    window_base.DoubleInPlace();
+  }
+  unsigned int multiple = j + 1;
+  PointXYZZ<Curve> ret = PointXYZZ<Curve>::Zero();
+  for (int k = 31 - __clz(multiple); k >= 0; --k) {
+    ret.DoubleInPlace();
+    if ((multiple >> k) & 1) ret += window_base;
+  }
+  table[i * window_size + j] = ret;
+}
+
+// Computes |scalars[i]| * G with the table of |ComputeFixedBaseTable()|,
+// which takes a mixed addition per window.
+template <typename Curve, typename ScalarField>
+__global__ void MapScalarFieldToPoint(const AffinePoint<Curve>* table,
+                                      const ScalarField* scalars,
+                                      unsigned int window_bits,
+                                      unsigned int window_count,
+                                      unsigned int modulus_bits,
+                                      PointXYZZ<Curve>* results,
+                                      unsigned int count) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= count) return;
+  unsigned int window_size = (1u << window_bits) - 1;
+  auto scalar = scalars[gid].ToBigInt();
+  PointXYZZ<Curve> ret = PointXYZZ<Curve>::Zero();
+  for (unsigned int i = 0; i < window_count; ++i) {
+    unsigned int bit_offset = i * window_bits;
+    unsigned int bit_count = min(window_bits, modulus_bits - bit_offset);
+    uint64_t digit = scalar.ExtractBits64(bit_offset, bit_count);
+    if (digit != 0) ret += table[i * window_size + digit - 1];
+  }
+  results[gid] = ret;
+}
+
+}  // namespace tachyon::math::kernels
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_KERNELS_POINT_BATCH_OPS_CU_H_
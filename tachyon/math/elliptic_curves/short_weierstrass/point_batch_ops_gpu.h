@@ -0,0 +1,167 @@
+// This header defines |PointBatchOpsGpu|, which runs the batch operations of
+// the points, i.e., |BatchNormalize()| and |BatchMapScalarFieldToPoint()|, on
+// the GPU. The inputs and the outputs stay on the device, so that the SRS and
+// the results of the MSMs don't have to be copied to the host to be
+// normalized.
+
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_POINT_BATCH_OPS_GPU_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_POINT_BATCH_OPS_GPU_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/kernels/point_batch_ops.cu.h"
+
+namespace tachyon::math {
+
+template <typename GpuCurve>
+class PointBatchOpsGpu {
+ public:
+  using BaseField = typename AffinePoint<GpuCurve>::BaseField;
+  using ScalarField = typename AffinePoint<GpuCurve>::ScalarField;
+  using CpuCurve = typename GpuCurve::CpuCurve;
+
+  constexpr static unsigned int kThreadNum = 256;
+  // Same as |AffinePoint::kMaxBatchMapWindowBits|.
+  constexpr static unsigned int kMaxWindowBits = 12;
+
+  explicit PointBatchOpsGpu(gpuStream_t stream = nullptr) : stream_(stream) {}
+  PointBatchOpsGpu(const PointBatchOpsGpu& other) = delete;
+  PointBatchOpsGpu& operator=(const PointBatchOpsGpu& other) = delete;
+
+  gpuStream_t stream() const { return stream_; }
+
+  // Converts the first |size| points of |points| to |affine_points|, where
+  // |Point| is one of |ProjectivePoint|, |JacobianPoint| and |PointXYZZ|. The
+  // operations are enqueued on |stream()|, so this returns before they end.
+  template <typename Point>
+  [[nodiscard]] bool BatchNormalize(
+      const device::gpu::GpuMemory<Point>& points, size_t size,
+      device::gpu::GpuMemory<AffinePoint<GpuCurve>>* affine_points) {
+    TRACE_EVENT("gpu", "PointBatchOpsGpu::BatchNormalize");
+    if (size > points.size() || size > affine_points->size()) {
+      LOG(ERROR) << "Too small buffers for " << size << " points";
+      return false;
+    }
+    return DoBatchNormalize(points.get(), size, affine_points->get());
+  }
+
+  // Computes |scalars[i]| * |point| for the first |size| scalars with the
+  // fixed-base windowed method, like
+  // |AffinePoint::BatchMapScalarFieldToPoint()|. The table of the multiples of
+  // |point| is computed and normalized on the device as well.
+  [[nodiscard]] bool BatchMapScalarFieldToPoint(
+      const AffinePoint<CpuCurve>& point,
+      const device::gpu::GpuMemory<ScalarField>& scalars, size_t size,
+      device::gpu::GpuMemory<AffinePoint<GpuCurve>>* affine_points) {
+    TRACE_EVENT("gpu", "PointBatchOpsGpu::BatchMapScalarFieldToPoint");
+    if (size > scalars.size() || size > affine_points->size()) {
+      LOG(ERROR) << "Too small buffers for " << size << " scalars";
+      return false;
+    }
+    if (size == 0) return true;
+    if (size > size_t{std::numeric_limits<unsigned int>::max()}) {
+      LOG(ERROR) << "Too many scalars: " << size;
+      return false;
+    }
+
+    unsigned int modulus_bits = ScalarField::Config::kModulusBits;
+    unsigned int window_bits =
+        std::min(MSMCtx::ComputeWindowsBits(size), kMaxWindowBits);
+    unsigned int window_count =
+        MSMCtx::ComputeWindowsCount<ScalarField>(window_bits);
+    unsigned int window_size = (1u << window_bits) - 1;
+    size_t table_size = size_t{window_count} * window_size;
+
+    Reserve(table_size, d_table_xyzz_);
+    Reserve(table_size, d_table_);
+    Reserve(size, d_results_);
+
+    dim3 grid((window_size + kThreadNum - 1) / kThreadNum, window_count);
+    kernels::ComputeFixedBaseTable<<<grid, kThreadNum, 0, stream_>>>(
+        ConvertPoint<AffinePoint<GpuCurve>>(point), window_bits, window_count,
+        d_table_xyzz_.get());
+    if (LOG_IF_GPU_LAST_ERROR("Failed to kernels::ComputeFixedBaseTable()") !=
+        gpuSuccess) {
+      return false;
+    }
+    if (!DoBatchNormalize(d_table_xyzz_.get(), table_size, d_table_.get())) {
+      return false;
+    }
+
+    unsigned int count = static_cast<unsigned int>(size);
+    kernels::MapScalarFieldToPoint<<<(count + kThreadNum - 1) / kThreadNum,
+                                     kThreadNum, 0, stream_>>>(
+        d_table_.get(), scalars.get(), window_bits, window_count, modulus_bits,
+        d_results_.get(), count);
+    if (LOG_IF_GPU_LAST_ERROR("Failed to kernels::MapScalarFieldToPoint()") !=
+        gpuSuccess) {
+      return false;
+    }
+    return DoBatchNormalize(d_results_.get(), size, affine_points->get());
+  }
+
+  // Waits until the operations enqueued on |stream()| end.
+  [[nodiscard]] bool Synchronize() {
+    return LOG_IF_GPU_ERROR(gpuStreamSynchronize(stream_),
+                            "Failed to gpuStreamSynchronize()") == gpuSuccess;
+  }
+
+ private:
+  template <typename T>
+  static void Reserve(size_t size, device::gpu::GpuMemory<T>& memory) {
+    if (memory.size() < size) {
+      memory = device::gpu::GpuMemory<T>::Malloc(size);
+    }
+  }
+
+  template <typename Point>
+  bool DoBatchNormalize(const Point* points, size_t size,
+                        AffinePoint<GpuCurve>* affine_points) {
+    if (size == 0) return true;
+    if (size > size_t{std::numeric_limits<unsigned int>::max()}) {
+      LOG(ERROR) << "Too many points: " << size;
+      return false;
+    }
+    unsigned int count = static_cast<unsigned int>(size);
+    unsigned int num_blocks = (count + kThreadNum - 1) / kThreadNum;
+    Reserve(size, d_others_);
+    Reserve(num_blocks, d_block_products_);
+
+    kernels::ComputeDenominatorProducts<<<num_blocks, kThreadNum,
+                                          2 * kThreadNum * sizeof(BaseField),
+                                          stream_>>>(
+        points, d_others_.get(), d_block_products_.get(), count);
+    if (LOG_IF_GPU_LAST_ERROR(
+            "Failed to kernels::ComputeDenominatorProducts()") != gpuSuccess) {
+      return false;
+    }
+    kernels::NormalizeWithDenominatorProducts<<<num_blocks, kThreadNum,
+                                                sizeof(BaseField), stream_>>>(
+        points, d_others_.get(), d_block_products_.get(), affine_points, count);
+    return LOG_IF_GPU_LAST_ERROR(
+               "Failed to kernels::NormalizeWithDenominatorProducts()") ==
+           gpuSuccess;
+  }
+
+  gpuStream_t stream_ = nullptr;
+  // The device buffers below are reused by the following calls if they are
+  // large enough.
+  device::gpu::GpuMemory<BaseField> d_others_;
+  device::gpu::GpuMemory<BaseField> d_block_products_;
+  device::gpu::GpuMemory<PointXYZZ<GpuCurve>> d_table_xyzz_;
+  device::gpu::GpuMemory<AffinePoint<GpuCurve>> d_table_;
+  device::gpu::GpuMemory<PointXYZZ<GpuCurve>> d_results_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_POINT_BATCH_OPS_GPU_H_
@@ -0,0 +1,105 @@
+#include "tachyon/math/elliptic_curves/short_weierstrass/point_batch_ops_gpu.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1_gpu.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using namespace device;
+
+class PointBatchOpsGpuTest : public testing::Test {
+ public:
+  // Not a multiple of |PointBatchOpsGpu::kThreadNum|, so that the last block
+  // is partially filled.
+  constexpr static size_t N = 1000;
+
+  static void SetUpTestSuite() {
+    GPU_MUST_SUCCESS(gpuDeviceReset(), "");
+    bn254::G1Curve::Init();
+    bn254::G1CurveGpu::Init();
+  }
+
+  static void TearDownTestSuite() {
+    GPU_MUST_SUCCESS(gpuDeviceReset(), "");
+  }
+
+ protected:
+  template <typename GpuPoint, typename CpuPoint>
+  static void TestBatchNormalize(const std::vector<CpuPoint>& points) {
+    gpu::GpuMemory<GpuPoint> d_points =
+        gpu::GpuMemory<GpuPoint>::Malloc(points.size());
+    ASSERT_TRUE(d_points.CopyFrom(points.data(), gpu::GpuMemoryType::kHost));
+    gpu::GpuMemory<bn254::G1AffinePointGpu> d_affine_points =
+        gpu::GpuMemory<bn254::G1AffinePointGpu>::Malloc(points.size());
+
+    PointBatchOpsGpu<bn254::G1CurveGpu> ops;
+    ASSERT_TRUE(ops.BatchNormalize(d_points, points.size(), &d_affine_points));
+    ASSERT_TRUE(ops.Synchronize());
+
+    std::vector<bn254::G1AffinePoint> affine_points(points.size());
+    ASSERT_TRUE(d_affine_points.CopyTo(affine_points.data(),
+                                       gpu::GpuMemoryType::kHost));
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_EQ(affine_points[i], points[i].ToAffine());
+    }
+  }
+};
+
+}  // namespace
+
+TEST_F(PointBatchOpsGpuTest, BatchNormalize) {
+  std::vector<bn254::G1JacobianPoint> points = base::CreateVector(
+      N, []() { return bn254::G1JacobianPoint::Random(); });
+  points[1] = bn254::G1JacobianPoint::Zero();
+  points[N - 1] = bn254::G1JacobianPoint::Zero();
+  TestBatchNormalize<bn254::G1JacobianPointGpu>(points);
+
+  std::vector<bn254::G1PointXYZZ> points_xyzz =
+      base::Map(points, [](const bn254::G1JacobianPoint& point) {
+        return point.ToXYZZ();
+      });
+  TestBatchNormalize<bn254::G1PointXYZZGpu>(points_xyzz);
+
+  std::vector<bn254::G1ProjectivePoint> points_projective =
+      base::Map(points, [](const bn254::G1JacobianPoint& point) {
+        return point.ToProjective();
+      });
+  TestBatchNormalize<bn254::G1ProjectivePointGpu>(points_projective);
+}
+
+TEST_F(PointBatchOpsGpuTest, BatchMapScalarFieldToPoint) {
+  std::vector<bn254::Fr> scalars =
+      base::CreateVector(N, []() { return bn254::Fr::Random(); });
+  scalars[0] = bn254::Fr::Zero();
+  scalars[1] = bn254::Fr::One();
+  scalars[2] = -bn254::Fr::One();
+  bn254::G1AffinePoint generator = bn254::G1AffinePoint::Generator();
+
+  gpu::GpuMemory<bn254::FrGpu> d_scalars =
+      gpu::GpuMemory<bn254::FrGpu>::Malloc(N);
+  ASSERT_TRUE(d_scalars.CopyFrom(scalars.data(), gpu::GpuMemoryType::kHost));
+  gpu::GpuMemory<bn254::G1AffinePointGpu> d_affine_points =
+      gpu::GpuMemory<bn254::G1AffinePointGpu>::Malloc(N);
+
+  PointBatchOpsGpu<bn254::G1CurveGpu> ops;
+  ASSERT_TRUE(ops.BatchMapScalarFieldToPoint(generator, d_scalars, N,
+                                             &d_affine_points));
+  ASSERT_TRUE(ops.Synchronize());
+
+  std::vector<bn254::G1AffinePoint> affine_points(N);
+  ASSERT_TRUE(
+      d_affine_points.CopyTo(affine_points.data(), gpu::GpuMemoryType::kHost));
+  std::vector<bn254::G1AffinePoint> expected(N);
+  ASSERT_TRUE(bn254::G1AffinePoint::BatchMapScalarFieldToPoint(
+      generator, scalars, &expected));
+  EXPECT_EQ(affine_points, expected);
+}
+
+}  // namespace tachyon::math
@@ -34,11 +34,17 @@ class SWCurve {
 
   constexpr static CurveType kType = CurveType::kShortWeierstrass;
 
+  // NOTE: The constants are computed by the first call only, so that the
+  // callers may call this whenever they need the curve, and the calls racing
+  // with it wait until it is done.
   static void Init() {
-    BaseField::Init();
-    ScalarField::Init();
+    [[maybe_unused]] static bool initialized = []() {
+      BaseField::Init();
+      ScalarField::Init();
 
-    Config::Init();
+      Config::Init();
+      return true;
+    }();
   }
 
   // Attempts to construct an affine point given an |x| coordinate. The
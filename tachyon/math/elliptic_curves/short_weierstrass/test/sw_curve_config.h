@@ -15,6 +15,8 @@ namespace test {
 template <typename _BaseField, typename _ScalarField>
 class SWCurveConfig {
  public:
+  constexpr static const char* kName = "tachyon::math::test::SWCurve";
+
   using BaseField = _BaseField;
   using BasePrimeField = BaseField;
   using ScalarField = _ScalarField;
@@ -37,6 +37,11 @@ struct FiniteFieldTraits<PackedBabyBear> {
   using Config = BabyBear::Config;
 };
 
+template <>
+struct PackedFieldTraits<BabyBear> {
+  using PackedField = PackedBabyBear;
+};
+
 }  // namespace tachyon::math
 
 namespace Eigen {
@@ -0,0 +1,17 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_BABY_BEAR_PACKED_BABY_BEAR4_H_
+#define TACHYON_MATH_FINITE_FIELDS_BABY_BEAR_PACKED_BABY_BEAR4_H_
+
+#include "tachyon/math/finite_fields/baby_bear/baby_bear4.h"
+#include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
+#include "tachyon/math/finite_fields/packed_fp4.h"
+
+namespace tachyon::math {
+
+// NOTE: |PackedFieldTraits<BabyBear4>| is not specialized, since the callers
+// of it reinterpret a span of the field as a span of the packed field, which
+// doesn't hold for the layout of |PackedFp4|.
+using PackedBabyBear4 = PackedFp4<BabyBear4>;
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_BABY_BEAR_PACKED_BABY_BEAR4_H_
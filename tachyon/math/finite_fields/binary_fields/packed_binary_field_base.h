@@ -0,0 +1,118 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_BASE_H_
+#define TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_BASE_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <optional>
+#include <string>
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/strings/string_util.h"
+#include "tachyon/math/base/field.h"
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_field_traits_forward.h"
+
+namespace tachyon::math {
+
+// Same as |PackedPrimeFieldBase|, but the lanes are |BinaryField|. Addition,
+// subtraction and negation are all the same XOR, so only |Add()| and |Mul()|
+// need to be vectorized by |Derived|.
+template <typename Derived>
+class PackedBinaryFieldBase : public Field<Derived> {
+ public:
+  using BinaryField = typename PackedBinaryFieldTraits<Derived>::BinaryField;
+
+  constexpr static size_t N = PackedBinaryFieldTraits<Derived>::N;
+
+  static Derived Random() {
+    Derived ret;
+    for (size_t i = 0; i < N; ++i) {
+      ret.values_[i] = BinaryField::Random();
+    }
+    return ret;
+  }
+
+  const std::array<BinaryField, N>& values() const { return values_; }
+  std::array<BinaryField, N>& values() { return values_; }
+
+  constexpr bool IsZero() const {
+    for (size_t i = 0; i < N; ++i) {
+      if (!values_[i].IsZero()) return false;
+    }
+    return true;
+  }
+
+  constexpr bool IsOne() const {
+    for (size_t i = 0; i < N; ++i) {
+      if (!values_[i].IsOne()) return false;
+    }
+    return true;
+  }
+
+  std::string ToString() const { return base::ContainerToString(values_); }
+  std::string ToHexString(bool pad_zero = false) const {
+    return base::ContainerToString(
+        base::Map(values_, [pad_zero](const BinaryField& value) {
+          return value.ToHexString(pad_zero);
+        }));
+  }
+
+  constexpr BinaryField& operator[](size_t i) { return values_[i]; }
+  constexpr const BinaryField& operator[](size_t i) const {
+    return values_[i];
+  }
+
+  constexpr bool operator==(const Derived& other) const {
+    return values_ == other.values_;
+  }
+  constexpr bool operator!=(const Derived& other) const {
+    return values_ != other.values_;
+  }
+
+  // AdditiveSemigroup methods
+  Derived& AddInPlace(const Derived& other) {
+    Derived& self = static_cast<Derived&>(*this);
+    return self = self + other;
+  }
+
+  // AdditiveGroup methods
+  Derived Sub(const Derived& other) const {
+    const Derived& self = static_cast<const Derived&>(*this);
+    return self + other;
+  }
+
+  Derived& SubInPlace(const Derived& other) {
+    Derived& self = static_cast<Derived&>(*this);
+    return self = self + other;
+  }
+
+  Derived Negate() const { return static_cast<const Derived&>(*this); }
+
+  Derived& NegateInPlace() { return static_cast<Derived&>(*this); }
+
+  // MultiplicativeSemigroup methods
+  Derived& MulInPlace(const Derived& other) {
+    Derived& self = static_cast<Derived&>(*this);
+    return self = self * other;
+  }
+
+  // MultiplicativeGroup methods
+  std::optional<Derived> Inverse() const {
+    Derived ret;
+    CHECK(BinaryField::BatchInverse(values_, &ret.values_));
+    return ret;
+  }
+
+  [[nodiscard]] std::optional<Derived*> InverseInPlace() {
+    CHECK(BinaryField::BatchInverseInPlace(values_));
+    return static_cast<Derived*>(this);
+  }
+
+ protected:
+  std::array<BinaryField, N> values_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_BASE_H_
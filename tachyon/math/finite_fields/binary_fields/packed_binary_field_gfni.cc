@@ -0,0 +1,184 @@
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_field_gfni.h"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::math {
+
+namespace {
+
+// The vgf2p8affineqb matrices, whose (7 - i)-th byte is the i-th row, that
+// map a coordinate over |BinaryField8| to the AES field
+// GF(2)[x] / (x⁸ + x⁴ + x³ + x + 1) and back. The isomorphism sends 0x13,
+// which generates the multiplicative group of |BinaryField8|, to 0x6e.
+constexpr int64_t kToAesMatrix = 0x31506aea964e983e;
+constexpr int64_t kFromAesMatrix = static_cast<int64_t>(0xd1e8863e72a2700c);
+
+// The image of α = 0x10, where X² = αX + 1 defines |BinaryField16| over
+// |BinaryField8|.
+constexpr char kAesAlpha = static_cast<char>(0xd3);
+
+template <typename BinaryField>
+__m256i ToVector(const PackedBinaryFieldGFNI<BinaryField>& packed) {
+  return _mm256_loadu_si256(
+      reinterpret_cast<const __m256i_u*>(packed.values().data()));
+}
+
+template <typename BinaryField>
+PackedBinaryFieldGFNI<BinaryField> FromVector(__m256i vector) {
+  PackedBinaryFieldGFNI<BinaryField> ret;
+  _mm256_storeu_si256(reinterpret_cast<__m256i_u*>(ret.values().data()),
+                      vector);
+  return ret;
+}
+
+__m256i ToAes(__m256i x) {
+  return _mm256_gf2p8affine_epi64_epi8(x, _mm256_set1_epi64x(kToAesMatrix),
+                                       0);
+}
+
+__m256i FromAes(__m256i x) {
+  return _mm256_gf2p8affine_epi64_epi8(x, _mm256_set1_epi64x(kFromAesMatrix),
+                                       0);
+}
+
+// Swaps the halves of every |Bits|-bit lane: [x₀, x₁] -> [x₁, x₀].
+template <size_t Bits>
+__m256i SwapHalves(__m256i x) {
+  if constexpr (Bits == 16) {
+    return _mm256_or_si256(_mm256_slli_epi16(x, 8), _mm256_srli_epi16(x, 8));
+  } else if constexpr (Bits == 32) {
+    return _mm256_or_si256(_mm256_slli_epi32(x, 16), _mm256_srli_epi32(x, 16));
+  } else if constexpr (Bits == 64) {
+    return _mm256_shuffle_epi32(x, 0b10110001);
+  } else {
+    static_assert(Bits == 128);
+    return _mm256_shuffle_epi32(x, 0b01001110);
+  }
+}
+
+// Takes the lower halves of the |Bits|-bit lanes from |lo| and the upper
+// halves from |hi|: [lo₀, hi₁].
+template <size_t Bits>
+__m256i Compose(__m256i lo, __m256i hi) {
+  if constexpr (Bits == 16) {
+    return _mm256_blendv_epi8(lo, hi,
+                              _mm256_set1_epi16(static_cast<int16_t>(0xff00)));
+  } else if constexpr (Bits == 32) {
+    return _mm256_blend_epi16(lo, hi, 0b10101010);
+  } else if constexpr (Bits == 64) {
+    return _mm256_blend_epi32(lo, hi, 0b10101010);
+  } else {
+    static_assert(Bits == 128);
+    return _mm256_blend_epi32(lo, hi, 0b11001100);
+  }
+}
+
+// The functions below run on the coordinates in the AES field and follow
+// |BinaryTowerOperations| on the halves of the |Bits|-bit lanes.
+template <size_t Bits>
+__m256i MulByAlpha(__m256i x) {
+  if constexpr (Bits == 8) {
+    return _mm256_gf2p8mul_epi8(x, _mm256_set1_epi8(kAesAlpha));
+  } else {
+    // (x₀ + x₁X) * X = x₁ + (x₀ + x₁ * α)X
+    __m256i swapped = SwapHalves<Bits>(x);
+    return Compose<Bits>(
+        swapped, _mm256_xor_si256(swapped, MulByAlpha<Bits / 2>(x)));
+  }
+}
+
+template <size_t Bits>
+__m256i Mul(__m256i lhs, __m256i rhs) {
+  if constexpr (Bits == 8) {
+    return _mm256_gf2p8mul_epi8(lhs, rhs);
+  } else {
+    // [z₀, z₁], where z₀ = lhs₀ * rhs₀ and z₁ = lhs₁ * rhs₁
+    __m256i z = Mul<Bits / 2>(lhs, rhs);
+    // [z₂, z₂], where z₂ = (lhs₀ + lhs₁) * (rhs₀ + rhs₁)
+    __m256i z2 =
+        Mul<Bits / 2>(_mm256_xor_si256(lhs, SwapHalves<Bits>(lhs)),
+                      _mm256_xor_si256(rhs, SwapHalves<Bits>(rhs)));
+    // [z₀ + z₁, z₀ + z₁]
+    __m256i z0z1 = _mm256_xor_si256(z, SwapHalves<Bits>(z));
+    // z₀ + z₁ + (z₂ - (z₀ + z₁) + z₁ * α)X
+    __m256i hi =
+        _mm256_xor_si256(_mm256_xor_si256(z2, z0z1), MulByAlpha<Bits / 2>(z));
+    return Compose<Bits>(z0z1, hi);
+  }
+}
+
+template <size_t Bits>
+__m256i Square(__m256i x) {
+  if constexpr (Bits == 8) {
+    return _mm256_gf2p8mul_epi8(x, x);
+  } else {
+    // [x₀², x₁²]
+    __m256i z = Square<Bits / 2>(x);
+    // x₀² + x₁² + (x₁² * α)X
+    return Compose<Bits>(_mm256_xor_si256(z, SwapHalves<Bits>(z)),
+                         MulByAlpha<Bits / 2>(z));
+  }
+}
+
+}  // namespace
+
+// static
+template <typename BinaryField>
+void PackedBinaryFieldGFNI<BinaryField>::Init() {
+  VLOG(1) << "PackedBinaryFieldGFNI<" << BinaryField::Config::kName
+          << "> initialized";
+}
+
+// static
+template <typename BinaryField>
+PackedBinaryFieldGFNI<BinaryField> PackedBinaryFieldGFNI<BinaryField>::Zero() {
+  return FromVector<BinaryField>(_mm256_setzero_si256());
+}
+
+// static
+template <typename BinaryField>
+PackedBinaryFieldGFNI<BinaryField> PackedBinaryFieldGFNI<BinaryField>::One() {
+  return Broadcast(BinaryField::One());
+}
+
+// static
+template <typename BinaryField>
+PackedBinaryFieldGFNI<BinaryField>
+PackedBinaryFieldGFNI<BinaryField>::Broadcast(const BinaryField& value) {
+  PackedBinaryFieldGFNI ret;
+  ret.values_.fill(value);
+  return ret;
+}
+
+template <typename BinaryField>
+PackedBinaryFieldGFNI<BinaryField> PackedBinaryFieldGFNI<BinaryField>::Add(
+    const PackedBinaryFieldGFNI& other) const {
+  return FromVector<BinaryField>(
+      _mm256_xor_si256(ToVector(*this), ToVector(other)));
+}
+
+template <typename BinaryField>
+PackedBinaryFieldGFNI<BinaryField> PackedBinaryFieldGFNI<BinaryField>::Mul(
+    const PackedBinaryFieldGFNI& other) const {
+  return FromVector<BinaryField>(FromAes(tachyon::math::Mul<BinaryField::kBits>(
+      ToAes(ToVector(*this)), ToAes(ToVector(other)))));
+}
+
+template <typename BinaryField>
+PackedBinaryFieldGFNI<BinaryField>
+PackedBinaryFieldGFNI<BinaryField>::SquareImpl() const {
+  return FromVector<BinaryField>(
+      FromAes(tachyon::math::Square<BinaryField::kBits>(
+          ToAes(ToVector(*this)))));
+}
+
+template class PackedBinaryFieldGFNI<BinaryField8>;
+template class PackedBinaryFieldGFNI<BinaryField16>;
+template class PackedBinaryFieldGFNI<BinaryField32>;
+template class PackedBinaryFieldGFNI<BinaryField64>;
+template class PackedBinaryFieldGFNI<BinaryField128>;
+
+}  // namespace tachyon::math
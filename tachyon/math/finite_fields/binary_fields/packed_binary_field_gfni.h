@@ -0,0 +1,74 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_GFNI_H_
+#define TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_GFNI_H_
+
+#include <stddef.h>
+
+#include "tachyon/export.h"
+#include "tachyon/math/finite_fields/binary_fields/binary_fields.h"
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_field_base.h"
+
+namespace tachyon::math {
+
+template <typename _BinaryField>
+class PackedBinaryFieldGFNI;
+
+template <typename _BinaryField>
+struct PackedBinaryFieldTraits<PackedBinaryFieldGFNI<_BinaryField>> {
+  using BinaryField = _BinaryField;
+
+  constexpr static size_t N = 32 / sizeof(_BinaryField);
+};
+
+// 256 bits of |BinaryField|, which is one of the binary tower fields from
+// |BinaryField8| to |BinaryField128|. Every byte is a coordinate over
+// |BinaryField8|, which is multiplied by vgf2p8mulb after being mapped to the
+// AES field by vgf2p8affineqb. The upper levels of the tower are multiplied
+// by Karatsuba on the halves of each lane like |BinaryTowerOperations|.
+template <typename _BinaryField>
+class TACHYON_EXPORT PackedBinaryFieldGFNI final
+    : public PackedBinaryFieldBase<PackedBinaryFieldGFNI<_BinaryField>> {
+ public:
+  using BinaryField = _BinaryField;
+
+  constexpr static size_t N =
+      PackedBinaryFieldTraits<PackedBinaryFieldGFNI>::N;
+
+  PackedBinaryFieldGFNI() = default;
+  PackedBinaryFieldGFNI(const PackedBinaryFieldGFNI& other) = default;
+  PackedBinaryFieldGFNI& operator=(const PackedBinaryFieldGFNI& other) =
+      default;
+  PackedBinaryFieldGFNI(PackedBinaryFieldGFNI&& other) = default;
+  PackedBinaryFieldGFNI& operator=(PackedBinaryFieldGFNI&& other) = default;
+
+  static void Init();
+
+  static PackedBinaryFieldGFNI Zero();
+
+  static PackedBinaryFieldGFNI One();
+
+  static PackedBinaryFieldGFNI Broadcast(const BinaryField& value);
+
+  // AdditiveSemigroup methods
+  PackedBinaryFieldGFNI Add(const PackedBinaryFieldGFNI& other) const;
+
+  // MultiplicativeSemigroup methods
+  PackedBinaryFieldGFNI Mul(const PackedBinaryFieldGFNI& other) const;
+
+  PackedBinaryFieldGFNI SquareImpl() const;
+};
+
+extern template class PackedBinaryFieldGFNI<BinaryField8>;
+extern template class PackedBinaryFieldGFNI<BinaryField16>;
+extern template class PackedBinaryFieldGFNI<BinaryField32>;
+extern template class PackedBinaryFieldGFNI<BinaryField64>;
+extern template class PackedBinaryFieldGFNI<BinaryField128>;
+
+using PackedBinaryField8GFNI = PackedBinaryFieldGFNI<BinaryField8>;
+using PackedBinaryField16GFNI = PackedBinaryFieldGFNI<BinaryField16>;
+using PackedBinaryField32GFNI = PackedBinaryFieldGFNI<BinaryField32>;
+using PackedBinaryField64GFNI = PackedBinaryFieldGFNI<BinaryField64>;
+using PackedBinaryField128GFNI = PackedBinaryFieldGFNI<BinaryField128>;
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_GFNI_H_
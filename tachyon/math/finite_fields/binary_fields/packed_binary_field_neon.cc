@@ -0,0 +1,219 @@
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_field_neon.h"
+
+#include <arm_neon.h>
+#include <stdint.h>
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::math {
+
+namespace {
+
+// The tables of the isomorphism between |BinaryField8| and the AES field
+// GF(2)[x] / (x⁸ + x⁴ + x³ + x + 1) over the lower and the upper nibbles, which
+// is the same as the one of |PackedBinaryFieldGFNI|.
+// clang-format off
+constexpr uint8_t kToAesLo[16] = {
+  0x00, 0x01, 0xbc, 0xbd, 0xb0, 0xb1, 0x0c, 0x0d,
+  0xec, 0xed, 0x50, 0x51, 0x5c, 0x5d, 0xe0, 0xe1,
+};
+constexpr uint8_t kToAesHi[16] = {
+  0x00, 0xd3, 0x8d, 0x5e, 0x2e, 0xfd, 0xa3, 0x70,
+  0x58, 0x8b, 0xd5, 0x06, 0x76, 0xa5, 0xfb, 0x28,
+};
+constexpr uint8_t kFromAesLo[16] = {
+  0x00, 0x01, 0x3c, 0x3d, 0x8c, 0x8d, 0xb0, 0xb1,
+  0x8a, 0x8b, 0xb6, 0xb7, 0x06, 0x07, 0x3a, 0x3b,
+};
+constexpr uint8_t kFromAesHi[16] = {
+  0x00, 0x59, 0x7a, 0x23, 0x53, 0x0a, 0x29, 0x70,
+  0x27, 0x7e, 0x5d, 0x04, 0x74, 0x2d, 0x0e, 0x57,
+};
+// clang-format on
+
+// The image of α = 0x10, where X² = αX + 1 defines |BinaryField16| over
+// |BinaryField8|.
+constexpr uint8_t kAesAlpha = 0xd3;
+
+template <typename BinaryField>
+uint8x16_t ToVector(const PackedBinaryFieldNeon<BinaryField>& packed) {
+  return vld1q_u8(reinterpret_cast<const uint8_t*>(packed.values().data()));
+}
+
+template <typename BinaryField>
+PackedBinaryFieldNeon<BinaryField> FromVector(uint8x16_t vector) {
+  PackedBinaryFieldNeon<BinaryField> ret;
+  vst1q_u8(reinterpret_cast<uint8_t*>(ret.values().data()), vector);
+  return ret;
+}
+
+uint8x16_t Transform(uint8x16_t x, const uint8_t lo_table[16],
+                     const uint8_t hi_table[16]) {
+  return veorq_u8(vqtbl1q_u8(vld1q_u8(lo_table), vandq_u8(x, vdupq_n_u8(0xf))),
+                  vqtbl1q_u8(vld1q_u8(hi_table), vshrq_n_u8(x, 4)));
+}
+
+uint8x16_t ToAes(uint8x16_t x) { return Transform(x, kToAesLo, kToAesHi); }
+
+uint8x16_t FromAes(uint8x16_t x) {
+  return Transform(x, kFromAesLo, kFromAesHi);
+}
+
+uint8x16_t MulAes(uint8x16_t lhs, uint8x16_t rhs) {
+  poly8x16_t lhs_p = vreinterpretq_p8_u8(lhs);
+  poly8x16_t rhs_p = vreinterpretq_p8_u8(rhs);
+  // The 15-bit carry-less products of the lower and the upper 8 bytes.
+  uint8x16_t prod_lo = vreinterpretq_u8_p16(
+      vmull_p8(vget_low_p8(lhs_p), vget_low_p8(rhs_p)));
+  uint8x16_t prod_hi = vreinterpretq_u8_p16(vmull_high_p8(lhs_p, rhs_p));
+  // prod = l + h * x⁸
+  uint8x16_t l = vuzp1q_u8(prod_lo, prod_hi);
+  uint8x16_t h = vuzp2q_u8(prod_lo, prod_hi);
+  // h * x⁸ = h * (x⁴ + x³ + x + 1)
+  //        = (h * 0x1b mod x⁸) + h' * x⁸
+  //        = (h * 0x1b mod x⁸) + (h' * 0x1b mod x⁸),
+  // where h' = (h >> 4) + (h >> 5) + (h >> 7) is of degree at most 2.
+  uint8x16_t h2 = veorq_u8(veorq_u8(vshrq_n_u8(h, 4), vshrq_n_u8(h, 5)),
+                           vshrq_n_u8(h, 7));
+  poly8x16_t k = vdupq_n_p8(0x1b);
+  uint8x16_t r = veorq_u8(
+      l, vreinterpretq_u8_p8(vmulq_p8(vreinterpretq_p8_u8(h), k)));
+  return veorq_u8(r,
+                  vreinterpretq_u8_p8(vmulq_p8(vreinterpretq_p8_u8(h2), k)));
+}
+
+// Swaps the halves of every |Bits|-bit lane: [x₀, x₁] -> [x₁, x₀].
+template <size_t Bits>
+uint8x16_t SwapHalves(uint8x16_t x) {
+  if constexpr (Bits == 16) {
+    return vrev16q_u8(x);
+  } else if constexpr (Bits == 32) {
+    return vreinterpretq_u8_u16(vrev32q_u16(vreinterpretq_u16_u8(x)));
+  } else if constexpr (Bits == 64) {
+    return vreinterpretq_u8_u32(vrev64q_u32(vreinterpretq_u32_u8(x)));
+  } else {
+    static_assert(Bits == 128);
+    return vextq_u8(x, x, 8);
+  }
+}
+
+// Takes the lower halves of the |Bits|-bit lanes from |lo| and the upper
+// halves from |hi|: [lo₀, hi₁].
+template <size_t Bits>
+uint8x16_t Compose(uint8x16_t lo, uint8x16_t hi) {
+  uint8x16_t hi_mask;
+  if constexpr (Bits == 16) {
+    hi_mask = vreinterpretq_u8_u16(vdupq_n_u16(0xff00));
+  } else if constexpr (Bits == 32) {
+    hi_mask = vreinterpretq_u8_u32(vdupq_n_u32(0xffff0000));
+  } else if constexpr (Bits == 64) {
+    hi_mask = vreinterpretq_u8_u64(vdupq_n_u64(0xffffffff00000000));
+  } else {
+    static_assert(Bits == 128);
+    hi_mask = vcombine_u8(vdup_n_u8(0), vdup_n_u8(0xff));
+  }
+  return vbslq_u8(hi_mask, hi, lo);
+}
+
+// The functions below run on the coordinates in the AES field and follow
+// |BinaryTowerOperations| on the halves of the |Bits|-bit lanes.
+template <size_t Bits>
+uint8x16_t MulByAlpha(uint8x16_t x) {
+  if constexpr (Bits == 8) {
+    return MulAes(x, vdupq_n_u8(kAesAlpha));
+  } else {
+    // (x₀ + x₁X) * X = x₁ + (x₀ + x₁ * α)X
+    uint8x16_t swapped = SwapHalves<Bits>(x);
+    return Compose<Bits>(swapped, veorq_u8(swapped, MulByAlpha<Bits / 2>(x)));
+  }
+}
+
+template <size_t Bits>
+uint8x16_t Mul(uint8x16_t lhs, uint8x16_t rhs) {
+  if constexpr (Bits == 8) {
+    return MulAes(lhs, rhs);
+  } else {
+    // [z₀, z₁], where z₀ = lhs₀ * rhs₀ and z₁ = lhs₁ * rhs₁
+    uint8x16_t z = Mul<Bits / 2>(lhs, rhs);
+    // [z₂, z₂], where z₂ = (lhs₀ + lhs₁) * (rhs₀ + rhs₁)
+    uint8x16_t z2 = Mul<Bits / 2>(veorq_u8(lhs, SwapHalves<Bits>(lhs)),
+                                  veorq_u8(rhs, SwapHalves<Bits>(rhs)));
+    // [z₀ + z₁, z₀ + z₁]
+    uint8x16_t z0z1 = veorq_u8(z, SwapHalves<Bits>(z));
+    // z₀ + z₁ + (z₂ - (z₀ + z₁) + z₁ * α)X
+    uint8x16_t hi = veorq_u8(veorq_u8(z2, z0z1), MulByAlpha<Bits / 2>(z));
+    return Compose<Bits>(z0z1, hi);
+  }
+}
+
+template <size_t Bits>
+uint8x16_t Square(uint8x16_t x) {
+  if constexpr (Bits == 8) {
+    return MulAes(x, x);
+  } else {
+    // [x₀², x₁²]
+    uint8x16_t z = Square<Bits / 2>(x);
+    // x₀² + x₁² + (x₁² * α)X
+    return Compose<Bits>(veorq_u8(z, SwapHalves<Bits>(z)),
+                         MulByAlpha<Bits / 2>(z));
+  }
+}
+
+}  // namespace
+
+// static
+template <typename BinaryField>
+void PackedBinaryFieldNeon<BinaryField>::Init() {
+  VLOG(1) << "PackedBinaryFieldNeon<" << BinaryField::Config::kName
+          << "> initialized";
+}
+
+// static
+template <typename BinaryField>
+PackedBinaryFieldNeon<BinaryField> PackedBinaryFieldNeon<BinaryField>::Zero() {
+  return FromVector<BinaryField>(vdupq_n_u8(0));
+}
+
+// static
+template <typename BinaryField>
+PackedBinaryFieldNeon<BinaryField> PackedBinaryFieldNeon<BinaryField>::One() {
+  return Broadcast(BinaryField::One());
+}
+
+// static
+template <typename BinaryField>
+PackedBinaryFieldNeon<BinaryField>
+PackedBinaryFieldNeon<BinaryField>::Broadcast(const BinaryField& value) {
+  PackedBinaryFieldNeon ret;
+  ret.values_.fill(value);
+  return ret;
+}
+
+template <typename BinaryField>
+PackedBinaryFieldNeon<BinaryField> PackedBinaryFieldNeon<BinaryField>::Add(
+    const PackedBinaryFieldNeon& other) const {
+  return FromVector<BinaryField>(veorq_u8(ToVector(*this), ToVector(other)));
+}
+
+template <typename BinaryField>
+PackedBinaryFieldNeon<BinaryField> PackedBinaryFieldNeon<BinaryField>::Mul(
+    const PackedBinaryFieldNeon& other) const {
+  return FromVector<BinaryField>(FromAes(tachyon::math::Mul<BinaryField::kBits>(
+      ToAes(ToVector(*this)), ToAes(ToVector(other)))));
+}
+
+template <typename BinaryField>
+PackedBinaryFieldNeon<BinaryField>
+PackedBinaryFieldNeon<BinaryField>::SquareImpl() const {
+  return FromVector<BinaryField>(
+      FromAes(tachyon::math::Square<BinaryField::kBits>(
+          ToAes(ToVector(*this)))));
+}
+
+template class PackedBinaryFieldNeon<BinaryField8>;
+template class PackedBinaryFieldNeon<BinaryField16>;
+template class PackedBinaryFieldNeon<BinaryField32>;
+template class PackedBinaryFieldNeon<BinaryField64>;
+template class PackedBinaryFieldNeon<BinaryField128>;
+
+}  // namespace tachyon::math
@@ -0,0 +1,73 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_NEON_H_
+#define TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_NEON_H_
+
+#include <stddef.h>
+
+#include "tachyon/export.h"
+#include "tachyon/math/finite_fields/binary_fields/binary_fields.h"
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_field_base.h"
+
+namespace tachyon::math {
+
+template <typename _BinaryField>
+class PackedBinaryFieldNeon;
+
+template <typename _BinaryField>
+struct PackedBinaryFieldTraits<PackedBinaryFieldNeon<_BinaryField>> {
+  using BinaryField = _BinaryField;
+
+  constexpr static size_t N = 16 / sizeof(_BinaryField);
+};
+
+// 128 bits of |BinaryField|, which is one of the binary tower fields from
+// |BinaryField8| to |BinaryField128|. Same as |PackedBinaryFieldGFNI|, but
+// every byte is multiplied in the AES field by pmull and reduced by pmul, and
+// mapped to the AES field by table lookups on its nibbles.
+template <typename _BinaryField>
+class TACHYON_EXPORT PackedBinaryFieldNeon final
+    : public PackedBinaryFieldBase<PackedBinaryFieldNeon<_BinaryField>> {
+ public:
+  using BinaryField = _BinaryField;
+
+  constexpr static size_t N =
+      PackedBinaryFieldTraits<PackedBinaryFieldNeon>::N;
+
+  PackedBinaryFieldNeon() = default;
+  PackedBinaryFieldNeon(const PackedBinaryFieldNeon& other) = default;
+  PackedBinaryFieldNeon& operator=(const PackedBinaryFieldNeon& other) =
+      default;
+  PackedBinaryFieldNeon(PackedBinaryFieldNeon&& other) = default;
+  PackedBinaryFieldNeon& operator=(PackedBinaryFieldNeon&& other) = default;
+
+  static void Init();
+
+  static PackedBinaryFieldNeon Zero();
+
+  static PackedBinaryFieldNeon One();
+
+  static PackedBinaryFieldNeon Broadcast(const BinaryField& value);
+
+  // AdditiveSemigroup methods
+  PackedBinaryFieldNeon Add(const PackedBinaryFieldNeon& other) const;
+
+  // MultiplicativeSemigroup methods
+  PackedBinaryFieldNeon Mul(const PackedBinaryFieldNeon& other) const;
+
+  PackedBinaryFieldNeon SquareImpl() const;
+};
+
+extern template class PackedBinaryFieldNeon<BinaryField8>;
+extern template class PackedBinaryFieldNeon<BinaryField16>;
+extern template class PackedBinaryFieldNeon<BinaryField32>;
+extern template class PackedBinaryFieldNeon<BinaryField64>;
+extern template class PackedBinaryFieldNeon<BinaryField128>;
+
+using PackedBinaryField8Neon = PackedBinaryFieldNeon<BinaryField8>;
+using PackedBinaryField16Neon = PackedBinaryFieldNeon<BinaryField16>;
+using PackedBinaryField32Neon = PackedBinaryFieldNeon<BinaryField32>;
+using PackedBinaryField64Neon = PackedBinaryFieldNeon<BinaryField64>;
+using PackedBinaryField128Neon = PackedBinaryFieldNeon<BinaryField128>;
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_NEON_H_
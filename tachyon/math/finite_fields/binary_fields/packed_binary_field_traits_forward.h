@@ -0,0 +1,11 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_TRAITS_FORWARD_H_
+#define TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_TRAITS_FORWARD_H_
+
+namespace tachyon::math {
+
+template <typename T>
+struct PackedBinaryFieldTraits;
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELD_TRAITS_FORWARD_H_
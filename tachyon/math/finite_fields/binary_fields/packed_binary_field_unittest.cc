@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/build/build_config.h"
+
+#if ARCH_CPU_X86_64
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_field_gfni.h"
+#elif ARCH_CPU_ARM64
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_field_neon.h"
+#endif
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_fields.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename PackedBinaryField>
+class PackedBinaryFieldTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PackedBinaryField::Init(); }
+};
+
+}  // namespace
+
+using PackedBinaryFieldTypes = testing::Types<
+#if ARCH_CPU_X86_64
+    PackedBinaryField8GFNI, PackedBinaryField16GFNI, PackedBinaryField32GFNI,
+    PackedBinaryField64GFNI, PackedBinaryField128GFNI
+#elif ARCH_CPU_ARM64
+    PackedBinaryField8Neon, PackedBinaryField16Neon, PackedBinaryField32Neon,
+    PackedBinaryField64Neon, PackedBinaryField128Neon
+#endif
+    >;
+
+TYPED_TEST_SUITE(PackedBinaryFieldTest, PackedBinaryFieldTypes);
+
+TYPED_TEST(PackedBinaryFieldTest, ZeroAndOne) {
+  using PackedBinaryField = TypeParam;
+
+  PackedBinaryField zero = PackedBinaryField::Zero();
+  PackedBinaryField one = PackedBinaryField::One();
+  for (size_t i = 0; i < PackedBinaryField::N; ++i) {
+    EXPECT_TRUE(zero[i].IsZero());
+    EXPECT_TRUE(one[i].IsOne());
+  }
+}
+
+TYPED_TEST(PackedBinaryFieldTest, Broadcast) {
+  using PackedBinaryField = TypeParam;
+  using BinaryField = typename PackedBinaryField::BinaryField;
+
+  BinaryField r = BinaryField::Random();
+  PackedBinaryField f = PackedBinaryField::Broadcast(r);
+  for (size_t i = 0; i < PackedBinaryField::N; ++i) {
+    EXPECT_EQ(f[i], r);
+  }
+}
+
+TYPED_TEST(PackedBinaryFieldTest, AdditiveOperators) {
+  using PackedBinaryField = TypeParam;
+
+  PackedBinaryField a = PackedBinaryField::Random();
+  PackedBinaryField b = PackedBinaryField::Random();
+  PackedBinaryField sum = a + b;
+  PackedBinaryField diff = a - b;
+  PackedBinaryField neg = -a;
+  for (size_t i = 0; i < PackedBinaryField::N; ++i) {
+    EXPECT_EQ(sum[i], a[i] + b[i]);
+    EXPECT_EQ(diff[i], a[i] - b[i]);
+    EXPECT_EQ(neg[i], -a[i]);
+  }
+  a += b;
+  EXPECT_EQ(a, sum);
+}
+
+TYPED_TEST(PackedBinaryFieldTest, Mul) {
+  using PackedBinaryField = TypeParam;
+  using BinaryField = typename PackedBinaryField::BinaryField;
+
+  PackedBinaryField a = PackedBinaryField::Random();
+  PackedBinaryField b = PackedBinaryField::Random();
+  PackedBinaryField zero = PackedBinaryField::Zero();
+  PackedBinaryField one = PackedBinaryField::One();
+  // The basis elements, among which are X of the sub-levels of the tower
+  // that are multiplied by α.
+  constexpr size_t kBits = std::min(BinaryField::kBits, size_t{64});
+  PackedBinaryField x;
+  for (size_t i = 0; i < PackedBinaryField::N; ++i) {
+    x[i] = BinaryField(uint64_t{1} << (i % kBits));
+  }
+
+  struct {
+    PackedBinaryField a;
+    PackedBinaryField b;
+  } tests[] = {
+      {a, b}, {a, zero}, {a, one}, {x, x}, {x, a},
+  };
+
+  for (auto& test : tests) {
+    PackedBinaryField c = test.a * test.b;
+    for (size_t i = 0; i < PackedBinaryField::N; ++i) {
+      EXPECT_EQ(c[i], test.a[i] * test.b[i]);
+    }
+    test.a *= test.b;
+    EXPECT_EQ(test.a, c);
+  }
+}
+
+TYPED_TEST(PackedBinaryFieldTest, Square) {
+  using PackedBinaryField = TypeParam;
+
+  PackedBinaryField a = PackedBinaryField::Random();
+  PackedBinaryField c = a.Square();
+  for (size_t i = 0; i < PackedBinaryField::N; ++i) {
+    EXPECT_EQ(c[i], a[i].Square());
+  }
+  EXPECT_EQ(c, a * a);
+}
+
+TYPED_TEST(PackedBinaryFieldTest, Inverse) {
+  using PackedBinaryField = TypeParam;
+
+  PackedBinaryField a = PackedBinaryField::Random();
+  std::optional<PackedBinaryField> c = a.Inverse();
+  for (size_t i = 0; i < PackedBinaryField::N; ++i) {
+    if (a[i].IsZero()) {
+      EXPECT_TRUE((*c)[i].IsZero());
+    } else {
+      EXPECT_EQ((*c)[i], a[i].Inverse());
+    }
+  }
+}
+
+TYPED_TEST(PackedBinaryFieldTest, BatchInverse) {
+  using PackedBinaryField = TypeParam;
+  using BinaryField = typename PackedBinaryField::BinaryField;
+
+  // Large enough to run on the lanes of |PackedBinaryField|.
+  std::vector<BinaryField> values = base::CreateVector(
+      5 * PackedBinaryField::N + 3, []() { return BinaryField::Random(); });
+  values[1] = BinaryField::Zero();
+  std::vector<BinaryField> inverses = values;
+  ASSERT_TRUE(BinaryField::BatchInverseInPlace(inverses));
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (values[i].IsZero()) {
+      EXPECT_TRUE(inverses[i].IsZero());
+    } else {
+      EXPECT_EQ(inverses[i], values[i].Inverse());
+    }
+  }
+}
+
+}  // namespace tachyon::math
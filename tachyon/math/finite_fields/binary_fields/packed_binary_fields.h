@@ -0,0 +1,60 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELDS_H_
+#define TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELDS_H_
+
+#include "tachyon/build/build_config.h"
+
+#if ARCH_CPU_X86_64
+#if defined(TACHYON_HAS_GFNI)
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_field_gfni.h"
+#endif
+#elif ARCH_CPU_ARM64
+#include "tachyon/math/finite_fields/binary_fields/packed_binary_field_neon.h"
+#endif
+#include "tachyon/math/finite_fields/finite_field_traits.h"
+
+#if (ARCH_CPU_X86_64 && defined(TACHYON_HAS_GFNI)) || ARCH_CPU_ARM64
+namespace tachyon::math {
+
+#if ARCH_CPU_X86_64
+using PackedBinaryField8 = PackedBinaryField8GFNI;
+using PackedBinaryField16 = PackedBinaryField16GFNI;
+using PackedBinaryField32 = PackedBinaryField32GFNI;
+using PackedBinaryField64 = PackedBinaryField64GFNI;
+using PackedBinaryField128 = PackedBinaryField128GFNI;
+#elif ARCH_CPU_ARM64
+using PackedBinaryField8 = PackedBinaryField8Neon;
+using PackedBinaryField16 = PackedBinaryField16Neon;
+using PackedBinaryField32 = PackedBinaryField32Neon;
+using PackedBinaryField64 = PackedBinaryField64Neon;
+using PackedBinaryField128 = PackedBinaryField128Neon;
+#endif
+
+template <>
+struct PackedFieldTraits<BinaryField8> {
+  using PackedField = PackedBinaryField8;
+};
+
+template <>
+struct PackedFieldTraits<BinaryField16> {
+  using PackedField = PackedBinaryField16;
+};
+
+template <>
+struct PackedFieldTraits<BinaryField32> {
+  using PackedField = PackedBinaryField32;
+};
+
+template <>
+struct PackedFieldTraits<BinaryField64> {
+  using PackedField = PackedBinaryField64;
+};
+
+template <>
+struct PackedFieldTraits<BinaryField128> {
+  using PackedField = PackedBinaryField128;
+};
+
+}  // namespace tachyon::math
+#endif
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_BINARY_FIELDS_PACKED_BINARY_FIELDS_H_
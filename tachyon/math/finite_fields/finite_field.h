@@ -1,9 +1,18 @@
 #ifndef TACHYON_MATH_FINITE_FIELDS_FINITE_FIELD_H_
 #define TACHYON_MATH_FINITE_FIELDS_FINITE_FIELD_H_
 
+#include <stddef.h>
+
+#include <atomic>
+#include <iterator>
+
+#include "tachyon/base/cxx20_is_constant_evaluated.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/math/base/field.h"
 #include "tachyon/math/finite_fields/finite_field_traits.h"
 #include "tachyon/math/finite_fields/square_root_algorithms/shanks.h"
+#include "tachyon/math/finite_fields/square_root_algorithms/table_tonelli_shanks.h"
 #include "tachyon/math/finite_fields/square_root_algorithms/tonelli_shanks.h"
 
 namespace tachyon::math {
@@ -25,12 +34,37 @@ class FiniteField : public Field<F> {
       return ComputeShanksSquareRoot(*static_cast<const F*>(this), ret);
     } else {
       static_assert(Config::kHasTwoAdicRootOfUnity);
+      // NOTE: The tables are built at runtime on the first use, so the loop
+      // of the textbook algorithm is left for the constant evaluation.
+      if (!base::is_constant_evaluated()) {
+        return ComputeTableTonelliShanksSquareRoot(
+            *static_cast<const F*>(this), ret);
+      }
       return ComputeTonelliShanksSquareRoot(
           *static_cast<const F*>(this),
           F::FromMontgomery(Config::kTwoAdicRootOfUnity), ret);
     }
     return false;
   }
+
+  // Finds the square roots of |values| in parallel, e.g., to decompress a
+  // batch of points. Returns false if any of them isn't a quadratic residue.
+  template <typename InputContainer, typename OutputContainer>
+  [[nodiscard]] static bool BatchSquareRoot(const InputContainer& values,
+                                            OutputContainer* roots) {
+    size_t size = std::size(values);
+    if (size != std::size(*roots)) {
+      LOG(ERROR) << "Size of |values| and |roots| do not match";
+      return false;
+    }
+    std::atomic<bool> check_valid(true);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      if (UNLIKELY(!values[i].SquareRoot(&(*roots)[i]))) {
+        check_valid.store(false, std::memory_order_relaxed);
+      }
+    }
+    return check_valid.load(std::memory_order_relaxed);
+  }
 };
 
 }  // namespace tachyon::math
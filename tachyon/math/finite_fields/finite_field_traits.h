@@ -12,6 +12,14 @@ struct FiniteFieldTraits {
   static constexpr bool kIsExtensionField = false;
 };
 
+// |PackedFieldTraits<F>::PackedField| is the packed prime field whose lanes
+// are |F|. It is specialized next to each packed prime field and is void for
+// the fields that don't have one.
+template <typename F>
+struct PackedFieldTraits {
+  using PackedField = void;
+};
+
 template <typename _Config>
 struct FiniteFieldTraits<BinaryField<_Config>> {
   static constexpr bool kIsPrimeField = false;
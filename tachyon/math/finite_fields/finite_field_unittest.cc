@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
@@ -40,4 +42,54 @@ TYPED_TEST(FiniteFieldTest, SquareRoot) {
   EXPECT_TRUE(success);
 }
 
+TYPED_TEST(FiniteFieldTest, BatchSquareRoot) {
+  using F = TypeParam;
+
+  std::vector<F> squares(100);
+  for (F& square : squares) {
+    square = F::Random().Square();
+  }
+  std::vector<F> roots(squares.size());
+  ASSERT_TRUE(F::BatchSquareRoot(squares, &roots));
+  for (size_t i = 0; i < squares.size(); ++i) {
+    EXPECT_EQ(roots[i].Square(), squares[i]);
+  }
+
+  F non_square = F::Random();
+  while (non_square.Legendre() != LegendreSymbol::kMinusOne) {
+    non_square = F::Random();
+  }
+  squares[50] = non_square;
+  EXPECT_FALSE(F::BatchSquareRoot(squares, &roots));
+}
+
+TEST(TableTonelliShanksTest, SquareRoot) {
+  using F = bn254::Fr;
+  F::Init();
+
+  // NOTE: The two-adicity of |bn254::Fr| is 28, whose lowest digit is narrower
+  // than the others.
+  static_assert(TonelliShanksTable<F>::kLowestDigitBits <
+                TonelliShanksTable<F>::kWindowBits);
+
+  F g = F::FromMontgomery(F::Config::kTwoAdicRootOfUnity);
+  for (size_t i = 0; i < 100; ++i) {
+    F a = F::Random();
+    F expected;
+    bool is_square = ComputeTonelliShanksSquareRoot(a, g, &expected);
+    F sqrt;
+    ASSERT_EQ(ComputeTableTonelliShanksSquareRoot(a, &sqrt), is_square);
+    if (is_square) {
+      EXPECT_TRUE(sqrt == expected || sqrt == -expected);
+    }
+  }
+  F sqrt;
+  ASSERT_TRUE(ComputeTableTonelliShanksSquareRoot(F::Zero(), &sqrt));
+  EXPECT_TRUE(sqrt.IsZero());
+  // g is a primitive 2²⁸-th root of unity, so it isn't a square, but g² is.
+  EXPECT_FALSE(ComputeTableTonelliShanksSquareRoot(g, &sqrt));
+  ASSERT_TRUE(ComputeTableTonelliShanksSquareRoot(g.Square(), &sqrt));
+  EXPECT_EQ(sqrt.Square(), g.Square());
+}
+
 }  // namespace tachyon::math
@@ -17,9 +17,8 @@ class Fp2 final : public QuadraticExtensionField<Fp2<Config>> {
   using BasePrimeField = typename Config::BasePrimeField;
   using FrobeniusCoefficient = typename Config::FrobeniusCoefficient;
 
-  using CpuField = Fp2<Config>;
-  // TODO(chokobole): Implements Fp2Gpu
-  using GpuField = Fp2<Config>;
+  using CpuField = Fp2<typename Config::CpuConfig>;
+  using GpuField = Fp2<typename Config::GpuConfig>;
 
   using QuadraticExtensionField<Fp2<Config>>::QuadraticExtensionField;
 
@@ -29,6 +28,14 @@ class Fp2 final : public QuadraticExtensionField<Fp2<Config>> {
   constexpr static uint64_t kDegreeOverBasePrimeField = 2;
 
   static void Init() {
+    [[maybe_unused]] static bool initialized = []() {
+      DoInit();
+      return true;
+    }();
+  }
+
+ private:
+  static void DoInit() {
     Config::Init();
 
     // αᴾ = (α₀ + α₁x)ᴾ
@@ -17,6 +17,28 @@ TEST_F(Fp2Test, TypeTest) {
   EXPECT_TRUE((std::is_same_v<bn254::Fq2::BasePrimeField, bn254::Fq>));
 }
 
+TEST_F(Fp2Test, SquareRoot) {
+  using F = bn254::Fq2;
+  using BaseField = bn254::Fq;
+
+  for (const F& a :
+       {F::Random(), F(BaseField::Random(), BaseField::Zero()),
+        F(BaseField::Zero(), BaseField::Random()), F::Zero(), F::One()}) {
+    F square = a.Square();
+    F sqrt;
+    ASSERT_TRUE(square.SquareRoot(&sqrt));
+    EXPECT_EQ(sqrt.Square(), square);
+  }
+
+  // a is a square if and only if its norm is a square over |BaseField|.
+  F non_square = F::Random();
+  while (non_square.Norm().Legendre() != LegendreSymbol::kMinusOne) {
+    non_square = F::Random();
+  }
+  F sqrt;
+  EXPECT_FALSE(non_square.SquareRoot(&sqrt));
+}
+
 TEST_F(Fp2Test, Copyable) {
   using F = bn254::Fq2;
 
@@ -30,6 +30,14 @@ class Fp3 final : public CubicExtensionField<Fp3<Config>> {
   constexpr static uint64_t kDegreeOverBasePrimeField = 3;
 
   static void Init() {
+    [[maybe_unused]] static bool initialized = []() {
+      DoInit();
+      return true;
+    }();
+  }
+
+ private:
+  static void DoInit() {
     Config::Init();
     // x³ = q = Config::kNonResidue
 
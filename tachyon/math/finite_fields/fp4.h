@@ -30,6 +30,14 @@ class Fp4 final : public QuadraticExtensionField<Fp4<Config>> {
   constexpr static uint64_t kDegreeOverBasePrimeField = 4;
 
   static void Init() {
+    [[maybe_unused]] static bool initialized = []() {
+      DoInit();
+      return true;
+    }();
+  }
+
+ private:
+  static void DoInit() {
     using BaseFieldConfig = typename BaseField::Config;
     // x⁴ = q = BaseFieldConfig::kNonResidue
 
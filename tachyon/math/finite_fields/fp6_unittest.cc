@@ -47,4 +47,15 @@ TEST_F(Fp6Test, JsonValueConverter) {
   EXPECT_EQ(value, expected);
 }
 
+TEST_F(Fp6Test, MulInPlaceBy01) {
+  using F = bn254::Fq6;
+  using Fp2 = bn254::Fq2;
+
+  F a = F::Random();
+  Fp2 beta0 = Fp2::Random();
+  Fp2 beta1 = Fp2::Random();
+  F expected = a * F(beta0, beta1, Fp2::Zero());
+  EXPECT_EQ(a.MulInPlaceBy01(beta0, beta1), expected);
+}
+
 }  // namespace tachyon::math
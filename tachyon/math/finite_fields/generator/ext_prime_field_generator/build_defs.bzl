@@ -2,6 +2,7 @@ load("//bazel:tachyon_cc.bzl", "tachyon_cc_library")
 
 def _generate_ext_prime_field_impl(ctx):
     fq_hdr_tpl_path = ctx.expand_location("$(location @kroma_network_tachyon//tachyon/math/finite_fields/generator/ext_prime_field_generator:fq.h.tpl)", [ctx.attr.fq_hdr_tpl_path])
+    fq_gpu_hdr_tpl_path = ctx.expand_location("$(location @kroma_network_tachyon//tachyon/math/finite_fields/generator/ext_prime_field_generator:fq_gpu.h.tpl)", [ctx.attr.fq_gpu_hdr_tpl_path])
 
     arguments = [
         "--out=%s" % (ctx.outputs.out.path),
@@ -12,6 +13,7 @@ def _generate_ext_prime_field_impl(ctx):
         "--base_field_hdr=%s" % (ctx.attr.base_field_hdr),
         "--base_field=%s" % (ctx.attr.base_field),
         "--fq_hdr_tpl_path=%s" % (fq_hdr_tpl_path),
+        "--fq_gpu_hdr_tpl_path=%s" % (fq_gpu_hdr_tpl_path),
     ]
 
     for non_residue in ctx.attr.non_residue:
@@ -21,7 +23,7 @@ def _generate_ext_prime_field_impl(ctx):
         arguments.append("--mul_by_non_residue_override=%s" % (ctx.attr.mul_by_non_residue_override))
 
     ctx.actions.run(
-        inputs = [ctx.files.fq_hdr_tpl_path[0]],
+        inputs = [ctx.files.fq_hdr_tpl_path[0], ctx.files.fq_gpu_hdr_tpl_path[0]],
         tools = [ctx.executable._tool],
         executable = ctx.executable._tool,
         outputs = [ctx.outputs.out],
@@ -46,6 +48,10 @@ generate_ext_prime_field = rule(
             allow_single_file = True,
             default = Label("@kroma_network_tachyon//tachyon/math/finite_fields/generator/ext_prime_field_generator:fq.h.tpl"),
         ),
+        "fq_gpu_hdr_tpl_path": attr.label(
+            allow_single_file = True,
+            default = Label("@kroma_network_tachyon//tachyon/math/finite_fields/generator/ext_prime_field_generator:fq_gpu.h.tpl"),
+        ),
         "_tool": attr.label(
             # TODO(chokobole): Change to "exec", so we can build on macos.
             cfg = "target",
@@ -67,10 +73,12 @@ def _generate_ext_prime_fields(
         base_field,
         mul_by_non_residue_override = "",
         ext_prime_field_deps = [],
+        gen_gpu = False,
         deps = [],
         **kwargs):
     for n in [
         ("{}_gen_hdr".format(name), "{}.h".format(name)),
+        ("{}_gen_gpu_hdr".format(name), "{}_gpu.h".format(name)),
     ]:
         generate_ext_prime_field(
             namespace = namespace,
@@ -94,6 +102,14 @@ def _generate_ext_prime_fields(
         **kwargs
     )
 
+    if gen_gpu:
+        tachyon_cc_library(
+            name = "{}_gpu".format(name),
+            hdrs = [":{}_gen_gpu_hdr".format(name)],
+            deps = [":{}".format(name)] + [dep + "_gpu" for dep in deps],
+            **kwargs
+        )
+
 def generate_fp2s(
         name,
         **kwargs):
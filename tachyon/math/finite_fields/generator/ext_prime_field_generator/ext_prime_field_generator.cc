@@ -13,6 +13,7 @@ namespace tachyon {
 
 struct GenerationConfig : public build::CcWriter {
   base::FilePath fq_hdr_tpl_path;
+  base::FilePath fq_gpu_hdr_tpl_path;
 
   std::string ns_name;
   std::string class_name;
@@ -27,6 +28,7 @@ struct GenerationConfig : public build::CcWriter {
   std::string GenerateMulByNonResidueCodeByDegree() const;
   std::string GenerateInitCode(bool mul_by_non_residue_fast) const;
   int GenerateConfigHdr() const;
+  int GenerateConfigGpuHdr() const;
 };
 
 std::string GenerationConfig::GenerateInitCode(
@@ -129,6 +131,23 @@ int GenerationConfig::GenerateConfigHdr() const {
   return WriteHdr(content, false);
 }
 
+int GenerationConfig::GenerateConfigGpuHdr() const {
+  absl::flat_hash_map<std::string, std::string> replacements = {
+      {"%{namespace}", ns_name},
+      {"%{class}", class_name},
+      {"%{degree}", base::NumberToString(degree)},
+      {"%{base_field}", base_field},
+      {"%{base_field_gpu_hdr}",
+       math::ConvertToGpuHdr(base::FilePath(base_field_hdr)).value()},
+      {"%{cpu_header_path}", math::ConvertToCpuHdr(GetHdrPath()).value()},
+  };
+
+  std::string tpl_content;
+  CHECK(base::ReadFileToString(fq_gpu_hdr_tpl_path, &tpl_content));
+  std::string content = absl::StrReplaceAll(tpl_content, replacements);
+  return WriteHdr(content, false);
+}
+
 int RealMain(int argc, char** argv) {
   GenerationConfig config;
   config.generator = "//tachyon/math/finite_fields/ext_prime_field_generator";
@@ -161,6 +180,9 @@ int RealMain(int argc, char** argv) {
   parser.AddFlag<base::FilePathFlag>(&config.fq_hdr_tpl_path)
       .set_long_name("--fq_hdr_tpl_path")
       .set_required();
+  parser.AddFlag<base::FilePathFlag>(&config.fq_gpu_hdr_tpl_path)
+      .set_long_name("--fq_gpu_hdr_tpl_path")
+      .set_required();
   parser.AddFlag<base::StringFlag>(&config.mul_by_non_residue_override)
       .set_long_name("--mul_by_non_residue_override");
 
@@ -170,7 +192,9 @@ int RealMain(int argc, char** argv) {
     return 1;
   }
 
-  if (base::EndsWith(config.out.value(), ".h")) {
+  if (base::EndsWith(config.out.value(), "_gpu.h")) {
+    return config.GenerateConfigGpuHdr();
+  } else if (base::EndsWith(config.out.value(), ".h")) {
     return config.GenerateConfigHdr();
   } else {
     tachyon_cerr << "suffix not supported:" << config.out << std::endl;
@@ -11,6 +11,8 @@ class %{class}Config {
   using BaseField = _BaseField;
   using BasePrimeField = %{base_prime_field};
   using FrobeniusCoefficient = %{frobenius_coefficient};
+  using CpuConfig = %{class}Config<typename BaseField::CpuField>;
+  using GpuConfig = %{class}Config<typename BaseField::GpuField>;
 %{if FrobeniusCoefficient2}
   using FrobeniusCoefficient2 = %{frobenius_coefficient};
 %{endif FrobeniusCoefficient2}
@@ -26,7 +28,7 @@ class %{class}Config {
   constexpr static uint64_t kDegreeOverBaseField = %{degree_over_base_field};
   constexpr static uint64_t kDegreeOverBasePrimeField = %{degree_over_base_prime_field};
 
-  static BaseField MulByNonResidue(const BaseField& v) {
+  constexpr static BaseField MulByNonResidue(const BaseField& v) {
 %{mul_by_non_residue_code}
   }
 
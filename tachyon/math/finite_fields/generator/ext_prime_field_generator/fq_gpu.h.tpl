@@ -0,0 +1,10 @@
+// clang-format off
+#include "%{base_field_gpu_hdr}"
+#include "%{cpu_header_path}"
+
+namespace %{namespace} {
+
+using %{class}Gpu = Fp%{degree}<%{class}Config<%{base_field}Gpu>>;
+
+}  // namespace %{namespace}
+// clang-format on
@@ -41,6 +41,7 @@ class TACHYON_EXPORT %{class}Config {
   constexpr static bool kModulusModFourIsThree = %{modulus_mod_four_is_three};
   constexpr static bool kModulusModSixIsOne = %{modulus_mod_six_is_one};
   constexpr static bool kModulusHasSpareBit = %{modulus_has_spare_bit};
+  constexpr static size_t kModulusSpareBits = %{modulus_spare_bits};
   constexpr static bool kCanUseNoCarryMulOptimization = %{can_use_no_carry_mul_optimization};
   constexpr static BigInt<%{n}> kMontgomeryR = BigInt<%{n}>({
     %{r}
@@ -197,8 +197,11 @@ int GenerationConfig::GenerateConfigHdr() const {
       math::MpzClassToString((trace - mpz_class(1)) / mpz_class(2));
 
   size_t num_bits = GetNumBits(m);
-  replacements["%{n}"] = base::NumberToString(math::gmp::GetLimbSize(m));
+  size_t limb_size = math::gmp::GetLimbSize(m);
+  replacements["%{n}"] = base::NumberToString(limb_size);
   replacements["%{modulus_bits}"] = base::NumberToString(num_bits);
+  replacements["%{modulus_spare_bits}"] =
+      base::NumberToString(64 * limb_size - num_bits);
 
   ModulusInfo modulus_info = ModulusInfo::From(m);
   replacements["%{modulus_has_spare_bit}"] =
@@ -15,17 +15,18 @@ template <size_t OpsCount = std::numeric_limits<size_t>::max(),
           bool CarryIn = false, bool CarryOut = false>
 struct CarryChain {
   size_t index = 0;
+  ptx::Carry carry;
 
   __device__ uint32_t Add(uint32_t x, uint32_t y) {
     ++index;
     if (index == 1 && OpsCount == 1 && !CarryIn && !CarryOut) {
       return ptx::u32::Add(x, y);
     } else if (index == 1 && !CarryIn) {
-      return ptx::u32::AddCc(x, y);
+      return ptx::u32::AddCc(x, y, carry);
     } else if (index < OpsCount || CarryOut) {
-      return ptx::u32::AddcCc(x, y);
+      return ptx::u32::AddcCc(x, y, carry);
     } else {
-      return ptx::u32::Addc(x, y);
+      return ptx::u32::Addc(x, y, carry);
     }
   }
 
@@ -34,11 +35,11 @@ struct CarryChain {
     if (index == 1 && OpsCount == 1 && !CarryIn && !CarryOut) {
       return ptx::u32::Sub(x, y);
     } else if (index == 1 && !CarryIn) {
-      return ptx::u32::SubCc(x, y);
+      return ptx::u32::SubCc(x, y, carry);
     } else if (index < OpsCount || CarryOut) {
-      return ptx::u32::SubcCc(x, y);
+      return ptx::u32::SubcCc(x, y, carry);
     } else {
-      return ptx::u32::Subc(x, y);
+      return ptx::u32::Subc(x, y, carry);
     }
   }
 
@@ -47,11 +48,11 @@ struct CarryChain {
     if (index == 1 && OpsCount == 1 && !CarryIn && !CarryOut) {
       return ptx::u32::MadLo(x, y, z);
     } else if (index == 1 && !CarryIn) {
-      return ptx::u32::MadLoCc(x, y, z);
+      return ptx::u32::MadLoCc(x, y, z, carry);
     } else if (index < OpsCount || CarryOut) {
-      return ptx::u32::MadcLoCc(x, y, z);
+      return ptx::u32::MadcLoCc(x, y, z, carry);
     } else {
-      return ptx::u32::MadcLo(x, y, z);
+      return ptx::u32::MadcLo(x, y, z, carry);
     }
   }
 
@@ -60,11 +61,11 @@ struct CarryChain {
     if (index == 1 && OpsCount == 1 && !CarryIn && !CarryOut) {
       return ptx::u32::MadHi(x, y, z);
     } else if (index == 1 && !CarryIn) {
-      return ptx::u32::MadHiCc(x, y, z);
+      return ptx::u32::MadHiCc(x, y, z, carry);
     } else if (index < OpsCount || CarryOut) {
-      return ptx::u32::MadcHiCc(x, y, z);
+      return ptx::u32::MadcHiCc(x, y, z, carry);
     } else {
-      return ptx::u32::MadcHi(x, y, z);
+      return ptx::u32::MadcHi(x, y, z, carry);
     }
   }
 };
@@ -77,17 +78,18 @@ template <size_t OpsCount = std::numeric_limits<size_t>::max(),
           bool CarryIn = false, bool CarryOut = false>
 struct CarryChain {
   size_t index = 0;
+  ptx::Carry carry;
 
   __device__ uint64_t Add(uint64_t x, uint64_t y) {
     ++index;
     if (index == 1 && OpsCount == 1 && !CarryIn && !CarryOut) {
       return ptx::u64::Add(x, y);
     } else if (index == 1 && !CarryIn) {
-      return ptx::u64::AddCc(x, y);
+      return ptx::u64::AddCc(x, y, carry);
     } else if (index < OpsCount || CarryOut) {
-      return ptx::u64::AddcCc(x, y);
+      return ptx::u64::AddcCc(x, y, carry);
     } else {
-      return ptx::u64::Addc(x, y);
+      return ptx::u64::Addc(x, y, carry);
     }
   }
 
@@ -96,11 +98,11 @@ struct CarryChain {
     if (index == 1 && OpsCount == 1 && !CarryIn && !CarryOut) {
       return ptx::u64::Sub(x, y);
     } else if (index == 1 && !CarryIn) {
-      return ptx::u64::SubCc(x, y);
+      return ptx::u64::SubCc(x, y, carry);
     } else if (index < OpsCount || CarryOut) {
-      return ptx::u64::SubcCc(x, y);
+      return ptx::u64::SubcCc(x, y, carry);
     } else {
-      return ptx::u64::Subc(x, y);
+      return ptx::u64::Subc(x, y, carry);
     }
   }
 
@@ -109,11 +111,11 @@ struct CarryChain {
     if (index == 1 && OpsCount == 1 && !CarryIn && !CarryOut) {
       return ptx::u64::MadLo(x, y, z);
     } else if (index == 1 && !CarryIn) {
-      return ptx::u64::MadLoCc(x, y, z);
+      return ptx::u64::MadLoCc(x, y, z, carry);
     } else if (index < OpsCount || CarryOut) {
-      return ptx::u64::MadcLoCc(x, y, z);
+      return ptx::u64::MadcLoCc(x, y, z, carry);
     } else {
-      return ptx::u64::MadcLo(x, y, z);
+      return ptx::u64::MadcLo(x, y, z, carry);
     }
   }
 
@@ -122,11 +124,11 @@ struct CarryChain {
     if (index == 1 && OpsCount == 1 && !CarryIn && !CarryOut) {
       return ptx::u64::MadHi(x, y, z);
     } else if (index == 1 && !CarryIn) {
-      return ptx::u64::MadHiCc(x, y, z);
+      return ptx::u64::MadHiCc(x, y, z, carry);
     } else if (index < OpsCount || CarryOut) {
-      return ptx::u64::MadcHiCc(x, y, z);
+      return ptx::u64::MadcHiCc(x, y, z, carry);
     } else {
-      return ptx::u64::MadcHi(x, y, z);
+      return ptx::u64::MadcHi(x, y, z, carry);
     }
   }
 };
@@ -6,7 +6,7 @@
 #include <optional>
 #include <utility>
 
-#include "third_party/gpus/cuda/include/cuda_runtime.h"
+#include "tachyon/device/gpu/gpu_runtime.h"
 
 namespace tachyon::math::kernels {
 
@@ -34,6 +34,21 @@ __global__ void Div(const T* x, const T* y, T* result, unsigned int count) {
 
 #undef DEFINE_FIELD_OP
 
+template <typename T>
+__global__ void Square(const T* x, T* result, unsigned int count) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= count) return;
+  result[gid] = x[gid].Square();
+}
+
+template <typename T>
+__global__ void SumOfTwoProducts(const T* a, const T* b, const T* c,
+                                 const T* d, T* result, unsigned int count) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= count) return;
+  result[gid] = T::SumOfTwoProducts(a[gid], b[gid], c[gid], d[gid]);
+}
+
 #define DEFINE_COMPARISON_OP(method, operator)                 \
   template <typename T>                                        \
   __global__ void method(const T* x, const T* y, bool* result, \
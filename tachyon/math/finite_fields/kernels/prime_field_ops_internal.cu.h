@@ -3,11 +3,126 @@
 
 #include <stdint.h>
 
-#include "third_party/gpus/cuda/include/cuda_runtime_api.h"
-
 #include "tachyon/base/compiler_specific.h"
+#include "tachyon/device/gpu/gpu_runtime.h"
 
 namespace tachyon::math::ptx {
+
+// |Carry| is the carry or the borrow passed along a chain of the operations
+// below, e.g., |AddCc()| followed by |AddcCc()| and |Addc()|. The operations
+// that read or write it should be called with the same |Carry| in the order of
+// the chain.
+#if TACHYON_USE_ROCM
+// NOTE: AMD GPUs have no carry flag that lives across instructions like PTX's
+// CC.CF, so the carry is kept in a register, which the compiler fuses into
+// v_add_co/v_addc_co.
+struct Carry {
+  uint32_t value = 0;
+};
+#else
+// NOTE: On CUDA, the carry is CC.CF, which the "volatile" asm statements below
+// keep in order, so |Carry| holds nothing.
+struct Carry {};
+#endif
+
+#if TACHYON_USE_ROCM
+namespace internal {
+
+template <typename T>
+__device__ ALWAYS_INLINE T AddWithCarry(T x, T y, uint32_t carry_in,
+                                        uint32_t& carry_out) {
+  T sum = x + y;
+  T result = sum + carry_in;
+  carry_out = (sum < x) | (result < sum);
+  return result;
+}
+
+template <typename T>
+__device__ ALWAYS_INLINE T SubWithBorrow(T x, T y, uint32_t borrow_in,
+                                         uint32_t& borrow_out) {
+  T diff = x - y;
+  T result = diff - borrow_in;
+  borrow_out = (x < y) | (diff < borrow_in);
+  return result;
+}
+
+__device__ ALWAYS_INLINE uint32_t MulHi(uint32_t x, uint32_t y) {
+  return __umulhi(x, y);
+}
+
+__device__ ALWAYS_INLINE uint64_t MulHi(uint64_t x, uint64_t y) {
+  return __umul64hi(x, y);
+}
+
+}  // namespace internal
+
+#define DEFINE_CARRY_OPS(T)                                                   \
+  __device__ ALWAYS_INLINE T Add(T x, T y) { return x + y; }                  \
+  __device__ ALWAYS_INLINE T AddCc(T x, T y, Carry& carry) {                  \
+    return internal::AddWithCarry<T>(x, y, 0, carry.value);                   \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T Addc(T x, T y, Carry& carry) {                   \
+    uint32_t carry_out;                                                       \
+    return internal::AddWithCarry<T>(x, y, carry.value, carry_out);           \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T AddcCc(T x, T y, Carry& carry) {                 \
+    return internal::AddWithCarry<T>(x, y, carry.value, carry.value);         \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T Sub(T x, T y) { return x - y; }                  \
+  __device__ ALWAYS_INLINE T SubCc(T x, T y, Carry& carry) {                  \
+    return internal::SubWithBorrow<T>(x, y, 0, carry.value);                  \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T Subc(T x, T y, Carry& carry) {                   \
+    uint32_t borrow_out;                                                      \
+    return internal::SubWithBorrow<T>(x, y, carry.value, borrow_out);         \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T SubcCc(T x, T y, Carry& carry) {                 \
+    return internal::SubWithBorrow<T>(x, y, carry.value, carry.value);        \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T MulLo(T x, T y) { return x * y; }                \
+  __device__ ALWAYS_INLINE T MulHi(T x, T y) { return internal::MulHi(x, y); } \
+  __device__ ALWAYS_INLINE T MadLo(T x, T y, T z) { return x * y + z; }       \
+  __device__ ALWAYS_INLINE T MadHi(T x, T y, T z) {                           \
+    return internal::MulHi(x, y) + z;                                         \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T MadLoCc(T x, T y, T z, Carry& carry) {           \
+    return AddCc(x * y, z, carry);                                            \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T MadHiCc(T x, T y, T z, Carry& carry) {           \
+    return AddCc(internal::MulHi(x, y), z, carry);                            \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T MadcLo(T x, T y, T z, Carry& carry) {            \
+    return Addc(x * y, z, carry);                                             \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T MadcHi(T x, T y, T z, Carry& carry) {            \
+    return Addc(internal::MulHi(x, y), z, carry);                             \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T MadcLoCc(T x, T y, T z, Carry& carry) {          \
+    return AddcCc(x * y, z, carry);                                           \
+  }                                                                           \
+  __device__ ALWAYS_INLINE T MadcHiCc(T x, T y, T z, Carry& carry) {          \
+    return AddcCc(internal::MulHi(x, y), z, carry);                           \
+  }
+
+namespace u32 {
+
+DEFINE_CARRY_OPS(uint32_t)
+
+__device__ ALWAYS_INLINE uint64_t MovB64(uint32_t lo, uint32_t hi) {
+  return (uint64_t{hi} << 32) | lo;
+}
+
+}  // namespace u32
+
+namespace u64 {
+
+DEFINE_CARRY_OPS(uint64_t)
+
+}  // namespace u64
+
+#undef DEFINE_CARRY_OPS
+
+#else
 namespace u32 {
 
 __device__ ALWAYS_INLINE uint32_t Add(uint32_t x, uint32_t y) {
@@ -16,19 +131,19 @@ __device__ ALWAYS_INLINE uint32_t Add(uint32_t x, uint32_t y) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t AddCc(uint32_t x, uint32_t y) {
+__device__ ALWAYS_INLINE uint32_t AddCc(uint32_t x, uint32_t y, Carry& carry) {
   uint32_t result;
   asm volatile("add.cc.u32 %0, %1, %2;" : "=r"(result) : "r"(x), "r"(y));
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t Addc(uint32_t x, uint32_t y) {
+__device__ ALWAYS_INLINE uint32_t Addc(uint32_t x, uint32_t y, Carry& carry) {
   uint32_t result;
   asm volatile("addc.u32 %0, %1, %2;" : "=r"(result) : "r"(x), "r"(y));
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t AddcCc(uint32_t x, uint32_t y) {
+__device__ ALWAYS_INLINE uint32_t AddcCc(uint32_t x, uint32_t y, Carry& carry) {
   uint32_t result;
   asm volatile("addc.cc.u32 %0, %1, %2;" : "=r"(result) : "r"(x), "r"(y));
   return result;
@@ -40,19 +155,19 @@ __device__ ALWAYS_INLINE uint32_t Sub(uint32_t x, uint32_t y) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t SubCc(uint32_t x, uint32_t y) {
+__device__ ALWAYS_INLINE uint32_t SubCc(uint32_t x, uint32_t y, Carry& carry) {
   uint32_t result;
   asm volatile("sub.cc.u32 %0, %1, %2;" : "=r"(result) : "r"(x), "r"(y));
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t Subc(uint32_t x, uint32_t y) {
+__device__ ALWAYS_INLINE uint32_t Subc(uint32_t x, uint32_t y, Carry& carry) {
   uint32_t result;
   asm volatile("subc.u32 %0, %1, %2;" : "=r"(result) : "r"(x), "r"(y));
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t SubcCc(uint32_t x, uint32_t y) {
+__device__ ALWAYS_INLINE uint32_t SubcCc(uint32_t x, uint32_t y, Carry& carry) {
   uint32_t result;
   asm volatile("subc.cc.u32 %0, %1, %2;" : "=r"(result) : "r"(x), "r"(y));
   return result;
@@ -82,7 +197,8 @@ __device__ ALWAYS_INLINE uint32_t MadHi(uint32_t x, uint32_t y, uint32_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t MadLoCc(uint32_t x, uint32_t y, uint32_t z) {
+__device__ ALWAYS_INLINE uint32_t MadLoCc(uint32_t x, uint32_t y, uint32_t z,
+                                          Carry& carry) {
   uint32_t result;
   asm volatile("mad.lo.cc.u32 %0, %1, %2, %3;"
                : "=r"(result)
@@ -90,7 +206,8 @@ __device__ ALWAYS_INLINE uint32_t MadLoCc(uint32_t x, uint32_t y, uint32_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t MadHiCc(uint32_t x, uint32_t y, uint32_t z) {
+__device__ ALWAYS_INLINE uint32_t MadHiCc(uint32_t x, uint32_t y, uint32_t z,
+                                          Carry& carry) {
   uint32_t result;
   asm volatile("mad.hi.cc.u32 %0, %1, %2, %3;"
                : "=r"(result)
@@ -98,7 +215,8 @@ __device__ ALWAYS_INLINE uint32_t MadHiCc(uint32_t x, uint32_t y, uint32_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t MadcLo(uint32_t x, uint32_t y, uint32_t z) {
+__device__ ALWAYS_INLINE uint32_t MadcLo(uint32_t x, uint32_t y, uint32_t z,
+                                         Carry& carry) {
   uint32_t result;
   asm volatile("madc.lo.u32 %0, %1, %2, %3;"
                : "=r"(result)
@@ -106,7 +224,8 @@ __device__ ALWAYS_INLINE uint32_t MadcLo(uint32_t x, uint32_t y, uint32_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t MadcHi(uint32_t x, uint32_t y, uint32_t z) {
+__device__ ALWAYS_INLINE uint32_t MadcHi(uint32_t x, uint32_t y, uint32_t z,
+                                         Carry& carry) {
   uint32_t result;
   asm volatile("madc.hi.u32 %0, %1, %2, %3;"
                : "=r"(result)
@@ -114,7 +233,8 @@ __device__ ALWAYS_INLINE uint32_t MadcHi(uint32_t x, uint32_t y, uint32_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t MadcLoCc(uint32_t x, uint32_t y, uint32_t z) {
+__device__ ALWAYS_INLINE uint32_t MadcLoCc(uint32_t x, uint32_t y, uint32_t z,
+                                           Carry& carry) {
   uint32_t result;
   asm volatile("madc.lo.cc.u32 %0, %1, %2, %3;"
                : "=r"(result)
@@ -122,7 +242,8 @@ __device__ ALWAYS_INLINE uint32_t MadcLoCc(uint32_t x, uint32_t y, uint32_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint32_t MadcHiCc(uint32_t x, uint32_t y, uint32_t z) {
+__device__ ALWAYS_INLINE uint32_t MadcHiCc(uint32_t x, uint32_t y, uint32_t z,
+                                           Carry& carry) {
   uint32_t result;
   asm volatile("madc.hi.cc.u32 %0, %1, %2, %3;"
                : "=r"(result)
@@ -146,19 +267,19 @@ __device__ ALWAYS_INLINE uint64_t Add(uint64_t x, uint64_t y) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t AddCc(uint64_t x, uint64_t y) {
+__device__ ALWAYS_INLINE uint64_t AddCc(uint64_t x, uint64_t y, Carry& carry) {
   uint64_t result;
   asm volatile("add.cc.u64 %0, %1, %2;" : "=l"(result) : "l"(x), "l"(y));
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t Addc(uint64_t x, uint64_t y) {
+__device__ ALWAYS_INLINE uint64_t Addc(uint64_t x, uint64_t y, Carry& carry) {
   uint64_t result;
   asm volatile("addc.u64 %0, %1, %2;" : "=l"(result) : "l"(x), "l"(y));
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t AddcCc(uint64_t x, uint64_t y) {
+__device__ ALWAYS_INLINE uint64_t AddcCc(uint64_t x, uint64_t y, Carry& carry) {
   uint64_t result;
   asm volatile("addc.cc.u64 %0, %1, %2;" : "=l"(result) : "l"(x), "l"(y));
   return result;
@@ -170,19 +291,19 @@ __device__ ALWAYS_INLINE uint64_t Sub(uint64_t x, uint64_t y) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t SubCc(uint64_t x, uint64_t y) {
+__device__ ALWAYS_INLINE uint64_t SubCc(uint64_t x, uint64_t y, Carry& carry) {
   uint64_t result;
   asm volatile("sub.cc.u64 %0, %1, %2;" : "=l"(result) : "l"(x), "l"(y));
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t Subc(uint64_t x, uint64_t y) {
+__device__ ALWAYS_INLINE uint64_t Subc(uint64_t x, uint64_t y, Carry& carry) {
   uint64_t result;
   asm volatile("subc.u64 %0, %1, %2;" : "=l"(result) : "l"(x), "l"(y));
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t SubcCc(uint64_t x, uint64_t y) {
+__device__ ALWAYS_INLINE uint64_t SubcCc(uint64_t x, uint64_t y, Carry& carry) {
   uint64_t result;
   asm volatile("subc.cc.u64 %0, %1, %2;" : "=l"(result) : "l"(x), "l"(y));
   return result;
@@ -212,7 +333,8 @@ __device__ ALWAYS_INLINE uint64_t MadHi(uint64_t x, uint64_t y, uint64_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t MadLoCc(uint64_t x, uint64_t y, uint64_t z) {
+__device__ ALWAYS_INLINE uint64_t MadLoCc(uint64_t x, uint64_t y, uint64_t z,
+                                          Carry& carry) {
   uint64_t result;
   asm volatile("mad.lo.cc.u64 %0, %1, %2, %3;"
                : "=l"(result)
@@ -220,7 +342,8 @@ __device__ ALWAYS_INLINE uint64_t MadLoCc(uint64_t x, uint64_t y, uint64_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t MadHiCc(uint64_t x, uint64_t y, uint64_t z) {
+__device__ ALWAYS_INLINE uint64_t MadHiCc(uint64_t x, uint64_t y, uint64_t z,
+                                          Carry& carry) {
   uint64_t result;
   asm volatile("mad.hi.cc.u64 %0, %1, %2, %3;"
                : "=l"(result)
@@ -228,7 +351,8 @@ __device__ ALWAYS_INLINE uint64_t MadHiCc(uint64_t x, uint64_t y, uint64_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t MadcLo(uint64_t x, uint64_t y, uint64_t z) {
+__device__ ALWAYS_INLINE uint64_t MadcLo(uint64_t x, uint64_t y, uint64_t z,
+                                         Carry& carry) {
   uint64_t result;
   asm volatile("madc.lo.u64 %0, %1, %2, %3;"
                : "=l"(result)
@@ -236,7 +360,8 @@ __device__ ALWAYS_INLINE uint64_t MadcLo(uint64_t x, uint64_t y, uint64_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t MadcHi(uint64_t x, uint64_t y, uint64_t z) {
+__device__ ALWAYS_INLINE uint64_t MadcHi(uint64_t x, uint64_t y, uint64_t z,
+                                         Carry& carry) {
   uint64_t result;
   asm volatile("madc.hi.u64 %0, %1, %2, %3;"
                : "=l"(result)
@@ -244,7 +369,8 @@ __device__ ALWAYS_INLINE uint64_t MadcHi(uint64_t x, uint64_t y, uint64_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t MadcLoCc(uint64_t x, uint64_t y, uint64_t z) {
+__device__ ALWAYS_INLINE uint64_t MadcLoCc(uint64_t x, uint64_t y, uint64_t z,
+                                           Carry& carry) {
   uint64_t result;
   asm volatile("madc.lo.cc.u64 %0, %1, %2, %3;"
                : "=l"(result)
@@ -252,7 +378,8 @@ __device__ ALWAYS_INLINE uint64_t MadcLoCc(uint64_t x, uint64_t y, uint64_t z) {
   return result;
 }
 
-__device__ ALWAYS_INLINE uint64_t MadcHiCc(uint64_t x, uint64_t y, uint64_t z) {
+__device__ ALWAYS_INLINE uint64_t MadcHiCc(uint64_t x, uint64_t y, uint64_t z,
+                                           Carry& carry) {
   uint64_t result;
   asm volatile("madc.hi.cc.u64 %0, %1, %2, %3;"
                : "=l"(result)
@@ -262,6 +389,7 @@ __device__ ALWAYS_INLINE uint64_t MadcHiCc(uint64_t x, uint64_t y, uint64_t z) {
 
 }  // namespace u64
 
+// NOTE: HIP has no named barriers, so these are only available on CUDA.
 __device__ ALWAYS_INLINE void BarArrive(const unsigned name,
                                         const unsigned count) {
   asm volatile("bar.arrive %0, %1;" : : "r"(name), "r"(count) : "memory");
@@ -271,6 +399,7 @@ __device__ ALWAYS_INLINE void BarSync(const unsigned name,
                                       const unsigned count) {
   asm volatile("bar.sync %0, %1;" : : "r"(name), "r"(count) : "memory");
 }
+#endif  // TACHYON_USE_ROCM
 
 }  // namespace tachyon::math::ptx
 
@@ -37,6 +37,11 @@ struct FiniteFieldTraits<PackedKoalaBear> {
   using Config = KoalaBear::Config;
 };
 
+template <>
+struct PackedFieldTraits<KoalaBear> {
+  using PackedField = PackedKoalaBear;
+};
+
 }  // namespace tachyon::math
 
 namespace Eigen {
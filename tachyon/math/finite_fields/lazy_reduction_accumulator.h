@@ -0,0 +1,121 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_LAZY_REDUCTION_ACCUMULATOR_H_
+#define TACHYON_MATH_FINITE_FIELDS_LAZY_REDUCTION_ACCUMULATOR_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
+
+namespace tachyon::math {
+namespace internal {
+
+template <typename F, typename SFINAE = void>
+struct IsLazyReducible : std::false_type {};
+
+// NOTE: |kModulusSpareBits| is only generated for the prime fields over
+// multiple 64-bit limbs in montgomery form.
+template <typename F>
+struct IsLazyReducible<
+    F, std::enable_if_t<FiniteFieldTraits<F>::kIsPrimeField &&
+                        std::is_same_v<F, typename F::CpuField> &&
+                        (F::Config::kModulusSpareBits > 0)>>
+    : std::true_type {};
+
+template <typename F, typename SFINAE = void>
+struct IsLazyReducibleQuadraticExtension : std::false_type {};
+
+template <typename Config>
+struct IsLazyReducibleQuadraticExtension<
+    Fp2<Config>,
+    std::enable_if_t<IsLazyReducible<typename Config::BaseField>::value>>
+    : std::true_type {};
+
+}  // namespace internal
+
+// Sum of products: a₁ * b₁ + a₂ * b₂ + ... + aₙ * bₙ
+//
+// By default, every product is reduced before it is added to the sum.
+template <typename F, typename SFINAE = void>
+class LazyReductionAccumulator {
+ public:
+  constexpr LazyReductionAccumulator() = default;
+
+  constexpr void AddProduct(const F& a, const F& b) { sum_ += a * b; }
+
+  constexpr F Reduce() const { return sum_; }
+
+ private:
+  F sum_ = F::Zero();
+};
+
+// If the modulus p has k spare bits, so that p < 2⁶⁴ᴺ⁻ᵏ, up to 2ᵏ double-width
+// products of the montgomery forms are summed up without a reduction. The sum
+// is below 2ᵏ * p² < p * R, where R = 2⁶⁴ᴺ, which a single montgomery
+// reduction brings back below p.
+template <typename F>
+class LazyReductionAccumulator<
+    F, std::enable_if_t<internal::IsLazyReducible<F>::value>> {
+ public:
+  constexpr static size_t N = F::N;
+  constexpr static size_t kMaxUnreducedProducts =
+      size_t{1} << std::min(F::Config::kModulusSpareBits, size_t{16});
+
+  constexpr LazyReductionAccumulator() = default;
+
+  constexpr void AddProduct(const F& a, const F& b) {
+    if (num_unreduced_products_ == kMaxUnreducedProducts) {
+      reduced_sum_ = Reduce();
+      unreduced_sum_ = BigInt<2 * N>();
+      num_unreduced_products_ = 0;
+    }
+    unreduced_sum_ += a.value().MulExtend(b.value());
+    ++num_unreduced_products_;
+  }
+
+  constexpr F Reduce() const {
+    BigInt<2 * N> unreduced_sum = unreduced_sum_;
+    BigInt<N> sum;
+    BigInt<N>::template MontgomeryReduce64<F::Config::kModulusHasSpareBit>(
+        unreduced_sum, F::Config::kModulus, F::Config::kInverse64, &sum);
+    return reduced_sum_ + F::FromMontgomery(sum);
+  }
+
+ private:
+  F reduced_sum_ = F::Zero();
+  BigInt<2 * N> unreduced_sum_;
+  size_t num_unreduced_products_ = 0;
+};
+
+// (a₀ + a₁u) * (b₀ + b₁u) = (a₀b₀ + qa₁b₁) + (a₀b₁ + a₁b₀)u, where q = u².
+// Each coordinate of the sum is accumulated in the base field, so that the
+// products of an extension over a lazily reducible prime field are reduced
+// twice in total instead of twice per product.
+template <typename F>
+class LazyReductionAccumulator<
+    F,
+    std::enable_if_t<internal::IsLazyReducibleQuadraticExtension<F>::value>> {
+ public:
+  using BaseField = typename F::BaseField;
+
+  constexpr LazyReductionAccumulator() = default;
+
+  constexpr void AddProduct(const F& a, const F& b) {
+    c0_.AddProduct(a.c0(), b.c0());
+    c0_.AddProduct(F::Config::MulByNonResidue(a.c1()), b.c1());
+    c1_.AddProduct(a.c0(), b.c1());
+    c1_.AddProduct(a.c1(), b.c0());
+  }
+
+  constexpr F Reduce() const { return F(c0_.Reduce(), c1_.Reduce()); }
+
+ private:
+  LazyReductionAccumulator<BaseField> c0_;
+  LazyReductionAccumulator<BaseField> c1_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_LAZY_REDUCTION_ACCUMULATOR_H_
@@ -0,0 +1,97 @@
+#include "tachyon/math/finite_fields/lazy_reduction_accumulator.h"
+
+#include <type_traits>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fq.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fq2.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq2.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/fq.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
+#include "tachyon/math/finite_fields/goldilocks/goldilocks_prime_field.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename PrimeField>
+class LazyReductionAccumulatorTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PrimeField::Init(); }
+};
+
+}  // namespace
+
+using PrimeFieldTypes = testing::Types<bls12_381::Fq, bn254::Fr, secp256k1::Fq,
+                                       BabyBear, Goldilocks>;
+TYPED_TEST_SUITE(LazyReductionAccumulatorTest, PrimeFieldTypes);
+
+TYPED_TEST(LazyReductionAccumulatorTest, IsLazyReducible) {
+  using F = TypeParam;
+
+  // Only the moduli with spare bits over multiple limbs can be reduced lazily.
+  constexpr bool kExpected = std::is_same_v<F, bls12_381::Fq> ||
+                             std::is_same_v<F, bn254::Fr>;
+  EXPECT_EQ(internal::IsLazyReducible<F>::value, kExpected);
+}
+
+TYPED_TEST(LazyReductionAccumulatorTest, AddProduct) {
+  using F = TypeParam;
+
+  for (size_t size : {0, 1, 4, 9, 100}) {
+    LazyReductionAccumulator<F> accumulator;
+    F expected = F::Zero();
+    for (size_t i = 0; i < size; ++i) {
+      F a = F::Random();
+      F b = F::Random();
+      accumulator.AddProduct(a, b);
+      expected += a * b;
+    }
+    EXPECT_EQ(accumulator.Reduce(), expected);
+  }
+
+  if constexpr (internal::IsLazyReducible<F>::value) {
+    // The largest products are accumulated well past
+    // |kMaxUnreducedProducts|.
+    F largest = F::FromMontgomery(F::Config::kModulus - BigInt<F::N>(1));
+    LazyReductionAccumulator<F> accumulator;
+    F expected = F::Zero();
+    for (size_t i = 0; i < 100; ++i) {
+      accumulator.AddProduct(largest, largest);
+      expected += largest * largest;
+    }
+    EXPECT_EQ(accumulator.Reduce(), expected);
+  }
+}
+
+template <typename QuadraticExtensionField>
+class QuadraticExtensionLazyReductionAccumulatorTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { QuadraticExtensionField::Init(); }
+};
+
+using QuadraticExtensionFieldTypes = testing::Types<bls12_381::Fq2, bn254::Fq2>;
+TYPED_TEST_SUITE(QuadraticExtensionLazyReductionAccumulatorTest,
+                 QuadraticExtensionFieldTypes);
+
+TYPED_TEST(QuadraticExtensionLazyReductionAccumulatorTest, AddProduct) {
+  using F = TypeParam;
+
+  static_assert(internal::IsLazyReducibleQuadraticExtension<F>::value);
+
+  for (size_t size : {0, 1, 4, 9, 100}) {
+    LazyReductionAccumulator<F> accumulator;
+    F expected = F::Zero();
+    for (size_t i = 0; i < size; ++i) {
+      F a = F::Random();
+      F b = F::Random();
+      accumulator.AddProduct(a, b);
+      expected += a * b;
+    }
+    EXPECT_EQ(accumulator.Reduce(), expected);
+  }
+}
+
+}  // namespace tachyon::math
@@ -37,6 +37,11 @@ struct FiniteFieldTraits<PackedMersenne31> {
   using Config = Mersenne31::Config;
 };
 
+template <>
+struct PackedFieldTraits<Mersenne31> {
+  using PackedField = PackedMersenne31;
+};
+
 }  // namespace tachyon::math
 
 namespace Eigen {
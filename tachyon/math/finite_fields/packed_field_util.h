@@ -0,0 +1,130 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_FIELD_UTIL_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_FIELD_UTIL_H_
+
+#include <stddef.h>
+
+#include <type_traits>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
+
+namespace tachyon::math {
+namespace internal {
+
+// An operand of |PackedPointwise()|, which is either a vector whose i-th
+// element is read at index i or a scalar broadcast to every index.
+template <typename F>
+class PointwiseOperand {
+ public:
+  using PackedField = typename PackedFieldTraits<F>::PackedField;
+  // |F| stands in for a missing |PackedField|. |PackedAt()| isn't called then.
+  using Packed =
+      std::conditional_t<std::is_void_v<PackedField>, F, PackedField>;
+
+  explicit PointwiseOperand(absl::Span<const F> values)
+      : values_(values.data()) {}
+  explicit PointwiseOperand(const F& scalar) : scalar_(scalar) {
+    if constexpr (!std::is_void_v<PackedField>) {
+      packed_scalar_ = PackedField::Broadcast(scalar);
+    }
+  }
+
+  const F& At(size_t i) const { return values_ ? values_[i] : scalar_; }
+
+  const Packed& PackedAt(size_t i) const {
+    return values_ ? reinterpret_cast<const Packed*>(values_)[i]
+                   : packed_scalar_;
+  }
+
+ private:
+  const F* values_ = nullptr;
+  F scalar_;
+  Packed packed_scalar_;
+};
+
+template <typename F, typename Fn>
+void DoPackedPointwise(absl::Span<F> out, Fn fn,
+                       const PointwiseOperand<F>&... operands) {
+  using PackedField = typename PackedFieldTraits<F>::PackedField;
+
+  size_t size = out.size();
+  if constexpr (std::is_void_v<PackedField>) {
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      out[i] = fn(operands.At(i)...);
+    }
+  } else {
+    constexpr size_t N = PackedField::N;
+
+    // NOTE: Unlike |F|, |PackedField| has constants that must be set up
+    // before its first use.
+    [[maybe_unused]] static bool packed_field_initialized = []() {
+      PackedField::Init();
+      return true;
+    }();
+
+    size_t num_packed = size / N;
+    PackedField* packed_out = reinterpret_cast<PackedField*>(out.data());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_packed; ++i) {
+      packed_out[i] = fn(operands.PackedAt(i)...);
+    }
+    for (size_t i = num_packed * N; i < size; ++i) {
+      out[i] = fn(operands.At(i)...);
+    }
+  }
+}
+
+}  // namespace internal
+
+// The functions below run on the lanes of |PackedFieldTraits<F>::PackedField|
+// and fall back to the ones of |F| if it doesn't have a packed field. Like
+// |PackedFFT|, |N| consecutive elements are reinterpreted as a single packed
+// value, and the remainder that doesn't fill a packed value is handled by |F|.
+// |PackedField::Init()| must be called before.
+
+// Sum of products: a₁ * b₁ + a₂ * b₂ + ... + aₙ * bₙ
+template <typename F>
+F PackedSumOfProducts(absl::Span<const F> a, absl::Span<const F> b) {
+  using PackedField = typename PackedFieldTraits<F>::PackedField;
+
+  CHECK_EQ(a.size(), b.size());
+  if constexpr (std::is_void_v<PackedField>) {
+    return F::SumOfProductsSerial(a, b);
+  } else {
+    constexpr size_t N = PackedField::N;
+    size_t num_packed = a.size() / N;
+    const PackedField* packed_a =
+        reinterpret_cast<const PackedField*>(a.data());
+    const PackedField* packed_b =
+        reinterpret_cast<const PackedField*>(b.data());
+    PackedField packed_sum = PackedField::Zero();
+    for (size_t i = 0; i < num_packed; ++i) {
+      packed_sum += packed_a[i] * packed_b[i];
+    }
+    F sum = F::Zero();
+    for (size_t i = 0; i < N; ++i) {
+      sum += packed_sum[i];
+    }
+    for (size_t i = num_packed * N; i < a.size(); ++i) {
+      sum += a[i] * b[i];
+    }
+    return sum;
+  }
+}
+
+// Sets |out|[i] = |fn|(|operands|[i]...) for every i, running on the packed
+// values in parallel. Each operand is either an |absl::Span<const F>| of the
+// same size as |out| or an |F|, which is broadcast. |fn| must accept both |F|
+// and |PackedField| values, e.g., a generic lambda. |out| may be one of the
+// operands. Unlike the functions above, this sets up |PackedField| itself.
+template <typename F, typename Fn, typename... Operands>
+void PackedPointwise(absl::Span<F> out, Fn fn, const Operands&... operands) {
+  internal::DoPackedPointwise<F>(out, fn,
+                                 internal::PointwiseOperand<F>(operands)...);
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_FIELD_UTIL_H_
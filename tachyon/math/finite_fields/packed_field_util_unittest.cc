@@ -0,0 +1,96 @@
+#include "tachyon/math/finite_fields/packed_field_util.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/packed_fr.h"
+#include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename F>
+class PackedFieldUtilTest
+    : public FiniteFieldTest<typename PackedFieldTraits<F>::PackedField> {};
+
+}  // namespace
+
+using PrimeFieldTypes = testing::Types<BabyBear
+#if ARCH_CPU_X86_64 && defined(TACHYON_HAS_AVX512_IFMA)
+                                       ,
+                                       bn254::Fr
+#endif
+                                       >;
+
+TYPED_TEST_SUITE(PackedFieldUtilTest, PrimeFieldTypes);
+
+TYPED_TEST(PackedFieldUtilTest, SumOfProducts) {
+  using F = TypeParam;
+  constexpr size_t N = PackedFieldTraits<F>::PackedField::N;
+
+  for (size_t size : {size_t{0}, N - 1, 4 * N, 4 * N + 3}) {
+    std::vector<F> a = base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> b = base::CreateVector(size, []() { return F::Random(); });
+    EXPECT_EQ(PackedSumOfProducts<F>(a, b), F::SumOfProductsSerial(a, b));
+  }
+}
+
+TYPED_TEST(PackedFieldUtilTest, Pointwise) {
+  using F = TypeParam;
+  constexpr size_t N = PackedFieldTraits<F>::PackedField::N;
+
+  F s = F::Random();
+  for (size_t size : {size_t{0}, N - 1, 4 * N, 4 * N + 3}) {
+    std::vector<F> a = base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> b = base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> expected = base::CreateVector(
+        size, [&a, &b, &s](size_t i) { return a[i] * s + b[i]; });
+
+    std::vector<F> out(size);
+    PackedPointwise(
+        absl::MakeSpan(out),
+        [](const auto& a, const auto& s, const auto& b) { return a * s + b; },
+        absl::MakeConstSpan(a), s, absl::MakeConstSpan(b));
+    EXPECT_EQ(out, expected);
+
+    PackedPointwise(
+        absl::MakeSpan(a),
+        [](const auto& a, const auto& s, const auto& b) { return a * s + b; },
+        absl::MakeConstSpan(a), s, absl::MakeConstSpan(b));
+    EXPECT_EQ(a, expected);
+  }
+}
+
+// NOTE: |F::BatchInverse()| runs on |PackedFieldTraits<F>::PackedField| if
+// there are enough elements.
+TYPED_TEST(PackedFieldUtilTest, BatchInverse) {
+  using F = TypeParam;
+  constexpr size_t N = PackedFieldTraits<F>::PackedField::N;
+
+  F coeff = F::Random();
+  for (size_t size : {N - 1, 2 * N, 4 * N + 3}) {
+    std::vector<F> groups = base::CreateVector(size, [](size_t i) {
+      return i % 5 == 0 ? F::Zero() : F::Random();
+    });
+    std::vector<F> expected = base::Map(groups, [&coeff](const F& g) {
+      return g.IsZero() ? F::Zero() : *g.Inverse() * coeff;
+    });
+
+    std::vector<F> inverses(size);
+    ASSERT_TRUE(F::BatchInverseSerial(groups, &inverses, coeff));
+    EXPECT_EQ(inverses, expected);
+
+    ASSERT_TRUE(F::BatchInverse(groups, &inverses, coeff));
+    EXPECT_EQ(inverses, expected);
+
+    ASSERT_TRUE(F::BatchInverseInPlace(groups, coeff));
+    EXPECT_EQ(groups, expected);
+  }
+}
+
+}  // namespace tachyon::math
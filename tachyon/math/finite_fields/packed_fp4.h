@@ -0,0 +1,286 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_FP4_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_FP4_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/strings/string_util.h"
+#include "tachyon/math/base/field.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
+
+namespace tachyon::math {
+
+// |PackedFp4| runs the arithmetic of |ExtField| on the lanes of |PackedField|,
+// which is the packed field of |BasePrimeField|. |ExtField| must be the
+// quartic extension x⁴ = q written as the tower
+//
+//   Fp2 = Fp[u] / (u² - q), Fp4 = Fp2[x] / (x² - u),
+//
+// like |BabyBear4|. Unlike the packed prime fields, the coefficients are
+// stored in the structure of arrays layout, where |values_[i]| holds the i-th
+// coefficient of |ExtField::FromBasePrimeFields()| of every lane. So a span of
+// |ExtField| can't be reinterpreted as a span of |PackedFp4| and should be
+// converted by |Pack()| and |Unpack()|.
+template <typename _ExtField>
+class PackedFp4 final : public Field<PackedFp4<_ExtField>> {
+ public:
+  using ExtField = _ExtField;
+  using BaseField = typename ExtField::BaseField;
+  using BasePrimeField = typename ExtField::BasePrimeField;
+  using PackedField = typename PackedFieldTraits<BasePrimeField>::PackedField;
+
+  constexpr static size_t N = PackedField::N;
+
+  PackedFp4() = default;
+  explicit PackedFp4(const std::array<PackedField, 4>& values)
+      : values_(values) {}
+
+  // NOTE: |ExtField::Init()| must be called before, since q is read from the
+  // config of |ExtField|.
+  static void Init() {
+    const BaseField& non_residue = ExtField::Config::kNonResidue;
+    CHECK(non_residue.c0().IsZero() && non_residue.c1().IsOne())
+        << "x² = u is expected";
+    PackedField::Init();
+    kNonResidue = PackedField::Broadcast(BaseField::Config::kNonResidue);
+  }
+
+  static PackedFp4 Zero() {
+    return PackedFp4({PackedField::Zero(), PackedField::Zero(),
+                      PackedField::Zero(), PackedField::Zero()});
+  }
+
+  static PackedFp4 One() {
+    return PackedFp4({PackedField::One(), PackedField::Zero(),
+                      PackedField::Zero(), PackedField::Zero()});
+  }
+
+  static PackedFp4 Random() {
+    return PackedFp4({PackedField::Random(), PackedField::Random(),
+                      PackedField::Random(), PackedField::Random()});
+  }
+
+  static PackedFp4 Broadcast(const ExtField& value) {
+    return PackedFp4({PackedField::Broadcast(value.c0().c0()),
+                      PackedField::Broadcast(value.c0().c1()),
+                      PackedField::Broadcast(value.c1().c0()),
+                      PackedField::Broadcast(value.c1().c1())});
+  }
+
+  // Packs |values| into the lanes, where |values.size()| must be |N|.
+  static PackedFp4 Pack(absl::Span<const ExtField> values) {
+    CHECK_EQ(values.size(), N);
+    PackedFp4 ret;
+    for (size_t i = 0; i < N; ++i) {
+      ret.values_[0][i] = values[i].c0().c0();
+      ret.values_[1][i] = values[i].c0().c1();
+      ret.values_[2][i] = values[i].c1().c0();
+      ret.values_[3][i] = values[i].c1().c1();
+    }
+    return ret;
+  }
+
+  // Unpacks the lanes into |values|, where |values.size()| must be |N|.
+  void Unpack(absl::Span<ExtField> values) const {
+    CHECK_EQ(values.size(), N);
+    for (size_t i = 0; i < N; ++i) {
+      values[i] = (*this)[i];
+    }
+  }
+
+  const std::array<PackedField, 4>& values() const { return values_; }
+  std::array<PackedField, 4>& values() { return values_; }
+
+  bool IsZero() const {
+    for (const PackedField& value : values_) {
+      if (!value.IsZero()) return false;
+    }
+    return true;
+  }
+
+  bool IsOne() const {
+    return values_[0].IsOne() && values_[1].IsZero() && values_[2].IsZero() &&
+           values_[3].IsZero();
+  }
+
+  std::string ToString() const {
+    return base::ContainerToString(base::CreateVector(
+        N, [this](size_t i) { return (*this)[i].ToString(); }));
+  }
+
+  std::string ToHexString(bool pad_zero = false) const {
+    return base::ContainerToString(
+        base::CreateVector(N, [this, pad_zero](size_t i) {
+          return (*this)[i].ToHexString(pad_zero);
+        }));
+  }
+
+  // Returns the i-th lane.
+  ExtField operator[](size_t i) const {
+    return ExtField(BaseField(values_[0][i], values_[1][i]),
+                    BaseField(values_[2][i], values_[3][i]));
+  }
+
+  bool operator==(const PackedFp4& other) const {
+    return values_ == other.values_;
+  }
+  bool operator!=(const PackedFp4& other) const {
+    return values_ != other.values_;
+  }
+
+  // AdditiveSemigroup methods
+  PackedFp4 Add(const PackedFp4& other) const {
+    PackedFp4 ret;
+    for (size_t i = 0; i < 4; ++i) {
+      ret.values_[i] = values_[i] + other.values_[i];
+    }
+    return ret;
+  }
+
+  PackedFp4& AddInPlace(const PackedFp4& other) {
+    for (size_t i = 0; i < 4; ++i) {
+      values_[i] += other.values_[i];
+    }
+    return *this;
+  }
+
+  // AdditiveGroup methods
+  PackedFp4 Sub(const PackedFp4& other) const {
+    PackedFp4 ret;
+    for (size_t i = 0; i < 4; ++i) {
+      ret.values_[i] = values_[i] - other.values_[i];
+    }
+    return ret;
+  }
+
+  PackedFp4& SubInPlace(const PackedFp4& other) {
+    for (size_t i = 0; i < 4; ++i) {
+      values_[i] -= other.values_[i];
+    }
+    return *this;
+  }
+
+  PackedFp4 Negate() const {
+    PackedFp4 ret;
+    for (size_t i = 0; i < 4; ++i) {
+      ret.values_[i] = -values_[i];
+    }
+    return ret;
+  }
+
+  PackedFp4& NegateInPlace() { return *this = Negate(); }
+
+  // MultiplicativeSemigroup methods
+  PackedFp4 Mul(const PackedFp4& other) const {
+    // (a₀ + a₁x) * (b₀ + b₁x) = a₀b₀ + a₁b₁u + ((a₀ + a₁)(b₀ + b₁) - a₀b₀ -
+    // a₁b₁)x, where every product over Fp2 is also done by Karatsuba. So it
+    // takes 9 multiplications over |PackedField| and 4 by q.
+    Fp2 a0{values_[0], values_[1]};
+    Fp2 a1{values_[2], values_[3]};
+    Fp2 b0{other.values_[0], other.values_[1]};
+    Fp2 b1{other.values_[2], other.values_[3]};
+    Fp2 v0 = Fp2Mul(a0, b0);
+    Fp2 v1 = Fp2Mul(a1, b1);
+    Fp2 c1 = Fp2Mul(Fp2Add(a0, a1), Fp2Add(b0, b1));
+    // v₁ * u = (q * v₁₁, v₁₀)
+    return PackedFp4({v0.c0 + kNonResidue * v1.c1, v0.c1 + v1.c0,
+                      c1.c0 - v0.c0 - v1.c0, c1.c1 - v0.c1 - v1.c1});
+  }
+
+  PackedFp4& MulInPlace(const PackedFp4& other) { return *this = Mul(other); }
+
+  PackedFp4 Mul(const PackedField& element) const {
+    PackedFp4 ret;
+    for (size_t i = 0; i < 4; ++i) {
+      ret.values_[i] = values_[i] * element;
+    }
+    return ret;
+  }
+
+  PackedFp4& MulInPlace(const PackedField& element) {
+    for (size_t i = 0; i < 4; ++i) {
+      values_[i] *= element;
+    }
+    return *this;
+  }
+
+  PackedFp4 SquareImpl() const {
+    // (a₀ + a₁x)² = a₀² + a₁²u + 2a₀a₁x
+    Fp2 a0{values_[0], values_[1]};
+    Fp2 a1{values_[2], values_[3]};
+    Fp2 v0 = Fp2Square(a0);
+    Fp2 v1 = Fp2Square(a1);
+    Fp2 c1 = Fp2Mul(a0, a1);
+    return PackedFp4({v0.c0 + kNonResidue * v1.c1, v0.c1 + v1.c0,
+                      c1.c0.Double(), c1.c1.Double()});
+  }
+
+  PackedFp4& SquareImplInPlace() { return *this = SquareImpl(); }
+
+  // MultiplicativeGroup methods
+  std::optional<PackedFp4> Inverse() const {
+    std::vector<ExtField> lanes(N);
+    Unpack(absl::MakeSpan(lanes));
+    CHECK(ExtField::BatchInverseInPlace(lanes));
+    return Pack(lanes);
+  }
+
+  [[nodiscard]] std::optional<PackedFp4*> InverseInPlace() {
+    *this = *Inverse();
+    return this;
+  }
+
+ private:
+  struct Fp2 {
+    PackedField c0;
+    PackedField c1;
+  };
+
+  static Fp2 Fp2Add(const Fp2& a, const Fp2& b) {
+    return {a.c0 + b.c0, a.c1 + b.c1};
+  }
+
+  // (a₀ + a₁u) * (b₀ + b₁u)
+  //   = a₀b₀ + a₁b₁q + ((a₀ + a₁)(b₀ + b₁) - a₀b₀ - a₁b₁)u
+  static Fp2 Fp2Mul(const Fp2& a, const Fp2& b) {
+    PackedField v0 = a.c0 * b.c0;
+    PackedField v1 = a.c1 * b.c1;
+    PackedField c1 = (a.c0 + a.c1) * (b.c0 + b.c1);
+    return {v0 + kNonResidue * v1, c1 - v0 - v1};
+  }
+
+  // (a₀ + a₁u)² = a₀² + a₁²q + 2a₀a₁u
+  static Fp2 Fp2Square(const Fp2& a) {
+    PackedField v = a.c0 * a.c1;
+    return {a.c0.Square() + kNonResidue * a.c1.Square(), v.Double()};
+  }
+
+  // q broadcasted to every lane.
+  static PackedField kNonResidue;
+
+  std::array<PackedField, 4> values_;
+};
+
+template <typename ExtField>
+typename PackedFp4<ExtField>::PackedField PackedFp4<ExtField>::kNonResidue;
+
+template <typename _ExtField>
+struct FiniteFieldTraits<PackedFp4<_ExtField>> {
+  static constexpr bool kIsPrimeField = false;
+  static constexpr bool kIsPackedPrimeField = false;
+  static constexpr bool kIsExtensionField = true;
+
+  using Config = typename _ExtField::Config;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_FP4_H_
@@ -0,0 +1,127 @@
+#include "tachyon/math/finite_fields/packed_fp4.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/finite_fields/baby_bear/packed_baby_bear4.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class PackedFp4Test : public testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    BabyBear4::Init();
+    PackedBabyBear4::Init();
+  }
+};
+
+}  // namespace
+
+TEST_F(PackedFp4Test, NonResidue) {
+  // x⁴ = 11
+  BabyBear4 x(BabyBear2::Zero(), BabyBear2::One());
+  EXPECT_EQ(x.Pow(4),
+            BabyBear4(BabyBear2(BabyBear(11), BabyBear::Zero()),
+                      BabyBear2::Zero()));
+}
+
+TEST_F(PackedFp4Test, ZeroAndOne) {
+  EXPECT_TRUE(PackedBabyBear4::Zero().IsZero());
+  EXPECT_TRUE(PackedBabyBear4::One().IsOne());
+  for (size_t i = 0; i < PackedBabyBear4::N; ++i) {
+    EXPECT_TRUE(PackedBabyBear4::Zero()[i].IsZero());
+    EXPECT_TRUE(PackedBabyBear4::One()[i].IsOne());
+  }
+  EXPECT_FALSE(PackedBabyBear4::Random().IsZero());
+  EXPECT_FALSE(PackedBabyBear4::Random().IsOne());
+}
+
+TEST_F(PackedFp4Test, BroadcastAndPack) {
+  BabyBear4 r = BabyBear4::Random();
+  PackedBabyBear4 f = PackedBabyBear4::Broadcast(r);
+  for (size_t i = 0; i < PackedBabyBear4::N; ++i) {
+    EXPECT_EQ(f[i], r);
+  }
+
+  std::vector<BabyBear4> values = base::CreateVector(
+      PackedBabyBear4::N, []() { return BabyBear4::Random(); });
+  PackedBabyBear4 packed = PackedBabyBear4::Pack(values);
+  std::vector<BabyBear4> unpacked(PackedBabyBear4::N);
+  packed.Unpack(absl::MakeSpan(unpacked));
+  EXPECT_EQ(unpacked, values);
+}
+
+TEST_F(PackedFp4Test, AdditiveOperators) {
+  PackedBabyBear4 a = PackedBabyBear4::Random();
+  PackedBabyBear4 b = PackedBabyBear4::Random();
+
+  PackedBabyBear4 sum = a + b;
+  PackedBabyBear4 diff = a - b;
+  PackedBabyBear4 neg = -a;
+  for (size_t i = 0; i < PackedBabyBear4::N; ++i) {
+    EXPECT_EQ(sum[i], a[i] + b[i]);
+    EXPECT_EQ(diff[i], a[i] - b[i]);
+    EXPECT_EQ(neg[i], -a[i]);
+  }
+
+  PackedBabyBear4 c = a;
+  c += b;
+  EXPECT_EQ(c, sum);
+  c = a;
+  c -= b;
+  EXPECT_EQ(c, diff);
+  c = a;
+  c.NegateInPlace();
+  EXPECT_EQ(c, neg);
+}
+
+TEST_F(PackedFp4Test, Mul) {
+  PackedBabyBear4 a = PackedBabyBear4::Random();
+  PackedBabyBear4 b = PackedBabyBear4::Random();
+
+  for (const PackedBabyBear4& c :
+       {b, PackedBabyBear4::Zero(), PackedBabyBear4::One()}) {
+    PackedBabyBear4 prod = a * c;
+    for (size_t i = 0; i < PackedBabyBear4::N; ++i) {
+      EXPECT_EQ(prod[i], a[i] * c[i]);
+    }
+    PackedBabyBear4 d = a;
+    d *= c;
+    EXPECT_EQ(d, prod);
+  }
+
+  PackedBabyBear s = PackedBabyBear::Random();
+  PackedBabyBear4 scaled = a * s;
+  for (size_t i = 0; i < PackedBabyBear4::N; ++i) {
+    EXPECT_EQ(scaled[i], a[i] * BabyBear4::FromBasePrimeFields(std::vector{
+                                    s[i], BabyBear::Zero(), BabyBear::Zero(),
+                                    BabyBear::Zero()}));
+  }
+}
+
+TEST_F(PackedFp4Test, Square) {
+  PackedBabyBear4 a = PackedBabyBear4::Random();
+  PackedBabyBear4 square = a.Square();
+  for (size_t i = 0; i < PackedBabyBear4::N; ++i) {
+    EXPECT_EQ(square[i], a[i].Square());
+  }
+  EXPECT_EQ(square, a * a);
+}
+
+TEST_F(PackedFp4Test, Inverse) {
+  PackedBabyBear4 a = PackedBabyBear4::Random();
+  EXPECT_TRUE((a * *a.Inverse()).IsOne());
+
+  std::vector<PackedBabyBear4> values = base::CreateVector(
+      4, []() { return PackedBabyBear4::Random(); });
+  std::vector<PackedBabyBear4> inverses = values;
+  ASSERT_TRUE(PackedBabyBear4::BatchInverseInPlace(inverses));
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_TRUE((values[i] * inverses[i]).IsOne());
+  }
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,249 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_IFMA_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_IFMA_H_
+
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/base/compiler_specific.h"
+
+namespace tachyon::math {
+
+// Arithmetic over 8 lanes of a prime field whose elements are |N| 64-bit
+// limbs in montgomery form, on AVX-512 IFMA.
+//
+// The lanes are split into |kNumLimbs| limbs of 52 bits and the i-th limbs of
+// all the lanes are held in a single vector, so that a vpmadd52luq and a
+// vpmadd52huq multiply the limbs of 8 lanes at once. The limbs are accumulated
+// in 64 bits without propagating the carries until the end of a
+// multiplication.
+//
+// The lanes stay in the montgomery form of the scalar field, whose R is
+// 2^(64 * |N|), whereas the montgomery multiplication over 52-bit limbs
+// divides by R' = 2^(52 * |kNumLimbs|). The left operand of |Mul()| is loaded
+// |kMulShift| bits shifted by |LoadShifted()|, which is R' / R, to cancel it
+// out.
+template <size_t N>
+class MontgomeryAVX512IFMA {
+ public:
+  constexpr static size_t kNumLimbs = (64 * N + 51) / 52;
+  constexpr static size_t kMulShift = 52 * kNumLimbs - 64 * N;
+  constexpr static uint64_t kLimbMask = (uint64_t{1} << 52) - 1;
+
+  // A sum of 2 elements must fit in the limbs.
+  static_assert(kMulShift > 0, "There must be a spare bit in the limbs");
+
+  // NOTE: This is not a |std::array|, which drops the alignment attribute of
+  // |__m512i|.
+  struct Limbs {
+    __m512i values[kNumLimbs];
+
+    ALWAYS_INLINE __m512i& operator[](size_t i) { return values[i]; }
+    ALWAYS_INLINE const __m512i& operator[](size_t i) const {
+      return values[i];
+    }
+  };
+
+  MontgomeryAVX512IFMA() = default;
+  explicit MontgomeryAVX512IFMA(const uint64_t modulus[N]) {
+    uint64_t modulus_limbs[kNumLimbs];
+    SplitLimbs(modulus, modulus_limbs);
+    for (size_t i = 0; i < kNumLimbs; ++i) {
+      modulus_[i] = _mm512_set1_epi64(modulus_limbs[i]);
+    }
+    // p⁻¹ mod 2⁶⁴ by the newton iteration, which doubles the correct bits
+    // every step starting from 1 bit of an odd p.
+    uint64_t inverse = 1;
+    for (size_t i = 0; i < 6; ++i) {
+      inverse *= 2 - modulus[0] * inverse;
+    }
+    inverse_ = _mm512_set1_epi64((0 - inverse) & kLimbMask);
+  }
+
+  // Loads 8 elements of |N| limbs laid out back to back from |elements|.
+  ALWAYS_INLINE Limbs Load(const uint64_t* elements) const {
+    return DoLoad(elements, 0);
+  }
+
+  // Same as |Load()|, but shifts the elements by |kMulShift| bits for the
+  // left operand of |Mul()|.
+  ALWAYS_INLINE Limbs LoadShifted(const uint64_t* elements) const {
+    return DoLoad(elements, kMulShift);
+  }
+
+  // Stores the 8 elements of |limbs|, which must be fully reduced, to
+  // |elements|.
+  ALWAYS_INLINE void Store(const Limbs& limbs, uint64_t* elements) const {
+    __m512i index = GetGatherIndex();
+    for (size_t k = 0; k < N; ++k) {
+      __m512i value = _mm512_setzero_si512();
+      for (size_t j = 0; j < kNumLimbs; ++j) {
+        ptrdiff_t d = static_cast<ptrdiff_t>(52 * j) -
+                      static_cast<ptrdiff_t>(64 * k);
+        if (d >= 64 || d <= -52) continue;
+        if (d >= 0) {
+          value = _mm512_or_si512(
+              value, _mm512_sllv_epi64(limbs[j], _mm512_set1_epi64(d)));
+        } else {
+          value = _mm512_or_si512(
+              value, _mm512_srlv_epi64(limbs[j], _mm512_set1_epi64(-d)));
+        }
+      }
+      _mm512_i64scatter_epi64(elements + k, index, value, 8);
+    }
+  }
+
+  ALWAYS_INLINE Limbs Add(const Limbs& lhs, const Limbs& rhs) const {
+    // lhs + rhs < 2p, which is reduced by a conditional subtraction.
+    Limbs ret;
+    __m512i carry = _mm512_setzero_si512();
+    for (size_t i = 0; i < kNumLimbs; ++i) {
+      __m512i t = _mm512_add_epi64(_mm512_add_epi64(lhs[i], rhs[i]), carry);
+      carry = _mm512_srli_epi64(t, 52);
+      ret[i] = _mm512_and_si512(t, _mm512_set1_epi64(kLimbMask));
+    }
+    return Reduce(ret);
+  }
+
+  ALWAYS_INLINE Limbs Sub(const Limbs& lhs, const Limbs& rhs) const {
+    // p is added back to the lanes where lhs - rhs borrows.
+    Limbs ret;
+    __m512i carry = _mm512_setzero_si512();
+    for (size_t i = 0; i < kNumLimbs; ++i) {
+      __m512i t = _mm512_add_epi64(_mm512_sub_epi64(lhs[i], rhs[i]), carry);
+      carry = _mm512_srai_epi64(t, 52);
+      ret[i] = _mm512_and_si512(t, _mm512_set1_epi64(kLimbMask));
+    }
+    __mmask8 borrow = _mm512_cmplt_epi64_mask(carry, _mm512_setzero_si512());
+    carry = _mm512_setzero_si512();
+    for (size_t i = 0; i < kNumLimbs; ++i) {
+      __m512i t = _mm512_add_epi64(
+          _mm512_add_epi64(ret[i], _mm512_maskz_mov_epi64(borrow, modulus_[i])),
+          carry);
+      carry = _mm512_srli_epi64(t, 52);
+      ret[i] = _mm512_and_si512(t, _mm512_set1_epi64(kLimbMask));
+    }
+    return ret;
+  }
+
+  ALWAYS_INLINE Limbs Negate(const Limbs& value) const {
+    Limbs zero;
+    for (size_t i = 0; i < kNumLimbs; ++i) {
+      zero[i] = _mm512_setzero_si512();
+    }
+    return Sub(zero, value);
+  }
+
+  // Returns |lhs| * |rhs| / R', where |lhs| must be loaded by
+  // |LoadShifted()|, which is the montgomery product of the scalar field.
+  ALWAYS_INLINE Limbs Mul(const Limbs& lhs, const Limbs& rhs) const {
+    // This is the CIOS method over 52-bit limbs. Every round adds at most 4
+    // values below 2⁵² to a limb, so the limbs never overflow 64 bits.
+    __m512i t[kNumLimbs + 1];
+    for (size_t i = 0; i <= kNumLimbs; ++i) {
+      t[i] = _mm512_setzero_si512();
+    }
+    for (size_t i = 0; i < kNumLimbs; ++i) {
+      for (size_t j = 0; j < kNumLimbs; ++j) {
+        t[j] = _mm512_madd52lo_epu64(t[j], lhs[i], rhs[j]);
+        t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], lhs[i], rhs[j]);
+      }
+      // m = t₀ * (-p⁻¹) mod 2⁵², which makes t divisible by 2⁵².
+      __m512i m =
+          _mm512_madd52lo_epu64(_mm512_setzero_si512(), t[0], inverse_);
+      for (size_t j = 0; j < kNumLimbs; ++j) {
+        t[j] = _mm512_madd52lo_epu64(t[j], m, modulus_[j]);
+        t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, modulus_[j]);
+      }
+      t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+      for (size_t j = 0; j < kNumLimbs; ++j) {
+        t[j] = t[j + 1];
+      }
+      t[kNumLimbs] = _mm512_setzero_si512();
+    }
+
+    // The product is below 2p, since lhs < R' and rhs < p.
+    Limbs ret;
+    __m512i carry = _mm512_setzero_si512();
+    for (size_t i = 0; i < kNumLimbs; ++i) {
+      __m512i sum = _mm512_add_epi64(t[i], carry);
+      carry = _mm512_srli_epi64(sum, 52);
+      ret[i] = _mm512_and_si512(sum, _mm512_set1_epi64(kLimbMask));
+    }
+    return Reduce(ret);
+  }
+
+ private:
+  // Splits a value of |N| limbs into 52-bit limbs.
+  static void SplitLimbs(const uint64_t value[N], uint64_t limbs[kNumLimbs]) {
+    for (size_t j = 0; j < kNumLimbs; ++j) {
+      size_t k = 52 * j / 64;
+      size_t r = 52 * j % 64;
+      uint64_t limb = k < N ? value[k] >> r : 0;
+      if (r > 12 && k + 1 < N) limb |= value[k + 1] << (64 - r);
+      limbs[j] = limb & kLimbMask;
+    }
+  }
+
+  // Returns the offsets of the first limbs of 8 elements in 64-bit words.
+  ALWAYS_INLINE static __m512i GetGatherIndex() {
+    return _mm512_set_epi64(7 * N, 6 * N, 5 * N, 4 * N, 3 * N, 2 * N, N, 0);
+  }
+
+  // Same as |SplitLimbs()|, but over the limbs of 8 elements at once.
+  ALWAYS_INLINE Limbs DoLoad(const uint64_t* elements, size_t shift) const {
+    __m512i index = GetGatherIndex();
+    __m512i values[N];
+    for (size_t k = 0; k < N; ++k) {
+      values[k] = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), 0xff,
+                                              index, elements + k, 8);
+    }
+    Limbs ret;
+    for (size_t j = 0; j < kNumLimbs; ++j) {
+      ptrdiff_t lo =
+          static_cast<ptrdiff_t>(52 * j) - static_cast<ptrdiff_t>(shift);
+      __m512i limb;
+      if (lo < 0) {
+        limb = _mm512_sllv_epi64(values[0], _mm512_set1_epi64(-lo));
+      } else {
+        size_t k = lo / 64;
+        size_t r = lo % 64;
+        limb = k < N ? _mm512_srlv_epi64(values[k], _mm512_set1_epi64(r))
+                     : _mm512_setzero_si512();
+        if (r > 12 && k + 1 < N) {
+          limb = _mm512_or_si512(
+              limb,
+              _mm512_sllv_epi64(values[k + 1], _mm512_set1_epi64(64 - r)));
+        }
+      }
+      ret[j] = _mm512_and_si512(limb, _mm512_set1_epi64(kLimbMask));
+    }
+    return ret;
+  }
+
+  // Subtracts p from the lanes of |value| that are not below p, where
+  // |value| must be below 2p.
+  ALWAYS_INLINE Limbs Reduce(const Limbs& value) const {
+    Limbs ret;
+    __m512i carry = _mm512_setzero_si512();
+    for (size_t i = 0; i < kNumLimbs; ++i) {
+      __m512i t =
+          _mm512_add_epi64(_mm512_sub_epi64(value[i], modulus_[i]), carry);
+      carry = _mm512_srai_epi64(t, 52);
+      ret[i] = _mm512_and_si512(t, _mm512_set1_epi64(kLimbMask));
+    }
+    __mmask8 below = _mm512_cmplt_epi64_mask(carry, _mm512_setzero_si512());
+    for (size_t i = 0; i < kNumLimbs; ++i) {
+      ret[i] = _mm512_mask_blend_epi64(below, ret[i], value[i]);
+    }
+    return ret;
+  }
+
+  Limbs modulus_;
+  // -p⁻¹ mod 2⁵²
+  __m512i inverse_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_IFMA_H_
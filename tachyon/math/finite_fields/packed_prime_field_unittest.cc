@@ -12,6 +12,9 @@
 #include "tachyon/math/finite_fields/koala_bear/packed_koala_bear_avx512.h"
 #include "tachyon/math/finite_fields/mersenne31/packed_mersenne31_avx512.h"
 #endif
+#if defined(TACHYON_HAS_AVX512_IFMA)
+#include "tachyon/math/elliptic_curves/bn/bn254/packed_fr_avx512_ifma.h"
+#endif
 #elif ARCH_CPU_ARM64
 #include "tachyon/math/finite_fields/baby_bear/packed_baby_bear_neon.h"
 #include "tachyon/math/finite_fields/koala_bear/packed_koala_bear_neon.h"
@@ -34,6 +37,10 @@ using PackedPrimeFieldTypes = testing::Types<
     ,
     PackedBabyBearAVX512, PackedMersenne31AVX512, PackedKoalaBearAVX512
 #endif
+#if defined(TACHYON_HAS_AVX512_IFMA)
+    ,
+    bn254::PackedFrAVX512IFMA
+#endif
 #elif ARCH_CPU_ARM64
     PackedBabyBearNeon, PackedMersenne31Neon, PackedKoalaBearNeon
 #endif
@@ -73,7 +80,9 @@ TYPED_TEST(PackedPrimeFieldTest, Broadcast) {
     EXPECT_EQ(f[i], r);
   }
 
-  EXPECT_EQ(f, PackedPrimeField(r.ToBigInt()[0]));
+  if constexpr (PrimeField::Config::kModulusBits <= 32) {
+    EXPECT_EQ(f, PackedPrimeField(r.ToBigInt()[0]));
+  }
 }
 
 TYPED_TEST(PackedPrimeFieldTest, Random) {
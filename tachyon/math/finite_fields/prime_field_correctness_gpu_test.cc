@@ -25,6 +25,20 @@ DEFINE_LAUNCH_FIELD_OP(Div)
 
 #undef DEFINE_LAUNCH_FIELD_OP
 
+DEFINE_LAUNCH_UNARY_OP(kThreadNum, Square, bn254::FqGpu, bn254::FqGpu)
+
+gpuError_t LaunchSumOfTwoProducts(const bn254::FqGpu* a, const bn254::FqGpu* b,
+                                  const bn254::FqGpu* c, const bn254::FqGpu* d,
+                                  bn254::FqGpu* result, size_t count) {
+  kernels::SumOfTwoProducts<<<(count - 1) / kThreadNum + 1, kThreadNum>>>(
+      a, b, c, d, result, count);
+  gpuError_t error = LOG_IF_GPU_LAST_ERROR("Failed to SumOfTwoProducts()");
+  return error == gpuSuccess
+             ? LOG_IF_GPU_ERROR(gpuDeviceSynchronize(),
+                                "Failed to gpuDeviceSynchronize()")
+             : error;
+}
+
 using namespace device;
 
 class PrimeFieldCorrectnessGpuTest : public FiniteFieldTest<bn254::Fq> {
@@ -129,4 +143,25 @@ TEST_F(PrimeFieldCorrectnessGpuTest, Div) {
 
 #undef RUN_OPERATION_TESTS
 
+TEST_F(PrimeFieldCorrectnessGpuTest, Square) {
+  GPU_MUST_SUCCESS(LaunchSquare(xs_.get(), results_.get(), N), "");
+  for (size_t i = 0; i < N; ++i) {
+    SCOPED_TRACE(absl::Substitute("a: $0", xs_[i].ToString()));
+    ASSERT_EQ(ConvertPrimeField<bn254::Fq>(results_[i]), x_cpus_[i].Square());
+  }
+}
+
+TEST_F(PrimeFieldCorrectnessGpuTest, SumOfTwoProducts) {
+  // a * b + b * b
+  GPU_MUST_SUCCESS(LaunchSumOfTwoProducts(xs_.get(), ys_.get(), ys_.get(),
+                                          ys_.get(), results_.get(), N),
+                   "");
+  for (size_t i = 0; i < N; ++i) {
+    SCOPED_TRACE(
+        absl::Substitute("a: $0, b: $1", xs_[i].ToString(), ys_[i].ToString()));
+    ASSERT_EQ(ConvertPrimeField<bn254::Fq>(results_[i]),
+              x_cpus_[i] * y_cpus_[i] + y_cpus_[i].Square());
+  }
+}
+
 }  // namespace tachyon::math
@@ -13,11 +13,8 @@
 #include <string>
 #include <utility>
 
-#if TACHYON_CUDA
-#include "third_party/gpus/cuda/include/cuda_runtime.h"
-#endif
-
 #include "tachyon/base/logging.h"
+#include "tachyon/device/gpu/gpu_runtime.h"
 #include "tachyon/math/base/arithmetics.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
@@ -155,7 +152,9 @@ class PrimeFieldGpu final : public PrimeFieldBase<PrimeFieldGpu<_Config>> {
   // tachyon/math/elliptic_curves/msm/kernels/variable_base_msm_kernels.cu.h
   __device__ constexpr uint32_t ExtractBits(unsigned int offset,
                                             unsigned int count) const {
-    unsigned int limb_index = offset / warpSize;
+    // NOTE: This is divided by the bit width of a limb, not |warpSize|, which
+    // is 64 on most AMD GPUs.
+    unsigned int limb_index = offset / 32;
     const uint32_t* x = reinterpret_cast<const uint32_t*>(value_.limbs);
     const uint32_t low_limb = x[limb_index];
     const uint32_t high_limb = limb_index < (N32 - 1) ? x[limb_index + 1] : 0;
@@ -262,6 +261,46 @@ class PrimeFieldGpu final : public PrimeFieldBase<PrimeFieldGpu<_Config>> {
     return *this;
   }
 
+  // Same as |Mul(*this)|, but every cross product xᵢ * xⱼ of the schoolbook
+  // multiplication is computed once and doubled.
+  __device__ constexpr PrimeFieldGpu SquareImpl() const {
+    static_assert(!(Config::kModulus[N - 1] >> 62));
+    BigInt<2 * N> wide;
+    SquareWideLimbs(value_, wide);
+    PrimeFieldGpu ret;
+    RedcWideLimbs(wide, ret.value_);
+    return Clamp(ret);
+  }
+
+  __device__ constexpr PrimeFieldGpu& SquareImplInPlace() {
+    *this = SquareImpl();
+    return *this;
+  }
+
+  // Returns a * b + c * d. The double-width products are added up before a
+  // single montgomery reduction, which is below 2p² < p * R, so that one
+  // reduction is saved compared to |a * b + c * d|.
+  __device__ constexpr static PrimeFieldGpu SumOfTwoProducts(
+      const PrimeFieldGpu& a, const PrimeFieldGpu& b, const PrimeFieldGpu& c,
+      const PrimeFieldGpu& d) {
+    static_assert(!(Config::kModulus[N - 1] >> 62));
+    BigInt<2 * N> ab;
+    BigInt<2 * N> cd;
+    MulWideLimbs(a.value_, b.value_, ab);
+    MulWideLimbs(c.value_, d.value_, cd);
+    uint32_t* x = reinterpret_cast<uint32_t*>(ab.limbs);
+    const uint32_t* y = reinterpret_cast<const uint32_t*>(cd.limbs);
+    ptx::Carry carry{};
+    x[0] = ptx::u32::AddCc(x[0], y[0], carry);
+    for (size_t i = 1; i < 2 * N32 - 1; ++i) {
+      x[i] = ptx::u32::AddcCc(x[i], y[i], carry);
+    }
+    x[2 * N32 - 1] = ptx::u32::Addc(x[2 * N32 - 1], y[2 * N32 - 1], carry);
+    PrimeFieldGpu ret;
+    RedcWideLimbs(ab, ret.value_);
+    return Clamp(ret);
+  }
+
   // MultiplicativeGroup methods
   __device__ constexpr std::optional<PrimeFieldGpu> Inverse() const {
     PrimeFieldGpu ret;
@@ -335,16 +374,134 @@ class PrimeFieldGpu final : public PrimeFieldBase<PrimeFieldGpu<_Config>> {
     }
 
     // merge |even| and |odd|
-    even[0] = ptx::u32::AddCc(even[0], odd[1]);
+    ptx::Carry carry{};
+    even[0] = ptx::u32::AddCc(even[0], odd[1], carry);
     for (i = 1; i < n - 1; ++i) {
-      even[i] = ptx::u32::AddcCc(even[i], odd[i + 1]);
+      even[i] = ptx::u32::AddcCc(even[i], odd[i + 1], carry);
     }
-    even[i] = ptx::u32::Addc(even[i], 0);
+    even[i] = ptx::u32::Addc(even[i], 0, carry);
 
     // final reduction from [0, 2 * mod) to [0, mod) not done here, instead
     // performed optionally in MulInPlace.
   }
 
+  // Computes the double-width product of |xs| and |ys| row by row. Every row
+  // adds the low halves of xⱼ * yᵢ in a carry chain and then the high halves
+  // in another one shifted by a limb.
+  __device__ constexpr static void MulWideLimbs(const BigInt<N>& xs,
+                                                const BigInt<N>& ys,
+                                                BigInt<2 * N>& results) {
+    constexpr size_t n = N32;
+    const uint32_t* x = reinterpret_cast<const uint32_t*>(xs.limbs);
+    const uint32_t* y = reinterpret_cast<const uint32_t*>(ys.limbs);
+    uint32_t* r = reinterpret_cast<uint32_t*>(results.limbs);
+    for (size_t i = 0; i < 2 * n; ++i) {
+      r[i] = 0;
+    }
+    ptx::Carry carry{};
+    for (size_t i = 0; i < n; ++i) {
+      r[i] = ptx::u32::MadLoCc(x[0], y[i], r[i], carry);
+      for (size_t j = 1; j < n; ++j) {
+        r[i + j] = ptx::u32::MadcLoCc(x[j], y[i], r[i + j], carry);
+      }
+      r[i + n] = ptx::u32::Addc(r[i + n], 0, carry);
+
+      r[i + 1] = ptx::u32::MadHiCc(x[0], y[i], r[i + 1], carry);
+      for (size_t j = 1; j < n - 1; ++j) {
+        r[i + j + 1] = ptx::u32::MadcHiCc(x[j], y[i], r[i + j + 1], carry);
+      }
+      if (i < n - 1) {
+        r[i + n] = ptx::u32::MadcHiCc(x[n - 1], y[i], r[i + n], carry);
+        r[i + n + 1] = ptx::u32::Addc(0, 0, carry);
+      } else {
+        r[i + n] = ptx::u32::MadcHi(x[n - 1], y[i], r[i + n], carry);
+      }
+    }
+  }
+
+  // Computes the double-width square of |xs|. The cross products xᵢ * xⱼ
+  // where i < j are added up in the same way as |MulWideLimbs()|, doubled by
+  // a carry chain and then the diagonal xᵢ² is added.
+  __device__ constexpr static void SquareWideLimbs(const BigInt<N>& xs,
+                                                   BigInt<2 * N>& results) {
+    constexpr size_t n = N32;
+    const uint32_t* x = reinterpret_cast<const uint32_t*>(xs.limbs);
+    uint32_t* r = reinterpret_cast<uint32_t*>(results.limbs);
+    for (size_t i = 0; i < 2 * n; ++i) {
+      r[i] = 0;
+    }
+    ptx::Carry carry{};
+    for (size_t i = 0; i < n - 1; ++i) {
+      r[2 * i + 1] = ptx::u32::MadLoCc(x[i + 1], x[i], r[2 * i + 1], carry);
+      for (size_t j = i + 2; j < n; ++j) {
+        r[i + j] = ptx::u32::MadcLoCc(x[j], x[i], r[i + j], carry);
+      }
+      r[i + n] = ptx::u32::Addc(r[i + n], 0, carry);
+
+      r[2 * i + 2] = ptx::u32::MadHiCc(x[i + 1], x[i], r[2 * i + 2], carry);
+      for (size_t j = i + 2; j < n; ++j) {
+        r[i + j + 1] = ptx::u32::MadcHiCc(x[j], x[i], r[i + j + 1], carry);
+      }
+      r[i + n + 1] = ptx::u32::Addc(0, 0, carry);
+    }
+
+    r[0] = ptx::u32::AddCc(r[0], r[0], carry);
+    for (size_t i = 1; i < 2 * n - 1; ++i) {
+      r[i] = ptx::u32::AddcCc(r[i], r[i], carry);
+    }
+    r[2 * n - 1] = ptx::u32::Addc(r[2 * n - 1], r[2 * n - 1], carry);
+
+    r[0] = ptx::u32::MadLoCc(x[0], x[0], r[0], carry);
+    r[1] = ptx::u32::MadcHiCc(x[0], x[0], r[1], carry);
+    for (size_t i = 1; i < n - 1; ++i) {
+      r[2 * i] = ptx::u32::MadcLoCc(x[i], x[i], r[2 * i], carry);
+      r[2 * i + 1] = ptx::u32::MadcHiCc(x[i], x[i], r[2 * i + 1], carry);
+    }
+    r[2 * n - 2] = ptx::u32::MadcLoCc(x[n - 1], x[n - 1], r[2 * n - 2], carry);
+    r[2 * n - 1] = ptx::u32::MadcHi(x[n - 1], x[n - 1], r[2 * n - 1], carry);
+  }
+
+  // Reduces a double-width value t < p * R to t * R⁻¹ in [0, 2 * mod). The
+  // low half is reduced in the same way as |MulLimbs()| multiplies it by 1,
+  // and the high half is added to it afterwards.
+  __device__ constexpr static void RedcWideLimbs(const BigInt<2 * N>& ts,
+                                                 BigInt<N>& results) {
+    constexpr size_t n = N32;
+    const uint32_t* t = reinterpret_cast<const uint32_t*>(ts.limbs);
+    uint32_t* even = reinterpret_cast<uint32_t*>(results.limbs);
+
+    ALIGNAS(8)
+    uint32_t odd[n + 1] = {
+        0,
+    };
+    for (size_t i = 0; i < n; i += 2) {
+      even[i] = t[i];
+      even[i + 1] = 0;
+      odd[i] = t[i + 1];
+      odd[i + 1] = 0;
+    }
+    size_t i;
+    for (i = 0; i < n; i += 2) {
+      RedcRow(&even[0], &odd[0], i == 0);
+      RedcRow(&odd[0], &even[0]);
+    }
+
+    // merge |even| and |odd|
+    ptx::Carry carry{};
+    even[0] = ptx::u32::AddCc(even[0], odd[1], carry);
+    for (i = 1; i < n - 1; ++i) {
+      even[i] = ptx::u32::AddcCc(even[i], odd[i + 1], carry);
+    }
+    even[i] = ptx::u32::Addc(even[i], 0, carry);
+
+    // add the high half
+    even[0] = ptx::u32::AddCc(even[0], t[n], carry);
+    for (i = 1; i < n - 1; ++i) {
+      even[i] = ptx::u32::AddcCc(even[i], t[n + i], carry);
+    }
+    even[i] = ptx::u32::Addc(even[i], t[n + i], carry);
+  }
+
   __device__ constexpr static BigInt<N> DivBy2Limbs(const BigInt<N>& xs) {
     BigInt<N> results;
     const uint32_t* x = reinterpret_cast<const uint32_t*>(xs.limbs);
@@ -373,24 +530,25 @@ class PrimeFieldGpu final : public PrimeFieldBase<PrimeFieldGpu<_Config>> {
   }
 
   __device__ constexpr static void CMadN(uint32_t* acc, const uint32_t* a,
-                                         uint32_t bi, size_t n = N32) {
-    acc[0] = ptx::u32::MadLoCc(a[0], bi, acc[0]);
-    acc[1] = ptx::u32::MadcHiCc(a[0], bi, acc[1]);
+                                         uint32_t bi, ptx::Carry& carry,
+                                         size_t n = N32) {
+    acc[0] = ptx::u32::MadLoCc(a[0], bi, acc[0], carry);
+    acc[1] = ptx::u32::MadcHiCc(a[0], bi, acc[1], carry);
     for (size_t i = 2; i < n; i += 2) {
-      acc[i] = ptx::u32::MadcLoCc(a[i], bi, acc[i]);
-      acc[i + 1] = ptx::u32::MadcHiCc(a[i], bi, acc[i + 1]);
+      acc[i] = ptx::u32::MadcLoCc(a[i], bi, acc[i], carry);
+      acc[i + 1] = ptx::u32::MadcHiCc(a[i], bi, acc[i + 1], carry);
     }
   }
 
   __device__ constexpr static void MadcNRshift(uint32_t* odd, const uint32_t* a,
-                                               uint32_t bi) {
+                                               uint32_t bi, ptx::Carry& carry) {
     constexpr uint32_t n = N32;
     for (size_t i = 0; i < n - 2; i += 2) {
-      odd[i] = ptx::u32::MadcLoCc(a[i], bi, odd[i + 2]);
-      odd[i + 1] = ptx::u32::MadcHiCc(a[i], bi, odd[i + 3]);
+      odd[i] = ptx::u32::MadcLoCc(a[i], bi, odd[i + 2], carry);
+      odd[i + 1] = ptx::u32::MadcHiCc(a[i], bi, odd[i + 3], carry);
     }
-    odd[n - 2] = ptx::u32::MadcLoCc(a[n - 2], bi, 0);
-    odd[n - 1] = ptx::u32::MadcHi(a[n - 2], bi, 0);
+    odd[n - 2] = ptx::u32::MadcLoCc(a[n - 2], bi, 0, carry);
+    odd[n - 1] = ptx::u32::MadcHi(a[n - 2], bi, 0, carry);
   }
 
   __device__ constexpr static void MadNRedc(uint32_t* even, uint32_t* odd,
@@ -399,19 +557,42 @@ class PrimeFieldGpu final : public PrimeFieldBase<PrimeFieldGpu<_Config>> {
     constexpr uint32_t n = N32;
     const uint32_t* const modulus =
         reinterpret_cast<const uint32_t* const>(GetModulus().limbs);
+    ptx::Carry carry{};
     if (first) {
       MulN(odd, a + 1, bi);
       MulN(even, a, bi);
     } else {
-      even[0] = ptx::u32::AddCc(even[0], odd[1]);
-      MadcNRshift(odd, a + 1, bi);
-      CMadN(even, a, bi);
-      odd[n - 1] = ptx::u32::Addc(odd[n - 1], 0);
+      even[0] = ptx::u32::AddCc(even[0], odd[1], carry);
+      MadcNRshift(odd, a + 1, bi, carry);
+      CMadN(even, a, bi, carry);
+      odd[n - 1] = ptx::u32::Addc(odd[n - 1], 0, carry);
+    }
+    uint32_t mi = even[0] * Config::kInverse32;
+    CMadN(odd, modulus + 1, mi, carry);
+    CMadN(even, modulus, mi, carry);
+    odd[n - 1] = ptx::u32::Addc(odd[n - 1], 0, carry);
+  }
+
+  // Same as |MadNRedc()| where |bi| is 0, so the multiplications by |bi| are
+  // reduced to shifting |odd| by 2 limbs.
+  __device__ constexpr static void RedcRow(uint32_t* even, uint32_t* odd,
+                                           bool first = false) {
+    constexpr uint32_t n = N32;
+    const uint32_t* const modulus =
+        reinterpret_cast<const uint32_t* const>(GetModulus().limbs);
+    ptx::Carry carry{};
+    if (!first) {
+      even[0] = ptx::u32::AddCc(even[0], odd[1], carry);
+      for (size_t i = 0; i < n - 2; ++i) {
+        odd[i] = ptx::u32::AddcCc(odd[i + 2], 0, carry);
+      }
+      odd[n - 2] = ptx::u32::AddcCc(0, 0, carry);
+      odd[n - 1] = ptx::u32::Addc(0, 0, carry);
     }
     uint32_t mi = even[0] * Config::kInverse32;
-    CMadN(odd, modulus + 1, mi);
-    CMadN(even, modulus, mi);
-    odd[n - 1] = ptx::u32::Addc(odd[n - 1], 0);
+    CMadN(odd, modulus + 1, mi, carry);
+    CMadN(even, modulus, mi, carry);
+    odd[n - 1] = ptx::u32::Addc(odd[n - 1], 0, carry);
   }
 
   __device__ constexpr static PrimeFieldGpu Clamp(PrimeFieldGpu& xs) {
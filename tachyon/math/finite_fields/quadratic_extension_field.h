@@ -16,6 +16,7 @@
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/json/json.h"
 #include "tachyon/math/finite_fields/cyclotomic_multiplicative_subgroup.h"
+#include "tachyon/math/finite_fields/square_root_algorithms/quadratic_extension_square_root.h"
 #include "tachyon/math/geometry/point2.h"
 
 namespace tachyon {
@@ -88,6 +89,13 @@ class QuadraticExtensionField
     return c0_.Square() - Config::MulByNonResidue(c1_.Square());
   }
 
+  // NOTE: This hides |FiniteField::SquareRoot()|, which is only for the prime
+  // fields.
+  constexpr bool SquareRoot(Derived* ret) const {
+    return ComputeQuadraticExtensionSquareRoot(
+        *static_cast<const Derived*>(this), ret);
+  }
+
   constexpr Derived& FrobeniusMapInPlace(uint64_t exponent) {
     c0_.FrobeniusMapInPlace(exponent);
     c1_.FrobeniusMapInPlace(exponent);
@@ -0,0 +1,58 @@
+// Copyright 2022 arkworks contributors
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
+// file.
+
+#ifndef TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_QUADRATIC_EXTENSION_SQUARE_ROOT_H_
+#define TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_QUADRATIC_EXTENSION_SQUARE_ROOT_H_
+
+#include <utility>
+
+namespace tachyon::math {
+
+// Finds x = x₀ + x₁u such that x² = a, where a = a₀ + a₁u and u² = β, by
+// reducing it to the square roots over the base field.
+// See https://eprint.iacr.org/2012/685.pdf
+template <typename F>
+constexpr bool ComputeQuadraticExtensionSquareRoot(const F& a, F* ret) {
+  using BaseField = typename F::BaseField;
+
+  if (a.c1().IsZero()) {
+    // If a₀ is a quadratic residue, x = √a₀. Otherwise, a₀ / β is, since β is
+    // a quadratic non-residue, and x = √(a₀ / β) * u.
+    BaseField x;
+    if (a.c0().SquareRoot(&x)) {
+      *ret = F(std::move(x), BaseField::Zero());
+      return true;
+    }
+    BaseField c0 = a.c0() * *F::Config::kNonResidue.Inverse();
+    if (!c0.SquareRoot(&x)) return false;
+    *ret = F(BaseField::Zero(), std::move(x));
+    return true;
+  }
+
+  // x² = x₀² + βx₁² + 2x₀x₁u = a₀ + a₁u, so that
+  //   x₀² - βx₁² = α, where α² = a₀² - βa₁² is the norm of a,
+  //   x₀² = (a₀ ± α) / 2,
+  //   x₁ = a₁ / 2x₀.
+  BaseField alpha;
+  if (!a.Norm().SquareRoot(&alpha)) return false;
+  BaseField two_inv = *BaseField(2).Inverse();
+  BaseField delta = (a.c0() + alpha) * two_inv;
+  BaseField x0;
+  if (!delta.SquareRoot(&x0)) {
+    delta -= alpha;
+    if (!delta.SquareRoot(&x0)) return false;
+  }
+  BaseField x1 = a.c1() * two_inv * *x0.Inverse();
+  F x(std::move(x0), std::move(x1));
+  if (x.Square() == a) {
+    *ret = std::move(x);
+    return true;
+  }
+  return false;
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_QUADRATIC_EXTENSION_SQUARE_ROOT_H_
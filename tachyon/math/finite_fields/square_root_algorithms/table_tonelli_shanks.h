@@ -0,0 +1,151 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_TABLE_TONELLI_SHANKS_H_
+#define TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_TABLE_TONELLI_SHANKS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/optional.h"
+
+namespace tachyon::math {
+
+// |TonelliShanksTable| holds the tables of the 2ˢ-th root of unity g, with
+// which the discrete logarithm of aᵀ to the base g is found w bits at a time.
+// See https://eprint.iacr.org/2020/1407.pdf.
+//
+// The exponent e of aᵀ = gᵉ is split into n = ⌈s / w⌉ digits dᵢ at the bit
+// offsets oᵢ, where the lowest one is r = s - (n - 1) * w bits wide and the
+// others are w bits wide. With bₖ = (aᵀ)^(2ᵏʷ), the i-th digit is looked up by
+//
+//   γ^(dᵢ) = b_(n - 1 - i) * Π{l < i} g^(-dₗ * 2^(oₗ + (n - 1 - i) * w)),
+//
+// where γ = g^(2ˢ⁻ʷ), so that s squarings and O(n²) multiplications replace
+// the O(s²) squarings of |ComputeTonelliShanksSquareRoot()|.
+template <typename F>
+class TonelliShanksTable {
+ public:
+  constexpr static uint32_t kTwoAdicity = F::Config::kTwoAdicity;
+  constexpr static uint32_t kWindowBits = std::min(kTwoAdicity, uint32_t{8});
+  constexpr static uint32_t kNumDigits =
+      (kTwoAdicity + kWindowBits - 1) / kWindowBits;
+  // The width of the lowest digit.
+  constexpr static uint32_t kLowestDigitBits =
+      kTwoAdicity - (kNumDigits - 1) * kWindowBits;
+
+  static const TonelliShanksTable& GetInstance() {
+    static base::NoDestructor<TonelliShanksTable> table;
+    return *table;
+  }
+
+  TonelliShanksTable(const TonelliShanksTable& other) = delete;
+  TonelliShanksTable& operator=(const TonelliShanksTable& other) = delete;
+
+  // Returns false if |a| isn't a quadratic residue.
+  bool SquareRoot(const F& a, F* ret) const {
+    if (a.IsZero()) {
+      *ret = F::Zero();
+      return true;
+    }
+
+    // v = a^((T - 1) / 2), x = a^((T + 1) / 2) and aᵀ = xv
+    F v = a.Pow(F::Config::kTraceMinusOneDivTwo);
+    F x = a * v;
+    F b[kNumDigits];
+    b[0] = x * v;
+    for (uint32_t k = 1; k < kNumDigits; ++k) {
+      b[k] = b[k - 1];
+      for (uint32_t i = 0; i < kWindowBits; ++i) {
+        b[k].SquareInPlace();
+      }
+    }
+
+    uint32_t digits[kNumDigits];
+    for (uint32_t i = 0; i < kNumDigits; ++i) {
+      uint32_t shift = (kNumDigits - 1 - i) * kWindowBits;
+      F gamma_digit = b[kNumDigits - 1 - i];
+      for (uint32_t l = 0; l < i; ++l) {
+        gamma_digit *= inv_powers_[GetOffset(l) + shift][digits[l]];
+      }
+      auto it = gamma_logs_.find(gamma_digit);
+      if (UNLIKELY(it == gamma_logs_.end())) return false;
+      digits[i] = i == 0 ? it->second >> (kWindowBits - kLowestDigitBits)
+                         : it->second;
+    }
+
+    // The exponent e is odd if and only if aᵀ is a primitive 2ˢ-th root of
+    // unity, which means that a isn't a quadratic residue.
+    if (digits[0] % 2 != 0) return false;
+
+    // √a = x * g^(-e / 2)
+    x *= inv_powers_[0][digits[0] / 2];
+    for (uint32_t l = 1; l < kNumDigits; ++l) {
+      x *= inv_powers_[GetOffset(l) - 1][digits[l]];
+    }
+    DCHECK_EQ(x.Square(), a);
+    *ret = std::move(x);
+    return true;
+  }
+
+ private:
+  friend class base::NoDestructor<TonelliShanksTable>;
+
+  TonelliShanksTable() {
+    F g = F::FromMontgomery(F::Config::kTwoAdicRootOfUnity);
+    F gamma = g;
+    for (uint32_t i = 0; i < kTwoAdicity - kWindowBits; ++i) {
+      gamma.SquareInPlace();
+    }
+    std::vector<F> gamma_powers =
+        F::GetSuccessivePowers(size_t{1} << kWindowBits, gamma);
+    gamma_logs_.reserve(gamma_powers.size());
+    for (uint32_t j = 0; j < gamma_powers.size(); ++j) {
+      gamma_logs_[gamma_powers[j]] = j;
+    }
+
+    // Only g^(-j * 2ᵐ) of the m used by |SquareRoot()| are computed.
+    std::vector<bool> used(kTwoAdicity, false);
+    used[0] = true;
+    for (uint32_t i = 1; i < kNumDigits; ++i) {
+      used[GetOffset(i) - 1] = true;
+      for (uint32_t l = 0; l < i; ++l) {
+        used[GetOffset(l) + (kNumDigits - 1 - i) * kWindowBits] = true;
+      }
+    }
+    F g_inv_pow = unwrap(g.Inverse());
+    inv_powers_.resize(kTwoAdicity);
+    for (uint32_t m = 0; m < kTwoAdicity; ++m) {
+      if (used[m]) {
+        inv_powers_[m] =
+            F::GetSuccessivePowers(size_t{1} << kWindowBits, g_inv_pow);
+      }
+      g_inv_pow.SquareInPlace();
+    }
+  }
+
+  // Returns the bit offset of the i-th digit.
+  constexpr static uint32_t GetOffset(uint32_t i) {
+    return i == 0 ? 0 : kLowestDigitBits + (i - 1) * kWindowBits;
+  }
+
+  // γʲ → j
+  absl::flat_hash_map<F, uint32_t> gamma_logs_;
+  // |inv_powers_[m][j]| = g^(-j * 2ᵐ), which is empty if it isn't used.
+  std::vector<std::vector<F>> inv_powers_;
+};
+
+// Finds x such that x² = |a| by the tables above.
+template <typename F>
+bool ComputeTableTonelliShanksSquareRoot(const F& a, F* ret) {
+  return TonelliShanksTable<F>::GetInstance().SquareRoot(a, ret);
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_TABLE_TONELLI_SHANKS_H_
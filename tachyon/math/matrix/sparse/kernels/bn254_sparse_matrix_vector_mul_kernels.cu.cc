@@ -0,0 +1,10 @@
+#include "tachyon/math/matrix/sparse/kernels/bn254_sparse_matrix_vector_mul_kernels.cu.h"
+
+namespace tachyon::math::kernels {
+
+template __global__ void ELLSparseMatrixVectorMul<bn254::FrGpu>(
+    const bn254::FrGpu* values, const unsigned int* col_indices,
+    unsigned int rows, unsigned int width, const bn254::FrGpu* vector,
+    bn254::FrGpu* results);
+
+}  // namespace tachyon::math::kernels
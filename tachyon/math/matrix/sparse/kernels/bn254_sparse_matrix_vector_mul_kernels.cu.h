@@ -0,0 +1,16 @@
+#ifndef TACHYON_MATH_MATRIX_SPARSE_KERNELS_BN254_SPARSE_MATRIX_VECTOR_MUL_KERNELS_CU_H_
+#define TACHYON_MATH_MATRIX_SPARSE_KERNELS_BN254_SPARSE_MATRIX_VECTOR_MUL_KERNELS_CU_H_
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr_gpu.h"
+#include "tachyon/math/matrix/sparse/kernels/sparse_matrix_vector_mul_kernels.cu.h"
+
+namespace tachyon::math::kernels {
+
+extern template __global__ void ELLSparseMatrixVectorMul<bn254::FrGpu>(
+    const bn254::FrGpu* values, const unsigned int* col_indices,
+    unsigned int rows, unsigned int width, const bn254::FrGpu* vector,
+    bn254::FrGpu* results);
+
+}  // namespace tachyon::math::kernels
+
+#endif  // TACHYON_MATH_MATRIX_SPARSE_KERNELS_BN254_SPARSE_MATRIX_VECTOR_MUL_KERNELS_CU_H_
@@ -0,0 +1,37 @@
+#ifndef TACHYON_MATH_MATRIX_SPARSE_KERNELS_SPARSE_MATRIX_VECTOR_MUL_KERNELS_CU_H_
+#define TACHYON_MATH_MATRIX_SPARSE_KERNELS_SPARSE_MATRIX_VECTOR_MUL_KERNELS_CU_H_
+
+#include <limits>
+
+#include "tachyon/device/gpu/gpu_runtime.h"
+
+namespace tachyon::math::kernels {
+
+// The column index of the padding of a row shorter than the width of the ELL
+// layout.
+constexpr unsigned int kELLPadding = std::numeric_limits<unsigned int>::max();
+
+// Computes |results| = M * |vector|, where the |rows| x |width| ELL layout of
+// M is stored column by column, i.e., the k-th element of the i-th row is at
+// k * |rows| + i, so that the threads of a warp read consecutive addresses.
+// Each thread computes a row and stops at the first padding.
+template <typename F>
+__global__ void ELLSparseMatrixVectorMul(const F* values,
+                                         const unsigned int* col_indices,
+                                         unsigned int rows, unsigned int width,
+                                         const F* vector, F* results) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= rows) return;
+  F sum = F::Zero();
+  for (unsigned int k = 0; k < width; ++k) {
+    unsigned int idx = k * rows + gid;
+    unsigned int col = col_indices[idx];
+    if (col == kELLPadding) break;
+    sum += values[idx] * vector[col];
+  }
+  results[gid] = sum;
+}
+
+}  // namespace tachyon::math::kernels
+
+#endif  // TACHYON_MATH_MATRIX_SPARSE_KERNELS_SPARSE_MATRIX_VECTOR_MUL_KERNELS_CU_H_
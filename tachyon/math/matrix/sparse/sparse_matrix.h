@@ -228,6 +228,7 @@ class CSRSparseMatrix {
     return matrix.ToCSR();
   }
 
+  const Elements& elements() const { return elements_; }
   const std::vector<size_t>& row_ptrs() const { return row_ptrs_; }
 
   std::vector<T> GetData() const {
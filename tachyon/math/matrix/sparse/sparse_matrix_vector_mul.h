@@ -0,0 +1,101 @@
+#ifndef TACHYON_MATH_MATRIX_SPARSE_SPARSE_MATRIX_VECTOR_MUL_H_
+#define TACHYON_MATH_MATRIX_SPARSE_SPARSE_MATRIX_VECTOR_MUL_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/matrix/sparse/sparse_matrix.h"
+
+namespace tachyon::math {
+
+namespace internal {
+
+// The number of row blocks per thread. More blocks than threads let the
+// threads that finish early take the remaining blocks.
+constexpr size_t kSpMVBlocksPerThread = 4;
+
+// Returns the starts of the row blocks of the first |rows| rows, followed by
+// |rows|. The blocks hold about the same number of nonzeros rather than the
+// same number of rows, since a few long rows, e.g., the linear combinations of
+// an R1CS, would otherwise keep a thread busy while the others idle.
+inline std::vector<size_t> ComputeRowBlocks(
+    const std::vector<size_t>& row_ptrs, size_t rows, size_t num_blocks) {
+  std::vector<size_t> starts;
+  starts.reserve(num_blocks + 1);
+  starts.push_back(0);
+  size_t nnz = row_ptrs[rows];
+  for (size_t i = 1; i < num_blocks; ++i) {
+    // The first row that starts at or after i / |num_blocks| of the nonzeros.
+    size_t row = static_cast<size_t>(
+        std::lower_bound(row_ptrs.begin(), row_ptrs.begin() + rows,
+                         nnz / num_blocks * i) -
+        row_ptrs.begin());
+    if (row > starts.back()) starts.push_back(row);
+  }
+  starts.push_back(rows);
+  return starts;
+}
+
+}  // namespace internal
+
+// Computes the first |results.size()| elements of |matrix| * |vector|, i.e.,
+// |results[i]| = Σⱼ (Mᵢ,ⱼ * vⱼ). The rows are split into blocks of about the
+// same number of nonzeros, each of which is computed on a single thread by
+// walking the contiguous elements of the CSR layout. The products by 1, which
+// are common in an R1CS, are replaced with additions.
+template <typename T>
+void SparseMatrixVectorMul(const CSRSparseMatrix<T>& matrix,
+                           absl::Span<const T> vector, absl::Span<T> results) {
+  using Element = typename CSRSparseMatrix<T>::Element;
+
+  size_t rows = results.size();
+  CHECK_LE(rows, matrix.MaxRows());
+  if (rows == 0) return;
+  const std::vector<Element>& elements = matrix.elements();
+  const std::vector<size_t>& row_ptrs = matrix.row_ptrs();
+
+#if defined(TACHYON_HAS_OPENMP)
+  size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+  size_t thread_nums = 1;
+#endif
+  std::vector<size_t> starts = internal::ComputeRowBlocks(
+      row_ptrs, rows,
+      std::min(rows, thread_nums * internal::kSpMVBlocksPerThread));
+  size_t num_blocks = starts.size() - 1;
+  OPENMP_PARALLEL_FOR(size_t b = 0; b < num_blocks; ++b) {
+    for (size_t i = starts[b]; i < starts[b + 1]; ++i) {
+      T sum = T::Zero();
+      for (size_t j = row_ptrs[i]; j < row_ptrs[i + 1]; ++j) {
+        const Element& element = elements[j];
+        DCHECK_LT(element.index, vector.size());
+        if (element.value.IsOne()) {
+          sum += vector[element.index];
+        } else {
+          sum += vector[element.index] * element.value;
+        }
+      }
+      results[i] = std::move(sum);
+    }
+  }
+}
+
+// Same as above, but returns all the rows of |matrix| * |vector|.
+template <typename T>
+std::vector<T> SparseMatrixVectorMul(const CSRSparseMatrix<T>& matrix,
+                                     absl::Span<const T> vector) {
+  std::vector<T> results(matrix.MaxRows());
+  SparseMatrixVectorMul(matrix, vector, absl::MakeSpan(results));
+  return results;
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_MATRIX_SPARSE_SPARSE_MATRIX_VECTOR_MUL_H_
@@ -0,0 +1,125 @@
+// This header defines |SparseMatrixVectorMulGpu|, which multiplies a sparse
+// matrix resident on the GPU by dense vectors on the device.
+
+#ifndef TACHYON_MATH_MATRIX_SPARSE_SPARSE_MATRIX_VECTOR_MUL_GPU_H_
+#define TACHYON_MATH_MATRIX_SPARSE_SPARSE_MATRIX_VECTOR_MUL_GPU_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/matrix/sparse/kernels/sparse_matrix_vector_mul_kernels.cu.h"
+#include "tachyon/math/matrix/sparse/sparse_matrix.h"
+
+namespace tachyon::math {
+
+// |SparseMatrixVectorMulGpu| uploads a matrix in the ELL layout, where every
+// row is padded to the length of the longest one, so that a thread computes a
+// row with coalesced reads. This suits the matrices whose rows have similar
+// lengths, like the ones of an R1CS, and the matrix is uploaded once to be
+// multiplied by many vectors, e.g., the witnesses of many proofs.
+template <typename F>
+class SparseMatrixVectorMulGpu {
+ public:
+  using GpuField = typename F::GpuField;
+
+  constexpr static unsigned int kThreadNum = 256;
+
+  explicit SparseMatrixVectorMulGpu(gpuStream_t stream = nullptr)
+      : stream_(stream) {}
+  SparseMatrixVectorMulGpu(const SparseMatrixVectorMulGpu& other) = delete;
+  SparseMatrixVectorMulGpu& operator=(const SparseMatrixVectorMulGpu& other) =
+      delete;
+
+  gpuStream_t stream() const { return stream_; }
+  size_t rows() const { return rows_; }
+  size_t width() const { return width_; }
+
+  // Uploads |matrix|. The device buffers are reused by the following loads
+  // if they are large enough.
+  [[nodiscard]] bool Load(const CSRSparseMatrix<F>& matrix) {
+    using Element = typename CSRSparseMatrix<F>::Element;
+
+    TRACE_EVENT("gpu", "SparseMatrixVectorMulGpu::Load");
+    const std::vector<size_t>& row_ptrs = matrix.row_ptrs();
+    const std::vector<Element>& elements = matrix.elements();
+    rows_ = matrix.MaxRows();
+    width_ = 0;
+    for (size_t i = 0; i < rows_; ++i) {
+      width_ = std::max(width_, row_ptrs[i + 1] - row_ptrs[i]);
+    }
+    if (rows_ * width_ > size_t{std::numeric_limits<unsigned int>::max()}) {
+      LOG(ERROR) << "Too large matrix: " << rows_ << " x " << width_;
+      return false;
+    }
+
+    std::vector<F> values(rows_ * width_, F::Zero());
+    std::vector<unsigned int> col_indices(rows_ * width_,
+                                          kernels::kELLPadding);
+    for (size_t i = 0; i < rows_; ++i) {
+      for (size_t j = row_ptrs[i]; j < row_ptrs[i + 1]; ++j) {
+        size_t idx = (j - row_ptrs[i]) * rows_ + i;
+        values[idx] = elements[j].value;
+        col_indices[idx] = static_cast<unsigned int>(elements[j].index);
+      }
+    }
+    if (values.empty()) return true;
+    if (d_values_.size() < values.size()) {
+      d_values_ = device::gpu::GpuMemory<GpuField>::Malloc(values.size());
+      d_col_indices_ =
+          device::gpu::GpuMemory<unsigned int>::Malloc(values.size());
+    }
+    if (!d_values_.CopyFromPageableAsync(values.data(), stream_, 0,
+                                         values.size()) ||
+        !d_col_indices_.CopyFromPageableAsync(col_indices.data(), stream_, 0,
+                                              col_indices.size())) {
+      return false;
+    }
+    // The host vectors must outlive the asynchronous copies above.
+    return Synchronize();
+  }
+
+  // Computes |results| = M * |vector| for the loaded matrix M. The kernel is
+  // enqueued on |stream()|, so this returns before it ends.
+  [[nodiscard]] bool Mul(const device::gpu::GpuMemory<GpuField>& vector,
+                         device::gpu::GpuMemory<GpuField>* results) {
+    TRACE_EVENT("gpu", "SparseMatrixVectorMulGpu::Mul");
+    if (results->size() < rows_) {
+      LOG(ERROR) << "Too small buffer for " << rows_ << " rows";
+      return false;
+    }
+    if (rows_ == 0) return true;
+    if (width_ == 0) return results->MemsetAsync(0, stream_, 0, rows_);
+
+    unsigned int rows = static_cast<unsigned int>(rows_);
+    kernels::ELLSparseMatrixVectorMul<<<(rows + kThreadNum - 1) / kThreadNum,
+                                        kThreadNum, 0, stream_>>>(
+        d_values_.get(), d_col_indices_.get(), rows,
+        static_cast<unsigned int>(width_), vector.get(), results->get());
+    return LOG_IF_GPU_LAST_ERROR(
+               "Failed to kernels::ELLSparseMatrixVectorMul()") == gpuSuccess;
+  }
+
+  // Waits until the operations enqueued on |stream()| end.
+  [[nodiscard]] bool Synchronize() {
+    return LOG_IF_GPU_ERROR(gpuStreamSynchronize(stream_),
+                            "Failed to gpuStreamSynchronize()") == gpuSuccess;
+  }
+
+ private:
+  gpuStream_t stream_ = nullptr;
+  size_t rows_ = 0;
+  size_t width_ = 0;
+  device::gpu::GpuMemory<GpuField> d_values_;
+  device::gpu::GpuMemory<unsigned int> d_col_indices_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_MATRIX_SPARSE_SPARSE_MATRIX_VECTOR_MUL_GPU_H_
@@ -0,0 +1,68 @@
+#include "tachyon/math/matrix/sparse/sparse_matrix_vector_mul_gpu.h"
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/matrix/sparse/kernels/bn254_sparse_matrix_vector_mul_kernels.cu.h"
+#include "tachyon/math/matrix/sparse/sparse_matrix_vector_mul.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn254::Fr;
+
+class SparseMatrixVectorMulGpuTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+
+  static void TearDownTestSuite() {
+    GPU_MUST_SUCCESS(gpuDeviceReset(), "");
+  }
+};
+
+}  // namespace
+
+TEST_F(SparseMatrixVectorMulGpuTest, Mul) {
+  constexpr size_t kRows = 1000;
+  constexpr size_t kCols = 300;
+
+  typename CSRSparseMatrix<F>::Elements elements;
+  std::vector<size_t> row_ptrs = {0};
+  for (size_t i = 0; i < kRows; ++i) {
+    size_t nnz = base::Uniform(base::Range<size_t>(0, 8));
+    for (size_t j = 0; j < nnz; ++j) {
+      elements.push_back({base::Uniform(base::Range<size_t>(0, kCols)),
+                          j == 0 ? F::One() : F::Random()});
+    }
+    row_ptrs.push_back(elements.size());
+  }
+  CSRSparseMatrix<F> matrix(std::move(elements), std::move(row_ptrs));
+  std::vector<F> vector =
+      base::CreateVector(kCols, []() { return F::Random(); });
+
+  SparseMatrixVectorMulGpu<F> spmv;
+  ASSERT_TRUE(spmv.Load(matrix));
+
+  device::gpu::GpuMemory<bn254::FrGpu> d_vector =
+      device::gpu::GpuMemory<bn254::FrGpu>::Malloc(kCols);
+  device::gpu::GpuMemory<bn254::FrGpu> d_results =
+      device::gpu::GpuMemory<bn254::FrGpu>::Malloc(kRows);
+  ASSERT_TRUE(
+      d_vector.CopyFrom(vector.data(), device::gpu::GpuMemoryType::kHost));
+  ASSERT_TRUE(spmv.Mul(d_vector, &d_results));
+  ASSERT_TRUE(spmv.Synchronize());
+
+  std::vector<F> results(kRows);
+  ASSERT_TRUE(
+      d_results.CopyTo(results.data(), device::gpu::GpuMemoryType::kHost));
+  EXPECT_EQ(results,
+            SparseMatrixVectorMul(matrix, absl::MakeConstSpan(vector)));
+}
+
+}  // namespace tachyon::math
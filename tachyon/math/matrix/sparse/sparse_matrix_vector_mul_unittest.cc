@@ -0,0 +1,85 @@
+#include "tachyon/math/matrix/sparse/sparse_matrix_vector_mul.h"
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class SparseMatrixVectorMulTest : public FiniteFieldTest<GF7> {};
+
+}  // namespace
+
+TEST_F(SparseMatrixVectorMulTest, Mul) {
+  //   1 0 4 0
+  //   0 0 0 0
+  //   0 5 2 2
+  //   3 0 0 1
+  CSRSparseMatrix<GF7> matrix(
+      {{0, GF7(1)},
+       {2, GF7(4)},
+       {1, GF7(5)},
+       {2, GF7(2)},
+       {3, GF7(2)},
+       {0, GF7(3)},
+       {3, GF7(1)}},
+      {0, 2, 2, 5, 7});
+  std::vector<GF7> vector = {GF7(1), GF7(2), GF7(3), GF7(4)};
+
+  std::vector<GF7> expected = {GF7(13), GF7(0), GF7(24), GF7(7)};
+  EXPECT_EQ(SparseMatrixVectorMul(matrix, absl::MakeConstSpan(vector)),
+            expected);
+
+  // Only the first rows are computed.
+  std::vector<GF7> results(3);
+  SparseMatrixVectorMul(matrix, absl::MakeConstSpan(vector),
+                        absl::MakeSpan(results));
+  EXPECT_EQ(results, std::vector<GF7>(expected.begin(), expected.begin() + 3));
+}
+
+TEST_F(SparseMatrixVectorMulTest, MulRandom) {
+  constexpr size_t kRows = 1000;
+  constexpr size_t kCols = 100;
+
+  // The rows have very different numbers of nonzeros, which are balanced over
+  // the row blocks.
+  typename CSRSparseMatrix<GF7>::Elements elements;
+  std::vector<size_t> row_ptrs = {0};
+  std::vector<std::vector<GF7>> dense(kRows, std::vector<GF7>(kCols));
+  for (size_t i = 0; i < kRows; ++i) {
+    bool is_long = i % 100 == 0;
+    size_t nnz = is_long ? kCols : base::Uniform(base::Range<size_t>(0, 5));
+    for (size_t j = 0; j < nnz; ++j) {
+      size_t col =
+          is_long ? j : base::Uniform(base::Range<size_t>(0, kCols));
+      GF7 value = GF7::Random();
+      elements.push_back({col, value});
+      dense[i][col] += value;
+    }
+    row_ptrs.push_back(elements.size());
+  }
+  CSRSparseMatrix<GF7> matrix(std::move(elements), std::move(row_ptrs));
+  std::vector<GF7> vector =
+      base::CreateVector(kCols, []() { return GF7::Random(); });
+
+  std::vector<GF7> expected =
+      base::Map(dense, [&vector](const std::vector<GF7>& row) {
+        GF7 sum = GF7::Zero();
+        for (size_t j = 0; j < kCols; ++j) {
+          sum += row[j] * vector[j];
+        }
+        return sum;
+      });
+  EXPECT_EQ(SparseMatrixVectorMul(matrix, absl::MakeConstSpan(vector)),
+            expected);
+}
+
+}  // namespace tachyon::math
@@ -8,6 +8,7 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -104,6 +105,15 @@ class MultilinearDenseEvaluations {
                        [](const F& value) { return value.IsOne(); });
   }
 
+  // Returns true if every evaluation is 0 or 1, e.g., of a selector or a
+  // witness bit.
+  constexpr bool IsBoolean() const {
+    return std::all_of(evaluations_.begin(), evaluations_.end(),
+                       [](const F& value) {
+                         return value.IsZero() || value.IsOne();
+                       });
+  }
+
   constexpr size_t Degree() const {
     return base::bits::SafeLog2Ceiling(evaluations_.size());
   }
@@ -114,11 +124,30 @@ class MultilinearDenseEvaluations {
     return MultilinearDenseEvaluations(poly);
   }
 
-  MultilinearDenseEvaluations FixVariablesInPlace(const Point& partial_point) {
+  MultilinearDenseEvaluations& FixVariablesInPlace(const Point& partial_point) {
     RunFixVariables(partial_point, evaluations_);
     return *this;
   }
 
+  // Fixes the first variable with |r|. Unlike |FixVariablesInPlace()|, it
+  // doesn't take a |Point|, and the result is written to the lower half of
+  // |evaluations_|, which keeps its capacity, so that no memory is allocated.
+  //
+  //   P(r, x₁, ..., xₙ₋₁)[b] = left + r * (right - left)
+  //   (where left = P[2b] and right = P[2b + 1])
+  MultilinearDenseEvaluations& FixFirstVariableInPlace(const F& r) {
+    if (evaluations_.empty()) return *this;
+    CHECK_GT(Degree(), size_t{0});
+    size_t half = evaluations_.size() >> 1;
+    for (size_t b = 0; b < half; ++b) {
+      const F& left = evaluations_[b << 1];
+      const F& right = evaluations_[(b << 1) + 1];
+      evaluations_[b] = left + r * (right - left);
+    }
+    evaluations_.resize(half);
+    return *this;
+  }
+
   // Evaluate polynomial at |point|. It uses |FixVariables()| internally. The
   // |point| is a vector in {0, 1}ᵏ in little-endian form. If the size of
   // |point| is less than the degree of the polynomial, the remaining components
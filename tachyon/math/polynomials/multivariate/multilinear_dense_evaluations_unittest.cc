@@ -53,6 +53,12 @@ TEST_F(MultilinearDenseEvaluationsTest, IsOne) {
   }
 }
 
+TEST_F(MultilinearDenseEvaluationsTest, IsBoolean) {
+  EXPECT_TRUE(Evals().IsBoolean());
+  EXPECT_TRUE(Evals({GF7(0), GF7(1), GF7(1), GF7(0)}).IsBoolean());
+  EXPECT_FALSE(Evals({GF7(0), GF7(2)}).IsBoolean());
+}
+
 TEST_F(MultilinearDenseEvaluationsTest, Random) {
   bool success = false;
   Poly r = Poly::Random(kMaxDegree);
@@ -120,6 +126,19 @@ TEST_F(MultilinearDenseEvaluationsTest, Evaluate) {
   }
 }
 
+TEST_F(MultilinearDenseEvaluationsTest, FixFirstVariableInPlace) {
+  for (const Poly& poly : polys_) {
+    Evals evals = poly.evaluations();
+    GF7 r = GF7::Random();
+    Evals expected = evals.FixVariables({r});
+    const GF7* data = evals.evaluations().data();
+    EXPECT_EQ(evals.FixFirstVariableInPlace(r), expected);
+    // The lower half of the buffer is reused.
+    EXPECT_EQ(evals.evaluations().data(), data);
+  }
+  EXPECT_TRUE(Evals().FixFirstVariableInPlace(GF7(3)).IsZero());
+}
+
 TEST_F(MultilinearDenseEvaluationsTest, ToString) {
   struct {
     const Poly& poly;
@@ -0,0 +1,164 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_CACHE_BLOCKED_FFT_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_CACHE_BLOCKED_FFT_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+
+namespace tachyon::math {
+
+// |CacheBlockedFFT| runs the butterfly stages of a radix-2 FFT with fewer
+// passes over the memory than running one pass per stage.
+//
+// 1. The stages whose butterflies stay within an aligned block of
+//    |block_size| elements are fused: every block runs all of them while it
+//    is resident in the L2 cache, in a single parallel region.
+// 2. The remaining stages are fused 2 at a time into radix-4 passes, where
+//    each pass loads 4 elements, applies the butterflies of both stages to
+//    them and stores them back.
+//
+// The butterflies and the twiddles are exactly the same as the ones of the
+// per-stage FFT, so are the results.
+template <typename F>
+class CacheBlockedFFT {
+ public:
+  using ButterflyFn = void (*)(F&, F&, const F&);
+
+  // The number of bytes of a block that is assumed to fit in the L2 cache
+  // together with its twiddles.
+  constexpr static size_t kBlockBytes = size_t{1} << 19;
+  constexpr static size_t kMaxBlockSize =
+      std::max(size_t{2}, kBlockBytes / sizeof(F));
+
+  // Returns the largest power of 2 block size, which is at most
+  // |kMaxBlockSize| and leaves at least one block per thread. Inside a
+  // parallel region, the transform runs on a single thread.
+  static size_t ComputeBlockSize(size_t size) {
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums =
+        omp_in_parallel() ? 1 : static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+    size_t block_size = std::min(kMaxBlockSize, size / thread_nums);
+    if (block_size < 2) return 2;
+    return size_t{1} << base::bits::Log2Floor(block_size);
+  }
+
+  // Runs the decimation-in-time stages for gaps |start_gap|, 2 * |start_gap|,
+  // ..., |values.size()| / 2. |roots_vec[k]| must hold the twiddles for the
+  // gap 2ᵏ.
+  template <ButterflyFn Fn>
+  static void RunOutIn(absl::Span<F> values,
+                       absl::Span<const std::vector<F>> roots_vec,
+                       size_t start_gap, size_t block_size) {
+    size_t size = values.size();
+    CHECK(base::bits::IsPowerOfTwo(size));
+    CHECK(base::bits::IsPowerOfTwo(block_size));
+    block_size = std::min(block_size, size);
+
+    size_t gap = start_gap;
+    if (2 * gap <= block_size) {
+      size_t end_gap = block_size;
+      OPENMP_PARALLEL_FOR(size_t b = 0; b < size; b += block_size) {
+        F* block = &values[b];
+        for (size_t g = gap; g < end_gap; g *= 2) {
+          const std::vector<F>& roots = roots_vec[base::bits::Log2Floor(g)];
+          for (size_t i = 0; i < block_size; i += 2 * g) {
+            for (size_t j = 0; j < g; ++j) {
+              Fn(block[i + j], block[i + j + g], roots[j]);
+            }
+          }
+        }
+      }
+      gap = end_gap;
+    }
+
+    for (; 4 * gap <= size; gap *= 4) {
+      size_t idx = base::bits::Log2Floor(gap);
+      const std::vector<F>& roots = roots_vec[idx];
+      const std::vector<F>& next_roots = roots_vec[idx + 1];
+      OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < size; i += 4 * gap) {
+        for (size_t j = 0; j < gap; ++j) {
+          F* v = &values[i + j];
+          Fn(v[0], v[gap], roots[j]);
+          Fn(v[2 * gap], v[3 * gap], roots[j]);
+          Fn(v[0], v[2 * gap], next_roots[j]);
+          Fn(v[gap], v[3 * gap], next_roots[j + gap]);
+        }
+      }
+    }
+
+    if (gap < size) {
+      const std::vector<F>& roots = roots_vec[base::bits::Log2Floor(gap)];
+      OPENMP_PARALLEL_FOR(size_t j = 0; j < gap; ++j) {
+        Fn(values[j], values[j + gap], roots[j]);
+      }
+    }
+  }
+
+  // Runs the decimation-in-frequency stages for gaps |values.size()| / 2,
+  // |values.size()| / 4, ..., 1. |roots_vec[k]| must hold the twiddles for
+  // the gap 2ᵏ.
+  template <ButterflyFn Fn>
+  static void RunInOut(absl::Span<F> values,
+                       absl::Span<const std::vector<F>> roots_vec,
+                       size_t block_size) {
+    size_t size = values.size();
+    CHECK(base::bits::IsPowerOfTwo(size));
+    CHECK(base::bits::IsPowerOfTwo(block_size));
+    block_size = std::min(block_size, size);
+    if (size < 2) return;
+
+    size_t gap = size / 2;
+    size_t end_gap = block_size / 2;
+    for (; gap / 2 > end_gap; gap /= 4) {
+      size_t half_gap = gap / 2;
+      size_t idx = base::bits::Log2Floor(gap);
+      const std::vector<F>& roots = roots_vec[idx];
+      const std::vector<F>& next_roots = roots_vec[idx - 1];
+      OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < size; i += 2 * gap) {
+        for (size_t j = 0; j < half_gap; ++j) {
+          F* v = &values[i + j];
+          Fn(v[0], v[gap], roots[j]);
+          Fn(v[half_gap], v[gap + half_gap], roots[j + half_gap]);
+          Fn(v[0], v[half_gap], next_roots[j]);
+          Fn(v[gap], v[gap + half_gap], next_roots[j]);
+        }
+      }
+    }
+
+    if (gap > end_gap) {
+      const std::vector<F>& roots = roots_vec[base::bits::Log2Floor(gap)];
+      OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < size; i += 2 * gap) {
+        for (size_t j = 0; j < gap; ++j) {
+          Fn(values[i + j], values[i + j + gap], roots[j]);
+        }
+      }
+      gap /= 2;
+    }
+
+    OPENMP_PARALLEL_FOR(size_t b = 0; b < size; b += block_size) {
+      F* block = &values[b];
+      for (size_t g = gap; g > 0; g /= 2) {
+        const std::vector<F>& roots = roots_vec[base::bits::Log2Floor(g)];
+        for (size_t i = 0; i < block_size; i += 2 * g) {
+          for (size_t j = 0; j < g; ++j) {
+            Fn(block[i + j], block[i + j + g], roots[j]);
+          }
+        }
+      }
+    }
+  }
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_CACHE_BLOCKED_FFT_H_
@@ -0,0 +1,114 @@
+#include "tachyon/math/polynomials/univariate/cache_blocked_fft.h"
+
+#include <utility>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bls12_381::Fr;
+
+constexpr size_t kLogSize = 7;
+constexpr size_t kSize = size_t{1} << kLogSize;
+
+void ButterflyFnInOut(F& lo, F& hi, const F& root) {
+  F neg = lo - hi;
+  lo += hi;
+  hi = neg * root;
+}
+
+void ButterflyFnOutIn(F& lo, F& hi, const F& root) {
+  hi *= root;
+  F neg = lo - hi;
+  lo += hi;
+  hi = std::move(neg);
+}
+
+class CacheBlockedFFTTest : public FiniteFieldTest<F> {
+ public:
+  void SetUp() override {
+    F omega;
+    ASSERT_TRUE(F::GetRootOfUnity(kSize, &omega));
+    // |roots_vec_[k]| holds the twiddles for the gap 2ᵏ.
+    roots_vec_ = base::CreateVector(kLogSize, [&omega](size_t k) {
+      size_t gap = size_t{1} << k;
+      F step = omega.Pow(kSize / (2 * gap));
+      std::vector<F> roots(gap);
+      F root = F::One();
+      for (size_t j = 0; j < gap; ++j) {
+        roots[j] = root;
+        root *= step;
+      }
+      return roots;
+    });
+    values_ = base::CreateVector(kSize, []() { return F::Random(); });
+  }
+
+ protected:
+  std::vector<std::vector<F>> roots_vec_;
+  std::vector<F> values_;
+};
+
+}  // namespace
+
+TEST_F(CacheBlockedFFTTest, RunOutIn) {
+  for (size_t start_gap : {1, 4}) {
+    std::vector<F> expected = values_;
+    for (size_t gap = start_gap; gap < kSize; gap *= 2) {
+      const std::vector<F>& roots = roots_vec_[base::bits::Log2Floor(gap)];
+      for (size_t i = 0; i < kSize; i += 2 * gap) {
+        for (size_t j = 0; j < gap; ++j) {
+          ButterflyFnOutIn(expected[i + j], expected[i + j + gap], roots[j]);
+        }
+      }
+    }
+
+    for (size_t block_size = 2; block_size <= 2 * kSize; block_size *= 2) {
+      SCOPED_TRACE(absl::Substitute("start_gap: $0, block_size: $1",
+                                    start_gap, block_size));
+      std::vector<F> values = values_;
+      CacheBlockedFFT<F>::RunOutIn<ButterflyFnOutIn>(
+          absl::MakeSpan(values), roots_vec_, start_gap, block_size);
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+TEST_F(CacheBlockedFFTTest, RunInOut) {
+  std::vector<F> expected = values_;
+  for (size_t gap = kSize / 2; gap > 0; gap /= 2) {
+    const std::vector<F>& roots = roots_vec_[base::bits::Log2Floor(gap)];
+    for (size_t i = 0; i < kSize; i += 2 * gap) {
+      for (size_t j = 0; j < gap; ++j) {
+        ButterflyFnInOut(expected[i + j], expected[i + j + gap], roots[j]);
+      }
+    }
+  }
+
+  for (size_t block_size = 2; block_size <= 2 * kSize; block_size *= 2) {
+    SCOPED_TRACE(absl::Substitute("block_size: $0", block_size));
+    std::vector<F> values = values_;
+    CacheBlockedFFT<F>::RunInOut<ButterflyFnInOut>(absl::MakeSpan(values),
+                                                   roots_vec_, block_size);
+    EXPECT_EQ(values, expected);
+  }
+}
+
+TEST_F(CacheBlockedFFTTest, ComputeBlockSize) {
+  for (size_t size : {size_t{1}, size_t{2}, kSize, size_t{1} << 24}) {
+    size_t block_size = CacheBlockedFFT<F>::ComputeBlockSize(size);
+    EXPECT_TRUE(base::bits::IsPowerOfTwo(block_size));
+    EXPECT_GE(block_size, size_t{2});
+    EXPECT_LE(block_size, CacheBlockedFFT<F>::kMaxBlockSize);
+  }
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,269 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_DISTRIBUTED_EVALUATION_DOMAIN_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_DISTRIBUTED_EVALUATION_DOMAIN_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/memory/memory.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/distributed/communicator.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/optional.h"
+#include "tachyon/base/range.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+namespace tachyon::math {
+
+// |DistributedEvaluationDomain| runs an FFT of a power of 2 size n, which is
+// too large for a single host, across the ranks of a |base::Communicator|.
+// The i-th rank holds the contiguous range |GetShard()| of the i-th rank of
+// both the input and the output.
+//
+// It uses the four-step decomposition n = n₁ * n₂. Seeing the input aᵢ as an
+// n₁ × n₂ matrix whose (i₁, i₂)-th element is a_{i₁ * n₂ + i₂}, the output is
+//
+//   X_{k₁ + n₁ * k₂} = Σ_{i₂} (ω^{n₁})^{i₂ * k₂} * ω^{i₂ * k₁} *
+//                      Σ_{i₁} (ω^{n₂})^{i₁ * k₁} * a_{i₁ * n₂ + i₂},
+//
+// where ω is the n-th root of unity. So the columns are transformed by FFTs of
+// size n₁, multiplied by the twiddles ω^{i₂ * k₁}, and the rows are transformed
+// by FFTs of size n₂. Each rank transforms its own columns and rows locally
+// with |Radix2EvaluationDomain| and the matrix is transposed across the ranks
+// with |base::Communicator::AllToAll()| before each step and at the end.
+//
+// NOTE: Every rank must call |FFT()| or |IFFT()| in the same order.
+template <typename F, size_t MaxDegree>
+class DistributedEvaluationDomain {
+ public:
+  using Domain = UnivariateEvaluationDomain<F, MaxDegree>;
+  using Evals = typename Domain::Evals;
+  using DensePoly = typename Domain::DensePoly;
+  using DenseCoeffs = typename Domain::DenseCoeffs;
+
+  // Returns nullptr if |size| or the world size of |comm| is not a power of 2,
+  // or if the world size is too large to split both n₁ and n₂.
+  static std::unique_ptr<DistributedEvaluationDomain> Create(
+      size_t size, base::Communicator* comm) {
+    size_t world_size = static_cast<size_t>(comm->world_size());
+    if (!base::bits::IsPowerOfTwo(size) ||
+        !base::bits::IsPowerOfTwo(world_size)) {
+      LOG(ERROR) << "Both the size and the world size must be a power of 2";
+      return nullptr;
+    }
+    uint32_t log_size = base::bits::SafeLog2Ceiling(size);
+    size_t n1 = size_t{1} << ((log_size + 1) / 2);
+    size_t n2 = size / n1;
+    // NOTE: |n2| <= |n1|.
+    if (n2 % world_size != 0) {
+      LOG(ERROR) << "The size is too small for the world size";
+      return nullptr;
+    }
+
+    F omega;
+    if (!F::GetRootOfUnity(size, &omega)) {
+      LOG(ERROR) << "No root of unity of size " << size;
+      return nullptr;
+    }
+    std::unique_ptr<Domain> col_domain =
+        Radix2EvaluationDomain<F, MaxDegree>::Create(n1);
+    std::unique_ptr<Domain> row_domain =
+        Radix2EvaluationDomain<F, MaxDegree>::Create(n2);
+    if (col_domain->group_gen() != omega.Pow(n2) ||
+        row_domain->group_gen() != omega.Pow(n1)) {
+      LOG(ERROR) << "The roots of unity of the sub-domains don't match";
+      return nullptr;
+    }
+    return absl::WrapUnique(
+        new DistributedEvaluationDomain(size, n1, n2, std::move(omega), comm,
+                                        std::move(col_domain),
+                                        std::move(row_domain)));
+  }
+
+  size_t size() const { return size_; }
+
+  // Returns the number of the elements each rank holds.
+  size_t local_size() const { return size_ / comm_->world_size(); }
+
+  const F& group_gen() const { return group_gen_; }
+
+  // Returns the range of the input and the output this rank holds.
+  base::Range<size_t> GetShard() const {
+    size_t start = comm_->rank() * local_size();
+    return {start, start + local_size()};
+  }
+
+  // |values| holds the coefficients in |GetShard()| and is replaced with the
+  // evaluations in |GetShard()|.
+  [[nodiscard]] bool FFT(std::vector<F>* values) const {
+    return Transform(values, /*inverse=*/false);
+  }
+
+  // |values| holds the evaluations in |GetShard()| and is replaced with the
+  // coefficients in |GetShard()|.
+  [[nodiscard]] bool IFFT(std::vector<F>* values) const {
+    return Transform(values, /*inverse=*/true);
+  }
+
+ private:
+  DistributedEvaluationDomain(size_t size, size_t n1, size_t n2, F&& group_gen,
+                              base::Communicator* comm,
+                              std::unique_ptr<Domain> col_domain,
+                              std::unique_ptr<Domain> row_domain)
+      : size_(size),
+        n1_(n1),
+        n2_(n2),
+        group_gen_(std::move(group_gen)),
+        group_gen_inv_(unwrap(group_gen_.Inverse())),
+        comm_(comm),
+        col_domain_(std::move(col_domain)),
+        row_domain_(std::move(row_domain)) {}
+
+  bool Transform(std::vector<F>* values, bool inverse) const {
+    if (values->size() != local_size()) {
+      LOG(ERROR) << "values_size and local_size don't match";
+      return false;
+    }
+    int world_size = comm_->world_size();
+    size_t rank = static_cast<size_t>(comm_->rank());
+    // The numbers of the rows and the columns each rank takes.
+    size_t r1 = n1_ / world_size;
+    size_t r2 = n2_ / world_size;
+
+    // Transposes the rows [rank * r1, (rank + 1) * r1) into the columns
+    // [rank * r2, (rank + 1) * r2).
+    std::vector<std::vector<F>> blocks(world_size);
+    OPENMP_PARALLEL_FOR(int q = 0; q < world_size; ++q) {
+      blocks[q].resize(r1 * r2);
+      for (size_t row = 0; row < r1; ++row) {
+        for (size_t c = 0; c < r2; ++c) {
+          blocks[q][row * r2 + c] = (*values)[row * n2_ + q * r2 + c];
+        }
+      }
+    }
+    values->clear();
+    std::vector<std::vector<F>> received;
+    if (!comm_->AllToAll(std::move(blocks), &received)) return false;
+    std::vector<std::vector<F>> cols(r2, std::vector<F>(n1_));
+    OPENMP_PARALLEL_FOR(size_t c = 0; c < r2; ++c) {
+      for (int q = 0; q < world_size; ++q) {
+        for (size_t row = 0; row < r1; ++row) {
+          cols[c][q * r1 + row] = received[q][row * r2 + c];
+        }
+      }
+    }
+    received.clear();
+
+    // Transforms the columns and multiplies them by the twiddles.
+    TransformBatch(*col_domain_, cols, inverse);
+    const F& root = inverse ? group_gen_inv_ : group_gen_;
+    OPENMP_PARALLEL_FOR(size_t c = 0; c < r2; ++c) {
+      F twiddle_step = root.Pow(rank * r2 + c);
+      F twiddle = F::One();
+      for (F& value : cols[c]) {
+        value *= twiddle;
+        twiddle *= twiddle_step;
+      }
+    }
+
+    // Transposes the columns into the rows [rank * r1, (rank + 1) * r1).
+    blocks = std::vector<std::vector<F>>(world_size);
+    OPENMP_PARALLEL_FOR(int q = 0; q < world_size; ++q) {
+      blocks[q].resize(r2 * r1);
+      for (size_t c = 0; c < r2; ++c) {
+        for (size_t row = 0; row < r1; ++row) {
+          blocks[q][c * r1 + row] = cols[c][q * r1 + row];
+        }
+      }
+    }
+    cols.clear();
+    if (!comm_->AllToAll(std::move(blocks), &received)) return false;
+    std::vector<std::vector<F>> rows(r1, std::vector<F>(n2_));
+    OPENMP_PARALLEL_FOR(size_t row = 0; row < r1; ++row) {
+      for (int q = 0; q < world_size; ++q) {
+        for (size_t c = 0; c < r2; ++c) {
+          rows[row][q * r2 + c] = received[q][c * r1 + row];
+        }
+      }
+    }
+    received.clear();
+
+    // Transforms the rows. The (row, k₂)-th element is now X_{k₁ + n₁ * k₂},
+    // where k₁ = rank * r1 + row.
+    TransformBatch(*row_domain_, rows, inverse);
+
+    // Transposes the rows back so that this rank holds the range
+    // [rank * r2 * n₁, (rank + 1) * r2 * n₁) of the output, i.e., k₂ in
+    // [rank * r2, (rank + 1) * r2) with every k₁.
+    blocks = std::vector<std::vector<F>>(world_size);
+    OPENMP_PARALLEL_FOR(int q = 0; q < world_size; ++q) {
+      blocks[q].resize(r1 * r2);
+      for (size_t row = 0; row < r1; ++row) {
+        for (size_t c = 0; c < r2; ++c) {
+          blocks[q][row * r2 + c] = rows[row][q * r2 + c];
+        }
+      }
+    }
+    rows.clear();
+    if (!comm_->AllToAll(std::move(blocks), &received)) return false;
+    values->resize(local_size());
+    OPENMP_PARALLEL_FOR(size_t c = 0; c < r2; ++c) {
+      for (int q = 0; q < world_size; ++q) {
+        for (size_t row = 0; row < r1; ++row) {
+          (*values)[c * n1_ + q * r1 + row] = received[q][row * r2 + c];
+        }
+      }
+    }
+    return true;
+  }
+
+  // Replaces each of |vectors| with its FFT, or IFFT if |inverse| is true,
+  // over |domain|.
+  static void TransformBatch(const Domain& domain,
+                             std::vector<std::vector<F>>& vectors,
+                             bool inverse) {
+    if (inverse) {
+      std::vector<Evals> evals_vec(vectors.size());
+      for (size_t i = 0; i < vectors.size(); ++i) {
+        evals_vec[i] = Evals(std::move(vectors[i]));
+      }
+      std::vector<DensePoly> polys = domain.IFFTBatch(std::move(evals_vec));
+      for (size_t i = 0; i < vectors.size(); ++i) {
+        // NOTE: The high degree zeros are removed by |IFFTBatch()|.
+        vectors[i] = std::move(polys[i]).TakeCoefficients().TakeCoefficients();
+        vectors[i].resize(domain.size(), F::Zero());
+      }
+    } else {
+      std::vector<DensePoly> polys(vectors.size());
+      for (size_t i = 0; i < vectors.size(); ++i) {
+        polys[i] = DensePoly(DenseCoeffs(std::move(vectors[i])));
+      }
+      std::vector<Evals> evals_vec = domain.FFTBatch(std::move(polys));
+      for (size_t i = 0; i < vectors.size(); ++i) {
+        // NOTE: The FFT of a zero polynomial is empty.
+        vectors[i] = std::move(evals_vec[i]).TakeEvaluations();
+        vectors[i].resize(domain.size(), F::Zero());
+      }
+    }
+  }
+
+  size_t size_;
+  size_t n1_;
+  size_t n2_;
+  F group_gen_;
+  F group_gen_inv_;
+  // not owned
+  base::Communicator* const comm_;
+  // The domains of size |n1_| and |n2_|, which transform the columns and the
+  // rows, respectively.
+  std::unique_ptr<Domain> col_domain_;
+  std::unique_ptr<Domain> row_domain_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_DISTRIBUTED_EVALUATION_DOMAIN_H_
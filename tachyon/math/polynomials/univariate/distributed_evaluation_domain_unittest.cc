@@ -0,0 +1,90 @@
+#include "tachyon/math/polynomials/univariate/distributed_evaluation_domain.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/distributed/local_transport.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn254::Fr;
+
+constexpr size_t kMaxDegree = 127;
+
+using Domain = UnivariateEvaluationDomain<F, kMaxDegree>;
+using DistributedDomain = DistributedEvaluationDomain<F, kMaxDegree>;
+
+class DistributedEvaluationDomainTest : public FiniteFieldTest<F> {};
+
+}  // namespace
+
+TEST_F(DistributedEvaluationDomainTest, Create) {
+  base::LocalTransportGroup group(4);
+  base::Communicator comm(group.GetTransport(0));
+  EXPECT_FALSE(DistributedDomain::Create(24, &comm));
+  // n₂ = 2 can't be split into 4.
+  EXPECT_FALSE(DistributedDomain::Create(8, &comm));
+  EXPECT_TRUE(DistributedDomain::Create(16, &comm));
+
+  base::LocalTransportGroup group3(3);
+  base::Communicator comm3(group3.GetTransport(0));
+  EXPECT_FALSE(DistributedDomain::Create(16, &comm3));
+}
+
+TEST_F(DistributedEvaluationDomainTest, FFTAndIFFT) {
+  for (size_t size : {size_t{16}, size_t{32}, size_t{128}}) {
+    for (int world_size : {1, 2, 4}) {
+      SCOPED_TRACE(size);
+      SCOPED_TRACE(world_size);
+      std::vector<F> coeffs =
+          base::CreateVector(size, []() { return F::Random(); });
+      std::unique_ptr<Domain> domain = Domain::Create(size);
+      std::vector<F> evals =
+          domain->FFT(typename Domain::DensePoly(
+                          typename Domain::DenseCoeffs(coeffs)))
+              .TakeEvaluations();
+
+      base::LocalTransportGroup group(world_size);
+      std::vector<std::vector<F>> results(world_size);
+      std::vector<std::vector<F>> inverse_results(world_size);
+      std::vector<std::thread> threads;
+      for (int i = 0; i < world_size; ++i) {
+        threads.emplace_back([&, i]() {
+          base::Communicator comm(group.GetTransport(i));
+          std::unique_ptr<DistributedDomain> distributed_domain =
+              DistributedDomain::Create(size, &comm);
+          CHECK(distributed_domain);
+          base::Range<size_t> shard = distributed_domain->GetShard();
+          results[i] = std::vector<F>(coeffs.begin() + shard.from,
+                                      coeffs.begin() + shard.to);
+          CHECK(distributed_domain->FFT(&results[i]));
+          inverse_results[i] = results[i];
+          CHECK(distributed_domain->IFFT(&inverse_results[i]));
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+
+      std::vector<F> result;
+      std::vector<F> inverse_result;
+      for (int i = 0; i < world_size; ++i) {
+        result.insert(result.end(), results[i].begin(), results[i].end());
+        inverse_result.insert(inverse_result.end(), inverse_results[i].begin(),
+                              inverse_results[i].end());
+      }
+      EXPECT_EQ(result, evals);
+      EXPECT_EQ(inverse_result, coeffs);
+    }
+  }
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,117 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_GROUP_FFT_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_GROUP_FFT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/optional.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/polynomials/univariate/twiddle_cache.h"
+
+namespace tachyon::math {
+
+namespace internal {
+
+// Runs the radix-2 decimation-in-time butterflies over |points| with the
+// twiddles of |TwiddleCache|, accumulating in |Point|, and multiplies the
+// results by n⁻¹ if |inverse| is true.
+template <typename Point, typename AffinePoint>
+bool GroupRadix2Transform(absl::Span<const AffinePoint> points, bool inverse,
+                          std::vector<AffinePoint>* ret) {
+  using ScalarField = typename AffinePoint::ScalarField;
+
+  size_t size = points.size();
+  if (!base::bits::IsPowerOfTwo(size)) {
+    LOG(ERROR) << "The size must be a power of 2: " << size;
+    return false;
+  }
+  if (size == 1) {
+    *ret = {points[0]};
+    return true;
+  }
+  uint32_t log_size = base::bits::SafeLog2Ceiling(size);
+
+  // Permutes the points in the bit-reversed order for the decimation-in-time
+  // butterflies.
+  std::vector<Point> values(size);
+  uint32_t shift = sizeof(size_t) * 8 - log_size;
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+    values[base::bits::BitRev(i) >> shift] = ConvertPoint<Point>(points[i]);
+  }
+
+  TwiddleCache<ScalarField>& cache = TwiddleCache<ScalarField>::GetInstance();
+  absl::Span<const std::vector<ScalarField>> roots_vec =
+      inverse ? cache.GetInvRootsVec(log_size) : cache.GetRootsVec(log_size);
+  for (uint32_t k = 0; k < log_size; ++k) {
+    // |gap| is the half of the length of the butterflies of this stage.
+    size_t gap = size_t{1} << k;
+    const std::vector<ScalarField>& roots = roots_vec[k];
+    OPENMP_PARALLEL_FOR(size_t b = 0; b < size / 2; ++b) {
+      size_t j = b & (gap - 1);
+      size_t lo = ((b >> k) << (k + 1)) + j;
+      size_t hi = lo + gap;
+      Point t = j == 0 ? values[hi] : values[hi] * roots[j];
+      values[hi] = values[lo] - t;
+      values[lo] += t;
+    }
+  }
+
+  if (inverse) {
+    ScalarField size_inv = unwrap(
+        ScalarField::FromBigInt(typename ScalarField::BigIntTy(size))
+            .Inverse());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      values[i] *= size_inv;
+    }
+  }
+  ret->resize(size);
+  return Point::BatchNormalize(values, ret);
+}
+
+}  // namespace internal
+
+// Sets |ret| to the FFT of |points| = [P₀, ..., Pₙ₋₁] over the domain of size
+// n, which must be a power of 2, whose generator is ω. That is, the i-th point
+// of |ret| is
+//
+//   Σⱼ ωⁱʲ * Pⱼ.
+//
+// It runs the same radix-2 butterflies as |Radix2EvaluationDomain| with the
+// twiddles of |TwiddleCache|, but each butterfly costs a scalar
+// multiplication on the curve, so it is much slower than an FFT over the
+// scalar field. The butterflies of each stage run in parallel. The points are
+// accumulated in |Point|, e.g., |JacobianPoint| or |PointXYZZ|, and
+// normalized in a batch at the end.
+template <typename AffinePoint,
+          typename Point = decltype(std::declval<AffinePoint>().ToJacobian())>
+[[nodiscard]] bool GroupFFT(absl::Span<const AffinePoint> points,
+                            std::vector<AffinePoint>* ret) {
+  return internal::GroupRadix2Transform<Point>(points, /*inverse=*/false, ret);
+}
+
+// Same as |GroupFFT()|, but sets |ret| to the IFFT of |points|. That is, the
+// i-th point of |ret| is
+//
+//   n⁻¹ * Σⱼ ω⁻ⁱʲ * Pⱼ.
+//
+// Given the powers of τ of an SRS [τ⁰G, ..., τⁿ⁻¹G], it returns the SRS in the
+// Lagrange basis [L₀(τ)G, ..., Lₙ₋₁(τ)G] of the domain of size n without
+// knowing τ, since Lᵢ(X) = n⁻¹ * Σⱼ (ω⁻ⁱX)ʲ.
+template <typename AffinePoint,
+          typename Point = decltype(std::declval<AffinePoint>().ToJacobian())>
+[[nodiscard]] bool GroupIFFT(absl::Span<const AffinePoint> points,
+                             std::vector<AffinePoint>* ret) {
+  return internal::GroupRadix2Transform<Point>(points, /*inverse=*/true, ret);
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_GROUP_FFT_H_
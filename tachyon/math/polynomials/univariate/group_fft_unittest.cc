@@ -0,0 +1,95 @@
+#include "tachyon/math/polynomials/univariate/group_fft.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using Point = bn254::G1AffinePoint;
+using ScalarField = bn254::Fr;
+
+constexpr size_t kMaxDegree = 31;
+
+using Domain = UnivariateEvaluationDomain<ScalarField, kMaxDegree>;
+
+class GroupFFTTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+};
+
+}  // namespace
+
+TEST_F(GroupFFTTest, InvalidSize) {
+  std::vector<Point> points(3, Point::Generator());
+  std::vector<Point> ret;
+  EXPECT_FALSE(GroupIFFT(absl::MakeConstSpan(points), &ret));
+}
+
+TEST_F(GroupFFTTest, FFTAndIFFT) {
+  for (size_t size : {size_t{2}, size_t{8}, size_t{32}}) {
+    SCOPED_TRACE(size);
+    std::vector<ScalarField> coeffs =
+        base::CreateVector(size, []() { return ScalarField::Random(); });
+    std::vector<Point> points =
+        base::Map(coeffs, [](const ScalarField& coeff) {
+          return (Point::Generator() * coeff).ToAffine();
+        });
+
+    std::unique_ptr<Domain> domain = Domain::Create(size);
+    std::vector<ScalarField> evals =
+        domain->FFT(Domain::DensePoly(Domain::DenseCoeffs(coeffs)))
+            .TakeEvaluations();
+    std::vector<Point> expected = base::Map(
+        evals, [](const ScalarField& eval) {
+          return (Point::Generator() * eval).ToAffine();
+        });
+
+    std::vector<Point> ret;
+    ASSERT_TRUE(GroupFFT(absl::MakeConstSpan(points), &ret));
+    EXPECT_EQ(ret, expected);
+
+    std::vector<Point> ret_xyzz;
+    ASSERT_TRUE((GroupFFT<Point, bn254::G1PointXYZZ>(
+        absl::MakeConstSpan(points), &ret_xyzz)));
+    EXPECT_EQ(ret_xyzz, expected);
+
+    std::vector<Point> inverse_ret;
+    ASSERT_TRUE(GroupIFFT(absl::MakeConstSpan(ret), &inverse_ret));
+    EXPECT_EQ(inverse_ret, points);
+  }
+}
+
+TEST_F(GroupFFTTest, LagrangeSRS) {
+  for (size_t size : {size_t{2}, size_t{8}, size_t{32}}) {
+    SCOPED_TRACE(size);
+    ScalarField tau = ScalarField::Random();
+    std::vector<ScalarField> powers =
+        ScalarField::GetSuccessivePowers(size, tau);
+    std::vector<Point> points = base::Map(
+        powers, [](const ScalarField& power) {
+          return (Point::Generator() * power).ToAffine();
+        });
+
+    std::vector<Point> ret;
+    ASSERT_TRUE(GroupIFFT(absl::MakeConstSpan(points), &ret));
+
+    std::unique_ptr<Domain> domain = Domain::Create(size);
+    std::vector<ScalarField> lagrange_coeffs =
+        domain->EvaluateAllLagrangeCoefficients(tau);
+    std::vector<Point> expected = base::Map(
+        lagrange_coeffs, [](const ScalarField& coeff) {
+          return (Point::Generator() * coeff).ToAffine();
+        });
+    EXPECT_EQ(ret, expected);
+  }
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,25 @@
+#include "tachyon/math/polynomials/univariate/kernels/bn254_radix2_ntt_kernels.cu.h"
+
+namespace tachyon::math::kernels {
+
+template __global__ void BitReverse<bn254::FrGpu>(bn254::FrGpu* data,
+                                                  unsigned int log_n,
+                                                  unsigned int n);
+
+template __global__ void ButterflyOutIn<bn254::FrGpu>(
+    bn254::FrGpu* data, const bn254::FrGpu* roots, unsigned int gap,
+    unsigned int stride, unsigned int n);
+
+template __global__ void ButterflyInOut<bn254::FrGpu>(
+    bn254::FrGpu* data, const bn254::FrGpu* roots, unsigned int gap,
+    unsigned int stride, unsigned int n);
+
+template __global__ void DistributePowers<bn254::FrGpu>(
+    bn254::FrGpu* data, const bn254::FrGpu* lo_powers,
+    const bn254::FrGpu* hi_powers, unsigned int log_lo, unsigned int n);
+
+template __global__ void MulByConst<bn254::FrGpu>(bn254::FrGpu* data,
+                                                  bn254::FrGpu c,
+                                                  unsigned int n);
+
+}  // namespace tachyon::math::kernels
@@ -0,0 +1,31 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_KERNELS_BN254_RADIX2_NTT_KERNELS_CU_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_KERNELS_BN254_RADIX2_NTT_KERNELS_CU_H_
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr_gpu.h"
+#include "tachyon/math/polynomials/univariate/kernels/radix2_ntt_kernels.cu.h"
+
+namespace tachyon::math::kernels {
+
+extern template __global__ void BitReverse<bn254::FrGpu>(bn254::FrGpu* data,
+                                                         unsigned int log_n,
+                                                         unsigned int n);
+
+extern template __global__ void ButterflyOutIn<bn254::FrGpu>(
+    bn254::FrGpu* data, const bn254::FrGpu* roots, unsigned int gap,
+    unsigned int stride, unsigned int n);
+
+extern template __global__ void ButterflyInOut<bn254::FrGpu>(
+    bn254::FrGpu* data, const bn254::FrGpu* roots, unsigned int gap,
+    unsigned int stride, unsigned int n);
+
+extern template __global__ void DistributePowers<bn254::FrGpu>(
+    bn254::FrGpu* data, const bn254::FrGpu* lo_powers,
+    const bn254::FrGpu* hi_powers, unsigned int log_lo, unsigned int n);
+
+extern template __global__ void MulByConst<bn254::FrGpu>(bn254::FrGpu* data,
+                                                         bn254::FrGpu c,
+                                                         unsigned int n);
+
+}  // namespace tachyon::math::kernels
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_KERNELS_BN254_RADIX2_NTT_KERNELS_CU_H_
@@ -0,0 +1,96 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_KERNELS_RADIX2_NTT_KERNELS_CU_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_KERNELS_RADIX2_NTT_KERNELS_CU_H_
+
+#include <utility>
+
+#include "tachyon/device/gpu/gpu_runtime.h"
+
+namespace tachyon::math::kernels {
+
+// Every kernel in this file handles a batch of vectors laid
+// out back to back. Each vector contains |n| elements and |blockIdx.y| selects
+// the vector in the batch.
+
+// Permutes each vector into bit-reversed order. |log_n| must be greater than 0.
+template <typename F>
+__global__ void BitReverse(F* data, unsigned int log_n, unsigned int n) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= n) return;
+  F* vec = data + static_cast<size_t>(blockIdx.y) * n;
+  unsigned int rgid = __brev(gid) >> (32 - log_n);
+  if (gid < rgid) {
+    F tmp = vec[gid];
+    vec[gid] = vec[rgid];
+    vec[rgid] = std::move(tmp);
+  }
+}
+
+// Applies a single Cooley-Tukey stage whose butterflies are |gap| apart.
+// |roots| contains ωⁱ for 0 ≤ i < n / 2 and |stride| is n / (2 * |gap|), so
+// that the j-th butterfly in a cluster uses ω^(j * |stride|).
+// |lo| = |lo| + |hi| * |root|
+// |hi| = |lo| - |hi| * |root|
+// This is the device counterpart of
+// |UnivariateEvaluationDomain::ButterflyFnOutIn()|.
+template <typename F>
+__global__ void ButterflyOutIn(F* data, const F* roots, unsigned int gap,
+                               unsigned int stride, unsigned int n) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= n / 2) return;
+  F* vec = data + static_cast<size_t>(blockIdx.y) * n;
+  unsigned int j = gid & (gap - 1);
+  unsigned int i = ((gid - j) << 1) + j;
+  F lo = vec[i];
+  F hi = vec[i + gap] * roots[j * stride];
+  vec[i] = lo + hi;
+  vec[i + gap] = lo - hi;
+}
+
+// Applies a single Gentleman-Sande stage whose butterflies are |gap| apart.
+// See |ButterflyOutIn()| for the meaning of |roots| and |stride|.
+// |lo| = |lo| + |hi|
+// |hi| = (|lo| - |hi|) * |root|
+// This is the device counterpart of
+// |UnivariateEvaluationDomain::ButterflyFnInOut()|.
+template <typename F>
+__global__ void ButterflyInOut(F* data, const F* roots, unsigned int gap,
+                               unsigned int stride, unsigned int n) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= n / 2) return;
+  F* vec = data + static_cast<size_t>(blockIdx.y) * n;
+  unsigned int j = gid & (gap - 1);
+  unsigned int i = ((gid - j) << 1) + j;
+  F lo = vec[i];
+  F hi = vec[i + gap];
+  vec[i] = lo + hi;
+  vec[i + gap] = (lo - hi) * roots[j * stride];
+}
+
+// Multiplies the i-th element of each vector with gⁱ. gⁱ is reconstructed from
+// two tables so that only O(√n) powers have to be prepared by the host:
+// |lo_powers|[k] = gᵏ for 0 ≤ k < 2^|log_lo| and
+// |hi_powers|[k] = c * g^(k * 2^|log_lo|), where c is an optional constant
+// that the host folds into the table.
+template <typename F>
+__global__ void DistributePowers(F* data, const F* lo_powers,
+                                 const F* hi_powers, unsigned int log_lo,
+                                 unsigned int n) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= n) return;
+  F* vec = data + static_cast<size_t>(blockIdx.y) * n;
+  unsigned int mask = (1 << log_lo) - 1;
+  vec[gid] *= lo_powers[gid & mask] * hi_powers[gid >> log_lo];
+}
+
+// Multiplies every element of each vector with |c|.
+template <typename F>
+__global__ void MulByConst(F* data, F c, unsigned int n) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= n) return;
+  F* vec = data + static_cast<size_t>(blockIdx.y) * n;
+  vec[gid] *= c;
+}
+
+}  // namespace tachyon::math::kernels
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_KERNELS_RADIX2_NTT_KERNELS_CU_H_
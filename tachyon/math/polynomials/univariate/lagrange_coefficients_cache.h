@@ -0,0 +1,104 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_LAGRANGE_COEFFICIENTS_CACHE_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_LAGRANGE_COEFFICIENTS_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/range.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
+
+namespace tachyon::math {
+
+// |LagrangeCoefficientsCache| keeps the Lagrange coefficients of the last
+// |capacity()| (domain, τ, range) triples, so that a verifier evaluating
+// l_first, l_last and l_blind at the same challenge over and over, e.g.,
+// across the proofs of a batch, computes them only once. The domains are
+// keyed by their size, offset and generator, not by their addresses.
+//
+// NOTE: This isn't thread-safe, just like the verifiers holding it.
+template <typename F>
+class LagrangeCoefficientsCache {
+ public:
+  constexpr static size_t kDefaultCapacity = 8;
+
+  explicit LagrangeCoefficientsCache(size_t capacity = kDefaultCapacity)
+      : capacity_(capacity) {
+    CHECK_GT(capacity_, size_t{0});
+  }
+
+  size_t capacity() const { return capacity_; }
+  size_t size() const { return entries_.size(); }
+
+  // Returns |domain.EvaluatePartialLagrangeCoefficients(tau, range)|, which
+  // is computed only if it isn't cached yet. The returned coefficients stay
+  // valid even after being evicted.
+  template <size_t MaxDegree, typename T, bool IsEndInclusive>
+  std::shared_ptr<const std::vector<F>> Get(
+      const UnivariateEvaluationDomain<F, MaxDegree>& domain, const F& tau,
+      base::Range<T, true, IsEndInclusive> range) {
+    Key key{domain.size(), domain.offset(), domain.group_gen(), tau,
+            static_cast<int64_t>(range.from),
+            static_cast<int64_t>(range.from) +
+                static_cast<int64_t>(range.GetSize())};
+    for (const Entry& entry : entries_) {
+      if (entry.key == key) return entry.coefficients;
+    }
+    auto coefficients = std::make_shared<const std::vector<F>>(
+        domain.EvaluatePartialLagrangeCoefficients(tau, range));
+    if (entries_.size() == capacity_) {
+      entries_[next_victim_] = {std::move(key), coefficients};
+      next_victim_ = (next_victim_ + 1) % capacity_;
+    } else {
+      entries_.push_back({std::move(key), coefficients});
+    }
+    return coefficients;
+  }
+
+  // Same as above, but over the whole domain.
+  template <size_t MaxDegree>
+  std::shared_ptr<const std::vector<F>> GetAll(
+      const UnivariateEvaluationDomain<F, MaxDegree>& domain, const F& tau) {
+    return Get(domain, tau, base::Range<size_t>::Until(domain.size()));
+  }
+
+  void Clear() {
+    entries_.clear();
+    next_victim_ = 0;
+  }
+
+ private:
+  struct Key {
+    size_t domain_size;
+    F offset;
+    F group_gen;
+    F tau;
+    // The range of the indices, [|from|, |to|).
+    int64_t from;
+    int64_t to;
+
+    bool operator==(const Key& other) const {
+      return domain_size == other.domain_size && offset == other.offset &&
+             group_gen == other.group_gen && tau == other.tau &&
+             from == other.from && to == other.to;
+    }
+  };
+
+  struct Entry {
+    Key key;
+    std::shared_ptr<const std::vector<F>> coefficients;
+  };
+
+  size_t capacity_;
+  // The entries are evicted in the order of insertion.
+  std::vector<Entry> entries_;
+  size_t next_victim_ = 0;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_LAGRANGE_COEFFICIENTS_CACHE_H_
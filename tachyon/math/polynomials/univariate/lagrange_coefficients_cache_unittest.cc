@@ -0,0 +1,54 @@
+#include "tachyon/math/polynomials/univariate/lagrange_coefficients_cache.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn254::Fr;
+
+constexpr size_t kMaxDegree = 31;
+
+using Domain = Radix2EvaluationDomain<F, kMaxDegree>;
+
+class LagrangeCoefficientsCacheTest : public FiniteFieldTest<F> {};
+
+}  // namespace
+
+TEST_F(LagrangeCoefficientsCacheTest, Get) {
+  std::unique_ptr<Domain> domain = Domain::Create(kMaxDegree + 1);
+  std::unique_ptr<Domain> small_domain = Domain::Create(16);
+  F tau = F::Random();
+  base::Range<int32_t, true, true> range(-3, 0);
+
+  LagrangeCoefficientsCache<F> cache(2);
+  std::shared_ptr<const std::vector<F>> coeffs = cache.Get(*domain, tau, range);
+  EXPECT_EQ(*coeffs, domain->EvaluatePartialLagrangeCoefficients(tau, range));
+  // A hit returns the cached coefficients.
+  EXPECT_EQ(cache.Get(*domain, tau, range), coeffs);
+  EXPECT_EQ(cache.size(), size_t{1});
+
+  // The domain, τ and the range are all a part of the key.
+  std::shared_ptr<const std::vector<F>> all_coeffs = cache.GetAll(*domain, tau);
+  EXPECT_EQ(*all_coeffs, domain->EvaluateAllLagrangeCoefficients(tau));
+  EXPECT_EQ(*cache.GetAll(*small_domain, tau),
+            small_domain->EvaluateAllLagrangeCoefficients(tau));
+  EXPECT_EQ(cache.size(), size_t{2});
+
+  // The oldest entry has been evicted, but it's still valid.
+  EXPECT_NE(cache.Get(*domain, tau, range), coeffs);
+  EXPECT_EQ(*coeffs, domain->EvaluatePartialLagrangeCoefficients(tau, range));
+
+  cache.Clear();
+  EXPECT_EQ(cache.size(), size_t{0});
+}
+
+}  // namespace tachyon::math
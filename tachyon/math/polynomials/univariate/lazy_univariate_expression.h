@@ -0,0 +1,376 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_LAZY_UNIVARIATE_EXPRESSION_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_LAZY_UNIVARIATE_EXPRESSION_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/packed_fr.h"
+#include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
+#include "tachyon/math/finite_fields/koala_bear/packed_koala_bear.h"
+#include "tachyon/math/finite_fields/mersenne31/packed_mersenne31.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+// A lazy expression over |UnivariateEvaluations| or
+// |UnivariateDensePolynomial|. Each operator only builds a node, and the whole
+// expression is evaluated in a single parallel pass by |Evaluate()|, which
+// doesn't materialize a temporary per operator:
+//
+//   Poly r = ((Lazy(a) * b - c) * y + d).Evaluate();
+//
+// The operands of an expression must outlive its evaluation. On the
+// coefficient form, only the linear operations are supported, i.e., a
+// polynomial can't be multiplied by another and a scalar can only multiply.
+
+namespace tachyon::math {
+namespace internal {
+
+template <typename Poly>
+struct LazyPolynomialTraits {};
+
+template <typename F, size_t MaxDegree>
+struct LazyPolynomialTraits<UnivariateEvaluations<F, MaxDegree>> {
+  using Poly = UnivariateEvaluations<F, MaxDegree>;
+
+  constexpr static bool kIsCoefficientForm = false;
+
+  static absl::Span<const F> GetValues(const Poly& poly) {
+    return poly.evaluations();
+  }
+
+  static Poly Create(std::vector<F>&& values, bool bit_reversed) {
+    Poly ret(std::move(values));
+    ret.set_bit_reversed(bit_reversed);
+    return ret;
+  }
+};
+
+template <typename F, size_t MaxDegree>
+struct LazyPolynomialTraits<UnivariateDensePolynomial<F, MaxDegree>> {
+  using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+
+  constexpr static bool kIsCoefficientForm = true;
+
+  static absl::Span<const F> GetValues(const Poly& poly) {
+    return poly.coefficients().coefficients();
+  }
+
+  static Poly Create(std::vector<F>&& values, bool bit_reversed) {
+    return Poly(typename Poly::Coefficients(std::move(values), true));
+  }
+};
+
+template <typename T, typename SFINAE = void>
+struct IsLazyPolynomial : std::false_type {};
+
+template <typename T>
+struct IsLazyPolynomial<T, decltype(void(LazyPolynomialTraits<T>::Create))>
+    : std::true_type {};
+
+// The packed value the expression runs on. |F| stands in for a missing
+// |PackedField|, in which case the packed path isn't taken.
+template <typename F>
+using LazyPacked =
+    std::conditional_t<std::is_void_v<typename PackedFieldTraits<F>::PackedField>,
+                       F, typename PackedFieldTraits<F>::PackedField>;
+
+// The sizes and the order of the polynomials referred to by an expression.
+struct LazyShape {
+  size_t min_size = std::numeric_limits<size_t>::max();
+  size_t max_size = 0;
+  size_t num_polys = 0;
+  bool bit_reversed = false;
+
+  void Add(size_t size, bool poly_bit_reversed) {
+    if (num_polys == 0) {
+      bit_reversed = poly_bit_reversed;
+    } else {
+      CHECK_EQ(bit_reversed, poly_bit_reversed);
+    }
+    min_size = std::min(min_size, size);
+    max_size = std::max(max_size, size);
+    ++num_polys;
+  }
+};
+
+// The base of the nodes, which are |LazyPoly|, |LazyScalar|, |LazyNegation|
+// and |LazyBinary|. A node provides:
+//
+// - |Field| and |Poly|, which is void for a scalar.
+// - |At(i)|: the i-th value, which is zero past the end of a polynomial.
+// - |PackedAt(i)|: the i-th packed value, which must be in range.
+// - |AddToShape(shape)|
+template <typename Derived>
+class LazyExpression {
+ public:
+  // Evaluates the expression in a single pass. This returns the polynomial
+  // of the operands.
+  auto Evaluate() const {
+    const Derived& expr = static_cast<const Derived&>(*this);
+    using F = typename Derived::Field;
+    using Poly = typename Derived::Poly;
+    using PackedField = typename PackedFieldTraits<F>::PackedField;
+
+    LazyShape shape;
+    expr.AddToShape(shape);
+    if constexpr (!LazyPolynomialTraits<Poly>::kIsCoefficientForm) {
+      // NOTE: An empty vector is the zero polynomial, which is read as zeros.
+      CHECK(shape.min_size == 0 || shape.min_size == shape.max_size)
+          << "Evaluation sizes unequal";
+    }
+
+    std::vector<F> values(shape.max_size);
+    size_t num_packed = 0;
+    if constexpr (!std::is_void_v<PackedField>) {
+      constexpr size_t N = PackedField::N;
+
+      // NOTE: Unlike |F|, |PackedField| has constants that must be set up
+      // before its first use.
+      [[maybe_unused]] static bool packed_field_initialized = []() {
+        PackedField::Init();
+        return true;
+      }();
+
+      num_packed = shape.min_size / N;
+      PackedField* packed_values =
+          reinterpret_cast<PackedField*>(values.data());
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < num_packed; ++i) {
+        packed_values[i] = expr.PackedAt(i);
+      }
+      num_packed *= N;
+    }
+    OPENMP_PARALLEL_FOR(size_t i = num_packed; i < values.size(); ++i) {
+      values[i] = expr.At(i);
+    }
+    return LazyPolynomialTraits<Poly>::Create(std::move(values),
+                                              shape.bit_reversed);
+  }
+};
+
+template <typename Poly_>
+class LazyPoly : public LazyExpression<LazyPoly<Poly_>> {
+ public:
+  using Poly = Poly_;
+  using Field = typename Poly::Field;
+  using Packed = LazyPacked<Field>;
+
+  explicit LazyPoly(const Poly& poly)
+      : values_(LazyPolynomialTraits<Poly>::GetValues(poly)) {
+    if constexpr (!LazyPolynomialTraits<Poly>::kIsCoefficientForm) {
+      bit_reversed_ = poly.bit_reversed();
+    }
+  }
+
+  Field At(size_t i) const {
+    return i < values_.size() ? values_[i] : Field::Zero();
+  }
+
+  const Packed& PackedAt(size_t i) const {
+    return reinterpret_cast<const Packed*>(values_.data())[i];
+  }
+
+  void AddToShape(LazyShape& shape) const {
+    shape.Add(values_.size(), bit_reversed_);
+  }
+
+ private:
+  absl::Span<const Field> values_;
+  bool bit_reversed_ = false;
+};
+
+template <typename F>
+class LazyScalar : public LazyExpression<LazyScalar<F>> {
+ public:
+  using Poly = void;
+  using Field = F;
+  using Packed = LazyPacked<F>;
+
+  explicit LazyScalar(const F& scalar) : scalar_(scalar) {
+    if constexpr (std::is_same_v<Packed, F>) {
+      packed_scalar_ = scalar;
+    } else {
+      packed_scalar_ = Packed::Broadcast(scalar);
+    }
+  }
+
+  const F& At(size_t i) const { return scalar_; }
+
+  const Packed& PackedAt(size_t i) const { return packed_scalar_; }
+
+  void AddToShape(LazyShape& shape) const {}
+
+ private:
+  F scalar_;
+  Packed packed_scalar_;
+};
+
+template <typename Expr>
+class LazyNegation : public LazyExpression<LazyNegation<Expr>> {
+ public:
+  using Poly = typename Expr::Poly;
+  using Field = typename Expr::Field;
+  using Packed = LazyPacked<Field>;
+
+  explicit LazyNegation(const Expr& expr) : expr_(expr) {}
+
+  Field At(size_t i) const { return -expr_.At(i); }
+
+  Packed PackedAt(size_t i) const { return -expr_.PackedAt(i); }
+
+  void AddToShape(LazyShape& shape) const { expr_.AddToShape(shape); }
+
+ private:
+  Expr expr_;
+};
+
+struct LazyAdd {
+  template <typename T>
+  T operator()(const T& l, const T& r) const {
+    return l + r;
+  }
+};
+
+struct LazySub {
+  template <typename T>
+  T operator()(const T& l, const T& r) const {
+    return l - r;
+  }
+};
+
+struct LazyMul {
+  template <typename T>
+  T operator()(const T& l, const T& r) const {
+    return l * r;
+  }
+};
+
+template <typename Op, typename L, typename R>
+class LazyBinary : public LazyExpression<LazyBinary<Op, L, R>> {
+ public:
+  using Poly = std::conditional_t<std::is_void_v<typename L::Poly>,
+                                  typename R::Poly, typename L::Poly>;
+  using Field = typename L::Field;
+  using Packed = LazyPacked<Field>;
+
+  static_assert(std::is_same_v<Field, typename R::Field>,
+                "The fields of the operands must be the same");
+  static_assert(std::is_void_v<typename L::Poly> ||
+                    std::is_void_v<typename R::Poly> ||
+                    std::is_same_v<typename L::Poly, typename R::Poly>,
+                "The polynomials of the operands must be the same");
+
+  LazyBinary(const L& l, const R& r) : l_(l), r_(r) {
+    if constexpr (LazyPolynomialTraits<Poly>::kIsCoefficientForm) {
+      constexpr bool kHasScalar =
+          std::is_void_v<typename L::Poly> || std::is_void_v<typename R::Poly>;
+      static_assert(std::is_same_v<Op, LazyMul> ? kHasScalar : !kHasScalar,
+                    "Only linear operations are supported on the coefficient "
+                    "form");
+    }
+  }
+
+  Field At(size_t i) const { return Op()(l_.At(i), r_.At(i)); }
+
+  Packed PackedAt(size_t i) const {
+    return Op()(l_.PackedAt(i), r_.PackedAt(i));
+  }
+
+  void AddToShape(LazyShape& shape) const {
+    l_.AddToShape(shape);
+    r_.AddToShape(shape);
+  }
+
+ private:
+  L l_;
+  R r_;
+};
+
+template <typename T>
+constexpr bool kIsLazyExpression =
+    std::is_base_of_v<LazyExpression<T>, T>;
+
+// Wraps an operand of an operator into a node.
+template <typename F, typename T>
+auto ToLazy(const T& operand) {
+  if constexpr (kIsLazyExpression<T>) {
+    return operand;
+  } else if constexpr (IsLazyPolynomial<T>::value) {
+    return LazyPoly<T>(operand);
+  } else {
+    return LazyScalar<F>(operand);
+  }
+}
+
+template <typename T, typename F>
+constexpr bool kIsLazyOperandOf =
+    kIsLazyExpression<T> || IsLazyPolynomial<T>::value || std::is_same_v<T, F>;
+
+// Whether |L| and |R| are the operands of a lazy operator, one of which must
+// be a lazy expression.
+template <typename L, typename R, typename SFINAE = void>
+struct IsLazyOperands : std::false_type {};
+
+template <typename L, typename R>
+struct IsLazyOperands<L, R,
+                      std::enable_if_t<kIsLazyExpression<L> ||
+                                       kIsLazyExpression<R>>> {
+  using Expr = std::conditional_t<kIsLazyExpression<L>, L, R>;
+  using F = typename Expr::Field;
+  constexpr static bool value =
+      kIsLazyOperandOf<L, F> && kIsLazyOperandOf<R, F>;
+};
+
+template <typename Op, typename L, typename R>
+auto MakeLazyBinary(const L& l, const R& r) {
+  using F = typename IsLazyOperands<L, R>::F;
+  auto lazy_l = ToLazy<F>(l);
+  auto lazy_r = ToLazy<F>(r);
+  return LazyBinary<Op, decltype(lazy_l), decltype(lazy_r)>(lazy_l, lazy_r);
+}
+
+template <typename L, typename R,
+          std::enable_if_t<IsLazyOperands<L, R>::value>* = nullptr>
+auto operator+(const L& l, const R& r) {
+  return MakeLazyBinary<LazyAdd>(l, r);
+}
+
+template <typename L, typename R,
+          std::enable_if_t<IsLazyOperands<L, R>::value>* = nullptr>
+auto operator-(const L& l, const R& r) {
+  return MakeLazyBinary<LazySub>(l, r);
+}
+
+template <typename L, typename R,
+          std::enable_if_t<IsLazyOperands<L, R>::value>* = nullptr>
+auto operator*(const L& l, const R& r) {
+  return MakeLazyBinary<LazyMul>(l, r);
+}
+
+template <typename Expr,
+          std::enable_if_t<kIsLazyExpression<Expr>>* = nullptr>
+auto operator-(const Expr& expr) {
+  return LazyNegation<Expr>(expr);
+}
+
+}  // namespace internal
+
+// Starts a lazy expression on |poly|, which must outlive its evaluation.
+template <typename Poly,
+          std::enable_if_t<internal::IsLazyPolynomial<Poly>::value>* = nullptr>
+internal::LazyPoly<Poly> Lazy(const Poly& poly) {
+  return internal::LazyPoly<Poly>(poly);
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_LAZY_UNIVARIATE_EXPRESSION_H_
@@ -0,0 +1,65 @@
+#include "tachyon/math/polynomials/univariate/lazy_univariate_expression.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::math {
+
+namespace {
+
+// NOTE: The size isn't a multiple of the number of lanes of
+// |PackedBabyBear|, so that both the packed and the scalar paths are taken.
+constexpr size_t kMaxDegree = 36;
+
+template <typename F>
+class LazyUnivariateExpressionTest : public FiniteFieldTest<F> {};
+
+}  // namespace
+
+using FieldTypes = testing::Types<GF7, BabyBear>;
+TYPED_TEST_SUITE(LazyUnivariateExpressionTest, FieldTypes);
+
+TYPED_TEST(LazyUnivariateExpressionTest, Evaluations) {
+  using F = TypeParam;
+  using Poly = UnivariateEvaluations<F, kMaxDegree>;
+
+  Poly a = Poly::Random(kMaxDegree);
+  Poly b = Poly::Random(kMaxDegree);
+  Poly c = Poly::Random(kMaxDegree);
+  Poly d = Poly::Random(kMaxDegree);
+  F y = F::Random();
+
+  EXPECT_EQ(((Lazy(a) * b - c) * y + d).Evaluate(), (a * b - c) * y + d);
+  EXPECT_EQ((-(Lazy(a) * y) + b * c).Evaluate(), -(a * y) + b * c);
+  Poly ys(std::vector<F>(kMaxDegree + 1, y));
+  EXPECT_EQ((Lazy(a) + y).Evaluate(), a + ys);
+
+  // The zero polynomial is read as zeros.
+  EXPECT_EQ((Lazy(a) * b + Poly::Zero()).Evaluate(), a * b);
+
+  a.set_bit_reversed(true);
+  b.set_bit_reversed(true);
+  EXPECT_TRUE((Lazy(a) - b).Evaluate().bit_reversed());
+}
+
+TYPED_TEST(LazyUnivariateExpressionTest, DenseCoefficients) {
+  using F = TypeParam;
+  using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+  Poly a = Poly::Random(kMaxDegree);
+  Poly b = Poly::Random(kMaxDegree / 2);
+  Poly c = Poly::Random(kMaxDegree - 1);
+  F y = F::Random();
+
+  EXPECT_EQ(((Lazy(a) - b) * y + c).Evaluate(), (a - b) * y + c);
+  EXPECT_EQ((-Lazy(b) + c).Evaluate(), -b + c);
+  // a - a = 0
+  EXPECT_TRUE((Lazy(a) - a).Evaluate().IsZero());
+}
+
+}  // namespace tachyon::math
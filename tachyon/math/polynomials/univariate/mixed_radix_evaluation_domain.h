@@ -19,16 +19,20 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "absl/memory/memory.h"
+#include "absl/types/span.h"
 
-#include "tachyon/base/bits.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/numerics/checked_math.h"
-#include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/base/tuning_profile.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 
@@ -58,14 +62,18 @@ class MixedRadixEvaluationDomain
   using SparsePoly = UnivariateSparsePolynomial<F, MaxDegree>;
 
   constexpr static size_t kMaxDegree = MaxDegree;
+  // Factor that determines if a the degree aware FFT should be called.
+  constexpr static size_t kDegreeAwareFFTThresholdFactor = 1 << 2;
 
-  constexpr static std::unique_ptr<MixedRadixEvaluationDomain> Create(
+  static std::unique_ptr<MixedRadixEvaluationDomain> Create(
       size_t num_coeffs) {
     size_t size = 0;
     PrimeFieldFactors factors;
     CHECK(ComputeSizeAndFactors(num_coeffs, &size, &factors));
-    return absl::WrapUnique(
+    auto ret = absl::WrapUnique(
         new MixedRadixEvaluationDomain(size, factors.two_adicity));
+    ret->PrepareRootsVecCache();
+    return ret;
   }
 
   constexpr static bool IsValidNumCoeffs(size_t num_coeffs) {
@@ -84,19 +92,47 @@ class MixedRadixEvaluationDomain
     return absl::WrapUnique(new MixedRadixEvaluationDomain(*this));
   }
 
+  // Returns the factor of the tuning profile for the size of |this| if it is
+  // set, or |kDegreeAwareFFTThresholdFactor| otherwise. See
+  // |base::TuningProfile|.
+  size_t GetDegreeAwareFFTThresholdFactor() const {
+    return base::TuningProfile::GetDefault()
+        .GetSize(base::TuningProfile::kDegreeAwareFFTThresholdFactor,
+                 this->size_)
+        .value_or(kDegreeAwareFFTThresholdFactor);
+  }
+
   // UnivariateEvaluationDomain methods
-  constexpr void DoFFT(Evals& evals) const override {
+  void DoFFT(Evals& evals) const override {
+    base::ThroughputMetrics::Scope scope =
+        Base::GetFFTMetrics(/*inverse=*/false).Measure(this->size_);
+    // The degree aware FFT splits the domain into 2ʳ cosets, where 2ʳ is the
+    // largest power of 2 dividing the size of the domain whose cosets are
+    // still as large as the polynomial.
+    uint32_t log_r = 0;
+    while (log_r < this->log_size_of_group_ &&
+           evals.evaluations_.size() * (size_t{2} << log_r) <= this->size_) {
+      ++log_r;
+    }
+    if ((size_t{1} << log_r) >= GetDegreeAwareFFTThresholdFactor()) {
+      DegreeAwareFFTInPlace(evals, log_r);
+      return;
+    }
     if (!this->offset_.IsOne()) {
       Base::DistributePowers(evals, this->offset_);
     }
     evals.evaluations_.resize(this->size_, F::Zero());
-    BestFFT(evals, this->group_gen_);
+    RunFFT(evals.evaluations_.data(), 1, this->size_, this->log_size_of_group_,
+           *twiddles_);
   }
 
   // UnivariateEvaluationDomain methods
-  CONSTEXPR_IF_NOT_OPENMP void DoIFFT(DensePoly& poly) const override {
+  void DoIFFT(DensePoly& poly) const override {
+    base::ThroughputMetrics::Scope scope =
+        Base::GetFFTMetrics(/*inverse=*/true).Measure(this->size_);
     poly.coefficients_.coefficients_.resize(this->size_, F::Zero());
-    BestFFT(poly, this->group_gen_inv_);
+    RunFFT(poly.coefficients_.coefficients_.data(), 1, this->size_,
+           this->log_size_of_group_, *inv_twiddles_);
     if (this->offset_.IsOne()) {
       // clang-format off
       OPENMP_PARALLEL_FOR(F& coeff : poly.coefficients_.coefficients_) {
@@ -167,39 +203,131 @@ class MixedRadixEvaluationDomain
     return best;
   }
 
-  template <typename PolyOrEvals>
-  void BestFFT(PolyOrEvals& poly_or_evals, const F& omega) const {
-#if defined(TACHYON_HAS_OPENMP)
-    uint32_t thread_nums = static_cast<uint32_t>(omp_get_max_threads());
-    uint32_t log_thread_nums = base::bits::Log2Floor(thread_nums);
-    if (this->log_size_of_group_ <= log_thread_nums) {
-#endif
-      return SerialFFT(poly_or_evals, omega, this->log_size_of_group_);
-#if defined(TACHYON_HAS_OPENMP)
-    } else {
-      return ParallelFFT(poly_or_evals, omega, this->log_size_of_group_,
-                         log_thread_nums);
+  // Twiddles of the passes of |RunFFT()| for a domain of size n = qᵗ * 2ˢ
+  // generated by ω, where q is |F::Config::kSmallSubgroupBase|. Since the
+  // twiddles of a pass only depend on the size of its sub-FFTs, they are
+  // shared with the FFTs of size n / 2ᵏ generated by ω^(2ᵏ).
+  struct Twiddles {
+    // |qth_roots[i]| is (ω^(n / q))ⁱ for 0 ≤ i < q.
+    std::vector<F> qth_roots;
+    // |q_roots_vec[p]| holds ωₘʲ for 0 ≤ j < m, where m = qᵖ and
+    // ωₘ = ω^(n / (q * m)), for the p-th radix-q pass.
+    std::vector<std::vector<F>> q_roots_vec;
+    // |roots_vec[p]| holds ωₘʲ for 0 ≤ j < m, where m = qᵗ * 2ᵖ and
+    // ωₘ = ω^(n / (2 * m)), for the p-th radix-2 pass.
+    std::vector<std::vector<F>> roots_vec;
+  };
+
+  static std::shared_ptr<const Twiddles> ComputeTwiddles(
+      const F& omega, size_t n, uint32_t two_adicity) {
+    constexpr size_t kQ = F::Config::kSmallSubgroupBase;
+    uint32_t q_adicity = ComputeQAdicity(n, two_adicity);
+
+    auto twiddles = std::make_shared<Twiddles>();
+    if (q_adicity > 0) {
+      twiddles->qth_roots = F::GetSuccessivePowers(kQ, omega.Pow(n / kQ));
     }
-#endif
+    size_t m = 1;
+    twiddles->q_roots_vec.reserve(q_adicity);
+    for (uint32_t p = 0; p < q_adicity; ++p, m *= kQ) {
+      twiddles->q_roots_vec.push_back(
+          F::GetSuccessivePowers(m, omega.Pow(n / (kQ * m))));
+    }
+    twiddles->roots_vec.reserve(two_adicity);
+    for (uint32_t p = 0; p < two_adicity; ++p, m *= 2) {
+      twiddles->roots_vec.push_back(
+          F::GetSuccessivePowers(m, omega.Pow(n / (2 * m))));
+    }
+    return twiddles;
   }
 
-  template <typename PolyOrEvals>
-  static void SerialFFT(PolyOrEvals& a, const F& omega, uint32_t two_adicity) {
-    // Conceptually, this FFT first splits into 2 sub-arrays |two_adicity| many
-    // times, and then splits into q sub-arrays |q_adicity| many times.
+  void PrepareRootsVecCache() {
+    twiddles_ = ComputeTwiddles(this->group_gen_, this->size_,
+                                this->log_size_of_group_);
+    inv_twiddles_ = ComputeTwiddles(this->group_gen_inv_, this->size_,
+                                    this->log_size_of_group_);
+  }
 
-    size_t n = a.NumElements();
-    uint64_t q = uint64_t{F::Config::kSmallSubgroupBase};
-    uint64_t n_u64 = n;
+  // Returns t, where |n| = qᵗ * 2^|two_adicity|.
+  constexpr static uint32_t ComputeQAdicity(size_t n, uint32_t two_adicity) {
+    constexpr size_t kQ = F::Config::kSmallSubgroupBase;
+    size_t q_part = n >> two_adicity;
+    DCHECK_EQ(q_part << two_adicity, n);
+    uint32_t q_adicity = 0;
+    while (q_part > 1) {
+      DCHECK_EQ(q_part % kQ, size_t{0});
+      q_part /= kQ;
+      ++q_adicity;
+    }
+    return q_adicity;
+  }
+
+  // Evaluates a polynomial of |evals.evaluations_.size()| coefficients over
+  // this domain. The domain is split into the 2ʳ cosets ωʲ * H, where H is
+  // generated by ω^(2ʳ). Since the polynomial has at most n / 2ʳ
+  // coefficients, the evaluations over ωʲ * H are an FFT of size n / 2ʳ of
+  // the coefficients multiplied by (ωʲ)ⁱ, which skips the r radix-2 passes
+  // that would only combine the zero padding. The j-th FFT runs on the
+  // elements at j, j + 2ʳ, j + 2 * 2ʳ, ..., which is where its evaluations
+  // belong.
+  void DegreeAwareFFTInPlace(Evals& evals, uint32_t log_r) const {
+    if (!this->offset_.IsOne()) {
+      Base::DistributePowers(evals, this->offset_);
+    }
+    size_t n = this->size_;
+    size_t r = size_t{1} << log_r;
+    size_t num_coeffs = evals.evaluations_.size();
+    evals.evaluations_.resize(n, F::Zero());
+    SpreadCoefficients(evals.evaluations_, num_coeffs, r, this->group_gen_);
+    for (size_t j = 0; j < r; ++j) {
+      RunFFT(&evals.evaluations_[j], r, n / r,
+             this->log_size_of_group_ - log_r, *twiddles_);
+    }
+  }
 
-    uint32_t q_adicity = ComputeAdicity(q, gmp::FromUnsignedInt(n_u64));
-    uint64_t q_part = static_cast<uint64_t>(std::pow(q, q_adicity));
-    uint64_t two_part =
-        static_cast<uint64_t>(std::pow(uint64_t{2}, two_adicity));
+  // Sets |a[r * c + j]| to |a[c]| * ω^(j * c) for 0 ≤ c < |num_coeffs| and
+  // 0 ≤ j < |r|. The coefficients in [⌈hi / r⌉, hi) are spread to positions
+  // that are at least |hi|, so they are spread in parallel before the ones
+  // below them are overwritten.
+  static void SpreadCoefficients(std::vector<F>& a, size_t num_coeffs,
+                                 size_t r, const F& omega) {
+    DCHECK_GE(r, size_t{2});
+    size_t hi = num_coeffs;
+    while (hi > 1) {
+      size_t lo = (hi + r - 1) / r;
+      absl::Span<F> coeffs(&a[lo], hi - lo);
+      base::Parallelize(coeffs, [&a, lo, r, &omega](absl::Span<F> chunk,
+                                                    size_t chunk_idx,
+                                                    size_t chunk_size) {
+        size_t c = lo + chunk_idx * chunk_size;
+        F w = omega.Pow(c);
+        for (size_t i = 0; i < chunk.size(); ++i, ++c) {
+          F v = chunk[i];
+          for (size_t j = 0; j < r; ++j) {
+            a[r * c + j] = v;
+            v *= w;
+          }
+          w *= omega;
+        }
+      });
+      hi = lo;
+    }
+    if (num_coeffs > 0) {
+      std::fill(a.begin() + 1, a.begin() + r, a[0]);
+    }
+  }
 
-    CHECK_EQ(n_u64, q_part * two_part);
+  // Runs the FFT in place on the |n| elements |a[0]|, |a[stride]|, ...,
+  // |a[(n - 1) * stride]|, where |n| = qᵗ * 2^|two_adicity|.
+  // Conceptually, this FFT first splits into 2 sub-arrays |two_adicity| many
+  // times, and then splits into q sub-arrays t many times. Every pass is
+  // distributed over the threads.
+  static void RunFFT(F* a, size_t stride, size_t n, uint32_t two_adicity,
+                     const Twiddles& twiddles) {
+    constexpr size_t kQ = F::Config::kSmallSubgroupBase;
+    uint32_t q_adicity = ComputeQAdicity(n, two_adicity);
+    auto at = [a, stride](size_t i) -> F& { return a[i * stride]; };
 
-    size_t m = 1;
     if (q_adicity > 0) {
       // If we're using the other radix, we have to do two things differently
       // than in the radix 2 case. 1. Applying the index permutation is a bit
@@ -215,159 +343,64 @@ class MixedRadixEvaluationDomain
       std::vector<bool> seen(n, false);
       for (size_t k = 0; k < n; ++k) {
         size_t i = k;
-        F& a_i = a.at(i);
+        F& a_i = at(i);
         while (!seen[i]) {
-          size_t dest = MixedRadixFFTPermute(two_adicity, q_adicity, q, n, i);
-          std::swap(a.at(dest), a_i);
+          size_t dest =
+              MixedRadixFFTPermute(two_adicity, q_adicity, kQ, n, i);
+          std::swap(at(dest), a_i);
           seen[i] = true;
           i = dest;
         }
       }
-
-      F omega_q = omega.Pow(n / q);
-      std::vector<F> qth_roots(q, F::One());
-      for (size_t i = 1; i < q; ++i) {
-        qth_roots[i] = qth_roots[i - 1] * omega_q;
+    } else {
+      for (size_t i = 0; i < n; ++i) {
+        size_t dest = MixedRadixFFTPermute(two_adicity, 0, kQ, n, i);
+        if (i < dest) std::swap(at(i), at(dest));
       }
+    }
 
-      std::vector<F> terms(q - 1, F::Zero());
-
-      // Doing the q_adicity passes.
-      for (size_t i = 0; i < q_adicity; ++i) {
-        F w_m = omega.Pow(n / (q * m));
-        for (size_t k = 0; k < n; k += q * m) {
-          F w_j = F::One();  // ωⱼ is ωₘʲ
-          for (size_t j = 0; j < m; ++j) {
-            const F& base_term = a[k + j];
-            F w_j_i = w_j;
-            for (size_t i = 1; i < q; ++i) {
-              terms[i - 1] = a[k + j + i * m];
-              terms[i - 1] *= w_j_i;
-              w_j_i *= w_j;
-            }
+    // Doing the q_adicity passes.
+    size_t m = 1;
+    for (uint32_t p = 0; p < q_adicity; ++p, m *= kQ) {
+      const std::vector<F>& roots = twiddles.q_roots_vec[p];
+      OPENMP_PARALLEL_NESTED_FOR(size_t k = 0; k < n; k += kQ * m) {
+        for (size_t j = 0; j < m; ++j) {
+          // ωⱼ is ωₘʲ
+          const F& w_j = roots[j];
+          std::array<F, kQ> terms;
+          terms[0] = at(k + j);
+          F w_j_i = w_j;
+          for (size_t i = 1; i < kQ; ++i) {
+            terms[i] = at(k + j + i * m) * w_j_i;
+            w_j_i *= w_j;
+          }
 
-            for (size_t i = 0; i < q; ++i) {
-              a.at(k + j + i * m) = base_term;
-              for (size_t l = 1; l < q; ++l) {
-                F tmp = terms[l - 1] * qth_roots[(i * l) % q];
-                a.at(k + j + i * m) += tmp;
-              }
+          for (size_t i = 0; i < kQ; ++i) {
+            F& value = at(k + j + i * m);
+            value = terms[0];
+            for (size_t l = 1; l < kQ; ++l) {
+              value += terms[l] * twiddles.qth_roots[(i * l) % kQ];
             }
-
-            w_j *= w_m;
           }
         }
-        m *= q;
       }
-    } else {
-      // Swapping in place (from Storer's book)
-      UnivariateEvaluationDomain<F, MaxDegree>::SwapElements(a, n, two_adicity);
     }
 
-    for (size_t i = 0; i < two_adicity; ++i) {
+    for (uint32_t p = 0; p < two_adicity; ++p, m *= 2) {
       // ωₘ is 2ˢ-th root of unity now
-      F w_m = omega.Pow(n / (2 * m));
-      for (size_t k = 0; k < n; k += 2 * m) {
-        F w = F::One();
+      const std::vector<F>& roots = twiddles.roots_vec[p];
+      OPENMP_PARALLEL_NESTED_FOR(size_t k = 0; k < n; k += 2 * m) {
         for (size_t j = 0; j < m; ++j) {
-          UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn(
-              a.at(k + j), a.at((k + m) + j), w);
-          w *= w_m;
+          Base::template ButterflyFnOutIn<F>(at(k + j), at((k + m) + j),
+                                             roots[j]);
         }
       }
-      m *= 2;
     }
   }
 
-#if defined(TACHYON_HAS_OPENMP)
-  template <typename PolyOrEvals>
-  static void ParallelFFT(PolyOrEvals& a, const F& omega, uint32_t two_adicity,
-                          uint32_t log_num_threads) {
-    CHECK_GE(two_adicity, log_num_threads);
-    // For documentation purposes, comments explain things
-    // as though |a| is a polynomial that we are trying to evaluate.
-
-    // Partition |a| equally into the number of threads.
-    // each partition is then of size m / num_threads.
-    size_t m = a.NumElements();
-    size_t num_threads = size_t{1} << (log_num_threads);
-    size_t num_cosets = num_threads;
-    CHECK_EQ(m % num_threads, size_t{0});
-    size_t coset_size = m / num_threads;
-
-    // We compute the FFT non-mutatively first in |tmp| first,
-    // and then shuffle it back into |a|.
-    // The evaluations are going to be arranged in cosets, each of size |a| /
-    // |num_threads|. so the first coset is (1, g^{|num_cosets|}, g^{2 *
-    // |num_cosets|}, etc.) the second coset is (g, g^{1 + |num_cosets|}, g^{1 +
-    // 2 * |num_cosets|}, etc.) These are cosets with generator
-    // g^{|num_cosets|}, and varying shifts.
-    std::vector<PolyOrEvals> tmp(num_cosets, PolyOrEvals::Zero(coset_size - 1));
-    F new_omega = omega.Pow(num_cosets);
-    uint32_t new_two_adicity =
-        ComputeAdicity(2, gmp::FromUnsignedInt(coset_size));
-
-    // For each coset, we first build a polynomial of degree |coset size|,
-    // whose evaluations over coset k will agree with the evaluations of a over
-    // the coset. Denote the kth such polynomial as poly_k
-#pragma omp parallel for
-    for (size_t k = 0; k < tmp.size(); ++k) {
-      PolyOrEvals& kth_poly_coeffs = tmp[k];
-      // Shuffle into a sub-FFT
-      F omega_k = omega.Pow(k);
-      F omega_step = omega.Pow(k * coset_size);
-
-      F elt = F::One();
-      // Construct |kth_poly_coeffs|, which is a polynomial whose evaluations on
-      // this coset should equal the evaluations of |a| on this coset.
-      // clang-format off
-        // |kth_poly_coeffs[i] = Σ{c in num_cosets} g^{k * (i + c * |coset|)} * a[i + c * |coset|]|
-      // clang-format on
-      // Where c represents the index of the coset being considered. multiplying
-      // by g^{k * i} corresponds to the shift for just being in a different
-      // coset.
-      //
-      // TODO(chokobole): Come back and improve the speed, and make this a more
-      // 'normal'
-      // See
-      // https://github.com/arkworks-rs/algebra/blob/993a4e7ca4ac495c733397dcb7a881b53ab1b18d/poly/src/domain/utils.rs#L151
-      // Cooley-Tukey. This appears to be an FFT of the polynomial
-      // |P(x) = Σ{c in num_cosets} a[i + c |coset|] * x^c|
-      // onto this coset.
-      // However this is being evaluated in time O(N) instead of time
-      // O(|coset|log(|coset|)). If this understanding is the case, its not
-      // doing standard Cooley-Tukey. At the moment, this has time complexity
-      // of at least 2 * N field mul's per thread, so we will be getting
-      // pretty bad parallelism. Exact complexity per thread atm is
-      // |2 * N + (N / num threads)log(N / num threads)| field muls.
-      // Compare to the time complexity of serial is Nlog(N) field muls), with
-      // log(N) in [15, 25]
-      for (size_t i = 0; i < coset_size; ++i) {
-        for (size_t c = 0; c < num_threads; ++c) {
-          size_t idx = i + (c * coset_size);
-          // t = the value of a corresponding to the ith element of
-          // the sth coset.
-          F t = a[idx] * elt;
-          kth_poly_coeffs.at(i) += t;
-          // elt = g^{k * idx}
-          elt *= omega_step;
-        }
-        elt *= omega_k;
-      }
-
-      // Perform sub-FFT
-      // Since the sub-FFT is mutative, after this point
-      // |kth_poly_coeffs| should be renamed |kth_coset_evals|.
-      SerialFFT(kth_poly_coeffs, new_omega, new_two_adicity);
-    }
-
-    // shuffle the values computed above into a
-    // The evaluations of a should be ordered as (1, g, g², ...)
-    for (size_t i = 0; i < a.NumElements(); ++i) {
-      a.at(i) = tmp[i % num_cosets][i / num_cosets];
-    }
-  }
-#endif
+  // The twiddles are shared with the clones of this domain, e.g, its cosets.
+  std::shared_ptr<const Twiddles> twiddles_;
+  std::shared_ptr<const Twiddles> inv_twiddles_;
 };
 
 }  // namespace tachyon::math
@@ -0,0 +1,193 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_MULTIPOINT_EVALUATION_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_MULTIPOINT_EVALUATION_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/optional.h"
+#include "tachyon/math/polynomials/univariate/polynomial_arithmetic.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+namespace tachyon::math {
+
+// |SubproductTree| is a binary tree over the points x₀, x₁, ..., xₙ₋₁ whose
+// leaves are X - xᵢ and whose inner nodes are the products of their children,
+// so that the root is M(X) = (X - x₀)(X - x₁)...(X - xₙ₋₁). It evaluates a
+// polynomial at all of the points and interpolates a polynomial from its
+// evaluations at them with a |FastMul()| or a |FastMod()| per node, which is
+// O(n log² n) instead of the O(n²) of evaluating point by point and of
+// |LagrangeInterpolate()|. The nodes of a level are computed in parallel.
+template <typename F, size_t MaxDegree>
+class SubproductTree {
+ public:
+  using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+  using Coeffs = UnivariateDenseCoefficients<F, MaxDegree>;
+
+  SubproductTree() = default;
+
+  // Builds the tree over |points|, whose size must not exceed |MaxDegree|.
+  static SubproductTree Build(absl::Span<const F> points) {
+    SubproductTree tree;
+    tree.points_ = std::vector<F>(points.begin(), points.end());
+    if (points.empty()) return tree;
+
+    // |levels_[0][i]| is X - xᵢ and |levels_[k][i]| covers the points
+    // x_{i * 2ᵏ}, ..., x_{(i + 1) * 2ᵏ - 1}. When a level has an odd number of
+    // nodes, the last one is carried to the next level as it is.
+    tree.levels_.push_back(
+        base::CreateVector(points.size(), [&points](size_t i) {
+          return Poly(Coeffs({-points[i], F::One()}));
+        }));
+    while (tree.levels_.back().size() > 1) {
+      const std::vector<Poly>& children = tree.levels_.back();
+      std::vector<Poly> parents((children.size() + 1) / 2);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < parents.size(); ++i) {
+        if (2 * i + 1 < children.size()) {
+          parents[i] = FastMul(children[2 * i], children[2 * i + 1]);
+        } else {
+          parents[i] = children[2 * i];
+        }
+      }
+      tree.levels_.push_back(std::move(parents));
+    }
+    return tree;
+  }
+
+  const std::vector<F>& points() const { return points_; }
+
+  // Returns M(X), or 1 if there are no points.
+  Poly GetVanishingPolynomial() const {
+    if (levels_.empty()) return Poly::One();
+    return levels_.back()[0];
+  }
+
+  // Returns P(x₀), P(x₁), ..., P(xₙ₋₁). P is reduced modulo the nodes from the
+  // root down to the level above the leaves, since P(xᵢ) is the evaluation at
+  // xᵢ of P modulo any node above X - xᵢ.
+  std::vector<F> Evaluate(const Poly& poly) const {
+    if (levels_.empty()) return {};
+
+    std::vector<Poly> remainders = {unwrap(FastMod(poly, levels_.back()[0]))};
+    for (size_t k = levels_.size() - 1; k > 1; --k) {
+      const std::vector<Poly>& children = levels_[k - 1];
+      std::vector<Poly> child_remainders(children.size());
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < children.size(); ++i) {
+        child_remainders[i] = unwrap(FastMod(remainders[i / 2], children[i]));
+      }
+      remainders = std::move(child_remainders);
+    }
+
+    std::vector<F> evals(points_.size());
+    size_t leaves_per_node = levels_.size() > 1 ? 2 : 1;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points_.size(); ++i) {
+      evals[i] = remainders[i / leaves_per_node].Evaluate(points_[i]);
+    }
+    return evals;
+  }
+
+  // Interpolates the unique polynomial P of degree less than n such that
+  // P(xᵢ) = |evals[i]|. Returns false if the sizes of |evals| and the points
+  // differ or if the points are not distinct.
+  //
+  // P(X) = Σᵢ yᵢ * M(X) / ((X - xᵢ) * M'(xᵢ)), which is combined from the
+  // leaves up to the root as L(X) * M_R(X) + R(X) * M_L(X), where L and R
+  // are the combinations of the children and M_L and M_R are their nodes.
+  [[nodiscard]] bool Interpolate(absl::Span<const F> evals, Poly* ret) const {
+    if (evals.size() != points_.size()) {
+      LOG(ERROR) << "points and evals sizes don't match";
+      return false;
+    }
+    if (levels_.empty()) {
+      *ret = Poly::Zero();
+      return true;
+    }
+
+    // |weights[i]| = 1 / M'(xᵢ), where M'(xᵢ) is zero if and only if xᵢ is a
+    // repeated root of M.
+    std::vector<F> weights = Evaluate(ComputeDerivative(levels_.back()[0]));
+    if (std::any_of(weights.begin(), weights.end(),
+                    [](const F& weight) { return weight.IsZero(); })) {
+      LOG(ERROR) << "points are not distinct";
+      return false;
+    }
+    CHECK(F::BatchInverseInPlace(weights));
+    std::vector<Poly> combinations =
+        base::CreateVector(weights.size(), [&weights, &evals](size_t i) {
+          return Poly(Coeffs({weights[i] * evals[i]}, true));
+        });
+    for (size_t k = 1; k < levels_.size(); ++k) {
+      const std::vector<Poly>& children = levels_[k - 1];
+      std::vector<Poly> parents((combinations.size() + 1) / 2);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < parents.size(); ++i) {
+        if (2 * i + 1 < combinations.size()) {
+          parents[i] = FastMul(combinations[2 * i], children[2 * i + 1]);
+          parents[i] += FastMul(combinations[2 * i + 1], children[2 * i]);
+        } else {
+          parents[i] = std::move(combinations[2 * i]);
+        }
+      }
+      combinations = std::move(parents);
+    }
+    *ret = std::move(combinations[0]);
+    return true;
+  }
+
+ private:
+  static Poly ComputeDerivative(const Poly& poly) {
+    const std::vector<F>& coefficients = poly.coefficients().coefficients();
+    if (coefficients.size() <= 1) return Poly::Zero();
+    std::vector<F> derivative(coefficients.size() - 1);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < derivative.size(); ++i) {
+      derivative[i] = coefficients[i + 1] * F(i + 1);
+    }
+    return Poly(Coeffs(std::move(derivative), true));
+  }
+
+  std::vector<F> points_;
+  std::vector<std::vector<Poly>> levels_;
+};
+
+// Evaluates every polynomial of |polys| at every point of |points|, where
+// |ret[i][j]| is the evaluation of |polys[i]| at |points[j]|. The powers of
+// each point are computed once and shared by all the polynomials, which suits
+// the openings evaluating many polynomials at a few points.
+template <typename F, size_t MaxDegree>
+std::vector<std::vector<F>> EvaluateMany(
+    absl::Span<const UnivariateDensePolynomial<F, MaxDegree>> polys,
+    absl::Span<const F> points) {
+  size_t max_size = 0;
+  for (const UnivariateDensePolynomial<F, MaxDegree>& poly : polys) {
+    max_size = std::max(max_size, poly.coefficients().coefficients().size());
+  }
+  std::vector<std::vector<F>> powers_vec =
+      base::Map(points, [max_size](const F& point) {
+        return F::GetSuccessivePowers(max_size, point);
+      });
+
+  std::vector<std::vector<F>> ret(polys.size(),
+                                  std::vector<F>(points.size(), F::Zero()));
+  OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < polys.size(); ++i) {
+    for (size_t j = 0; j < points.size(); ++j) {
+      const std::vector<F>& coefficients =
+          polys[i].coefficients().coefficients();
+      const std::vector<F>& powers = powers_vec[j];
+      F& eval = ret[i][j];
+      for (size_t k = 0; k < coefficients.size(); ++k) {
+        eval += coefficients[k] * powers[k];
+      }
+    }
+  }
+  return ret;
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_MULTIPOINT_EVALUATION_H_
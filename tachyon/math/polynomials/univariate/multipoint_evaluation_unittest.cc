@@ -0,0 +1,92 @@
+#include "tachyon/math/polynomials/univariate/multipoint_evaluation.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn254::Fr;
+
+constexpr size_t kMaxDegree = 128;
+
+using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+using Tree = SubproductTree<F, kMaxDegree>;
+
+class MultipointEvaluationTest : public FiniteFieldTest<F> {};
+
+}  // namespace
+
+TEST_F(MultipointEvaluationTest, Evaluate) {
+  // Covers the trees with even and odd numbers of nodes per level.
+  for (size_t num_points : {size_t{1}, size_t{2}, size_t{5}, size_t{16},
+                            size_t{37}}) {
+    SCOPED_TRACE(num_points);
+    std::vector<F> points =
+        base::CreateVector(num_points, []() { return F::Random(); });
+    Tree tree = Tree::Build(points);
+    EXPECT_EQ(tree.GetVanishingPolynomial(), Poly::FromRoots(points));
+
+    for (size_t degree : {size_t{0}, num_points - 1, 2 * num_points}) {
+      Poly poly = Poly::Random(degree);
+      std::vector<F> evals = tree.Evaluate(poly);
+      ASSERT_EQ(evals.size(), num_points);
+      for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(evals[i], poly.Evaluate(points[i]));
+      }
+    }
+  }
+}
+
+TEST_F(MultipointEvaluationTest, Interpolate) {
+  for (size_t num_points : {size_t{1}, size_t{2}, size_t{5}, size_t{16},
+                            size_t{37}}) {
+    SCOPED_TRACE(num_points);
+    std::vector<F> points =
+        base::CreateVector(num_points, []() { return F::Random(); });
+    Poly expected = Poly::Random(num_points - 1);
+    std::vector<F> evals = base::Map(points, [&expected](const F& point) {
+      return expected.Evaluate(point);
+    });
+
+    Tree tree = Tree::Build(points);
+    Poly poly;
+    ASSERT_TRUE(tree.Interpolate(evals, &poly));
+    EXPECT_EQ(poly, expected);
+  }
+}
+
+TEST_F(MultipointEvaluationTest, InterpolateFailure) {
+  std::vector<F> points = {F(1), F(2), F(1)};
+  Tree tree = Tree::Build(points);
+  Poly poly;
+  std::vector<F> evals = {F(3), F(4), F(5)};
+  EXPECT_FALSE(tree.Interpolate(evals, &poly));
+  evals.pop_back();
+  EXPECT_FALSE(tree.Interpolate(evals, &poly));
+}
+
+TEST_F(MultipointEvaluationTest, EvaluateMany) {
+  std::vector<Poly> polys = base::CreateVector(
+      5, [](size_t i) { return Poly::Random(3 * i + 1); });
+  polys.push_back(Poly::Zero());
+  std::vector<F> points = {F::Random(), F::Zero(), F::Random()};
+
+  std::vector<std::vector<F>> evals_vec =
+      EvaluateMany(absl::MakeConstSpan(polys), absl::MakeConstSpan(points));
+  ASSERT_EQ(evals_vec.size(), polys.size());
+  for (size_t i = 0; i < polys.size(); ++i) {
+    ASSERT_EQ(evals_vec[i].size(), points.size());
+    for (size_t j = 0; j < points.size(); ++j) {
+      EXPECT_EQ(evals_vec[i][j], polys[i].Evaluate(points[j]));
+    }
+  }
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,190 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_PACKED_FFT_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_PACKED_FFT_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+
+namespace tachyon::math {
+
+// |PackedFFT| runs the butterfly stages of a radix-2 FFT over a small prime
+// field |F| on its packed prime field |PackedF|, so that every butterfly
+// handles |N| lanes at once. The values are processed in place: |N|
+// consecutive elements are reinterpreted as a single |PackedF|.
+//
+// 1. The stages whose gap is at least |N| pair up whole packed values, whose
+//    twiddles are |N| consecutive elements of the scalar twiddle table.
+// 2. The stages whose gap is smaller than |N| pair up lanes of the same
+//    packed value. They run on tiles of |N| packed values that are transposed
+//    first, so that the lanes of a packed value become |N| packed values and
+//    every twiddle is broadcast to all lanes. The tiles are transposed back
+//    afterwards.
+//
+// Like |CacheBlockedFFT|, the stages that stay within a block of
+// |block_size| elements are fused per block and the results are exactly the
+// same as the ones of the per-stage FFT.
+template <typename PackedF>
+class PackedFFT {
+ public:
+  using F = typename PackedF::PrimeField;
+  using ButterflyFn = void (*)(PackedF&, PackedF&, const PackedF&);
+
+  constexpr static size_t N = PackedF::N;
+  // The number of elements of a tile that is transposed.
+  constexpr static size_t kTileSize = N * N;
+
+  static_assert(sizeof(PackedF) == N * sizeof(F),
+                "PackedF must be laid out as N consecutive elements of F");
+
+  // Returns true if |size| elements can be transformed, which requires at
+  // least a tile.
+  constexpr static bool IsSupported(size_t size) { return size >= kTileSize; }
+
+  // Transposes |tile| as an |N| x |N| matrix whose i-th row is |tile[i]|.
+  static void Transpose(absl::Span<PackedF> tile) {
+    DCHECK_EQ(tile.size(), N);
+    for (size_t i = 0; i < N; ++i) {
+      for (size_t j = i + 1; j < N; ++j) {
+        std::swap(tile[i][j], tile[j][i]);
+      }
+    }
+  }
+
+  // Runs the decimation-in-time stages for gaps |start_gap|, 2 * |start_gap|,
+  // ..., |values.size()| / 2. |roots_vec[k]| must hold the twiddles for the
+  // gap 2ᵏ. See |CacheBlockedFFT::RunOutIn()|.
+  template <ButterflyFn Fn>
+  static void RunOutIn(absl::Span<F> values,
+                       absl::Span<const std::vector<F>> roots_vec,
+                       size_t start_gap, size_t block_size) {
+    size_t size = values.size();
+    CHECK(base::bits::IsPowerOfTwo(size));
+    CHECK(base::bits::IsPowerOfTwo(block_size));
+    CHECK(IsSupported(size));
+    block_size = std::clamp(block_size, kTileSize, size);
+    PackedF* packed = reinterpret_cast<PackedF*>(values.data());
+
+    size_t gap = start_gap;
+    if (2 * gap <= block_size) {
+      OPENMP_PARALLEL_FOR(size_t b = 0; b < size; b += block_size) {
+        PackedF* block = &packed[b / N];
+        if (gap < N) {
+          for (size_t t = 0; t < block_size; t += kTileSize) {
+            absl::Span<PackedF> tile(&block[t / N], N);
+            Transpose(tile);
+            for (size_t g = gap; g < N; g *= 2) {
+              RunTransposedStage<Fn>(
+                  tile, roots_vec[base::bits::Log2Floor(g)], g);
+            }
+            Transpose(tile);
+          }
+        }
+        for (size_t g = std::max(gap, N); g < block_size; g *= 2) {
+          RunStage<Fn>(block, block_size,
+                       roots_vec[base::bits::Log2Floor(g)], g);
+        }
+      }
+      gap = block_size;
+    }
+
+    for (; gap < size; gap *= 2) {
+      const std::vector<F>& roots = roots_vec[base::bits::Log2Floor(gap)];
+      RunStageInParallel<Fn>(packed, size, roots, gap);
+    }
+  }
+
+  // Runs the decimation-in-frequency stages for gaps |values.size()| / 2,
+  // |values.size()| / 4, ..., 1. |roots_vec[k]| must hold the twiddles for
+  // the gap 2ᵏ. See |CacheBlockedFFT::RunInOut()|.
+  template <ButterflyFn Fn>
+  static void RunInOut(absl::Span<F> values,
+                       absl::Span<const std::vector<F>> roots_vec,
+                       size_t block_size) {
+    size_t size = values.size();
+    CHECK(base::bits::IsPowerOfTwo(size));
+    CHECK(base::bits::IsPowerOfTwo(block_size));
+    CHECK(IsSupported(size));
+    block_size = std::clamp(block_size, kTileSize, size);
+    PackedF* packed = reinterpret_cast<PackedF*>(values.data());
+
+    for (size_t gap = size / 2; gap >= block_size; gap /= 2) {
+      const std::vector<F>& roots = roots_vec[base::bits::Log2Floor(gap)];
+      RunStageInParallel<Fn>(packed, size, roots, gap);
+    }
+
+    OPENMP_PARALLEL_FOR(size_t b = 0; b < size; b += block_size) {
+      PackedF* block = &packed[b / N];
+      for (size_t g = block_size / 2; g >= N; g /= 2) {
+        RunStage<Fn>(block, block_size,
+                     roots_vec[base::bits::Log2Floor(g)], g);
+      }
+      for (size_t t = 0; t < block_size; t += kTileSize) {
+        absl::Span<PackedF> tile(&block[t / N], N);
+        Transpose(tile);
+        for (size_t g = N / 2; g > 0; g /= 2) {
+          RunTransposedStage<Fn>(
+              tile, roots_vec[base::bits::Log2Floor(g)], g);
+        }
+        Transpose(tile);
+      }
+    }
+  }
+
+ private:
+  // Loads the twiddles for |N| consecutive butterflies starting from |root|.
+  static const PackedF& LoadRoots(const F& root) {
+    return *reinterpret_cast<const PackedF*>(&root);
+  }
+
+  // Runs a stage of |gap| ≥ |N| on the first |len| elements of |values|.
+  template <ButterflyFn Fn>
+  static void RunStage(PackedF* values, size_t len,
+                       const std::vector<F>& roots, size_t gap) {
+    size_t packed_len = len / N;
+    size_t packed_gap = gap / N;
+    for (size_t i = 0; i < packed_len; i += 2 * packed_gap) {
+      for (size_t j = 0; j < packed_gap; ++j) {
+        Fn(values[i + j], values[i + j + packed_gap], LoadRoots(roots[j * N]));
+      }
+    }
+  }
+
+  // Same as |RunStage()|, but the butterflies of the stage are distributed
+  // over the threads.
+  template <ButterflyFn Fn>
+  static void RunStageInParallel(PackedF* values, size_t len,
+                                 const std::vector<F>& roots, size_t gap) {
+    size_t packed_len = len / N;
+    size_t packed_gap = gap / N;
+    OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < packed_len;
+                               i += 2 * packed_gap) {
+      for (size_t j = 0; j < packed_gap; ++j) {
+        Fn(values[i + j], values[i + j + packed_gap], LoadRoots(roots[j * N]));
+      }
+    }
+  }
+
+  // Runs a stage of |gap| < |N| on a transposed |tile|, where the i-th lanes
+  // of the packed values form the i-th chunk of |N| elements.
+  template <ButterflyFn Fn>
+  static void RunTransposedStage(absl::Span<PackedF> tile,
+                                 const std::vector<F>& roots, size_t gap) {
+    for (size_t i = 0; i < N; i += 2 * gap) {
+      for (size_t j = 0; j < gap; ++j) {
+        Fn(tile[i + j], tile[i + j + gap], PackedF::Broadcast(roots[j]));
+      }
+    }
+  }
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_PACKED_FFT_H_
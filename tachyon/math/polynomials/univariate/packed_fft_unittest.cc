@@ -0,0 +1,128 @@
+#include "tachyon/math/polynomials/univariate/packed_fft.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/polynomials/univariate/cache_blocked_fft.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = BabyBear;
+using PackedF = PackedBabyBear;
+
+constexpr size_t kLogSize = 10;
+constexpr size_t kSize = size_t{1} << kLogSize;
+
+template <typename T>
+void ButterflyFnInOut(T& lo, T& hi, const T& root) {
+  T neg = lo - hi;
+  lo += hi;
+  hi = neg * root;
+}
+
+template <typename T>
+void ButterflyFnOutIn(T& lo, T& hi, const T& root) {
+  hi *= root;
+  T neg = lo - hi;
+  lo += hi;
+  hi = std::move(neg);
+}
+
+class PackedFFTTest : public FiniteFieldTest<PackedF> {
+ public:
+  void SetUp() override {
+    F omega;
+    ASSERT_TRUE(F::GetRootOfUnity(kSize, &omega));
+    // |roots_vec_[k]| holds the twiddles for the gap 2ᵏ.
+    roots_vec_ = base::CreateVector(kLogSize, [&omega](size_t k) {
+      size_t gap = size_t{1} << k;
+      return F::GetSuccessivePowers(gap, omega.Pow(kSize / (2 * gap)));
+    });
+    values_ = base::CreateVector(kSize, []() { return F::Random(); });
+  }
+
+ protected:
+  std::vector<std::vector<F>> roots_vec_;
+  std::vector<F> values_;
+};
+
+}  // namespace
+
+TEST_F(PackedFFTTest, Transpose) {
+  std::vector<PackedF> tile =
+      base::CreateVector(PackedF::N, []() { return PackedF::Random(); });
+  std::vector<PackedF> transposed = tile;
+  PackedFFT<PackedF>::Transpose(absl::MakeSpan(transposed));
+  for (size_t i = 0; i < PackedF::N; ++i) {
+    for (size_t j = 0; j < PackedF::N; ++j) {
+      EXPECT_EQ(transposed[i][j], tile[j][i]);
+    }
+  }
+  PackedFFT<PackedF>::Transpose(absl::MakeSpan(transposed));
+  EXPECT_EQ(transposed, tile);
+}
+
+TEST_F(PackedFFTTest, RunOutIn) {
+  for (size_t start_gap : {size_t{1}, size_t{2}, PackedF::N, size_t{64}}) {
+    std::vector<F> expected = values_;
+    CacheBlockedFFT<F>::RunOutIn<ButterflyFnOutIn<F>>(
+        absl::MakeSpan(expected), roots_vec_, start_gap, kSize);
+
+    for (size_t block_size = 2; block_size <= kSize; block_size *= 2) {
+      SCOPED_TRACE(absl::Substitute("start_gap: $0, block_size: $1",
+                                    start_gap, block_size));
+      std::vector<F> values = values_;
+      PackedFFT<PackedF>::RunOutIn<ButterflyFnOutIn<PackedF>>(
+          absl::MakeSpan(values), roots_vec_, start_gap, block_size);
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+TEST_F(PackedFFTTest, RunInOut) {
+  std::vector<F> expected = values_;
+  CacheBlockedFFT<F>::RunInOut<ButterflyFnInOut<F>>(absl::MakeSpan(expected),
+                                                    roots_vec_, kSize);
+
+  for (size_t block_size = 2; block_size <= kSize; block_size *= 2) {
+    SCOPED_TRACE(absl::Substitute("block_size: $0", block_size));
+    std::vector<F> values = values_;
+    PackedFFT<PackedF>::RunInOut<ButterflyFnInOut<PackedF>>(
+        absl::MakeSpan(values), roots_vec_, block_size);
+    EXPECT_EQ(values, expected);
+  }
+}
+
+TEST_F(PackedFFTTest, Radix2EvaluationDomain) {
+  using Domain = Radix2EvaluationDomain<F>;
+  using DensePoly = Domain::DensePoly;
+  using Evals = Domain::Evals;
+
+  static_assert(Domain::kHasPackedField);
+  std::unique_ptr<Domain> domain = Domain::Create(kSize);
+  DensePoly poly = DensePoly::Random(kSize - 1);
+  Evals evals = domain->FFT(poly);
+  std::vector<F> elements = domain->GetElements();
+  for (size_t i = 0; i < kSize; ++i) {
+    EXPECT_EQ(evals[i], poly.Evaluate(elements[i]));
+  }
+  EXPECT_EQ(domain->IFFT(evals), poly);
+}
+
+TEST_F(PackedFFTTest, IsSupported) {
+  constexpr size_t kTileSize = PackedFFT<PackedF>::kTileSize;
+  EXPECT_FALSE(PackedFFT<PackedF>::IsSupported(kTileSize / 2));
+  EXPECT_TRUE(PackedFFT<PackedF>::IsSupported(kTileSize));
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,325 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_POLYNOMIAL_ARITHMETIC_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_POLYNOMIAL_ARITHMETIC_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/compiler_specific.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/base/arithmetics_results.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+// The operators of |UnivariateDensePolynomial| multiply and divide in the
+// schoolbook way, which is O(n²). The functions below switch to FFT-based
+// multiplication and Newton-iteration division when the operands are large
+// enough for them to pay off. The thresholds below are where the schoolbook
+// methods stop winning for 256-bit fields; rerun
+// polynomial_arithmetic_benchmark.cc to retune them.
+
+namespace tachyon::math {
+
+// |FastMul()| uses |FFTMul()| when both of the operands have at least this
+// many coefficients.
+constexpr size_t kFFTMulThreshold = 64;
+
+// |FastDivMod()| uses |NewtonDivMod()| when both of the divisor and the
+// quotient have at least this many coefficients.
+constexpr size_t kNewtonDivThreshold = 128;
+
+// |DivideByLinearInPlace()| splits the synthetic division over the threads
+// when the dividend has more than this many coefficients.
+constexpr size_t kParallelSyntheticDivisionThreshold = 1 << 14;
+
+namespace internal {
+
+template <typename F, size_t MaxDegree>
+UnivariateDensePolynomial<F, MaxDegree> Truncate(const std::vector<F>& coeffs,
+                                                 size_t size) {
+  size = std::min(size, coeffs.size());
+  return UnivariateDensePolynomial<F, MaxDegree>(
+      UnivariateDenseCoefficients<F, MaxDegree>(
+          std::vector<F>(coeffs.begin(), coeffs.begin() + size), true));
+}
+
+// Returns the first |size| coefficients of the reversal Xᵈ * P(1 / X) of P
+// whose degree is d.
+template <typename F, size_t MaxDegree>
+UnivariateDensePolynomial<F, MaxDegree> Reverse(const std::vector<F>& coeffs,
+                                                size_t size) {
+  size = std::min(size, coeffs.size());
+  std::vector<F> reversed(coeffs.rbegin(), coeffs.rbegin() + size);
+  return UnivariateDensePolynomial<F, MaxDegree>(
+      UnivariateDenseCoefficients<F, MaxDegree>(std::move(reversed), true));
+}
+
+}  // namespace internal
+
+// Returns |a| * |b| by pointwise multiplying their evaluations over a radix-2
+// domain large enough for the product, which is O(n log n).
+template <typename F, size_t MaxDegree>
+UnivariateDensePolynomial<F, MaxDegree> FFTMul(
+    const UnivariateDensePolynomial<F, MaxDegree>& a,
+    const UnivariateDensePolynomial<F, MaxDegree>& b) {
+  using Domain = Radix2EvaluationDomain<F, MaxDegree>;
+  using Evals = typename Domain::Evals;
+
+  if (a.IsZero() || b.IsZero()) {
+    return UnivariateDensePolynomial<F, MaxDegree>::Zero();
+  }
+  size_t num_coeffs = a.Degree() + b.Degree() + 1;
+  CHECK(Domain::IsValidNumCoeffs(num_coeffs));
+  std::unique_ptr<Domain> domain = Domain::Create(num_coeffs);
+  Evals evals = domain->FFT(a);
+  evals *= domain->FFT(b);
+  return domain->IFFT(std::move(evals));
+}
+
+// Returns |a| * |b|, choosing between the schoolbook and the FFT-based
+// multiplication by the sizes of the operands. See |kFFTMulThreshold|.
+template <typename F, size_t MaxDegree>
+UnivariateDensePolynomial<F, MaxDegree> FastMul(
+    const UnivariateDensePolynomial<F, MaxDegree>& a,
+    const UnivariateDensePolynomial<F, MaxDegree>& b) {
+  if constexpr (F::Config::kHasTwoAdicRootOfUnity) {
+    if (!a.IsZero() && !b.IsZero() &&
+        std::min(a.Degree(), b.Degree()) + 1 >= kFFTMulThreshold &&
+        Radix2EvaluationDomain<F, MaxDegree>::IsValidNumCoeffs(
+            a.Degree() + b.Degree() + 1)) {
+      return FFTMul(a, b);
+    }
+  }
+  return a * b;
+}
+
+// Returns G such that |poly| * G ≡ 1 (mod Xⁿ) where n is |size|, doubling the
+// precision of G per Newton iteration G' = G * (2 - |poly| * G). The constant
+// term of |poly| must not be zero.
+template <typename F, size_t MaxDegree>
+UnivariateDensePolynomial<F, MaxDegree> InverseSeries(
+    const UnivariateDensePolynomial<F, MaxDegree>& poly, size_t size) {
+  using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+
+  const std::vector<F>& coeffs = poly.coefficients().coefficients();
+  CHECK(!poly.IsZero() && !coeffs[0].IsZero());
+  std::vector<F> inverse = {*coeffs[0].Inverse()};
+  while (inverse.size() < size) {
+    // If |poly| * G = 1 + Xᵏ * E, then G' = G - Xᵏ * (G * E) (mod X²ᵏ).
+    size_t k = inverse.size();
+    size_t next_k = std::min(2 * k, size);
+    Poly g = internal::Truncate<F, MaxDegree>(inverse, k);
+    Poly product =
+        FastMul(internal::Truncate<F, MaxDegree>(coeffs, next_k), g);
+    const std::vector<F>& product_coeffs =
+        product.coefficients().coefficients();
+    std::vector<F> error;
+    if (product_coeffs.size() > k) {
+      error = std::vector<F>(
+          product_coeffs.begin() + k,
+          product_coeffs.begin() + std::min(product_coeffs.size(), next_k));
+    }
+    Poly correction = FastMul(
+        g, Poly(UnivariateDenseCoefficients<F, MaxDegree>(error, true)));
+    const std::vector<F>& correction_coeffs =
+        correction.coefficients().coefficients();
+    inverse.resize(next_k);
+    for (size_t i = 0; i < std::min(correction_coeffs.size(), next_k - k);
+         ++i) {
+      inverse[k + i] = -correction_coeffs[i];
+    }
+  }
+  return internal::Truncate<F, MaxDegree>(inverse, size);
+}
+
+// Returns the quotient and the remainder of |a| / |b| through the power series
+// inverse of the reversal of |b|, which is O(n log n) with |FastMul()|. |b|
+// must not be zero.
+//
+// If |a| = |b| * Q + R with deg(|a|) = n and deg(|b|) = m, reversing the
+// coefficients gives rev(|a|) ≡ rev(|b|) * rev(Q) (mod Xⁿ⁻ᵐ⁺¹), so
+// rev(Q) = rev(|a|) * rev(|b|)⁻¹ (mod Xⁿ⁻ᵐ⁺¹) and R = |a| - |b| * Q.
+template <typename F, size_t MaxDegree>
+DivResult<UnivariateDensePolynomial<F, MaxDegree>> NewtonDivMod(
+    const UnivariateDensePolynomial<F, MaxDegree>& a,
+    const UnivariateDensePolynomial<F, MaxDegree>& b) {
+  using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+
+  CHECK(!b.IsZero());
+  if (a.IsZero() || a.Degree() < b.Degree()) {
+    return {Poly::Zero(), a};
+  }
+  size_t quotient_size = a.Degree() - b.Degree() + 1;
+  const std::vector<F>& a_coeffs = a.coefficients().coefficients();
+  const std::vector<F>& b_coeffs = b.coefficients().coefficients();
+  Poly rev_b_inv = InverseSeries(
+      internal::Reverse<F, MaxDegree>(b_coeffs, quotient_size), quotient_size);
+  Poly rev_quotient = FastMul(
+      internal::Reverse<F, MaxDegree>(a_coeffs, quotient_size), rev_b_inv);
+
+  std::vector<F> quotient(quotient_size, F::Zero());
+  const std::vector<F>& rev_quotient_coeffs =
+      rev_quotient.coefficients().coefficients();
+  for (size_t i = 0; i < std::min(rev_quotient_coeffs.size(), quotient_size);
+       ++i) {
+    quotient[quotient_size - 1 - i] = rev_quotient_coeffs[i];
+  }
+  Poly q(UnivariateDenseCoefficients<F, MaxDegree>(std::move(quotient), true));
+  Poly r = a - FastMul(b, q);
+  return {std::move(q), std::move(r)};
+}
+
+// Returns the quotient and the remainder of |a| / |b|, choosing between the
+// long division and |NewtonDivMod()| by the sizes of the divisor and the
+// quotient. See |kNewtonDivThreshold|. Returns std::nullopt if |b| is zero.
+template <typename F, size_t MaxDegree>
+std::optional<DivResult<UnivariateDensePolynomial<F, MaxDegree>>> FastDivMod(
+    const UnivariateDensePolynomial<F, MaxDegree>& a,
+    const UnivariateDensePolynomial<F, MaxDegree>& b) {
+  using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+
+  if (UNLIKELY(b.IsZero())) {
+    LOG(ERROR) << "Division by zero attempted";
+    return std::nullopt;
+  }
+  if (a.IsZero() || a.Degree() < b.Degree()) {
+    return DivResult<Poly>{Poly::Zero(), a};
+  }
+  if constexpr (F::Config::kHasTwoAdicRootOfUnity) {
+    if (std::min(b.Degree() + 1, a.Degree() - b.Degree() + 1) >=
+        kNewtonDivThreshold) {
+      return NewtonDivMod(a, b);
+    }
+  }
+  return a.DivMod(b);
+}
+
+// Returns the quotient of |a| / |b|, or std::nullopt if |b| is zero.
+template <typename F, size_t MaxDegree>
+std::optional<UnivariateDensePolynomial<F, MaxDegree>> FastDiv(
+    const UnivariateDensePolynomial<F, MaxDegree>& a,
+    const UnivariateDensePolynomial<F, MaxDegree>& b) {
+  std::optional<DivResult<UnivariateDensePolynomial<F, MaxDegree>>> result =
+      FastDivMod(a, b);
+  if (UNLIKELY(!result)) return std::nullopt;
+  return std::move(result->quotient);
+}
+
+// Returns the remainder of |a| / |b|, or std::nullopt if |b| is zero.
+template <typename F, size_t MaxDegree>
+std::optional<UnivariateDensePolynomial<F, MaxDegree>> FastMod(
+    const UnivariateDensePolynomial<F, MaxDegree>& a,
+    const UnivariateDensePolynomial<F, MaxDegree>& b) {
+  std::optional<DivResult<UnivariateDensePolynomial<F, MaxDegree>>> result =
+      FastDivMod(a, b);
+  if (UNLIKELY(!result)) return std::nullopt;
+  return std::move(result->remainder);
+}
+
+// Divides |poly| by X - |point| in place and returns the remainder, which is
+// the evaluation of |poly| at |point|.
+//
+// The synthetic division computes the quotient Q from the top with
+// Qᵢ = Pᵢ₊₁ + z * Qᵢ₊₁. To parallelize it, every chunk of Q first runs the
+// recurrence as if the chunk were on the top. Since the true Qᵢ is the
+// chunk-local one plus zᵉ⁻ⁱ * Qₑ, where e is the start of the next chunk, the
+// carries Qₑ are then propagated over the chunks from the top and added back
+// to each chunk in parallel.
+template <typename F, size_t MaxDegree>
+F DivideByLinearInPlace(UnivariateDensePolynomial<F, MaxDegree>& poly,
+                        const F& point) {
+  std::vector<F>& coeffs = poly.coefficients().coefficients();
+  if (coeffs.empty()) return F::Zero();
+  F remainder = coeffs[0];
+  coeffs.erase(coeffs.begin());
+  if (coeffs.empty()) return remainder;
+
+  size_t chunk_size = base::GetNumElementsPerThread(
+      coeffs, kParallelSyntheticDivisionThreshold);
+  std::vector<F> chunk_heads = base::ParallelizeMapByChunkSize(
+      coeffs, chunk_size, [&point](absl::Span<F> chunk) {
+        for (size_t i = chunk.size() - 1; i > 0; --i) {
+          chunk[i - 1] += point * chunk[i];
+        }
+        return chunk[0];
+      });
+
+  // |carries[k]| is the true value of the coefficient right above the k-th
+  // chunk.
+  size_t num_chunks = chunk_heads.size();
+  std::vector<F> carries(num_chunks, F::Zero());
+  if (num_chunks > 1) {
+    F point_pow_chunk = point.Pow(chunk_size);
+    for (size_t k = num_chunks - 1; k > 0; --k) {
+      carries[k - 1] = chunk_heads[k] + point_pow_chunk * carries[k];
+    }
+    base::ParallelizeByChunkSize(
+        coeffs, chunk_size,
+        [&point, &carries](absl::Span<F> chunk, size_t chunk_index) {
+          if (carries[chunk_index].IsZero()) return;
+          F carry = carries[chunk_index] * point;
+          for (size_t i = chunk.size(); i > 0; --i) {
+            chunk[i - 1] += carry;
+            carry *= point;
+          }
+        });
+  }
+  remainder += point * coeffs[0];
+  return remainder;
+}
+
+// Returns the quotient of |poly| / (X - x₀)(X - x₁)...(X - xₙ₋₁) by dividing
+// by the linear factors one at a time, which is O(n * deg(|poly|)) without
+// expanding the divisor.
+template <typename F, size_t MaxDegree>
+UnivariateDensePolynomial<F, MaxDegree> DivideByLinearFactors(
+    UnivariateDensePolynomial<F, MaxDegree> poly, absl::Span<const F> points) {
+  for (const F& point : points) {
+    DivideByLinearInPlace(poly, point);
+  }
+  return poly;
+}
+
+// Returns Σᵢ |scalars[i]| * |polys[i]|. Unlike combining the polynomials one
+// by one, every coefficient is accumulated in a single pass over them without
+// copying any of them.
+template <typename F, size_t MaxDegree>
+UnivariateDensePolynomial<F, MaxDegree> LinearCombination(
+    const std::vector<const UnivariateDensePolynomial<F, MaxDegree>*>& polys,
+    const std::vector<F>& scalars) {
+  CHECK_EQ(polys.size(), scalars.size());
+  size_t size = 0;
+  for (const UnivariateDensePolynomial<F, MaxDegree>* poly : polys) {
+    size = std::max(size, poly->NumElements());
+  }
+  std::vector<F> coeffs(size);
+  base::Parallelize(coeffs, [&polys, &scalars](absl::Span<F> chunk,
+                                               size_t chunk_offset,
+                                               size_t chunk_size) {
+    size_t start = chunk_offset * chunk_size;
+    for (size_t i = 0; i < polys.size(); ++i) {
+      const std::vector<F>& poly_coeffs =
+          polys[i]->coefficients().coefficients();
+      if (start >= poly_coeffs.size()) continue;
+      size_t len = std::min(chunk.size(), poly_coeffs.size() - start);
+      const F& scalar = scalars[i];
+      for (size_t j = 0; j < len; ++j) {
+        chunk[j] += scalar * poly_coeffs[start + j];
+      }
+    }
+  });
+  return UnivariateDensePolynomial<F, MaxDegree>(
+      UnivariateDenseCoefficients<F, MaxDegree>(std::move(coeffs), true));
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_POLYNOMIAL_ARITHMETIC_H_
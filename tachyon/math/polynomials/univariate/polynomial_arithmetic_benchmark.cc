@@ -0,0 +1,113 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/polynomial_arithmetic.h"
+
+namespace tachyon::math {
+
+constexpr size_t kMaxDegree = (size_t{1} << 16) - 1;
+
+// The operands of the multiplications and the divisor and the quotient of the
+// divisions have |state.range(0)| coefficients each, which is where
+// |kFFTMulThreshold| and |kNewtonDivThreshold| are compared against.
+
+template <typename F>
+void BM_SchoolbookMul(benchmark::State& state) {
+  using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+  Poly a = Poly::Random(state.range(0) - 1);
+  Poly b = Poly::Random(state.range(0) - 1);
+  for (auto _ : state) {
+    Poly c = a * b;
+    benchmark::DoNotOptimize(c);
+  }
+}
+
+template <typename F>
+void BM_FFTMul(benchmark::State& state) {
+  using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+  Poly a = Poly::Random(state.range(0) - 1);
+  Poly b = Poly::Random(state.range(0) - 1);
+  for (auto _ : state) {
+    Poly c = FFTMul(a, b);
+    benchmark::DoNotOptimize(c);
+  }
+}
+
+template <typename F>
+void BM_LongDivision(benchmark::State& state) {
+  using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+  Poly a = Poly::Random(2 * (state.range(0) - 1));
+  Poly b = Poly::Random(state.range(0) - 1);
+  for (auto _ : state) {
+    auto result = a.DivMod(b);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+template <typename F>
+void BM_NewtonDivision(benchmark::State& state) {
+  using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+  Poly a = Poly::Random(2 * (state.range(0) - 1));
+  Poly b = Poly::Random(state.range(0) - 1);
+  for (auto _ : state) {
+    auto result = NewtonDivMod(a, b);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+template <typename F>
+void BM_DivideByLinear(benchmark::State& state) {
+  using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+  Poly poly = Poly::Random(state.range(0) - 1);
+  Poly divisor = Poly::FromRoots(std::vector<F>({F::Random()}));
+  for (auto _ : state) {
+    auto result = poly / divisor;
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+template <typename F>
+void BM_SyntheticDivision(benchmark::State& state) {
+  using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+  Poly poly = Poly::Random(state.range(0) - 1);
+  F point = F::Random();
+  for (auto _ : state) {
+    Poly quotient = poly;
+    F remainder = DivideByLinearInPlace(quotient, point);
+    benchmark::DoNotOptimize(remainder);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_SchoolbookMul, bn254::Fr)
+    ->RangeMultiplier(2)
+    ->Range(1 << 3, 1 << 10);
+
+BENCHMARK_TEMPLATE(BM_FFTMul, bn254::Fr)
+    ->RangeMultiplier(2)
+    ->Range(1 << 3, 1 << 10);
+
+BENCHMARK_TEMPLATE(BM_LongDivision, bn254::Fr)
+    ->RangeMultiplier(2)
+    ->Range(1 << 3, 1 << 10);
+
+BENCHMARK_TEMPLATE(BM_NewtonDivision, bn254::Fr)
+    ->RangeMultiplier(2)
+    ->Range(1 << 3, 1 << 10);
+
+BENCHMARK_TEMPLATE(BM_DivideByLinear, bn254::Fr)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+
+BENCHMARK_TEMPLATE(BM_SyntheticDivision, bn254::Fr)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+
+}  // namespace tachyon::math
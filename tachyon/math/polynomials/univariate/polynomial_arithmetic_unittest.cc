@@ -0,0 +1,112 @@
+#include "tachyon/math/polynomials/univariate/polynomial_arithmetic.h"
+
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn254::Fr;
+
+constexpr size_t kMaxDegree = 1024;
+
+using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+class PolynomialArithmeticTest : public FiniteFieldTest<F> {};
+
+}  // namespace
+
+TEST_F(PolynomialArithmeticTest, FFTMul) {
+  for (size_t a_degree : {size_t{0}, size_t{1}, size_t{63}, size_t{300}}) {
+    for (size_t b_degree : {size_t{0}, size_t{7}, size_t{64}, size_t{200}}) {
+      SCOPED_TRACE(a_degree);
+      SCOPED_TRACE(b_degree);
+      Poly a = Poly::Random(a_degree);
+      Poly b = Poly::Random(b_degree);
+      Poly expected = a * b;
+      EXPECT_EQ(FFTMul(a, b), expected);
+      EXPECT_EQ(FastMul(a, b), expected);
+    }
+  }
+  EXPECT_TRUE(FFTMul(Poly::Random(10), Poly::Zero()).IsZero());
+}
+
+TEST_F(PolynomialArithmeticTest, InverseSeries) {
+  for (size_t size : {size_t{1}, size_t{2}, size_t{5}, size_t{130}}) {
+    SCOPED_TRACE(size);
+    Poly poly = Poly::Random(size + 3);
+    Poly inverse = InverseSeries(poly, size);
+    std::vector<F> product = (poly * inverse).coefficients().coefficients();
+    product.resize(size, F::Zero());
+    std::vector<F> expected(size, F::Zero());
+    expected[0] = F::One();
+    EXPECT_EQ(product, expected);
+  }
+}
+
+TEST_F(PolynomialArithmeticTest, DivMod) {
+  for (size_t a_degree : {size_t{0}, size_t{10}, size_t{300}, size_t{700}}) {
+    for (size_t b_degree : {size_t{0}, size_t{3}, size_t{150}, size_t{400}}) {
+      SCOPED_TRACE(a_degree);
+      SCOPED_TRACE(b_degree);
+      Poly a = Poly::Random(a_degree);
+      Poly b = Poly::Random(b_degree);
+      DivResult<Poly> expected = *a.DivMod(b);
+      EXPECT_EQ(NewtonDivMod(a, b), expected);
+      EXPECT_EQ(FastDivMod(a, b), expected);
+      EXPECT_EQ(FastDiv(a, b), expected.quotient);
+      EXPECT_EQ(FastMod(a, b), expected.remainder);
+    }
+  }
+  EXPECT_FALSE(FastDivMod(Poly::Random(10), Poly::Zero()));
+}
+
+TEST_F(PolynomialArithmeticTest, DivideByLinearInPlace) {
+  using BigPoly =
+      UnivariateDensePolynomial<F, kParallelSyntheticDivisionThreshold + 5>;
+
+  // The largest degree runs the parallel synthetic division.
+  for (size_t degree : {size_t{0}, size_t{1}, size_t{17},
+                        kParallelSyntheticDivisionThreshold + 5}) {
+    SCOPED_TRACE(degree);
+    BigPoly poly = BigPoly::Random(degree);
+    F point = F::Random();
+    BigPoly divisor = BigPoly::FromRoots(std::vector<F>({point}));
+    DivResult<BigPoly> expected = *poly.DivMod(divisor);
+
+    BigPoly quotient = poly;
+    F remainder = DivideByLinearInPlace(quotient, point);
+    EXPECT_EQ(quotient, expected.quotient);
+    EXPECT_EQ(remainder, poly.Evaluate(point));
+  }
+}
+
+TEST_F(PolynomialArithmeticTest, DivideByLinearFactors) {
+  std::vector<F> points = base::CreateVector(5, []() { return F::Random(); });
+  Poly poly = Poly::Random(40);
+  Poly expected = *(poly / Poly::FromRoots(points));
+  EXPECT_EQ(DivideByLinearFactors(poly, absl::MakeConstSpan(points)), expected);
+  EXPECT_EQ(DivideByLinearFactors(poly, absl::Span<const F>()), poly);
+}
+
+TEST_F(PolynomialArithmeticTest, LinearCombination) {
+  std::vector<Poly> polys = {Poly::Random(10), Poly::Random(40),
+                             Poly::Random(25)};
+  std::vector<F> scalars = base::CreateVector(3, []() { return F::Random(); });
+  Poly expected = polys[0] * scalars[0];
+  expected += polys[1] * scalars[1];
+  expected += polys[2] * scalars[2];
+  std::vector<const Poly*> poly_ptrs = {&polys[0], &polys[1], &polys[2]};
+  EXPECT_EQ(LinearCombination(poly_ptrs, scalars), expected);
+  EXPECT_TRUE(LinearCombination(std::vector<const Poly*>(), std::vector<F>())
+                  .IsZero());
+}
+
+}  // namespace tachyon::math
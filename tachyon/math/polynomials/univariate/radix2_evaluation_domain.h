@@ -15,8 +15,8 @@
 #include <stdint.h>
 
 #include <algorithm>
-#include <cmath>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -27,6 +27,16 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/base/tuning_profile.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/packed_fr.h"
+#include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
+#include "tachyon/math/finite_fields/finite_field_traits.h"
+#include "tachyon/math/finite_fields/koala_bear/packed_koala_bear.h"
+#include "tachyon/math/finite_fields/mersenne31/packed_mersenne31.h"
+#include "tachyon/math/polynomials/univariate/cache_blocked_fft.h"
+#include "tachyon/math/polynomials/univariate/packed_fft.h"
+#include "tachyon/math/polynomials/univariate/twiddle_cache.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 
@@ -44,8 +54,12 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   using Evals = UnivariateEvaluations<F, MaxDegree>;
   using DensePoly = UnivariateDensePolynomial<F, MaxDegree>;
   using SparsePoly = UnivariateSparsePolynomial<F, MaxDegree>;
+  using PackedField = typename PackedFieldTraits<F>::PackedField;
 
   constexpr static size_t kMaxDegree = MaxDegree;
+  // Whether the butterflies run on the lanes of |PackedField|. See
+  // |PackedFFT|.
+  constexpr static bool kHasPackedField = !std::is_void_v<PackedField>;
   // Factor that determines if a the degree aware FFT should be called.
   constexpr static size_t kDegreeAwareFFTThresholdFactor = 1 << 2;
 
@@ -61,6 +75,14 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   static std::unique_ptr<Radix2EvaluationDomain> Create(size_t num_coeffs) {
     auto ret = absl::WrapUnique(new Radix2EvaluationDomain(
         absl::bit_ceil(num_coeffs), base::bits::SafeLog2Ceiling(num_coeffs)));
+    if constexpr (kHasPackedField) {
+      // NOTE: Unlike |F|, |PackedField| has constants that must be set up
+      // before its first use.
+      [[maybe_unused]] static bool packed_field_initialized = []() {
+        PackedField::Init();
+        return true;
+      }();
+    }
     ret->PrepareRootsVecCache();
     return ret;
   }
@@ -85,9 +107,22 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     return absl::WrapUnique(new Radix2EvaluationDomain(*this));
   }
 
+  // Returns the factor of the tuning profile for the size of |this| if it is
+  // set, or |kDegreeAwareFFTThresholdFactor| otherwise. See
+  // |base::TuningProfile|.
+  size_t GetDegreeAwareFFTThresholdFactor() const {
+    return base::TuningProfile::GetDefault()
+        .GetSize(base::TuningProfile::kDegreeAwareFFTThresholdFactor,
+                 this->size_)
+        .value_or(kDegreeAwareFFTThresholdFactor);
+  }
+
   // UnivariateEvaluationDomain methods
-  constexpr void DoFFT(Evals& evals) const override {
-    if (evals.evaluations_.size() * kDegreeAwareFFTThresholdFactor <=
+  void DoFFT(Evals& evals) const override {
+    TRACE_EVENT("fft", "Radix2EvaluationDomain::FFT");
+    base::ThroughputMetrics::Scope scope =
+        Base::GetFFTMetrics(/*inverse=*/false).Measure(this->size_);
+    if (evals.evaluations_.size() * GetDegreeAwareFFTThresholdFactor() <=
         this->size_) {
       DegreeAwareFFTInPlace(evals);
     } else {
@@ -97,12 +132,145 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   }
 
   // UnivariateEvaluationDomain methods
-  constexpr void DoIFFT(DensePoly& poly) const override {
+  void DoIFFT(DensePoly& poly) const override {
+    TRACE_EVENT("fft", "Radix2EvaluationDomain::IFFT");
+    base::ThroughputMetrics::Scope scope =
+        Base::GetFFTMetrics(/*inverse=*/true).Measure(this->size_);
     poly.coefficients_.coefficients_.resize(this->size_, F::Zero());
     InOrderIFFTInPlace(poly);
     poly.coefficients_.RemoveHighDegreeZeros();
   }
 
+  // UnivariateEvaluationDomain methods
+  // The decimation-in-frequency butterflies of |InOutHelper()| read the
+  // coefficients in order and write the evaluations in bit-reversed order, so
+  // nothing is permuted.
+  void DoFFTBitReversed(Evals& evals) const override {
+    TRACE_EVENT("fft", "Radix2EvaluationDomain::FFTBitReversed");
+    base::ThroughputMetrics::Scope scope =
+        Base::GetFFTMetrics(/*inverse=*/false).Measure(this->size_);
+    if (!this->offset_.IsOne()) {
+      Base::DistributePowers(evals, this->offset_);
+    }
+    evals.evaluations_.resize(this->size_, F::Zero());
+    InOutHelper(absl::MakeSpan(evals.evaluations_), roots_vec_);
+    evals.bit_reversed_ = true;
+  }
+
+  // UnivariateEvaluationDomain methods
+  // The decimation-in-time butterflies of |OutInHelper()| read the
+  // evaluations in bit-reversed order and write the coefficients in order, so
+  // nothing is permuted.
+  void DoIFFTFromBitReversed(DensePoly& poly) const override {
+    TRACE_EVENT("fft", "Radix2EvaluationDomain::IFFTFromBitReversed");
+    base::ThroughputMetrics::Scope scope =
+        Base::GetFFTMetrics(/*inverse=*/true).Measure(this->size_);
+    CHECK_EQ(poly.coefficients_.coefficients_.size(), this->size_);
+    OutInHelper(absl::MakeSpan(poly.coefficients_.coefficients_),
+                inv_roots_vec_, 1);
+    ScaleIFFTInPlace(poly);
+    poly.coefficients_.RemoveHighDegreeZeros();
+  }
+
+  // UnivariateEvaluationDomain methods
+  void DoLDEBatch(absl::Span<Evals> evals_vec, size_t blowup,
+                  const F& shift) const override {
+    TRACE_EVENT("fft", "Radix2EvaluationDomain::LDEBatch");
+    LDEBatchHelper(evals_vec, blowup, shift, false);
+  }
+
+  // UnivariateEvaluationDomain methods
+  void DoLDEBatchBitReversed(absl::Span<Evals> evals_vec, size_t blowup,
+                             const F& shift) const override {
+    TRACE_EVENT("fft", "Radix2EvaluationDomain::LDEBatchBitReversed");
+    LDEBatchHelper(evals_vec, blowup, shift, true);
+  }
+
+  // The IFFT over this domain and the FFT over the extended coset are fused.
+  // Scaling by 1 / n, moving out of this coset and moving into the extended
+  // coset are a single distribution of powers of (|offset_inv_| * |shift|).
+  // The IFFT reads the evaluations in either order, and so does the FFT
+  // write the extension:
+  // - In order, the extended FFT is degree aware, which skips the butterflies
+  //   on the zero padding regardless of |blowup|.
+  // - In bit-reversed order, the i-th block of |size_| elements of the
+  //   extension is the bit-reversed FFT over this domain of P(cᵢ * X), where
+  //   cᵢ = ω^bitrev(i) and ω generates the extended subgroup. It costs the
+  //   same as the degree aware FFT and never permutes the extension.
+  void LDEBatchHelper(absl::Span<Evals> evals_vec, size_t blowup,
+                      const F& shift, bool bit_reversed) const {
+    size_t extended_size = this->CheckLDE(evals_vec, blowup);
+    F g = this->offset_inv_ * shift;
+    std::unique_ptr<Radix2EvaluationDomain> extended;
+    std::vector<F> block_shifts;
+    if (bit_reversed) {
+      F omega;
+      CHECK(F::GetRootOfUnity(extended_size, &omega));
+      uint32_t log_blowup = base::bits::SafeLog2Ceiling(blowup);
+      block_shifts = base::CreateVector(blowup, [&g, &omega,
+                                                 log_blowup](size_t i) {
+        size_t ridx = log_blowup == 0 ? 0
+                                      : base::bits::BitRev(i) >>
+                                            (sizeof(size_t) * 8 - log_blowup);
+        return g * omega.Pow(ridx);
+      });
+    } else {
+      extended = Create(extended_size);
+    }
+    this->RunTransforms(evals_vec.size(), [this, evals_vec, blowup,
+                                           bit_reversed, &g, &extended,
+                                           &block_shifts](size_t i) {
+      Evals& evals = evals_vec[i];
+      if (evals.evaluations_.empty()) return;
+      absl::Span<F> coeffs = absl::MakeSpan(evals.evaluations_);
+      if (evals.bit_reversed_) {
+        CHECK_EQ(coeffs.size(), this->size_);
+        OutInHelper(coeffs, inv_roots_vec_, 1);
+      } else {
+        evals.evaluations_.resize(this->size_, F::Zero());
+        coeffs = absl::MakeSpan(evals.evaluations_);
+        InOutHelper(coeffs, inv_roots_vec_);
+        this->SwapElements(evals, this->size_ - 1, this->log_size_of_group_);
+      }
+      evals.bit_reversed_ = bit_reversed;
+      if (!bit_reversed) {
+        Base::DistributePowersAndMulByConst(evals, g, this->size_inv_);
+        extended->DegreeAwareFFTInPlace(evals);
+        return;
+      }
+      evals.evaluations_.resize(blowup * this->size_);
+      // NOTE: The first block is written last, since it overwrites the
+      // coefficients.
+      for (size_t j = blowup; j > 0; --j) {
+        absl::Span<F> block = absl::MakeSpan(
+            &evals.evaluations_[(j - 1) * this->size_], this->size_);
+        DistributePowersAndMulByConstTo(
+            absl::MakeConstSpan(evals.evaluations_.data(), this->size_),
+            block_shifts[j - 1], this->size_inv_, block);
+        InOutHelper(block, roots_vec_);
+      }
+    });
+  }
+
+  // Writes |c| * |g|ⁱ * |src[i]| to |dst[i]|, where |dst| may be |src|.
+  CONSTEXPR_IF_NOT_OPENMP static void DistributePowersAndMulByConstTo(
+      absl::Span<const F> src, const F& g, const F& c, absl::Span<F> dst) {
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif
+    size_t size = src.size();
+    size_t num_elems_per_thread = std::max(size / thread_nums, size_t{1024});
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; i += num_elems_per_thread) {
+      F pow = c * g.Pow(i);
+      for (size_t j = i; j < std::min(i + num_elems_per_thread, size); ++j) {
+        dst[j] = src[j] * pow;
+        pow *= g;
+      }
+    }
+  }
+
   // Degree aware FFT that runs in O(n log d) instead of O(n log n).
   // Implementation copied from libiop. (See
   // https://github.com/arkworks-rs/algebra/blob/master/poly/src/domain/radix2/fft.rs#L28)
@@ -136,7 +304,7 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
                                    });
     }
     size_t start_gap = duplicity_of_initials;
-    OutInHelper(evals, start_gap);
+    OutInHelper(absl::MakeSpan(evals.evaluations_), roots_vec_, start_gap);
   }
 
   constexpr void InOrderFFTInPlace(Evals& evals) const {
@@ -148,6 +316,11 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
 
   CONSTEXPR_IF_NOT_OPENMP void InOrderIFFTInPlace(DensePoly& poly) const {
     IFFTHelperInPlace(poly);
+    ScaleIFFTInPlace(poly);
+  }
+
+  // Multiplies the i-th coefficient by |size_inv_| * |offset_inv_|ⁱ.
+  CONSTEXPR_IF_NOT_OPENMP void ScaleIFFTInPlace(DensePoly& poly) const {
     if (this->offset_.IsOne()) {
       // clang-format off
       OPENMP_PARALLEL_FOR(F& val : poly.coefficients_.coefficients_) {
@@ -164,46 +337,26 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     uint32_t log_len = static_cast<uint32_t>(base::bits::Log2Ceiling(
         static_cast<uint32_t>(evals.evaluations_.size())));
     this->SwapElements(evals, evals.evaluations_.size() - 1, log_len);
-    OutInHelper(evals, 1);
+    OutInHelper(absl::MakeSpan(evals.evaluations_), roots_vec_, 1);
   }
 
   // Handles doing an IFFT with handling of being in order and out of order.
   // The results here must all be divided by |poly|, which is left up to the
   // caller to do.
   constexpr void IFFTHelperInPlace(DensePoly& poly) const {
-    InOutHelper(poly);
+    InOutHelper(absl::MakeSpan(poly.coefficients_.coefficients_),
+                inv_roots_vec_);
     uint32_t log_len = static_cast<uint32_t>(base::bits::Log2Ceiling(
         static_cast<uint32_t>(poly.coefficients_.coefficients_.size())));
     this->SwapElements(poly, poly.coefficients_.coefficients_.size() - 1,
                        log_len);
   }
 
-  template <FFTOrder Order, typename PolyOrEvals>
-  CONSTEXPR_IF_NOT_OPENMP static void ApplyButterfly(PolyOrEvals& poly_or_evals,
-                                                     absl::Span<const F> roots,
-                                                     size_t gap) {
-    void (*fn)(F&, F&, const F&);
-
-    if constexpr (Order == FFTOrder::kInOut) {
-      fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnInOut;
-    } else {
-      static_assert(Order == FFTOrder::kOutIn);
-      fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn;
-    }
-
-    // Each butterfly cluster uses 2 * |gap| positions.
-    size_t chunk_size = 2 * gap;
-    OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < poly_or_evals.NumElements();
-                               i += chunk_size) {
-      for (size_t j = 0; j < gap; ++j) {
-        fn(poly_or_evals.at(i + j), poly_or_evals.at(i + j + gap), roots[j]);
-      }
-    }
-  }
-
+  // Views |roots_vec_| and |inv_roots_vec_| for |OutInHelper()| and
+  // |InOutHelper()| into the |TwiddleCache|, where |roots_vec_[k]| and
+  // |inv_roots_vec_[k]| hold the twiddles for the gap 2ᵏ. Here is an example
+  // where |this->size_| equals 32.
   // clang-format off
-  // Precompute |roots_vec_| and |inv_roots_vec_| for |OutInHelper()| and |InOutHelper()|.
-  // Here is an example where |this->size_| equals 32.
   // |root_vec_| = [
   //   [1],
   //   [1, ω⁸],
@@ -212,63 +365,60 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   //   [1, ω, ω², ω³, ω⁴, ω⁵, ω⁶, ω⁷, ω⁸, ω⁹, ω¹⁰, ω¹¹, ω¹², ω¹³, ω¹⁴, ω¹⁵],
   // ]
   // |inv_root_vec_| = [
-  //   [1, ω⁻¹, ω⁻², ω⁻³, ω⁻⁴, ω⁻⁵, ω⁻⁶, ω⁻⁷, ω⁻⁸, ω⁻⁹, ω⁻¹⁰, ω⁻¹¹, ω⁻¹², ω⁻¹³, ω⁻¹⁴, ω⁻¹⁵],
-  //   [1, ω⁻², ω⁻⁴, ω⁻⁶, ω⁻⁸, ω⁻¹⁰, ω⁻¹², ω⁻¹⁴],
-  //   [1, ω⁻⁴, ω⁻⁸, ω⁻¹²],
-  //   [1, ω⁻⁸],
   //   [1],
+  //   [1, ω⁻⁸],
+  //   [1, ω⁻⁴, ω⁻⁸, ω⁻¹²],
+  //   [1, ω⁻², ω⁻⁴, ω⁻⁶, ω⁻⁸, ω⁻¹⁰, ω⁻¹², ω⁻¹⁴],
+  //   [1, ω⁻¹, ω⁻², ω⁻³, ω⁻⁴, ω⁻⁵, ω⁻⁶, ω⁻⁷, ω⁻⁸, ω⁻⁹, ω⁻¹⁰, ω⁻¹¹, ω⁻¹², ω⁻¹³, ω⁻¹⁴, ω⁻¹⁵],
   // ]
   // clang-format on
-  CONSTEXPR_IF_NOT_OPENMP void PrepareRootsVecCache() {
-    if (this->log_size_of_group_ == 0) return;
-
-    roots_vec_.resize(this->log_size_of_group_);
-    inv_roots_vec_.resize(this->log_size_of_group_);
-
-    // Compute biggest vector of |root_vec_| and |inv_root_vec_| first.
-    roots_vec_[this->log_size_of_group_ - 1] =
-        this->GetRootsOfUnity(this->size_ / 2, this->group_gen_);
-    inv_roots_vec_[0] =
-        this->GetRootsOfUnity(this->size_ / 2, this->group_gen_inv_);
-
-    // Prepare space in each vector for the others.
-    size_t size = this->size_ / 2;
-    for (size_t i = 1; i < this->log_size_of_group_; ++i) {
-      size /= 2;
-      roots_vec_[this->log_size_of_group_ - i - 1].resize(size);
-      inv_roots_vec_[i].resize(size);
-    }
-
-    // Assign every element based on the biggest vector.
-    OPENMP_PARALLEL_FOR(size_t i = 1; i < this->log_size_of_group_; ++i) {
-      for (size_t j = 0; j < this->size_ / std::pow(2, i + 1); ++j) {
-        size_t k = std::pow(2, i) * j;
-        roots_vec_[this->log_size_of_group_ - i - 1][j] = roots_vec_.back()[k];
-        inv_roots_vec_[i][j] = inv_roots_vec_.front()[k];
-      }
-    }
+  void PrepareRootsVecCache() {
+    TwiddleCache<F>& cache = TwiddleCache<F>::GetInstance();
+    roots_vec_ = cache.GetRootsVec(this->log_size_of_group_);
+    inv_roots_vec_ = cache.GetInvRootsVec(this->log_size_of_group_);
   }
 
-  constexpr void InOutHelper(DensePoly& poly) const {
-    size_t gap = poly.coefficients_.coefficients_.size() / 2;
-    size_t idx = 0;
-    while (gap > 0) {
-      ApplyButterfly<FFTOrder::kInOut>(poly, inv_roots_vec_[idx++], gap);
-      gap /= 2;
+  // Runs the decimation-in-frequency butterflies with the twiddles of
+  // |roots_vec|, which reads |values| in order and writes them in bit-reversed
+  // order. It is an FFT with |roots_vec_| and an IFFT with |inv_roots_vec_|.
+  void InOutHelper(absl::Span<F> values,
+                   absl::Span<const std::vector<F>> roots_vec) const {
+    size_t block_size = CacheBlockedFFT<F>::ComputeBlockSize(values.size());
+    if constexpr (kHasPackedField) {
+      if (PackedFFT<PackedField>::IsSupported(values.size())) {
+        PackedFFT<PackedField>::template RunInOut<
+            Base::template ButterflyFnInOut<PackedField>>(values, roots_vec,
+                                                          block_size);
+        return;
+      }
     }
+    CacheBlockedFFT<F>::template RunInOut<Base::template ButterflyFnInOut<F>>(
+        values, roots_vec, block_size);
   }
 
-  constexpr void OutInHelper(Evals& evals, size_t start_gap) const {
-    size_t gap = start_gap;
-    size_t idx = base::bits::SafeLog2Ceiling(start_gap);
-    while (gap < evals.evaluations_.size()) {
-      ApplyButterfly<FFTOrder::kOutIn>(evals, roots_vec_[idx++], gap);
-      gap *= 2;
+  // Runs the decimation-in-time butterflies with the twiddles of |roots_vec|,
+  // which reads |values| in bit-reversed order and writes them in order. See
+  // |InOutHelper()|.
+  void OutInHelper(absl::Span<F> values,
+                   absl::Span<const std::vector<F>> roots_vec,
+                   size_t start_gap) const {
+    size_t block_size = CacheBlockedFFT<F>::ComputeBlockSize(values.size());
+    if constexpr (kHasPackedField) {
+      if (PackedFFT<PackedField>::IsSupported(values.size())) {
+        PackedFFT<PackedField>::template RunOutIn<
+            Base::template ButterflyFnOutIn<PackedField>>(
+            values, roots_vec, start_gap, block_size);
+        return;
+      }
     }
+    CacheBlockedFFT<F>::template RunOutIn<Base::template ButterflyFnOutIn<F>>(
+        values, roots_vec, start_gap, block_size);
   }
 
-  std::vector<std::vector<F>> roots_vec_;
-  std::vector<std::vector<F>> inv_roots_vec_;
+  // not owned
+  absl::Span<const std::vector<F>> roots_vec_;
+  // not owned
+  absl::Span<const std::vector<F>> inv_roots_vec_;
 };
 
 }  // namespace tachyon::math
@@ -0,0 +1,272 @@
+// This header defines |Radix2EvaluationDomainGpu|, an
+// |UnivariateEvaluationDomain| that runs radix-2 (I)FFTs on the GPU. Besides
+// the usual host-side |FFT()| and |IFFT()|, it exposes batched in-place
+// (I)FFTs on |device::gpu::GpuMemory| so that provers that already keep their
+// polynomials on the device don't have to pay for the round trip.
+
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_RADIX2_EVALUATION_DOMAIN_GPU_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_RADIX2_EVALUATION_DOMAIN_GPU_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/finite_fields/prime_field_conversions.h"
+#include "tachyon/math/polynomials/univariate/kernels/radix2_ntt_kernels.cu.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
+
+namespace tachyon::math {
+
+template <typename F,
+          size_t MaxDegree = (size_t{1} << F::Config::kTwoAdicity) - 1>
+class Radix2EvaluationDomainGpu
+    : public UnivariateEvaluationDomain<F, MaxDegree> {
+ public:
+  using Base = UnivariateEvaluationDomain<F, MaxDegree>;
+  using Field = F;
+  using GpuField = typename F::GpuField;
+  using Evals = UnivariateEvaluations<F, MaxDegree>;
+  using DensePoly = UnivariateDensePolynomial<F, MaxDegree>;
+
+  constexpr static size_t kMaxDegree = MaxDegree;
+  constexpr static unsigned int kThreadNum = 256;
+
+  static std::unique_ptr<Radix2EvaluationDomainGpu> Create(
+      size_t num_coeffs, gpuStream_t stream = nullptr) {
+    auto ret = absl::WrapUnique(new Radix2EvaluationDomainGpu(
+        absl::bit_ceil(num_coeffs), base::bits::SafeLog2Ceiling(num_coeffs),
+        stream));
+    CHECK(ret->PrepareRootsCache());
+    return ret;
+  }
+
+  constexpr static bool IsValidNumCoeffs(size_t num_coeffs) {
+    return base::bits::SafeLog2Ceiling(num_coeffs) <= F::Config::kTwoAdicity;
+  }
+
+  gpuStream_t stream() const { return stream_; }
+
+  // Runs FFTs in place on |batch_size| vectors of |this->size_| coefficients
+  // that are laid out back to back in |data|. The coefficients must be in
+  // order and the evaluations are in order as well.
+  [[nodiscard]] bool FFTInPlace(device::gpu::GpuMemory<GpuField>& data,
+                                size_t batch_size = 1) const {
+    TRACE_EVENT("gpu", "Radix2EvaluationDomainGpu::FFTInPlace");
+    if (!CheckBatch(data, batch_size)) return false;
+    if (this->size_ == 1) return true;
+
+    if (!this->offset_.IsOne()) {
+      if (!DistributePowers(data, batch_size, this->offset_, F::One())) {
+        return false;
+      }
+    }
+    if (!BitReverse(data, batch_size)) return false;
+    for (size_t gap = 1; gap < this->size_; gap *= 2) {
+      kernels::ButterflyOutIn<<<GetGrid(this->size_ / 2, batch_size),
+                                 kThreadNum, 0, stream_>>>(
+          data.get(), d_roots_.get(), gap, this->size_ / (2 * gap),
+          this->size_);
+      if (LOG_IF_GPU_LAST_ERROR("Failed to kernels::ButterflyOutIn()") !=
+          gpuSuccess) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Runs IFFTs in place on |batch_size| vectors of |this->size_| evaluations
+  // that are laid out back to back in |data|. See |FFTInPlace()|.
+  [[nodiscard]] bool IFFTInPlace(device::gpu::GpuMemory<GpuField>& data,
+                                 size_t batch_size = 1) const {
+    TRACE_EVENT("gpu", "Radix2EvaluationDomainGpu::IFFTInPlace");
+    if (!CheckBatch(data, batch_size)) return false;
+    if (this->size_ == 1) return true;
+
+    for (size_t gap = this->size_ / 2; gap > 0; gap /= 2) {
+      kernels::ButterflyInOut<<<GetGrid(this->size_ / 2, batch_size),
+                                 kThreadNum, 0, stream_>>>(
+          data.get(), d_inv_roots_.get(), gap, this->size_ / (2 * gap),
+          this->size_);
+      if (LOG_IF_GPU_LAST_ERROR("Failed to kernels::ButterflyInOut()") !=
+          gpuSuccess) {
+        return false;
+      }
+    }
+    if (!BitReverse(data, batch_size)) return false;
+    if (this->offset_.IsOne()) {
+      kernels::MulByConst<<<GetGrid(this->size_, batch_size), kThreadNum, 0,
+                            stream_>>>(
+          data.get(), ConvertPrimeField<GpuField>(this->size_inv_),
+          this->size_);
+      return LOG_IF_GPU_LAST_ERROR("Failed to kernels::MulByConst()") ==
+             gpuSuccess;
+    }
+    return DistributePowers(data, batch_size, this->offset_inv_,
+                            this->size_inv_);
+  }
+
+ private:
+  Radix2EvaluationDomainGpu(size_t size, uint32_t log_size_of_group,
+                            gpuStream_t stream)
+      : Base(size, log_size_of_group), stream_(stream) {}
+
+  // NOTE: |GpuMemory| is not copyable, so the device side caches are rebuilt
+  // instead of being copied.
+  Radix2EvaluationDomainGpu(const Radix2EvaluationDomainGpu& other)
+      : Base(other), stream_(other.stream_) {
+    CHECK(PrepareRootsCache());
+  }
+
+  // UnivariateEvaluationDomain methods
+  std::unique_ptr<Base> Clone() const override {
+    return absl::WrapUnique(new Radix2EvaluationDomainGpu(*this));
+  }
+
+  // UnivariateEvaluationDomain methods
+  void DoFFT(Evals& evals) const override {
+    std::vector<F>& evaluations = evals.evaluations();
+    evaluations.resize(this->size_, F::Zero());
+    CHECK(RunOnDevice(evaluations, /*is_fft=*/true));
+  }
+
+  // UnivariateEvaluationDomain methods
+  void DoIFFT(DensePoly& poly) const override {
+    std::vector<F>& coefficients = poly.coefficients().coefficients();
+    coefficients.resize(this->size_, F::Zero());
+    CHECK(RunOnDevice(coefficients, /*is_fft=*/false));
+    poly.coefficients().RemoveHighDegreeZeros();
+  }
+
+  // UnivariateEvaluationDomain methods
+  // NOTE: Every transform synchronizes |stream_|, so they must not be run
+  // concurrently from the host threads.
+  void DoFFTBatch(absl::Span<Evals> evals_vec) const override {
+    for (Evals& evals : evals_vec) {
+      if (!evals.evaluations().empty()) DoFFT(evals);
+    }
+  }
+
+  // UnivariateEvaluationDomain methods
+  void DoIFFTBatch(absl::Span<DensePoly> polys) const override {
+    for (DensePoly& poly : polys) {
+      if (!poly.coefficients().coefficients().empty()) DoIFFT(poly);
+    }
+  }
+
+  bool RunOnDevice(std::vector<F>& values, bool is_fft) const {
+    auto d_values = device::gpu::GpuMemory<GpuField>::Malloc(values.size());
+    if (!d_values.CopyFromAsync(values.data(),
+                                device::gpu::GpuMemoryType::kHost, stream_)) {
+      return false;
+    }
+    bool ok = is_fft ? FFTInPlace(d_values) : IFFTInPlace(d_values);
+    if (!ok) return false;
+    if (!d_values.CopyToAsync(values.data(), device::gpu::GpuMemoryType::kHost,
+                              stream_)) {
+      return false;
+    }
+    return LOG_IF_GPU_ERROR(gpuStreamSynchronize(stream_),
+                            "Failed to gpuStreamSynchronize()") == gpuSuccess;
+  }
+
+  // Uploads ωⁱ and ω⁻ⁱ for 0 ≤ i < |this->size_| / 2. Unlike
+  // |Radix2EvaluationDomain::PrepareRootsVecCache()|, a single table per
+  // direction is enough, since every stage reads it with its own stride.
+  bool PrepareRootsCache() {
+    if (this->log_size_of_group_ == 0) return true;
+
+    size_t half = this->size_ / 2;
+    std::vector<F> roots = this->GetRootsOfUnity(half, this->group_gen_);
+    std::vector<F> inv_roots =
+        this->GetRootsOfUnity(half, this->group_gen_inv_);
+    d_roots_ = device::gpu::GpuMemory<GpuField>::Malloc(half);
+    d_inv_roots_ = device::gpu::GpuMemory<GpuField>::Malloc(half);
+    return d_roots_.CopyFrom(roots.data(), device::gpu::GpuMemoryType::kHost) &&
+           d_inv_roots_.CopyFrom(inv_roots.data(),
+                                 device::gpu::GpuMemoryType::kHost);
+  }
+
+  bool CheckBatch(const device::gpu::GpuMemory<GpuField>& data,
+                  size_t batch_size) const {
+    if (batch_size == 0) {
+      LOG(ERROR) << "batch_size is zero";
+      return false;
+    }
+    if (data.size() < this->size_ * batch_size) {
+      LOG(ERROR) << "data.size() is smaller than size * batch_size";
+      return false;
+    }
+    return true;
+  }
+
+  bool BitReverse(device::gpu::GpuMemory<GpuField>& data,
+                  size_t batch_size) const {
+    kernels::BitReverse<<<GetGrid(this->size_, batch_size), kThreadNum, 0,
+                          stream_>>>(data.get(), this->log_size_of_group_,
+                                     this->size_);
+    return LOG_IF_GPU_LAST_ERROR("Failed to kernels::BitReverse()") ==
+           gpuSuccess;
+  }
+
+  // Multiplies the i-th element of each vector with |c| * |g|ⁱ. The powers of
+  // |g| are split into two tables of roughly √n elements each. See
+  // |kernels::DistributePowers()|.
+  bool DistributePowers(device::gpu::GpuMemory<GpuField>& data,
+                        size_t batch_size, const F& g, const F& c) const {
+    uint32_t log_lo = (this->log_size_of_group_ + 1) / 2;
+    size_t lo_size = size_t{1} << log_lo;
+    size_t hi_size = this->size_ >> log_lo;
+    if (hi_size == 0) hi_size = 1;
+    std::vector<F> lo_powers = F::GetSuccessivePowers(lo_size, g);
+    std::vector<F> hi_powers =
+        F::GetSuccessivePowers(hi_size, g.Pow(lo_size), c);
+
+    auto d_lo_powers = device::gpu::GpuMemory<GpuField>::Malloc(lo_size);
+    auto d_hi_powers = device::gpu::GpuMemory<GpuField>::Malloc(hi_size);
+    if (!d_lo_powers.CopyFromAsync(lo_powers.data(),
+                                   device::gpu::GpuMemoryType::kHost,
+                                   stream_)) {
+      return false;
+    }
+    if (!d_hi_powers.CopyFromAsync(hi_powers.data(),
+                                   device::gpu::GpuMemoryType::kHost,
+                                   stream_)) {
+      return false;
+    }
+    kernels::DistributePowers<<<GetGrid(this->size_, batch_size), kThreadNum,
+                                0, stream_>>>(data.get(), d_lo_powers.get(),
+                                              d_hi_powers.get(), log_lo,
+                                              this->size_);
+    if (LOG_IF_GPU_LAST_ERROR("Failed to kernels::DistributePowers()") !=
+        gpuSuccess) {
+      return false;
+    }
+    // |lo_powers| and |hi_powers| must outlive the asynchronous copies above.
+    return LOG_IF_GPU_ERROR(gpuStreamSynchronize(stream_),
+                            "Failed to gpuStreamSynchronize()") == gpuSuccess;
+  }
+
+  static dim3 GetGrid(size_t threads, size_t batch_size) {
+    return dim3((threads + kThreadNum - 1) / kThreadNum, batch_size);
+  }
+
+  // not owned
+  gpuStream_t stream_ = nullptr;
+  device::gpu::GpuMemory<GpuField> d_roots_;
+  device::gpu::GpuMemory<GpuField> d_inv_roots_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_RADIX2_EVALUATION_DOMAIN_GPU_H_
@@ -0,0 +1,110 @@
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain_gpu.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/kernels/bn254_radix2_ntt_kernels.cu.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using namespace device;
+
+constexpr size_t kMaxDegree = SIZE_MAX - 1;
+
+using F = bn254::Fr;
+using Domain = UnivariateEvaluationDomain<F, kMaxDegree>;
+using CpuDomain = Radix2EvaluationDomain<F, kMaxDegree>;
+using GpuDomain = Radix2EvaluationDomainGpu<F, kMaxDegree>;
+using DensePoly = Domain::DensePoly;
+using Evals = Domain::Evals;
+
+class Radix2EvaluationDomainGpuTest : public testing::Test {
+ public:
+  constexpr static size_t kLogCount = 10;
+  constexpr static size_t kCount = 1 << kLogCount;
+
+  static void SetUpTestSuite() { F::Init(); }
+
+  static void TearDownTestSuite() {
+    GPU_MUST_SUCCESS(gpuDeviceReset(), "");
+  }
+};
+
+}  // namespace
+
+TEST_F(Radix2EvaluationDomainGpuTest, FFTAndIFFT) {
+  for (size_t log_n = 0; log_n <= kLogCount; ++log_n) {
+    size_t n = size_t{1} << log_n;
+    std::unique_ptr<CpuDomain> cpu_domain = CpuDomain::Create(n);
+    std::unique_ptr<GpuDomain> gpu_domain = GpuDomain::Create(n);
+
+    DensePoly poly = DensePoly::Random(n - 1);
+    Evals expected_evals = cpu_domain->FFT(poly);
+    Evals evals = gpu_domain->FFT(poly);
+    EXPECT_EQ(evals, expected_evals);
+
+    EXPECT_EQ(gpu_domain->IFFT(evals), cpu_domain->IFFT(expected_evals));
+    EXPECT_EQ(gpu_domain->IFFT(std::move(evals)), poly);
+  }
+}
+
+TEST_F(Radix2EvaluationDomainGpuTest, CosetFFTAndIFFT) {
+  std::unique_ptr<CpuDomain> cpu_domain = CpuDomain::Create(kCount);
+  std::unique_ptr<GpuDomain> gpu_domain = GpuDomain::Create(kCount);
+  F offset = F::Random();
+  std::unique_ptr<Domain> cpu_coset = cpu_domain->GetCoset(offset);
+  std::unique_ptr<Domain> gpu_coset = gpu_domain->GetCoset(offset);
+
+  DensePoly poly = DensePoly::Random(kCount - 1);
+  Evals evals = gpu_coset->FFT(poly);
+  EXPECT_EQ(evals, cpu_coset->FFT(poly));
+  EXPECT_EQ(gpu_coset->IFFT(std::move(evals)), poly);
+}
+
+TEST_F(Radix2EvaluationDomainGpuTest, BatchedFFTInPlace) {
+  constexpr size_t kBatchSize = 4;
+
+  std::unique_ptr<CpuDomain> cpu_domain = CpuDomain::Create(kCount);
+  std::unique_ptr<GpuDomain> gpu_domain = GpuDomain::Create(kCount);
+
+  std::vector<DensePoly> polys;
+  std::vector<F> values;
+  for (size_t i = 0; i < kBatchSize; ++i) {
+    polys.push_back(DensePoly::Random(kCount - 1));
+    const std::vector<F>& coeffs = polys.back().coefficients().coefficients();
+    values.insert(values.end(), coeffs.begin(), coeffs.end());
+  }
+
+  auto d_values = gpu::GpuMemory<F::GpuField>::Malloc(values.size());
+  ASSERT_TRUE(d_values.CopyFrom(values.data(), gpu::GpuMemoryType::kHost));
+  ASSERT_TRUE(gpu_domain->FFTInPlace(d_values, kBatchSize));
+
+  std::vector<F> results;
+  ASSERT_TRUE(d_values.ToStdVector(&results));
+  for (size_t i = 0; i < kBatchSize; ++i) {
+    Evals expected = cpu_domain->FFT(polys[i]);
+    std::vector<F> actual(results.begin() + i * kCount,
+                          results.begin() + (i + 1) * kCount);
+    EXPECT_EQ(actual, expected.evaluations());
+  }
+
+  ASSERT_TRUE(gpu_domain->IFFTInPlace(d_values, kBatchSize));
+  ASSERT_TRUE(d_values.ToStdVector(&results));
+  EXPECT_EQ(results, values);
+}
+
+TEST_F(Radix2EvaluationDomainGpuTest, InvalidBatch) {
+  std::unique_ptr<GpuDomain> gpu_domain = GpuDomain::Create(kCount);
+  auto d_values = gpu::GpuMemory<F::GpuField>::Malloc(kCount);
+  EXPECT_FALSE(gpu_domain->FFTInPlace(d_values, 0));
+  EXPECT_FALSE(gpu_domain->FFTInPlace(d_values, 2));
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,167 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_TWIDDLE_CACHE_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_TWIDDLE_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/optional.h"
+
+namespace tachyon::math {
+
+enum class TwiddleLayout {
+  // The twiddles of a level are ωⁱ for 0 ≤ i < 2ᵏ.
+  kNatural,
+  // The twiddles of a level are ωʳᵉᵛ⁽ⁱ⁾ for 0 ≤ i < 2ᵏ, where rev(i) reverses
+  // the k bits of i.
+  kBitReversed,
+};
+
+// |TwiddleCache| is a process-wide table of the twiddles of the radix-2 FFTs
+// over |F|. The k-th level holds the 2ᵏ twiddles of the butterflies of the gap
+// 2ᵏ, that is the powers of the primitive 2ᵏ⁺¹-th root of unity. Since these
+// don't depend on the size of the domain, a domain of size 2ᵐ views into the
+// first m levels instead of computing its own copy, and so do its cosets,
+// whose offsets are distributed separately.
+//
+// The levels are computed on demand, when a domain bigger than any of the
+// previous ones asks for them, and are never freed or moved afterwards, so
+// the views stay valid for the lifetime of the process.
+template <typename F>
+class TwiddleCache {
+ public:
+  constexpr static uint32_t kMaxLevels = F::Config::kTwoAdicity;
+
+  static TwiddleCache& GetInstance() {
+    static base::NoDestructor<TwiddleCache> cache;
+    return *cache;
+  }
+
+  TwiddleCache(const TwiddleCache& other) = delete;
+  TwiddleCache& operator=(const TwiddleCache& other) = delete;
+
+  // Returns the levels 0, ..., |log_size| - 1 of ω, which are the twiddles of
+  // a domain of size 2^|log_size| whose generator is ω.
+  absl::Span<const std::vector<F>> GetRootsVec(
+      uint32_t log_size, TwiddleLayout layout = TwiddleLayout::kNatural) {
+    return Get(log_size, layout).roots;
+  }
+
+  // Same as |GetRootsVec()|, but of ω⁻¹.
+  absl::Span<const std::vector<F>> GetInvRootsVec(
+      uint32_t log_size, TwiddleLayout layout = TwiddleLayout::kNatural) {
+    return Get(log_size, layout).inv_roots;
+  }
+
+ private:
+  friend class base::NoDestructor<TwiddleCache>;
+
+  struct Views {
+    absl::Span<const std::vector<F>> roots;
+    absl::Span<const std::vector<F>> inv_roots;
+  };
+
+  struct Levels {
+    std::array<std::vector<F>, kMaxLevels> roots;
+    std::array<std::vector<F>, kMaxLevels> inv_roots;
+  };
+
+  TwiddleCache() = default;
+
+  Views Get(uint32_t log_size, TwiddleLayout layout) {
+    CHECK_LE(log_size, kMaxLevels);
+    size_t idx = static_cast<size_t>(layout);
+    Levels& levels = levels_[idx];
+    {
+      absl::MutexLock lock(&mu_);
+      if (num_levels_[idx] < log_size) {
+        if (layout == TwiddleLayout::kNatural) {
+          GrowNatural(log_size);
+        } else {
+          GrowBitReversed(log_size);
+        }
+      }
+    }
+    return {absl::MakeConstSpan(levels.roots.data(), log_size),
+            absl::MakeConstSpan(levels.inv_roots.data(), log_size)};
+  }
+
+  // Computes the missing natural levels below |log_size|. The top level is
+  // computed from the root of unity and the k-th level takes every
+  // 2ᵗᵒᵖ⁻ᵏ-th twiddle of it.
+  void GrowNatural(uint32_t log_size) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    Levels& levels = levels_[static_cast<size_t>(TwiddleLayout::kNatural)];
+    uint32_t from = num_levels_[static_cast<size_t>(TwiddleLayout::kNatural)];
+    uint32_t top = log_size - 1;
+
+    F omega;
+    CHECK(F::GetRootOfUnity(size_t{1} << log_size, &omega));
+    F omega_inv = unwrap(omega.Inverse());
+    size_t top_size = size_t{1} << top;
+    levels.roots[top] = F::GetSuccessivePowers(top_size, omega);
+    levels.inv_roots[top] = F::GetSuccessivePowers(top_size, omega_inv);
+
+    OPENMP_PARALLEL_FOR(uint32_t k = from; k < top; ++k) {
+      size_t size = size_t{1} << k;
+      size_t stride = size_t{1} << (top - k);
+      std::vector<F> roots(size);
+      std::vector<F> inv_roots(size);
+      for (size_t i = 0; i < size; ++i) {
+        roots[i] = levels.roots[top][i * stride];
+        inv_roots[i] = levels.inv_roots[top][i * stride];
+      }
+      levels.roots[k] = std::move(roots);
+      levels.inv_roots[k] = std::move(inv_roots);
+    }
+    num_levels_[static_cast<size_t>(TwiddleLayout::kNatural)] = log_size;
+  }
+
+  // Computes the missing bit-reversed levels below |log_size| by permuting
+  // the natural ones.
+  void GrowBitReversed(uint32_t log_size) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    const Levels& natural =
+        levels_[static_cast<size_t>(TwiddleLayout::kNatural)];
+    Levels& levels = levels_[static_cast<size_t>(TwiddleLayout::kBitReversed)];
+    if (num_levels_[static_cast<size_t>(TwiddleLayout::kNatural)] < log_size) {
+      GrowNatural(log_size);
+    }
+    uint32_t from =
+        num_levels_[static_cast<size_t>(TwiddleLayout::kBitReversed)];
+
+    OPENMP_PARALLEL_FOR(uint32_t k = from; k < log_size; ++k) {
+      size_t size = size_t{1} << k;
+      std::vector<F> roots(size);
+      std::vector<F> inv_roots(size);
+      for (size_t i = 0; i < size; ++i) {
+        size_t ridx =
+            k == 0 ? 0 : base::bits::BitRev(i) >> (sizeof(size_t) * 8 - k);
+        roots[i] = natural.roots[k][ridx];
+        inv_roots[i] = natural.inv_roots[k][ridx];
+      }
+      levels.roots[k] = std::move(roots);
+      levels.inv_roots[k] = std::move(inv_roots);
+    }
+    num_levels_[static_cast<size_t>(TwiddleLayout::kBitReversed)] = log_size;
+  }
+
+  absl::Mutex mu_;
+  // The levels are indexed by |TwiddleLayout|. Only the levels below
+  // |num_levels_| of the same layout are visible to the readers.
+  std::array<Levels, 2> levels_;
+  std::array<uint32_t, 2> num_levels_ ABSL_GUARDED_BY(mu_) = {0, 0};
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_TWIDDLE_CACHE_H_
@@ -0,0 +1,64 @@
+#include "tachyon/math/polynomials/univariate/twiddle_cache.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn254::Fr;
+
+constexpr uint32_t kLogSize = 6;
+
+class TwiddleCacheTest : public FiniteFieldTest<F> {};
+
+}  // namespace
+
+TEST_F(TwiddleCacheTest, GetRootsVec) {
+  TwiddleCache<F>& cache = TwiddleCache<F>::GetInstance();
+  absl::Span<const std::vector<F>> roots_vec = cache.GetRootsVec(kLogSize);
+  absl::Span<const std::vector<F>> inv_roots_vec =
+      cache.GetInvRootsVec(kLogSize);
+  ASSERT_EQ(roots_vec.size(), kLogSize);
+  ASSERT_EQ(inv_roots_vec.size(), kLogSize);
+
+  for (uint32_t k = 0; k < kLogSize; ++k) {
+    F omega;
+    ASSERT_TRUE(F::GetRootOfUnity(size_t{1} << (k + 1), &omega));
+    EXPECT_EQ(roots_vec[k], F::GetSuccessivePowers(size_t{1} << k, omega));
+    EXPECT_EQ(inv_roots_vec[k], F::GetSuccessivePowers(
+                                    size_t{1} << k, unwrap(omega.Inverse())));
+  }
+}
+
+TEST_F(TwiddleCacheTest, Views) {
+  TwiddleCache<F>& cache = TwiddleCache<F>::GetInstance();
+  absl::Span<const std::vector<F>> small = cache.GetRootsVec(kLogSize - 2);
+  absl::Span<const std::vector<F>> big = cache.GetRootsVec(kLogSize + 2);
+  // The smaller domain views into the same levels, which growing the cache
+  // doesn't move.
+  EXPECT_EQ(small.data(), big.data());
+  EXPECT_EQ(small, big.subspan(0, kLogSize - 2));
+}
+
+TEST_F(TwiddleCacheTest, BitReversed) {
+  TwiddleCache<F>& cache = TwiddleCache<F>::GetInstance();
+  absl::Span<const std::vector<F>> roots_vec = cache.GetRootsVec(kLogSize);
+  absl::Span<const std::vector<F>> bit_reversed_roots_vec =
+      cache.GetRootsVec(kLogSize, TwiddleLayout::kBitReversed);
+  ASSERT_EQ(bit_reversed_roots_vec.size(), kLogSize);
+
+  for (uint32_t k = 1; k < kLogSize; ++k) {
+    for (size_t i = 0; i < (size_t{1} << k); ++i) {
+      size_t ridx = base::bits::BitRev(i) >> (sizeof(size_t) * 8 - k);
+      EXPECT_EQ(bit_reversed_roots_vec[k][i], roots_vec[k][ridx]);
+    }
+  }
+}
+
+}  // namespace tachyon::math
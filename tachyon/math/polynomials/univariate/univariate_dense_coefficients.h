@@ -20,6 +20,7 @@
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/containers/adapters.h"
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/memory/numa.h"
 #include "tachyon/base/parallelize.h"
 #include "tachyon/base/strings/string_util.h"
 #include "tachyon/math/polynomials/univariate/support_poly_operators.h"
@@ -53,6 +54,7 @@ class UnivariateDenseCoefficients {
       : coefficients_(coefficients) {
     if (cleanup) RemoveHighDegreeZeros();
     CHECK_LE(Degree(), kMaxDegree);
+    base::ApplyNumaPolicy(coefficients_);
   }
 
   constexpr explicit UnivariateDenseCoefficients(std::vector<F>&& coefficients,
@@ -60,6 +62,7 @@ class UnivariateDenseCoefficients {
       : coefficients_(std::move(coefficients)) {
     if (cleanup) RemoveHighDegreeZeros();
     CHECK_LE(Degree(), kMaxDegree);
+    base::ApplyNumaPolicy(coefficients_);
   }
 
   constexpr static UnivariateDenseCoefficients Zero() {
@@ -12,10 +12,15 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/metrics/metrics_registry.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/base/optional.h"
+#include "tachyon/base/parallelize.h"
 #include "tachyon/base/range.h"
 #include "tachyon/math/polynomials/evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_forwards.h"
@@ -134,6 +139,37 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
 
   constexpr virtual void DoFFT(Evals& evals) const = 0;
 
+  // Compute a FFT whose evaluations are stored in bit-reversed order. See
+  // |DoFFTBitReversed()|.
+  [[nodiscard]] Evals FFTBitReversed(const DensePoly& poly) const {
+    if (poly.IsZero()) return {};
+
+    Evals evals;
+    evals.evaluations_ = poly.coefficients_.coefficients_;
+    DoFFTBitReversed(evals);
+    return evals;
+  }
+
+  [[nodiscard]] Evals FFTBitReversed(DensePoly&& poly) const {
+    if (poly.IsZero()) return {};
+
+    Evals evals;
+    evals.evaluations_ = std::move(poly.coefficients_.coefficients_);
+    DoFFTBitReversed(evals);
+    return evals;
+  }
+
+  // By default, the evaluations of |DoFFT()| are permuted into bit-reversed
+  // order. A domain whose butterflies can write bit-reversed order directly
+  // overrides this to skip the permutation.
+  virtual void DoFFTBitReversed(Evals& evals) const {
+    CHECK(base::bits::IsPowerOfTwo(size_));
+    DoFFT(evals);
+    evals.evaluations_.resize(size_, F::Zero());
+    SwapElements(evals, size_, log_size_of_group_);
+    evals.bit_reversed_ = true;
+  }
+
   // Compute an IFFT.
   [[nodiscard]] constexpr DensePoly IFFT(const Evals& evals) const {
     // NOTE(chokobole): |evals.IsZero()| can be super slow!
@@ -142,7 +178,11 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
 
     DensePoly poly;
     poly.coefficients_.coefficients_ = evals.evaluations_;
-    DoIFFT(poly);
+    if (evals.bit_reversed_) {
+      DoIFFTFromBitReversed(poly);
+    } else {
+      DoIFFT(poly);
+    }
     return poly;
   }
 
@@ -154,12 +194,244 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
 
     DensePoly poly;
     poly.coefficients_.coefficients_ = std::move(evals.evaluations_);
-    DoIFFT(poly);
+    if (evals.bit_reversed_) {
+      DoIFFTFromBitReversed(poly);
+    } else {
+      DoIFFT(poly);
+    }
     return poly;
   }
 
   constexpr virtual void DoIFFT(DensePoly& poly) const = 0;
 
+  // Runs an IFFT over the evaluations in |poly| that are stored in
+  // bit-reversed order. By default, they are permuted back into order for
+  // |DoIFFT()|. A domain whose butterflies can read bit-reversed order
+  // directly overrides this to skip the permutation.
+  virtual void DoIFFTFromBitReversed(DensePoly& poly) const {
+    PermuteIntoOrder(poly);
+    DoIFFT(poly);
+  }
+
+  // Compute FFTs of many polynomials at once. The result is the same as
+  // calling |FFT()| on each of them. See |DoFFTBatch()|.
+  [[nodiscard]] std::vector<Evals> FFTBatch(
+      absl::Span<const DensePoly* const> polys) const {
+    std::vector<Evals> evals_vec(polys.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < polys.size(); ++i) {
+      if (!polys[i]->IsZero()) {
+        evals_vec[i].evaluations_ = polys[i]->coefficients_.coefficients_;
+      }
+    }
+    DoFFTBatch(absl::MakeSpan(evals_vec));
+    return evals_vec;
+  }
+
+  [[nodiscard]] std::vector<Evals> FFTBatch(
+      absl::Span<const DensePoly> polys) const {
+    return FFTBatch(base::Map(polys, [](const DensePoly& poly) {
+      return &poly;
+    }));
+  }
+
+  [[nodiscard]] std::vector<Evals> FFTBatch(
+      std::vector<DensePoly>&& polys) const {
+    std::vector<Evals> evals_vec(polys.size());
+    for (size_t i = 0; i < polys.size(); ++i) {
+      if (!polys[i].IsZero()) {
+        evals_vec[i].evaluations_ =
+            std::move(polys[i].coefficients_.coefficients_);
+      }
+    }
+    DoFFTBatch(absl::MakeSpan(evals_vec));
+    return evals_vec;
+  }
+
+  // Compute IFFTs of many evaluations at once. The result is the same as
+  // calling |IFFT()| on each of them. See |DoIFFTBatch()|.
+  // NOTE: The evaluations in bit-reversed order are permuted back into order
+  // first. Use |IFFT()| to skip the permutation.
+  [[nodiscard]] std::vector<DensePoly> IFFTBatch(
+      absl::Span<const Evals* const> evals_vec) const {
+    std::vector<DensePoly> polys(evals_vec.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < evals_vec.size(); ++i) {
+      polys[i].coefficients_.coefficients_ = evals_vec[i]->evaluations_;
+      if (evals_vec[i]->bit_reversed_) PermuteIntoOrder(polys[i]);
+    }
+    DoIFFTBatch(absl::MakeSpan(polys));
+    return polys;
+  }
+
+  [[nodiscard]] std::vector<DensePoly> IFFTBatch(
+      absl::Span<const Evals> evals_vec) const {
+    return IFFTBatch(
+        base::Map(evals_vec, [](const Evals& evals) { return &evals; }));
+  }
+
+  [[nodiscard]] std::vector<DensePoly> IFFTBatch(
+      std::vector<Evals>&& evals_vec) const {
+    std::vector<DensePoly> polys(evals_vec.size());
+    for (size_t i = 0; i < evals_vec.size(); ++i) {
+      polys[i].coefficients_.coefficients_ =
+          std::move(evals_vec[i].evaluations_);
+      if (evals_vec[i].bit_reversed_) PermuteIntoOrder(polys[i]);
+    }
+    DoIFFTBatch(absl::MakeSpan(polys));
+    return polys;
+  }
+
+  // Computes the low-degree extension of |evals|, the evaluations over this
+  // domain of a polynomial P of degree < |size_|. It returns the evaluations
+  // of P over the coset |shift| * H', where H' is the subgroup of size
+  // |blowup| * |size_|. The result is the same as running |IFFT()| over this
+  // domain and then |FFT()| over that coset. See |DoLDEBatch()|.
+  // NOTE: |evals| may be stored in bit-reversed order, while the result is
+  // always in order. See |LDEBatchBitReversed()| for the other way.
+  [[nodiscard]] Evals LDE(const Evals& evals, size_t blowup,
+                          const F& shift) const {
+    Evals ret = evals;
+    DoLDEBatch(absl::MakeSpan(&ret, 1), blowup, shift);
+    return ret;
+  }
+
+  [[nodiscard]] Evals LDE(Evals&& evals, size_t blowup, const F& shift) const {
+    DoLDEBatch(absl::MakeSpan(&evals, 1), blowup, shift);
+    return std::move(evals);
+  }
+
+  // Computes the low-degree extensions of many evaluations at once. The
+  // result is the same as calling |LDE()| on each of them.
+  [[nodiscard]] std::vector<Evals> LDEBatch(absl::Span<const Evals> evals_vec,
+                                            size_t blowup,
+                                            const F& shift) const {
+    std::vector<Evals> ret(evals_vec.begin(), evals_vec.end());
+    DoLDEBatch(absl::MakeSpan(ret), blowup, shift);
+    return ret;
+  }
+
+  [[nodiscard]] std::vector<Evals> LDEBatch(std::vector<Evals>&& evals_vec,
+                                            size_t blowup,
+                                            const F& shift) const {
+    DoLDEBatch(absl::MakeSpan(evals_vec), blowup, shift);
+    return std::move(evals_vec);
+  }
+
+  // Computes the low-degree extensions of many evaluations at once, whose
+  // results are stored in bit-reversed order. The result is the same as
+  // calling |LDE()| on each of them and permuting it, but a domain that
+  // overrides |DoLDEBatchBitReversed()| never permutes the extensions. Along
+  // with the evaluations that are already in bit-reversed order, this saves
+  // every reordering pass for a consumer that works in bit-reversed order,
+  // e.g., a merkle tree commitment for FRI.
+  [[nodiscard]] std::vector<Evals> LDEBatchBitReversed(
+      absl::Span<const Evals> evals_vec, size_t blowup, const F& shift) const {
+    std::vector<Evals> ret(evals_vec.begin(), evals_vec.end());
+    DoLDEBatchBitReversed(absl::MakeSpan(ret), blowup, shift);
+    return ret;
+  }
+
+  [[nodiscard]] std::vector<Evals> LDEBatchBitReversed(
+      std::vector<Evals>&& evals_vec, size_t blowup, const F& shift) const {
+    DoLDEBatchBitReversed(absl::MakeSpan(evals_vec), blowup, shift);
+    return std::move(evals_vec);
+  }
+
+  // Runs |DoFFT()| on every non-empty element of |evals_vec|. When there are
+  // enough of them or they are small, they are distributed across the
+  // threads, each of which transforms its columns on its own, sharing the
+  // cached twiddles of this domain. Otherwise, they are transformed one by
+  // one, each using every thread.
+  virtual void DoFFTBatch(absl::Span<Evals> evals_vec) const {
+    RunTransforms(evals_vec.size(), [this, evals_vec](size_t i) {
+      if (!evals_vec[i].evaluations_.empty()) DoFFT(evals_vec[i]);
+    });
+  }
+
+  // Runs |DoIFFT()| on every non-empty element of |polys|. See
+  // |DoFFTBatch()|.
+  virtual void DoIFFTBatch(absl::Span<DensePoly> polys) const {
+    RunTransforms(polys.size(), [this, polys](size_t i) {
+      if (!polys[i].coefficients_.coefficients_.empty()) DoIFFT(polys[i]);
+    });
+  }
+
+  // Replaces every non-empty element of |evals_vec| with its low-degree
+  // extension. See |LDE()|. By default, the polynomials are evaluated over the
+  // |blowup| cosets shift * ωʲ * H of this domain H for 0 ≤ j < |blowup|,
+  // where ω generates H', and the results are interleaved, since the i-th
+  // element of the j-th coset is the (i * |blowup| + j)-th element of
+  // shift * H'.
+  virtual void DoLDEBatch(absl::Span<Evals> evals_vec, size_t blowup,
+                          const F& shift) const {
+    size_t extended_size = CheckLDE(evals_vec, blowup);
+    F omega;
+    CHECK(F::GetRootOfUnity(extended_size, &omega));
+
+    std::vector<DensePoly> polys(evals_vec.size());
+    for (size_t i = 0; i < evals_vec.size(); ++i) {
+      polys[i].coefficients_.coefficients_ =
+          std::move(evals_vec[i].evaluations_);
+    }
+    std::vector<bool> non_empty(evals_vec.size());
+    for (size_t i = 0; i < evals_vec.size(); ++i) {
+      non_empty[i] = !polys[i].coefficients_.coefficients_.empty();
+      if (non_empty[i] && evals_vec[i].bit_reversed_) {
+        PermuteIntoOrder(polys[i]);
+      }
+      evals_vec[i].bit_reversed_ = false;
+    }
+    DoIFFTBatch(absl::MakeSpan(polys));
+    for (size_t i = 0; i < evals_vec.size(); ++i) {
+      evals_vec[i].evaluations_.clear();
+      if (non_empty[i]) {
+        evals_vec[i].evaluations_.resize(extended_size, F::Zero());
+      }
+    }
+
+    F offset = shift;
+    for (size_t j = 0; j < blowup; ++j) {
+      std::vector<Evals> cosets =
+          GetCoset(offset)->FFTBatch(absl::MakeConstSpan(polys));
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < evals_vec.size(); ++i) {
+        // NOTE: The cosets of a zero polynomial are empty and its extension
+        // is already filled with zeros.
+        const std::vector<F>& coset = cosets[i].evaluations_;
+        for (size_t k = 0; k < coset.size(); ++k) {
+          evals_vec[i].evaluations_[k * blowup + j] = coset[k];
+        }
+      }
+      offset *= omega;
+    }
+  }
+
+  // Replaces every non-empty element of |evals_vec| with its low-degree
+  // extension in bit-reversed order. See |LDEBatchBitReversed()|. By default,
+  // the extensions of |DoLDEBatch()| are permuted.
+  virtual void DoLDEBatchBitReversed(absl::Span<Evals> evals_vec,
+                                     size_t blowup, const F& shift) const {
+    DoLDEBatch(evals_vec, blowup, shift);
+    size_t extended_size = blowup * size_;
+    CHECK(base::bits::IsPowerOfTwo(extended_size));
+    uint32_t log_extended_size = base::bits::SafeLog2Ceiling(extended_size);
+    for (Evals& evals : evals_vec) {
+      if (evals.evaluations_.empty()) continue;
+      SwapElements(evals, extended_size, log_extended_size);
+      evals.bit_reversed_ = true;
+    }
+  }
+
+  // Checks the arguments of |DoLDEBatch()| and returns the size of the
+  // extended domain.
+  size_t CheckLDE(absl::Span<const Evals> evals_vec, size_t blowup) const {
+    CHECK(base::bits::IsPowerOfTwo(blowup));
+    size_t extended_size = blowup * size_;
+    CHECK_LE(extended_size, MaxDegree + 1);
+    for (const Evals& evals : evals_vec) {
+      CHECK_LE(evals.evaluations_.size(), size_);
+    }
+    return extended_size;
+  }
+
   // Computes the first |size| roots of unity for the entire domain.
   // e.g. for the domain [1, g, g², ..., gⁿ⁻¹}] and |size| = n / 2, it
   // computes [1, g, g², ..., g^{(n / 2) - 1}]
@@ -233,16 +505,21 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
       // In this case, we know that τ = h * gⁱ, for some value i.
       // Then i-th lagrange coefficient in this case is then simply 1,
       // and all other lagrange coefficients are 0.
-      // Thus we find i by brute force.
+      // Thus we find i by brute force, which is split into chunks.
       std::vector<F> u(size, F::Zero());
-      F omega_i = GetElement(range.from);
-      for (F& u_i : u) {
-        if (omega_i == tau) {
-          u_i = F::One();
-          break;
-        }
-        omega_i *= group_gen_;
-      }
+      F omega_from = GetElement(range.from);
+      base::Parallelize(
+          u, [this, &tau, &omega_from](absl::Span<F> chunk, size_t chunk_idx,
+                                       size_t chunk_size) {
+            F omega_i = omega_from * group_gen_.Pow(chunk_idx * chunk_size);
+            for (F& u_i : chunk) {
+              if (omega_i == tau) {
+                u_i = F::One();
+                return;
+              }
+              omega_i *= group_gen_;
+            }
+          });
       return u;
     } else {
       // In this case we have to compute Z_H(τ) * vᵢ / (τ - h * gⁱ)
@@ -370,6 +647,42 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   }
 
  protected:
+  // Returns the metrics of the FFTs, or the IFFTs if |inverse| is true, which
+  // record the elements and the time spent as tachyon_fft_elements_total and
+  // tachyon_fft_seconds with a label "kind" of "fft" or "ifft". See
+  // |base::ThroughputMetrics|.
+  static const base::ThroughputMetrics& GetFFTMetrics(bool inverse) {
+    static const base::ThroughputMetrics fft_metrics("tachyon_fft", "elements",
+                                                     {{"kind", "fft"}});
+    static const base::ThroughputMetrics ifft_metrics(
+        "tachyon_fft", "elements", {{"kind", "ifft"}});
+    return inverse ? ifft_metrics : fft_metrics;
+  }
+
+  // A single transform smaller than this doesn't scale well across the
+  // threads, so |RunTransforms()| distributes the transforms instead.
+  constexpr static size_t kMinSizeForParallelTransform = size_t{1} << 16;
+
+  // Calls |fn(i)| for 0 ≤ i < |num_transforms|. See |DoFFTBatch()|.
+  template <typename Fn>
+  void RunTransforms(size_t num_transforms, Fn&& fn) const {
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+    if (num_transforms > 1 && (num_transforms >= thread_nums ||
+                               size_ < kMinSizeForParallelTransform)) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < num_transforms; ++i) {
+        fn(i);
+      }
+    } else {
+      for (size_t i = 0; i < num_transforms; ++i) {
+        fn(i);
+      }
+    }
+  }
+
   // Multiply the i-th element of |poly_or_evals| with |c|*|g|ⁱ.
   template <typename PolyOrEvals>
   CONSTEXPR_IF_NOT_OPENMP static void DistributePowersAndMulByConst(
@@ -419,8 +732,11 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   //             | c₀ * ω⁰ + c₁ * ω³ + c₂ * ω⁶ + c₃ * ω⁹ |
   // Note that the coefficients are in order and evaluations are out of order(should be swapped after).
   // clang-format on
-  constexpr static void ButterflyFnInOut(F& lo, F& hi, const F& root) {
-    F neg = lo - hi;
+  // NOTE: |T| is either |F| or the packed prime field of |F|, whose lanes
+  // run the same butterfly.
+  template <typename T>
+  constexpr static void ButterflyFnInOut(T& lo, T& hi, const T& root) {
+    T neg = lo - hi;
 
     lo += hi;
 
@@ -458,16 +774,26 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   //             | c₀ * ω⁰ + c₁ * ω³ + c₂ * ω⁶ + c₃ * ω⁹ |
   // Note that the coefficients are out of order the evaluations are in order(should be swapped before).
   // clang-format on
-  constexpr static void ButterflyFnOutIn(F& lo, F& hi, const F& root) {
+  // NOTE: See the note of |ButterflyFnInOut()| for |T|.
+  template <typename T>
+  constexpr static void ButterflyFnOutIn(T& lo, T& hi, const T& root) {
     hi *= root;
 
-    F neg = lo - hi;
+    T neg = lo - hi;
 
     lo += hi;
 
     hi = std::move(neg);
   }
 
+  // Permutes the evaluations in |poly| that are stored in bit-reversed order
+  // back into order.
+  void PermuteIntoOrder(DensePoly& poly) const {
+    CHECK(base::bits::IsPowerOfTwo(size_));
+    CHECK_EQ(poly.coefficients_.coefficients_.size(), size_);
+    SwapElements(poly, size_, log_size_of_group_);
+  }
+
   template <typename PolyOrEvals>
   CONSTEXPR_IF_NOT_OPENMP static void SwapElements(PolyOrEvals& poly_or_evals,
                                                    size_t size,
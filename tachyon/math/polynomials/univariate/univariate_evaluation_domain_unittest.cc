@@ -3,9 +3,12 @@
 // can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
 // file.
 
+#include "absl/strings/substitute.h"
 #include "absl/types/span.h"
 #include "gtest/gtest.h"
 
+#include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/containers/contains.h"
 #include "tachyon/base/functional/function_ref.h"
 #include "tachyon/base/optional.h"
@@ -277,6 +280,148 @@ TYPED_TEST(UnivariateEvaluationDomainTest, FFTCorrectness) {
   }
 }
 
+TYPED_TEST(UnivariateEvaluationDomainTest, FFTBatch) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  size_t domain_size = 32;
+  std::vector<DensePoly> polys = {
+      DensePoly::Random(domain_size - 1), DensePoly::Zero(),
+      DensePoly::Random(domain_size / 8 - 1),
+      DensePoly::Random(domain_size / 2 - 1)};
+  this->TestDomains(domain_size, [&polys](const BaseDomain& d) {
+    std::vector<Evals> expected_evals_vec =
+        base::Map(polys, [&d](const DensePoly& poly) { return d.FFT(poly); });
+    EXPECT_EQ(d.FFTBatch(absl::MakeConstSpan(polys)), expected_evals_vec);
+    std::vector<DensePoly> polys_copy = polys;
+    EXPECT_EQ(d.FFTBatch(std::move(polys_copy)), expected_evals_vec);
+
+    std::vector<DensePoly> expected_polys =
+        base::Map(expected_evals_vec,
+                  [&d](const Evals& evals) { return d.IFFT(evals); });
+    EXPECT_EQ(d.IFFTBatch(absl::MakeConstSpan(expected_evals_vec)),
+              expected_polys);
+    EXPECT_EQ(d.IFFTBatch(std::move(expected_evals_vec)), expected_polys);
+  });
+}
+
+TYPED_TEST(UnivariateEvaluationDomainTest, LDE) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  size_t domain_size = 16;
+  F shift = F::FromMontgomery(F::Config::kSubgroupGenerator);
+  for (size_t blowup : {1, 2, 8}) {
+    SCOPED_TRACE(absl::Substitute("blowup: $0", blowup));
+    this->TestDomains(domain_size, [blowup, &shift](const BaseDomain& d) {
+      F omega;
+      if (!F::GetRootOfUnity(blowup * d.size(), &omega)) return;
+      std::unique_ptr<BaseDomain> extended =
+          Domain::Create(blowup * d.size())->GetCoset(shift);
+      if (extended->size() != blowup * d.size()) return;
+
+      std::vector<Evals> evals_vec = {
+          d.template Random<Evals>(),
+          d.FFT(DensePoly::Random(d.size() / 4 - 1)),
+          d.template Zero<Evals>(),
+          Evals(),
+      };
+      std::vector<Evals> expected_evals_vec = {
+          extended->FFT(d.IFFT(evals_vec[0])),
+          extended->FFT(d.IFFT(evals_vec[1])),
+          Evals(std::vector<F>(extended->size(), F::Zero())),
+          Evals(),
+      };
+      for (size_t i = 0; i < evals_vec.size(); ++i) {
+        EXPECT_EQ(d.LDE(evals_vec[i], blowup, shift), expected_evals_vec[i]);
+      }
+      EXPECT_EQ(d.LDEBatch(absl::MakeConstSpan(evals_vec), blowup, shift),
+                expected_evals_vec);
+      EXPECT_EQ(d.LDEBatch(std::move(evals_vec), blowup, shift),
+                expected_evals_vec);
+    });
+  }
+}
+
+TYPED_TEST(UnivariateEvaluationDomainTest, FFTBitReversed) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  size_t domain_size = 16;
+  this->TestDomains(domain_size, [](const BaseDomain& d) {
+    if (!base::bits::IsPowerOfTwo(d.size())) return;
+    uint32_t log_size = base::bits::Log2Floor(d.size());
+
+    DensePoly poly = DensePoly::Random(d.size() - 1);
+    Evals evals = d.FFT(poly);
+    Evals bit_reversed_evals = d.FFTBitReversed(poly);
+    EXPECT_TRUE(bit_reversed_evals.bit_reversed());
+    for (size_t i = 0; i < d.size(); ++i) {
+      size_t ridx = base::bits::BitRev(i) >> (64 - log_size);
+      EXPECT_EQ(bit_reversed_evals.evaluations()[i], evals.evaluations()[ridx]);
+    }
+
+    EXPECT_EQ(d.IFFT(bit_reversed_evals), poly);
+    EXPECT_EQ(d.IFFTBatch(std::vector<Evals>{bit_reversed_evals, evals}),
+              (std::vector<DensePoly>{poly, poly}));
+  });
+}
+
+TYPED_TEST(UnivariateEvaluationDomainTest, LDEBatchBitReversed) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  size_t domain_size = 16;
+  F shift = F::FromMontgomery(F::Config::kSubgroupGenerator);
+  for (size_t blowup : {1, 2, 8}) {
+    SCOPED_TRACE(absl::Substitute("blowup: $0", blowup));
+    this->TestDomains(domain_size, [blowup, &shift](const BaseDomain& d) {
+      size_t extended_size = blowup * d.size();
+      F omega;
+      if (!F::GetRootOfUnity(extended_size, &omega)) return;
+      if (!base::bits::IsPowerOfTwo(extended_size)) return;
+      uint32_t log_extended_size = base::bits::Log2Floor(extended_size);
+
+      DensePoly poly = DensePoly::Random(d.size() - 1);
+      std::vector<Evals> evals_vec = {
+          d.FFT(poly),
+          d.FFTBitReversed(poly),
+          d.FFT(DensePoly::Random(d.size() / 4 - 1)),
+          Evals(),
+      };
+      std::vector<Evals> expected_evals_vec =
+          d.LDEBatch(absl::MakeConstSpan(evals_vec), blowup, shift);
+      std::vector<Evals> bit_reversed_evals_vec =
+          d.LDEBatchBitReversed(std::move(evals_vec), blowup, shift);
+      // The extension of the evaluations in bit-reversed order is the same.
+      EXPECT_EQ(expected_evals_vec[0], expected_evals_vec[1]);
+      EXPECT_TRUE(bit_reversed_evals_vec[3].evaluations().empty());
+      for (size_t i = 0; i < 3; ++i) {
+        const Evals& bit_reversed_evals = bit_reversed_evals_vec[i];
+        EXPECT_TRUE(bit_reversed_evals.bit_reversed());
+        ASSERT_EQ(bit_reversed_evals.NumElements(), extended_size);
+        for (size_t j = 0; j < extended_size; ++j) {
+          size_t ridx = base::bits::BitRev(j) >> (64 - log_extended_size);
+          EXPECT_EQ(bit_reversed_evals.evaluations()[j],
+                    expected_evals_vec[i].evaluations()[ridx]);
+        }
+      }
+    });
+  }
+}
+
 // Test that the degree aware FFT (O(n log d)) matches the regular FFT
 // (O(n log n)).
 TYPED_TEST(UnivariateEvaluationDomainTest, DegreeAwareFFTCorrectness) {
@@ -286,22 +431,25 @@ TYPED_TEST(UnivariateEvaluationDomainTest, DegreeAwareFFTCorrectness) {
   using DensePoly = typename Domain::DensePoly;
   using Evals = typename Domain::Evals;
 
-  if constexpr (std::is_same_v<F, bls12_381::Fr>) {
-    const size_t log_degree = 5;
-    const size_t degree = (size_t{1} << log_degree) - 1;
-    DensePoly rand_poly = DensePoly::Random(degree);
-    size_t domain_size = (degree + 1) * Domain::kDegreeAwareFFTThresholdFactor;
-    this->TestDomains(domain_size, [domain_size,
-                                    &rand_poly](const BaseDomain& d) {
-      Evals deg_aware_fft_evals = d.FFT(rand_poly);
-      for (size_t i = 0; i < domain_size; ++i) {
-        EXPECT_EQ(deg_aware_fft_evals[i], rand_poly.Evaluate(d.GetElement(i)));
-      }
-    });
-  } else {
-    GTEST_SKIP() << "Skip testing DegreeAwareFFTCorrectness on "
-                    "MixedRadixEvaluationDomain";
+  const size_t log_degree = 5;
+  const size_t degree = (size_t{1} << log_degree) - 1;
+  DensePoly rand_poly = DensePoly::Random(degree);
+  size_t domain_size = (degree + 1) * Domain::kDegreeAwareFFTThresholdFactor;
+  if constexpr (std::is_same_v<F, bn384_small_two_adicity::Fq>) {
+    // Makes the size of the domain 3² * 2⁷ so that the FFTs over the cosets
+    // run the radix-3 passes too.
+    static_assert(F::Config::kSmallSubgroupBase == 3);
+    domain_size *= 3 * 3;
   }
+  this->TestDomains(domain_size, [domain_size,
+                                  &rand_poly](const BaseDomain& d) {
+    ASSERT_EQ(d.size(), domain_size);
+    Evals deg_aware_fft_evals = d.FFT(rand_poly);
+    for (size_t i = 0; i < domain_size; ++i) {
+      EXPECT_EQ(deg_aware_fft_evals[i], rand_poly.Evaluate(d.GetElement(i)));
+    }
+    EXPECT_EQ(rand_poly, d.IFFT(std::move(deg_aware_fft_evals)));
+  });
 }
 
 TYPED_TEST(UnivariateEvaluationDomainTest, RootsOfUnity) {
@@ -18,6 +18,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/json/json.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/memory/numa.h"
 #include "tachyon/base/strings/string_util.h"
 #include "tachyon/math/polynomials/polynomial.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_forwards.h"
@@ -52,10 +53,12 @@ class UnivariateEvaluations final
   constexpr explicit UnivariateEvaluations(const std::vector<F>& evaluations)
       : evaluations_(evaluations) {
     CHECK_LE(Degree(), MaxDegree);
+    base::ApplyNumaPolicy(evaluations_);
   }
   constexpr explicit UnivariateEvaluations(std::vector<F>&& evaluations)
       : evaluations_(std::move(evaluations)) {
     CHECK_LE(Degree(), MaxDegree);
+    base::ApplyNumaPolicy(evaluations_);
   }
 
   constexpr static bool IsCoefficientForm() { return false; }
@@ -87,6 +90,15 @@ class UnivariateEvaluations final
     return std::move(evaluations_);
   }
 
+  // Whether |evaluations_| are stored in bit-reversed order, i.e., the i-th
+  // element is the evaluation at the bitrev(i)-th element of the domain.
+  constexpr bool bit_reversed() const { return bit_reversed_; }
+  // NOTE: This doesn't reorder |evaluations_|. It only declares the order in
+  // which they are stored.
+  constexpr void set_bit_reversed(bool bit_reversed) {
+    bit_reversed_ = bit_reversed;
+  }
+
   // NOTE(chokobole): Sometimes, this degree doesn't match with the exact
   // degree of the coefficients that is produced by IFFT. We leave it for
   // consistency with another polynomial.
@@ -117,7 +129,8 @@ class UnivariateEvaluations final
     if (other.evaluations_.empty()) {
       return IsZero();
     }
-    return evaluations_ == other.evaluations_;
+    return bit_reversed_ == other.bit_reversed_ &&
+           evaluations_ == other.evaluations_;
   }
 
   constexpr bool operator!=(const UnivariateEvaluations& other) const {
@@ -194,6 +207,34 @@ class UnivariateEvaluations final
                                                                        scalar);
   }
 
+  // Returns |this| * |other| + |addend| in a single pass over the
+  // evaluations.
+  UnivariateEvaluations MulAdd(const UnivariateEvaluations& other,
+                               const UnivariateEvaluations& addend) const {
+    return internal::UnivariateEvaluationsOp<F, MaxDegree>::MulAdd(
+        *this, other, addend);
+  }
+
+  UnivariateEvaluations& MulAddInPlace(const UnivariateEvaluations& other,
+                                       const UnivariateEvaluations& addend) {
+    return internal::UnivariateEvaluationsOp<F, MaxDegree>::MulAddInPlace(
+        *this, other, addend);
+  }
+
+  // Returns |this| * |scalar| + |addend| in a single pass over the
+  // evaluations.
+  UnivariateEvaluations MulAdd(const F& scalar,
+                               const UnivariateEvaluations& addend) const {
+    return internal::UnivariateEvaluationsOp<F, MaxDegree>::MulAdd(
+        *this, scalar, addend);
+  }
+
+  UnivariateEvaluations& MulAddInPlace(const F& scalar,
+                                       const UnivariateEvaluations& addend) {
+    return internal::UnivariateEvaluationsOp<F, MaxDegree>::MulAddInPlace(
+        *this, scalar, addend);
+  }
+
   constexpr std::optional<UnivariateEvaluations> Div(
       const UnivariateEvaluations& other) const {
     return internal::UnivariateEvaluationsOp<F, MaxDegree>::Div(*this, other);
@@ -255,6 +296,9 @@ class UnivariateEvaluations final
   }
 
   std::vector<F> evaluations_;
+  // NOTE: This is not serialized, so that the format stays the same. The
+  // evaluations must be in order when they are serialized.
+  bool bit_reversed_ = false;
 };
 
 template <typename F, size_t MaxDegree>
@@ -288,6 +332,7 @@ class Copyable<math::UnivariateEvaluations<F, MaxDegree>> {
  public:
   static bool WriteTo(const math::UnivariateEvaluations<F, MaxDegree>& evals,
                       Buffer* buffer) {
+    CHECK(!evals.bit_reversed());
     return buffer->Write(evals.evaluations());
   }
 
@@ -12,7 +12,14 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/packed_fr.h"
+#include "tachyon/math/finite_fields/baby_bear/packed_baby_bear.h"
+#include "tachyon/math/finite_fields/koala_bear/packed_koala_bear.h"
+#include "tachyon/math/finite_fields/mersenne31/packed_mersenne31.h"
+#include "tachyon/math/finite_fields/packed_field_util.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 
 namespace tachyon::math {
@@ -35,11 +42,13 @@ class UnivariateEvaluationsOp {
       return self;
     }
     CHECK_EQ(l_evaluations.size(), r_evaluations.size());
+    CHECK_EQ(self.bit_reversed_, other.bit_reversed_);
     std::vector<F> o_evaluations(r_evaluations.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
-      o_evaluations[i] = l_evaluations[i] + r_evaluations[i];
-    }
-    return Poly(std::move(o_evaluations));
+    PackedPointwise(
+        absl::MakeSpan(o_evaluations),
+        [](const auto& l, const auto& r) { return l + r; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(r_evaluations));
+    return Create(self, std::move(o_evaluations));
   }
 
   static Poly& AddInPlace(Poly& self, const Poly& other) {
@@ -54,9 +63,11 @@ class UnivariateEvaluationsOp {
       return self;
     }
     CHECK_EQ(l_evaluations.size(), r_evaluations.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
-      l_evaluations[i] += r_evaluations[i];
-    }
+    CHECK_EQ(self.bit_reversed_, other.bit_reversed_);
+    PackedPointwise(
+        absl::MakeSpan(l_evaluations),
+        [](const auto& l, const auto& r) { return l + r; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(r_evaluations));
     return self;
   }
 
@@ -72,11 +83,13 @@ class UnivariateEvaluationsOp {
       return self;
     }
     CHECK_EQ(l_evaluations.size(), r_evaluations.size());
+    CHECK_EQ(self.bit_reversed_, other.bit_reversed_);
     std::vector<F> o_evaluations(r_evaluations.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
-      o_evaluations[i] = l_evaluations[i] - r_evaluations[i];
-    }
-    return Poly(std::move(o_evaluations));
+    PackedPointwise(
+        absl::MakeSpan(o_evaluations),
+        [](const auto& l, const auto& r) { return l - r; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(r_evaluations));
+    return Create(self, std::move(o_evaluations));
   }
 
   static Poly& SubInPlace(Poly& self, const Poly& other) {
@@ -91,9 +104,11 @@ class UnivariateEvaluationsOp {
       return self;
     }
     CHECK_EQ(l_evaluations.size(), r_evaluations.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
-      l_evaluations[i] -= r_evaluations[i];
-    }
+    CHECK_EQ(self.bit_reversed_, other.bit_reversed_);
+    PackedPointwise(
+        absl::MakeSpan(l_evaluations),
+        [](const auto& l, const auto& r) { return l - r; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(r_evaluations));
     return self;
   }
 
@@ -103,10 +118,10 @@ class UnivariateEvaluationsOp {
       return self;
     }
     std::vector<F> o_evaluations(i_evaluations.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < i_evaluations.size(); ++i) {
-      o_evaluations[i] = -i_evaluations[i];
-    }
-    return Poly(std::move(o_evaluations));
+    PackedPointwise(
+        absl::MakeSpan(o_evaluations), [](const auto& v) { return -v; },
+        absl::MakeConstSpan(i_evaluations));
+    return Create(self, std::move(o_evaluations));
   }
 
   static Poly& NegateInPlace(Poly& self) {
@@ -114,11 +129,9 @@ class UnivariateEvaluationsOp {
     if (evaluations.empty()) {
       return self;
     }
-    // clang-format off
-    OPENMP_PARALLEL_FOR(F& evaluation : evaluations) {
-      // clang-format on
-      evaluation.NegateInPlace();
-    }
+    PackedPointwise(
+        absl::MakeSpan(evaluations), [](const auto& v) { return -v; },
+        absl::MakeConstSpan(evaluations));
     return self;
   }
 
@@ -130,11 +143,13 @@ class UnivariateEvaluationsOp {
       return Poly::Zero();
     }
     CHECK_EQ(l_evaluations.size(), r_evaluations.size());
+    CHECK_EQ(self.bit_reversed_, other.bit_reversed_);
     std::vector<F> o_evaluations(r_evaluations.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
-      o_evaluations[i] = l_evaluations[i] * r_evaluations[i];
-    }
-    return Poly(std::move(o_evaluations));
+    PackedPointwise(
+        absl::MakeSpan(o_evaluations),
+        [](const auto& l, const auto& r) { return l * r; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(r_evaluations));
+    return Create(self, std::move(o_evaluations));
   }
 
   static Poly& MulInPlace(Poly& self, const Poly& other) {
@@ -150,9 +165,11 @@ class UnivariateEvaluationsOp {
       return self;
     }
     CHECK_EQ(l_evaluations.size(), r_evaluations.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
-      l_evaluations[i] *= r_evaluations[i];
-    }
+    CHECK_EQ(self.bit_reversed_, other.bit_reversed_);
+    PackedPointwise(
+        absl::MakeSpan(l_evaluations),
+        [](const auto& l, const auto& r) { return l * r; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(r_evaluations));
     return self;
   }
 
@@ -167,10 +184,11 @@ class UnivariateEvaluationsOp {
       return self;
     }
     std::vector<F> o_evaluations(l_evaluations.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < l_evaluations.size(); ++i) {
-      o_evaluations[i] = l_evaluations[i] * scalar;
-    }
-    return Poly(std::move(o_evaluations));
+    PackedPointwise(
+        absl::MakeSpan(o_evaluations),
+        [](const auto& l, const auto& s) { return l * s; },
+        absl::MakeConstSpan(l_evaluations), scalar);
+    return Create(self, std::move(o_evaluations));
   }
 
   static Poly& MulInPlace(Poly& self, const F& scalar) {
@@ -179,9 +197,107 @@ class UnivariateEvaluationsOp {
       // 0 * s or f(x) * 1
       return self;
     }
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < l_evaluations.size(); ++i) {
-      l_evaluations[i] *= scalar;
+    PackedPointwise(
+        absl::MakeSpan(l_evaluations),
+        [](const auto& l, const auto& s) { return l * s; },
+        absl::MakeConstSpan(l_evaluations), scalar);
+    return self;
+  }
+
+  // f(x) * g(x) + h(x)
+  static Poly MulAdd(const Poly& self, const Poly& other, const Poly& addend) {
+    const std::vector<F>& l_evaluations = self.evaluations_;
+    const std::vector<F>& r_evaluations = other.evaluations_;
+    const std::vector<F>& a_evaluations = addend.evaluations_;
+    if (l_evaluations.empty() || r_evaluations.empty()) {
+      // 0 * g(x) + h(x) or f(x) * 0 + h(x)
+      return addend;
+    }
+    if (a_evaluations.empty()) {
+      // f(x) * g(x) + 0
+      return Mul(self, other);
     }
+    CHECK_EQ(l_evaluations.size(), r_evaluations.size());
+    CHECK_EQ(l_evaluations.size(), a_evaluations.size());
+    CHECK_EQ(self.bit_reversed_, other.bit_reversed_);
+    CHECK_EQ(self.bit_reversed_, addend.bit_reversed_);
+    std::vector<F> o_evaluations(l_evaluations.size());
+    PackedPointwise(
+        absl::MakeSpan(o_evaluations),
+        [](const auto& l, const auto& r, const auto& a) { return l * r + a; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(r_evaluations),
+        absl::MakeConstSpan(a_evaluations));
+    return Create(self, std::move(o_evaluations));
+  }
+
+  // f(x) = f(x) * g(x) + h(x)
+  static Poly& MulAddInPlace(Poly& self, const Poly& other,
+                             const Poly& addend) {
+    std::vector<F>& l_evaluations = self.evaluations_;
+    const std::vector<F>& r_evaluations = other.evaluations_;
+    const std::vector<F>& a_evaluations = addend.evaluations_;
+    if (l_evaluations.empty() || r_evaluations.empty()) {
+      // 0 * g(x) + h(x) or f(x) * 0 + h(x)
+      return self = addend;
+    }
+    if (a_evaluations.empty()) {
+      // f(x) * g(x) + 0
+      return MulInPlace(self, other);
+    }
+    CHECK_EQ(l_evaluations.size(), r_evaluations.size());
+    CHECK_EQ(l_evaluations.size(), a_evaluations.size());
+    CHECK_EQ(self.bit_reversed_, other.bit_reversed_);
+    CHECK_EQ(self.bit_reversed_, addend.bit_reversed_);
+    PackedPointwise(
+        absl::MakeSpan(l_evaluations),
+        [](const auto& l, const auto& r, const auto& a) { return l * r + a; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(r_evaluations),
+        absl::MakeConstSpan(a_evaluations));
+    return self;
+  }
+
+  // f(x) * s + h(x)
+  static Poly MulAdd(const Poly& self, const F& scalar, const Poly& addend) {
+    const std::vector<F>& l_evaluations = self.evaluations_;
+    const std::vector<F>& a_evaluations = addend.evaluations_;
+    if (l_evaluations.empty() || scalar.IsZero()) {
+      // 0 * s + h(x) or f(x) * 0 + h(x)
+      return addend;
+    }
+    if (a_evaluations.empty()) {
+      // f(x) * s + 0
+      return Mul(self, scalar);
+    }
+    CHECK_EQ(l_evaluations.size(), a_evaluations.size());
+    CHECK_EQ(self.bit_reversed_, addend.bit_reversed_);
+    std::vector<F> o_evaluations(l_evaluations.size());
+    PackedPointwise(
+        absl::MakeSpan(o_evaluations),
+        [](const auto& l, const auto& s, const auto& a) { return l * s + a; },
+        absl::MakeConstSpan(l_evaluations), scalar,
+        absl::MakeConstSpan(a_evaluations));
+    return Create(self, std::move(o_evaluations));
+  }
+
+  // f(x) = f(x) * s + h(x)
+  static Poly& MulAddInPlace(Poly& self, const F& scalar, const Poly& addend) {
+    std::vector<F>& l_evaluations = self.evaluations_;
+    const std::vector<F>& a_evaluations = addend.evaluations_;
+    if (l_evaluations.empty() || scalar.IsZero()) {
+      // 0 * s + h(x) or f(x) * 0 + h(x)
+      return self = addend;
+    }
+    if (a_evaluations.empty()) {
+      // f(x) * s + 0
+      return MulInPlace(self, scalar);
+    }
+    CHECK_EQ(l_evaluations.size(), a_evaluations.size());
+    CHECK_EQ(self.bit_reversed_, addend.bit_reversed_);
+    PackedPointwise(
+        absl::MakeSpan(l_evaluations),
+        [](const auto& l, const auto& s, const auto& a) { return l * s + a; },
+        absl::MakeConstSpan(l_evaluations), scalar,
+        absl::MakeConstSpan(a_evaluations));
     return self;
   }
 
@@ -203,21 +319,21 @@ class UnivariateEvaluationsOp {
       LOG_IF_NOT_GPU(ERROR) << "Evaluation sizes unequal for division";
       return std::nullopt;
     }
-    std::vector<F> o_evaluations(r_evaluations.size());
-    std::atomic<bool> check_valid(true);
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
-      const std::optional<F> div = l_evaluations[i] / r_evaluations[i];
-      if (UNLIKELY(!div)) {
-        check_valid.store(false, std::memory_order_relaxed);
-        continue;
-      }
-      o_evaluations[i] = std::move(*div);
+    if (UNLIKELY(self.bit_reversed_ != other.bit_reversed_)) {
+      LOG_IF_NOT_GPU(ERROR) << "Evaluation orders unequal for division";
+      return std::nullopt;
     }
-    if (LIKELY(check_valid.load(std::memory_order_relaxed))) {
-      return Poly(std::move(o_evaluations));
+    // NOTE: g(x)⁻¹ is batch inverted into the output, which costs a single
+    // inversion per thread instead of one per element.
+    std::vector<F> o_evaluations(r_evaluations.size());
+    if (UNLIKELY(!BatchInverse(r_evaluations, o_evaluations))) {
+      return std::nullopt;
     }
-    LOG_IF_NOT_GPU(ERROR) << "Division by zero attempted";
-    return std::nullopt;
+    PackedPointwise(
+        absl::MakeSpan(o_evaluations),
+        [](const auto& l, const auto& r_inv) { return l * r_inv; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(o_evaluations));
+    return Create(self, std::move(o_evaluations));
   }
 
   [[nodiscard]] CONSTEXPR_IF_NOT_OPENMP static std::optional<Poly*> DivInPlace(
@@ -238,16 +354,19 @@ class UnivariateEvaluationsOp {
       LOG_IF_NOT_GPU(ERROR) << "Evaluation sizes unequal for division";
       return std::nullopt;
     }
-    std::atomic<bool> check_valid(true);
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
-      if (UNLIKELY(!(l_evaluations[i] /= r_evaluations[i])))
-        check_valid.store(false, std::memory_order_relaxed);
+    if (UNLIKELY(self.bit_reversed_ != other.bit_reversed_)) {
+      LOG_IF_NOT_GPU(ERROR) << "Evaluation orders unequal for division";
+      return std::nullopt;
     }
-    if (LIKELY(check_valid.load(std::memory_order_relaxed))) {
-      return &self;
+    std::vector<F> r_inverses(r_evaluations.size());
+    if (UNLIKELY(!BatchInverse(r_evaluations, r_inverses))) {
+      return std::nullopt;
     }
-    LOG_IF_NOT_GPU(ERROR) << "Division by zero attempted";
-    return std::nullopt;
+    PackedPointwise(
+        absl::MakeSpan(l_evaluations),
+        [](const auto& l, const auto& r_inv) { return l * r_inv; },
+        absl::MakeConstSpan(l_evaluations), absl::MakeConstSpan(r_inverses));
+    return &self;
   }
 
   constexpr static std::optional<Poly> Div(const Poly& self, const F& scalar) {
@@ -264,6 +383,33 @@ class UnivariateEvaluationsOp {
     LOG_IF_NOT_GPU(ERROR) << "Division by zero attempted";
     return std::nullopt;
   }
+
+ private:
+  // Sets |inverses| to the inverses of |evaluations|. Returns false if any of
+  // |evaluations| is zero, which |F::BatchInverse()| would silently map to
+  // zero.
+  static bool BatchInverse(const std::vector<F>& evaluations,
+                           std::vector<F>& inverses) {
+    std::atomic<bool> has_zero(false);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < evaluations.size(); ++i) {
+      if (UNLIKELY(evaluations[i].IsZero())) {
+        has_zero.store(true, std::memory_order_relaxed);
+      }
+    }
+    if (UNLIKELY(has_zero.load(std::memory_order_relaxed))) {
+      LOG_IF_NOT_GPU(ERROR) << "Division by zero attempted";
+      return false;
+    }
+    CHECK(F::BatchInverse(evaluations, &inverses));
+    return true;
+  }
+
+  // Creates the evaluations stored in the same order as |self|.
+  static Poly Create(const Poly& self, std::vector<F>&& evaluations) {
+    Poly ret(std::move(evaluations));
+    ret.bit_reversed_ = self.bit_reversed_;
+    return ret;
+  }
 };
 
 }  // namespace internal
@@ -241,6 +241,32 @@ TEST_F(UnivariateEvaluationsTest, MulScalar) {
   EXPECT_EQ(poly, expected);
 }
 
+TEST_F(UnivariateEvaluationsTest, MulAdd) {
+  Poly a = Poly::Random(kMaxDegree);
+  Poly b = Poly::Random(kMaxDegree);
+  Poly c = Poly::Random(kMaxDegree);
+  GF7 scalar = GF7::Random();
+
+  Poly expected = a * b + c;
+  EXPECT_EQ(a.MulAdd(b, c), expected);
+  Poly tmp = a;
+  tmp.MulAddInPlace(b, c);
+  EXPECT_EQ(tmp, expected);
+
+  expected = a * scalar + c;
+  EXPECT_EQ(a.MulAdd(scalar, c), expected);
+  tmp = a;
+  tmp.MulAddInPlace(scalar, c);
+  EXPECT_EQ(tmp, expected);
+
+  // 0 * g(x) + h(x), f(x) * 0 + h(x) and f(x) * g(x) + 0
+  EXPECT_EQ(Poly::Zero().MulAdd(b, c), c);
+  EXPECT_EQ(a.MulAdd(Poly::Zero(), c), c);
+  EXPECT_EQ(a.MulAdd(GF7::Zero(), c), c);
+  EXPECT_EQ(a.MulAdd(b, Poly::Zero()), a * b);
+  EXPECT_EQ(a.MulAdd(scalar, Poly::Zero()), a * scalar);
+}
+
 TEST_F(UnivariateEvaluationsTest, DivScalar) {
   Poly poly = Poly::Random(kMaxDegree);
   GF7 scalar = GF7::Random();
@@ -0,0 +1,117 @@
+#ifndef TACHYON_NODE_BASE_NODE_ASYNC_WORKER_H_
+#define TACHYON_NODE_BASE_NODE_ASYNC_WORKER_H_
+
+#include <stdint.h>
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "third_party/node_addon_api/napi.h"
+
+#include "tachyon/base/binding/cpp_stack_value.h"
+#include "tachyon/node/base/node_cpp_object.h"
+
+namespace tachyon::node {
+
+// Returns the elements of |T| that the typed array |value| holds without a
+// copy, e.g., the field elements in the Montgomery form as a |BigUint64Array|.
+template <typename T>
+bool TypedArrayToSpan(const Napi::Value& value, absl::Span<const T>* span) {
+  if (!value.IsTypedArray()) return false;
+  Napi::TypedArray array = value.As<Napi::TypedArray>();
+  if (array.ByteOffset() % alignof(T) != 0) return false;
+  if (array.ByteLength() % sizeof(T) != 0) return false;
+  const uint8_t* data =
+      reinterpret_cast<const uint8_t*>(array.ArrayBuffer().Data()) +
+      array.ByteOffset();
+  *span = absl::Span<const T>(reinterpret_cast<const T*>(data),
+                              array.ByteLength() / sizeof(T));
+  return true;
+}
+
+// Returns a |BigUint64Array| that takes the ownership of |values| without a
+// copy.
+template <typename T>
+Napi::Value ToBigUint64Array(Napi::Env env, std::vector<T>&& values) {
+  static_assert(sizeof(T) % sizeof(uint64_t) == 0);
+  auto* owner = new std::vector<T>(std::move(values));
+  size_t byte_length = owner->size() * sizeof(T);
+  Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(
+      env, owner->data(), byte_length,
+      [](Napi::Env, void*, std::vector<T>* owner) { delete owner; }, owner);
+  return Napi::BigUint64Array::New(env, byte_length / sizeof(uint64_t),
+                                   buffer, 0);
+}
+
+// Returns an instance of the bound class |T|.
+template <typename T>
+Napi::Value ToJSObject(Napi::Env env, T&& value) {
+  using Class = std::decay_t<T>;
+  return NodeCppObject<Class>::NewInstance(
+      env, Napi::External<base::CppValue>::New(
+               env, new base::CppStackValue<Class>(std::forward<T>(value))));
+}
+
+// Runs |Task| on a worker thread of libuv and settles a promise with its
+// result on the main thread, so that a long computation doesn't block the
+// event loop. The arguments passed to |Keep()| are referenced until then, so
+// that |Task| can read the typed arrays of them without a copy.
+// NOTE: |Task| must not touch any JS value.
+template <typename R>
+class NodeAsyncWorker : public Napi::AsyncWorker {
+ public:
+  // Returns false with an error message on failure.
+  using Task = std::function<bool(R*, std::string*)>;
+  using Converter = Napi::Value (*)(Napi::Env, R&&);
+
+  NodeAsyncWorker(Napi::Env env, Task task, Converter converter)
+      : Napi::AsyncWorker(env),
+        task_(std::move(task)),
+        converter_(converter),
+        deferred_(Napi::Promise::Deferred::New(env)) {}
+
+  void Keep(const Napi::Value& value) {
+    refs_.push_back(Napi::Persistent(value.ToObject()));
+  }
+
+  // Queues the worker, which deletes itself once the promise is settled.
+  Napi::Promise Run() {
+    Napi::Promise promise = deferred_.Promise();
+    Queue();
+    return promise;
+  }
+
+  // Napi::AsyncWorker methods
+  void Execute() override {
+    R ret;
+    std::string error;
+    if (!task_(&ret, &error)) {
+      SetError(error);
+      return;
+    }
+    ret_ = std::move(ret);
+  }
+
+  void OnOK() override {
+    deferred_.Resolve(converter_(Env(), std::move(*ret_)));
+  }
+
+  void OnError(const Napi::Error& error) override {
+    deferred_.Reject(error.Value());
+  }
+
+ private:
+  Task task_;
+  Converter converter_;
+  Napi::Promise::Deferred deferred_;
+  std::vector<Napi::ObjectReference> refs_;
+  std::optional<R> ret_;
+};
+
+}  // namespace tachyon::node
+
+#endif  // TACHYON_NODE_BASE_NODE_ASYNC_WORKER_H_
@@ -21,4 +21,10 @@ NodeModule NodeModule::AddSubModule(std::string_view name) {
   return NodeModule(env_, exports, name, full_name_);
 }
 
+NodeModule& NodeModule::AddNapiFunction(std::string_view name,
+                                        Napi::Function::Callback f) {
+  exports_.Set(name.data(), Napi::Function::New(env_, f, name.data()));
+  return *this;
+}
+
 }  // namespace tachyon::node
@@ -39,6 +39,11 @@ class TACHYON_EXPORT NodeModule : public NodeCppBindable {
     return *this;
   }
 
+  // Adds |f|, which handles the arguments by itself, e.g., to return a
+  // |Napi::Promise| of a |NodeAsyncWorker|.
+  NodeModule& AddNapiFunction(std::string_view name,
+                              Napi::Function::Callback f);
+
   template <typename Class, typename... Options>
   NodeCppClass<Class, Options...> NewClass(std::string_view name) {
     return NodeCppClass<Class, Options...>(env_, exports_, name, full_name_);
@@ -0,0 +1,69 @@
+#ifndef TACHYON_NODE_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
+#define TACHYON_NODE_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
+
+#include <string>
+#include <utility>
+
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/node/base/node_async_worker.h"
+#include "tachyon/node/base/node_errors.h"
+#include "tachyon/node/base/node_module.h"
+
+namespace tachyon::node::math {
+
+// msmAsync(bases, scalars) returns a promise of the MSM as a jacobian point.
+// |bases| and |scalars| are typed arrays, e.g., |BigUint64Array|, of the
+// coordinates x and y of the affine points and of the scalars respectively,
+// which are in the Montgomery form and read without a copy.
+template <typename AffinePoint,
+          typename ScalarField = typename AffinePoint::ScalarField>
+Napi::Value MSMAsync(const Napi::CallbackInfo& info) {
+  using MSM = tachyon::math::VariableBaseMSM<AffinePoint>;
+  using Bucket = typename MSM::Bucket;
+  using JacobianPoint = decltype(std::declval<Bucket>().ToJacobian());
+
+  Napi::Env env = info.Env();
+  if (info.Length() != 2) {
+    NAPI_THROW(WrongNumberOfArguments(env), env.Null());
+  }
+  absl::Span<const AffinePoint> bases;
+  if (!TypedArrayToSpan(info[0], &bases)) {
+    NAPI_THROW(InvalidArgument(env, 0), env.Null());
+  }
+  absl::Span<const ScalarField> scalars;
+  if (!TypedArrayToSpan(info[1], &scalars)) {
+    NAPI_THROW(InvalidArgument(env, 1), env.Null());
+  }
+
+  auto* worker = new NodeAsyncWorker<JacobianPoint>(
+      env,
+      [bases, scalars](JacobianPoint* ret, std::string* error) {
+        if (bases.size() != scalars.size()) {
+          *error = "Bases and scalars differ in length";
+          return false;
+        }
+        MSM msm;
+        Bucket bucket;
+        if (!msm.Run(bases, scalars, &bucket)) {
+          *error = "Failed to run MSM";
+          return false;
+        }
+        *ret = bucket.ToJacobian();
+        return true;
+      },
+      [](Napi::Env env, JacobianPoint&& ret) {
+        return ToJSObject(env, std::move(ret));
+      });
+  worker->Keep(info[0]);
+  worker->Keep(info[1]);
+  return worker->Run();
+}
+
+template <typename AffinePoint>
+void AddVariableBaseMSM(NodeModule& m) {
+  m.AddNapiFunction("msmAsync", &MSMAsync<AffinePoint>);
+}
+
+}  // namespace tachyon::node::math
+
+#endif  // TACHYON_NODE_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
@@ -8,6 +8,8 @@
 #include "tachyon/node/math/elliptic_curves/bn/bn254/fq.h"
 #include "tachyon/node/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/node/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/node/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/node/math/polynomials/univariate/radix2_evaluation_domain.h"
 
 namespace tachyon::node::math {
 
@@ -17,12 +19,16 @@ void AddMath(NodeModule& m) {
   bls12_381::AddFq(bls12_381);
   bls12_381::AddFr(bls12_381);
   bls12_381::AddG1(bls12_381);
+  AddVariableBaseMSM<tachyon::math::bls12_381::G1AffinePoint>(bls12_381);
+  AddRadix2EvaluationDomain<tachyon::math::bls12_381::Fr>(bls12_381);
 
   NodeModule bn254 = m.AddSubModule("bn254");
   bn254.AddFunction("init", &tachyon::math::bn254::G1Curve::Init);
   bn254::AddFq(bn254);
   bn254::AddFr(bn254);
   bn254::AddG1(bn254);
+  AddVariableBaseMSM<tachyon::math::bn254::G1AffinePoint>(bn254);
+  AddRadix2EvaluationDomain<tachyon::math::bn254::Fr>(bn254);
 }
 
 }  // namespace tachyon::node::math
@@ -0,0 +1,81 @@
+#ifndef TACHYON_NODE_MATH_POLYNOMIALS_UNIVARIATE_RADIX2_EVALUATION_DOMAIN_H_
+#define TACHYON_NODE_MATH_POLYNOMIALS_UNIVARIATE_RADIX2_EVALUATION_DOMAIN_H_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+#include "tachyon/node/base/node_async_worker.h"
+#include "tachyon/node/base/node_errors.h"
+#include "tachyon/node/base/node_module.h"
+
+namespace tachyon::node::math {
+
+namespace internal {
+
+template <typename F>
+Napi::Value FieldsToJSValue(Napi::Env env, std::vector<F>&& values) {
+  return ToBigUint64Array(env, std::move(values));
+}
+
+// Returns a promise of the (I)FFT of the typed array |info[0]| of the field
+// elements in the Montgomery form of a power of two length. The input is read
+// without a copy on the main thread and copied once as a whole on the worker
+// thread, since the domain owns what it transforms, and the output is a
+// |BigUint64Array| that owns the result.
+template <typename F, bool kInverse>
+Napi::Value FFTAsync(const Napi::CallbackInfo& info) {
+  using Domain = tachyon::math::Radix2EvaluationDomain<F>;
+
+  Napi::Env env = info.Env();
+  if (info.Length() != 1) {
+    NAPI_THROW(WrongNumberOfArguments(env), env.Null());
+  }
+  absl::Span<const F> values;
+  if (!TypedArrayToSpan(info[0], &values)) {
+    NAPI_THROW(InvalidArgument0(env), env.Null());
+  }
+
+  auto* worker = new NodeAsyncWorker<std::vector<F>>(
+      env,
+      [values](std::vector<F>* ret, std::string* error) {
+        if (!base::bits::IsPowerOfTwo(values.size())) {
+          *error = "Length must be a power of two";
+          return false;
+        }
+        std::unique_ptr<Domain> domain = Domain::Create(values.size());
+        std::vector<F> input(values.begin(), values.end());
+        if constexpr (kInverse) {
+          *ret = domain->IFFT(typename Domain::Evals(std::move(input)))
+                     .TakeCoefficients()
+                     .TakeCoefficients();
+          // NOTE: The high degree zeros are removed by |IFFT()|.
+          ret->resize(values.size(), F::Zero());
+        } else {
+          *ret = domain
+                     ->FFT(typename Domain::DensePoly(
+                         typename Domain::DenseCoeffs(std::move(input))))
+                     .TakeEvaluations();
+        }
+        return true;
+      },
+      &FieldsToJSValue<F>);
+  worker->Keep(info[0]);
+  return worker->Run();
+}
+
+}  // namespace internal
+
+// Adds fftAsync(coeffs) and ifftAsync(evals).
+template <typename F>
+void AddRadix2EvaluationDomain(NodeModule& m) {
+  m.AddNapiFunction("fftAsync", &internal::FFTAsync<F, false>)
+      .AddNapiFunction("ifftAsync", &internal::FFTAsync<F, true>);
+}
+
+}  // namespace tachyon::node::math
+
+#endif  // TACHYON_NODE_MATH_POLYNOMIALS_UNIVARIATE_RADIX2_EVALUATION_DOMAIN_H_
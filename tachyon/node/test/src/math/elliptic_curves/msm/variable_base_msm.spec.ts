@@ -0,0 +1,27 @@
+import { beforeAll, describe, expect, test } from '@jest/globals';
+
+const tachyon = require('../../../../external/kroma_network_tachyon/tachyon/node/tachyon.node');
+
+beforeAll(() => {
+  tachyon.math.bn254.init();
+});
+
+describe('VariableBaseMSM', () => {
+  test('msmAsync()', async () => {
+    // The affine points of zero coordinates are zeros.
+    const bases = new BigUint64Array(8 * 2 * 4);
+    const scalars = new BigUint64Array(8 * 4);
+    for (let i = 0; i < 8; ++i) {
+      scalars[i * 4] = BigInt(i + 1);
+    }
+    const ret = await tachyon.math.bn254.msmAsync(bases, scalars);
+    expect(ret.isZero()).toBe(true);
+  });
+
+  test('msmAsync() with invalid arguments', async () => {
+    expect(() => tachyon.math.bn254.msmAsync(new BigUint64Array(8))).toThrow();
+    await expect(
+      tachyon.math.bn254.msmAsync(new BigUint64Array(2 * 2 * 4), new BigUint64Array(4)),
+    ).rejects.toThrow('Bases and scalars differ in length');
+  });
+});
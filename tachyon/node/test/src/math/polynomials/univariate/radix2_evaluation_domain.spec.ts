@@ -0,0 +1,25 @@
+import { beforeAll, describe, expect, test } from '@jest/globals';
+
+const tachyon = require('../../../../external/kroma_network_tachyon/tachyon/node/tachyon.node');
+
+beforeAll(() => {
+  tachyon.math.bn254.init();
+});
+
+describe('Radix2EvaluationDomain', () => {
+  test('fftAsync() and ifftAsync()', async () => {
+    const coeffs = new BigUint64Array(8 * 4);
+    for (let i = 0; i < 8; ++i) {
+      coeffs[i * 4] = BigInt(i + 1);
+    }
+    const evals = await tachyon.math.bn254.fftAsync(coeffs);
+    expect(evals.length).toBe(coeffs.length);
+    expect(await tachyon.math.bn254.ifftAsync(evals)).toEqual(coeffs);
+  });
+
+  test('fftAsync() with a length of no power of two', async () => {
+    await expect(tachyon.math.bn254.fftAsync(new BigUint64Array(6 * 4))).rejects.toThrow(
+      'Length must be a power of two',
+    );
+  });
+});
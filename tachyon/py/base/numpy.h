@@ -0,0 +1,67 @@
+#ifndef TACHYON_PY_BASE_NUMPY_H_
+#define TACHYON_PY_BASE_NUMPY_H_
+
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "absl/types/span.h"
+#include "pybind11/numpy.h"
+
+#include "tachyon/py/base/pybind11.h"
+
+namespace tachyon::py {
+
+// A C-contiguous NumPy array of the limbs of the elements, e.g., the field
+// elements in the Montgomery form. An array of n elements has the shape of
+// (n, ...), where the trailing dimensions are the shape of an element. So a
+// million elements cross the boundary at once, instead of as a million Python
+// objects.
+using LimbArray = py11::array_t<uint64_t, py11::array::c_style>;
+
+// Returns the elements that |array| holds without a copy. It throws a
+// |ValueError| unless the trailing dimensions of |array| are |element_shape|.
+template <typename T>
+absl::Span<const T> ViewAs(const LimbArray& array,
+                           const std::vector<py11::ssize_t>& element_shape) {
+  py11::ssize_t limbs = 1;
+  for (py11::ssize_t dim : element_shape) limbs *= dim;
+  static_assert(sizeof(T) % sizeof(uint64_t) == 0);
+  if (static_cast<size_t>(limbs) * sizeof(uint64_t) != sizeof(T)) {
+    throw py11::value_error("Element shape doesn't match the element");
+  }
+  if (static_cast<size_t>(array.ndim()) != element_shape.size() + 1) {
+    throw py11::value_error(absl::Substitute("Expected $0 dimensions, got $1",
+                                             element_shape.size() + 1,
+                                             array.ndim()));
+  }
+  for (size_t i = 0; i < element_shape.size(); ++i) {
+    if (array.shape(i + 1) != element_shape[i]) {
+      throw py11::value_error(absl::Substitute(
+          "Expected $0 at dimension $1, got $2", element_shape[i], i + 1,
+          array.shape(i + 1)));
+    }
+  }
+  return absl::Span<const T>(reinterpret_cast<const T*>(array.data()),
+                             array.shape(0));
+}
+
+// Returns an array that takes the ownership of |values| without a copy.
+template <typename T>
+LimbArray ToArray(std::vector<T>&& values,
+                  std::vector<py11::ssize_t> element_shape) {
+  auto* owner = new std::vector<T>(std::move(values));
+  py11::capsule base(owner, [](void* ptr) {
+    delete reinterpret_cast<std::vector<T>*>(ptr);
+  });
+  element_shape.insert(element_shape.begin(),
+                       static_cast<py11::ssize_t>(owner->size()));
+  return LimbArray(std::move(element_shape),
+                   reinterpret_cast<const uint64_t*>(owner->data()), base);
+}
+
+}  // namespace tachyon::py
+
+#endif  // TACHYON_PY_BASE_NUMPY_H_
@@ -0,0 +1,44 @@
+#ifndef TACHYON_PY_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
+#define TACHYON_PY_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/py/base/numpy.h"
+#include "tachyon/py/base/pybind11.h"
+
+namespace tachyon::py::math {
+
+// Adds |msm()|, which computes an MSM of the arrays of |AffinePoint| and
+// |ScalarField| without copying them. See |AddAffinePoint()| and
+// |AddPrimeField()| for their shapes.
+template <typename AffinePoint,
+          typename BaseField = typename AffinePoint::BaseField,
+          typename ScalarField = typename AffinePoint::ScalarField>
+void AddVariableBaseMSM(py11::module& m) {
+  using MSM = tachyon::math::VariableBaseMSM<AffinePoint>;
+
+  m.def(
+      "msm",
+      [](const LimbArray& bases, const LimbArray& scalars) {
+        absl::Span<const AffinePoint> bases_view =
+            ViewAs<AffinePoint>(bases, {2, BaseField::N});
+        absl::Span<const ScalarField> scalars_view =
+            ViewAs<ScalarField>(scalars, {ScalarField::N});
+        if (bases_view.size() != scalars_view.size()) {
+          throw py11::value_error("Bases and scalars differ in length");
+        }
+        typename MSM::Bucket ret;
+        {
+          // NOTE: |bases| and |scalars| are kept alive by the caller.
+          py11::gil_scoped_release release;
+          MSM msm;
+          CHECK(msm.Run(bases_view, scalars_view, &ret));
+        }
+        return ret.ToJacobian();
+      },
+      py11::arg("bases"), py11::arg("scalars"));
+}
+
+}  // namespace tachyon::py::math
+
+#endif  // TACHYON_PY_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
@@ -2,10 +2,15 @@
 #define TACHYON_PY_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_AFFINE_POINT_H_
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "pybind11/operators.h"
+#include "pybind11/stl.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/base/big_int.h"
+#include "tachyon/py/base/numpy.h"
 #include "tachyon/py/base/pybind11.h"
 
 namespace tachyon::py::math {
@@ -14,6 +19,10 @@ template <typename AffinePoint,
           typename BaseField = typename AffinePoint::BaseField,
           typename ScalarField = typename AffinePoint::ScalarField>
 void AddAffinePoint(py11::module& m, const std::string& name) {
+  // NOTE: The arrays of |AffinePoint| are of shape (n, 2, N), whose rows are
+  // the coordinates x and y in the Montgomery form. See |LimbArray|.
+  constexpr py11::ssize_t N = BaseField::N;
+  static_assert(sizeof(AffinePoint) == 2 * sizeof(BaseField));
   py11::class_<AffinePoint>(m, name.data())
       .def(py11::init<>())
       .def(py11::init<const BaseField&, const BaseField&>(), py11::arg("x"),
@@ -21,6 +30,23 @@ void AddAffinePoint(py11::module& m, const std::string& name) {
       .def_static("zero", &AffinePoint::Zero)
       .def_static("generator", &AffinePoint::Generator)
       .def_static("random", &AffinePoint::Random)
+      .def_static("random_array",
+                  [](size_t n) {
+                    std::vector<AffinePoint> points = base::CreateVector(
+                        n, []() { return AffinePoint::Random(); });
+                    return ToArray(std::move(points), {2, N});
+                  })
+      .def_static("to_array",
+                  [](std::vector<AffinePoint> points) {
+                    return ToArray(std::move(points), {2, N});
+                  })
+      .def_static("from_array",
+                  [](const LimbArray& array) {
+                    absl::Span<const AffinePoint> points =
+                        ViewAs<AffinePoint>(array, {2, N});
+                    return std::vector<AffinePoint>(points.begin(),
+                                                    points.end());
+                  })
       .def_property_readonly("x", &AffinePoint::x)
       .def_property_readonly("y", &AffinePoint::y)
       .def("is_zero", &AffinePoint::IsZero)
@@ -2,10 +2,14 @@
 #define TACHYON_PY_MATH_FINITE_FIELDS_PRIME_FIELD_H_
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "pybind11/operators.h"
 #include "pybind11/stl.h"
 
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/py/base/numpy.h"
 #include "tachyon/py/base/pybind11.h"
 #include "tachyon/py/math/base/big_int.h"
 
@@ -13,6 +17,9 @@ namespace tachyon::py::math {
 
 template <typename PrimeField, size_t N = PrimeField::N>
 void AddPrimeField(py11::module& m, const std::string& name) {
+  // NOTE: The arrays of |PrimeField| are of shape (n, N), whose rows are the
+  // elements in the Montgomery form. See |LimbArray|.
+  static_assert(sizeof(PrimeField) == N * sizeof(uint64_t));
   py11::class_<PrimeField>(m, name.data())
       .def(py11::init<const tachyon::math::BigInt<N>>())
       .def_static("zero", &PrimeField::Zero)
@@ -20,6 +27,23 @@ void AddPrimeField(py11::module& m, const std::string& name) {
       .def_static("random", &PrimeField::Random)
       .def_static("from_dec_string", &PrimeField::FromDecString)
       .def_static("from_hex_string", &PrimeField::FromHexString)
+      .def_static("random_array",
+                  [](size_t n) {
+                    std::vector<PrimeField> values = base::CreateVector(
+                        n, []() { return PrimeField::Random(); });
+                    return ToArray(std::move(values), {N});
+                  })
+      .def_static("to_array",
+                  [](std::vector<PrimeField> values) {
+                    return ToArray(std::move(values), {N});
+                  })
+      .def_static("from_array",
+                  [](const LimbArray& array) {
+                    absl::Span<const PrimeField> values =
+                        ViewAs<PrimeField>(array, {N});
+                    return std::vector<PrimeField>(values.begin(),
+                                                   values.end());
+                  })
       .def("is_zero", &PrimeField::IsZero)
       .def("is_one", &PrimeField::IsOne)
       .def("to_string", &PrimeField::ToString)
@@ -8,6 +8,8 @@
 #include "tachyon/py/math/elliptic_curves/bn/bn254/fq.h"
 #include "tachyon/py/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/py/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/py/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/py/math/polynomials/univariate/radix2_evaluation_domain.h"
 
 namespace tachyon::py::math {
 
@@ -18,12 +20,16 @@ void AddMath(py11::module& m) {
   bls12_381::AddFq(bls12_381);
   bls12_381::AddFr(bls12_381);
   bls12_381::AddG1(bls12_381);
+  AddVariableBaseMSM<tachyon::math::bls12_381::G1AffinePoint>(bls12_381);
+  AddRadix2EvaluationDomain<tachyon::math::bls12_381::Fr>(bls12_381);
 
   py11::module bn254 = math.def_submodule("bn254");
   bn254.def("init", &tachyon::math::bn254::G1Curve::Init);
   bn254::AddFq(bn254);
   bn254::AddFr(bn254);
   bn254::AddG1(bn254);
+  AddVariableBaseMSM<tachyon::math::bn254::G1AffinePoint>(bn254);
+  AddRadix2EvaluationDomain<tachyon::math::bn254::Fr>(bn254);
 }
 
 }  // namespace tachyon::py::math
@@ -0,0 +1,75 @@
+#ifndef TACHYON_PY_MATH_POLYNOMIALS_UNIVARIATE_RADIX2_EVALUATION_DOMAIN_H_
+#define TACHYON_PY_MATH_POLYNOMIALS_UNIVARIATE_RADIX2_EVALUATION_DOMAIN_H_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+#include "tachyon/py/base/numpy.h"
+#include "tachyon/py/base/pybind11.h"
+
+namespace tachyon::py::math {
+
+namespace internal {
+
+template <typename F>
+absl::Span<const F> ViewAsFFTInput(const LimbArray& array) {
+  absl::Span<const F> values = ViewAs<F>(array, {F::N});
+  if (!base::bits::IsPowerOfTwo(values.size())) {
+    throw py11::value_error("Length must be a power of two");
+  }
+  return values;
+}
+
+}  // namespace internal
+
+// Adds |fft()| and |ifft()|, which take and return the arrays of |F| of a
+// power of two length. See |AddPrimeField()| for their shapes. The input is
+// copied once as a whole, since the domain owns what it transforms, and the
+// output is returned without a copy.
+template <typename F>
+void AddRadix2EvaluationDomain(py11::module& m) {
+  using Domain = tachyon::math::Radix2EvaluationDomain<F>;
+
+  m.def(
+      "fft",
+      [](const LimbArray& coeffs) {
+        absl::Span<const F> coeffs_view =
+            internal::ViewAsFFTInput<F>(coeffs);
+        std::vector<F> evals;
+        {
+          py11::gil_scoped_release release;
+          std::unique_ptr<Domain> domain = Domain::Create(coeffs_view.size());
+          typename Domain::DensePoly poly(typename Domain::DenseCoeffs(
+              std::vector<F>(coeffs_view.begin(), coeffs_view.end())));
+          evals = domain->FFT(std::move(poly)).TakeEvaluations();
+        }
+        return ToArray(std::move(evals), {F::N});
+      },
+      py11::arg("coeffs"));
+  m.def(
+      "ifft",
+      [](const LimbArray& evals) {
+        absl::Span<const F> evals_view = internal::ViewAsFFTInput<F>(evals);
+        std::vector<F> coeffs;
+        {
+          py11::gil_scoped_release release;
+          std::unique_ptr<Domain> domain = Domain::Create(evals_view.size());
+          typename Domain::Evals cpp_evals(
+              std::vector<F>(evals_view.begin(), evals_view.end()));
+          coeffs = domain->IFFT(std::move(cpp_evals))
+                       .TakeCoefficients()
+                       .TakeCoefficients();
+          // NOTE: The high degree zeros are removed by |IFFT()|.
+          coeffs.resize(evals_view.size(), F::Zero());
+        }
+        return ToArray(std::move(coeffs), {F::N});
+      },
+      py11::arg("evals"));
+}
+
+}  // namespace tachyon::py::math
+
+#endif  // TACHYON_PY_MATH_POLYNOMIALS_UNIVARIATE_RADIX2_EVALUATION_DOMAIN_H_
@@ -1,4 +1,5 @@
 from absl.testing import absltest
+import numpy as np
 
 from external.kroma_network_tachyon.tachyon.py import tachyon
 
@@ -93,3 +94,25 @@ class AffinePointTest(absltest.TestCase):
                 '21888242871839275222246405745257275088696311157297823662689037894645226208572'),
             tachyon.math.bn254.Fq(4)
         ))
+
+    def test_array(self):
+        points = [tachyon.math.bn254.G1AffinePoint.random() for _ in range(4)]
+        array = tachyon.math.bn254.G1AffinePoint.to_array(points)
+        self.assertEqual(array.shape, (4, 2, 4))
+        self.assertEqual(array.dtype, np.uint64)
+        self.assertEqual(tachyon.math.bn254.G1AffinePoint.from_array(array), points)
+
+    def test_msm(self):
+        points = [tachyon.math.bn254.G1AffinePoint.random() for _ in range(16)]
+        scalars = [tachyon.math.bn254.Fr.random() for _ in range(16)]
+        expected = tachyon.math.bn254.G1JacobianPoint.zero()
+        for point, scalar in zip(points, scalars):
+            expected += point * scalar
+        ret = tachyon.math.bn254.msm(
+            tachyon.math.bn254.G1AffinePoint.to_array(points),
+            tachyon.math.bn254.Fr.to_array(scalars))
+        self.assertEqual(ret, expected)
+        with self.assertRaises(ValueError):
+            tachyon.math.bn254.msm(
+                tachyon.math.bn254.G1AffinePoint.to_array(points),
+                tachyon.math.bn254.Fr.to_array(scalars[:8]))
@@ -1,4 +1,5 @@
 from absl.testing import absltest
+import numpy as np
 
 from external.kroma_network_tachyon.tachyon.py import tachyon
 
@@ -141,3 +142,21 @@ class PrimeFieldTest(absltest.TestCase):
         self.assertEqual(f.square(), expected)
         f.square_in_place()
         self.assertEqual(f, expected)
+
+    def test_array(self):
+        values = [tachyon.math.bn254.Fr.random() for _ in range(4)]
+        array = tachyon.math.bn254.Fr.to_array(values)
+        self.assertEqual(array.shape, (4, 4))
+        self.assertEqual(array.dtype, np.uint64)
+        self.assertEqual(tachyon.math.bn254.Fr.from_array(array), values)
+        self.assertEqual(tachyon.math.bn254.Fr.random_array(8).shape, (8, 4))
+        with self.assertRaises(ValueError):
+            tachyon.math.bn254.Fr.from_array(np.zeros((4, 3), dtype=np.uint64))
+
+    def test_fft(self):
+        coeffs = tachyon.math.bn254.Fr.random_array(8)
+        evals = tachyon.math.bn254.fft(coeffs)
+        self.assertEqual(evals.shape, (8, 4))
+        np.testing.assert_array_equal(tachyon.math.bn254.ifft(evals), coeffs)
+        with self.assertRaises(ValueError):
+            tachyon.math.bn254.fft(tachyon.math.bn254.Fr.random_array(6))
@@ -0,0 +1,25 @@
+use std::{mem, slice};
+
+/// Reinterprets `values` as a slice of `U` without a copy, so that a whole
+/// slice crosses the FFI boundary as a single pointer and length instead of
+/// being converted element by element.
+///
+/// # Safety
+///
+/// `T` and `U` must have the same size and representation, e.g., a halo2curves
+/// field and the tachyon field of the same modulus, both in the Montgomery
+/// form, and `values` must be aligned as far as the reader of `U` requires.
+pub unsafe fn cast_slice<T, U>(values: &[T]) -> &[U] {
+    assert_eq!(mem::size_of::<T>(), mem::size_of::<U>());
+    slice::from_raw_parts(values.as_ptr() as *const U, values.len())
+}
+
+/// The mutable version of `cast_slice()`.
+///
+/// # Safety
+///
+/// See `cast_slice()`.
+pub unsafe fn cast_slice_mut<T, U>(values: &mut [T]) -> &mut [U] {
+    assert_eq!(mem::size_of::<T>(), mem::size_of::<U>());
+    slice::from_raw_parts_mut(values.as_mut_ptr() as *mut U, values.len())
+}
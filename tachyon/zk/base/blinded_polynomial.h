@@ -9,10 +9,16 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/strings/substitute.h"
+#include "absl/types/span.h"
 
-namespace tachyon::zk {
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/containers/container_util.h"
+
+namespace tachyon {
+namespace zk {
 
 template <typename Poly, typename Evals>
 class BlindedPolynomial {
@@ -38,6 +44,20 @@ class BlindedPolynomial {
     poly_ = domain->IFFT(std::move(evals_));
   }
 
+  // Same as calling |TransformEvalsToPoly()| on each of |polys|, but the
+  // IFFTs are run as a batch. See |UnivariateEvaluationDomain::IFFTBatch()|.
+  template <typename Domain>
+  static void TransformEvalsToPoly(absl::Span<BlindedPolynomial* const> polys,
+                                   const Domain* domain) {
+    std::vector<Poly> transformed = domain->IFFTBatch(
+        base::Map(polys, [](BlindedPolynomial* poly) {
+          return std::move(poly->evals_);
+        }));
+    for (size_t i = 0; i < polys.size(); ++i) {
+      polys[i]->poly_ = std::move(transformed[i]);
+    }
+  }
+
   std::string ToString() const {
     if (evals_.NumElements() == 0) {
       return absl::Substitute("{poly: $0, blind: $1}", poly_.ToString(),
@@ -48,12 +68,45 @@ class BlindedPolynomial {
     }
   }
 
+ bool operator==(const BlindedPolynomial& other) const {
+    return poly_ == other.poly_ && evals_ == other.evals_ &&
+           blind_ == other.blind_;
+  }
+  bool operator!=(const BlindedPolynomial& other) const {
+    return !operator==(other);
+  }
+
  private:
+  friend class base::Copyable<BlindedPolynomial<Poly, Evals>>;
+
   Poly poly_;
   Evals evals_;
   F blind_;
 };
 
-}  // namespace tachyon::zk
+}  // namespace zk
+
+namespace base {
+
+template <typename Poly, typename Evals>
+class Copyable<zk::BlindedPolynomial<Poly, Evals>> {
+ public:
+  static bool WriteTo(const zk::BlindedPolynomial<Poly, Evals>& poly,
+                      Buffer* buffer) {
+    return buffer->WriteMany(poly.poly_, poly.evals_, poly.blind_);
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       zk::BlindedPolynomial<Poly, Evals>* poly) {
+    return buffer.ReadMany(&poly->poly_, &poly->evals_, &poly->blind_);
+  }
+
+  static size_t EstimateSize(const zk::BlindedPolynomial<Poly, Evals>& poly) {
+    return base::EstimateSize(poly.poly_, poly.evals_, poly.blind_);
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
 
 #endif  // TACHYON_ZK_BASE_BLINDED_POLYNOMIAL_H_
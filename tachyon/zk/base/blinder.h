@@ -3,6 +3,8 @@
 
 #include <stddef.h>
 
+#include "absl/types/span.h"
+
 #include "tachyon/zk/base/random_field_generator_base.h"
 #include "tachyon/zk/base/row_types.h"
 
@@ -37,10 +39,8 @@ class Blinder {
     if (include_last_row) ++blinding_rows;
     if (size < blinding_rows) return false;
     RowIndex start = size - blinding_rows;
-    for (RowIndex i = start; i < size; ++i) {
-      // NOTE(chokobole): Boundary check is the responsibility of API callers.
-      evals.at(i) = random_field_generator_->Generate();
-    }
+    random_field_generator_->GenerateMany(
+        absl::MakeSpan(evals.evaluations()).subspan(start, blinding_rows));
     return true;
   }
 
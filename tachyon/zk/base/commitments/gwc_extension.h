@@ -12,6 +12,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
 #include "tachyon/crypto/commitments/kzg/gwc.h"
 #include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
@@ -50,6 +52,8 @@ class GWCExtension final
   using Field = typename Base::Field;
   using Poly = typename Base::Poly;
   using Evals = typename Base::Evals;
+  using PairingPoints =
+      typename crypto::GWC<Curve, MaxDegree, Commitment>::PairingPoints;
 
   GWCExtension() = default;
   explicit GWCExtension(crypto::GWC<Curve, MaxDegree, Commitment>&& gwc)
@@ -91,6 +95,11 @@ class GWCExtension final
     return gwc_.DoUnsafeSetup(size, tau);
   }
 
+  // See |crypto::KZG::Precompute()|.
+  [[nodiscard]] bool Precompute(size_t precompute_factor) {
+    return gwc_.Precompute(precompute_factor);
+  }
+
   template <typename ScalarContainer>
   [[nodiscard]] bool DoCommit(const ScalarContainer& v, Commitment* out) const {
     return gwc_.DoCommit(v, out);
@@ -137,6 +146,39 @@ class GWCExtension final
     return gwc_.DoCommitLagrange(v, state, index);
   }
 
+  [[nodiscard]] bool DoBatchCommit(absl::Span<const Poly* const> polys,
+                                   crypto::BatchCommitmentState& state,
+                                   size_t index) {
+    return gwc_.DoBatchCommit(polys, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommit(
+      absl::Span<const absl::Span<const Field>> scalars_list,
+      crypto::BatchCommitmentState& state, size_t index) {
+    return gwc_.DoBatchCommit(scalars_list, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommitLagrange(
+      absl::Span<const Evals* const> evals_list,
+      crypto::BatchCommitmentState& state, size_t index) {
+    return gwc_.DoBatchCommitLagrange(evals_list, state, index);
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const Field> deltas,
+                                      Commitment* out) const {
+    return gwc_.DoUpdateLagrange(commitment, rows, deltas, out);
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const Field> deltas,
+                                      crypto::BatchCommitmentState& state,
+                                      size_t index) {
+    return gwc_.DoUpdateLagrange(commitment, rows, deltas, state, index);
+  }
+
   template <typename Container, typename Proof>
   [[nodiscard]] bool DoCreateOpeningProof(const Container& poly_openings,
                                           Proof* proof) {
@@ -149,6 +191,19 @@ class GWCExtension final
     return gwc_.DoVerifyOpeningProof(poly_openings, proof);
   }
 
+  template <typename Container>
+  [[nodiscard]] bool ComputePairingPoints(
+      const Container& poly_openings,
+      crypto::TranscriptReader<Commitment>* reader,
+      PairingPoints* pairing_points) const {
+    return gwc_.ComputePairingPoints(poly_openings, reader, pairing_points);
+  }
+
+  [[nodiscard]] bool BatchVerifyPairingPoints(
+      absl::Span<const PairingPoints> pairing_points_vec) const {
+    return gwc_.BatchVerifyPairingPoints(pairing_points_vec);
+  }
+
  private:
   template <typename PCS, typename LS>
   friend class c::zk::plonk::halo2::KZGFamilyProverImpl;
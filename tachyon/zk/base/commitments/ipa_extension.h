@@ -0,0 +1,242 @@
+// Copyright 2020-2022 The Electric Coin Company
+// Copyright 2022 The Halo2 developers
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.halo2 and the LICENCE-APACHE.halo2
+// file.
+
+#ifndef TACHYON_ZK_BASE_COMMITMENTS_IPA_EXTENSION_H_
+#define TACHYON_ZK_BASE_COMMITMENTS_IPA_EXTENSION_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/crypto/commitments/batch_commitment_state.h"
+#include "tachyon/crypto/commitments/ipa/ipa.h"
+#include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
+
+namespace tachyon {
+namespace zk {
+
+template <typename Point, size_t MaxDegree, size_t MaxExtendedDegree,
+          typename Commitment>
+class IPAExtension final
+    : public UnivariatePolynomialCommitmentSchemeExtension<
+          IPAExtension<Point, MaxDegree, MaxExtendedDegree, Commitment>> {
+ public:
+  // NOTE: The following values are pre-determined according to the Commitment
+  // Opening Scheme. Like GWC, the IPA multiopen of halo2 queries the instance
+  // columns.
+  constexpr static bool kQueryInstance = true;
+
+  using Base = UnivariatePolynomialCommitmentSchemeExtension<
+      IPAExtension<Point, MaxDegree, MaxExtendedDegree, Commitment>>;
+  using Field = typename Base::Field;
+  using Poly = typename Base::Poly;
+  using Evals = typename Base::Evals;
+  using VerificationMSM =
+      typename crypto::IPA<Point, MaxDegree, Commitment>::VerificationMSM;
+
+  IPAExtension() = default;
+  explicit IPAExtension(crypto::IPA<Point, MaxDegree, Commitment>&& ipa)
+      : ipa_(std::move(ipa)) {}
+
+  IPAExtension(std::vector<Point>&& g, std::vector<Point>&& g_lagrange,
+               Point&& u, Point&& w)
+      : ipa_(std::move(g), std::move(g_lagrange), std::move(u), std::move(w)) {
+  }
+
+  const crypto::IPA<Point, MaxDegree, Commitment>& ipa() const { return ipa_; }
+
+  const char* Name() { return ipa_.Name(); }
+
+  size_t N() const { return ipa_.N(); }
+
+  size_t D() const { return N() - 1; }
+
+  crypto::BatchCommitmentState& batch_commitment_state() {
+    return ipa_.batch_commitment_state();
+  }
+  bool GetBatchMode() const { return ipa_.GetBatchMode(); }
+
+  void SetBatchMode(size_t batch_count) { ipa_.SetBatchMode(batch_count); }
+
+  std::vector<Commitment> GetBatchCommitments() {
+    return ipa_.GetBatchCommitments();
+  }
+
+  [[nodiscard]] bool DoSetup(size_t size) { return ipa_.DoSetup(size); }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommit(const ScalarContainer& v, Commitment* out) const {
+    return ipa_.DoCommit(v, out);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommit(const ScalarContainer& v,
+                              crypto::BatchCommitmentState& state,
+                              size_t index) {
+    return ipa_.DoCommit(v, state, index);
+  }
+
+  [[nodiscard]] bool DoCommit(const Poly& poly, Commitment* out) const {
+    return ipa_.DoCommit(poly, out);
+  }
+
+  [[nodiscard]] bool DoCommit(const Poly& poly,
+                              crypto::BatchCommitmentState& state,
+                              size_t index) {
+    return ipa_.DoCommit(poly, state, index);
+  }
+
+  [[nodiscard]] bool DoCommitLagrange(const Evals& evals,
+                                      Commitment* out) const {
+    return ipa_.DoCommitLagrange(evals, out);
+  }
+
+  [[nodiscard]] bool DoCommitLagrange(const Evals& evals,
+                                      crypto::BatchCommitmentState& state,
+                                      size_t index) {
+    return ipa_.DoCommitLagrange(evals, state, index);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
+                                      Commitment* out) const {
+    return ipa_.DoCommitLagrange(v, out);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
+                                      crypto::BatchCommitmentState& state,
+                                      size_t index) {
+    return ipa_.DoCommitLagrange(v, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommit(absl::Span<const Poly* const> polys,
+                                   crypto::BatchCommitmentState& state,
+                                   size_t index) {
+    return ipa_.DoBatchCommit(polys, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommit(
+      absl::Span<const absl::Span<const Field>> scalars_list,
+      crypto::BatchCommitmentState& state, size_t index) {
+    return ipa_.DoBatchCommit(scalars_list, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommitLagrange(
+      absl::Span<const Evals* const> evals_list,
+      crypto::BatchCommitmentState& state, size_t index) {
+    return ipa_.DoBatchCommitLagrange(evals_list, state, index);
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const Field> deltas,
+                                      Commitment* out) const {
+    return ipa_.DoUpdateLagrange(commitment, rows, deltas, out);
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const Field> deltas,
+                                      crypto::BatchCommitmentState& state,
+                                      size_t index) {
+    return ipa_.DoUpdateLagrange(commitment, rows, deltas, state, index);
+  }
+
+  template <typename Container, typename Proof>
+  [[nodiscard]] bool DoCreateOpeningProof(const Container& poly_openings,
+                                          Proof* proof) {
+    return ipa_.DoCreateOpeningProof(poly_openings, proof);
+  }
+
+  template <typename Container, typename Proof>
+  [[nodiscard]] bool DoVerifyOpeningProof(const Container& poly_openings,
+                                          Proof* proof) const {
+    return ipa_.DoVerifyOpeningProof(poly_openings, proof);
+  }
+
+  template <typename Container>
+  [[nodiscard]] bool ComputeVerificationMSM(
+      const Container& poly_openings,
+      crypto::TranscriptReader<Commitment>* reader,
+      VerificationMSM* msm) const {
+    return ipa_.ComputeVerificationMSM(poly_openings, reader, msm);
+  }
+
+  [[nodiscard]] bool VerifyMSM(absl::Span<const VerificationMSM> msms) const {
+    return ipa_.VerifyMSM(msms);
+  }
+
+ private:
+  friend class base::Copyable<
+      IPAExtension<Point, MaxDegree, MaxExtendedDegree, Commitment>>;
+
+  crypto::IPA<Point, MaxDegree, Commitment> ipa_;
+};
+
+template <typename Point, size_t MaxDegree, size_t MaxExtendedDegree,
+          typename Commitment>
+struct UnivariatePolynomialCommitmentSchemeExtensionTraits<
+    IPAExtension<Point, MaxDegree, MaxExtendedDegree, Commitment>> {
+ public:
+  constexpr static size_t kMaxExtendedDegree = MaxExtendedDegree;
+  constexpr static size_t kMaxExtendedSize = kMaxExtendedDegree + 1;
+};
+
+}  // namespace zk
+
+namespace crypto {
+
+template <typename Point, size_t MaxDegree, size_t MaxExtendedDegree,
+          typename _Commitment>
+struct VectorCommitmentSchemeTraits<
+    zk::IPAExtension<Point, MaxDegree, MaxExtendedDegree, _Commitment>> {
+ public:
+  using Field = typename Point::ScalarField;
+  using Commitment = _Commitment;
+
+  constexpr static size_t kMaxSize = MaxDegree + 1;
+  constexpr static bool kIsTransparent = true;
+  constexpr static bool kSupportsBatchMode = true;
+};
+
+}  // namespace crypto
+
+namespace base {
+
+template <typename Point, size_t MaxDegree, size_t MaxExtendedDegree,
+          typename Commitment>
+class Copyable<
+    zk::IPAExtension<Point, MaxDegree, MaxExtendedDegree, Commitment>> {
+ public:
+  using PCS = zk::IPAExtension<Point, MaxDegree, MaxExtendedDegree, Commitment>;
+
+  static bool WriteTo(const PCS& pcs, Buffer* buffer) {
+    return buffer->WriteMany(pcs.ipa_);
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, PCS* pcs) {
+    crypto::IPA<Point, MaxDegree, Commitment> ipa;
+    if (!buffer.ReadMany(&ipa)) {
+      return false;
+    }
+
+    pcs->ipa_ = std::move(ipa);
+    return true;
+  }
+
+  static size_t EstimateSize(const PCS& pcs) {
+    return base::EstimateSize(pcs.ipa_);
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_ZK_BASE_COMMITMENTS_IPA_EXTENSION_H_
@@ -12,6 +12,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
 #include "tachyon/crypto/commitments/kzg/shplonk.h"
 #include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
@@ -50,6 +52,8 @@ class SHPlonkExtension final
   using Field = typename Base::Field;
   using Poly = typename Base::Poly;
   using Evals = typename Base::Evals;
+  using PairingPoints =
+      typename crypto::SHPlonk<Curve, MaxDegree, Commitment>::PairingPoints;
 
   SHPlonkExtension() = default;
   explicit SHPlonkExtension(
@@ -92,6 +96,11 @@ class SHPlonkExtension final
     return shplonk_.DoUnsafeSetup(size, tau);
   }
 
+  // See |crypto::KZG::Precompute()|.
+  [[nodiscard]] bool Precompute(size_t precompute_factor) {
+    return shplonk_.Precompute(precompute_factor);
+  }
+
   template <typename ScalarContainer>
   [[nodiscard]] bool DoCommit(const ScalarContainer& v, Commitment* out) const {
     return shplonk_.DoCommit(v, out);
@@ -138,6 +147,39 @@ class SHPlonkExtension final
     return shplonk_.DoCommitLagrange(v, state, index);
   }
 
+  [[nodiscard]] bool DoBatchCommit(absl::Span<const Poly* const> polys,
+                                   crypto::BatchCommitmentState& state,
+                                   size_t index) {
+    return shplonk_.DoBatchCommit(polys, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommit(
+      absl::Span<const absl::Span<const Field>> scalars_list,
+      crypto::BatchCommitmentState& state, size_t index) {
+    return shplonk_.DoBatchCommit(scalars_list, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommitLagrange(
+      absl::Span<const Evals* const> evals_list,
+      crypto::BatchCommitmentState& state, size_t index) {
+    return shplonk_.DoBatchCommitLagrange(evals_list, state, index);
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const Field> deltas,
+                                      Commitment* out) const {
+    return shplonk_.DoUpdateLagrange(commitment, rows, deltas, out);
+  }
+
+  [[nodiscard]] bool DoUpdateLagrange(const Commitment& commitment,
+                                      absl::Span<const size_t> rows,
+                                      absl::Span<const Field> deltas,
+                                      crypto::BatchCommitmentState& state,
+                                      size_t index) {
+    return shplonk_.DoUpdateLagrange(commitment, rows, deltas, state, index);
+  }
+
   template <typename Container, typename Proof>
   [[nodiscard]] bool DoCreateOpeningProof(const Container& poly_openings,
                                           Proof* proof) {
@@ -150,6 +192,19 @@ class SHPlonkExtension final
     return shplonk_.DoVerifyOpeningProof(poly_openings, proof);
   }
 
+  template <typename Container>
+  [[nodiscard]] bool ComputePairingPoints(
+      const Container& poly_openings,
+      crypto::TranscriptReader<Commitment>* reader,
+      PairingPoints* pairing_points) const {
+    return shplonk_.ComputePairingPoints(poly_openings, reader, pairing_points);
+  }
+
+  [[nodiscard]] bool BatchVerifyPairingPoints(
+      absl::Span<const PairingPoints> pairing_points_vec) const {
+    return shplonk_.BatchVerifyPairingPoints(pairing_points_vec);
+  }
+
  private:
   template <typename PCS, typename LS>
   friend class c::zk::plonk::halo2::KZGFamilyProverImpl;
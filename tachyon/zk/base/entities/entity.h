@@ -11,6 +11,8 @@
 #include <memory>
 #include <utility>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/vector_commitment_scheme_traits_forward.h"
 #include "tachyon/crypto/transcripts/transcript.h"
@@ -40,17 +42,26 @@ class Entity {
 
   const PCS& pcs() const { return pcs_; }
   PCS& pcs() { return pcs_; }
-  void set_domain(std::unique_ptr<Domain> domain) {
+  // NOTE: The domains are immutable once created, so they can be shared by
+  // several entities, e.g, the provers proving the same circuit concurrently.
+  void set_domain(std::shared_ptr<const Domain> domain) {
     CHECK_LE(domain->size(), size_t{std::numeric_limits<RowIndex>::max()});
     domain_ = std::move(domain);
   }
   const Domain* domain() const { return domain_.get(); }
-  void set_extended_domain(std::unique_ptr<ExtendedDomain> extended_domain) {
+  const std::shared_ptr<const Domain>& shared_domain() const {
+    return domain_;
+  }
+  void set_extended_domain(
+      std::shared_ptr<const ExtendedDomain> extended_domain) {
     extended_domain_ = std::move(extended_domain);
   }
   const ExtendedDomain* extended_domain() const {
     return extended_domain_.get();
   }
+  const std::shared_ptr<const ExtendedDomain>& shared_extended_domain() const {
+    return extended_domain_;
+  }
   crypto::Transcript<Commitment>* transcript() { return transcript_.get(); }
   const crypto::Transcript<Commitment>* transcript() const {
     return transcript_.get();
@@ -104,10 +115,32 @@ class Entity {
     CHECK(pcs_.DoCommit(container, pcs_.batch_commitment_state(), index));
   }
 
+  // Commits to each of |evals_list| at |index|, |index| + 1, and so on. This
+  // is preferred to calling |BatchCommitAt()| for each of them, since the PCS
+  // can share the loads of its parameters between the commitments.
+  template <typename T = PCS,
+            std::enable_if_t<crypto::VectorCommitmentSchemeTraits<
+                T>::kSupportsBatchMode>* = nullptr>
+  void BatchCommitAllAt(absl::Span<const Evals* const> evals_list,
+                        size_t index) {
+    CHECK(pcs_.BatchCommitLagrange(evals_list, index));
+  }
+
+  // Same as above, but commits to each of |scalars_list| as the coefficients
+  // of a polynomial.
+  template <typename T = PCS,
+            std::enable_if_t<crypto::VectorCommitmentSchemeTraits<
+                T>::kSupportsBatchMode>* = nullptr>
+  void BatchCommitAllAt(absl::Span<const absl::Span<const F>> scalars_list,
+                        size_t index) {
+    CHECK(pcs_.DoBatchCommit(scalars_list, pcs_.batch_commitment_state(),
+                             index));
+  }
+
  protected:
   PCS pcs_;
-  std::unique_ptr<Domain> domain_;
-  std::unique_ptr<ExtendedDomain> extended_domain_;
+  std::shared_ptr<const Domain> domain_;
+  std::shared_ptr<const ExtendedDomain> extended_domain_;
   std::unique_ptr<crypto::Transcript<Commitment>> transcript_;
 };
 
@@ -93,9 +93,7 @@ class ProverBase : public Entity<PCS> {
                 T>::kSupportsBatchMode>* = nullptr>
   void RetrieveAndWriteBatchCommitmentsToProof() {
     std::vector<Commitment> commitments = this->pcs_.GetBatchCommitments();
-    for (const Commitment& commitment : commitments) {
-      CHECK(GetWriter()->WriteToProof(commitment));
-    }
+    CHECK(GetWriter()->WriteManyToProof(commitments));
   }
 
   template <typename T = PCS,
@@ -103,9 +101,7 @@ class ProverBase : public Entity<PCS> {
                 T>::kSupportsBatchMode>* = nullptr>
   void RetrieveAndWriteBatchCommitmentsToTranscript() {
     std::vector<Commitment> commitments = this->pcs_.GetBatchCommitments();
-    for (const Commitment& commitment : commitments) {
-      CHECK(GetWriter()->WriteToTranscript(commitment));
-    }
+    CHECK(GetWriter()->WriteManyToTranscript(commitments));
   }
 
  protected:
@@ -0,0 +1,116 @@
+#ifndef TACHYON_ZK_BASE_PARALLEL_RANDOM_FIELD_GENERATOR_H_
+#define TACHYON_ZK_BASE_PARALLEL_RANDOM_FIELD_GENERATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/crypto/random/xor_shift/xor_shift_rng.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/zk/base/random_field_generator_base.h"
+
+namespace tachyon::zk {
+
+// |ParallelRandomFieldGenerator| fills spans of random field elements in
+// parallel. A span is split into chunks of |kChunkSize| elements, and each
+// chunk is drawn from its own |crypto::XORShiftRNG| substream, whose seed is
+// derived from |seed_| and the index of the substream. So the elements only
+// depend on the seed and the sizes of the previous calls, not on the number
+// of threads, which keeps the proofs reproducible from a seed.
+//
+// NOTE: Unlike |plonk::halo2::RandomFieldGenerator|, this doesn't follow the
+// sampling of Halo2, so it can't be used to reproduce the proofs of Halo2.
+template <typename F>
+class ParallelRandomFieldGenerator : public RandomFieldGeneratorBase<F> {
+ public:
+  constexpr static size_t kChunkSize = 1024;
+
+  explicit ParallelRandomFieldGenerator(uint64_t seed) : seed_(seed) {}
+
+  static ParallelRandomFieldGenerator FromRandomSeed() {
+    return ParallelRandomFieldGenerator(
+        base::Uniform(base::Range<uint64_t>::All()));
+  }
+
+  uint64_t seed() const { return seed_; }
+  uint64_t num_substreams() const { return num_substreams_; }
+
+  // RandomFieldGeneratorBase<F> methods
+  F Generate() override {
+    F ret;
+    GenerateMany(absl::MakeSpan(&ret, 1));
+    return ret;
+  }
+
+  void GenerateMany(absl::Span<F> values) override {
+    size_t num_chunks = (values.size() + kChunkSize - 1) / kChunkSize;
+    uint64_t first_substream = num_substreams_;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+      crypto::XORShiftRNG rng = CreateSubstream(first_substream + i);
+      for (F& value : values.subspan(i * kChunkSize, kChunkSize)) {
+        value = Sample(rng);
+      }
+    }
+    num_substreams_ += num_chunks;
+  }
+
+ private:
+  // See https://prng.di.unimi.it/splitmix64.c.
+  static uint64_t SplitMix64(uint64_t& state) {
+    uint64_t z = (state += UINT64_C(0x9e3779b97f4a7c15));
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+    return z ^ (z >> 31);
+  }
+
+  crypto::XORShiftRNG CreateSubstream(uint64_t index) const {
+    uint64_t state = seed_ ^ SplitMix64(index);
+    uint64_t lo = SplitMix64(state);
+    uint64_t hi = SplitMix64(state);
+    // NOTE: The all-zero state of |crypto::XORShiftRNG| only yields zeros.
+    if (lo == 0 && hi == 0) lo = 1;
+    return crypto::XORShiftRNG::FromState(
+        static_cast<uint32_t>(lo), static_cast<uint32_t>(lo >> 32),
+        static_cast<uint32_t>(hi), static_cast<uint32_t>(hi >> 32));
+  }
+
+  // Samples by rejection a uniform value in [0, p), which is taken as the
+  // Montgomery form as is. Since the Montgomery form is a bijection on
+  // [0, p), the element is uniform as well, and no conversion is needed.
+  static F Sample(crypto::XORShiftRNG& rng) {
+    constexpr size_t kModulusBits = F::Config::kModulusBits;
+    if constexpr (kModulusBits <= 32) {
+      constexpr uint32_t kMask =
+          kModulusBits == 32 ? UINT32_MAX
+                             : (uint32_t{1} << kModulusBits) - 1;
+      while (true) {
+        uint32_t value = rng.NextUint32() & kMask;
+        if (value < F::Config::kModulus) return F::FromMontgomery(value);
+      }
+    } else {
+      constexpr size_t N = F::N;
+      constexpr size_t kTopBits = kModulusBits - 64 * (N - 1);
+      constexpr uint64_t kMask =
+          kTopBits == 64 ? UINT64_MAX : (uint64_t{1} << kTopBits) - 1;
+      math::BigInt<N> value;
+      do {
+        for (size_t i = 0; i < N; ++i) {
+          value[i] = rng.NextUint64();
+        }
+        value[N - 1] &= kMask;
+      } while (value >= F::Config::kModulus);
+      return F::FromMontgomery(value);
+    }
+  }
+
+  uint64_t seed_;
+  // The number of substreams drawn so far.
+  uint64_t num_substreams_ = 0;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_BASE_PARALLEL_RANDOM_FIELD_GENERATOR_H_
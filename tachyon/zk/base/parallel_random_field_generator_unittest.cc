@@ -0,0 +1,53 @@
+#include "tachyon/zk/base/parallel_random_field_generator.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+template <typename F>
+class ParallelRandomFieldGeneratorTest : public math::FiniteFieldTest<F> {};
+
+}  // namespace
+
+using PrimeFieldTypes = testing::Types<math::bn254::Fr, math::BabyBear>;
+TYPED_TEST_SUITE(ParallelRandomFieldGeneratorTest, PrimeFieldTypes);
+
+TYPED_TEST(ParallelRandomFieldGeneratorTest, GenerateMany) {
+  using F = TypeParam;
+  using Generator = ParallelRandomFieldGenerator<F>;
+
+  constexpr size_t kSize = 3 * Generator::kChunkSize + 5;
+
+  Generator generator(1);
+  std::vector<F> values(kSize);
+  generator.GenerateMany(absl::MakeSpan(values));
+  EXPECT_EQ(generator.num_substreams(), 4);
+  // The chunks are drawn from different substreams.
+  EXPECT_NE(values[0], values[Generator::kChunkSize]);
+
+  // The same seed and the same calls yield the same elements.
+  Generator generator2(1);
+  std::vector<F> values2(kSize);
+  generator2.GenerateMany(absl::MakeSpan(values2));
+  EXPECT_EQ(values, values2);
+
+  // The next calls continue with the next substreams.
+  F next = generator.Generate();
+  EXPECT_EQ(generator.num_substreams(), 5);
+  EXPECT_EQ(generator2.Generate(), next);
+
+  Generator generator3(2);
+  std::vector<F> values3(kSize);
+  generator3.GenerateMany(absl::MakeSpan(values3));
+  EXPECT_NE(values, values3);
+}
+
+}  // namespace tachyon::zk
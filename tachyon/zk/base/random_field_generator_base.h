@@ -1,6 +1,8 @@
 #ifndef TACHYON_ZK_BASE_RANDOM_FIELD_GENERATOR_BASE_H_
 #define TACHYON_ZK_BASE_RANDOM_FIELD_GENERATOR_BASE_H_
 
+#include "absl/types/span.h"
+
 namespace tachyon::zk {
 
 template <typename F>
@@ -9,6 +11,14 @@ class RandomFieldGeneratorBase {
   virtual ~RandomFieldGeneratorBase() = default;
 
   virtual F Generate() = 0;
+
+  // Fills |values| with random field elements. By default, these are the ones
+  // |Generate()| returns one by one.
+  virtual void GenerateMany(absl::Span<F> values) {
+    for (F& value : values) {
+      value = Generate();
+    }
+  }
 };
 
 }  // namespace tachyon::zk
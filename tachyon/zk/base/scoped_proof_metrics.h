@@ -0,0 +1,48 @@
+#ifndef TACHYON_ZK_BASE_SCOPED_PROOF_METRICS_H_
+#define TACHYON_ZK_BASE_SCOPED_PROOF_METRICS_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <string_view>
+
+#include "tachyon/base/metrics/metrics_registry.h"
+#include "tachyon/base/time/trace_recorder.h"
+
+namespace tachyon::zk {
+
+// |ScopedProofMetrics| records the proofs created by |prover|, e.g., "halo2",
+// from its construction to its destruction to |base::MetricsRegistry| if the
+// metrics are enabled:
+//
+//   tachyon_prover_proofs_total{prover="<prover>"}: the number of the proofs.
+//   tachyon_prover_seconds{prover="<prover>"}: the time spent on them.
+//   tachyon_prover_peak_rss_bytes{prover="<prover>"}: the peak resident memory
+//     of the process when the last of them is created.
+class ScopedProofMetrics {
+ public:
+  explicit ScopedProofMetrics(std::string_view prover, size_t num_proofs = 1)
+      : labels_({{"prover", std::string(prover)}}),
+        metrics_("tachyon_prover", "proofs", labels_),
+        scope_(metrics_.Measure(num_proofs)) {}
+  ScopedProofMetrics(const ScopedProofMetrics& other) = delete;
+  ScopedProofMetrics& operator=(const ScopedProofMetrics& other) = delete;
+  ~ScopedProofMetrics() {
+    if (!base::MetricsRegistry::IsEnabled()) return;
+    base::MetricsRegistry::GetInstance()
+        .GetGauge("tachyon_prover_peak_rss_bytes",
+                  "The peak resident memory of the process in bytes when the "
+                  "last proof is created.",
+                  labels_)
+        ->Set(base::TraceRecorder::GetPeakRSS());
+  }
+
+ private:
+  base::MetricsRegistry::Labels labels_;
+  base::ThroughputMetrics metrics_;
+  base::ThroughputMetrics::Scope scope_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_BASE_SCOPED_PROOF_METRICS_H_
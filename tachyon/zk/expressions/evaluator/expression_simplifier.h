@@ -0,0 +1,286 @@
+#ifndef TACHYON_ZK_EXPRESSIONS_EVALUATOR_EXPRESSION_SIMPLIFIER_H_
+#define TACHYON_ZK_EXPRESSIONS_EVALUATOR_EXPRESSION_SIMPLIFIER_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/expressions/constant_expression.h"
+#include "tachyon/zk/expressions/evaluator.h"
+#include "tachyon/zk/expressions/negated_expression.h"
+#include "tachyon/zk/expressions/product_expression.h"
+#include "tachyon/zk/expressions/scaled_expression.h"
+#include "tachyon/zk/expressions/sum_expression.h"
+
+namespace tachyon::zk {
+
+// |ExpressionSimplifier| rewrites an expression into an equivalent one that
+// takes fewer multiplications to evaluate per row. From the leaves up, it
+//
+// - folds the constants and drops the additions of 0 and the multiplications
+//   by 0 and 1,
+// - merges the nested scalings and the negations into a single coefficient,
+// - and factors out a factor shared by several terms of a sum, so that
+//   s * a + s * b, where s is typically a selector, becomes s * (a + b).
+template <typename F>
+class ExpressionSimplifier
+    : public Evaluator<F, std::unique_ptr<Expression<F>>> {
+ public:
+  using Expr = std::unique_ptr<Expression<F>>;
+
+  // Evaluator methods
+  Expr Evaluate(const Expression<F>* input) override {
+    switch (input->type()) {
+      case ExpressionType::kConstant:
+      case ExpressionType::kSelector:
+      case ExpressionType::kFixed:
+      case ExpressionType::kAdvice:
+      case ExpressionType::kInstance:
+      case ExpressionType::kChallenge:
+        return input->Clone();
+      case ExpressionType::kNegated:
+        return Scale(Evaluate(input->ToNegated()->expr()), -F::One());
+      case ExpressionType::kScaled: {
+        const ScaledExpression<F>* scaled = input->ToScaled();
+        return Scale(Evaluate(scaled->expr()), scaled->scale());
+      }
+      case ExpressionType::kSum:
+      case ExpressionType::kProduct: {
+        std::vector<Term> terms;
+        CollectTerms(input, F::One(), terms);
+        return BuildSum(std::move(terms));
+      }
+    }
+    NOTREACHED();
+    return nullptr;
+  }
+
+ private:
+  // coefficient * factors[0] * factors[1] * ...
+  struct Term {
+    F coefficient;
+    std::vector<Expr> factors;
+
+    bool IsConstant() const { return factors.empty(); }
+  };
+
+  // Appends the terms of |coefficient| * |input| to |terms|, flattening the
+  // sums and the products.
+  void CollectTerms(const Expression<F>* input, const F& coefficient,
+                    std::vector<Term>& terms) {
+    switch (input->type()) {
+      case ExpressionType::kSum: {
+        const SumExpression<F>* sum = input->ToSum();
+        CollectTerms(sum->left(), coefficient, terms);
+        CollectTerms(sum->right(), coefficient, terms);
+        return;
+      }
+      case ExpressionType::kNegated:
+        CollectTerms(input->ToNegated()->expr(), -coefficient, terms);
+        return;
+      case ExpressionType::kScaled: {
+        const ScaledExpression<F>* scaled = input->ToScaled();
+        CollectTerms(scaled->expr(), coefficient * scaled->scale(), terms);
+        return;
+      }
+      default:
+        break;
+    }
+    Term term{coefficient, {}};
+    if (input->type() == ExpressionType::kProduct) {
+      CollectFactors(input, term);
+    } else {
+      AddFactor(Evaluate(input), term);
+    }
+    if (!term.coefficient.IsZero()) terms.push_back(std::move(term));
+  }
+
+  void CollectFactors(const Expression<F>* input, Term& term) {
+    if (input->type() == ExpressionType::kProduct) {
+      const ProductExpression<F>* product = input->ToProduct();
+      CollectFactors(product->left(), term);
+      CollectFactors(product->right(), term);
+      return;
+    }
+    AddFactor(Evaluate(input), term);
+  }
+
+  // Multiplies |term| by a simplified |factor|, moving its constant part into
+  // the coefficient.
+  static void AddFactor(Expr factor, Term& term) {
+    switch (factor->type()) {
+      case ExpressionType::kConstant:
+        term.coefficient *= factor->ToConstant()->value();
+        return;
+      case ExpressionType::kNegated:
+        term.coefficient = -term.coefficient;
+        AddFactor(factor->ToNegated()->expr()->Clone(), term);
+        return;
+      case ExpressionType::kScaled: {
+        const ScaledExpression<F>* scaled = factor->ToScaled();
+        term.coefficient *= scaled->scale();
+        AddFactor(scaled->expr()->Clone(), term);
+        return;
+      }
+      case ExpressionType::kProduct: {
+        const ProductExpression<F>* product = factor->ToProduct();
+        AddFactor(product->left()->Clone(), term);
+        AddFactor(product->right()->Clone(), term);
+        return;
+      }
+      default:
+        term.factors.push_back(std::move(factor));
+        return;
+    }
+  }
+
+  static bool HaveSameFactors(const Term& a, const Term& b) {
+    if (a.factors.size() != b.factors.size()) return false;
+    for (size_t i = 0; i < a.factors.size(); ++i) {
+      if (*a.factors[i] != *b.factors[i]) return false;
+    }
+    return true;
+  }
+
+  static std::optional<size_t> FindFactor(const Term& term,
+                                          const Expression<F>& factor) {
+    for (size_t i = 0; i < term.factors.size(); ++i) {
+      if (*term.factors[i] == factor) return i;
+    }
+    return std::nullopt;
+  }
+
+  // Merges the terms with the same factors, including the constants.
+  static std::vector<Term> MergeTerms(std::vector<Term>&& terms) {
+    std::vector<Term> merged;
+    for (Term& term : terms) {
+      auto it = std::find_if(
+          merged.begin(), merged.end(),
+          [&term](const Term& other) { return HaveSameFactors(term, other); });
+      if (it == merged.end()) {
+        merged.push_back(std::move(term));
+      } else {
+        it->coefficient += term.coefficient;
+      }
+    }
+    merged.erase(std::remove_if(merged.begin(), merged.end(),
+                                [](const Term& term) {
+                                  return term.coefficient.IsZero();
+                                }),
+                 merged.end());
+    return merged;
+  }
+
+  Expr BuildSum(std::vector<Term>&& terms) {
+    terms = MergeTerms(std::move(terms));
+    if (terms.empty()) return ExpressionFactory<F>::Constant(F::Zero());
+
+    // Find the factor shared by the most terms.
+    const Expression<F>* best_factor = nullptr;
+    size_t best_count = 1;
+    for (const Term& term : terms) {
+      for (const Expr& factor : term.factors) {
+        size_t count = std::count_if(
+            terms.begin(), terms.end(), [&factor](const Term& other) {
+              return FindFactor(other, *factor).has_value();
+            });
+        if (count > best_count) {
+          best_factor = factor.get();
+          best_count = count;
+        }
+      }
+    }
+
+    if (best_factor == nullptr) {
+      Expr sum;
+      // The positive terms go first so that the negative ones become
+      // subtractions.
+      std::stable_partition(terms.begin(), terms.end(), [](const Term& term) {
+        return !(-term.coefficient).IsOne();
+      });
+      for (Term& term : terms) {
+        sum = Add(std::move(sum), std::move(term));
+      }
+      return sum;
+    }
+
+    // factor * (Σ terms / factor) + Σ the others
+    Expr factor = best_factor->Clone();
+    std::vector<Term> inner_terms;
+    std::vector<Term> outer_terms;
+    for (Term& term : terms) {
+      std::optional<size_t> idx = FindFactor(term, *factor);
+      if (idx.has_value()) {
+        term.factors.erase(term.factors.begin() + idx.value());
+        inner_terms.push_back(std::move(term));
+      } else {
+        outer_terms.push_back(std::move(term));
+      }
+    }
+    Term factored{F::One(), {}};
+    AddFactor(std::move(factor), factored);
+    AddFactor(BuildSum(std::move(inner_terms)), factored);
+    if (outer_terms.empty()) return BuildProduct(std::move(factored));
+    outer_terms.push_back(std::move(factored));
+    return BuildSum(std::move(outer_terms));
+  }
+
+  static Expr Add(Expr sum, Term&& term) {
+    if (!sum) return BuildProduct(std::move(term));
+    if ((-term.coefficient).IsOne()) {
+      term.coefficient = F::One();
+      return ExpressionFactory<F>::Sum(
+          std::move(sum),
+          ExpressionFactory<F>::Negated(BuildProduct(std::move(term))));
+    }
+    return ExpressionFactory<F>::Sum(std::move(sum),
+                                     BuildProduct(std::move(term)));
+  }
+
+  // Returns |scale| * |expr|, where |expr| is simplified.
+  static Expr Scale(Expr expr, const F& scale) {
+    Term term{scale, {}};
+    AddFactor(std::move(expr), term);
+    return BuildProduct(std::move(term));
+  }
+
+  static Expr BuildProduct(Term&& term) {
+    if (term.coefficient.IsZero()) {
+      return ExpressionFactory<F>::Constant(F::Zero());
+    }
+    if (term.IsConstant()) {
+      return ExpressionFactory<F>::Constant(term.coefficient);
+    }
+    Expr product = std::move(term.factors[0]);
+    for (size_t i = 1; i < term.factors.size(); ++i) {
+      product = ExpressionFactory<F>::Product(std::move(product),
+                                              std::move(term.factors[i]));
+    }
+    if (term.coefficient.IsOne()) return product;
+    if ((-term.coefficient).IsOne()) {
+      return ExpressionFactory<F>::Negated(std::move(product));
+    }
+    // NOTE: |GraphEvaluator| turns a product with 2 into a doubling, which is
+    // cheaper than the multiplication of a scaling.
+    if (term.coefficient == F(2)) {
+      return ExpressionFactory<F>::Product(
+          ExpressionFactory<F>::Constant(term.coefficient), std::move(product));
+    }
+    return ExpressionFactory<F>::Scaled(std::move(product), term.coefficient);
+  }
+};
+
+template <typename F>
+std::unique_ptr<Expression<F>> Expression<F>::Simplify() const {
+  ExpressionSimplifier<F> simplifier;
+  return Evaluate(&simplifier);
+}
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_EXPRESSIONS_EVALUATOR_EXPRESSION_SIMPLIFIER_H_
@@ -0,0 +1,105 @@
+#include "tachyon/zk/expressions/evaluator/expression_simplifier.h"
+
+#include <memory>
+
+#include "tachyon/zk/expressions/evaluator/test/evaluator_test.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+
+namespace tachyon::zk {
+
+using Expr = std::unique_ptr<Expression<GF7>>;
+
+class ExpressionSimplifierTest : public EvaluatorTest {
+ public:
+  void SetUp() override {
+    a_ = ExpressionFactory<GF7>::Fixed(
+        plonk::FixedQuery(0, Rotation(0), plonk::FixedColumnKey(0)));
+    b_ = ExpressionFactory<GF7>::Advice(
+        plonk::AdviceQuery(0, Rotation(1), plonk::AdviceColumnKey(0)));
+    s_ = ExpressionFactory<GF7>::Fixed(
+        plonk::FixedQuery(1, Rotation(0), plonk::FixedColumnKey(1)));
+  }
+
+ protected:
+  Expr a_;
+  Expr b_;
+  Expr s_;
+};
+
+TEST_F(ExpressionSimplifierTest, FoldConstants) {
+  // (2 + 3) * 3 = 1
+  Expr expr = ExpressionFactory<GF7>::Product(
+      ExpressionFactory<GF7>::Sum(ExpressionFactory<GF7>::Constant(GF7(2)),
+                                  ExpressionFactory<GF7>::Constant(GF7(3))),
+      ExpressionFactory<GF7>::Constant(GF7(3)));
+  EXPECT_EQ(*expr->Simplify(), *ExpressionFactory<GF7>::Constant(GF7(1)));
+
+  // (a * 3) * 5 = a
+  expr = ExpressionFactory<GF7>::Scaled(
+      ExpressionFactory<GF7>::Scaled(a_->Clone(), GF7(3)), GF7(5));
+  EXPECT_EQ(*expr->Simplify(), *a_);
+}
+
+TEST_F(ExpressionSimplifierTest, DropIdentities) {
+  // a * 1 + 0 = a
+  Expr expr = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Product(a_->Clone(),
+                                      ExpressionFactory<GF7>::Constant(GF7(1))),
+      ExpressionFactory<GF7>::Constant(GF7(0)));
+  EXPECT_EQ(*expr->Simplify(), *a_);
+
+  // a * 0 + b = b
+  expr = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Product(a_->Clone(),
+                                      ExpressionFactory<GF7>::Constant(GF7(0))),
+      b_->Clone());
+  EXPECT_EQ(*expr->Simplify(), *b_);
+
+  // -(-a) = a
+  expr = ExpressionFactory<GF7>::Negated(
+      ExpressionFactory<GF7>::Negated(a_->Clone()));
+  EXPECT_EQ(*expr->Simplify(), *a_);
+
+  // a + b - a = b
+  expr = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Sum(a_->Clone(), b_->Clone()),
+      ExpressionFactory<GF7>::Negated(a_->Clone()));
+  EXPECT_EQ(*expr->Simplify(), *b_);
+}
+
+TEST_F(ExpressionSimplifierTest, KeepSubtraction) {
+  // a - b
+  Expr expr =
+      ExpressionFactory<GF7>::Sum(a_->Clone(),
+                                  ExpressionFactory<GF7>::Negated(b_->Clone()));
+  EXPECT_EQ(*expr->Simplify(), *expr);
+
+  // -b + a = a - b
+  Expr reordered = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Negated(b_->Clone()), a_->Clone());
+  EXPECT_EQ(*reordered->Simplify(), *expr);
+}
+
+TEST_F(ExpressionSimplifierTest, FactorOut) {
+  // s * a + s * b = s * (a + b)
+  Expr expr = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Product(s_->Clone(), a_->Clone()),
+      ExpressionFactory<GF7>::Product(s_->Clone(), b_->Clone()));
+  Expr expected = ExpressionFactory<GF7>::Product(
+      s_->Clone(), ExpressionFactory<GF7>::Sum(a_->Clone(), b_->Clone()));
+  EXPECT_EQ(*expr->Simplify(), *expected);
+
+  // s * a - b * s = s * (a - b)
+  expr = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Product(s_->Clone(), a_->Clone()),
+      ExpressionFactory<GF7>::Negated(
+          ExpressionFactory<GF7>::Product(b_->Clone(), s_->Clone())));
+  expected = ExpressionFactory<GF7>::Product(
+      s_->Clone(),
+      ExpressionFactory<GF7>::Sum(
+          a_->Clone(), ExpressionFactory<GF7>::Negated(b_->Clone())));
+  EXPECT_EQ(*expr->Simplify(), *expected);
+  EXPECT_LT(expr->Simplify()->Complexity(), expr->Complexity());
+}
+
+}  // namespace tachyon::zk
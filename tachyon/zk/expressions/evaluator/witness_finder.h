@@ -0,0 +1,55 @@
+#ifndef TACHYON_ZK_EXPRESSIONS_EVALUATOR_WITNESS_FINDER_H_
+#define TACHYON_ZK_EXPRESSIONS_EVALUATOR_WITNESS_FINDER_H_
+
+#include "tachyon/zk/expressions/evaluator.h"
+#include "tachyon/zk/expressions/negated_expression.h"
+#include "tachyon/zk/expressions/product_expression.h"
+#include "tachyon/zk/expressions/scaled_expression.h"
+#include "tachyon/zk/expressions/sum_expression.h"
+
+namespace tachyon::zk {
+
+// Returns true if the expression queries an advice column, an instance column
+// or a challenge, which means that it can evaluate differently from proof to
+// proof. Otherwise it only depends on the proving key.
+template <typename F>
+class WitnessFinder : public Evaluator<F, bool> {
+ public:
+  // Evaluator methods
+  bool Evaluate(const Expression<F>* input) override {
+    switch (input->type()) {
+      case ExpressionType::kConstant:
+        return false;
+      case ExpressionType::kSelector:
+        return false;
+      case ExpressionType::kFixed:
+        return false;
+      case ExpressionType::kAdvice:
+        return true;
+      case ExpressionType::kInstance:
+        return true;
+      case ExpressionType::kChallenge:
+        return true;
+      case ExpressionType::kNegated:
+        return Evaluate(input->ToNegated()->expr());
+      case ExpressionType::kSum: {
+        const SumExpression<F>* sum = input->ToSum();
+        return Evaluate(sum->left()) || Evaluate(sum->right());
+      }
+      case ExpressionType::kProduct: {
+        const ProductExpression<F>* product = input->ToProduct();
+        return Evaluate(product->left()) || Evaluate(product->right());
+      }
+      case ExpressionType::kScaled: {
+        const ScaledExpression<F>* scaled = input->ToScaled();
+        return Evaluate(scaled->expr());
+      }
+    }
+    NOTREACHED();
+    return false;
+  }
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_EXPRESSIONS_EVALUATOR_WITNESS_FINDER_H_
@@ -0,0 +1,63 @@
+#include "tachyon/zk/expressions/evaluator/witness_finder.h"
+
+#include <memory>
+
+#include "tachyon/zk/expressions/evaluator/test/evaluator_test.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+
+namespace tachyon::zk {
+
+using Expr = std::unique_ptr<Expression<GF7>>;
+
+class WitnessFinderTest : public EvaluatorTest {
+ protected:
+  bool ContainsWitness(const Expr& expr) {
+    WitnessFinder<GF7> finder;
+    return expr->Evaluate(&finder);
+  }
+};
+
+TEST_F(WitnessFinderTest, Leaves) {
+  EXPECT_FALSE(ContainsWitness(ExpressionFactory<GF7>::Constant(GF7(3))));
+  EXPECT_FALSE(ContainsWitness(
+      ExpressionFactory<GF7>::Selector(plonk::Selector::Simple(1))));
+  EXPECT_FALSE(ContainsWitness(ExpressionFactory<GF7>::Fixed(
+      plonk::FixedQuery(1, Rotation(1), plonk::FixedColumnKey(0)))));
+  EXPECT_TRUE(ContainsWitness(
+      ExpressionFactory<GF7>::Advice(plonk::AdviceQuery(
+          1, Rotation(1), plonk::AdviceColumnKey(0, plonk::Phase(0))))));
+  EXPECT_TRUE(ContainsWitness(ExpressionFactory<GF7>::Instance(
+      plonk::InstanceQuery(1, Rotation(1), plonk::InstanceColumnKey(0)))));
+  EXPECT_TRUE(ContainsWitness(ExpressionFactory<GF7>::Challenge(
+      plonk::Challenge(1, plonk::Phase(0)))));
+}
+
+TEST_F(WitnessFinderTest, Nested) {
+  auto fixed = []() {
+    return ExpressionFactory<GF7>::Fixed(
+        plonk::FixedQuery(1, Rotation(0), plonk::FixedColumnKey(1)));
+  };
+  auto advice = []() {
+    return ExpressionFactory<GF7>::Advice(plonk::AdviceQuery(
+        1, Rotation(0), plonk::AdviceColumnKey(1, plonk::Phase(0))));
+  };
+
+  // 3 * (f₁(X) - 2 * f₁(X))
+  Expr expr = ExpressionFactory<GF7>::Scaled(
+      ExpressionFactory<GF7>::Sum(
+          fixed(),
+          ExpressionFactory<GF7>::Negated(ExpressionFactory<GF7>::Product(
+              ExpressionFactory<GF7>::Constant(GF7(2)), fixed()))),
+      GF7(3));
+  EXPECT_FALSE(ContainsWitness(expr));
+
+  // 3 * (f₁(X) - f₁(X) * a₁(X))
+  expr = ExpressionFactory<GF7>::Scaled(
+      ExpressionFactory<GF7>::Sum(
+          fixed(), ExpressionFactory<GF7>::Negated(
+                       ExpressionFactory<GF7>::Product(fixed(), advice()))),
+      GF7(3));
+  EXPECT_TRUE(ContainsWitness(expr));
+}
+
+}  // namespace tachyon::zk
@@ -108,6 +108,10 @@ class Expression {
       const std::vector<base::Ref<const Expression<F>>>& replacements,
       bool must_be_non_simple) const;
 
+  // Returns an equivalent expression that takes fewer multiplications to
+  // evaluate. See expression_simplifier.h.
+  std::unique_ptr<Expression<F>> Simplify() const;
+
   template <typename Evaluated>
   Evaluated Evaluate(Evaluator<F, Evaluated>* evaluator) const {
     return evaluator->Evaluate(this);
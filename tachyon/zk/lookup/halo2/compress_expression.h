@@ -11,36 +11,53 @@
 #include <utility>
 #include <vector>
 
-#include "tachyon/base/compiler_specific.h"
-#include "tachyon/base/openmp_util.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/parallelize.h"
 #include "tachyon/zk/lookup/proving_evaluator.h"
+#include "tachyon/zk/plonk/vanishing/compiled_graph_evaluator.h"
+#include "tachyon/zk/plonk/vanishing/evaluation_input.h"
+#include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
 
 namespace tachyon::zk::lookup::halo2 {
 
+// Returns θᵐ⁻¹E₀(X) + θᵐ⁻²E₁(X) + ... + θEₘ₋₂(X) + Eₘ₋₁(X) over the rows of
+// the table of |evaluator_tpl|, where Eᵢ(X) is the i-th of |expressions|.
+// The expressions are compiled into a single |plonk::CompiledGraphEvaluator|,
+// whose Horner's rule folds them with |theta| block by block, so the rows are
+// walked only once instead of once per expression.
 template <typename Domain, typename Evals, typename F>
 Evals CompressExpressions(
     const Domain* domain,
     const std::vector<std::unique_ptr<Expression<F>>>& expressions,
     const F& theta, const ProvingEvaluator<Evals>& evaluator_tpl) {
+  plonk::GraphEvaluator<F> graph;
+  std::vector<plonk::ValueSource> parts = base::Map(
+      expressions, [&graph](const std::unique_ptr<Expression<F>>& expression) {
+        return graph.AddExpression(expression.get());
+      });
+  graph.AddCalculation(plonk::Calculation::Horner(
+      plonk::ValueSource::ZeroConstant(), std::move(parts),
+      plonk::ValueSource::Theta()));
+  plonk::CompiledGraphEvaluator<F> compiled =
+      plonk::CompiledGraphEvaluator<F>::Compile(graph);
+
+  // NOTE: Only |theta| is read by the calculations above.
+  F unused = F::Zero();
+  plonk::EvaluationInput<Evals, plonk::MultiPhaseRefTable<Evals>> input(
+      {}, {}, evaluator_tpl.table(), theta, unused, unused, unused,
+      evaluator_tpl.size());
+
   Evals compressed_evals = domain->template Zero<Evals>();
-  std::vector<F>& compressed_values = compressed_evals.evaluations();
-
-  for (size_t expr_idx = 0; expr_idx < expressions.size(); ++expr_idx) {
-    if (UNLIKELY(expr_idx == 0)) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < compressed_values.size(); ++i) {
-        ProvingEvaluator<Evals> evaluator = evaluator_tpl;
-        evaluator.set_idx(i);
-        compressed_values[i] = evaluator.Evaluate(expressions[expr_idx].get());
-      }
-    } else {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < compressed_values.size(); ++i) {
-        ProvingEvaluator<Evals> evaluator = evaluator_tpl;
-        evaluator.set_idx(i);
-        compressed_values[i] *= theta;
-        compressed_values[i] += evaluator.Evaluate(expressions[expr_idx].get());
-      }
-    }
-  }
+  base::Parallelize(
+      compressed_evals.evaluations(),
+      [&compiled, &input, &evaluator_tpl](absl::Span<F> chunk,
+                                          size_t chunk_offset,
+                                          size_t chunk_size) {
+        compiled.Evaluate(input, chunk_offset * chunk_size,
+                          evaluator_tpl.rot_scale(), chunk);
+      });
   return compressed_evals;
 }
 
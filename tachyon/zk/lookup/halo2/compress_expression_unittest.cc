@@ -40,4 +40,46 @@ TEST_F(CompressExpressionTest, CompressExpressions) {
   EXPECT_EQ(out, Evals(std::move(expected)));
 }
 
+TEST_F(CompressExpressionTest, CompressColumnExpressions) {
+  const Domain* domain = prover_->domain();
+  std::vector<Evals> fixed_columns = {domain->Random<Evals>()};
+  std::vector<Evals> advice_columns = {domain->Random<Evals>(),
+                                       domain->Random<Evals>()};
+  std::vector<F> challenges = {F::Random()};
+  plonk::MultiPhaseRefTable<Evals> table(fixed_columns, advice_columns, {},
+                                         challenges);
+  int32_t n = static_cast<int32_t>(domain->size());
+  ProvingEvaluator<Evals> evaluator(0, n, 1, table);
+
+  std::vector<std::unique_ptr<Expression<F>>> expressions;
+  expressions.push_back(ExpressionFactory<F>::Product(
+      ExpressionFactory<F>::Fixed(
+          plonk::FixedQuery(0, Rotation(0), plonk::FixedColumnKey(0))),
+      ExpressionFactory<F>::Advice(
+          plonk::AdviceQuery(0, Rotation(1), plonk::AdviceColumnKey(0)))));
+  expressions.push_back(ExpressionFactory<F>::Sum(
+      ExpressionFactory<F>::Advice(
+          plonk::AdviceQuery(1, Rotation(-1), plonk::AdviceColumnKey(1))),
+      ExpressionFactory<F>::Challenge(
+          plonk::Challenge(0, plonk::kFirstPhase))));
+  expressions.push_back(ExpressionFactory<F>::Negated(
+      ExpressionFactory<F>::Advice(
+          plonk::AdviceQuery(2, Rotation(0), plonk::AdviceColumnKey(0)))));
+
+  // Every row, including the ones whose rotations wrap around, is the same as
+  // the one compressed by |ProvingEvaluator|.
+  std::vector<F> expected(n);
+  for (int32_t i = 0; i < n; ++i) {
+    for (const std::unique_ptr<Expression<F>>& expression : expressions) {
+      ProvingEvaluator<Evals> row_evaluator = evaluator;
+      row_evaluator.set_idx(i);
+      expected[i] *= theta_;
+      expected[i] += row_evaluator.Evaluate(expression.get());
+    }
+  }
+
+  Evals out = CompressExpressions(domain, expressions, theta_, evaluator);
+  EXPECT_EQ(out, Evals(std::move(expected)));
+}
+
 }  // namespace tachyon::zk::lookup::halo2
@@ -134,16 +134,21 @@ class Evaluator {
     size_t num_lookups =
         builder.lookup_provers_[circuit_idx].grand_product_polys().size();
     const LookupProver& lookup_prover = builder.lookup_provers_[circuit_idx];
+    std::vector<const typename PCS::Poly*> polys;
+    polys.reserve(num_lookups * 3);
+    for (size_t i = 0; i < num_lookups; ++i) {
+      polys.push_back(&lookup_prover.grand_product_polys()[i].poly());
+      polys.push_back(&lookup_prover.permuted_pairs()[i].input().poly());
+      polys.push_back(&lookup_prover.permuted_pairs()[i].table().poly());
+    }
+    std::vector<Evals> cosets = builder.coset_domain_->FFTBatch(polys);
     lookup_product_cosets_.resize(num_lookups);
     lookup_input_cosets_.resize(num_lookups);
     lookup_table_cosets_.resize(num_lookups);
     for (size_t i = 0; i < num_lookups; ++i) {
-      lookup_product_cosets_[i] = builder.coset_domain_->FFT(
-          lookup_prover.grand_product_polys()[i].poly());
-      lookup_input_cosets_[i] = builder.coset_domain_->FFT(
-          lookup_prover.permuted_pairs()[i].input().poly());
-      lookup_table_cosets_[i] = builder.coset_domain_->FFT(
-          lookup_prover.permuted_pairs()[i].table().poly());
+      lookup_product_cosets_[i] = std::move(cosets[3 * i]);
+      lookup_input_cosets_[i] = std::move(cosets[3 * i + 1]);
+      lookup_table_cosets_[i] = std::move(cosets[3 * i + 2]);
     }
   }
 
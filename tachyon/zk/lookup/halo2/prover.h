@@ -13,6 +13,7 @@
 
 #include "absl/types/span.h"
 
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/prover_base.h"
@@ -20,9 +21,11 @@
 #include "tachyon/zk/lookup/lookup_argument.h"
 #include "tachyon/zk/lookup/lookup_pair.h"
 #include "tachyon/zk/lookup/proving_evaluator.h"
+#include "tachyon/zk/plonk/base/batch_inverse_scheduler.h"
 #include "tachyon/zk/plonk/base/multi_phase_ref_table.h"
 
-namespace tachyon::zk::lookup::halo2 {
+namespace tachyon {
+namespace zk::lookup::halo2 {
 
 template <typename Poly, typename Evals>
 class Prover {
@@ -69,11 +72,7 @@ class Prover {
   template <typename PCS>
   static void BatchCreateGrandProductPolys(std::vector<Prover>& lookup_provers,
                                            ProverBase<PCS>* prover,
-                                           const F& beta, const F& gamma) {
-    for (Prover& lookup_prover : lookup_provers) {
-      lookup_prover.CreateGrandProductPolys(prover, beta, gamma);
-    }
-  }
+                                           const F& beta, const F& gamma);
 
   constexpr static size_t GetNumGrandProductPolysCommitments(
       const std::vector<Prover>& lookup_provers) {
@@ -109,6 +108,8 @@ class Prover {
             std::vector<crypto::PolynomialOpening<Poly>>& openings) const;
 
  private:
+  friend class base::Copyable<Prover<Poly, Evals>>;
+
   template <typename Domain>
   static Pair<Evals> CompressPair(const Domain* domain,
                                   const Argument<F>& argument, const F& theta,
@@ -121,8 +122,7 @@ class Prover {
   template <typename PCS>
   static BlindedPolynomial<Poly, Evals> CreateGrandProductPoly(
       ProverBase<PCS>* prover, const Pair<Evals>& compressed_pair,
-      const Pair<BlindedPolynomial<Poly, Evals>>& permuted_pair, const F& beta,
-      const F& gamma);
+      std::vector<F>&& inverses, const F& beta, const F& gamma);
 
   template <typename Domain>
   void CompressPairs(const Domain* domain,
@@ -132,9 +132,18 @@ class Prover {
   template <typename PCS>
   void PermutePairs(ProverBase<PCS>* prover);
 
+  // Adds the denominators of Zₗ,ᵢ for every pair i to |scheduler| and returns
+  // them. They should be passed to |CreateGrandProductPolys()| after
+  // |scheduler| is run.
+  template <typename PCS>
+  std::vector<std::vector<F>> CreateGrandProductDenominators(
+      ProverBase<PCS>* prover, const F& beta, const F& gamma,
+      plonk::BatchInverseScheduler<F>& scheduler) const;
+
   template <typename PCS>
   void CreateGrandProductPolys(ProverBase<PCS>* prover, const F& beta,
-                               const F& gamma);
+                               const F& gamma,
+                               std::vector<std::vector<F>>&& inverses_list);
 
   template <typename Domain>
   void TransformEvalsToPoly(const Domain* domain);
@@ -158,7 +167,35 @@ class Prover {
   std::vector<BlindedPolynomial<Poly, Evals>> grand_product_polys_;
 };
 
-}  // namespace tachyon::zk::lookup::halo2
+}  // namespace zk::lookup::halo2
+
+namespace base {
+
+template <typename Poly, typename Evals>
+class Copyable<zk::lookup::halo2::Prover<Poly, Evals>> {
+ public:
+  static bool WriteTo(const zk::lookup::halo2::Prover<Poly, Evals>& prover,
+                      Buffer* buffer) {
+    return buffer->WriteMany(prover.compressed_pairs_, prover.permuted_pairs_,
+                             prover.grand_product_polys_);
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       zk::lookup::halo2::Prover<Poly, Evals>* prover) {
+    return buffer.ReadMany(&prover->compressed_pairs_,
+                           &prover->permuted_pairs_,
+                           &prover->grand_product_polys_);
+  }
+
+  static size_t EstimateSize(
+      const zk::lookup::halo2::Prover<Poly, Evals>& prover) {
+    return base::EstimateSize(prover.compressed_pairs_, prover.permuted_pairs_,
+                              prover.grand_product_polys_);
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
 
 #include "tachyon/zk/lookup/halo2/prover_impl.h"
 
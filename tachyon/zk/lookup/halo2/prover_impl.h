@@ -97,13 +97,17 @@ void Prover<Poly, Evals>::BatchCommitPermutedPairs(
   if (lookup_provers.empty()) return;
 
   if constexpr (PCS::kSupportsBatchMode) {
+    std::vector<const Evals*> evals_list;
+    evals_list.reserve(GetNumPermutedPairsCommitments(lookup_provers));
     for (const Prover& lookup_prover : lookup_provers) {
       for (const Pair<BlindedPolynomial<Poly, Evals>>& permuted_pair :
            lookup_prover.permuted_pairs_) {
-        prover->BatchCommitAt(permuted_pair.input().evals(), commit_idx++);
-        prover->BatchCommitAt(permuted_pair.table().evals(), commit_idx++);
+        evals_list.push_back(&permuted_pair.input().evals());
+        evals_list.push_back(&permuted_pair.table().evals());
       }
     }
+    prover->BatchCommitAllAt(evals_list, commit_idx);
+    commit_idx += evals_list.size();
   } else {
     for (const Prover& lookup_prover : lookup_provers) {
       for (const Pair<BlindedPolynomial<Poly, Evals>>& permuted_pair :
@@ -115,34 +119,76 @@ void Prover<Poly, Evals>::BatchCommitPermutedPairs(
   }
 }
 
+// static
+template <typename Poly, typename Evals>
+template <typename PCS>
+void Prover<Poly, Evals>::BatchCreateGrandProductPolys(
+    std::vector<Prover>& lookup_provers, ProverBase<PCS>* prover,
+    const F& beta, const F& gamma) {
+  // The denominators of every pair of every circuit are inverted at once,
+  // rather than per pair.
+  plonk::BatchInverseScheduler<F> scheduler;
+  std::vector<std::vector<std::vector<F>>> denominators_lists =
+      base::Map(lookup_provers, [prover, &beta, &gamma,
+                                 &scheduler](const Prover& lookup_prover) {
+        return lookup_prover.CreateGrandProductDenominators(prover, beta,
+                                                            gamma, scheduler);
+      });
+  CHECK(scheduler.Run());
+
+  for (size_t i = 0; i < lookup_provers.size(); ++i) {
+    lookup_provers[i].CreateGrandProductPolys(
+        prover, beta, gamma, std::move(denominators_lists[i]));
+  }
+}
+
 // static
 template <typename Poly, typename Evals>
 template <typename PCS>
 BlindedPolynomial<Poly, Evals> Prover<Poly, Evals>::CreateGrandProductPoly(
     ProverBase<PCS>* prover, const Pair<Evals>& compressed_pair,
-    const Pair<BlindedPolynomial<Poly, Evals>>& permuted_pair, const F& beta,
-    const F& gamma) {
-  return {plonk::GrandProductArgument::CreatePolySerial(
+    std::vector<F>&& inverses, const F& beta, const F& gamma) {
+  return {plonk::GrandProductArgument::CreatePolyFromInverses(
               prover, CreateNumeratorCallback(compressed_pair, beta, gamma),
-              CreateDenominatorCallback(permuted_pair, beta, gamma)),
+              std::move(inverses)),
           prover->blinder().Generate()};
 }
 
 template <typename Poly, typename Evals>
 template <typename PCS>
-void Prover<Poly, Evals>::CreateGrandProductPolys(ProverBase<PCS>* prover,
-                                                  const F& beta,
-                                                  const F& gamma) {
+std::vector<std::vector<typename Poly::Field>>
+Prover<Poly, Evals>::CreateGrandProductDenominators(
+    ProverBase<PCS>* prover, const F& beta, const F& gamma,
+    plonk::BatchInverseScheduler<F>& scheduler) const {
+  std::vector<std::vector<F>> denominators_list = base::Map(
+      permuted_pairs_,
+      [prover, &beta, &gamma](
+          const Pair<BlindedPolynomial<Poly, Evals>>& permuted_pair) {
+        return plonk::GrandProductArgument::CreateDenominators(
+            prover, CreateDenominatorCallback(permuted_pair, beta, gamma));
+      });
+  for (std::vector<F>& denominators : denominators_list) {
+    scheduler.Add(absl::MakeSpan(denominators).subspan(1));
+  }
+  return denominators_list;
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS>
+void Prover<Poly, Evals>::CreateGrandProductPolys(
+    ProverBase<PCS>* prover, const F& beta, const F& gamma,
+    std::vector<std::vector<F>>&& inverses_list) {
   // Zₗ,ᵢ(X)
   CHECK_EQ(compressed_pairs_.size(), permuted_pairs_.size());
-  grand_product_polys_.resize(compressed_pairs_.size());
+  CHECK_EQ(compressed_pairs_.size(), inverses_list.size());
 
   // NOTE(dongchangYoo): do not change this code to parallelized logic.
   grand_product_polys_ = base::Map(
-      compressed_pairs_, [this, prover, &beta, &gamma](
+      compressed_pairs_, [prover, &inverses_list, &beta, &gamma](
                              size_t i, const Pair<Evals>& compressed_pair) {
         return CreateGrandProductPoly(prover, compressed_pair,
-                                      permuted_pairs_[i], beta, gamma);
+                                      std::move(inverses_list[i]), beta,
+                                      gamma);
       });
   compressed_pairs_.clear();
 }
@@ -156,12 +202,16 @@ void Prover<Poly, Evals>::BatchCommitGrandProductPolys(
   if (lookup_provers.empty()) return;
 
   if constexpr (PCS::kSupportsBatchMode) {
+    std::vector<const Evals*> evals_list;
+    evals_list.reserve(GetNumGrandProductPolysCommitments(lookup_provers));
     for (const Prover& lookup_prover : lookup_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_product_poly :
            lookup_prover.grand_product_polys_) {
-        prover->BatchCommitAt(grand_product_poly.evals(), commit_idx++);
+        evals_list.push_back(&grand_product_poly.evals());
       }
     }
+    prover->BatchCommitAllAt(evals_list, commit_idx);
+    commit_idx += evals_list.size();
   } else {
     for (const Prover& lookup_prover : lookup_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_product_poly :
@@ -175,14 +225,17 @@ void Prover<Poly, Evals>::BatchCommitGrandProductPolys(
 template <typename Poly, typename Evals>
 template <typename Domain>
 void Prover<Poly, Evals>::TransformEvalsToPoly(const Domain* domain) {
+  std::vector<BlindedPolynomial<Poly, Evals>*> polys;
+  polys.reserve(permuted_pairs_.size() * 2 + grand_product_polys_.size());
   for (Pair<BlindedPolynomial<Poly, Evals>>& permuted_pair : permuted_pairs_) {
-    permuted_pair.input().TransformEvalsToPoly(domain);
-    permuted_pair.table().TransformEvalsToPoly(domain);
+    polys.push_back(&permuted_pair.input());
+    polys.push_back(&permuted_pair.table());
   }
   for (BlindedPolynomial<Poly, Evals>& grand_product_poly :
        grand_product_polys_) {
-    grand_product_poly.TransformEvalsToPoly(domain);
+    polys.push_back(&grand_product_poly);
   }
+  BlindedPolynomial<Poly, Evals>::TransformEvalsToPoly(polys, domain);
 }
 
 template <typename Poly, typename Evals>
@@ -176,13 +176,18 @@ class Evaluator {
     size_t num_lookups =
         builder.lookup_provers_[circuit_idx].grand_sum_polys().size();
     const LookupProver& lookup_prover = builder.lookup_provers_[circuit_idx];
+    std::vector<const typename PCS::Poly*> polys;
+    polys.reserve(num_lookups * 2);
+    for (size_t i = 0; i < num_lookups; ++i) {
+      polys.push_back(&lookup_prover.grand_sum_polys()[i].poly());
+      polys.push_back(&lookup_prover.m_polys()[i].poly());
+    }
+    std::vector<Evals> cosets = builder.coset_domain_->FFTBatch(polys);
     lookup_sum_cosets_.resize(num_lookups);
     lookup_m_cosets_.resize(num_lookups);
     for (size_t i = 0; i < num_lookups; ++i) {
-      lookup_sum_cosets_[i] =
-          builder.coset_domain_->FFT(lookup_prover.grand_sum_polys()[i].poly());
-      lookup_m_cosets_[i] =
-          builder.coset_domain_->FFT(lookup_prover.m_polys()[i].poly());
+      lookup_sum_cosets_[i] = std::move(cosets[2 * i]);
+      lookup_m_cosets_[i] = std::move(cosets[2 * i + 1]);
     }
   }
 
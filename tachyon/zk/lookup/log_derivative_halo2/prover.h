@@ -6,19 +6,28 @@
 #ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_HALO2_PROVER_H_
 #define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_HALO2_PROVER_H_
 
+#include <algorithm>
 #include <atomic>
+#include <memory>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/expressions/evaluator/witness_finder.h"
 #include "tachyon/zk/lookup/halo2/opening_point_set.h"
 #include "tachyon/zk/lookup/lookup_argument.h"
 #include "tachyon/zk/lookup/proving_evaluator.h"
+#include "tachyon/zk/lookup/table_index_cache.h"
 #include "tachyon/zk/plonk/base/multi_phase_ref_table.h"
 
-namespace tachyon::zk::lookup::log_derivative_halo2 {
+namespace tachyon {
+namespace zk::lookup::log_derivative_halo2 {
 
 template <typename BigInt>
 struct TableEvalWithIndex {
@@ -34,13 +43,18 @@ struct TableEvalWithIndex {
   }
 };
 
-template <typename BigInt>
+template <typename F>
 struct ComputeMPolysTempStorage {
+  using BigInt = typename F::BigIntTy;
+
   std::vector<TableEvalWithIndex<BigInt>> sorted_table_with_indices;
+  // A map from each unique table value to the row whose m value counts it.
+  absl::flat_hash_map<F, RowIndex> table_index_map;
   std::vector<std::atomic<size_t>> m_values_atomic;
 
   explicit ComputeMPolysTempStorage(size_t usable_rows)
       : sorted_table_with_indices(usable_rows), m_values_atomic(usable_rows) {
+    table_index_map.reserve(usable_rows);
     OPENMP_PARALLEL_FOR(RowIndex i = 0; i < usable_rows; ++i) {
       m_values_atomic[i] = 0;
     }
@@ -66,9 +80,17 @@ class Prover {
   const std::vector<std::vector<Evals>>& compressed_inputs_vec() const {
     return compressed_inputs_vec_;
   }
+  // Returns the unique compressed tables, which are shared among the lookup
+  // arguments of the same table expressions. See |table_indices()|.
   const std::vector<Evals>& compressed_tables() const {
     return compressed_tables_;
   }
+  // Returns the index of the compressed table of each lookup argument in
+  // |compressed_tables()|.
+  const std::vector<size_t>& table_indices() const { return table_indices_; }
+  const Evals& GetCompressedTable(size_t argument_idx) const {
+    return compressed_tables_[table_indices_[argument_idx]];
+  }
   const std::vector<BlindedPolynomial<Poly, Evals>>& m_polys() const {
     return m_polys_;
   }
@@ -82,12 +104,30 @@ class Prover {
       const std::vector<Argument<F>>& arguments, const F& theta,
       const std::vector<plonk::MultiPhaseRefTable<Evals>>& tables);
 
+  // If |table_index_cache| is not null, the rows of the unique table values
+  // of the lookup arguments whose table expressions don't contain any witness
+  // are taken from it, or stored into it if they are not cached yet.
   template <typename PCS>
   static void BatchComputeMPolys(std::vector<Prover>& lookup_provers,
-                                 ProverBase<PCS>* prover) {
-    ComputeMPolysTempStorage<BigInt> storage(prover->GetUsableRows());
+                                 ProverBase<PCS>* prover,
+                                 const std::vector<Argument<F>>& arguments,
+                                 TableIndexCache* table_index_cache = nullptr) {
+    ComputeMPolysTempStorage<F> storage(prover->GetUsableRows());
+    std::vector<TableIndexCache*> table_index_caches = base::Map(
+        arguments,
+        [table_index_cache](const Argument<F>& argument) -> TableIndexCache* {
+          if (table_index_cache == nullptr) return nullptr;
+          WitnessFinder<F> finder;
+          bool contains_witness = std::any_of(
+              argument.table_expressions().begin(),
+              argument.table_expressions().end(),
+              [&finder](const std::unique_ptr<Expression<F>>& expression) {
+                return expression->Evaluate(&finder);
+              });
+          return contains_witness ? nullptr : table_index_cache;
+        });
     for (Prover& lookup_prover : lookup_provers) {
-      lookup_prover.ComputeMPolys(prover, storage);
+      lookup_prover.ComputeMPolys(prover, table_index_caches, storage);
     }
   }
 
@@ -143,6 +183,8 @@ class Prover {
             std::vector<crypto::PolynomialOpening<Poly>>& openings) const;
 
  private:
+  friend class base::Copyable<Prover<Poly, Evals>>;
+
   template <typename Domain>
   static std::vector<Evals> CompressInputs(
       const Domain* domain, const Argument<F>& argument, const F& theta,
@@ -153,29 +195,50 @@ class Prover {
                              const F& theta,
                              const ProvingEvaluator<Evals>& evaluator_tpl);
 
+  // Returns the index of the first lookup argument of the same table
+  // expressions among the unique ones for each of |arguments|. The lookups of
+  // a table are split into several arguments by
+  // |plonk::ConstraintSystem::ChunkLookups()| once their inputs exceed the
+  // degree bound, and those share the compressed table, its sort and its log
+  // derivatives.
+  static std::vector<size_t> ComputeTableIndices(
+      const std::vector<Argument<F>>& arguments);
+
   template <typename Domain>
   void CompressPairs(const Domain* domain,
                      const std::vector<Argument<F>>& arguments, const F& theta,
                      const ProvingEvaluator<Evals>& evaluator_tpl);
 
+  // Maps each unique value of |compressed_table| to a row holding it into
+  // |storage.table_index_map|. If |collect_unique_rows| is true, it returns
+  // those rows as well.
+  static std::vector<RowIndex> ComputeTableIndexMap(
+      const Evals& compressed_table, RowIndex usable_rows,
+      bool collect_unique_rows, ComputeMPolysTempStorage<F>& storage);
+
   template <typename PCS>
   static BlindedPolynomial<Poly, Evals> ComputeMPoly(
       ProverBase<PCS>* prover, const std::vector<Evals>& compressed_inputs,
-      const Evals& compressed_table, ComputeMPolysTempStorage<BigInt>& storage);
+      const Evals& compressed_table, size_t argument_idx,
+      TableIndexCache* table_index_cache, bool reuse_table_index_map,
+      ComputeMPolysTempStorage<F>& storage);
 
   template <typename PCS>
   void ComputeMPolys(ProverBase<PCS>* prover,
-                     ComputeMPolysTempStorage<BigInt>& storage);
+                     const std::vector<TableIndexCache*>& table_index_caches,
+                     ComputeMPolysTempStorage<F>& storage);
 
   static void ComputeLogDerivatives(const Evals& evals, const F& beta,
-                                    std::vector<F>& ret);
+                                    absl::Span<F> ret);
 
+  // If |reuse_table_log_derivatives| is true, |storage.table_log_derivatives|
+  // already holds 1 / τ(X) of |compressed_table|.
   template <typename PCS>
   static BlindedPolynomial<Poly, Evals> CreateGrandSumPoly(
       ProverBase<PCS>* prover, const Evals& m_values,
       const std::vector<Evals>& compressed_inputs,
       const Evals& compressed_table, const F& beta,
-      GrandSumPolysTempStorage<F>& storage);
+      bool reuse_table_log_derivatives, GrandSumPolysTempStorage<F>& storage);
 
   template <typename PCS>
   void CreateGrandSumPolys(ProverBase<PCS>* prover, const F& beta,
@@ -190,15 +253,47 @@ class Prover {
 
   // fᵢ(X)
   std::vector<std::vector<Evals>> compressed_inputs_vec_;
-  // t(X)
+  // t(X) of the unique table expressions
   std::vector<Evals> compressed_tables_;
+  // The index of each argument's t(X) in |compressed_tables_|
+  std::vector<size_t> table_indices_;
   // m(X)
   std::vector<BlindedPolynomial<Poly, Evals>> m_polys_;
   // ϕ(X)
   std::vector<BlindedPolynomial<Poly, Evals>> grand_sum_polys_;
 };
 
-}  // namespace tachyon::zk::lookup::log_derivative_halo2
+}  // namespace zk::lookup::log_derivative_halo2
+
+namespace base {
+
+template <typename Poly, typename Evals>
+class Copyable<zk::lookup::log_derivative_halo2::Prover<Poly, Evals>> {
+ public:
+  using Prover = zk::lookup::log_derivative_halo2::Prover<Poly, Evals>;
+
+  static bool WriteTo(const Prover& prover, Buffer* buffer) {
+    return buffer->WriteMany(prover.compressed_inputs_vec_,
+                             prover.compressed_tables_, prover.table_indices_,
+                             prover.m_polys_, prover.grand_sum_polys_);
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, Prover* prover) {
+    return buffer.ReadMany(&prover->compressed_inputs_vec_,
+                           &prover->compressed_tables_,
+                           &prover->table_indices_, &prover->m_polys_,
+                           &prover->grand_sum_polys_);
+  }
+
+  static size_t EstimateSize(const Prover& prover) {
+    return base::EstimateSize(prover.compressed_inputs_vec_,
+                              prover.compressed_tables_, prover.table_indices_,
+                              prover.m_polys_, prover.grand_sum_polys_);
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
 
 #include "tachyon/zk/lookup/log_derivative_halo2/prover_impl.h"
 
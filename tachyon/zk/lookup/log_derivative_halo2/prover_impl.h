@@ -8,14 +8,16 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
-#include "third_party/pdqsort/include/pdqsort.h"
-
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/parallelize.h"
 #include "tachyon/base/ref.h"
+#include "tachyon/base/sort.h"
 #include "tachyon/zk/lookup/halo2/compress_expression.h"
 #include "tachyon/zk/lookup/log_derivative_halo2/prover.h"
 
@@ -48,18 +50,38 @@ Evals Prover<Poly, Evals>::CompressTable(
                                     evaluator_tpl);
 }
 
+// static
+template <typename Poly, typename Evals>
+std::vector<size_t> Prover<Poly, Evals>::ComputeTableIndices(
+    const std::vector<Argument<F>>& arguments) {
+  // NOTE: The table expressions are identified the same way as
+  // |plonk::ConstraintSystem::CreateLookupsMap()| does.
+  absl::flat_hash_map<std::string, size_t> indices;
+  return base::Map(arguments, [&indices](const Argument<F>& argument) {
+    std::stringstream ss;
+    for (const std::unique_ptr<Expression<F>>& expr :
+         argument.table_expressions()) {
+      ss << expr->Identifier();
+    }
+    return indices.try_emplace(ss.str(), indices.size()).first->second;
+  });
+}
+
 template <typename Poly, typename Evals>
 template <typename Domain>
 void Prover<Poly, Evals>::CompressPairs(
     const Domain* domain, const std::vector<Argument<F>>& arguments,
     const F& theta, const ProvingEvaluator<Evals>& evaluator_tpl) {
+  table_indices_ = ComputeTableIndices(arguments);
   compressed_inputs_vec_.reserve(arguments.size());
-  compressed_tables_.reserve(arguments.size());
-  for (const Argument<F>& argument : arguments) {
+  for (size_t i = 0; i < arguments.size(); ++i) {
     compressed_inputs_vec_.push_back(
-        CompressInputs(domain, argument, theta, evaluator_tpl));
-    compressed_tables_.push_back(
-        CompressTable(domain, argument, theta, evaluator_tpl));
+        CompressInputs(domain, arguments[i], theta, evaluator_tpl));
+    // The unique tables are numbered in the order of their first arguments.
+    if (table_indices_[i] == compressed_tables_.size()) {
+      compressed_tables_.push_back(
+          CompressTable(domain, arguments[i], theta, evaluator_tpl));
+    }
   }
 }
 
@@ -91,30 +113,73 @@ struct LessThan {
   }
 };
 
+// static
+template <typename Poly, typename Evals>
+std::vector<RowIndex> Prover<Poly, Evals>::ComputeTableIndexMap(
+    const Evals& compressed_table, RowIndex usable_rows,
+    bool collect_unique_rows, ComputeMPolysTempStorage<F>& storage) {
+  OPENMP_PARALLEL_FOR(RowIndex i = 0; i < usable_rows; ++i) {
+    storage.sorted_table_with_indices[i] = {i, compressed_table[i].ToBigInt()};
+  }
+
+  base::ParallelSort(storage.sorted_table_with_indices.begin(),
+                     storage.sorted_table_with_indices.end());
+
+  // NOTE: Each unique table value is mapped to the row that the binary search
+  // over |storage.sorted_table_with_indices| finds, so that the inputs are
+  // counted at the same rows as the binary search per input would while each
+  // of them is looked up in constant time.
+  std::vector<RowIndex> unique_rows;
+  for (RowIndex i = 0; i < usable_rows; ++i) {
+    const BigInt& eval = storage.sorted_table_with_indices[i].eval;
+    if (i != 0 && eval == storage.sorted_table_with_indices[i - 1].eval) {
+      continue;
+    }
+    auto it = base::BinarySearchByKey(
+        storage.sorted_table_with_indices.begin(),
+        storage.sorted_table_with_indices.end(), eval, LessThan<BigInt>{});
+    storage.table_index_map.try_emplace(compressed_table[it->index],
+                                        it->index);
+    if (collect_unique_rows) unique_rows.push_back(it->index);
+  }
+  return unique_rows;
+}
+
 // static
 template <typename Poly, typename Evals>
 template <typename PCS>
 BlindedPolynomial<Poly, Evals> Prover<Poly, Evals>::ComputeMPoly(
     ProverBase<PCS>* prover, const std::vector<Evals>& compressed_inputs,
-    const Evals& compressed_table, ComputeMPolysTempStorage<BigInt>& storage) {
+    const Evals& compressed_table, size_t argument_idx,
+    TableIndexCache* table_index_cache, bool reuse_table_index_map,
+    ComputeMPolysTempStorage<F>& storage) {
   RowIndex usable_rows = prover->GetUsableRows();
 
-  OPENMP_PARALLEL_FOR(RowIndex i = 0; i < usable_rows; ++i) {
-    storage.sorted_table_with_indices[i] = {i, compressed_table[i].ToBigInt()};
+  // NOTE: |storage.table_index_map| is kept for the next argument, so that
+  // the arguments of the same table sort it only once.
+  if (!reuse_table_index_map) {
+    storage.table_index_map.clear();
+    const std::vector<RowIndex>* cached_unique_rows =
+        table_index_cache ? table_index_cache->Find(argument_idx) : nullptr;
+    if (cached_unique_rows) {
+      for (RowIndex row : *cached_unique_rows) {
+        storage.table_index_map.try_emplace(compressed_table[row], row);
+      }
+    } else {
+      std::vector<RowIndex> unique_rows = ComputeTableIndexMap(
+          compressed_table, usable_rows, table_index_cache != nullptr, storage);
+      if (table_index_cache) {
+        table_index_cache->Insert(argument_idx, std::move(unique_rows));
+      }
+    }
   }
 
-  pdqsort(storage.sorted_table_with_indices.begin(),
-          storage.sorted_table_with_indices.end());
-
   OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < compressed_inputs.size(); ++i) {
     for (RowIndex j = 0; j < usable_rows; ++j) {
-      BigInt input = compressed_inputs[i][j].ToBigInt();
-      auto it = base::BinarySearchByKey(
-          storage.sorted_table_with_indices.begin(),
-          storage.sorted_table_with_indices.end(), input, LessThan<BigInt>{});
-      if (it != storage.sorted_table_with_indices.end()) {
-        storage.m_values_atomic[it->index].fetch_add(1,
-                                                     std::memory_order_relaxed);
+      auto it = storage.table_index_map.find(compressed_inputs[i][j]);
+      if (it != storage.table_index_map.end()) {
+        storage.m_values_atomic[it->second].fetch_add(
+            1, std::memory_order_relaxed);
       }
     }
   }
@@ -134,15 +199,24 @@ BlindedPolynomial<Poly, Evals> Prover<Poly, Evals>::ComputeMPoly(
 template <typename Poly, typename Evals>
 template <typename PCS>
 void Prover<Poly, Evals>::ComputeMPolys(
-    ProverBase<PCS>* prover, ComputeMPolysTempStorage<BigInt>& storage) {
-  CHECK_EQ(compressed_inputs_vec_.size(), compressed_tables_.size());
-  m_polys_ =
-      base::Map(compressed_inputs_vec_,
-                [this, prover, &storage](
-                    size_t i, const std::vector<Evals>& compressed_inputs) {
-                  return ComputeMPoly(prover, compressed_inputs,
-                                      compressed_tables_[i], storage);
-                });
+    ProverBase<PCS>* prover,
+    const std::vector<TableIndexCache*>& table_index_caches,
+    ComputeMPolysTempStorage<F>& storage) {
+  CHECK_EQ(compressed_inputs_vec_.size(), table_indices_.size());
+  CHECK_EQ(compressed_inputs_vec_.size(), table_index_caches.size());
+  std::optional<size_t> last_table_idx;
+  m_polys_ = base::Map(
+      compressed_inputs_vec_,
+      [this, prover, &table_index_caches, &storage, &last_table_idx](
+          size_t i, const std::vector<Evals>& compressed_inputs) {
+        size_t table_idx = table_indices_[i];
+        bool reuse_table_index_map = last_table_idx == table_idx;
+        last_table_idx = table_idx;
+        return ComputeMPoly(prover, compressed_inputs,
+                            compressed_tables_[table_idx], i,
+                            table_index_caches[i], reuse_table_index_map,
+                            storage);
+      });
 }
 
 // static
@@ -154,12 +228,16 @@ void Prover<Poly, Evals>::BatchCommitMPolys(
   if (lookup_provers.empty()) return;
 
   if constexpr (PCS::kSupportsBatchMode) {
+    std::vector<const Evals*> evals_list;
+    evals_list.reserve(GetNumMPolysCommitments(lookup_provers));
     for (const Prover& lookup_prover : lookup_provers) {
       for (const BlindedPolynomial<Poly, Evals>& m_poly :
            lookup_prover.m_polys()) {
-        prover->BatchCommitAt(m_poly.evals(), commit_idx++);
+        evals_list.push_back(&m_poly.evals());
       }
     }
+    prover->BatchCommitAllAt(evals_list, commit_idx);
+    commit_idx += evals_list.size();
   } else {
     for (const Prover& lookup_prover : lookup_provers) {
       for (const BlindedPolynomial<Poly, Evals>& m_poly :
@@ -174,7 +252,7 @@ void Prover<Poly, Evals>::BatchCommitMPolys(
 template <typename Poly, typename Evals>
 void Prover<Poly, Evals>::ComputeLogDerivatives(const Evals& evals,
                                                 const F& beta,
-                                                std::vector<F>& ret) {
+                                                absl::Span<F> ret) {
   base::Parallelize(ret,
                     [&evals, &beta](absl::Span<F> chunk, size_t chunk_offset,
                                     size_t chunk_size) {
@@ -192,16 +270,20 @@ template <typename PCS>
 BlindedPolynomial<Poly, Evals> Prover<Poly, Evals>::CreateGrandSumPoly(
     ProverBase<PCS>* prover, const Evals& m_values,
     const std::vector<Evals>& compressed_inputs, const Evals& compressed_table,
-    const F& beta, GrandSumPolysTempStorage<F>& storage) {
+    const F& beta, bool reuse_table_log_derivatives,
+    GrandSumPolysTempStorage<F>& storage) {
   size_t n = prover->pcs().N();
   RowIndex usable_rows = prover->GetUsableRows();
 
+  std::vector<F> grand_sum(n);
+
   // Σ 1/(φᵢ(X))
-  // NOTE(chokobole): To save memory, |input_log_derivatives| uses the storage
-  // space of |storage.table_log_derivatives| since
-  // |storage.table_log_derivatives| is currently empty and will be assigned
-  // with relevant values after |input_log_derivatives| is finished being used.
-  std::vector<F>& input_log_derivatives = storage.table_log_derivatives;
+  // NOTE: To save memory, |input_log_derivatives| uses the storage space of
+  // |grand_sum|, which is assigned after |input_log_derivatives| is finished
+  // being used, so that |storage.table_log_derivatives| can be kept for the
+  // next argument of the same table.
+  absl::Span<F> input_log_derivatives =
+      absl::MakeSpan(grand_sum).subspan(0, usable_rows);
   for (size_t i = 0; i < compressed_inputs.size(); ++i) {
     ComputeLogDerivatives(compressed_inputs[i], beta, input_log_derivatives);
 
@@ -217,9 +299,11 @@ BlindedPolynomial<Poly, Evals> Prover<Poly, Evals>::CreateGrandSumPoly(
   }
 
   // 1 / τ(X)
-  ComputeLogDerivatives(compressed_table, beta, storage.table_log_derivatives);
+  if (!reuse_table_log_derivatives) {
+    ComputeLogDerivatives(compressed_table, beta,
+                          absl::MakeSpan(storage.table_log_derivatives));
+  }
 
-  std::vector<F> grand_sum(n);
   grand_sum[0] = F::Zero();
 
   // (Σ 1/φᵢ(X)) - m(X) / τ(X)
@@ -234,47 +318,14 @@ BlindedPolynomial<Poly, Evals> Prover<Poly, Evals>::CreateGrandSumPoly(
     }
   }
 
-// let L(X) = (Σ 1/φᵢ(X)) - m(X) / τ(X)
-// ϕ(ω⁰) = 0
-// ϕ(ω¹) = L(ω⁰)
-// ...
-// ϕ(ω^last) = L(ω⁰) + L(ω¹) + ... + L(ω^{usable_rows - 1})
-#if defined(TACHYON_HAS_OPENMP)
-  // NOTE(chokobole): To save memory, |segment_sum| overwrites
-  // |storage.table_log_derivatives| since the current values of
-  // |storage.table_log_derivatives| are not needed anymore.
-  std::vector<F>& segment_sum = storage.table_log_derivatives;
-
-  absl::Span<F> grand_sum_sub_span =
-      absl::MakeSpan(grand_sum).subspan(0, usable_rows);
-  base::Parallelize(
-      grand_sum_sub_span,
-      [&log_derivatives_diff, &segment_sum](
-          absl::Span<F> chunk, size_t chunk_idx, size_t chunk_size) {
-        size_t start = chunk_idx * chunk_size;
-        for (size_t i = 1; i < chunk.size(); ++i) {
-          chunk[i] = chunk[i - 1] + log_derivatives_diff[start + i - 1];
-        }
-        segment_sum[chunk_idx] = chunk.back();
-      });
-
-  for (size_t i = 1; i < segment_sum.size(); ++i) {
-    segment_sum[i] += segment_sum[i - 1];
-  }
-
-  base::Parallelize(
-      grand_sum_sub_span,
-      [&segment_sum](absl::Span<F> chunk, size_t chunk_idx, size_t chunk_size) {
-        if (chunk_idx == 0) return;
-        const F& prefix_sum = segment_sum[chunk_idx - 1];
-        for (F& v : chunk) {
-          v += prefix_sum;
-        }
-      });
-#else
-  std::partial_sum(log_derivatives_diff.begin(), log_derivatives_diff.end() - 1,
-                   grand_sum.begin() + 1);
-#endif
+  // let L(X) = (Σ 1/φᵢ(X)) - m(X) / τ(X)
+  // ϕ(ω⁰) = 0
+  // ϕ(ω¹) = L(ω⁰)
+  // ...
+  // ϕ(ω^last) = L(ω⁰) + L(ω¹) + ... + L(ω^{usable_rows - 1})
+  base::ParallelizeInclusiveScan(
+      absl::MakeSpan(grand_sum).subspan(0, usable_rows),
+      [](const F& a, const F& b) { return a + b; });
 
   Evals grand_sum_poly(std::move(grand_sum));
 
@@ -289,16 +340,21 @@ template <typename PCS>
 void Prover<Poly, Evals>::CreateGrandSumPolys(
     ProverBase<PCS>* prover, const F& beta,
     GrandSumPolysTempStorage<F>& storage) {
-  CHECK_EQ(compressed_inputs_vec_.size(), compressed_tables_.size());
-
-  grand_sum_polys_ =
-      base::Map(compressed_inputs_vec_,
-                [this, &prover, &beta, &storage](
-                    size_t i, const std::vector<Evals>& compressed_inputs) {
-                  return CreateGrandSumPoly(
-                      prover, m_polys_[i].evals(), compressed_inputs,
-                      compressed_tables_[i], beta, storage);
-                });
+  CHECK_EQ(compressed_inputs_vec_.size(), table_indices_.size());
+
+  std::optional<size_t> last_table_idx;
+  grand_sum_polys_ = base::Map(
+      compressed_inputs_vec_,
+      [this, &prover, &beta, &storage, &last_table_idx](
+          size_t i, const std::vector<Evals>& compressed_inputs) {
+        size_t table_idx = table_indices_[i];
+        bool reuse_table_log_derivatives = last_table_idx == table_idx;
+        last_table_idx = table_idx;
+        return CreateGrandSumPoly(prover, m_polys_[i].evals(),
+                                  compressed_inputs,
+                                  compressed_tables_[table_idx], beta,
+                                  reuse_table_log_derivatives, storage);
+      });
 }
 
 // static
@@ -310,12 +366,16 @@ void Prover<Poly, Evals>::BatchCommitGrandSumPolys(
   if (lookup_provers.empty()) return;
 
   if constexpr (PCS::kSupportsBatchMode) {
+    std::vector<const Evals*> evals_list;
+    evals_list.reserve(GetNumGrandSumPolysCommitments(lookup_provers));
     for (const Prover& lookup_prover : lookup_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_sum_poly :
            lookup_prover.grand_sum_polys_) {
-        prover->BatchCommitAt(grand_sum_poly.evals(), commit_idx++);
+        evals_list.push_back(&grand_sum_poly.evals());
       }
     }
+    prover->BatchCommitAllAt(evals_list, commit_idx);
+    commit_idx += evals_list.size();
   } else {
     for (const Prover& lookup_prover : lookup_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_sum_poly :
@@ -329,12 +389,15 @@ void Prover<Poly, Evals>::BatchCommitGrandSumPolys(
 template <typename Poly, typename Evals>
 template <typename Domain>
 void Prover<Poly, Evals>::TransformEvalsToPoly(const Domain* domain) {
+  std::vector<BlindedPolynomial<Poly, Evals>*> polys;
+  polys.reserve(m_polys_.size() + grand_sum_polys_.size());
   for (BlindedPolynomial<Poly, Evals>& m_poly : m_polys_) {
-    m_poly.TransformEvalsToPoly(domain);
+    polys.push_back(&m_poly);
   }
   for (BlindedPolynomial<Poly, Evals>& grand_sum_poly : grand_sum_polys_) {
-    grand_sum_poly.TransformEvalsToPoly(domain);
+    polys.push_back(&grand_sum_poly);
   }
+  BlindedPolynomial<Poly, Evals>::TransformEvalsToPoly(polys, domain);
 }
 
 template <typename Poly, typename Evals>
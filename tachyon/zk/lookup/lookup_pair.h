@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/json/json.h"
 
 namespace tachyon {
@@ -47,6 +48,23 @@ using Pairs = std::vector<Pair<T, U>>;
 
 namespace base {
 
+template <typename T, typename U>
+class Copyable<zk::lookup::Pair<T, U>> {
+ public:
+  static bool WriteTo(const zk::lookup::Pair<T, U>& pair, Buffer* buffer) {
+    return buffer->WriteMany(pair.input(), pair.table());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       zk::lookup::Pair<T, U>* pair) {
+    return buffer.ReadMany(&pair->input(), &pair->table());
+  }
+
+  static size_t EstimateSize(const zk::lookup::Pair<T, U>& pair) {
+    return base::EstimateSize(pair.input(), pair.table());
+  }
+};
+
 template <typename T, typename U>
 class RapidJsonValueConverter<zk::lookup::Pair<T, U>> {
  public:
@@ -41,6 +41,7 @@ class ProvingEvaluator
   void set_idx(int32_t idx) { idx_ = idx; }
   int32_t size() const { return size_; }
   int32_t rot_scale() const { return rot_scale_; }
+  const plonk::MultiPhaseRefTable<Evals>& table() const { return table_; }
 
   // Evaluator methods
   Field Evaluate(const Expression<Field>* input) override {
@@ -0,0 +1,47 @@
+#ifndef TACHYON_ZK_LOOKUP_TABLE_INDEX_CACHE_H_
+#define TACHYON_ZK_LOOKUP_TABLE_INDEX_CACHE_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+
+#include "tachyon/zk/base/row_types.h"
+
+namespace tachyon::zk::lookup {
+
+// |TableIndexCache| keeps the rows of the unique table values for each lookup
+// argument whose table expressions don't contain any witness. Such a table
+// only depends on the proving key, so which of its rows hold equal values
+// doesn't change from proof to proof even though the compressed values change
+// along with θ. The provers use it to skip sorting the table after the first
+// proof made with the same proving key.
+class TableIndexCache {
+ public:
+  TableIndexCache() = default;
+
+  bool empty() const { return unique_rows_map_.empty(); }
+
+  // Returns the rows of the unique table values of the |argument_idx|-th
+  // lookup argument, or nullptr if they are not cached yet.
+  const std::vector<RowIndex>* Find(size_t argument_idx) const {
+    auto it = unique_rows_map_.find(argument_idx);
+    if (it == unique_rows_map_.end()) return nullptr;
+    return &it->second;
+  }
+
+  void Insert(size_t argument_idx, std::vector<RowIndex>&& unique_rows) {
+    unique_rows_map_[argument_idx] = std::move(unique_rows);
+  }
+
+  void Clear() { unique_rows_map_.clear(); }
+
+ private:
+  absl::flat_hash_map<size_t, std::vector<RowIndex>> unique_rows_map_;
+};
+
+}  // namespace tachyon::zk::lookup
+
+#endif  // TACHYON_ZK_LOOKUP_TABLE_INDEX_CACHE_H_
@@ -0,0 +1,134 @@
+#ifndef TACHYON_ZK_PLONK_BASE_BATCH_INVERSE_SCHEDULER_H_
+#define TACHYON_ZK_PLONK_BASE_BATCH_INVERSE_SCHEDULER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/compiler_specific.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+
+namespace tachyon::zk::plonk {
+
+// |BatchInverseScheduler| collects the values to be inverted from several
+// grand products, e.g, the denominators of every permutation column set of
+// every circuit, and inverts them all at once with the Montgomery's trick.
+// Instead of paying for an inversion per grand product, the values are split
+// evenly over the threads regardless of which grand product they belong to,
+// so that only a single inversion is done per thread.
+template <typename F>
+class BatchInverseScheduler {
+ public:
+  BatchInverseScheduler() = default;
+
+  size_t size() const { return size_; }
+
+  // NOTE: |values| must be kept alive until |Run()| is called.
+  void Add(absl::Span<F> values) {
+    if (values.empty()) return;
+    offsets_.push_back(size_);
+    spans_.push_back(values);
+    size_ += values.size();
+  }
+
+  // Replaces every added value with its inverse. Zeros are left as they are
+  // like |F::BatchInverseInPlace()|. The added values are cleared afterwards.
+  [[nodiscard]] bool Run() {
+    if (size_ == 0) return true;
+
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif
+    size_t chunk_size = (size_ + thread_nums - 1) / thread_nums;
+    size_t num_chunks = (size_ + chunk_size - 1) / chunk_size;
+    std::atomic<bool> check_valid(true);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+      size_t begin = i * chunk_size;
+      size_t end = std::min(begin + chunk_size, size_);
+      if (UNLIKELY(!DoBatchInverse(GetSubspans(begin, end), end - begin))) {
+        check_valid.store(false, std::memory_order_relaxed);
+      }
+    }
+
+    spans_.clear();
+    offsets_.clear();
+    size_ = 0;
+    if (UNLIKELY(!check_valid.load(std::memory_order_relaxed))) {
+      LOG(ERROR) << "Inverse of zero attempted";
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  // Returns the parts of the added spans that fall into [|begin|, |end|) of
+  // the concatenation of them.
+  std::vector<absl::Span<F>> GetSubspans(size_t begin, size_t end) const {
+    size_t idx =
+        std::upper_bound(offsets_.begin(), offsets_.end(), begin) -
+        offsets_.begin() - 1;
+    std::vector<absl::Span<F>> ret;
+    while (begin < end) {
+      size_t start = begin - offsets_[idx];
+      size_t len = std::min(spans_[idx].size() - start, end - begin);
+      ret.push_back(spans_[idx].subspan(start, len));
+      begin += len;
+      ++idx;
+    }
+    return ret;
+  }
+
+  // This is the same as |DoBatchInverse()| in groups.h except that it walks
+  // over several spans as if they were a single one.
+  static bool DoBatchInverse(const std::vector<absl::Span<F>>& subspans,
+                             size_t size) {
+    // First pass: compute [a₁, a₁ * a₂, ..., a₁ * a₂ * ... * aₙ] skipping
+    // zeros.
+    std::vector<F> products;
+    products.reserve(size);
+    F product = F::One();
+    for (absl::Span<F> subspan : subspans) {
+      for (const F& value : subspan) {
+        if (!value.IsZero()) product *= value;
+        products.push_back(product);
+      }
+    }
+
+    // (a₁ * a₂ * ... *  aₙ)⁻¹
+    std::optional<F> product_inv_opt = product.Inverse();
+    if (UNLIKELY(!product_inv_opt)) return false;
+    F product_inv = std::move(*product_inv_opt);
+
+    // Second pass: iterate backwards to compute inverses.
+    size_t i = size;
+    for (auto it = subspans.rbegin(); it != subspans.rend(); ++it) {
+      for (auto value_it = it->rbegin(); value_it != it->rend(); ++value_it) {
+        --i;
+        F& value = *value_it;
+        if (value.IsZero()) continue;
+        // (a₁ * a₂ * ... *  aᵢ)⁻¹ * aᵢ = (a₁ * a₂ * ... *  aᵢ₋₁)⁻¹
+        F new_product_inv = product_inv * value;
+        // (a₁ * a₂ * ... *  aᵢ)⁻¹ * (a₁ * a₂ * ... aᵢ₋₁) = aᵢ⁻¹
+        value = i == 0 ? product_inv : product_inv * products[i - 1];
+        product_inv = std::move(new_product_inv);
+      }
+    }
+    return true;
+  }
+
+  std::vector<absl::Span<F>> spans_;
+  // |offsets_[i]| is the index of the first value of |spans_[i]| in the
+  // concatenation of |spans_|.
+  std::vector<size_t> offsets_;
+  size_t size_ = 0;
+};
+
+}  // namespace tachyon::zk::plonk
+
+#endif  // TACHYON_ZK_PLONK_BASE_BATCH_INVERSE_SCHEDULER_H_
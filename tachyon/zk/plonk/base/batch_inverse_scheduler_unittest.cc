@@ -0,0 +1,47 @@
+#include "tachyon/zk/plonk/base/batch_inverse_scheduler.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/optional.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::zk::plonk {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+class BatchInverseSchedulerTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+};
+
+}  // namespace
+
+TEST_F(BatchInverseSchedulerTest, Run) {
+  std::vector<std::vector<F>> values_list = base::Map(
+      std::vector<size_t>{1, 0, 17, 100, 3}, [](size_t size) {
+        return base::CreateVector(size, []() { return F::Random(); });
+      });
+  values_list[2][5] = F::Zero();
+  std::vector<std::vector<F>> expected = base::Map(
+      values_list, [](const std::vector<F>& values) {
+        return base::Map(values, [](const F& value) {
+          return value.IsZero() ? F::Zero() : unwrap(value.Inverse());
+        });
+      });
+
+  BatchInverseScheduler<F> scheduler;
+  for (std::vector<F>& values : values_list) {
+    scheduler.Add(absl::MakeSpan(values));
+  }
+  EXPECT_EQ(scheduler.size(), size_t{121});
+  ASSERT_TRUE(scheduler.Run());
+  EXPECT_EQ(scheduler.size(), size_t{0});
+  EXPECT_EQ(values_list, expected);
+}
+
+}  // namespace tachyon::zk::plonk
@@ -1,5 +1,8 @@
 #include "tachyon/zk/plonk/constraint_system/constraint_system.h"
 
+#include <string>
+
+#include "absl/container/flat_hash_map.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
@@ -242,6 +245,48 @@ TEST_F(ConstraintSystemTest, LookupAny) {
   EXPECT_EQ(constraint_system.lookups(), expected_lookups);
 }
 
+TEST_F(ConstraintSystemTest, ChunkLookups) {
+  ConstraintSystem<F> constraint_system(lookup::Type::kLogDerivativeHalo2);
+
+  std::vector<FixedColumnKey> tables = {constraint_system.CreateFixedColumn(),
+                                        constraint_system.CreateFixedColumn()};
+  // Maps the identifier of each input to the one of its table.
+  absl::flat_hash_map<std::string, std::string> table_of_input;
+  for (const FixedColumnKey& table : tables) {
+    for (size_t i = 0; i < 2; ++i) {
+      AdviceColumnKey advice = constraint_system.CreateAdviceColumn();
+      constraint_system.LookupAny(
+          "lookup", [&advice, &table, &table_of_input](VirtualCells<F>& cells) {
+            std::unique_ptr<Expression<F>> advice_expr =
+                cells.QueryAdvice(advice, Rotation::Cur());
+            std::unique_ptr<Expression<F>> table_expr =
+                cells.QueryFixed(table, Rotation::Cur());
+            table_of_input[advice_expr->Identifier()] =
+                table_expr->Identifier();
+
+            lookup::Pairs<std::unique_ptr<Expression<F>>> lookup_pairs;
+            lookup_pairs.emplace_back(std::move(advice_expr),
+                                      std::move(table_expr));
+            return lookup_pairs;
+          });
+    }
+  }
+
+  constraint_system.ChunkLookups();
+
+  // Both inputs of a table fit into a single argument, but never into the
+  // argument of the other table.
+  ASSERT_EQ(constraint_system.lookups().size(), 2);
+  for (const lookup::Argument<F>& argument : constraint_system.lookups()) {
+    ASSERT_EQ(argument.inputs_expressions().size(), 2);
+    for (const std::vector<std::unique_ptr<Expression<F>>>& input :
+         argument.inputs_expressions()) {
+      EXPECT_EQ(table_of_input[input[0]->Identifier()],
+                argument.table_expressions()[0]->Identifier());
+    }
+  }
+}
+
 TEST_F(ConstraintSystemTest, QueryFixedIndex) {
   ConstraintSystem<F> constraint_system;
   FixedColumnKey column = constraint_system.CreateFixedColumn();
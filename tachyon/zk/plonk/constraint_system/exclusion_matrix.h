@@ -7,11 +7,17 @@
 #ifndef TACHYON_ZK_PLONK_CONSTRAINT_SYSTEM_EXCLUSION_MATRIX_H_
 #define TACHYON_ZK_PLONK_CONSTRAINT_SYSTEM_EXCLUSION_MATRIX_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <algorithm>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/export.h"
 #include "tachyon/zk/plonk/constraint_system/selector_description.h"
 
@@ -58,14 +64,30 @@ namespace tachyon::zk::plonk {
 
 class TACHYON_EXPORT ExclusionMatrix {
  public:
+  // The activations are packed into words first, so that the selectors are
+  // compared 64 rows at a time. The rows of the matrix are computed in
+  // parallel.
   explicit ExclusionMatrix(const std::vector<SelectorDescription>& selectors) {
-    lower_triangular_matrix_ =
-        base::CreateVector(selectors.size(), [&selectors](size_t i) {
-          const SelectorDescription& selector = selectors[i];
-          return base::CreateVector(i, [&selector, &selectors](size_t j) {
-            return !selector.IsOrthogonal(selectors[j]);
-          });
-        });
+    size_t size = selectors.size();
+    std::vector<std::vector<uint64_t>> bitsets(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      bitsets[i] = Pack(selectors[i].activations());
+    }
+
+    lower_triangular_matrix_ = base::CreateVector(
+        size, [](size_t i) { return std::vector<bool>(i, false); });
+    OPENMP_PARALLEL_FOR(size_t k = 0; k < size; ++k) {
+      // NOTE: The i-th row has i entries, so the rows are visited as
+      // 0, n - 1, 1, n - 2, ..., which balances the threads better than
+      // splitting them in order.
+      size_t i = k % 2 == 0 ? k / 2 : size - 1 - k / 2;
+      // NOTE: Each row is a separate |std::vector<bool>|, so the threads
+      // never write to the same word.
+      std::vector<bool>& row = lower_triangular_matrix_[i];
+      for (size_t j = 0; j < i; ++j) {
+        row[j] = !IsOrthogonal(bitsets[i], bitsets[j]);
+      }
+    }
   }
 
   const std::vector<std::vector<bool>>& lower_triangular_matrix() const {
@@ -78,6 +100,37 @@ class TACHYON_EXPORT ExclusionMatrix {
     return lower_triangular_matrix_[i][j];
   }
 
+  // Returns |activations| packed into words, where the i-th row is the
+  // (i % 64)-th bit of the (i / 64)-th word.
+  static std::vector<uint64_t> Pack(const std::vector<bool>& activations) {
+    std::vector<uint64_t> ret((activations.size() + 63) / 64, 0);
+    for (size_t i = 0; i < activations.size(); ++i) {
+      if (activations[i]) ret[i / 64] |= uint64_t{1} << (i % 64);
+    }
+    return ret;
+  }
+
+  // Returns true if no bit is set in both |a| and |b|.
+  static bool IsOrthogonal(absl::Span<const uint64_t> a,
+                           absl::Span<const uint64_t> b) {
+    // The words of a block are combined without branches so that the compiler
+    // vectorizes them, and the check stops at the first conflicting block.
+    constexpr size_t kBlockSize = 16;
+    size_t size = std::min(a.size(), b.size());
+    size_t i = 0;
+    for (; i + kBlockSize <= size; i += kBlockSize) {
+      uint64_t conflicts = 0;
+      for (size_t k = 0; k < kBlockSize; ++k) {
+        conflicts |= a[i + k] & b[i + k];
+      }
+      if (conflicts != 0) return false;
+    }
+    for (; i < size; ++i) {
+      if ((a[i] & b[i]) != 0) return false;
+    }
+    return true;
+  }
+
  private:
   std::vector<std::vector<bool>> lower_triangular_matrix_;
 };
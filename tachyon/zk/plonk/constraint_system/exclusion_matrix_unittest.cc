@@ -3,6 +3,8 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "tachyon/base/random.h"
+
 namespace tachyon::zk::plonk {
 
 namespace {
@@ -100,4 +102,38 @@ TEST_F(ExclusionMatrixTest, IsExclusive) {
   }
 }
 
+TEST_F(ExclusionMatrixTest, Pack) {
+  std::vector<bool> activations(130, false);
+  activations[0] = true;
+  activations[65] = true;
+  activations[129] = true;
+  EXPECT_EQ(ExclusionMatrix::Pack(activations),
+            (std::vector<uint64_t>{1, 2, 2}));
+}
+
+TEST_F(ExclusionMatrixTest, LongSelectors) {
+  // The selectors span more than a block of words, and are sparse enough for
+  // some of them to be orthogonal.
+  constexpr size_t kNumSelectors = 20;
+  constexpr size_t kRows = 64 * 40 + 7;
+  std::vector<std::vector<bool>> activations =
+      base::CreateVector(kNumSelectors, []() {
+        return base::CreateVector(kRows, []() {
+          return base::Uniform(base::Range<size_t>::Until(100)) == 0;
+        });
+      });
+  std::vector<SelectorDescription> selectors =
+      base::CreateVector(kNumSelectors, [&activations](size_t i) {
+        return SelectorDescription(i, &activations[i], 1);
+      });
+
+  ExclusionMatrix exclusion_matrix(selectors);
+  for (size_t i = 0; i < kNumSelectors; ++i) {
+    for (size_t j = 0; j < i; ++j) {
+      EXPECT_EQ(exclusion_matrix.IsExclusive(i, j),
+                !selectors[i].IsOrthogonal(selectors[j]));
+    }
+  }
+}
+
 }  // namespace tachyon::zk::plonk
@@ -20,6 +20,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/containers/cxx20_erase_vector.h"
 #include "tachyon/base/functional/callback.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/zk/expressions/expression_factory.h"
 #include "tachyon/zk/plonk/constraint_system/exclusion_matrix.h"
 #include "tachyon/zk/plonk/constraint_system/selector_assignment.h"
@@ -160,9 +161,11 @@ class SelectorCompressor {
       // appear in any gate constraint.
       std::unique_ptr<Expression<F>> expression = callback_.Run();
 
-      std::vector<F> combination_assignment =
-          base::Map(selector.activations(),
-                    [](bool b) { return b ? F::One() : F::Zero(); });
+      const std::vector<bool>& activations = selector.activations();
+      std::vector<F> combination_assignment(activations.size());
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < activations.size(); ++i) {
+        combination_assignment[i] = activations[i] ? F::One() : F::Zero();
+      }
       size_t combination_index = combination_assignments_.size();
       combination_assignments_.push_back(std::move(combination_assignment));
       selector_assignments_.push_back(SelectorAssignment<F>(
@@ -267,7 +270,7 @@ class SelectorCompressor {
 
       // Update the combination assignment
       const std::vector<bool>& activations = selector.activations();
-      for (size_t i = 0; i < n; ++i) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
         // This will not overwrite another selector's activations
         // because we have ensured that selectors are disjoint.
         if (activations[i]) {
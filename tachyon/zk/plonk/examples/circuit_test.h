@@ -1,20 +1,28 @@
 #ifndef TACHYON_ZK_PLONK_EXAMPLES_CIRCUIT_TEST_H_
 #define TACHYON_ZK_PLONK_EXAMPLES_CIRCUIT_TEST_H_
 
+#include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "absl/types/span.h"
 
 #include "tachyon/base/array_to_vector.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
 #include "tachyon/zk/lookup/lookup_pair.h"
 #include "tachyon/zk/plonk/examples/circuit_test_type_traits.h"
 #include "tachyon/zk/plonk/examples/point.h"
 #include "tachyon/zk/plonk/halo2/pinned_constraint_system.h"
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
+#include "tachyon/zk/plonk/halo2/prepared_verifying_key.h"
+#include "tachyon/zk/plonk/halo2/proof_checkpoint.h"
+#include "tachyon/zk/plonk/halo2/prover_memory_budget.h"
 #include "tachyon/zk/plonk/halo2/prover_test.h"
+#include "tachyon/zk/plonk/keys/proving_key_cache.h"
 
 namespace tachyon::zk::plonk {
 
@@ -221,7 +229,64 @@ class CircuitTest : public halo2::ProverTest<typename TestArguments::PCS,
     }
   }
 
-  void CreateProofTest() {
+  void LoadProvingKeyWithCacheTest() {
+    CHECK(this->prover_->pcs().UnsafeSetup(TestData::kN, F(2)));
+    this->prover_->set_domain(Domain::Create(TestData::kN));
+
+    Circuit circuit = TestData::GetCircuit();
+    ProvingKey<LS> expected;
+    ASSERT_TRUE(expected.Load(this->prover_.get(), circuit));
+
+    base::ScopedTempDir temp_dir;
+    ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+    ProvingKeyCache cache(temp_dir.GetPath());
+    // The first load writes the cache, which the second one reads.
+    for (size_t i = 0; i < 2; ++i) {
+      SCOPED_TRACE(absl::Substitute("i: $0", i));
+      ProvingKey<LS> pkey;
+      ASSERT_TRUE(pkey.LoadWithCache(this->prover_.get(), circuit, cache));
+      EXPECT_FALSE(base::IsDirectoryEmpty(temp_dir.GetPath()));
+
+      const VerifyingKey<F, Commitment>& vkey = pkey.verifying_key();
+      const VerifyingKey<F, Commitment>& expected_vkey =
+          expected.verifying_key();
+      EXPECT_EQ(vkey.fixed_commitments(), expected_vkey.fixed_commitments());
+      EXPECT_EQ(vkey.permutation_verifying_key().commitments(),
+                expected_vkey.permutation_verifying_key().commitments());
+      EXPECT_EQ(vkey.transcript_repr(), expected_vkey.transcript_repr());
+      EXPECT_EQ(pkey.l_first(), expected.l_first());
+      EXPECT_EQ(pkey.l_last(), expected.l_last());
+      EXPECT_EQ(pkey.l_active_row(), expected.l_active_row());
+      EXPECT_EQ(pkey.fixed_columns(), expected.fixed_columns());
+      EXPECT_EQ(pkey.fixed_polys(), expected.fixed_polys());
+      EXPECT_EQ(pkey.permutation_proving_key().permutations(),
+                expected.permutation_proving_key().permutations());
+      EXPECT_EQ(pkey.permutation_proving_key().polys(),
+                expected.permutation_proving_key().polys());
+    }
+  }
+
+  void CreateProofTest(bool async_commit = false) {
+    CHECK(this->prover_->pcs().UnsafeSetup(TestData::kN, F(2)));
+    this->prover_->set_domain(Domain::Create(TestData::kN));
+    this->prover_->set_async_commit(async_commit);
+
+    std::vector<Circuit> circuits = TestData::Get2Circuits();
+
+    std::vector<Evals> instance_columns = TestData::GetInstanceColumns();
+    std::vector<std::vector<Evals>> instance_columns_vec = {
+        instance_columns, std::move(instance_columns)};
+
+    ProvingKey<LS> pkey;
+    ASSERT_TRUE(pkey.Load(this->prover_.get(), circuits[0]));
+    this->prover_->CreateProof(pkey, std::move(instance_columns_vec), circuits);
+
+    std::vector<uint8_t> proof =
+        this->prover_->GetWriter()->buffer().owned_buffer();
+    EXPECT_EQ(proof, base::ArrayToVector(TestData::kProof));
+  }
+
+  void CreateProofWithFixedCosetsTest() {
     CHECK(this->prover_->pcs().UnsafeSetup(TestData::kN, F(2)));
     this->prover_->set_domain(Domain::Create(TestData::kN));
 
@@ -233,6 +298,8 @@ class CircuitTest : public halo2::ProverTest<typename TestArguments::PCS,
 
     ProvingKey<LS> pkey;
     ASSERT_TRUE(pkey.Load(this->prover_.get(), circuits[0]));
+    pkey.PrecomputeFixedCosets(this->prover_.get());
+    EXPECT_FALSE(pkey.fixed_cosets().empty());
     this->prover_->CreateProof(pkey, std::move(instance_columns_vec), circuits);
 
     std::vector<uint8_t> proof =
@@ -240,6 +307,121 @@ class CircuitTest : public halo2::ProverTest<typename TestArguments::PCS,
     EXPECT_EQ(proof, base::ArrayToVector(TestData::kProof));
   }
 
+  void CreateProofWithMemoryBudgetTest() {
+    CHECK(this->prover_->pcs().UnsafeSetup(TestData::kN, F(2)));
+    this->prover_->set_domain(Domain::Create(TestData::kN));
+
+    // Every intermediate is spilled, since none of them fits in the budget.
+    base::ScopedTempDir temp_dir;
+    ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+    base::FilePath scratch_path = temp_dir.GetPath().Append("proof.spill");
+    {
+      halo2::ProverMemoryBudget memory_budget(0, scratch_path);
+      this->prover_->set_memory_budget(&memory_budget);
+
+      std::vector<Circuit> circuits = TestData::Get2Circuits();
+
+      std::vector<Evals> instance_columns = TestData::GetInstanceColumns();
+      std::vector<std::vector<Evals>> instance_columns_vec = {
+          instance_columns, std::move(instance_columns)};
+
+      ProvingKey<LS> pkey;
+      ASSERT_TRUE(pkey.Load(this->prover_.get(), circuits[0]));
+      this->prover_->CreateProof(pkey, std::move(instance_columns_vec),
+                                 circuits);
+      this->prover_->set_memory_budget(nullptr);
+
+      const halo2::SpillMetrics& metrics = memory_budget.metrics();
+      EXPECT_EQ(metrics.num_spills, size_t{3});
+      EXPECT_GT(metrics.spilled_bytes, size_t{0});
+      EXPECT_EQ(metrics.restored_bytes, metrics.spilled_bytes);
+    }
+    EXPECT_FALSE(base::PathExists(scratch_path));
+
+    std::vector<uint8_t> proof =
+        this->prover_->GetWriter()->buffer().owned_buffer();
+    EXPECT_EQ(proof, base::ArrayToVector(TestData::kProof));
+  }
+
+  void CreateProofWithCheckpointTest() {
+    base::ScopedTempDir temp_dir;
+    ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+    halo2::ProofCheckpoint checkpoint(temp_dir.GetPath().Append("proof.ckpt"));
+
+    // The checkpoint is backed up whenever the proof is flushed, i.e., right
+    // before each challenge is squeezed, to resume the proof from each of
+    // them later.
+    std::vector<base::FilePath> backups;
+    std::vector<uint8_t> proof = CreateProofWithCheckpoint(
+        &checkpoint, [&checkpoint, &temp_dir, &backups]() {
+          if (!base::PathExists(checkpoint.path())) return;
+          base::FilePath backup =
+              temp_dir.GetPath().Append(absl::StrCat("backup", backups.size()));
+          CHECK(base::CopyFile(checkpoint.path(), backup));
+          backups.push_back(std::move(backup));
+        });
+    EXPECT_EQ(proof, base::ArrayToVector(TestData::kProof));
+    EXPECT_FALSE(base::PathExists(checkpoint.path()));
+    ASSERT_FALSE(backups.empty());
+
+    for (const base::FilePath& backup : backups) {
+      SCOPED_TRACE(backup.value());
+      this->SetUp();
+      halo2::ProofCheckpoint resumed_checkpoint(backup);
+      std::vector<uint8_t> resumed_proof =
+          CreateProofWithCheckpoint(&resumed_checkpoint, []() {});
+      // NOTE: What is flushed before the checkpoint isn't flushed again.
+      size_t flushed_len =
+          this->prover_->GetWriter()->GetProofLen() - resumed_proof.size();
+      resumed_proof.insert(resumed_proof.begin(), proof.begin(),
+                           proof.begin() + flushed_len);
+      EXPECT_EQ(resumed_proof, proof);
+      EXPECT_FALSE(base::PathExists(backup));
+    }
+  }
+
+  void BatchVerifyProofTest() {
+    using PairingPoints = typename PCS::PairingPoints;
+    CHECK(this->prover_->pcs().UnsafeSetup(TestData::kN, F(2)));
+    this->prover_->set_domain(Domain::Create(TestData::kN));
+
+    Circuit circuit = TestData::GetCircuit();
+
+    VerifyingKey<F, Commitment> vkey;
+    ASSERT_TRUE(
+        vkey.Load(this->prover_.get(), circuit, TestArguments::LS::type));
+
+    std::vector<uint8_t> owned_proof = base::ArrayToVector(TestData::kProof);
+
+    std::vector<Evals> instance_columns = TestData::GetInstanceColumns();
+    std::vector<std::vector<Evals>> instance_columns_vec = {
+        instance_columns, std::move(instance_columns)};
+
+    // The verifying key is prepared once for all the proofs.
+    halo2::PreparedVerifyingKey<F, Commitment> pvk(vkey,
+                                                   this->prover_->domain());
+
+    // Every proof is read by its own verifier with its own transcript.
+    std::vector<PairingPoints> pairing_points_vec(3);
+    for (PairingPoints& pairing_points : pairing_points_vec) {
+      halo2::Verifier<PCS, LS> verifier(
+          PCS(this->prover_->pcs()),
+          std::make_unique<halo2::Blake2bReader<Commitment>>(
+              CreateBufferWithProof(absl::MakeSpan(owned_proof))));
+      verifier.set_domain(this->prover_->shared_domain());
+      verifier.set_extended_domain(this->prover_->shared_extended_domain());
+      ASSERT_TRUE(verifier.VerifyProofWithoutPairing(
+          pvk, instance_columns_vec, &pairing_points));
+    }
+
+    halo2::Verifier<PCS, LS> verifier = this->CreateVerifier(
+        CreateBufferWithProof(absl::MakeSpan(owned_proof)));
+    EXPECT_TRUE(verifier.BatchVerifyPairingPoints(pairing_points_vec));
+
+    std::swap(pairing_points_vec[1][0], pairing_points_vec[1][1]);
+    EXPECT_FALSE(verifier.BatchVerifyPairingPoints(pairing_points_vec));
+  }
+
   void VerifyProofTest() {
     using Proof = typename TestArguments::LS::Proof;
     CHECK(this->prover_->pcs().UnsafeSetup(TestData::kN, F(2)));
@@ -606,6 +788,36 @@ class CircuitTest : public halo2::ProverTest<typename TestArguments::PCS,
     });
   }
 
+  // Creates a proof with |checkpoint| and returns what is flushed to the proof
+  // sink, which calls |on_flush()| first.
+  template <typename Callback>
+  std::vector<uint8_t> CreateProofWithCheckpoint(
+      halo2::ProofCheckpoint* checkpoint, Callback on_flush) {
+    CHECK(this->prover_->pcs().UnsafeSetup(TestData::kN, F(2)));
+    this->prover_->set_domain(Domain::Create(TestData::kN));
+    this->prover_->set_checkpoint(checkpoint);
+
+    std::vector<uint8_t> proof;
+    this->prover_->GetWriter()->set_proof_sink(
+        [&proof, &on_flush](absl::Span<const uint8_t> segment) {
+          on_flush();
+          proof.insert(proof.end(), segment.begin(), segment.end());
+          return true;
+        });
+
+    std::vector<Circuit> circuits = TestData::Get2Circuits();
+
+    std::vector<Evals> instance_columns = TestData::GetInstanceColumns();
+    std::vector<std::vector<Evals>> instance_columns_vec = {
+        instance_columns, std::move(instance_columns)};
+
+    ProvingKey<LS> pkey;
+    CHECK(pkey.Load(this->prover_.get(), circuits[0]));
+    this->prover_->CreateProof(pkey, std::move(instance_columns_vec), circuits);
+    this->prover_->GetWriter()->set_proof_sink(nullptr);
+    return proof;
+  }
+
   static base::Buffer CreateBufferWithProof(absl::Span<uint8_t> proof) {
     return {proof.data(), proof.size()};
   }
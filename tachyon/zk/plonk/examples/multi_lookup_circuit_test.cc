@@ -28,6 +28,12 @@ using MultiLookupTestArgumentsList = testing::Types<
 TYPED_TEST_SUITE(MultiLookupCircuitTest, MultiLookupTestArgumentsList);
 
 TYPED_TEST(MultiLookupCircuitTest, CreateProof) { this->CreateProofTest(); }
+TYPED_TEST(MultiLookupCircuitTest, CreateProofWithCheckpoint) {
+  this->CreateProofWithCheckpointTest();
+}
+TYPED_TEST(MultiLookupCircuitTest, CreateProofWithMemoryBudget) {
+  this->CreateProofWithMemoryBudgetTest();
+}
 TYPED_TEST(MultiLookupCircuitTest, VerifyProof) { this->VerifyProofTest(); }
 
 }  // namespace tachyon::zk::plonk
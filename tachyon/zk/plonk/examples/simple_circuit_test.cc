@@ -34,7 +34,13 @@ TYPED_TEST(SimpleCircuitTest, LoadVerifyingKey) {
   this->LoadVerifyingKeyTest();
 }
 TYPED_TEST(SimpleCircuitTest, LoadProvingKey) { this->LoadProvingKeyTest(); }
+TYPED_TEST(SimpleCircuitTest, LoadProvingKeyWithCache) {
+  this->LoadProvingKeyWithCacheTest();
+}
 TYPED_TEST(SimpleCircuitTest, CreateProof) { this->CreateProofTest(); }
+TYPED_TEST(SimpleCircuitTest, CreateProofWithFixedCosets) {
+  this->CreateProofWithFixedCosetsTest();
+}
 TYPED_TEST(SimpleCircuitTest, VerifyProof) { this->VerifyProofTest(); }
 
 }  // namespace tachyon::zk::plonk
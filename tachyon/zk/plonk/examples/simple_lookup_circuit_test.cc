@@ -39,6 +39,18 @@ TYPED_TEST(SimpleLookupCircuitTest, LoadProvingKey) {
   this->LoadProvingKeyTest();
 }
 TYPED_TEST(SimpleLookupCircuitTest, CreateProof) { this->CreateProofTest(); }
+TYPED_TEST(SimpleLookupCircuitTest, CreateProofWithAsyncCommit) {
+  this->CreateProofTest(/*async_commit=*/true);
+}
+TYPED_TEST(SimpleLookupCircuitTest, CreateProofWithCheckpoint) {
+  this->CreateProofWithCheckpointTest();
+}
+TYPED_TEST(SimpleLookupCircuitTest, CreateProofWithMemoryBudget) {
+  this->CreateProofWithMemoryBudgetTest();
+}
 TYPED_TEST(SimpleLookupCircuitTest, VerifyProof) { this->VerifyProofTest(); }
+TYPED_TEST(SimpleLookupCircuitTest, BatchVerifyProof) {
+  this->BatchVerifyProofTest();
+}
 
 }  // namespace tachyon::zk::plonk
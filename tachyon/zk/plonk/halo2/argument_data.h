@@ -53,7 +53,9 @@ class ArgumentData {
   static ArgumentData Create(
       ProverBase<PCS>* prover, std::vector<Circuit>& circuits,
       const ConstraintSystem<F>& constraint_system,
-      std::vector<std::vector<Evals>>&& instance_columns_vec) {
+      std::vector<std::vector<Evals>>&& instance_columns_vec,
+      IncrementalAdviceCommitments<Evals, typename PCS::Commitment>*
+          incremental_commitments = nullptr) {
     // Generate instance polynomial and write it to transcript.
     std::vector<std::vector<Poly>> instance_polys_vec =
         GenerateInstancePolys(prover, instance_columns_vec);
@@ -69,7 +71,8 @@ class ArgumentData {
 
     // Generate advice poly by synthesizing circuit and write it to transcript.
     Synthesizer<Evals> synthesizer(num_circuits, &constraint_system);
-    synthesizer.GenerateAdviceColumns(prover, circuits, instance_columns_vec);
+    synthesizer.GenerateAdviceColumns(prover, circuits, instance_columns_vec,
+                                      incremental_commitments);
 
     return ArgumentData(std::move(synthesizer).TakeAdviceColumnsVec(),
                         std::move(synthesizer).TakeAdviceBlindsVec(),
@@ -110,9 +113,7 @@ class ArgumentData {
     CHECK(!advice_transformed_);
     advice_polys_vec_ = base::Map(
         advice_columns_vec_, [domain](std::vector<Evals>& advice_columns) {
-          return base::Map(advice_columns, [domain](Evals& advice_column) {
-            return domain->IFFT(std::move(advice_column));
-          });
+          return domain->IFFTBatch(std::move(advice_columns));
         });
     advice_transformed_ = true;
   }
@@ -143,6 +144,31 @@ class ArgumentData {
     });
   }
 
+  // NOTE: Unlike |base::Copyable<ArgumentData>|, which holds the columns in
+  // evaluation form only, these write and read the data in the middle of
+  // |Prover::CreateProof()| as well, when some of it is already transformed
+  // to coefficient form or released. See |ProofCheckpoint|.
+  [[nodiscard]] bool WriteCheckpointTo(base::Buffer* buffer) const {
+    return buffer->WriteMany(advice_transformed_, advice_columns_vec_,
+                             advice_polys_vec_, advice_blinds_vec_,
+                             challenges_, instance_columns_vec_,
+                             instance_polys_vec_);
+  }
+
+  [[nodiscard]] bool ReadCheckpointFrom(const base::ReadOnlyBuffer& buffer) {
+    return buffer.ReadMany(&advice_transformed_, &advice_columns_vec_,
+                           &advice_polys_vec_, &advice_blinds_vec_,
+                           &challenges_, &instance_columns_vec_,
+                           &instance_polys_vec_);
+  }
+
+  size_t EstimateCheckpointSize() const {
+    return base::EstimateSize(advice_transformed_, advice_columns_vec_,
+                              advice_polys_vec_, advice_blinds_vec_,
+                              challenges_, instance_columns_vec_,
+                              instance_polys_vec_);
+  }
+
   bool operator==(const ArgumentData& other) const {
     return advice_transformed_ == other.advice_transformed_ &&
            advice_columns_vec_ == other.advice_columns_vec_ &&
@@ -178,8 +204,6 @@ class ArgumentData {
     instance_polys_vec.reserve(num_circuit);
     for (size_t i = 0; i < num_circuit; ++i) {
       const std::vector<Evals>& instance_columns = instance_columns_vec[i];
-      std::vector<Poly> instance_polys;
-      instance_polys.reserve(num_instance_columns);
       for (size_t j = 0; j < num_instance_columns; ++j) {
         const Evals& instance_column = instance_columns[j];
         if constexpr (PCS::kQueryInstance && PCS::kSupportsBatchMode) {
@@ -191,9 +215,9 @@ class ArgumentData {
             CHECK(prover->GetWriter()->WriteToTranscript(instance));
           }
         }
-        instance_polys.push_back(prover->domain()->IFFT(instance_column));
       }
-      instance_polys_vec.push_back(std::move(instance_polys));
+      instance_polys_vec.push_back(
+          prover->domain()->IFFTBatch(absl::MakeConstSpan(instance_columns)));
     }
     if constexpr (PCS::kSupportsBatchMode && PCS::kQueryInstance) {
       prover->RetrieveAndWriteBatchCommitmentsToTranscript();
@@ -17,44 +17,48 @@ class ArgumentDataTest : public math::FiniteFieldTest<math::GF7> {
  public:
   using Poly = math::UnivariateDensePolynomial<math::GF7, kMaxDegree>;
   using Evals = math::UnivariateEvaluations<math::GF7, kMaxDegree>;
+
+  static ArgumentData<Poly, Evals> CreateRandomArgumentData() {
+    constexpr size_t kNumCircuits = 2;
+    constexpr size_t kNumAdvices = 3;
+    constexpr size_t kNumBlinds = 4;
+    constexpr size_t kNumChallenges = 2;
+    constexpr size_t kNumInstances = 2;
+
+    std::vector<std::vector<Evals>> advice_columns_vec =
+        base::CreateVector(kNumCircuits, []() {
+          return base::CreateVector(kNumAdvices,
+                                    []() { return Evals::Random(kMaxDegree); });
+        });
+    std::vector<std::vector<math::GF7>> advice_blinds_vec =
+        base::CreateVector(kNumCircuits, []() {
+          return base::CreateVector(kNumBlinds,
+                                    []() { return math::GF7::Random(); });
+        });
+    std::vector<math::GF7> challenges = base::CreateVector(
+        kNumChallenges, []() { return math::GF7::Random(); });
+    std::vector<std::vector<Evals>> instance_columns_vec =
+        base::CreateVector(kNumCircuits, []() {
+          return base::CreateVector(kNumInstances,
+                                    []() { return Evals::Random(kMaxDegree); });
+        });
+    std::vector<std::vector<Poly>> instance_polys_vec =
+        base::CreateVector(kNumCircuits, []() {
+          return base::CreateVector(kNumInstances,
+                                    []() { return Poly::Random(kMaxDegree); });
+        });
+
+    return ArgumentData<Poly, Evals>(
+        std::move(advice_columns_vec), std::move(advice_blinds_vec),
+        std::move(challenges), std::move(instance_columns_vec),
+        std::move(instance_polys_vec));
+  }
 };
 
 }  // namespace
 
 TEST_F(ArgumentDataTest, Copyable) {
-  constexpr size_t kNumCircuits = 2;
-  constexpr size_t kNumAdvices = 3;
-  constexpr size_t kNumBlinds = 4;
-  constexpr size_t kNumChallenges = 2;
-  constexpr size_t kNumInstances = 2;
-
-  std::vector<std::vector<Evals>> advice_columns_vec =
-      base::CreateVector(kNumCircuits, []() {
-        return base::CreateVector(kNumAdvices,
-                                  []() { return Evals::Random(kMaxDegree); });
-      });
-  std::vector<std::vector<math::GF7>> advice_blinds_vec =
-      base::CreateVector(kNumCircuits, []() {
-        return base::CreateVector(kNumBlinds,
-                                  []() { return math::GF7::Random(); });
-      });
-  std::vector<math::GF7> challenges =
-      base::CreateVector(kNumChallenges, []() { return math::GF7::Random(); });
-  std::vector<std::vector<Evals>> instance_columns_vec =
-      base::CreateVector(kNumCircuits, []() {
-        return base::CreateVector(kNumInstances,
-                                  []() { return Evals::Random(kMaxDegree); });
-      });
-  std::vector<std::vector<Poly>> instance_polys_vec =
-      base::CreateVector(kNumCircuits, []() {
-        return base::CreateVector(kNumInstances,
-                                  []() { return Poly::Random(kMaxDegree); });
-      });
-
-  ArgumentData<Poly, Evals> expected(
-      std::move(advice_columns_vec), std::move(advice_blinds_vec),
-      std::move(challenges), std::move(instance_columns_vec),
-      std::move(instance_polys_vec));
+  ArgumentData<Poly, Evals> expected = CreateRandomArgumentData();
 
   base::Uint8VectorBuffer write_buf;
   ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
@@ -69,4 +73,21 @@ TEST_F(ArgumentDataTest, Copyable) {
   EXPECT_EQ(value, expected);
 }
 
+TEST_F(ArgumentDataTest, Checkpoint) {
+  ArgumentData<Poly, Evals> expected = CreateRandomArgumentData();
+  expected.DeallocateAllColumnsVec();
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(expected.EstimateCheckpointSize()));
+  ASSERT_TRUE(expected.WriteCheckpointTo(&write_buf));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  ArgumentData<Poly, Evals> value;
+  ASSERT_TRUE(value.ReadCheckpointFrom(write_buf));
+
+  EXPECT_EQ(value, expected);
+}
+
 }  // namespace tachyon::zk::plonk::halo2
@@ -8,6 +8,7 @@
 #define TACHYON_ZK_PLONK_HALO2_BLAKE2B_TRANSCRIPT_H_
 
 #include <stdint.h>
+#include <string.h>
 
 #include <utility>
 #include <vector>
@@ -15,6 +16,7 @@
 #include "absl/types/span.h"
 #include "openssl/blake2.h"
 
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/zk/plonk/halo2/constants.h"
 #include "tachyon/zk/plonk/halo2/prime_field_conversion.h"
@@ -40,18 +42,20 @@ class Blake2bBase {
   }
 
   bool DoWriteToTranscript(const AffinePoint& point) {
-    DoUpdate(kBlake2bPrefixPoint, 1);
-    if (point.IsZero()) {
-      DoUpdate(BaseField::BigIntTy::Zero().ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-      DoUpdate(typename BaseField::BigIntTy(5).ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-    } else {
-      DoUpdate(point.x().ToBigInt().ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-      DoUpdate(point.y().ToBigInt().ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
+    uint8_t bytes[kPointByteNums];
+    SerializePoint(point, bytes);
+    DoUpdate(bytes, kPointByteNums);
+    return true;
+  }
+
+  // Same as calling |DoWriteToTranscript()| for each of |points|, but all of
+  // them are serialized first and hashed by a single |DoUpdate()|.
+  bool DoWriteManyToTranscript(absl::Span<const AffinePoint> points) {
+    std::vector<uint8_t> bytes(points.size() * kPointByteNums);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points.size(); ++i) {
+      SerializePoint(points[i], &bytes[i * kPointByteNums]);
     }
+    DoUpdate(bytes.data(), bytes.size());
     return true;
   }
 
@@ -94,6 +98,28 @@ class Blake2bBase {
   }
 
   BLAKE2B_CTX state_;
+
+ private:
+  constexpr static size_t kPointByteNums =
+      1 + 2 * BaseField::BigIntTy::kByteNums;
+
+  // Writes the prefix and the coordinates of |point| to |bytes|, which are
+  // what is hashed for |point|.
+  static void SerializePoint(const AffinePoint& point, uint8_t* bytes) {
+    constexpr size_t kByteNums = BaseField::BigIntTy::kByteNums;
+
+    bytes[0] = kBlake2bPrefixPoint[0];
+    if (point.IsZero()) {
+      memcpy(&bytes[1], BaseField::BigIntTy::Zero().ToBytesLE().data(),
+             kByteNums);
+      memcpy(&bytes[1 + kByteNums],
+             typename BaseField::BigIntTy(5).ToBytesLE().data(), kByteNums);
+    } else {
+      memcpy(&bytes[1], point.x().ToBigInt().ToBytesLE().data(), kByteNums);
+      memcpy(&bytes[1 + kByteNums], point.y().ToBigInt().ToBytesLE().data(),
+             kByteNums);
+    }
+  }
 };
 
 }  // namespace internal
@@ -122,6 +148,10 @@ class Blake2bReader : public crypto::TranscriptReader<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool WriteManyToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoWriteManyToTranscript(points);
+  }
+
  private:
   bool DoReadFromProof(AffinePoint* point) const override {
     return ProofSerializer<AffinePoint>::ReadFromProof(this->buffer_, point);
@@ -158,6 +188,17 @@ class Blake2bWriter : public crypto::TranscriptWriter<AffinePoint>,
 
   void SetState(absl::Span<const uint8_t> state) { this->DoSetState(state); }
 
+  // crypto::TranscriptWriterBase methods
+  bool SaveState(std::vector<uint8_t>* state) const override {
+    *state = this->DoGetState();
+    return true;
+  }
+
+  bool RestoreState(absl::Span<const uint8_t> state) override {
+    this->DoSetState(state);
+    return true;
+  }
+
   // crypto::TranscriptWriter methods
   ScalarField SqueezeChallenge() override { return this->DoSqueezeChallenge(); }
 
@@ -169,13 +210,19 @@ class Blake2bWriter : public crypto::TranscriptWriter<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool WriteManyToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoWriteManyToTranscript(points);
+  }
+
  private:
   bool DoWriteToProof(const AffinePoint& point) override {
-    return ProofSerializer<AffinePoint>::WriteToProof(point, this->buffer_);
+    return ProofSerializer<AffinePoint>::WriteToProof(point,
+                                                      this->GetProofBuffer());
   }
 
   bool DoWriteToProof(const ScalarField& scalar) override {
-    return ProofSerializer<ScalarField>::WriteToProof(scalar, this->buffer_);
+    return ProofSerializer<ScalarField>::WriteToProof(scalar,
+                                                      this->GetProofBuffer());
   }
 };
 
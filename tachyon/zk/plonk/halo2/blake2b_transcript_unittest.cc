@@ -54,6 +54,69 @@ TEST_F(Blake2bTranscriptTest, WriteScalar) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(Blake2bTranscriptTest, WriteManyPoints) {
+  std::vector<G1AffinePoint> points = {
+      G1AffinePoint::Random(), G1AffinePoint::Zero(), G1AffinePoint::Random()};
+
+  base::Uint8VectorBuffer write_buf;
+  Blake2bWriter<G1AffinePoint> writer(std::move(write_buf));
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(writer.WriteToProof(point));
+  }
+
+  base::Uint8VectorBuffer write_buf2;
+  Blake2bWriter<G1AffinePoint> writer2(std::move(write_buf2));
+  ASSERT_TRUE(writer2.WriteManyToProof(points));
+
+  EXPECT_EQ(writer.buffer().owned_buffer(), writer2.buffer().owned_buffer());
+  EXPECT_EQ(writer.SqueezeChallenge(), writer2.SqueezeChallenge());
+}
+
+TEST_F(Blake2bTranscriptTest, WriteToProofOutput) {
+  std::vector<G1AffinePoint> points = {G1AffinePoint::Random(),
+                                       G1AffinePoint::Random()};
+
+  base::Uint8VectorBuffer write_buf;
+  Blake2bWriter<G1AffinePoint> writer(std::move(write_buf));
+  ASSERT_TRUE(writer.WriteManyToProof(points));
+
+  base::Uint8VectorBuffer write_buf2;
+  Blake2bWriter<G1AffinePoint> writer2(std::move(write_buf2));
+  std::vector<uint8_t> output(writer.GetProofLen());
+  writer2.SetProofOutput(absl::MakeSpan(output));
+  ASSERT_TRUE(writer2.WriteManyToProof(points));
+  EXPECT_EQ(output, writer.buffer().owned_buffer());
+  EXPECT_TRUE(writer2.buffer().owned_buffer().empty());
+
+  // The output is full.
+  EXPECT_FALSE(writer2.WriteToProof(points[0]));
+}
+
+TEST_F(Blake2bTranscriptTest, FlushProof) {
+  std::vector<G1AffinePoint> points = {G1AffinePoint::Random(),
+                                       G1AffinePoint::Random()};
+
+  base::Uint8VectorBuffer write_buf;
+  Blake2bWriter<G1AffinePoint> writer(std::move(write_buf));
+  ASSERT_TRUE(writer.WriteManyToProof(points));
+
+  base::Uint8VectorBuffer write_buf2;
+  Blake2bWriter<G1AffinePoint> writer2(std::move(write_buf2));
+  std::vector<uint8_t> streamed;
+  writer2.set_proof_sink([&streamed](absl::Span<const uint8_t> segment) {
+    streamed.insert(streamed.end(), segment.begin(), segment.end());
+    return true;
+  });
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(writer2.WriteToProof(point));
+    ASSERT_TRUE(writer2.FlushProof());
+    EXPECT_TRUE(writer2.GetUnflushedProof().empty());
+  }
+  EXPECT_EQ(streamed, writer.buffer().owned_buffer());
+  EXPECT_EQ(writer2.GetProofLen(), streamed.size());
+  EXPECT_EQ(writer.SqueezeChallenge(), writer2.SqueezeChallenge());
+}
+
 TEST_F(Blake2bTranscriptTest, SqueezeChallenge) {
   base::Uint8VectorBuffer write_buf;
   Blake2bWriter<G1AffinePoint> writer(std::move(write_buf));
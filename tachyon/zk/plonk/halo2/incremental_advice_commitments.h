@@ -0,0 +1,178 @@
+#ifndef TACHYON_ZK_PLONK_HALO2_INCREMENTAL_ADVICE_COMMITMENTS_H_
+#define TACHYON_ZK_PLONK_HALO2_INCREMENTAL_ADVICE_COMMITMENTS_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/base/entities/prover_base.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+// |IncrementalAdviceCommitments| keeps the advice columns of the last proof
+// and their commitments, so that the advice columns of the next proof of the
+// same circuit are committed to by the rows that changed only. By the
+// additive homomorphism of the commitment,
+//   Commit(a') = Commit(a) + Σᵢ (a'ᵢ - aᵢ)·[Lᵢ(τ)]₁,
+// so the MSM runs over the changed rows instead of all of them. This suits
+// the circuits proved over and over with the witnesses that barely change,
+// e.g., a rollup whose state is updated by a few transactions.
+//
+// If more than 1 / |max_delta_ratio()| of the rows of a column changed, or the
+// column wasn't committed to before, it is committed to from scratch.
+//
+// NOTE: The advice columns are copied once more, and the cache must be used
+// with a single proving key and SRS. |Clear()| must be called otherwise.
+template <typename Evals, typename Commitment>
+class IncrementalAdviceCommitments {
+ public:
+  using F = typename Evals::Field;
+
+  constexpr static size_t kDefaultMaxDeltaRatio = 8;
+
+  IncrementalAdviceCommitments() = default;
+  explicit IncrementalAdviceCommitments(size_t max_delta_ratio)
+      : max_delta_ratio_(max_delta_ratio) {
+    CHECK_GT(max_delta_ratio_, size_t{0});
+  }
+
+  size_t max_delta_ratio() const { return max_delta_ratio_; }
+  // The number of the columns committed to by the changed rows and from
+  // scratch.
+  size_t num_delta_commits() const { return num_delta_commits_; }
+  size_t num_full_commits() const { return num_full_commits_; }
+
+  // Returns the last commitment of the advice column at |column_idx| of the
+  // circuit at |circuit_idx|, or null if it isn't committed to yet.
+  const Commitment* GetCommitment(size_t circuit_idx, size_t column_idx) const {
+    if (circuit_idx >= entries_.size()) return nullptr;
+    const std::vector<Entry>& entries = entries_[circuit_idx];
+    if (column_idx >= entries.size()) return nullptr;
+    const Entry& entry = entries[column_idx];
+    return entry.committed ? &entry.commitment : nullptr;
+  }
+
+  // Commits to the advice column |evals| at |column_idx| of the circuit at
+  // |circuit_idx| and writes it to the proof.
+  template <typename PCS>
+  void CommitAndWriteToProof(ProverBase<PCS>* prover, size_t circuit_idx,
+                             size_t column_idx, const Evals& evals) {
+    Entry& entry = GetEntry(circuit_idx, column_idx);
+    std::vector<size_t> rows;
+    std::vector<F> deltas;
+    if (FindDeltas(entry, evals, &rows, &deltas)) {
+      Commitment commitment;
+      CHECK(prover->pcs().UpdateLagrange(entry.commitment, rows, deltas,
+                                         &commitment));
+      entry.commitment = std::move(commitment);
+      ApplyDeltas(rows, deltas, &entry);
+    } else {
+      entry.commitment = prover->Commit(evals);
+      entry.evals = evals;
+      entry.committed = true;
+    }
+    CHECK(prover->GetWriter()->WriteToProof(entry.commitment));
+  }
+
+  // Same as above, but commits to |evals| at |index| of the batch
+  // commitments. The commitment is kept once
+  // |RetrieveAndWriteBatchCommitmentsToProof()| is called.
+  template <typename PCS>
+  void BatchCommitAt(ProverBase<PCS>* prover, size_t circuit_idx,
+                     size_t column_idx, const Evals& evals, size_t index) {
+    Entry& entry = GetEntry(circuit_idx, column_idx);
+    std::vector<size_t> rows;
+    std::vector<F> deltas;
+    if (FindDeltas(entry, evals, &rows, &deltas)) {
+      CHECK(prover->pcs().UpdateLagrange(entry.commitment, rows, deltas,
+                                         index));
+      ApplyDeltas(rows, deltas, &entry);
+    } else {
+      prover->BatchCommitAt(evals, index);
+      entry.evals = evals;
+    }
+    // The commitment isn't known until the batch commitments are retrieved.
+    entry.committed = false;
+    if (pending_.size() <= index) pending_.resize(index + 1);
+    pending_[index] = {circuit_idx, column_idx};
+  }
+
+  template <typename PCS>
+  void RetrieveAndWriteBatchCommitmentsToProof(ProverBase<PCS>* prover) {
+    std::vector<Commitment> commitments = prover->pcs().GetBatchCommitments();
+    CHECK(prover->GetWriter()->WriteManyToProof(commitments));
+    CHECK_EQ(commitments.size(), pending_.size());
+    for (size_t i = 0; i < commitments.size(); ++i) {
+      Entry& entry = GetEntry(pending_[i].first, pending_[i].second);
+      entry.commitment = std::move(commitments[i]);
+      entry.committed = true;
+    }
+    pending_.clear();
+  }
+
+  void Clear() {
+    entries_.clear();
+    pending_.clear();
+  }
+
+ private:
+  struct Entry {
+    Evals evals;
+    Commitment commitment;
+    bool committed = false;
+  };
+
+  Entry& GetEntry(size_t circuit_idx, size_t column_idx) {
+    if (entries_.size() <= circuit_idx) entries_.resize(circuit_idx + 1);
+    std::vector<Entry>& entries = entries_[circuit_idx];
+    if (entries.size() <= column_idx) entries.resize(column_idx + 1);
+    return entries[column_idx];
+  }
+
+  // Populates |rows| and |deltas| with the rows of |evals| that differ from
+  // the ones of |entry|. Returns false if |evals| should be committed to from
+  // scratch.
+  bool FindDeltas(const Entry& entry, const Evals& evals,
+                  std::vector<size_t>* rows, std::vector<F>* deltas) {
+    const std::vector<F>& prev = entry.evals.evaluations();
+    const std::vector<F>& next = evals.evaluations();
+    if (!entry.committed || prev.size() != next.size()) {
+      ++num_full_commits_;
+      return false;
+    }
+    size_t max_delta_size = next.size() / max_delta_ratio_;
+    for (size_t i = 0; i < next.size(); ++i) {
+      if (prev[i] == next[i]) continue;
+      if (rows->size() == max_delta_size) {
+        ++num_full_commits_;
+        return false;
+      }
+      rows->push_back(i);
+      deltas->push_back(next[i] - prev[i]);
+    }
+    ++num_delta_commits_;
+    return true;
+  }
+
+  static void ApplyDeltas(const std::vector<size_t>& rows,
+                          const std::vector<F>& deltas, Entry* entry) {
+    std::vector<F>& evals = entry->evals.evaluations();
+    for (size_t i = 0; i < rows.size(); ++i) {
+      evals[rows[i]] += deltas[i];
+    }
+  }
+
+  size_t max_delta_ratio_ = kDefaultMaxDeltaRatio;
+  size_t num_delta_commits_ = 0;
+  size_t num_full_commits_ = 0;
+  // |entries_[i][j]| is the advice column at j of the circuit at i.
+  std::vector<std::vector<Entry>> entries_;
+  // The circuit and the column indices of each of the batch commitments.
+  std::vector<std::pair<size_t, size_t>> pending_;
+};
+
+}  // namespace tachyon::zk::plonk::halo2
+
+#endif  // TACHYON_ZK_PLONK_HALO2_INCREMENTAL_ADVICE_COMMITMENTS_H_
@@ -0,0 +1,64 @@
+#include "tachyon/zk/plonk/halo2/incremental_advice_commitments.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/zk/plonk/halo2/bn254_shplonk_prover_test.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+namespace {
+
+class IncrementalAdviceCommitmentsTest : public BN254SHPlonkProverTest {
+ public:
+  using Cache = IncrementalAdviceCommitments<Evals, Commitment>;
+
+  // Commits to |evals_list| through |cache| in batch mode and checks that
+  // they are the same as the ones committed to from scratch.
+  void CommitAndCheck(Cache& cache, const std::vector<Evals>& evals_list) {
+    prover_->pcs().SetBatchMode(evals_list.size());
+    for (size_t i = 0; i < evals_list.size(); ++i) {
+      cache.BatchCommitAt(prover_.get(), 0, i, evals_list[i], i);
+    }
+    cache.RetrieveAndWriteBatchCommitmentsToProof(prover_.get());
+    for (size_t i = 0; i < evals_list.size(); ++i) {
+      const Commitment* commitment = cache.GetCommitment(0, i);
+      ASSERT_TRUE(commitment);
+      EXPECT_EQ(*commitment, prover_->Commit(evals_list[i]));
+    }
+  }
+};
+
+}  // namespace
+
+TEST_F(IncrementalAdviceCommitmentsTest, Commit) {
+  Cache cache;
+  EXPECT_FALSE(cache.GetCommitment(0, 0));
+
+  std::vector<Evals> evals_list = {
+      prover_->domain()->template Random<Evals>(),
+      prover_->domain()->template Random<Evals>(),
+  };
+  CommitAndCheck(cache, evals_list);
+  EXPECT_EQ(cache.num_full_commits(), size_t{2});
+  EXPECT_EQ(cache.num_delta_commits(), size_t{0});
+
+  // A few rows of the first column and all the rows of the second one change.
+  evals_list[0].at(3) = F::Random();
+  evals_list[0].at(7) = F::Random();
+  evals_list[1] = prover_->domain()->template Random<Evals>();
+  CommitAndCheck(cache, evals_list);
+  EXPECT_EQ(cache.num_full_commits(), size_t{3});
+  EXPECT_EQ(cache.num_delta_commits(), size_t{1});
+
+  // Nothing changes.
+  CommitAndCheck(cache, evals_list);
+  EXPECT_EQ(cache.num_full_commits(), size_t{3});
+  EXPECT_EQ(cache.num_delta_commits(), size_t{3});
+
+  cache.Clear();
+  EXPECT_FALSE(cache.GetCommitment(0, 0));
+}
+
+}  // namespace tachyon::zk::plonk::halo2
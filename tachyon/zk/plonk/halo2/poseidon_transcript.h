@@ -11,12 +11,16 @@
 
 #include <algorithm>
 #include <array>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "absl/types/span.h"
 
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/strings/string_util.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/bn254_halo2_poseidon_config.h"
 #include "tachyon/crypto/hashes/sponge/poseidon/poseidon.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/zk/plonk/halo2/prime_field_conversion.h"
@@ -33,24 +37,16 @@ class PoseidonBase {
   using Curve = typename AffinePoint::Curve;
   using CurveConfig = typename Curve::Config;
 
-  PoseidonBase()
-      : poseidon_(
-            // See
-            // https://github.com/kroma-network/halo2/blob/7d0a36990452c8e7ebd600de258420781a9b7917/halo2_proofs/src/transcript/poseidon.rs#L28.
-            crypto::PoseidonConfig<ScalarField>::CreateCustom(8, 5, 8, 63, 0)) {
+  PoseidonBase() : poseidon_(GetPoseidonConfig()) {
     // See
     // https://github.com/kroma-network/poseidon/blob/00a2fe049208860a5835b1f24d2a80105439b995/src/spec.rs#L15.
     poseidon_.state.elements[0] =
         FromUint128<ScalarField>(absl::uint128(1) << 64);
   }
 
-  ScalarField DoSqueezeChallenge() {
-    ScalarField scalar = DoSqueeze();
-    std::array<uint8_t, 32> scalar_bytes = scalar.ToBigInt().ToBytesLE();
-    uint8_t wide_scalar_bytes[64] = {0};
-    memcpy(wide_scalar_bytes, scalar_bytes.data(), 32);
-    return FromUint512<ScalarField>(wide_scalar_bytes);
-  }
+  // NOTE: Halo2 converts the squeezed scalar into its bytes and back with
+  // |FromUint512()|, which is an identity since the scalar is already reduced.
+  ScalarField DoSqueezeChallenge() { return DoSqueeze(); }
 
   bool DoWriteToTranscript(const AffinePoint& point) {
     ScalarField coords[] = {BaseToScalar(point.x()), BaseToScalar(point.y())};
@@ -63,6 +59,18 @@ class PoseidonBase {
     return true;
   }
 
+  // Same as calling |DoWriteToTranscript()| for each of |points|, but the
+  // coordinates of all of them are absorbed by a single |DoUpdate()|.
+  bool DoWriteManyToTranscript(absl::Span<const AffinePoint> points) {
+    std::vector<ScalarField> coords(points.size() * 2);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points.size(); ++i) {
+      coords[2 * i] = BaseToScalar(points[i].x());
+      coords[2 * i + 1] = BaseToScalar(points[i].y());
+    }
+    DoUpdate(coords.data(), coords.size());
+    return true;
+  }
+
   // See
   // https://github.com/kroma-network/poseidon/blob/00a2fe049208860a5835b1f24d2a80105439b995/src/poseidon.rs#L47-L69
   ScalarField DoSqueeze() {
@@ -137,9 +145,28 @@ class PoseidonBase {
   std::vector<ScalarField> absorbing_;
 
  private:
+  // NOTE: The round constants and the MDS matrix are generated once per
+  // process instead of per transcript, since it takes much longer than
+  // copying them. The ones of bn254 are generated at build time.
+  static const crypto::PoseidonConfig<ScalarField>& GetPoseidonConfig() {
+    // See
+    // https://github.com/kroma-network/halo2/blob/7d0a36990452c8e7ebd600de258420781a9b7917/halo2_proofs/src/transcript/poseidon.rs#L28.
+    if constexpr (std::is_same_v<ScalarField, math::bn254::Fr>) {
+      return crypto::GetBn254Halo2PoseidonConfig();
+    } else {
+      static const base::NoDestructor<crypto::PoseidonConfig<ScalarField>>
+          config(crypto::PoseidonConfig<ScalarField>::CreateCustom(8, 5, 8, 63,
+                                                                   0));
+      return *config;
+    }
+  }
+
   // See
   // https://github.com/kroma-network/halo2/blob/7d0a36990452c8e7ebd600de258420781a9b7917/halo2_proofs/src/helpers.rs#L37-L58.
-  ScalarField BaseToScalar(const BaseField& base) {
+  static ScalarField BaseToScalar(const BaseField& base) {
+    if constexpr (BaseField::N == 4) {
+      return FromUint256<ScalarField>(base.ToBigInt());
+    }
     constexpr size_t kByteNums = BaseField::BigIntTy::kByteNums;
 
     std::array<uint8_t, kByteNums> bytes = base.ToBigInt().ToBytesLE();
@@ -172,6 +199,10 @@ class PoseidonReader : public crypto::TranscriptReader<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool WriteManyToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoWriteManyToTranscript(points);
+  }
+
  private:
   bool DoReadFromProof(AffinePoint* point) const override {
     return ProofSerializer<AffinePoint>::ReadFromProof(this->buffer_, point);
@@ -211,6 +242,17 @@ class PoseidonWriter : public crypto::TranscriptWriter<AffinePoint>,
 
   void SetState(absl::Span<const uint8_t> state) { this->DoSetState(state); }
 
+  // crypto::TranscriptWriterBase methods
+  bool SaveState(std::vector<uint8_t>* state) const override {
+    *state = this->DoGetState();
+    return true;
+  }
+
+  bool RestoreState(absl::Span<const uint8_t> state) override {
+    this->DoSetState(state);
+    return true;
+  }
+
   // crypto::TranscriptWriter methods
   ScalarField SqueezeChallenge() override { return this->DoSqueezeChallenge(); }
 
@@ -222,13 +264,19 @@ class PoseidonWriter : public crypto::TranscriptWriter<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool WriteManyToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoWriteManyToTranscript(points);
+  }
+
  private:
   bool DoWriteToProof(const AffinePoint& point) override {
-    return ProofSerializer<AffinePoint>::WriteToProof(point, this->buffer_);
+    return ProofSerializer<AffinePoint>::WriteToProof(point,
+                                                      this->GetProofBuffer());
   }
 
   bool DoWriteToProof(const ScalarField& scalar) override {
-    return ProofSerializer<ScalarField>::WriteToProof(scalar, this->buffer_);
+    return ProofSerializer<ScalarField>::WriteToProof(scalar,
+                                                      this->GetProofBuffer());
   }
 };
 
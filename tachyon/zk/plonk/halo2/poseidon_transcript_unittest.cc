@@ -54,6 +54,24 @@ TEST_F(PoseidonTranscriptTest, WriteScalar) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(PoseidonTranscriptTest, WriteManyPoints) {
+  std::vector<G1AffinePoint> points = {
+      G1AffinePoint::Random(), G1AffinePoint::Zero(), G1AffinePoint::Random()};
+
+  base::Uint8VectorBuffer write_buf;
+  PoseidonWriter<G1AffinePoint> writer(std::move(write_buf));
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(writer.WriteToProof(point));
+  }
+
+  base::Uint8VectorBuffer write_buf2;
+  PoseidonWriter<G1AffinePoint> writer2(std::move(write_buf2));
+  ASSERT_TRUE(writer2.WriteManyToProof(points));
+
+  EXPECT_EQ(writer.buffer().owned_buffer(), writer2.buffer().owned_buffer());
+  EXPECT_EQ(writer.SqueezeChallenge(), writer2.SqueezeChallenge());
+}
+
 TEST_F(PoseidonTranscriptTest, SqueezeChallenge) {
   base::Uint8VectorBuffer write_buf;
   PoseidonWriter<G1AffinePoint> writer(std::move(write_buf));
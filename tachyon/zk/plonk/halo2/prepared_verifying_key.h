@@ -0,0 +1,82 @@
+#ifndef TACHYON_ZK_PLONK_HALO2_PREPARED_VERIFYING_KEY_H_
+#define TACHYON_ZK_PLONK_HALO2_PREPARED_VERIFYING_KEY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "tachyon/zk/base/rotation.h"
+#include "tachyon/zk/base/row_types.h"
+#include "tachyon/zk/plonk/keys/verifying_key.h"
+#include "tachyon/zk/plonk/permutation/permutation_verifier.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+// |PreparedVerifyingKey| holds the values of the verification that don't
+// depend on the proof, so that they are computed once for the proofs verified
+// against the same |VerifyingKey| on the same domain. The |VerifyingKey| isn't
+// copied and must outlive |this|.
+template <typename F, typename C>
+class PreparedVerifyingKey {
+ public:
+  using PermutationConstants = typename PermutationVerifier<F, C>::Constants;
+
+  template <typename Domain>
+  PreparedVerifyingKey(const VerifyingKey<F, C>& vkey, const Domain* domain)
+      : vkey_(&vkey), domain_size_(domain->size()) {
+    const ConstraintSystem<F>& constraint_system = vkey.constraint_system();
+    blinding_factors_ = constraint_system.ComputeBlindingFactors();
+    usable_rows_ = domain->size() - (blinding_factors_ + 1);
+
+    omega_ = domain->GetElement(Rotation::Next().value());
+    omega_inv_ = domain->GetElement(Rotation::Prev().value());
+    omega_last_ = domain->GetElement(constraint_system.ComputeLastRow());
+
+    for (const InstanceQueryData& query :
+         constraint_system.instance_queries()) {
+      int32_t rotation = query.rotation().value();
+      if (rotation < min_instance_rotation_) {
+        min_instance_rotation_ = rotation;
+      } else if (rotation > max_instance_rotation_) {
+        max_instance_rotation_ = rotation;
+      }
+    }
+
+    permutation_constants_ = PermutationConstants::Create(constraint_system);
+  }
+
+  const VerifyingKey<F, C>& vkey() const { return *vkey_; }
+  size_t domain_size() const { return domain_size_; }
+  RowIndex blinding_factors() const { return blinding_factors_; }
+  RowIndex usable_rows() const { return usable_rows_; }
+  const F& omega() const { return omega_; }
+  const F& omega_inv() const { return omega_inv_; }
+  const F& omega_last() const { return omega_last_; }
+  int32_t min_instance_rotation() const { return min_instance_rotation_; }
+  int32_t max_instance_rotation() const { return max_instance_rotation_; }
+  const PermutationConstants& permutation_constants() const {
+    return permutation_constants_;
+  }
+
+ private:
+  const VerifyingKey<F, C>* vkey_;
+  size_t domain_size_;
+  RowIndex blinding_factors_;
+  RowIndex usable_rows_;
+  // x_next = ω * x
+  F omega_;
+  // x_prev = ω⁻¹ * x
+  F omega_inv_;
+  // x_last = ω^(-(blinding_factors + 1)) * x
+  F omega_last_;
+  // The range of the rotations of the instance queries, which bounds the
+  // Lagrange coefficients of the instance evaluations.
+  int32_t min_instance_rotation_ = 0;
+  int32_t max_instance_rotation_ = 0;
+  PermutationConstants permutation_constants_;
+};
+
+}  // namespace tachyon::zk::plonk::halo2
+
+#endif  // TACHYON_ZK_PLONK_HALO2_PREPARED_VERIFYING_KEY_H_
@@ -50,6 +50,22 @@ static F FromUint512(uint64_t limbs[8]) {
   return F::FromMontgomery(d2) + F::FromMontgomery(d3);
 }
 
+// Returns |value| mod p, where p is the modulus of |F|. This is the same as
+// |FromUint512()| of |value| zero-extended to 512 bits, but it takes a few
+// conditional subtractions instead of the Montgomery multiplications, e.g,
+// just one for a coordinate of BN254 G1, whose base field modulus is less than
+// twice the scalar field modulus.
+template <typename F>
+static F FromUint256(math::BigInt<4> value) {
+  if constexpr (F::N != 4) {
+    static_assert(base::AlwaysFalse<F>);
+  }
+  while (value >= F::Config::kModulus) {
+    value.SubInPlace(F::Config::kModulus);
+  }
+  return F(value);
+}
+
 template <typename F>
 static F FromUint512(uint8_t bytes[64]) {
   base::ReadOnlyBuffer buffer(bytes, 64);
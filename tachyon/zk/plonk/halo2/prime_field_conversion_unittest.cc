@@ -50,4 +50,20 @@ TEST_F(PrimeFieldConversionTest, FromUint512) {
   EXPECT_EQ(FromUint512<F>(bytes64), expected);
 }
 
+TEST_F(PrimeFieldConversionTest, FromUint256) {
+  math::BigInt<4> values[] = {
+      math::BigInt<4>(0),
+      F::Config::kModulus,
+      math::BigInt<4>::Max(),
+      math::BigInt<4>::Random(),
+  };
+  for (const math::BigInt<4>& value : values) {
+    uint64_t limbs8[8] = {0};
+    for (size_t i = 0; i < 4; ++i) {
+      limbs8[i] = value[i];
+    }
+    EXPECT_EQ(FromUint256<F>(value), FromUint512<F>(limbs8));
+  }
+}
+
 }  // namespace tachyon::zk::plonk::halo2
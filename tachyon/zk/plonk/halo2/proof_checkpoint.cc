@@ -0,0 +1,118 @@
+#include "tachyon/zk/plonk/halo2/proof_checkpoint.h"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+namespace {
+
+// "TPCK" in the little endian.
+constexpr uint32_t kMagic = 0x4b435054;
+constexpr uint32_t kVersion = 1;
+
+}  // namespace
+
+ProofCheckpoint::ProofCheckpoint(const base::FilePath& path) : path_(path) {}
+
+ProofCheckpoint::~ProofCheckpoint() {
+  if (file_.IsValid()) {
+    file_.Close();
+    base::DeleteFile(GetTemporaryPath());
+  }
+}
+
+bool ProofCheckpoint::Begin() {
+  if (!base::CreateDirectory(path_.DirName())) {
+    LOG(ERROR) << "Failed to create " << path_.DirName().value();
+    return false;
+  }
+  base::FilePath temporary_path = GetTemporaryPath();
+  file_ = base::File(temporary_path,
+                     base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
+  if (!file_.IsValid()) {
+    LOG(ERROR) << "Failed to open " << temporary_path.value() << ": "
+               << base::File::ErrorToString(file_.error_details());
+    return false;
+  }
+  return Write(kMagic) && Write(kVersion);
+}
+
+bool ProofCheckpoint::Commit() {
+  // NOTE: The checkpoint is synced before it replaces the current one, so that
+  // the current one is never replaced with a partially written one.
+  bool flushed = file_.Flush();
+  file_.Close();
+  base::FilePath temporary_path = GetTemporaryPath();
+  if (!flushed) {
+    LOG(ERROR) << "Failed to flush " << temporary_path.value();
+    base::DeleteFile(temporary_path);
+    return false;
+  }
+  base::File::Error error;
+  if (!base::ReplaceFile(temporary_path, path_, &error)) {
+    LOG(ERROR) << "Failed to replace " << path_.value() << ": "
+               << base::File::ErrorToString(error);
+    base::DeleteFile(temporary_path);
+    return false;
+  }
+  return true;
+}
+
+bool ProofCheckpoint::Load() {
+  Unload();
+  if (!base::PathExists(path_)) return false;
+  std::optional<std::vector<uint8_t>> bytes = base::ReadFileToBytes(path_);
+  if (!bytes.has_value()) {
+    LOG(ERROR) << "Failed to read " << path_.value();
+    return false;
+  }
+  bytes_ = std::move(bytes).value();
+  buffer_ = base::ReadOnlyBuffer(bytes_.data(), bytes_.size());
+  uint32_t magic;
+  uint32_t version;
+  if (!buffer_.ReadMany(&magic, &version) || magic != kMagic ||
+      version != kVersion) {
+    LOG(ERROR) << path_.value() << " is not a checkpoint of version "
+               << kVersion;
+    Unload();
+    return false;
+  }
+  return true;
+}
+
+void ProofCheckpoint::Unload() {
+  buffer_ = base::ReadOnlyBuffer();
+  bytes_ = std::vector<uint8_t>();
+}
+
+bool ProofCheckpoint::Remove() {
+  Unload();
+  return base::DeleteFile(path_);
+}
+
+bool ProofCheckpoint::WriteBytes(absl::Span<const uint8_t> bytes) {
+  // NOTE: |base::File::WriteAtCurrentPos()| takes the size as an int.
+  constexpr size_t kMaxChunkSize = std::numeric_limits<int>::max();
+  while (!bytes.empty()) {
+    int size = static_cast<int>(std::min(bytes.size(), kMaxChunkSize));
+    if (file_.WriteAtCurrentPos(reinterpret_cast<const char*>(bytes.data()),
+                                size) != size) {
+      LOG(ERROR) << "Failed to write " << GetTemporaryPath().value();
+      return false;
+    }
+    bytes.remove_prefix(size);
+  }
+  return true;
+}
+
+base::FilePath ProofCheckpoint::GetTemporaryPath() const {
+  return base::FilePath(path_.value() + ".tmp");
+}
+
+}  // namespace tachyon::zk::plonk::halo2
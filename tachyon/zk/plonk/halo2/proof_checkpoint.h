@@ -0,0 +1,98 @@
+#ifndef TACHYON_ZK_PLONK_HALO2_PROOF_CHECKPOINT_H_
+#define TACHYON_ZK_PLONK_HALO2_PROOF_CHECKPOINT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/buffer/read_only_buffer.h"
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/export.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+// The phases of |Prover::CreateProof()| at the end of which its state is saved
+// to a |ProofCheckpoint|.
+enum class ProofPhase : uint32_t {
+  // The circuits are synthesized and theta is about to be squeezed.
+  kSynthesized = 1,
+  // h(X) is committed and x is about to be squeezed.
+  kQuotientCommitted = 2,
+};
+
+// |ProofCheckpoint| keeps the state of a long-running |Prover::CreateProof()|
+// in a file on a fast local storage, so that a proof interrupted, e.g., by a
+// preemption of the node, resumes from the latest phase instead of from
+// scratch. The state is written in the binary format of |base::Copyable|,
+// value by value, to a temporary file next to the checkpoint, which then
+// replaces the checkpoint. So a checkpoint interrupted while being written
+// leaves the previous one intact.
+//
+// NOTE: The checkpoint only holds for the machine it is written on, since the
+// values are written in the native endian.
+class TACHYON_EXPORT ProofCheckpoint {
+ public:
+  explicit ProofCheckpoint(const base::FilePath& path);
+  ProofCheckpoint(const ProofCheckpoint& other) = delete;
+  ProofCheckpoint& operator=(const ProofCheckpoint& other) = delete;
+  ~ProofCheckpoint();
+
+  const base::FilePath& path() const { return path_; }
+
+  // Returns the checkpoint read by |Load()|.
+  const base::ReadOnlyBuffer& buffer() const { return buffer_; }
+
+  // Starts to write a new checkpoint, which replaces the current one once
+  // |Commit()| succeeds.
+  [[nodiscard]] bool Begin();
+
+  // Writes |value| with its |base::Copyable|.
+  template <typename T>
+  [[nodiscard]] bool Write(const T& value) {
+    return WriteWith(base::EstimateSize(value), [&value](base::Buffer* buffer) {
+      return buffer->Write(value);
+    });
+  }
+
+  // Writes what |write(buffer)| writes to |buffer|, which is of |size| bytes.
+  template <typename Callback>
+  [[nodiscard]] bool WriteWith(size_t size, Callback write) {
+    base::Uint8VectorBuffer buffer;
+    if (!buffer.Grow(size)) return false;
+    if (!write(&buffer)) return false;
+    return WriteBytes(absl::Span<const uint8_t>(buffer.owned_buffer().data(),
+                                                buffer.buffer_offset()));
+  }
+
+  [[nodiscard]] bool Commit();
+
+  // Reads the checkpoint into |buffer()|, which is positioned after the
+  // header. Returns false if there is none or it is of another version.
+  [[nodiscard]] bool Load();
+
+  // Releases the checkpoint read by |Load()|.
+  void Unload();
+
+  // Deletes the checkpoint, which is called once the proof is created.
+  bool Remove();
+
+ private:
+  bool WriteBytes(absl::Span<const uint8_t> bytes);
+
+  base::FilePath GetTemporaryPath() const;
+
+  base::FilePath path_;
+  base::File file_;
+  std::vector<uint8_t> bytes_;
+  base::ReadOnlyBuffer buffer_;
+};
+
+}  // namespace tachyon::zk::plonk::halo2
+
+#endif  // TACHYON_ZK_PLONK_HALO2_PROOF_CHECKPOINT_H_
@@ -0,0 +1,71 @@
+#include "tachyon/zk/plonk/halo2/proof_checkpoint.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+namespace {
+
+class ProofCheckpointTest : public testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().Append("checkpoints/proof.ckpt");
+  }
+
+ protected:
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+};
+
+}  // namespace
+
+TEST_F(ProofCheckpointTest, SaveAndLoad) {
+  ProofCheckpoint checkpoint(path_);
+  EXPECT_FALSE(checkpoint.Load());
+
+  std::vector<uint8_t> bytes = {1, 2, 3};
+  ASSERT_TRUE(checkpoint.Begin());
+  ASSERT_TRUE(checkpoint.Write(ProofPhase::kSynthesized));
+  ASSERT_TRUE(checkpoint.Write(bytes));
+  ASSERT_TRUE(checkpoint.Commit());
+
+  // A checkpoint that isn't committed doesn't replace the current one.
+  ASSERT_TRUE(checkpoint.Begin());
+  ASSERT_TRUE(checkpoint.Write(ProofPhase::kQuotientCommitted));
+
+  ProofCheckpoint checkpoint2(path_);
+  ASSERT_TRUE(checkpoint2.Load());
+  ProofPhase phase;
+  std::vector<uint8_t> bytes2;
+  ASSERT_TRUE(checkpoint2.buffer().ReadMany(&phase, &bytes2));
+  EXPECT_TRUE(checkpoint2.buffer().Done());
+  EXPECT_EQ(phase, ProofPhase::kSynthesized);
+  EXPECT_EQ(bytes2, bytes);
+
+  ASSERT_TRUE(checkpoint.Write(bytes));
+  ASSERT_TRUE(checkpoint.Commit());
+  ASSERT_TRUE(checkpoint2.Load());
+  ASSERT_TRUE(checkpoint2.buffer().Read(&phase));
+  EXPECT_EQ(phase, ProofPhase::kQuotientCommitted);
+
+  EXPECT_TRUE(checkpoint2.Remove());
+  EXPECT_FALSE(base::PathExists(path_));
+  EXPECT_FALSE(checkpoint.Load());
+}
+
+TEST_F(ProofCheckpointTest, LoadMalformed) {
+  ASSERT_TRUE(base::CreateDirectory(path_.DirName()));
+  ASSERT_TRUE(base::WriteFile(path_, std::string("not a checkpoint")));
+
+  ProofCheckpoint checkpoint(path_);
+  EXPECT_FALSE(checkpoint.Load());
+}
+
+}  // namespace tachyon::zk::plonk::halo2
@@ -7,14 +7,22 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_PROVER_H_
 #define TACHYON_ZK_PLONK_HALO2_PROVER_H_
 
+#include <future>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/threading/thread_pool.h"
+#include "tachyon/base/time/trace_recorder.h"
 #include "tachyon/base/types/always_false.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/base/scoped_proof_metrics.h"
 #include "tachyon/zk/plonk/halo2/argument_data.h"
 #include "tachyon/zk/plonk/halo2/c_prover_impl_base_forward.h"
+#include "tachyon/zk/plonk/halo2/incremental_advice_commitments.h"
+#include "tachyon/zk/plonk/halo2/proof_checkpoint.h"
+#include "tachyon/zk/plonk/halo2/prover_memory_budget.h"
 #include "tachyon/zk/plonk/halo2/random_field_generator.h"
 #include "tachyon/zk/plonk/halo2/verifier.h"
 #include "tachyon/zk/plonk/permutation/permutation_prover.h"
@@ -65,6 +73,71 @@ class Prover : public ProverBase<PCS> {
   crypto::XORShiftRNG* rng() { return rng_.get(); }
   RandomFieldGenerator<F>* generator() { return generator_.get(); }
 
+  // See |VanishingProver::set_streaming_quotient()|.
+  void set_streaming_quotient(bool streaming_quotient) {
+    streaming_quotient_ = streaming_quotient;
+  }
+
+  // If true, the lookup tables that don't contain any witness are indexed
+  // once per proving key instead of once per proof. This applies to
+  // |lookup::Type::kLogDerivativeHalo2| only. See |lookup::TableIndexCache|.
+  void set_cache_lookup_tables(bool cache_lookup_tables) {
+    cache_lookup_tables_ = cache_lookup_tables;
+  }
+
+  // If true, |CreateProof()| keeps the fixed columns of the proving key instead
+  // of releasing them once they are interpolated, so that proving doesn't
+  // modify the proving key and it can be shared by several provers proving
+  // concurrently. This must not be used together with
+  // |set_cache_lookup_tables()|, which fills the proving key while proving.
+  void set_keep_fixed_columns(bool keep_fixed_columns) {
+    keep_fixed_columns_ = keep_fixed_columns;
+  }
+
+  // If true, the batch commitments are computed on another thread while the
+  // prover works on what doesn't depend on them, e.g, the grand product polys
+  // of the permutation are committed while the ones of the lookups are
+  // created. The PCS must be safe to commit while the domains are used.
+  void set_async_commit(bool async_commit) { async_commit_ = async_commit; }
+
+  // If not null, |CreateProof()| records the time and the memory usage of each
+  // of its phases to |trace_recorder|. |trace_recorder| must outlive |this|.
+  void set_trace_recorder(base::TraceRecorder* trace_recorder) {
+    trace_recorder_ = trace_recorder;
+  }
+
+  // If not null, |CreateProof()| spills the intermediates that aren't used
+  // for a while to the scratch file of |memory_budget| if they exceed its
+  // budget, and reads them back once they are used again. See
+  // |ProverMemoryBudget|. |memory_budget| must outlive |this|.
+  void set_memory_budget(ProverMemoryBudget* memory_budget) {
+    memory_budget_ = memory_budget;
+  }
+
+  // If not null, |CreateProof()| saves its state to |checkpoint| at the end of
+  // each |ProofPhase| and resumes from the latest one if |checkpoint| holds
+  // the state of a proof of the same verifying key, which is removed once the
+  // proof is created. |checkpoint| must outlive |this|.
+  //
+  // To resume, the prover must be created the same way as the one that saved
+  // the state, with a transcript that supports
+  // |crypto::TranscriptWriterBase::SaveState()|, and |CreateProof()| must be
+  // called with the same instance columns and circuits, which aren't
+  // synthesized again.
+  // NOTE: The proof flushed to the proof sink before the state is saved isn't
+  // flushed again, so the sink must keep what it has received until then.
+  void set_checkpoint(ProofCheckpoint* checkpoint) { checkpoint_ = checkpoint; }
+
+  // If not null, |CreateProof()| commits to the advice columns by the rows
+  // that changed since the last proof of |incremental_commitments|. See
+  // |IncrementalAdviceCommitments|. |incremental_commitments| must outlive
+  // |this|.
+  void set_incremental_commitments(
+      IncrementalAdviceCommitments<Evals, Commitment>*
+          incremental_commitments) {
+    incremental_commitments_ = incremental_commitments;
+  }
+
   Verifier<PCS, LS> ToVerifier(
       std::unique_ptr<crypto::TranscriptReader<Commitment>> reader) {
     Verifier<PCS, LS> ret(std::move(this->pcs_), std::move(reader));
@@ -77,6 +150,7 @@ class Prover : public ProverBase<PCS> {
   void CreateProof(ProvingKey<LS>& proving_key,
                    std::vector<std::vector<Evals>>&& instance_columns_vec,
                    std::vector<Circuit>& circuits) {
+    ScopedProofMetrics proof_metrics("halo2");
     size_t num_circuits = circuits.size();
 
     // Check length of instances.
@@ -87,6 +161,8 @@ class Prover : public ProverBase<PCS> {
                                          .num_instance_columns());
     }
 
+    if (checkpoint_ && ResumeProof(proving_key)) return;
+
     // Initially write hash value of verification key to transcript.
     crypto::TranscriptWriter<Commitment>* writer = this->GetWriter();
     CHECK(writer->WriteToTranscript(
@@ -94,9 +170,16 @@ class Prover : public ProverBase<PCS> {
 
     // It owns all the columns, polys and the others required in the proof
     // generation process and provides step-by-step logics as its methods.
+    std::optional<base::ScopedTraceEvent> synthesize_event;
+    synthesize_event.emplace(trace_recorder_, "Synthesize");
     ArgumentData<Poly, Evals> argument_data = ArgumentData<Poly, Evals>::Create(
         this, circuits, proving_key.verifying_key().constraint_system(),
-        std::move(instance_columns_vec));
+        std::move(instance_columns_vec), incremental_commitments_);
+    synthesize_event.reset();
+    if (checkpoint_) {
+      SaveCheckpoint(ProofPhase::kSynthesized, proving_key, argument_data,
+                     [](ProofCheckpoint*) { return true; });
+    }
     CreateProof(proving_key, &argument_data);
   }
 
@@ -131,16 +214,23 @@ class Prover : public ProverBase<PCS> {
     VLOG(1) << "Halo2 Constraint System: "
             << proving_key.verifying_key().constraint_system().ToString();
 
+    base::ScopedTraceEvent proof_event(trace_recorder_, "CreateProof");
+    base::ScopedTracePhases phases(trace_recorder_);
+
     size_t num_circuits = argument_data->GetNumCircuits();
     std::vector<LookupProver> lookup_provers(num_circuits);
     std::vector<PermutationProver<Poly, Evals>> permutation_provers(
         num_circuits);
     VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals> vanishing_prover;
+    vanishing_prover.set_streaming_quotient(streaming_quotient_);
     const ConstraintSystem<F>& cs =
         proving_key.verifying_key().constraint_system();
     const Domain* domain = this->domain();
 
+    // NOTE: The proof written so far is flushed before every challenge is
+    // squeezed. See |TranscriptWriterBase::FlushProof()|.
     crypto::TranscriptWriter<Commitment>* writer = this->GetWriter();
+    CHECK(writer->FlushProof());
     F theta = writer->SqueezeChallenge();
     VLOG(2) << "Halo2(theta): " << theta.ToHexString(true);
 
@@ -149,20 +239,29 @@ class Prover : public ProverBase<PCS> {
 
     size_t commit_idx = 0;
     if constexpr (LS::type == lookup::Type::kHalo2) {
+      phases.Begin("CompressPairs");
       LookupProver::BatchCompressPairs(lookup_provers, domain, cs.lookups(),
                                        theta, column_tables);
+      phases.Begin("PermutePairs");
       LookupProver::BatchPermutePairs(lookup_provers, this);
 
+      phases.Begin("CommitPermutedPairs");
       if constexpr (PCS::kSupportsBatchMode) {
         this->pcs_.SetBatchMode(
             LookupProver::GetNumPermutedPairsCommitments(lookup_provers));
       }
       LookupProver::BatchCommitPermutedPairs(lookup_provers, this, commit_idx);
     } else if constexpr (LS::type == lookup::Type::kLogDerivativeHalo2) {
+      phases.Begin("CompressPairs");
       LookupProver::BatchCompressPairs(lookup_provers, domain, cs.lookups(),
                                        theta, column_tables);
-      LookupProver::BatchComputeMPolys(lookup_provers, this);
+      phases.Begin("ComputeMPolys");
+      LookupProver::BatchComputeMPolys(
+          lookup_provers, this, cs.lookups(),
+          cache_lookup_tables_ ? &proving_key.lookup_table_index_cache()
+                               : nullptr);
 
+      phases.Begin("CommitMPolys");
       if constexpr (PCS::kSupportsBatchMode) {
         this->pcs_.SetBatchMode(
             LookupProver::GetNumMPolysCommitments(lookup_provers));
@@ -176,15 +275,33 @@ class Prover : public ProverBase<PCS> {
       this->RetrieveAndWriteBatchCommitmentsToProof();
     }
 
+    CHECK(writer->FlushProof());
     F beta = writer->SqueezeChallenge();
     VLOG(2) << "Halo2(beta): " << beta.ToHexString(true);
     F gamma = writer->SqueezeChallenge();
     VLOG(2) << "Halo2(gamma): " << gamma.ToHexString(true);
 
+    phases.Begin("CreateGrandProductPolys");
     PermutationProver<Poly, Evals>::BatchCreateGrandProductPolys(
         permutation_provers, this, cs.permutation(), column_tables,
         cs.ComputeDegree(), proving_key.permutation_proving_key(), beta, gamma);
 
+    // NOTE: The grand product polys of the permutation are committed while
+    // the ones of the lookups are created, and the latter are committed while
+    // the advice columns are interpolated, if |async_commit_| is set. See
+    // |LaunchCommit()|.
+    if constexpr (PCS::kSupportsBatchMode) {
+      this->pcs_.SetBatchMode(
+          PermutationProver<Poly, Evals>::GetNumGrandProductPolysCommitments(
+              permutation_provers));
+    }
+    std::future<void> commit_future =
+        LaunchCommit([this, &permutation_provers]() {
+          size_t commit_idx = 0;
+          PermutationProver<Poly, Evals>::BatchCommitGrandProductPolys(
+              permutation_provers, this, commit_idx);
+        });
+
     if constexpr (LS::type == lookup::Type::kHalo2) {
       LookupProver::BatchCreateGrandProductPolys(lookup_provers, this, beta,
                                                  gamma);
@@ -196,7 +313,11 @@ class Prover : public ProverBase<PCS> {
 
     vanishing_prover.CreateRandomPoly(this);
 
+    phases.Begin("CommitGrandProductPolys");
+    WaitCommit(commit_future);
     if constexpr (PCS::kSupportsBatchMode) {
+      this->RetrieveAndWriteBatchCommitmentsToProof();
+
       size_t num_lookup_poly;
       if constexpr (LS::type == lookup::Type::kHalo2) {
         num_lookup_poly =
@@ -208,48 +329,67 @@ class Prover : public ProverBase<PCS> {
         static_assert(base::AlwaysFalse<LS>);
       }
       this->pcs_.SetBatchMode(
-          PermutationProver<Poly, Evals>::GetNumGrandProductPolysCommitments(
-              permutation_provers) +
           num_lookup_poly +
           VanishingProver<Poly, Evals, ExtendedPoly,
                           ExtendedEvals>::GetNumRandomPolyCommitment());
     }
-    commit_idx = 0;
-    PermutationProver<Poly, Evals>::BatchCommitGrandProductPolys(
-        permutation_provers, this, commit_idx);
-    if constexpr (LS::type == lookup::Type::kHalo2) {
-      LookupProver::BatchCommitGrandProductPolys(lookup_provers, this,
-                                                 commit_idx);
-    } else if constexpr (LS::type == lookup::Type::kLogDerivativeHalo2) {
-      LookupProver::BatchCommitGrandSumPolys(lookup_provers, this, commit_idx);
-    } else {
-      static_assert(base::AlwaysFalse<LS>);
-    }
-    vanishing_prover.CommitRandomPoly(this, commit_idx);
+    commit_future = LaunchCommit([this, &lookup_provers, &vanishing_prover]() {
+      size_t commit_idx = 0;
+      if constexpr (LS::type == lookup::Type::kHalo2) {
+        LookupProver::BatchCommitGrandProductPolys(lookup_provers, this,
+                                                   commit_idx);
+      } else if constexpr (LS::type == lookup::Type::kLogDerivativeHalo2) {
+        LookupProver::BatchCommitGrandSumPolys(lookup_provers, this,
+                                               commit_idx);
+      } else {
+        static_assert(base::AlwaysFalse<LS>);
+      }
+      vanishing_prover.CommitRandomPoly(this, commit_idx);
+    });
+
+    // The advice columns don't depend on y, so they are interpolated before
+    // it is squeezed.
+    phases.Begin("TransformEvalsToPoly");
+    argument_data->TransformEvalsToPoly(domain);
+
+    WaitCommit(commit_future);
     if constexpr (PCS::kSupportsBatchMode) {
       this->RetrieveAndWriteBatchCommitmentsToProof();
     }
 
+    CHECK(writer->FlushProof());
     F y = writer->SqueezeChallenge();
     VLOG(2) << "Halo2(y): " << y.ToHexString(true);
 
-    argument_data->TransformEvalsToPoly(domain);
     PermutationProver<Poly, Evals>::TransformEvalsToPoly(permutation_provers,
                                                          domain);
     LookupProver::TransformEvalsToPoly(lookup_provers, domain);
 
     argument_data->DeallocateAllColumnsVec();
-    proving_key.fixed_columns().clear();
+    if (!keep_fixed_columns_) proving_key.ReleaseFixedColumns();
     column_tables.clear();
 
     std::vector<MultiPhaseRefTable<Poly>> poly_tables =
         argument_data->ExportPolyTables(proving_key.fixed_polys());
 
+    phases.Begin("CreateHEvals");
     vanishing_prover.CreateHEvals(this, proving_key, poly_tables, theta, beta,
                                   gamma, y, permutation_provers,
                                   lookup_provers);
+    poly_tables.clear();
+
+    // NOTE: The rest of the arguments aren't used until x is squeezed, while
+    // the quotient is finalized on the extended domain, which is where the
+    // memory of the proof peaks.
+    SpilledIntermediates spilled;
+    if (memory_budget_) {
+      SpillIntermediates(argument_data, permutation_provers, lookup_provers,
+                         vanishing_prover, spilled);
+    }
+    phases.Begin("CreateFinalHPoly");
     vanishing_prover.CreateFinalHPoly(this, cs);
 
+    phases.Begin("CommitFinalHPoly");
     if constexpr (PCS::kSupportsBatchMode) {
       this->pcs_.SetBatchMode(
           VanishingProver<Poly, Evals, ExtendedPoly,
@@ -260,7 +400,39 @@ class Prover : public ProverBase<PCS> {
     if constexpr (PCS::kSupportsBatchMode) {
       this->RetrieveAndWriteBatchCommitmentsToProof();
     }
+    if (memory_budget_) {
+      RestoreIntermediates(spilled, argument_data, permutation_provers,
+                           lookup_provers);
+    }
+
+    if (checkpoint_) {
+      SaveCheckpoint(ProofPhase::kQuotientCommitted, proving_key,
+                     *argument_data, [&](ProofCheckpoint* checkpoint) {
+                       return checkpoint->Write(permutation_provers) &&
+                              checkpoint->Write(lookup_provers) &&
+                              checkpoint->Write(vanishing_prover);
+                     });
+    }
+    OpenProof(proving_key, *argument_data, vanishing_prover,
+              permutation_provers, lookup_provers, phases);
+  }
+
+  // Squeezes x and creates the rest of the proof, which is what
+  // |CreateProof()| does after h(X) is committed.
+  void OpenProof(
+      const ProvingKey<LS>& proving_key,
+      const ArgumentData<Poly, Evals>& argument_data,
+      VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals>&
+          vanishing_prover,
+      const std::vector<PermutationProver<Poly, Evals>>& permutation_provers,
+      const std::vector<LookupProver>& lookup_provers,
+      base::ScopedTracePhases& phases) {
+    const Domain* domain = this->domain();
+    std::vector<MultiPhaseRefTable<Poly>> poly_tables =
+        argument_data.ExportPolyTables(proving_key.fixed_polys());
 
+    crypto::TranscriptWriter<Commitment>* writer = this->GetWriter();
+    CHECK(writer->FlushProof());
     F x = writer->SqueezeChallenge();
     VLOG(2) << "Halo2(x): " << x.ToHexString(true);
     F x_prev = Rotation::Prev().RotateOmega(domain, x);
@@ -272,15 +444,231 @@ class Prover : public ProverBase<PCS> {
                                                                 x_last);
     lookup::halo2::OpeningPointSet<F> lookup_opening_point_set(x, x_prev,
                                                                x_next);
+    phases.Begin("Evaluate");
     Evaluate(proving_key, poly_tables, vanishing_prover, permutation_provers,
              lookup_provers, permutation_opening_point_set,
              lookup_opening_point_set);
 
+    phases.Begin("Open");
     std::vector<crypto::PolynomialOpening<Poly>> openings =
         Open(proving_key, poly_tables, vanishing_prover, permutation_provers,
              lookup_provers, permutation_opening_point_set,
              lookup_opening_point_set);
-    CHECK(this->pcs_.CreateOpeningProof(openings, this->GetWriter()));
+    phases.Begin("CreateOpeningProof");
+    CHECK(this->pcs_.CreateOpeningProof(openings, writer));
+    CHECK(writer->FlushProof());
+    if (checkpoint_) checkpoint_->Remove();
+  }
+
+  // Saves the state of the proof at the end of |phase| to |checkpoint_|,
+  // followed by |argument_data| and what |write_phase_state(checkpoint_)|
+  // writes. The proof goes on even if it fails.
+  template <typename Callback>
+  void SaveCheckpoint(ProofPhase phase, const ProvingKey<LS>& proving_key,
+                      const ArgumentData<Poly, Evals>& argument_data,
+                      Callback write_phase_state) {
+    base::ScopedTraceEvent event(trace_recorder_, "SaveCheckpoint");
+    crypto::TranscriptWriter<Commitment>* writer = this->GetWriter();
+    std::vector<uint8_t> transcript_state;
+    if (!writer->SaveState(&transcript_state)) {
+      LOG(WARNING) << "The transcript doesn't support checkpoints";
+      return;
+    }
+    absl::Span<const uint8_t> unflushed_proof = writer->GetUnflushedProof();
+    size_t flushed_len = writer->GetProofLen() - unflushed_proof.size();
+    if (!checkpoint_->Begin() || !checkpoint_->Write(phase) ||
+        !checkpoint_->Write(proving_key.verifying_key().transcript_repr()) ||
+        !checkpoint_->Write(*rng_) || !checkpoint_->Write(transcript_state) ||
+        !checkpoint_->Write(flushed_len) ||
+        !checkpoint_->Write(std::vector<uint8_t>(unflushed_proof.begin(),
+                                                 unflushed_proof.end())) ||
+        !checkpoint_->WriteWith(argument_data.EstimateCheckpointSize(),
+                                [&argument_data](base::Buffer* buffer) {
+                                  return argument_data.WriteCheckpointTo(
+                                      buffer);
+                                }) ||
+        !write_phase_state(checkpoint_) || !checkpoint_->Commit()) {
+      LOG(WARNING) << "Failed to save the checkpoint to "
+                   << checkpoint_->path().value();
+    }
+  }
+
+  // Resumes the proof from |checkpoint_| if it holds the state of a proof of
+  // |proving_key|. Returns false if the proof has to start from scratch, in
+  // which case nothing is changed.
+  bool ResumeProof(ProvingKey<LS>& proving_key) {
+    crypto::TranscriptWriter<Commitment>* writer = this->GetWriter();
+    if (writer->GetProofLen() != 0 || !checkpoint_->Load()) return false;
+
+    const base::ReadOnlyBuffer& buffer = checkpoint_->buffer();
+    ProofPhase phase;
+    F transcript_repr;
+    crypto::XORShiftRNG rng;
+    std::vector<uint8_t> transcript_state;
+    size_t flushed_len;
+    std::vector<uint8_t> unflushed_proof;
+    if (!buffer.ReadMany(&phase, &transcript_repr, &rng, &transcript_state,
+                         &flushed_len, &unflushed_proof)) {
+      LOG(ERROR) << "Failed to read the checkpoint "
+                 << checkpoint_->path().value();
+      checkpoint_->Unload();
+      return false;
+    }
+    if (transcript_repr != proving_key.verifying_key().transcript_repr()) {
+      LOG(WARNING) << "Ignoring the checkpoint of another verifying key";
+      checkpoint_->Unload();
+      return false;
+    }
+
+    ArgumentData<Poly, Evals> argument_data;
+    std::vector<PermutationProver<Poly, Evals>> permutation_provers;
+    std::vector<LookupProver> lookup_provers;
+    VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals> vanishing_prover;
+    bool read = argument_data.ReadCheckpointFrom(buffer);
+    if (phase == ProofPhase::kQuotientCommitted) {
+      read = read && buffer.ReadMany(&permutation_provers, &lookup_provers,
+                                     &vanishing_prover);
+    } else if (phase != ProofPhase::kSynthesized) {
+      read = false;
+    }
+    checkpoint_->Unload();
+    if (!read) {
+      LOG(ERROR) << "Failed to read the checkpoint "
+                 << checkpoint_->path().value();
+      return false;
+    }
+    if (!writer->RestoreState(transcript_state)) {
+      LOG(WARNING) << "The transcript doesn't support checkpoints";
+      return false;
+    }
+    CHECK(writer->RestoreProof(unflushed_proof, flushed_len));
+    SetRng(std::make_unique<crypto::XORShiftRNG>(rng));
+    VLOG(1) << "Resuming the proof from " << checkpoint_->path().value();
+
+    if (phase == ProofPhase::kSynthesized) {
+      CreateProof(proving_key, &argument_data);
+    } else {
+      base::ScopedTraceEvent proof_event(trace_recorder_, "CreateProof");
+      base::ScopedTracePhases phases(trace_recorder_);
+      if (!keep_fixed_columns_) proving_key.ReleaseFixedColumns();
+      OpenProof(proving_key, argument_data, vanishing_prover,
+                permutation_provers, lookup_provers, phases);
+    }
+    return true;
+  }
+
+  // The slots of the intermediates spilled by |SpillIntermediates()|, which
+  // are empty for the ones kept in memory.
+  struct SpilledIntermediates {
+    ProverMemoryBudget::Slot argument_data;
+    ProverMemoryBudget::Slot lookup_provers;
+    ProverMemoryBudget::Slot permutation_provers;
+  };
+
+  // Spills the intermediates to |memory_budget_| while the memory of them and
+  // |vanishing_prover| exceeds its budget. They are spilled in the order of
+  // their usual sizes, i.e., the advice and instance polys first, then the
+  // permuted columns and the grand product polys of the lookups, and then the
+  // grand product polys of the permutation. A value that fails to be spilled
+  // is kept in memory.
+  void SpillIntermediates(
+      ArgumentData<Poly, Evals>* argument_data,
+      std::vector<PermutationProver<Poly, Evals>>& permutation_provers,
+      std::vector<LookupProver>& lookup_provers,
+      const VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals>&
+          vanishing_prover,
+      SpilledIntermediates& spilled) {
+    base::ScopedTraceEvent event(trace_recorder_, "SpillIntermediates");
+    size_t argument_data_size = argument_data->EstimateCheckpointSize();
+    size_t lookup_provers_size = base::EstimateSize(lookup_provers);
+    size_t permutation_provers_size = base::EstimateSize(permutation_provers);
+    size_t size = argument_data_size + lookup_provers_size +
+                  permutation_provers_size +
+                  base::EstimateSize(vanishing_prover);
+    size_t budget = memory_budget_->budget();
+
+    if (size > budget &&
+        memory_budget_->SpillWith(
+            argument_data_size,
+            [argument_data](base::Buffer* buffer) {
+              return argument_data->WriteCheckpointTo(buffer);
+            },
+            &spilled.argument_data)) {
+      *argument_data = ArgumentData<Poly, Evals>();
+      size -= argument_data_size;
+    }
+    if (size > budget &&
+        memory_budget_->Spill(lookup_provers, &spilled.lookup_provers)) {
+      lookup_provers = std::vector<LookupProver>();
+      size -= lookup_provers_size;
+    }
+    if (size > budget && memory_budget_->Spill(permutation_provers,
+                                               &spilled.permutation_provers)) {
+      permutation_provers = std::vector<PermutationProver<Poly, Evals>>();
+      size -= permutation_provers_size;
+    }
+    if (size > budget) {
+      LOG(WARNING) << "The intermediates of " << size
+                   << " bytes exceed the memory budget of " << budget
+                   << " bytes";
+    }
+    VLOG(1) << "Spilled the intermediates: "
+            << memory_budget_->metrics().ToString();
+  }
+
+  // Reads the intermediates spilled by |SpillIntermediates()| back.
+  void RestoreIntermediates(
+      const SpilledIntermediates& spilled,
+      ArgumentData<Poly, Evals>* argument_data,
+      std::vector<PermutationProver<Poly, Evals>>& permutation_provers,
+      std::vector<LookupProver>& lookup_provers) {
+    base::ScopedTraceEvent event(trace_recorder_, "RestoreIntermediates");
+    if (!spilled.argument_data.IsEmpty()) {
+      CHECK(memory_budget_->RestoreWith(
+          spilled.argument_data,
+          [argument_data](const base::ReadOnlyBuffer& buffer) {
+            return argument_data->ReadCheckpointFrom(buffer);
+          }));
+    }
+    if (!spilled.lookup_provers.IsEmpty()) {
+      CHECK(memory_budget_->Restore(spilled.lookup_provers, &lookup_provers));
+    }
+    if (!spilled.permutation_provers.IsEmpty()) {
+      CHECK(memory_budget_->Restore(spilled.permutation_provers,
+                                    &permutation_provers));
+    }
+    if (!memory_budget_->Reset()) {
+      LOG(WARNING) << "Failed to truncate "
+                   << memory_budget_->scratch_path().value();
+    }
+  }
+
+  // Runs |commit| on another thread if |async_commit_| is set, or right away
+  // otherwise. |WaitCommit()| must be called with the returned future before
+  // the batch commitments are retrieved.
+  // NOTE: Only the batch commitments are launched on another thread, since
+  // the other commitments are written to the proof right away.
+  template <typename Callable>
+  std::future<void> LaunchCommit(Callable&& commit) {
+    if constexpr (PCS::kSupportsBatchMode) {
+      if (async_commit_) {
+        // NOTE: The commitment runs on the pool of the calling thread, so that
+        // it stays within the threads given to the prover.
+        base::ThreadPool* thread_pool = &base::ThreadPool::GetCurrent();
+        return std::async(
+            std::launch::async,
+            [thread_pool, commit = std::forward<Callable>(commit)]() mutable {
+              base::ScopedThreadPool scoped_thread_pool(thread_pool);
+              commit();
+            });
+      }
+    }
+    commit();
+    return std::future<void>();
+  }
+
+  static void WaitCommit(std::future<void>& commit_future) {
+    if (commit_future.valid()) commit_future.get();
   }
 
   void Evaluate(
@@ -354,6 +742,19 @@ class Prover : public ProverBase<PCS> {
 
   std::unique_ptr<crypto::XORShiftRNG> rng_;
   std::unique_ptr<RandomFieldGenerator<F>> generator_;
+  bool streaming_quotient_ = false;
+  bool cache_lookup_tables_ = false;
+  bool keep_fixed_columns_ = false;
+  bool async_commit_ = false;
+  // not owned
+  base::TraceRecorder* trace_recorder_ = nullptr;
+  // not owned
+  ProofCheckpoint* checkpoint_ = nullptr;
+  // not owned
+  ProverMemoryBudget* memory_budget_ = nullptr;
+  // not owned
+  IncrementalAdviceCommitments<Evals, Commitment>* incremental_commitments_ =
+      nullptr;
 };
 
 }  // namespace tachyon::zk::plonk::halo2
@@ -0,0 +1,115 @@
+#include "tachyon/zk/plonk/halo2/prover_memory_budget.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+std::string SpillMetrics::ToString() const {
+  return absl::Substitute(
+      "{num_spills: $0, spilled_bytes: $1, restored_bytes: $2, "
+      "peak_scratch_bytes: $3}",
+      num_spills, spilled_bytes, restored_bytes, peak_scratch_bytes);
+}
+
+ProverMemoryBudget::ProverMemoryBudget(size_t budget,
+                                       const base::FilePath& scratch_path)
+    : budget_(budget), scratch_path_(scratch_path) {}
+
+ProverMemoryBudget::~ProverMemoryBudget() {
+  if (file_.IsValid()) {
+    file_.Close();
+    base::DeleteFile(scratch_path_);
+  }
+}
+
+bool ProverMemoryBudget::Reset() {
+  if (!file_.IsValid()) return true;
+  scratch_size_ = 0;
+  return file_.SetLength(0);
+}
+
+bool ProverMemoryBudget::MapForWrite(size_t size, Slot* slot, uint8_t** data) {
+  if (size == 0) {
+    LOG(ERROR) << "Can't spill an empty value";
+    return false;
+  }
+  if (!file_.IsValid()) {
+    if (!base::CreateDirectory(scratch_path_.DirName())) {
+      LOG(ERROR) << "Failed to create " << scratch_path_.DirName().value();
+      return false;
+    }
+    file_ = base::File(scratch_path_, base::File::FLAG_CREATE_ALWAYS |
+                                          base::File::FLAG_READ |
+                                          base::File::FLAG_WRITE);
+    if (!file_.IsValid()) {
+      LOG(ERROR) << "Failed to open " << scratch_path_.value() << ": "
+                 << base::File::ErrorToString(file_.error_details());
+      return false;
+    }
+  }
+
+  size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t offset = base::bits::AlignUp(scratch_size_, page_size);
+  if (!file_.SetLength(static_cast<int64_t>(offset + size))) {
+    LOG(ERROR) << "Failed to grow " << scratch_path_.value() << " to "
+               << offset + size << " bytes";
+    return false;
+  }
+  void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      file_.GetPlatformFile(), static_cast<off_t>(offset));
+  if (mapped == MAP_FAILED) {
+    PLOG(ERROR) << "mmap";
+    file_.SetLength(static_cast<int64_t>(scratch_size_));
+    return false;
+  }
+
+  *slot = {offset, size};
+  *data = static_cast<uint8_t*>(mapped);
+  scratch_size_ = offset + size;
+  ++metrics_.num_spills;
+  metrics_.spilled_bytes += size;
+  metrics_.peak_scratch_bytes =
+      std::max(metrics_.peak_scratch_bytes, scratch_size_);
+  return true;
+}
+
+bool ProverMemoryBudget::MapForRead(const Slot& slot, const uint8_t** data) {
+  if (slot.IsEmpty() || slot.offset + slot.size > scratch_size_) {
+    LOG(ERROR) << "Invalid slot at " << slot.offset << " of " << slot.size
+               << " bytes";
+    return false;
+  }
+  void* mapped = mmap(nullptr, slot.size, PROT_READ, MAP_SHARED,
+                      file_.GetPlatformFile(), static_cast<off_t>(slot.offset));
+  if (mapped == MAP_FAILED) {
+    PLOG(ERROR) << "mmap";
+    return false;
+  }
+  // NOTE: The advice is only a hint, so the mapping is still usable if it
+  // fails.
+  if (madvise(mapped, slot.size, MADV_SEQUENTIAL) != 0) {
+    PLOG(WARNING) << "madvise";
+  }
+  *data = static_cast<const uint8_t*>(mapped);
+  metrics_.restored_bytes += slot.size;
+  return true;
+}
+
+bool ProverMemoryBudget::Unmap(const uint8_t* data, const Slot& slot) {
+  if (munmap(const_cast<uint8_t*>(data), slot.size) != 0) {
+    PLOG(ERROR) << "munmap";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tachyon::zk::plonk::halo2
@@ -0,0 +1,117 @@
+#ifndef TACHYON_ZK_PLONK_HALO2_PROVER_MEMORY_BUDGET_H_
+#define TACHYON_ZK_PLONK_HALO2_PROVER_MEMORY_BUDGET_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/buffer/read_only_buffer.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/export.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+// The amount of the intermediates spilled by a |ProverMemoryBudget|.
+struct SpillMetrics {
+  // The number of the values spilled to the scratch file.
+  size_t num_spills = 0;
+  // The bytes written to and read back from the scratch file.
+  size_t spilled_bytes = 0;
+  size_t restored_bytes = 0;
+  // The largest size of the scratch file.
+  size_t peak_scratch_bytes = 0;
+
+  std::string ToString() const;
+};
+
+// |ProverMemoryBudget| bounds the memory of the intermediates of
+// |Prover::CreateProof()|. The ones that are not used for a while are spilled
+// to a scratch file if they exceed |budget()| and read back once they are used
+// again. They are written in the binary format of |base::Copyable| straight to
+// a shared mapping of the scratch file, so the spill doesn't allocate a copy,
+// and the pages written are left to the kernel to write back and reclaim.
+//
+// NOTE: The scratch file is removed once |this| is destroyed and only holds
+// for the process, since the values are written in the native layout.
+class TACHYON_EXPORT ProverMemoryBudget {
+ public:
+  // A value spilled to the scratch file.
+  struct Slot {
+    // The offset aligned to the page size, which |mmap()| requires.
+    size_t offset = 0;
+    size_t size = 0;
+
+    bool IsEmpty() const { return size == 0; }
+  };
+
+  // |scratch_path| should be on a fast local storage and is created once a
+  // value is spilled.
+  ProverMemoryBudget(size_t budget, const base::FilePath& scratch_path);
+  ProverMemoryBudget(const ProverMemoryBudget& other) = delete;
+  ProverMemoryBudget& operator=(const ProverMemoryBudget& other) = delete;
+  ~ProverMemoryBudget();
+
+  size_t budget() const { return budget_; }
+  const base::FilePath& scratch_path() const { return scratch_path_; }
+  const SpillMetrics& metrics() const { return metrics_; }
+
+  // Writes |value| with its |base::Copyable| to the scratch file and populates
+  // |slot| with where it is written. The caller releases |value| afterwards.
+  template <typename T>
+  [[nodiscard]] bool Spill(const T& value, Slot* slot) {
+    return SpillWith(
+        base::EstimateSize(value),
+        [&value](base::Buffer* buffer) { return buffer->Write(value); }, slot);
+  }
+
+  // Writes what |write(buffer)| writes to |buffer|, which is of |size| bytes.
+  template <typename Callback>
+  [[nodiscard]] bool SpillWith(size_t size, Callback write, Slot* slot) {
+    uint8_t* data;
+    if (!MapForWrite(size, slot, &data)) return false;
+    base::Buffer buffer(data, size);
+    bool written = write(&buffer);
+    return Unmap(data, *slot) && written;
+  }
+
+  // Reads |value| back from |slot| populated by |Spill()|.
+  template <typename T>
+  [[nodiscard]] bool Restore(const Slot& slot, T* value) {
+    return RestoreWith(slot, [value](const base::ReadOnlyBuffer& buffer) {
+      return buffer.Read(value);
+    });
+  }
+
+  // Calls |read(buffer)| with the buffer of |slot| populated by |SpillWith()|.
+  template <typename Callback>
+  [[nodiscard]] bool RestoreWith(const Slot& slot, Callback read) {
+    const uint8_t* data;
+    if (!MapForRead(slot, &data)) return false;
+    base::ReadOnlyBuffer buffer(data, slot.size);
+    bool read_all = read(buffer);
+    return Unmap(data, slot) && read_all;
+  }
+
+  // Drops the values spilled so far, which is called once all of them are
+  // restored.
+  bool Reset();
+
+ private:
+  bool MapForWrite(size_t size, Slot* slot, uint8_t** data);
+  bool MapForRead(const Slot& slot, const uint8_t** data);
+  bool Unmap(const uint8_t* data, const Slot& slot);
+
+  size_t budget_;
+  base::FilePath scratch_path_;
+  base::File file_;
+  size_t scratch_size_ = 0;
+  SpillMetrics metrics_;
+};
+
+}  // namespace tachyon::zk::plonk::halo2
+
+#endif  // TACHYON_ZK_PLONK_HALO2_PROVER_MEMORY_BUDGET_H_
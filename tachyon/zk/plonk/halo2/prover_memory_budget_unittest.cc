@@ -0,0 +1,68 @@
+#include "tachyon/zk/plonk/halo2/prover_memory_budget.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+namespace {
+
+class ProverMemoryBudgetTest : public testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().Append("scratch/proof.spill");
+  }
+
+ protected:
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+};
+
+}  // namespace
+
+TEST_F(ProverMemoryBudgetTest, SpillAndRestore) {
+  std::vector<uint64_t> values(10000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = i * i;
+  }
+  std::vector<uint8_t> bytes = {1, 2, 3};
+
+  {
+    ProverMemoryBudget memory_budget(1024, path_);
+    EXPECT_EQ(memory_budget.budget(), size_t{1024});
+    EXPECT_FALSE(base::PathExists(path_));
+
+    ProverMemoryBudget::Slot values_slot;
+    ProverMemoryBudget::Slot bytes_slot;
+    ASSERT_TRUE(memory_budget.Spill(values, &values_slot));
+    ASSERT_TRUE(memory_budget.Spill(bytes, &bytes_slot));
+    EXPECT_TRUE(base::PathExists(path_));
+    EXPECT_EQ(values_slot.offset, size_t{0});
+    EXPECT_GT(bytes_slot.offset, values_slot.size - 1);
+
+    std::vector<uint8_t> bytes2;
+    ASSERT_TRUE(memory_budget.Restore(bytes_slot, &bytes2));
+    EXPECT_EQ(bytes2, bytes);
+    std::vector<uint64_t> values2;
+    ASSERT_TRUE(memory_budget.Restore(values_slot, &values2));
+    EXPECT_EQ(values2, values);
+
+    const SpillMetrics& metrics = memory_budget.metrics();
+    EXPECT_EQ(metrics.num_spills, size_t{2});
+    EXPECT_EQ(metrics.spilled_bytes, values_slot.size + bytes_slot.size);
+    EXPECT_EQ(metrics.restored_bytes, metrics.spilled_bytes);
+    EXPECT_EQ(metrics.peak_scratch_bytes, bytes_slot.offset + bytes_slot.size);
+
+    ASSERT_TRUE(memory_budget.Reset());
+    EXPECT_FALSE(memory_budget.Restore(values_slot, &values2));
+  }
+  // The scratch file is removed with the budget.
+  EXPECT_FALSE(base::PathExists(path_));
+}
+
+}  // namespace tachyon::zk::plonk::halo2
@@ -163,6 +163,17 @@ class Sha256Writer : public crypto::TranscriptWriter<AffinePoint>,
 
   void SetState(absl::Span<const uint8_t> state) { this->DoSetState(state); }
 
+  // crypto::TranscriptWriterBase methods
+  bool SaveState(std::vector<uint8_t>* state) const override {
+    *state = this->DoGetState();
+    return true;
+  }
+
+  bool RestoreState(absl::Span<const uint8_t> state) override {
+    this->DoSetState(state);
+    return true;
+  }
+
   // crypto::TranscriptWriter methods
   ScalarField SqueezeChallenge() override { return this->DoSqueezeChallenge(); }
 
@@ -180,11 +191,12 @@ class Sha256Writer : public crypto::TranscriptWriter<AffinePoint>,
     // https://github.com/kroma-network/halo2-snark-aggregator/blob/2637b512397b255525782006439a9cedde5b79b8/halo2-snark-aggregator-api/src/transcript/sha.rs#L156-L173.
     math::BigInt<4> x = point.x().ToBigInt();
     math::BigInt<4> y = point.y().ToBigInt();
-    return this->buffer_.WriteMany(x, y);
+    return this->GetProofBuffer().WriteMany(x, y);
   }
 
   bool DoWriteToProof(const ScalarField& scalar) override {
-    return ProofSerializer<ScalarField>::WriteToProof(scalar, this->buffer_);
+    return ProofSerializer<ScalarField>::WriteToProof(scalar,
+                                                      this->GetProofBuffer());
   }
 
   SHA256_CTX state_;
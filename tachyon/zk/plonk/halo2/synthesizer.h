@@ -7,12 +7,15 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_SYNTHESIZER_H_
 #define TACHYON_ZK_PLONK_HALO2_SYNTHESIZER_H_
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/plonk/constraint_system/constraint_system.h"
+#include "tachyon/zk/plonk/halo2/incremental_advice_commitments.h"
 #include "tachyon/zk/plonk/halo2/witness_collection.h"
 
 namespace tachyon::zk::plonk::halo2 {
@@ -36,12 +39,15 @@ class Synthesizer {
     }
   }
 
-  // Synthesize circuit and store advice columns.
-  template <typename PCS, typename Circuit,
-            typename RationalEvals = typename PCS::RationalEvals>
+  // Synthesize circuit and store advice columns. If |incremental_commitments|
+  // is not null, the advice columns are committed to through it. See
+  // |IncrementalAdviceCommitments|.
+  template <typename PCS, typename Circuit>
   void GenerateAdviceColumns(
       ProverBase<PCS>* prover, std::vector<Circuit>& circuits,
-      const std::vector<std::vector<Evals>>& instance_columns_vec) {
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      IncrementalAdviceCommitments<Evals, typename PCS::Commitment>*
+          incremental_commitments = nullptr) {
     VLOG(2) << "Generating advice columns";
     CHECK_EQ(num_circuits_, circuits.size());
 
@@ -60,41 +66,93 @@ class Synthesizer {
         prover->pcs().SetBatchMode(current_phase_column_indices.size() *
                                    num_circuits_);
       }
-      for (size_t i = 0; i < num_circuits_; ++i) {
-        std::vector<RationalEvals> rational_advice_columns =
-            GenerateRationalAdvices(prover, current_phase,
-                                    instance_columns_vec[i], circuits[i],
-                                    config);
-
-        // Parse only indices related to the |current_phase|.
-        const std::vector<Phase>& advice_phases =
-            constraint_system_->advice_column_phases();
-        for (size_t j = 0; j < rational_advice_columns.size(); ++j) {
-          if (current_phase != advice_phases[j]) continue;
-          const RationalEvals& column = rational_advice_columns[j];
-          std::vector<F> evaluated(column.NumElements());
-          CHECK(math::RationalField<F>::BatchEvaluate(column.evaluations(),
-                                                      &evaluated));
-          // Add blinding factors to advice columns
-          evaluated[prover->pcs().N() - 1] = F::One();
-
-          Evals evaluated_evals(std::move(evaluated));
-          if constexpr (PCS::kSupportsBatchMode) {
-            prover->BatchCommitAt(evaluated_evals, write_idx++);
-          } else {
-            prover->CommitAndWriteToProof(evaluated_evals);
+      // NOTE: The circuits are synthesized in parallel, at most as many at a
+      // time as the number of threads to bound the memory held by the
+      // pending rational values. Committing and blinding them stays in the
+      // order of the circuits so that the proof doesn't depend on the
+      // scheduling.
+      const std::vector<Phase>& advice_phases =
+          constraint_system_->advice_column_phases();
+      size_t batch_size = std::min(GetNumThreads(), num_circuits_);
+      std::vector<InPlaceWitnessCollection<Evals>> witnesses(batch_size);
+      for (size_t batch_start = 0; batch_start < num_circuits_;
+           batch_start += batch_size) {
+        size_t batch_end = std::min(batch_start + batch_size, num_circuits_);
+        OPENMP_PARALLEL_FOR(size_t i = batch_start; i < batch_end; ++i) {
+          // The advice columns of the |current_phase| are allocated here, so
+          // that the witness is written into them without an intermediate
+          // copy.
+          std::vector<Evals>& advice_columns = advice_columns_vec_[i];
+          for (size_t j = 0; j < advice_columns.size(); ++j) {
+            if (current_phase != advice_phases[j]) continue;
+            advice_columns[j] = prover->domain()->template Zero<Evals>();
+          }
+          witnesses[i - batch_start] =
+              GenerateAdvices(prover, current_phase, instance_columns_vec[i],
+                              circuits[i], config, &advice_columns);
+        }
+
+        for (size_t i = batch_start; i < batch_end; ++i) {
+          InPlaceWitnessCollection<Evals>& witness =
+              witnesses[i - batch_start];
+          size_t num_pending_values = witness.num_pending_values();
+          size_t num_skipped_inversions = 0;
+          CHECK(witness.EvaluatePendingValues(&num_skipped_inversions));
+          VLOG(2) << "Skipped " << num_skipped_inversions << " of "
+                  << num_pending_values
+                  << " inversions of the pending rational advice values";
+          num_pending_values_ += num_pending_values;
+          num_skipped_inversions_ += num_skipped_inversions;
+
+          std::vector<Evals>& advice_columns = advice_columns_vec_[i];
+          // Parse only indices related to the |current_phase|.
+          for (size_t j = 0; j < advice_columns.size(); ++j) {
+            if (current_phase != advice_phases[j]) continue;
+            Evals& evaluated_evals = advice_columns[j];
+            // Add blinding factors to advice columns
+            evaluated_evals.at(prover->pcs().N() - 1) = F::One();
+
+            if constexpr (PCS::kSupportsBatchMode) {
+              if (incremental_commitments) {
+                incremental_commitments->BatchCommitAt(prover, i, j,
+                                                       evaluated_evals,
+                                                       write_idx++);
+              } else {
+                prover->BatchCommitAt(evaluated_evals, write_idx++);
+              }
+            } else {
+              if (incremental_commitments) {
+                incremental_commitments->CommitAndWriteToProof(
+                    prover, i, j, evaluated_evals);
+              } else {
+                prover->CommitAndWriteToProof(evaluated_evals);
+              }
+            }
+            SetAdviceBlind(i, j, prover->blinder().Generate());
           }
-          SetAdviceColumn(i, j, std::move(evaluated_evals),
-                          prover->blinder().Generate());
         }
       }
       if constexpr (PCS::kSupportsBatchMode) {
-        prover->RetrieveAndWriteBatchCommitmentsToProof();
+        if (incremental_commitments) {
+          incremental_commitments->RetrieveAndWriteBatchCommitmentsToProof(
+              prover);
+        } else {
+          prover->RetrieveAndWriteBatchCommitmentsToProof();
+        }
       }
       UpdateChallenges(prover, current_phase);
     }
   }
 
+  // Returns the number of the advice values assigned so far whose
+  // denominators weren't one, or which were assigned to a cell that had such
+  // a value. They are evaluated after the synthesis of each phase.
+  size_t num_pending_values() const { return num_pending_values_; }
+
+  // Returns the number of the inversions skipped by the evaluations of the
+  // pending rational advice values so far, since their denominators were one.
+  size_t num_skipped_inversions() const { return num_skipped_inversions_; }
+
   // Return |challenges_| as a vector.
   std::vector<F> ExportChallenges() {
     return base::Map(
@@ -118,35 +176,42 @@ class Synthesizer {
   };
 
  private:
-  void SetAdviceColumn(size_t circuit_idx, size_t column_idx, Evals&& column,
-                       F&& blind) {
+  void SetAdviceBlind(size_t circuit_idx, size_t column_idx, F&& blind) {
     CHECK_LT(circuit_idx, num_circuits_);
     CHECK_LT(column_idx, constraint_system_->num_advice_columns());
-    advice_columns_vec_[circuit_idx][column_idx] = std::move(column);
     advice_blinds_vec_[circuit_idx][column_idx] = std::move(blind);
   }
 
-  // Performs synthesis for a specific |circuit| and a specific |phase|, and
-  // returns a vector of |RationalEvals|.
-  template <typename PCS, typename Circuit,
-            typename RationalEvals = typename PCS::RationalEvals>
-  std::vector<RationalEvals> GenerateRationalAdvices(
+  static size_t GetNumThreads() {
+#if defined(TACHYON_HAS_OPENMP)
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+  }
+
+  // Performs synthesis for a specific |circuit| and a specific |phase|, which
+  // writes the columns of |phase| of |advice_columns| allocated by the
+  // caller, and returns the witness holding the values yet to be evaluated.
+  // This may be called concurrently for different circuits.
+  template <typename PCS, typename Circuit>
+  InPlaceWitnessCollection<Evals> GenerateAdvices(
       ProverBase<PCS>* prover, Phase phase,
       const std::vector<Evals>& instance_columns, const Circuit& circuit,
-      const typename Circuit::Config& config) {
+      const typename Circuit::Config& config,
+      std::vector<Evals>* advice_columns) {
     // The prover will not be allowed to assign values to advice
     // cells that exist within inactive rows, which include some
     // number of blinding factors and an extra row for use in the
     // permutation argument.
-    WitnessCollection<Evals, RationalEvals> witness(
-        prover->domain(), constraint_system_->num_advice_columns(),
-        prover->GetUsableRows(), phase, challenges_, instance_columns);
+    InPlaceWitnessCollection<Evals> witness(advice_columns,
+                                            prover->GetUsableRows(), phase,
+                                            &challenges_, &instance_columns);
 
     typename Circuit::FloorPlanner floor_planner;
     floor_planner.Synthesize(&witness, circuit, config.Clone(),
                              constraint_system_->constants());
-
-    return std::move(witness).TakeAdvices();
+    return witness;
   }
 
   template <typename PCS>
@@ -170,6 +235,8 @@ class Synthesizer {
   absl::btree_map<size_t, F> challenges_;
   std::vector<std::vector<Evals>> advice_columns_vec_;
   std::vector<std::vector<F>> advice_blinds_vec_;
+  size_t num_pending_values_ = 0;
+  size_t num_skipped_inversions_ = 0;
 };
 
 }  // namespace tachyon::zk::plonk::halo2
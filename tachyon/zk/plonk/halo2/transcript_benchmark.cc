@@ -0,0 +1,57 @@
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/zk/plonk/halo2/blake2b_transcript.h"
+#include "tachyon/zk/plonk/halo2/poseidon_transcript.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+using Point = math::bn254::G1AffinePoint;
+
+// Each iteration writes |state.range(0)| commitments to a fresh transcript,
+// which is what |ProverBase::RetrieveAndWriteBatchCommitmentsToProof()| does.
+
+template <typename Writer>
+void BM_WriteToProof(benchmark::State& state) {
+  math::bn254::G1Curve::Init();
+  std::vector<Point> points =
+      base::CreateVector(state.range(0), []() { return Point::Random(); });
+  for (auto _ : state) {
+    Writer writer((base::Uint8VectorBuffer()));
+    for (const Point& point : points) {
+      CHECK(writer.WriteToProof(point));
+    }
+    benchmark::DoNotOptimize(writer.SqueezeChallenge());
+  }
+}
+
+template <typename Writer>
+void BM_WriteManyToProof(benchmark::State& state) {
+  math::bn254::G1Curve::Init();
+  std::vector<Point> points =
+      base::CreateVector(state.range(0), []() { return Point::Random(); });
+  for (auto _ : state) {
+    Writer writer((base::Uint8VectorBuffer()));
+    CHECK(writer.WriteManyToProof(points));
+    benchmark::DoNotOptimize(writer.SqueezeChallenge());
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_WriteToProof, Blake2bWriter<Point>)
+    ->RangeMultiplier(4)
+    ->Range(4, 256);
+BENCHMARK_TEMPLATE(BM_WriteManyToProof, Blake2bWriter<Point>)
+    ->RangeMultiplier(4)
+    ->Range(4, 256);
+BENCHMARK_TEMPLATE(BM_WriteToProof, PoseidonWriter<Point>)
+    ->RangeMultiplier(4)
+    ->Range(4, 256);
+BENCHMARK_TEMPLATE(BM_WriteManyToProof, PoseidonWriter<Point>)
+    ->RangeMultiplier(4)
+    ->Range(4, 256);
+
+}  // namespace tachyon::zk::plonk::halo2
@@ -12,13 +12,16 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
+#include "tachyon/math/polynomials/univariate/lagrange_coefficients_cache.h"
 #include "tachyon/zk/base/entities/verifier_base.h"
 #include "tachyon/zk/lookup/halo2/opening_point_set.h"
 #include "tachyon/zk/lookup/halo2/utils.h"
+#include "tachyon/zk/plonk/halo2/prepared_verifying_key.h"
 #include "tachyon/zk/plonk/halo2/proof_reader.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
 #include "tachyon/zk/plonk/permutation/permutation_utils.h"
@@ -44,13 +47,91 @@ class Verifier : public VerifierBase<PCS> {
   using Opening = crypto::PolynomialOpening<Poly, Commitment>;
   using LookupVerifier = typename LS::Verifier;
   using Proof = typename LS::Proof;
+  using PreparedVerifyingKey = halo2::PreparedVerifyingKey<F, Commitment>;
 
   using VerifierBase<PCS>::VerifierBase;
 
+  // Returns the values of the verification against |vkey| that don't depend
+  // on the proof. Prepare it once when verifying many proofs against |vkey|.
+  PreparedVerifyingKey Prepare(const VerifyingKey<F, Commitment>& vkey) const {
+    return PreparedVerifyingKey(vkey, this->domain());
+  }
+
   [[nodiscard]] bool VerifyProof(
       const VerifyingKey<F, Commitment>& vkey,
       const std::vector<std::vector<Evals>>& instance_columns_vec) {
-    return VerifyProofForTesting(vkey, instance_columns_vec, nullptr, nullptr);
+    return VerifyProof(Prepare(vkey), instance_columns_vec);
+  }
+
+  [[nodiscard]] bool VerifyProof(
+      const PreparedVerifyingKey& pvk,
+      const std::vector<std::vector<Evals>>& instance_columns_vec) {
+    return VerifyProofForTesting(pvk, instance_columns_vec, nullptr, nullptr);
+  }
+
+  // Verifies the proof like |VerifyProof()| except for the pairing check of
+  // the opening proof, whose G1 points are populated to |pairing_points|
+  // instead. The pairing checks of many proofs, even the ones read by other
+  // verifiers, can then be run at once by |BatchVerifyPairingPoints()|.
+  template <typename T = PCS>
+  [[nodiscard]] bool VerifyProofWithoutPairing(
+      const VerifyingKey<F, Commitment>& vkey,
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      typename T::PairingPoints* pairing_points) {
+    return VerifyProofWithoutPairing<T>(Prepare(vkey), instance_columns_vec,
+                                        pairing_points);
+  }
+
+  template <typename T = PCS>
+  [[nodiscard]] bool VerifyProofWithoutPairing(
+      const PreparedVerifyingKey& pvk,
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      typename T::PairingPoints* pairing_points) {
+    return DoVerifyProof(
+        pvk, instance_columns_vec, nullptr, nullptr,
+        [this, pairing_points](const std::vector<Opening>& openings) {
+          return this->pcs_.ComputePairingPoints(openings, this->GetReader(),
+                                                 pairing_points);
+        });
+  }
+
+  // Finishes the proofs verified by |VerifyProofWithoutPairing()| with a
+  // single pairing. See |crypto::BatchCheckPairingPoints()|.
+  template <typename T = PCS>
+  [[nodiscard]] bool BatchVerifyPairingPoints(
+      absl::Span<const typename T::PairingPoints> pairing_points_vec) const {
+    return this->pcs_.BatchVerifyPairingPoints(pairing_points_vec);
+  }
+
+  // Same as |VerifyProofWithoutPairing()|, but for a PCS without a pairing,
+  // e.g., |IPAExtension|, whose final MSM is accumulated into |msm| instead.
+  template <typename T = PCS>
+  [[nodiscard]] bool VerifyProofWithoutMSM(
+      const VerifyingKey<F, Commitment>& vkey,
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      typename T::VerificationMSM* msm) {
+    return VerifyProofWithoutMSM<T>(Prepare(vkey), instance_columns_vec, msm);
+  }
+
+  template <typename T = PCS>
+  [[nodiscard]] bool VerifyProofWithoutMSM(
+      const PreparedVerifyingKey& pvk,
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      typename T::VerificationMSM* msm) {
+    return DoVerifyProof(
+        pvk, instance_columns_vec, nullptr, nullptr,
+        [this, msm](const std::vector<Opening>& openings) {
+          return this->pcs_.ComputeVerificationMSM(openings, this->GetReader(),
+                                                   msm);
+        });
+  }
+
+  // Finishes the proofs verified by |VerifyProofWithoutMSM()| with a single
+  // MSM. See |crypto::IPA::VerifyMSM()|.
+  template <typename T = PCS>
+  [[nodiscard]] bool BatchVerifyMSMs(
+      absl::Span<const typename T::VerificationMSM> msms) const {
+    return this->pcs_.VerifyMSM(msms);
   }
 
  private:
@@ -61,7 +142,35 @@ class Verifier : public VerifierBase<PCS> {
       const VerifyingKey<F, Commitment>& vkey,
       const std::vector<std::vector<Evals>>& instance_columns_vec,
       Proof* proof_out, F* expected_h_eval_out) {
-    if (!ValidateInstanceColumnsVec(vkey, instance_columns_vec)) return false;
+    return VerifyProofForTesting(Prepare(vkey), instance_columns_vec,
+                                 proof_out, expected_h_eval_out);
+  }
+
+  bool VerifyProofForTesting(
+      const PreparedVerifyingKey& pvk,
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      Proof* proof_out, F* expected_h_eval_out) {
+    return DoVerifyProof(
+        pvk, instance_columns_vec, proof_out, expected_h_eval_out,
+        [this](const std::vector<Opening>& openings) {
+          return this->pcs_.VerifyOpeningProof(openings, this->GetReader());
+        });
+  }
+
+  // |verify_openings| is called with the openings of the proof at last and
+  // should verify the opening proof against them.
+  template <typename VerifyOpenings>
+  bool DoVerifyProof(
+      const PreparedVerifyingKey& pvk,
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      Proof* proof_out, F* expected_h_eval_out,
+      VerifyOpenings&& verify_openings) {
+    if (pvk.domain_size() != this->domain()->size()) {
+      LOG(ERROR) << "The verifying key is prepared for another domain";
+      return false;
+    }
+    const VerifyingKey<F, Commitment>& vkey = pvk.vkey();
+    if (!ValidateInstanceColumnsVec(pvk, instance_columns_vec)) return false;
 
     std::vector<std::vector<Commitment>> instance_commitments_vec;
     if constexpr (PCS::kQueryInstance) {
@@ -97,7 +206,7 @@ class Verifier : public VerifierBase<PCS> {
     } else {
       proof_reader.ReadInstanceEvalsIfNoQueryInstance();
       proof.instance_evals_vec =
-          ComputeInstanceEvalsVec(vkey, instance_columns_vec, proof.x);
+          ComputeInstanceEvalsVec(pvk, instance_columns_vec, proof.x);
     }
     proof_reader.ReadAdviceEvals();
     proof_reader.ReadFixedEvals();
@@ -111,36 +220,38 @@ class Verifier : public VerifierBase<PCS> {
       *proof_out = proof;
     }
 
-    ComputeAuxValues(vkey.constraint_system(), proof);
+    ComputeAuxValues(pvk, proof);
 
-    return DoVerify(instance_commitments_vec, vkey, proof, expected_h_eval_out);
+    return DoVerify(instance_commitments_vec, pvk, proof, expected_h_eval_out,
+                    std::forward<VerifyOpenings>(verify_openings));
   }
 
-  void ComputeAuxValues(const ConstraintSystem<F>& constraint_system,
-                        Proof& proof) const {
-    RowIndex blinding_factors = constraint_system.ComputeBlindingFactors();
-    std::vector<F> l_evals = this->domain_->EvaluatePartialLagrangeCoefficients(
-        proof.x, base::Range<int32_t, /*IsStartInclusive=*/true,
-                             /*IsEndInclusive=*/true>(
-                     -static_cast<int32_t>(blinding_factors + 1), 0));
+  void ComputeAuxValues(const PreparedVerifyingKey& pvk, Proof& proof) const {
+    RowIndex blinding_factors = pvk.blinding_factors();
+    std::shared_ptr<const std::vector<F>> l_evals_ptr =
+        lagrange_coefficients_cache_.Get(
+            *this->domain_, proof.x,
+            base::Range<int32_t, /*IsStartInclusive=*/true,
+                        /*IsEndInclusive=*/true>(
+                -static_cast<int32_t>(blinding_factors + 1), 0));
+    const std::vector<F>& l_evals = *l_evals_ptr;
     proof.l_first = l_evals[1 + blinding_factors];
     proof.l_blind = std::accumulate(
         l_evals.begin() + 1, l_evals.begin() + 1 + blinding_factors, F::Zero(),
         [](F& acc, const F& eval) { return acc += eval; });
     proof.l_last = l_evals[0];
 
-    proof.x_next = Rotation::Next().RotateOmega(this->domain(), proof.x);
-    proof.x_prev = Rotation::Prev().RotateOmega(this->domain(), proof.x);
-    proof.x_last =
-        Rotation(-(blinding_factors + 1)).RotateOmega(this->domain(), proof.x);
+    proof.x_next = proof.x * pvk.omega();
+    proof.x_prev = proof.x * pvk.omega_inv();
+    proof.x_last = proof.x * pvk.omega_last();
     proof.x_n = proof.x.Pow(this->pcs_.N());
   }
 
   bool ValidateInstanceColumnsVec(
-      const VerifyingKey<F, Commitment>& vkey,
+      const PreparedVerifyingKey& pvk,
       const std::vector<std::vector<Evals>>& instance_columns_vec) const {
     size_t num_instance_columns =
-        vkey.constraint_system().num_instance_columns();
+        pvk.vkey().constraint_system().num_instance_columns();
     auto check_num_instance_columns =
         [num_instance_columns](const std::vector<Evals>& instance_columns) {
           if (instance_columns.size() != num_instance_columns) {
@@ -151,8 +262,7 @@ class Verifier : public VerifierBase<PCS> {
           return true;
         };
 
-    RowIndex usable_rows =
-        this->GetUsableRows(vkey.constraint_system().ComputeBlindingFactors());
+    RowIndex usable_rows = pvk.usable_rows();
     auto check_rows = [usable_rows](const Evals& instance_columns) {
       if (instance_columns.NumElements() > size_t{usable_rows}) {
         LOG(ERROR) << "Too many number of elements in instance column";
@@ -245,26 +355,12 @@ class Verifier : public VerifierBase<PCS> {
   }
 
   std::vector<std::vector<F>> ComputeInstanceEvalsVec(
-      const VerifyingKey<F, Commitment>& vkey,
+      const PreparedVerifyingKey& pvk,
       const std::vector<std::vector<Evals>>& instance_columns_vec, const F& x) {
-    struct RotationRange {
-      int32_t min = 0;
-      int32_t max = 0;
-    };
-
     const std::vector<InstanceQueryData>& instance_queries =
-        vkey.constraint_system().instance_queries();
-    RotationRange range = std::accumulate(
-        instance_queries.begin(), instance_queries.end(), RotationRange(),
-        [](RotationRange& range, const InstanceQueryData& instance) {
-          int32_t rotation_value = instance.rotation().value();
-          if (rotation_value < range.min) {
-            range.min = rotation_value;
-          } else if (rotation_value > range.max) {
-            range.max = rotation_value;
-          }
-          return range;
-        });
+        pvk.vkey().constraint_system().instance_queries();
+    int32_t min_rotation = pvk.min_instance_rotation();
+    int32_t max_rotation = pvk.max_instance_rotation();
 
     std::vector<RowIndex> max_instances_rows =
         base::Map(instance_columns_vec, &ComputeMaxRow);
@@ -273,24 +369,28 @@ class Verifier : public VerifierBase<PCS> {
     RowIndex max_instances_row =
         max_instances_row_it != max_instances_rows.end() ? *max_instances_row_it
                                                          : 0;
-    std::vector<F> partial_lagrange_coeffs =
-        this->domain_->EvaluatePartialLagrangeCoefficients(
-            x, base::Range<int32_t>(-range.max,
-                                    static_cast<int32_t>(max_instances_row) +
-                                        std::abs(range.min)));
-
-    return base::Map(instance_columns_vec,
-                     [&instance_queries, &partial_lagrange_coeffs,
-                      &range](const std::vector<Evals>& instance_columns) {
-                       return ComputeInstanceEvals(
-                           instance_columns, instance_queries,
-                           partial_lagrange_coeffs, range.max);
-                     });
+    std::shared_ptr<const std::vector<F>> partial_lagrange_coeffs_ptr =
+        lagrange_coefficients_cache_.Get(
+            *this->domain_, x,
+            base::Range<int32_t>(-max_rotation,
+                                 static_cast<int32_t>(max_instances_row) +
+                                     std::abs(min_rotation)));
+    const std::vector<F>& partial_lagrange_coeffs =
+        *partial_lagrange_coeffs_ptr;
+
+    return base::Map(
+        instance_columns_vec,
+        [&instance_queries, &partial_lagrange_coeffs,
+         max_rotation](const std::vector<Evals>& instance_columns) {
+          return ComputeInstanceEvals(instance_columns, instance_queries,
+                                      partial_lagrange_coeffs, max_rotation);
+        });
   }
 
   F EvaluateH(
       const std::vector<std::vector<Commitment>>& instance_commitments_vec,
-      const VerifyingKey<F, Commitment>& vkey, const Proof& proof) {
+      const PreparedVerifyingKey& pvk, const Proof& proof) {
+    const VerifyingKey<F, Commitment>& vkey = pvk.vkey();
     size_t num_circuits = proof.advices_commitments_vec.size();
     const ConstraintSystem<F>& constraint_system = vkey.constraint_system();
     size_t size =
@@ -316,8 +416,9 @@ class Verifier : public VerifierBase<PCS> {
               i, vkey.permutation_verifying_key().commitments());
       PermutationVerifier<F, Commitment> permutation_verifier(
           permutation_verifier_data);
-      permutation_verifier.Evaluate(constraint_system, proof.x, l_values,
-                                    evals);
+      permutation_verifier.Evaluate(constraint_system,
+                                    pvk.permutation_constants(), proof.x,
+                                    l_values, evals);
 
       LookupVerifier lookup_verifier(proof, i, l_values);
       lookup_verifier.Evaluate(constraint_system.lookups(), evals);
@@ -389,11 +490,12 @@ class Verifier : public VerifierBase<PCS> {
     return openings;
   }
 
+  template <typename VerifyOpenings>
   bool DoVerify(
       const std::vector<std::vector<Commitment>>& instance_commitments_vec,
-      const VerifyingKey<F, Commitment>& vkey, const Proof& proof,
-      F* expected_h_eval_out) {
-    F expected_h_eval = EvaluateH(instance_commitments_vec, vkey, proof);
+      const PreparedVerifyingKey& pvk, const Proof& proof,
+      F* expected_h_eval_out, VerifyOpenings&& verify_openings) {
+    F expected_h_eval = EvaluateH(instance_commitments_vec, pvk, proof);
     if (expected_h_eval_out) {
       *expected_h_eval_out = expected_h_eval;
     }
@@ -402,11 +504,15 @@ class Verifier : public VerifierBase<PCS> {
     // elliptic curve point.
     Commitment expected_h_commitment;
     std::vector<Opening> openings =
-        Open(instance_commitments_vec, vkey, proof, expected_h_commitment,
-             expected_h_eval);
+        Open(instance_commitments_vec, pvk.vkey(), proof,
+             expected_h_commitment, expected_h_eval);
 
-    return this->pcs_.VerifyOpeningProof(openings, this->GetReader());
+    return verify_openings(openings);
   }
+
+  // The Lagrange coefficients at the challenge x, which are shared by the
+  // proofs verified at the same x.
+  mutable math::LagrangeCoefficientsCache<F> lagrange_coefficients_cache_;
 };
 
 }  // namespace halo2
@@ -13,7 +13,9 @@
 
 #include "absl/container/btree_map.h"
 
+#include "tachyon/base/logging.h"
 #include "tachyon/base/range.h"
+#include "tachyon/math/base/rational_field.h"
 #include "tachyon/zk/plonk/base/phase.h"
 #include "tachyon/zk/plonk/layout/assignment.h"
 
@@ -77,6 +79,125 @@ class WitnessCollection : public Assignment<typename Evals::Field> {
   std::vector<Evals> instance_columns_;
 };
 
+// Same as |WitnessCollection|, but writes the advice values of the current
+// phase straight into |advices|, which are the final columns preallocated by
+// the caller, instead of holding a |RationalEvals| per column to be evaluated
+// and copied later. The values whose denominators are one, which are the
+// common case, are written as they are, and the others are kept aside until
+// |EvaluatePendingValues()| writes them with a single batch inversion.
+// NOTE: |advices|, |challenges| and |instance_columns| must outlive |this|.
+template <typename Evals>
+class InPlaceWitnessCollection : public Assignment<typename Evals::Field> {
+ public:
+  using F = typename Evals::Field;
+  using AssignCallback = typename Assignment<F>::AssignCallback;
+
+  InPlaceWitnessCollection() = default;
+  InPlaceWitnessCollection(std::vector<Evals>* advices, RowIndex usable_rows,
+                           Phase current_phase,
+                           const absl::btree_map<size_t, F>* challenges,
+                           const std::vector<Evals>* instance_columns)
+      : advices_(advices),
+        usable_rows_(base::Range<RowIndex>::Until(usable_rows)),
+        current_phase_(current_phase),
+        challenges_(challenges),
+        instance_columns_(instance_columns),
+        has_pending_value_(advices->size()) {}
+
+  size_t num_pending_values() const { return pending_values_.size(); }
+
+  Value<F> QueryInstance(const InstanceColumnKey& column,
+                         RowIndex row) override {
+    CHECK(usable_rows_.Contains(row));
+    CHECK_LT(column.index(), instance_columns_->size());
+
+    return Value<F>::Known((*instance_columns_)[column.index()][row]);
+  }
+
+  void AssignAdvice(std::string_view, const AdviceColumnKey& column,
+                    RowIndex row, AssignCallback assign) override {
+    // NOTE: The columns of the other phases are assigned by the synthesis of
+    // their own phases, so they are left as they are.
+    if (current_phase_ != column.phase()) return;
+
+    CHECK(usable_rows_.Contains(row));
+    CHECK_LT(column.index(), advices_->size());
+
+    math::RationalField<F> value = std::move(assign).Run().value();
+    std::vector<bool>& has_pending_value = has_pending_value_[column.index()];
+    // NOTE: A value assigned after a pending one to the same cell is kept
+    // aside as well, so that the last one wins.
+    if (value.denominator().IsOne() &&
+        (has_pending_value.empty() || !has_pending_value[row])) {
+      (*advices_)[column.index()].at(row) = value.numerator();
+      return;
+    }
+    if (has_pending_value.empty()) {
+      has_pending_value.resize((*advices_)[column.index()].NumElements());
+    }
+    has_pending_value[row] = true;
+    pending_values_.push_back({column.index(), row, std::move(value)});
+  }
+
+  Value<F> GetChallenge(Challenge challenge) override {
+    auto it = challenges_->find(challenge.index());
+    if (it != challenges_->end()) return Value<F>::Known(it->second);
+    return Value<F>::Unknown();
+  }
+
+  // Writes the values kept aside by |AssignAdvice()| into |advices_| in the
+  // order of their assignments. Returns false if any of their denominators is
+  // zero. The number of the values written without an inversion is added to
+  // |num_skipped_inversions| if it is not null.
+  [[nodiscard]] bool EvaluatePendingValues(
+      size_t* num_skipped_inversions = nullptr) {
+    std::vector<F> denominators;
+    for (const PendingValue& pending_value : pending_values_) {
+      if (!pending_value.value.denominator().IsOne()) {
+        denominators.push_back(pending_value.value.denominator());
+      }
+    }
+    if (!F::BatchInverseInPlace(denominators)) {
+      LOG(ERROR) << "Inverse of zero attempted";
+      return false;
+    }
+    size_t denominator_idx = 0;
+    for (const PendingValue& pending_value : pending_values_) {
+      F& cell = (*advices_)[pending_value.column_idx].at(pending_value.row);
+      cell = pending_value.value.numerator();
+      if (!pending_value.value.denominator().IsOne()) {
+        cell *= denominators[denominator_idx++];
+      }
+    }
+    if (num_skipped_inversions) {
+      *num_skipped_inversions += pending_values_.size() - denominators.size();
+    }
+    pending_values_.clear();
+    has_pending_value_.assign(has_pending_value_.size(), {});
+    return true;
+  }
+
+ private:
+  struct PendingValue {
+    size_t column_idx;
+    RowIndex row;
+    math::RationalField<F> value;
+  };
+
+  // not owned
+  std::vector<Evals>* advices_ = nullptr;
+  base::Range<RowIndex> usable_rows_;
+  Phase current_phase_;
+  // not owned
+  const absl::btree_map<size_t, F>* challenges_ = nullptr;
+  // not owned
+  const std::vector<Evals>* instance_columns_ = nullptr;
+  std::vector<PendingValue> pending_values_;
+  // |has_pending_value_[i]| is empty until a value of the i-th column is kept
+  // aside, and then marks the rows that have one.
+  std::vector<std::vector<bool>> has_pending_value_;
+};
+
 }  // namespace tachyon::zk::plonk::halo2
 
 #endif  // TACHYON_ZK_PLONK_HALO2_WITNESS_COLLECTION_H_
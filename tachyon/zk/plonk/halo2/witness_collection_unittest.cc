@@ -45,12 +45,27 @@ class WitnessCollectionTest : public math::FiniteFieldTest<F> {
     witness_collection_ = WitnessCollection<Evals, RationalEvals>(
         domain.get(), kNumAdviceColumns, kUsableRows, current_phase,
         expected_challenges_, expected_instance_columns_);
+
+    advice_columns_ =
+        std::vector<Evals>(kNumAdviceColumns, domain->Zero<Evals>());
+    in_place_witness_collection_ = InPlaceWitnessCollection<Evals>(
+        &advice_columns_, kUsableRows, current_phase, &expected_challenges_,
+        &expected_instance_columns_);
+  }
+
+  void AssignInPlace(size_t col, RowIndex row,
+                     const math::RationalField<F>& value) {
+    in_place_witness_collection_.AssignAdvice(
+        "", AdviceColumnKey(col), row,
+        [value]() { return Value<math::RationalField<F>>::Known(value); });
   }
 
  protected:
   absl::btree_map<size_t, F> expected_challenges_;
   std::vector<Evals> expected_instance_columns_;
   WitnessCollection<Evals, RationalEvals> witness_collection_;
+  std::vector<Evals> advice_columns_;
+  InPlaceWitnessCollection<Evals> in_place_witness_collection_;
 };
 
 }  // namespace
@@ -91,4 +106,48 @@ TEST_F(WitnessCollectionTest, GetChallenge) {
   EXPECT_EQ(Value<F>::Known(expected_challenges_[target_idx]), challenge);
 }
 
+TEST_F(WitnessCollectionTest, AssignAdviceInPlace) {
+  F value = F::Random();
+  math::RationalField<F> fraction = math::RationalField<F>::Random();
+  AssignInPlace(0, 10, math::RationalField<F>(value));
+  AssignInPlace(1, 10, fraction);
+
+  // The value whose denominator is one is written as it is.
+  EXPECT_EQ(advice_columns_[0][10], value);
+  EXPECT_EQ(in_place_witness_collection_.num_pending_values(), size_t{1});
+
+  size_t num_skipped_inversions = 0;
+  ASSERT_TRUE(in_place_witness_collection_.EvaluatePendingValues(
+      &num_skipped_inversions));
+  EXPECT_EQ(advice_columns_[1][10], fraction.Evaluate());
+  EXPECT_EQ(num_skipped_inversions, size_t{0});
+  EXPECT_EQ(in_place_witness_collection_.num_pending_values(), size_t{0});
+}
+
+TEST_F(WitnessCollectionTest, AssignAdviceInPlaceOverwrite) {
+  F value = F::Random();
+  math::RationalField<F> fraction = math::RationalField<F>::Random();
+  AssignInPlace(0, 10, fraction);
+  AssignInPlace(0, 10, math::RationalField<F>(value));
+  AssignInPlace(0, 11, math::RationalField<F>(value));
+  AssignInPlace(0, 11, fraction);
+
+  size_t num_skipped_inversions = 0;
+  ASSERT_TRUE(in_place_witness_collection_.EvaluatePendingValues(
+      &num_skipped_inversions));
+  // The last assignment to a cell wins.
+  EXPECT_EQ(advice_columns_[0][10], value);
+  EXPECT_EQ(advice_columns_[0][11], fraction.Evaluate());
+  EXPECT_EQ(num_skipped_inversions, size_t{1});
+}
+
+TEST_F(WitnessCollectionTest, AssignAdviceInPlaceOtherPhase) {
+  in_place_witness_collection_.AssignAdvice(
+      "", AdviceColumnKey(0, kSecondPhase), 10, []() {
+        return Value<math::RationalField<F>>::Known(
+            math::RationalField<F>::One());
+      });
+  EXPECT_TRUE(advice_columns_[0][10].IsZero());
+}
+
 }  // namespace tachyon::zk::plonk::halo2
@@ -0,0 +1,23 @@
+#ifndef TACHYON_ZK_PLONK_KEYS_FIXED_COSETS_H_
+#define TACHYON_ZK_PLONK_KEYS_FIXED_COSETS_H_
+
+#include <vector>
+
+namespace tachyon::zk::plonk {
+
+// |FixedCosets| holds the coset FFTs of the polynomials of a |ProvingKey| that
+// don't depend on the witness over one of the cosets ζ * ωₑⁱ * H, on which
+// |CircuitPolynomialBuilder| builds the parts of the circuit polynomial. See
+// |ProvingKey::PrecomputeFixedCosets()|.
+template <typename Evals>
+struct FixedCosets {
+  std::vector<Evals> fixed_columns;
+  std::vector<Evals> permutation_columns;
+  Evals l_first;
+  Evals l_last;
+  Evals l_active_row;
+};
+
+}  // namespace tachyon::zk::plonk
+
+#endif  // TACHYON_ZK_PLONK_KEYS_FIXED_COSETS_H_
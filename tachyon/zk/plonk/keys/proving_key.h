@@ -7,14 +7,29 @@
 #ifndef TACHYON_ZK_PLONK_KEYS_PROVING_KEY_H_
 #define TACHYON_ZK_PLONK_KEYS_PROVING_KEY_H_
 
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/lookup/table_index_cache.h"
+#include "tachyon/zk/plonk/keys/fixed_cosets.h"
+#include "tachyon/zk/plonk/keys/proving_key_cache.h"
+#include "tachyon/zk/plonk/keys/proving_key_column_loader.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
 #include "tachyon/zk/plonk/permutation/permutation_proving_key.h"
 #include "tachyon/zk/plonk/vanishing/vanishing_argument.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
 
 namespace tachyon {
 
@@ -34,12 +49,103 @@ class ProvingKey : public Key {
   const Poly& l_first() const { return l_first_; }
   const Poly& l_last() const { return l_last_; }
   const Poly& l_active_row() const { return l_active_row_; }
-  const std::vector<Evals>& fixed_columns() const { return fixed_columns_; }
-  std::vector<Evals>& fixed_columns() { return fixed_columns_; }
-  const std::vector<Poly>& fixed_polys() const { return fixed_polys_; }
+  // NOTE: The accessors of the fixed columns, the fixed polys and the
+  // permutation proving key page them in with |column_loader_| if they are not
+  // loaded yet, so they are not thread-safe.
+  const std::vector<Evals>& fixed_columns() const {
+    EnsureFixedColumnsLoaded();
+    return fixed_columns_;
+  }
+  std::vector<Evals>& fixed_columns() {
+    EnsureFixedColumnsLoaded();
+    return fixed_columns_;
+  }
+  const std::vector<Poly>& fixed_polys() const {
+    EnsureFixedPolysLoaded();
+    return fixed_polys_;
+  }
   const PermutationProvingKey<Poly, Evals>& permutation_proving_key() const {
+    EnsurePermutationProvingKeyLoaded();
     return permutation_proving_key_;
   }
+  bool has_column_loader() const { return !!column_loader_; }
+  lookup::TableIndexCache& lookup_table_index_cache() {
+    return lookup_table_index_cache_;
+  }
+  // Empty unless |PrecomputeFixedCosets()| is called.
+  const std::vector<FixedCosets<Evals>>& fixed_cosets() const {
+    return fixed_cosets_;
+  }
+
+  // Precomputes the coset FFTs of the fixed polys, the permutation polys and
+  // the L polys over each part of the extended domain of |prover|. They are
+  // constant for the key, so the vanishing argument of |prover| only FFTs the
+  // columns that depend on the witness afterwards. This takes as much memory
+  // as the extended domain for each of the polys.
+  template <typename PCS>
+  void PrecomputeFixedCosets(const ProverBase<PCS>* prover) {
+    using Domain = typename PCS::Domain;
+
+    const Domain* domain = prover->domain();
+    size_t num_parts =
+        prover->extended_domain()->size() >> domain->log_size_of_group();
+    const F& extended_omega = prover->extended_domain()->group_gen();
+    const std::vector<Poly>& fixed_polys = this->fixed_polys();
+    const std::vector<Poly>& permutation_polys =
+        permutation_proving_key().polys();
+
+    fixed_cosets_.clear();
+    fixed_cosets_.reserve(num_parts);
+    // The same cosets as |CircuitPolynomialBuilder::BuildPart()|.
+    F offset = GetHalo2Zeta<F>();
+    for (size_t i = 0; i < num_parts; ++i) {
+      std::unique_ptr<Domain> coset_domain = domain->GetCoset(offset);
+      FixedCosets<Evals> cosets;
+      cosets.fixed_columns =
+          coset_domain->FFTBatch(absl::MakeConstSpan(fixed_polys));
+      cosets.permutation_columns =
+          coset_domain->FFTBatch(absl::MakeConstSpan(permutation_polys));
+      cosets.l_first = coset_domain->FFT(l_first_);
+      cosets.l_last = coset_domain->FFT(l_last_);
+      cosets.l_active_row = coset_domain->FFT(l_active_row_);
+      fixed_cosets_.push_back(std::move(cosets));
+      offset *= extended_omega;
+    }
+  }
+
+  void ReleaseFixedCosets() {
+    fixed_cosets_.clear();
+    fixed_cosets_.shrink_to_fit();
+  }
+
+  // Replaces the fixed columns, the fixed polys and the permutation proving key
+  // with |column_loader|. They are loaded when they are first touched.
+  void SetColumnLoader(
+      std::unique_ptr<ProvingKeyColumnLoader<Poly, Evals>> column_loader) {
+    column_loader_ = std::move(column_loader);
+    ReleaseColumns();
+  }
+
+  // Drops the fixed columns. If there is a |column_loader_|, they are loaded
+  // again when they are touched next time. Otherwise, they are gone for good.
+  void ReleaseFixedColumns() {
+    fixed_columns_.clear();
+    fixed_columns_.shrink_to_fit();
+    fixed_columns_loaded_ = false;
+  }
+
+  // Drops the fixed columns, the fixed polys and the permutation proving key if
+  // they can be loaded again with |column_loader_|, e.g, under memory pressure
+  // between proofs. This does nothing without |column_loader_|.
+  void ReleaseColumns() {
+    if (!column_loader_) return;
+    ReleaseFixedColumns();
+    fixed_polys_.clear();
+    fixed_polys_.shrink_to_fit();
+    fixed_polys_loaded_ = false;
+    permutation_proving_key_ = PermutationProvingKey<Poly, Evals>();
+    permutation_proving_key_loaded_ = false;
+  }
 
   // Return true if it is able to load from an instance of |circuit|.
   template <typename PCS, typename Circuit>
@@ -66,6 +172,38 @@ class ProvingKey : public Key {
     return DoLoad(prover, std::move(pre_load_result), nullptr);
   }
 
+  // Same as |Load()|, but the results of keygen are read from |cache| if the
+  // same circuit has been loaded with the same PCS and domain before.
+  // Otherwise, they are computed as |Load()| does and written to |cache|. The
+  // circuit is still synthesized to compute the digest, but the commitments,
+  // the IFFTs and the permutations are skipped when it hits.
+  template <typename PCS, typename Circuit>
+  [[nodiscard]] bool LoadWithCache(ProverBase<PCS>* prover,
+                                   const Circuit& circuit,
+                                   const ProvingKeyCache& cache) {
+    using RationalEvals = typename PCS::RationalEvals;
+    KeyPreLoadResult<Evals, RationalEvals> pre_load_result(LS::type);
+    if (!this->PreLoad(prover, circuit, &pre_load_result)) return false;
+
+    std::string digest =
+        ProvingKeyCache::ComputeDigest(prover, pre_load_result);
+    base::FilePath path = cache.GetPath(digest);
+    if (base::PathExists(path)) {
+      if (ReadCache(prover, path, digest, pre_load_result)) return true;
+      LOG(WARNING) << "Running keygen again since " << path.value()
+                   << " is invalid";
+    }
+
+    VerifyingKeyLoadResult<Evals> vk_result;
+    if (!verifying_key_.DoLoad(prover, std::move(pre_load_result), &vk_result))
+      return false;
+    if (!DoLoad(prover, std::move(pre_load_result), &vk_result)) return false;
+    // NOTE: If it fails to write the file, keygen is only run again by the
+    // next load.
+    std::ignore = WriteCache(path, digest);
+    return true;
+  }
+
  private:
   friend class c::zk::plonk::ProvingKeyImplBase<LS>;
 
@@ -82,7 +220,10 @@ class ProvingKey : public Key {
         verifying_key_.constraint_system().ComputeBlindingFactors());
 
     const Domain* domain = prover->domain();
+    column_loader_.reset();
     fixed_columns_ = std::move(pre_load_result.fixed_columns);
+    lookup_table_index_cache_.Clear();
+    ReleaseFixedCosets();
     fixed_polys_ = base::Map(fixed_columns_, [domain](const Evals& evals) {
       return domain->IFFT(evals);
     });
@@ -163,14 +304,175 @@ class ProvingKey : public Key {
     return true;
   }
 
+  template <typename PCS, typename RationalEvals>
+  bool ReadCache(ProverBase<PCS>* prover, const base::FilePath& path,
+                 std::string_view digest,
+                 KeyPreLoadResult<Evals, RationalEvals>& pre_load_result) {
+    ProvingKeyCache::Reader reader;
+    if (!reader.Initialize(path)) return false;
+    uint64_t magic;
+    uint32_t version;
+    uint32_t field_size;
+    if (!reader.Read(&magic) || !reader.Read(&version) ||
+        !reader.Read(&field_size)) {
+      return false;
+    }
+    if (magic != ProvingKeyCache::kMagic ||
+        version != ProvingKeyCache::kVersion || field_size != sizeof(F)) {
+      LOG(ERROR) << "Not a proving key cache of version "
+                 << ProvingKeyCache::kVersion;
+      return false;
+    }
+    F one;
+    std::string_view file_digest;
+    if (!reader.Read(&one) ||
+        !reader.ReadBytes(ProvingKeyCache::kHexDigestSize, &file_digest)) {
+      return false;
+    }
+    if (one != F::One()) {
+      LOG(ERROR) << "Field representation mismatch";
+      return false;
+    }
+    if (file_digest != digest) {
+      LOG(ERROR) << "Digest mismatch";
+      return false;
+    }
+
+    F transcript_repr;
+    std::vector<C> fixed_commitments;
+    std::vector<C> permutation_commitments;
+    std::vector<std::vector<F>> lagrange_polys;
+    std::vector<std::vector<F>> fixed_polys;
+    std::vector<std::vector<F>> permutations;
+    std::vector<std::vector<F>> permutation_polys;
+    if (!reader.Read(&transcript_repr) ||
+        !reader.ReadColumn(&fixed_commitments) ||
+        !reader.ReadColumn(&permutation_commitments) ||
+        !reader.ReadColumns(&lagrange_polys) ||
+        !reader.ReadColumns(&fixed_polys) ||
+        !reader.ReadColumns(&permutations) ||
+        !reader.ReadColumns(&permutation_polys)) {
+      return false;
+    }
+    if (!reader.Done()) {
+      LOG(ERROR) << "Trailing bytes in " << path.value();
+      return false;
+    }
+    if (lagrange_polys.size() != 3 ||
+        fixed_polys.size() != pre_load_result.fixed_columns.size()) {
+      LOG(ERROR) << "Invalid proving key cache";
+      return false;
+    }
+
+    verifying_key_.constraint_system_ =
+        std::move(pre_load_result.constraint_system);
+    verifying_key_.fixed_commitments_ = std::move(fixed_commitments);
+    verifying_key_.permutation_verifying_key_ =
+        PermutationVerifyingKey<C>(std::move(permutation_commitments));
+    verifying_key_.transcript_repr_ = transcript_repr;
+
+    prover->blinder().set_blinding_factors(
+        verifying_key_.constraint_system().ComputeBlindingFactors());
+    column_loader_.reset();
+    fixed_columns_ = std::move(pre_load_result.fixed_columns);
+    lookup_table_index_cache_.Clear();
+    ReleaseFixedCosets();
+    fixed_polys_ = ToPolys(std::move(fixed_polys));
+    std::vector<Evals> permutation_evals =
+        base::Map(permutations, [](std::vector<F>& evals) {
+          return Evals(std::move(evals));
+        });
+    permutation_proving_key_ = PermutationProvingKey<Poly, Evals>(
+        std::move(permutation_evals), ToPolys(std::move(permutation_polys)));
+    l_first_ = ToPoly(std::move(lagrange_polys[0]));
+    l_last_ = ToPoly(std::move(lagrange_polys[1]));
+    l_active_row_ = ToPoly(std::move(lagrange_polys[2]));
+    vanishing_argument_ =
+        VanishingArgument<LS>::Create(verifying_key_.constraint_system());
+    return true;
+  }
+
+  bool WriteCache(const base::FilePath& path, std::string_view digest) const {
+    ProvingKeyCache::Writer writer;
+    writer.Write(ProvingKeyCache::kMagic);
+    writer.Write(ProvingKeyCache::kVersion);
+    writer.Write(static_cast<uint32_t>(sizeof(F)));
+    writer.Write(F::One());
+    writer.WriteBytes(digest);
+
+    writer.Write(verifying_key_.transcript_repr_);
+    writer.WriteColumn(verifying_key_.fixed_commitments_);
+    writer.WriteColumn(
+        verifying_key_.permutation_verifying_key_.commitments());
+    writer.Write(uint64_t{3});
+    writer.WriteColumn(l_first_.coefficients().coefficients());
+    writer.WriteColumn(l_last_.coefficients().coefficients());
+    writer.WriteColumn(l_active_row_.coefficients().coefficients());
+    writer.Write(static_cast<uint64_t>(fixed_polys_.size()));
+    for (const Poly& poly : fixed_polys_) {
+      writer.WriteColumn(poly.coefficients().coefficients());
+    }
+    const std::vector<Evals>& permutations =
+        permutation_proving_key_.permutations();
+    writer.Write(static_cast<uint64_t>(permutations.size()));
+    for (const Evals& permutation : permutations) {
+      writer.WriteColumn(permutation.evaluations());
+    }
+    const std::vector<Poly>& permutation_polys =
+        permutation_proving_key_.polys();
+    writer.Write(static_cast<uint64_t>(permutation_polys.size()));
+    for (const Poly& poly : permutation_polys) {
+      writer.WriteColumn(poly.coefficients().coefficients());
+    }
+    return writer.Save(path);
+  }
+
+  static Poly ToPoly(std::vector<F>&& coeffs) {
+    return Poly(typename Poly::Coefficients(std::move(coeffs)));
+  }
+
+  static std::vector<Poly> ToPolys(std::vector<std::vector<F>>&& coeffs_list) {
+    return base::Map(coeffs_list, [](std::vector<F>& coeffs) {
+      return ToPoly(std::move(coeffs));
+    });
+  }
+
+  void EnsureFixedColumnsLoaded() const {
+    if (fixed_columns_loaded_ || !column_loader_) return;
+    CHECK(column_loader_->LoadFixedColumns(&fixed_columns_));
+    fixed_columns_loaded_ = true;
+  }
+
+  void EnsureFixedPolysLoaded() const {
+    if (fixed_polys_loaded_ || !column_loader_) return;
+    CHECK(column_loader_->LoadFixedPolys(&fixed_polys_));
+    fixed_polys_loaded_ = true;
+  }
+
+  void EnsurePermutationProvingKeyLoaded() const {
+    if (permutation_proving_key_loaded_ || !column_loader_) return;
+    CHECK(column_loader_->LoadPermutationProvingKey(&permutation_proving_key_));
+    permutation_proving_key_loaded_ = true;
+  }
+
   VerifyingKey<F, C> verifying_key_;
   Poly l_first_;
   Poly l_last_;
   Poly l_active_row_;
-  std::vector<Evals> fixed_columns_;
-  std::vector<Poly> fixed_polys_;
-  PermutationProvingKey<Poly, Evals> permutation_proving_key_;
+  // NOTE: These are mutable since they are paged in by the const accessors
+  // when there is a |column_loader_|.
+  mutable std::vector<Evals> fixed_columns_;
+  mutable std::vector<Poly> fixed_polys_;
+  mutable PermutationProvingKey<Poly, Evals> permutation_proving_key_;
+  std::unique_ptr<ProvingKeyColumnLoader<Poly, Evals>> column_loader_;
+  mutable bool fixed_columns_loaded_ = false;
+  mutable bool fixed_polys_loaded_ = false;
+  mutable bool permutation_proving_key_loaded_ = false;
   VanishingArgument<LS> vanishing_argument_;
+  // Filled by the lookup provers while proving. See
+  // |lookup::TableIndexCache|.
+  lookup::TableIndexCache lookup_table_index_cache_;
+  std::vector<FixedCosets<Evals>> fixed_cosets_;
 };
 
 }  // namespace zk::plonk
@@ -0,0 +1,265 @@
+#ifndef TACHYON_ZK_PLONK_KEYS_PROVING_KEY_CACHE_H_
+#define TACHYON_ZK_PLONK_KEYS_PROVING_KEY_CACHE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+#include "openssl/blake2.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/strings/rust_stringifier.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+#include "tachyon/zk/base/entities/entity.h"
+#include "tachyon/zk/plonk/halo2/pinned_constraint_system.h"
+#include "tachyon/zk/plonk/halo2/pinned_evaluation_domain.h"
+#include "tachyon/zk/plonk/keys/key.h"
+#include "tachyon/zk/plonk/permutation/label.h"
+#include "tachyon/zk/plonk/permutation/permutation_assembly.h"
+
+namespace tachyon::zk::plonk {
+
+// |ProvingKeyCache| keeps the results of keygen in |dir()|, one file per
+// circuit, named after the digest of everything keygen depends on: the PCS,
+// the domain, the constraint system, the fixed columns and the copy
+// constraints. See |ProvingKey::LoadWithCache()|.
+//
+// Each file is in the native format, where every column is its length as a
+// uint64_t followed by the in-memory representation of its elements aligned
+// to |kAlignment|, so that it is copied out of the memory mapped file as it
+// is.
+// clang-format off
+// +-------+---------+------------+----------------+------------+
+// | magic | version | field size | F::One() bytes | hex digest |
+// +-------+---------+------------+----------------+------------+
+// |  u64  |   u32   |    u32     |   field size   |    128     |
+// +-------+---------+------------+----------------+------------+
+// clang-format on
+// NOTE: The elements are written in the limbs of the host, which is checked
+// with F::One() when loaded, so the directory shouldn't be shared across the
+// hosts whose endianness or field representation are different.
+class ProvingKeyCache {
+ public:
+  constexpr static uint64_t kMagic = 0x434b'504e'4f48'4354;  // TCHONPKC
+  constexpr static uint32_t kVersion = 1;
+  constexpr static size_t kAlignment = 64;
+  constexpr static size_t kDigestSize = BLAKE2B512_DIGEST_LENGTH;
+  constexpr static size_t kHexDigestSize = 2 * kDigestSize;
+
+  // Writes a cache file.
+  class Writer {
+   public:
+    template <typename T>
+    void Write(const T& value) {
+      const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+      out_.insert(out_.end(), bytes, bytes + sizeof(T));
+    }
+
+    void WriteBytes(std::string_view bytes) {
+      out_.insert(out_.end(), bytes.begin(), bytes.end());
+    }
+
+    template <typename T>
+    void WriteColumn(const std::vector<T>& column) {
+      Write(static_cast<uint64_t>(column.size()));
+      out_.resize(base::bits::AlignUp(out_.size(), kAlignment));
+      const uint8_t* bytes = reinterpret_cast<const uint8_t*>(column.data());
+      out_.insert(out_.end(), bytes, bytes + column.size() * sizeof(T));
+    }
+
+    // Writes the columns to a temporary file first, so that a process loading
+    // |path| concurrently never sees a partially written file.
+    [[nodiscard]] bool Save(const base::FilePath& path) const {
+      if (!base::CreateDirectory(path.DirName())) {
+        LOG(ERROR) << "Failed to create " << path.DirName().value();
+        return false;
+      }
+      base::FilePath tmp_path;
+      if (!base::CreateTemporaryFileInDir(path.DirName(), &tmp_path)) {
+        LOG(ERROR) << "Failed to create a temporary file in "
+                   << path.DirName().value();
+        return false;
+      }
+      if (!base::WriteLargeFile(tmp_path, out_) ||
+          !base::ReplaceFile(tmp_path, path, nullptr)) {
+        LOG(ERROR) << "Failed to write " << path.value();
+        base::DeleteFile(tmp_path);
+        return false;
+      }
+      return true;
+    }
+
+   private:
+    std::vector<uint8_t> out_;
+  };
+
+  // Reads a cache file written by |Writer| out of the memory mapped file.
+  class Reader {
+   public:
+    [[nodiscard]] bool Initialize(const base::FilePath& path) {
+      if (!file_.Initialize(path,
+                            base::MemoryMappedFile::Access::kSequential)) {
+        LOG(ERROR) << "Failed to map " << path.value();
+        return false;
+      }
+      buffer_ = file_.ToBuffer();
+      return true;
+    }
+
+    bool Done() const { return buffer_.Done(); }
+
+    // NOTE: The values are not necessarily aligned, e.g., the length of a
+    // column, so they are copied rather than viewed in place.
+    template <typename T>
+    [[nodiscard]] bool Read(T* value) {
+      absl::Span<const uint8_t> bytes;
+      if (!ReadSpan(sizeof(T), &bytes)) return false;
+      memcpy(value, bytes.data(), sizeof(T));
+      return true;
+    }
+
+    [[nodiscard]] bool ReadBytes(uint64_t len, std::string_view* bytes) {
+      absl::Span<const char> chars;
+      if (!ReadSpan(len, &chars)) return false;
+      *bytes = std::string_view(chars.data(), chars.size());
+      return true;
+    }
+
+    template <typename T>
+    [[nodiscard]] bool ReadColumn(std::vector<T>* column) {
+      uint64_t len;
+      if (!Read(&len)) return false;
+      buffer_.set_buffer_offset(
+          base::bits::AlignUp(buffer_.buffer_offset(), kAlignment));
+      absl::Span<const T> values;
+      if (!ReadSpan(len, &values)) return false;
+      column->resize(len);
+      memcpy(column->data(), values.data(), len * sizeof(T));
+      return true;
+    }
+
+    template <typename T>
+    [[nodiscard]] bool ReadColumns(std::vector<std::vector<T>>* columns) {
+      uint64_t num_columns;
+      if (!Read(&num_columns)) return false;
+      columns->resize(num_columns);
+      for (std::vector<T>& column : *columns) {
+        if (!ReadColumn(&column)) return false;
+      }
+      return true;
+    }
+
+   private:
+    template <typename T>
+    [[nodiscard]] bool ReadSpan(uint64_t len, absl::Span<const T>* values) {
+      if (!buffer_.ReadSpan(len, values)) {
+        LOG(ERROR) << "Proving key cache is truncated";
+        return false;
+      }
+      return true;
+    }
+
+    base::MemoryMappedFile file_;
+    base::ReadOnlyBuffer buffer_;
+  };
+
+  explicit ProvingKeyCache(const base::FilePath& dir) : dir_(dir) {}
+
+  const base::FilePath& dir() const { return dir_; }
+
+  base::FilePath GetPath(std::string_view digest) const {
+    return dir_.Append(absl::StrCat(digest, ".pk"));
+  }
+
+  // Returns the hex of the digest of |result| and the PCS and the domain of
+  // |entity|. This is cheap compared to keygen, since it only hashes the
+  // inputs of keygen without committing to or interpolating any of them.
+  template <typename PCS, typename Evals, typename RationalEvals>
+  static std::string ComputeDigest(
+      const Entity<PCS>* entity,
+      const KeyPreLoadResult<Evals, RationalEvals>& result) {
+    using F = typename PCS::Field;
+
+    BLAKE2B_CTX state;
+    BLAKE2B512_Init(&state);
+
+    // The commitments depend on the SRS.
+    const PCS& pcs = entity->pcs();
+    base::Uint8VectorBuffer pcs_buffer;
+    CHECK(pcs_buffer.Grow(base::EstimateSize(pcs)));
+    CHECK(pcs_buffer.Write(pcs));
+    UpdateBytes(&state, pcs_buffer.owned_buffer());
+
+    UpdateString(&state, base::ToRustDebugString(
+                             halo2::PinnedEvaluationDomain<F>(entity)));
+    const ConstraintSystem<F>& constraint_system = result.constraint_system;
+    UpdateValue(&state, static_cast<uint32_t>(constraint_system.lookup_type()));
+    UpdateString(&state,
+                 base::ToRustDebugString(
+                     halo2::PinnedConstraintSystem<F>(constraint_system)));
+
+    UpdateValue(&state, static_cast<uint64_t>(result.fixed_columns.size()));
+    for (const Evals& column : result.fixed_columns) {
+      UpdateColumn(&state, column.evaluations());
+    }
+
+    // The copy constraints are hashed as the next label of each label.
+    const PermutationAssembly& permutation = result.assembly.permutation();
+    RowIndex rows = static_cast<RowIndex>(entity->domain()->size());
+    UpdateValue(&state, static_cast<uint64_t>(permutation.columns().size()));
+    std::vector<uint64_t> next_labels(rows);
+    for (size_t i = 0; i < permutation.columns().size(); ++i) {
+      for (RowIndex j = 0; j < rows; ++j) {
+        const Label& next = permutation.cycle_store().GetNextLabel(Label(i, j));
+        next_labels[j] = (uint64_t{next.col} << 32) | next.row;
+      }
+      UpdateColumn(&state, next_labels);
+    }
+
+    uint8_t digest[kDigestSize];
+    BLAKE2B512_Final(digest, &state);
+    return base::HexEncode(digest, kDigestSize, /*use_lower_case=*/true);
+  }
+
+ private:
+  static void UpdateBytes(BLAKE2B_CTX* state,
+                          absl::Span<const uint8_t> bytes) {
+    UpdateValue(state, static_cast<uint64_t>(bytes.size()));
+    BLAKE2B512_Update(state, bytes.data(), bytes.size());
+  }
+
+  static void UpdateString(BLAKE2B_CTX* state, std::string_view str) {
+    UpdateBytes(state, absl::Span<const uint8_t>(
+                           reinterpret_cast<const uint8_t*>(str.data()),
+                           str.size()));
+  }
+
+  template <typename T>
+  static void UpdateValue(BLAKE2B_CTX* state, const T& value) {
+    BLAKE2B512_Update(state, &value, sizeof(T));
+  }
+
+  template <typename T>
+  static void UpdateColumn(BLAKE2B_CTX* state, const std::vector<T>& column) {
+    UpdateValue(state, static_cast<uint64_t>(column.size()));
+    BLAKE2B512_Update(state, column.data(), column.size() * sizeof(T));
+  }
+
+  const base::FilePath dir_;
+};
+
+}  // namespace tachyon::zk::plonk
+
+#endif  // TACHYON_ZK_PLONK_KEYS_PROVING_KEY_CACHE_H_
@@ -0,0 +1,28 @@
+#ifndef TACHYON_ZK_PLONK_KEYS_PROVING_KEY_COLUMN_LOADER_H_
+#define TACHYON_ZK_PLONK_KEYS_PROVING_KEY_COLUMN_LOADER_H_
+
+#include <vector>
+
+#include "tachyon/zk/plonk/permutation/permutation_proving_key.h"
+
+namespace tachyon::zk::plonk {
+
+// |ProvingKeyColumnLoader| pages in the heavy columns of a |ProvingKey| from
+// where they are stored, e.g, a file, when they are first touched. Since the
+// columns can be loaded again at any time, the |ProvingKey| is free to drop
+// them when they are not needed. See |ProvingKey::ReleaseColumns()|.
+template <typename Poly, typename Evals>
+class ProvingKeyColumnLoader {
+ public:
+  virtual ~ProvingKeyColumnLoader() = default;
+
+  [[nodiscard]] virtual bool LoadFixedColumns(
+      std::vector<Evals>* fixed_columns) = 0;
+  [[nodiscard]] virtual bool LoadFixedPolys(std::vector<Poly>* fixed_polys) = 0;
+  [[nodiscard]] virtual bool LoadPermutationProvingKey(
+      PermutationProvingKey<Poly, Evals>* permutation_proving_key) = 0;
+};
+
+}  // namespace tachyon::zk::plonk
+
+#endif  // TACHYON_ZK_PLONK_KEYS_PROVING_KEY_COLUMN_LOADER_H_
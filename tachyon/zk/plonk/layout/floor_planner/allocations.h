@@ -8,10 +8,14 @@
 #define TACHYON_ZK_PLONK_LAYOUT_FLOOR_PLANNER_ALLOCATIONS_H_
 
 #include <algorithm>
+#include <iterator>
+#include <optional>
 #include <vector>
 
+#include "absl/container/btree_map.h"
 #include "absl/container/btree_set.h"
 
+#include "tachyon/base/logging.h"
 #include "tachyon/export.h"
 #include "tachyon/zk/plonk/layout/floor_planner/allocated_region.h"
 #include "tachyon/zk/plonk/layout/floor_planner/empty_space.h"
@@ -21,17 +25,45 @@ namespace tachyon::zk::plonk {
 // Allocated rows within a column.
 
 // This is a set of |AllocatedRegion|s, representing disjoint allocated
-// intervals.
+// intervals. The unallocated intervals between them are indexed as well, so
+// that |FreeIntervals()| only visits the intervals it returns instead of
+// rescanning every allocation from the top of the column.
 class TACHYON_EXPORT Allocations {
  public:
-  absl::btree_set<AllocatedRegion>& allocations() { return allocations_; }
+  const absl::btree_set<AllocatedRegion>& allocations() const {
+    return allocations_;
+  }
 
   // Returns the row that forms the unbounded unallocated interval.
-  RowIndex UnboundedIntervalStart() const {
-    if (allocations_.empty()) {
-      return 0;
+  RowIndex UnboundedIntervalStart() const { return unbounded_interval_start_; }
+
+  // Allocates |region|, which must lie within an unallocated interval.
+  void Allocate(const AllocatedRegion& region) {
+    allocations_.insert(region);
+    if (region.length() == 0) return;
+
+    if (region.start() >= unbounded_interval_start_) {
+      if (region.start() > unbounded_interval_start_) {
+        free_intervals_[unbounded_interval_start_] = region.start();
+      }
+      unbounded_interval_start_ = region.End();
+      return;
+    }
+
+    // Split the bounded interval containing |region|.
+    auto it = free_intervals_.upper_bound(region.start());
+    CHECK(it != free_intervals_.begin());
+    --it;
+    RowIndex start = it->first;
+    RowIndex end = it->second;
+    CHECK_LE(region.End(), end);
+    free_intervals_.erase(it);
+    if (start < region.start()) {
+      free_intervals_[start] = region.start();
+    }
+    if (region.End() < end) {
+      free_intervals_[region.End()] = end;
     }
-    return allocations_.rbegin()->End();
   }
 
   // Return all the *unallocated* non-empty intervals intersecting [|start|,
@@ -39,17 +71,23 @@ class TACHYON_EXPORT Allocations {
   std::vector<EmptySpace> FreeIntervals(RowIndex start,
                                         std::optional<RowIndex> end) const {
     std::vector<EmptySpace> result;
-    result.reserve(allocations_.size() + 1);
-    RowIndex row = start;
-    for (const AllocatedRegion& region : allocations_) {
-      if (end.has_value() && region.start() >= end.value()) {
-        break;
+    // Start from the bounded interval containing |start|, if any.
+    auto it = free_intervals_.upper_bound(start);
+    if (it != free_intervals_.begin() && std::prev(it)->second > start) {
+      --it;
+    }
+    for (; it != free_intervals_.end(); ++it) {
+      RowIndex space_start = std::max(start, it->first);
+      if (end.has_value() && space_start >= end.value()) {
+        return result;
       }
-      if (row < region.start()) {
-        result.emplace_back(row, std::optional<RowIndex>(region.start()));
+      RowIndex space_end = it->second;
+      if (end.has_value()) {
+        space_end = std::min(space_end, end.value());
       }
-      row = std::max(row, region.End());
+      result.emplace_back(space_start, std::optional<RowIndex>(space_end));
     }
+    RowIndex row = std::max(start, unbounded_interval_start_);
     if (!end.has_value() || row < end.value()) {
       result.emplace_back(row, end);
     }
@@ -58,6 +96,9 @@ class TACHYON_EXPORT Allocations {
 
  private:
   absl::btree_set<AllocatedRegion> allocations_;
+  // The bounded unallocated intervals, mapping the start of each to its end.
+  absl::btree_map<RowIndex, RowIndex> free_intervals_;
+  RowIndex unbounded_interval_start_ = 0;
 };
 
 }  // namespace tachyon::zk::plonk
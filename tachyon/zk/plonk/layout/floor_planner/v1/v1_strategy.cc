@@ -15,15 +15,14 @@ namespace tachyon::zk::plonk {
 // taking into account prior columns.
 std::optional<RowIndex> FirstFitRegion(
     CircuitAllocations* column_allocations,
-    const std::vector<RegionColumn>& region_columns, RowIndex region_length,
+    absl::Span<const RegionColumn> region_columns, RowIndex region_length,
     RowIndex start, std::optional<RowIndex> slack) {
   if (region_columns.empty()) {
     return start;
   }
 
   const RegionColumn& c = region_columns[0];
-  std::vector<RegionColumn> remaining_columns(region_columns.begin() + 1,
-                                              region_columns.end());
+  absl::Span<const RegionColumn> remaining_columns = region_columns.subspan(1);
 
   std::optional<RowIndex> end;
   if (slack.has_value()) {
@@ -52,7 +51,7 @@ std::optional<RowIndex> FirstFitRegion(
         if (end.has_value()) {
           CHECK_LE(row.value() + region_length, end.value());
         }
-        column_allocations->at(c).allocations().insert(
+        column_allocations->at(c).Allocate(
             AllocatedRegion(row.value(), region_length));
         return row;
       }
@@ -63,4 +62,13 @@ std::optional<RowIndex> FirstFitRegion(
   return std::nullopt;
 }
 
+RowIndex SlotInRegion(CircuitAllocations* column_allocations,
+                      absl::Span<const RegionColumn> region_columns,
+                      RowIndex region_length) {
+  std::optional<RowIndex> region_start = FirstFitRegion(
+      column_allocations, region_columns, region_length, 0, std::nullopt);
+  CHECK(region_start.has_value()) << "We can always fit a region somewhere";
+  return *region_start;
+}
+
 }  // namespace tachyon::zk::plonk
@@ -15,10 +15,12 @@
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
 #include "third_party/pdqsort/include/pdqsort.h"
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/export.h"
 #include "tachyon/zk/plonk/base/column_key.h"
 #include "tachyon/zk/plonk/base/column_type.h"
@@ -35,7 +37,7 @@ using CircuitAllocations = absl::flat_hash_map<RegionColumn, Allocations>;
 //   taking into account prior columns.
 TACHYON_EXPORT std::optional<RowIndex> FirstFitRegion(
     CircuitAllocations* column_allocations,
-    const std::vector<RegionColumn>& region_columns, RowIndex region_length,
+    absl::Span<const RegionColumn> region_columns, RowIndex region_length,
     RowIndex start, std::optional<RowIndex> slack);
 
 template <typename F>
@@ -53,39 +55,54 @@ struct SlotInResult {
   CircuitAllocations column_allocations;
 };
 
-// Positions the regions starting at the earliest row for which none of the
-// columns are in use, taking into account gaps between earlier regions.
+// Returns the columns of each region sorted to ensure determinism. The regions
+// don't depend on each other, so they are sorted in parallel.
 template <typename F>
-SlotInResult<F> SlotIn(std::vector<RegionShape<F>>& region_shapes) {
-  // Tracks the empty regions for each column.
-  CircuitAllocations column_allocations;
-
-  std::vector<RegionInfo<F>> regions;
-  regions.reserve(region_shapes.size());
-
-  for (RegionShape<F>& region : region_shapes) {
-    // Sort the region's columns to ensure determinism.
+std::vector<std::vector<RegionColumn>> GetSortedRegionColumns(
+    absl::Span<const RegionShape<F>> region_shapes) {
+  std::vector<std::vector<RegionColumn>> ret(region_shapes.size());
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < region_shapes.size(); ++i) {
     // NOTE(TomTaehoonKim): Sorted result might be different from the original
     // See
     // https://github.com/kroma-network/halo2/blob/7d0a36990452c8e7ebd600de258420781a9b7917/halo2_proofs/src/circuit/floor_planner/v1/strategy.rs#L171-L191
     // - An unstable sort is fine, because region.columns() returns a set.
     // - The sort order relies on Column's Ord implementation!
-    std::vector<RegionColumn> region_columns(region.columns().begin(),
-                                             region.columns().end());
-    pdqsort(region_columns.begin(), region_columns.end(),
+    const RegionShape<F>& region = region_shapes[i];
+    ret[i] = std::vector<RegionColumn>(region.columns().begin(),
+                                       region.columns().end());
+    pdqsort(ret[i].begin(), ret[i].end(),
             [](const RegionColumn& lhs, const RegionColumn& rhs) {
               return lhs < rhs;
             });
+  }
+  return ret;
+}
+
+// Positions the region at the earliest row for which none of |region_columns|
+// are in use, taking into account gaps between earlier regions.
+TACHYON_EXPORT RowIndex SlotInRegion(
+    CircuitAllocations* column_allocations,
+    absl::Span<const RegionColumn> region_columns, RowIndex region_length);
+
+// Positions the regions starting at the earliest row for which none of the
+// columns are in use, taking into account gaps between earlier regions.
+template <typename F>
+SlotInResult<F> SlotIn(std::vector<RegionShape<F>>& region_shapes) {
+  // Tracks the empty regions for each column.
+  CircuitAllocations column_allocations;
 
-    std::optional<RowIndex> region_start =
-        FirstFitRegion(&column_allocations, region_columns, region.row_count(),
-                       0, std::nullopt);
-    CHECK(region_start.has_value()) << "We can always fit a region somewhere";
+  std::vector<std::vector<RegionColumn>> region_columns =
+      GetSortedRegionColumns<F>(region_shapes);
 
-    regions.emplace_back(*region_start, std::move(region));
+  std::vector<RegionInfo<F>> regions;
+  regions.reserve(region_shapes.size());
+  for (size_t i = 0; i < region_shapes.size(); ++i) {
+    RowIndex region_start = SlotInRegion(&column_allocations, region_columns[i],
+                                         region_shapes[i].row_count());
+    regions.emplace_back(region_start, std::move(region_shapes[i]));
   }
 
-  return {regions, column_allocations};
+  return {std::move(regions), std::move(column_allocations)};
 }
 
 TACHYON_EXPORT struct SlotInBiggestAdviceFirstResult {
@@ -94,54 +111,55 @@ TACHYON_EXPORT struct SlotInBiggestAdviceFirstResult {
 };
 
 // Sorts the regions by advice area and then lays them out with the |SlotIn|
-// strategy.
+// strategy. The |i|-th region of |region_shapes| must have |i| as its region
+// index, as measured by |MeasurementPass|.
+//
+// NOTE: The regions are sorted by their indexes rather than copied, and their
+// advice areas are computed once in parallel instead of on every comparison.
+// Since |pdqsort| is deterministic given the results of the comparisons, the
+// order is the same as the one of sorting the regions themselves.
 template <typename F>
 SlotInBiggestAdviceFirstResult SlotInBiggestAdviceFirst(
     const std::vector<RegionShape<F>>& region_shapes) {
-  std::vector<RegionShape<F>> sorted_regions = region_shapes;
+  std::vector<size_t> advice_areas(region_shapes.size());
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < region_shapes.size(); ++i) {
+    // Count the number of advice columns
+    size_t advice_cols = 0;
+    for (const RegionColumn& column : region_shapes[i].columns()) {
+      if (column.type() == RegionColumn::Type::kColumn) {
+        const AnyColumnKey& c = column.column();
+        if (c.type() == ColumnType::kAdvice) {
+          ++advice_cols;
+        }
+      }
+    }
+    advice_areas[i] = advice_cols * region_shapes[i].row_count();
+  }
+
+  std::vector<size_t> sorted_indices =
+      base::CreateRangedVector(size_t{0}, region_shapes.size());
   // NOTE(TomTaehoonKim): Sorted result might be different from the original
   // See
   // https://github.com/kroma-network/halo2/blob/7d0a36990452c8e7ebd600de258420781a9b7917/halo2_proofs/src/layout/floor_planner/v1/strategy.rs#L202-L215
-  pdqsort(sorted_regions.begin(), sorted_regions.end(),
-          [](const RegionShape<F>& lhs, const RegionShape<F>& rhs) {
-            // Count the number of advice columns
-            size_t lhs_advice_cols = 0;
-            for (const RegionColumn& column : lhs.columns()) {
-              if (column.type() == RegionColumn::Type::kColumn) {
-                const AnyColumnKey& c = column.column();
-                if (c.type() == ColumnType::kAdvice) {
-                  ++lhs_advice_cols;
-                }
-              }
-            }
-            size_t rhs_advice_cols = 0;
-            for (const RegionColumn& column : rhs.columns()) {
-              if (column.type() == RegionColumn::Type::kColumn) {
-                const AnyColumnKey& c = column.column();
-                if (c.type() == ColumnType::kAdvice) {
-                  ++rhs_advice_cols;
-                }
-              }
-            }
+  pdqsort(sorted_indices.begin(), sorted_indices.end(),
+          [&advice_areas](size_t lhs, size_t rhs) {
             // Sort by advice area (since this has the most contention).
-            return lhs_advice_cols * lhs.row_count() <
-                   rhs_advice_cols * rhs.row_count();
+            return advice_areas[lhs] < advice_areas[rhs];
           });
-  std::reverse(sorted_regions.begin(), sorted_regions.end());
+  std::reverse(sorted_indices.begin(), sorted_indices.end());
 
   // Lay out the sorted regions.
-  SlotInResult<F> result = SlotIn(sorted_regions);
-
-  // Un-sort the regions so they match the original indexing.
-  pdqsort(result.regions.begin(), result.regions.end(),
-          [](const RegionInfo<F>& lhs, const RegionInfo<F>& rhs) {
-            return lhs.region.region_index() < rhs.region.region_index();
-          });
-  std::vector<RowIndex> region_starts = base::Map(
-      result.regions,
-      [](const RegionInfo<F>& region) { return region.region_start; });
+  std::vector<std::vector<RegionColumn>> region_columns =
+      GetSortedRegionColumns<F>(region_shapes);
+  CircuitAllocations column_allocations;
+  std::vector<RowIndex> region_starts(region_shapes.size());
+  for (size_t i : sorted_indices) {
+    DCHECK_EQ(region_shapes[i].region_index(), i);
+    region_starts[i] = SlotInRegion(&column_allocations, region_columns[i],
+                                    region_shapes[i].row_count());
+  }
 
-  return {region_starts, result.column_allocations};
+  return {std::move(region_starts), std::move(column_allocations)};
 }
 
 }  // namespace tachyon::zk::plonk
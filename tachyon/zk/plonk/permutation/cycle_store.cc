@@ -6,10 +6,115 @@
 
 #include "tachyon/zk/plonk/permutation/cycle_store.h"
 
+#include <atomic>
 #include <utility>
 
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+
 namespace tachyon::zk::plonk {
 
+namespace {
+
+// A lock-free union-find over the labels, where a label (col, row) is at
+// col * rows + row. A parent always has a smaller index than its children,
+// so that the root of a set is its smallest label, and no cycle is made by
+// the threads linking the roots concurrently.
+class ConcurrentDisjointSets {
+ public:
+  explicit ConcurrentDisjointSets(size_t size) : parents_(size) {
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      parents_[i].store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // Returns the root of |i|. The path is halved on the way, which keeps the
+  // trees shallow.
+  size_t Find(size_t i) {
+    while (true) {
+      size_t parent = parents_[i].load(std::memory_order_relaxed);
+      if (parent == i) return i;
+      size_t grandparent = parents_[parent].load(std::memory_order_relaxed);
+      if (parent != grandparent) {
+        // NOTE: It's fine to fail, since another thread has already moved
+        // |i| closer to the root.
+        parents_[i].compare_exchange_weak(parent, grandparent,
+                                          std::memory_order_relaxed);
+      }
+      i = grandparent;
+    }
+  }
+
+  void Union(size_t i, size_t j) {
+    while (true) {
+      i = Find(i);
+      j = Find(j);
+      if (i == j) return;
+      if (i < j) std::swap(i, j);
+      // Link the larger root |i| under the smaller one |j|. If |i| is no
+      // longer a root, retry from the new roots.
+      size_t expected = i;
+      if (parents_[i].compare_exchange_strong(expected, j,
+                                              std::memory_order_relaxed)) {
+        return;
+      }
+    }
+  }
+
+ private:
+  std::vector<std::atomic<size_t>> parents_;
+};
+
+}  // namespace
+
+// static
+CycleStore CycleStore::Build(size_t cols, RowIndex rows,
+                             absl::Span<const std::pair<Label, Label>> copies) {
+  size_t size = cols * size_t{rows};
+  auto get_index = [rows](const Label& l) {
+    return l.col * size_t{rows} + l.row;
+  };
+  auto get_label = [rows](size_t i) {
+    return Label(i / rows, static_cast<RowIndex>(i % rows));
+  };
+
+  ConcurrentDisjointSets sets(size);
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < copies.size(); ++i) {
+    const auto& [left, right] = copies[i];
+    CHECK_LT(left.col, cols);
+    CHECK_LT(left.row, rows);
+    CHECK_LT(right.col, cols);
+    CHECK_LT(right.row, rows);
+    sets.Union(get_index(left), get_index(right));
+  }
+
+  // No more unions are made, so every path is compressed to the root.
+  std::vector<size_t> roots(size);
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) { roots[i] = sets.Find(i); }
+
+  CycleStore ret(cols, rows);
+  // The labels are chained in the order of their indices, which only takes a
+  // single pass. |lasts[root]| is the last label chained to the cycle of
+  // |root|.
+  std::vector<size_t> lasts(size);
+  for (size_t i = 0; i < size; ++i) {
+    size_t root = roots[i];
+    if (root != i) {
+      ret.mapping_[get_label(lasts[root])] = get_label(i);
+      ++ret.sizes_[get_label(root)];
+    }
+    lasts[root] = i;
+  }
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+    size_t root = roots[i];
+    Label l = get_label(i);
+    ret.aux_[l] = get_label(root);
+    // Close the cycle.
+    if (root == i) ret.mapping_[get_label(lasts[i])] = l;
+  }
+  return ret;
+}
+
 bool CycleStore::MergeCycle(const Label& label, const Label& label2) {
   Label left_cycle_base = GetCycleBase(label);
   Label right_cycle_base = GetCycleBase(label2);
@@ -7,9 +7,13 @@
 #ifndef TACHYON_ZK_PLONK_PERMUTATION_CYCLE_STORE_H_
 #define TACHYON_ZK_PLONK_PERMUTATION_CYCLE_STORE_H_
 
+#include <stddef.h>
+
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/export.h"
 #include "tachyon/zk/plonk/permutation/label.h"
@@ -99,6 +103,18 @@ class TACHYON_EXPORT CycleStore {
         cols, std::vector<size_t>(rows, size_t{1})));
   }
 
+  // Returns the store in which the labels of each pair of |copies| belong to
+  // the same cycle, which is what |MergeCycle()| produces for each pair, but
+  // the cycles are found by a lock-free union-find running in parallel.
+  //
+  // NOTE: The labels in a cycle are ordered by (col, row), and the base of a
+  // cycle is its first label. So the cycles are the same however |copies| are
+  // ordered, but they are not the ones of |MergeCycle()|, whose order
+  // depends on the order of the merges. This means that the permutations,
+  // and therefore the verifying key, are different from the ones of halo2.
+  static CycleStore Build(size_t cols, RowIndex rows,
+                          absl::Span<const std::pair<Label, Label>> copies);
+
   const Table<Label>& mapping() const { return mapping_; }
   const Table<Label>& aux() const { return aux_; }
   const Table<size_t>& sizes() const { return sizes_; }
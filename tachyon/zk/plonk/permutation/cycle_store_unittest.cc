@@ -5,6 +5,10 @@
 
 #include "tachyon/zk/plonk/permutation/cycle_store.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -50,4 +54,55 @@ TEST(CycleStoreTest, MergeCycle) {
   }
 }
 
+TEST(CycleStoreTest, Build) {
+  constexpr size_t kCols = 10;
+  constexpr RowIndex kRows = 10;
+
+  std::vector<Label> labels;
+  labels.reserve(kCols * kRows);
+  for (size_t col = 0; col < kCols; ++col) {
+    for (RowIndex row = 0; row < kRows; ++row) {
+      labels.push_back(Label(col, row));
+    }
+  }
+
+  std::vector<std::pair<Label, Label>> copies;
+  CycleStore expected(kCols, kRows);
+  for (int i = 0; i < 50; ++i) {
+    Label label = base::UniformElement(labels);
+    Label label2 = base::UniformElement(labels);
+    copies.emplace_back(label, label2);
+    expected.MergeCycle(label, label2);
+  }
+
+  CycleStore store = CycleStore::Build(kCols, kRows, copies);
+  for (const Label& label : labels) {
+    // The cycles are the same as the merged ones, but their bases are the
+    // first labels.
+    std::vector<Label> cycle = store.GetAllLabels(label);
+    EXPECT_EQ(store.GetCycleBase(label), cycle[0]);
+    EXPECT_EQ(store.GetCycleSize(label), expected.GetCycleSize(label));
+    std::vector<Label> expected_cycle = expected.GetAllLabels(label);
+    // Both end with the base again.
+    cycle.pop_back();
+    expected_cycle.pop_back();
+    EXPECT_THAT(cycle, testing::UnorderedElementsAreArray(expected_cycle));
+    EXPECT_TRUE(std::is_sorted(cycle.begin(), cycle.end(),
+                               [](const Label& a, const Label& b) {
+                                 return a.col < b.col ||
+                                        (a.col == b.col && a.row < b.row);
+                               }));
+  }
+
+  // The cycles don't depend on the order of the copies.
+  std::reverse(copies.begin(), copies.end());
+  for (std::pair<Label, Label>& copy : copies) {
+    std::swap(copy.first, copy.second);
+  }
+  CycleStore store2 = CycleStore::Build(kCols, kRows, copies);
+  EXPECT_EQ(store.mapping(), store2.mapping());
+  EXPECT_EQ(store.aux(), store2.aux());
+  EXPECT_EQ(store.sizes(), store2.sizes());
+}
+
 }  // namespace tachyon::zk::plonk
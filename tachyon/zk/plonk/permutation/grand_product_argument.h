@@ -102,18 +102,83 @@ class GrandProductArgument {
     return DoCreatePoly(prover, last_z, std::move(z));
   }
 
+  // The following functions split |CreatePolySerial()| and
+  // |CreateExcessivePoly()| into the steps before and after the batch
+  // inversion, so that the denominators of several grand products can be
+  // inverted at once by |BatchInverseScheduler|. The denominators are held at
+  // [1, n] and should be passed to the matching |Create*PolyFromInverses()|
+  // after their inversion. See |PermutationProver| for how the denominators of
+  // |CreateExcessivePoly()| are created.
+  template <typename PCS, typename Callable,
+            typename F = typename PCS::Evals::Field>
+  static std::vector<F> CreateDenominators(ProverBase<PCS>* prover,
+                                           Callable denominator_callback) {
+    // NOTE(chokobole): It's safe to downcast because domain is already checked.
+    RowIndex size = static_cast<RowIndex>(prover->pcs().N());
+    std::vector<F> z(size + 1);
+    absl::Span<F> grand_product = absl::MakeSpan(z).subspan(1);
+
+    OPENMP_PARALLEL_FOR(RowIndex i = 0; i < size; ++i) {
+      grand_product[i] = denominator_callback(i);
+    }
+    return z;
+  }
+
+  template <typename PCS, typename Callable,
+            typename Evals = typename PCS::Evals,
+            typename F = typename Evals::Field>
+  static Evals CreatePolyFromInverses(ProverBase<PCS>* prover,
+                                      Callable numerator_callback,
+                                      std::vector<F>&& z) {
+    // NOTE(chokobole): It's safe to downcast because domain is already checked.
+    RowIndex size = static_cast<RowIndex>(prover->pcs().N());
+    absl::Span<F> grand_product = absl::MakeSpan(z).subspan(1);
+
+    OPENMP_PARALLEL_FOR(RowIndex i = 0; i < size; ++i) {
+      grand_product[i] *= numerator_callback(i);
+    }
+
+    F last_z = F::One();
+    return DoCreatePoly(prover, last_z, std::move(z));
+  }
+
+  template <typename PCS, typename Callable, typename F,
+            typename Evals = typename PCS::Evals>
+  static Evals CreateExcessivePolyFromInverses(ProverBase<PCS>* prover,
+                                               Callable numerator_callback,
+                                               size_t num_cols,
+                                               std::vector<F>&& z,
+                                               F& last_z) {
+    absl::Span<F> grand_product = absl::MakeSpan(z).subspan(1);
+
+    base::Parallelize(
+        grand_product,
+        [&numerator_callback, num_cols](absl::Span<F> chunk,
+                                        size_t chunk_offset,
+                                        size_t chunk_size) {
+          RowIndex start = chunk_offset * chunk_size;
+          for (size_t j = 0; j < num_cols; ++j) {
+            for (RowIndex k = 0; k < chunk.size(); ++k) {
+              chunk[k] *= numerator_callback(j, start + k);
+            }
+          }
+        });
+
+    return DoCreatePoly(prover, last_z, std::move(z));
+  }
+
  private:
   template <typename PCS, typename F, typename Evals = typename PCS::Evals>
   static Evals DoCreatePoly(ProverBase<PCS>* prover, F& last_z,
                             std::vector<F>&& grand_product) {
     RowIndex usable_rows = prover->GetUsableRows();
 
-    // TODO(chokobole): Apply the same optimization trick used in grand sum.
-    absl::Span<F> z(grand_product);
+    // z[0] = |last_z|
+    // z[i + 1] = z[i] * grand_product[i + 1]
+    absl::Span<F> z = absl::MakeSpan(grand_product).subspan(0, usable_rows + 1);
     z[0] = last_z;
-    for (RowIndex i = 0; i < usable_rows; ++i) {
-      z[i + 1] = z[i] * grand_product[i + 1];
-    }
+    base::ParallelizeInclusiveScan(
+        z, [](const F& a, const F& b) { return a * b; });
     last_z = z[usable_rows];
     grand_product.pop_back();
 
@@ -10,6 +10,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/export.h"
@@ -55,6 +57,16 @@ class TACHYON_EXPORT PermutationAssembly {
   const std::vector<AnyColumnKey>& columns() const { return columns_; }
   const CycleStore& cycle_store() const { return cycle_store_; }
 
+  bool build_cycles_in_parallel() const { return build_cycles_in_parallel_; }
+  // If true, the copies are only recorded by |Copy()|, and the cycles are
+  // built at once by |BuildCycleStore()|, which is much faster when there are
+  // many copies. See |CycleStore::Build()| for how the cycles differ from the
+  // ones merged one at a time.
+  void set_build_cycles_in_parallel(bool build_cycles_in_parallel) {
+    CHECK(copies_.empty());
+    build_cycles_in_parallel_ = build_cycles_in_parallel;
+  }
+
   void Copy(const AnyColumnKey& left_column, RowIndex left_row,
             const AnyColumnKey& right_column, RowIndex right_row) {
     CHECK_LE(left_row, rows_);
@@ -64,10 +76,23 @@ class TACHYON_EXPORT PermutationAssembly {
     size_t left_col_idx = GetColumnIndex(left_column);
     size_t right_col_idx = GetColumnIndex(right_column);
 
+    if (build_cycles_in_parallel_) {
+      copies_.emplace_back(Label(left_col_idx, left_row),
+                           Label(right_col_idx, right_row));
+      return;
+    }
     cycle_store_.MergeCycle(Label(left_col_idx, left_row),
                             Label(right_col_idx, right_row));
   }
 
+  // Builds the cycles of the recorded copies. This must be called after the
+  // last |Copy()| if |build_cycles_in_parallel()| is true.
+  void BuildCycleStore() {
+    if (copies_.empty()) return;
+    cycle_store_ = CycleStore::Build(columns_.size(), rows_, copies_);
+    copies_ = {};
+  }
+
   // Returns |PermutationVerifyingKey| which has commitments for permutations.
   template <typename PCS, typename Evals,
             typename Commitment = typename PCS::Commitment>
@@ -93,12 +118,8 @@ class TACHYON_EXPORT PermutationAssembly {
     const Domain* domain = prover->domain();
 
     // The polynomials of permutations with coefficients.
-    std::vector<Poly> polys;
-    polys.reserve(columns_.size());
-    for (size_t i = 0; i < columns_.size(); ++i) {
-      Poly poly = domain->IFFT(permutations[i]);
-      polys.push_back(std::move(poly));
-    }
+    std::vector<Poly> polys = domain->IFFTBatch(
+        absl::MakeConstSpan(permutations).subspan(0, columns_.size()));
 
     return PermutationProvingKey<Poly, Evals>(std::move(permutations),
                                               std::move(polys));
@@ -110,6 +131,7 @@ class TACHYON_EXPORT PermutationAssembly {
   template <typename Evals, typename Domain>
   std::vector<Evals> GeneratePermutations(const Domain* domain) const {
     CHECK_EQ(domain->size(), size_t{rows_});
+    CHECK(copies_.empty()) << "BuildCycleStore() is not called";
     // TODO(chokobole): This should be changed to be created just once, but this
     // is created again in `permutation_argument_runner_impl.h`.
     UnpermutedTable<Evals> unpermuted_table =
@@ -140,6 +162,10 @@ class TACHYON_EXPORT PermutationAssembly {
   std::vector<AnyColumnKey> columns_;
   CycleStore cycle_store_;
   RowIndex rows_ = 0;
+  bool build_cycles_in_parallel_ = false;
+  // The copies recorded until |BuildCycleStore()| if
+  // |build_cycles_in_parallel_| is true.
+  std::vector<std::pair<Label, Label>> copies_;
 };
 
 }  // namespace tachyon::zk::plonk
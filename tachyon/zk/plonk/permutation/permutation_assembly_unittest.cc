@@ -78,4 +78,31 @@ TEST_F(PermutationAssemblyTest, BuildKeys) {
   }
 }
 
+TEST_F(PermutationAssemblyTest, BuildCyclesInParallel) {
+  RowIndex n = static_cast<RowIndex>(prover_->pcs().N());
+  PermutationAssembly assembly(columns_, n);
+  assembly.set_build_cycles_in_parallel(true);
+  assembly.Copy(columns_[0], 1, columns_[2], 3);
+  assembly.Copy(columns_[1], 2, columns_[2], 3);
+  assembly.Copy(columns_[3], 0, columns_[0], 0);
+  assembly.BuildCycleStore();
+
+  const CycleStore& cycle_store = assembly.cycle_store();
+  EXPECT_EQ(cycle_store.GetNextLabel(Label(0, 1)), Label(1, 2));
+  EXPECT_EQ(cycle_store.GetNextLabel(Label(1, 2)), Label(2, 3));
+  EXPECT_EQ(cycle_store.GetNextLabel(Label(2, 3)), Label(0, 1));
+  EXPECT_EQ(cycle_store.GetNextLabel(Label(0, 0)), Label(3, 0));
+  EXPECT_EQ(cycle_store.GetNextLabel(Label(3, 0)), Label(0, 0));
+  EXPECT_EQ(cycle_store.GetNextLabel(Label(1, 1)), Label(1, 1));
+
+  const Domain* domain = prover_->domain();
+  std::vector<Evals> permutations =
+      assembly.GeneratePermutations<Evals>(domain);
+  UnpermutedTable<Evals> unpermuted_table =
+      UnpermutedTable<Evals>::Construct(columns_.size(), n, domain);
+  EXPECT_EQ(permutations[0][1], unpermuted_table[Label(1, 2)]);
+  EXPECT_EQ(permutations[2][3], unpermuted_table[Label(0, 1)]);
+  EXPECT_EQ(permutations[3][0], unpermuted_table[Label(0, 0)]);
+}
+
 }  // namespace tachyon::zk::plonk
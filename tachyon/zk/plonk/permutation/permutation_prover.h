@@ -9,20 +9,22 @@
 
 #include <stddef.h>
 
-#include <functional>
 #include <vector>
 
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/plonk/base/batch_inverse_scheduler.h"
 #include "tachyon/zk/plonk/base/multi_phase_ref_table.h"
 #include "tachyon/zk/plonk/permutation/permutation_argument.h"
 #include "tachyon/zk/plonk/permutation/permutation_opening_point_set.h"
 #include "tachyon/zk/plonk/permutation/permutation_proving_key.h"
 #include "tachyon/zk/plonk/permutation/permutation_table_store.h"
 
-namespace tachyon::zk::plonk {
+namespace tachyon {
+namespace zk::plonk {
 
 template <typename Poly, typename Evals>
 class PermutationProver {
@@ -93,10 +95,32 @@ class PermutationProver {
       std::vector<crypto::PolynomialOpening<Poly>>& openings);
 
  private:
+  friend class base::Copyable<PermutationProver<Poly, Evals>>;
+
+  // The products of the numerators and the denominators of Zₚ,ᵢ over the
+  // columns of a chunk.
+  struct GrandProductFractions {
+    // Πⱼ (vⱼ(ωᵏ) + β * δʲ * ωᵏ + γ) at k.
+    std::vector<F> numerators;
+    // Πⱼ (vⱼ(ωᵏ) + β * sⱼ(ωᵏ) + γ) at k + 1, whose first element is a
+    // placeholder for the running product.
+    std::vector<F> denominators;
+  };
+
+  // Computes the products of the numerators and the denominators of Zₚ,ᵢ for
+  // every chunk index i in a single row-major pass over the columns of the
+  // chunk, and adds the denominators to |scheduler|. They should be passed to
+  // |CreateGrandProductPolys()| after |scheduler| is run.
   template <typename PCS>
-  void CreateGrandProductPolys(ProverBase<PCS>* prover,
-                               const PermutationTableStore<Evals>& table_store,
-                               size_t chunk_num, const F& beta, const F& gamma);
+  static std::vector<GrandProductFractions> CreateGrandProductFractions(
+      ProverBase<PCS>* prover, const PermutationTableStore<Evals>& table_store,
+      size_t chunk_num, const F& beta, const F& gamma,
+      BatchInverseScheduler<F>& scheduler);
+
+  template <typename PCS>
+  void CreateGrandProductPolys(
+      ProverBase<PCS>* prover, size_t chunk_num,
+      std::vector<GrandProductFractions>&& fractions_list);
 
   template <typename Domain>
   void TransformEvalsToPoly(const Domain* domain);
@@ -105,21 +129,35 @@ class PermutationProver {
   void Evaluate(ProverBase<PCS>* prover,
                 const PermutationOpeningPointSet<F>& point_set) const;
 
-  static std::function<F(size_t, RowIndex)> CreateNumeratorCallback(
-      const std::vector<base::Ref<const Evals>>& unpermuted_columns,
-      const std::vector<base::Ref<const Evals>>& value_columns, const F& beta,
-      const F& gamma);
-
-  static std::function<F(size_t, RowIndex)> CreateDenominatorCallback(
-      const std::vector<base::Ref<const Evals>>& permuted_columns,
-      const std::vector<base::Ref<const Evals>>& value_columns, const F& beta,
-      const F& gamma);
-
   // Zₚ,ᵢ(X)
   std::vector<BlindedPolynomial<Poly, Evals>> grand_product_polys_;
 };
 
-}  // namespace tachyon::zk::plonk
+}  // namespace zk::plonk
+
+namespace base {
+
+template <typename Poly, typename Evals>
+class Copyable<zk::plonk::PermutationProver<Poly, Evals>> {
+ public:
+  static bool WriteTo(const zk::plonk::PermutationProver<Poly, Evals>& prover,
+                      Buffer* buffer) {
+    return buffer->Write(prover.grand_product_polys_);
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       zk::plonk::PermutationProver<Poly, Evals>* prover) {
+    return buffer.Read(&prover->grand_product_polys_);
+  }
+
+  static size_t EstimateSize(
+      const zk::plonk::PermutationProver<Poly, Evals>& prover) {
+    return base::EstimateSize(prover.grand_product_polys_);
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
 
 #include "tachyon/zk/plonk/permutation/permutation_prover_impl.h"
 
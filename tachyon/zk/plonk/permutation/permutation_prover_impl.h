@@ -10,7 +10,9 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/ref.h"
 #include "tachyon/zk/plonk/permutation/grand_product_argument.h"
 #include "tachyon/zk/plonk/permutation/permutation_prover.h"
@@ -18,30 +20,75 @@
 
 namespace tachyon::zk::plonk {
 
+// static
 template <typename Poly, typename Evals>
 template <typename PCS>
-void PermutationProver<Poly, Evals>::CreateGrandProductPolys(
+std::vector<typename PermutationProver<Poly, Evals>::GrandProductFractions>
+PermutationProver<Poly, Evals>::CreateGrandProductFractions(
     ProverBase<PCS>* prover, const PermutationTableStore<Evals>& table_store,
-    size_t chunk_num, const F& beta, const F& gamma) {
+    size_t chunk_num, const F& beta, const F& gamma,
+    BatchInverseScheduler<F>& scheduler) {
+  // NOTE(chokobole): It's safe to downcast because domain is already checked.
+  RowIndex size = static_cast<RowIndex>(prover->pcs().N());
+  std::vector<GrandProductFractions> fractions_list = base::CreateVector(
+      chunk_num, [size, &table_store, &beta, &gamma](size_t i) {
+        auto to_evaluations = [](const base::Ref<const Evals>& column) {
+          return &column->evaluations();
+        };
+        std::vector<const std::vector<F>*> unpermuted_columns =
+            base::Map(table_store.GetUnpermutedColumns(i), to_evaluations);
+        std::vector<const std::vector<F>*> permuted_columns =
+            base::Map(table_store.GetPermutedColumns(i), to_evaluations);
+        std::vector<const std::vector<F>*> value_columns =
+            base::Map(table_store.GetValueColumns(i), to_evaluations);
+
+        GrandProductFractions fractions{std::vector<F>(size),
+                                        std::vector<F>(size + 1, F::One())};
+        absl::Span<F> denominators =
+            absl::MakeSpan(fractions.denominators).subspan(1);
+        // NOTE: Every value vⱼ(ωᵏ) + γ is shared by the numerator and the
+        // denominator, so a row of every column of the chunk is read once.
+        OPENMP_PARALLEL_FOR(RowIndex k = 0; k < size; ++k) {
+          F numerator = F::One();
+          F denominator = F::One();
+          for (size_t j = 0; j < value_columns.size(); ++j) {
+            F value = (*value_columns[j])[k] + gamma;
+            // vⱼ(ωᵏ) + β * δʲ * ωᵏ + γ
+            numerator *= value + beta * (*unpermuted_columns[j])[k];
+            // vⱼ(ωᵏ) + β * sⱼ(ωᵏ) + γ
+            denominator *= value + beta * (*permuted_columns[j])[k];
+          }
+          fractions.numerators[k] = std::move(numerator);
+          denominators[k] = std::move(denominator);
+        }
+        return fractions;
+      });
+  for (GrandProductFractions& fractions : fractions_list) {
+    scheduler.Add(absl::MakeSpan(fractions.denominators).subspan(1));
+  }
+  return fractions_list;
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS>
+void PermutationProver<Poly, Evals>::CreateGrandProductPolys(
+    ProverBase<PCS>* prover, size_t chunk_num,
+    std::vector<GrandProductFractions>&& fractions_list) {
+  CHECK_EQ(fractions_list.size(), chunk_num);
   grand_product_polys_.reserve(chunk_num);
 
   // Track the "last" value from the previous column set.
   F last_z = F::One();
 
   for (size_t i = 0; i < chunk_num; ++i) {
-    std::vector<base::Ref<const Evals>> permuted_columns =
-        table_store.GetPermutedColumns(i);
-    std::vector<base::Ref<const Evals>> unpermuted_columns =
-        table_store.GetUnpermutedColumns(i);
-    std::vector<base::Ref<const Evals>> value_columns =
-        table_store.GetValueColumns(i);
-
-    size_t chunk_size = table_store.GetChunkSize(i);
-    Evals grand_product_poly = GrandProductArgument::CreateExcessivePoly(
-        prover,
-        CreateNumeratorCallback(unpermuted_columns, value_columns, beta, gamma),
-        CreateDenominatorCallback(permuted_columns, value_columns, beta, gamma),
-        chunk_size, last_z);
+    std::vector<F> numerators = std::move(fractions_list[i].numerators);
+    Evals grand_product_poly =
+        GrandProductArgument::CreateExcessivePolyFromInverses(
+            prover,
+            [&numerators](size_t, RowIndex row_index) {
+              return numerators[row_index];
+            },
+            1, std::move(fractions_list[i].denominators), last_z);
 
     grand_product_polys_.emplace_back(std::move(grand_product_poly),
                                       prover->blinder().Generate());
@@ -68,15 +115,35 @@ void PermutationProver<Poly, Evals>::BatchCreateGrandProductPolys(
   size_t chunk_len = ComputePermutationChunkLength(constraint_system_degree);
   size_t chunk_num = (argument.columns().size() + chunk_len - 1) / chunk_len;
 
-  UnpermutedTable<Evals> unpermuted_table = UnpermutedTable<Evals>::Construct(
-      argument.columns().size(), prover->pcs().N(), prover->domain());
+  CHECK_EQ(permutation_proving_key.permutations().size(),
+           argument.columns().size());
+  const UnpermutedTable<Evals>& unpermuted_table =
+      permutation_proving_key.GetUnpermutedTable(prover->domain());
   PermutedTable<Evals> permuted_table(&permutation_proving_key.permutations());
+  std::vector<PermutationTableStore<Evals>> table_stores = base::Map(
+      tables, [&argument, &permuted_table, &unpermuted_table,
+               chunk_len](const MultiPhaseRefTable<Evals>& table) {
+        return PermutationTableStore<Evals>(argument.columns(), table,
+                                            permuted_table, unpermuted_table,
+                                            chunk_len);
+      });
+
+  // The denominators of every column set of every circuit are inverted at
+  // once, rather than per column set. The table of δʲ * ωᵏ above is cached in
+  // the key and shared by every circuit.
+  BatchInverseScheduler<F> scheduler;
+  std::vector<std::vector<GrandProductFractions>> fractions_lists = base::Map(
+      table_stores,
+      [prover, chunk_num, &beta, &gamma,
+       &scheduler](const PermutationTableStore<Evals>& table_store) {
+        return CreateGrandProductFractions(prover, table_store, chunk_num,
+                                           beta, gamma, scheduler);
+      });
+  CHECK(scheduler.Run());
+
   for (size_t i = 0; i < tables.size(); ++i) {
-    PermutationTableStore<Evals> table_store(argument.columns(), tables[i],
-                                             permuted_table, unpermuted_table,
-                                             chunk_len);
-    permutation_provers[i].CreateGrandProductPolys(prover, table_store,
-                                                   chunk_num, beta, gamma);
+    permutation_provers[i].CreateGrandProductPolys(
+        prover, chunk_num, std::move(fractions_lists[i]));
   }
 }
 
@@ -89,12 +156,16 @@ void PermutationProver<Poly, Evals>::BatchCommitGrandProductPolys(
   if (permutation_provers.empty()) return;
 
   if constexpr (PCS::kSupportsBatchMode) {
+    std::vector<const Evals*> evals_list;
+    evals_list.reserve(GetNumGrandProductPolysCommitments(permutation_provers));
     for (const PermutationProver& permutation_prover : permutation_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_product_poly :
            permutation_prover.grand_product_polys_) {
-        prover->BatchCommitAt(grand_product_poly.evals(), commit_idx++);
+        evals_list.push_back(&grand_product_poly.evals());
       }
     }
+    prover->BatchCommitAllAt(evals_list, commit_idx);
+    commit_idx += evals_list.size();
   } else {
     for (const PermutationProver& permutation_prover : permutation_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_product_poly :
@@ -109,10 +180,12 @@ template <typename Poly, typename Evals>
 template <typename Domain>
 void PermutationProver<Poly, Evals>::TransformEvalsToPoly(
     const Domain* domain) {
-  for (BlindedPolynomial<Poly, Evals>& grand_product_poly :
-       grand_product_polys_) {
-    grand_product_poly.TransformEvalsToPoly(domain);
-  }
+  BlindedPolynomial<Poly, Evals>::TransformEvalsToPoly(
+      base::Map(grand_product_polys_,
+                [](BlindedPolynomial<Poly, Evals>& grand_product_poly) {
+                  return &grand_product_poly;
+                }),
+      domain);
 }
 
 template <typename Poly, typename Evals>
@@ -196,38 +269,6 @@ void PermutationProver<Poly, Evals>::OpenPermutationProvingKey(
 #undef OPENING
 }
 
-// static
-template <typename Poly, typename Evals>
-std::function<typename Poly::Field(size_t, RowIndex)>
-PermutationProver<Poly, Evals>::CreateNumeratorCallback(
-    const std::vector<base::Ref<const Evals>>& unpermuted_columns,
-    const std::vector<base::Ref<const Evals>>& value_columns, const F& beta,
-    const F& gamma) {
-  // vᵢ(ωʲ) + β * δⁱ * ωʲ + γ
-  return [&unpermuted_columns, &value_columns, &beta, &gamma](
-             size_t column_index, RowIndex row_index) {
-    const Evals& unpermuted_values = *unpermuted_columns[column_index];
-    const Evals& values = *value_columns[column_index];
-    return values[row_index] + beta * unpermuted_values[row_index] + gamma;
-  };
-}
-
-// static
-template <typename Poly, typename Evals>
-std::function<typename Poly::Field(size_t, RowIndex)>
-PermutationProver<Poly, Evals>::CreateDenominatorCallback(
-    const std::vector<base::Ref<const Evals>>& permuted_columns,
-    const std::vector<base::Ref<const Evals>>& value_columns, const F& beta,
-    const F& gamma) {
-  // vᵢ(ωʲ) + β * sᵢ(ωʲ) + γ
-  return [&permuted_columns, &value_columns, &beta, &gamma](
-             size_t column_index, RowIndex row_index) {
-    const Evals& permuted_values = *permuted_columns[column_index];
-    const Evals& values = *value_columns[column_index];
-    return values[row_index] + beta * permuted_values[row_index] + gamma;
-  };
-}
-
 }  // namespace tachyon::zk::plonk
 
 #endif  // TACHYON_ZK_PLONK_PERMUTATION_PERMUTATION_PROVER_IMPL_H_
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "tachyon/base/buffer/copyable.h"
+#include "tachyon/zk/plonk/permutation/unpermuted_table.h"
 
 namespace tachyon {
 namespace zk::plonk {
@@ -30,6 +31,24 @@ class PermutationProvingKey {
   const std::vector<Poly>& polys() const { return polys_; }
   std::vector<Poly>& polys() { return polys_; }
 
+  // Returns the |UnpermutedTable| of the columns of |permutations()| over
+  // |domain|, i.e, the evaluations δʲωⁱ of the identity permutation. It doesn't
+  // depend on the witness, so it is constructed on the first call and shared
+  // by the proofs with this key afterwards. This takes as much memory as
+  // |permutations()|.
+  // NOTE: This is not thread-safe, so it should be called once before the
+  // key is shared by provers running concurrently.
+  template <typename Domain>
+  const UnpermutedTable<Evals>& GetUnpermutedTable(
+      const Domain* domain) const {
+    if (!unpermuted_table_constructed_) {
+      unpermuted_table_ = UnpermutedTable<Evals>::Construct(
+          permutations_.size(), domain->size(), domain);
+      unpermuted_table_constructed_ = true;
+    }
+    return unpermuted_table_;
+  }
+
   size_t BytesLength() const { return base::EstimateSize(this); }
 
   bool operator==(const PermutationProvingKey& other) const {
@@ -42,6 +61,10 @@ class PermutationProvingKey {
  private:
   std::vector<Evals> permutations_;
   std::vector<Poly> polys_;
+  // NOTE: These are mutable since they are cached by the const
+  // |GetUnpermutedTable()|.
+  mutable UnpermutedTable<Evals> unpermuted_table_;
+  mutable bool unpermuted_table_constructed_ = false;
 };
 
 }  // namespace zk::plonk
@@ -53,4 +53,29 @@ TEST_F(PermutationProvingKeyTest, Copyable) {
   EXPECT_EQ(value, expected);
 }
 
+TEST_F(PermutationProvingKeyTest, GetUnpermutedTable) {
+  constexpr static size_t N = 32;
+  constexpr static size_t kMaxDegree = N - 1;
+
+  using Domain = math::UnivariateEvaluationDomain<F, kMaxDegree>;
+  using Poly = Domain::DensePoly;
+  using Evals = Domain::Evals;
+  using ProvingKey = PermutationProvingKey<Poly, Evals>;
+
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+
+  ProvingKey proving_key({domain->Random<Evals>(), domain->Random<Evals>(),
+                          domain->Random<Evals>()},
+                         {domain->Random<Poly>(), domain->Random<Poly>(),
+                          domain->Random<Poly>()});
+
+  const UnpermutedTable<Evals>& unpermuted_table =
+      proving_key.GetUnpermutedTable(domain.get());
+  UnpermutedTable<Evals> expected =
+      UnpermutedTable<Evals>::Construct(3, N, domain.get());
+  EXPECT_EQ(unpermuted_table.table(), expected.table());
+  // The table is constructed only once.
+  EXPECT_EQ(&proving_key.GetUnpermutedTable(domain.get()), &unpermuted_table);
+}
+
 }  // namespace tachyon::zk::plonk
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "tachyon/base/containers/adapters.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/zk/plonk/base/l_values.h"
 #include "tachyon/zk/plonk/constraint_system/constraint_system.h"
@@ -22,11 +23,44 @@ namespace tachyon::zk::plonk {
 template <typename F, typename C>
 class PermutationVerifier {
  public:
+  // The values of |Evaluate()| that only depend on the constraint system, so
+  // that they can be computed once for many proofs.
+  struct Constants {
+    size_t chunk_len = 0;
+    // The query indices of the columns of the permutation at |Rotation::Cur()|.
+    std::vector<size_t> query_indices;
+    // δ^(i * |chunk_len|) for the i-th chunk.
+    std::vector<F> chunk_delta_powers;
+
+    static Constants Create(const ConstraintSystem<F>& constraint_system) {
+      Constants ret;
+      ret.chunk_len = constraint_system.ComputePermutationChunkLen();
+      const std::vector<AnyColumnKey>& columns =
+          constraint_system.permutation().columns();
+      ret.query_indices = base::Map(columns, [&constraint_system](
+                                                 const AnyColumnKey& column) {
+        return constraint_system.GetAnyQueryIndex(column, Rotation::Cur());
+      });
+      size_t num_chunks = (columns.size() + ret.chunk_len - 1) / ret.chunk_len;
+      ret.chunk_delta_powers = F::GetSuccessivePowers(
+          num_chunks, GetDelta<F>().Pow(ret.chunk_len));
+      return ret;
+    }
+  };
+
   explicit PermutationVerifier(const PermutationVerifierData<F, C>& data)
       : data_(data) {}
 
   void Evaluate(const ConstraintSystem<F>& constraint_system, const F& x,
                 const LValues<F>& l_values, std::vector<F>& evals) const {
+    Evaluate(constraint_system, Constants::Create(constraint_system), x,
+             l_values, evals);
+  }
+
+  // Same as above, but with the |constants| computed beforehand.
+  void Evaluate(const ConstraintSystem<F>& constraint_system,
+                const Constants& constants, const F& x,
+                const LValues<F>& l_values, std::vector<F>& evals) const {
     if (data_.grand_product_evals.empty()) return;
 
     // l_first(x) * (1 - Zₚ,₀(x)) = 0
@@ -49,24 +83,25 @@ class PermutationVerifier {
     size_t chunk_idx = 0;
     const F& delta = GetDelta<F>();
     F active_rows = F::One() - (l_values.last + l_values.blind);
-    size_t chunk_len = constraint_system.ComputePermutationChunkLen();
+    size_t chunk_len = constants.chunk_len;
+    F beta_x = data_.beta * x;
     for (absl::Span<const AnyColumnKey> columns :
          base::Chunked(argument.columns(), chunk_len)) {
+      size_t offset = chunk_idx * chunk_len;
       absl::Span<const F> substitution_evals_chunk =
-          data_.substitution_evals.subspan(chunk_idx * chunk_len,
-                                           columns.size());
+          data_.substitution_evals.subspan(offset, columns.size());
       F left = data_.grand_product_next_evals[chunk_idx];
       for (size_t i = 0; i < columns.size(); ++i) {
-        const AnyColumnKey& column = columns[i];
-        const F& eval = GetEval(constraint_system, column);
+        const F& eval =
+            GetEval(columns[i], constants.query_indices[offset + i]);
         left *= eval + data_.beta * substitution_evals_chunk[i] + data_.gamma;
       }
 
       F right = data_.grand_product_evals[chunk_idx];
-      F current_delta = data_.beta * x * delta.Pow(chunk_idx * chunk_len);
+      F current_delta = beta_x * constants.chunk_delta_powers[chunk_idx];
       for (size_t i = 0; i < columns.size(); ++i) {
-        const AnyColumnKey& column = columns[i];
-        const F& eval = GetEval(constraint_system, column);
+        const F& eval =
+            GetEval(columns[i], constants.query_indices[offset + i]);
         right *= eval + current_delta + data_.gamma;
         current_delta *= delta;
       }
@@ -115,8 +150,7 @@ class PermutationVerifier {
   }
 
  private:
-  const F& GetEval(const ConstraintSystem<F>& constraint_system,
-                   const AnyColumnKey& column) const {
+  const F& GetEval(const AnyColumnKey& column, size_t query_index) const {
     const absl::Span<const F>* evals = nullptr;
     switch (column.type()) {
       case ColumnType::kAdvice: {
@@ -135,8 +169,7 @@ class PermutationVerifier {
         NOTREACHED();
       }
     }
-    return (
-        *evals)[constraint_system.GetAnyQueryIndex(column, Rotation::Cur())];
+    return (*evals)[query_index];
   }
 
   const PermutationVerifierData<F, C>& data_;
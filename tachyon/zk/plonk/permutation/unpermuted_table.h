@@ -7,6 +7,7 @@
 #ifndef TACHYON_ZK_PLONK_PERMUTATION_UNPERMUTED_TABLE_H_
 #define TACHYON_ZK_PLONK_PERMUTATION_UNPERMUTED_TABLE_H_
 
+#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -62,19 +63,25 @@ class UnpermutedTable {
     // The δ is g^2ˢ with order T where modulus = 2ˢ * T + 1.
     F delta = GetDelta<F>();
 
-    Table unpermuted_table;
-    unpermuted_table.reserve(cols);
-    // Assign [δ⁰ω⁰, δ⁰ω¹, δ⁰ω², ..., δ⁰ωⁿ⁻¹] to the first col.
-    unpermuted_table.push_back(Evals(std::move(omega_powers)));
-
+    // NOTE: Each col is computed from δⁱ rather than from the previous col, so
+    // that all the cols are computed in parallel.
+    std::vector<F> delta_powers = F::GetSuccessivePowers(cols, delta);
+    std::vector<std::vector<F>> cols_tmp(cols, std::vector<F>(rows));
     // Assign [δⁱω⁰, δⁱω¹, δⁱω², ..., δⁱωⁿ⁻¹] to each col.
-    for (size_t i = 1; i < cols; ++i) {
-      std::vector<F> col(rows);
-      OPENMP_PARALLEL_FOR(RowIndex j = 0; j < rows; ++j) {
-        col[j] = unpermuted_table[i - 1][j] * delta;
+    OPENMP_PARALLEL_NESTED_FOR(size_t i = 1; i < cols; ++i) {
+      for (RowIndex j = 0; j < rows; ++j) {
+        cols_tmp[i][j] = omega_powers[j] * delta_powers[i];
       }
-      unpermuted_table.push_back(Evals(std::move(col)));
     }
+    if (cols != 0) {
+      // Assign [δ⁰ω⁰, δ⁰ω¹, δ⁰ω², ..., δ⁰ωⁿ⁻¹] to the first col.
+      cols_tmp[0] = std::move(omega_powers);
+    }
+
+    Table unpermuted_table =
+        base::Map(std::make_move_iterator(cols_tmp.begin()),
+                  std::make_move_iterator(cols_tmp.end()),
+                  [](std::vector<F>&& col) { return Evals(std::move(col)); });
     return UnpermutedTable(std::move(unpermuted_table));
   }
 
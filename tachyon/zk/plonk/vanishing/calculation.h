@@ -20,6 +20,13 @@
 
 namespace tachyon::zk::plonk {
 
+template <typename F>
+class CompiledGraphEvaluator;
+template <typename F>
+class GraphEvaluatorCodegen;
+template <typename F>
+class GraphEvaluatorGpu;
+
 class TACHYON_EXPORT Calculation {
  public:
   enum class Type {
@@ -62,6 +69,8 @@ class TACHYON_EXPORT Calculation {
     return Calculation(Type::kStore, value);
   }
 
+  Type type() const { return type_; }
+
   bool operator==(const Calculation& other) const {
     return type_ == other.type_ && pair_ == other.pair_ &&
            value_ == other.value_ && horner_ == other.horner_;
@@ -107,6 +116,13 @@ class TACHYON_EXPORT Calculation {
   std::string ToString() const;
 
  private:
+  template <typename F>
+  friend class CompiledGraphEvaluator;
+  template <typename F>
+  friend class GraphEvaluatorCodegen;
+  template <typename F>
+  friend class GraphEvaluatorGpu;
+
   struct Pair {
     ValueSource left;
     ValueSource right;
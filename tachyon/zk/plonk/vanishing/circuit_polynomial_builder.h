@@ -7,14 +7,20 @@
 #ifndef TACHYON_ZK_PLONK_VANISHING_CIRCUIT_POLYNOMIAL_BUILDER_H_
 #define TACHYON_ZK_PLONK_VANISHING_CIRCUIT_POLYNOMIAL_BUILDER_H_
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "absl/types/span.h"
 
 #include "tachyon/base/containers/adapters.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/memory/vector_pool.h"
 #include "tachyon/base/numerics/checked_math.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/parallelize.h"
 #include "tachyon/base/types/always_false.h"
 #include "tachyon/zk/base/rotation.h"
@@ -24,8 +30,11 @@
 #include "tachyon/zk/plonk/base/column_key.h"
 #include "tachyon/zk/plonk/base/owned_table.h"
 #include "tachyon/zk/plonk/base/ref_table.h"
+#include "tachyon/zk/plonk/keys/fixed_cosets.h"
 #include "tachyon/zk/plonk/keys/proving_key_forward.h"
 #include "tachyon/zk/plonk/permutation/permutation_prover.h"
+#include "tachyon/zk/plonk/permutation/unpermuted_table.h"
+#include "tachyon/zk/plonk/vanishing/compiled_graph_evaluator.h"
 #include "tachyon/zk/plonk/vanishing/evaluation_input.h"
 #include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
 #include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
@@ -48,6 +57,11 @@ class CircuitPolynomialBuilder {
   using ExtendedEvals = typename PCS::ExtendedEvals;
   using LookupProver = typename LS::Prover;
   using LookupEvaluator = typename LS::Evaluator;
+  // Overwrites |chunk| with the custom gates of the rows from |start|, which
+  // takes |chunk| as the previous values. See
+  // |VanishingArgument::SetSpecializedCustomGates()|.
+  using SpecializedCustomGates = std::function<void(
+      const EvaluationInput<Evals>& input, size_t start, absl::Span<F> chunk)>;
 
   CircuitPolynomialBuilder(
       const F& omega, const F& extended_omega, const F& theta, const F& beta,
@@ -85,10 +99,16 @@ class CircuitPolynomialBuilder {
     builder.num_parts_ = extended_domain->size() >> domain->log_size_of_group();
     builder.chunk_len_ = cs_degree - 2;
 
-    builder.delta_ = GetDelta<F>();
-
     builder.last_rotation_ = Rotation(last_row);
     builder.delta_start_ = beta * zeta;
+    if (!proving_key.verifying_key()
+             .constraint_system()
+             .permutation()
+             .columns()
+             .empty()) {
+      builder.unpermuted_table_ =
+          &proving_key.permutation_proving_key().GetUnpermutedTable(domain);
+    }
     return builder;
   }
 
@@ -96,61 +116,79 @@ class CircuitPolynomialBuilder {
     current_extended_omega_ *= extended_omega_;
   }
 
+  // When |parallel_parts| is true, |BuildExtendedCircuitColumn()| evaluates
+  // as many parts at once as there are threads, each with its own cosets,
+  // instead of evaluating one part at a time over all the threads. The number
+  // of parts evaluated at once is further limited so that their cosets fit in
+  // |memory_budget| bytes, where 0 means that there is no limit.
+  void set_parallel_parts(bool parallel_parts) {
+    parallel_parts_ = parallel_parts;
+  }
+  void set_memory_budget(size_t memory_budget) {
+    memory_budget_ = memory_budget;
+  }
+
+  // When |compile_custom_gates| is true, the custom gates are evaluated by a
+  // |CompiledGraphEvaluator| over blocks of rows instead of row by row.
+  void set_compile_custom_gates(bool compile_custom_gates) {
+    compile_custom_gates_ = compile_custom_gates;
+  }
+
+  // When |specialized_custom_gates| is set, the custom gates are evaluated by
+  // it instead of |GraphEvaluator| or |CompiledGraphEvaluator|.
+  void set_specialized_custom_gates(
+      SpecializedCustomGates specialized_custom_gates) {
+    specialized_custom_gates_ = std::move(specialized_custom_gates);
+  }
+
+  // When the custom gates are compiled and their column queries of a circuit
+  // fit in |row_blocked_table_budget| bytes, they are materialized into a row
+  // blocked table for each circuit of each part, so that a block of rows
+  // reads contiguous memory. See
+  // |CompiledGraphEvaluator::MaterializeRowBlockedTable()|. 0, which is the
+  // default, disables it.
+  // NOTE: Each of the parts built concurrently holds its own table.
+  void set_row_blocked_table_budget(size_t row_blocked_table_budget) {
+    row_blocked_table_budget_ = row_blocked_table_budget;
+  }
+
   // Returns an evaluation-formed polynomial as below.
   // - gate₀(X) + y * gate₁(X) + ... + yⁱ * gateᵢ(X) + ...
   ExtendedEvals BuildExtendedCircuitColumn(
       const GraphEvaluator<F>& custom_gate_evaluator,
       LookupEvaluator& lookup_evaluator) {
-    std::vector<std::vector<F>> value_parts;
-    value_parts.reserve(num_parts_);
-    // Calculate the quotient polynomial for each part
-    for (size_t i = 0; i < num_parts_; ++i) {
-      VLOG(1) << "BuildExtendedCircuitColumn part: (" << i + 1 << " / "
-              << num_parts_ << ")";
-
-      coset_domain_ = domain_->GetCoset(zeta_ * current_extended_omega_);
-
-      UpdateLPolys();
-
-      std::vector<F> value_part(static_cast<size_t>(n_));
-      size_t circuit_num = poly_tables_.size();
-      for (size_t j = 0; j < circuit_num; ++j) {
-        VLOG(1) << "BuildExtendedCircuitColumn part: " << i << " circuit: ("
-                << j + 1 << " / " << circuit_num << ")";
-        UpdateTable(j);
-        // Do iff there are permutation constraints.
-        if (permutation_provers_[j].grand_product_polys().size() > 0)
-          UpdatePermutationCosets(j);
-        // Do iff there are lookup constraints.
-        size_t lookup_polys_num = 0;
-        if constexpr (LS::type == lookup::Type::kHalo2) {
-          lookup_polys_num = lookup_provers_[j].grand_product_polys().size();
-        } else if constexpr (LS::type == lookup::Type::kLogDerivativeHalo2) {
-          lookup_polys_num = lookup_provers_[j].grand_sum_polys().size();
-        } else {
-          static_assert(base::AlwaysFalse<LS>);
-        }
-
-        if (lookup_polys_num > 0) lookup_evaluator.UpdateLookupCosets(*this, j);
-        base::Parallelize(
-            value_part,
-            [this, &custom_gate_evaluator, &lookup_evaluator](
-                absl::Span<F> chunk, size_t chunk_offset, size_t chunk_size) {
-              UpdateChunkByCustomGates(custom_gate_evaluator, chunk,
-                                       chunk_offset, chunk_size);
-              UpdateChunkByPermutation(chunk, chunk_offset, chunk_size);
-              lookup_evaluator.UpdateChunkByLookups(*this, chunk, chunk_offset,
-                                                    chunk_size);
-            });
-      }
-
-      value_parts.push_back(std::move(value_part));
-      UpdateCurrentExtendedOmega();
-    }
+    std::vector<std::vector<F>> value_parts(num_parts_);
+    BuildParts(custom_gate_evaluator, lookup_evaluator,
+               [&value_parts](size_t part, std::vector<F>&& value_part) {
+                 value_parts[part] = std::move(value_part);
+               });
     std::vector<F> extended = BuildExtendedColumnWithColumns(value_parts);
+    for (std::vector<F>& value_part : value_parts) {
+      base::VectorPool<F>::GetDefault().Release(std::move(value_part));
+    }
     return ExtendedEvals(std::move(extended));
   }
 
+  // Returns the first |num_pieces| * n coefficients of the circuit polynomial
+  // divided by t(X) = Xⁿ - 1 before the powers of ζ are distributed, which
+  // |DivideByVanishingPolyInPlace()| and |ExtendedToCoeff()| return from
+  // |BuildExtendedCircuitColumn()|. Each part is interpolated into them as
+  // soon as it is built, so that the extended evaluations are never held at
+  // once. See |AccumulateExtendedCoeffsByPart()|.
+  std::vector<F> BuildExtendedCircuitCoeffs(
+      const GraphEvaluator<F>& custom_gate_evaluator,
+      LookupEvaluator& lookup_evaluator, size_t num_pieces) {
+    CHECK_LE(num_pieces, num_parts_);
+    std::vector<F> coeffs(num_pieces * static_cast<size_t>(n_), F::Zero());
+    BuildParts(custom_gate_evaluator, lookup_evaluator,
+               [this, &coeffs](size_t part, std::vector<F>&& value_part) {
+                 AccumulateExtendedCoeffsByPart(std::move(value_part), part,
+                                                num_parts_, extended_omega_,
+                                                domain_, coeffs);
+               });
+    return coeffs;
+  }
+
   void UpdateChunkByPermutation(absl::Span<F> chunk, size_t chunk_offset,
                                 size_t chunk_size) {
     if (permutation_product_cosets_.empty()) return;
@@ -172,7 +210,6 @@ class CircuitPolynomialBuilder {
                   [](absl::Span<const Evals> chunk) { return chunk; });
 
     size_t start = chunk_offset * chunk_size;
-    F beta_term = current_extended_omega_ * omega_.Pow(start);
     for (size_t i = 0; i < chunk.size(); ++i) {
       size_t idx = start + i;
 
@@ -197,18 +234,16 @@ class CircuitPolynomialBuilder {
 
       // And for all the sets we enforce: (1 - (l_last(X) + l_blind(X))) *
       // (zⱼ(wX) * Πⱼ(p(X) + βsⱼ(X) + γ) - zⱼ(X) Πⱼ(p(X) + δʲβX + γ))
-      F current_delta = delta_start_ * beta_term;
       RowIndex r_next = Rotation(1).GetIndex(idx, /*scale=*/1, n_);
 
       for (size_t j = 0; j < product_cosets.size(); ++j) {
         F left = CalculateLeft(column_chunks[j], coset_chunks[j], idx,
                                product_cosets[j][r_next]);
-        F right = CalculateRight(column_chunks[j], current_delta, idx,
+        F right = CalculateRight(column_chunks[j], j * chunk_len_, idx,
                                  product_cosets[j][idx]);
         chunk[i] *= y_;
         chunk[i] += (left - right) * l_active_row_[idx];
       }
-      beta_term *= omega_;
     }
   }
 
@@ -216,6 +251,203 @@ class CircuitPolynomialBuilder {
   friend class lookup::halo2::Evaluator<F, Evals>;
   friend class lookup::log_derivative_halo2::Evaluator<F, Evals>;
 
+  // Returns the part of the circuit polynomial over the coset
+  // ζ * ωₑⁱ * H, where ωₑ is the generator of the extended domain and
+  // |current_extended_omega_| is ωₑⁱ.
+  std::vector<F> BuildPart(size_t part,
+                           const GraphEvaluator<F>& custom_gate_evaluator,
+                           LookupEvaluator& lookup_evaluator) {
+    VLOG(1) << "BuildExtendedCircuitColumn part: (" << part + 1 << " / "
+            << num_parts_ << ")";
+
+    coset_domain_ = domain_->GetCoset(zeta_ * current_extended_omega_);
+    fixed_cosets_ = GetFixedCosets(part);
+    coset_delta_start_ = delta_start_ * current_extended_omega_;
+
+    UpdateLPolys();
+
+    // NOTE: The storage is reused from the previous parts or proofs, so it
+    // is zeroed by the first circuit instead of being zero-initialized.
+    std::vector<F> value_part =
+        base::VectorPool<F>::GetDefault().Acquire(static_cast<size_t>(n_));
+    size_t circuit_num = poly_tables_.size();
+    if (circuit_num == 0) {
+      std::fill(value_part.begin(), value_part.end(), F::Zero());
+    }
+    for (size_t j = 0; j < circuit_num; ++j) {
+      VLOG(1) << "BuildExtendedCircuitColumn part: " << part << " circuit: ("
+              << j + 1 << " / " << circuit_num << ")";
+      UpdateTable(j);
+      if (use_row_blocked_table_) {
+        compiled_custom_gates_->MaterializeRowBlockedTable(
+            ExtractEvaluationInput(std::vector<F>(), std::vector<int32_t>()),
+            /*scale=*/1, &row_blocked_table_);
+      }
+      // Do iff there are permutation constraints.
+      if (permutation_provers_[j].grand_product_polys().size() > 0)
+        UpdatePermutationCosets(j);
+      // Do iff there are lookup constraints.
+      if (GetNumLookups(j) > 0) lookup_evaluator.UpdateLookupCosets(*this, j);
+      base::Parallelize(
+          value_part,
+          [this, &custom_gate_evaluator, &lookup_evaluator, j](
+              absl::Span<F> chunk, size_t chunk_offset, size_t chunk_size) {
+            if (j == 0) std::fill(chunk.begin(), chunk.end(), F::Zero());
+            UpdateChunkByCustomGates(custom_gate_evaluator, chunk,
+                                     chunk_offset, chunk_size);
+            UpdateChunkByPermutation(chunk, chunk_offset, chunk_size);
+            lookup_evaluator.UpdateChunkByLookups(*this, chunk, chunk_offset,
+                                                  chunk_size);
+          });
+    }
+    return value_part;
+  }
+
+  // Builds every part and passes it to |callback| in order, which takes the
+  // index of the part and its values.
+  template <typename Callback>
+  void BuildParts(const GraphEvaluator<F>& custom_gate_evaluator,
+                  LookupEvaluator& lookup_evaluator, Callback callback) {
+    if (compile_custom_gates_ && !specialized_custom_gates_) {
+      compiled_custom_gates_ =
+          CompiledGraphEvaluator<F>::Compile(custom_gate_evaluator);
+      size_t table_size = compiled_custom_gates_->EstimateRowBlockedTableSize(
+          static_cast<size_t>(n_));
+      use_row_blocked_table_ = row_blocked_table_budget_ != 0 &&
+                               table_size <= row_blocked_table_budget_;
+      VLOG(1) << "Row blocked table of "
+              << compiled_custom_gates_->num_queries() << " queries ("
+              << table_size << " bytes): "
+              << (use_row_blocked_table_ ? "enabled" : "disabled");
+    }
+
+    size_t num_concurrent_parts = ComputeNumConcurrentParts();
+    if (num_concurrent_parts > 1) {
+      BuildPartsConcurrently(custom_gate_evaluator, lookup_evaluator,
+                             num_concurrent_parts, callback);
+      return;
+    }
+
+    // Calculate the quotient polynomial for each part
+    for (size_t i = 0; i < num_parts_; ++i) {
+      callback(i, BuildPart(i, custom_gate_evaluator, lookup_evaluator));
+      UpdateCurrentExtendedOmega();
+    }
+  }
+
+  // Evaluates |num_concurrent_parts| parts at a time, each on a single thread
+  // with its own builder and lookup evaluator, which are reused by the next
+  // parts so that no more cosets than that are alive at once.
+  template <typename Callback>
+  void BuildPartsConcurrently(const GraphEvaluator<F>& custom_gate_evaluator,
+                              const LookupEvaluator& lookup_evaluator,
+                              size_t num_concurrent_parts,
+                              Callback& callback) {
+    std::vector<CircuitPolynomialBuilder> builders;
+    builders.reserve(num_concurrent_parts);
+    for (size_t i = 0; i < num_concurrent_parts; ++i) {
+      builders.push_back(CreatePartBuilder());
+    }
+    std::vector<LookupEvaluator> lookup_evaluators(num_concurrent_parts,
+                                                   lookup_evaluator);
+
+    std::vector<std::vector<F>> value_parts(num_concurrent_parts);
+    for (size_t start = 0; start < num_parts_; start += num_concurrent_parts) {
+      size_t len = std::min(num_concurrent_parts, num_parts_ - start);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < len; ++i) {
+        size_t part = start + i;
+        builders[i].current_extended_omega_ = extended_omega_.Pow(part);
+        value_parts[i] = builders[i].BuildPart(part, custom_gate_evaluator,
+                                               lookup_evaluators[i]);
+      }
+      for (size_t i = 0; i < len; ++i) {
+        callback(start + i, std::move(value_parts[i]));
+      }
+    }
+  }
+
+  // Returns a builder sharing the inputs of this one, whose cosets are
+  // computed separately.
+  CircuitPolynomialBuilder CreatePartBuilder() const {
+    CircuitPolynomialBuilder builder(
+        omega_, extended_omega_, theta_, beta_, gamma_, y_, zeta_,
+        proving_key_, permutation_provers_, lookup_provers_, poly_tables_);
+    builder.domain_ = domain_;
+    builder.n_ = n_;
+    builder.num_parts_ = num_parts_;
+    builder.chunk_len_ = chunk_len_;
+    builder.last_rotation_ = last_rotation_;
+    builder.delta_start_ = delta_start_;
+    builder.unpermuted_table_ = unpermuted_table_;
+    builder.specialized_custom_gates_ = specialized_custom_gates_;
+    builder.compiled_custom_gates_ = compiled_custom_gates_;
+    builder.use_row_blocked_table_ = use_row_blocked_table_;
+    return builder;
+  }
+
+  size_t ComputeNumConcurrentParts() const {
+    if (!parallel_parts_) return 1;
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif
+    size_t num_concurrent_parts = std::min(num_parts_, thread_nums);
+    if (memory_budget_ != 0) {
+      size_t part_memory = EstimatePartMemory();
+      if (part_memory != 0) {
+        num_concurrent_parts =
+            std::min(num_concurrent_parts, memory_budget_ / part_memory);
+      }
+    }
+    return num_concurrent_parts;
+  }
+
+  // Returns the size in bytes of the cosets that a part holds at once, which
+  // are the L polynomials, the columns, the permutation cosets and the lookup
+  // cosets of the largest circuit, and of its row blocked table if any.
+  size_t EstimatePartMemory() const {
+    size_t lookup_cosets_per_lookup = 0;
+    if constexpr (LS::type == lookup::Type::kHalo2) {
+      lookup_cosets_per_lookup = 3;
+    } else if constexpr (LS::type == lookup::Type::kLogDerivativeHalo2) {
+      lookup_cosets_per_lookup = 2;
+    } else {
+      static_assert(base::AlwaysFalse<LS>);
+    }
+
+    size_t num_cosets = 0;
+    for (size_t i = 0; i < poly_tables_.size(); ++i) {
+      const MultiPhaseRefTable<Poly>& poly_table = poly_tables_[i];
+      num_cosets = std::max(
+          num_cosets,
+          poly_table.GetFixedColumns().size() +
+              poly_table.GetAdviceColumns().size() +
+              poly_table.GetInstanceColumns().size() +
+              permutation_provers_[i].grand_product_polys().size() +
+              GetNumLookups(i) * lookup_cosets_per_lookup);
+    }
+    num_cosets += proving_key_.permutation_proving_key().polys().size();
+    // |l_first_|, |l_last_| and |l_active_row_|
+    num_cosets += 3;
+    size_t part_memory = num_cosets * static_cast<size_t>(n_) * sizeof(F);
+    if (use_row_blocked_table_) {
+      part_memory += compiled_custom_gates_->EstimateRowBlockedTableSize(
+          static_cast<size_t>(n_));
+    }
+    return part_memory;
+  }
+
+  size_t GetNumLookups(size_t circuit_idx) const {
+    if constexpr (LS::type == lookup::Type::kHalo2) {
+      return lookup_provers_[circuit_idx].grand_product_polys().size();
+    } else if constexpr (LS::type == lookup::Type::kLogDerivativeHalo2) {
+      return lookup_provers_[circuit_idx].grand_sum_polys().size();
+    } else {
+      static_assert(base::AlwaysFalse<LS>);
+    }
+  }
+
   EvaluationInput<Evals> ExtractEvaluationInput(
       std ::vector<F>&& intermediates, std::vector<int32_t>&& rotations) {
     return EvaluationInput<Evals>(std::move(intermediates),
@@ -234,13 +466,19 @@ class CircuitPolynomialBuilder {
     return left;
   }
 
+  // The identity permutation over the coset is δʲβ * ζ * ωₑᵖᵃʳᵗ * ωⁱ, which
+  // is |coset_delta_start_| times δʲωⁱ of |unpermuted_table_|. This reads
+  // the table rather than accumulating δ column by column, so that the terms
+  // of the columns don't depend on each other.
   template <typename Evals>
   F CalculateRight(const std::vector<base::Ref<const Evals>>& column_chunk,
-                   F& current_delta, size_t idx, const F& initial_value) {
+                   size_t column_offset, size_t idx, const F& initial_value) {
+    const std::vector<Evals>& identities = unpermuted_table_->table();
     F right = initial_value;
     for (size_t i = 0; i < column_chunk.size(); ++i) {
-      right *= (*column_chunk[i])[idx] + current_delta + gamma_;
-      current_delta *= delta_;
+      right *= (*column_chunk[i])[idx] +
+               coset_delta_start_ * identities[column_offset + i][idx] +
+               gamma_;
     }
     return right;
   }
@@ -248,17 +486,50 @@ class CircuitPolynomialBuilder {
   void UpdateChunkByCustomGates(const GraphEvaluator<F>& custom_gate_evaluator,
                                 absl::Span<F> chunk, size_t chunk_offset,
                                 size_t chunk_size) {
+    size_t start = chunk_offset * chunk_size;
+    if (specialized_custom_gates_) {
+      specialized_custom_gates_(
+          ExtractEvaluationInput(std::vector<F>(), std::vector<int32_t>()),
+          start, chunk);
+      return;
+    }
+    if (compiled_custom_gates_.has_value()) {
+      EvaluationInput<Evals> evaluation_input =
+          ExtractEvaluationInput(std::vector<F>(), std::vector<int32_t>());
+      compiled_custom_gates_->Evaluate(evaluation_input, start, /*scale=*/1,
+                                       chunk, row_blocked_table_);
+      return;
+    }
+
     EvaluationInput<Evals> evaluation_input = ExtractEvaluationInput(
         custom_gate_evaluator.CreateInitialIntermediates(),
         custom_gate_evaluator.CreateEmptyRotations());
-    size_t start = chunk_offset * chunk_size;
     for (size_t i = 0; i < chunk.size(); ++i) {
       chunk[i] = custom_gate_evaluator.Evaluate(evaluation_input, start + i,
                                                 /*scale=*/1, chunk[i]);
     }
   }
 
+  // Returns the cosets of |part| precomputed by
+  // |ProvingKey::PrecomputeFixedCosets()|, or nullptr if they are not
+  // precomputed for the domains of this builder.
+  const FixedCosets<Evals>* GetFixedCosets(size_t part) const {
+    const std::vector<FixedCosets<Evals>>& fixed_cosets =
+        proving_key_.fixed_cosets();
+    if (fixed_cosets.size() != num_parts_) return nullptr;
+    if (fixed_cosets[part].l_first.NumElements() != static_cast<size_t>(n_)) {
+      return nullptr;
+    }
+    return &fixed_cosets[part];
+  }
+
   void UpdateLPolys() {
+    if (fixed_cosets_) {
+      l_first_ = fixed_cosets_->l_first;
+      l_last_ = fixed_cosets_->l_last;
+      l_active_row_ = fixed_cosets_->l_active_row;
+      return;
+    }
     l_first_ = coset_domain_->FFT(proving_key_.l_first());
     l_last_ = coset_domain_->FFT(proving_key_.l_last());
     l_active_row_ = coset_domain_->FFT(proving_key_.l_active_row());
@@ -267,51 +538,48 @@ class CircuitPolynomialBuilder {
   void UpdatePermutationCosets(size_t circuit_idx) {
     const std::vector<BlindedPolynomial<Poly, Evals>>& grand_product_polys =
         permutation_provers_[circuit_idx].grand_product_polys();
-    permutation_product_cosets_.resize(grand_product_polys.size());
-    for (size_t i = 0; i < grand_product_polys.size(); ++i) {
-      permutation_product_cosets_[i] =
-          coset_domain_->FFT(grand_product_polys[i].poly());
-    }
-
-    const std::vector<Poly>& polys =
-        proving_key_.permutation_proving_key().polys();
-    permutation_cosets_.resize(polys.size());
-    for (size_t i = 0; i < polys.size(); ++i) {
-      permutation_cosets_[i] = coset_domain_->FFT(polys[i]);
+    std::vector<const Poly*> grand_product_poly_ptrs = base::Map(
+        grand_product_polys,
+        [](const BlindedPolynomial<Poly, Evals>& grand_product_poly) {
+          return &grand_product_poly.poly();
+        });
+    UpdateCosets(grand_product_poly_ptrs, permutation_product_cosets_);
+
+    if (fixed_cosets_) {
+      permutation_cosets_ = fixed_cosets_->permutation_columns;
+      return;
     }
+    UpdateCosets(
+        absl::MakeConstSpan(proving_key_.permutation_proving_key().polys()),
+        permutation_cosets_);
   }
 
   void UpdateTable(size_t circuit_idx) {
-    absl::Span<const Poly> new_fixed_columns =
-        poly_tables_[circuit_idx].GetFixedColumns();
-    std::vector<Evals>& fixed_columns = table_.fixed_columns();
-    fixed_columns.resize(new_fixed_columns.size());
-    for (size_t i = 0; i < new_fixed_columns.size(); ++i) {
-      fixed_columns[i] = coset_domain_->FFT(new_fixed_columns[i]);
-    }
-
-    absl::Span<const Poly> new_advice_columns =
-        poly_tables_[circuit_idx].GetAdviceColumns();
-    std::vector<Evals>& advice_columns = table_.advice_columns();
-    advice_columns.resize(new_advice_columns.size());
-    for (size_t i = 0; i < new_advice_columns.size(); ++i) {
-      advice_columns[i] = coset_domain_->FFT(new_advice_columns[i]);
-    }
-
-    absl::Span<const Poly> new_instance_columns =
-        poly_tables_[circuit_idx].GetInstanceColumns();
-    std::vector<Evals>& instance_columns = table_.instance_columns();
-    instance_columns.resize(new_instance_columns.size());
-    for (size_t i = 0; i < new_instance_columns.size(); ++i) {
-      instance_columns[i] = coset_domain_->FFT(new_instance_columns[i]);
+    const MultiPhaseRefTable<Poly>& poly_table = poly_tables_[circuit_idx];
+    if (fixed_cosets_) {
+      table_.fixed_columns() = fixed_cosets_->fixed_columns;
+    } else {
+      UpdateCosets(poly_table.GetFixedColumns(), table_.fixed_columns());
     }
+    UpdateCosets(poly_table.GetAdviceColumns(), table_.advice_columns());
+    UpdateCosets(poly_table.GetInstanceColumns(), table_.instance_columns());
 
     table_.set_challenges(poly_tables_[circuit_idx].challenges());
   }
 
+  // Replaces |cosets| with the coset FFTs of |polys|. The previous cosets are
+  // released first, so that they don't coexist with the new ones.
+  template <typename Polys>
+  void UpdateCosets(const Polys& polys, std::vector<Evals>& cosets) const {
+    cosets.clear();
+    cosets = coset_domain_->FFTBatch(polys);
+  }
+
   // not owned
   const Domain* domain_ = nullptr;
   std::unique_ptr<Domain> coset_domain_;
+  // The cosets of the current part precomputed in |proving_key_|, or nullptr.
+  const FixedCosets<Evals>* fixed_cosets_ = nullptr;
 
   F one_ = F::One();
   F current_extended_omega_ = F::One();
@@ -321,14 +589,28 @@ class CircuitPolynomialBuilder {
   size_t chunk_len_ = 0;
   const F& omega_;
   const F& extended_omega_;
-  F delta_;
   const F& theta_;
   const F& beta_;
   const F& gamma_;
   const F& y_;
   const F& zeta_;
   Rotation last_rotation_;
+  // β * ζ
   F delta_start_;
+  // β * ζ * ωₑᵖᵃʳᵗ of the current part.
+  F coset_delta_start_;
+  // The δʲωⁱ cached in |proving_key_|, or nullptr without permutation
+  // columns. See |PermutationProvingKey::GetUnpermutedTable()|.
+  const UnpermutedTable<Evals>* unpermuted_table_ = nullptr;
+  bool parallel_parts_ = false;
+  size_t memory_budget_ = 0;
+  SpecializedCustomGates specialized_custom_gates_;
+  bool compile_custom_gates_ = false;
+  std::optional<CompiledGraphEvaluator<F>> compiled_custom_gates_;
+  size_t row_blocked_table_budget_ = 0;
+  bool use_row_blocked_table_ = false;
+  // Empty unless |use_row_blocked_table_| is true.
+  std::vector<F> row_blocked_table_;
 
   const ProvingKey<LS>& proving_key_;
   const std::vector<PermutationProver<Poly, Evals>>& permutation_provers_;
@@ -0,0 +1,388 @@
+#ifndef TACHYON_ZK_PLONK_VANISHING_COMPILED_GRAPH_EVALUATOR_H_
+#define TACHYON_ZK_PLONK_VANISHING_COMPILED_GRAPH_EVALUATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/zk/base/rotation.h"
+#include "tachyon/zk/plonk/vanishing/calculation.h"
+#include "tachyon/zk/plonk/vanishing/evaluation_input.h"
+#include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
+#include "tachyon/zk/plonk/vanishing/value_source.h"
+
+namespace tachyon::zk::plonk {
+
+// |CompiledGraphEvaluator| evaluates the calculations of a |GraphEvaluator|
+// over a block of rows at once instead of row by row. Each calculation runs
+// as a loop over the rows of the block, the rotated row indices are computed
+// once per block and the operands are resolved to pointers once per block, so
+// the interpreter dispatch and the |Rotation::GetIndex()| per row are gone.
+//
+// Optionally, the column queries of the calculations can be materialized into
+// a row blocked table, an array of the blocks of |kBlockSize| rows, each of
+// which holds the rotated values of every query one after another. A block of
+// rows then reads a single contiguous range of memory instead of a range of
+// every column, and the rotations never wrap around within a block. See
+// |MaterializeRowBlockedTable()|.
+template <typename F>
+class CompiledGraphEvaluator {
+ public:
+  constexpr static size_t kBlockSize = 128;
+
+  CompiledGraphEvaluator() = default;
+
+  static CompiledGraphEvaluator Compile(const GraphEvaluator<F>& graph) {
+    CompiledGraphEvaluator compiled;
+    compiled.constants_ = graph.constants();
+    compiled.rotations_ = graph.rotations();
+    compiled.num_intermediates_ = graph.num_intermediates();
+    compiled.instructions_.reserve(graph.calculations().size());
+    for (const CalculationInfo& info : graph.calculations()) {
+      const Calculation& calculation = info.calculation;
+      Instruction instruction;
+      instruction.type = calculation.type();
+      instruction.target = info.target;
+      switch (calculation.type()) {
+        case Calculation::Type::kAdd:
+        case Calculation::Type::kSub:
+        case Calculation::Type::kMul:
+          instruction.operands = {calculation.pair().left,
+                                  calculation.pair().right};
+          break;
+        case Calculation::Type::kSquare:
+        case Calculation::Type::kDouble:
+        case Calculation::Type::kNegate:
+        case Calculation::Type::kStore:
+          instruction.operands = {calculation.value()};
+          break;
+        case Calculation::Type::kHorner: {
+          // The operands are the initial value, the factor and the parts.
+          const Calculation::HornerData& horner = calculation.horner();
+          instruction.operands.reserve(horner.parts.size() + 2);
+          instruction.operands.push_back(horner.init);
+          instruction.operands.push_back(horner.factor);
+          instruction.operands.insert(instruction.operands.end(),
+                                      horner.parts.begin(), horner.parts.end());
+          break;
+        }
+      }
+      instruction.query_slots = base::Map(
+          instruction.operands, [&compiled](const ValueSource& operand) {
+            return compiled.GetOrAddQuerySlot(operand);
+          });
+      compiled.max_operands_ =
+          std::max(compiled.max_operands_, instruction.operands.size());
+      compiled.instructions_.push_back(std::move(instruction));
+    }
+    return compiled;
+  }
+
+  size_t num_intermediates() const { return num_intermediates_; }
+  // Returns the number of the distinct column queries of the calculations.
+  size_t num_queries() const { return queries_.size(); }
+
+  // Returns the size in bytes of the row blocked table of |n| rows.
+  size_t EstimateRowBlockedTableSize(size_t n) const {
+    size_t num_blocks = (n + kBlockSize - 1) / kBlockSize;
+    return num_blocks * queries_.size() * kBlockSize * sizeof(F);
+  }
+
+  // Materializes the values of the column queries of |data| into |table|,
+  // where the value of the q-th query at the i-th row of the b-th block is at
+  // (b * |num_queries()| + q) * |kBlockSize| + i. The storage of |table| is
+  // reused if it is large enough.
+  template <typename Evals, typename Table>
+  void MaterializeRowBlockedTable(const EvaluationInput<Evals, Table>& data,
+                                  int32_t scale, std::vector<F>* table) const {
+    size_t n = static_cast<size_t>(data.n());
+    size_t num_blocks = (n + kBlockSize - 1) / kBlockSize;
+    table->resize(num_blocks * queries_.size() * kBlockSize);
+    OPENMP_PARALLEL_FOR(size_t b = 0; b < num_blocks; ++b) {
+      size_t start = b * kBlockSize;
+      size_t len = std::min(kBlockSize, n - start);
+      F* block = &(*table)[b * queries_.size() * kBlockSize];
+      for (size_t q = 0; q < queries_.size(); ++q) {
+        const ValueSource& query = queries_[q];
+        const Evals& column = GetColumn(data, query);
+        const std::vector<F>& evaluations = column.evaluations();
+        RowIndex rotated_start =
+            Rotation(rotations_[query.rotation_index()])
+                .GetIndex(start, scale, data.n());
+        F* values = &block[q * kBlockSize];
+        if (rotated_start + len <= evaluations.size()) {
+          std::copy_n(evaluations.begin() + rotated_start, len, values);
+        } else {
+          for (size_t i = 0; i < len; ++i) {
+            values[i] = column[(rotated_start + i) % n];
+          }
+        }
+      }
+    }
+  }
+
+  // Replaces |values[i]| with the evaluation at the (|start| + i)-th row,
+  // where |values[i]| is the previous value of the row. It is the same as
+  // calling |GraphEvaluator::Evaluate()| for each row. If |row_blocked_table|
+  // is not empty, it must be the one materialized from |data| with the same
+  // |scale|, from which the column queries are read.
+  template <typename Evals, typename Table>
+  void Evaluate(const EvaluationInput<Evals, Table>& data, size_t start,
+                int32_t scale, absl::Span<F> values,
+                absl::Span<const F> row_blocked_table = {}) const {
+    if (instructions_.empty()) {
+      std::fill(values.begin(), values.end(), F::Zero());
+      return;
+    }
+
+    BlockScratch scratch;
+    scratch.intermediates.resize(num_intermediates_ * kBlockSize);
+    scratch.gathered.resize(max_operands_ * kBlockSize);
+    scratch.rotated_starts.resize(rotations_.size());
+    size_t result = instructions_.back().target * kBlockSize;
+    // The blocks are aligned to the multiples of |kBlockSize|, so that each of
+    // them lies within a block of the row blocked table.
+    size_t offset = 0;
+    while (offset < values.size()) {
+      size_t row = start + offset;
+      size_t len =
+          std::min(kBlockSize - row % kBlockSize, values.size() - offset);
+      absl::Span<F> block = values.subspan(offset, len);
+      if (!row_blocked_table.empty()) {
+        scratch.row_blocked_block =
+            &row_blocked_table[row / kBlockSize * queries_.size() *
+                                   kBlockSize +
+                               row % kBlockSize];
+      }
+      EvaluateBlock(data, row, scale, block, scratch);
+      std::copy_n(scratch.intermediates.begin() + result, block.size(),
+                  block.begin());
+      offset += len;
+    }
+  }
+
+ private:
+  constexpr static size_t kNoQuerySlot = std::numeric_limits<size_t>::max();
+
+  struct Instruction {
+    Calculation::Type type;
+    size_t target;
+    std::vector<ValueSource> operands;
+    // The index of each operand in |queries_|, or |kNoQuerySlot| if it is not
+    // a column query.
+    std::vector<size_t> query_slots;
+  };
+
+  // The values of an operand over a block, where the i-th value is at
+  // |ptr[i * stride]|. The stride is 0 for the operands that are the same for
+  // every row.
+  struct Lane {
+    const F* ptr;
+    size_t stride;
+
+    const F& operator[](size_t i) const { return ptr[i * stride]; }
+  };
+
+  struct BlockScratch {
+    std::vector<F> intermediates;
+    // The rotated values of the columns whose rows wrap around in a block.
+    std::vector<F> gathered;
+    std::vector<RowIndex> rotated_starts;
+    // The first row of the block in the row blocked table, if any.
+    const F* row_blocked_block = nullptr;
+  };
+
+  template <typename Evals, typename Table>
+  void EvaluateBlock(const EvaluationInput<Evals, Table>& data, size_t start,
+                     int32_t scale, absl::Span<const F> previous_values,
+                     BlockScratch& scratch) const {
+    for (size_t i = 0; i < rotations_.size(); ++i) {
+      scratch.rotated_starts[i] =
+          Rotation(rotations_[i]).GetIndex(start, scale, data.n());
+    }
+
+    size_t len = previous_values.size();
+    for (const Instruction& instruction : instructions_) {
+      F* out = &scratch.intermediates[instruction.target * kBlockSize];
+      auto get = [this, &data, &previous_values, &scratch, &instruction,
+                  len](size_t i) -> Lane {
+        if (scratch.row_blocked_block != nullptr &&
+            instruction.query_slots[i] != kNoQuerySlot) {
+          return {scratch.row_blocked_block +
+                      instruction.query_slots[i] * kBlockSize,
+                  1};
+        }
+        return Resolve(data, instruction.operands[i], i, len, previous_values,
+                       scratch);
+      };
+      switch (instruction.type) {
+        case Calculation::Type::kAdd: {
+          Lane left = get(0);
+          Lane right = get(1);
+          for (size_t i = 0; i < len; ++i) out[i] = left[i] + right[i];
+          break;
+        }
+        case Calculation::Type::kSub: {
+          Lane left = get(0);
+          Lane right = get(1);
+          for (size_t i = 0; i < len; ++i) out[i] = left[i] - right[i];
+          break;
+        }
+        case Calculation::Type::kMul: {
+          Lane left = get(0);
+          Lane right = get(1);
+          for (size_t i = 0; i < len; ++i) out[i] = left[i] * right[i];
+          break;
+        }
+        case Calculation::Type::kSquare: {
+          Lane value = get(0);
+          for (size_t i = 0; i < len; ++i) out[i] = value[i].Square();
+          break;
+        }
+        case Calculation::Type::kDouble: {
+          Lane value = get(0);
+          for (size_t i = 0; i < len; ++i) out[i] = value[i].Double();
+          break;
+        }
+        case Calculation::Type::kNegate: {
+          Lane value = get(0);
+          for (size_t i = 0; i < len; ++i) out[i] = -value[i];
+          break;
+        }
+        case Calculation::Type::kStore: {
+          Lane value = get(0);
+          for (size_t i = 0; i < len; ++i) out[i] = value[i];
+          break;
+        }
+        case Calculation::Type::kHorner: {
+          Lane init = get(0);
+          Lane factor = get(1);
+          for (size_t i = 0; i < len; ++i) out[i] = init[i];
+          for (size_t j = 2; j < instruction.operands.size(); ++j) {
+            Lane part = get(j);
+            for (size_t i = 0; i < len; ++i) {
+              out[i] *= factor[i];
+              out[i] += part[i];
+            }
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  // Returns the values of |source| over the block. A column is read in place
+  // unless its rotated rows wrap around in the block, in which case they are
+  // gathered into the |operand_idx|-th slot of |scratch.gathered|.
+  template <typename Evals, typename Table>
+  Lane Resolve(const EvaluationInput<Evals, Table>& data,
+               const ValueSource& source, size_t operand_idx, size_t len,
+               absl::Span<const F> previous_values,
+               BlockScratch& scratch) const {
+    switch (source.type()) {
+      case ValueSource::Type::kConstant:
+        return {&constants_[source.index()], 0};
+      case ValueSource::Type::kIntermediate:
+        return {&scratch.intermediates[source.index() * kBlockSize], 1};
+      case ValueSource::Type::kChallenge:
+        return {&data.table().challenges()[source.index()], 0};
+      case ValueSource::Type::kFixed:
+        return ResolveColumn(
+            data.table().GetFixedColumns()[source.column_index()],
+            scratch.rotated_starts[source.rotation_index()], operand_idx, len,
+            data.n(), scratch);
+      case ValueSource::Type::kAdvice:
+        return ResolveColumn(
+            data.table().GetAdviceColumns()[source.column_index()],
+            scratch.rotated_starts[source.rotation_index()], operand_idx, len,
+            data.n(), scratch);
+      case ValueSource::Type::kInstance:
+        return ResolveColumn(
+            data.table().GetInstanceColumns()[source.column_index()],
+            scratch.rotated_starts[source.rotation_index()], operand_idx, len,
+            data.n(), scratch);
+      case ValueSource::Type::kBeta:
+        return {&data.beta(), 0};
+      case ValueSource::Type::kGamma:
+        return {&data.gamma(), 0};
+      case ValueSource::Type::kTheta:
+        return {&data.theta(), 0};
+      case ValueSource::Type::kY:
+        return {&data.y(), 0};
+      case ValueSource::Type::kPreviousValue:
+        return {previous_values.data(), 1};
+    }
+    NOTREACHED();
+    return {nullptr, 0};
+  }
+
+  // Returns the index of |operand| in |queries_|, which is added if it is a
+  // column query that is not there yet.
+  size_t GetOrAddQuerySlot(const ValueSource& operand) {
+    switch (operand.type()) {
+      case ValueSource::Type::kFixed:
+      case ValueSource::Type::kAdvice:
+      case ValueSource::Type::kInstance:
+        break;
+      default:
+        return kNoQuerySlot;
+    }
+    auto it = std::find(queries_.begin(), queries_.end(), operand);
+    if (it != queries_.end()) return it - queries_.begin();
+    queries_.push_back(operand);
+    return queries_.size() - 1;
+  }
+
+  template <typename Evals, typename Table>
+  static const Evals& GetColumn(const EvaluationInput<Evals, Table>& data,
+                                const ValueSource& query) {
+    switch (query.type()) {
+      case ValueSource::Type::kFixed:
+        return data.table().GetFixedColumns()[query.column_index()];
+      case ValueSource::Type::kAdvice:
+        return data.table().GetAdviceColumns()[query.column_index()];
+      case ValueSource::Type::kInstance:
+        return data.table().GetInstanceColumns()[query.column_index()];
+      default:
+        break;
+    }
+    NOTREACHED();
+    return data.table().GetFixedColumns()[0];
+  }
+
+  template <typename Evals>
+  static Lane ResolveColumn(const Evals& column, RowIndex rotated_start,
+                            size_t operand_idx, size_t len, int32_t n,
+                            BlockScratch& scratch) {
+    const std::vector<F>& evaluations = column.evaluations();
+    if (rotated_start + len <= evaluations.size()) {
+      return {&evaluations[rotated_start], 1};
+    }
+    F* gathered = &scratch.gathered[operand_idx * kBlockSize];
+    for (size_t i = 0; i < len; ++i) {
+      gathered[i] = column[(rotated_start + i) % static_cast<size_t>(n)];
+    }
+    return {gathered, 1};
+  }
+
+  std::vector<F> constants_;
+  std::vector<int32_t> rotations_;
+  std::vector<Instruction> instructions_;
+  // The distinct column queries of |instructions_|.
+  std::vector<ValueSource> queries_;
+  size_t num_intermediates_ = 0;
+  size_t max_operands_ = 0;
+};
+
+}  // namespace tachyon::zk::plonk
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_COMPILED_GRAPH_EVALUATOR_H_
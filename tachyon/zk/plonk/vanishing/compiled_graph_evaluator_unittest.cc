@@ -0,0 +1,168 @@
+#include "tachyon/zk/plonk/vanishing/compiled_graph_evaluator.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+#include "tachyon/zk/plonk/base/multi_phase_owned_table.h"
+
+namespace tachyon::zk::plonk {
+
+namespace {
+
+using F = math::GF7;
+
+// Spans 3 blocks, the last of which is partial.
+constexpr size_t kN = 300;
+
+using Evals = math::UnivariateEvaluations<F, kN - 1>;
+using Expr = std::unique_ptr<Expression<F>>;
+
+class CompiledGraphEvaluatorTest : public math::FiniteFieldTest<F> {
+ public:
+  void SetUp() override {
+    auto create_columns = [](size_t num_columns) {
+      return base::CreateVector(num_columns, []() {
+        return Evals(base::CreateVector(kN, []() { return F::Random(); }));
+      });
+    };
+    challenges_ = {F::Random(), F::Random()};
+    table_ = MultiPhaseOwnedTable<Evals>(create_columns(2), create_columns(2),
+                                         create_columns(1), challenges_);
+    theta_ = F::Random();
+    beta_ = F::Random();
+    gamma_ = F::Random();
+    y_ = F::Random();
+
+    // (a₀(ωX) * f₁(X) + 3 * i₀(ω⁻¹X) - c₁)² and 2 * a₁(ω²X) - f₀(X) + β are
+    // combined by the Horner's rule with y like the custom gates.
+    Expr gate0 = ExpressionFactory<F>::Product(
+        ExpressionFactory<F>::Advice(
+            AdviceQuery(0, Rotation(1), AdviceColumnKey(0))),
+        ExpressionFactory<F>::Fixed(
+            FixedQuery(0, Rotation(0), FixedColumnKey(1))));
+    gate0 = ExpressionFactory<F>::Sum(
+        std::move(gate0),
+        ExpressionFactory<F>::Scaled(
+            ExpressionFactory<F>::Instance(
+                InstanceQuery(0, Rotation(-1), InstanceColumnKey(0))),
+            F(3)));
+    gate0 = ExpressionFactory<F>::Sum(
+        std::move(gate0),
+        ExpressionFactory<F>::Negated(
+            ExpressionFactory<F>::Challenge(Challenge(1, Phase(0)))));
+    Expr gate1 = ExpressionFactory<F>::Product(
+        ExpressionFactory<F>::Constant(F(2)),
+        ExpressionFactory<F>::Advice(
+            AdviceQuery(1, Rotation(2), AdviceColumnKey(1))));
+    gate1 = ExpressionFactory<F>::Sum(
+        std::move(gate1),
+        ExpressionFactory<F>::Negated(ExpressionFactory<F>::Fixed(
+            FixedQuery(1, Rotation(0), FixedColumnKey(0)))));
+
+    ValueSource part0 = graph_.AddExpression(gate0.get());
+    part0 = graph_.AddCalculation(Calculation::Square(part0));
+    ValueSource part1 = graph_.AddExpression(gate1.get());
+    part1 =
+        graph_.AddCalculation(Calculation::Add(part1, ValueSource::Beta()));
+    graph_.AddCalculation(Calculation::Horner(ValueSource::PreviousValue(),
+                                              {part0, part1},
+                                              ValueSource::Y()));
+  }
+
+ protected:
+  EvaluationInput<Evals> CreateEvaluationInput() const {
+    return EvaluationInput<Evals>(graph_.CreateInitialIntermediates(),
+                                  graph_.CreateEmptyRotations(), table_,
+                                  theta_, beta_, gamma_, y_, kN);
+  }
+
+  GraphEvaluator<F> graph_;
+  std::vector<F> challenges_;
+  MultiPhaseOwnedTable<Evals> table_;
+  F theta_;
+  F beta_;
+  F gamma_;
+  F y_;
+};
+
+}  // namespace
+
+TEST_F(CompiledGraphEvaluatorTest, Evaluate) {
+  CompiledGraphEvaluator<F> compiled =
+      CompiledGraphEvaluator<F>::Compile(graph_);
+  EXPECT_EQ(compiled.num_intermediates(), graph_.num_intermediates());
+
+  std::vector<F> previous_values =
+      base::CreateVector(kN, []() { return F::Random(); });
+  EvaluationInput<Evals> evaluation_input = CreateEvaluationInput();
+  std::vector<F> expected = base::CreateVector(
+      kN, [this, &evaluation_input, &previous_values](size_t i) {
+        return graph_.Evaluate(evaluation_input, i, /*scale=*/1,
+                               previous_values[i]);
+      });
+
+  // Start at an offset so that the blocks don't begin at a multiple of the
+  // block size and the rotations wrap around within a block.
+  for (size_t start : {size_t{0}, size_t{1}, size_t{170}}) {
+    SCOPED_TRACE(start);
+    std::vector<F> values(previous_values.begin() + start,
+                          previous_values.end());
+    compiled.Evaluate(evaluation_input, start, /*scale=*/1,
+                      absl::MakeSpan(values));
+    EXPECT_EQ(values,
+              std::vector<F>(expected.begin() + start, expected.end()));
+  }
+}
+
+TEST_F(CompiledGraphEvaluatorTest, EvaluateWithRowBlockedTable) {
+  CompiledGraphEvaluator<F> compiled =
+      CompiledGraphEvaluator<F>::Compile(graph_);
+  // a₀(ωX), f₁(X), i₀(ω⁻¹X), a₁(ω²X) and f₀(X)
+  EXPECT_EQ(compiled.num_queries(), size_t{5});
+  EXPECT_EQ(compiled.EstimateRowBlockedTableSize(kN),
+            3 * 5 * CompiledGraphEvaluator<F>::kBlockSize * sizeof(F));
+
+  EvaluationInput<Evals> evaluation_input = CreateEvaluationInput();
+  std::vector<F> table;
+  compiled.MaterializeRowBlockedTable(evaluation_input, /*scale=*/1, &table);
+  EXPECT_EQ(table.size() * sizeof(F),
+            compiled.EstimateRowBlockedTableSize(kN));
+
+  std::vector<F> previous_values =
+      base::CreateVector(kN, []() { return F::Random(); });
+  std::vector<F> expected = base::CreateVector(
+      kN, [this, &evaluation_input, &previous_values](size_t i) {
+        return graph_.Evaluate(evaluation_input, i, /*scale=*/1,
+                               previous_values[i]);
+      });
+
+  for (size_t start : {size_t{0}, size_t{1}, size_t{170}}) {
+    SCOPED_TRACE(start);
+    std::vector<F> values(previous_values.begin() + start,
+                          previous_values.end());
+    compiled.Evaluate(evaluation_input, start, /*scale=*/1,
+                      absl::MakeSpan(values), table);
+    EXPECT_EQ(values,
+              std::vector<F>(expected.begin() + start, expected.end()));
+  }
+}
+
+TEST_F(CompiledGraphEvaluatorTest, EvaluateEmpty) {
+  GraphEvaluator<F> graph;
+  CompiledGraphEvaluator<F> compiled =
+      CompiledGraphEvaluator<F>::Compile(graph);
+  std::vector<F> values(10, F::One());
+  compiled.Evaluate(CreateEvaluationInput(), 0, /*scale=*/1,
+                    absl::MakeSpan(values));
+  EXPECT_EQ(values, std::vector<F>(10, F::Zero()));
+}
+
+}  // namespace tachyon::zk::plonk
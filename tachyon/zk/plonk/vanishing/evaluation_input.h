@@ -16,15 +16,18 @@
 
 namespace tachyon::zk::plonk {
 
-template <typename Evals>
+// |Table| is either |MultiPhaseOwnedTable<Evals>| or
+// |MultiPhaseRefTable<Evals>|, the latter of which is evaluated by
+// |CompiledGraphEvaluator| only, e.g., to compress the lookup expressions.
+template <typename Evals, typename Table = MultiPhaseOwnedTable<Evals>>
 class EvaluationInput {
  public:
   using F = typename Evals::Field;
 
   EvaluationInput(std::vector<F>&& intermediates,
-                  std::vector<int32_t>&& rotations,
-                  const MultiPhaseOwnedTable<Evals>& table, const F& theta,
-                  const F& beta, const F& gamma, const F& y, int32_t n)
+                  std::vector<int32_t>&& rotations, const Table& table,
+                  const F& theta, const F& beta, const F& gamma, const F& y,
+                  int32_t n)
       : intermediates_(std::move(intermediates)),
         rotations_(std::move(rotations)),
         table_(table),
@@ -38,7 +41,7 @@ class EvaluationInput {
   std::vector<F>& intermediates() { return intermediates_; }
   const std::vector<int32_t>& rotations() const { return rotations_; }
   std::vector<int32_t>& rotations() { return rotations_; }
-  const MultiPhaseOwnedTable<Evals>& table() const { return table_; }
+  const Table& table() const { return table_; }
   const F& theta() const { return theta_; }
   const F& beta() const { return beta_; }
   const F& gamma() const { return gamma_; }
@@ -48,7 +51,7 @@ class EvaluationInput {
  private:
   std::vector<F> intermediates_;
   std::vector<int32_t> rotations_;
-  const MultiPhaseOwnedTable<Evals>& table_;
+  const Table& table_;
   const F& theta_;
   const F& beta_;
   const F& gamma_;
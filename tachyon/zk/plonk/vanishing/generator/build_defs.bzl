@@ -0,0 +1,71 @@
+load("//bazel:tachyon_cc.bzl", "tachyon_cc_library")
+
+def _generate_gate_evaluator_hdr_impl(ctx):
+    hdr_tpl_path = ctx.expand_location("$(location @kroma_network_tachyon//tachyon/zk/plonk/vanishing/generator:gate_evaluator.h.tpl)", [ctx.attr.hdr_tpl_path])
+
+    arguments = [
+        "--out=%s" % (ctx.outputs.out.path),
+        "--namespace=%s" % (ctx.attr.namespace),
+        "--class=%s" % (ctx.attr.class_name),
+        "--pk_path=%s" % (ctx.file.pk.path),
+        "--hdr_tpl_path=%s" % (hdr_tpl_path),
+    ]
+
+    ctx.actions.run(
+        inputs = [ctx.files.hdr_tpl_path[0], ctx.file.pk],
+        tools = [ctx.executable._tool],
+        executable = ctx.executable._tool,
+        outputs = [ctx.outputs.out],
+        arguments = arguments,
+    )
+
+    return [DefaultInfo(files = depset([ctx.outputs.out]))]
+
+generate_gate_evaluator_hdr = rule(
+    implementation = _generate_gate_evaluator_hdr_impl,
+    attrs = {
+        "out": attr.output(mandatory = True),
+        "namespace": attr.string(mandatory = True),
+        "class_name": attr.string(mandatory = True),
+        "pk": attr.label(mandatory = True, allow_single_file = True),
+        "hdr_tpl_path": attr.label(
+            allow_single_file = True,
+            default = Label("@kroma_network_tachyon//tachyon/zk/plonk/vanishing/generator:gate_evaluator.h.tpl"),
+        ),
+        "_tool": attr.label(
+            # TODO(chokobole): Change to "exec", so we can build on macos.
+            cfg = "target",
+            executable = True,
+            allow_single_file = True,
+            default = Label("@kroma_network_tachyon//tachyon/zk/plonk/vanishing/generator"),
+        ),
+    },
+)
+
+# Generates a library of |class_name|, which evaluates the custom gates of the
+# circuit of the bn254 halo2 proving key |pk| as straight-line code. Pass an
+# instance of it to |VanishingArgument::SetSpecializedCustomGates()|.
+def generate_gate_evaluator(
+        name,
+        namespace,
+        class_name,
+        pk,
+        **kwargs):
+    generate_gate_evaluator_hdr(
+        namespace = namespace,
+        class_name = class_name,
+        pk = pk,
+        name = "{}_gen_hdr".format(name),
+        out = "{}.h".format(name),
+    )
+
+    tachyon_cc_library(
+        name = name,
+        hdrs = [":{}_gen_hdr".format(name)],
+        deps = [
+            "//tachyon/zk/plonk/vanishing:evaluation_input",
+            "//tachyon/zk/plonk/vanishing:graph_evaluator",
+            "@com_google_absl//absl/types:span",
+        ],
+        **kwargs
+    )
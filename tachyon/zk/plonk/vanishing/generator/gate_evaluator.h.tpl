@@ -0,0 +1,64 @@
+// clang-format off
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+
+#include "absl/types/span.h"
+
+#include "tachyon/zk/plonk/vanishing/evaluation_input.h"
+#include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
+
+namespace %{namespace} {
+
+// |%{class}| evaluates the custom gates of a fixed circuit row by row as
+// straight-line code, instead of interpreting the calculations of their
+// |GraphEvaluator|. See |VanishingArgument::SetSpecializedCustomGates()|.
+template <typename Evals>
+class %{class} {
+ public:
+  using F = typename Evals::Field;
+
+  constexpr static size_t kNumCalculations = %{num_calculations};
+  constexpr static std::array<int32_t, %{num_rotations}> kRotations = {%{rotations}};
+
+  %{class}() : constants_({
+%{constants}
+  }) {}
+
+  // Returns true if |graph| is the graph that this is generated from.
+  bool Matches(const tachyon::zk::plonk::GraphEvaluator<F>& graph) const {
+    return graph.calculations().size() == kNumCalculations &&
+           std::equal(graph.rotations().begin(), graph.rotations().end(), kRotations.begin(), kRotations.end()) &&
+           std::equal(graph.constants().begin(), graph.constants().end(), constants_.begin(), constants_.end());
+  }
+
+  // Overwrites |chunk[i]| with the evaluation of the gates at the row
+  // |start + i|, which takes |chunk[i]| as the previous value.
+  void Evaluate(const tachyon::zk::plonk::EvaluationInput<Evals>& input, size_t start, absl::Span<F> chunk) const {
+    [[maybe_unused]] absl::Span<const Evals> fixed = input.table().GetFixedColumns();
+    [[maybe_unused]] absl::Span<const Evals> advice = input.table().GetAdviceColumns();
+    [[maybe_unused]] absl::Span<const Evals> instance = input.table().GetInstanceColumns();
+    [[maybe_unused]] absl::Span<const F> challenges = input.table().challenges();
+    [[maybe_unused]] int32_t n = input.n();
+    for (size_t i = 0; i < chunk.size(); ++i) {
+      [[maybe_unused]] int32_t idx = static_cast<int32_t>(start + i);
+%{row}
+    }
+  }
+
+ private:
+  // NOTE: The absolute value of |rotation| is assumed to be less than |n|.
+  constexpr static int32_t Rotate(int32_t idx, int32_t rotation, int32_t n) {
+    int32_t ret = idx + rotation;
+    if (ret >= n) return ret - n;
+    if (ret < 0) return ret + n;
+    return ret;
+  }
+
+  std::array<F, %{num_constants}> constants_;
+};
+
+}  // namespace %{namespace}
+// clang-format on
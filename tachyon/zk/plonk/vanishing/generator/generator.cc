@@ -0,0 +1,111 @@
+#include <optional>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/str_replace.h"
+#include "absl/strings/strip.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/files/file_path_flag.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+#include "tachyon/build/cc_writer.h"
+#include "tachyon/c/zk/plonk/keys/bn254_plonk_proving_key_impl.h"
+#include "tachyon/zk/plonk/vanishing/generator/graph_evaluator_codegen.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_argument.h"
+
+namespace tachyon {
+
+struct GenerationConfig : public build::CcWriter {
+  base::FilePath hdr_tpl_path;
+
+  std::string ns_name;
+  std::string class_name;
+  base::FilePath pk_path;
+
+  int GenerateHdr() const;
+};
+
+int GenerationConfig::GenerateHdr() const {
+  using LS = c::zk::plonk::bn254::LS;
+  using F = typename LS::Field;
+
+  std::optional<std::vector<uint8_t>> pk_state =
+      base::ReadFileToBytes(pk_path);
+  if (!pk_state.has_value()) {
+    tachyon_cerr << "failed to read: " << pk_path << std::endl;
+    return 1;
+  }
+  // NOTE: Only the verifying key, which holds the constraint system, is read
+  // out of the proving key.
+  c::zk::plonk::bn254::PKeyImpl pkey(absl::Span<const uint8_t>(*pk_state),
+                                     /*read_only_vk=*/true);
+  zk::plonk::VanishingArgument<LS> vanishing_argument =
+      zk::plonk::VanishingArgument<LS>::Create(pkey.GetConstraintSystem());
+  const zk::plonk::GraphEvaluator<F>& custom_gates =
+      vanishing_argument.custom_gates();
+  zk::plonk::GraphEvaluatorCodegen<F> codegen(custom_gates);
+
+  absl::flat_hash_map<std::string, std::string> replacements = {
+      {"%{namespace}", ns_name},
+      {"%{class}", class_name},
+      {"%{num_calculations}",
+       base::NumberToString(custom_gates.calculations().size())},
+      {"%{num_rotations}",
+       base::NumberToString(custom_gates.rotations().size())},
+      {"%{rotations}", codegen.GenerateRotations()},
+      {"%{num_constants}",
+       base::NumberToString(custom_gates.constants().size())},
+      {"%{constants}",
+       std::string(absl::StripSuffix(codegen.GenerateConstants(), "\n"))},
+      {"%{row}", std::string(absl::StripSuffix(codegen.GenerateRow(), "\n"))},
+  };
+
+  std::string tpl_content;
+  CHECK(base::ReadFileToString(hdr_tpl_path, &tpl_content));
+
+  std::string content = absl::StrReplaceAll(tpl_content, replacements);
+  return WriteHdr(content, false);
+}
+
+int RealMain(int argc, char** argv) {
+  GenerationConfig config;
+  config.generator = "//tachyon/zk/plonk/vanishing/generator";
+
+  base::FlagParser parser;
+  parser.AddFlag<base::FilePathFlag>(&config.out)
+      .set_long_name("--out")
+      .set_help("path to output");
+  parser.AddFlag<base::StringFlag>(&config.ns_name)
+      .set_long_name("--namespace")
+      .set_required();
+  parser.AddFlag<base::StringFlag>(&config.class_name)
+      .set_long_name("--class")
+      .set_required();
+  parser.AddFlag<base::FilePathFlag>(&config.pk_path)
+      .set_long_name("--pk_path")
+      .set_help("path to the halo2 serialization of the proving key")
+      .set_required();
+  parser.AddFlag<base::FilePathFlag>(&config.hdr_tpl_path)
+      .set_long_name("--hdr_tpl_path")
+      .set_required();
+
+  std::string error;
+  if (!parser.Parse(argc, argv, &error)) {
+    tachyon_cerr << error << std::endl;
+    return 1;
+  }
+
+  if (base::EndsWith(config.out.value(), ".h")) {
+    return config.GenerateHdr();
+  } else {
+    tachyon_cerr << "suffix not supported:" << config.out << std::endl;
+    return 1;
+  }
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
@@ -0,0 +1,150 @@
+#ifndef TACHYON_ZK_PLONK_VANISHING_GENERATOR_GRAPH_EVALUATOR_CODEGEN_H_
+#define TACHYON_ZK_PLONK_VANISHING_GENERATOR_GRAPH_EVALUATOR_CODEGEN_H_
+
+#include <stddef.h>
+
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "absl/strings/str_join.h"
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/plonk/vanishing/calculation.h"
+#include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
+#include "tachyon/zk/plonk/vanishing/value_source.h"
+
+namespace tachyon::zk::plonk {
+
+// |GraphEvaluatorCodegen| emits the C++ code that evaluates |graph| for a row
+// as straight-line code, in which the columns, the rotations and the
+// intermediates of |graph| are baked in, so that the compiler can inline and
+// schedule the whole row. See gate_evaluator.h.tpl for where it is placed.
+template <typename F>
+class GraphEvaluatorCodegen {
+ public:
+  explicit GraphEvaluatorCodegen(const GraphEvaluator<F>& graph)
+      : graph_(graph) {}
+
+  // Returns the initializers of the constants of |graph|.
+  std::string GenerateConstants() const {
+    std::stringstream ss;
+    for (const F& constant : graph_.constants()) {
+      ss << "      *F::FromDecString(\"" << constant.ToString() << "\"),\n";
+    }
+    return ss.str();
+  }
+
+  // Returns the rotations of |graph| separated by commas.
+  std::string GenerateRotations() const {
+    return absl::StrJoin(graph_.rotations(), ", ");
+  }
+
+  // Returns the statements that overwrite |chunk[i]| with the evaluation of
+  // |graph| at the row |idx|, where the previous value is |chunk[i]|.
+  std::string GenerateRow() const {
+    std::stringstream ss;
+    for (size_t i = 0; i < graph_.rotations().size(); ++i) {
+      ss << absl::Substitute("      int32_t r$0 = Rotate(idx, $1, n);\n", i,
+                             graph_.rotations()[i]);
+    }
+    for (const CalculationInfo& info : graph_.calculations()) {
+      ss << GenerateCalculation(info);
+    }
+    if (graph_.calculations().empty()) {
+      ss << "      chunk[i] = F::Zero();\n";
+    } else {
+      ss << absl::Substitute("      chunk[i] = v$0;\n",
+                             graph_.calculations().back().target);
+    }
+    return ss.str();
+  }
+
+ private:
+  static std::string GenerateCalculation(const CalculationInfo& info) {
+    const Calculation& calculation = info.calculation;
+    size_t target = info.target;
+    switch (calculation.type()) {
+      case Calculation::Type::kAdd:
+        return GenerateBinary(target, calculation.pair(), "+");
+      case Calculation::Type::kSub:
+        return GenerateBinary(target, calculation.pair(), "-");
+      case Calculation::Type::kMul:
+        return GenerateBinary(target, calculation.pair(), "*");
+      case Calculation::Type::kSquare:
+        return absl::Substitute("      F v$0 = ($1).Square();\n", target,
+                                GenerateSource(calculation.value()));
+      case Calculation::Type::kDouble:
+        return absl::Substitute("      F v$0 = ($1).Double();\n", target,
+                                GenerateSource(calculation.value()));
+      case Calculation::Type::kNegate:
+        return absl::Substitute("      F v$0 = -($1);\n", target,
+                                GenerateSource(calculation.value()));
+      case Calculation::Type::kStore:
+        return absl::Substitute("      const F& v$0 = $1;\n", target,
+                                GenerateSource(calculation.value()));
+      case Calculation::Type::kHorner: {
+        const Calculation::HornerData& horner = calculation.horner();
+        std::string factor = GenerateSource(horner.factor);
+        std::stringstream ss;
+        ss << absl::Substitute("      F v$0 = $1;\n", target,
+                               GenerateSource(horner.init));
+        for (const ValueSource& part : horner.parts) {
+          ss << absl::Substitute("      v$0 *= $1;\n", target, factor);
+          ss << absl::Substitute("      v$0 += $1;\n", target,
+                                 GenerateSource(part));
+        }
+        return ss.str();
+      }
+    }
+    NOTREACHED();
+    return "";
+  }
+
+  static std::string GenerateBinary(size_t target,
+                                    const Calculation::Pair& pair,
+                                    std::string_view op) {
+    return absl::Substitute("      F v$0 = $1 $2 $3;\n", target,
+                            GenerateSource(pair.left), op,
+                            GenerateSource(pair.right));
+  }
+
+  static std::string GenerateSource(const ValueSource& source) {
+    switch (source.type()) {
+      case ValueSource::Type::kConstant:
+        return absl::Substitute("constants_[$0]", source.index());
+      case ValueSource::Type::kIntermediate:
+        return absl::Substitute("v$0", source.index());
+      case ValueSource::Type::kFixed:
+        return absl::Substitute("fixed[$0][r$1]", source.column_index(),
+                                source.rotation_index());
+      case ValueSource::Type::kAdvice:
+        return absl::Substitute("advice[$0][r$1]", source.column_index(),
+                                source.rotation_index());
+      case ValueSource::Type::kInstance:
+        return absl::Substitute("instance[$0][r$1]", source.column_index(),
+                                source.rotation_index());
+      case ValueSource::Type::kChallenge:
+        return absl::Substitute("challenges[$0]", source.index());
+      case ValueSource::Type::kBeta:
+        return "input.beta()";
+      case ValueSource::Type::kGamma:
+        return "input.gamma()";
+      case ValueSource::Type::kTheta:
+        return "input.theta()";
+      case ValueSource::Type::kY:
+        return "input.y()";
+      case ValueSource::Type::kPreviousValue:
+        return "chunk[i]";
+    }
+    NOTREACHED();
+    return "";
+  }
+
+  const GraphEvaluator<F>& graph_;
+};
+
+}  // namespace tachyon::zk::plonk
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_GENERATOR_GRAPH_EVALUATOR_CODEGEN_H_
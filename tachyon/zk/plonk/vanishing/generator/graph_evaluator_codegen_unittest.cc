@@ -0,0 +1,41 @@
+#include "tachyon/zk/plonk/vanishing/generator/graph_evaluator_codegen.h"
+
+#include <memory>
+
+#include "tachyon/zk/expressions/evaluator/test/evaluator_test.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+
+namespace tachyon::zk::plonk {
+
+namespace {
+
+class GraphEvaluatorCodegenTest : public EvaluatorTest {};
+
+}  // namespace
+
+TEST_F(GraphEvaluatorCodegenTest, GenerateRow) {
+  std::unique_ptr<Expression<GF7>> expr = ExpressionFactory<GF7>::Product(
+      ExpressionFactory<GF7>::Fixed(
+          FixedQuery(1, Rotation(0), FixedColumnKey(0))),
+      ExpressionFactory<GF7>::Advice(
+          AdviceQuery(1, Rotation(1), AdviceColumnKey(1))));
+  GraphEvaluator<GF7> graph_evaluator;
+  ValueSource part = graph_evaluator.AddExpression(expr.get());
+  graph_evaluator.AddCalculation(Calculation::Horner(
+      ValueSource::PreviousValue(), {part}, ValueSource::Y()));
+
+  GraphEvaluatorCodegen<GF7> codegen(graph_evaluator);
+  EXPECT_EQ(codegen.GenerateRotations(), "0, 1");
+  EXPECT_EQ(codegen.GenerateRow(),
+            "      int32_t r0 = Rotate(idx, 0, n);\n"
+            "      int32_t r1 = Rotate(idx, 1, n);\n"
+            "      const F& v0 = fixed[0][r0];\n"
+            "      const F& v1 = advice[1][r1];\n"
+            "      F v2 = v0 * v1;\n"
+            "      F v3 = chunk[i];\n"
+            "      v3 *= input.y();\n"
+            "      v3 += v2;\n"
+            "      chunk[i] = v3;\n");
+}
+
+}  // namespace tachyon::zk::plonk
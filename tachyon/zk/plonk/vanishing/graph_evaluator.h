@@ -54,8 +54,10 @@ class GraphEvaluator : public Evaluator<F, ValueSource> {
   GraphEvaluator() = default;
 
   const std::vector<F>& constants() const { return constants_; }
-  const std::vector<int32_t>& rotations() { return rotations_; }
-  const std::vector<CalculationInfo>& calculations() { return calculations_; }
+  const std::vector<int32_t>& rotations() const { return rotations_; }
+  const std::vector<CalculationInfo>& calculations() const {
+    return calculations_;
+  }
   size_t num_intermediates() const { return num_intermediates_; }
 
   template <typename Evals>
@@ -0,0 +1,362 @@
+// This header defines |GraphEvaluatorGpu|, which evaluates the calculations of
+// a |GraphEvaluator| on the GPU, and |GpuEvaluationTable|, which keeps the
+// columns of a coset of the extended domain on the device so that they are
+// uploaded once and shared by every graph evaluated over the coset, e.g, the
+// custom gates and the compressions of the lookups.
+
+#ifndef TACHYON_ZK_PLONK_VANISHING_GRAPH_EVALUATOR_GPU_H_
+#define TACHYON_ZK_PLONK_VANISHING_GRAPH_EVALUATOR_GPU_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/time/trace_event.h"
+#include "tachyon/device/gpu/gpu_logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/zk/base/rotation.h"
+#include "tachyon/zk/plonk/vanishing/calculation.h"
+#include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
+#include "tachyon/zk/plonk/vanishing/kernels/graph_evaluator_kernels.cu.h"
+#include "tachyon/zk/plonk/vanishing/value_source.h"
+
+namespace tachyon::zk::plonk {
+
+template <typename F>
+class GpuEvaluationTable {
+ public:
+  using GpuField = typename F::GpuField;
+
+  explicit GpuEvaluationTable(gpuStream_t stream = nullptr) : stream_(stream) {}
+
+  gpuStream_t stream() const { return stream_; }
+  size_t n() const { return n_; }
+  const std::vector<F>& challenges() const { return challenges_; }
+
+  const GpuField* GetFixedColumn(size_t i) const {
+    return d_fixed_.get() + i * n_;
+  }
+  const GpuField* GetAdviceColumn(size_t i) const {
+    return d_advice_.get() + i * n_;
+  }
+  const GpuField* GetInstanceColumn(size_t i) const {
+    return d_instance_.get() + i * n_;
+  }
+
+  // Uploads the columns and the challenges of |table|. Every column must have
+  // the same number of evaluations. The device buffers are reused by the
+  // following uploads, e.g, for the next coset.
+  template <typename Table>
+  [[nodiscard]] bool Upload(const Table& table) {
+    n_ = 0;
+    for (const auto& columns :
+         {table.GetFixedColumns(), table.GetAdviceColumns(),
+          table.GetInstanceColumns()}) {
+      if (!columns.empty()) {
+        n_ = columns[0].evaluations().size();
+        break;
+      }
+    }
+    if (n_ > size_t{std::numeric_limits<int32_t>::max()}) {
+      LOG(ERROR) << "Too many rows: " << n_;
+      return false;
+    }
+    if (!UploadColumns(table.GetFixedColumns(), d_fixed_)) return false;
+    if (!UploadColumns(table.GetAdviceColumns(), d_advice_)) return false;
+    if (!UploadColumns(table.GetInstanceColumns(), d_instance_)) return false;
+    challenges_ =
+        std::vector<F>(table.challenges().begin(), table.challenges().end());
+    // The evaluations of |table| must outlive the asynchronous copies above.
+    return LOG_IF_GPU_ERROR(gpuStreamSynchronize(stream_),
+                            "Failed to gpuStreamSynchronize()") == gpuSuccess;
+  }
+
+ private:
+  template <typename Evals>
+  bool UploadColumns(absl::Span<const Evals> columns,
+                     device::gpu::GpuMemory<GpuField>& d_columns) {
+    if (columns.empty()) return true;
+    if (d_columns.size() < columns.size() * n_) {
+      d_columns = device::gpu::GpuMemory<GpuField>::Malloc(columns.size() * n_);
+    }
+    for (size_t i = 0; i < columns.size(); ++i) {
+      const std::vector<F>& evaluations = columns[i].evaluations();
+      if (evaluations.size() != n_) {
+        LOG(ERROR) << "The columns have different sizes";
+        return false;
+      }
+      if (!d_columns.CopyFromAsync(evaluations.data(),
+                                   device::gpu::GpuMemoryType::kHost, stream_,
+                                   i * n_, n_)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // not owned
+  gpuStream_t stream_ = nullptr;
+  size_t n_ = 0;
+  std::vector<F> challenges_;
+  device::gpu::GpuMemory<GpuField> d_fixed_;
+  device::gpu::GpuMemory<GpuField> d_advice_;
+  device::gpu::GpuMemory<GpuField> d_instance_;
+};
+
+// |GraphEvaluatorGpu| runs each calculation of a |GraphEvaluator| as a kernel
+// over a chunk of rows. The intermediates of a chunk live on the device, which
+// bounds the device memory to |num_intermediates()| * |chunk_size()| elements
+// besides the table.
+template <typename F>
+class GraphEvaluatorGpu {
+ public:
+  using GpuField = typename F::GpuField;
+  using GpuOperand = kernels::GpuOperand<GpuField>;
+  using GpuCalculationType = kernels::GpuCalculationType;
+
+  constexpr static unsigned int kThreadNum = 256;
+  constexpr static size_t kDefaultChunkSize = size_t{1} << 16;
+
+  explicit GraphEvaluatorGpu(const GraphEvaluator<F>& graph)
+      : constants_(graph.constants()),
+        rotations_(graph.rotations()),
+        calculations_(graph.calculations()),
+        num_intermediates_(graph.num_intermediates()) {}
+
+  size_t num_intermediates() const { return num_intermediates_; }
+
+  size_t chunk_size() const { return chunk_size_; }
+  void set_chunk_size(size_t chunk_size) {
+    CHECK_GT(chunk_size, size_t{0});
+    chunk_size_ = chunk_size;
+  }
+
+  // Replaces |values[i]| with the evaluation at the i-th row of |table|, where
+  // |values[i]| is the previous value of the row. It is the same as calling
+  // |GraphEvaluator::Evaluate()| for each row.
+  [[nodiscard]] bool Evaluate(const GpuEvaluationTable<F>& table,
+                              const F& theta, const F& beta, const F& gamma,
+                              const F& y, int32_t scale,
+                              device::gpu::GpuMemory<GpuField>& values) {
+    TRACE_EVENT("gpu", "GraphEvaluatorGpu::Evaluate");
+    size_t n = table.n();
+    if (values.size() < n) {
+      LOG(ERROR) << "values.size() is smaller than the number of rows";
+      return false;
+    }
+    if (n == 0) return true;
+    gpuStream_t stream = table.stream();
+    if (calculations_.empty()) {
+      return values.MemsetAsync(0, stream, 0, n) && Synchronize(stream);
+    }
+
+    if (!UploadScalars(table, theta, beta, gamma, y)) return false;
+    offsets_ = base::Map(rotations_, [scale, n](int32_t rotation) {
+      return static_cast<unsigned int>(
+          Rotation(rotation).GetIndex(0, scale, static_cast<int32_t>(n)));
+    });
+
+    size_t chunk_size = std::min(chunk_size_, n);
+    if (d_intermediates_.size() < num_intermediates_ * chunk_size) {
+      d_intermediates_ = device::gpu::GpuMemory<GpuField>::Malloc(
+          num_intermediates_ * chunk_size);
+    }
+    size_t result = calculations_.back().target * chunk_size;
+    for (size_t start = 0; start < n; start += chunk_size) {
+      size_t len = std::min(chunk_size, n - start);
+      Chunk chunk{start, len, n, chunk_size, values.get() + start};
+      for (const CalculationInfo& info : calculations_) {
+        if (!EvaluateCalculation(table, info, chunk, stream)) return false;
+      }
+      if (!values.CopyFromAsync(d_intermediates_.get() + result,
+                                device::gpu::GpuMemoryType::kDevice, stream,
+                                start, len)) {
+        return false;
+      }
+    }
+    return Synchronize(stream);
+  }
+
+  // Same as above, but |values| are on the host.
+  [[nodiscard]] bool Evaluate(const GpuEvaluationTable<F>& table,
+                              const F& theta, const F& beta, const F& gamma,
+                              const F& y, int32_t scale,
+                              std::vector<F>& values) {
+    gpuStream_t stream = table.stream();
+    auto d_values = device::gpu::GpuMemory<GpuField>::Malloc(values.size());
+    if (!d_values.CopyFromAsync(values.data(),
+                                device::gpu::GpuMemoryType::kHost, stream)) {
+      return false;
+    }
+    if (!Evaluate(table, theta, beta, gamma, y, scale, d_values)) return false;
+    if (!d_values.CopyToAsync(values.data(), device::gpu::GpuMemoryType::kHost,
+                              stream)) {
+      return false;
+    }
+    return Synchronize(stream);
+  }
+
+ private:
+  struct Chunk {
+    size_t start;
+    size_t len;
+    size_t n;
+    // The distance between the intermediates on the device.
+    size_t stride;
+    GpuField* previous_values;
+  };
+
+  // Uploads the constants, the challenges, θ, β, γ and y back to back, which
+  // are the values that are the same for every row.
+  bool UploadScalars(const GpuEvaluationTable<F>& table, const F& theta,
+                     const F& beta, const F& gamma, const F& y) {
+    scalars_ = constants_;
+    scalars_.insert(scalars_.end(), table.challenges().begin(),
+                    table.challenges().end());
+    scalars_.insert(scalars_.end(), {theta, beta, gamma, y});
+    if (d_scalars_.size() < scalars_.size()) {
+      d_scalars_ = device::gpu::GpuMemory<GpuField>::Malloc(scalars_.size());
+    }
+    // NOTE: |scalars_| outlives the asynchronous copy, since the stream is
+    // synchronized before it is overwritten.
+    return d_scalars_.CopyFromAsync(scalars_.data(),
+                                    device::gpu::GpuMemoryType::kHost,
+                                    table.stream(), 0, scalars_.size());
+  }
+
+  bool EvaluateCalculation(const GpuEvaluationTable<F>& table,
+                           const CalculationInfo& info, const Chunk& chunk,
+                           gpuStream_t stream) {
+    const Calculation& calculation = info.calculation;
+    GpuField* out = d_intermediates_.get() + info.target * chunk.stride;
+    auto resolve = [this, &table, &chunk](const ValueSource& source) {
+      return Resolve(table, source, chunk);
+    };
+    switch (calculation.type()) {
+      case Calculation::Type::kAdd:
+        return Launch(GpuCalculationType::kAdd,
+                      resolve(calculation.pair().left),
+                      resolve(calculation.pair().right), out, chunk, stream);
+      case Calculation::Type::kSub:
+        return Launch(GpuCalculationType::kSub,
+                      resolve(calculation.pair().left),
+                      resolve(calculation.pair().right), out, chunk, stream);
+      case Calculation::Type::kMul:
+        return Launch(GpuCalculationType::kMul,
+                      resolve(calculation.pair().left),
+                      resolve(calculation.pair().right), out, chunk, stream);
+      case Calculation::Type::kSquare:
+        return Launch(GpuCalculationType::kSquare,
+                      resolve(calculation.value()), GpuOperand{}, out, chunk,
+                      stream);
+      case Calculation::Type::kDouble:
+        return Launch(GpuCalculationType::kDouble,
+                      resolve(calculation.value()), GpuOperand{}, out, chunk,
+                      stream);
+      case Calculation::Type::kNegate:
+        return Launch(GpuCalculationType::kNegate,
+                      resolve(calculation.value()), GpuOperand{}, out, chunk,
+                      stream);
+      case Calculation::Type::kStore:
+        return Launch(GpuCalculationType::kStore,
+                      resolve(calculation.value()), GpuOperand{}, out, chunk,
+                      stream);
+      case Calculation::Type::kHorner: {
+        const Calculation::HornerData& horner = calculation.horner();
+        if (!Launch(GpuCalculationType::kStore, resolve(horner.init),
+                    GpuOperand{}, out, chunk, stream)) {
+          return false;
+        }
+        GpuOperand factor = resolve(horner.factor);
+        for (const ValueSource& part : horner.parts) {
+          if (!Launch(GpuCalculationType::kMulAdd, factor, resolve(part), out,
+                      chunk, stream)) {
+            return false;
+          }
+        }
+        return true;
+      }
+    }
+    NOTREACHED();
+    return false;
+  }
+
+  GpuOperand Resolve(const GpuEvaluationTable<F>& table,
+                     const ValueSource& source, const Chunk& chunk) const {
+    size_t num_challenges = table.challenges().size();
+    // The index of θ in |d_scalars_|. See |UploadScalars()|.
+    size_t theta_idx = constants_.size() + num_challenges;
+    switch (source.type()) {
+      case ValueSource::Type::kConstant:
+        return Scalar(source.index());
+      case ValueSource::Type::kIntermediate:
+        return {d_intermediates_.get() + source.index() * chunk.stride, 0,
+                GpuOperand::Kind::kChunk};
+      case ValueSource::Type::kFixed:
+        return {table.GetFixedColumn(source.column_index()),
+                offsets_[source.rotation_index()], GpuOperand::Kind::kColumn};
+      case ValueSource::Type::kAdvice:
+        return {table.GetAdviceColumn(source.column_index()),
+                offsets_[source.rotation_index()], GpuOperand::Kind::kColumn};
+      case ValueSource::Type::kInstance:
+        return {table.GetInstanceColumn(source.column_index()),
+                offsets_[source.rotation_index()], GpuOperand::Kind::kColumn};
+      case ValueSource::Type::kChallenge:
+        return Scalar(constants_.size() + source.index());
+      case ValueSource::Type::kTheta:
+        return Scalar(theta_idx);
+      case ValueSource::Type::kBeta:
+        return Scalar(theta_idx + 1);
+      case ValueSource::Type::kGamma:
+        return Scalar(theta_idx + 2);
+      case ValueSource::Type::kY:
+        return Scalar(theta_idx + 3);
+      case ValueSource::Type::kPreviousValue:
+        return {chunk.previous_values, 0, GpuOperand::Kind::kChunk};
+    }
+    NOTREACHED();
+    return {};
+  }
+
+  GpuOperand Scalar(size_t idx) const {
+    return {d_scalars_.get() + idx, 0, GpuOperand::Kind::kScalar};
+  }
+
+  static bool Launch(GpuCalculationType type, const GpuOperand& a,
+                     const GpuOperand& b, GpuField* out, const Chunk& chunk,
+                     gpuStream_t stream) {
+    kernels::EvaluateCalculation<<<(chunk.len + kThreadNum - 1) / kThreadNum,
+                                   kThreadNum, 0, stream>>>(
+        type, a, b, out, chunk.start, chunk.len, chunk.n);
+    return LOG_IF_GPU_LAST_ERROR("Failed to kernels::EvaluateCalculation()") ==
+           gpuSuccess;
+  }
+
+  static bool Synchronize(gpuStream_t stream) {
+    return LOG_IF_GPU_ERROR(gpuStreamSynchronize(stream),
+                            "Failed to gpuStreamSynchronize()") == gpuSuccess;
+  }
+
+  std::vector<F> constants_;
+  std::vector<int32_t> rotations_;
+  std::vector<CalculationInfo> calculations_;
+  size_t num_intermediates_ = 0;
+  size_t chunk_size_ = kDefaultChunkSize;
+
+  // The scratch of |Evaluate()|.
+  std::vector<F> scalars_;
+  std::vector<unsigned int> offsets_;
+  device::gpu::GpuMemory<GpuField> d_scalars_;
+  device::gpu::GpuMemory<GpuField> d_intermediates_;
+};
+
+}  // namespace tachyon::zk::plonk
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_GRAPH_EVALUATOR_GPU_H_
@@ -0,0 +1,129 @@
+#include "tachyon/zk/plonk/vanishing/graph_evaluator_gpu.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+#include "tachyon/zk/plonk/base/multi_phase_owned_table.h"
+#include "tachyon/zk/plonk/vanishing/evaluation_input.h"
+#include "tachyon/zk/plonk/vanishing/kernels/bn254_graph_evaluator_kernels.cu.h"
+
+namespace tachyon::zk::plonk {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+constexpr size_t kN = 512;
+
+using Evals = math::UnivariateEvaluations<F, kN - 1>;
+using Expr = std::unique_ptr<Expression<F>>;
+
+class GraphEvaluatorGpuTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+
+  static void TearDownTestSuite() {
+    GPU_MUST_SUCCESS(gpuDeviceReset(), "");
+  }
+
+  void SetUp() override {
+    auto create_columns = [](size_t num_columns) {
+      return base::CreateVector(num_columns, []() {
+        return Evals(base::CreateVector(kN, []() { return F::Random(); }));
+      });
+    };
+    challenges_ = {F::Random(), F::Random()};
+    table_ = MultiPhaseOwnedTable<Evals>(create_columns(2), create_columns(2),
+                                         create_columns(1), challenges_);
+    theta_ = F::Random();
+    beta_ = F::Random();
+    gamma_ = F::Random();
+    y_ = F::Random();
+
+    // a₀(ωX) * f₁(X) + 3 * i₀(ω⁻¹X) - c₁ and 2 * a₁(ω²X) - f₀(X) + β are
+    // combined by the Horner's rule with y like the custom gates.
+    Expr gate0 = ExpressionFactory<F>::Product(
+        ExpressionFactory<F>::Advice(
+            AdviceQuery(0, Rotation(1), AdviceColumnKey(0))),
+        ExpressionFactory<F>::Fixed(
+            FixedQuery(0, Rotation(0), FixedColumnKey(1))));
+    gate0 = ExpressionFactory<F>::Sum(
+        std::move(gate0),
+        ExpressionFactory<F>::Scaled(
+            ExpressionFactory<F>::Instance(
+                InstanceQuery(0, Rotation(-1), InstanceColumnKey(0))),
+            F(3)));
+    gate0 = ExpressionFactory<F>::Sum(
+        std::move(gate0),
+        ExpressionFactory<F>::Negated(
+            ExpressionFactory<F>::Challenge(Challenge(1, Phase(0)))));
+    Expr gate1 = ExpressionFactory<F>::Product(
+        ExpressionFactory<F>::Constant(F(2)),
+        ExpressionFactory<F>::Advice(
+            AdviceQuery(1, Rotation(2), AdviceColumnKey(1))));
+    gate1 = ExpressionFactory<F>::Sum(
+        std::move(gate1),
+        ExpressionFactory<F>::Negated(ExpressionFactory<F>::Fixed(
+            FixedQuery(1, Rotation(0), FixedColumnKey(0)))));
+
+    ValueSource part0 = graph_.AddExpression(gate0.get());
+    part0 = graph_.AddCalculation(Calculation::Square(part0));
+    ValueSource part1 = graph_.AddExpression(gate1.get());
+    part1 =
+        graph_.AddCalculation(Calculation::Add(part1, ValueSource::Beta()));
+    graph_.AddCalculation(Calculation::Horner(ValueSource::PreviousValue(),
+                                              {part0, part1},
+                                              ValueSource::Y()));
+  }
+
+ protected:
+  GraphEvaluator<F> graph_;
+  std::vector<F> challenges_;
+  MultiPhaseOwnedTable<Evals> table_;
+  F theta_;
+  F beta_;
+  F gamma_;
+  F y_;
+};
+
+}  // namespace
+
+TEST_F(GraphEvaluatorGpuTest, Evaluate) {
+  GpuEvaluationTable<F> gpu_table;
+  ASSERT_TRUE(gpu_table.Upload(table_));
+  GraphEvaluatorGpu<F> gpu_graph(graph_);
+
+  std::vector<F> previous_values =
+      base::CreateVector(kN, []() { return F::Random(); });
+  // The chunk of 200 rows leaves a partial chunk at the end.
+  for (size_t chunk_size : {kN, size_t{200}}) {
+    for (int32_t scale : {1, 2}) {
+      SCOPED_TRACE(chunk_size);
+      SCOPED_TRACE(scale);
+      EvaluationInput<Evals> evaluation_input(
+          graph_.CreateInitialIntermediates(), graph_.CreateEmptyRotations(),
+          table_, theta_, beta_, gamma_, y_, kN);
+      std::vector<F> expected = base::CreateVector(
+          kN, [this, &evaluation_input, &previous_values, scale](size_t i) {
+            return graph_.Evaluate(evaluation_input, i, scale,
+                                   previous_values[i]);
+          });
+
+      gpu_graph.set_chunk_size(chunk_size);
+      std::vector<F> values = previous_values;
+      ASSERT_TRUE(gpu_graph.Evaluate(gpu_table, theta_, beta_, gamma_, y_,
+                                     scale, values));
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+}  // namespace tachyon::zk::plonk
@@ -0,0 +1,10 @@
+#include "tachyon/zk/plonk/vanishing/kernels/bn254_graph_evaluator_kernels.cu.h"
+
+namespace tachyon::zk::plonk::kernels {
+
+template __global__ void EvaluateCalculation<math::bn254::FrGpu>(
+    GpuCalculationType type, GpuOperand<math::bn254::FrGpu> a,
+    GpuOperand<math::bn254::FrGpu> b, math::bn254::FrGpu* out,
+    unsigned int start, unsigned int len, unsigned int n);
+
+}  // namespace tachyon::zk::plonk::kernels
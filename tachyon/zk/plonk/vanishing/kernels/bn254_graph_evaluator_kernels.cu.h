@@ -0,0 +1,16 @@
+#ifndef TACHYON_ZK_PLONK_VANISHING_KERNELS_BN254_GRAPH_EVALUATOR_KERNELS_CU_H_
+#define TACHYON_ZK_PLONK_VANISHING_KERNELS_BN254_GRAPH_EVALUATOR_KERNELS_CU_H_
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr_gpu.h"
+#include "tachyon/zk/plonk/vanishing/kernels/graph_evaluator_kernels.cu.h"
+
+namespace tachyon::zk::plonk::kernels {
+
+extern template __global__ void EvaluateCalculation<math::bn254::FrGpu>(
+    GpuCalculationType type, GpuOperand<math::bn254::FrGpu> a,
+    GpuOperand<math::bn254::FrGpu> b, math::bn254::FrGpu* out,
+    unsigned int start, unsigned int len, unsigned int n);
+
+}  // namespace tachyon::zk::plonk::kernels
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_KERNELS_BN254_GRAPH_EVALUATOR_KERNELS_CU_H_
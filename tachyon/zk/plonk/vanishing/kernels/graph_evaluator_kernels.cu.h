@@ -0,0 +1,98 @@
+#ifndef TACHYON_ZK_PLONK_VANISHING_KERNELS_GRAPH_EVALUATOR_KERNELS_CU_H_
+#define TACHYON_ZK_PLONK_VANISHING_KERNELS_GRAPH_EVALUATOR_KERNELS_CU_H_
+
+#include <stdint.h>
+
+#include "tachyon/device/gpu/gpu_runtime.h"
+
+namespace tachyon::zk::plonk::kernels {
+
+// The device counterpart of |Calculation::Type|. |kHorner| is lowered into a
+// |kStore| of the initial value followed by a |kMulAdd| per part.
+enum class GpuCalculationType : uint8_t {
+  kAdd,
+  kSub,
+  kMul,
+  kSquare,
+  kDouble,
+  kNegate,
+  kStore,
+  // out = out * a + b
+  kMulAdd,
+};
+
+// The device counterpart of |ValueSource|, resolved to a pointer by the host.
+template <typename F>
+struct GpuOperand {
+  enum class Kind : uint8_t {
+    // The same value for every row, e.g, a constant or a challenge.
+    kScalar,
+    // A column of the table that is indexed by the rotated row.
+    kColumn,
+    // A buffer that is indexed by the row in the chunk, e.g, an intermediate.
+    kChunk,
+  };
+
+  const F* ptr;
+  // The rotation times the scale modulo n for a |kColumn|.
+  unsigned int offset;
+  Kind kind;
+
+  __device__ const F& Get(unsigned int i, unsigned int start,
+                          unsigned int n) const {
+    switch (kind) {
+      case Kind::kScalar:
+        return ptr[0];
+      case Kind::kColumn:
+        return ptr[(start + i + offset) % n];
+      case Kind::kChunk:
+        return ptr[i];
+    }
+    return ptr[0];
+  }
+};
+
+// Evaluates a single calculation for the rows in [|start|, |start| + |len|)
+// of columns whose size is |n|. |out| points to the chunk of the target.
+template <typename F>
+__global__ void EvaluateCalculation(GpuCalculationType type, GpuOperand<F> a,
+                                    GpuOperand<F> b, F* out,
+                                    unsigned int start, unsigned int len,
+                                    unsigned int n) {
+  unsigned int gid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (gid >= len) return;
+  switch (type) {
+    case GpuCalculationType::kAdd:
+      out[gid] = a.Get(gid, start, n) + b.Get(gid, start, n);
+      return;
+    case GpuCalculationType::kSub:
+      out[gid] = a.Get(gid, start, n) - b.Get(gid, start, n);
+      return;
+    case GpuCalculationType::kMul:
+      out[gid] = a.Get(gid, start, n) * b.Get(gid, start, n);
+      return;
+    case GpuCalculationType::kSquare: {
+      const F& value = a.Get(gid, start, n);
+      out[gid] = value * value;
+      return;
+    }
+    case GpuCalculationType::kDouble: {
+      const F& value = a.Get(gid, start, n);
+      out[gid] = value + value;
+      return;
+    }
+    case GpuCalculationType::kNegate:
+      out[gid] = a.Get(gid, start, n).Negate();
+      return;
+    case GpuCalculationType::kStore:
+      out[gid] = a.Get(gid, start, n);
+      return;
+    case GpuCalculationType::kMulAdd:
+      out[gid] = out[gid] * a.Get(gid, start, n) + b.Get(gid, start, n);
+      return;
+  }
+}
+
+}  // namespace tachyon::zk::plonk::kernels
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_KERNELS_GRAPH_EVALUATOR_KERNELS_CU_H_
@@ -7,18 +7,26 @@
 #ifndef TACHYON_ZK_PLONK_VANISHING_VANISHING_ARGUMENT_H_
 #define TACHYON_ZK_PLONK_VANISHING_VANISHING_ARGUMENT_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/expressions/evaluator/expression_simplifier.h"
 #include "tachyon/zk/lookup/halo2/evaluator.h"
 #include "tachyon/zk/plonk/constraint_system/constraint_system.h"
 #include "tachyon/zk/plonk/keys/proving_key_forward.h"
 #include "tachyon/zk/plonk/vanishing/circuit_polynomial_builder.h"
+#include "tachyon/zk/plonk/vanishing/evaluation_input.h"
 #include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
 
 namespace tachyon::zk::plonk {
@@ -37,18 +45,32 @@ class VanishingArgument {
       const ConstraintSystem<F>& constraint_system) {
     VanishingArgument evaluator;
 
-    std::vector<ValueSource> parts;
+    // NOTE: The gates are simplified before they are added to the graph, which
+    // factors out the selectors shared by the terms and folds the constants.
+    std::vector<const Expression<F>*> gate_polys;
     for (const Gate<F>& gate : constraint_system.gates()) {
-      std::vector<ValueSource> tmp = base::Map(
-          gate.polys(),
-          [&evaluator](const std::unique_ptr<Expression<F>>& expression) {
-            return evaluator.custom_gates_.AddExpression(expression.get());
-          });
-      parts.insert(parts.end(), std::make_move_iterator(tmp.begin()),
-                   std::make_move_iterator(tmp.end()));
+      for (const std::unique_ptr<Expression<F>>& poly : gate.polys()) {
+        gate_polys.push_back(poly.get());
+      }
+    }
+    std::vector<std::unique_ptr<Expression<F>>> simplified_gate_polys =
+        base::Map(gate_polys,
+                  [](const Expression<F>* poly) { return poly->Simplify(); });
+    AddGates(base::Map(simplified_gate_polys,
+                       [](const std::unique_ptr<Expression<F>>& poly) {
+                         return static_cast<const Expression<F>*>(poly.get());
+                       }),
+             evaluator.custom_gates_);
+
+    if (VLOG_IS_ON(1)) {
+      GraphEvaluator<F> unsimplified;
+      AddGates(gate_polys, unsimplified);
+      VLOG(1) << "Custom gates: calculations "
+              << unsimplified.calculations().size() << " -> "
+              << evaluator.custom_gates_.calculations().size()
+              << ", multiplications " << CountMultiplications(unsimplified)
+              << " -> " << CountMultiplications(evaluator.custom_gates_);
     }
-    evaluator.custom_gates_.AddCalculation(Calculation::Horner(
-        ValueSource::PreviousValue(), std::move(parts), ValueSource::Y()));
 
     evaluator.lookup_evaluator_.EvaluateLookups(constraint_system.lookups());
 
@@ -58,6 +80,38 @@ class VanishingArgument {
   const GraphEvaluator<F>& custom_gates() const { return custom_gates_; }
   const LookupEvaluator& lookup_evaluator() const { return lookup_evaluator_; }
 
+  // See |CircuitPolynomialBuilder::set_parallel_parts()|.
+  void set_parallel_parts(bool parallel_parts) {
+    parallel_parts_ = parallel_parts;
+  }
+  void set_memory_budget(size_t memory_budget) {
+    memory_budget_ = memory_budget;
+  }
+  // See |CircuitPolynomialBuilder::set_compile_custom_gates()|.
+  void set_compile_custom_gates(bool compile_custom_gates) {
+    compile_custom_gates_ = compile_custom_gates;
+  }
+  // Evaluates the custom gates by |specialized| from now on, which is
+  // generated by |generate_gate_evaluator()| in
+  // tachyon/zk/plonk/vanishing/generator/build_defs.bzl. Returns false if it
+  // isn't generated from the custom gates of this.
+  template <typename Specialized>
+  [[nodiscard]] bool SetSpecializedCustomGates(Specialized specialized) {
+    if (!specialized.Matches(custom_gates_)) {
+      LOG(ERROR) << "The specialized custom gates don't match the circuit";
+      return false;
+    }
+    specialized_custom_gates_ =
+        [specialized = std::move(specialized)](
+            const EvaluationInput<Evals>& input, size_t start,
+            absl::Span<F> chunk) { specialized.Evaluate(input, start, chunk); };
+    return true;
+  }
+  // See |CircuitPolynomialBuilder::set_row_blocked_table_budget()|.
+  void set_row_blocked_table_budget(size_t row_blocked_table_budget) {
+    row_blocked_table_budget_ = row_blocked_table_budget;
+  }
+
   template <typename PCS, typename Poly,
             typename ExtendedEvals = typename PCS::ExtendedEvals>
   ExtendedEvals BuildExtendedCircuitColumn(
@@ -66,6 +120,35 @@ class VanishingArgument {
       const F& beta, const F& gamma, const F& y, const F& zeta,
       const std::vector<PermutationProver<Poly, Evals>>& permutation_provers,
       const std::vector<LookupProver>& lookup_provers) {
+    CircuitPolynomialBuilder<PCS, LS> builder =
+        CreateBuilder(prover, proving_key, poly_tables, theta, beta, gamma, y,
+                      zeta, permutation_provers, lookup_provers);
+    return builder.BuildExtendedCircuitColumn(custom_gates_, lookup_evaluator_);
+  }
+
+  // See |CircuitPolynomialBuilder::BuildExtendedCircuitCoeffs()|.
+  template <typename PCS, typename Poly>
+  std::vector<F> BuildExtendedCircuitCoeffs(
+      ProverBase<PCS>* prover, const ProvingKey<LS>& proving_key,
+      const std::vector<MultiPhaseRefTable<Poly>>& poly_tables, const F& theta,
+      const F& beta, const F& gamma, const F& y, const F& zeta,
+      const std::vector<PermutationProver<Poly, Evals>>& permutation_provers,
+      const std::vector<LookupProver>& lookup_provers, size_t num_pieces) {
+    CircuitPolynomialBuilder<PCS, LS> builder =
+        CreateBuilder(prover, proving_key, poly_tables, theta, beta, gamma, y,
+                      zeta, permutation_provers, lookup_provers);
+    return builder.BuildExtendedCircuitCoeffs(custom_gates_, lookup_evaluator_,
+                                              num_pieces);
+  }
+
+ private:
+  template <typename PCS, typename Poly>
+  CircuitPolynomialBuilder<PCS, LS> CreateBuilder(
+      ProverBase<PCS>* prover, const ProvingKey<LS>& proving_key,
+      const std::vector<MultiPhaseRefTable<Poly>>& poly_tables, const F& theta,
+      const F& beta, const F& gamma, const F& y, const F& zeta,
+      const std::vector<PermutationProver<Poly, Evals>>& permutation_provers,
+      const std::vector<LookupProver>& lookup_provers) const {
     size_t cs_degree =
         proving_key.verifying_key().constraint_system().ComputeDegree();
 
@@ -74,13 +157,47 @@ class VanishingArgument {
             prover->domain(), prover->extended_domain(), prover->pcs().N(),
             prover->GetLastRow(), cs_degree, poly_tables, theta, beta, gamma, y,
             zeta, proving_key, permutation_provers, lookup_provers);
+    builder.set_parallel_parts(parallel_parts_);
+    builder.set_memory_budget(memory_budget_);
+    builder.set_compile_custom_gates(compile_custom_gates_);
+    builder.set_specialized_custom_gates(specialized_custom_gates_);
+    builder.set_row_blocked_table_budget(row_blocked_table_budget_);
+    return builder;
+  }
 
-    return builder.BuildExtendedCircuitColumn(custom_gates_, lookup_evaluator_);
+  // Adds gate₀(X) + y * gate₁(X) + ... + yⁱ * gateᵢ(X) + ... to |graph|.
+  static void AddGates(const std::vector<const Expression<F>*>& gate_polys,
+                       GraphEvaluator<F>& graph) {
+    std::vector<ValueSource> parts =
+        base::Map(gate_polys, [&graph](const Expression<F>* poly) {
+          return graph.AddExpression(poly);
+        });
+    graph.AddCalculation(Calculation::Horner(
+        ValueSource::PreviousValue(), std::move(parts), ValueSource::Y()));
+  }
+
+  // Returns the number of multiplications per row apart from the Horner's
+  // rule, which takes the same number of them for every graph of the gates.
+  static size_t CountMultiplications(const GraphEvaluator<F>& graph) {
+    return std::count_if(graph.calculations().begin(),
+                         graph.calculations().end(),
+                         [](const CalculationInfo& info) {
+                           return info.calculation.type() ==
+                                      Calculation::Type::kMul ||
+                                  info.calculation.type() ==
+                                      Calculation::Type::kSquare;
+                         });
   }
 
- private:
   GraphEvaluator<F> custom_gates_;
   LookupEvaluator lookup_evaluator_;
+  bool parallel_parts_ = false;
+  size_t memory_budget_ = 0;
+  bool compile_custom_gates_ = false;
+  // See |CircuitPolynomialBuilder::SpecializedCustomGates|.
+  std::function<void(const EvaluationInput<Evals>&, size_t, absl::Span<F>)>
+      specialized_custom_gates_;
+  size_t row_blocked_table_budget_ = 0;
 };
 
 }  // namespace tachyon::zk::plonk
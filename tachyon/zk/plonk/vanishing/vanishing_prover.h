@@ -11,6 +11,7 @@
 
 #include "absl/types/span.h"
 
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/prover_base.h"
@@ -19,7 +20,8 @@
 #include "tachyon/zk/plonk/keys/proving_key.h"
 #include "tachyon/zk/plonk/permutation/permutation_prover.h"
 
-namespace tachyon::zk::plonk {
+namespace tachyon {
+namespace zk::plonk {
 
 template <typename Poly, typename Evals, typename ExtendedPoly,
           typename ExtendedEvals>
@@ -27,6 +29,14 @@ class VanishingProver {
  public:
   using F = typename Poly::Field;
 
+  // When |streaming_quotient| is true, |CreateHEvals()| interpolates each part
+  // of the circuit polynomial into the coefficients of h(X) as soon as it is
+  // built, instead of holding the evaluations of every part over the extended
+  // domain and interpolating them at once in |CreateFinalHPoly()|.
+  void set_streaming_quotient(bool streaming_quotient) {
+    streaming_quotient_ = streaming_quotient;
+  }
+
   template <typename PCS>
   void CreateRandomPoly(ProverBase<PCS>* prover);
 
@@ -81,12 +91,20 @@ class VanishingProver {
             std::vector<crypto::PolynomialOpening<Poly>>& openings) const;
 
  private:
+  friend class base::Copyable<
+      VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals>>;
+
   template <typename PCS, ColumnType C>
   static void EvaluateColumns(ProverBase<PCS>* prover,
                               const absl::Span<const Poly> polys,
                               const std::vector<QueryData<C>>& queries,
                               const F& x);
 
+  // Returns the views of the pieces of h(X) of |n| coefficients each, where
+  // the missing coefficients are zero.
+  std::vector<absl::Span<const F>> GetHPieces(
+      size_t n, size_t quotient_poly_degree) const;
+
   template <typename Domain, ColumnType C>
   static void OpenColumns(
       const Domain* domain, const absl::Span<const Poly> polys,
@@ -98,9 +116,42 @@ class VanishingProver {
   ExtendedPoly h_poly_;
   Poly combined_h_poly_;
   std::vector<F> h_blinds_;
+  bool streaming_quotient_ = false;
+};
+
+}  // namespace zk::plonk
+
+namespace base {
+
+template <typename Poly, typename Evals, typename ExtendedPoly,
+          typename ExtendedEvals>
+class Copyable<
+    zk::plonk::VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals>> {
+ public:
+  using Prover =
+      zk::plonk::VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals>;
+
+  static bool WriteTo(const Prover& prover, Buffer* buffer) {
+    return buffer->WriteMany(prover.random_poly_, prover.h_evals_,
+                             prover.h_poly_, prover.combined_h_poly_,
+                             prover.h_blinds_);
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, Prover* prover) {
+    return buffer.ReadMany(&prover->random_poly_, &prover->h_evals_,
+                           &prover->h_poly_, &prover->combined_h_poly_,
+                           &prover->h_blinds_);
+  }
+
+  static size_t EstimateSize(const Prover& prover) {
+    return base::EstimateSize(prover.random_poly_, prover.h_evals_,
+                              prover.h_poly_, prover.combined_h_poly_,
+                              prover.h_blinds_);
+  }
 };
 
-}  // namespace tachyon::zk::plonk
+}  // namespace base
+}  // namespace tachyon
 
 #include "tachyon/zk/plonk/vanishing/vanishing_prover_impl.h"
 
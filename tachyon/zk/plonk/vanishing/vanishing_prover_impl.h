@@ -7,6 +7,7 @@
 #ifndef TACHYON_ZK_PLONK_VANISHING_VANISHING_PROVER_IMPL_H_
 #define TACHYON_ZK_PLONK_VANISHING_VANISHING_PROVER_IMPL_H_
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -61,6 +62,18 @@ void VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals>::CreateHEvals(
   VanishingArgument<LS> vanishing_argument = VanishingArgument<LS>::Create(
       proving_key.verifying_key().constraint_system());
   F zeta = GetHalo2Zeta<F>();
+  if (streaming_quotient_) {
+    const size_t quotient_poly_degree =
+        proving_key.verifying_key().constraint_system().ComputeDegree() - 1;
+    std::vector<F> h_coeffs = vanishing_argument.BuildExtendedCircuitCoeffs(
+        prover, proving_key, tables, theta, beta, gamma, y, zeta,
+        permutation_provers, lookup_provers, quotient_poly_degree);
+    h_poly_ = ExtendedPoly(
+        typename ExtendedPoly::Coefficients(std::move(h_coeffs)));
+    // Distribute powers to move from coset. See |ExtendedToCoeff()|.
+    DistributePowersZeta<F>(h_poly_, false);
+    return;
+  }
   h_evals_ = vanishing_argument.BuildExtendedCircuitColumn(
       prover, proving_key, tables, theta, beta, gamma, y, zeta,
       permutation_provers, lookup_provers);
@@ -73,13 +86,16 @@ void VanishingProver<Poly, Evals, ExtendedPoly,
                      ExtendedEvals>::CreateFinalHPoly(ProverBase<PCS>* prover,
                                                       const ConstraintSystem<F>&
                                                           constraint_system) {
-  // Divide by t(X) = Xⁿ - 1.
-  DivideByVanishingPolyInPlace<F>(h_evals_, prover->extended_domain(),
-                                  prover->domain());
+  // NOTE: |CreateHEvals()| has already obtained h(X) when streaming.
+  if (!streaming_quotient_) {
+    // Divide by t(X) = Xⁿ - 1.
+    DivideByVanishingPolyInPlace<F>(h_evals_, prover->extended_domain(),
+                                    prover->domain());
 
-  // Obtain final h(X) polynomial
-  h_poly_ = ExtendedToCoeff<F, ExtendedPoly>(std::move(h_evals_),
-                                             prover->extended_domain());
+    // Obtain final h(X) polynomial
+    h_poly_ = ExtendedToCoeff<F, ExtendedPoly>(std::move(h_evals_),
+                                               prover->extended_domain());
+  }
 
   // FIXME(TomTaehoonKim): Remove this if possible.
   const size_t quotient_poly_degree = constraint_system.ComputeDegree() - 1;
@@ -96,34 +112,40 @@ void VanishingProver<Poly, Evals, ExtendedPoly,
                                                       const ConstraintSystem<F>&
                                                           constraint_system,
                                                       size_t& commit_idx) {
-  // Truncate it to match the size of the quotient polynomial; the
-  // evaluation domain might be slightly larger than necessary because
-  // it always lies on a power-of-two boundary.
-  std::vector<F>& h_coeffs = h_poly_.coefficients().coefficients();
   const size_t quotient_poly_degree = constraint_system.ComputeDegree() - 1;
-  size_t n = prover->pcs().N();
-  h_coeffs.resize(n * quotient_poly_degree, F::Zero());
+  std::vector<absl::Span<const F>> h_pieces =
+      GetHPieces(prover->pcs().N(), quotient_poly_degree);
 
-  // Compute commitments to each h(X) piece
+  // Compute commitments to each h(X) piece. The pieces share the bases, so
+  // they are committed by a single batched MSM, or one by one instead of in
+  // parallel, since each MSM already runs in parallel by itself.
   if constexpr (PCS::kSupportsBatchMode) {
-    base::ParallelizeByChunkSize(
-        h_coeffs, n,
-        [commit_idx, prover](absl::Span<const F> h_piece, size_t chunk_index) {
-          prover->BatchCommitAt(h_piece, commit_idx + chunk_index);
-        });
+    prover->BatchCommitAllAt(h_pieces, commit_idx);
     commit_idx += quotient_poly_degree;
   } else {
-    using Commitment = typename PCS::Commitment;
-    std::vector<Commitment> commitments = base::ParallelizeMapByChunkSize(
-        h_coeffs, n, [prover](absl::Span<const F> h_piece) {
-          return prover->Commit(h_piece);
-        });
-    for (const Commitment& commitment : commitments) {
-      CHECK(prover->GetWriter()->WriteToProof(commitment));
+    for (absl::Span<const F> h_piece : h_pieces) {
+      prover->CommitAndWriteToProof(h_piece);
     }
   }
 }
 
+template <typename Poly, typename Evals, typename ExtendedPoly,
+          typename ExtendedEvals>
+std::vector<absl::Span<const typename Poly::Field>>
+VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals>::GetHPieces(
+    size_t n, size_t quotient_poly_degree) const {
+  // The evaluation domain might be slightly larger than necessary because it
+  // always lies on a power-of-two boundary, while the high degree zeros might
+  // be removed, so the coefficients are viewed as |quotient_poly_degree|
+  // pieces of at most |n| coefficients without being resized.
+  const std::vector<F>& h_coeffs = h_poly_.coefficients().coefficients();
+  return base::CreateVector(quotient_poly_degree, [&h_coeffs, n](size_t i) {
+    size_t begin = std::min(i * n, h_coeffs.size());
+    size_t end = std::min(begin + n, h_coeffs.size());
+    return absl::Span<const F>(h_coeffs.data() + begin, end - begin);
+  });
+}
+
 // static
 template <typename Poly, typename Evals, typename ExtendedPoly,
           typename ExtendedEvals>
@@ -164,15 +186,14 @@ void VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals>::BatchEvaluate(
                   constraint_system.fixed_queries(), x);
 
   size_t n = prover->pcs().N();
-  auto h_chunks = base::Chunked(h_poly_.coefficients().coefficients(), n);
-  std::vector<absl::Span<F>> h_pieces =
-      base::Map(h_chunks.begin(), h_chunks.end(),
-                [](absl::Span<F> h_piece) { return h_piece; });
+  std::vector<absl::Span<const F>> h_pieces =
+      GetHPieces(n, constraint_system.ComputeDegree() - 1);
   std::vector<F> coeffs(n);
   for (size_t i = h_pieces.size() - 1; i != SIZE_MAX; --i) {
+    absl::Span<const F> h_piece = h_pieces[i];
     OPENMP_PARALLEL_FOR(size_t j = 0; j < n; ++j) {
       coeffs[j] *= x_n;
-      coeffs[j] += h_pieces[i][j];
+      if (j < h_piece.size()) coeffs[j] += h_piece[j];
     }
   }
   combined_h_poly_ = Poly(Coefficients(std::move(coeffs), true));
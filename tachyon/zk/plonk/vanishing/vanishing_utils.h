@@ -12,6 +12,8 @@
 
 #include "absl/types/span.h"
 
+#include "tachyon/base/memory/vector_pool.h"
+#include "tachyon/base/optional.h"
 #include "tachyon/base/parallelize.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/prover_base.h"
@@ -127,6 +129,62 @@ ExtendedPoly ExtendedToCoeff(ExtendedEvals&& evals,
   return poly;
 }
 
+// This accumulates |part|, the evaluations of the circuit polynomial over the
+// coset ζ * ωₑᵖ * H where ωₑ is the generator of the extended domain and p is
+// |part_idx|, into |coeffs|. Once every part is accumulated, |coeffs| is the
+// same as the first |coeffs.size()| coefficients that
+// |DivideByVanishingPolyInPlace()| followed by the IFFT of
+// |ExtendedToCoeff()| gives, before the powers of ζ are distributed, so the
+// evaluations of every part never have to be held at once.
+//
+// Let g(X) be that polynomial, P be |num_parts| and μ = ωₑⁿ. The IFFT of the
+// part over H gives cₚ[k] = ωₑᵖᵏ * Σₘ gₖ₊ₘₙ * μᵖᵐ, so that
+// gₖ₊ₘₙ = (1 / P) * Σₚ ωₑ⁻ᵖᵏ * cₚ[k] * μ⁻ᵖᵐ. Since t(X) = Xⁿ - 1 is the
+// constant ζⁿ * μᵖ - 1 over the coset, the part is divided by it as well.
+template <typename F, typename Domain>
+void AccumulateExtendedCoeffsByPart(std::vector<F>&& part, size_t part_idx,
+                                    size_t num_parts, const F& extended_omega,
+                                    const Domain* domain,
+                                    std::vector<F>& coeffs) {
+  using Evals = typename Domain::Evals;
+  using DensePoly = typename Domain::DensePoly;
+
+  size_t n = domain->size();
+  CHECK_EQ(part.size(), n);
+  CHECK_EQ(coeffs.size() % n, size_t{0});
+  size_t num_pieces = coeffs.size() / n;
+
+  const F zeta = GetHalo2Zeta<F>();
+  const F mu_p = extended_omega.Pow(n).Pow(part_idx);
+  // 1 / (P * (ζⁿ * μᵖ - 1))
+  const F factor =
+      unwrap((F(num_parts) * (zeta.Pow(n) * mu_p - F::One())).Inverse());
+  const F mu_p_inv = unwrap(mu_p.Inverse());
+  const F omega_p_inv = unwrap(extended_omega.Pow(part_idx).Inverse());
+  std::vector<F> mu_p_inv_powers =
+      F::GetSuccessivePowers(num_pieces, mu_p_inv);
+
+  DensePoly poly = domain->IFFT(Evals(std::move(part)));
+  std::vector<F>& part_coeffs = poly.coefficients().coefficients();
+  base::Parallelize(part_coeffs, [&omega_p_inv, &factor, &mu_p_inv_powers, n,
+                                  &coeffs](absl::Span<F> chunk,
+                                           size_t chunk_offset,
+                                           size_t chunk_size) {
+    size_t start = chunk_offset * chunk_size;
+    F d_factor = factor * omega_p_inv.Pow(start);
+    for (size_t i = 0; i < chunk.size(); ++i) {
+      // dₚ[k] = ωₑ⁻ᵖᵏ * cₚ[k] / P
+      F d = chunk[i] * d_factor;
+      for (size_t m = 0; m < mu_p_inv_powers.size(); ++m) {
+        coeffs[m * n + start + i] += d * mu_p_inv_powers[m];
+      }
+      d_factor *= omega_p_inv;
+    }
+  });
+  base::VectorPool<F>::GetDefault().Release(
+      std::move(poly).TakeCoefficients().TakeCoefficients());
+}
+
 template <typename F>
 std::vector<F> BuildExtendedColumnWithColumns(
     const std::vector<std::vector<F>>& columns) {
@@ -134,7 +192,10 @@ std::vector<F> BuildExtendedColumnWithColumns(
   size_t cols = columns.size();
   size_t rows = columns[0].size();
 
-  std::vector<F> flattened_transposed_columns(cols * rows);
+  // NOTE: Every element is overwritten below, so the storage doesn't have to
+  // be zero-initialized.
+  std::vector<F> flattened_transposed_columns =
+      base::VectorPool<F>::GetDefault().Acquire(cols * rows);
   OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < columns.size(); ++i) {
     for (size_t j = 0; j < rows; ++j) {
       flattened_transposed_columns[j * cols + i] = columns[i][j];
@@ -6,6 +6,8 @@
 
 #include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -27,6 +29,13 @@ class VanishingUtilsTest : public testing::Test {
   using Poly = typename Domain::DensePoly;
   using Coeffs = typename Poly::Coefficients;
   using Evals = typename Domain::Evals;
+
+  constexpr static size_t kNumParts = 4;
+  constexpr static size_t kExtendedMaxDegree = kNumParts * N - 1;
+
+  using ExtendedDomain =
+      math::UnivariateEvaluationDomain<F, kExtendedMaxDegree>;
+  using ExtendedEvals = typename ExtendedDomain::Evals;
 };
 
 }  // namespace
@@ -50,4 +59,32 @@ TEST_F(VanishingUtilsTest, BuildExtendedColumnWithColumns) {
   }
 }
 
+TEST_F(VanishingUtilsTest, AccumulateExtendedCoeffsByPart) {
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  std::unique_ptr<ExtendedDomain> extended_domain =
+      ExtendedDomain::Create(kNumParts * N);
+  // Only the first 3 pieces are accumulated like the quotient polynomial.
+  constexpr size_t kNumPieces = 3;
+  std::vector<std::vector<F>> parts = base::CreateVector(kNumParts, []() {
+    return base::CreateVector(N, []() { return F::Random(); });
+  });
+
+  ExtendedEvals extended_evals(BuildExtendedColumnWithColumns(parts));
+  DivideByVanishingPolyInPlace<F>(extended_evals, extended_domain.get(),
+                                  domain.get());
+  std::vector<F> expected = std::move(
+      extended_domain->IFFT(std::move(extended_evals))
+          .coefficients()
+          .coefficients());
+  expected.resize(kNumPieces * N, F::Zero());
+
+  std::vector<F> coeffs(kNumPieces * N, F::Zero());
+  for (size_t i = 0; i < kNumParts; ++i) {
+    AccumulateExtendedCoeffsByPart(std::move(parts[i]), i, kNumParts,
+                                   extended_domain->group_gen(), domain.get(),
+                                   coeffs);
+  }
+  EXPECT_EQ(coeffs, expected);
+}
+
 }  // namespace tachyon::zk::plonk
@@ -1,6 +1,12 @@
 #ifndef TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_CIRCUIT_H_
 #define TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_CIRCUIT_H_
 
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/zk/r1cs/constraint_system/constraint_system.h"
 
 namespace tachyon::zk::r1cs {
@@ -13,6 +19,24 @@ class Circuit {
   virtual void Synthesize(ConstraintSystem<F>& constraint_system) const = 0;
 };
 
+// Synthesizes each of |circuits| into its own sub-system of
+// |constraint_system| in parallel and then absorbs them in order. The result
+// is the same as synthesizing them one by one into |constraint_system|, as
+// long as none of |circuits| refers to a variable it didn't create. See
+// |ConstraintSystem::Absorb()|.
+template <typename F>
+void SynthesizeInParallel(absl::Span<const Circuit<F>* const> circuits,
+                          ConstraintSystem<F>& constraint_system) {
+  std::vector<ConstraintSystem<F>> sub_systems(circuits.size());
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < circuits.size(); ++i) {
+    sub_systems[i] = constraint_system.CreateSubSystem();
+    circuits[i]->Synthesize(sub_systems[i]);
+  }
+  for (ConstraintSystem<F>& sub_system : sub_systems) {
+    constraint_system.Absorb(std::move(sub_system));
+  }
+}
+
 }  // namespace tachyon::zk::r1cs
 
 #endif  // TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_CIRCUIT_H_
@@ -8,6 +8,8 @@
 
 #include <stddef.h>
 
+#include <algorithm>
+#include <iterator>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -15,8 +17,8 @@
 #include "absl/container/btree_map.h"
 #include "gtest/gtest_prod.h"
 
-#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/functional/callback.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/zk/r1cs/constraint_system/constraint_matrices.h"
 #include "tachyon/zk/r1cs/constraint_system/linear_combination.h"
 #include "tachyon/zk/r1cs/constraint_system/optimization_goal.h"
@@ -264,16 +266,80 @@ class ConstraintSystem {
   // [Groth-Maller17](https://eprint.iacr.org/2017/540), addition gates
   // do not contribute to the size of the multi-scalar multiplication, which
   // is the dominating cost.
+  //
+  // An LC only depends on the LCs with lower indices, so the LCs are grouped
+  // into levels, where an LC only depends on the LCs of the lower levels. The
+  // LCs of each level are inlined in parallel, and an LC is freed as soon as
+  // the last level using it is done. The result is the same as inlining them
+  // one by one with |TransformLCMap()|.
   void InlineAllLCs() {
     // Only inline when a matrix representing R1CS is needed.
     if (!mode_.ShouldConstructMatrices()) return;
 
-    // A dummy closure is used, which means that
-    // - it does not modify the |inlined_lc|.
-    // - it does not add new witness variables.
-    TransformLCMap([](size_t, LinearCombination<F>& inlined_lc) {
-      return TransformLCMapResult(0);
-    });
+    std::vector<size_t> num_times_used = ComputeLCNumTimesUsed(false);
+
+    size_t num_lcs = lc_map_.size();
+    std::vector<LinearCombination<F>> lcs(num_lcs);
+    std::vector<size_t> levels(num_lcs, 0);
+    // |last_used_levels[i]| is the highest level of the LCs using the i-th LC.
+    std::vector<size_t> last_used_levels(num_lcs, 0);
+    size_t num_levels = 0;
+    for (std::pair<const size_t, LinearCombination<F>>& entry : lc_map_) {
+      size_t level = 0;
+      for (const Term<F>& term : entry.second.terms()) {
+        if (term.variable.IsSymbolicLinearCombination()) {
+          level = std::max(level, levels[term.variable.index()] + 1);
+        }
+      }
+      for (const Term<F>& term : entry.second.terms()) {
+        if (term.variable.IsSymbolicLinearCombination()) {
+          size_t& last_used_level = last_used_levels[term.variable.index()];
+          last_used_level = std::max(last_used_level, level);
+        }
+      }
+      levels[entry.first] = level;
+      num_levels = std::max(num_levels, level + 1);
+      lcs[entry.first] = std::move(entry.second);
+    }
+    lc_map_.clear();
+
+    std::vector<std::vector<size_t>> lcs_by_level(num_levels);
+    std::vector<std::vector<size_t>> lcs_by_last_used_level(num_levels);
+    for (size_t i = 0; i < num_lcs; ++i) {
+      lcs_by_level[levels[i]].push_back(i);
+      if (num_times_used[i] > 0) {
+        lcs_by_last_used_level[last_used_levels[i]].push_back(i);
+      }
+    }
+
+    for (size_t level = 0; level < num_levels; ++level) {
+      const std::vector<size_t>& indices = lcs_by_level[level];
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < indices.size(); ++i) {
+        LinearCombination<F> inlined_lc;
+        for (Term<F>& term : lcs[indices[i]].terms()) {
+          if (term.variable.IsSymbolicLinearCombination()) {
+            // The LCs of the lower levels are already inlined and are only
+            // read by this level.
+            const LinearCombination<F>& lc = lcs[term.variable.index()];
+            inlined_lc.AppendTerms((lc * term.coefficient).TakeTerms());
+          } else {
+            inlined_lc.AppendTerm(std::move(term));
+          }
+        }
+        inlined_lc.Deduplicate();
+        lcs[indices[i]] = std::move(inlined_lc);
+      }
+      // Delete linear combinations that are no longer used.
+      for (size_t index : lcs_by_last_used_level[level]) {
+        lcs[index] = LinearCombination<F>();
+      }
+    }
+
+    for (size_t i = 0; i < num_lcs; ++i) {
+      if (num_times_used[i] == 0) {
+        lc_map_.insert(lc_map_.end(), {i, std::move(lcs[i])});
+      }
+    }
   }
 
   // If a |SymbolicLinearCombination| is used in more than one location and has
@@ -363,6 +429,77 @@ class ConstraintSystem {
     }
   }
 
+  // Returns an empty constraint system with the same mode and optimization
+  // goal as |this|, into which an independent sub-circuit can be synthesized
+  // while others are synthesized into other sub-systems. See |Absorb()|.
+  ConstraintSystem CreateSubSystem() const {
+    ConstraintSystem ret;
+    ret.mode_ = mode_;
+    ret.optimization_goal_ = optimization_goal_;
+    return ret;
+  }
+
+  // Appends the variables, linear combinations and constraints of |other|,
+  // which must be created by |CreateSubSystem()|, to |this|. The result is the
+  // same as if they were created on |this| in the same order. Since their
+  // indices are shifted, |other| must not refer to the variables of |this|.
+  void Absorb(ConstraintSystem&& other) {
+    size_t instance_offset = num_instance_variables_ - 1;
+    size_t witness_offset = num_witness_variables_;
+    size_t lc_offset = num_linear_combinations_;
+
+    for (std::pair<const size_t, LinearCombination<F>>& entry :
+         other.lc_map_) {
+      for (Term<F>& term : entry.second.terms()) {
+        const Variable& v = term.variable;
+        switch (v.type()) {
+          case Variable::Type::kZero:
+          case Variable::Type::kOne:
+            break;
+          case Variable::Type::kInstance:
+            term.variable = Variable::Instance(v.index() + instance_offset);
+            break;
+          case Variable::Type::kWitness:
+            term.variable = Variable::Witness(v.index() + witness_offset);
+            break;
+          case Variable::Type::kSymbolicLinearCombination:
+            term.variable =
+                Variable::SymbolicLinearCombination(v.index() + lc_offset);
+            break;
+        }
+      }
+      lc_map_.insert(lc_map_.end(),
+                     {entry.first + lc_offset, std::move(entry.second)});
+    }
+    auto append_constraints = [lc_offset](const std::vector<size_t>& from,
+                                          std::vector<size_t>& to) {
+      to.reserve(to.size() + from.size());
+      for (size_t index : from) {
+        to.push_back(index + lc_offset);
+      }
+    };
+    append_constraints(other.a_constraints_, a_constraints_);
+    append_constraints(other.b_constraints_, b_constraints_);
+    append_constraints(other.c_constraints_, c_constraints_);
+
+    if (!mode_.IsSetup()) {
+      // The first instance assignment of |other| is the one of |CreateOne()|.
+      instance_assignments_.insert(
+          instance_assignments_.end(),
+          std::make_move_iterator(other.instance_assignments_.begin() + 1),
+          std::make_move_iterator(other.instance_assignments_.end()));
+      witness_assignments_.insert(
+          witness_assignments_.end(),
+          std::make_move_iterator(other.witness_assignments_.begin()),
+          std::make_move_iterator(other.witness_assignments_.end()));
+    }
+
+    num_instance_variables_ += other.num_instance_variables_ - 1;
+    num_witness_variables_ += other.num_witness_variables_;
+    num_constraints_ += other.num_constraints_;
+    num_linear_combinations_ += other.num_linear_combinations_;
+  }
+
   // Finalize the constraint system (either by outlining or inlining,
   // if an optimization goal is set).
   void Finalize() {
@@ -450,10 +587,12 @@ class ConstraintSystem {
   FRIEND_TEST(ConstraintSystemTest, GetAssignedValue);
 
   Matrix<F> MakeMatrix(const std::vector<size_t>& constraints) const {
-    return Matrix<F>(base::Map(constraints, [this](size_t index) {
-      auto it = lc_map_.find(index);
-      return MakeRow(it->second);
-    }));
+    std::vector<std::vector<Cell<F>>> rows(constraints.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < constraints.size(); ++i) {
+      auto it = lc_map_.find(constraints[i]);
+      rows[i] = MakeRow(it->second);
+    }
+    return Matrix<F>(std::move(rows));
   }
 
   F DoEvalLinearCombination(const LinearCombination<F>& lc) const {
@@ -4,6 +4,7 @@
 
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
 #include "tachyon/math/finite_fields/test/gf7.h"
+#include "tachyon/zk/r1cs/constraint_system/test/simple_circuit.h"
 
 namespace tachyon::zk::r1cs {
 
@@ -275,4 +276,33 @@ TEST_F(ConstraintSystemTest, IsSatisfied) {
   ASSERT_TRUE(!constraint_system.IsSatisfied());
 }
 
+TEST_F(ConstraintSystemTest, SynthesizeInParallel) {
+  SimpleCircuit<F> circuit0(F(2), F(3));
+  SimpleCircuit<F> circuit1(F(4), F(5));
+  SimpleCircuit<F> circuit2(F(6), F(1));
+  std::vector<const Circuit<F>*> circuits = {&circuit0, &circuit1, &circuit2};
+
+  ConstraintSystem<F> expected;
+  for (const Circuit<F>* circuit : circuits) {
+    circuit->Synthesize(expected);
+  }
+  expected.Finalize();
+
+  ConstraintSystem<F> constraint_system;
+  SynthesizeInParallel(absl::MakeConstSpan(circuits), constraint_system);
+  constraint_system.Finalize();
+
+  EXPECT_EQ(constraint_system.num_instance_variables(),
+            expected.num_instance_variables());
+  EXPECT_EQ(constraint_system.num_witness_variables(),
+            expected.num_witness_variables());
+  EXPECT_EQ(constraint_system.num_constraints(), expected.num_constraints());
+  EXPECT_EQ(constraint_system.instance_assignments(),
+            expected.instance_assignments());
+  EXPECT_EQ(constraint_system.witness_assignments(),
+            expected.witness_assignments());
+  EXPECT_EQ(constraint_system.ToMatrices(), expected.ToMatrices());
+  EXPECT_TRUE(constraint_system.IsSatisfied());
+}
+
 }  // namespace tachyon::zk::r1cs
@@ -17,6 +17,7 @@
 #include "absl/strings/substitute.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/matrix/sparse/sparse_matrix.h"
 
 namespace tachyon::zk::r1cs {
 
@@ -54,6 +55,23 @@ class Matrix {
                            });
   }
 
+  // Returns |this| in the CSR layout, where the cells of all the rows are
+  // stored contiguously in a single vector.
+  math::CSRSparseMatrix<F> ToCSR() const {
+    typename math::CSRSparseMatrix<F>::Elements elements;
+    elements.reserve(CountNonZero());
+    std::vector<size_t> row_ptrs;
+    row_ptrs.reserve(cells_.size() + 1);
+    row_ptrs.push_back(0);
+    for (const std::vector<Cell<F>>& row : cells_) {
+      for (const Cell<F>& cell : row) {
+        elements.push_back({cell.index, cell.coefficient});
+      }
+      row_ptrs.push_back(elements.size());
+    }
+    return {std::move(elements), std::move(row_ptrs)};
+  }
+
   bool operator==(const Matrix& other) const { return cells_ == other.cells_; }
   bool operator!=(const Matrix& other) const { return cells_ != other.cells_; }
 
@@ -0,0 +1,54 @@
+#include "tachyon/zk/r1cs/constraint_system/matrix.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+#include "tachyon/zk/r1cs/constraint_system/quadratic_arithmetic_program.h"
+
+namespace tachyon::zk::r1cs {
+
+namespace {
+
+using F = math::GF7;
+
+class MatrixTest : public math::FiniteFieldTest<F> {
+ public:
+  void SetUp() override {
+    // clang-format off
+    matrix_ = Matrix<F>({
+        {{F(1), 0}, {F(4), 2}},
+        {},
+        {{F(5), 1}, {F(2), 2}, {F(1), 3}},
+    });
+    // clang-format on
+  }
+
+ protected:
+  Matrix<F> matrix_;
+};
+
+}  // namespace
+
+TEST_F(MatrixTest, ToCSR) {
+  math::CSRSparseMatrix<F> csr = matrix_.ToCSR();
+  EXPECT_EQ(csr.GetData(), std::vector<F>({F(1), F(4), F(5), F(2), F(1)}));
+  EXPECT_EQ(csr.GetColumnIndices(), std::vector<size_t>({0, 2, 1, 2, 3}));
+  EXPECT_EQ(csr.row_ptrs(), std::vector<size_t>({0, 2, 2, 5}));
+}
+
+TEST_F(MatrixTest, EvaluateConstraints) {
+  std::vector<F> assignments = {F(3), F(1), F(2), F(6)};
+
+  std::vector<F> results(3);
+  EvaluateConstraints(matrix_.ToCSR(), absl::MakeConstSpan(assignments),
+                      absl::MakeSpan(results));
+  for (size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(results[i], EvaluateConstraint(matrix_[i],
+                                             absl::MakeConstSpan(assignments)));
+  }
+}
+
+}  // namespace tachyon::zk::r1cs
@@ -14,9 +14,14 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/optional.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/math/matrix/sparse/sparse_matrix.h"
+#include "tachyon/math/matrix/sparse/sparse_matrix_vector_mul.h"
 #include "tachyon/zk/r1cs/constraint_system/constraint_system.h"
 #include "tachyon/zk/r1cs/constraint_system/qap_instance_map_result.h"
 #include "tachyon/zk/r1cs/constraint_system/qap_witness_map_result.h"
@@ -41,6 +46,53 @@ F EvaluateConstraint(const std::vector<Cell<F>>& cells,
   return std::accumulate(sums.begin(), sums.end(), F::Zero(), std::plus<>());
 }
 
+// Evaluates the first |results.size()| rows of |matrix| with |assignments|.
+// Unlike |EvaluateConstraint()|, the rows are evaluated in parallel by
+// |math::SparseMatrixVectorMul()|.
+template <typename F>
+void EvaluateConstraints(const math::CSRSparseMatrix<F>& matrix,
+                         absl::Span<const F> assignments,
+                         absl::Span<F> results) {
+  math::SparseMatrixVectorMul(matrix, assignments, results);
+}
+
+// Returns (a[i] * b[i] - c[i]) * |factor| over the coset |shift| * H, where
+// |a|, |b| and |c| are evaluations over the domain H of |domain|. The three
+// are moved onto the coset at once by |LDEBatch()|, which fuses each IFFT, the
+// coset shift and the FFT, and the result is combined in place into |a|.
+template <typename Domain, typename F>
+std::vector<F> ComputeABMinusCOverCoset(const Domain* domain,
+                                        std::vector<F>&& a,
+                                        std::vector<F>&& b,
+                                        std::vector<F>&& c, const F& shift,
+                                        const F& factor) {
+  using Evals = typename Domain::Evals;
+
+  std::vector<Evals> evals_vec;
+  evals_vec.reserve(3);
+  evals_vec.emplace_back(std::move(a));
+  evals_vec.emplace_back(std::move(b));
+  evals_vec.emplace_back(std::move(c));
+  evals_vec = domain->LDEBatch(std::move(evals_vec), 1, shift);
+
+  std::vector<F> ret = std::move(evals_vec[0]).TakeEvaluations();
+  const Evals& b_evals = evals_vec[1];
+  const Evals& c_evals = evals_vec[2];
+  if (factor.IsOne()) {
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < ret.size(); ++i) {
+      ret[i] *= b_evals[i];
+      ret[i] -= c_evals[i];
+    }
+  } else {
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < ret.size(); ++i) {
+      ret[i] *= b_evals[i];
+      ret[i] -= c_evals[i];
+      ret[i] *= factor;
+    }
+  }
+  return ret;
+}
+
 template <typename F>
 class QuadraticArithmeticProgram {
  public:
@@ -125,7 +177,6 @@ class QuadraticArithmeticProgram {
       const Domain* domain, const ConstraintMatrices<F>& matrices,
       absl::Span<const F> full_assignments) {
     using Evals = typename Domain::Evals;
-    using DensePoly = typename Domain::DensePoly;
 
     CHECK_GE(domain->size(), matrices.num_constraints);
 
@@ -142,46 +193,30 @@ class QuadraticArithmeticProgram {
     //        = 0                      (otherwise)
     // where x is |full_assignments|.
     // clang-format on
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < matrices.num_constraints; ++i) {
-      a[i] = EvaluateConstraint(matrices.a[i], full_assignments);
-      b[i] = EvaluateConstraint(matrices.b[i], full_assignments);
-      c[i] = EvaluateConstraint(matrices.c[i], full_assignments);
-    }
+    size_t num_constraints = matrices.num_constraints;
+    EvaluateConstraints(matrices.a.ToCSR(), full_assignments,
+                        absl::MakeSpan(a).first(num_constraints));
+    EvaluateConstraints(matrices.b.ToCSR(), full_assignments,
+                        absl::MakeSpan(b).first(num_constraints));
+    EvaluateConstraints(matrices.c.ToCSR(), full_assignments,
+                        absl::MakeSpan(c).first(num_constraints));
 
     for (size_t i = matrices.num_constraints;
          i < matrices.num_constraints + matrices.num_instance_variables; ++i) {
       a[i] = full_assignments[i - matrices.num_constraints];
     }
 
-    Evals a_evals(std::move(a));
-    DensePoly a_poly = domain->IFFT(std::move(a_evals));
-    Evals b_evals(std::move(b));
-    DensePoly b_poly = domain->IFFT(std::move(b_evals));
-    Evals c_evals(std::move(c));
-    DensePoly c_poly = domain->IFFT(std::move(c_evals));
-
-    std::unique_ptr<Domain> coset_domain =
-        domain->GetCoset(F::FromMontgomery(F::Config::kSubgroupGenerator));
-
-    a_evals = coset_domain->FFT(std::move(a_poly));
-    b_evals = coset_domain->FFT(std::move(b_poly));
-    c_evals = coset_domain->FFT(std::move(c_poly));
-
+    F g = F::FromMontgomery(F::Config::kSubgroupGenerator);
     F vanishing_polynomial_over_coset =
-        unwrap(domain
-                   ->EvaluateVanishingPolynomial(
-                       F::FromMontgomery(F::Config::kSubgroupGenerator))
-                   .Inverse());
+        unwrap(domain->EvaluateVanishingPolynomial(g).Inverse());
 
     // |h_evals[i]| = (|a[i]| * |b[i]| - |c[i]|)) / (g * ωⁿ⁺ˡ⁺¹ - 1)
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < domain->size(); ++i) {
-      F& h_evals_i = a_evals.at(i);
-      h_evals_i *= b_evals[i];
-      h_evals_i -= c_evals[i];
-      h_evals_i *= vanishing_polynomial_over_coset;
-    }
+    Evals h_evals(ComputeABMinusCOverCoset(domain, std::move(a), std::move(b),
+                                           std::move(c), g,
+                                           vanishing_polynomial_over_coset));
 
-    return coset_domain->IFFT(std::move(a_evals))
+    std::unique_ptr<Domain> coset_domain = domain->GetCoset(g);
+    return coset_domain->IFFT(std::move(h_evals))
         .TakeCoefficients()
         .TakeCoefficients();
   }
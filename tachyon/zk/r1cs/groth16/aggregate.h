@@ -0,0 +1,611 @@
+#ifndef TACHYON_ZK_R1CS_GROTH16_AGGREGATE_H_
+#define TACHYON_ZK_R1CS_GROTH16_AGGREGATE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include <array>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "openssl/sha.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/optional.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/pairing/pairing.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/zk/r1cs/groth16/aggregate_proof.h"
+#include "tachyon/zk/r1cs/groth16/aggregation_srs.h"
+#include "tachyon/zk/r1cs/groth16/prepared_verifying_key.h"
+#include "tachyon/zk/r1cs/groth16/proof.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+namespace internal {
+
+// The Fiat-Shamir transcript of the aggregation. The messages are serialized
+// and absorbed into a running SHA-256 state, so that the elements of the
+// target group can be absorbed as well as the points.
+template <typename F>
+class AggregationTranscript {
+ public:
+  AggregationTranscript() {
+    constexpr char kDomainSeparator[] = "tachyon-groth16-snarkpack";
+    SHA256_Init(&state_);
+    SHA256_Update(&state_, kDomainSeparator, sizeof(kDomainSeparator) - 1);
+  }
+
+  template <typename... Args>
+  [[nodiscard]] bool Write(const Args&... args) {
+    base::Uint8VectorBuffer buffer;
+    if (!buffer.WriteMany(args...)) return false;
+    Update(buffer);
+    return true;
+  }
+
+  template <typename Container>
+  [[nodiscard]] bool WritePublicInputs(
+      absl::Span<const Container> public_inputs_vec) {
+    base::Uint8VectorBuffer buffer;
+    for (const Container& public_inputs : public_inputs_vec) {
+      for (const F& public_input : public_inputs) {
+        if (!buffer.Write(public_input)) return false;
+      }
+    }
+    Update(buffer);
+    return true;
+  }
+
+  // Returns a non-zero challenge. The top byte of the digest is dropped so
+  // that it is always less than the modulus.
+  F SqueezeChallenge() {
+    using BigInt = typename F::BigIntTy;
+
+    while (true) {
+      uint8_t digest[SHA256_DIGEST_LENGTH];
+      SHA256_CTX hasher = state_;
+      SHA256_Final(digest, &hasher);
+      SHA256_Init(&state_);
+      SHA256_Update(&state_, digest, SHA256_DIGEST_LENGTH);
+
+      std::array<uint8_t, BigInt::kByteNums> bytes = {};
+      memcpy(bytes.data(), digest, SHA256_DIGEST_LENGTH - 1);
+      F challenge = F::FromBigInt(BigInt::FromBytesLE(bytes));
+      if (!challenge.IsZero()) return challenge;
+    }
+  }
+
+ private:
+  void Update(const base::Uint8VectorBuffer& buffer) {
+    SHA256_Update(&state_, buffer.owned_buffer().data(),
+                  buffer.owned_buffer().size());
+  }
+
+  SHA256_CTX state_;
+};
+
+template <typename Curve>
+std::vector<typename Curve::G2Prepared> PrepareG2Points(
+    absl::Span<const typename Curve::G2Curve::AffinePoint> points) {
+  using G2Prepared = typename Curve::G2Prepared;
+
+  std::vector<G2Prepared> ret(points.size());
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < points.size(); ++i) {
+    ret[i] = G2Prepared::From(points[i]);
+  }
+  return ret;
+}
+
+// Returns the Miller loop of Πᵢ e(|g1|[i], |g2|[i]). The Miller loops of
+// several inner pairing products are multiplied before a single final
+// exponentiation.
+template <typename Curve>
+typename Curve::Fp12 MillerLoop(
+    absl::Span<const typename Curve::G1Curve::AffinePoint> g1,
+    absl::Span<const typename Curve::G2Prepared> g2) {
+  return Curve::MultiMillerLoop(g1, g2);
+}
+
+// Returns [|points|[0] * |scalars|[0], |points|[1] * |scalars|[1], ...].
+template <typename Point, typename F>
+std::vector<Point> ScalePoints(absl::Span<const Point> points,
+                               absl::Span<const F> scalars) {
+  using JacobianPoint = math::JacobianPoint<typename Point::Curve>;
+
+  std::vector<JacobianPoint> scaled(points.size());
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < points.size(); ++i) {
+    scaled[i] = points[i] * scalars[i];
+  }
+  std::vector<Point> ret(points.size());
+  CHECK(JacobianPoint::BatchNormalize(scaled, &ret));
+  return ret;
+}
+
+// Returns |left| + |x| * |right| elementwise.
+template <typename Point, typename F>
+std::vector<Point> FoldPoints(absl::Span<const Point> left,
+                              absl::Span<const Point> right, const F& x) {
+  using JacobianPoint = math::JacobianPoint<typename Point::Curve>;
+
+  std::vector<JacobianPoint> folded(left.size());
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < left.size(); ++i) {
+    folded[i] = right[i] * x + left[i];
+  }
+  std::vector<Point> ret(left.size());
+  CHECK(JacobianPoint::BatchNormalize(folded, &ret));
+  return ret;
+}
+
+template <typename F>
+std::vector<F> FoldScalars(absl::Span<const F> left, absl::Span<const F> right,
+                           const F& x) {
+  std::vector<F> ret(left.size());
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < left.size(); ++i) {
+    ret[i] = left[i] + right[i] * x;
+  }
+  return ret;
+}
+
+// Returns the coefficients of Πⱼ (1 + |challenges|[j] * (|s| * X)^(2ᵏ⁻¹⁻ʲ)),
+// where k = |challenges.size()|. Its i-th coefficient is the one by which the
+// i-th element of a vector is multiplied when the vector is folded with
+// |challenges| and sⁱ is multiplied beforehand.
+template <typename F>
+std::vector<F> ComputeFoldingCoefficients(absl::Span<const F> challenges,
+                                          const F& s) {
+  std::vector<F> coeffs = {F::One()};
+  coeffs.reserve(size_t{1} << challenges.size());
+  // s^(2ᵗ)
+  F s_power = s;
+  for (size_t t = 0; t < challenges.size(); ++t) {
+    F y = challenges[challenges.size() - 1 - t] * s_power;
+    size_t size = coeffs.size();
+    for (size_t i = 0; i < size; ++i) {
+      coeffs.push_back(coeffs[i] * y);
+    }
+    s_power.SquareInPlace();
+  }
+  return coeffs;
+}
+
+// Evaluates the polynomial of |ComputeFoldingCoefficients()| at |point| in
+// O(k).
+template <typename F>
+F EvaluateFoldingPolynomial(absl::Span<const F> challenges, const F& s,
+                            const F& point) {
+  F ret = F::One();
+  // (s * point)^(2ᵗ)
+  F power = s * point;
+  for (size_t t = 0; t < challenges.size(); ++t) {
+    ret *= F::One() + challenges[challenges.size() - 1 - t] * power;
+    power.SquareInPlace();
+  }
+  return ret;
+}
+
+// Returns the coefficients of (f(X) - f(|point|)) / (X - |point|).
+template <typename F>
+std::vector<F> ComputeKZGQuotient(absl::Span<const F> coeffs, const F& point) {
+  std::vector<F> quotient(coeffs.size() - 1);
+  F acc = F::Zero();
+  for (size_t i = coeffs.size() - 1; i > 0; --i) {
+    acc = acc * point + coeffs[i];
+    quotient[i - 1] = acc;
+  }
+  return quotient;
+}
+
+template <typename Point, typename F>
+Point CommitKZG(absl::Span<const Point> powers, absl::Span<const F> coeffs) {
+  using Bucket = typename math::VariableBaseMSM<Point>::Bucket;
+
+  math::VariableBaseMSM<Point> msm;
+  Bucket bucket;
+  CHECK(msm.Run(powers.first(coeffs.size()), coeffs, &bucket));
+  return math::ConvertPoint<Point>(bucket);
+}
+
+}  // namespace internal
+
+// Aggregates |proofs| into a single proof of O(log m) size, following
+// SnarkPack (https://eprint.iacr.org/2021/529). |public_inputs_vec[i]| is the
+// public inputs of |proofs[i]|, which are bound to the transcript. The number
+// of proofs m has to be a power of 2 with 2 ≤ m ≤ |srs.MaxProofs()|.
+//
+// The prover commits to A, B and C, gets a challenge r and proves
+//
+//   Z_AB = Πᵢ e(Aᵢ, Bᵢ)^(rⁱ) and Z_C = Σᵢ rⁱ * Cᵢ
+//
+// with TIPP and MIPP, which halve the vectors in each round. The inner pairing
+// products of a round share their prepared G2 points, and their Miller loops
+// are multiplied before a single final exponentiation. The Miller loops, the
+// preparation of the G2 points and the folding all run in parallel.
+template <typename Curve, typename Container>
+[[nodiscard]] bool AggregateProofs(
+    const AggregationSRS<Curve>& srs, absl::Span<const Proof<Curve>> proofs,
+    absl::Span<const Container> public_inputs_vec,
+    AggregateProof<Curve>* aggregate_proof) {
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Fp12 = typename Curve::Fp12;
+  using F = typename G1Point::ScalarField;
+  using G1Bucket = typename math::VariableBaseMSM<G1Point>::Bucket;
+
+  size_t m = proofs.size();
+  if (m < 2 || !base::bits::IsPowerOfTwo(m) || m > srs.MaxProofs()) {
+    LOG(ERROR) << "Invalid number of proofs to aggregate: " << m;
+    return false;
+  }
+  if (public_inputs_vec.size() != m) {
+    LOG(ERROR) << "The number of proofs and public inputs do not match";
+    return false;
+  }
+
+  auto final_exponentiation = [](const Fp12& f) {
+    return Curve::FinalExponentiation(f);
+  };
+  auto miller_loop = [](absl::Span<const G1Point> g1,
+                        absl::Span<const G2Prepared> g2) {
+    return internal::MillerLoop<Curve>(g1, g2);
+  };
+
+  std::vector<G1Point> a =
+      base::Map(proofs, [](const Proof<Curve>& proof) { return proof.a(); });
+  std::vector<G2Point> b =
+      base::Map(proofs, [](const Proof<Curve>& proof) { return proof.b(); });
+  std::vector<G1Point> c =
+      base::Map(proofs, [](const Proof<Curve>& proof) { return proof.c(); });
+  // v = ([aⁱ]₂, [bⁱ]₂) and w = ([aᵐ⁺ⁱ]₁, [bᵐ⁺ⁱ]₁)
+  std::array<std::vector<G2Point>, 2> v = {
+      std::vector<G2Point>(srs.h_alpha_powers().begin(),
+                           srs.h_alpha_powers().begin() + m),
+      std::vector<G2Point>(srs.h_beta_powers().begin(),
+                           srs.h_beta_powers().begin() + m),
+  };
+  std::array<std::vector<G1Point>, 2> w = {
+      std::vector<G1Point>(srs.g_alpha_powers().begin() + m,
+                           srs.g_alpha_powers().begin() + 2 * m),
+      std::vector<G1Point>(srs.g_beta_powers().begin() + m,
+                           srs.g_beta_powers().begin() + 2 * m),
+  };
+  std::array<std::vector<G2Prepared>, 2> v_prepared = {
+      internal::PrepareG2Points<Curve>(v[0]),
+      internal::PrepareG2Points<Curve>(v[1]),
+  };
+
+  // com_ab = (e(A, v₀) * e(w₀, B), e(A, v₁) * e(w₁, B))
+  // com_c = (e(C, v₀), e(C, v₁))
+  {
+    std::vector<G2Prepared> b_prepared = internal::PrepareG2Points<Curve>(b);
+    for (size_t k = 0; k < 2; ++k) {
+      aggregate_proof->com_ab[k] = final_exponentiation(
+          miller_loop(a, v_prepared[k]) * miller_loop(w[k], b_prepared));
+      aggregate_proof->com_c[k] =
+          final_exponentiation(miller_loop(c, v_prepared[k]));
+    }
+  }
+
+  internal::AggregationTranscript<F> transcript;
+  if (!transcript.WritePublicInputs(public_inputs_vec)) return false;
+  if (!transcript.Write(aggregate_proof->com_ab, aggregate_proof->com_c)) {
+    return false;
+  }
+  F r = transcript.SqueezeChallenge();
+  F r_inv = unwrap(r.Inverse());
+  std::vector<F> rs = F::GetSuccessivePowers(m, r);
+
+  // Since e(wᵢ * r⁻ⁱ, Bᵢ * rⁱ) = e(wᵢ, Bᵢ), the commitment to (A, Bʳ) under
+  // (v, wʳ⁻¹) is still |com_ab|.
+  b = internal::ScalePoints<G2Point, F>(b, rs);
+  {
+    std::vector<F> r_inv_powers = F::GetSuccessivePowers(m, r_inv);
+    for (size_t k = 0; k < 2; ++k) {
+      w[k] = internal::ScalePoints<G1Point, F>(w[k], r_inv_powers);
+    }
+  }
+  std::vector<G2Prepared> b_prepared = internal::PrepareG2Points<Curve>(b);
+
+  math::VariableBaseMSM<G1Point> msm;
+  aggregate_proof->z_ab = final_exponentiation(miller_loop(a, b_prepared));
+  {
+    G1Bucket z_c;
+    if (!msm.Run(c, rs, &z_c)) return false;
+    aggregate_proof->z_c = math::ConvertPoint<G1Point>(z_c);
+  }
+  if (!transcript.Write(aggregate_proof->z_ab, aggregate_proof->z_c)) {
+    return false;
+  }
+
+  TippMippProof<Curve>& tmipp = aggregate_proof->tmipp;
+  tmipp.rounds.clear();
+  std::vector<F> xs;
+  std::vector<F> xs_inv;
+  while (a.size() > 1) {
+    size_t half = a.size() / 2;
+    auto left = [half](const auto& vec) {
+      return absl::MakeConstSpan(vec).first(half);
+    };
+    auto right = [half](const auto& vec) {
+      return absl::MakeConstSpan(vec).subspan(half);
+    };
+
+    TippMippRound<Curve> round;
+    for (size_t k = 0; k < 2; ++k) {
+      round.com_ab_l[k] = final_exponentiation(
+          miller_loop(right(a), left(v_prepared[k])) *
+          miller_loop(right(w[k]), left(b_prepared)));
+      round.com_ab_r[k] = final_exponentiation(
+          miller_loop(left(a), right(v_prepared[k])) *
+          miller_loop(left(w[k]), right(b_prepared)));
+      round.com_c_l[k] = final_exponentiation(
+          miller_loop(right(c), left(v_prepared[k])));
+      round.com_c_r[k] = final_exponentiation(
+          miller_loop(left(c), right(v_prepared[k])));
+    }
+    round.z_ab_l =
+        final_exponentiation(miller_loop(right(a), left(b_prepared)));
+    round.z_ab_r =
+        final_exponentiation(miller_loop(left(a), right(b_prepared)));
+    G1Bucket z_c_l;
+    if (!msm.Run(right(c), left(rs), &z_c_l)) return false;
+    round.z_c_l = math::ConvertPoint<G1Point>(z_c_l);
+    G1Bucket z_c_r;
+    if (!msm.Run(left(c), right(rs), &z_c_r)) return false;
+    round.z_c_r = math::ConvertPoint<G1Point>(z_c_r);
+
+    if (!transcript.Write(round)) return false;
+    F x = transcript.SqueezeChallenge();
+    F x_inv = unwrap(x.Inverse());
+
+    // A' = A_L + x * A_R, B' = B_L + x⁻¹ * B_R, C' = C_L + x * C_R,
+    // r' = r_L + x⁻¹ * r_R, v' = v_L + x⁻¹ * v_R and w' = w_L + x * w_R
+    a = internal::FoldPoints(left(a), right(a), x);
+    b = internal::FoldPoints(left(b), right(b), x_inv);
+    c = internal::FoldPoints(left(c), right(c), x);
+    rs = internal::FoldScalars(left(rs), right(rs), x_inv);
+    for (size_t k = 0; k < 2; ++k) {
+      v[k] = internal::FoldPoints(left(v[k]), right(v[k]), x_inv);
+      w[k] = internal::FoldPoints(left(w[k]), right(w[k]), x);
+    }
+    if (a.size() > 1) {
+      b_prepared = internal::PrepareG2Points<Curve>(b);
+      for (size_t k = 0; k < 2; ++k) {
+        v_prepared[k] = internal::PrepareG2Points<Curve>(v[k]);
+      }
+    }
+
+    tmipp.rounds.push_back(std::move(round));
+    xs.push_back(std::move(x));
+    xs_inv.push_back(std::move(x_inv));
+  }
+
+  tmipp.final_a = a[0];
+  tmipp.final_b = b[0];
+  tmipp.final_c = c[0];
+  tmipp.final_v = {v[0][0], v[1][0]};
+  tmipp.final_w = {w[0][0], w[1][0]};
+  if (!transcript.Write(tmipp.final_a, tmipp.final_b, tmipp.final_c,
+                        tmipp.final_v, tmipp.final_w)) {
+    return false;
+  }
+  F z = transcript.SqueezeChallenge();
+
+  // The final v is the commitment to fᵥ(X) = Πⱼ (1 + xⱼ⁻¹ * X^(2ᵏ⁻¹⁻ʲ)) under
+  // ([aⁱ]₂) and ([bⁱ]₂).
+  std::vector<F> v_quotient = internal::ComputeKZGQuotient<F>(
+      internal::ComputeFoldingCoefficients<F>(xs_inv, F::One()), z);
+  tmipp.v_opening = {
+      internal::CommitKZG<G2Point, F>(srs.h_alpha_powers(), v_quotient),
+      internal::CommitKZG<G2Point, F>(srs.h_beta_powers(), v_quotient),
+  };
+
+  // The final w is the commitment to
+  // f_w(X) = Xᵐ * Πⱼ (1 + xⱼ * (r⁻¹ * X)^(2ᵏ⁻¹⁻ʲ)) under ([aⁱ]₁) and ([bⁱ]₁).
+  std::vector<F> w_coeffs(m, F::Zero());
+  std::vector<F> w_folding_coeffs =
+      internal::ComputeFoldingCoefficients<F>(xs, r_inv);
+  w_coeffs.insert(w_coeffs.end(), w_folding_coeffs.begin(),
+                  w_folding_coeffs.end());
+  std::vector<F> w_quotient = internal::ComputeKZGQuotient<F>(w_coeffs, z);
+  tmipp.w_opening = {
+      internal::CommitKZG<G1Point, F>(srs.g_alpha_powers(), w_quotient),
+      internal::CommitKZG<G1Point, F>(srs.g_beta_powers(), w_quotient),
+  };
+  return true;
+}
+
+// Verifies |proof| aggregated by |AggregateProofs()| against |pvk|.
+// |public_inputs_vec[i]| is the public inputs of the i-th aggregated proof.
+//
+// After replaying the transcript and folding the commitments with the
+// challenges, which takes O(log m) exponentiations in the target group, it
+// checks
+//
+//   Z_AB ≟ e([α]₁, [β]₂)^(Σᵢ rⁱ) * e(Σᵢ rⁱ * Pᵢ, [γ]₂) * e(Z_C, [δ]₂),
+//
+// where Pᵢ is the prepared inputs of the i-th proof, the final TIPP and MIPP
+// relations and the KZG openings of the final commitment keys. The pairing
+// checks are raised to the power of random values and multiplied together,
+// so that they are run as a single multi Miller loop and final
+// exponentiation.
+template <typename Curve, typename Container>
+[[nodiscard]] bool VerifyAggregateProof(
+    const PreparedVerifyingKey<Curve>& pvk,
+    const AggregationVerifyingKey<Curve>& avk,
+    absl::Span<const Container> public_inputs_vec,
+    const AggregateProof<Curve>& proof) {
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+  using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+  using G2JacobianPoint = math::JacobianPoint<typename G2Point::Curve>;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Fp12 = typename Curve::Fp12;
+  using F = typename G1Point::ScalarField;
+  using Bucket = typename math::VariableBaseMSM<G1Point>::Bucket;
+
+  size_t m = public_inputs_vec.size();
+  if (m < 2 || !base::bits::IsPowerOfTwo(m)) {
+    LOG(ERROR) << "Invalid number of aggregated proofs: " << m;
+    return false;
+  }
+  const TippMippProof<Curve>& tmipp = proof.tmipp;
+  if (tmipp.rounds.size() != static_cast<size_t>(base::bits::Log2Floor(m))) {
+    LOG(ERROR) << "The number of rounds doesn't match with the number of "
+                  "proofs";
+    return false;
+  }
+
+  const std::vector<G1Point>& l_g1_query = pvk.verifying_key().l_g1_query();
+  for (const Container& public_inputs : public_inputs_vec) {
+    if (std::size(public_inputs) + 1 != l_g1_query.size()) {
+      LOG(ERROR) << "The size of public inputs doesn't match with verifying "
+                    "key";
+      return false;
+    }
+  }
+
+  internal::AggregationTranscript<F> transcript;
+  if (!transcript.WritePublicInputs(public_inputs_vec)) return false;
+  if (!transcript.Write(proof.com_ab, proof.com_c)) return false;
+  F r = transcript.SqueezeChallenge();
+  F r_inv = unwrap(r.Inverse());
+  if (!transcript.Write(proof.z_ab, proof.z_c)) return false;
+  std::vector<F> xs;
+  xs.reserve(tmipp.rounds.size());
+  for (const TippMippRound<Curve>& round : tmipp.rounds) {
+    if (!transcript.Write(round)) return false;
+    xs.push_back(transcript.SqueezeChallenge());
+  }
+  std::vector<F> xs_inv = xs;
+  if (!F::BatchInverseInPlace(xs_inv)) return false;
+  if (!transcript.Write(tmipp.final_a, tmipp.final_b, tmipp.final_c,
+                        tmipp.final_v, tmipp.final_w)) {
+    return false;
+  }
+  F z = transcript.SqueezeChallenge();
+
+  // com' = com * com_Lˣ * com_Rˣ⁻¹ and Z' = Z * Z_Lˣ * Z_Rˣ⁻¹
+  PairCommitment<Curve> com_ab = proof.com_ab;
+  PairCommitment<Curve> com_c = proof.com_c;
+  Fp12 z_ab = proof.z_ab;
+  G1JacobianPoint z_c = proof.z_c.ToJacobian();
+  for (size_t j = 0; j < tmipp.rounds.size(); ++j) {
+    const TippMippRound<Curve>& round = tmipp.rounds[j];
+    const F& x = xs[j];
+    const F& x_inv = xs_inv[j];
+    for (size_t k = 0; k < 2; ++k) {
+      com_ab[k] *= round.com_ab_l[k].Pow(x) * round.com_ab_r[k].Pow(x_inv);
+      com_c[k] *= round.com_c_l[k].Pow(x) * round.com_c_r[k].Pow(x_inv);
+    }
+    z_ab *= round.z_ab_l.Pow(x) * round.z_ab_r.Pow(x_inv);
+    z_c += round.z_c_l * x + round.z_c_r * x_inv;
+  }
+
+  // MIPP: Z_C' ≟ r' * C', where r' is folded from [r⁰, r¹, ...].
+  F r_folded = internal::EvaluateFoldingPolynomial<F>(xs_inv, F::One(), r);
+  if (tmipp.final_c * r_folded != z_c) {
+    LOG(ERROR) << "The final MIPP relation doesn't hold";
+    return false;
+  }
+
+  // |combined_inputs| = [Σᵢ rⁱ, Σᵢ rⁱ * xᵢ₀, Σᵢ rⁱ * xᵢ₁, ...]
+  std::vector<F> rs = F::GetSuccessivePowers(m, r);
+  std::vector<F> combined_inputs(l_g1_query.size());
+  combined_inputs[0] =
+      std::accumulate(rs.begin(), rs.end(), F::Zero(),
+                      [](F& acc, const F& r_power) { return acc += r_power; });
+  OPENMP_PARALLEL_FOR(size_t j = 1; j < combined_inputs.size(); ++j) {
+    F sum = F::Zero();
+    for (size_t i = 0; i < rs.size(); ++i) {
+      sum += rs[i] * public_inputs_vec[i][j - 1];
+    }
+    combined_inputs[j] = std::move(sum);
+  }
+  math::VariableBaseMSM<G1Point> msm;
+  // Σᵢ rⁱ * Pᵢ
+  Bucket prepared_inputs;
+  if (!msm.Run(l_g1_query, combined_inputs, &prepared_inputs)) return false;
+
+  F v_eval = internal::EvaluateFoldingPolynomial<F>(xs_inv, F::One(), z);
+  F w_eval =
+      z.Pow(m) * internal::EvaluateFoldingPolynomial<F>(xs, r_inv, z);
+
+  // The first check doesn't have to be randomized.
+  std::array<F, 10> rhos;
+  rhos[0] = F::One();
+  for (size_t i = 1; i < rhos.size(); ++i) {
+    rhos[i] = F::Random();
+  }
+
+  const G1Point& a = tmipp.final_a;
+  const G1Point& c = tmipp.final_c;
+  const std::array<G1Point, 2>& w = tmipp.final_w;
+  const std::array<G2Point, 2>& v = tmipp.final_v;
+  // clang-format off
+  // 0: e(Σᵢ rⁱ * Pᵢ, [-γ]₂) * e(Z_C, [-δ]₂) ≟ e([α]₁, [β]₂)^(Σᵢ rⁱ) * Z_AB⁻¹
+  // 1, 2: e(A', v'ₖ) * e(w'ₖ, B') ≟ com_ab'ₖ
+  // 3: e(A', B') ≟ Z_AB'
+  // 4, 5: e(C', v'ₖ) ≟ com_c'ₖ
+  // 6, 7: e([1]₁, v'ₖ - [fᵥ(z)]₂) * e(-([a or b]₁ - [z]₁), πᵥₖ) ≟ 1
+  // 8, 9: e(w'ₖ - [f_w(z)]₁, [1]₂) * e(-π_wₖ, [a or b]₂ - [z]₂) ≟ 1
+  // clang-format on
+  G1JacobianPoint g_w_eval = avk.g() * w_eval;
+  G1JacobianPoint g_z = avk.g() * z;
+  std::vector<G1JacobianPoint> g1_jacobian = {
+      math::ConvertPoint<G1JacobianPoint>(prepared_inputs),
+      proof.z_c.ToJacobian(),
+      a * rhos[1] + c * rhos[4],
+      a * rhos[2] + c * rhos[5],
+      w[0] * rhos[1] + w[1] * rhos[2] + a * rhos[3],
+      avk.g() * rhos[6],
+      -((avk.g_alpha().ToJacobian() - g_z) * rhos[6]),
+      avk.g() * rhos[7],
+      -((avk.g_beta().ToJacobian() - g_z) * rhos[7]),
+      (w[0].ToJacobian() - g_w_eval) * rhos[8] +
+          (w[1].ToJacobian() - g_w_eval) * rhos[9],
+      -(tmipp.w_opening[0] * rhos[8]),
+      -(tmipp.w_opening[1] * rhos[9]),
+  };
+  std::vector<G1Point> g1(g1_jacobian.size());
+  if (!G1JacobianPoint::BatchNormalize(g1_jacobian, &g1)) return false;
+
+  G2JacobianPoint h_v_eval = avk.h() * v_eval;
+  G2JacobianPoint h_z = avk.h() * z;
+  std::vector<G2Point> g2_affine = {
+      v[0],
+      v[1],
+      tmipp.final_b,
+      (v[0].ToJacobian() - h_v_eval).ToAffine(),
+      tmipp.v_opening[0],
+      (v[1].ToJacobian() - h_v_eval).ToAffine(),
+      tmipp.v_opening[1],
+      avk.h(),
+      (avk.h_alpha().ToJacobian() - h_z).ToAffine(),
+      (avk.h_beta().ToJacobian() - h_z).ToAffine(),
+  };
+  std::vector<G2Prepared> g2 = {pvk.gamma_neg_g2(), pvk.delta_neg_g2()};
+  g2.reserve(g1.size());
+  for (const G2Point& point : g2_affine) {
+    g2.push_back(G2Prepared::From(point));
+  }
+
+  std::optional<Fp12> z_ab_inv = proof.z_ab.Inverse();
+  if (!z_ab_inv.has_value()) return false;
+  Fp12 expected = pvk.alpha_g1_beta_g2().Pow(combined_inputs[0]) *
+                  *z_ab_inv * com_ab[0].Pow(rhos[1]) *
+                  com_ab[1].Pow(rhos[2]) * z_ab.Pow(rhos[3]) *
+                  com_c[0].Pow(rhos[4]) * com_c[1].Pow(rhos[5]);
+  return math::Pairing<Curve>(g1, g2) == expected;
+}
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_AGGREGATE_H_
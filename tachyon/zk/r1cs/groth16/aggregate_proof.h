@@ -0,0 +1,176 @@
+#ifndef TACHYON_ZK_R1CS_GROTH16_AGGREGATE_PROOF_H_
+#define TACHYON_ZK_R1CS_GROTH16_AGGREGATE_PROOF_H_
+
+#include <array>
+#include <vector>
+
+#include "tachyon/base/buffer/copyable.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// The commitment to a vector, which is a pair of inner pairing products: one
+// under the keys of a and the other under the keys of b. See |AggregationSRS|.
+template <typename Curve>
+using PairCommitment = std::array<typename Curve::Fp12, 2>;
+
+// The messages of a single round of TIPP on (A, Bʳ) and MIPP on (C, r), where
+// L and R denote the left and the right halves of the vectors and keys.
+template <typename Curve>
+struct TippMippRound {
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using Fp12 = typename Curve::Fp12;
+
+  // Commitments to (A_R, Bʳ_L) and (A_L, Bʳ_R) under (v_L, w_R) and
+  // (v_R, w_L).
+  PairCommitment<Curve> com_ab_l;
+  PairCommitment<Curve> com_ab_r;
+  // e(A_R, Bʳ_L) and e(A_L, Bʳ_R)
+  Fp12 z_ab_l;
+  Fp12 z_ab_r;
+  // Commitments to C_R and C_L under v_L and v_R.
+  PairCommitment<Curve> com_c_l;
+  PairCommitment<Curve> com_c_r;
+  // <C_R, r_L> and <C_L, r_R>
+  G1Point z_c_l;
+  G1Point z_c_r;
+
+  bool operator==(const TippMippRound& other) const {
+    return com_ab_l == other.com_ab_l && com_ab_r == other.com_ab_r &&
+           z_ab_l == other.z_ab_l && z_ab_r == other.z_ab_r &&
+           com_c_l == other.com_c_l && com_c_r == other.com_c_r &&
+           z_c_l == other.z_c_l && z_c_r == other.z_c_r;
+  }
+  bool operator!=(const TippMippRound& other) const {
+    return !operator==(other);
+  }
+};
+
+// The proof of the TIPP and MIPP arguments run together over log₂(m) rounds,
+// along with the KZG openings of the final commitment keys.
+template <typename Curve>
+struct TippMippProof {
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+
+  std::vector<TippMippRound<Curve>> rounds;
+  G1Point final_a;
+  G2Point final_b;
+  G1Point final_c;
+  std::array<G2Point, 2> final_v;
+  std::array<G1Point, 2> final_w;
+  // Openings of |final_v| and |final_w| at the challenge z.
+  std::array<G2Point, 2> v_opening;
+  std::array<G1Point, 2> w_opening;
+
+  bool operator==(const TippMippProof& other) const {
+    return rounds == other.rounds && final_a == other.final_a &&
+           final_b == other.final_b && final_c == other.final_c &&
+           final_v == other.final_v && final_w == other.final_w &&
+           v_opening == other.v_opening && w_opening == other.w_opening;
+  }
+  bool operator!=(const TippMippProof& other) const {
+    return !operator==(other);
+  }
+};
+
+// A SnarkPack aggregate of m Groth16 proofs (Aᵢ, Bᵢ, Cᵢ). Its size is
+// O(log m).
+template <typename Curve>
+struct AggregateProof {
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using Fp12 = typename Curve::Fp12;
+
+  // Commitments to (A, B) and C.
+  PairCommitment<Curve> com_ab;
+  PairCommitment<Curve> com_c;
+  // Πᵢ e(Aᵢ, Bᵢ)^(rⁱ)
+  Fp12 z_ab;
+  // Σᵢ rⁱ * Cᵢ
+  G1Point z_c;
+  TippMippProof<Curve> tmipp;
+
+  bool operator==(const AggregateProof& other) const {
+    return com_ab == other.com_ab && com_c == other.com_c &&
+           z_ab == other.z_ab && z_c == other.z_c && tmipp == other.tmipp;
+  }
+  bool operator!=(const AggregateProof& other) const {
+    return !operator==(other);
+  }
+};
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+namespace tachyon::base {
+
+template <typename Curve>
+class Copyable<zk::r1cs::groth16::TippMippRound<Curve>> {
+ public:
+  using TippMippRound = zk::r1cs::groth16::TippMippRound<Curve>;
+
+  static bool WriteTo(const TippMippRound& round, Buffer* buffer) {
+    return buffer->WriteMany(round.com_ab_l, round.com_ab_r, round.z_ab_l,
+                             round.z_ab_r, round.com_c_l, round.com_c_r,
+                             round.z_c_l, round.z_c_r);
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, TippMippRound* round) {
+    return buffer.ReadMany(&round->com_ab_l, &round->com_ab_r, &round->z_ab_l,
+                           &round->z_ab_r, &round->com_c_l, &round->com_c_r,
+                           &round->z_c_l, &round->z_c_r);
+  }
+
+  static size_t EstimateSize(const TippMippRound& round) {
+    return base::EstimateSize(round.com_ab_l, round.com_ab_r, round.z_ab_l,
+                              round.z_ab_r, round.com_c_l, round.com_c_r,
+                              round.z_c_l, round.z_c_r);
+  }
+};
+
+template <typename Curve>
+class Copyable<zk::r1cs::groth16::TippMippProof<Curve>> {
+ public:
+  using TippMippProof = zk::r1cs::groth16::TippMippProof<Curve>;
+
+  static bool WriteTo(const TippMippProof& proof, Buffer* buffer) {
+    return buffer->WriteMany(proof.rounds, proof.final_a, proof.final_b,
+                             proof.final_c, proof.final_v, proof.final_w,
+                             proof.v_opening, proof.w_opening);
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, TippMippProof* proof) {
+    return buffer.ReadMany(&proof->rounds, &proof->final_a, &proof->final_b,
+                           &proof->final_c, &proof->final_v, &proof->final_w,
+                           &proof->v_opening, &proof->w_opening);
+  }
+
+  static size_t EstimateSize(const TippMippProof& proof) {
+    return base::EstimateSize(proof.rounds, proof.final_a, proof.final_b,
+                              proof.final_c, proof.final_v, proof.final_w,
+                              proof.v_opening, proof.w_opening);
+  }
+};
+
+template <typename Curve>
+class Copyable<zk::r1cs::groth16::AggregateProof<Curve>> {
+ public:
+  using AggregateProof = zk::r1cs::groth16::AggregateProof<Curve>;
+
+  static bool WriteTo(const AggregateProof& proof, Buffer* buffer) {
+    return buffer->WriteMany(proof.com_ab, proof.com_c, proof.z_ab, proof.z_c,
+                             proof.tmipp);
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, AggregateProof* proof) {
+    return buffer.ReadMany(&proof->com_ab, &proof->com_c, &proof->z_ab,
+                           &proof->z_c, &proof->tmipp);
+  }
+
+  static size_t EstimateSize(const AggregateProof& proof) {
+    return base::EstimateSize(proof.com_ab, proof.com_c, proof.z_ab,
+                              proof.z_c, proof.tmipp);
+  }
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_AGGREGATE_PROOF_H_
@@ -0,0 +1,144 @@
+#ifndef TACHYON_ZK_R1CS_GROTH16_AGGREGATION_SRS_H_
+#define TACHYON_ZK_R1CS_GROTH16_AGGREGATION_SRS_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// The verifier side of |AggregationSRS|: [1]₁, [a]₁, [b]₁, [1]₂, [a]₂ and
+// [b]₂. It doesn't depend on the number of aggregated proofs.
+template <typename Curve>
+class AggregationVerifyingKey {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+
+  AggregationVerifyingKey() = default;
+  AggregationVerifyingKey(const G1Point& g, const G1Point& g_alpha,
+                          const G1Point& g_beta, const G2Point& h,
+                          const G2Point& h_alpha, const G2Point& h_beta)
+      : g_(g),
+        g_alpha_(g_alpha),
+        g_beta_(g_beta),
+        h_(h),
+        h_alpha_(h_alpha),
+        h_beta_(h_beta) {}
+
+  const G1Point& g() const { return g_; }
+  const G1Point& g_alpha() const { return g_alpha_; }
+  const G1Point& g_beta() const { return g_beta_; }
+  const G2Point& h() const { return h_; }
+  const G2Point& h_alpha() const { return h_alpha_; }
+  const G2Point& h_beta() const { return h_beta_; }
+
+ private:
+  G1Point g_;
+  G1Point g_alpha_;
+  G1Point g_beta_;
+  G2Point h_;
+  G2Point h_alpha_;
+  G2Point h_beta_;
+};
+
+// The structured reference string of the SnarkPack aggregation, which is made
+// of two powers of tau with the secrets a and b:
+//
+// [a⁰]₁, ..., [a²ⁿ⁻¹]₁, [b⁰]₁, ..., [b²ⁿ⁻¹]₁, [a⁰]₂, ..., [aⁿ⁻¹]₂,
+// [b⁰]₂, ..., [bⁿ⁻¹]₂
+//
+// It aggregates m proofs, where m is a power of 2 and 2 ≤ m ≤ n. The
+// commitment keys are v = ([aⁱ]₂, [bⁱ]₂) and w = ([aᵐ⁺ⁱ]₁, [bᵐ⁺ⁱ]₁) for i < m.
+// See https://eprint.iacr.org/2021/529.
+template <typename Curve>
+class AggregationSRS {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+  using F = typename G1Point::ScalarField;
+
+  AggregationSRS() = default;
+  AggregationSRS(std::vector<G1Point>&& g_alpha_powers,
+                 std::vector<G1Point>&& g_beta_powers,
+                 std::vector<G2Point>&& h_alpha_powers,
+                 std::vector<G2Point>&& h_beta_powers)
+      : g_alpha_powers_(std::move(g_alpha_powers)),
+        g_beta_powers_(std::move(g_beta_powers)),
+        h_alpha_powers_(std::move(h_alpha_powers)),
+        h_beta_powers_(std::move(h_beta_powers)) {
+    CHECK_EQ(g_alpha_powers_.size(), 2 * h_alpha_powers_.size());
+    CHECK_EQ(g_beta_powers_.size(), 2 * h_beta_powers_.size());
+    CHECK_EQ(h_alpha_powers_.size(), h_beta_powers_.size());
+  }
+
+  const std::vector<G1Point>& g_alpha_powers() const {
+    return g_alpha_powers_;
+  }
+  const std::vector<G1Point>& g_beta_powers() const { return g_beta_powers_; }
+  const std::vector<G2Point>& h_alpha_powers() const {
+    return h_alpha_powers_;
+  }
+  const std::vector<G2Point>& h_beta_powers() const { return h_beta_powers_; }
+
+  // The maximum number of proofs to be aggregated.
+  size_t MaxProofs() const { return h_alpha_powers_.size(); }
+
+  // NOTE: Only for testing. In production, the SRS has to be derived from two
+  // independent powers of tau ceremonies.
+  [[nodiscard]] bool UnsafeSetup(size_t n) {
+    return UnsafeSetup(n, F::Random(), F::Random());
+  }
+
+  [[nodiscard]] bool UnsafeSetup(size_t n, const F& a, const F& b) {
+    if (n < 2 || !base::bits::IsPowerOfTwo(n)) {
+      LOG(ERROR) << "Invalid size of the aggregation SRS: " << n;
+      return false;
+    }
+    std::vector<F> a_powers = F::GetSuccessivePowers(2 * n, a);
+    std::vector<F> b_powers = F::GetSuccessivePowers(2 * n, b);
+
+    G1Point g = G1Point::Generator();
+    G2Point h = G2Point::Generator();
+    g_alpha_powers_.resize(2 * n);
+    g_beta_powers_.resize(2 * n);
+    h_alpha_powers_.resize(n);
+    h_beta_powers_.resize(n);
+    absl::Span<const F> a_powers_first_n =
+        absl::MakeConstSpan(a_powers).first(n);
+    absl::Span<const F> b_powers_first_n =
+        absl::MakeConstSpan(b_powers).first(n);
+    return G1Point::BatchMapScalarFieldToPoint(g, a_powers,
+                                               &g_alpha_powers_) &&
+           G1Point::BatchMapScalarFieldToPoint(g, b_powers, &g_beta_powers_) &&
+           G2Point::BatchMapScalarFieldToPoint(h, a_powers_first_n,
+                                               &h_alpha_powers_) &&
+           G2Point::BatchMapScalarFieldToPoint(h, b_powers_first_n,
+                                               &h_beta_powers_);
+  }
+
+  AggregationVerifyingKey<Curve> GetVerifyingKey() const {
+    return {g_alpha_powers_[0], g_alpha_powers_[1], g_beta_powers_[1],
+            h_alpha_powers_[0], h_alpha_powers_[1], h_beta_powers_[1]};
+  }
+
+ private:
+  // [a⁰]₁, ..., [a²ⁿ⁻¹]₁
+  std::vector<G1Point> g_alpha_powers_;
+  // [b⁰]₁, ..., [b²ⁿ⁻¹]₁
+  std::vector<G1Point> g_beta_powers_;
+  // [a⁰]₂, ..., [aⁿ⁻¹]₂
+  std::vector<G2Point> h_alpha_powers_;
+  // [b⁰]₂, ..., [bⁿ⁻¹]₂
+  std::vector<G2Point> h_beta_powers_;
+};
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_AGGREGATION_SRS_H_
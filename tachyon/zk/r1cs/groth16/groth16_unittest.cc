@@ -1,9 +1,12 @@
 #include "gtest/gtest.h"
 
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
 #include "tachyon/zk/r1cs/constraint_system/quadratic_arithmetic_program.h"
 #include "tachyon/zk/r1cs/constraint_system/test/simple_circuit.h"
+#include "tachyon/zk/r1cs/groth16/aggregate.h"
 #include "tachyon/zk/r1cs/groth16/prove.h"
 #include "tachyon/zk/r1cs/groth16/verify.h"
 
@@ -42,4 +45,227 @@ TEST_F(Groth16Test, ProveAndVerify) {
   ASSERT_TRUE(VerifyProof(pvk, proof, public_inputs));
 }
 
+TEST_F(Groth16Test, PreparedVerifyingKeyCopyable) {
+  SimpleCircuit<F> circuit(F::Random(), F::Random());
+  ToxicWaste<Curve> toxic_waste = ToxicWaste<Curve>::RandomWithoutX();
+  ProvingKey<Curve> pk;
+  bool loaded =
+      pk.Load<MaxDegree, QuadraticArithmeticProgram<F>>(toxic_waste, circuit);
+  ASSERT_TRUE(loaded);
+  Proof<Curve> proof =
+      CreateProofWithReductionZK<MaxDegree, QuadraticArithmeticProgram<F>>(
+          circuit, pk);
+  PreparedVerifyingKey<Curve> expected =
+      std::move(pk).TakeVerifyingKey().ToPreparedVerifyingKey();
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  PreparedVerifyingKey<Curve> pvk;
+  ASSERT_TRUE(write_buf.Read(&pvk));
+  EXPECT_EQ(pvk.verifying_key().alpha_g1(),
+            expected.verifying_key().alpha_g1());
+  EXPECT_EQ(pvk.verifying_key().l_g1_query(),
+            expected.verifying_key().l_g1_query());
+  EXPECT_EQ(pvk.alpha_g1_beta_g2(), expected.alpha_g1_beta_g2());
+  EXPECT_EQ(pvk.delta_neg_g2().ell_coeffs().size(),
+            expected.delta_neg_g2().ell_coeffs().size());
+  ASSERT_TRUE(VerifyProof(pvk, proof, circuit.GetPublicInputs()));
+}
+
+TEST_F(Groth16Test, BatchVerify) {
+  constexpr size_t kNumProofs = 3;
+
+  ToxicWaste<Curve> toxic_waste = ToxicWaste<Curve>::RandomWithoutX();
+  ProvingKey<Curve> pk;
+  bool loaded = pk.Load<MaxDegree, QuadraticArithmeticProgram<F>>(
+      toxic_waste, SimpleCircuit<F>(F::Random(), F::Random()));
+  ASSERT_TRUE(loaded);
+
+  std::vector<Proof<Curve>> proofs;
+  std::vector<std::vector<F>> public_inputs_vec;
+  for (size_t i = 0; i < kNumProofs; ++i) {
+    SimpleCircuit<F> circuit(F::Random(), F::Random());
+    proofs.push_back(
+        CreateProofWithReductionZK<MaxDegree, QuadraticArithmeticProgram<F>>(
+            circuit, pk));
+    public_inputs_vec.push_back(circuit.GetPublicInputs());
+  }
+  PreparedVerifyingKey<Curve> pvk =
+      std::move(pk).TakeVerifyingKey().ToPreparedVerifyingKey();
+  ASSERT_TRUE(BatchVerifyProofs(pvk, absl::MakeConstSpan(proofs),
+                                absl::MakeConstSpan(public_inputs_vec)));
+
+  // A proof paired with the public inputs of another proof must be rejected.
+  std::swap(public_inputs_vec[1], public_inputs_vec[2]);
+  ASSERT_FALSE(BatchVerifyProofs(pvk, absl::MakeConstSpan(proofs),
+                                 absl::MakeConstSpan(public_inputs_vec)));
+}
+
+TEST_F(Groth16Test, AggregateAndVerify) {
+  constexpr size_t kNumProofs = 4;
+
+  ToxicWaste<Curve> toxic_waste = ToxicWaste<Curve>::RandomWithoutX();
+  ProvingKey<Curve> pk;
+  bool loaded = pk.Load<MaxDegree, QuadraticArithmeticProgram<F>>(
+      toxic_waste, SimpleCircuit<F>(F::Random(), F::Random()));
+  ASSERT_TRUE(loaded);
+
+  std::vector<Proof<Curve>> proofs;
+  std::vector<std::vector<F>> public_inputs_vec;
+  for (size_t i = 0; i < kNumProofs; ++i) {
+    SimpleCircuit<F> circuit(F::Random(), F::Random());
+    proofs.push_back(
+        CreateProofWithReductionZK<MaxDegree, QuadraticArithmeticProgram<F>>(
+            circuit, pk));
+    public_inputs_vec.push_back(circuit.GetPublicInputs());
+  }
+  PreparedVerifyingKey<Curve> pvk =
+      std::move(pk).TakeVerifyingKey().ToPreparedVerifyingKey();
+
+  // The SRS is larger than needed to check that it aggregates fewer proofs.
+  AggregationSRS<Curve> srs;
+  ASSERT_TRUE(srs.UnsafeSetup(2 * kNumProofs));
+  AggregationVerifyingKey<Curve> avk = srs.GetVerifyingKey();
+
+  AggregateProof<Curve> aggregate_proof;
+  ASSERT_TRUE(AggregateProofs(srs, absl::MakeConstSpan(proofs),
+                              absl::MakeConstSpan(public_inputs_vec),
+                              &aggregate_proof));
+  ASSERT_TRUE(VerifyAggregateProof(pvk, avk,
+                                   absl::MakeConstSpan(public_inputs_vec),
+                                   aggregate_proof));
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(aggregate_proof)));
+  ASSERT_TRUE(write_buf.Write(aggregate_proof));
+  ASSERT_TRUE(write_buf.Done());
+  write_buf.set_buffer_offset(0);
+  AggregateProof<Curve> aggregate_proof_read;
+  ASSERT_TRUE(write_buf.Read(&aggregate_proof_read));
+  EXPECT_EQ(aggregate_proof, aggregate_proof_read);
+
+  // The aggregate must be rejected for the public inputs of other proofs.
+  std::swap(public_inputs_vec[1], public_inputs_vec[2]);
+  ASSERT_FALSE(VerifyAggregateProof(pvk, avk,
+                                    absl::MakeConstSpan(public_inputs_vec),
+                                    aggregate_proof));
+}
+
+TEST_F(Groth16Test, ProveWithPrecomputedQueries) {
+  using Domain = math::UnivariateEvaluationDomain<F, MaxDegree>;
+
+  SimpleCircuit<F> circuit(F::Random(), F::Random());
+  ToxicWaste<Curve> toxic_waste = ToxicWaste<Curve>::RandomWithoutX();
+  ProvingKey<Curve> pk;
+  bool loaded =
+      pk.Load<MaxDegree, QuadraticArithmeticProgram<F>>(toxic_waste, circuit);
+  ASSERT_TRUE(loaded);
+
+  PrecomputedQueries<Curve> precomputed;
+  {
+    PrecomputedQueries<Curve> expected_precomputed;
+    ASSERT_TRUE(expected_precomputed.Precompute(pk));
+    EXPECT_TRUE(expected_precomputed.IsPrecomputedFrom(pk));
+
+    base::ScopedTempDir temp_dir;
+    ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+    base::FilePath path = temp_dir.GetPath().Append("precomputed");
+    ASSERT_TRUE(expected_precomputed.Save(path));
+    ASSERT_TRUE(precomputed.LoadOrPrecompute(pk, path));
+    EXPECT_EQ(precomputed.b_g2_query().table(),
+              expected_precomputed.b_g2_query().table());
+  }
+
+  ConstraintSystem<F> cs;
+  cs.set_optimization_goal(OptimizationGoal::kConstraints);
+  circuit.Synthesize(cs);
+  cs.Finalize();
+  std::unique_ptr<Domain> domain =
+      Domain::Create(cs.num_constraints() + cs.num_instance_variables());
+  QAPWitnessMapResult<F> result =
+      QuadraticArithmeticProgram<F>::WitnessMap(domain.get(), cs);
+  absl::Span<const F> h = absl::MakeConstSpan(result.h);
+  absl::Span<const F> instance_assignments =
+      absl::MakeConstSpan(cs.instance_assignments()).subspan(1);
+  absl::Span<const F> witness_assignments =
+      absl::MakeConstSpan(cs.witness_assignments());
+  absl::Span<const F> full_assignments =
+      absl::MakeConstSpan(result.full_assignments).subspan(1);
+
+  F r = F::Random();
+  F s = F::Random();
+  Proof<Curve> expected =
+      CreateProofWithAssignment(pk, r, s, h, instance_assignments,
+                                witness_assignments, full_assignments);
+  Proof<Curve> proof =
+      CreateProofWithAssignment(pk, precomputed, r, s, h, instance_assignments,
+                                witness_assignments, full_assignments);
+  EXPECT_EQ(proof, expected);
+
+  PreparedVerifyingKey<Curve> pvk =
+      std::move(pk).TakeVerifyingKey().ToPreparedVerifyingKey();
+  ASSERT_TRUE(VerifyProof(pvk, proof, circuit.GetPublicInputs()));
+}
+
+TEST_F(Groth16Test, CreateProofsWithAssignments) {
+  using Domain = math::UnivariateEvaluationDomain<F, MaxDegree>;
+
+  constexpr size_t kNumProofs = 3;
+
+  ToxicWaste<Curve> toxic_waste = ToxicWaste<Curve>::RandomWithoutX();
+  ProvingKey<Curve> pk;
+  bool loaded = pk.Load<MaxDegree, QuadraticArithmeticProgram<F>>(
+      toxic_waste, SimpleCircuit<F>(F::Random(), F::Random()));
+  ASSERT_TRUE(loaded);
+
+  std::vector<ConstraintSystem<F>> css(kNumProofs);
+  std::vector<QAPWitnessMapResult<F>> results;
+  std::vector<ProofAssignments<F>> assignments_list;
+  std::vector<std::vector<F>> public_inputs_vec;
+  for (size_t i = 0; i < kNumProofs; ++i) {
+    SimpleCircuit<F> circuit(F::Random(), F::Random());
+    ConstraintSystem<F>& cs = css[i];
+    cs.set_optimization_goal(OptimizationGoal::kConstraints);
+    circuit.Synthesize(cs);
+    cs.Finalize();
+    std::unique_ptr<Domain> domain =
+        Domain::Create(cs.num_constraints() + cs.num_instance_variables());
+    results.push_back(
+        QuadraticArithmeticProgram<F>::WitnessMap(domain.get(), cs));
+    public_inputs_vec.push_back(circuit.GetPublicInputs());
+  }
+  for (size_t i = 0; i < kNumProofs; ++i) {
+    // The last proof isn't zero-knowledge to cover the proofs without [B]₁.
+    bool zk = i != kNumProofs - 1;
+    assignments_list.push_back({
+        zk ? F::Random() : F::Zero(),
+        zk ? F::Random() : F::Zero(),
+        absl::MakeConstSpan(results[i].h),
+        absl::MakeConstSpan(css[i].witness_assignments()),
+        absl::MakeConstSpan(results[i].full_assignments).subspan(1),
+    });
+  }
+
+  std::vector<Proof<Curve>> proofs =
+      CreateProofsWithAssignments(pk, absl::MakeConstSpan(assignments_list));
+  ASSERT_EQ(proofs.size(), kNumProofs);
+
+  PreparedVerifyingKey<Curve> pvk =
+      VerifyingKey<Curve>(pk.verifying_key()).ToPreparedVerifyingKey();
+  for (size_t i = 0; i < kNumProofs; ++i) {
+    const ProofAssignments<F>& assignments = assignments_list[i];
+    Proof<Curve> expected = CreateProofWithAssignment(
+        pk, assignments.r, assignments.s, assignments.h_coefficients,
+        absl::MakeConstSpan(css[i].instance_assignments()).subspan(1),
+        assignments.witness_assignments, assignments.full_assignments);
+    EXPECT_EQ(proofs[i], expected);
+    EXPECT_TRUE(VerifyProof(pvk, proofs[i], public_inputs_vec[i]));
+  }
+}
+
 }  // namespace tachyon::zk::r1cs::groth16
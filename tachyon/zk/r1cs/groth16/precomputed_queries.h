@@ -0,0 +1,178 @@
+#ifndef TACHYON_ZK_R1CS_GROTH16_PRECOMPUTED_QUERIES_H_
+#define TACHYON_ZK_R1CS_GROTH16_PRECOMPUTED_QUERIES_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/msm/precomputed_bases_msm.h"
+#include "tachyon/zk/r1cs/groth16/proving_key.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// |PrecomputedQueries| holds the tables of |math::PrecomputedBasesMSM| for the
+// queries of a |ProvingKey|. Since the queries are fixed for a circuit, the
+// tables can be built once, persisted by |base::Copyable| or |Save()| and
+// passed to every |CreateProofWithAssignment()|.
+template <typename Curve>
+class PrecomputedQueries {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+  using MSM = math::PrecomputedBasesMSM<G1Point>;
+  using G2MSM = math::PrecomputedBasesMSM<G2Point>;
+
+  PrecomputedQueries() = default;
+  PrecomputedQueries(MSM&& a_g1_query, MSM&& b_g1_query, G2MSM&& b_g2_query,
+                     MSM&& h_g1_query, MSM&& l_g1_query)
+      : a_g1_query_(std::move(a_g1_query)),
+        b_g1_query_(std::move(b_g1_query)),
+        b_g2_query_(std::move(b_g2_query)),
+        h_g1_query_(std::move(h_g1_query)),
+        l_g1_query_(std::move(l_g1_query)) {}
+
+  const MSM& a_g1_query() const { return a_g1_query_; }
+  const MSM& b_g1_query() const { return b_g1_query_; }
+  const G2MSM& b_g2_query() const { return b_g2_query_; }
+  const MSM& h_g1_query() const { return h_g1_query_; }
+  const MSM& l_g1_query() const { return l_g1_query_; }
+
+  [[nodiscard]] bool Precompute(
+      const ProvingKey<Curve>& pk,
+      size_t precompute_factor = MSM::kDefaultPrecomputeFactor) {
+    // NOTE: The first element of |a_g1_query()| and |b_g1_query()| is not
+    // multiplied by any assignment. See |CalculateCoeff()|.
+    return a_g1_query_.Precompute(
+               absl::MakeConstSpan(pk.a_g1_query()).subspan(1),
+               precompute_factor) &&
+           b_g1_query_.Precompute(
+               absl::MakeConstSpan(pk.b_g1_query()).subspan(1),
+               precompute_factor) &&
+           b_g2_query_.Precompute(
+               absl::MakeConstSpan(pk.b_g2_query()).subspan(1),
+               precompute_factor) &&
+           h_g1_query_.Precompute(pk.h_g1_query(), precompute_factor) &&
+           l_g1_query_.Precompute(pk.l_g1_query(), precompute_factor);
+  }
+
+  // Returns true if the tables are built from the queries of |pk|. The first
+  // |size()| elements of each table are the bases themselves, so they are
+  // compared with the queries.
+  bool IsPrecomputedFrom(const ProvingKey<Curve>& pk) const {
+    return Matches(a_g1_query_,
+                   absl::MakeConstSpan(pk.a_g1_query()).subspan(1)) &&
+           Matches(b_g1_query_,
+                   absl::MakeConstSpan(pk.b_g1_query()).subspan(1)) &&
+           Matches(b_g2_query_,
+                   absl::MakeConstSpan(pk.b_g2_query()).subspan(1)) &&
+           Matches(h_g1_query_, absl::MakeConstSpan(pk.h_g1_query())) &&
+           Matches(l_g1_query_, absl::MakeConstSpan(pk.l_g1_query()));
+  }
+
+  // Writes the tables to |path|, typically next to the zkey they are built
+  // from, so that the following runs can |Load()| them instead of
+  // precomputing them again.
+  [[nodiscard]] bool Save(const base::FilePath& path) const {
+    base::Uint8VectorBuffer buffer;
+    if (!buffer.Grow(base::EstimateSize(*this))) return false;
+    if (!buffer.Write(*this)) return false;
+    if (!base::WriteLargeFile(path, buffer.owned_buffer())) {
+      LOG(ERROR) << "Failed to write " << path.value();
+      return false;
+    }
+    return true;
+  }
+
+  // Reads the tables written by |Save()| from |path|.
+  [[nodiscard]] bool Load(const base::FilePath& path) {
+    base::MemoryMappedFile file;
+    if (!file.Initialize(path, base::MemoryMappedFile::Access::kSequential)) {
+      LOG(ERROR) << "Failed to map " << path.value();
+      return false;
+    }
+    base::ReadOnlyBuffer buffer = file.ToBuffer();
+    return buffer.Read(this);
+  }
+
+  // Loads the tables from |path| if they are built from |pk|. Otherwise, it
+  // precomputes them from |pk| and saves them to |path|.
+  [[nodiscard]] bool LoadOrPrecompute(
+      const ProvingKey<Curve>& pk, const base::FilePath& path,
+      size_t precompute_factor = MSM::kDefaultPrecomputeFactor) {
+    if (base::PathExists(path)) {
+      if (Load(path) && IsPrecomputedFrom(pk)) return true;
+      LOG(WARNING) << "Precomputing again since " << path.value()
+                   << " isn't built from the proving key";
+    }
+    return Precompute(pk, precompute_factor) && Save(path);
+  }
+
+ private:
+  template <typename Point>
+  static bool Matches(const math::PrecomputedBasesMSM<Point>& msm,
+                      absl::Span<const Point> bases) {
+    return msm.size() == bases.size() &&
+           std::equal(bases.begin(), bases.end(), msm.table().begin());
+  }
+
+  // |a_g1_query_|, |b_g1_query_| and |b_g2_query_| are built without the first
+  // element.
+  MSM a_g1_query_;
+  MSM b_g1_query_;
+  G2MSM b_g2_query_;
+  MSM h_g1_query_;
+  MSM l_g1_query_;
+};
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+namespace tachyon::base {
+
+template <typename Curve>
+class Copyable<zk::r1cs::groth16::PrecomputedQueries<Curve>> {
+ public:
+  using Queries = zk::r1cs::groth16::PrecomputedQueries<Curve>;
+  using MSM = typename Queries::MSM;
+  using G2MSM = typename Queries::G2MSM;
+
+  static bool WriteTo(const Queries& queries, Buffer* buffer) {
+    return buffer->WriteMany(queries.a_g1_query(), queries.b_g1_query(),
+                             queries.b_g2_query(), queries.h_g1_query(),
+                             queries.l_g1_query());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, Queries* queries) {
+    MSM a_g1_query;
+    MSM b_g1_query;
+    G2MSM b_g2_query;
+    MSM h_g1_query;
+    MSM l_g1_query;
+    if (!buffer.ReadMany(&a_g1_query, &b_g1_query, &b_g2_query, &h_g1_query,
+                         &l_g1_query)) {
+      return false;
+    }
+    *queries = Queries(std::move(a_g1_query), std::move(b_g1_query),
+                       std::move(b_g2_query), std::move(h_g1_query),
+                       std::move(l_g1_query));
+    return true;
+  }
+
+  static size_t EstimateSize(const Queries& queries) {
+    return base::EstimateSize(queries.a_g1_query(), queries.b_g1_query(),
+                              queries.b_g2_query(), queries.h_g1_query(),
+                              queries.l_g1_query());
+  }
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_PRECOMPUTED_QUERIES_H_
@@ -8,6 +8,7 @@
 
 #include <utility>
 
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/zk/r1cs/groth16/verifying_key.h"
 
 namespace tachyon::zk::r1cs::groth16 {
@@ -69,4 +70,47 @@ PreparedVerifyingKey<Curve> VerifyingKey<Curve>::ToPreparedVerifyingKey() && {
 
 }  // namespace tachyon::zk::r1cs::groth16
 
+namespace tachyon::base {
+
+// The pairing e([α]₁, [β]₂) and the line coefficients of [-δ]₂ and [-γ]₂ are
+// persisted as they are, so that loading a prepared verifying key doesn't
+// have to compute them again.
+template <typename Curve>
+class Copyable<zk::r1cs::groth16::PreparedVerifyingKey<Curve>> {
+ public:
+  using PreparedVerifyingKey = zk::r1cs::groth16::PreparedVerifyingKey<Curve>;
+  using VerifyingKey = zk::r1cs::groth16::VerifyingKey<Curve>;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Fp12 = typename Curve::Fp12;
+
+  static bool WriteTo(const PreparedVerifyingKey& pvk, Buffer* buffer) {
+    return buffer->WriteMany(pvk.verifying_key(), pvk.alpha_g1_beta_g2(),
+                             pvk.delta_neg_g2(), pvk.gamma_neg_g2());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       PreparedVerifyingKey* pvk) {
+    VerifyingKey verifying_key;
+    Fp12 alpha_g1_beta_g2;
+    G2Prepared delta_neg_g2;
+    G2Prepared gamma_neg_g2;
+    if (!buffer.ReadMany(&verifying_key, &alpha_g1_beta_g2, &delta_neg_g2,
+                         &gamma_neg_g2)) {
+      return false;
+    }
+    *pvk = PreparedVerifyingKey(std::move(verifying_key),
+                                std::move(alpha_g1_beta_g2),
+                                std::move(delta_neg_g2),
+                                std::move(gamma_neg_g2));
+    return true;
+  }
+
+  static size_t EstimateSize(const PreparedVerifyingKey& pvk) {
+    return base::EstimateSize(pvk.verifying_key(), pvk.alpha_g1_beta_g2(),
+                              pvk.delta_neg_g2(), pvk.gamma_neg_g2());
+  }
+};
+
+}  // namespace tachyon::base
+
 #endif  // TACHYON_ZK_R1CS_GROTH16_PREPARED_VERIFYING_KEY_H_
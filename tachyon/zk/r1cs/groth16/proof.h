@@ -6,11 +6,15 @@
 #ifndef TACHYON_ZK_R1CS_GROTH16_PROOF_H_
 #define TACHYON_ZK_R1CS_GROTH16_PROOF_H_
 
+#include <stddef.h>
+
 #include <string>
 #include <utility>
 
 #include "absl/strings/substitute.h"
 
+#include "tachyon/base/buffer/copyable.h"
+
 namespace tachyon::zk::r1cs::groth16 {
 
 template <typename Curve>
@@ -52,4 +56,33 @@ class Proof {
 
 }  // namespace tachyon::zk::r1cs::groth16
 
+namespace tachyon::base {
+
+template <typename Curve>
+class Copyable<zk::r1cs::groth16::Proof<Curve>> {
+ public:
+  using Proof = zk::r1cs::groth16::Proof<Curve>;
+  using G1Point = typename Proof::G1Point;
+  using G2Point = typename Proof::G2Point;
+
+  static bool WriteTo(const Proof& proof, Buffer* buffer) {
+    return buffer->WriteMany(proof.a(), proof.b(), proof.c());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, Proof* proof) {
+    G1Point a;
+    G2Point b;
+    G1Point c;
+    if (!buffer.ReadMany(&a, &b, &c)) return false;
+    *proof = Proof(std::move(a), std::move(b), std::move(c));
+    return true;
+  }
+
+  static size_t EstimateSize(const Proof& proof) {
+    return base::EstimateSize(proof.a(), proof.b(), proof.c());
+  }
+};
+
+}  // namespace tachyon::base
+
 #endif  // TACHYON_ZK_R1CS_GROTH16_PROOF_H_
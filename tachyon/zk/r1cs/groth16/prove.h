@@ -8,15 +8,25 @@
 
 #include <stddef.h>
 
+#include <future>
 #include <memory>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "absl/types/span.h"
 
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/base/optional.h"
+#include "tachyon/base/time/time_interval.h"
+#include "tachyon/base/time/trace_recorder.h"
+#include "tachyon/math/elliptic_curves/msm/glv.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/zk/base/scoped_proof_metrics.h"
 #include "tachyon/zk/r1cs/constraint_system/qap_witness_map_result.h"
+#include "tachyon/zk/r1cs/groth16/precomputed_queries.h"
 #include "tachyon/zk/r1cs/groth16/proof.h"
 #include "tachyon/zk/r1cs/groth16/proving_key.h"
 
@@ -37,67 +47,148 @@ Bucket CalculateCoeff(const Bucket& initial,
   return ret;
 }
 
+// Same as above, but runs the MSM with |precomputed|, which is built from
+// |query| without its first element.
+template <typename Bucket, typename AffinePoint, typename F>
+Bucket CalculateCoeff(const Bucket& initial,
+                      absl::Span<const AffinePoint> query,
+                      const math::PrecomputedBasesMSM<AffinePoint>& precomputed,
+                      const AffinePoint& vk_param,
+                      absl::Span<const F> assignments) {
+  Bucket acc;
+  CHECK(precomputed.Run(assignments, &acc));
+
+  Bucket ret = initial + query[0];
+  ret += acc;
+  ret += vk_param;
+  return ret;
+}
+
+namespace internal {
+
+// Runs |callback| and logs how long it took as the time of the MSM |name|. It
+// is recorded as a phase of the metrics as well. See |base::ScopedTraceEvent|.
+template <typename Callable>
+auto RunTimedMSM(std::string_view name, Callable callback) {
+  base::ScopedTraceEvent event(nullptr, absl::StrCat("Groth16MSM(", name, ")"));
+  base::TimeInterval interval(base::TimeTicks::Now());
+  auto ret = callback();
+  VLOG(1) << "Groth16 MSM(" << name << "): " << interval.GetTimeDelta();
+  return ret;
+}
+
 template <typename Curve, typename F>
-Proof<Curve> CreateProofWithAssignment(const ProvingKey<Curve>& pk, const F& r,
-                                       const F& s,
-                                       absl::Span<const F> h_coefficients,
-                                       absl::Span<const F> instance_assignments,
-                                       absl::Span<const F> witness_assignments,
-                                       absl::Span<const F> full_assignments) {
+Proof<Curve> CreateProofWithAssignment(
+    const ProvingKey<Curve>& pk, const PrecomputedQueries<Curve>* precomputed,
+    const F& r, const F& s, absl::Span<const F> h_coefficients,
+    absl::Span<const F> witness_assignments,
+    absl::Span<const F> full_assignments) {
   using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
   using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
   using G1Bucket = typename math::VariableBaseMSM<G1AffinePoint>::Bucket;
   using G2Bucket = typename math::VariableBaseMSM<G2AffinePoint>::Bucket;
 
+  ScopedProofMetrics proof_metrics("groth16");
+
+  // The G2 MSM is independent of the G1 MSMs and scales worse than them over
+  // the threads. So it runs on its own thread while the G1 MSMs, each of which
+  // is parallelized internally, run one after another on this thread to fill
+  // the cores it leaves idle.
+  std::future<G2Bucket> b_g2_future = std::async(
+      std::launch::async, [&pk, precomputed, &s, full_assignments]() {
+        return RunTimedMSM("b_g2", [&pk, precomputed, &s, full_assignments]() {
+          // |s_delta_g2_bucket| = [sδ]₂
+          G2Bucket s_delta_g2_bucket =
+              math::ConvertPoint<G2Bucket>(s * pk.verifying_key().delta_g2());
+          // |b_g2_bucket| = [B]₂ = [β + Σᵢ₌₀..ₘ (xᵢ * bᵢ(x)) + sδ]₂
+          // where x is |full_assignments|.
+          if (precomputed) {
+            return CalculateCoeff(s_delta_g2_bucket,
+                                  absl::MakeConstSpan(pk.b_g2_query()),
+                                  precomputed->b_g2_query(),
+                                  pk.verifying_key().beta_g2(),
+                                  full_assignments);
+          }
+          return CalculateCoeff(s_delta_g2_bucket,
+                                absl::MakeConstSpan(pk.b_g2_query()),
+                                pk.verifying_key().beta_g2(), full_assignments);
+        });
+      });
+
   math::VariableBaseMSM<G1AffinePoint> msm;
 
   // |witness_acc| = [Σᵢ₌ₗ₊₁..ₘ (β * aᵢ(x) + α * bᵢ(x) + cᵢ(x)) / δ]₁
-  G1Bucket witness_acc;
-  CHECK(msm.Run(pk.l_g1_query(), witness_assignments, &witness_acc));
+  G1Bucket witness_acc = RunTimedMSM("l", [&]() {
+    G1Bucket ret;
+    if (precomputed) {
+      CHECK(precomputed->l_g1_query().Run(witness_assignments, &ret));
+    } else {
+      CHECK(msm.Run(pk.l_g1_query(), witness_assignments, &ret));
+    }
+    return ret;
+  });
 
   // |h_acc| = [(h(x) * t(x)) / δ]₁
-  G1Bucket h_acc;
-  if (h_coefficients.size() > pk.h_g1_query().size()) {
-    absl::Span<const F> h_coefficients_subspan =
-        h_coefficients.subspan(0, h_coefficients.size() - 1);
-    CHECK(msm.Run(pk.h_g1_query(), h_coefficients_subspan, &h_acc));
-  } else {
-    absl::Span<const G1AffinePoint> h_g1_query_subspan =
-        absl::MakeConstSpan(pk.h_g1_query()).subspan(0, h_coefficients.size());
-    CHECK(msm.Run(h_g1_query_subspan, h_coefficients, &h_acc));
-  }
+  G1Bucket h_acc = RunTimedMSM("h", [&]() {
+    G1Bucket ret;
+    if (h_coefficients.size() > pk.h_g1_query().size()) {
+      absl::Span<const F> h_coefficients_subspan =
+          h_coefficients.subspan(0, h_coefficients.size() - 1);
+      if (precomputed) {
+        CHECK(precomputed->h_g1_query().Run(h_coefficients_subspan, &ret));
+      } else {
+        CHECK(msm.Run(pk.h_g1_query(), h_coefficients_subspan, &ret));
+      }
+    } else if (precomputed) {
+      CHECK(precomputed->h_g1_query().Run(h_coefficients, &ret));
+    } else {
+      absl::Span<const G1AffinePoint> h_g1_query_subspan =
+          absl::MakeConstSpan(pk.h_g1_query())
+              .subspan(0, h_coefficients.size());
+      CHECK(msm.Run(h_g1_query_subspan, h_coefficients, &ret));
+    }
+    return ret;
+  });
 
   G1Bucket ac_g1_bucket[2];
 
   // |r_delta_g1_bucket| = [rδ]₁
-  G1Bucket r_delta_g1_bucket = math::ConvertPoint<G1Bucket>(r * pk.delta_g1());
+  G1Bucket r_delta_g1_bucket = math::ConvertPoint<G1Bucket>(
+      math::ScalarMulWithGLV(pk.delta_g1(), r));
   // |ac_g1_bucket[0]| = [A]₁ = [α + Σᵢ₌₀..ₘ (xᵢ * aᵢ(x)) + rδ]₁
   // where x is |full_assignments|.
-  ac_g1_bucket[0] =
-      CalculateCoeff(r_delta_g1_bucket, absl::MakeConstSpan(pk.a_g1_query()),
-                     pk.verifying_key().alpha_g1(), full_assignments);
-
-  // |s_delta_g2_bucket| = [sδ]₂
-  G2Bucket s_delta_g2_bucket =
-      math::ConvertPoint<G2Bucket>(s * pk.verifying_key().delta_g2());
-  // |b_g2_bucket| = [B]₂ = [β + Σᵢ₌₀..ₘ (xᵢ * bᵢ(x)) + sδ]₂
-  // where x is |full_assignments|.
-  G2Bucket b_g2_bucket =
-      CalculateCoeff(s_delta_g2_bucket, absl::MakeConstSpan(pk.b_g2_query()),
-                     pk.verifying_key().beta_g2(), full_assignments);
+  ac_g1_bucket[0] = RunTimedMSM("a", [&]() {
+    if (precomputed) {
+      return CalculateCoeff(r_delta_g1_bucket,
+                            absl::MakeConstSpan(pk.a_g1_query()),
+                            precomputed->a_g1_query(),
+                            pk.verifying_key().alpha_g1(), full_assignments);
+    }
+    return CalculateCoeff(r_delta_g1_bucket,
+                          absl::MakeConstSpan(pk.a_g1_query()),
+                          pk.verifying_key().alpha_g1(), full_assignments);
+  });
 
   // |ac_g1_bucket[1]| = [As]₁
   ac_g1_bucket[1] = ac_g1_bucket[0] * s;
   // |ac_g1_bucket[1]| = [As + Br - rsδ]₁
   if (!r.IsZero()) {
     // |s_delta_g1_bucket| = [sδ]₁
-    G1Bucket s_delta_g1_bucket =
-        math::ConvertPoint<G1Bucket>(s * pk.delta_g1());
+    G1Bucket s_delta_g1_bucket = math::ConvertPoint<G1Bucket>(
+        math::ScalarMulWithGLV(pk.delta_g1(), s));
     // |b_g1_bucket| = [B]₁ = [β + Σᵢ₌₀..ₘ (xᵢ * bᵢ(x)) + sδ]₁
     // where x is |full_assignments|.
-    G1Bucket b_g1_bucket =
-        CalculateCoeff(s_delta_g1_bucket, absl::MakeConstSpan(pk.b_g1_query()),
-                       pk.beta_g1(), full_assignments);
+    G1Bucket b_g1_bucket = RunTimedMSM("b_g1", [&]() {
+      if (precomputed) {
+        return CalculateCoeff(s_delta_g1_bucket,
+                              absl::MakeConstSpan(pk.b_g1_query()),
+                              precomputed->b_g1_query(), pk.beta_g1(),
+                              full_assignments);
+      }
+      return CalculateCoeff(s_delta_g1_bucket,
+                            absl::MakeConstSpan(pk.b_g1_query()), pk.beta_g1(),
+                            full_assignments);
+    });
     ac_g1_bucket[1] += (r * b_g1_bucket);
     ac_g1_bucket[1] -= (s * r_delta_g1_bucket);
   }
@@ -113,6 +204,8 @@ Proof<Curve> CreateProofWithAssignment(const ProvingKey<Curve>& pk, const F& r,
   G1AffinePoint ac_g1[2];
   CHECK(G1Bucket::BatchNormalize(ac_g1_bucket, &ac_g1));
 
+  G2Bucket b_g2_bucket = b_g2_future.get();
+
   return {
       std::move(ac_g1[0]),
       b_g2_bucket.ToAffine(),
@@ -120,6 +213,34 @@ Proof<Curve> CreateProofWithAssignment(const ProvingKey<Curve>& pk, const F& r,
   };
 }
 
+}  // namespace internal
+
+template <typename Curve, typename F>
+Proof<Curve> CreateProofWithAssignment(const ProvingKey<Curve>& pk, const F& r,
+                                       const F& s,
+                                       absl::Span<const F> h_coefficients,
+                                       absl::Span<const F> instance_assignments,
+                                       absl::Span<const F> witness_assignments,
+                                       absl::Span<const F> full_assignments) {
+  return internal::CreateProofWithAssignment<Curve>(
+      pk, nullptr, r, s, h_coefficients, witness_assignments,
+      full_assignments);
+}
+
+// Same as above, but runs the MSMs with |precomputed|, which must be built
+// from |pk|.
+template <typename Curve, typename F>
+Proof<Curve> CreateProofWithAssignment(
+    const ProvingKey<Curve>& pk, const PrecomputedQueries<Curve>& precomputed,
+    const F& r, const F& s, absl::Span<const F> h_coefficients,
+    absl::Span<const F> instance_assignments,
+    absl::Span<const F> witness_assignments,
+    absl::Span<const F> full_assignments) {
+  return internal::CreateProofWithAssignment<Curve>(
+      pk, &precomputed, r, s, h_coefficients, witness_assignments,
+      full_assignments);
+}
+
 template <typename Curve, typename F>
 Proof<Curve> CreateProofWithAssignmentZK(
     const ProvingKey<Curve>& pk, absl::Span<const F> h_coefficients,
@@ -142,6 +263,174 @@ Proof<Curve> CreateProofWithAssignmentNoZK(
                                    full_assignments);
 }
 
+// The inputs of one of the proofs created by |CreateProofsWithAssignments()|.
+// See |CreateProofWithAssignment()|.
+template <typename F>
+struct ProofAssignments {
+  F r;
+  F s;
+  absl::Span<const F> h_coefficients;
+  absl::Span<const F> witness_assignments;
+  absl::Span<const F> full_assignments;
+};
+
+// Creates a proof for each of |assignments_list|, all for the circuit of
+// |pk|. The result is the same as calling |CreateProofWithAssignment()| for
+// each of them, but every query of |pk| is shared by the MSMs of all the
+// proofs, so each base is loaded once per batch instead of once per proof.
+// See |math::VariableBaseMSM::RunBatch()|.
+template <typename Curve, typename F>
+std::vector<Proof<Curve>> CreateProofsWithAssignments(
+    const ProvingKey<Curve>& pk,
+    absl::Span<const ProofAssignments<F>> assignments_list) {
+  using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G1Bucket = typename math::VariableBaseMSM<G1AffinePoint>::Bucket;
+  using G2Bucket = typename math::VariableBaseMSM<G2AffinePoint>::Bucket;
+
+  size_t num_proofs = assignments_list.size();
+  if (num_proofs == 0) return {};
+  ScopedProofMetrics proof_metrics("groth16", num_proofs);
+
+  std::vector<absl::Span<const F>> full_assignments_list = base::Map(
+      assignments_list, [](const ProofAssignments<F>& assignments) {
+        return assignments.full_assignments;
+      });
+
+  // See |internal::CreateProofWithAssignment()| for why the G2 MSMs run on
+  // their own thread.
+  std::future<std::vector<G2AffinePoint>> b_g2_future = std::async(
+      std::launch::async, [&pk, assignments_list, &full_assignments_list]() {
+        std::vector<G2Bucket> b_g2_buckets = internal::RunTimedMSM(
+            "b_g2", [&pk, &full_assignments_list]() {
+              math::VariableBaseMSM<G2AffinePoint> msm;
+              std::vector<G2Bucket> ret;
+              CHECK(msm.RunBatch(
+                  absl::MakeConstSpan(pk.b_g2_query()).subspan(1),
+                  absl::MakeConstSpan(full_assignments_list), &ret));
+              return ret;
+            });
+        for (size_t i = 0; i < b_g2_buckets.size(); ++i) {
+          // |b_g2_buckets[i]| = [B]₂ = [β + Σᵢ₌₀..ₘ (xᵢ * bᵢ(x)) + sδ]₂
+          b_g2_buckets[i] += pk.b_g2_query()[0];
+          b_g2_buckets[i] += pk.verifying_key().beta_g2();
+          b_g2_buckets[i] += math::ConvertPoint<G2Bucket>(
+              assignments_list[i].s * pk.verifying_key().delta_g2());
+        }
+        std::vector<G2AffinePoint> ret(b_g2_buckets.size());
+        CHECK(G2Bucket::BatchNormalize(b_g2_buckets, &ret));
+        return ret;
+      });
+
+  math::VariableBaseMSM<G1AffinePoint> msm;
+
+  // |witness_accs[i]| = [Σᵢ₌ₗ₊₁..ₘ (β * aᵢ(x) + α * bᵢ(x) + cᵢ(x)) / δ]₁
+  std::vector<G1Bucket> witness_accs = internal::RunTimedMSM("l", [&]() {
+    std::vector<absl::Span<const F>> witness_assignments_list = base::Map(
+        assignments_list, [](const ProofAssignments<F>& assignments) {
+          return assignments.witness_assignments;
+        });
+    std::vector<G1Bucket> ret;
+    CHECK(msm.RunBatch(pk.l_g1_query(),
+                       absl::MakeConstSpan(witness_assignments_list), &ret));
+    return ret;
+  });
+
+  // |h_accs[i]| = [(h(x) * t(x)) / δ]₁
+  std::vector<G1Bucket> h_accs = internal::RunTimedMSM("h", [&]() {
+    std::vector<absl::Span<const F>> h_coefficients_list = base::Map(
+        assignments_list, [&pk](const ProofAssignments<F>& assignments) {
+          absl::Span<const F> h_coefficients = assignments.h_coefficients;
+          if (h_coefficients.size() > pk.h_g1_query().size()) {
+            return h_coefficients.subspan(0, h_coefficients.size() - 1);
+          }
+          return h_coefficients;
+        });
+    std::vector<G1Bucket> ret;
+    CHECK(msm.RunBatch(pk.h_g1_query(),
+                       absl::MakeConstSpan(h_coefficients_list), &ret));
+    return ret;
+  });
+
+  // |a_accs[i]| = [Σᵢ₌₁..ₘ (xᵢ * aᵢ(x))]₁
+  std::vector<G1Bucket> a_accs = internal::RunTimedMSM("a", [&]() {
+    std::vector<G1Bucket> ret;
+    CHECK(msm.RunBatch(absl::MakeConstSpan(pk.a_g1_query()).subspan(1),
+                       absl::MakeConstSpan(full_assignments_list), &ret));
+    return ret;
+  });
+
+  // [B]₁ is only needed by the proofs whose |r| is not zero.
+  std::vector<size_t> b_indices;
+  std::vector<absl::Span<const F>> b_full_assignments_list;
+  for (size_t i = 0; i < num_proofs; ++i) {
+    if (assignments_list[i].r.IsZero()) continue;
+    b_indices.push_back(i);
+    b_full_assignments_list.push_back(full_assignments_list[i]);
+  }
+  // |b_accs[j]| = [Σᵢ₌₁..ₘ (xᵢ * bᵢ(x))]₁
+  std::vector<G1Bucket> b_accs;
+  if (!b_indices.empty()) {
+    b_accs = internal::RunTimedMSM("b_g1", [&]() {
+      std::vector<G1Bucket> ret;
+      CHECK(msm.RunBatch(absl::MakeConstSpan(pk.b_g1_query()).subspan(1),
+                         absl::MakeConstSpan(b_full_assignments_list), &ret));
+      return ret;
+    });
+  }
+
+  // |ac_g1_buckets[2 * i]| and |ac_g1_buckets[2 * i + 1]| are [A]₁ and [C]₁
+  // of the i-th proof. They are normalized all at once.
+  std::vector<G1Bucket> ac_g1_buckets(2 * num_proofs);
+  size_t b_idx = 0;
+  for (size_t i = 0; i < num_proofs; ++i) {
+    const F& r = assignments_list[i].r;
+    const F& s = assignments_list[i].s;
+
+    // |r_delta_g1_bucket| = [rδ]₁
+    G1Bucket r_delta_g1_bucket = math::ConvertPoint<G1Bucket>(
+        math::ScalarMulWithGLV(pk.delta_g1(), r));
+    // |a_g1_bucket| = [A]₁ = [α + Σᵢ₌₀..ₘ (xᵢ * aᵢ(x)) + rδ]₁
+    G1Bucket& a_g1_bucket = ac_g1_buckets[2 * i];
+    a_g1_bucket = r_delta_g1_bucket + pk.a_g1_query()[0];
+    a_g1_bucket += a_accs[i];
+    a_g1_bucket += pk.verifying_key().alpha_g1();
+
+    // |c_g1_bucket| = [As]₁
+    G1Bucket& c_g1_bucket = ac_g1_buckets[2 * i + 1];
+    c_g1_bucket = a_g1_bucket * s;
+    // |c_g1_bucket| = [As + Br - rsδ]₁
+    if (b_idx < b_indices.size() && b_indices[b_idx] == i) {
+      // |b_g1_bucket| = [B]₁ = [β + Σᵢ₌₀..ₘ (xᵢ * bᵢ(x)) + sδ]₁
+      G1Bucket b_g1_bucket = math::ConvertPoint<G1Bucket>(
+          math::ScalarMulWithGLV(pk.delta_g1(), s));
+      b_g1_bucket += pk.b_g1_query()[0];
+      b_g1_bucket += b_accs[b_idx++];
+      b_g1_bucket += pk.beta_g1();
+      c_g1_bucket += (r * b_g1_bucket);
+      c_g1_bucket -= (s * r_delta_g1_bucket);
+    }
+    // clang-format off
+    // |c_g1_bucket| = [C]₁ = [(Σᵢ₌ₗ₊₁..ₘ (β * aᵢ(x) + α * bᵢ(x) + cᵢ(x)) + h(x)t(x)) / δ + As + Br - rsδ]₁
+    // clang-format on
+    c_g1_bucket += witness_accs[i];
+    c_g1_bucket += h_accs[i];
+  }
+
+  std::vector<G1AffinePoint> ac_g1(2 * num_proofs);
+  CHECK(G1Bucket::BatchNormalize(ac_g1_buckets, &ac_g1));
+
+  std::vector<G2AffinePoint> b_g2 = b_g2_future.get();
+
+  std::vector<Proof<Curve>> proofs;
+  proofs.reserve(num_proofs);
+  for (size_t i = 0; i < num_proofs; ++i) {
+    proofs.emplace_back(std::move(ac_g1[2 * i]), std::move(b_g2[i]),
+                        std::move(ac_g1[2 * i + 1]));
+  }
+  return proofs;
+}
+
 // Create a Groth16 proof using randomness |r| and |s| and the provided
 // R1CS-to-QAP reduction.
 template <size_t MaxDegree, typename QAP, typename F, typename Curve>
@@ -225,15 +514,15 @@ Proof<Curve> ReRandomizeProof(const VerifyingKey<Curve>& vk,
   //   C' = C + r₂A
   G1JacobianPoint ac_jacobian[2];
   F inv = unwrap(randoms.r1.Inverse());
-  ac_jacobian[0] = proof.a() * inv;
+  ac_jacobian[0] = math::ScalarMulWithGLV(proof.a(), inv);
 
-  ac_jacobian[1] = proof.a() * randoms.r2;
+  ac_jacobian[1] = math::ScalarMulWithGLV(proof.a(), randoms.r2);
   ac_jacobian[1] += proof.c();
 
   G1AffinePoint ac[2];
   CHECK(G1JacobianPoint::BatchNormalize(ac_jacobian, &ac));
 
-  G2JacobianPoint b = vk.delta_g2() * randoms.r2;
+  G2JacobianPoint b = math::ScalarMulWithGLV(vk.delta_g2(), randoms.r2);
   b += proof.b();
   b *= randoms.r1;
 
@@ -0,0 +1,213 @@
+#ifndef TACHYON_ZK_R1CS_GROTH16_PROVE_GPU_H_
+#define TACHYON_ZK_R1CS_GROTH16_PROVE_GPU_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/numeric/bits.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/device/gpu/gpu_memory.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm_gpu.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/zk/r1cs/groth16/proof.h"
+#include "tachyon/zk/r1cs/groth16/prove.h"
+#include "tachyon/zk/r1cs/groth16/proving_key.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// Creates Groth16 proofs with the G1 MSMs run on the GPU. The G1 queries of
+// the proving key are uploaded once on construction and stay resident on the
+// device, so each proof only uploads its assignments. The G2 MSM keeps running
+// on the CPU, concurrently with the G1 MSMs.
+// NOTE: |pk| must outlive this.
+template <typename Curve, typename G1CurveGpu>
+class ProverGpu {
+ public:
+  using F = typename Curve::G1Curve::ScalarField;
+  using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
+  using G1JacobianPoint = typename Curve::G1Curve::JacobianPoint;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G1Bucket = typename math::VariableBaseMSM<G1AffinePoint>::Bucket;
+  using G2Bucket = typename math::VariableBaseMSM<G2AffinePoint>::Bucket;
+  using G1AffinePointGpu = math::AffinePoint<G1CurveGpu>;
+  using FGpu = typename G1AffinePointGpu::ScalarField;
+
+  ProverGpu(const ProvingKey<Curve>& pk, math::MSMAlgorithmKind kind,
+            gpuMemPool_t mem_pool, gpuStream_t stream)
+      : pk_(pk), msm_(kind, mem_pool, stream) {
+    // The first element of |a_g1_query()| and |b_g1_query()| is added without
+    // being multiplied. See |CalculateCoeff()|.
+    a_g1_query_ = Upload(absl::MakeConstSpan(pk.a_g1_query()).subspan(1));
+    b_g1_query_ = Upload(absl::MakeConstSpan(pk.b_g1_query()).subspan(1));
+    h_g1_query_ = Upload(absl::MakeConstSpan(pk.h_g1_query()));
+    l_g1_query_ = Upload(absl::MakeConstSpan(pk.l_g1_query()));
+
+    size_t max_size = std::max({a_g1_query_.d_bases.size(),
+                                b_g1_query_.d_bases.size(),
+                                h_g1_query_.d_bases.size(),
+                                l_g1_query_.d_bases.size()});
+    d_scalars_ = device::gpu::GpuMemory<FGpu>::Malloc(max_size);
+  }
+  ProverGpu(const ProverGpu& other) = delete;
+  ProverGpu& operator=(const ProverGpu& other) = delete;
+
+  // Same as |CreateProofWithAssignment()| in prove.h.
+  Proof<Curve> CreateProofWithAssignment(
+      const F& r, const F& s, absl::Span<const F> h_coefficients,
+      absl::Span<const F> witness_assignments,
+      absl::Span<const F> full_assignments) {
+    std::future<G2Bucket> b_g2_future =
+        std::async(std::launch::async, [this, &s, full_assignments]() {
+          return internal::RunTimedMSM("b_g2", [this, &s, full_assignments]() {
+            // |s_delta_g2_bucket| = [sδ]₂
+            G2Bucket s_delta_g2_bucket = math::ConvertPoint<G2Bucket>(
+                s * pk_.verifying_key().delta_g2());
+            // |b_g2_bucket| = [B]₂ = [β + Σᵢ₌₀..ₘ (xᵢ * bᵢ(x)) + sδ]₂
+            // where x is |full_assignments|.
+            return CalculateCoeff(s_delta_g2_bucket,
+                                  absl::MakeConstSpan(pk_.b_g2_query()),
+                                  pk_.verifying_key().beta_g2(),
+                                  full_assignments);
+          });
+        });
+
+    // |witness_acc| = [Σᵢ₌ₗ₊₁..ₘ (β * aᵢ(x) + α * bᵢ(x) + cᵢ(x)) / δ]₁
+    G1Bucket witness_acc = internal::RunTimedMSM(
+        "l", [&]() { return RunMSM(l_g1_query_, witness_assignments); });
+
+    // |h_acc| = [(h(x) * t(x)) / δ]₁
+    G1Bucket h_acc = internal::RunTimedMSM("h", [&]() {
+      return RunMSM(h_g1_query_,
+                    h_coefficients.subspan(
+                        0, std::min(h_coefficients.size(), h_g1_query_.size)));
+    });
+
+    G1Bucket ac_g1_bucket[2];
+
+    // |r_delta_g1_bucket| = [rδ]₁
+    G1Bucket r_delta_g1_bucket =
+        math::ConvertPoint<G1Bucket>(r * pk_.delta_g1());
+    // |ac_g1_bucket[0]| = [A]₁ = [α + Σᵢ₌₀..ₘ (xᵢ * aᵢ(x)) + rδ]₁
+    // where x is |full_assignments|.
+    ac_g1_bucket[0] = internal::RunTimedMSM("a", [&]() {
+      G1Bucket ret = r_delta_g1_bucket + pk_.a_g1_query()[0];
+      ret += RunMSM(a_g1_query_, full_assignments);
+      ret += pk_.verifying_key().alpha_g1();
+      return ret;
+    });
+
+    // |ac_g1_bucket[1]| = [As]₁
+    ac_g1_bucket[1] = ac_g1_bucket[0] * s;
+    // |ac_g1_bucket[1]| = [As + Br - rsδ]₁
+    if (!r.IsZero()) {
+      // |s_delta_g1_bucket| = [sδ]₁
+      G1Bucket s_delta_g1_bucket =
+          math::ConvertPoint<G1Bucket>(s * pk_.delta_g1());
+      // |b_g1_bucket| = [B]₁ = [β + Σᵢ₌₀..ₘ (xᵢ * bᵢ(x)) + sδ]₁
+      // where x is |full_assignments|.
+      G1Bucket b_g1_bucket = internal::RunTimedMSM("b_g1", [&]() {
+        G1Bucket ret = s_delta_g1_bucket + pk_.b_g1_query()[0];
+        ret += RunMSM(b_g1_query_, full_assignments);
+        ret += pk_.beta_g1();
+        return ret;
+      });
+      ac_g1_bucket[1] += (r * b_g1_bucket);
+      ac_g1_bucket[1] -= (s * r_delta_g1_bucket);
+    }
+    // clang-format off
+    // |ac_g1_bucket[1]| = [C]₁ = [(Σᵢ₌ₗ₊₁..ₘ (β * aᵢ(x) + α * bᵢ(x) + cᵢ(x)) + h(x)t(x)) / δ + As + Br - rsδ]₁
+    // clang-format on
+    ac_g1_bucket[1] += witness_acc;
+    ac_g1_bucket[1] += h_acc;
+
+    G1AffinePoint ac_g1[2];
+    CHECK(G1Bucket::BatchNormalize(ac_g1_bucket, &ac_g1));
+
+    G2Bucket b_g2_bucket = b_g2_future.get();
+
+    return {
+        std::move(ac_g1[0]),
+        b_g2_bucket.ToAffine(),
+        std::move(ac_g1[1]),
+    };
+  }
+
+  Proof<Curve> CreateProofWithAssignmentZK(
+      absl::Span<const F> h_coefficients,
+      absl::Span<const F> instance_assignments,
+      absl::Span<const F> witness_assignments,
+      absl::Span<const F> full_assignments) {
+    return CreateProofWithAssignment(F::Random(), F::Random(), h_coefficients,
+                                     witness_assignments, full_assignments);
+  }
+
+  Proof<Curve> CreateProofWithAssignmentNoZK(
+      absl::Span<const F> h_coefficients,
+      absl::Span<const F> instance_assignments,
+      absl::Span<const F> witness_assignments,
+      absl::Span<const F> full_assignments) {
+    return CreateProofWithAssignment(F::Zero(), F::Zero(), h_coefficients,
+                                     witness_assignments, full_assignments);
+  }
+
+ private:
+  struct ResidentQuery {
+    // Padded with zero points to a power of 2.
+    device::gpu::GpuMemory<G1AffinePointGpu> d_bases;
+    // The number of bases before padding.
+    size_t size = 0;
+  };
+
+  static ResidentQuery Upload(absl::Span<const G1AffinePoint> query) {
+    std::vector<G1AffinePoint> aligned_bases(absl::bit_ceil(query.size()),
+                                             G1AffinePoint::Zero());
+    std::copy(query.begin(), query.end(), aligned_bases.begin());
+
+    ResidentQuery ret;
+    ret.d_bases =
+        device::gpu::GpuMemory<G1AffinePointGpu>::Malloc(aligned_bases.size());
+    CHECK(ret.d_bases.CopyFrom(aligned_bases.data(),
+                               device::gpu::GpuMemoryType::kHost));
+    ret.size = query.size();
+    return ret;
+  }
+
+  // Runs an MSM between the first |scalars.size()| bases of |query| and
+  // |scalars|.
+  G1Bucket RunMSM(const ResidentQuery& query, absl::Span<const F> scalars) {
+    CHECK_LE(scalars.size(), query.size);
+    size_t aligned_size = query.d_bases.size();
+    CHECK(d_scalars_.CopyFrom(scalars.data(), device::gpu::GpuMemoryType::kHost,
+                              0, scalars.size()));
+    // NOTE: The zero of a prime field is all zero bits in the montgomery form
+    // as well, so the padding is filled with zeros.
+    if (scalars.size() < aligned_size) {
+      CHECK(d_scalars_.Memset(0, scalars.size(),
+                              aligned_size - scalars.size()));
+    }
+
+    G1JacobianPoint ret;
+    CHECK(msm_.Run(query.d_bases, d_scalars_, aligned_size, &ret));
+    return math::ConvertPoint<G1Bucket>(ret);
+  }
+
+  const ProvingKey<Curve>& pk_;
+  math::VariableBaseMSMGpu<G1CurveGpu> msm_;
+  ResidentQuery a_g1_query_;
+  ResidentQuery b_g1_query_;
+  ResidentQuery h_g1_query_;
+  ResidentQuery l_g1_query_;
+  device::gpu::GpuMemory<FGpu> d_scalars_;
+};
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_PROVE_GPU_H_
@@ -6,10 +6,15 @@
 #ifndef TACHYON_ZK_R1CS_GROTH16_VERIFY_H_
 #define TACHYON_ZK_R1CS_GROTH16_VERIFY_H_
 
+#include <numeric>
+#include <utility>
 #include <vector>
 
 #include "absl/types/span.h"
 
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/pairing/pairing.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
@@ -67,6 +72,95 @@ template <typename Curve, typename Container>
   return VerifyProofWithPreparedInputs(pvk, proof, prepared_inputs);
 }
 
+// Verifies every proof of |proofs| against the same |pvk| at once.
+// |public_inputs_vec[i]| is the public inputs of |proofs[i]|. The pairing
+// equation of each proof is raised to the power of a random rᵢ and they are
+// multiplied together, so that the G1 points paired with the same G2 point
+// are gathered by an MSM and only a single multi Miller loop and final
+// exponentiation are run:
+//
+// clang-format off
+// Πᵢ e(rᵢ * Aᵢ, Bᵢ) * e(Σᵢ rᵢ * Pᵢ, [-γ]₂) * e(Σᵢ rᵢ * Cᵢ, [-δ]₂) ≟ e([α]₁, [β]₂)^(Σᵢ rᵢ)
+// clang-format on
+//
+// where Pᵢ is the prepared inputs of the i-th proof. Since Pᵢ is linear in
+// the public inputs, Σᵢ rᵢ * Pᵢ is computed by a single MSM over the
+// combined public inputs.
+template <typename Curve, typename Container>
+[[nodiscard]] bool BatchVerifyProofs(
+    const PreparedVerifyingKey<Curve>& pvk,
+    absl::Span<const Proof<Curve>> proofs,
+    absl::Span<const Container> public_inputs_vec) {
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+  using G2Prepared = typename Curve::G2Prepared;
+  using F = typename G1Point::ScalarField;
+  using Bucket = typename math::VariableBaseMSM<G1Point>::Bucket;
+
+  if (proofs.size() != public_inputs_vec.size()) {
+    LOG(ERROR) << "The number of proofs and public inputs do not match";
+    return false;
+  }
+  if (proofs.empty()) return true;
+
+  const std::vector<G1Point>& l_g1_query = pvk.verifying_key().l_g1_query();
+  for (const Container& public_inputs : public_inputs_vec) {
+    if (std::size(public_inputs) + 1 != l_g1_query.size()) {
+      LOG(ERROR) << "The size of public inputs doesn't match with verifying "
+                    "key";
+      return false;
+    }
+  }
+
+  // The first equation doesn't have to be randomized.
+  std::vector<F> rs = base::CreateVector(
+      proofs.size(), [](size_t i) { return i == 0 ? F::One() : F::Random(); });
+
+  // |combined_inputs| = [Σᵢ rᵢ, Σᵢ rᵢ * xᵢ₀, Σᵢ rᵢ * xᵢ₁, ...]
+  std::vector<F> combined_inputs(l_g1_query.size());
+  combined_inputs[0] =
+      std::accumulate(rs.begin(), rs.end(), F::Zero(),
+                      [](F& acc, const F& r) { return acc += r; });
+  OPENMP_PARALLEL_FOR(size_t j = 1; j < combined_inputs.size(); ++j) {
+    F sum = F::Zero();
+    for (size_t i = 0; i < rs.size(); ++i) {
+      sum += rs[i] * public_inputs_vec[i][j - 1];
+    }
+    combined_inputs[j] = std::move(sum);
+  }
+
+  math::VariableBaseMSM<G1Point> msm;
+  // Σᵢ rᵢ * Pᵢ
+  Bucket prepared_inputs;
+  if (!msm.Run(l_g1_query, combined_inputs, &prepared_inputs)) return false;
+  // Σᵢ rᵢ * Cᵢ
+  std::vector<G1Point> cs =
+      base::Map(proofs, [](const Proof<Curve>& proof) { return proof.c(); });
+  Bucket c;
+  if (!msm.Run(cs, rs, &c)) return false;
+
+  // [r₀ * A₀, r₁ * A₁, ..., Σᵢ rᵢ * Pᵢ, Σᵢ rᵢ * Cᵢ]
+  std::vector<G1JacobianPoint> scaled_as =
+      base::CreateVector(proofs.size(), [&proofs, &rs](size_t i) {
+        return proofs[i].a() * rs[i];
+      });
+  std::vector<G1Point> g1(proofs.size() + 2);
+  absl::Span<G1Point> g1_scaled_as = absl::MakeSpan(g1).first(proofs.size());
+  if (!G1JacobianPoint::BatchNormalize(scaled_as, &g1_scaled_as)) return false;
+  g1[proofs.size()] = math::ConvertPoint<G1Point>(prepared_inputs);
+  g1[proofs.size() + 1] = math::ConvertPoint<G1Point>(c);
+
+  // [B₀, B₁, ..., [-γ]₂, [-δ]₂]
+  std::vector<G2Prepared> g2 = base::Map(proofs, [](const Proof<Curve>& proof) {
+    return G2Prepared::From(proof.b());
+  });
+  g2.push_back(pvk.gamma_neg_g2());
+  g2.push_back(pvk.delta_neg_g2());
+
+  return math::Pairing<Curve>(g1, g2) ==
+         pvk.alpha_g1_beta_g2().Pow(combined_inputs[0]);
+}
+
 }  // namespace tachyon::zk::r1cs::groth16
 
 #endif  // TACHYON_ZK_R1CS_GROTH16_VERIFY_H_
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/base/optional.h"
 #include "tachyon/zk/r1cs/groth16/key.h"
@@ -125,4 +126,42 @@ class VerifyingKey : public Key {
 
 }  // namespace tachyon::zk::r1cs::groth16
 
+namespace tachyon::base {
+
+template <typename Curve>
+class Copyable<zk::r1cs::groth16::VerifyingKey<Curve>> {
+ public:
+  using VerifyingKey = zk::r1cs::groth16::VerifyingKey<Curve>;
+  using G1Point = typename VerifyingKey::G1Point;
+  using G2Point = typename VerifyingKey::G2Point;
+
+  static bool WriteTo(const VerifyingKey& vk, Buffer* buffer) {
+    return buffer->WriteMany(vk.alpha_g1(), vk.beta_g2(), vk.gamma_g2(),
+                             vk.delta_g2(), vk.l_g1_query());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, VerifyingKey* vk) {
+    G1Point alpha_g1;
+    G2Point beta_g2;
+    G2Point gamma_g2;
+    G2Point delta_g2;
+    std::vector<G1Point> l_g1_query;
+    if (!buffer.ReadMany(&alpha_g1, &beta_g2, &gamma_g2, &delta_g2,
+                         &l_g1_query)) {
+      return false;
+    }
+    *vk = VerifyingKey(std::move(alpha_g1), std::move(beta_g2),
+                       std::move(gamma_g2), std::move(delta_g2),
+                       std::move(l_g1_query));
+    return true;
+  }
+
+  static size_t EstimateSize(const VerifyingKey& vk) {
+    return base::EstimateSize(vk.alpha_g1(), vk.beta_g2(), vk.gamma_g2(),
+                              vk.delta_g2(), vk.l_g1_query());
+  }
+};
+
+}  // namespace tachyon::base
+
 #endif  // TACHYON_ZK_R1CS_GROTH16_VERIFYING_KEY_H_
@@ -2,6 +2,7 @@
 #include <stdint.h>
 
 #include <iostream>
+#include <string_view>
 #include <utility>
 
 #include "alt_bn128.hpp"  // NOLINT(build/include_subdir)
@@ -11,11 +12,20 @@
 #include "benchmark/bit_conversion.h"
 #include "benchmark/rapidsnark_runner.h"
 #include "benchmark/tachyon_runner.h"
+#if TACHYON_CUDA
+#include "benchmark/tachyon_gpu_runner.h"
+#endif
 // clang-format on
 #include "tachyon/base/console/iostream.h"
 #include "tachyon/base/flag/flag_parser.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
 
+#if TACHYON_CUDA
+#include "tachyon/math/elliptic_curves/bn/bn254/g1_gpu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/bellman/bn254_bellman_msm_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/cuzk/bn254_cuzk_kernels.cu.h"
+#endif
+
 namespace tachyon::circom {
 
 using namespace math;
@@ -59,10 +69,20 @@ int RealMain(int argc, char** argv) {
   Curve::Init();
 
   std::vector<std::unique_ptr<Runner<Curve>>> runners;
+  std::vector<std::string_view> runner_names;
   runners.push_back(std::make_unique<TachyonRunner<Curve, MaxDegree>>(
       base::FilePath("benchmark/sha256_512_cpp/sha256_512.dat")));
+  runner_names.push_back("tachyon");
+#if TACHYON_CUDA
+  runners.push_back(
+      std::make_unique<
+          TachyonGpuRunner<Curve, math::bn254::G1CurveGpu, MaxDegree>>(
+          base::FilePath("benchmark/sha256_512_cpp/sha256_512.dat")));
+  runner_names.push_back("tachyon_gpu");
+#endif
   runners.push_back(std::make_unique<RapidsnarkRunner<Curve, AltBn128::Engine>>(
       base::FilePath("benchmark/sha256_512_verification_key.json")));
+  runner_names.push_back("rapidsnark");
   std::vector<zk::r1cs::groth16::Proof<Curve>> proofs;
 
   std::vector<uint8_t> in = base::CreateVector(
@@ -80,16 +100,18 @@ int RealMain(int argc, char** argv) {
 
       WitnessLoader<F>& witness_loader = tachyon_runner->witness_loader();
 
-      witness_loader.Set("in", Uint8ToBitVector<F>(in));
-      witness_loader.Load();
-
       const zk::r1cs::ConstraintMatrices<F>& constraint_matrices =
           tachyon_runner->constraint_matrices();
 
-      full_assignments = base::CreateVector(
-          constraint_matrices.num_instance_variables +
-              constraint_matrices.num_witness_variables,
-          [&witness_loader](size_t i) { return witness_loader.Get(i); });
+      // The witnesses are computed natively and written straight into the
+      // full assignments, without a .wtns file in between.
+      full_assignments.resize(constraint_matrices.num_instance_variables +
+                              constraint_matrices.num_witness_variables);
+      base::TimeTicks now = base::TimeTicks::Now();
+      witness_loader.Set("in", Uint8ToBitVector<F>(in));
+      witness_loader.Load();
+      witness_loader.GetAll(absl::MakeSpan(full_assignments));
+      std::cout << "witness: " << base::TimeTicks::Now() - now << std::endl;
 
       public_inputs =
           absl::MakeConstSpan(full_assignments)
@@ -108,12 +130,7 @@ int RealMain(int argc, char** argv) {
       std::cout << "[" << j << "]: " << delta << std::endl;
       total_delta += delta;
     }
-    if (i == 0) {
-      std::cout << "tachyon(avg): ";
-    } else {
-      std::cout << "rapidsnark(avg): ";
-    }
-    std::cout << total_delta / n << std::endl;
+    std::cout << runner_names[i] << "(avg): " << total_delta / n << std::endl;
 
     if (i > 0) {
       CHECK_EQ(proofs[0], proofs.back());
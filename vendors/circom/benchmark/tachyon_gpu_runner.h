@@ -0,0 +1,98 @@
+#ifndef VENDORS_CIRCOM_BENCHMARK_TACHYON_GPU_RUNNER_H_
+#define VENDORS_CIRCOM_BENCHMARK_TACHYON_GPU_RUNNER_H_
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// clang-format off
+#include "benchmark/tachyon_runner.h"
+// clang-format on
+#include "tachyon/device/gpu/scoped_mem_pool.h"
+#include "tachyon/device/gpu/scoped_stream.h"
+#include "tachyon/zk/r1cs/groth16/prove_gpu.h"
+
+namespace tachyon::circom {
+
+// Same as |TachyonRunner|, but runs the G1 MSMs on the GPU. The G1 queries of
+// the zkey are uploaded once in |LoadZkey()|, so they are excluded from the
+// measured time as the zkey parsing is.
+template <typename Curve, typename G1CurveGpu, size_t MaxDegree>
+class TachyonGpuRunner : public TachyonRunner<Curve, MaxDegree> {
+ public:
+  using F = typename Curve::G1Curve::ScalarField;
+
+  explicit TachyonGpuRunner(const base::FilePath& data_path)
+      : TachyonRunner<Curve, MaxDegree>(data_path) {
+    gpuMemPoolProps props = {gpuMemAllocationTypePinned,
+                             gpuMemHandleTypeNone,
+                             {gpuMemLocationTypeDevice, 0}};
+    mem_pool_ = device::gpu::CreateMemPool(&props);
+    uint64_t mem_pool_threshold = std::numeric_limits<uint64_t>::max();
+    GPU_MUST_SUCCESS(
+        gpuMemPoolSetAttribute(mem_pool_.get(), gpuMemPoolAttrReleaseThreshold,
+                               &mem_pool_threshold),
+        "Failed to gpuMemPoolSetAttribute()");
+    stream_ = device::gpu::CreateStream();
+  }
+
+  void LoadZkey(const base::FilePath& zkey_path) override {
+    TachyonRunner<Curve, MaxDegree>::LoadZkey(zkey_path);
+    prover_ =
+        std::make_unique<zk::r1cs::groth16::ProverGpu<Curve, G1CurveGpu>>(
+            this->proving_key_, math::MSMAlgorithmKind::kBellmanMSM,
+            mem_pool_.get(), stream_.get());
+  }
+
+  zk::r1cs::groth16::Proof<Curve> Run(const std::vector<F>& full_assignments,
+                                      absl::Span<const F> public_inputs,
+                                      base::TimeDelta& delta) override {
+    using Domain = math::UnivariateEvaluationDomain<F, MaxDegree>;
+
+    const zk::r1cs::ConstraintMatrices<F>& constraint_matrices =
+        this->constraint_matrices_;
+
+    base::TimeTicks now = base::TimeTicks::Now();
+
+    std::unique_ptr<Domain> domain =
+        Domain::Create(constraint_matrices.num_constraints +
+                       constraint_matrices.num_instance_variables);
+    std::vector<F> h_evals =
+        QuadraticArithmeticProgram<F>::WitnessMapFromMatrices(
+            domain.get(), this->csr_matrices_, full_assignments);
+
+    zk::r1cs::groth16::Proof<Curve> proof =
+        prover_->CreateProofWithAssignmentNoZK(
+            absl::MakeConstSpan(h_evals),
+            absl::MakeConstSpan(full_assignments)
+                .subspan(1, constraint_matrices.num_instance_variables - 1),
+            absl::MakeConstSpan(full_assignments)
+                .subspan(constraint_matrices.num_instance_variables),
+            absl::MakeConstSpan(full_assignments).subspan(1));
+
+    delta = base::TimeTicks::Now() - now;
+
+    if (!this->prepared_verifying_key_.has_value()) {
+      // NOTE: The verifying key is copied, since |prover_| keeps referring to
+      // |proving_key_|.
+      this->prepared_verifying_key_ =
+          zk::r1cs::groth16::VerifyingKey<Curve>(
+              this->proving_key_.verifying_key())
+              .ToPreparedVerifyingKey();
+    }
+    CHECK(zk::r1cs::groth16::VerifyProof(*this->prepared_verifying_key_, proof,
+                                         public_inputs));
+
+    return proof;
+  }
+
+ private:
+  device::gpu::ScopedMemPool mem_pool_;
+  device::gpu::ScopedStream stream_;
+  std::unique_ptr<zk::r1cs::groth16::ProverGpu<Curve, G1CurveGpu>> prover_;
+};
+
+}  // namespace tachyon::circom
+
+#endif  // VENDORS_CIRCOM_BENCHMARK_TACHYON_GPU_RUNNER_H_
@@ -44,6 +44,8 @@ class TachyonRunner : public Runner<Curve> {
 
     proving_key_ = std::move(*zkey).TakeProvingKey().ToNativeProvingKey();
     constraint_matrices_ = std::move(*zkey).TakeConstraintMatrices().ToNative();
+    csr_matrices_ =
+        QuadraticArithmeticProgram<F>::CSRMatrices::From(constraint_matrices_);
   }
 
   zk::r1cs::groth16::Proof<Curve> Run(const std::vector<F>& full_assignments,
@@ -58,7 +60,7 @@ class TachyonRunner : public Runner<Curve> {
                        constraint_matrices_.num_instance_variables);
     std::vector<F> h_evals =
         QuadraticArithmeticProgram<F>::WitnessMapFromMatrices(
-            domain.get(), constraint_matrices_, full_assignments);
+            domain.get(), csr_matrices_, full_assignments);
 
     zk::r1cs::groth16::Proof<Curve> proof =
         zk::r1cs::groth16::CreateProofWithAssignmentNoZK(
@@ -81,10 +83,11 @@ class TachyonRunner : public Runner<Curve> {
     return proof;
   }
 
- private:
+ protected:
   WitnessLoader<F> witness_loader_;
   zk::r1cs::groth16::ProvingKey<Curve> proving_key_;
   zk::r1cs::ConstraintMatrices<F> constraint_matrices_;
+  typename QuadraticArithmeticProgram<F>::CSRMatrices csr_matrices_;
   std::optional<zk::r1cs::groth16::PreparedVerifyingKey<Curve>>
       prepared_verifying_key_;
 };
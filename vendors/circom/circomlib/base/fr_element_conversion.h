@@ -20,6 +20,14 @@ FrElement ConvertToFrElement(const F& value) {
 template <typename F>
 F ConvertFromFrElement(FrElement& value) {
   using BigInt = typename F::BigIntTy;
+  // NOTE: Most of the signals computed by the witness calculator are already
+  // in the long montgomery form, which is the same as the one of |F|. So they
+  // are copied as is instead of being converted to the normal form and back.
+  if (value.type == Fr_LONGMONTGOMERY) {
+    BigInt bigint;
+    memcpy(bigint.limbs, value.longVal, sizeof(uint64_t) * F::kLimbNums);
+    return F::FromMontgomery(bigint);
+  }
   FrElement tmp;
   Fr_toLongNormal(&tmp, &value);
   BigInt bigint;
@@ -3,16 +3,58 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <string_view>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/buffer/endian_auto_reset.h"
 #include "tachyon/base/buffer/read_only_buffer.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
 #include "tachyon/base/range.h"
 
 namespace tachyon::circom {
 
+// Reads |num_elements| elements of |T| from the current offset of |buffer| in
+// parallel and advances the offset past them. Every element must be encoded
+// in the same number of bytes, which is the case for the fields and the points
+// stored in the sections.
+template <typename T>
+bool ReadElementsInParallel(const base::ReadOnlyBuffer& buffer,
+                            size_t num_elements, std::vector<T>* elements) {
+  size_t element_size = base::EstimateSize(T());
+  size_t offset = buffer.buffer_offset();
+  if (offset + element_size * num_elements > buffer.buffer_len()) {
+    LOG(ERROR) << "Not enough bytes to read " << num_elements << " elements";
+    return false;
+  }
+
+  elements->resize(num_elements);
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(buffer.buffer());
+  std::atomic<bool> failed(false);
+  base::Parallelize(
+      *elements,
+      [&buffer, data, offset, element_size, &failed](
+          absl::Span<T> chunk, size_t chunk_index, size_t chunk_size) {
+        size_t start = offset + chunk_index * chunk_size * element_size;
+        base::ReadOnlyBuffer chunk_buffer(data + start,
+                                          chunk.size() * element_size);
+        chunk_buffer.set_endian(buffer.endian());
+        for (T& element : chunk) {
+          if (!chunk_buffer.Read(&element)) {
+            failed.store(true, std::memory_order_relaxed);
+            return;
+          }
+        }
+      });
+  if (failed.load(std::memory_order_relaxed)) return false;
+  buffer.set_buffer_offset(offset + element_size * num_elements);
+  return true;
+}
+
 template <typename T>
 struct Section {
   T type;
@@ -51,13 +93,26 @@ class Sections {
     return true;
   }
 
+  // Returns the bytes of the section of |type|, which point into the buffer
+  // given on construction, or an empty span if there's no such section.
+  absl::Span<const uint8_t> GetBytes(T type) const {
+    auto it = std::find_if(
+        sections_.begin(), sections_.end(),
+        [type](const Section<T>& section) { return section.type == type; });
+    if (it == sections_.end()) return {};
+    return absl::MakeConstSpan(
+        reinterpret_cast<const uint8_t*>(buffer_.buffer()) + it->range.from,
+        it->range.to - it->range.from);
+  }
+
  private:
   bool Add() {
     T type;
     uint64_t size;
     if (!buffer_.ReadMany(&type, &size)) return false;
 
-    sections_.push_back({type, {buffer_.buffer_offset(), size}});
+    sections_.push_back(
+        {type, {buffer_.buffer_offset(), buffer_.buffer_offset() + size}});
     buffer_.set_buffer_offset(buffer_.buffer_offset() + size);
     return true;
   }
@@ -4,6 +4,7 @@
 
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 
 namespace tachyon::circom {
@@ -71,4 +72,44 @@ TEST(SectionsTest, ReadAndGet) {
   }
 }
 
+TEST(SectionsTest, GetBytes) {
+  base::Uint8VectorBuffer buffer;
+  ASSERT_TRUE(buffer.Write(uint32_t{1}));
+  ASSERT_TRUE(buffer.Write(Type::kDummy));
+  ASSERT_TRUE(buffer.Write(uint64_t{2}));
+  size_t offset = buffer.buffer_offset();
+  ASSERT_TRUE(buffer.Write(uint8_t{3}));
+  ASSERT_TRUE(buffer.Write(uint8_t{4}));
+  buffer.set_buffer_offset(0);
+  Sections<Type> sections(buffer, &TypeToString);
+  ASSERT_TRUE(sections.Read());
+
+  EXPECT_TRUE(sections.GetBytes(Type::kDummy2).empty());
+  absl::Span<const uint8_t> bytes = sections.GetBytes(Type::kDummy);
+  ASSERT_EQ(bytes.size(), 2);
+  EXPECT_EQ(bytes.data(),
+            reinterpret_cast<const uint8_t*>(buffer.buffer()) + offset);
+  EXPECT_EQ(bytes[0], 3);
+  EXPECT_EQ(bytes[1], 4);
+}
+
+TEST(SectionsTest, ReadElementsInParallel) {
+  std::vector<uint32_t> expected = base::CreateVector(
+      100, [](size_t i) { return static_cast<uint32_t>(i * i); });
+  base::Uint8VectorBuffer buffer;
+  ASSERT_TRUE(buffer.Write(uint8_t{0}));
+  for (uint32_t value : expected) {
+    ASSERT_TRUE(buffer.Write(value));
+  }
+  buffer.set_buffer_offset(1);
+
+  std::vector<uint32_t> elements;
+  ASSERT_TRUE(ReadElementsInParallel(buffer, expected.size(), &elements));
+  EXPECT_EQ(elements, expected);
+  EXPECT_EQ(buffer.buffer_offset(), buffer.buffer_len());
+
+  buffer.set_buffer_offset(1);
+  EXPECT_FALSE(ReadElementsInParallel(buffer, expected.size() + 1, &elements));
+}
+
 }  // namespace tachyon::circom
@@ -10,7 +10,13 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/matrix/sparse/sparse_matrix.h"
+#include "tachyon/math/matrix/sparse/sparse_matrix_vector_mul.h"
+#include "tachyon/zk/r1cs/constraint_system/constraint_matrices.h"
 #include "tachyon/zk/r1cs/constraint_system/quadratic_arithmetic_program.h"
 
 namespace tachyon::circom {
@@ -18,6 +24,25 @@ namespace tachyon::circom {
 template <typename F>
 class QuadraticArithmeticProgram {
  public:
+  // The A and B matrices of |zk::r1cs::ConstraintMatrices| in the CSR layout.
+  // Convert them once with |From()| when creating many proofs for the same
+  // circuit.
+  struct CSRMatrices {
+    size_t num_instance_variables = 0;
+    size_t num_constraints = 0;
+    math::CSRSparseMatrix<F> a;
+    math::CSRSparseMatrix<F> b;
+
+    static CSRMatrices From(const zk::r1cs::ConstraintMatrices<F>& matrices) {
+      return {
+          matrices.num_instance_variables,
+          matrices.num_constraints,
+          matrices.a.ToCSR(),
+          matrices.b.ToCSR(),
+      };
+    }
+  };
+
   QuadraticArithmeticProgram() = delete;
 
   template <typename Domain>
@@ -31,9 +56,14 @@ class QuadraticArithmeticProgram {
   static std::vector<F> WitnessMapFromMatrices(
       const Domain* domain, const zk::r1cs::ConstraintMatrices<F>& matrices,
       absl::Span<const F> full_assignments) {
-    using Evals = typename Domain::Evals;
-    using DensePoly = typename Domain::DensePoly;
+    return WitnessMapFromMatrices(domain, CSRMatrices::From(matrices),
+                                  full_assignments);
+  }
 
+  template <typename Domain>
+  static std::vector<F> WitnessMapFromMatrices(
+      const Domain* domain, const CSRMatrices& matrices,
+      absl::Span<const F> full_assignments) {
     CHECK_GE(domain->size(), matrices.num_constraints);
 
     std::vector<F> a(domain->size());
@@ -49,9 +79,12 @@ class QuadraticArithmeticProgram {
     //        = 0                      (otherwise)
     // where x is |full_assignments|.
     // clang-format on
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < matrices.num_constraints; ++i) {
-      a[i] = zk::r1cs::EvaluateConstraint(matrices.a[i], full_assignments);
-      b[i] = zk::r1cs::EvaluateConstraint(matrices.b[i], full_assignments);
+    size_t num_constraints = matrices.num_constraints;
+    math::SparseMatrixVectorMul(matrices.a, full_assignments,
+                                absl::MakeSpan(a).first(num_constraints));
+    math::SparseMatrixVectorMul(matrices.b, full_assignments,
+                                absl::MakeSpan(b).first(num_constraints));
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_constraints; ++i) {
       c[i] = a[i] * b[i];
     }
 
@@ -60,35 +93,17 @@ class QuadraticArithmeticProgram {
       a[i] = full_assignments[i - matrices.num_constraints];
     }
 
-    Evals a_evals(std::move(a));
-    DensePoly a_poly = domain->IFFT(std::move(a_evals));
-    Evals b_evals(std::move(b));
-    DensePoly b_poly = domain->IFFT(std::move(b_evals));
-    Evals c_evals(std::move(c));
-    DensePoly c_poly = domain->IFFT(std::move(c_evals));
-
     F root_of_unity;
     {
       std::unique_ptr<Domain> extended_domain =
           Domain::Create(2 * domain->size());
       root_of_unity = extended_domain->GetElement(1);
     }
-    Domain::DistributePowers(a_poly, root_of_unity);
-    Domain::DistributePowers(b_poly, root_of_unity);
-    Domain::DistributePowers(c_poly, root_of_unity);
-
-    a_evals = domain->FFT(std::move(a_poly));
-    b_evals = domain->FFT(std::move(b_poly));
-    c_evals = domain->FFT(std::move(c_poly));
 
     // |h_evals[i]| = |a[i]| * |b[i]| - |c[i]|
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < domain->size(); ++i) {
-      F& h_evals_i = a_evals.at(i);
-      h_evals_i *= b_evals[i];
-      h_evals_i -= c_evals[i];
-    }
-
-    return std::move(a_evals).TakeEvaluations();
+    return zk::r1cs::ComputeABMinusCOverCoset(domain, std::move(a),
+                                              std::move(b), std::move(c),
+                                              root_of_unity, F::One());
   }
 
   template <typename Domain>
@@ -5,10 +5,14 @@
 #include <string>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "circomlib/base/fr_element_conversion.h"
 #include "circomlib/generated/common/calcwit.hpp"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/files/file_path.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 
 namespace tachyon::circom {
 
@@ -44,6 +48,20 @@ class WitnessLoader {
     return ConvertFromFrElement<F>(v);
   }
 
+  // Returns the number of the witnesses, including the constant one.
+  size_t GetNumWitnesses() const { return get_size_of_witness(); }
+
+  // Writes the first |witnesses.size()| witnesses in parallel into
+  // |witnesses|, which is typically the buffer of the full assignments of a
+  // prover. Unlike saving them to a .wtns file and parsing it again, they are
+  // written in place in the montgomery form.
+  void GetAll(absl::Span<F> witnesses) const {
+    CHECK_LE(witnesses.size(), GetNumWitnesses());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < witnesses.size(); ++i) {
+      witnesses[i] = Get(i);
+    }
+  }
+
  private:
   std::unique_ptr<Circom_Circuit> circuit_;
   std::unique_ptr<Circom_CalcWit> calc_wit_;
@@ -0,0 +1,148 @@
+#ifndef VENDORS_CIRCOM_CIRCOMLIB_JSON_DECIMAL_H_
+#define VENDORS_CIRCOM_CIRCOMLIB_JSON_DECIMAL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <optional>
+#include <string_view>
+
+#include "absl/numeric/int128.h"
+
+#include "tachyon/base/endian_utils.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/arithmetics.h"
+#include "tachyon/math/base/big_int.h"
+
+namespace tachyon::circom {
+namespace internal {
+
+// The number of the decimal digits converted at once, which is the largest
+// power of 10 that fits in a limb.
+constexpr size_t kDecimalChunkDigits = 19;
+constexpr uint64_t kDecimalChunk = UINT64_C(10000000000000000000);
+
+constexpr char kDigitPairs[] =
+    "0001020304050607080910111213141516171819202122232425262728293031323334"
+    "3536373839404142434445464748495051525354555657585960616263646566676869"
+    "707172737475767778798081828384858687888990919293949596979899";
+
+// Writes |chunk| < 10¹⁹ to |out| with |kDecimalChunkDigits| digits padded with
+// leading zeros, 2 digits at a time.
+inline void WriteDecimalChunk(uint64_t chunk, char* out) {
+  for (size_t i = kDecimalChunkDigits; i > 1; i -= 2) {
+    size_t pair = static_cast<size_t>(chunk % 100) * 2;
+    chunk /= 100;
+    out[i - 1] = kDigitPairs[pair + 1];
+    out[i - 2] = kDigitPairs[pair];
+  }
+  out[0] = static_cast<char>('0' + chunk);
+}
+
+}  // namespace internal
+
+// The largest number of the decimal digits of a |BigInt<N>|, since
+// 2⁶⁴ < 10²⁰.
+template <size_t N>
+constexpr size_t kMaxDecimalDigits = 20 * N;
+
+// Writes |value| in decimal to |out|, which holds at least
+// |kMaxDecimalDigits<N>| chars, and returns the number of the digits written.
+// It doesn't null-terminate |out|.
+//
+// NOTE: This is the same as |value.ToString()| without going through gmp and
+// allocating a string. |value| is split into base 10¹⁹ chunks by dividing all
+// the limbs at once, and each chunk is then converted to digits.
+template <size_t N>
+size_t WriteDecimal(const math::BigInt<N>& value, char* out) {
+  // NOTE: A |BigInt<N>| has at most N + 1 chunks, since 10¹⁹ > 2⁶³.
+  uint64_t chunks[N + 1];
+  size_t num_chunks = 0;
+  math::BigInt<N> quotient = value;
+  do {
+    absl::uint128 remainder = 0;
+    FOR_FROM_BIGGEST(i, 0, N) {
+      absl::uint128 dividend = (remainder << 64) | quotient.limbs[i];
+      quotient.limbs[i] =
+          absl::Uint128Low64(dividend / internal::kDecimalChunk);
+      remainder = dividend % internal::kDecimalChunk;
+    }
+    chunks[num_chunks++] = absl::Uint128Low64(remainder);
+  } while (!quotient.IsZero());
+
+  // The biggest chunk is written without the leading zeros.
+  char biggest[internal::kDecimalChunkDigits];
+  internal::WriteDecimalChunk(chunks[num_chunks - 1], biggest);
+  size_t skip = 0;
+  while (skip < internal::kDecimalChunkDigits - 1 && biggest[skip] == '0') {
+    ++skip;
+  }
+  size_t len = internal::kDecimalChunkDigits - skip;
+  memcpy(out, biggest + skip, len);
+  for (size_t i = num_chunks - 1; i > 0; --i) {
+    internal::WriteDecimalChunk(chunks[i - 1], out + len);
+    len += internal::kDecimalChunkDigits;
+  }
+  return len;
+}
+
+// Parses the decimal |str| to |value|. Returns false if |str| is empty, has a
+// char other than a digit or doesn't fit in a |BigInt<N>|. Unlike
+// |math::BigInt<N>::FromDecString()|, it doesn't go through gmp.
+template <size_t N>
+[[nodiscard]] bool ParseDecimal(std::string_view str, math::BigInt<N>* value) {
+  if (str.empty()) return false;
+
+  math::BigInt<N> ret;
+  // The first chunk takes the leftover digits so that the others are full.
+  size_t chunk_len = str.size() % internal::kDecimalChunkDigits;
+  if (chunk_len == 0) chunk_len = internal::kDecimalChunkDigits;
+  for (size_t offset = 0; offset < str.size();
+       offset += chunk_len, chunk_len = internal::kDecimalChunkDigits) {
+    uint64_t chunk = 0;
+    uint64_t scale = 1;
+    for (char c : str.substr(offset, chunk_len)) {
+      if (c < '0' || c > '9') return false;
+      chunk = chunk * 10 + static_cast<uint64_t>(c - '0');
+      scale *= 10;
+    }
+    // |ret| = |ret| * |scale| + |chunk|
+    uint64_t carry = chunk;
+    FOR_FROM_SMALLEST(i, 0, N) {
+      math::MulResult<uint64_t> result =
+          math::internal::u64::MulAddWithCarry(0, ret.limbs[i], scale, carry);
+      ret.limbs[i] = result.lo;
+      carry = result.hi;
+    }
+    if (carry != 0) return false;
+  }
+  *value = ret;
+  return true;
+}
+
+// Same as |F::FromDecString()|, but with |ParseDecimal()|.
+template <typename F>
+std::optional<F> ParsePrimeField(std::string_view str) {
+  using BigIntTy = typename F::BigIntTy;
+
+  BigIntTy value;
+  if (!ParseDecimal(str, &value)) return std::nullopt;
+  if (value >= F::Config::kModulus) {
+    LOG(ERROR) << "value(" << str << ") is greater than or equal to modulus";
+    return std::nullopt;
+  }
+  return F::FromBigInt(value);
+}
+
+// Writes the prime field |value| in decimal as a json string to |writer|.
+template <typename F, typename Writer>
+bool WriteDecimalString(const F& value, Writer& writer) {
+  char buffer[kMaxDecimalDigits<F::BigIntTy::kLimbNums>];
+  size_t len = WriteDecimal(value.ToBigInt(), buffer);
+  return writer.String(buffer, len, true);
+}
+
+}  // namespace tachyon::circom
+
+#endif  // VENDORS_CIRCOM_CIRCOMLIB_JSON_DECIMAL_H_
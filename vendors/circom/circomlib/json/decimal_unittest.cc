@@ -0,0 +1,74 @@
+#include "circomlib/json/decimal.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::circom {
+
+namespace {
+
+class DecimalTest : public math::FiniteFieldTest<math::bn254::Fr> {};
+
+template <size_t N>
+std::string ToDecimal(const math::BigInt<N>& value) {
+  char buffer[kMaxDecimalDigits<N>];
+  return std::string(buffer, WriteDecimal(value, buffer));
+}
+
+}  // namespace
+
+TEST_F(DecimalTest, Write) {
+  EXPECT_EQ(ToDecimal(math::BigInt<1>(0)), "0");
+  EXPECT_EQ(ToDecimal(math::BigInt<1>(9)), "9");
+  EXPECT_EQ(ToDecimal(math::BigInt<1>(UINT64_C(10000000000000000000))),
+            "10000000000000000000");
+  EXPECT_EQ(ToDecimal(math::BigInt<2>({0, 1})), "18446744073709551616");
+  EXPECT_EQ(ToDecimal(math::BigInt<4>::Max()),
+            math::BigInt<4>::Max().ToString());
+  EXPECT_EQ(ToDecimal(math::BigInt<6>::Max()),
+            math::BigInt<6>::Max().ToString());
+
+  for (size_t i = 0; i < 100; ++i) {
+    math::BigInt<4> value = math::BigInt<4>::Random();
+    EXPECT_EQ(ToDecimal(value), value.ToString());
+  }
+}
+
+TEST_F(DecimalTest, Parse) {
+  math::BigInt<2> value;
+  EXPECT_FALSE(ParseDecimal("", &value));
+  EXPECT_FALSE(ParseDecimal("12a", &value));
+  EXPECT_FALSE(ParseDecimal("-1", &value));
+  // 2¹²⁸ doesn't fit in 2 limbs.
+  EXPECT_FALSE(
+      ParseDecimal("340282366920938463463374607431768211456", &value));
+  ASSERT_TRUE(ParseDecimal("340282366920938463463374607431768211455", &value));
+  EXPECT_EQ(value, math::BigInt<2>::Max());
+  ASSERT_TRUE(ParseDecimal("0018446744073709551616", &value));
+  EXPECT_EQ(value, math::BigInt<2>({0, 1}));
+
+  for (size_t i = 0; i < 100; ++i) {
+    math::BigInt<6> expected = math::BigInt<6>::Random();
+    math::BigInt<6> value;
+    ASSERT_TRUE(ParseDecimal(expected.ToString(), &value));
+    EXPECT_EQ(value, expected);
+  }
+}
+
+TEST_F(DecimalTest, PrimeField) {
+  using F = math::bn254::Fr;
+
+  for (size_t i = 0; i < 100; ++i) {
+    F expected = F::Random();
+    std::optional<F> value = ParsePrimeField<F>(expected.ToString());
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(*value, expected);
+  }
+  EXPECT_FALSE(ParsePrimeField<F>(F::Config::kModulus.ToString()).has_value());
+}
+
+}  // namespace tachyon::circom
@@ -1,6 +1,8 @@
 #ifndef VENDORS_CIRCOM_CIRCOMLIB_JSON_GROTH16_PROOF_H_
 #define VENDORS_CIRCOM_CIRCOMLIB_JSON_GROTH16_PROOF_H_
 
+#include <string_view>
+
 #include "circomlib/json/json_converter_forward.h"
 #include "circomlib/json/points.h"
 #include "tachyon/zk/r1cs/groth16/proof.h"
@@ -22,17 +24,35 @@ class JsonSerializer<zk::r1cs::groth16::Proof<Curve>> {
 
     document.AddMember("protocol", "groth16", allocator);
 
-    std::string_view curve_name = Curve::Config::kName;
     rapidjson::Value curve;
+    curve.SetString(rapidjson::StringRef(GetCurveName()));
+    document.AddMember("curve", curve, allocator);
+    return document;
+  }
+
+  template <typename Writer>
+  static bool Write(const zk::r1cs::groth16::Proof<Curve>& proof,
+                    Writer& writer) {
+    return writer.StartObject() &&
+           internal::WriteMember(writer, "pi_a", proof.a()) &&
+           internal::WriteMember(writer, "pi_b", proof.b()) &&
+           internal::WriteMember(writer, "pi_c", proof.c()) &&
+           writer.Key("protocol") && writer.String("groth16") &&
+           writer.Key("curve") && writer.String(GetCurveName()) &&
+           writer.EndObject();
+  }
+
+ private:
+  // Returns the curve name of snarkjs.
+  static const char* GetCurveName() {
+    std::string_view curve_name = Curve::Config::kName;
     if (curve_name == "tachyon::math::bn254::BN254") {
-      curve.SetString("bn128");
+      return "bn128";
     } else if (curve_name == "tachyon::math::bls12_381::BLS12_381") {
-      curve.SetString("bls12381");
-    } else {
-      NOTREACHED();
+      return "bls12381";
     }
-    document.AddMember("curve", curve, allocator);
-    return document;
+    NOTREACHED();
+    return "";
   }
 };
 
@@ -1,20 +1,49 @@
 #ifndef VENDORS_CIRCOM_CIRCOMLIB_JSON_JSON_H_
 #define VENDORS_CIRCOM_CIRCOMLIB_JSON_JSON_H_
 
-#include "rapidjson/stringbuffer.h"
+#include <stdio.h>
+
+#include "rapidjson/filewritestream.h"
 #include "rapidjson/writer.h"
 
 #include "circomlib/json/json_converter_forward.h"
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/buffer/vector_buffer.h"
 #include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
 
 namespace tachyon::circom {
 
+// Writes |value| in json to |path| as it goes, so neither the
+// |rapidjson::Document| nor the whole json string is built in memory.
 template <typename T>
 bool WriteToJson(const T& value, const base::FilePath& path) {
-  rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-  ConvertToJson(value).Accept(writer);
-  return base::WriteFile(path, buffer.GetString());
+  FILE* file = base::OpenFile(path, "wb");
+  if (!file) {
+    LOG(ERROR) << "Failed to open " << path.value();
+    return false;
+  }
+  char buffer[1 << 16];
+  rapidjson::FileWriteStream stream(file, buffer, sizeof(buffer));
+  rapidjson::Writer<rapidjson::FileWriteStream> writer(stream);
+  bool written = WriteJson(value, writer);
+  stream.Flush();
+  written = written && !ferror(file);
+  return base::CloseFile(file) && written;
+}
+
+// Writes |value| with its |base::Copyable| to |path|. It is much smaller and
+// faster than |WriteToJson()| but only readable by tachyon.
+template <typename T>
+bool WriteToBinary(const T& value, const base::FilePath& path) {
+  base::Uint8VectorBuffer buffer;
+  if (!buffer.Grow(base::EstimateSize(value))) return false;
+  if (!buffer.Write(value)) return false;
+  if (!base::WriteLargeFile(path, buffer.owned_buffer())) {
+    LOG(ERROR) << "Failed to write " << path.value();
+    return false;
+  }
+  return true;
 }
 
 }  // namespace tachyon::circom
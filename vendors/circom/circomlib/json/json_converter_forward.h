@@ -13,6 +13,13 @@ rapidjson::Document ConvertToJson(const T& value) {
   return JsonSerializer<T>::ToJson(value);
 }
 
+// Writes |value| to |writer| as it goes instead of building a
+// |rapidjson::Document|.
+template <typename T, typename Writer>
+bool WriteJson(const T& value, Writer& writer) {
+  return JsonSerializer<T>::Write(value, writer);
+}
+
 }  // namespace tachyon::circom
 
 #endif  // VENDORS_CIRCOM_CIRCOMLIB_JSON_JSON_CONVERTER_FORWARD_H_
@@ -0,0 +1,87 @@
+#include "circomlib/json/json.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "circomlib/json/groth16_proof.h"
+#include "circomlib/json/prime_field.h"
+#include "tachyon/base/buffer/read_only_buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+
+namespace tachyon::circom {
+
+namespace {
+
+using Curve = math::bn254::BN254Curve;
+using F = math::bn254::Fr;
+
+class JsonTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Curve::Init(); }
+
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+ protected:
+  // Checks that the json streamed to the file is the same as the one built
+  // with |ConvertToJson()|.
+  template <typename T>
+  void TestWriteToJson(const T& value) {
+    base::FilePath path = temp_dir_.GetPath().Append("value.json");
+    ASSERT_TRUE(WriteToJson(value, path));
+
+    std::string content;
+    ASSERT_TRUE(base::ReadFileToString(path, &content));
+    rapidjson::Document document;
+    document.Parse(content.data(), content.size());
+    ASSERT_FALSE(document.HasParseError());
+    EXPECT_TRUE(document == ConvertToJson(value));
+  }
+
+  base::ScopedTempDir temp_dir_;
+};
+
+}  // namespace
+
+TEST_F(JsonTest, WriteToJson) {
+  std::vector<F> public_inputs =
+      base::CreateVector(8, []() { return F::Random(); });
+  TestWriteToJson(absl::MakeConstSpan(public_inputs));
+
+  zk::r1cs::groth16::Proof<Curve> proof(math::bn254::G1AffinePoint::Random(),
+                                        math::bn254::G2AffinePoint::Random(),
+                                        math::bn254::G1AffinePoint::Random());
+  TestWriteToJson(proof);
+}
+
+TEST_F(JsonTest, WriteToBinary) {
+  std::vector<F> public_inputs =
+      base::CreateVector(8, []() { return F::Random(); });
+  zk::r1cs::groth16::Proof<Curve> proof(math::bn254::G1AffinePoint::Random(),
+                                        math::bn254::G2AffinePoint::Random(),
+                                        math::bn254::G1AffinePoint::Random());
+  base::FilePath public_path = temp_dir_.GetPath().Append("public.bin");
+  base::FilePath proof_path = temp_dir_.GetPath().Append("proof.bin");
+  ASSERT_TRUE(WriteToBinary(absl::MakeConstSpan(public_inputs), public_path));
+  ASSERT_TRUE(WriteToBinary(proof, proof_path));
+
+  std::optional<std::vector<uint8_t>> bytes =
+      base::ReadFileToBytes(public_path);
+  ASSERT_TRUE(bytes.has_value());
+  std::vector<F> public_inputs2;
+  ASSERT_TRUE(base::ReadOnlyBuffer(bytes->data(), bytes->size())
+                  .Read(&public_inputs2));
+  EXPECT_EQ(public_inputs2, public_inputs);
+
+  bytes = base::ReadFileToBytes(proof_path);
+  ASSERT_TRUE(bytes.has_value());
+  zk::r1cs::groth16::Proof<Curve> proof2;
+  ASSERT_TRUE(base::ReadOnlyBuffer(bytes->data(), bytes->size()).Read(&proof2));
+  EXPECT_EQ(proof2, proof);
+}
+
+}  // namespace tachyon::circom
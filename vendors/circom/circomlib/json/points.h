@@ -5,6 +5,7 @@
 
 #include "rapidjson/document.h"
 
+#include "circomlib/json/decimal.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 
 namespace tachyon::circom::internal {
@@ -51,6 +52,38 @@ void AddMember(rapidjson::Document& document, std::string_view member,
                      document.GetAllocator());
 }
 
+// Same as |AddMember()|, but writes |point| to |writer|.
+template <typename Curve, typename Writer>
+bool WriteMember(Writer& writer, std::string_view member,
+                 const math::AffinePoint<Curve>& point) {
+  using BaseField = typename math::AffinePoint<Curve>::BaseField;
+
+  const BaseField& x = point.x();
+  const BaseField& y = point.y();
+  if (!writer.Key(member.data(), member.size())) return false;
+  if (!writer.StartArray()) return false;
+  if constexpr (BaseField::ExtensionDegree() == 1) {
+    if (!WriteDecimalString(x, writer)) return false;
+    if (!WriteDecimalString(y, writer)) return false;
+    if (!writer.String("1")) return false;
+  } else {
+    static_assert(BaseField::ExtensionDegree() == 2);
+    if (!writer.StartArray()) return false;
+    if (!WriteDecimalString(x.c0(), writer)) return false;
+    if (!WriteDecimalString(x.c1(), writer)) return false;
+    if (!writer.EndArray()) return false;
+    if (!writer.StartArray()) return false;
+    if (!WriteDecimalString(y.c0(), writer)) return false;
+    if (!WriteDecimalString(y.c1(), writer)) return false;
+    if (!writer.EndArray()) return false;
+    if (!writer.StartArray()) return false;
+    if (!writer.String("1")) return false;
+    if (!writer.String("0")) return false;
+    if (!writer.EndArray()) return false;
+  }
+  return writer.EndArray();
+}
+
 }  // namespace tachyon::circom::internal
 
 #endif  // VENDORS_CIRCOM_CIRCOMLIB_JSON_POINTS_H_
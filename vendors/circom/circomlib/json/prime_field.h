@@ -5,6 +5,7 @@
 
 #include "absl/types/span.h"
 
+#include "circomlib/json/decimal.h"
 #include "circomlib/json/json_converter_forward.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
 
@@ -28,6 +29,15 @@ class JsonSerializer<
 
     return document;
   }
+
+  template <typename Writer>
+  static bool Write(absl::Span<const F> prime_fields, Writer& writer) {
+    if (!writer.StartArray()) return false;
+    for (const F& prime_field : prime_fields) {
+      if (!WriteDecimalString(prime_field, writer)) return false;
+    }
+    return writer.EndArray();
+  }
 };
 
 }  // namespace tachyon::circom
@@ -6,7 +6,6 @@
 #include <string.h>
 
 #include <memory>
-#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,7 +15,7 @@
 #include "circomlib/r1cs/constraint.h"
 #include "tachyon/base/buffer/endian_auto_reset.h"
 #include "tachyon/base/buffer/read_only_buffer.h"
-#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/strings/string_util.h"
 
@@ -49,13 +48,14 @@ constexpr char kR1CSMagic[4] = {'r', '1', 'c', 's'};
 // Return nullptr if the parser failed to parse.
 template <typename F>
 std::unique_ptr<R1CS<F>> ParseR1CS(const base::FilePath& path) {
-  std::optional<std::vector<uint8_t>> r1cs_data = base::ReadFileToBytes(path);
-  if (!r1cs_data.has_value()) {
-    LOG(ERROR) << "Failed to read file: " << path.value();
+  base::MemoryMappedFile r1cs_file;
+  if (!r1cs_file.Initialize(path,
+                            base::MemoryMappedFile::Access::kSequential)) {
+    LOG(ERROR) << "Failed to map file: " << path.value();
     return nullptr;
   }
 
-  base::ReadOnlyBuffer buffer(r1cs_data->data(), r1cs_data->size());
+  base::ReadOnlyBuffer buffer = r1cs_file.ToBuffer();
   buffer.set_endian(base::Endian::kLittle);
   char magic[4];
   uint32_t version;
@@ -0,0 +1,167 @@
+#ifndef VENDORS_CIRCOM_CIRCOMLIB_R1CS_R1CS_MATRICES_H_
+#define VENDORS_CIRCOM_CIRCOMLIB_R1CS_R1CS_MATRICES_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "circomlib/base/sections.h"
+#include "circomlib/r1cs/r1cs.h"
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/buffer/read_only_buffer.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/matrix/sparse/sparse_matrix.h"
+
+namespace tachyon::circom {
+
+// The A, B and C matrices of an r1cs file in the CSR layout. Unlike
+// |ParseR1CS()|, |ParseR1CSMatrices()| doesn't allocate vectors of terms for
+// each constraint, so it is preferred for large circuits.
+template <typename F>
+struct R1CSMatrices {
+  v1::R1CSHeaderSection header;
+  math::CSRSparseMatrix<F> a;
+  math::CSRSparseMatrix<F> b;
+  math::CSRSparseMatrix<F> c;
+
+  size_t GetNumInstanceVariables() const {
+    return 1 + header.num_public_outputs + header.num_public_inputs;
+  }
+
+  size_t GetNumVariables() const { return header.num_wires; }
+};
+
+namespace internal {
+
+// Scans the constraints from the current offset of |buffer| once to find
+// where each of them starts and how many terms each linear combination has,
+// skipping the terms. |row_ptrs| are populated with the row pointers of the
+// A, B and C matrices.
+inline bool ScanR1CSConstraints(const base::ReadOnlyBuffer& buffer,
+                                uint32_t num_constraints, size_t term_size,
+                                std::vector<size_t>* offsets,
+                                std::array<std::vector<size_t>, 3>* row_ptrs) {
+  offsets->resize(num_constraints);
+  for (std::vector<size_t>& ptrs : *row_ptrs) {
+    ptrs.resize(size_t{num_constraints} + 1);
+    ptrs[0] = 0;
+  }
+  for (uint32_t i = 0; i < num_constraints; ++i) {
+    (*offsets)[i] = buffer.buffer_offset();
+    for (size_t j = 0; j < 3; ++j) {
+      uint32_t n;
+      if (!buffer.Read(&n)) return false;
+      size_t next = buffer.buffer_offset() + size_t{n} * term_size;
+      if (next > buffer.buffer_len()) {
+        LOG(ERROR) << "Not enough bytes to read constraint " << i;
+        return false;
+      }
+      buffer.set_buffer_offset(next);
+      (*row_ptrs)[j][i + 1] = (*row_ptrs)[j][i] + n;
+    }
+  }
+  return true;
+}
+
+}  // namespace internal
+
+// Returns std::nullopt if the parser failed to parse.
+//
+// NOTE: The constraints are scanned once to find their offsets, since they
+// are of variable length. They are then parsed in parallel straight into the
+// elements of the CSR matrices.
+template <typename F>
+std::optional<R1CSMatrices<F>> ParseR1CSMatrices(const base::FilePath& path) {
+  using Elements = typename math::CSRSparseMatrix<F>::Elements;
+
+  base::MemoryMappedFile r1cs_file;
+  if (!r1cs_file.Initialize(path)) {
+    LOG(ERROR) << "Failed to map file: " << path.value();
+    return std::nullopt;
+  }
+
+  base::ReadOnlyBuffer buffer = r1cs_file.ToBuffer();
+  buffer.set_endian(base::Endian::kLittle);
+  char magic[4];
+  uint32_t version;
+  if (!buffer.ReadMany(magic, &version)) return std::nullopt;
+  if (memcmp(magic, kR1CSMagic, 4) != 0) {
+    LOG(ERROR) << "Invalid magic: " << magic;
+    return std::nullopt;
+  }
+  if (version != 1) {
+    LOG(ERROR) << "Invalid version: " << version;
+    return std::nullopt;
+  }
+
+  Sections<v1::R1CSSectionType> sections(buffer,
+                                         &v1::R1CSSectionTypeToString);
+  if (!sections.Read()) return std::nullopt;
+
+  R1CSMatrices<F> matrices;
+  if (!sections.MoveTo(v1::R1CSSectionType::kHeader)) return std::nullopt;
+  if (!matrices.header.Read(buffer)) return std::nullopt;
+
+  if (!sections.MoveTo(v1::R1CSSectionType::kConstraints)) return std::nullopt;
+  size_t term_size = sizeof(uint32_t) + base::EstimateSize(F());
+  std::vector<size_t> offsets;
+  std::array<std::vector<size_t>, 3> row_ptrs;
+  if (!internal::ScanR1CSConstraints(buffer, matrices.header.num_constraints,
+                                     term_size, &offsets, &row_ptrs)) {
+    return std::nullopt;
+  }
+
+  std::array<Elements, 3> elements;
+  for (size_t j = 0; j < 3; ++j) {
+    elements[j].resize(row_ptrs[j].back());
+  }
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(buffer.buffer());
+  size_t len = buffer.buffer_len();
+  std::atomic<bool> failed(false);
+  base::Parallelize(
+      offsets, [data, len, &row_ptrs, &elements, &failed](
+                   absl::Span<const size_t> chunk, size_t chunk_index,
+                   size_t chunk_size) {
+        base::ReadOnlyBuffer chunk_buffer(data, len);
+        chunk_buffer.set_endian(base::Endian::kLittle);
+        for (size_t i = 0; i < chunk.size(); ++i) {
+          size_t row = chunk_index * chunk_size + i;
+          chunk_buffer.set_buffer_offset(chunk[i]);
+          for (size_t j = 0; j < 3; ++j) {
+            uint32_t n;
+            if (!chunk_buffer.Read(&n)) {
+              failed.store(true, std::memory_order_relaxed);
+              return;
+            }
+            for (size_t k = row_ptrs[j][row]; k < row_ptrs[j][row + 1]; ++k) {
+              uint32_t wire_id;
+              if (!chunk_buffer.ReadMany(&wire_id, &elements[j][k].value)) {
+                failed.store(true, std::memory_order_relaxed);
+                return;
+              }
+              elements[j][k].index = wire_id;
+            }
+          }
+        }
+      });
+  if (failed.load(std::memory_order_relaxed)) return std::nullopt;
+
+  matrices.a = {std::move(elements[0]), std::move(row_ptrs[0])};
+  matrices.b = {std::move(elements[1]), std::move(row_ptrs[1])};
+  matrices.c = {std::move(elements[2]), std::move(row_ptrs[2])};
+  return matrices;
+}
+
+}  // namespace tachyon::circom
+
+#endif  // VENDORS_CIRCOM_CIRCOMLIB_R1CS_R1CS_MATRICES_H_
@@ -1,9 +1,11 @@
 #include "circomlib/r1cs/r1cs.h"
 
+#include <optional>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "circomlib/r1cs/r1cs_matrices.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
 
@@ -62,4 +64,45 @@ TEST(R1CSTest, Parse) {
             expected_wire_id_to_label_id_map);
 }
 
+TEST(R1CSTest, ParseMatrices) {
+  std::unique_ptr<R1CS<F>> r1cs =
+      ParseR1CS<F>(base::FilePath("examples/multiplier_3.r1cs"));
+  ASSERT_TRUE(r1cs);
+  std::optional<R1CSMatrices<F>> matrices =
+      ParseR1CSMatrices<F>(base::FilePath("examples/multiplier_3.r1cs"));
+  ASSERT_TRUE(matrices.has_value());
+
+  EXPECT_EQ(matrices->header, r1cs->ToV1()->header);
+  EXPECT_EQ(matrices->GetNumInstanceVariables(),
+            r1cs->GetNumInstanceVariables());
+  EXPECT_EQ(matrices->GetNumVariables(), r1cs->GetNumVariables());
+
+  const std::vector<Constraint<F>>& constraints = r1cs->GetConstraints();
+  auto expect_matrix = [&constraints](const math::CSRSparseMatrix<F>& matrix,
+                                      auto get_lc) {
+    ASSERT_EQ(matrix.MaxRows(), constraints.size());
+    for (size_t i = 0; i < constraints.size(); ++i) {
+      const std::vector<Term<F>>& terms = get_lc(constraints[i]).terms;
+      size_t begin = matrix.row_ptrs()[i];
+      ASSERT_EQ(matrix.row_ptrs()[i + 1] - begin, terms.size());
+      for (size_t j = 0; j < terms.size(); ++j) {
+        EXPECT_EQ(matrix.elements()[begin + j].index, terms[j].wire_id);
+        EXPECT_EQ(matrix.elements()[begin + j].value, terms[j].coefficient);
+      }
+    }
+  };
+  expect_matrix(matrices->a,
+                [](const Constraint<F>& c) -> const LinearCombination<F>& {
+                  return c.a;
+                });
+  expect_matrix(matrices->b,
+                [](const Constraint<F>& c) -> const LinearCombination<F>& {
+                  return c.b;
+                });
+  expect_matrix(matrices->c,
+                [](const Constraint<F>& c) -> const LinearCombination<F>& {
+                  return c.c;
+                });
+}
+
 }  // namespace tachyon::circom
@@ -6,7 +6,6 @@
 #include <string.h>
 
 #include <memory>
-#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,7 +14,7 @@
 #include "circomlib/base/sections.h"
 #include "tachyon/base/buffer/endian_auto_reset.h"
 #include "tachyon/base/buffer/read_only_buffer.h"
-#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/strings/string_util.h"
 
@@ -47,13 +46,17 @@ constexpr char kWtnsMagic[4] = {'w', 't', 'n', 's'};
 // Return nullptr if the parser failed to parse.
 template <typename F>
 std::unique_ptr<Wtns<F>> ParseWtns(const base::FilePath& path) {
-  std::optional<std::vector<uint8_t>> wtns_data = base::ReadFileToBytes(path);
-  if (!wtns_data.has_value()) {
-    LOG(ERROR) << "Failed to read file: " << path.value();
+  base::MemoryMappedFile wtns_file;
+  if (!wtns_file.Initialize(path,
+                            base::MemoryMappedFile::Access::kSequential)) {
+    LOG(ERROR) << "Failed to map file: " << path.value();
     return nullptr;
   }
+  // NOTE: Every section is converted, so the whole file is read ahead while
+  // the header is parsed.
+  wtns_file.WillNeed(0, wtns_file.length());
 
-  base::ReadOnlyBuffer buffer(wtns_data->data(), wtns_data->size());
+  base::ReadOnlyBuffer buffer = wtns_file.ToBuffer();
   buffer.set_endian(base::Endian::kLittle);
   char magic[4];
   uint32_t version;
@@ -119,11 +122,7 @@ struct WtnsDataSection {
   bool Read(const base::ReadOnlyBuffer& buffer,
             const WtnsHeaderSection& header) {
     base::EndianAutoReset reset(buffer, base::Endian::kLittle);
-    witnesses.resize(header.num_witness);
-    for (uint32_t i = 0; i < header.num_witness; ++i) {
-      if (!buffer.Read(&witnesses[i])) return false;
-    }
-    return true;
+    return ReadElementsInParallel(buffer, header.num_witness, &witnesses);
   }
 
   std::string ToString() const { return base::ContainerToString(witnesses); }
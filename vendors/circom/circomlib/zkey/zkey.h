@@ -5,7 +5,6 @@
 
 #include <algorithm>
 #include <memory>
-#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -17,9 +16,10 @@
 #include "tachyon/base/auto_reset.h"
 #include "tachyon/base/buffer/endian_auto_reset.h"
 #include "tachyon/base/buffer/read_only_buffer.h"
-#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/strings/string_util.h"
+#include "tachyon/math/elliptic_curves/pairing/point_validation.h"
 
 namespace tachyon::circom {
 namespace v1 {
@@ -41,22 +41,37 @@ struct ZKey {
 
   virtual bool Read(const base::ReadOnlyBuffer& buffer) = 0;
 
+  // Returns true if every point read by |Read()| passes |validation|.
+  [[nodiscard]] virtual bool ValidatePoints(
+      math::PointValidation validation) const = 0;
+
   virtual ProvingKey<Curve> TakeProvingKey() && = 0;
   virtual ConstraintMatrices<F> TakeConstraintMatrices() && = 0;
 };
 
 constexpr char kZkeyMagic[4] = {'z', 'k', 'e', 'y'};
 
-// Return nullptr if the parser failed to parse.
+// Return nullptr if the parser failed to parse or if any of the points
+// doesn't pass |validation|. A zkey from an untrusted source should be parsed
+// with |math::PointValidation::kSubgroup|.
 template <typename Curve>
-std::unique_ptr<ZKey<Curve>> ParseZKey(const base::FilePath& path) {
-  std::optional<std::vector<uint8_t>> zkey_data = base::ReadFileToBytes(path);
-  if (!zkey_data.has_value()) {
-    LOG(ERROR) << "Failed to read file: " << path.value();
+std::unique_ptr<ZKey<Curve>> ParseZKey(
+    const base::FilePath& path,
+    math::PointValidation validation = math::PointValidation::kNone) {
+  // NOTE: The file is mapped rather than read into memory, so that the
+  // sections are converted straight from the mapping without holding a second
+  // copy of a zkey that can take several GBs.
+  base::MemoryMappedFile zkey_file;
+  if (!zkey_file.Initialize(path,
+                            base::MemoryMappedFile::Access::kSequential)) {
+    LOG(ERROR) << "Failed to map file: " << path.value();
     return nullptr;
   }
+  // NOTE: Every section is converted, so the whole file is read ahead while
+  // the header is parsed.
+  zkey_file.WillNeed(0, zkey_file.length());
 
-  base::ReadOnlyBuffer buffer(zkey_data->data(), zkey_data->size());
+  base::ReadOnlyBuffer buffer = zkey_file.ToBuffer();
   buffer.set_endian(base::Endian::kLittle);
   char magic[4];
   uint32_t version;
@@ -73,6 +88,10 @@ std::unique_ptr<ZKey<Curve>> ParseZKey(const base::FilePath& path) {
     LOG(ERROR) << "Invalid version: " << version;
     return nullptr;
   }
+  if (!zkey->ValidatePoints(validation)) {
+    LOG(ERROR) << "Invalid points in zkey: " << path.value();
+    return nullptr;
+  }
   return zkey;
 }
 
@@ -164,11 +183,7 @@ struct CommitmentsSection {
   }
 
   bool Read(const base::ReadOnlyBuffer& buffer, uint32_t num_commitments) {
-    commitments.resize(num_commitments);
-    for (uint32_t i = 0; i < num_commitments; ++i) {
-      if (!buffer.Read(&commitments[i])) return false;
-    }
-    return true;
+    return ReadElementsInParallel(buffer, num_commitments, &commitments);
   }
 
   // NOTE(chokobole): the fields are represented in montgomery form.
@@ -293,6 +308,20 @@ struct ZKey : public circom::ZKey<Curve> {
     return true;
   }
 
+  bool ValidatePoints(math::PointValidation validation) const override {
+    const VerifyingKey<Curve>& vkey = header_groth.vkey;
+    G1AffinePoint vkey_g1s[] = {vkey.alpha_g1, vkey.beta_g1, vkey.delta_g1};
+    G2AffinePoint vkey_g2s[] = {vkey.beta_g2, vkey.gamma_g2, vkey.delta_g2};
+    return math::ValidateG1Points<Curve>(vkey_g1s, validation) &&
+           math::ValidateG2Points<Curve>(vkey_g2s, validation) &&
+           math::ValidateG1Points<Curve>(ic.commitments, validation) &&
+           math::ValidateG1Points<Curve>(points_a1.commitments, validation) &&
+           math::ValidateG1Points<Curve>(points_b1.commitments, validation) &&
+           math::ValidateG2Points<Curve>(points_b2.commitments, validation) &&
+           math::ValidateG1Points<Curve>(points_c1.commitments, validation) &&
+           math::ValidateG1Points<Curve>(points_h1.commitments, validation);
+  }
+
   ProvingKey<Curve> TakeProvingKey() && override {
     return {
         std::move(header_groth.vkey),     std::move(ic.commitments),
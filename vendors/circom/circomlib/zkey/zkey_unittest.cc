@@ -1,5 +1,6 @@
 #include "circomlib/zkey/zkey.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -352,4 +353,21 @@ TEST_F(ZKeyTest, Parse) {
   EXPECT_EQ(v1_zkey->points_h1, expected_points_h1);
 }
 
+TEST_F(ZKeyTest, ValidatePoints) {
+  std::unique_ptr<ZKey<Curve>> zkey = ParseZKey<Curve>(
+      base::FilePath("examples/multiplier_3.zkey"),
+      math::PointValidation::kSubgroup);
+  ASSERT_TRUE(zkey);
+
+  v1::ZKey<Curve>* v1_zkey = zkey->ToV1();
+  std::vector<G2AffinePoint>& points_b2 = v1_zkey->points_b2.commitments;
+  auto it = std::find_if(
+      points_b2.begin(), points_b2.end(),
+      [](const G2AffinePoint& point) { return !point.IsZero(); });
+  ASSERT_NE(it, points_b2.end());
+  *it = G2AffinePoint(it->x(), it->y().Double());
+  EXPECT_TRUE(zkey->ValidatePoints(math::PointValidation::kNone));
+  EXPECT_FALSE(zkey->ValidatePoints(math::PointValidation::kOnCurve));
+}
+
 }  // namespace tachyon::circom
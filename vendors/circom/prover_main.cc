@@ -1,3 +1,6 @@
+#include <limits>
+#include <type_traits>
+
 #include "circomlib/circuit/quadratic_arithmetic_program.h"
 #include "circomlib/json/groth16_proof.h"
 #include "circomlib/json/json.h"
@@ -7,12 +10,24 @@
 #include "tachyon/base/console/iostream.h"
 #include "tachyon/base/files/file_path_flag.h"
 #include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/memory/numa.h"
+#include "tachyon/base/threading/thread_pool.h"
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/bls12_381.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/zk/r1cs/groth16/precomputed_queries.h"
 #include "tachyon/zk/r1cs/groth16/prove.h"
 #include "tachyon/zk/r1cs/groth16/verify.h"
 
+#if TACHYON_CUDA
+#include "tachyon/device/gpu/scoped_mem_pool.h"
+#include "tachyon/device/gpu/scoped_stream.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1_gpu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/bellman/bn254_bellman_msm_kernels.cu.h"
+#include "tachyon/math/elliptic_curves/msm/kernels/cuzk/bn254_cuzk_kernels.cu.h"
+#include "tachyon/zk/r1cs/groth16/prove_gpu.h"
+#endif
+
 namespace tachyon {
 
 enum class Curve {
@@ -39,15 +54,87 @@ class FlagValueTraits<Curve> {
   }
 };
 
+template <>
+class FlagValueTraits<NumaPolicy> {
+ public:
+  static bool ParseValue(std::string_view input, NumaPolicy* value,
+                         std::string* reason) {
+    if (input == "default") {
+      *value = NumaPolicy::kDefault;
+    } else if (input == "interleave") {
+      *value = NumaPolicy::kInterleave;
+    } else if (input == "partition") {
+      *value = NumaPolicy::kPartition;
+    } else {
+      *reason = absl::Substitute("Unknown numa policy: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
+template <>
+class FlagValueTraits<ThreadAffinity> {
+ public:
+  static bool ParseValue(std::string_view input, ThreadAffinity* value,
+                         std::string* reason) {
+    if (input == "none") {
+      *value = ThreadAffinity::kNone;
+    } else if (input == "compact") {
+      *value = ThreadAffinity::kCompact;
+    } else if (input == "spread") {
+      *value = ThreadAffinity::kSpread;
+    } else {
+      *reason = absl::Substitute("Unknown thread affinity: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
 }  // namespace base
 
 namespace circom {
 
+#if TACHYON_CUDA
+template <typename Curve, typename G1CurveGpu>
+zk::r1cs::groth16::Proof<Curve> CreateProofGpu(
+    const zk::r1cs::groth16::ProvingKey<Curve>& proving_key,
+    absl::Span<const typename Curve::G1Curve::ScalarField> h_evals,
+    absl::Span<const typename Curve::G1Curve::ScalarField> instance_assignments,
+    absl::Span<const typename Curve::G1Curve::ScalarField> witness_assignments,
+    absl::Span<const typename Curve::G1Curve::ScalarField> full_assignments,
+    bool no_zk) {
+  gpuMemPoolProps props = {gpuMemAllocationTypePinned,
+                           gpuMemHandleTypeNone,
+                           {gpuMemLocationTypeDevice, 0}};
+  device::gpu::ScopedMemPool mem_pool = device::gpu::CreateMemPool(&props);
+  uint64_t mem_pool_threshold = std::numeric_limits<uint64_t>::max();
+  GPU_MUST_SUCCESS(
+      gpuMemPoolSetAttribute(mem_pool.get(), gpuMemPoolAttrReleaseThreshold,
+                             &mem_pool_threshold),
+      "Failed to gpuMemPoolSetAttribute()");
+  device::gpu::ScopedStream stream = device::gpu::CreateStream();
+
+  zk::r1cs::groth16::ProverGpu<Curve, G1CurveGpu> prover(
+      proving_key, math::MSMAlgorithmKind::kBellmanMSM, mem_pool.get(),
+      stream.get());
+  if (no_zk) {
+    return prover.CreateProofWithAssignmentNoZK(
+        h_evals, instance_assignments, witness_assignments, full_assignments);
+  }
+  return prover.CreateProofWithAssignmentZK(
+      h_evals, instance_assignments, witness_assignments, full_assignments);
+}
+#endif
+
 template <typename Curve>
 void CreateProof(const base::FilePath& zkey_path,
                  const base::FilePath& witness_path,
                  const base::FilePath& proof_path,
-                 const base::FilePath& public_path, bool no_zk, bool verify) {
+                 const base::FilePath& public_path,
+                 const base::FilePath& precomputed_path, bool no_zk,
+                 bool verify, bool gpu, bool validate_points, bool binary) {
   using F = typename Curve::G1Curve::ScalarField;
   using Domain = math::UnivariateEvaluationDomain<F, SIZE_MAX>;
 
@@ -56,7 +143,9 @@ void CreateProof(const base::FilePath& zkey_path,
   zk::r1cs::groth16::ProvingKey<Curve> proving_key;
   zk::r1cs::ConstraintMatrices<F> constraint_matrices;
   {
-    std::unique_ptr<ZKey<Curve>> zkey = ParseZKey<Curve>(zkey_path);
+    std::unique_ptr<ZKey<Curve>> zkey = ParseZKey<Curve>(
+        zkey_path, validate_points ? math::PointValidation::kSubgroup
+                                   : math::PointValidation::kNone);
     CHECK(zkey);
 
     proving_key = std::move(*zkey).TakeProvingKey().ToNativeProvingKey();
@@ -76,7 +165,32 @@ void CreateProof(const base::FilePath& zkey_path,
           domain.get(), constraint_matrices, full_assignments);
 
   zk::r1cs::groth16::Proof<Curve> proof;
-  if (no_zk) {
+  if (gpu) {
+#if TACHYON_CUDA
+    if constexpr (std::is_same_v<Curve, math::bn254::BN254Curve>) {
+      proof = CreateProofGpu<Curve, math::bn254::G1CurveGpu>(
+          proving_key, absl::MakeConstSpan(h_evals),
+          full_assignments.subspan(
+              1, constraint_matrices.num_instance_variables - 1),
+          full_assignments.subspan(constraint_matrices.num_instance_variables),
+          full_assignments.subspan(1), no_zk);
+    } else {
+      NOTREACHED() << "--gpu is only supported for bn254";
+    }
+#else
+    NOTREACHED() << "--gpu requires a build with --config cuda";
+#endif
+  } else if (!precomputed_path.empty()) {
+    zk::r1cs::groth16::PrecomputedQueries<Curve> precomputed;
+    CHECK(precomputed.LoadOrPrecompute(proving_key, precomputed_path));
+    proof = zk::r1cs::groth16::CreateProofWithAssignment(
+        proving_key, precomputed, no_zk ? F::Zero() : F::Random(),
+        no_zk ? F::Zero() : F::Random(), absl::MakeConstSpan(h_evals),
+        full_assignments.subspan(
+            1, constraint_matrices.num_instance_variables - 1),
+        full_assignments.subspan(constraint_matrices.num_instance_variables),
+        full_assignments.subspan(1));
+  } else if (no_zk) {
     proof = zk::r1cs::groth16::CreateProofWithAssignmentNoZK(
         proving_key, absl::MakeConstSpan(h_evals),
         full_assignments.subspan(
@@ -101,8 +215,13 @@ void CreateProof(const base::FilePath& zkey_path,
                                          public_inputs));
   }
 
-  CHECK(WriteToJson(proof, proof_path));
-  CHECK(WriteToJson(public_inputs, public_path));
+  if (binary) {
+    CHECK(WriteToBinary(proof, proof_path));
+    CHECK(WriteToBinary(public_inputs, public_path));
+  } else {
+    CHECK(WriteToJson(proof, proof_path));
+    CHECK(WriteToJson(public_inputs, public_path));
+  }
 }
 
 }  // namespace circom
@@ -113,9 +232,15 @@ int RealMain(int argc, char** argv) {
   base::FilePath witness_path;
   base::FilePath proof_path;
   base::FilePath public_path;
+  base::FilePath precomputed_path;
   Curve curve;
   bool no_zk = false;
   bool verify = false;
+  bool gpu = false;
+  bool validate_points = false;
+  bool binary = false;
+  base::NumaPolicy numa_policy = base::NumaPolicy::kDefault;
+  base::ThreadAffinity thread_affinity = base::ThreadAffinity::kNone;
   parser.AddFlag<base::FilePathFlag>(&zkey_path)
       .set_name("zkey")
       .set_help("The path to zkey file");
@@ -128,6 +253,12 @@ int RealMain(int argc, char** argv) {
   parser.AddFlag<base::FilePathFlag>(&public_path)
       .set_name("public")
       .set_help("The path to public json");
+  parser.AddFlag<base::FilePathFlag>(&precomputed_path)
+      .set_long_name("--precomputed")
+      .set_help(
+          "The path to the precomputed tables of the proving key. They are "
+          "loaded if the file is built from the zkey. Otherwise, they are "
+          "built and saved to the path so that the next runs can reuse them.");
   parser.AddFlag<base::Flag<Curve>>(&curve).set_long_name("--curve").set_help(
       "The curve type among ('bn254', bls12_381'), by default 'bn254'");
   parser.AddFlag<base::BoolFlag>(&no_zk).set_long_name("--no_zk").set_help(
@@ -138,21 +269,69 @@ int RealMain(int argc, char** argv) {
       .set_help(
           "Verify the proof. By default verify is disabled. Use this flag "
           "to verify the proof with the public inputs.");
+  parser.AddFlag<base::BoolFlag>(&gpu).set_long_name("--gpu").set_help(
+      "Run the G1 MSMs on the GPU. By default the proof is created on the CPU. "
+      "Only 'bn254' is supported and the binary must be built with "
+      "'--config cuda'.");
+  parser.AddFlag<base::BoolFlag>(&validate_points)
+      .set_long_name("--validate_points")
+      .set_help(
+          "Check that every point of the zkey is on the curve and in the "
+          "subgroup. By default the zkey is trusted. Use this flag to load a "
+          "zkey from an untrusted source.");
+  parser.AddFlag<base::BoolFlag>(&binary)
+      .set_long_name("--binary")
+      .set_help(
+          "Write the proof and the public inputs in the binary format of "
+          "tachyon instead of json. It is faster but not readable by "
+          "snarkjs.");
+  parser.AddFlag<base::Flag<base::NumaPolicy>>(&numa_policy)
+      .set_long_name("--numa_policy")
+      .set_help(
+          "How the polynomials and the proving key columns are placed over "
+          "the NUMA nodes among ('default', 'interleave', 'partition'), by "
+          "default 'default'");
+  parser.AddFlag<base::Flag<base::ThreadAffinity>>(&thread_affinity)
+      .set_long_name("--thread_affinity")
+      .set_help(
+          "Which CPUs the worker threads are pinned to among ('none', "
+          "'compact', 'spread'), by default 'none'");
 
   std::string error;
   if (!parser.Parse(argc, argv, &error)) {
     tachyon_cerr << error << std::endl;
     return 1;
   }
+#if TACHYON_CUDA
+  if (gpu && curve != Curve::kBN254) {
+    tachyon_cerr << "--gpu is only supported for bn254" << std::endl;
+    return 1;
+  }
+#else
+  if (gpu) {
+    tachyon_cerr << "please build with --config cuda to use --gpu"
+                 << std::endl;
+    return 1;
+  }
+#endif
+  if (gpu && !precomputed_path.empty()) {
+    tachyon_cerr << "--precomputed can't be used with --gpu" << std::endl;
+    return 1;
+  }
+
+  base::SetNumaPolicy(numa_policy);
+  base::ThreadPool::SetDefaultAffinity(thread_affinity);
 
   switch (curve) {
     case Curve::kBN254:
       circom::CreateProof<math::bn254::BN254Curve>(
-          zkey_path, witness_path, proof_path, public_path, no_zk, verify);
+          zkey_path, witness_path, proof_path, public_path, precomputed_path,
+          no_zk, verify, gpu, validate_points, binary);
       break;
     case Curve::kBLS12_381:
       circom::CreateProof<math::bls12_381::BLS12_381Curve>(
-          zkey_path, witness_path, proof_path, public_path, no_zk, verify);
+          zkey_path, witness_path, proof_path, public_path, precomputed_path,
+          no_zk, verify, gpu, validate_points, binary);
       break;
   }
   return 0;
@@ -0,0 +1,249 @@
+#include <stddef.h>
+
+#include <future>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_split.h"
+
+#include "circomlib/circuit/quadratic_arithmetic_program.h"
+#include "circomlib/json/groth16_proof.h"
+#include "circomlib/json/json.h"
+#include "circomlib/json/prime_field.h"
+#include "circomlib/wtns/wtns.h"
+#include "circomlib/zkey/zkey.h"
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/files/file_path_flag.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/bls12_381.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/zk/r1cs/groth16/prove.h"
+#include "tachyon/zk/r1cs/groth16/verify.h"
+
+namespace tachyon {
+
+enum class Curve {
+  kBN254,
+  kBLS12_381,
+};
+
+namespace base {
+
+template <>
+class FlagValueTraits<Curve> {
+ public:
+  static bool ParseValue(std::string_view input, Curve* value,
+                         std::string* reason) {
+    if (input == "bn254") {
+      *value = Curve::kBN254;
+    } else if (input == "bls12_381") {
+      *value = Curve::kBLS12_381;
+    } else {
+      *reason = absl::Substitute("Unknown curve: $0", input);
+      return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace base
+
+namespace circom {
+
+// Loads a zkey once and creates a proof for each request read from |in|. A
+// request is a line of "<wtns> <proof> <public>" paths, and the server exits at
+// the end of |in|. The witness of the
+// next request is parsed while the current one is being proved. For each
+// request, "ok <proof>" or "error <wtns>" is written to stdout once it is
+// done.
+template <typename Curve>
+class ProverServer {
+ public:
+  using F = typename Curve::G1Curve::ScalarField;
+  using Domain = math::UnivariateEvaluationDomain<F, SIZE_MAX>;
+  using CSRMatrices = typename QuadraticArithmeticProgram<F>::CSRMatrices;
+
+  ProverServer(const base::FilePath& zkey_path, bool no_zk, bool verify,
+               bool binary)
+      : no_zk_(no_zk), verify_(verify), binary_(binary) {
+    std::unique_ptr<ZKey<Curve>> zkey = ParseZKey<Curve>(zkey_path);
+    CHECK(zkey);
+
+    proving_key_ = std::move(*zkey).TakeProvingKey().ToNativeProvingKey();
+    constraint_matrices_ = std::move(*zkey).TakeConstraintMatrices().ToNative();
+    csr_matrices_ = CSRMatrices::From(constraint_matrices_);
+    // NOTE: The verifying key is copied, since |proving_key_| is used for
+    // every proof.
+    prepared_verifying_key_ =
+        zk::r1cs::groth16::VerifyingKey<Curve>(proving_key_.verifying_key())
+            .ToPreparedVerifyingKey();
+    domain_ = Domain::Create(constraint_matrices_.num_constraints +
+                             constraint_matrices_.num_instance_variables);
+  }
+
+  void Serve(std::istream& in) {
+    std::future<std::optional<Request>> next_request =
+        std::async(std::launch::async, [&in]() { return ReadRequest(in); });
+    while (true) {
+      std::optional<Request> request = next_request.get();
+      if (!request.has_value()) break;
+      next_request =
+          std::async(std::launch::async, [&in]() { return ReadRequest(in); });
+
+      if (request->wtns && Prove(*request)) {
+        std::cout << "ok " << request->proof_path.value() << std::endl;
+      } else {
+        std::cout << "error " << request->wtns_path.value() << std::endl;
+      }
+    }
+  }
+
+ private:
+  struct Request {
+    base::FilePath wtns_path;
+    base::FilePath proof_path;
+    base::FilePath public_path;
+    // nullptr if the request is invalid or |wtns_path| failed to be parsed.
+    std::unique_ptr<Wtns<F>> wtns;
+  };
+
+  // Returns std::nullopt on the end of |in|.
+  static std::optional<Request> ReadRequest(std::istream& in) {
+    std::string line;
+    while (std::getline(in, line)) {
+      std::vector<std::string> paths =
+          absl::StrSplit(line, ' ', absl::SkipWhitespace());
+      if (paths.empty()) continue;
+      Request request;
+      if (paths.size() != 3) {
+        LOG(ERROR) << "Invalid request: " << line;
+        request.wtns_path = base::FilePath(line);
+        return request;
+      }
+      request.wtns_path = base::FilePath(paths[0]);
+      request.proof_path = base::FilePath(paths[1]);
+      request.public_path = base::FilePath(paths[2]);
+      request.wtns = ParseWtns<F>(request.wtns_path);
+      return request;
+    }
+    return std::nullopt;
+  }
+
+  bool Prove(const Request& request) const {
+    absl::Span<const F> full_assignments = request.wtns->GetWitnesses();
+    size_t num_instance_variables = constraint_matrices_.num_instance_variables;
+    size_t num_variables =
+        num_instance_variables + constraint_matrices_.num_witness_variables;
+    if (full_assignments.size() != num_variables) {
+      LOG(ERROR) << "Witness size mismatch: " << full_assignments.size();
+      return false;
+    }
+
+    std::vector<F> h_evals =
+        QuadraticArithmeticProgram<F>::WitnessMapFromMatrices(
+            domain_.get(), csr_matrices_, full_assignments);
+
+    absl::Span<const F> public_inputs =
+        full_assignments.subspan(1, num_instance_variables - 1);
+    zk::r1cs::groth16::Proof<Curve> proof;
+    if (no_zk_) {
+      proof = zk::r1cs::groth16::CreateProofWithAssignmentNoZK(
+          proving_key_, absl::MakeConstSpan(h_evals), public_inputs,
+          full_assignments.subspan(num_instance_variables),
+          full_assignments.subspan(1));
+    } else {
+      proof = zk::r1cs::groth16::CreateProofWithAssignmentZK(
+          proving_key_, absl::MakeConstSpan(h_evals), public_inputs,
+          full_assignments.subspan(num_instance_variables),
+          full_assignments.subspan(1));
+    }
+
+    if (verify_ && !zk::r1cs::groth16::VerifyProof(prepared_verifying_key_,
+                                                   proof, public_inputs)) {
+      LOG(ERROR) << "Failed to verify proof: " << request.proof_path.value();
+      return false;
+    }
+
+    if (binary_) {
+      return WriteToBinary(proof, request.proof_path) &&
+             WriteToBinary(public_inputs, request.public_path);
+    }
+    return WriteToJson(proof, request.proof_path) &&
+           WriteToJson(public_inputs, request.public_path);
+  }
+
+  bool no_zk_;
+  bool verify_;
+  bool binary_;
+  zk::r1cs::groth16::ProvingKey<Curve> proving_key_;
+  zk::r1cs::ConstraintMatrices<F> constraint_matrices_;
+  CSRMatrices csr_matrices_;
+  zk::r1cs::groth16::PreparedVerifyingKey<Curve> prepared_verifying_key_;
+  std::unique_ptr<Domain> domain_;
+};
+
+template <typename Curve>
+void Serve(const base::FilePath& zkey_path, bool no_zk, bool verify,
+           bool binary) {
+  Curve::Init();
+
+  ProverServer<Curve> server(zkey_path, no_zk, verify, binary);
+  server.Serve(std::cin);
+}
+
+}  // namespace circom
+
+int RealMain(int argc, char** argv) {
+  base::FlagParser parser;
+  base::FilePath zkey_path;
+  Curve curve = Curve::kBN254;
+  bool no_zk = false;
+  bool verify = false;
+  bool binary = false;
+  parser.AddFlag<base::FilePathFlag>(&zkey_path)
+      .set_name("zkey")
+      .set_help("The path to zkey file");
+  parser.AddFlag<base::Flag<Curve>>(&curve).set_long_name("--curve").set_help(
+      "The curve type among ('bn254', bls12_381'), by default 'bn254'");
+  parser.AddFlag<base::BoolFlag>(&no_zk).set_long_name("--no_zk").set_help(
+      "Create proofs without zk. By default zk is enabled. Use this flag to "
+      "compare the proofs with rapidsnark.");
+  parser.AddFlag<base::BoolFlag>(&verify)
+      .set_long_name("--verify")
+      .set_help(
+          "Verify the proofs. By default verify is disabled. Use this flag "
+          "to verify the proofs with the public inputs.");
+  parser.AddFlag<base::BoolFlag>(&binary)
+      .set_long_name("--binary")
+      .set_help(
+          "Write the proofs and the public inputs in the binary format of "
+          "tachyon instead of json. It is faster but not readable by "
+          "snarkjs.");
+
+  std::string error;
+  if (!parser.Parse(argc, argv, &error)) {
+    tachyon_cerr << error << std::endl;
+    return 1;
+  }
+
+  switch (curve) {
+    case Curve::kBN254:
+      circom::Serve<math::bn254::BN254Curve>(zkey_path, no_zk, verify,
+                                             binary);
+      break;
+    case Curve::kBLS12_381:
+      circom::Serve<math::bls12_381::BLS12_381Curve>(zkey_path, no_zk, verify,
+                                                     binary);
+      break;
+  }
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
@@ -0,0 +1,167 @@
+// A port of tachyon/zk/plonk/examples/fibonacci/fibonacci1_circuit.h.
+use std::marker::PhantomData;
+
+use halo2_proofs::{
+    circuit::{AssignedCell, Layouter, SimpleFloorPlanner},
+    plonk::{Advice, Circuit, Column, ConstraintSystem, Error, Instance, Selector},
+    poly::Rotation,
+};
+use halo2curves::FieldExt;
+
+#[derive(Clone, Debug)]
+pub(crate) struct FibonacciConfig {
+    advice: [Column<Advice>; 3],
+    selector: Selector,
+    instance: Column<Instance>,
+}
+
+struct FibonacciChip<F: FieldExt> {
+    config: FibonacciConfig,
+    _marker: PhantomData<F>,
+}
+
+impl<F: FieldExt> FibonacciChip<F> {
+    fn construct(config: FibonacciConfig) -> Self {
+        Self {
+            config,
+            _marker: PhantomData,
+        }
+    }
+
+    fn configure(meta: &mut ConstraintSystem<F>) -> FibonacciConfig {
+        let advice = [
+            meta.advice_column(),
+            meta.advice_column(),
+            meta.advice_column(),
+        ];
+        let selector = meta.selector();
+        let instance = meta.instance_column();
+
+        for column in advice.iter() {
+            meta.enable_equality(*column);
+        }
+        meta.enable_equality(instance);
+
+        meta.create_gate("add", |meta| {
+            //
+            // advice[0] | advice[1] | advice[2] | selector
+            //    a           b           c           s
+            //
+            let s = meta.query_selector(selector);
+            let a = meta.query_advice(advice[0], Rotation::cur());
+            let b = meta.query_advice(advice[1], Rotation::cur());
+            let c = meta.query_advice(advice[2], Rotation::cur());
+            vec![s * (a + b - c)]
+        });
+
+        FibonacciConfig {
+            advice,
+            selector,
+            instance,
+        }
+    }
+
+    #[allow(clippy::type_complexity)]
+    fn assign_first_row(
+        &self,
+        mut layouter: impl Layouter<F>,
+    ) -> Result<(AssignedCell<F, F>, AssignedCell<F, F>), Error> {
+        layouter.assign_region(
+            || "first row",
+            |mut region| {
+                self.config.selector.enable(&mut region, 0)?;
+
+                let a_cell = region.assign_advice_from_instance(
+                    || "f(0)",
+                    self.config.instance,
+                    0,
+                    self.config.advice[0],
+                    0,
+                )?;
+                let b_cell = region.assign_advice_from_instance(
+                    || "f(1)",
+                    self.config.instance,
+                    1,
+                    self.config.advice[1],
+                    0,
+                )?;
+                let c_cell = region.assign_advice(
+                    || "a + b",
+                    self.config.advice[2],
+                    0,
+                    || a_cell.value().copied() + b_cell.value(),
+                )?;
+
+                Ok((b_cell, c_cell))
+            },
+        )
+    }
+
+    fn assign_row(
+        &self,
+        mut layouter: impl Layouter<F>,
+        prev_b: &AssignedCell<F, F>,
+        prev_c: &AssignedCell<F, F>,
+    ) -> Result<AssignedCell<F, F>, Error> {
+        layouter.assign_region(
+            || "next row",
+            |mut region| {
+                self.config.selector.enable(&mut region, 0)?;
+
+                // Copy the value from b & c in previous row to a & b in current row
+                let a_cell = prev_b.copy_advice(|| "a", &mut region, self.config.advice[0], 0)?;
+                let b_cell = prev_c.copy_advice(|| "b", &mut region, self.config.advice[1], 0)?;
+
+                region.assign_advice(
+                    || "a + b",
+                    self.config.advice[2],
+                    0,
+                    || a_cell.value().copied() + b_cell.value(),
+                )
+            },
+        )
+    }
+
+    fn expose_public(
+        &self,
+        mut layouter: impl Layouter<F>,
+        cell: &AssignedCell<F, F>,
+        row: usize,
+    ) -> Result<(), Error> {
+        layouter.constrain_instance(cell.cell(), self.config.instance, row)
+    }
+}
+
+#[derive(Clone, Default)]
+pub(crate) struct FibonacciCircuit<F: FieldExt>(PhantomData<F>);
+
+impl<F: FieldExt> Circuit<F> for FibonacciCircuit<F> {
+    type Config = FibonacciConfig;
+    type FloorPlanner = SimpleFloorPlanner;
+
+    fn without_witnesses(&self) -> Self {
+        Self::default()
+    }
+
+    fn configure(meta: &mut ConstraintSystem<F>) -> Self::Config {
+        FibonacciChip::configure(meta)
+    }
+
+    fn synthesize(
+        &self,
+        config: Self::Config,
+        mut layouter: impl Layouter<F>,
+    ) -> Result<(), Error> {
+        let chip = FibonacciChip::construct(config);
+
+        let (mut prev_b, mut prev_c) = chip.assign_first_row(layouter.namespace(|| "first row"))?;
+
+        for _ in 3..10 {
+            let c_cell = chip.assign_row(layouter.namespace(|| "next row"), &prev_b, &prev_c)?;
+            prev_b = prev_c;
+            prev_c = c_cell;
+        }
+
+        chip.expose_public(layouter.namespace(|| "out"), &prev_c, 2)
+    }
+}
@@ -0,0 +1,78 @@
+mod fibonacci_circuit;
+#[path = "../../src/circuits/shuffle_circuit.rs"]
+mod shuffle_circuit;
+
+use std::time::Instant;
+
+use halo2_proofs::{
+    plonk::{create_proof, keygen_pk2, Circuit},
+    poly::kzg::{
+        commitment::{KZGCommitmentScheme, ParamsKZG},
+        multiopen::{ProverGWC, ProverSHPLONK},
+    },
+    transcript::{Blake2bWrite, Challenge255, TranscriptWriterBuffer},
+};
+use halo2curves::bn256::{Bn256, Fr};
+use rand_core::OsRng;
+
+use fibonacci_circuit::FibonacciCircuit;
+use shuffle_circuit::MyCircuit as ShuffleCircuit;
+
+// NOTE: These should be the same as |Halo2Config::kShuffleWidth| and
+// |Halo2Config::kShuffleHeight| in benchmark/halo2/halo2_config.h.
+const SHUFFLE_WIDTH: usize = 4;
+const SHUFFLE_HEIGHT: usize = 256;
+
+// Returns the time taken to create a proof of |circuit| in microseconds. The
+// setup and the keygen are not timed.
+fn prove<C: Circuit<Fr>>(k: u32, use_shplonk: bool, circuit: C, instances: &[&[Fr]]) -> u64 {
+    let params = ParamsKZG::<Bn256>::unsafe_setup_with_s(k, Fr::from(2));
+    let pk = keygen_pk2(&params, &circuit).expect("keygen should not fail");
+    let mut transcript = Blake2bWrite::<_, _, Challenge255<_>>::init(vec![]);
+
+    let start = Instant::now();
+    if use_shplonk {
+        create_proof::<KZGCommitmentScheme<Bn256>, ProverSHPLONK<_>, _, _, _, _>(
+            &params,
+            &pk,
+            &[circuit],
+            &[instances],
+            OsRng,
+            &mut transcript,
+        )
+    } else {
+        create_proof::<KZGCommitmentScheme<Bn256>, ProverGWC<_>, _, _, _, _>(
+            &params,
+            &pk,
+            &[circuit],
+            &[instances],
+            OsRng,
+            &mut transcript,
+        )
+    }
+    .expect("proof generation should not fail");
+    start.elapsed().as_micros() as u64
+}
+
+#[no_mangle]
+pub extern "C" fn run_halo2_fibonacci(k: u32, use_shplonk: bool, duration: *mut u64) {
+    let instance = [Fr::from(1), Fr::from(1), Fr::from(55)];
+    let elapsed = prove(
+        k,
+        use_shplonk,
+        FibonacciCircuit::<Fr>::default(),
+        &[&instance],
+    );
+    unsafe {
+        duration.write(elapsed);
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn run_halo2_shuffle(k: u32, use_shplonk: bool, duration: *mut u64) {
+    let circuit = ShuffleCircuit::<Fr, SHUFFLE_WIDTH, SHUFFLE_HEIGHT>::rand(&mut OsRng);
+    let elapsed = prove(k, use_shplonk, circuit, &[]);
+    unsafe {
+        duration.write(elapsed);
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef VENDORS_HALO2_INCLUDE_BN254_ASYNC_MSM_H_
+#define VENDORS_HALO2_INCLUDE_BN254_ASYNC_MSM_H_
+
+#include <stdint.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "rust/cxx.h"
+
+namespace tachyon::halo2_api::bn254 {
+
+struct G1JacobianPoint;
+struct G1Point2;
+struct Fr;
+
+// |AsyncG1MSM| runs MSMs on its own thread, so that the caller can do other
+// work, e.g., synthesizing the next phase, while the commitments are being
+// computed. |submit()| enqueues an MSM and returns a ticket, and |poll()| and
+// |wait()| retrieve its result by the ticket. The MSMs run one by one in the
+// order of submission, since each of them uses every core or the GPU on its
+// own.
+// NOTE: The bases and the scalars must outlive the MSM, i.e., until its
+// ticket is waited for.
+class AsyncG1MSM {
+ public:
+  // Computes an MSM on the thread of |AsyncG1MSM|.
+  class Backend {
+   public:
+    virtual ~Backend() = default;
+
+    virtual rust::Box<G1JacobianPoint> Run(
+        rust::Slice<const G1Point2> bases, rust::Slice<const Fr> scalars) = 0;
+  };
+
+  explicit AsyncG1MSM(std::unique_ptr<Backend> backend);
+  AsyncG1MSM(const AsyncG1MSM& other) = delete;
+  AsyncG1MSM& operator=(const AsyncG1MSM& other) = delete;
+  // Waits until every submitted MSM is done.
+  ~AsyncG1MSM();
+
+  uint64_t submit(rust::Slice<const G1Point2> bases,
+                  rust::Slice<const Fr> scalars) const;
+  // Returns true if the MSM of |ticket| is done, which must not be waited
+  // for yet.
+  bool poll(uint64_t ticket) const;
+  // Blocks until the MSM of |ticket| is done and returns its result. Each
+  // ticket can be waited for only once.
+  rust::Box<G1JacobianPoint> wait(uint64_t ticket) const;
+
+ private:
+  struct Job {
+    uint64_t ticket;
+    rust::Slice<const G1Point2> bases;
+    rust::Slice<const Fr> scalars;
+  };
+
+  void RunJobs();
+
+  std::unique_ptr<Backend> backend_;
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable cv_;
+  mutable std::deque<Job> jobs_;
+  mutable std::unordered_map<uint64_t, rust::Box<G1JacobianPoint>> results_;
+  mutable uint64_t next_ticket_ = 0;
+  bool stopped_ = false;
+
+  std::thread thread_;
+};
+
+std::unique_ptr<AsyncG1MSM> new_async_g1_msm(uint8_t degree);
+
+std::unique_ptr<AsyncG1MSM> new_async_g1_msm_gpu(uint8_t degree,
+                                                 int algorithm);
+
+}  // namespace tachyon::halo2_api::bn254
+
+#endif  // VENDORS_HALO2_INCLUDE_BN254_ASYNC_MSM_H_
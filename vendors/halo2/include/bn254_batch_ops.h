@@ -0,0 +1,23 @@
+#ifndef VENDORS_HALO2_INCLUDE_BN254_BATCH_OPS_H_
+#define VENDORS_HALO2_INCLUDE_BN254_BATCH_OPS_H_
+
+#include "rust/cxx.h"
+
+namespace tachyon::halo2_api::bn254 {
+
+struct Fr;
+struct G1JacobianPoint;
+struct G1Point2;
+
+// Inverts every nonzero value of |values| in place. The zeros stay zero.
+void batch_invert(rust::Slice<Fr> values);
+
+// Normalizes |jacobian_points| into |affine_points| with a single batch
+// inversion. The point at infinity is normalized into (0, 0). Returns false if
+// they differ in length.
+bool batch_normalize(rust::Slice<const G1JacobianPoint> jacobian_points,
+                     rust::Slice<G1Point2> affine_points);
+
+}  // namespace tachyon::halo2_api::bn254
+
+#endif  // VENDORS_HALO2_INCLUDE_BN254_BATCH_OPS_H_
@@ -6,6 +6,8 @@
 #include <memory>
 #include <utility>
 
+#include "rust/cxx.h"
+
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_evaluations.h"
 
 namespace tachyon::halo2_api::bn254 {
@@ -29,6 +31,7 @@ class Evals {
 
   size_t len() const;
   void set_value(size_t idx, const Fr& value);
+  void set_range(size_t start, rust::Slice<const Fr> values);
   std::unique_ptr<Evals> clone() const;
 
  private:
@@ -51,6 +51,8 @@ class GWCProver {
                     rust::Slice<AdviceSingle> advice_singles,
                     rust::Slice<const Fr> challenges);
   rust::Vec<uint8_t> get_proof() const;
+  void enable_trace(bool enable);
+  rust::String get_trace() const;
 
  private:
   tachyon_halo2_bn254_gwc_prover* prover_;
@@ -19,6 +19,14 @@ rust::Box<G1JacobianPoint> g1_point2_msm_gpu(G1MSMGpu* msm,
                                              rust::Slice<const G1Point2> bases,
                                              rust::Slice<const Fr> scalars);
 
+uint64_t g1_point2_upload_bases_gpu(G1MSMGpu* msm,
+                                    rust::Slice<const G1Point2> bases);
+
+rust::Box<G1JacobianPoint> g1_msm_gpu_with_resident_bases(
+    G1MSMGpu* msm, uint64_t bases_handle, rust::Slice<const Fr> scalars);
+
+void g1_release_bases_gpu(G1MSMGpu* msm, uint64_t bases_handle);
+
 }  // namespace tachyon::halo2_api::bn254
 
 #endif  // VENDORS_HALO2_INCLUDE_BN254_MSM_GPU_H_
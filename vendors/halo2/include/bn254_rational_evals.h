@@ -6,6 +6,8 @@
 #include <memory>
 #include <utility>
 
+#include "rust/cxx.h"
+
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_rational_evaluations.h"
 
 namespace tachyon::halo2_api::bn254 {
@@ -34,6 +36,12 @@ class RationalEvals {
   void set_zero(size_t idx);
   void set_trivial(size_t idx, const Fr& numerator);
   void set_rational(size_t idx, const Fr& numerator, const Fr& denominator);
+  // |denominators| is empty if every denominator is one.
+  void set_range(size_t start, rust::Slice<const Fr> numerators,
+                 rust::Slice<const Fr> denominators);
+  void set_batch(rust::Slice<const size_t> indices,
+                 rust::Slice<const Fr> numerators,
+                 rust::Slice<const Fr> denominators);
   std::unique_ptr<RationalEvals> clone() const;
 
  private:
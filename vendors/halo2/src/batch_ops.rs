@@ -0,0 +1,93 @@
+#[cfg(test)]
+mod test {
+    use crate::bn254::{batch_invert, batch_normalize};
+    use halo2curves::{
+        bn256::{Fr, G1Affine, G1},
+        group::{
+            ff::{BatchInvert, Field},
+            Curve, Group,
+        },
+    };
+    use rand_core::OsRng;
+    use std::time::Instant;
+
+    struct Timer {
+        now: Instant,
+    }
+
+    impl Timer {
+        fn new() -> Timer {
+            Timer {
+                now: Instant::now(),
+            }
+        }
+
+        fn reset(&mut self) {
+            self.now = Instant::now();
+        }
+
+        fn end(&self, message: &str, n: usize) {
+            let elapsed = self.now.elapsed();
+            println!(
+                "{}, elapsed: {:?}, per element: {:?}",
+                message,
+                elapsed,
+                elapsed / n as u32
+            );
+        }
+    }
+
+    #[test]
+    fn test_batch_invert() {
+        let n = 1usize << 10;
+        let mut values: Vec<Fr> = (0..n).map(|_| Fr::random(OsRng)).collect();
+        values[1] = Fr::zero();
+
+        let mut expected = values.clone();
+        expected.iter_mut().batch_invert();
+
+        // Crosses the FFI boundary once per element.
+        let mut actual = values.clone();
+        let mut timer = Timer::new();
+        for value in actual.iter_mut() {
+            batch_invert(std::slice::from_mut(value));
+        }
+        timer.end("batch_invert per element", n);
+        assert_eq!(actual, expected);
+
+        // Crosses the FFI boundary once per slice.
+        timer.reset();
+        batch_invert(&mut values);
+        timer.end("batch_invert", n);
+        assert_eq!(values, expected);
+    }
+
+    #[test]
+    fn test_batch_normalize() {
+        let n = 1usize << 10;
+        let mut points: Vec<G1> = (0..n).map(|_| G1::random(OsRng)).collect();
+        points[1] = G1::identity();
+
+        let mut expected = vec![G1Affine::identity(); n];
+        G1::batch_normalize(&points, &mut expected);
+
+        // Crosses the FFI boundary once per element.
+        let mut actual = vec![G1Affine::identity(); n];
+        let mut timer = Timer::new();
+        for (point, affine_point) in points.iter().zip(actual.iter_mut()) {
+            batch_normalize(
+                std::slice::from_ref(point),
+                std::slice::from_mut(affine_point),
+            );
+        }
+        timer.end("batch_normalize per element", n);
+        assert_eq!(actual, expected);
+
+        // Crosses the FFI boundary once per slice.
+        let mut actual = vec![G1Affine::identity(); n];
+        timer.reset();
+        batch_normalize(&points, &mut actual);
+        timer.end("batch_normalize", n);
+        assert_eq!(actual, expected);
+    }
+}
@@ -14,6 +14,7 @@ use halo2_proofs::{
 use halo2curves::{bn256::G2Affine, Coordinates, CurveAffine, FieldExt};
 use num_bigint::BigUint;
 
+use tachyon_rs::base::{cast_slice, cast_slice_mut};
 use tachyon_rs::math::elliptic_curves::bn::bn254::{
     Fr as FrImpl, G1JacobianPoint as G1JacobianPointImpl, G1Point2 as G1Point2Impl,
     G2AffinePoint as G2AffinePointImpl,
@@ -70,6 +71,39 @@ pub mod ffi {
             bases: &[G1Point2],
             scalars: &[Fr],
         ) -> Box<G1JacobianPoint>;
+        #[cfg(feature = "gpu")]
+        unsafe fn g1_point2_upload_bases_gpu(msm: *mut G1MSMGpu, bases: &[G1Point2]) -> u64;
+        #[cfg(feature = "gpu")]
+        unsafe fn g1_msm_gpu_with_resident_bases(
+            msm: *mut G1MSMGpu,
+            bases_handle: u64,
+            scalars: &[Fr],
+        ) -> Box<G1JacobianPoint>;
+        #[cfg(feature = "gpu")]
+        unsafe fn g1_release_bases_gpu(msm: *mut G1MSMGpu, bases_handle: u64);
+    }
+
+    unsafe extern "C++" {
+        include!("vendors/halo2/include/bn254_async_msm.h");
+
+        type AsyncG1MSM;
+
+        fn new_async_g1_msm(degree: u8) -> UniquePtr<AsyncG1MSM>;
+        #[cfg(feature = "gpu")]
+        fn new_async_g1_msm_gpu(degree: u8, algorithm: i32) -> UniquePtr<AsyncG1MSM>;
+        unsafe fn submit(&self, bases: &[G1Point2], scalars: &[Fr]) -> u64;
+        fn poll(&self, ticket: u64) -> bool;
+        fn wait(&self, ticket: u64) -> Box<G1JacobianPoint>;
+    }
+
+    unsafe extern "C++" {
+        include!("vendors/halo2/include/bn254_batch_ops.h");
+
+        fn batch_invert(values: &mut [Fr]);
+        fn batch_normalize(
+            jacobian_points: &[G1JacobianPoint],
+            affine_points: &mut [G1Point2],
+        ) -> bool;
     }
 
     unsafe extern "C++" {
@@ -133,6 +167,7 @@ pub mod ffi {
         fn zero_evals() -> UniquePtr<Evals>;
         fn len(&self) -> usize;
         fn set_value(self: Pin<&mut Evals>, idx: usize, value: &Fr);
+        fn set_range(self: Pin<&mut Evals>, start: usize, values: &[Fr]);
         fn clone(&self) -> UniquePtr<Evals>;
     }
 
@@ -149,6 +184,18 @@ pub mod ffi {
             numerator: &Fr,
             denominator: &Fr,
         );
+        fn set_range(
+            self: Pin<&mut RationalEvals>,
+            start: usize,
+            numerators: &[Fr],
+            denominators: &[Fr],
+        );
+        fn set_batch(
+            self: Pin<&mut RationalEvals>,
+            indices: &[usize],
+            numerators: &[Fr],
+            denominators: &[Fr],
+        );
         fn clone(&self) -> UniquePtr<RationalEvals>;
     }
 
@@ -193,6 +240,8 @@ pub mod ffi {
             challenges: &[Fr],
         );
         fn get_proof(self: &GWCProver) -> Vec<u8>;
+        fn enable_trace(self: Pin<&mut GWCProver>, enable: bool);
+        fn get_trace(self: &GWCProver) -> String;
     }
 
     unsafe extern "C++" {
@@ -230,6 +279,8 @@ pub mod ffi {
             challenges: &[Fr],
         );
         fn get_proof(self: &SHPlonkProver) -> Vec<u8>;
+        fn enable_trace(self: Pin<&mut SHPlonkProver>, enable: bool);
+        fn get_trace(self: &SHPlonkProver) -> String;
     }
 }
 
@@ -655,6 +706,92 @@ impl<C: CurveAffine> ProvingKey<C> {
     }
 }
 
+/// Runs the MSMs of tachyon on a thread of its own, so that the caller can
+/// overlap them with other work. See `MSMTicket`.
+pub struct AsyncMSM {
+    inner: cxx::UniquePtr<ffi::AsyncG1MSM>,
+}
+
+// NOTE: The state of `ffi::AsyncG1MSM` is guarded by a mutex.
+unsafe impl Send for AsyncMSM {}
+unsafe impl Sync for AsyncMSM {}
+
+impl AsyncMSM {
+    pub fn new(degree: u8) -> AsyncMSM {
+        AsyncMSM {
+            inner: ffi::new_async_g1_msm(degree),
+        }
+    }
+
+    #[cfg(feature = "gpu")]
+    pub fn new_gpu(degree: u8, algorithm: i32) -> AsyncMSM {
+        AsyncMSM {
+            inner: ffi::new_async_g1_msm_gpu(degree, algorithm),
+        }
+    }
+
+    /// Submits an MSM of `bases` and `scalars` and returns at once. They stay
+    /// borrowed until the returned ticket is waited for or dropped.
+    pub fn submit<'a>(
+        &'a self,
+        bases: &'a [halo2curves::bn256::G1Affine],
+        scalars: &'a [halo2curves::bn256::Fr],
+    ) -> MSMTicket<'a> {
+        let cpp_bases = unsafe { std::mem::transmute::<_, &[G1Point2]>(bases) };
+        let cpp_scalars = unsafe { std::mem::transmute::<_, &[Fr]>(scalars) };
+        MSMTicket {
+            msm: self,
+            ticket: Some(unsafe { self.inner.submit(cpp_bases, cpp_scalars) }),
+        }
+    }
+}
+
+/// A handle to an MSM submitted to `AsyncMSM`.
+pub struct MSMTicket<'a> {
+    msm: &'a AsyncMSM,
+    ticket: Option<u64>,
+}
+
+impl<'a> MSMTicket<'a> {
+    /// Returns true if the MSM is done, so that `wait()` doesn't block.
+    pub fn is_ready(&self) -> bool {
+        self.msm.inner.poll(self.ticket.unwrap())
+    }
+
+    /// Blocks until the MSM is done and returns its result.
+    pub fn wait(mut self) -> halo2curves::bn256::G1 {
+        let ret = self.msm.inner.wait(self.ticket.take().unwrap());
+        *unsafe { std::mem::transmute::<_, Box<halo2curves::bn256::G1>>(ret) }
+    }
+}
+
+impl<'a> Drop for MSMTicket<'a> {
+    fn drop(&mut self) {
+        // NOTE: The MSM must be done before its inputs are released.
+        if let Some(ticket) = self.ticket.take() {
+            self.msm.inner.wait(ticket);
+        }
+    }
+}
+
+/// Inverts every nonzero value of `values` in place like `ff::BatchInvert`,
+/// but within a single FFI call.
+pub fn batch_invert(values: &mut [halo2curves::bn256::Fr]) {
+    ffi::batch_invert(unsafe { cast_slice_mut::<_, Fr>(values) })
+}
+
+/// Normalizes `points` into `affine_points` like `Curve::batch_normalize()`,
+/// but within a single FFI call.
+pub fn batch_normalize(
+    points: &[halo2curves::bn256::G1],
+    affine_points: &mut [halo2curves::bn256::G1Affine],
+) {
+    assert!(ffi::batch_normalize(
+        unsafe { cast_slice::<_, G1JacobianPoint>(points) },
+        unsafe { cast_slice_mut::<_, G1Point2>(affine_points) },
+    ));
+}
+
 pub struct Evals {
     inner: cxx::UniquePtr<ffi::Evals>,
 }
@@ -676,6 +813,13 @@ impl Evals {
         let cpp_fr = unsafe { std::mem::transmute::<_, &Fr>(fr) };
         self.inner.pin_mut().set_value(idx, cpp_fr)
     }
+
+    /// Sets the values at `start..start + values.len()` across the FFI
+    /// boundary at once, which is cheaper than calling `set_value()` for each.
+    pub fn set_values(&mut self, start: usize, values: &[halo2curves::bn256::Fr]) {
+        let cpp_values = unsafe { cast_slice::<_, Fr>(values) };
+        self.inner.pin_mut().set_range(start, cpp_values)
+    }
 }
 
 impl Clone for Evals {
@@ -716,6 +860,124 @@ impl RationalEvals {
             .pin_mut()
             .set_rational(idx, cpp_numerator, cpp_denominator)
     }
+
+    /// Sets the values at `start..start + numerators.len()`. `denominators` is
+    /// empty if every denominator is one.
+    pub fn set_range(
+        &mut self,
+        start: usize,
+        numerators: &[halo2curves::bn256::Fr],
+        denominators: &[halo2curves::bn256::Fr],
+    ) {
+        let cpp_numerators = unsafe { std::mem::transmute::<_, &[Fr]>(numerators) };
+        let cpp_denominators = unsafe { std::mem::transmute::<_, &[Fr]>(denominators) };
+        self.inner
+            .pin_mut()
+            .set_range(start, cpp_numerators, cpp_denominators)
+    }
+
+    /// Sets the value at `indices[i]` to `numerators[i] / denominators[i]`.
+    /// `denominators` is empty if every denominator is one.
+    pub fn set_batch(
+        &mut self,
+        indices: &[usize],
+        numerators: &[halo2curves::bn256::Fr],
+        denominators: &[halo2curves::bn256::Fr],
+    ) {
+        let cpp_numerators = unsafe { std::mem::transmute::<_, &[Fr]>(numerators) };
+        let cpp_denominators = unsafe { std::mem::transmute::<_, &[Fr]>(denominators) };
+        self.inner
+            .pin_mut()
+            .set_batch(indices, cpp_numerators, cpp_denominators)
+    }
+}
+
+/// Buffers the assignments to a `RationalEvals`, so that they cross the FFI
+/// boundary in batches of up to `RationalEvalsBuffer::CAPACITY` cells instead
+/// of one cell at a time. The buffered cells must be flushed with `flush()`
+/// before the `RationalEvals` is read.
+#[derive(Default)]
+pub struct RationalEvalsBuffer {
+    indices: Vec<usize>,
+    numerators: Vec<halo2curves::bn256::Fr>,
+    // Empty as long as every buffered denominator is one.
+    denominators: Vec<halo2curves::bn256::Fr>,
+}
+
+impl RationalEvalsBuffer {
+    pub const CAPACITY: usize = 1 << 14;
+
+    pub fn new() -> RationalEvalsBuffer {
+        RationalEvalsBuffer::default()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.indices.is_empty()
+    }
+
+    pub fn push_zero(&mut self, evals: &mut RationalEvals, idx: usize) {
+        self.push_trivial(evals, idx, &halo2curves::bn256::Fr::zero())
+    }
+
+    pub fn push_trivial(
+        &mut self,
+        evals: &mut RationalEvals,
+        idx: usize,
+        numerator: &halo2curves::bn256::Fr,
+    ) {
+        self.indices.push(idx);
+        self.numerators.push(*numerator);
+        if !self.denominators.is_empty() {
+            self.denominators.push(halo2curves::bn256::Fr::one());
+        }
+        self.flush_if_full(evals)
+    }
+
+    pub fn push_rational(
+        &mut self,
+        evals: &mut RationalEvals,
+        idx: usize,
+        numerator: &halo2curves::bn256::Fr,
+        denominator: &halo2curves::bn256::Fr,
+    ) {
+        if self.denominators.is_empty() {
+            self.denominators
+                .resize(self.numerators.len(), halo2curves::bn256::Fr::one());
+        }
+        self.indices.push(idx);
+        self.numerators.push(*numerator);
+        self.denominators.push(*denominator);
+        self.flush_if_full(evals)
+    }
+
+    /// Sets the buffered cells to `evals`. The cells assigned to consecutive
+    /// rows in order, which is how a region usually fills a column, are set
+    /// as a range without the indices.
+    pub fn flush(&mut self, evals: &mut RationalEvals) {
+        if self.indices.is_empty() {
+            return;
+        }
+        let start = self.indices[0];
+        let is_range = self
+            .indices
+            .iter()
+            .enumerate()
+            .all(|(i, &idx)| idx == start + i);
+        if is_range {
+            evals.set_range(start, &self.numerators, &self.denominators);
+        } else {
+            evals.set_batch(&self.indices, &self.numerators, &self.denominators);
+        }
+        self.indices.clear();
+        self.numerators.clear();
+        self.denominators.clear();
+    }
+
+    fn flush_if_full(&mut self, evals: &mut RationalEvals) {
+        if self.indices.len() >= Self::CAPACITY {
+            self.flush(evals)
+        }
+    }
 }
 
 impl Clone for RationalEvals {
@@ -773,6 +1035,10 @@ pub trait TachyonProver<Scheme: CommitmentScheme> {
 
     fn get_proof(&self) -> Vec<u8>;
 
+    fn enable_trace(&mut self, enable: bool);
+
+    fn get_trace(&self) -> String;
+
     fn transcript_repr(&self, pk: &mut ProvingKey<Scheme::Curve>) -> Scheme::Scalar;
 }
 
@@ -881,6 +1147,14 @@ impl<Scheme: CommitmentScheme> TachyonProver<Scheme> for GWCProver<Scheme> {
         self.inner.get_proof()
     }
 
+    fn enable_trace(&mut self, enable: bool) {
+        self.inner.pin_mut().enable_trace(enable)
+    }
+
+    fn get_trace(&self) -> String {
+        self.inner.get_trace()
+    }
+
     fn transcript_repr(
         &self,
         pk: &mut ProvingKey<<Scheme as CommitmentScheme>::Curve>,
@@ -994,6 +1268,14 @@ impl<Scheme: CommitmentScheme> TachyonProver<Scheme> for SHPlonkProver<Scheme> {
         self.inner.get_proof()
     }
 
+    fn enable_trace(&mut self, enable: bool) {
+        self.inner.pin_mut().enable_trace(enable)
+    }
+
+    fn get_trace(&self) -> String {
+        self.inner.get_trace()
+    }
+
     fn transcript_repr(
         &self,
         pk: &mut ProvingKey<<Scheme as CommitmentScheme>::Curve>,
@@ -0,0 +1,98 @@
+#include "vendors/halo2/include/bn254_async_msm.h"
+
+#include <utility>
+
+#include "tachyon/base/logging.h"
+#include "vendors/halo2/include/bn254_msm.h"
+#include "vendors/halo2/src/bn254.rs.h"
+
+namespace tachyon::halo2_api::bn254 {
+
+namespace {
+
+class CpuBackend : public AsyncG1MSM::Backend {
+ public:
+  explicit CpuBackend(uint8_t degree) : msm_(create_g1_msm(degree)) {}
+  ~CpuBackend() override { destroy_g1_msm(std::move(msm_)); }
+
+  // AsyncG1MSM::Backend methods
+  rust::Box<G1JacobianPoint> Run(rust::Slice<const G1Point2> bases,
+                                 rust::Slice<const Fr> scalars) override {
+    return g1_point2_msm(&*msm_, bases, scalars);
+  }
+
+ private:
+  rust::Box<G1MSM> msm_;
+};
+
+}  // namespace
+
+AsyncG1MSM::AsyncG1MSM(std::unique_ptr<Backend> backend)
+    : backend_(std::move(backend)), thread_(&AsyncG1MSM::RunJobs, this) {}
+
+AsyncG1MSM::~AsyncG1MSM() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+uint64_t AsyncG1MSM::submit(rust::Slice<const G1Point2> bases,
+                            rust::Slice<const Fr> scalars) const {
+  CHECK_EQ(bases.size(), scalars.size());
+  uint64_t ticket;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ticket = next_ticket_++;
+    jobs_.push_back({ticket, bases, scalars});
+  }
+  cv_.notify_all();
+  return ticket;
+}
+
+bool AsyncG1MSM::poll(uint64_t ticket) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CHECK_LT(ticket, next_ticket_);
+  return results_.find(ticket) != results_.end();
+}
+
+rust::Box<G1JacobianPoint> AsyncG1MSM::wait(uint64_t ticket) const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  CHECK_LT(ticket, next_ticket_);
+  cv_.wait(lock, [this, ticket]() {
+    return results_.find(ticket) != results_.end();
+  });
+  auto it = results_.find(ticket);
+  rust::Box<G1JacobianPoint> ret = std::move(it->second);
+  results_.erase(it);
+  return ret;
+}
+
+void AsyncG1MSM::RunJobs() {
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      // NOTE: The pending jobs are run even after |stopped_| is set, since
+      // their inputs may be still borrowed by the caller.
+      cv_.wait(lock, [this]() { return stopped_ || !jobs_.empty(); });
+      if (jobs_.empty()) return;
+      job = jobs_.front();
+      jobs_.pop_front();
+    }
+    rust::Box<G1JacobianPoint> result = backend_->Run(job.bases, job.scalars);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      results_.emplace(job.ticket, std::move(result));
+    }
+    cv_.notify_all();
+  }
+}
+
+std::unique_ptr<AsyncG1MSM> new_async_g1_msm(uint8_t degree) {
+  return std::make_unique<AsyncG1MSM>(std::make_unique<CpuBackend>(degree));
+}
+
+}  // namespace tachyon::halo2_api::bn254
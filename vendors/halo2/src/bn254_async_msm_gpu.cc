@@ -0,0 +1,36 @@
+#include "vendors/halo2/include/bn254_async_msm.h"
+
+#include <utility>
+
+#include "vendors/halo2/include/bn254_msm_gpu.h"
+#include "vendors/halo2/src/bn254.rs.h"
+
+namespace tachyon::halo2_api::bn254 {
+
+namespace {
+
+class GpuBackend : public AsyncG1MSM::Backend {
+ public:
+  GpuBackend(uint8_t degree, int algorithm)
+      : msm_(create_g1_msm_gpu(degree, algorithm)) {}
+  ~GpuBackend() override { destroy_g1_msm_gpu(std::move(msm_)); }
+
+  // AsyncG1MSM::Backend methods
+  rust::Box<G1JacobianPoint> Run(rust::Slice<const G1Point2> bases,
+                                 rust::Slice<const Fr> scalars) override {
+    return g1_point2_msm_gpu(&*msm_, bases, scalars);
+  }
+
+ private:
+  rust::Box<G1MSMGpu> msm_;
+};
+
+}  // namespace
+
+std::unique_ptr<AsyncG1MSM> new_async_g1_msm_gpu(uint8_t degree,
+                                                 int algorithm) {
+  return std::make_unique<AsyncG1MSM>(
+      std::make_unique<GpuBackend>(degree, algorithm));
+}
+
+}  // namespace tachyon::halo2_api::bn254
@@ -0,0 +1,34 @@
+#include "vendors/halo2/include/bn254_batch_ops.h"
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/c/math/elliptic_curves/bn/bn254/fr_type_traits.h"
+#include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_type_traits.h"
+#include "vendors/halo2/src/bn254.rs.h"
+
+namespace tachyon::halo2_api::bn254 {
+
+void batch_invert(rust::Slice<Fr> values) {
+  absl::Span<math::bn254::Fr> cpp_values(
+      c::base::native_cast(reinterpret_cast<tachyon_bn254_fr*>(values.data())),
+      values.size());
+  CHECK(math::bn254::Fr::BatchInverseInPlace(cpp_values));
+}
+
+bool batch_normalize(rust::Slice<const G1JacobianPoint> jacobian_points,
+                     rust::Slice<G1Point2> affine_points) {
+  absl::Span<const math::bn254::G1JacobianPoint> cpp_jacobian_points(
+      c::base::native_cast(reinterpret_cast<const tachyon_bn254_g1_jacobian*>(
+          jacobian_points.data())),
+      jacobian_points.size());
+  // NOTE: |G1Point2| has the same layout as |math::bn254::G1AffinePoint|.
+  absl::Span<math::bn254::G1AffinePoint> cpp_affine_points(
+      c::base::native_cast(
+          reinterpret_cast<tachyon_bn254_g1_affine*>(affine_points.data())),
+      affine_points.size());
+  return math::bn254::G1JacobianPoint::BatchNormalize(cpp_jacobian_points,
+                                                      &cpp_affine_points);
+}
+
+}  // namespace tachyon::halo2_api::bn254
@@ -17,6 +17,12 @@ void Evals::set_value(size_t idx, const Fr& fr) {
       evals_, idx, reinterpret_cast<const tachyon_bn254_fr*>(&fr));
 }
 
+void Evals::set_range(size_t start, rust::Slice<const Fr> values) {
+  tachyon_bn254_univariate_evaluations_set_range(
+      evals_, start, reinterpret_cast<const tachyon_bn254_fr*>(values.data()),
+      values.size());
+}
+
 std::unique_ptr<Evals> Evals::clone() const {
   return std::make_unique<Evals>(
       tachyon_bn254_univariate_evaluations_clone(evals_));
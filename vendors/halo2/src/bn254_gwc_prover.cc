@@ -1,5 +1,7 @@
 #include "vendors/halo2/include/bn254_gwc_prover.h"
 
+#include <string>
+
 #include "tachyon/base/buffer/buffer.h"
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_evaluation_domain.h"
 #include "tachyon/rs/base/rust_vec.h"
@@ -187,6 +189,19 @@ rust::Vec<uint8_t> GWCProver::get_proof() const {
   return proof;
 }
 
+void GWCProver::enable_trace(bool enable) {
+  tachyon_halo2_bn254_gwc_prover_enable_trace(prover_, enable);
+}
+
+rust::String GWCProver::get_trace() const {
+  size_t trace_len;
+  tachyon_halo2_bn254_gwc_prover_get_trace(prover_, nullptr, &trace_len);
+  std::string trace(trace_len, '\0');
+  tachyon_halo2_bn254_gwc_prover_get_trace(prover_, trace.data(),
+                                              &trace_len);
+  return rust::String(trace);
+}
+
 std::unique_ptr<GWCProver> new_gwc_prover(uint8_t transcript_type, uint32_t k,
                                           const Fr& s) {
   return std::make_unique<GWCProver>(transcript_type, k, s);
@@ -27,4 +27,27 @@ rust::Box<G1JacobianPoint> g1_point2_msm_gpu(G1MSMGpu* msm,
       reinterpret_cast<G1JacobianPoint*>(ret));
 }
 
+uint64_t g1_point2_upload_bases_gpu(G1MSMGpu* msm,
+                                    rust::Slice<const G1Point2> bases) {
+  return tachyon_bn254_g1_msm_gpu_upload_point2_bases(
+      reinterpret_cast<tachyon_bn254_g1_msm_gpu_ptr>(msm),
+      reinterpret_cast<const tachyon_bn254_g1_point2*>(bases.data()),
+      bases.length());
+}
+
+rust::Box<G1JacobianPoint> g1_msm_gpu_with_resident_bases(
+    G1MSMGpu* msm, uint64_t bases_handle, rust::Slice<const Fr> scalars) {
+  auto ret = tachyon_bn254_g1_msm_gpu_with_resident_bases(
+      reinterpret_cast<tachyon_bn254_g1_msm_gpu_ptr>(msm), bases_handle,
+      reinterpret_cast<const tachyon_bn254_fr*>(scalars.data()),
+      scalars.length());
+  return rust::Box<G1JacobianPoint>::from_raw(
+      reinterpret_cast<G1JacobianPoint*>(ret));
+}
+
+void g1_release_bases_gpu(G1MSMGpu* msm, uint64_t bases_handle) {
+  tachyon_bn254_g1_msm_gpu_release_bases(
+      reinterpret_cast<tachyon_bn254_g1_msm_gpu_ptr>(msm), bases_handle);
+}
+
 }  // namespace tachyon::halo2_api::bn254
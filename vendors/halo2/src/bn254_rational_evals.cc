@@ -1,5 +1,6 @@
 #include "vendors/halo2/include/bn254_rational_evals.h"
 
+#include "tachyon/base/logging.h"
 #include "vendors/halo2/src/bn254.rs.h"
 
 namespace tachyon::halo2_api::bn254 {
@@ -31,6 +32,32 @@ void RationalEvals::set_rational(size_t idx, const Fr& numerator,
       reinterpret_cast<const tachyon_bn254_fr*>(&denominator));
 }
 
+void RationalEvals::set_range(size_t start, rust::Slice<const Fr> numerators,
+                              rust::Slice<const Fr> denominators) {
+  CHECK(denominators.empty() || denominators.size() == numerators.size());
+  tachyon_bn254_univariate_rational_evaluations_set_range(
+      evals_, start,
+      reinterpret_cast<const tachyon_bn254_fr*>(numerators.data()),
+      denominators.empty()
+          ? nullptr
+          : reinterpret_cast<const tachyon_bn254_fr*>(denominators.data()),
+      numerators.size());
+}
+
+void RationalEvals::set_batch(rust::Slice<const size_t> indices,
+                              rust::Slice<const Fr> numerators,
+                              rust::Slice<const Fr> denominators) {
+  CHECK_EQ(indices.size(), numerators.size());
+  CHECK(denominators.empty() || denominators.size() == numerators.size());
+  tachyon_bn254_univariate_rational_evaluations_set_batch(
+      evals_, indices.data(),
+      reinterpret_cast<const tachyon_bn254_fr*>(numerators.data()),
+      denominators.empty()
+          ? nullptr
+          : reinterpret_cast<const tachyon_bn254_fr*>(denominators.data()),
+      numerators.size());
+}
+
 std::unique_ptr<RationalEvals> RationalEvals::clone() const {
   return std::make_unique<RationalEvals>(
       tachyon_bn254_univariate_rational_evaluations_clone(evals_));
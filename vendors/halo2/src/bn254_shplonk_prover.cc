@@ -1,5 +1,7 @@
 #include "vendors/halo2/include/bn254_shplonk_prover.h"
 
+#include <string>
+
 #include "tachyon/base/buffer/buffer.h"
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_evaluation_domain.h"
 #include "tachyon/rs/base/rust_vec.h"
@@ -191,6 +193,19 @@ rust::Vec<uint8_t> SHPlonkProver::get_proof() const {
   return proof;
 }
 
+void SHPlonkProver::enable_trace(bool enable) {
+  tachyon_halo2_bn254_shplonk_prover_enable_trace(prover_, enable);
+}
+
+rust::String SHPlonkProver::get_trace() const {
+  size_t trace_len;
+  tachyon_halo2_bn254_shplonk_prover_get_trace(prover_, nullptr, &trace_len);
+  std::string trace(trace_len, '\0');
+  tachyon_halo2_bn254_shplonk_prover_get_trace(prover_, trace.data(),
+                                              &trace_len);
+  return rust::String(trace);
+}
+
 std::unique_ptr<SHPlonkProver> new_shplonk_prover(uint8_t transcript_type,
                                                   uint32_t k, const Fr& s) {
   return std::make_unique<SHPlonkProver>(transcript_type, k, s);
@@ -35,7 +35,7 @@ fn shuffled<F: FieldExt, R: RngCore, const W: usize, const H: usize>(
 }
 
 #[derive(Clone)]
-struct MyConfig<const W: usize> {
+pub(crate) struct MyConfig<const W: usize> {
     q_shuffle: Selector,
     q_first: Selector,
     q_last: Selector,
@@ -109,13 +109,13 @@ impl<const W: usize> MyConfig<W> {
 }
 
 #[derive(Clone, Default)]
-struct MyCircuit<F: FieldExt, const W: usize, const H: usize> {
+pub(crate) struct MyCircuit<F: FieldExt, const W: usize, const H: usize> {
     original: Value<[[F; H]; W]>,
     shuffled: Value<[[F; H]; W]>,
 }
 
 impl<F: FieldExt, const W: usize, const H: usize> MyCircuit<F, W, H> {
-    fn rand<R: RngCore>(rng: &mut R) -> Self {
+    pub(crate) fn rand<R: RngCore>(rng: &mut R) -> Self {
         let original = rand_2d_array::<F, _, W, H>(rng);
         let shuffled = shuffled(original, rng);
 
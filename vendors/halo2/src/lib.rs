@@ -1,3 +1,4 @@
+mod batch_ops;
 mod bn254;
 mod circuits;
 mod consts;
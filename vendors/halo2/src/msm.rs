@@ -1,6 +1,6 @@
 #[cfg(test)]
 mod test {
-    use crate::bn254::{ffi, Fr as CppFr, G1Point2 as CppG1Point2};
+    use crate::bn254::{ffi, AsyncMSM, Fr as CppFr, G1Point2 as CppG1Point2};
     use halo2_proofs::arithmetic::best_multiexp;
     use halo2curves::{
         bn256::{Fr, G1Affine, G1},
@@ -81,6 +81,55 @@ mod test {
         }
     }
 
+    #[test]
+    fn test_async_msm() {
+        let degree = 10;
+        let n = 1usize << degree;
+
+        let test_sets = [TestSet::create(n), TestSet::create(n / 2)];
+        let expected: Vec<G1> = test_sets
+            .iter()
+            .map(|test_set| best_multiexp(&test_set.scalars, &test_set.bases))
+            .collect();
+
+        let msm = AsyncMSM::new(degree);
+        let mut timer = Timer::new();
+        let tickets: Vec<_> = test_sets
+            .iter()
+            .map(|test_set| msm.submit(&test_set.bases, &test_set.scalars))
+            .collect();
+        timer.end("submit");
+
+        timer.reset();
+        for (ticket, expected) in tickets.into_iter().zip(expected.iter()) {
+            assert_eq!(ticket.wait(), *expected);
+        }
+        timer.end("async_msm");
+
+        // A ticket that is dropped without being waited for is done anyway.
+        let ticket = msm.submit(&test_sets[0].bases, &test_sets[0].scalars);
+        drop(ticket);
+        let ticket = msm.submit(&test_sets[1].bases, &test_sets[1].scalars);
+        while !ticket.is_ready() {
+            std::thread::yield_now();
+        }
+        assert_eq!(ticket.wait(), expected[1]);
+    }
+
+    #[cfg(feature = "gpu")]
+    #[test]
+    fn test_async_msm_gpu() {
+        let degree = 10;
+        let n = 1usize << degree;
+
+        let test_set = TestSet::create(n);
+        let expected = best_multiexp(&test_set.scalars, &test_set.bases);
+
+        let msm = AsyncMSM::new_gpu(degree, 0);
+        let ticket = msm.submit(&test_set.bases, &test_set.scalars);
+        assert_eq!(ticket.wait(), expected);
+    }
+
     #[cfg(feature = "gpu")]
     #[test]
     fn test_msm_gpu() {
@@ -113,4 +162,36 @@ mod test {
 
         ffi::destroy_g1_msm_gpu(msm);
     }
+
+    #[cfg(feature = "gpu")]
+    #[test]
+    fn test_msm_gpu_with_resident_bases() {
+        let degree = 10;
+        let n = 1usize << degree;
+
+        let test_set = TestSet::create(n);
+        let expected = best_multiexp(&test_set.scalars, &test_set.bases);
+
+        let mut msm = ffi::create_g1_msm_gpu(degree, 0);
+        unsafe {
+            let bases: Vec<CppG1Point2> = mem::transmute(test_set.bases);
+            let scalars: Vec<CppFr> = mem::transmute(test_set.scalars);
+
+            let mut timer = Timer::new();
+            let handle = ffi::g1_point2_upload_bases_gpu(&mut *msm, &bases);
+            timer.end("upload_bases_gpu");
+            assert_eq!(ffi::g1_point2_upload_bases_gpu(&mut *msm, &bases), handle);
+
+            for _ in 0..2 {
+                timer.reset();
+                let actual = ffi::g1_msm_gpu_with_resident_bases(&mut *msm, handle, &scalars);
+                let actual: Box<G1> = mem::transmute(actual);
+                timer.end("msm_gpu_with_resident_bases");
+                assert_eq!(*actual, expected);
+            }
+
+            ffi::g1_release_bases_gpu(&mut *msm, handle);
+        }
+        ffi::destroy_g1_msm_gpu(msm);
+    }
 }
@@ -7,7 +7,7 @@ use std::{
 
 use crate::bn254::{
     AdviceSingle, Evals, InstanceSingle, ProvingKey as TachyonProvingKey, RationalEvals,
-    TachyonProver, TranscriptWriteState,
+    RationalEvalsBuffer, TachyonProver, TranscriptWriteState,
 };
 use crate::xor_shift_rng::XORShiftRng as TachyonXORShiftRng;
 use ff::Field;
@@ -25,6 +25,7 @@ use halo2curves::{
     group::{prime::PrimeCurveAffine, Curve},
     CurveAffine,
 };
+use tachyon_rs::base::cast_slice;
 
 /// This creates a proof for the provided `circuit` when given the public
 /// parameters `params` and the proving key [`ProvingKey`] that was
@@ -73,14 +74,12 @@ pub fn create_proof<
                         return Err(Error::InstanceTooLarge);
                     }
 
-                    for i in 0..values.len() {
-                        if !P::QUERY_INSTANCE {
-                            transcript.common_scalar(values[i])?;
+                    if !P::QUERY_INSTANCE {
+                        for value in values.iter() {
+                            transcript.common_scalar(*value)?;
                         }
-                        poly.set_value(i, unsafe {
-                            std::mem::transmute::<_, &halo2curves::bn256::Fr>(&values[i])
-                        });
                     }
+                    poly.set_values(0, unsafe { cast_slice::<_, Fr>(*values) });
                     Ok(poly)
                 })
                 .collect::<Result<Vec<_>, _>>()?;
@@ -120,6 +119,8 @@ pub fn create_proof<
         k: u32,
         current_phase: sealed::Phase,
         advice: Vec<RationalEvals>,
+        // The assignments to |advice| that are not set yet, one per column.
+        advice_buffers: Vec<RationalEvalsBuffer>,
         challenges: &'a HashMap<usize, F>,
         instances: &'a [&'a [F]],
         usable_rows: RangeTo<usize>,
@@ -195,18 +196,19 @@ pub fn create_proof<
                 .advice
                 .get_mut(column.index())
                 .ok_or(Error::BoundsFailure)?;
+            let buffer = &mut self.advice_buffers[column.index()];
 
             let value = to().into_field().assign()?;
             match &value {
-                Assigned::Zero => rational_evals.set_zero(row),
+                Assigned::Zero => buffer.push_zero(rational_evals, row),
                 Assigned::Trivial(numerator) => {
                     let numerator = unsafe { std::mem::transmute::<_, &Fr>(numerator) };
-                    rational_evals.set_trivial(row, numerator);
+                    buffer.push_trivial(rational_evals, row, numerator);
                 }
                 Assigned::Rational(numerator, denominator) => {
                     let numerator = unsafe { std::mem::transmute::<_, &Fr>(numerator) };
                     let denominator = unsafe { std::mem::transmute::<_, &Fr>(denominator) };
-                    rational_evals.set_rational(row, numerator, denominator)
+                    buffer.push_rational(rational_evals, row, numerator, denominator)
                 }
             }
 
@@ -313,6 +315,9 @@ pub fn create_proof<
                     k: prover.k(),
                     current_phase,
                     advice: vec![prover.empty_rational_evals(); num_advice_columns],
+                    advice_buffers: (0..num_advice_columns)
+                        .map(|_| RationalEvalsBuffer::new())
+                        .collect(),
                     instances,
                     challenges: &challenges,
                     // The prover will not be allowed to assign values to advice
@@ -330,6 +335,13 @@ pub fn create_proof<
                     config.clone(),
                     pk.constants(),
                 )?;
+                for (advice_col, buffer) in witness
+                    .advice
+                    .iter_mut()
+                    .zip(witness.advice_buffers.iter_mut())
+                {
+                    buffer.flush(advice_col);
+                }
 
                 #[cfg(feature = "phase-check")]
                 {
@@ -488,9 +500,7 @@ mod test {
         let domain = EvaluationDomain::new(1, k);
         let scalars = (0..N).map(|_| Fr::random(OsRng)).collect::<Vec<_>>();
         let mut evals = prover_from_s.empty_evals();
-        for i in 0..scalars.len() {
-            evals.set_value(i, &scalars[i]);
-        }
+        evals.set_values(0, &scalars);
         let lagrange = domain.lagrange_from_vec(scalars.clone());
         let expected_commitment = params.commit_lagrange(&lagrange, Blind::default());
         assert_eq!(prover_from_s.commit_lagrange(&evals), expected_commitment);
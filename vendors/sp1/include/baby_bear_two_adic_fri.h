@@ -0,0 +1,62 @@
+#ifndef VENDORS_SP1_INCLUDE_BABY_BEAR_TWO_ADIC_FRI_H_
+#define VENDORS_SP1_INCLUDE_BABY_BEAR_TWO_ADIC_FRI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include "rust/cxx.h"
+
+#include "tachyon/c/zk/air/sp1/baby_bear_poseidon2_two_adic_fri.h"
+
+namespace tachyon::sp1_api::baby_bear {
+
+struct BabyBear;
+
+class ProverData {
+ public:
+  explicit ProverData(tachyon_sp1_baby_bear_poseidon2_field_merkle_tree* tree)
+      : tree_(tree) {}
+  ProverData(const ProverData& other) = delete;
+  ProverData& operator=(const ProverData& other) = delete;
+  ~ProverData();
+
+  const tachyon_sp1_baby_bear_poseidon2_field_merkle_tree* tree() const {
+    return tree_;
+  }
+
+ private:
+  tachyon_sp1_baby_bear_poseidon2_field_merkle_tree* tree_;
+};
+
+class TwoAdicFri {
+ public:
+  // |round_constants| is empty to use the default round constants.
+  TwoAdicFri(uint32_t log_blowup, rust::Slice<const BabyBear> round_constants);
+  TwoAdicFri(const TwoAdicFri& other) = delete;
+  TwoAdicFri& operator=(const TwoAdicFri& other) = delete;
+  ~TwoAdicFri();
+
+  void coset_lde_batch(rust::Slice<const BabyBear> values, size_t cols,
+                       const BabyBear& shift,
+                       rust::Slice<BabyBear> extended_values) const;
+  // |values| are the matrices of |rows| x |cols| concatenated.
+  std::unique_ptr<ProverData> commit(rust::Slice<const BabyBear> values,
+                                     rust::Slice<const size_t> rows,
+                                     rust::Slice<const size_t> cols,
+                                     rust::Slice<BabyBear> commitment) const;
+  void open(const ProverData& prover_data, size_t index,
+            rust::Slice<BabyBear> openings,
+            rust::Slice<BabyBear> proof) const;
+
+ private:
+  tachyon_sp1_baby_bear_poseidon2_two_adic_fri* pcs_;
+};
+
+std::unique_ptr<TwoAdicFri> new_two_adic_fri(
+    uint32_t log_blowup, rust::Slice<const BabyBear> round_constants);
+
+}  // namespace tachyon::sp1_api::baby_bear
+
+#endif  // VENDORS_SP1_INCLUDE_BABY_BEAR_TWO_ADIC_FRI_H_
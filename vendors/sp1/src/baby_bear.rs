@@ -0,0 +1,252 @@
+use std::sync::Arc;
+
+use p3_commit::Mmcs;
+use p3_field::AbstractField;
+use p3_matrix::{dense::RowMajorMatrix, Dimensions, Matrix};
+use p3_symmetric::Hash;
+
+pub const DIGEST_ELEMS: usize = 8;
+
+/// An element of BabyBear in the Montgomery form, which is the same as the
+/// one of `p3_baby_bear::BabyBear`.
+#[repr(transparent)]
+pub struct BabyBear(pub u32);
+
+#[cxx::bridge(namespace = "tachyon::sp1_api::baby_bear")]
+pub mod ffi {
+    extern "Rust" {
+        type BabyBear;
+    }
+
+    unsafe extern "C++" {
+        include!("vendors/sp1/include/baby_bear_two_adic_fri.h");
+
+        type TwoAdicFri;
+        type ProverData;
+
+        fn new_two_adic_fri(log_blowup: u32, round_constants: &[BabyBear])
+            -> UniquePtr<TwoAdicFri>;
+        fn coset_lde_batch(
+            &self,
+            values: &[BabyBear],
+            cols: usize,
+            shift: &BabyBear,
+            extended_values: &mut [BabyBear],
+        );
+        fn commit(
+            &self,
+            values: &[BabyBear],
+            rows: &[usize],
+            cols: &[usize],
+            commitment: &mut [BabyBear],
+        ) -> UniquePtr<ProverData>;
+        fn open(
+            &self,
+            prover_data: &ProverData,
+            index: usize,
+            openings: &mut [BabyBear],
+            proof: &mut [BabyBear],
+        );
+    }
+}
+
+fn cpp_slice(values: &[p3_baby_bear::BabyBear]) -> &[BabyBear] {
+    unsafe { std::mem::transmute::<_, &[BabyBear]>(values) }
+}
+
+fn cpp_slice_mut(values: &mut [p3_baby_bear::BabyBear]) -> &mut [BabyBear] {
+    unsafe { std::mem::transmute::<_, &mut [BabyBear]>(values) }
+}
+
+fn cpp_digests_mut(digests: &mut [[p3_baby_bear::BabyBear; DIGEST_ELEMS]]) -> &mut [BabyBear] {
+    unsafe {
+        std::slice::from_raw_parts_mut(
+            digests.as_mut_ptr() as *mut BabyBear,
+            digests.len() * DIGEST_ELEMS,
+        )
+    }
+}
+
+/// Computes the low-degree extensions and the commitments of the
+/// `TwoAdicFriPcs` with tachyon.
+pub struct TwoAdicFri {
+    log_blowup: usize,
+    inner: cxx::UniquePtr<ffi::TwoAdicFri>,
+}
+
+// NOTE: `ffi::TwoAdicFri` is immutable once created.
+unsafe impl Send for TwoAdicFri {}
+unsafe impl Sync for TwoAdicFri {}
+
+impl TwoAdicFri {
+    /// `round_constants` are the round constants of the rounds of Poseidon2 in
+    /// order, or empty to use the default ones of tachyon.
+    pub fn new(
+        log_blowup: usize,
+        round_constants: &[[p3_baby_bear::BabyBear; 16]],
+    ) -> TwoAdicFri {
+        // The representations of BabyBear must be the same on both sides, where
+        // one is 2³² mod p in the Montgomery form.
+        debug_assert_eq!(
+            unsafe { std::mem::transmute::<_, u32>(p3_baby_bear::BabyBear::one()) },
+            ((1u64 << 32) % 0x7800_0001) as u32
+        );
+        let round_constants: Vec<p3_baby_bear::BabyBear> =
+            round_constants.iter().flatten().copied().collect();
+        TwoAdicFri {
+            log_blowup,
+            inner: ffi::new_two_adic_fri(log_blowup as u32, cpp_slice(&round_constants)),
+        }
+    }
+
+    pub fn log_blowup(&self) -> usize {
+        self.log_blowup
+    }
+
+    /// Returns the low-degree extension of `evals` over the coset of `shift` in
+    /// bit-reversed order.
+    pub fn coset_lde_batch(
+        &self,
+        evals: RowMajorMatrix<p3_baby_bear::BabyBear>,
+        shift: p3_baby_bear::BabyBear,
+    ) -> RowMajorMatrix<p3_baby_bear::BabyBear> {
+        let width = evals.width();
+        let mut extended_values =
+            p3_baby_bear::BabyBear::zero_vec(evals.values.len() << self.log_blowup);
+        self.inner.coset_lde_batch(
+            cpp_slice(&evals.values),
+            width,
+            &BabyBear(unsafe { std::mem::transmute::<_, u32>(shift) }),
+            cpp_slice_mut(&mut extended_values),
+        );
+        RowMajorMatrix::new(extended_values, width)
+    }
+}
+
+pub struct TachyonProverData<M> {
+    matrices: Vec<M>,
+    inner: Arc<cxx::UniquePtr<ffi::ProverData>>,
+}
+
+// NOTE: `ffi::ProverData` is immutable once created.
+unsafe impl<M: Send> Send for TachyonProverData<M> {}
+unsafe impl<M: Sync> Sync for TachyonProverData<M> {}
+
+impl<M: Clone> Clone for TachyonProverData<M> {
+    fn clone(&self) -> Self {
+        TachyonProverData {
+            matrices: self.matrices.clone(),
+            inner: self.inner.clone(),
+        }
+    }
+}
+
+/// A `Mmcs` that commits to and opens the matrices with the field merkle tree
+/// of tachyon, while the verification is delegated to `inner`, which must be
+/// the `FieldMerkleTreeMmcs` of the same Poseidon2.
+#[derive(Clone)]
+pub struct TachyonMmcs<InnerMmcs> {
+    fri: Arc<TwoAdicFri>,
+    inner: InnerMmcs,
+}
+
+impl<InnerMmcs> TachyonMmcs<InnerMmcs> {
+    pub fn new(fri: Arc<TwoAdicFri>, inner: InnerMmcs) -> Self {
+        TachyonMmcs { fri, inner }
+    }
+
+    pub fn fri(&self) -> &TwoAdicFri {
+        &self.fri
+    }
+}
+
+impl<InnerMmcs> Mmcs<p3_baby_bear::BabyBear> for TachyonMmcs<InnerMmcs>
+where
+    InnerMmcs: Mmcs<
+        p3_baby_bear::BabyBear,
+        Commitment = Hash<p3_baby_bear::BabyBear, p3_baby_bear::BabyBear, DIGEST_ELEMS>,
+        Proof = Vec<[p3_baby_bear::BabyBear; DIGEST_ELEMS]>,
+    >,
+{
+    type ProverData<M> = TachyonProverData<M>;
+    type Commitment = InnerMmcs::Commitment;
+    type Proof = InnerMmcs::Proof;
+    type Error = InnerMmcs::Error;
+
+    fn commit<M: Matrix<p3_baby_bear::BabyBear>>(
+        &self,
+        inputs: Vec<M>,
+    ) -> (Self::Commitment, Self::ProverData<M>) {
+        // The matrices are concatenated, so that they cross the FFI boundary
+        // with a single call.
+        let len = inputs.iter().map(|m| m.width() * m.height()).sum();
+        let mut values = Vec::with_capacity(len);
+        for m in inputs.iter() {
+            for r in 0..m.height() {
+                values.extend(m.row(r));
+            }
+        }
+        let rows: Vec<usize> = inputs.iter().map(|m| m.height()).collect();
+        let cols: Vec<usize> = inputs.iter().map(|m| m.width()).collect();
+        let mut commitment = [p3_baby_bear::BabyBear::zero(); DIGEST_ELEMS];
+        let inner = self.fri.inner.commit(
+            cpp_slice(&values),
+            &rows,
+            &cols,
+            cpp_slice_mut(&mut commitment),
+        );
+        (
+            commitment.into(),
+            TachyonProverData {
+                matrices: inputs,
+                inner: Arc::new(inner),
+            },
+        )
+    }
+
+    fn open_batch<M: Matrix<p3_baby_bear::BabyBear>>(
+        &self,
+        index: usize,
+        prover_data: &Self::ProverData<M>,
+    ) -> (Vec<Vec<p3_baby_bear::BabyBear>>, Self::Proof) {
+        let widths: Vec<usize> = prover_data.matrices.iter().map(|m| m.width()).collect();
+        let log_max_height = p3_util::log2_strict_usize(self.get_max_height(prover_data));
+        let mut openings = p3_baby_bear::BabyBear::zero_vec(widths.iter().sum());
+        let mut proof = vec![[p3_baby_bear::BabyBear::zero(); DIGEST_ELEMS]; log_max_height];
+        self.fri.inner.open(
+            &prover_data.inner,
+            index,
+            cpp_slice_mut(&mut openings),
+            cpp_digests_mut(&mut proof),
+        );
+        let mut offset = 0;
+        let openings = widths
+            .into_iter()
+            .map(|width| {
+                let row = openings[offset..offset + width].to_vec();
+                offset += width;
+                row
+            })
+            .collect();
+        (openings, proof)
+    }
+
+    fn get_matrices<'a, M: Matrix<p3_baby_bear::BabyBear>>(
+        &self,
+        prover_data: &'a Self::ProverData<M>,
+    ) -> Vec<&'a M> {
+        prover_data.matrices.iter().collect()
+    }
+
+    fn verify_batch(
+        &self,
+        commit: &Self::Commitment,
+        dimensions: &[Dimensions],
+        index: usize,
+        opened_values: &[Vec<p3_baby_bear::BabyBear>],
+        proof: &Self::Proof,
+    ) -> Result<(), Self::Error> {
+        self.inner
+            .verify_batch(commit, dimensions, index, opened_values, proof)
+    }
+}
@@ -0,0 +1,92 @@
+#include "vendors/sp1/include/baby_bear_two_adic_fri.h"
+
+#include <vector>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "vendors/sp1/src/baby_bear.rs.h"
+
+namespace tachyon::sp1_api::baby_bear {
+
+namespace {
+
+const tachyon_baby_bear* c_cast(const BabyBear* value) {
+  return reinterpret_cast<const tachyon_baby_bear*>(value);
+}
+
+tachyon_baby_bear* c_cast(BabyBear* value) {
+  return reinterpret_cast<tachyon_baby_bear*>(value);
+}
+
+}  // namespace
+
+ProverData::~ProverData() {
+  tachyon_sp1_baby_bear_poseidon2_field_merkle_tree_destroy(tree_);
+}
+
+TwoAdicFri::TwoAdicFri(uint32_t log_blowup,
+                       rust::Slice<const BabyBear> round_constants) {
+  if (round_constants.empty()) {
+    pcs_ = tachyon_sp1_baby_bear_poseidon2_two_adic_fri_create(log_blowup,
+                                                                nullptr);
+    return;
+  }
+  CHECK_EQ(round_constants.size(),
+           size_t{TACHYON_SP1_BABY_BEAR_POSEIDON2_ROUNDS *
+                  TACHYON_SP1_BABY_BEAR_POSEIDON2_WIDTH});
+  pcs_ = tachyon_sp1_baby_bear_poseidon2_two_adic_fri_create(
+      log_blowup, c_cast(round_constants.data()));
+}
+
+TwoAdicFri::~TwoAdicFri() {
+  tachyon_sp1_baby_bear_poseidon2_two_adic_fri_destroy(pcs_);
+}
+
+void TwoAdicFri::coset_lde_batch(rust::Slice<const BabyBear> values,
+                                 size_t cols, const BabyBear& shift,
+                                 rust::Slice<BabyBear> extended_values) const {
+  CHECK_NE(cols, size_t{0});
+  CHECK_EQ(values.size() % cols, size_t{0});
+  size_t rows = values.size() / cols;
+  CHECK_EQ(extended_values.size() % values.size(), size_t{0});
+  CHECK(base::bits::IsPowerOfTwo(extended_values.size() / values.size()));
+  tachyon_sp1_baby_bear_poseidon2_two_adic_fri_coset_lde_batch(
+      pcs_, c_cast(values.data()), rows, cols, *c_cast(&shift),
+      c_cast(extended_values.data()));
+}
+
+std::unique_ptr<ProverData> TwoAdicFri::commit(
+    rust::Slice<const BabyBear> values, rust::Slice<const size_t> rows,
+    rust::Slice<const size_t> cols, rust::Slice<BabyBear> commitment) const {
+  CHECK_EQ(rows.size(), cols.size());
+  CHECK_EQ(commitment.size(),
+           size_t{TACHYON_SP1_BABY_BEAR_POSEIDON2_DIGEST_SIZE});
+  std::vector<const tachyon_baby_bear*> matrices(rows.size());
+  size_t offset = 0;
+  for (size_t i = 0; i < rows.size(); ++i) {
+    matrices[i] = c_cast(values.data() + offset);
+    offset += rows[i] * cols[i];
+  }
+  CHECK_EQ(offset, values.size());
+  return std::make_unique<ProverData>(
+      tachyon_sp1_baby_bear_poseidon2_two_adic_fri_commit(
+          pcs_, matrices.data(), rows.data(), cols.data(), rows.size(),
+          c_cast(commitment.data())));
+}
+
+void TwoAdicFri::open(const ProverData& prover_data, size_t index,
+                      rust::Slice<BabyBear> openings,
+                      rust::Slice<BabyBear> proof) const {
+  // NOTE: The sizes of |openings| and |proof| are checked by the caller,
+  // which knows the dimensions of the committed matrices.
+  tachyon_sp1_baby_bear_poseidon2_two_adic_fri_open(
+      pcs_, prover_data.tree(), index, c_cast(openings.data()),
+      c_cast(proof.data()));
+}
+
+std::unique_ptr<TwoAdicFri> new_two_adic_fri(
+    uint32_t log_blowup, rust::Slice<const BabyBear> round_constants) {
+  return std::make_unique<TwoAdicFri>(log_blowup, round_constants);
+}
+
+}  // namespace tachyon::sp1_api::baby_bear
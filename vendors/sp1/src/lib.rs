@@ -1,3 +1,4 @@
+pub mod baby_bear;
 pub mod sp1;
 
 #[cfg(test)]
@@ -1,46 +1,72 @@
-use std::marker::PhantomData;
+use std::sync::Arc;
 
+use p3_baby_bear::BabyBear;
 use p3_challenger::{CanObserve, CanSample, GrindingChallenger};
 use p3_commit::{Mmcs, OpenedValues, Pcs, PolynomialSpace, TwoAdicMultiplicativeCoset};
-use p3_dft::TwoAdicSubgroupDft;
-use p3_field::{ExtensionField, TwoAdicField};
-use p3_fri::{FriConfig, TwoAdicFriPcsProof, VerificationError};
-use p3_matrix::bitrev::BitReversableMatrix;
+use p3_field::{
+    batch_multiplicative_inverse, cyclic_subgroup_coset_known_order, AbstractField,
+    ExtensionField, TwoAdicField,
+};
+use p3_fri::{prover, BatchOpening, FriConfig, TwoAdicFriPcsProof, VerificationError};
+use p3_interpolation::interpolate_coset;
+use p3_matrix::bitrev::{BitReversableMatrix, BitReversedMatrixView};
 use p3_matrix::dense::RowMajorMatrix;
 use p3_matrix::Matrix;
-use p3_util::log2_strict_usize;
+use p3_maybe_rayon::prelude::*;
+use p3_util::{log2_strict_usize, reverse_slice_index_bits};
 
+use crate::baby_bear::{TachyonMmcs, TwoAdicFri};
+
+type Val = BabyBear;
+
+/// The `TwoAdicFriPcs` over BabyBear whose low-degree extensions and input
+/// commitments are computed by tachyon. `InputMmcs` is the `Mmcs` of plonky3
+/// of the same Poseidon2, which only verifies the openings.
 #[derive(Debug)]
-pub struct TwoAdicFriPcs<Val, Dft, InputMmcs, FriMmcs> {
+pub struct TwoAdicFriPcs<InputMmcs, FriMmcs> {
     // degree bound
     log_n: usize,
-    dft: Dft,
-    mmcs: InputMmcs,
+    mmcs: TachyonMmcs<InputMmcs>,
     fri: FriConfig<FriMmcs>,
-    _phantom: PhantomData<Val>,
 }
 
-impl<Val, Dft, InputMmcs, FriMmcs, Challenge, Challenger> Pcs<Challenge, Challenger>
-    for TwoAdicFriPcs<Val, Dft, InputMmcs, FriMmcs>
+impl<InputMmcs, FriMmcs> TwoAdicFriPcs<InputMmcs, FriMmcs> {
+    /// `round_constants` are the round constants of Poseidon2 of `mmcs`, or
+    /// empty to use the default ones of tachyon.
+    pub fn new(
+        log_n: usize,
+        mmcs: InputMmcs,
+        fri: FriConfig<FriMmcs>,
+        round_constants: &[[Val; 16]],
+    ) -> Self {
+        let two_adic_fri = Arc::new(TwoAdicFri::new(fri.log_blowup, round_constants));
+        Self {
+            log_n,
+            mmcs: TachyonMmcs::new(two_adic_fri, mmcs),
+            fri,
+        }
+    }
+}
+
+impl<InputMmcs, FriMmcs, Challenge, Challenger> Pcs<Challenge, Challenger>
+    for TwoAdicFriPcs<InputMmcs, FriMmcs>
 where
-    Val: TwoAdicField,
-    Dft: TwoAdicSubgroupDft<Val>,
-    InputMmcs: Mmcs<Val>,
+    TachyonMmcs<InputMmcs>: Mmcs<Val>,
     FriMmcs: Mmcs<Challenge>,
     Challenge: TwoAdicField + ExtensionField<Val>,
     Challenger:
         CanObserve<FriMmcs::Commitment> + CanSample<Challenge> + GrindingChallenger<Witness = Val>,
-    <InputMmcs as Mmcs<Val>>::ProverData<RowMajorMatrix<Val>>: Clone,
+    <TachyonMmcs<InputMmcs> as Mmcs<Val>>::ProverData<RowMajorMatrix<Val>>: Clone,
 {
     type Domain = TwoAdicMultiplicativeCoset<Val>;
 
-    type Commitment = InputMmcs::Commitment;
+    type Commitment = <TachyonMmcs<InputMmcs> as Mmcs<Val>>::Commitment;
 
-    type ProverData = InputMmcs::ProverData<RowMajorMatrix<Val>>;
+    type ProverData = <TachyonMmcs<InputMmcs> as Mmcs<Val>>::ProverData<RowMajorMatrix<Val>>;
 
-    type Proof = TwoAdicFriPcsProof<Val, Challenge, InputMmcs, FriMmcs>;
+    type Proof = TwoAdicFriPcsProof<Val, Challenge, TachyonMmcs<InputMmcs>, FriMmcs>;
 
-    type Error = VerificationError<InputMmcs::Error, FriMmcs::Error>;
+    type Error = VerificationError<<TachyonMmcs<InputMmcs> as Mmcs<Val>>::Error, FriMmcs::Error>;
 
     fn natural_domain_for_degree(&self, degree: usize) -> Self::Domain {
         let log_n = log2_strict_usize(degree);
@@ -63,10 +89,7 @@ where
                 assert!(log_n <= self.log_n);
                 let shift = Val::generator() / domain.shift;
                 // Commit to the bit-reversed LDE.
-                self.dft
-                    .coset_lde_batch(evals, self.fri.log_blowup, shift)
-                    .bit_reverse_rows()
-                    .to_row_major_matrix()
+                self.mmcs.fri().coset_lde_batch(evals, shift)
             })
             .collect();
 
@@ -86,6 +109,8 @@ where
         lde.split_rows(domain.size()).0.bit_reverse_rows()
     }
 
+    // This is taken and modified from the `TwoAdicFriPcs::open()` of plonky3,
+    // except that the input matrices are opened by tachyon.
     fn open(
         &self,
         // For each round,
@@ -99,7 +124,108 @@ where
         )>,
         challenger: &mut Challenger,
     ) -> (OpenedValues<Challenge>, Self::Proof) {
-        todo!()
+        // Batch combination challenge
+        let alpha: Challenge = challenger.sample();
+
+        let mats_and_points: Vec<(Vec<&RowMajorMatrix<Val>>, &Vec<Vec<Challenge>>)> = rounds
+            .iter()
+            .map(|(data, points)| (self.mmcs.get_matrices(data), points))
+            .collect();
+
+        let global_max_height = mats_and_points
+            .iter()
+            .flat_map(|(mats, _)| mats.iter().map(|m| m.height()))
+            .max()
+            .unwrap();
+        let log_global_max_height = log2_strict_usize(global_max_height);
+
+        // For each unique opening point z, we will find the largest degree bound
+        // for that point, and precompute 1/(X - z) for the largest subgroup (in bitrev order).
+        let inv_denoms = compute_inverse_denominators(&mats_and_points, Val::generator());
+
+        let mut all_opened_values: OpenedValues<Challenge> = vec![];
+
+        let mut reduced_openings: [Option<Vec<Challenge>>; 32] = core::array::from_fn(|_| None);
+        let mut num_reduced = [0; 32];
+
+        for (mats, points) in mats_and_points.iter() {
+            let mut opened_values_for_round = vec![];
+            for (mat, points_for_mat) in mats.iter().zip(points.iter()) {
+                let log_height = log2_strict_usize(mat.height());
+                let reduced_opening_for_log_height = reduced_openings[log_height]
+                    .get_or_insert_with(|| vec![Challenge::zero(); mat.height()]);
+                debug_assert_eq!(reduced_opening_for_log_height.len(), mat.height());
+
+                let alpha_powers: Vec<Challenge> = alpha.powers().take(mat.width()).collect();
+                let mut opened_values_for_mat = vec![];
+                for &point in points_for_mat {
+                    // Use Barycentric interpolation to evaluate the matrix at the given point.
+                    let (low_coset, _) = mat.split_rows(mat.height() >> self.fri.log_blowup);
+                    let ys = interpolate_coset(
+                        &BitReversedMatrixView::new(low_coset),
+                        Val::generator(),
+                        point,
+                    );
+
+                    let alpha_pow_offset = alpha.exp_u64(num_reduced[log_height] as u64);
+                    let reduced_ys: Challenge =
+                        ys.iter().zip(alpha_powers.iter()).map(|(&y, &a)| a * y).sum();
+                    let inv_denom = &lookup(&inv_denoms, &point).unwrap()[..mat.height()];
+
+                    reduced_opening_for_log_height
+                        .par_iter_mut()
+                        .zip(inv_denom.par_iter())
+                        .enumerate()
+                        .for_each(|(r, (ro, &inv_denom))| {
+                            let reduced_row: Challenge = mat
+                                .row(r)
+                                .into_iter()
+                                .zip(alpha_powers.iter())
+                                .map(|(v, &a)| a * v)
+                                .sum();
+                            *ro += alpha_pow_offset * (reduced_ys - reduced_row) * inv_denom
+                        });
+
+                    num_reduced[log_height] += mat.width();
+                    opened_values_for_mat.push(ys);
+                }
+                opened_values_for_round.push(opened_values_for_mat);
+            }
+            all_opened_values.push(opened_values_for_round);
+        }
+
+        let fri_input: Vec<Vec<Challenge>> =
+            reduced_openings.into_iter().rev().flatten().collect();
+
+        let (fri_proof, query_indices) = prover::prove(&self.fri, &fri_input, challenger);
+
+        let query_openings = query_indices
+            .into_iter()
+            .map(|index| {
+                rounds
+                    .iter()
+                    .map(|(data, _)| {
+                        let log_max_height = log2_strict_usize(self.mmcs.get_max_height(data));
+                        let bits_reduced = log_global_max_height - log_max_height;
+                        let reduced_index = index >> bits_reduced;
+                        let (opened_values, opening_proof) =
+                            self.mmcs.open_batch(reduced_index, data);
+                        BatchOpening {
+                            opened_values,
+                            opening_proof,
+                        }
+                    })
+                    .collect()
+            })
+            .collect();
+
+        (
+            all_opened_values,
+            TwoAdicFriPcsProof {
+                fri_proof,
+                query_openings,
+            },
+        )
     }
 
     fn verify(
@@ -126,3 +252,48 @@ where
         todo!()
     }
 }
+
+fn lookup<'a, K: PartialEq, V>(map: &'a [(K, V)], key: &K) -> Option<&'a V> {
+    map.iter().find(|(k, _)| k == key).map(|(_, v)| v)
+}
+
+// Returns 1/(X - z) over the largest subgroup in bitrev order for each unique
+// opening point z, which is a short list, so it is searched linearly.
+fn compute_inverse_denominators<F: TwoAdicField, EF: ExtensionField<F>, M: Matrix<F>>(
+    mats_and_points: &[(Vec<&M>, &Vec<Vec<EF>>)],
+    coset_shift: F,
+) -> Vec<(EF, Vec<EF>)> {
+    let mut max_log_height_for_point: Vec<(EF, usize)> = vec![];
+    for (mats, points) in mats_and_points {
+        for (mat, points_for_mat) in mats.iter().zip(points.iter()) {
+            let log_height = log2_strict_usize(mat.height());
+            for &z in points_for_mat {
+                match max_log_height_for_point.iter_mut().find(|(p, _)| *p == z) {
+                    Some((_, lh)) => *lh = core::cmp::max(*lh, log_height),
+                    None => max_log_height_for_point.push((z, log_height)),
+                }
+            }
+        }
+    }
+
+    // Compute the largest subgroup we will use, in bitrev order.
+    let max_log_height = max_log_height_for_point.iter().map(|(_, lh)| *lh).max().unwrap();
+    let mut subgroup: Vec<F> = cyclic_subgroup_coset_known_order(
+        F::two_adic_generator(max_log_height),
+        coset_shift,
+        1 << max_log_height,
+    )
+    .collect();
+    reverse_slice_index_bits(&mut subgroup);
+
+    max_log_height_for_point
+        .into_iter()
+        .map(|(z, log_height)| {
+            let denoms: Vec<EF> = subgroup[..(1 << log_height)]
+                .iter()
+                .map(|&x| EF::from_base(x) - z)
+                .collect();
+            (z, batch_multiplicative_inverse(&denoms))
+        })
+        .collect()
+}